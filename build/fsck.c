@@ -0,0 +1,387 @@
+#define _LARGEFILE_SOURCE 1
+#define _FILE_OFFSET_BITS 64
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <inttypes.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <ctype.h>
+#include <errno.h>
+#include <stdarg.h>
+#define FS_HOST_TOOL 1
+#include "filesystem.h"
+
+/* This program checks a RojocOS filesystem image and reports its layout.
+ * It takes the disk image and, optionally, the sector where the
+ * filesystem starts ("@1024" for weensyos.img, as with mkbootdisk).
+ *
+ * A committed but unretired journal record is applied in memory before
+ * checking, exactly as fs_init would at the next boot; the image itself
+ * is never modified.
+ *
+ * Checks: the tree is a tree (every used node reachable exactly once, no
+ * dangling or duplicate entries), inode reference counts match the tree,
+ * and the block tables agree with the inode extents (a block shared by
+ * clones holds one reference per inode).
+ * Reports: per-file extents, the free-run histogram, and the number of
+ * bytes moved by copy_block relocations.
+ *
+ * Exit status is 0 if the image is clean, 1 if errors were found, and 2
+ * if it could not be read.
+ */
+
+#define SECTORSIZE 512
+#define MAX_ENTITY_COUNT (1U << 20)
+#define NHISTOGRAM 16
+
+static int diskfd;
+static off_t fsbase;
+static unsigned nerrors;
+
+static fs_descriptor fsdesc;
+static uint8_t *meta;           // metadata regions, [0, journal_offset)
+static fs_node_t *nodes;
+static fs_inode_entry *inodes;
+static uint32_t *node_refs;     // tree entries pointing at each node
+static uint32_t *inode_refs;    // tree nodes pointing at each inode
+static int64_t *block_owner;    // first inode claiming each block, or -1
+static uint32_t *block_refs;    // number of inodes claiming each block
+
+
+static void usage(void) {
+    fprintf(stderr, "Usage: fsck IMAGE [@SECNUM]\n");
+    exit(2);
+}
+
+static void error(const char *format, ...) __attribute__((format(printf, 1, 2)));
+static void error(const char *format, ...) {
+    va_list val;
+    va_start(val, format);
+    printf("error: ");
+    vprintf(format, val);
+    printf("\n");
+    va_end(val);
+    ++nerrors;
+}
+
+static void diskread(void *buf, uint64_t start, size_t size) {
+    while (size > 0) {
+        ssize_t r = pread(diskfd, buf, size, fsbase + (off_t) start);
+        if (r == -1 && errno != EINTR) {
+            perror("read");
+            exit(2);
+        } else if (r == 0) {
+            fprintf(stderr, "fsck: image ends at offset %" PRIu64 "\n", (uint64_t) fsbase + start);
+            exit(2);
+        } else if (r > 0) {
+            buf = (unsigned char *) buf + r;
+            start += r;
+            size -= r;
+        }
+    }
+}
+
+static void *xcalloc(size_t n, size_t size) {
+    void *p = calloc(n ? n : 1, size);
+    if (!p) {
+        perror("calloc");
+        exit(2);
+    }
+    return p;
+}
+
+
+// Journal: same format and checksum as lib-filesystem/filesystem.c
+
+static uint32_t journal_checksum(const uint8_t *data, size_t size) {
+    uint32_t h = 2166136261U; // FNV-1a
+    for (size_t i = 0; i < size; i++) {
+        h ^= data[i];
+        h *= 16777619U;
+    }
+    return h;
+}
+
+static void journal_overlay(void) {
+    fs_journal_header header;
+    diskread(&header, fsdesc.journal_offset, sizeof(header));
+    if (header.magic != FS_JOURNAL_MAGIC) {
+        return;
+    }
+
+    if (header.length > FS_JOURNAL_CAPACITY) {
+        printf("journal: record %u has bad length %u, ignored\n", header.sequence, header.length);
+        return;
+    }
+
+    uint8_t *buf = xcalloc(header.length, 1);
+    diskread(buf, fsdesc.journal_offset + sizeof(header), header.length);
+    if (journal_checksum(buf, header.length) != header.checksum) {
+        printf("journal: record %u is torn, ignored\n", header.sequence);
+        free(buf);
+        return;
+    }
+
+    printf("journal: applying committed record %u (%u bytes)\n", header.sequence, header.length);
+    size_t pos = 0;
+    while (pos + sizeof(fs_journal_record) <= header.length) {
+        fs_journal_record *rec = (fs_journal_record *) &buf[pos];
+        if (pos + sizeof(*rec) + rec->size > header.length
+            || (uint64_t) rec->offset + rec->size > fsdesc.journal_offset) {
+            error("journal record at %zu writes outside the metadata regions", pos);
+            break;
+        }
+        memcpy(meta + rec->offset, rec + 1, rec->size);
+        pos += sizeof(*rec) + ((rec->size + 3) & ~3U);
+    }
+    free(buf);
+}
+
+
+// Tree
+
+static void check_node(uint32_t index, char *path, size_t pathlen) {
+    fs_node_t *node = &nodes[index];
+
+    if (node->value >= fsdesc.metadata.inode_count) {
+        error("%s: node %u points to inode %u (inode_count %u)", path, index,
+              node->value, fsdesc.metadata.inode_count);
+    } else if (node->value) {
+        ++inode_refs[node->value];
+    }
+
+    if (node->children_count < 0 || node->children_count > FS_MAX_CHILDREN) {
+        error("%s: node %u has %d children", path, index, node->children_count);
+        return;
+    }
+    if (node->value && node->children_count) {
+        error("%s: file node %u has %d children", path, index, node->children_count);
+    }
+
+    for (int i = 0; i < node->children_count; i++) {
+        fd_node_child_t *child = &node->children[i];
+        size_t namelen = strnlen(child->name, FS_NAME_SIZE);
+
+        if (namelen == 0 || namelen == FS_NAME_SIZE) {
+            error("%s: node %u entry %d has a bad name", path, index, i);
+            continue;
+        }
+        for (int j = 0; j < i; j++) {
+            if (strncmp(node->children[j].name, child->name, FS_NAME_SIZE) == 0) {
+                error("%s: duplicate entry \"%s\"", path, child->name);
+            }
+        }
+        if (child->index == 0 || child->index >= fsdesc.metadata.node_count) {
+            error("%s: entry \"%s\" points to node %u", path, child->name, child->index);
+            continue;
+        }
+        if (node_refs[child->index]++) {
+            error("%s: entry \"%s\" points to node %u, which is already linked",
+                  path, child->name, child->index);
+            continue;
+        }
+
+        size_t sublen = pathlen + (pathlen > 1) + namelen;
+        char *subpath = xcalloc(sublen + 1, 1);
+        snprintf(subpath, sublen + 1, "%s%s%s", path, pathlen > 1 ? "/" : "", child->name);
+        check_node(child->index, subpath, sublen);
+        free(subpath);
+    }
+}
+
+static void print_files(uint32_t index, const char *path) {
+    fs_node_t *node = &nodes[index];
+
+    if (node->value && node->value < fsdesc.metadata.inode_count) {
+        fs_inode_entry *entry = &inodes[node->value];
+        printf("  %-32s %5u %10" PRIu64 " %6u %7u %6u\n", path, node->value,
+               entry->size, entry->block_count, entry->block_count ? 1 : 0,
+               entry->start_block);
+        return;
+    }
+
+    if (node->children_count < 0 || node->children_count > FS_MAX_CHILDREN) {
+        return;
+    }
+    for (int i = 0; i < node->children_count; i++) {
+        fd_node_child_t *child = &node->children[i];
+        if (child->index == 0 || child->index >= fsdesc.metadata.node_count
+            || node_refs[child->index] != 1
+            || strnlen(child->name, FS_NAME_SIZE) == FS_NAME_SIZE) {
+            continue;
+        }
+
+        char subpath[4096];
+        snprintf(subpath, sizeof(subpath), "%s%s%s", path, strcmp(path, "/") ? "/" : "", child->name);
+        print_files(child->index, subpath);
+    }
+}
+
+
+int main(int argc, char *argv[]) {
+    char *str;
+    unsigned long sector = 0;
+
+    if (argc < 2 || argc > 3) {
+        usage();
+    }
+    if (argc == 3) {
+        if (argv[2][0] != '@' || !isdigit((unsigned char) argv[2][1])
+            || ((sector = strtoul(argv[2] + 1, &str, 0)), *str != 0)) {
+            usage();
+        }
+    }
+    if ((diskfd = open(argv[1], O_RDONLY)) < 0) {
+        fprintf(stderr, "%s: %s\n", argv[1], strerror(errno));
+        usage();
+    }
+    fsbase = (off_t) sector * SECTORSIZE;
+
+    diskread(&fsdesc.metadata, 0, sizeof(fs_metadata));
+    if (fsdesc.metadata.block_count == 0) {
+        printf("%s: unformatted filesystem (fs_init will format it)\n", argv[1]);
+        return 0;
+    }
+    if (fsdesc.metadata.inode_count > MAX_ENTITY_COUNT
+        || fsdesc.metadata.block_count > MAX_ENTITY_COUNT
+        || fsdesc.metadata.node_count == 0
+        || fsdesc.metadata.node_count > MAX_ENTITY_COUNT) {
+        fprintf(stderr, "%s: bad geometry: %u inodes, %u blocks, %u nodes\n", argv[1],
+                fsdesc.metadata.inode_count, fsdesc.metadata.block_count,
+                fsdesc.metadata.node_count);
+        return 2;
+    }
+    fs_layout(&fsdesc);
+
+    const fs_metadata *m = &fsdesc.metadata;
+    printf("geometry: %u inodes, %u blocks, %u nodes\n", m->inode_count, m->block_count, m->node_count);
+    printf("layout: inodes @%" PRIuPTR ", block usage @%" PRIuPTR ", available blocks @%" PRIuPTR
+           ", tree usage @%" PRIuPTR ", tree @%" PRIuPTR ", journal @%" PRIuPTR ", data @%" PRIuPTR "\n",
+           fsdesc.inode_table_offset, fsdesc.block_usage_offset, fsdesc.avail_block_table_offset,
+           fsdesc.tree_usage_offset, fsdesc.tree_offset, fsdesc.journal_offset, fsdesc.data_offset);
+
+    struct stat st;
+    if (fstat(diskfd, &st) == 0 && S_ISREG(st.st_mode)
+        && (uint64_t) st.st_size < (uint64_t) fsbase + fsdesc.data_offset
+                                   + (uint64_t) m->block_count * FS_BLOCK_SIZE) {
+        error("image is too small for %u data blocks", m->block_count);
+    }
+
+    meta = xcalloc(fsdesc.journal_offset, 1);
+    diskread(meta, 0, fsdesc.journal_offset);
+    journal_overlay();
+    memcpy(&fsdesc.metadata, meta, sizeof(fs_metadata));
+
+    inodes = (fs_inode_entry *) (meta + fsdesc.inode_table_offset);
+    nodes = (fs_node_t *) (meta + fsdesc.tree_offset);
+    const uint8_t *block_usage = meta + fsdesc.block_usage_offset;
+    const uint8_t *avail = meta + fsdesc.avail_block_table_offset;
+    const uint8_t *tree_usage = meta + fsdesc.tree_usage_offset;
+
+    node_refs = xcalloc(m->node_count, sizeof(uint32_t));
+    inode_refs = xcalloc(m->inode_count, sizeof(uint32_t));
+    block_owner = xcalloc(m->block_count, sizeof(int64_t));
+    block_refs = xcalloc(m->block_count, sizeof(uint32_t));
+
+
+    // 1. tree
+    node_refs[0] = 1;
+    check_node(0, "/", 1);
+    for (uint32_t i = 1; i < m->node_count; i++) {
+        if (node_refs[i] && !tree_usage[i]) {
+            error("node %u is linked but marked free", i);
+        } else if (!node_refs[i] && tree_usage[i]) {
+            error("node %u is marked used but unreachable", i);
+        }
+    }
+
+    // 2. inodes and their extents
+    for (uint32_t b = 0; b < m->block_count; b++) {
+        block_owner[b] = -1;
+    }
+    if (m->inode_count && inodes[0].ref) {
+        error("inode 0 is reserved but has %u references", inodes[0].ref);
+    }
+    for (uint32_t i = 1; i < m->inode_count; i++) {
+        fs_inode_entry *entry = &inodes[i];
+
+        if (entry->ref != inode_refs[i]) {
+            error("inode %u has refcount %u, but %u tree references", i, entry->ref, inode_refs[i]);
+        }
+        if (!entry->ref) {
+            continue;
+        }
+        if (entry->size > (uint64_t) entry->block_count * FS_BLOCK_SIZE) {
+            error("inode %u has size %" PRIu64 " but only %u blocks", i, entry->size, entry->block_count);
+        }
+        if ((uint64_t) entry->start_block + entry->block_count > m->block_count) {
+            error("inode %u extent [%u, %u) is out of range", i, entry->start_block,
+                  entry->start_block + entry->block_count);
+            continue;
+        }
+        // blocks shared by clones have one reference per inode
+        for (uint32_t b = entry->start_block; b < entry->start_block + entry->block_count; b++) {
+            if (block_refs[b]++ == 0) {
+                block_owner[b] = i;
+            }
+        }
+    }
+
+    // 3. block tables
+    uint32_t nowned = 0, nwritten = 0;
+    for (uint32_t b = 0; b < m->block_count; b++) {
+        if (block_owner[b] >= 0) {
+            ++nowned;
+            if (!avail[b]) {
+                error("block %u belongs to inode %" PRId64 " but is marked available", b, block_owner[b]);
+            } else if (avail[b] != block_refs[b]) {
+                error("block %u is claimed by %u inodes but has %u references", b, block_refs[b], avail[b]);
+            }
+        } else if (avail[b]) {
+            error("block %u is marked allocated but no inode owns it", b);
+        }
+        nwritten += block_usage[b] != 0;
+    }
+
+
+    // Layout report
+    printf("\nfiles:\n  %-32s %5s %10s %6s %7s %6s\n", "path", "inode", "size", "blocks", "extents", "start");
+    print_files(0, "/");
+
+    uint32_t histogram[NHISTOGRAM] = {0};
+    uint32_t nfree = 0, nruns = 0, largest = 0, run = 0;
+    for (uint32_t b = 0; b <= m->block_count; b++) {
+        if (b < m->block_count && block_owner[b] < 0 && !avail[b]) {
+            ++run;
+            continue;
+        }
+        if (run) {
+            int bucket = 0;
+            while ((run >> (bucket + 1)) && bucket < NHISTOGRAM - 1) {
+                ++bucket;
+            }
+            ++histogram[bucket];
+            nfree += run;
+            ++nruns;
+            largest = run > largest ? run : largest;
+            run = 0;
+        }
+    }
+
+    printf("\nblocks: %u used, %u free in %u runs (largest %u), %u ever written\n",
+           nowned, nfree, nruns, largest, nwritten);
+    printf("free runs:\n");
+    for (int i = 0; i < NHISTOGRAM; i++) {
+        if (histogram[i]) {
+            printf("  %6u-%-6u %u\n", 1U << i, (2U << i) - 1, histogram[i]);
+        }
+    }
+    printf("relocations: %u, %" PRIu64 " bytes moved by copy_block\n",
+           m->relocation_count, m->relocated_bytes);
+
+    printf("\n%s: %u error%s\n", argv[1], nerrors, nerrors == 1 ? "" : "s");
+    return nerrors ? 1 : 0;
+}
@@ -0,0 +1,130 @@
+#define _LARGEFILE_SOURCE 1
+#define _FILE_OFFSET_BITS 64
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <errno.h>
+#define FS_HOST_TOOL 1
+#include "filesystem.h"
+
+/* This program formats a RojocOS filesystem image and installs program
+ * binaries in its /bin directory, where the kernel's exec finds them.
+ * It takes the (zeroed) filesystem image, then the binaries; a binary
+ * named "obj/p-cat" is installed as "/bin/cat".
+ *
+ * It is linked against the kernel's own filesystem objects (obj/
+ * filesystem.o, aes.o and string.o), so files are encrypted exactly as
+ * the kernel would encrypt them.
+ */
+
+static int diskfd;
+
+
+static void usage(void) {
+    fprintf(stderr, "Usage: mkfs IMAGE [PROGRAM...]\n");
+    exit(1);
+}
+
+// Called by the filesystem objects.
+void log_printf(const char *format, ...) {
+    (void) format;
+}
+
+void assert_fail(const char *file, int line, const char *msg) {
+    fprintf(stderr, "%s:%d: assertion '%s' failed\n", file, line, msg);
+    abort();
+}
+
+static int disk_read(uintptr_t ptr, uint64_t start, size_t size) {
+    ssize_t r = pread(diskfd, (void *) ptr, size, (off_t) start);
+    return r == (ssize_t) size ? 0 : -1;
+}
+
+static int disk_write(uintptr_t ptr, uint64_t start, size_t size) {
+    ssize_t r = pwrite(diskfd, (const void *) ptr, size, (off_t) start);
+    return r == (ssize_t) size ? 0 : -1;
+}
+
+static void generate_random(uint8_t *buffer, size_t size) {
+    static FILE *urandom;
+    if (!urandom && !(urandom = fopen("/dev/urandom", "rb"))) {
+        perror("/dev/urandom");
+        exit(1);
+    }
+    if (fread(buffer, 1, size, urandom) != size) {
+        perror("/dev/urandom");
+        exit(1);
+    }
+}
+
+static normpath make_path(const char *str) {
+    normpath path = { str, strlen(str) };
+    return path;
+}
+
+static void install(fs_descriptor *fsdesc, const char *filename) {
+    FILE *f = fopen(filename, "rb");
+    if (!f) {
+        fprintf(stderr, "%s: %s\n", filename, strerror(errno));
+        exit(1);
+    }
+    static char data[FS_DEFAULT_BLOCK_COUNT * FS_BLOCK_SIZE];
+    size_t size = fread(data, 1, sizeof(data), f);
+    if (ferror(f) || !feof(f)) {
+        fprintf(stderr, "%s: read error or too large\n", filename);
+        exit(1);
+    }
+    fclose(f);
+
+    const char *name = strrchr(filename, '/');
+    name = name ? name + 1 : filename;
+    if (strncmp(name, "p-", 2) == 0) {
+        name += 2;
+    }
+    char path[FS_NAME_SIZE + 8];
+    if (strlen(name) >= FS_NAME_SIZE) {
+        fprintf(stderr, "%s: name too long\n", filename);
+        exit(1);
+    }
+    snprintf(path, sizeof(path), "/bin/%s", name);
+
+    int64_t ino = fs_alloc_inode(fsdesc);
+    int r = ino < 0 ? (int) ino : fs_touch(fsdesc, make_path(path), (uint32_t) ino);
+    if (r >= 0) {
+        ssize_t n = fs_write(fsdesc, (fs_ino) ino, data, size, 0);
+        r = n < 0 ? (int) n : 0;
+    }
+    if (r < 0) {
+        fprintf(stderr, "%s: cannot install as %s (error %d)\n", filename, path, -r);
+        exit(1);
+    }
+}
+
+int main(int argc, char *argv[]) {
+    if (argc < 2) {
+        usage();
+    }
+    if ((diskfd = open(argv[1], O_RDWR)) < 0) {
+        fprintf(stderr, "%s: %s\n", argv[1], strerror(errno));
+        usage();
+    }
+
+    static fs_descriptor fsdesc;
+    if (fs_init(&fsdesc, disk_read, disk_write, generate_random) < 0
+        || fs_touch(&fsdesc, make_path("/bin"), 0) < 0) {
+        fprintf(stderr, "%s: cannot format\n", argv[1]);
+        return 1;
+    }
+    for (int i = 2; i < argc; ++i) {
+        install(&fsdesc, argv[i]);
+    }
+    if (fs_commit(&fsdesc) < 0) {
+        fprintf(stderr, "%s: cannot commit\n", argv[1]);
+        return 1;
+    }
+    return 0;
+}
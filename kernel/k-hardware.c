@@ -35,13 +35,6 @@ void hardware_init(void) {
 //    The taskstate_t, segmentdescriptor_t, and pseduodescriptor_t types
 //    are defined by the x86 hardware.
 
-// Segment selectors
-#define SEGSEL_KERN_CODE        0x8             // kernel code segment
-#define SEGSEL_APP_CODE         0x10            // application code segment
-#define SEGSEL_KERN_DATA        0x18            // kernel data segment
-#define SEGSEL_APP_DATA         0x20            // application data segment
-#define SEGSEL_TASKSTATE        0x28            // task state segment
-
 // Segments
 static uint64_t segments[7];
 
@@ -87,6 +80,8 @@ extern void default_int_handler(void);
 extern void gpf_int_handler(void);
 extern void pagefault_int_handler(void);
 extern void timer_int_handler(void);
+extern void keyboard_int_handler(void);
+extern void syscall_entry(void);
 
 void segments_init(void) {
     // Segments for kernel & user code & data
@@ -94,9 +89,9 @@ void segments_init(void) {
     // kernel and user code. (Data segments are unused in WeensyOS.)
     segments[0] = 0;
     set_app_segment(&segments[SEGSEL_KERN_CODE >> 3], X86SEG_X | X86SEG_L, 0);
-    set_app_segment(&segments[SEGSEL_APP_CODE >> 3], X86SEG_X | X86SEG_L, 3);
     set_app_segment(&segments[SEGSEL_KERN_DATA >> 3], X86SEG_W, 0);
     set_app_segment(&segments[SEGSEL_APP_DATA >> 3], X86SEG_W, 3);
+    set_app_segment(&segments[SEGSEL_APP_CODE >> 3], X86SEG_X | X86SEG_L, 3);
     set_sys_segment(&segments[SEGSEL_TASKSTATE >> 3], X86SEG_TSS, 0,
                     (uintptr_t) &kernel_task_descriptor,
                     sizeof(kernel_task_descriptor));
@@ -119,6 +114,8 @@ void segments_init(void) {
     // Timer interrupt
     set_gate(&interrupt_descriptors[INT_TIMER], X86GATE_INTERRUPT, 0,
              (uint64_t) timer_int_handler);
+    set_gate(&interrupt_descriptors[INT_KEYBOARD], X86GATE_INTERRUPT, 0,
+             (uint64_t) keyboard_int_handler);
 
     // GPF and page fault
     set_gate(&interrupt_descriptors[INT_GPF], X86GATE_INTERRUPT, 0,
@@ -129,11 +126,21 @@ void segments_init(void) {
     // System calls get special handling.
     // Note that the last argument is '3'.  This means that unprivileged
     // (level-3) applications may generate these interrupts.
-    for (unsigned i = INT_SYS; i < INT_SYS + 32; ++i) {
+    for (unsigned i = INT_SYS; i < INT_SYS + 36; ++i) {
         set_gate(&interrupt_descriptors[i], X86GATE_INTERRUPT, 3,
                  (uint64_t) sys_int_handlers[i - INT_SYS]);
     }
 
+    // The `syscall` instruction enters the kernel at syscall_entry
+    // (k-exception.S) without going through the IDT. SYSCALL loads
+    // SEGSEL_KERN_CODE and the selector after it; SYSRET loads the two
+    // selectors after STAR[63:48], i.e. SEGSEL_APP_DATA and SEGSEL_APP_CODE.
+    wrmsr(MSR_IA32_EFER, rdmsr(MSR_IA32_EFER) | IA32_EFER_SCE);
+    wrmsr(MSR_IA32_STAR, ((uint64_t) (SEGSEL_APP_DATA - 8) << 48)
+          | ((uint64_t) SEGSEL_KERN_CODE << 32));
+    wrmsr(MSR_IA32_LSTAR, (uint64_t) syscall_entry);
+    wrmsr(MSR_IA32_FMASK, EFLAGS_IF | EFLAGS_DF | EFLAGS_TF | EFLAGS_AC);
+
     x86_64_pseudodescriptor idt;
     idt.pseudod_limit = sizeof(interrupt_descriptors) - 1;
     idt.pseudod_base = (uint64_t) interrupt_descriptors;
@@ -261,6 +268,12 @@ void timer_init(int rate) {
 }
 
 
+void keyboard_interrupt_init(void) {
+    interrupts_enabled |= 1 << (INT_KEYBOARD - INT_HARDWARE);
+    interrupt_mask();
+}
+
+
 // virtual_memory_init
 //    Initialize the virtual memory system, including an initial page table
 //    `kernel_pagetable`.
@@ -268,6 +281,13 @@ void timer_init(int rate) {
 static x86_64_pagetable kernel_pagetables[5];
 x86_64_pagetable* kernel_pagetable;
 
+// The loaded page table. With PCIDs, TLB entries are tagged with the page
+// number of their page table; tlb_stale[pn] is set when page table `pn`
+// changed while not loaded, so its entries must be flushed on load.
+static x86_64_pagetable* loaded_pagetable;
+static int pcid_enabled;
+static uint8_t tlb_stale[NPAGES];
+
 void virtual_memory_init(void) {
     log_printf("kernel_pagetables = %p\n", (void*)kernel_pagetables);
     kernel_pagetable = &kernel_pagetables[0];
@@ -285,6 +305,14 @@ void virtual_memory_init(void) {
                        MEMSIZE_PHYSICAL, PTE_P | PTE_W | PTE_U, NULL);
 
     lcr3((uintptr_t) kernel_pagetable);
+    loaded_pagetable = kernel_pagetable;
+
+    uint32_t ecx;
+    cpuid(1, NULL, NULL, &ecx, NULL);
+    if (ecx & CPUID_1_ECX_PCID) {
+        lcr4(rcr4() | CR4_PCIDE);
+        pcid_enabled = 1;
+    }
 }
 
 
@@ -309,6 +337,8 @@ void virtual_memory_init(void) {
 
 static x86_64_pagetable* lookup_l4pagetable(x86_64_pagetable* pagetable,
                  uintptr_t va, int perm, x86_64_pagetable* (*allocator)(void));
+static void pageentry_set(x86_64_pagetable* pagetable, uintptr_t va,
+                          x86_64_pageentry_t* pep, x86_64_pageentry_t pe);
 
 int virtual_memory_map(x86_64_pagetable* pagetable, uintptr_t va,
                        uintptr_t pa, size_t sz, int perm,
@@ -333,9 +363,11 @@ int virtual_memory_map(x86_64_pagetable* pagetable, uintptr_t va,
             last_index123 = cur_index123;
         }
         if ((perm & PTE_P) && l4pagetable) {
-            l4pagetable->entry[L4PAGEINDEX(va)] = pa | perm;
+            pageentry_set(pagetable, va, &l4pagetable->entry[L4PAGEINDEX(va)],
+                          pa | perm);
         } else if (l4pagetable) {
-            l4pagetable->entry[L4PAGEINDEX(va)] = perm;
+            pageentry_set(pagetable, va, &l4pagetable->entry[L4PAGEINDEX(va)],
+                          perm);
         } else if (perm & PTE_P) {
             return -1;
         }
@@ -378,6 +410,25 @@ static x86_64_pagetable* lookup_l4pagetable(x86_64_pagetable* pagetable,
 }
 
 
+// pageentry_set(pagetable, va, pep, pe)
+//    Set the level-4 entry `*pep` for `va` in `pagetable` to `pe`. If that
+//    replaces a present mapping, the old translation may be cached: drop it
+//    now if `pagetable` is loaded, otherwise when it is next loaded.
+
+static void pageentry_set(x86_64_pagetable* pagetable, uintptr_t va,
+                          x86_64_pageentry_t* pep, x86_64_pageentry_t pe) {
+    x86_64_pageentry_t old = *pep;
+    *pep = pe;
+    if ((old & PTE_P) && old != pe) {
+        if (pagetable == loaded_pagetable) {
+            invlpg((void*) va);
+        } else {
+            tlb_invalidate_pagetable(pagetable);
+        }
+    }
+}
+
+
 // virtual_memory_lookup(pagetable, va)
 //    Returns information about the mapping of the virtual address `va` in
 //    `pagetable`. The information is returned as a `vamapping` object.
@@ -406,15 +457,38 @@ vamapping virtual_memory_lookup(x86_64_pagetable* pagetable, uintptr_t va) {
 
 void set_pagetable(x86_64_pagetable* pagetable) {
     assert(PAGEOFFSET(pagetable) == 0); // must be page aligned
-    assert(virtual_memory_lookup(pagetable, (uintptr_t) default_int_handler).pa
-           == (uintptr_t) default_int_handler);
-    assert(virtual_memory_lookup(kernel_pagetable, (uintptr_t) pagetable).pa
-           == (uintptr_t) pagetable);
-    assert(virtual_memory_lookup(pagetable, (uintptr_t) kernel_pagetable).pa
-           == (uintptr_t) kernel_pagetable);
-    assert(virtual_memory_lookup(pagetable, (uintptr_t) virtual_memory_map).pa
-           == (uintptr_t) virtual_memory_map);
-    lcr3((uintptr_t) pagetable);
+    if (WEENSYOS_DEBUG) {
+        assert(virtual_memory_lookup(pagetable, (uintptr_t) default_int_handler).pa
+               == (uintptr_t) default_int_handler);
+        assert(virtual_memory_lookup(kernel_pagetable, (uintptr_t) pagetable).pa
+               == (uintptr_t) pagetable);
+        assert(virtual_memory_lookup(pagetable, (uintptr_t) kernel_pagetable).pa
+               == (uintptr_t) kernel_pagetable);
+        assert(virtual_memory_lookup(pagetable, (uintptr_t) virtual_memory_map).pa
+               == (uintptr_t) virtual_memory_map);
+    }
+    if (pagetable == loaded_pagetable) {
+        return;
+    }
+
+    uintptr_t cr3 = (uintptr_t) pagetable;
+    int pn = PAGENUMBER(pagetable);
+    if (pcid_enabled) {
+        cr3 |= pn;
+        if (!tlb_stale[pn]) {
+            cr3 |= CR3_NOFLUSH;
+        }
+    }
+    tlb_stale[pn] = 0;
+    loaded_pagetable = pagetable;
+    lcr3(cr3);
+}
+
+void tlb_invalidate_pagetable(x86_64_pagetable* pagetable) {
+    if (pagetable == loaded_pagetable) {
+        set_pagetable(kernel_pagetable);
+    }
+    tlb_stale[PAGENUMBER(pagetable)] = 1;
 }
 
 
@@ -525,9 +599,15 @@ void process_init(proc* p, int flags) {
 //    and 80 * 25.
 
 void console_show_cursor(int cpos) {
+    static int shown_cpos = -1;
     if (cpos < 0 || cpos > CONSOLE_ROWS * CONSOLE_COLUMNS) {
         cpos = 0;
     }
+    // port I/O is slow; skip it if the cursor has not moved
+    if (cpos == shown_cpos) {
+        return;
+    }
+    shown_cpos = cpos;
     outb(0x3D4, 14);
     outb(0x3D5, cpos / 256);
     outb(0x3D4, 15);
@@ -1071,17 +1151,21 @@ int readdisk(uintptr_t ptr, uint64_t start, size_t size) {
         return -1;
     }
 
-    // Read first sector
+    // Read first sector, through `buffer` only if it is partial
 
     uint32_t src_sect = (uint32_t) (start / SECTORSIZE);
     uint8_t buffer[SECTORSIZE];
-    int r = readsect((uintptr_t) buffer, src_sect);
-    if (r < 0) return r;
+    uint64_t count = 0;
+    int r;
+    if (start % SECTORSIZE != 0 || size < SECTORSIZE) {
+        r = readsect((uintptr_t) buffer, src_sect);
+        if (r < 0) return r;
 
-    uint64_t count = MIN(SECTORSIZE-start%SECTORSIZE, size);
-    memcpy((void *) ptr, &buffer[start%SECTORSIZE], count);
+        count = MIN(SECTORSIZE-start%SECTORSIZE, size);
+        memcpy((void *) ptr, &buffer[start%SECTORSIZE], count);
 
-    src_sect += 1;
+        src_sect += 1;
+    }
 
     // Read other sectors
 
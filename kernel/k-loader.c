@@ -2,133 +2,288 @@
 #include "elf.h"
 #include "lib.h"
 #include "kernel.h"
+#include "filesystem.h"
 
 // k-loader.c
 //
-//    Load a weensy application into memory from a RAM image.
-
-#define SECTORSIZE              512
-
-extern uint8_t _binary_obj_p_allocator_start[];
-extern uint8_t _binary_obj_p_allocator_end[];
-extern uint8_t _binary_obj_p_fork_start[];
-extern uint8_t _binary_obj_p_fork_end[];
-extern uint8_t _binary_obj_p_shell_start[];
-extern uint8_t _binary_obj_p_shell_end[];
-extern uint8_t _binary_obj_p_cat_start[];
-extern uint8_t _binary_obj_p_cat_end[];
-extern uint8_t _binary_obj_p_echo_start[];
-extern uint8_t _binary_obj_p_echo_end[];
-extern uint8_t _binary_obj_p_ls_start[];
-extern uint8_t _binary_obj_p_ls_end[];
-extern uint8_t _binary_obj_p_mkdir_start[];
-extern uint8_t _binary_obj_p_mkdir_end[];
-//extern uint8_t _binary_obj_p_rand_start[];
-//extern uint8_t _binary_obj_p_rand_end[];
-extern uint8_t _binary_obj_p_entropy_start[];
-extern uint8_t _binary_obj_p_entropy_end[];
-extern uint8_t _binary_obj_p_plane_start[];
-extern uint8_t _binary_obj_p_plane_end[];
-extern uint8_t _binary_obj_p_touch_start[];
-extern uint8_t _binary_obj_p_touch_end[];
-extern uint8_t _binary_obj_p_rm_start[];
-extern uint8_t _binary_obj_p_rm_end[];
-// new for below
-
-struct ramimage {
-    void* begin;
-    void* end;
-} ramimages[] = {
-    { _binary_obj_p_allocator_start, _binary_obj_p_allocator_end },
-    { _binary_obj_p_fork_start, _binary_obj_p_fork_end },
-    { _binary_obj_p_shell_start, _binary_obj_p_shell_end },
-    { _binary_obj_p_cat_start, _binary_obj_p_cat_end },
-    { _binary_obj_p_echo_start, _binary_obj_p_echo_end },
-    { _binary_obj_p_ls_start, _binary_obj_p_ls_end },
-    { _binary_obj_p_mkdir_start, _binary_obj_p_mkdir_end },
-    { _binary_obj_p_rm_start, _binary_obj_p_rm_end },
-    { _binary_obj_p_entropy_start, _binary_obj_p_entropy_end },
-    { _binary_obj_p_plane_start, _binary_obj_p_plane_end },
-    { _binary_obj_p_touch_start, _binary_obj_p_touch_end }
-};
-
-static int program_load_segment(proc* p, const elf_program* ph,
-                                const uint8_t* src,
-                                x86_64_pagetable* (*allocator)(void));
-
-// program_load(p, programnumber)
-//    Load the code corresponding to program `programnumber` into the process
-//    `p` and set `p->p_registers.reg_rip` to its entry point. Calls
-//    `assign_physical_page` to as required. Returns 0 on success and
-//    -1 on failure (e.g. out-of-memory). `allocator` is passed to
-//    `virtual_memory_map`.
-
-int program_load(proc* p, int programnumber,
+//    Load a weensy application into memory from an executable file in the
+//    filesystem (see build/mkfs.c, which installs them in /bin).
+
+extern fs_descriptor fsdesc;
+
+// Page cache for executables: file pages of recently run programs, each
+// a PO_SHARED page the cache holds one reference to. Warm starts neither
+// read nor decrypt the file again, and read-only segments map the cached
+// pages directly into every process running the program. File mappings
+// have pages of their own (see mmap_page), so writing through one never
+// changes the text of a running program.
+#define PROGCACHE_SIZE 32
+
+static struct progcache_page {
+    fs_ino ino;                 // 0 if the slot is empty
+    uint32_t index;             // page index in the file
+    uint32_t stamp;             // last use, for LRU eviction
+    uintptr_t pa;
+} progcache[PROGCACHE_SIZE];
+
+static uint32_t progcache_clock;
+
+static uintptr_t progcache_get(fs_ino ino, uint32_t index);
+static int program_read(fs_ino ino, uint64_t offset, void* dst, size_t size);
+static int program_load_segment(proc* p, fs_ino ino, const elf_program* ph);
+static int program_map_text(proc* p, fs_ino ino, const elf_program* ph,
+                            x86_64_pagetable* (*allocator)(void));
+
+// program_load(p, ino)
+//    Load the executable in inode `ino` into the process `p` and set
+//    `p->p_registers.reg_rip` to its entry point. Returns 0 on success and
+//    -1 on failure (e.g. out-of-memory or not an executable). `allocator`
+//    is passed to `virtual_memory_map`.
+
+int program_load(proc* p, fs_ino ino,
                  x86_64_pagetable* (*allocator)(void)) {
-    // is this a valid program?
-    int nprograms = sizeof(ramimages) / sizeof(ramimages[0]);
-    assert(programnumber >= 0 && programnumber < nprograms);
-    elf_header* eh = (elf_header*) ramimages[programnumber].begin;
-    assert(eh->e_magic == ELF_MAGIC);
+    if (program_check(ino) < 0) {
+        return -1;
+    }
+    elf_header* eh = (elf_header*) progcache_get(ino, 0);
+
+    // keep the header page while loading evicts other cache pages
+    page_ref((uintptr_t) eh);
 
     // load each loadable program segment into memory
+    int r = 0;
+    p->p_nsegments = 0;
     elf_program* ph = (elf_program*) ((const uint8_t*) eh + eh->e_phoff);
     for (int i = 0; i < eh->e_phnum; ++i) {
         if (ph[i].p_type == ELF_PTYPE_LOAD) {
-            const uint8_t* pdata = (const uint8_t*) eh + ph[i].p_offset;
-            if (program_load_segment(p, &ph[i], pdata, allocator) < 0) {
-                return -1;
+            r = 1;
+            if (!(ph[i].p_flags & ELF_PFLAG_WRITE)) {
+                r = program_map_text(p, ino, &ph[i], allocator);
+            }
+            if (r > 0) {
+                r = program_load_segment(p, ino, &ph[i]);
+            }
+            if (r < 0) {
+                break;
             }
         }
     }
 
     // set the entry point from the ELF header
     p->p_registers.reg_rip = eh->e_entry;
+    page_unref((uintptr_t) eh);
+    return r < 0 ? -1 : 0;
+}
+
+
+int program_check(fs_ino ino) {
+    // the headers must fit in the first page
+    elf_header* eh = (elf_header*) progcache_get(ino, 0);
+    if (!eh || eh->e_magic != ELF_MAGIC
+        || eh->e_phoff + eh->e_phnum * sizeof(elf_program) > PAGESIZE) {
+        return -1;
+    }
     return 0;
 }
 
 
-// program_load_segment(p, ph, src, allocator)
-//    Load an ELF segment at virtual address `ph->p_va` in process `p`. Copies
-//    `[src, src + ph->p_filesz)` to `dst`, then clears
-//    `[ph->p_va + ph->p_filesz, ph->p_va + ph->p_memsz)` to 0.
-//    Calls `assign_physical_page` to allocate pages and `virtual_memory_map`
-//    to map them in `p->p_pagetable`. Returns 0 on success and -1 on failure.
+// program_cache_invalidate(ino)
+//    Drop the cached pages of inode `ino`. Processes keep the pages they
+//    have mapped.
+
+void program_cache_invalidate(fs_ino ino) {
+    for (int i = 0; i < PROGCACHE_SIZE; ++i) {
+        if (progcache[i].ino == ino) {
+            page_unref(progcache[i].pa);
+            progcache[i].ino = 0;
+        }
+    }
+}
+
+
+// progcache_get(ino, index)
+//    Return the address of the cached page `index` of inode `ino`, reading
+//    it through fs_read on a miss. Returns 0 on failure.
+
+static uintptr_t progcache_get(fs_ino ino, uint32_t index) {
+    struct progcache_page* slot = &progcache[0];
+    for (int i = 0; i < PROGCACHE_SIZE; ++i) {
+        if (progcache[i].ino == ino && progcache[i].index == index) {
+            progcache[i].stamp = ++progcache_clock;
+            return progcache[i].pa;
+        }
+        if (slot->ino != 0
+            && (progcache[i].ino == 0 || progcache[i].stamp < slot->stamp)) {
+            slot = &progcache[i];
+        }
+    }
+
+    uintptr_t pa = page_alloc(PO_SHARED);
+    if (!pa) {
+        return 0;
+    }
+    // page_alloc zeroes the page, so a short read at the end of the file
+    // leaves the rest zero
+    if (fs_read(&fsdesc, ino, (void*) pa, PAGESIZE,
+                (uint64_t) index * PAGESIZE) < 0) {
+        page_unref(pa);
+        return 0;
+    }
+
+    if (slot->ino != 0) {
+        page_unref(slot->pa);
+    }
+    slot->ino = ino;
+    slot->index = index;
+    slot->stamp = ++progcache_clock;
+    slot->pa = pa;
+    return pa;
+}
+
+
+// program_read(ino, offset, dst, size)
+//    Copy `size` bytes at `offset` in inode `ino` to `dst` through the page
+//    cache. Returns 0 on success and -1 on failure.
+
+static int program_read(fs_ino ino, uint64_t offset, void* dst, size_t size) {
+    while (size > 0) {
+        uintptr_t pa = progcache_get(ino, offset / PAGESIZE);
+        if (!pa) {
+            return -1;
+        }
+        size_t n = MIN(size, (size_t) (PAGESIZE - offset % PAGESIZE));
+        memcpy(dst, (const uint8_t*) pa + offset % PAGESIZE, n);
+        dst = (uint8_t*) dst + n;
+        offset += n;
+        size -= n;
+    }
+    return 0;
+}
 
-static int program_load_segment(proc* p, const elf_program* ph,
-        const uint8_t* src,
-        x86_64_pagetable* (*allocator)(void)) {
-    uintptr_t va = (uintptr_t) ph->p_va;
-    uintptr_t end_file = va + ph->p_filesz, end_mem = va + ph->p_memsz;
-    va &= ~(PAGESIZE - 1);                // round to page boundary
 
-    // allocate memory
-    for (uintptr_t addr = va; addr < end_mem; addr += PAGESIZE) {
-    uintptr_t paddr = page_alloc(p->p_pid);
+// program_load_segment(p, ino, ph)
+//    Record ELF segment `ph` at virtual address `ph->p_va` in process `p`
+//    for demand paging: the file bytes `[ph->p_offset, ph->p_offset +
+//    ph->p_filesz)` are copied in, and `[ph->p_va + ph->p_filesz,
+//    ph->p_va + ph->p_memsz)` zeroed, page by page on first touch.
+//    Returns 0 on success and -1 on failure.
 
-    if (paddr > 0) {
-    if (virtual_memory_map(p->p_pagetable, addr, paddr, PAGESIZE,
-            PTE_P | PTE_W | PTE_U, allocator) < 0) {
-    paddr = 0;
+static int program_load_segment(proc* p, fs_ino ino, const elf_program* ph) {
+    if (p->p_nsegments == PROC_NSEGMENTS) {
+        console_printf(CPOS(22, 0), 0xC000,
+                       "program_load_segment(pid %d): too many segments\n",
+                       p->p_pid);
+        return -1;
     }
+
+    proc_segment* seg = &p->p_segments[p->p_nsegments++];
+    seg->va = ph->p_va & ~(PAGESIZE - 1);
+    seg->end_mem = ph->p_va + ph->p_memsz;
+    seg->file_va = ph->p_va;
+    seg->end_file = ph->p_va + ph->p_filesz;
+    seg->ino = ino;
+    seg->offset = ph->p_offset;
+    seg->perm = PTE_P | PTE_U;
+    if (ph->p_flags & ELF_PFLAG_WRITE) {
+        seg->perm |= PTE_W;
     }
+    return 0;
+}
+
 
-    if (paddr <= 0) {
-    console_printf(CPOS(22, 0), 0xC000,
-    "program_load_segment(pid %d): can't assign address %p\n",
-    p->p_pid, addr);
-    return -1;
+int program_map_zero(proc* p, uintptr_t va, size_t size, int perm) {
+    if (p->p_nsegments == PROC_NSEGMENTS) {
+        return -1;
     }
+
+    proc_segment* seg = &p->p_segments[p->p_nsegments++];
+    seg->va = va;
+    seg->end_mem = va + size;
+    seg->file_va = seg->end_file = va;
+    seg->ino = 0;
+    seg->offset = 0;
+    seg->perm = perm;
+    return 0;
+}
+
+
+int program_demand_page(proc* p, uintptr_t va,
+                        x86_64_pagetable* (*allocator)(void)) {
+    va &= ~(PAGESIZE - 1);
+    if (virtual_memory_lookup(p->p_pagetable, va).pn >= 0) {
+        return 1;
+    }
+
+    for (int i = 0; i < p->p_nsegments; ++i) {
+        proc_segment* seg = &p->p_segments[i];
+        if (va < seg->va || va >= seg->end_mem) {
+            continue;
+        }
+
+        // file mappings share one page per file page
+        if (seg->perm & PTE_FILE) {
+            uintptr_t pa = mmap_page(seg->ino, (seg->offset + (va - seg->va)) / PAGESIZE);
+            if (!pa) {
+                return -1;
+            }
+            if (virtual_memory_map(p->p_pagetable, va, pa, PAGESIZE,
+                                   seg->perm, allocator) < 0) {
+                page_unref(pa);
+                return -1;
+            }
+            return 0;
+        }
+
+        uintptr_t pa = page_alloc(p->p_pid);
+        if (!pa) {
+            return -1;
+        }
+
+        // page_alloc zeroes the page; copy the file-backed part
+        uintptr_t start = MAX(va, seg->file_va);
+        uintptr_t end = MIN(va + PAGESIZE, seg->end_file);
+        if (start < end
+            && program_read(seg->ino, seg->offset + (start - seg->file_va),
+                            (uint8_t*) pa + (start - va), end - start) < 0) {
+            return -1;
+        }
+
+        if (virtual_memory_map(p->p_pagetable, va, pa, PAGESIZE,
+                               seg->perm, allocator) < 0) {
+            return -1;
+        }
+        return 0;
     }
+    return 1;
+}
 
-    // ensure new memory mappings are active
-    set_pagetable(p->p_pagetable);
 
-    // copy data from executable image into process memory
-    memcpy((uint8_t*) va, src, end_file - va);
-    memset((uint8_t*) end_file, 0, end_mem - end_file);
+// program_map_text(p, ino, ph, allocator)
+//    Map read-only segment `ph` of the executable in inode `ino` into
+//    process `p` straight from the page cache. Returns 0 on success, -1 on
+//    failure, and 1 if the segment's file pages do not line up with its
+//    virtual pages (or it has a zero-filled tail) and must be loaded with
+//    program_load_segment.
 
-    // restore kernel pagetable
-    set_pagetable(kernel_pagetable);
+static int program_map_text(proc* p, fs_ino ino, const elf_program* ph,
+                            x86_64_pagetable* (*allocator)(void)) {
+    if (ph->p_offset % PAGESIZE != ph->p_va % PAGESIZE
+        || ph->p_filesz != ph->p_memsz) {
+        return 1;
+    }
+
+    uintptr_t va = ph->p_va & ~(PAGESIZE - 1);
+    uint32_t index = ph->p_offset / PAGESIZE;
+    for (; va < ph->p_va + ph->p_memsz; va += PAGESIZE, ++index) {
+        uintptr_t pa = progcache_get(ino, index);
+        if (!pa || virtual_memory_map(p->p_pagetable, va, pa, PAGESIZE,
+                                      PTE_P | PTE_U, allocator) < 0) {
+            console_printf(CPOS(22, 0), 0xC000,
+                           "program_map_text(pid %d): can't map address %p\n",
+                           p->p_pid, va);
+            return -1;
+        }
+        page_ref(pa);
+    }
     return 0;
 }
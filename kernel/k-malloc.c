@@ -34,8 +34,7 @@ void extend_heap() {
         return;
     }
 
-    // Zero the page for security
-    memset((void*)ptr, 0, PAGESIZE);
+    // page_alloc returns zeroed pages
 
     // Map the page into the kernel's page table
     virtual_memory_map(kernel_pagetable, ptr, ptr, PAGESIZE, PTE_P | PTE_W, NULL);
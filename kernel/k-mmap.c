@@ -0,0 +1,319 @@
+#include "kernel.h"
+#include "lib.h"
+#include "errno.h"
+#include "filesystem.h"
+
+// k-mmap.c
+//
+//    Shared file mappings. A mapping is a PTE_FILE segment of the process
+//    (see proc_segment): its pages fault in from the mapped page table
+//    below (program_demand_page), so every mapping of a file shares the
+//    same decrypted pages. Pages the process writes are marked dirty by
+//    the MMU (PTE_D), or by user_run when the kernel writes to them, and
+//    are encrypted and written back with fs_write at msync, at munmap,
+//    at eviction (see mmap_page), and when the process exits or execs.
+//    Bytes past the end of the file are not written back: a mapping never
+//    changes the file's size. A write through a file descriptor is copied
+//    into the mapped pages it covers (mmap_file_changed), so mappings see
+//    it and a later writeback does not undo it. Removing the file detaches
+//    its mappings: they keep their pages but never write back, as the
+//    inode may be reused.
+
+extern fs_descriptor fsdesc;
+extern proc processes[NPROC];
+
+
+// Mapped pages: one PO_SHARED page per (inode, page) that some process
+// maps, apart from the executable page cache. The table holds one
+// reference to each page; an entry whose page no process maps any more
+// is free. When no entry is free, the least recently faulted page is
+// evicted: written back and unmapped from every process that maps it, so
+// a file page never has two diverging copies. Those processes fault it
+// in again on their next access.
+#define MMAP_PAGES 64
+
+static struct mmap_page {
+    uint32_t ino;               // 0 if the slot is empty
+    uint32_t index;             // page index in the file
+    uint32_t stamp;             // last fault, for LRU eviction
+    uintptr_t pa;
+} mmap_pages[MMAP_PAGES];
+static uint32_t mmap_clock;
+
+static int mmap_page_live(const struct mmap_page* mp) {
+    return mp->ino != 0 && page_refcount(mp->pa) > 1;
+}
+
+
+static int mmap_writeback(proc* p, proc_segment* seg, uintptr_t va, uintptr_t end);
+
+// mmap_evict(mp)
+//    Unmap the page of entry `mp` from every process that maps it, writing
+//    it back first where the process dirtied it. Only the table's reference
+//    remains. Returns 0 on success and a negative error code on failure.
+
+static int mmap_evict(struct mmap_page* mp) {
+    uint64_t offset = (uint64_t) mp->index * PAGESIZE;
+    for (pid_t pid = 1; pid < NPROC; ++pid) {
+        proc* p = &processes[pid];
+        if (p->p_state == P_FREE || p->p_state == P_BROKEN) {
+            continue;
+        }
+        for (int i = 0; i < p->p_nsegments; ++i) {
+            proc_segment* seg = &p->p_segments[i];
+            if (!(seg->perm & PTE_FILE) || seg->ino != mp->ino
+                || offset < seg->offset
+                || offset - seg->offset >= seg->end_mem - seg->va) {
+                continue;
+            }
+            uintptr_t va = seg->va + (offset - seg->offset);
+            vamapping vam = virtual_memory_lookup(p->p_pagetable, va);
+            if (vam.pn < 0 || PAGEADDRESS(vam.pn) != mp->pa) {
+                continue;
+            }
+
+            int r = mmap_writeback(p, seg, va, va + PAGESIZE);
+            if (r < 0) {
+                return r;
+            }
+            virtual_memory_map(p->p_pagetable, va, 0, PAGESIZE, 0, NULL);
+            page_unref(mp->pa);
+        }
+    }
+    assert(!mmap_page_live(mp));
+    return 0;
+}
+
+
+uintptr_t mmap_page(uint32_t ino, uint32_t index) {
+    // the file was removed (see mmap_detach): pages never read are zero
+    if (ino == 0) {
+        return page_alloc(PO_SHARED);
+    }
+
+    // prefer a free slot, then the least recently faulted page
+    struct mmap_page* slot = NULL;
+    for (int i = 0; i < MMAP_PAGES; ++i) {
+        struct mmap_page* mp = &mmap_pages[i];
+        if (mmap_page_live(mp) && mp->ino == ino && mp->index == index) {
+            mp->stamp = ++mmap_clock;
+            page_ref(mp->pa);
+            return mp->pa;
+        }
+        if (!slot
+            || (mmap_page_live(slot)
+                && (!mmap_page_live(mp) || mp->stamp < slot->stamp))) {
+            slot = mp;
+        }
+    }
+
+    if (mmap_page_live(slot)) {
+        int r = mmap_evict(slot);
+        if (r < 0) {
+            log_printf("mmap_page: writeback of inode %u failed %d\n",
+                       slot->ino, r);
+            return 0;
+        }
+    }
+    if (slot->ino != 0) {
+        page_unref(slot->pa);
+        slot->ino = 0;
+    }
+
+    uintptr_t pa = page_alloc(PO_SHARED);
+    if (!pa) {
+        return 0;
+    }
+    // page_alloc zeroes the page, so a short read at the end of the file
+    // leaves the rest zero
+    if (fs_read(&fsdesc, ino, (void*) pa, PAGESIZE,
+                (uint64_t) index * PAGESIZE) < 0) {
+        page_unref(pa);
+        return 0;
+    }
+
+    slot->ino = ino;
+    slot->index = index;
+    slot->stamp = ++mmap_clock;
+    slot->pa = pa;
+    page_ref(pa);
+    return pa;
+}
+
+
+void mmap_file_changed(uint32_t ino, uint64_t offset, size_t size) {
+    for (int i = 0; i < MMAP_PAGES; ++i) {
+        struct mmap_page* mp = &mmap_pages[i];
+        if (!mmap_page_live(mp) || mp->ino != ino) {
+            continue;
+        }
+        uint64_t start = (uint64_t) mp->index * PAGESIZE;
+        uint64_t lo = MAX(offset, start);
+        uint64_t hi = MIN(offset + size, start + PAGESIZE);
+        if (lo < hi
+            && fs_read(&fsdesc, ino, (void*) (mp->pa + (lo - start)), hi - lo, lo) < 0) {
+            log_printf("mmap_file_changed: cannot read inode %u\n", ino);
+        }
+    }
+}
+
+
+// mmap_segment(p, va)
+//    Return the file mapping of process `p` containing `va`, or NULL.
+
+static proc_segment* mmap_segment(proc* p, uintptr_t va) {
+    for (int i = 0; i < p->p_nsegments; ++i) {
+        proc_segment* seg = &p->p_segments[i];
+        if ((seg->perm & PTE_FILE) && va >= seg->va && va < seg->end_mem) {
+            return seg;
+        }
+    }
+    return NULL;
+}
+
+
+// mmap_writeback(p, seg, va, end)
+//    Write the dirty pages of file mapping `seg` in `[va, end)` back to
+//    the file, and mark them clean. Returns 0 on success and a negative
+//    error code on failure.
+
+static int mmap_writeback(proc* p, proc_segment* seg, uintptr_t va, uintptr_t end) {
+    if (seg->ino == 0) {
+        return 0;
+    }
+
+    struct stat st;
+    int r = fs_fstat(&fsdesc, seg->ino, &st);
+    if (r < 0) {
+        return r;
+    }
+
+    for (va = MAX(va, seg->va); va < MIN(end, seg->end_mem); va += PAGESIZE) {
+        vamapping vam = virtual_memory_lookup(p->p_pagetable, va);
+        if (vam.pn < 0 || !(vam.perm & PTE_D)) {
+            continue;
+        }
+
+        uint64_t offset = seg->offset + (va - seg->va);
+        if (offset < st.st_size) {
+            program_invalidate(seg->ino);
+            size_t n = MIN((uint64_t) PAGESIZE, st.st_size - offset);
+            ssize_t w = fs_write(&fsdesc, seg->ino, (const void*) vam.pa, n, offset);
+            if (w < 0) {
+                return w;
+            }
+        }
+        virtual_memory_map(p->p_pagetable, va, vam.pa, PAGESIZE,
+                           vam.perm & ~PTE_D, NULL);
+    }
+    return 0;
+}
+
+
+int mmap_file(proc* p, uintptr_t va, size_t size, int prot, uint32_t ino) {
+    uintptr_t end = va + ROUNDUP(size, PAGESIZE);
+    if (va % PAGESIZE != 0 || size == 0 || va < PROC_START_ADDR
+        || end <= va || end > MEMSIZE_VIRTUAL) {
+        return -EINVAL;
+    }
+
+    // the range must be free: no segment and no page mapped yet
+    for (int i = 0; i < p->p_nsegments; ++i) {
+        if (va < p->p_segments[i].end_mem && p->p_segments[i].va < end) {
+            return -EINVAL;
+        }
+    }
+    for (uintptr_t a = va; a < end; a += PAGESIZE) {
+        if (virtual_memory_lookup(p->p_pagetable, a).pn >= 0) {
+            return -EINVAL;
+        }
+    }
+    if (p->p_nsegments == PROC_NSEGMENTS) {
+        return -ENOMEM;
+    }
+
+    proc_segment* seg = &p->p_segments[p->p_nsegments++];
+    seg->va = seg->file_va = va;
+    seg->end_mem = seg->end_file = end;
+    seg->ino = ino;
+    seg->offset = 0;
+    seg->perm = PTE_P | PTE_U | PTE_FILE;
+    if (prot & PROT_WRITE) {
+        seg->perm |= PTE_W;
+    }
+    return 0;
+}
+
+
+int mmap_sync(proc* p, uintptr_t va, size_t size) {
+    uintptr_t end = va + size;
+    if (va % PAGESIZE != 0 || end < va) {
+        return -EINVAL;
+    }
+
+    for (int i = 0; i < p->p_nsegments; ++i) {
+        proc_segment* seg = &p->p_segments[i];
+        if ((seg->perm & PTE_FILE) && va < seg->end_mem && seg->va < end) {
+            int r = mmap_writeback(p, seg, va, end);
+            if (r < 0) {
+                return r;
+            }
+        }
+    }
+    return 0;
+}
+
+
+int mmap_unmap(proc* p, uintptr_t va, size_t size) {
+    proc_segment* seg = mmap_segment(p, va);
+    if (!seg || seg->va != va || seg->end_mem != va + ROUNDUP(size, PAGESIZE)) {
+        return -EINVAL;
+    }
+
+    int r = mmap_writeback(p, seg, seg->va, seg->end_mem);
+    if (r < 0) {
+        return r;
+    }
+
+    for (; va < seg->end_mem; va += PAGESIZE) {
+        vamapping vam = virtual_memory_lookup(p->p_pagetable, va);
+        if (vam.pn >= 0) {
+            virtual_memory_map(p->p_pagetable, va, 0, PAGESIZE, 0, NULL);
+            page_unref(vam.pa);
+        }
+    }
+    *seg = p->p_segments[--p->p_nsegments];
+    return 0;
+}
+
+
+void mmap_release(proc* p) {
+    for (int i = 0; i < p->p_nsegments; ++i) {
+        proc_segment* seg = &p->p_segments[i];
+        if ((seg->perm & PTE_FILE)
+            && mmap_writeback(p, seg, seg->va, seg->end_mem) < 0) {
+            log_printf("mmap_release(pid %d): writeback of inode %u failed\n",
+                       p->p_pid, seg->ino);
+        }
+    }
+}
+
+
+void mmap_detach(proc* p, uint32_t ino) {
+    for (int i = 0; i < p->p_nsegments; ++i) {
+        proc_segment* seg = &p->p_segments[i];
+        if ((seg->perm & PTE_FILE) && seg->ino == ino) {
+            seg->ino = 0;
+        }
+    }
+}
+
+
+void mmap_file_removed(uint32_t ino) {
+    for (int i = 0; i < MMAP_PAGES; ++i) {
+        if (mmap_pages[i].ino == ino) {
+            page_unref(mmap_pages[i].pa);
+            mmap_pages[i].ino = 0;
+        }
+    }
+}
@@ -0,0 +1,21 @@
+#ifndef WEENSYOS_K_SEGMENTS_H
+#define WEENSYOS_K_SEGMENTS_H
+
+// k-segments.h
+//
+//    Kernel stack and segment selector constants. Only preprocessor
+//    definitions: k-exception.S includes this file too.
+
+// Top of the kernel stack
+#define KERNEL_STACK_TOP        0xA0000
+
+// Segment selectors, in the order SYSCALL/SYSRET require (see the STAR
+// MSR in segments_init): kernel data right after kernel code, application
+// data right before application code.
+#define SEGSEL_KERN_CODE        0x8             // kernel code segment
+#define SEGSEL_KERN_DATA        0x10            // kernel data segment
+#define SEGSEL_APP_DATA         0x18            // application data segment
+#define SEGSEL_APP_CODE         0x20            // application code segment
+#define SEGSEL_TASKSTATE        0x28            // task state segment
+
+#endif
@@ -0,0 +1,103 @@
+#include "kernel.h"
+#include "lib.h"
+#include "errno.h"
+
+// k-usercopy.c
+//
+//    Access to the current process's memory from system calls. A user
+//    buffer is contiguous in virtual memory but not necessarily in physical
+//    memory, so it is walked one run of physically contiguous pages at a
+//    time; the kernel reaches each run through its identity mapping.
+
+extern proc* current;
+
+
+size_t user_run(uintptr_t va, size_t size, int perm, uintptr_t* pa) {
+    perm |= PTE_P | PTE_U;
+    size_t n = 0;
+    int file = 0;               // the run holds a mapped file page
+    while (n < size) {
+        uintptr_t addr = va + n;
+        if (addr < va || addr >= MEMSIZE_VIRTUAL) {
+            break;
+        }
+        // faulting in a mapped file page may evict another (see mmap_page),
+        // maybe one this run holds: end the run there instead
+        if (file && virtual_memory_lookup(current->p_pagetable, addr).pn < 0) {
+            break;
+        }
+        if ((perm & PTE_W) && cow_break(current, addr) < 0) {
+            break;
+        }
+        program_demand_page(current, addr, pagetable_alloc);
+
+        vamapping vam = virtual_memory_lookup(current->p_pagetable, addr);
+        if (vam.pn < 0 || (vam.perm & perm) != perm) {
+            break;
+        }
+        file |= (vam.perm & PTE_FILE) != 0;
+        // the MMU does not see the kernel's writes to a mapped file page
+        if ((perm & PTE_W) && (vam.perm & PTE_FILE) && !(vam.perm & PTE_D)) {
+            virtual_memory_map(current->p_pagetable, ROUNDDOWN(addr, PAGESIZE),
+                               PAGEADDRESS(vam.pn), PAGESIZE, vam.perm | PTE_D, NULL);
+        }
+        if (n == 0) {
+            *pa = vam.pa;
+        } else if (vam.pa != *pa + n) {
+            break;
+        }
+        n += MIN(size - n, (size_t) (PAGESIZE - PAGEOFFSET(addr)));
+    }
+    return n;
+}
+
+
+int copy_from_user(void* dst, uintptr_t va, size_t size) {
+    while (size > 0) {
+        uintptr_t pa;
+        size_t n = user_run(va, size, 0, &pa);
+        if (n == 0) {
+            return -EFAULT;
+        }
+        memcpy(dst, (const void*) pa, n);
+        dst = (uint8_t*) dst + n;
+        va += n;
+        size -= n;
+    }
+    return 0;
+}
+
+
+int copy_to_user(uintptr_t va, const void* src, size_t size) {
+    while (size > 0) {
+        uintptr_t pa;
+        size_t n = user_run(va, size, PTE_W, &pa);
+        if (n == 0) {
+            return -EFAULT;
+        }
+        memcpy((void*) pa, src, n);
+        src = (const uint8_t*) src + n;
+        va += n;
+        size -= n;
+    }
+    return 0;
+}
+
+
+ssize_t strncpy_from_user(char* dst, uintptr_t va, size_t size) {
+    size_t len = 0;
+    while (len < size) {
+        uintptr_t pa;
+        size_t n = user_run(va + len, size - len, 0, &pa);
+        if (n == 0) {
+            return -EFAULT;
+        }
+        const char* s = (const char*) pa;
+        for (size_t i = 0; i < n; ++i, ++len) {
+            if ((dst[len] = s[i]) == '\0') {
+                return len;
+            }
+        }
+    }
+    return -ENAMETOOLONG;
+}
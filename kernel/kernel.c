@@ -7,6 +7,7 @@
 #include "string.h"
 #include "k-malloc.h"
 #include "k-filedescriptor.h"
+#include "aes.h"
 
 // kernel.c
 //
@@ -22,18 +23,25 @@
 // |     | Code + Data  Stack |  ...  : Memory | Code + Data  Stack | Code ...
 // +-----+--------------------+----------------+--------------------+---------/
 // 0  0x40000              0x80000 0xA0000 0x100000             0x140000
-//                                             ^
-//                                             | \___ PROC_SIZE ___/
-//                                      PROC_START_ADDR
+//                                               \___ PROC_SIZE ___/
+//
+// PROCESS VIRTUAL MEMORY LAYOUT
+//
+// Virtual addresses [0, MEMSIZE_PHYSICAL) map physical memory one-to-one,
+// kernel-only except for the console. Process code, data and heap start
+// at PROC_START_ADDR (== MEMSIZE_PHYSICAL), and the stack page is the last
+// page below MEMSIZE_VIRTUAL.
 
 #define PROC_SIZE 0x40000       // initial state only
 
-static proc processes[NPROC];   // array of process descriptors
+proc processes[NPROC];          // array of process descriptors
                                 // Note that `processes[0]` is never used.
 proc* current;                  // pointer to currently executing proc
 
 #define HZ 100                  // timer interrupt frequency (interrupts/sec)
 static unsigned ticks;          // # timer interrupts so far
+#define FS_COMMIT_INTERVAL HZ   // ticks between metadata journal commits
+#define CHECK_INTERVAL HZ       // ticks between virtual memory checks
 
 void schedule(void);
 void run(proc* p) __attribute__((noreturn));
@@ -58,6 +66,17 @@ static int memshow_enabled = 0;
 //      as the console), and a number >=0 means that process ID.
 //
 //    pageinfo_init() sets up the initial pageinfo[] state.
+//
+//    Free pages are kept by a buddy allocator: a free block of order `k` is
+//    2^k pages starting at a multiple of 2^k, linked in free_head[k]
+//    through free_link[] of its first page.
+//
+//    The pages owned by each process are linked in owned_head[pid] through
+//    owned_link[], so freeing them costs the process's footprint rather
+//    than a scan of physical memory.
+//
+//    Single pages are handed out from zero_pool[] when possible: free pages
+//    taken out of the buddy allocator and zeroed while the CPU is idle.
 
 typedef struct physical_pageinfo {
     int8_t owner;
@@ -66,7 +85,28 @@ typedef struct physical_pageinfo {
 
 static physical_pageinfo pageinfo[PAGENUMBER(MEMSIZE_PHYSICAL)];
 
+#define PAGE_MAX_ORDER 9                // 2^9 pages = MEMSIZE_PHYSICAL
+
+static int16_t free_head[PAGE_MAX_ORDER + 1];
+static struct free_link {
+    int16_t next, prev;
+    int8_t order;                       // -1 unless first page of a free block,
+                                        // ZERO_POOL if in zero_pool[]
+} free_link[NPAGES];
+
+#define ZERO_POOL (-2)
+#define ZERO_POOL_SIZE 32
+
+static int16_t zero_pool[ZERO_POOL_SIZE];
+static int zero_pool_count;
+
+static int16_t owned_head[NPROC];
+static struct owned_link {
+    int16_t next, prev;
+} owned_link[NPAGES];
+
 static void pageinfo_init(void);
+static void page_free(int pn);
 
 
 // Memory functions
@@ -81,7 +121,7 @@ void memshow_virtual_animate(void);
 
 #define FILESYSTEM_DISK_OFFSET 1024*512
 
-static fs_descriptor fsdesc;
+fs_descriptor fsdesc;
 
 static int fs_read_disk(uintptr_t ptr, uint64_t start, size_t size) {
     int r = readdisk(ptr, start + FILESYSTEM_DISK_OFFSET, size);
@@ -114,12 +154,36 @@ static normpath resolve_path(const char *path) {
     return resolved_normpath;
 }
 
+// user_path(va, path)
+//    Copies the path at user address `va` of the current process and
+//    resolves it against the working directory into `*path`. Returns 0 on
+//    success and a negative error code if the path is not readable or too
+//    long.
+static int user_path(uintptr_t va, normpath* path) {
+    static char buffer[sizeof(current->p_cwd)];
+    ssize_t r = strncpy_from_user(buffer, va, sizeof(buffer));
+    if (r < 0) {
+        return r;
+    }
+    *path = resolve_path(buffer);
+    return 0;
+}
 
 // kernel(command)
 //    Initialize the hardware and processes and start running. The `command`
 //    string is an optional string passed from the boot loader.
 
-static void process_setup(pid_t pid, int program_number, pid_t parent);
+static void process_setup(pid_t pid, uint32_t ino, pid_t parent);
+static int64_t program_lookup(const char* name, int* builtin);
+static void program_registry_init(void);
+
+// Program arguments are copied to this page of the new address space,
+// and the kernel data page follows it.
+#define ARGS_VA (PROC_START_ADDR + 0x40000)    // VDSO_ADDR - PAGESIZE
+
+static void vdso_init(void);
+static int vdso_setup(proc* p);
+static void vdso_reseed(proc* p);
 
 void kernel(void) {
     hardware_init();
@@ -128,8 +192,10 @@ void kernel(void) {
     pageinfo_init();
     console_clear();
     timer_init(HZ);
+    keyboard_interrupt_init();
 
     request_user_entropy();   // collect user generated entropy at boot
+    vdso_init();
 
     // nullptr is inaccessible even to the kernel
     virtual_memory_map(kernel_pagetable, (uintptr_t) 0, (uintptr_t) 0,
@@ -153,35 +219,290 @@ void kernel(void) {
 
     strcpy(processes[0].p_cwd, "/");
 
-    //process_setup(6, 0); // p-allocator
-    process_setup(5, 2, 0); // hello
-    process_setup(1, 1, 0); // fork
+    program_registry_init();
+
+    int builtin;
+    int64_t shell = program_lookup("shell", &builtin);
+    int64_t fork = program_lookup("fork", &builtin);
+    if (shell < 0 || fork < 0) {
+        panic("No /bin/shell or /bin/fork in the filesystem\n");
+    }
+
+    process_setup(5, shell, 0); // hello
+    process_setup(1, fork, 0); // fork
 
     run(&processes[1]);
 }
 
-uintptr_t page_alloc(pageowner_t owner)
-{
-    static int pageno = 0;
-    uintptr_t pt = (uintptr_t)NULL;
+// free_push(pn, order), free_remove(pn)
+//    Add or remove the free block of order `order` starting at page `pn`.
 
-    for (int tries = 0; tries < PAGENUMBER(MEMSIZE_PHYSICAL); ++tries)
-    {
-	if (pageinfo[pageno].owner == PO_FREE) {
-	    pageinfo[pageno].owner = owner;
-	    pageinfo[pageno].refcount++;
-	    pt = (uintptr_t)(PAGEADDRESS(pageno));
+static void free_push(int pn, int order) {
+    free_link[pn].order = order;
+    free_link[pn].prev = -1;
+    free_link[pn].next = free_head[order];
+    if (free_head[order] >= 0) {
+        free_link[free_head[order]].prev = pn;
+    }
+    free_head[order] = pn;
+}
 
-	    memset((void*) PAGEADDRESS(pageno), 0, PAGESIZE);
+static void free_remove(int pn) {
+    struct free_link* fl = &free_link[pn];
+    if (fl->prev >= 0) {
+        free_link[fl->prev].next = fl->next;
+    } else {
+        free_head[fl->order] = fl->next;
+    }
+    if (fl->next >= 0) {
+        free_link[fl->next].prev = fl->prev;
+    }
+    fl->order = -1;
+}
 
-	    //log_printf("proc %d: page_alloc = %d (%p)\n", current->p_pid, pageno, PAGEADDRESS(pageno));
-	    break;
-	}
+// page_owner_set(pn, owner)
+//    Changes the owner of page `pn`, moving it between the owned_head[]
+//    lists.
+
+static void page_owner_set(int pn, int owner) {
+    int old = pageinfo[pn].owner;
+    struct owned_link* ol = &owned_link[pn];
+    if (old > 0) {
+        if (ol->prev >= 0) {
+            owned_link[ol->prev].next = ol->next;
+        } else {
+            owned_head[old] = ol->next;
+        }
+        if (ol->next >= 0) {
+            owned_link[ol->next].prev = ol->prev;
+        }
+    }
+    pageinfo[pn].owner = owner;
+    if (owner > 0) {
+        ol->prev = -1;
+        ol->next = owned_head[owner];
+        if (owned_head[owner] >= 0) {
+            owned_link[owned_head[owner]].prev = pn;
+        }
+        owned_head[owner] = pn;
+    }
+}
+
+// buddy_alloc(order)
+//    Removes a free block of 2^`order` pages from the buddy allocator.
+//    Returns its first page number, or -1 if there is none.
+
+static int buddy_alloc(int order) {
+    int k = order;
+    while (k <= PAGE_MAX_ORDER && free_head[k] < 0) {
+        ++k;
+    }
+    if (k > PAGE_MAX_ORDER) {
+        return -1;
+    }
+
+    int pn = free_head[k];
+    free_remove(pn);
+    // split, returning the upper halves
+    while (k > order) {
+        --k;
+        free_push(pn + (1 << k), k);
+    }
+    return pn;
+}
+
+// zero_pool_refill()
+//    Zeroes one more free page for the zero pool. Called when idle.
+
+static void zero_pool_refill(void) {
+    if (zero_pool_count == ZERO_POOL_SIZE) {
+        return;
+    }
+    int pn = buddy_alloc(0);
+    if (pn >= 0) {
+        memset((void*) PAGEADDRESS(pn), 0, PAGESIZE);
+        free_link[pn].order = ZERO_POOL;
+        zero_pool[zero_pool_count++] = pn;
+    }
+}
+
+// zero_pool_drain()
+//    Returns the zero pool to the buddy allocator, so its pages can merge
+//    into larger blocks.
+
+static void zero_pool_drain(void) {
+    while (zero_pool_count > 0) {
+        int pn = zero_pool[--zero_pool_count];
+        free_link[pn].order = -1;
+        page_free(pn);
+    }
+}
+
+// page_alloc_order(owner, order)
+//    Allocates 2^`order` physically contiguous, zeroed pages to `owner`,
+//    each with reference count 1. Returns the address of the first page,
+//    or NULL if there is no free block that large.
+
+uintptr_t page_alloc_order(pageowner_t owner, int order) {
+    int pn;
+    if (order == 0 && zero_pool_count > 0) {
+        // already zero
+        pn = zero_pool[--zero_pool_count];
+        free_link[pn].order = -1;
+    } else {
+        pn = buddy_alloc(order);
+        if (pn < 0 && zero_pool_count > 0) {
+            zero_pool_drain();
+            pn = buddy_alloc(order);
+        }
+        if (pn < 0) {
+            return (uintptr_t) NULL;
+        }
+        memset((void*) PAGEADDRESS(pn), 0, PAGESIZE << order);
+    }
+
+    for (int i = 0; i < (1 << order); ++i) {
+        assert(pageinfo[pn + i].owner == PO_FREE);
+        page_owner_set(pn + i, owner);
+        pageinfo[pn + i].refcount = 1;
+    }
+    return PAGEADDRESS(pn);
+}
 
-	pageno = (pageno + 1) % PAGENUMBER(MEMSIZE_PHYSICAL);
+uintptr_t page_alloc(pageowner_t owner) {
+    return page_alloc_order(owner, 0);
+}
+
+// page_free(pn)
+//    Returns page `pn` to the buddy allocator, merging it with its free
+//    buddies.
+
+static void page_free(int pn) {
+    page_owner_set(pn, PO_FREE);
+    pageinfo[pn].refcount = 0;
+
+    int k = 0;
+    while (k < PAGE_MAX_ORDER) {
+        int buddy = pn ^ (1 << k);
+        if (buddy >= NPAGES || free_link[buddy].order != k) {
+            break;
+        }
+        free_remove(buddy);
+        pn = MIN(pn, buddy);
+        ++k;
+    }
+    free_push(pn, k);
+}
+
+void page_ref(uintptr_t pa) {
+    int pn = PAGENUMBER(pa);
+    assert(pageinfo[pn].refcount > 0);
+    ++pageinfo[pn].refcount;
+}
+
+void page_unref(uintptr_t pa) {
+    int pn = PAGENUMBER(pa);
+    assert(pageinfo[pn].refcount > 0);
+    if (--pageinfo[pn].refcount == 0) {
+        page_free(pn);
+    }
+}
+
+int page_refcount(uintptr_t pa) {
+    return pageinfo[PAGENUMBER(pa)].refcount;
+}
+
+// process_free_pages(pid, keep)
+//    Frees every page owned by process `pid`, except page `keep`.
+
+static void process_free_pages(pid_t pid, uintptr_t keep) {
+    x86_64_pagetable* pagetable = processes[pid].p_pagetable;
+    if (pagetable && pagetable != kernel_pagetable) {
+        tlb_invalidate_pagetable(pagetable);
+    }
+    processes[pid].p_vdso = NULL;
+
+    int pn = owned_head[pid];
+    while (pn >= 0) {
+        int next = owned_link[pn].next;
+        if (PAGEADDRESS(pn) != keep) {
+            assert(pageinfo[pn].owner == pid && pageinfo[pn].refcount == 1);
+            page_free(pn);
+        }
+        pn = next;
     }
+}
 
-    return pt;
+// process_unshare(p)
+//    Drops the references of process `p` to shared (copy-on-write or
+//    mapped file) pages, after writing its file mappings back. The pages
+//    it owns are freed separately, by owner. Only user mappings count:
+//    below PROC_START_ADDR every page table aliases all of physical
+//    memory, shared pages included, without holding references. The walk
+//    skips absent page tables and reads each level-4 table once.
+
+static void process_unshare(proc* p) {
+    mmap_release(p);
+    uintptr_t va = PROC_START_ADDR;
+    while (va < MEMSIZE_VIRTUAL) {
+        // descend to the level-4 table for `va`
+        x86_64_pagetable* pt = p->p_pagetable;
+        int level = 0;
+        for (; level < 3; ++level) {
+            x86_64_pageentry_t pe = pt->entry[PAGEINDEX(va, level)];
+            if (!(pe & PTE_P)) {
+                break;
+            }
+            pt = (x86_64_pagetable*) PTE_ADDR(pe);
+        }
+        // an absent entry at `level` maps nothing in the range it covers;
+        // a level-4 table covers what one level-3 entry does
+        uintptr_t span = (uintptr_t) PAGESIZE << ((3 - MIN(level, 2)) * PAGEINDEXBITS);
+        uintptr_t next = ROUNDDOWN(va, span) + span;
+        if (level < 3) {
+            va = next;
+            continue;
+        }
+
+        for (; va < next && va < MEMSIZE_VIRTUAL; va += PAGESIZE) {
+            x86_64_pageentry_t pe = pt->entry[L4PAGEINDEX(va)];
+            int pn = PAGENUMBER(pe);
+            if ((pe & (PTE_P | PTE_U)) == (PTE_P | PTE_U)
+                && pageinfo[pn].owner == PO_SHARED) {
+                page_unref(PTE_ADDR(pe));
+            }
+        }
+    }
+}
+
+// cow_break(p, va)
+//    Gives process `p` a private, writable copy of the copy-on-write page
+//    containing `va`. The last process sharing a page just takes it over.
+//    Returns 0 on success, 1 if the page is not copy-on-write, and -1 if
+//    out of memory.
+
+int cow_break(proc* p, uintptr_t va) {
+    va = ROUNDDOWN(va, PAGESIZE);
+    vamapping vam = virtual_memory_lookup(p->p_pagetable, va);
+    if (vam.pn < 0 || !(vam.perm & PTE_COW)) {
+        return 1;
+    }
+
+    int perm = (vam.perm & ~PTE_COW) | PTE_W;
+    uintptr_t pa = PAGEADDRESS(vam.pn);
+
+    if (pageinfo[vam.pn].refcount == 1) {
+        page_owner_set(vam.pn, p->p_pid);
+    } else {
+        pa = page_alloc(p->p_pid);
+        if (pa == (uintptr_t) NULL) {
+            return -1;
+        }
+        memcpy((void*) pa, (void*) PAGEADDRESS(vam.pn), PAGESIZE);
+        page_unref(vam.pa);
+    }
+
+    return virtual_memory_map(p->p_pagetable, va, pa, PAGESIZE, perm, NULL);
 }
 
 x86_64_pagetable* pagetable_alloc(void)
@@ -189,30 +510,23 @@ x86_64_pagetable* pagetable_alloc(void)
     return (x86_64_pagetable*)page_alloc(current->p_pid);
 }
 
-// process_setup(pid, program_number, parent)
-//    Load application program `program_number` as process number `pid`.
+// process_setup(pid, ino, parent)
+//    Load the executable in filesystem inode `ino` as process number `pid`.
 //    This loads the application's code and data into memory, sets its
 //    %rip and %rsp, gives it a stack page, and marks it as runnable.
 
-void process_setup(pid_t pid, int program_number, pid_t parent) {
-    extern char end[];
-
+void process_setup(pid_t pid, uint32_t ino, pid_t parent) {
     process_init(&processes[pid], 0);
 
     current = &processes[pid];
     x86_64_pagetable* p_pagetable = pagetable_alloc();
     assert(p_pagetable != NULL);
 
+    // all physical memory (except the null page), for the kernel
     virtual_memory_map(p_pagetable,
-		       KERNEL_START_ADDR,
-		       KERNEL_START_ADDR,
-		       PAGEADDRESS(PAGENUMBER((uintptr_t)end) + 1)
-			    - KERNEL_START_ADDR,
-		       PTE_P | PTE_W, pagetable_alloc);
-    virtual_memory_map(p_pagetable,
-		       KERNEL_STACK_TOP - PAGESIZE,
-		       KERNEL_STACK_TOP - PAGESIZE,
 		       PAGESIZE,
+		       PAGESIZE,
+		       MEMSIZE_PHYSICAL - PAGESIZE,
 		       PTE_P | PTE_W, pagetable_alloc);
     virtual_memory_map(p_pagetable,
 		       (uintptr_t) console,
@@ -220,34 +534,240 @@ void process_setup(pid_t pid, int program_number, pid_t parent) {
 		       PAGESIZE, PTE_P | PTE_W | PTE_U, pagetable_alloc);
 
     processes[pid].p_pagetable = p_pagetable;
-    int r = program_load(&processes[pid], program_number, pagetable_alloc);
+    int r = program_load(&processes[pid], ino, pagetable_alloc);
     assert(r >= 0);
 
     processes[pid].p_registers.reg_rsp = MEMSIZE_VIRTUAL;
-    uintptr_t stack_page = processes[pid].p_registers.reg_rsp - PAGESIZE;
-    uintptr_t pstack_page = page_alloc(pid);
-    virtual_memory_map(p_pagetable, stack_page, pstack_page,
-                       PAGESIZE, PTE_P | PTE_W | PTE_U, pagetable_alloc);
+    r = program_map_zero(&processes[pid], MEMSIZE_VIRTUAL - PAGESIZE,
+                         PAGESIZE, PTE_P | PTE_W | PTE_U);
+    assert(r >= 0);
+    r = vdso_setup(&processes[pid]);
+    assert(r >= 0);
 
     processes[pid].p_parent = parent;
     processes[pid].p_state = P_RUNNABLE;
     processes[pid].p_wait_pid = -1;
     processes[pid].fd_max = 0;
     processes[pid].fd_list = NULL;
+    processes[pid].p_ioring = 0;
     strcpy(processes[pid].p_cwd, processes[parent].p_cwd);
 }
 
-void process_kill(pid_t pid) {
-    processes[pid].p_state = P_BROKEN;
+// Program registry: an open-addressing hash table from command names to
+// the executables in /bin and the kernel builtins. It is filled at boot
+// by scanning /bin, validating each ELF header once; exec falls back to
+// a path lookup only on a miss, and adds what it finds.
+
+#define PROGRAM_REGISTRY_SIZE 64        // power of 2
+
+enum { BUILTIN_SHOW = 1, BUILTIN_HIDE, BUILTIN_CLEAR, BUILTIN_TESTMALLOC };
+
+typedef struct program_entry {
+    char name[FS_NAME_SIZE];            // "" if the slot is empty
+    uint32_t ino;                       // 0 if stale or a builtin
+    int builtin;                        // BUILTIN_*, or 0
+} program_entry;
+
+static program_entry program_registry[PROGRAM_REGISTRY_SIZE];
+
+// program_slot(name)
+//    Returns the registry slot of `name`, or the empty slot where it would
+//    go, or NULL if the registry is full.
+
+static program_entry* program_slot(const char* name) {
+    uint32_t h = 2166136261U;           // FNV-1a
+    for (const char* c = name; *c; c++) {
+        h = (h ^ (uint8_t) *c) * 16777619U;
+    }
+
+    for (int i = 0; i < PROGRAM_REGISTRY_SIZE; i++) {
+        program_entry* pe = &program_registry[(h + i) % PROGRAM_REGISTRY_SIZE];
+        if (pe->name[0] == '\0' || strcmp(pe->name, name) == 0) {
+            return pe;
+        }
+    }
+    return NULL;
+}
+
+static void program_register(const char* name, uint32_t ino, int builtin) {
+    program_entry* pe = program_slot(name);
+    if (pe && strlen(name) < FS_NAME_SIZE) {
+        strcpy(pe->name, name);
+        pe->ino = ino;
+        pe->builtin = builtin;
+    }
+}
+
+// program_invalidate(ino)
+//    Forgets what is cached about the executable in inode `ino`, which is
+//    being written or removed.
+
+void program_invalidate(uint32_t ino) {
+    program_cache_invalidate(ino);
+    for (int i = 0; i < PROGRAM_REGISTRY_SIZE; i++) {
+        if (program_registry[i].ino == ino) {
+            program_registry[i].ino = 0;
+        }
+    }
+}
+
+// exec_builtin(builtin, argv_va)
+//    Runs kernel builtin command `builtin` with the arguments at user
+//    address `argv_va`.
+
+static void exec_builtin(int builtin, uintptr_t argv_va) {
+    switch (builtin) {
+    case BUILTIN_SHOW:
+        memshow_enabled = 1;
+        break;
+
+    case BUILTIN_HIDE:
+        memshow_enabled = 0;
+        console_clear();
+        break;
+
+    case BUILTIN_CLEAR:
+        console_clear();
+        break;
+
+    case BUILTIN_TESTMALLOC: {
+        static char arg[64];
+        uintptr_t argv[2];
+        if (copy_from_user(argv, argv_va, sizeof(argv)) == 0 && argv[1]
+            && strncpy_from_user(arg, argv[1], sizeof(arg)) >= 0) {
+            testmalloc(arg);
+        } else {
+            testmalloc(NULL);
+        }
+        break;
+    }
+    }
+}
+
+// program_lookup(name, builtin)
+//    Returns the inode of the executable run by command `name`: the file
+//    at path `name` if it contains a '/', otherwise /bin/`name`. If `name`
+//    is a kernel builtin, returns 0 and sets `*builtin`. Returns a
+//    negative error code if there is no such executable.
+
+static int64_t program_lookup(const char* name, int* builtin) {
+    static char buffer[FS_NAME_SIZE + 8];
+    const char* path = name;
 
-    for (int pn = 0; pn < NPAGETABLEENTRIES; pn++) {
-        if (pageinfo[pn].owner == pid) {
-            assert(pageinfo[pn].refcount == 1);
-            pageinfo[pn].owner = PO_FREE;
-            pageinfo[pn].refcount = 0;
+    *builtin = 0;
+    if (!strchr(name, '/')) {
+        if (strlen(name) >= FS_NAME_SIZE) {
+            return -ENAMETOOLONG;
         }
+
+        program_entry* pe = program_slot(name);
+        if (pe && pe->name[0] && (pe->ino || pe->builtin)) {
+            *builtin = pe->builtin;
+            return pe->ino;
+        }
+
+        snprintf(buffer, sizeof(buffer), "/bin/%s", name);
+        path = buffer;
     }
 
+    int64_t ino = fs_getattr(&fsdesc, resolve_path(path));
+    if (ino <= 0 || program_check(ino) < 0) {
+        log_printf("command not found : %s\n", path);
+        return ino < 0 ? ino : -ENOEXEC;
+    }
+    if (path == buffer) {
+        program_register(name, ino, 0);
+    }
+    return ino;
+}
+
+// program_registry_init()
+//    Registers the kernel builtins and every executable in /bin.
+
+static void program_registry_init(void) {
+    program_register("show", 0, BUILTIN_SHOW);
+    program_register("hide", 0, BUILTIN_HIDE);
+    program_register("clear", 0, BUILTIN_CLEAR);
+    program_register("testmalloc", 0, BUILTIN_TESTMALLOC);
+
+    static dirent ents[8];
+    normpath bin = resolve_path("/bin");
+    uint32_t cookie = 0;
+    int n, builtin;
+    while ((n = fs_getdents(&fsdesc, bin, cookie, ents, 8)) > 0) {
+        for (int i = 0; i < n; i++) {
+            if (ents[i].d_type == DT_REG) {
+                program_lookup(ents[i].d_name, &builtin);
+            }
+        }
+        cookie += n;
+    }
+}
+
+// args_page_alloc(owner, argv_va, argc)
+//    Copies the argument vector at user address `argv_va` of the current
+//    process into a new page owned by `owner`, laid out for ARGS_VA.
+//    Stores the argument count in `*argc`. Returns the page's physical
+//    address, or NULL if out of memory or if the arguments are not
+//    readable or do not fit in the page.
+
+static uintptr_t args_page_alloc(pid_t owner, uintptr_t argv_va, int* argc) {
+    uintptr_t pargs_pa = page_alloc(owner);
+    if (pargs_pa == (uintptr_t) NULL) {
+        return pargs_pa;
+    }
+
+    // the pointers are copied to the start of the page first, then
+    // replaced by the addresses of the copied strings
+    uintptr_t* argv = (uintptr_t*) pargs_pa;
+    int n = 0;
+    do {
+        if ((n + 1) * sizeof(uintptr_t) > PAGESIZE
+            || copy_from_user(&argv[n], argv_va + n * sizeof(uintptr_t),
+                              sizeof(uintptr_t)) < 0) {
+            page_unref(pargs_pa);
+            return (uintptr_t) NULL;
+        }
+    } while (argv[n++]);
+    --n;
+
+    uintptr_t offset = (n+1)*sizeof(char*);
+
+    for (int i = 0; i < n; i++) {
+        ssize_t len = strncpy_from_user((char*) (pargs_pa+offset), argv[i],
+                                        PAGESIZE - offset);
+        if (len < 0) {
+            page_unref(pargs_pa);
+            return (uintptr_t) NULL;
+        }
+        argv[i] = ARGS_VA+offset;
+        offset += len+1;
+    }
+
+    *argc = n;
+    return pargs_pa;
+}
+
+// args_page_map(p, pargs_pa, argc)
+//    Maps the argument page built by args_page_alloc into freshly set up
+//    process `p` and passes it to process_main.
+
+static void args_page_map(proc* p, uintptr_t pargs_pa, int argc) {
+    assert(virtual_memory_map(p->p_pagetable, ARGS_VA, pargs_pa,
+                        PAGESIZE, PTE_P | PTE_W | PTE_U, NULL) == 0);
+
+    p->p_registers.reg_rdi = argc;
+    p->p_registers.reg_rsi = ARGS_VA;
+}
+
+void process_kill(pid_t pid) {
+    if (processes[pid].p_state != P_FREE && processes[pid].p_state != P_BROKEN) {
+        process_unshare(&processes[pid]);
+    }
+    processes[pid].p_state = P_BROKEN;
+
+    process_free_pages(pid, 0);
+
     if (processes[pid].p_parent >= 1) {
         assert(processes[pid].p_parent < NPROC);
         proc* parent = &processes[processes[pid].p_parent];
@@ -270,12 +790,44 @@ int assign_physical_page(uintptr_t addr, int8_t owner) {
         || addr >= MEMSIZE_PHYSICAL
         || pageinfo[PAGENUMBER(addr)].refcount != 0) {
         return -1;
-    } else {
-        pageinfo[PAGENUMBER(addr)].refcount = 1;
-        pageinfo[PAGENUMBER(addr)].owner = owner;
-	memset((void*) PAGEADDRESS(PAGENUMBER(addr)), 0, PAGESIZE);
+    }
+
+    int pn = PAGENUMBER(addr);
+    if (free_link[pn].order == ZERO_POOL) {
+        for (int i = 0; i < zero_pool_count; ++i) {
+            if (zero_pool[i] == pn) {
+                zero_pool[i] = zero_pool[--zero_pool_count];
+                break;
+            }
+        }
+        free_link[pn].order = -1;
+        page_owner_set(pn, owner);
+        pageinfo[pn].refcount = 1;
         return 0;
     }
+
+    // find the free block containing the page, and split it down to it
+    int k = 0;
+    while (free_link[pn & ~((1 << k) - 1)].order != k) {
+        ++k;
+        assert(k <= PAGE_MAX_ORDER);
+    }
+    int head = pn & ~((1 << k) - 1);
+    free_remove(head);
+    while (k > 0) {
+        --k;
+        if (pn >= head + (1 << k)) {
+            free_push(head, k);
+            head += 1 << k;
+        } else {
+            free_push(head + (1 << k), k);
+        }
+    }
+
+    page_owner_set(pn, owner);
+    pageinfo[pn].refcount = 1;
+    memset((void*) PAGEADDRESS(pn), 0, PAGESIZE);
+    return 0;
 }
 
 #define STDIN_LENGTH 2024
@@ -295,20 +847,323 @@ void check_keyboard_push(void) {
     }
 }
 
-// returns -1 if there is not innput character; else returns the character (similar to the other function check_keyboard_push right above; except there is a buffer with push now)
+// returns -1 if there is not innput character; else returns the next character buffered by check_keyboard_push (on keyboard interrupts)
 int check_keyboard_pop(void) {
-    int c = check_keyboard();
+    if (stdin_next == stdin_end) {
+        return -1;
+    }
 
-    if (c !=0 && c == -1) {
-        if (stdin_next == stdin_end) {
-            return -1;
+    int c = stdin_buffer[stdin_next];
+    stdin_next = (stdin_next + 1) % STDIN_LENGTH;
+    return c;
+}
+
+
+// File system calls
+//    Shared by the system call handlers and the I/O ring. Each returns the
+//    system call's result or a negative error code.
+
+static int64_t file_open(uintptr_t path_va) {
+    normpath path;
+    int64_t r = user_path(path_va, &path);
+    if (r < 0) {
+        return r;
+    }
+
+    log_printf("path : %s\n", path);
+
+    r = fs_getattr(&fsdesc, path);
+    if (r < 0) {
+        log_printf("getattr failed %d\n", r);
+        return r;
+    }
+    uint32_t inode = (uint32_t) r;
+    log_printf("inode : %d\n", inode);
+
+    current->fd_max++;
+    r = fdlist_add_entry(&current->fd_list, current->fd_max, inode);
+    if (r < 0) {
+        log_printf("fdlist_add_entry failed %d\n", inode);
+        return r;
+    }
+
+    return current->fd_max;
+}
+
+static int file_stat(uintptr_t path_va, uintptr_t st_va) {
+    normpath path;
+    int r = user_path(path_va, &path);
+    if (r < 0) {
+        return r;
+    }
+
+    struct stat st;
+    r = fs_stat(&fsdesc, path, &st);
+    if (r >= 0) {
+        r = copy_to_user(st_va, &st, sizeof(st));
+    }
+    return r;
+}
+
+static int file_fstat(int fd, uintptr_t st_va) {
+    proc_fdentry_t *entry = fdlist_search_entry(&current->fd_list, fd);
+    if (entry == NULL) {
+        return -EINVAL;
+    }
+
+    struct stat st;
+    int r = fs_fstat(&fsdesc, entry->inode, &st);
+    if (r >= 0) {
+        r = copy_to_user(st_va, &st, sizeof(st));
+    }
+    return r;
+}
+
+// inode_read(ino, va, size, offset), inode_write(ino, va, size, offset)
+//    Transfer `size` bytes between the user buffer at `va` and file
+//    `ino` at `offset`, straight to or from each physically contiguous
+//    run of the buffer, which may span several pages. Return the number of
+//    bytes transferred, or a negative error code if none were.
+
+static ssize_t inode_read(fs_ino ino, uintptr_t va, size_t size, uint64_t offset) {
+    ssize_t r = 0;
+    while ((size_t) r < size) {
+        uintptr_t buf;
+        size_t chunk = user_run(va + r, size - r, PTE_W, &buf);
+        if (chunk == 0) {
+            return r > 0 ? r : -EFAULT;
         }
 
-        c = stdin_buffer[stdin_next];
-        stdin_next = (stdin_next + 1) % STDIN_LENGTH;
+        ssize_t n = fs_read(&fsdesc, ino, (void *) buf, chunk, offset + r);
+        if (n < 0) {
+            return r > 0 ? r : n;
+        }
+        r += n;
+        if ((size_t) n < chunk) {
+            break;
+        }
     }
+    return r;
+}
 
-    return c;
+static ssize_t inode_write(fs_ino ino, uintptr_t va, size_t size, uint64_t offset) {
+    program_invalidate(ino);
+
+    ssize_t r = 0;
+    while ((size_t) r < size) {
+        uintptr_t buf;
+        size_t chunk = user_run(va + r, size - r, 0, &buf);
+        if (chunk == 0) {
+            return r > 0 ? r : -EFAULT;
+        }
+
+        ssize_t n = fs_write(&fsdesc, ino, (const void *) buf, chunk, offset + r);
+        if (n < 0) {
+            log_printf("write failed %d\n", n);
+            return r > 0 ? r : n;
+        }
+        mmap_file_changed(ino, offset + r, chunk);
+        r += chunk;
+    }
+    return r;
+}
+
+// file_io(fd, va, size, offset, write)
+//    Read (or, if `write`, write) `size` bytes at user address `va` from
+//    open file `fd`, at `offset` or, if `offset` is negative, at the file's
+//    offset, which then advances.
+
+static ssize_t file_io(int fd, uintptr_t va, size_t size, off_t offset, int write) {
+    proc_fdentry_t *entry = fdlist_search_entry(&current->fd_list, fd);
+    if (entry == NULL) {
+        return -EINVAL;
+    }
+
+    uint64_t pos = offset < 0 ? (uint64_t) entry->offset : (uint64_t) offset;
+    ssize_t r = write ? inode_write(entry->inode, va, size, pos)
+        : inode_read(entry->inode, va, size, pos);
+    if (r > 0 && offset < 0) {
+        entry->offset += r;
+    }
+    return r;
+}
+
+// file_iov(fd, iov_va, iovcnt, write)
+//    Like file_io at the file's offset, but for the `iovcnt` buffers of
+//    the iovec array at user address `iov_va`, in order. Stops at the
+//    first short transfer.
+
+static ssize_t file_iov(int fd, uintptr_t iov_va, int iovcnt, int write) {
+    if (iovcnt < 0 || iovcnt > IOV_MAX) {
+        return -EINVAL;
+    }
+    iovec iov[IOV_MAX];
+    int r = copy_from_user(iov, iov_va, iovcnt * sizeof(iovec));
+    if (r < 0) {
+        return r;
+    }
+
+    ssize_t total = 0;
+    for (int i = 0; i < iovcnt; i++) {
+        ssize_t n = file_io(fd, (uintptr_t) iov[i].iov_base, iov[i].iov_len, -1, write);
+        if (n < 0) {
+            return total > 0 ? total : n;
+        }
+        total += n;
+        if ((size_t) n < iov[i].iov_len) {
+            break;
+        }
+    }
+    return total;
+}
+
+// file_copy(fd_in, fd_out, size)
+//    Copies `size` bytes from open file `fd_in` to open file `fd_out` with
+//    fs_copy_range, at and advancing each file's offset.
+
+static ssize_t file_copy(int fd_in, int fd_out, size_t size) {
+    proc_fdentry_t *in = fdlist_search_entry(&current->fd_list, fd_in);
+    proc_fdentry_t *out = fdlist_search_entry(&current->fd_list, fd_out);
+    if (in == NULL || out == NULL) {
+        return -EINVAL;
+    }
+
+    program_invalidate(out->inode);
+    ssize_t r = fs_copy_range(&fsdesc, in->inode, in->offset,
+                              out->inode, out->offset, size);
+    if (r > 0) {
+        mmap_file_changed(out->inode, out->offset, r);
+        in->offset += r;
+        out->offset += r;
+    }
+    return r;
+}
+
+// I/O ring
+//    A process queues requests in the submission ring of its `io_ring`
+//    page (see lib.h) and runs them all with one INT_SYS_IORING_ENTER.
+//    The kernel completes them in order, posting each result to the
+//    completion ring.
+
+// ioring_setup(va)
+//    Maps a new, empty I/O ring page at user address `va` of the current
+//    process, where nothing must be mapped yet, and makes it the process's
+//    ring. Returns 0 on success and a negative error code on failure.
+
+static int ioring_setup(uintptr_t va) {
+    if (va < PROC_START_ADDR || va >= MEMSIZE_VIRTUAL
+        || PAGEOFFSET(va) != 0
+        || virtual_memory_lookup(current->p_pagetable, va).pn >= 0) {
+        return -EINVAL;
+    }
+
+    uintptr_t pa = page_alloc(current->p_pid);
+    if (pa == (uintptr_t) NULL) {
+        return -ENOMEM;
+    }
+    if (virtual_memory_map(current->p_pagetable, va, pa, PAGESIZE,
+                           PTE_P | PTE_W | PTE_U, pagetable_alloc) < 0) {
+        page_unref(pa);
+        return -ENOMEM;
+    }
+
+    current->p_ioring = va;
+    return 0;
+}
+
+// ioring_enter()
+//    Runs the requests queued in the current process's I/O ring, as long
+//    as the completion ring has room. Returns the number of requests run,
+//    or a negative error code if the process has no usable ring.
+
+static int ioring_enter(void) {
+    // the page is looked up on every call: fork may have made it
+    // copy-on-write
+    uintptr_t pa;
+    if (!current->p_ioring
+        || user_run(current->p_ioring, sizeof(io_ring), PTE_W, &pa) != sizeof(io_ring)) {
+        return -EFAULT;
+    }
+    io_ring* ring = (io_ring*) pa;
+
+    int n = 0;
+    while (ring->sq_head != ring->sq_tail
+           && ring->cq_tail - ring->cq_head < IORING_ENTRIES) {
+        io_sqe* sqe = &ring->sq[ring->sq_head % IORING_ENTRIES];
+        int64_t r;
+        switch (sqe->op) {
+        case IORING_OP_OPEN:
+            r = file_open(sqe->addr);
+            break;
+        case IORING_OP_READ:
+            r = file_io(sqe->fd, sqe->addr, sqe->len, -1, 0);
+            break;
+        case IORING_OP_WRITE:
+            r = file_io(sqe->fd, sqe->addr, sqe->len, -1, 1);
+            break;
+        case IORING_OP_STAT:
+            r = file_stat(sqe->addr, sqe->arg);
+            break;
+        case IORING_OP_FSTAT:
+            r = file_fstat(sqe->fd, sqe->arg);
+            break;
+        default:
+            r = -EINVAL;
+            break;
+        }
+
+        io_cqe* cqe = &ring->cq[ring->cq_tail % IORING_ENTRIES];
+        cqe->user_data = sqe->user_data;
+        cqe->res = r;
+        ++ring->sq_head;
+        ++ring->cq_tail;
+        ++n;
+    }
+    return n;
+}
+
+
+// Kernel data page
+//    Each process has a private page, mapped read-only at VDSO_ADDR, with
+//    the vdso_data of lib.h. run() refreshes the time on every return to
+//    the process, and timer interrupts draw a new seed from an AES-CTR
+//    keystream keyed with boot entropy.
+
+static uint64_t tsc_hz;                 // measured cycle counter frequency
+static uint64_t tsc_first_tick;         // cycle counter at the first tick
+static struct AES_ctx vdso_rng;
+
+static void vdso_init(void) {
+    uint8_t key[AES_KEYLEN + AES_BLOCKLEN];
+    fs_generate_random(key, sizeof(key));
+    AES_init_ctx_iv(&vdso_rng, key, key + AES_KEYLEN);
+}
+
+// vdso_setup(p)
+//    Give process `p` a new kernel data page. Returns 0 on success and -1
+//    if out of memory.
+
+static int vdso_setup(proc* p) {
+    uintptr_t pa = page_alloc(p->p_pid);
+    if (pa == (uintptr_t) NULL) {
+        return -1;
+    }
+    if (virtual_memory_map(p->p_pagetable, VDSO_ADDR, pa, PAGESIZE,
+                           PTE_P | PTE_U, pagetable_alloc) < 0) {
+        page_unref(pa);
+        return -1;
+    }
+
+    p->p_vdso = (vdso_data*) pa;
+    p->p_vdso->pid = p->p_pid;
+    p->p_vdso->hz = HZ;
+    vdso_reseed(p);
+    return 0;
+}
+
+static void vdso_reseed(proc* p) {
+    AES_CTR_xcrypt_buffer(&vdso_rng, (uint8_t*) p->p_vdso->seed,
+                          sizeof(p->p_vdso->seed));
 }
 
 
@@ -324,29 +1179,40 @@ int check_keyboard_pop(void) {
 //    Note that hardware interrupts are disabled whenever the kernel is running.
 
 void exception(x86_64_registers* reg) {
-    // Copy the saved registers into the `current` process descriptor
-    // and always use the kernel's page table.
+    // Copy the saved registers into the `current` process descriptor.
+    // The kernel keeps running on the process's page table, which maps
+    // all of physical memory for it.
     current->p_registers = *reg;
-    set_pagetable(kernel_pagetable);
+
+    // syscall_entry takes the number straight from the user's %rax: only
+    // system calls may come in that way.
+    if (reg->reg_err == SYSCALL_ENTRY_ERR
+        && (reg->reg_intno < INT_SYS || reg->reg_intno > INT_SYS_MSYNC)) {
+        current->p_registers.reg_rax = -ENOSYS;
+        run(current);
+    }
 
     // It can be useful to log events using `log_printf`.
     // Events logged this way are stored in the host's `log.txt` file.
     //log_printf("proc %d: exception %d\n", current->p_pid, reg->reg_intno);
 
-    // Show the current cursor location and memory state
-    // (unless this is a kernel fault).
+    // Show the current cursor location and memory state, and check
+    // invariants. The checks walk every page table, so only WEENSYOS_DEBUG
+    // builds run them on every exception (except kernel faults); others
+    // refresh the display on timer ticks and check every CHECK_INTERVAL.
     console_show_cursor(cursorpos);
-    if (reg->reg_intno != INT_PAGEFAULT || (reg->reg_err & PFERR_USER)) {
-        check_virtual_memory();
+    if (WEENSYOS_DEBUG
+        ? reg->reg_intno != INT_PAGEFAULT || (reg->reg_err & PFERR_USER)
+        : reg->reg_intno == INT_TIMER) {
+        if (WEENSYOS_DEBUG || ticks % CHECK_INTERVAL == 0) {
+            check_virtual_memory();
+        }
         if (memshow_enabled) {
             memshow_physical();
             memshow_virtual_animate();
         }
     }
 
-    // If Control-C was typed, exit the virtual machine.
-    check_keyboard_push();
-
 
     // Actually handle the exception.
     switch (reg->reg_intno) {
@@ -391,56 +1257,54 @@ void exception(x86_64_registers* reg) {
         current->p_registers.reg_rax = check_keyboard_pop();
         break;
 
-    case INT_SYS_OPEN: {
+    case INT_SYS_OPEN:
         log_printf("proc %d: exception INT_SYS_OPEN (%d)\n", current->p_pid, reg->reg_intno);
+        current->p_registers.reg_rax = file_open(current->p_registers.reg_rdi);
+        break;
 
-        uintptr_t va = current->p_registers.reg_rdi;
-        vamapping vam = virtual_memory_lookup(current->p_pagetable, va);
-        normpath path = resolve_path((char *) vam.pa);
+    case INT_SYS_STAT:
+        log_printf("proc %d: exception INT_SYS_STAT (%d)\n", current->p_pid, reg->reg_intno);
+        current->p_registers.reg_rax = file_stat(current->p_registers.reg_rdi,
+                                                 current->p_registers.reg_rsi);
+        break;
 
-        log_printf("path : %s\n", path);
+    case INT_SYS_FSTAT:
+        current->p_registers.reg_rax = file_fstat(current->p_registers.reg_rdi,
+                                                  current->p_registers.reg_rsi);
+        break;
 
-        int64_t r = fs_getattr(&fsdesc, path);
-        if (r < 0) {
-            log_printf("getattr failed %d\n", r);
-            current->p_registers.reg_rax = r;
-            break;
-        }
-        uint32_t inode = (uint32_t) r;
-        log_printf("inode : %d\n", inode);
+    case INT_SYS_REMOVE: {
+        log_printf("proc %d: exception INT_SYS_REMOVE (%d)\n", current->p_pid, reg->reg_intno);
 
-        current->fd_max++;
-        r = fdlist_add_entry(&current->fd_list, current->fd_max, inode);
+        normpath path;
+        int r = user_path(current->p_registers.reg_rdi, &path);
         if (r < 0) {
-            log_printf("fdlist_add_entry failed %d\n", inode);
             current->p_registers.reg_rax = r;
             break;
-        };
-
-
-        // TODO: test
-        //proc_fdentry_t *entry = fdlist_search_entry(&current->fd_list, current->fd_max);
-        //log_printf("entry : %d\n", entry->inode);
-
-        current->p_registers.reg_rax = inode;
-        current->p_registers.reg_rax = current->fd_max;
-        break;
-    }
-
-    case INT_SYS_REMOVE: {
-        log_printf("proc %d: exception INT_SYS_REMOVE (%d)\n", current->p_pid, reg->reg_intno);
+        }
 
-        uintptr_t va = current->p_registers.reg_rdi;
-        vamapping vam = virtual_memory_lookup(current->p_pagetable, va);
-        normpath path = resolve_path((char *) vam.pa);
+        int64_t ino = fs_getattr(&fsdesc, path);
+        if (ino > 0) {
+            program_invalidate(ino);
+        }
 
-        int r = fs_remove(&fsdesc, path);
+        r = fs_remove(&fsdesc, path);
         if (r < 0) {
             log_printf("remove failed %d\n", r);
             current->p_registers.reg_rax = -1;
             break;
         }
 
+        struct stat st;
+        if (ino > 0 && fs_fstat(&fsdesc, ino, &st) == -ENOENT) {
+            for (pid_t pid = 1; pid < NPROC; ++pid) {
+                if (processes[pid].p_state != P_FREE) {
+                    mmap_detach(&processes[pid], ino);
+                }
+            }
+            mmap_file_removed(ino);
+        }
+
         current->p_registers.reg_rax = 0;
         break;
     }
@@ -451,12 +1315,22 @@ void exception(x86_64_registers* reg) {
 
     case INT_SYS_PAGE_ALLOC: {
         uintptr_t vaddr = current->p_registers.reg_rdi;
+        // the kernel's mappings below PROC_START_ADDR are off limits
+        if (vaddr < PROC_START_ADDR || vaddr >= MEMSIZE_VIRTUAL
+            || PAGEOFFSET(vaddr) != 0) {
+            current->p_registers.reg_rax = -1;
+            break;
+        }
         uintptr_t paddr = page_alloc(current->p_pid);
         
         if (paddr == (uintptr_t)NULL) {
             current->p_registers.reg_rax = -1;
             console_printf(CPOS(24, 0), 0x0C00, "Out of physical memory!");
         } else {
+            vamapping old = virtual_memory_lookup(current->p_pagetable, vaddr);
+            if (old.pn >= 0 && pageinfo[old.pn].owner == PO_SHARED) {
+                page_unref(old.pa);
+            }
             virtual_memory_map(current->p_pagetable, vaddr, paddr,
                                 PAGESIZE, PTE_P | PTE_W | PTE_U, NULL);
             current->p_registers.reg_rax = vaddr;
@@ -465,81 +1339,91 @@ void exception(x86_64_registers* reg) {
         break;
     }
 
-    case INT_SYS_READ: {
+    case INT_SYS_READ:
         log_printf("proc %d: exception INT_SYS_READ (%d)\n", current->p_pid, reg->reg_intno);
+        current->p_registers.reg_rax = file_io(current->p_registers.reg_rdi,
+                                               current->p_registers.reg_rsi,
+                                               current->p_registers.reg_rdx, -1, 0);
+        break;
 
-        int fd = current->p_registers.reg_rdi;
-        log_printf("fd : %d\n", fd);
-
-        uintptr_t va = current->p_registers.reg_rsi;
-        vamapping vam = virtual_memory_lookup(current->p_pagetable, va);
-        uintptr_t buf = vam.pa;
-
-        size_t size = current->p_registers.reg_rdx; // TODO: Max ssize_t / size_t
-        log_printf("size : %d\n", size);
-
-        proc_fdentry_t *entry = fdlist_search_entry(&current->fd_list, fd);
-        log_printf("entry : %d\n", entry->inode);
-        log_printf("offset : %d\n", entry->offset);
-
-        // TODO: check if size available
+    case INT_SYS_WRITE:
+        log_printf("proc %d: exception INT_SYS_WRITE (%d)\n", current->p_pid, reg->reg_intno);
+        current->p_registers.reg_rax = file_io(current->p_registers.reg_rdi,
+                                               current->p_registers.reg_rsi,
+                                               current->p_registers.reg_rdx, -1, 1);
+        break;
 
-        int r = fs_read(&fsdesc, entry->inode, (void *) buf, size, entry->offset);
-        if (r < 0) {
-            current->p_registers.reg_rax = r;
+    case INT_SYS_PREAD:
+    case INT_SYS_PWRITE: {
+        off_t offset = current->p_registers.reg_rcx;
+        if (offset < 0) {
+            current->p_registers.reg_rax = -EINVAL;
             break;
         }
-
-        log_printf("read %d bytes\n", r);
-
-        entry->offset += r;
-        current->p_registers.reg_rax = r;
+        current->p_registers.reg_rax = file_io(current->p_registers.reg_rdi,
+                                               current->p_registers.reg_rsi,
+                                               current->p_registers.reg_rdx, offset,
+                                               reg->reg_intno == INT_SYS_PWRITE);
         break;
     }
 
-    case INT_SYS_WRITE: {
-        log_printf("proc %d: exception INT_SYS_WRITE (%d)\n", current->p_pid, reg->reg_intno);
-
-        int fd = current->p_registers.reg_rdi;
-
-        uintptr_t va = current->p_registers.reg_rsi;
-        vamapping vam = virtual_memory_lookup(current->p_pagetable, va);
-        uintptr_t buf = vam.pa;
+    case INT_SYS_READV:
+    case INT_SYS_WRITEV:
+        current->p_registers.reg_rax = file_iov(current->p_registers.reg_rdi,
+                                                current->p_registers.reg_rsi,
+                                                current->p_registers.reg_rdx,
+                                                reg->reg_intno == INT_SYS_WRITEV);
+        break;
 
-        size_t size = current->p_registers.reg_rdx; // TODO: Max ssize_t / size_t
-        //log_printf("buf : %p\n", (void *) buf);
-        log_printf("size : %d\n", size);
+    case INT_SYS_COPY_FILE_RANGE:
+        current->p_registers.reg_rax = file_copy(current->p_registers.reg_rdi,
+                                                 current->p_registers.reg_rsi,
+                                                 current->p_registers.reg_rdx);
+        break;
 
-        proc_fdentry_t *entry = fdlist_search_entry(&current->fd_list, fd);
-        if (entry == NULL) {
-            log_printf("fd %d not found\n", fd);
-            current->p_registers.reg_rax = -1;
+    case INT_SYS_MMAP: {
+        proc_fdentry_t *entry = fdlist_search_entry(&current->fd_list, current->p_registers.reg_rcx);
+        if (entry == NULL || entry->inode == 0) {
+            current->p_registers.reg_rax = -EINVAL;
             break;
         }
-        log_printf("fd : %d, inode : %d, offset : %d\n", fd, entry->inode, entry->offset);
+        current->p_registers.reg_rax = mmap_file(current, current->p_registers.reg_rdi,
+                                                 current->p_registers.reg_rsi,
+                                                 current->p_registers.reg_rdx, entry->inode);
+        break;
+    }
 
-        int r = fs_write(&fsdesc, entry->inode, (void *) buf, size, entry->offset);
-        if (r < 0) {
-            log_printf("write failed %d\n", r);
-            current->p_registers.reg_rax = r;
-            break;
-        }
+    case INT_SYS_MUNMAP:
+        current->p_registers.reg_rax = mmap_unmap(current, current->p_registers.reg_rdi,
+                                                  current->p_registers.reg_rsi);
+        break;
 
-        entry->offset += size;
+    case INT_SYS_MSYNC:
+        current->p_registers.reg_rax = mmap_sync(current, current->p_registers.reg_rdi,
+                                                 current->p_registers.reg_rsi);
+        break;
 
-        current->p_registers.reg_rax = size;
+    case INT_SYS_IORING_SETUP:
+        current->p_registers.reg_rax = ioring_setup(current->p_registers.reg_rdi);
+        break;
+
+    case INT_SYS_IORING_ENTER:
+        log_printf("proc %d: exception INT_SYS_IORING_ENTER (%d)\n", current->p_pid, reg->reg_intno);
+        current->p_registers.reg_rax = ioring_enter();
         break;
-    }
 
     case INT_SYS_MKDIR: {
         log_printf("proc %d: exception INT_SYS_MKDIR (%d)\n", current->p_pid, reg->reg_intno);
         
-        uintptr_t va = current->p_registers.reg_rdi;
-        vamapping vam = virtual_memory_lookup(current->p_pagetable, va);
-        normpath path = resolve_path((char *) vam.pa);
+        normpath path;
+        int r = user_path(current->p_registers.reg_rdi, &path);
+        if (r < 0) {
+            current->p_registers.reg_rax = r;
+            break;
+        }
 
         log_printf("mkdir path : %.*s\n", (int)path.len, path.str);
-        int r = fs_touch(&fsdesc, path, 0);
+        r = fs_touch(&fsdesc, path, 0);
 
         if (r < 0) {
             log_printf("mkdir failed %d\n", r);
@@ -554,11 +1438,14 @@ void exception(x86_64_registers* reg) {
     case INT_SYS_TOUCH: {
         log_printf("proc %d: exception INT_SYS_TOUCH (%d)\n", current->p_pid, reg->reg_intno);
         
-        uintptr_t va = current->p_registers.reg_rdi;
-        vamapping vam = virtual_memory_lookup(current->p_pagetable, va);
-        normpath path = resolve_path((char *) vam.pa);
+        normpath path;
+        int64_t r = user_path(current->p_registers.reg_rdi, &path);
+        if (r < 0) {
+            current->p_registers.reg_rax = r;
+            break;
+        }
 
-        int64_t r = fs_alloc_inode(&fsdesc);
+        r = fs_alloc_inode(&fsdesc);
         if (r < 0) {
             log_printf("alloc inode failed %d\n", r);
             current->p_registers.reg_rax = r;
@@ -579,53 +1466,39 @@ void exception(x86_64_registers* reg) {
         break;
     }
 
-    case INT_SYS_LISTDIR: {
-        log_printf("proc %d: exception INT_SYS_LISTDIR (%d)\n", current->p_pid, reg->reg_intno);
-        
-        uintptr_t va = current->p_registers.reg_rdi;
-        vamapping vam = virtual_memory_lookup(current->p_pagetable, va);
-        normpath path = resolve_path((char *) vam.pa);
-
-        log_printf("listdir path : %.*s\n", (int)path.len, path.str);
+    case INT_SYS_GETDENTS: {
+        log_printf("proc %d: exception INT_SYS_GETDENTS (%d)\n", current->p_pid, reg->reg_intno);
 
-        va = current->p_registers.reg_rsi;
-        vam = virtual_memory_lookup(current->p_pagetable, va);
-        char *buffer = (char *) vam.pa;
-
-        fs_dirreader dr;
-        int children_count = fs_readdir_init(&fsdesc, path, &dr);
-        if (children_count < 0) {
-            log_printf("proc %d: LISTDIR, readdir_init failed\n", current->p_pid);
-            current->p_registers.reg_rax = children_count;
+        // a buffer too small for one entry would read as the end of the
+        // directory
+        if (current->p_registers.reg_rdx < sizeof(dirent)) {
+            current->p_registers.reg_rax = -EINVAL;
             break;
         }
 
-        log_printf("children_count : %d\n", children_count);
-
-        for (int i = 0; i < children_count; i++) {
-            char name[32]; // TODO: 32 -> NAME_SIZE
-            int r = fs_readdir_next(&dr, name);
-            if (r < 0) {
-                log_printf("proc %d: LISTDIR, readdir_next failed\n", current->p_pid);
-                current->p_registers.reg_rax = r;
-                break;
-            }
-
-            for (int j = 0; j < 32 && name[j]; j++) {
-                *buffer = name[j];
-                buffer++;
-            }
-            
-            *buffer = '\n';
-            buffer++;
+        normpath path;
+        int r = user_path(current->p_registers.reg_rdi, &path);
+        if (r < 0) {
+            current->p_registers.reg_rax = r;
+            break;
         }
 
-        log_printf("buffer : %s\n", (char *) vam.pa);
+        // At most a bufferful of entries per call; the caller continues
+        // from the returned cookie.
+        static dirent ents[8];
+        uintptr_t va = current->p_registers.reg_rsi;
+        size_t count = MIN(current->p_registers.reg_rdx / sizeof(dirent),
+                           sizeof(ents) / sizeof(ents[0]));
+        uint32_t cookie = current->p_registers.reg_rcx;
 
-        *buffer = '\0';
+        r = fs_getdents(&fsdesc, path, cookie, ents, count);
+        if (r < 0) {
+            log_printf("getdents failed %d\n", r);
+        } else if (copy_to_user(va, ents, r * sizeof(dirent)) < 0) {
+            r = -EFAULT;
+        }
 
-        log_printf("proc %d: LISTDIR, success\n", current->p_pid);
-        current->p_registers.reg_rax = 0;
+        current->p_registers.reg_rax = r;
         break;
     }
 
@@ -635,137 +1508,93 @@ void exception(x86_64_registers* reg) {
 
         // TODO: Better EXECV
 
-        uintptr_t va = current->p_registers.reg_rdi;
-        vamapping vam = virtual_memory_lookup(current->p_pagetable, va);
-        char* path = (char*) vam.pa;
-
-        // path is not safe
-
-        if (strcmp(path, "show") == 0) {
-            memshow_enabled = 1;
-            current->p_exit_code = 0;
-            process_kill(current->p_pid);
+        static char path[sizeof(current->p_cwd)];
+        int64_t ino = strncpy_from_user(path, current->p_registers.reg_rdi, sizeof(path));
+        if (ino < 0) {
+            current->p_registers.reg_rax = ino;
             break;
         }
-        if (strcmp(path, "hide") == 0) {
-            memshow_enabled = 0;
-            console_clear();
 
-            current->p_exit_code = 0;
-            process_kill(current->p_pid);
+        int builtin;
+        ino = program_lookup(path, &builtin);
+        if (ino < 0) {
+            current->p_registers.reg_rax = ino;
             break;
         }
-        if (strcmp(path, "clear") == 0) {
-            console_clear();
+        if (builtin) {
+            exec_builtin(builtin, current->p_registers.reg_rsi);
             current->p_exit_code = 0;
             process_kill(current->p_pid);
             break;
         }
-        if (strcmp(path, "testmalloc") == 0) {
-            va = current->p_registers.reg_rsi;
-            vam = virtual_memory_lookup(current->p_pagetable, va);
-            char** argv = (char**) vam.pa;
 
-            if (argv[1]) {
-                vam = virtual_memory_lookup(current->p_pagetable, (uintptr_t) argv[1]);
-                char *arg = (char*) vam.pa;
-                testmalloc(arg);
-            } else {
-                testmalloc(NULL);
-            }
-            
-            current->p_exit_code = 0;
-            process_kill(current->p_pid);
-            break;
-        }
-
-        // Check path
-
-        int program_number = -1;
-        
-        if (strcmp(path, "cat") == 0) {
-            log_printf("run cat\n");
-            program_number = 3;
-        } else if (strcmp(path, "echo") == 0) {
-            log_printf("run echo\n");
-            program_number = 4;
-        } else if (strcmp(path, "ls") == 0) {
-            log_printf("run ls\n");
-            program_number = 5;
-        } else if (strcmp(path, "mkdir") == 0) {
-            log_printf("run mkdir\n");
-            program_number = 6;
-        } else if (strcmp(path, "rm") == 0) {
-            log_printf("run rm\n");
-            program_number = 7;
-        } else if (strcmp(path, "entropy") == 0) {
-            log_printf("run entropy\n");
-            program_number = 8;
-        } else if (strcmp(path, "plane") == 0) {
-            log_printf("run plane\n");
-            program_number = 9;
-        } else if (strcmp(path, "touch") == 0) {
-            log_printf("run touch\n");
-            program_number = 10;
-        } else {
-            log_printf("command not found : %s\n", path);
-            current->p_registers.reg_rax = -1;
+        // Arguments
+        int argc;
+        uintptr_t pargs_pa = args_page_alloc(current->p_pid, current->p_registers.reg_rsi, &argc);
+        if (pargs_pa == (uintptr_t) NULL) {
+            current->p_registers.reg_rax = -ENOMEM;
             break;
         }
 
+        // Clear page table
+        process_unshare(current);
+        process_free_pages(current->p_pid, pargs_pa);
 
-        log_printf("program_numer : %d\n", program_number);
-
-        // Arguments
-        log_printf("Arguments\n");
-
-        va = current->p_registers.reg_rsi;
-        vam = virtual_memory_lookup(current->p_pagetable, va);
-        char** argv = (char**) vam.pa;
-
-        int argc = 0;
-        while (argv[argc]) argc++;
+        // Setup process
+        process_setup(current->p_pid, ino, current->p_parent);
+        args_page_map(current, pargs_pa, argc);
+        break;
+    }
 
-        uintptr_t pargs_va = 0x140000;
+    case INT_SYS_SPAWN: {
+        log_printf("proc %d: exception INT_SYS_SPAWN (%d)\n", current->p_pid, reg->reg_intno);
 
-        uintptr_t pargs_pa = page_alloc(current->p_pid);
-        if (pargs_pa == (uintptr_t) NULL) {
-            console_printf(CPOS(24, 0), 0x0C00, "Out of physical memory!");
-            assert(0);
+        // Like fork followed by execv in the child, without ever
+        // duplicating the parent's address space.
+        static char path[sizeof(current->p_cwd)];
+        int64_t ino = strncpy_from_user(path, current->p_registers.reg_rdi, sizeof(path));
+        if (ino < 0) {
+            current->p_registers.reg_rax = ino;
+            break;
         }
 
-        // Copy argv to pargs
-        log_printf("copy argv to pargs_pa\n");
-
-        uintptr_t offset = (argc+1)*sizeof(char*);
-
-        for (int i = 0; i < argc; i++) {
-            ((uintptr_t*) pargs_pa)[i] = pargs_va+offset;
-            vam = virtual_memory_lookup(current->p_pagetable, (uintptr_t) argv[i]);
-            strcpy((char*) (pargs_pa+offset), (char*) vam.pa);
-            offset += strlen((char*) vam.pa)+1;
+        int builtin;
+        ino = program_lookup(path, &builtin);
+        if (ino < 0) {
+            current->p_registers.reg_rax = ino;
+            break;
+        }
+        if (builtin) {
+            exec_builtin(builtin, current->p_registers.reg_rsi);
+            current->p_registers.reg_rax = 0;
+            break;
         }
 
-        ((char**) pargs_pa)[argc] = NULL;
-
-        // Clear page table
-        for (int pn = 0; pn < NPAGETABLEENTRIES; pn++) {
-            if (pageinfo[pn].owner == current->p_pid && PAGEADDRESS(pn) != pargs_pa) {
-                assert(pageinfo[pn].refcount == 1);
-                pageinfo[pn].owner = PO_FREE;
-                pageinfo[pn].refcount = 0;
+        pid_t pid = 0;
+        for (pid_t i = 1; i < NPROC; i++) {
+            if (processes[i].p_state == P_FREE) {
+                pid = i;
+                break;
             }
         }
+        if (pid == 0) {
+            current->p_registers.reg_rax = -EAGAIN;
+            break;
+        }
 
-        // Setup process
-        process_setup(current->p_pid, program_number, current->p_parent);
+        int argc;
+        uintptr_t pargs_pa = args_page_alloc(pid, current->p_registers.reg_rsi, &argc);
+        if (pargs_pa == (uintptr_t) NULL) {
+            current->p_registers.reg_rax = -ENOMEM;
+            break;
+        }
 
-        // Setup arguments
-        assert(virtual_memory_map(current->p_pagetable, pargs_va, pargs_pa,
-                            PAGESIZE, PTE_P | PTE_W | PTE_U, NULL) == 0);
+        proc* parent = current;
+        process_setup(pid, ino, parent->p_pid); // sets current
+        args_page_map(&processes[pid], pargs_pa, argc);
+        current = parent;
 
-        current->p_registers.reg_rdi = argc;
-        current->p_registers.reg_rsi = pargs_va;
+        current->p_registers.reg_rax = pid;
         break;
     }
 
@@ -773,9 +1602,13 @@ void exception(x86_64_registers* reg) {
         log_printf("proc %d: exception INT_SYS_WAIT (%d)\n", current->p_pid, reg->reg_intno);
 
         pid_t pid = current->p_registers.reg_rdi;
-        uintptr_t va = current->p_registers.reg_rsi;
-        vamapping vam = virtual_memory_lookup(current->p_pagetable, va);
-        int* exit_code = (int*) vam.pa;
+        // the exit code is stored when the child exits, maybe much later,
+        // so keep the address it is stored at
+        uintptr_t exit_code;
+        if (user_run(current->p_registers.reg_rsi, sizeof(int), PTE_W, &exit_code) != sizeof(int)) {
+            current->p_registers.reg_rax = -EFAULT;
+            break;
+        }
 
         assert(pid >= 1);
         assert(processes[pid].p_parent == current->p_pid);
@@ -783,13 +1616,13 @@ void exception(x86_64_registers* reg) {
         current->p_registers.reg_rax = 0;
 
         if (processes[pid].p_state == P_BROKEN) {
-            *exit_code = processes[pid].p_exit_code;
+            *(int*) exit_code = processes[pid].p_exit_code;
             break;
         }
 
         current->p_state = P_BLOCKED;
         current->p_wait_pid = pid;
-        current->p_wait_exit_code = exit_code;
+        current->p_wait_exit_code = (int*) exit_code;
 
         break;
     }
@@ -812,13 +1645,14 @@ void exception(x86_64_registers* reg) {
         log_printf("proc %d: exception INT_SYS_GETCWD (%d)\n", current->p_pid, reg->reg_intno);
 
         uintptr_t va = current->p_registers.reg_rdi;
-        vamapping vam = virtual_memory_lookup(current->p_pagetable, va);
-        char* buffer = (char*) vam.pa;
         size_t size = current->p_registers.reg_rsi;
 
-        strcpy(buffer, current->p_cwd); // TODO: Buffer overflow exploit
-
-        current->p_registers.reg_rax = 0;
+        size_t len = strlen(current->p_cwd) + 1;
+        if (len > size) {
+            current->p_registers.reg_rax = -EINVAL;
+            break;
+        }
+        current->p_registers.reg_rax = copy_to_user(va, current->p_cwd, len);
         
         break;
     }
@@ -826,11 +1660,14 @@ void exception(x86_64_registers* reg) {
     case INT_SYS_CHDIR: {
         log_printf("proc %d: exception INT_SYS_CHDIR (%d)\n", current->p_pid, reg->reg_intno);
 
-        uintptr_t va = current->p_registers.reg_rdi;
-        vamapping vam = virtual_memory_lookup(current->p_pagetable, va);
-        normpath path = resolve_path((char *) vam.pa);;
+        normpath path;
+        int64_t r = user_path(current->p_registers.reg_rdi, &path);
+        if (r < 0) {
+            current->p_registers.reg_rax = r;
+            break;
+        }
 
-        int64_t r = fs_getattr(&fsdesc, path);
+        r = fs_getattr(&fsdesc, path);
         if (r < 0) {
             current->p_registers.reg_rax = r;
             break;
@@ -846,10 +1683,28 @@ void exception(x86_64_registers* reg) {
         break;
     }
 
+    case INT_KEYBOARD:
+        // buffer the key; Control-C exits the virtual machine
+        check_keyboard_push();
+        break;
+
     case INT_TIMER:
         //log_printf("proc %d: exception INT_TIMER (%d)\n", current->p_pid, reg->reg_intno);
 
         ++ticks;
+        if (ticks % FS_COMMIT_INTERVAL == 0) {
+            fs_commit(&fsdesc);
+        }
+
+        // measure the cycle counter against the timer, for the vDSO
+        if (ticks == 1) {
+            tsc_first_tick = read_cycle_counter();
+        } else if (ticks % HZ == 1) {
+            tsc_hz = (read_cycle_counter() - tsc_first_tick) * HZ / (ticks - 1);
+        }
+        if (current->p_vdso) {
+            vdso_reseed(current);
+        }
         schedule();
         break;                  /* will not be reached */
 
@@ -867,6 +1722,18 @@ void exception(x86_64_registers* reg) {
             panic("Kernel page fault for %p (%s %s, rip=%p)!\n",
                   addr, operation, problem, reg->reg_rip);
         }
+
+        // First touch of a demand-paged segment.
+        if (!(reg->reg_err & PFERR_PRESENT)
+            && program_demand_page(current, addr, pagetable_alloc) == 0) {
+            break;
+        }
+
+        // Write to a copy-on-write page: give the process its own copy.
+        if ((reg->reg_err & PFERR_WRITE) && (reg->reg_err & PFERR_PRESENT)
+            && cow_break(current, addr) == 0) {
+            break;
+        }
         console_printf(CPOS(24, 0), 0x0C00,
                        "Process %d page fault for %p (%s %s, rip=%p)!\n",
                        current->p_pid, addr, operation, problem, reg->reg_rip);
@@ -901,19 +1768,39 @@ void exception(x86_64_registers* reg) {
             break;
         }
 
+        // the child gets its own kernel data page
+        current->p_pagetable = p_pagetable;
+        if (vdso_setup(current) < 0) {
+            process_free_pages(pid, 0);
+            parent->p_registers.reg_rax = -1;
+            current = parent;
+            break;
+        }
+
         for (uintptr_t va = 0; va < MEMSIZE_VIRTUAL; va += PAGESIZE) {
             vamapping vam = virtual_memory_lookup(parent->p_pagetable, va);
 
-            if (vam.pn == -1)
+            if (vam.pn == -1 || va == VDSO_ADDR)
                 continue;
 
             assert(vam.pn >= 0);
 
-            if (pageinfo[vam.pn].owner == parent->p_pid) {
-                uintptr_t pa = page_alloc(pid);
-                assert(pa != (uintptr_t) NULL);
-                memcpy((void*) pa, (void*) vam.pa, PAGESIZE);
-                virtual_memory_map(p_pagetable, va, pa, PAGESIZE, vam.perm, pagetable_alloc);
+            int owner = pageinfo[vam.pn].owner;
+            if (vam.perm & PTE_FILE) {
+                // mapped file pages stay shared, writable or not
+                page_ref(vam.pa);
+                virtual_memory_map(p_pagetable, va, vam.pa, PAGESIZE, vam.perm, pagetable_alloc);
+            } else if ((owner == parent->p_pid || owner == PO_SHARED) && (vam.perm & PTE_U)) {
+                // Share the page copy-on-write: both processes map it
+                // read-only until one of them writes to it.
+                int perm = vam.perm;
+                if (perm & (PTE_W | PTE_COW)) {
+                    perm = (perm & ~PTE_W) | PTE_COW;
+                    virtual_memory_map(parent->p_pagetable, va, vam.pa, PAGESIZE, perm, NULL);
+                }
+                page_owner_set(vam.pn, PO_SHARED);
+                ++pageinfo[vam.pn].refcount;
+                virtual_memory_map(p_pagetable, va, vam.pa, PAGESIZE, perm, pagetable_alloc);
             } else {
                 virtual_memory_map(p_pagetable, va, vam.pa, PAGESIZE, vam.perm, pagetable_alloc);
             }
@@ -921,11 +1808,14 @@ void exception(x86_64_registers* reg) {
 
         current->p_parent = parent->p_pid;
         current->p_pagetable = p_pagetable;
+        memcpy(current->p_segments, parent->p_segments, sizeof(parent->p_segments));
+        current->p_nsegments = parent->p_nsegments;
         current->p_registers = parent->p_registers;
         current->p_registers.reg_rax = 0;
         current->p_state = P_RUNNABLE;
         current->p_wait_pid = -1;
         strcpy(current->p_cwd, parent->p_cwd);
+        current->p_ioring = parent->p_ioring;
 
         parent->p_registers.reg_rax = pid;
 
@@ -969,11 +1859,17 @@ void exception(x86_64_registers* reg) {
 
 void schedule(void) {
     pid_t pid = current->p_pid;
+    int idle = 0;
     while (1) {
         pid = (pid + 1) % NPROC;
         if (processes[pid].p_state == P_RUNNABLE) {
             run(&processes[pid]);
         }
+        // Nothing was runnable for a whole round: zero a page meanwhile.
+        if (++idle == NPROC) {
+            zero_pool_refill();
+            idle = 0;
+        }
         // If Control-C was typed, exit the virtual machine.
         check_keyboard_push();
     }
@@ -993,8 +1889,16 @@ void run(proc* p) {
     // Load the process's current pagetable.
     set_pagetable(p->p_pagetable);
 
-    // This function is defined in k-exception.S. It restores the process's
-    // registers then jumps back to user mode.
+    if (p->p_vdso) {
+        p->p_vdso->ticks = ticks;
+        p->p_vdso->tsc_hz = tsc_hz;
+    }
+
+    // These functions are defined in k-exception.S. They restore the
+    // process's registers then jump back to user mode.
+    if (p->p_registers.reg_err == SYSCALL_ENTRY_ERR) {
+        syscall_return(&p->p_registers);
+    }
     exception_return(&p->p_registers);
 
  spinloop: goto spinloop;       // should never get here
@@ -1007,6 +1911,16 @@ void run(proc* p) {
 void pageinfo_init(void) {
     extern char end[];
 
+    for (int k = 0; k <= PAGE_MAX_ORDER; ++k) {
+        free_head[k] = -1;
+    }
+    for (int pn = 0; pn < NPAGES; ++pn) {
+        free_link[pn].order = -1;
+    }
+    for (pid_t pid = 0; pid < NPROC; ++pid) {
+        owned_head[pid] = -1;
+    }
+
     for (uintptr_t addr = 0; addr < MEMSIZE_PHYSICAL; addr += PAGESIZE) {
         int owner;
         if (physical_memory_isreserved(addr)) {
@@ -1019,6 +1933,9 @@ void pageinfo_init(void) {
         }
         pageinfo[PAGENUMBER(addr)].owner = owner;
         pageinfo[PAGENUMBER(addr)].refcount = (owner != PO_FREE);
+        if (owner == PO_FREE) {
+            page_free(PAGENUMBER(addr));
+        }
     }
 }
 
@@ -1139,7 +2056,7 @@ void check_virtual_memory(void) {
 //    Draw a picture of physical memory on the CGA console.
 
 static const uint16_t memstate_colors[] = {
-    'H' | 0x0D00,
+    'S' | 0x0700, 'H' | 0x0D00,
     'K' | 0x0D00, 'R' | 0x0700, '.' | 0x0700, '1' | 0x0C00,
     '2' | 0x0A00, '3' | 0x0900, '4' | 0x0E00, '5' | 0x0F00,
     '6' | 0x0C00, '7' | 0x0A00, '8' | 0x0900, '9' | 0x0E00,
@@ -1158,7 +2075,7 @@ void memshow_physical(void) {
         if (pageinfo[pn].refcount == 0) {
             owner = PO_FREE;
         }
-        uint16_t color = memstate_colors[owner - PO_KERNEL_HEAP];
+        uint16_t color = memstate_colors[owner - PO_SHARED];
 
 	if (pn == PAGENUMBER(console)) {
 	    color = 'C' | 0x0700;
@@ -1176,13 +2093,16 @@ void memshow_physical(void) {
 
 // memshow_virtual(pagetable, name)
 //    Draw a picture of the virtual memory map `pagetable` (named `name`) on
-//    the CGA console.
+//    the CGA console. The picture has room for the top 12 rows of 64 pages.
+
+#define MEMSHOW_VIRTUAL_START (MEMSIZE_VIRTUAL - 12 * 64 * PAGESIZE)
 
 void memshow_virtual(x86_64_pagetable* pagetable, const char* name) {
     assert((uintptr_t) pagetable == PTE_ADDR(pagetable));
 
     console_printf(CPOS(10, 26), 0x0F00, "VIRTUAL ADDRESS SPACE FOR %s", name);
-    for (uintptr_t va = 0; va < MEMSIZE_VIRTUAL; va += PAGESIZE) {
+    for (uintptr_t va = MEMSHOW_VIRTUAL_START; va < MEMSIZE_VIRTUAL;
+         va += PAGESIZE) {
         vamapping vam = virtual_memory_lookup(pagetable, va);
         uint16_t color;
         if (vam.pn < 0) {
@@ -1196,7 +2116,7 @@ void memshow_virtual(x86_64_pagetable* pagetable, const char* name) {
 	    if (vam.pn == PAGENUMBER(console)) {
 		color = 'C' | 0x0700;
 	    } else {
-		color = memstate_colors[owner - PO_KERNEL_HEAP];
+		color = memstate_colors[owner - PO_SHARED];
 	    }
             // reverse video for user-accessible pages
             if (vam.perm & PTE_U) {
@@ -1208,7 +2128,7 @@ void memshow_virtual(x86_64_pagetable* pagetable, const char* name) {
                 color &= 0x77FF;
             }
         }
-        uint32_t pn = PAGENUMBER(va);
+        uint32_t pn = PAGENUMBER(va - MEMSHOW_VIRTUAL_START);
         if (pn % 64 == 0) {
             console_printf(CPOS(11 + pn / 64, 3), 0x0F00, "0x%06X ", va);
         }
@@ -1,6 +1,7 @@
 #ifndef WEENSYOS_KERNEL_H
 #define WEENSYOS_KERNEL_H
 #include "x86-64.h"
+#include "k-segments.h"
 #if WEENSYOS_PROCESS
 #error "kernel.h should not be used by process code."
 #endif
@@ -13,6 +14,14 @@
 #define PO_RESERVED (-1)
 #define PO_KERNEL (-2)
 #define PO_KERNEL_HEAP (-3)
+#define PO_SHARED (-4)                  // user page shared by several processes
+
+// Software-defined page table entry bit (ignored by the MMU): the page is
+// shared copy-on-write and mapped read-only until the first write.
+#define PTE_COW ((x86_64_pageentry_t) 0x200)
+// Software-defined page table entry bit: the page is a file page mapped
+// shared by mmap (see k-mmap.c).
+#define PTE_FILE ((x86_64_pageentry_t) 0x400)
 
 typedef int pageowner_t;            // process IDs
 
@@ -35,6 +44,24 @@ typedef struct proc_fdentry {
 typedef proc_fdentry_t* proc_fdlist_t;
 
 
+// A range of a process's address space that is paged in on first touch:
+// bytes [file_va, end_file) come from the executable in inode `ino`
+// starting at file offset `offset`, the rest of [va, end_mem) is zero.
+// If `perm` has PTE_FILE, the range is a file mapping instead, and maps
+// the pages of `ino` shared by all its mappings (see mmap_page).
+typedef struct proc_segment {
+    uintptr_t va;                       // page aligned
+    uintptr_t end_mem;
+    uintptr_t file_va;
+    uintptr_t end_file;
+    uint32_t ino;
+    uint64_t offset;
+    int perm;
+} proc_segment;
+
+#define PROC_NSEGMENTS 8
+
+
 // Process descriptor type
 typedef struct proc {
     pid_t p_pid;                        // process ID
@@ -48,6 +75,10 @@ typedef struct proc {
     x86_64_pagetable* p_pagetable;      // process's page table
     proc_fdlist_t fd_list;             // file descriptor list
     int fd_max;
+    proc_segment p_segments[PROC_NSEGMENTS]; // demand-paged ranges
+    int p_nsegments;
+    uintptr_t p_ioring;                 // user address of the I/O ring, or 0
+    struct vdso_data* p_vdso;           // kernel data page, or NULL
 } proc;
 
 #define NPROC 16                // maximum number of processes
@@ -55,11 +86,10 @@ typedef struct proc {
 
 // Kernel start address
 #define KERNEL_START_ADDR       0x40000
-// Top of the kernel stack
-#define KERNEL_STACK_TOP        0xA0000
-
-// First application-accessible address
-#define PROC_START_ADDR         0x100000
+// First application-accessible address. Virtual addresses below this
+// map all of physical memory, for the kernel only, in every page table,
+// so the kernel can run on a process's page table.
+#define PROC_START_ADDR         0x200000
 
 // Physical memory size
 #define MEMSIZE_PHYSICAL        0x200000
@@ -67,11 +97,18 @@ typedef struct proc {
 #define NPAGES                  (MEMSIZE_PHYSICAL / PAGESIZE)
 
 // Virtual memory size
-#define MEMSIZE_VIRTUAL         0x300000
+#define MEMSIZE_VIRTUAL         0x400000
 
 // Hardware interrupt numbers
 #define INT_HARDWARE            32
 #define INT_TIMER               (INT_HARDWARE + 0)
+#define INT_KEYBOARD            (INT_HARDWARE + 1)
+
+// WEENSYOS_DEBUG (`make DEBUG=1`) runs the kernel's invariant checks on
+// every exception instead of periodically.
+#ifndef WEENSYOS_DEBUG
+#define WEENSYOS_DEBUG 0
+#endif
 
 
 // hardware_init
@@ -85,12 +122,31 @@ void hardware_init(void);
 //    timer interrupt if `rate <= 0`.
 void timer_init(int rate);
 
+// keyboard_interrupt_init()
+//    Enable the keyboard interrupt, INT_KEYBOARD.
+void keyboard_interrupt_init(void);
+
 
 // kernel page table (used for virtual memory)
 extern x86_64_pagetable* kernel_pagetable;
 
 extern uintptr_t page_alloc(int owner);
 
+// page_alloc_order(owner, order)
+//    Allocate 2^`order` physically contiguous zeroed pages to `owner`.
+//    Returns the first page's address, or NULL if out of memory.
+uintptr_t page_alloc_order(int owner, int order);
+
+// page_ref(pa), page_unref(pa)
+//    Add or drop a reference to the allocated physical page at `pa`. The
+//    page is freed with its last reference.
+void page_ref(uintptr_t pa);
+void page_unref(uintptr_t pa);
+
+// page_refcount(pa)
+//    Return the number of references to the physical page at `pa`.
+int page_refcount(uintptr_t pa);
+
 // virtual_memory_map(pagetable, va, pa, sz, perm, allocator)
 //    Map virtual address range `[va, va+sz)` in `pagetable`.
 //    When `X >= 0 && X < sz`, the new pagetable will map virtual address
@@ -136,11 +192,18 @@ int assign_physical_page(uintptr_t addr, int8_t owner);
 int physical_memory_isreserved(uintptr_t pa);
 
 // set_pagetable
-//    Change page table. lcr3() is the hardware instruction;
-//    set_pagetable() additionally checks that important kernel procedures are
-//    mappable in `pagetable`, and calls panic() if they aren't.
+//    Change page table. lcr3() is the hardware instruction; set_pagetable()
+//    does nothing if `pagetable` is already loaded, and keeps its TLB
+//    entries if the processor supports PCIDs. WEENSYOS_DEBUG builds also
+//    check that important kernel procedures are mappable in `pagetable`.
 void set_pagetable(x86_64_pagetable* pagetable);
 
+// tlb_invalidate_pagetable(pagetable)
+//    Drop the TLB entries cached for `pagetable` when it is next loaded,
+//    first switching to `kernel_pagetable` if `pagetable` is loaded now.
+//    Call before freeing a page table.
+void tlb_invalidate_pagetable(x86_64_pagetable* pagetable);
+
 // check_page_table_mappings
 //    Check operating system invariants about kernel mappings for a page
 //    table. Panic if any of the invariants are false.
@@ -159,6 +222,13 @@ void reboot(void) __attribute__((noreturn));
 //    and start the process back up. Defined in k-exception.S.
 void exception_return(x86_64_registers* reg) __attribute__((noreturn));
 
+// syscall_return
+//    Like exception_return, for registers saved by syscall_entry (whose
+//    reg_err is SYSCALL_ENTRY_ERR): returns with `sysret`, leaving %rcx
+//    and %r11 clobbered. Defined in k-exception.S.
+#define SYSCALL_ENTRY_ERR ((uint64_t) -1)
+void syscall_return(x86_64_registers* reg) __attribute__((noreturn));
+
 
 // console_show_cursor(cpos)
 //    Move the console cursor to position `cpos`, which should be between 0
@@ -202,15 +272,121 @@ void process_init(proc* p, int flags);
 #define PROCINIT_DISABLE_INTERRUPTS     0x02
 
 
-// program_load(p, programnumber)
-//    Load the code corresponding to program `programnumber` into the process
-//    `p` and set `p->p_registers.reg_eip` to its entry point. Calls
-//    `assign_physical_page` as required. Returns 0 on success and
-//    -1 on failure (e.g. out-of-memory). `allocator` is passed to
+// program_load(p, ino)
+//    Load the executable in filesystem inode `ino` into the process `p` and
+//    set `p->p_registers.reg_eip` to its entry point. Read-only segments
+//    are mapped from the executable page cache; writable segments are only
+//    recorded, and paged in by program_demand_page. Returns 0 on success
+//    and -1 on failure (e.g. out-of-memory). `allocator` is passed to
 //    `virtual_memory_map`.
-int program_load(proc* p, int programnumber,
+int program_load(proc* p, uint32_t ino,
                  x86_64_pagetable* (*allocator)(void));
 
+// program_check(ino)
+//    Return 0 if inode `ino` holds an executable program_load can load, and
+//    -1 otherwise.
+int program_check(uint32_t ino);
+
+// program_cache_invalidate(ino)
+//    Drop the cached pages of inode `ino`; called when the file changes.
+void program_cache_invalidate(uint32_t ino);
+
+// program_invalidate(ino)
+//    Forget what is cached about the executable in inode `ino`: its page
+//    cache pages and its program registry entries. Called before the file
+//    is written or removed.
+void program_invalidate(uint32_t ino);
+
+// program_map_zero(p, va, size, perm)
+//    Reserve `[va, va+size)` in process `p` as demand-zero memory mapped
+//    with `perm`. Returns 0 on success and -1 if `p` has too many segments.
+int program_map_zero(proc* p, uintptr_t va, size_t size, int perm);
+
+// program_demand_page(p, va, allocator)
+//    Page in the page containing `va` of process `p` from its segments.
+//    Returns 0 on success, 1 if `va` is in no segment or already mapped,
+//    and -1 if out of memory.
+int program_demand_page(proc* p, uintptr_t va,
+                        x86_64_pagetable* (*allocator)(void));
+
+
+// pagetable_alloc()
+//    Allocate a page table page owned by the current process.
+x86_64_pagetable* pagetable_alloc(void);
+
+// cow_break(p, va)
+//    Give process `p` a private, writable copy of the copy-on-write page
+//    containing `va`. Returns 0 on success, 1 if the page is not
+//    copy-on-write, and -1 if out of memory.
+int cow_break(proc* p, uintptr_t va);
+
+// user_run(va, size, perm, pa)
+//    Return the length of the longest prefix of user buffer `[va, va+size)`
+//    of the current process mapped with `perm` onto physically contiguous
+//    memory, and store its physical address in `*pa`. Returns 0 if `va` is
+//    not accessible. Pages are demand-paged in, and PTE_W breaks
+//    copy-on-write.
+size_t user_run(uintptr_t va, size_t size, int perm, uintptr_t* pa);
+
+// copy_from_user(dst, va, size), copy_to_user(va, src, size)
+//    Copy `size` bytes between kernel memory and user address `va` of the
+//    current process, across page boundaries. Return 0 on success and
+//    -EFAULT if part of the user buffer is not accessible.
+int copy_from_user(void* dst, uintptr_t va, size_t size);
+int copy_to_user(uintptr_t va, const void* src, size_t size);
+
+// strncpy_from_user(dst, va, size)
+//    Copy the string at user address `va` of the current process, with its
+//    null terminator, into the `size`-byte buffer `dst`. Returns the string
+//    length, -EFAULT if it is not accessible, or -ENAMETOOLONG if it does
+//    not fit.
+ssize_t strncpy_from_user(char* dst, uintptr_t va, size_t size);
+
+
+// mmap_file(p, va, size, prot, ino)
+//    Map `size` bytes of file `ino`, from its start, at page-aligned user
+//    address `va` of process `p`, shared and writable if `prot` has
+//    PROT_WRITE. Pages fault in through mmap_page. Returns 0 on success
+//    and a negative error code on failure.
+int mmap_file(proc* p, uintptr_t va, size_t size, int prot, uint32_t ino);
+
+// mmap_sync(p, va, size)
+//    Write the pages of process `p`'s file mappings in `[va, va+size)`
+//    that were written since the last sync back to their files. Returns 0
+//    on success and a negative error code on failure.
+int mmap_sync(proc* p, uintptr_t va, size_t size);
+
+// mmap_unmap(p, va, size)
+//    Sync and remove the file mapping `[va, va+size)` of process `p`, which
+//    must be a whole mapping. Returns 0 on success and a negative error
+//    code on failure.
+int mmap_unmap(proc* p, uintptr_t va, size_t size);
+
+// mmap_page(ino, index)
+//    Return the mapped page holding page `index` of file `ino`, shared by
+//    every mapping of it, reading it from the file if no process maps it
+//    yet, with a new reference for the caller. May evict another mapped
+//    page, unmapping it from the processes that map it. Returns 0 if out
+//    of memory or if the evicted page cannot be written back.
+uintptr_t mmap_page(uint32_t ino, uint32_t index);
+
+// mmap_file_changed(ino, offset, size)
+//    Copy bytes `[offset, offset+size)` of file `ino`, just written through
+//    a file descriptor, into the mapped pages that hold them.
+void mmap_file_changed(uint32_t ino, uint64_t offset, size_t size);
+
+// mmap_detach(p, ino), mmap_file_removed(ino)
+//    File `ino` was removed and its inode may be reused: detach the
+//    mappings of it in process `p`, which keep the pages they have but no
+//    longer write back, and forget its mapped pages.
+void mmap_detach(proc* p, uint32_t ino);
+void mmap_file_removed(uint32_t ino);
+
+// mmap_release(p)
+//    Sync every file mapping of process `p`, which is exiting or replacing
+//    its program.
+void mmap_release(proc* p);
+
 
 // log_printf, log_vprintf
 //    Print debugging messages to the host's `log.txt` file. We run QEMU
@@ -5,62 +5,349 @@
 #include "kernel.h"
 
 #define METADATA_SIZE sizeof(fs_metadata)
-#define BLOCK_SIZE 4096
+#define BLOCK_SIZE FS_BLOCK_SIZE
 
 // Pour nombres positifs uniquement
 #define SIZE_TO_BLOCK(x) ((uint32_t) (((x) + BLOCK_SIZE - 1) / BLOCK_SIZE))
 
+#define NAME_SIZE FS_NAME_SIZE
+#define MAX_CHILDREN FS_MAX_CHILDREN
 
-typedef struct fs_inode_entry {
-    uint8_t ref;
-    uint64_t size;
-    uint32_t start_block;
-    uint32_t block_count;
-    uint8_t cipher_key[FS_KEY_SIZE];
-    uint128_t cipher_iv;
-} fs_inode_entry;
+#define NODE_SIZE sizeof(fs_node_t)
 
-#define NAME_SIZE 32
-#define MAX_CHILDREN 32
 
-typedef struct fd_node_child {
-    char name[NAME_SIZE];
-    uint32_t index;
-} fd_node_child_t;
+#define INODE_ENTRY_SIZE sizeof(struct fs_inode_entry)
 
-typedef struct fs_node {
-    uint32_t value;
-    int children_count;
-    fd_node_child_t children[MAX_CHILDREN];
-} fs_node_t;
 
+static const uint8_t ZERO = 0;
+static const uint8_t ONE = 1;
 
-#define NODE_SIZE sizeof(fs_node_t)
 
+// Metadata journal
+//
+//    Every write to the metadata regions (inode table, usage tables, tree)
+//    goes through fs_meta_write, which appends a record to the in-memory
+//    journal buffer instead of touching the disk. fs_meta_read overlays the
+//    pending records on top of what is on disk, so callers always see their
+//    own updates. fs_commit then writes the whole batch sequentially to the
+//    journal region, marks it committed, and checkpoints it in place.
+//    A crash before the commit header is written loses the batch; a crash
+//    after it is repaired by journal_replay at fs_init.
+//
+//    A batch only ends between the steps of an operation, each of which
+//    leaves the metadata consistent: a step first reserves room for its
+//    worst case with journal_reserve, which commits the pending batch if
+//    it would not fit, and its writes then never commit on their own.
+
+// Records are padded so that every header stays 4-byte aligned.
+#define JOURNAL_RECORD_SPAN(size) (sizeof(fs_journal_record) + ROUNDUP((size_t) (size), 4))
+
+static uint32_t journal_checksum(const uint8_t *data, size_t size) {
+    uint32_t h = 2166136261U; // FNV-1a
+    for (size_t i = 0; i < size; i++) {
+        h ^= data[i];
+        h *= 16777619U;
+    }
+    return h;
+}
 
-#define INODE_ENTRY_SIZE sizeof(struct fs_inode_entry)
+static int journal_apply(fs_descriptor *fsdesc) {
+    size_t pos = 0;
+    while (pos < fsdesc->journal_length) {
+        fs_journal_record *rec = (fs_journal_record *) &fsdesc->journal_buffer[pos];
+        int r = fsdesc->fsdw((uintptr_t) (rec + 1), rec->offset, rec->size);
+        if (r < 0) return r;
 
+        pos += JOURNAL_RECORD_SPAN(rec->size);
+    }
 
-static const uint8_t ZERO = 0;
-static const uint8_t ONE = 1;
+    return 0;
+}
+
+static int journal_commit(fs_descriptor *fsdesc) {
+    if (fsdesc->journal_length == 0)
+        return 0;
+
+    // 1. records, in one sequential write
+    int r = fsdesc->fsdw((uintptr_t) fsdesc->journal_buffer,
+                         fsdesc->journal_offset + sizeof(fs_journal_header),
+                         fsdesc->journal_length);
+    if (r < 0) return r;
+
+    // 2. commit point
+    fs_journal_header header = {
+        .magic = FS_JOURNAL_MAGIC,
+        .sequence = ++fsdesc->journal_sequence,
+        .length = fsdesc->journal_length,
+        .checksum = journal_checksum(fsdesc->journal_buffer, fsdesc->journal_length)
+    };
+    r = fsdesc->fsdw((uintptr_t) &header, fsdesc->journal_offset, sizeof(header));
+    if (r < 0) return r;
+
+    // 3. checkpoint, then retire the record
+    r = journal_apply(fsdesc);
+    if (r < 0) return r;
+
+    header.magic = 0;
+    r = fsdesc->fsdw((uintptr_t) &header, fsdesc->journal_offset, sizeof(header));
+    if (r < 0) return r;
+
+    fsdesc->journal_length = 0;
+    return 0;
+}
+
+static int journal_replay(fs_descriptor *fsdesc) {
+    fs_journal_header header;
+    int r = fsdesc->fsdr((uintptr_t) &header, fsdesc->journal_offset, sizeof(header));
+    if (r < 0) return r;
+
+    fsdesc->journal_sequence = header.sequence;
+    fsdesc->journal_length = 0;
+
+    if (header.magic != FS_JOURNAL_MAGIC)
+        return 0;
+
+    if (header.length <= FS_JOURNAL_CAPACITY) {
+        r = fsdesc->fsdr((uintptr_t) fsdesc->journal_buffer,
+                         fsdesc->journal_offset + sizeof(fs_journal_header), header.length);
+        if (r < 0) return r;
+
+        // A torn record never reached its commit point: drop it.
+        if (journal_checksum(fsdesc->journal_buffer, header.length) == header.checksum) {
+            log_printf("journal_replay / replaying record %d (%d bytes)\n", header.sequence, header.length);
+            fsdesc->journal_length = header.length;
+            r = journal_apply(fsdesc);
+            if (r < 0) return r;
+        }
+    }
+
+    header.magic = 0;
+    r = fsdesc->fsdw((uintptr_t) &header, fsdesc->journal_offset, sizeof(header));
+    if (r < 0) return r;
+
+    fsdesc->journal_length = 0;
+    return 0;
+}
+
+int fs_meta_read(fs_descriptor *fsdesc, void *ptr, uint64_t start, size_t size) {
+    int r = fsdesc->fsdr((uintptr_t) ptr, start, size);
+    if (r < 0) return r;
+
+    size_t pos = 0;
+    while (pos < fsdesc->journal_length) {
+        fs_journal_record *rec = (fs_journal_record *) &fsdesc->journal_buffer[pos];
+        uint64_t lo = MAX((uint64_t) rec->offset, start);
+        uint64_t hi = MIN((uint64_t) rec->offset + rec->size, start + size);
+        if (lo < hi) {
+            memcpy((uint8_t *) ptr + (lo - start),
+                   (uint8_t *) (rec + 1) + (lo - rec->offset), hi - lo);
+        }
+
+        pos += JOURNAL_RECORD_SPAN(rec->size);
+    }
+
+    return 0;
+}
+
+int fs_meta_write(fs_descriptor *fsdesc, const void *ptr, uint64_t start, size_t size) {
+    if (JOURNAL_RECORD_SPAN(size) > FS_JOURNAL_CAPACITY)
+        return -EINVAL;
+
+    // Rewriting the same structure again (e.g. a parent node) replaces the
+    // pending copy, as long as no later record overlaps it.
+    fs_journal_record *same = NULL;
+    size_t pos = 0;
+    while (pos < fsdesc->journal_length) {
+        fs_journal_record *rec = (fs_journal_record *) &fsdesc->journal_buffer[pos];
+
+        if (rec->offset == start && rec->size == size) {
+            same = rec;
+        } else if (same && rec->offset < start + size && start < (uint64_t) rec->offset + rec->size) {
+            same = NULL;
+        }
+
+        pos += JOURNAL_RECORD_SPAN(rec->size);
+    }
+
+    if (same) {
+        memcpy(same + 1, ptr, size);
+        return 0;
+    }
+
+    // the step did not reserve enough
+    if (fsdesc->journal_length + JOURNAL_RECORD_SPAN(size) > FS_JOURNAL_CAPACITY)
+        return -ENOSPC;
+
+    fs_journal_record *rec = (fs_journal_record *) &fsdesc->journal_buffer[fsdesc->journal_length];
+    rec->offset = (uint32_t) start;
+    rec->size = (uint32_t) size;
+    memcpy(rec + 1, ptr, size);
+    fsdesc->journal_length += JOURNAL_RECORD_SPAN(size);
+
+    return 0;
+}
+
+// Makes room for `size` bytes of records, committing the pending batch if
+// needed. Only called at the start of a step.
+static int journal_reserve(fs_descriptor *fsdesc, size_t size) {
+    if (size > FS_JOURNAL_CAPACITY)
+        return -ENOSPC;
+
+    if (fsdesc->journal_length + size > FS_JOURNAL_CAPACITY)
+        return journal_commit(fsdesc);
+
+    return 0;
+}
+
+#define INODE_RECORD_SPAN JOURNAL_RECORD_SPAN(INODE_ENTRY_SIZE)
+#define NODE_RECORD_SPAN JOURNAL_RECORD_SPAN(NODE_SIZE)
+
+
+// Inodes
+//
+//    A file's data is one contiguous extent [start_block, start_block +
+//    block_count). block_count may exceed SIZE_TO_BLOCK(size): the extra
+//    blocks are a speculative preallocation for a growing file.
+//
+//    The last block of a growing file may also be "delayed": it lives in a
+//    fs_delalloc slot and has no disk block yet. Its data and the file size
+//    that includes it are only in memory; the on-disk inode never claims
+//    more than its allocated blocks. Delayed blocks get a disk block when
+//    the file outgrows them, when their slot is reused, or at fs_commit.
+
+static uint8_t block_buffer[BLOCK_SIZE];
+
+static fs_delalloc *delalloc_find(fs_descriptor *fsdesc, fs_ino ino) {
+    for (int i = 0; i < FS_DELALLOC_SLOTS; i++) {
+        if (fsdesc->delalloc[i].ino == ino)
+            return &fsdesc->delalloc[i];
+    }
+    return NULL;
+}
 
+// Inode entries are cached (write-through) in a small direct-mapped
+// cache; every inode update goes through write_inode.
+static int read_inode(fs_descriptor *fsdesc, fs_ino ino, fs_inode_entry *entry) {
+    fs_inode_cache *c = &fsdesc->inode_cache[ino % FS_INODE_CACHE_SIZE];
+    if (c->ino != ino || ino == 0) {
+        int r = fs_meta_read(fsdesc, &c->entry, fsdesc->inode_table_offset + ino * INODE_ENTRY_SIZE, INODE_ENTRY_SIZE);
+        if (r < 0) return r;
+        c->ino = ino;
+    }
+    *entry = c->entry;
+
+    fs_delalloc *slot = delalloc_find(fsdesc, ino);
+    if (slot)
+        entry->size = slot->size;
+
+    return 0;
+}
+
+static int write_inode(fs_descriptor *fsdesc, fs_ino ino, const fs_inode_entry *entry) {
+    fs_inode_entry disk_entry = *entry;
+
+    fs_delalloc *slot = delalloc_find(fsdesc, ino);
+    if (slot) {
+        slot->size = entry->size;
+        disk_entry.size = MIN(entry->size, (uint64_t) entry->block_count * BLOCK_SIZE);
+    }
+
+    int r = fs_meta_write(fsdesc, &disk_entry, fsdesc->inode_table_offset + ino * INODE_ENTRY_SIZE, INODE_ENTRY_SIZE);
+    if (r < 0) return r;
+
+    fs_inode_cache *c = &fsdesc->inode_cache[ino % FS_INODE_CACHE_SIZE];
+    c->ino = ino;
+    c->entry = disk_entry;
+    return 0;
+}
+
+// The block tables are updated a run at a time: one read and one journal
+// record per TABLE_RUN entries, however many blocks an extent spans.
+#define TABLE_RUN 1024
+
+// Journal space needed to update `n` entries (see set_table).
+#define TABLE_SPAN(n) ((size_t) (n) + ((n) + TABLE_RUN - 1) / TABLE_RUN * JOURNAL_RECORD_SPAN(1))
+
+static uint8_t table_buffer[TABLE_RUN];
+
+// Sets the `n` table entries at `offset` to `value`.
+static int set_table(fs_descriptor *fsdesc, uint64_t offset, uint32_t n, uint8_t value) {
+    for (uint32_t i = 0; i < n; i += TABLE_RUN) {
+        uint32_t k = MIN(n - i, (uint32_t) TABLE_RUN);
+        memset(table_buffer, value, k);
+        int r = fs_meta_write(fsdesc, table_buffer, offset + i, k);
+        if (r < 0) return r;
+    }
+    return 0;
+}
+
+static int set_blocks(fs_descriptor *fsdesc, uint32_t start_block, uint32_t n, const uint8_t *value) {
+    return set_table(fsdesc, fsdesc->avail_block_table_offset + start_block, n, *value);
+}
+
+// Adds `delta` to the reference count of each of `n` blocks.
+static int add_block_refs(fs_descriptor *fsdesc, uint32_t start_block, uint32_t n, int delta) {
+    uint64_t offset = fsdesc->avail_block_table_offset + start_block;
+    for (uint32_t i = 0; i < n; i += TABLE_RUN) {
+        uint32_t k = MIN(n - i, (uint32_t) TABLE_RUN);
+        int r = fs_meta_read(fsdesc, table_buffer, offset + i, k);
+        if (r < 0) return r;
+
+        for (uint32_t j = 0; j < k; j++) {
+            assert(table_buffer[j] + delta >= 0 && table_buffer[j] + delta <= 0xFF);
+            table_buffer[j] += delta;
+        }
+
+        r = fs_meta_write(fsdesc, table_buffer, offset + i, k);
+        if (r < 0) return r;
+    }
+    return 0;
+}
+
+// Returns 1 if one of `n` blocks cannot take another reference.
+static int block_refs_full(fs_descriptor *fsdesc, uint32_t start_block, uint32_t n) {
+    uint64_t offset = fsdesc->avail_block_table_offset + start_block;
+    for (uint32_t i = 0; i < n; i += TABLE_RUN) {
+        uint32_t k = MIN(n - i, (uint32_t) TABLE_RUN);
+        int r = fs_meta_read(fsdesc, table_buffer, offset + i, k);
+        if (r < 0) return r;
+
+        for (uint32_t j = 0; j < k; j++)
+            if (table_buffer[j] == 0xFF)
+                return 1;
+    }
+    return 0;
+}
+
+// Drops one reference to each of `n` blocks; a block is free again once
+// no file's extent includes it.
+static int block_unref(fs_descriptor *fsdesc, uint32_t start_block, uint32_t n) {
+    return add_block_refs(fsdesc, start_block, n, -1);
+}
 
 int unref_inode(fs_descriptor *fsdesc, uint32_t ino) {
     fs_inode_entry entry;
-    int r = fsdesc->fsdr((uintptr_t) &entry, fsdesc->inode_table_offset + ino * INODE_ENTRY_SIZE, INODE_ENTRY_SIZE);
+    int r = read_inode(fsdesc, ino, &entry);
     if (r < 0) return r;
 
     assert(entry.ref > 0);
     entry.ref -= 1;
 
     if (entry.ref == 0) {
+        // The key goes away with the entry, so the data blocks need no
+        // scrubbing: they are just returned to the allocator (or left to
+        // the clones that share them).
+        r = block_unref(fsdesc, entry.start_block, entry.block_count);
+        if (r < 0) return r;
+
+        fs_delalloc *slot = delalloc_find(fsdesc, ino);
+        if (slot)
+            slot->ino = 0;
+
         memset(&entry, 0, INODE_ENTRY_SIZE);
-        for (uint32_t i = 0; i < entry.block_count; i++) {
-            fsdesc->fsdw((uintptr_t) &ZERO, fsdesc->data_offset + entry.start_block + i * BLOCK_SIZE, BLOCK_SIZE);
-        }
     }
 
-    r = fsdesc->fsdw((uintptr_t) &entry, fsdesc->inode_table_offset + ino * INODE_ENTRY_SIZE, INODE_ENTRY_SIZE);
+    r = write_inode(fsdesc, ino, &entry);
     if (r < 0) return r;
 
     return 0;
@@ -77,25 +364,78 @@ int decrypt_block(fs_descriptor *fsdesc, uint32_t index, struct AES_ctx *ctx, ui
     return 0;
 }
 
-int encrypt_block(fs_descriptor *fsdesc, uint32_t index, struct AES_ctx *ctx, const void *buffer) {
-    AES_CTR_xcrypt_buffer(ctx, (uint8_t *) buffer, BLOCK_SIZE);
+// Encrypts `buffer` in place and writes it to data block `index`. The
+// caller marks the block written (see mark_written).
+int encrypt_block(fs_descriptor *fsdesc, uint32_t index, struct AES_ctx *ctx, uint8_t *buffer) {
+    AES_CTR_xcrypt_buffer(ctx, buffer, BLOCK_SIZE);
 
     uintptr_t addr = fsdesc->data_offset + index * BLOCK_SIZE;
-    int r = fsdesc->fsdw((uintptr_t) buffer, addr, BLOCK_SIZE);
-    if (r < 0) return r;
+    return fsdesc->fsdw((uintptr_t) buffer, addr, BLOCK_SIZE);
+}
+
+// Marks `n` data blocks as written in the block usage table.
+static int mark_written(fs_descriptor *fsdesc, uint32_t index, uint32_t n) {
+    return set_table(fsdesc, fsdesc->block_usage_offset + index, n, 1);
+}
+
+// Each block of a file is encrypted with the IV cipher_iv + its index in
+// the file, so blocks can be read, written and moved independently.
+static int read_file_block(fs_descriptor *fsdesc, fs_ino ino, const fs_inode_entry *entry,
+                           uint32_t block_idx, uint8_t *buffer) {
+    if (block_idx >= entry->block_count) {
+        fs_delalloc *slot = delalloc_find(fsdesc, ino);
+        if (slot && slot->block == block_idx) {
+            memcpy(buffer, slot->data, BLOCK_SIZE);
+        } else {
+            memset(buffer, 0, BLOCK_SIZE);
+        }
+        return 0;
+    }
 
-    r = fsdesc->fsdw((uintptr_t) &ONE, fsdesc->block_usage_offset + index, 1);
+    struct AES_ctx ctx;
+    uint128_t iv = entry->cipher_iv + block_idx;
+    AES_init_ctx_iv(&ctx, entry->cipher_key, (uint8_t *) &iv);
+
+    return decrypt_block(fsdesc, entry->start_block + block_idx, &ctx, buffer);
+}
+
+// Reads `n` consecutive on-disk blocks of a file, starting at `block_idx`,
+// with one disk transfer, and decrypts them in place in `buffer`.
+static int read_file_blocks(fs_descriptor *fsdesc, const fs_inode_entry *entry,
+                            uint32_t block_idx, uint32_t n, uint8_t *buffer) {
+    assert(block_idx + n <= entry->block_count);
+
+    uintptr_t addr = fsdesc->data_offset + (uint64_t) (entry->start_block + block_idx) * BLOCK_SIZE;
+    int r = fsdesc->fsdr((uintptr_t) buffer, addr, (size_t) n * BLOCK_SIZE);
     if (r < 0) return r;
 
+    for (uint32_t i = 0; i < n; i++) {
+        struct AES_ctx ctx;
+        uint128_t iv = entry->cipher_iv + block_idx + i;
+        AES_init_ctx_iv(&ctx, entry->cipher_key, (uint8_t *) &iv);
+        AES_CTR_xcrypt_buffer(&ctx, buffer + (size_t) i * BLOCK_SIZE, BLOCK_SIZE);
+    }
     return 0;
 }
 
+// `buffer` is clobbered.
+static int write_file_block(fs_descriptor *fsdesc, const fs_inode_entry *entry,
+                            uint32_t block_idx, uint8_t *buffer) {
+    assert(block_idx < entry->block_count);
+
+    struct AES_ctx ctx;
+    uint128_t iv = entry->cipher_iv + block_idx;
+    AES_init_ctx_iv(&ctx, entry->cipher_key, (uint8_t *) &iv);
+
+    return encrypt_block(fsdesc, entry->start_block + block_idx, &ctx, buffer);
+}
+
 int64_t search_available_inode(fs_descriptor *fsdesc) {
     for (uint32_t i = 1; i < fsdesc->metadata.inode_count; i++) {
         uint8_t used;
         uint64_t addr = fsdesc->inode_table_offset + i*INODE_ENTRY_SIZE;
 
-        int r = fsdesc->fsdr((uintptr_t) &used, addr, 1);
+        int r = fs_meta_read(fsdesc, &used, addr, 1);
         if (r < 0) return r;
         
         if (!used) return i;
@@ -109,99 +449,368 @@ int64_t fs_alloc_inode(fs_descriptor *fsdesc) {
     if (r < 0) return r;
     uint32_t inode = (uint32_t) r;
 
-    fs_inode_entry entry;
-    r = fsdesc->fsdr((uintptr_t) &entry, fsdesc->inode_table_offset + inode*INODE_ENTRY_SIZE, INODE_ENTRY_SIZE);
+    // The new inode is linked by fs_touch next: room for both, so that the
+    // file is created in one batch.
+    r = journal_reserve(fsdesc, INODE_RECORD_SPAN + 2 * NODE_RECORD_SPAN + JOURNAL_RECORD_SPAN(1));
     if (r < 0) return r;
-    
-    entry.ref += 1;
 
-    r = fsdesc->fsdw((uintptr_t) &entry, fsdesc->inode_table_offset + inode*INODE_ENTRY_SIZE, INODE_ENTRY_SIZE);
+    fs_inode_entry entry;
+    memset(&entry, 0, INODE_ENTRY_SIZE);
+    entry.ref = 1;
+    fsdesc->fsrng(entry.cipher_key, FS_KEY_SIZE);
+    fsdesc->fsrng((uint8_t *) &entry.cipher_iv, FS_IV_SIZE);
+
+    r = write_inode(fsdesc, inode, &entry);
     if (r < 0) return r;
     
     return inode;
 }
 
 
-int64_t search_free_blocks(fs_descriptor *fsdesc, uint32_t n) {
-    uint32_t start_block = 0;
-    uint32_t count = 0;
-    uintptr_t addr = fsdesc->avail_block_table_offset;
-
-    while (start_block+count < fsdesc->metadata.block_count && count < n) {
-        unsigned char dest;
-
-        int r = fsdesc->fsdr((uintptr_t) &dest, addr, 1);
-        if (r < 0) return r;
+// Block allocation
+//
+//    The available block table holds one byte per data block: the number
+//    of files whose extent includes it, so nonzero if the block is
+//    allocated and more than one for blocks shared by clones (see
+//    fs_copy_range). New extents are placed next-fit, from a cursor
+//    that follows the last allocation, so that files created one after the
+//    other do not all compete for the space at the start of the disk. If
+//    no run after the cursor is large enough, the smallest run that fits
+//    is used (best-fit).
+//
+//    A block freed by the pending journal batch is not reused before the
+//    batch commits: until then the committed metadata still points to it,
+//    and data blocks are written in place, outside the journal.
+
+#define AVAIL_CHUNK 64
+
+// Returns the start of a free run of at least `need` blocks and stores its
+// usable length (at most `want`) in *got.
+static int64_t search_free_blocks(fs_descriptor *fsdesc, uint32_t need, uint32_t want, uint32_t *got) {
+    uint32_t block_count = fsdesc->metadata.block_count;
+    uint32_t cursor = fsdesc->alloc_cursor < block_count ? fsdesc->alloc_cursor : 0;
+
+    int64_t next_fit = -1, wrap_fit = -1, best_fit = -1;
+    uint32_t best_len = 0;
+    uint32_t run_start = 0, run_len = 0;
+    uint8_t chunk[AVAIL_CHUNK], committed[AVAIL_CHUNK];
+
+    for (uint32_t b = 0; b <= block_count; b++) {
+        int allocated = 1;
+        if (b < block_count) {
+            if (b % AVAIL_CHUNK == 0) {
+                uint32_t k = MIN((uint32_t) AVAIL_CHUNK, block_count - b);
+                int r = fs_meta_read(fsdesc, chunk, fsdesc->avail_block_table_offset + b, k);
+                if (r < 0) return r;
+                r = fsdesc->fsdr((uintptr_t) committed, fsdesc->avail_block_table_offset + b, k);
+                if (r < 0) return r;
+            }
+            allocated = chunk[b % AVAIL_CHUNK] != 0 || committed[b % AVAIL_CHUNK] != 0;
+        }
 
-        count++;
+        if (!allocated) {
+            if (run_len++ == 0)
+                run_start = b;
+            continue;
+        }
+        if (run_len == 0)
+            continue;
+
+        // A run that straddles the cursor is considered from the cursor on.
+        uint32_t start = run_start, len = run_len;
+        if (start < cursor && cursor < start + len) {
+            len -= cursor - start;
+            start = cursor;
+        }
 
-        if (dest != 0) {
-            start_block += count;
-            count = 0;
+        if (len >= want) {
+            if (start >= cursor && next_fit < 0)
+                next_fit = start;
+            else if (start < cursor && wrap_fit < 0)
+                wrap_fit = start;
+        }
+        if (run_len >= need && (best_fit < 0 || run_len < best_len)) {
+            best_fit = run_start;
+            best_len = run_len;
         }
 
-        addr += 1;
+        run_len = 0;
     }
 
-    if (count == n) {
-        return (int64_t) start_block;
+    if (next_fit >= 0 || wrap_fit >= 0) {
+        *got = want;
+        return next_fit >= 0 ? next_fit : wrap_fit;
     }
-    
+    if (best_fit >= 0) {
+        *got = MIN(best_len, want);
+        return best_fit;
+    }
+
     return -ENOSPC;
 }
 
-int are_blocks_avaiblable(fs_descriptor *fsdesc, int start_block, uint32_t n) {
-    uintptr_t addr = fsdesc->avail_block_table_offset;
+static int are_blocks_available(fs_descriptor *fsdesc, uint32_t start_block, uint32_t n) {
+    if ((uint64_t) start_block + n > fsdesc->metadata.block_count)
+        return 0;
 
     for (uint32_t i = 0; i < n; i++) {
-        unsigned char dest;
+        uint8_t allocated, committed;
 
-        int r = fsdesc->fsdr((uintptr_t) &dest, addr + start_block + i, 1);
+        int r = fs_meta_read(fsdesc, &allocated, fsdesc->avail_block_table_offset + start_block + i, 1);
+        if (r < 0) return r;
+        r = fsdesc->fsdr((uintptr_t) &committed, fsdesc->avail_block_table_offset + start_block + i, 1);
         if (r < 0) return r;
 
-        if (dest != 0) {
+        if (allocated || committed)
             return 0;
-        }
-
-        addr += 1;
     }
 
     return 1;
 }
 
+// Gives back the preallocated tail of every file except `except`.
+// Used when the disk is full.
+static int trim_preallocations(fs_descriptor *fsdesc, fs_ino except) {
+    for (uint32_t ino = 1; ino < fsdesc->metadata.inode_count; ino++) {
+        if (ino == except)
+            continue;
 
-int set_availability(fs_descriptor *fsdesc, int block, const uint8_t *value) {
-    uintptr_t addr = fsdesc->avail_block_table_offset + block;
+        fs_inode_entry entry;
+        int r = read_inode(fsdesc, ino, &entry);
+        if (r < 0) return r;
+
+        uint32_t used = SIZE_TO_BLOCK(entry.size);
+        if (!entry.ref || used >= entry.block_count)
+            continue;
+
+        r = journal_reserve(fsdesc, TABLE_SPAN(entry.block_count - used) + INODE_RECORD_SPAN);
+        if (r < 0) return r;
+
+        r = block_unref(fsdesc, entry.start_block + used, entry.block_count - used);
+        if (r < 0) return r;
+
+        entry.block_count = used;
+        if (used == 0)
+            entry.start_block = 0;
+
+        r = write_inode(fsdesc, ino, &entry);
+        if (r < 0) return r;
+    }
 
-    int r = fsdesc->fsdw((uintptr_t) value, addr, 1);
-    if (r < 0) return r;
-    
     return 0;
 }
 
-int copy_block(fs_descriptor *fsdesc,
-        uint32_t src_index, uint8_t *src_key, uint128_t src_iv,
-        uint32_t dst_index, uint8_t *dst_key, uint128_t dst_iv,
-        uint32_t n) {
-
-    struct AES_ctx ctx_dec;
-    AES_init_ctx_iv(&ctx_dec, src_key, (uint8_t *) &src_iv);
+// Finds a free run for `ino`, as search_free_blocks. When the disk is
+// full, the preallocations of the other files are given back and the
+// pending batch is committed, so that the blocks freed are available.
+static int64_t search_blocks_for(fs_descriptor *fsdesc, fs_ino ino, uint32_t need, uint32_t want, uint32_t *got) {
+    int64_t start = search_free_blocks(fsdesc, need, want, got);
+    if (start != -ENOSPC)
+        return start;
 
-    struct AES_ctx ctx_enc;
-    AES_init_ctx_iv(&ctx_enc, dst_key, (uint8_t *) &dst_iv);
+    int r = trim_preallocations(fsdesc, ino);
+    if (r < 0) return r;
+    r = journal_commit(fsdesc);
+    if (r < 0) return r;
 
-    uint8_t buf[BLOCK_SIZE];
+    return search_free_blocks(fsdesc, need, want, got);
+}
 
+// Copies `n` blocks of ciphertext. The IV depends on the block's index in
+// the file, not on its position on disk, so no re-encryption is needed.
+int copy_block(fs_descriptor *fsdesc, uint32_t src_index, uint32_t dst_index, uint32_t n) {
     for (uint32_t i = 0; i < n; i++) {
-        int r = decrypt_block(fsdesc, src_index + i, &ctx_dec, buf);
+        int r = fsdesc->fsdr((uintptr_t) block_buffer, fsdesc->data_offset + (src_index + i) * BLOCK_SIZE, BLOCK_SIZE);
         if (r < 0) return r;
-        r = encrypt_block(fsdesc, dst_index + i, &ctx_enc, buf);
+        r = fsdesc->fsdw((uintptr_t) block_buffer, fsdesc->data_offset + (dst_index + i) * BLOCK_SIZE, BLOCK_SIZE);
         if (r < 0) return r;
     }
+    int r = mark_written(fsdesc, dst_index, n);
+    if (r < 0) return r;
 
-    return 0;
+    // Relocation statistics, reported by the host fsck
+    fsdesc->metadata.relocation_count += 1;
+    fsdesc->metadata.relocated_bytes += (uint64_t) n * BLOCK_SIZE;
+    return fs_meta_write(fsdesc, &fsdesc->metadata, 0, METADATA_SIZE);
+}
+
+// Makes sure the first `need` blocks of the file are allocated, growing
+// the extent in place when the following blocks are free and relocating
+// it otherwise. A file that grows again gets up to as many blocks again
+// (at most FS_PREALLOC_MAX_BLOCKS) preallocated. A delayed block that now
+// has a home is written out. The updated inode is written.
+static int ensure_blocks(fs_descriptor *fsdesc, fs_ino ino, fs_inode_entry *entry, uint32_t need) {
+    if (need <= entry->block_count)
+        return 0;
+
+    uint32_t want = need;
+    if (entry->block_count > 0)
+        want += MIN(need, (uint32_t) FS_PREALLOC_MAX_BLOCKS);
+
+    // new extent, copied blocks, old extent, delayed block and inode
+    int r = journal_reserve(fsdesc, TABLE_SPAN(want) + 2 * TABLE_SPAN(entry->block_count)
+                            + JOURNAL_RECORD_SPAN(METADATA_SIZE) + JOURNAL_RECORD_SPAN(1)
+                            + INODE_RECORD_SPAN);
+    if (r < 0) return r;
+
+    uint32_t tail = entry->start_block + entry->block_count;
+    if (entry->block_count > 0) {
+        r = are_blocks_available(fsdesc, tail, want - entry->block_count);
+        if (r < 0) return r;
+        if (!r) {
+            want = need;
+            r = are_blocks_available(fsdesc, tail, need - entry->block_count);
+            if (r < 0) return r;
+        }
+    }
+
+    if (r) {
+        r = set_blocks(fsdesc, tail, want - entry->block_count, &ONE);
+        if (r < 0) return r;
+    } else {
+        uint32_t got;
+        int64_t start = search_blocks_for(fsdesc, ino, need, want, &got);
+        if (start < 0) return start;
+        want = got;
+
+        r = set_blocks(fsdesc, (uint32_t) start, want, &ONE);
+        if (r < 0) return r;
+
+        if (entry->block_count > 0) {
+            log_printf("fs_write / relocating inode %d from block %d to %d\n", ino, entry->start_block, (uint32_t) start);
+
+            uint32_t used = MIN(entry->block_count, SIZE_TO_BLOCK(entry->size));
+            r = copy_block(fsdesc, entry->start_block, (uint32_t) start, used);
+            if (r < 0) return r;
+
+            r = block_unref(fsdesc, entry->start_block, entry->block_count);
+            if (r < 0) return r;
+        }
+
+        entry->start_block = (uint32_t) start;
+    }
+
+    entry->block_count = want;
+    fsdesc->alloc_cursor = entry->start_block + entry->block_count;
+
+    fs_delalloc *slot = delalloc_find(fsdesc, ino);
+    if (slot && slot->block < entry->block_count) {
+        r = write_file_block(fsdesc, entry, slot->block, slot->data);
+        slot->ino = 0;
+        if (r < 0) return r;
+        r = mark_written(fsdesc, entry->start_block + slot->block, 1);
+        if (r < 0) return r;
+    }
+
+    return write_inode(fsdesc, ino, entry);
+}
+
+// Sets `ctx`, which holds the expanded key of the file `entry`, to encrypt
+// or decrypt block `block_idx` of the file. Copies between two files keep
+// one such context per file instead of expanding the keys for every block.
+static void set_block_iv(struct AES_ctx *ctx, const fs_inode_entry *entry, uint32_t block_idx) {
+    uint128_t iv = entry->cipher_iv + block_idx;
+    AES_ctx_set_iv(ctx, (uint8_t *) &iv);
+}
+
+// Blocks shared with a clone are read-only. Before the first write to a
+// file that shares its blocks, its data is copied to a new extent and
+// re-encrypted under a new key: writing it in place, or keeping the key,
+// would reuse the other file's key stream.
+static int unshare_blocks(fs_descriptor *fsdesc, fs_ino ino, fs_inode_entry *entry) {
+    if (entry->block_count == 0)
+        return 0;
+
+    // Clones share all the blocks in use, so the first one tells.
+    uint8_t refs;
+    int r = fs_meta_read(fsdesc, &refs, fsdesc->avail_block_table_offset + entry->start_block, 1);
+    if (r < 0) return r;
+    if (refs <= 1)
+        return 0;
+
+    uint32_t n = entry->block_count, got;
+    r = journal_reserve(fsdesc, 3 * TABLE_SPAN(n) + INODE_RECORD_SPAN);
+    if (r < 0) return r;
+
+    int64_t start = search_blocks_for(fsdesc, ino, n, n, &got);
+    if (start < 0) return start;
+
+    r = set_blocks(fsdesc, (uint32_t) start, n, &ONE);
+    if (r < 0) return r;
+
+    log_printf("fs_write / unsharing inode %d from block %d to %d\n", ino, entry->start_block, (uint32_t) start);
+
+    fs_inode_entry old = *entry;
+    entry->start_block = (uint32_t) start;
+    fsdesc->fsrng(entry->cipher_key, FS_KEY_SIZE);
+    fsdesc->fsrng((uint8_t *) &entry->cipher_iv, FS_IV_SIZE);
+
+    struct AES_ctx old_ctx, new_ctx;
+    AES_init_ctx(&old_ctx, old.cipher_key);
+    AES_init_ctx(&new_ctx, entry->cipher_key);
+
+    uint32_t used = MIN(n, SIZE_TO_BLOCK(entry->size));
+    for (uint32_t i = 0; i < used; i++) {
+        set_block_iv(&old_ctx, &old, i);
+        r = decrypt_block(fsdesc, old.start_block + i, &old_ctx, block_buffer);
+        if (r < 0) return r;
+
+        set_block_iv(&new_ctx, entry, i);
+        r = encrypt_block(fsdesc, entry->start_block + i, &new_ctx, block_buffer);
+        if (r < 0) return r;
+    }
+    r = mark_written(fsdesc, entry->start_block, used);
+    if (r < 0) return r;
+
+    r = block_unref(fsdesc, old.start_block, n);
+    if (r < 0) return r;
+
+    return write_inode(fsdesc, ino, entry);
+}
+
+// Gives the delayed block of `ino` a disk block.
+static int delalloc_flush(fs_descriptor *fsdesc, fs_delalloc *slot) {
+    fs_ino ino = slot->ino;
+
+    fs_inode_entry entry;
+    int r = read_inode(fsdesc, ino, &entry);
+    if (r < 0) return r;
+
+    return ensure_blocks(fsdesc, ino, &entry, slot->block + 1);
+}
+
+// Returns a slot holding block `block_idx` of `ino`, evicting another
+// file's delayed block if needed.
+static fs_delalloc *delalloc_get(fs_descriptor *fsdesc, fs_ino ino, uint32_t block_idx, uint64_t size) {
+    fs_delalloc *slot = delalloc_find(fsdesc, ino);
+    if (slot)
+        return slot->block == block_idx ? slot : NULL;
+
+    slot = delalloc_find(fsdesc, 0);
+    if (!slot) {
+        slot = &fsdesc->delalloc[fsdesc->delalloc_victim];
+        fsdesc->delalloc_victim = (fsdesc->delalloc_victim + 1) % FS_DELALLOC_SLOTS;
+        if (delalloc_flush(fsdesc, slot) < 0)
+            return NULL;
+    }
+
+    slot->ino = ino;
+    slot->block = block_idx;
+    slot->size = size;
+    memset(slot->data, 0, BLOCK_SIZE);
+    return slot;
 }
 
+int fs_commit(fs_descriptor *fsdesc) {
+    for (int i = 0; i < FS_DELALLOC_SLOTS; i++) {
+        if (fsdesc->delalloc[i].ino) {
+            int r = delalloc_flush(fsdesc, &fsdesc->delalloc[i]);
+            if (r < 0) return r;
+        }
+    }
+
+    return journal_commit(fsdesc);
+}
 
 
 int fs_init(fs_descriptor *fsdesc, fs_disk_reader fsdr, fs_disk_writer fsdw, fs_random_generator fsrng) {
@@ -212,15 +821,28 @@ int fs_init(fs_descriptor *fsdesc, fs_disk_reader fsdr, fs_disk_writer fsdw, fs_
     int r = fsdr((uintptr_t) &fsdesc->metadata, 0, METADATA_SIZE);
     if (r < 0) return r;
 
-    fsdesc->metadata.block_count = 16;
-    fsdesc->metadata.inode_count = 16;
-    fsdesc->metadata.node_count = 16;
+    int format = fsdesc->metadata.block_count == 0;
+    if (format) {
+        memset(&fsdesc->metadata, 0, METADATA_SIZE);
+        fsdesc->metadata.block_count = FS_DEFAULT_BLOCK_COUNT;
+        fsdesc->metadata.inode_count = FS_DEFAULT_INODE_COUNT;
+        fsdesc->metadata.node_count = FS_DEFAULT_NODE_COUNT;
+    }
 
-    fsdesc->inode_table_offset = METADATA_SIZE;
-    fsdesc->block_usage_offset = fsdesc->inode_table_offset + fsdesc->metadata.inode_count * INODE_ENTRY_SIZE;
-    fsdesc->tree_usage_offset = fsdesc->block_usage_offset + fsdesc->metadata.inode_count;
-    fsdesc->tree_offset = fsdesc->tree_usage_offset + fsdesc->metadata.block_count * BLOCK_SIZE;
-    fsdesc->data_offset = fsdesc->tree_offset + fsdesc->metadata.node_count * NODE_SIZE;
+    fs_layout(fsdesc);
+    memset(fsdesc->inode_cache, 0, sizeof(fsdesc->inode_cache));
+    memset(fsdesc->dentry_cache, 0, sizeof(fsdesc->dentry_cache));
+
+    r = journal_replay(fsdesc);
+    if (r < 0) return r;
+
+    if (format) {
+        r = fs_meta_write(fsdesc, &fsdesc->metadata, 0, METADATA_SIZE);
+    } else {
+        // the replayed journal may have updated the relocation counters
+        r = fsdr((uintptr_t) &fsdesc->metadata, 0, METADATA_SIZE);
+    }
+    if (r < 0) return r;
 
     return 0;
 }
@@ -229,13 +851,11 @@ ssize_t fs_read(fs_descriptor *fsdesc, fs_ino ino, void *buf, size_t size, uint6
     if (size > FS_IO_MAX_SIZE)
         return -EINVAL;
 
-    uintptr_t entry_addr = METADATA_SIZE + ino * INODE_ENTRY_SIZE;
-
     struct fs_inode_entry entry;
-    int r = fsdesc->fsdr((uintptr_t) &entry, entry_addr, INODE_ENTRY_SIZE);
+    int r = read_inode(fsdesc, ino, &entry);
     if (r < 0) return r;
 
-    if (offset >= entry.size)
+    if (offset >= entry.size || size == 0)
         return 0;
 
     if (size + offset > entry.size)
@@ -247,18 +867,7 @@ ssize_t fs_read(fs_descriptor *fsdesc, fs_ino ino, void *buf, size_t size, uint6
     uint32_t end_block = (offset + size - 1) / BLOCK_SIZE;
     uint32_t offset_in_block = offset % BLOCK_SIZE;
 
-    struct AES_ctx ctx;
-    uint8_t block_buf[BLOCK_SIZE];
-
     for (uint32_t block_idx = start_block; block_idx <= end_block; block_idx++) {
-        // Initialize AES context with the correct IV for this block
-        uint128_t iv = entry.cipher_iv + block_idx;
-        AES_init_ctx_iv(&ctx, entry.cipher_key, (uint8_t *)&iv);
-
-        // Decrypt the block
-        r = decrypt_block(fsdesc, entry.start_block + block_idx, &ctx, block_buf);
-        if (r < 0) return r;
-
         // Calculate how many bytes to copy from this block
         size_t block_offset = (block_idx == start_block) ? offset_in_block : 0;
         size_t bytes_to_copy = BLOCK_SIZE - block_offset;
@@ -266,8 +875,24 @@ ssize_t fs_read(fs_descriptor *fsdesc, fs_ino ino, void *buf, size_t size, uint6
         if (bytes_to_copy > size - bytes_read)
             bytes_to_copy = size - bytes_read;
 
+        // Whole blocks on disk go straight to the output buffer and are
+        // decrypted there, as many as possible per disk transfer
+        if (bytes_to_copy == BLOCK_SIZE && block_idx < entry.block_count) {
+            uint32_t n = MIN((size - bytes_read) / BLOCK_SIZE,
+                             (size_t) (entry.block_count - block_idx));
+            r = read_file_blocks(fsdesc, &entry, block_idx, n, dst + bytes_read);
+            if (r < 0) return r;
+
+            bytes_read += (size_t) n * BLOCK_SIZE;
+            block_idx += n - 1;
+            continue;
+        }
+
+        r = read_file_block(fsdesc, ino, &entry, block_idx, block_buffer);
+        if (r < 0) return r;
+
         // Copy the decrypted data to the output buffer
-        memcpy(dst + bytes_read, block_buf + block_offset, bytes_to_copy);
+        memcpy(dst + bytes_read, block_buffer + block_offset, bytes_to_copy);
         bytes_read += bytes_to_copy;
     }
 
@@ -280,155 +905,318 @@ ssize_t fs_write(fs_descriptor *fsdesc, fs_ino ino, const void *buf, size_t size
     if (size > FS_IO_MAX_SIZE)
         return -EINVAL;
 
-    uintptr_t entry_addr = METADATA_SIZE + ino * INODE_ENTRY_SIZE;
     struct fs_inode_entry entry;
-    int64_t r = fsdesc->fsdr((uintptr_t) &entry, entry_addr, INODE_ENTRY_SIZE);
+    int64_t r = read_inode(fsdesc, ino, &entry);
     if (r < 0) return r;
 
-    log_printf("fs_write / current file size: %llu, block_count: %u, start_block: %u\n", 
-               entry.size, entry.block_count, entry.start_block);
-
     if (entry.size < offset)
         return -EINVAL;
-    
-    uint32_t total_block = SIZE_TO_BLOCK(offset+size); // Total number of blocks needed to write the file
-    uint32_t new_block = total_block - entry.block_count;
-    int aba = -1;
 
-    log_printf("fs_write / total_block needed: %u, new blocks needed: %d\n", total_block, new_block);
+    if (size == 0)
+        return 0;
 
-    // If we need more blocks than the file already has, we need to allocate new blocks
-    if (new_block > 0) {
-        aba = are_blocks_avaiblable(fsdesc, entry.start_block + entry.block_count, new_block);
-        if (aba < 0) return aba;
-        log_printf("fs_write / blocks available after current file: %s\n", aba ? "yes" : "no");
-    }
+    r = unshare_blocks(fsdesc, ino, &entry);
+    if (r < 0) return r;
 
-    uint8_t partial_block[BLOCK_SIZE];
-    if (offset % BLOCK_SIZE != 0) {
-        // If the offset is not a multiple of the block size, we need to handle the partial block
-        log_printf("fs_write / handling partial block at offset %llu\n", offset);
-        struct AES_ctx ctx;
-        uint128_t iv = entry.cipher_iv + offset / BLOCK_SIZE;
-        AES_init_ctx_iv(&ctx, entry.cipher_key, (uint8_t *) &iv);
-        r = decrypt_block(fsdesc, entry.start_block + offset / BLOCK_SIZE, &ctx, partial_block);
-        if (r < 0) return r;
+    uint64_t end = offset + size;
+    uint32_t need = SIZE_TO_BLOCK(end);
 
-        memcpy(partial_block + offset % BLOCK_SIZE, buf, BLOCK_SIZE - offset % BLOCK_SIZE);
-    }
+    // Delayed allocation: a write that only spills into the block right
+    // after the extent is kept in memory until the file grows further.
+    fs_delalloc *slot = NULL;
+    if (need == entry.block_count + 1)
+        slot = delalloc_get(fsdesc, ino, entry.block_count, entry.size);
 
-    if (aba == 0) {
-        // If the blocks right after the last block of the file are not available, we need to search for free blocks
-        log_printf("fs_write / searching for %u free blocks\n", total_block);
-        r = search_free_blocks(fsdesc, total_block);
+    if (!slot) {
+        r = ensure_blocks(fsdesc, ino, &entry, need);
         if (r < 0) return r;
+    }
 
-        uint32_t new_start_block = (uint32_t) r;
-        log_printf("fs_write / found new start block: %u\n", new_start_block);
-        
-        uint8_t dst_key[FS_KEY_SIZE];
-        uint128_t dst_iv;
-        fsdesc->fsrng(dst_key, FS_KEY_SIZE);
-        fsdesc->fsrng((uint8_t *) &dst_iv, FS_IV_SIZE);
+    uint32_t first = offset / BLOCK_SIZE;
+    r = journal_reserve(fsdesc, TABLE_SPAN(need - first) + INODE_RECORD_SPAN);
+    if (r < 0) return r;
 
-        log_printf("fs_write / copying %u blocks from old location to new\n", offset / BLOCK_SIZE);
-        copy_block(fsdesc,
-            entry.start_block, entry.cipher_key, entry.cipher_iv,
-            new_start_block, dst_key, dst_iv,
-            offset / BLOCK_SIZE);
+    const uint8_t *src = (const uint8_t *) buf;
+    uint64_t pos = offset;
+
+    while (pos < end) {
+        uint32_t block_idx = pos / BLOCK_SIZE;
+        size_t block_offset = pos % BLOCK_SIZE;
+        size_t n = MIN((uint64_t) BLOCK_SIZE - block_offset, end - pos);
+
+        if (slot && block_idx == slot->block) {
+            memcpy(slot->data + block_offset, src, n);
+        } else {
+            // Partial block: read, modify, write
+            if (n < BLOCK_SIZE) {
+                r = read_file_block(fsdesc, ino, &entry, block_idx, block_buffer);
+                if (r < 0) return r;
+            }
+
+            memcpy(block_buffer + block_offset, src, n);
+            r = write_file_block(fsdesc, &entry, block_idx, block_buffer);
+            if (r < 0) return r;
+        }
 
-        entry.start_block = new_start_block;
-        memcpy(entry.cipher_key, dst_key, FS_KEY_SIZE);
-        memcpy(&entry.cipher_iv, &dst_iv, FS_IV_SIZE);
+        src += n;
+        pos += n;
     }
 
-    struct AES_ctx ctx;
-    uint128_t iv = entry.cipher_iv + offset / BLOCK_SIZE;
-    AES_init_ctx_iv(&ctx, entry.cipher_key, (uint8_t *) &iv);
-    
-    // Handle partial block
-    if (offset % BLOCK_SIZE != 0) {
-        log_printf("fs_write / writing partial block at block index %u\n", offset / BLOCK_SIZE);
-        r = encrypt_block(fsdesc, entry.start_block + offset / BLOCK_SIZE, &ctx, partial_block);
+    uint32_t written = MIN(need, entry.block_count);
+    if (written > first) {
+        r = mark_written(fsdesc, entry.start_block + first, written - first);
         if (r < 0) return r;
     }
 
-    // Handle the rest of the blocks
-    if (new_block) {
-        int final_blocks_index = entry.start_block + SIZE_TO_BLOCK(offset);
-        uintptr_t final_blocks_addr = fsdesc->data_offset + final_blocks_index * BLOCK_SIZE;
-        
-        log_printf("fs_write / writing %u full blocks starting at index %d\n", 
-                  new_block, final_blocks_index);
+    entry.size = MAX(entry.size, end);
+    r = write_inode(fsdesc, ino, &entry);
+    if (r < 0) return r;
 
-        for (uint32_t i = 0; i < new_block; i++) {
-            encrypt_block(fsdesc, final_blocks_index + i, &ctx, buf);
-            buf += BLOCK_SIZE;
-        }
+    return size;
+}
+
+// A copy of a whole file into an empty file makes it a clone: the two
+// files share the source's blocks, and its key. Each block's entry in the
+// available block table counts its references, and the first write to
+// either file gives it a private copy (see unshare_blocks).
+static int clone_blocks(fs_descriptor *fsdesc, fs_ino src_ino, fs_ino dst_ino) {
+    fs_delalloc *slot = delalloc_find(fsdesc, src_ino);
+    if (slot) {
+        int r = delalloc_flush(fsdesc, slot);
+        slot->ino = 0;
+        if (r < 0) return r;
+    }
+
+    fs_inode_entry src, dst;
+    int r = read_inode(fsdesc, src_ino, &src);
+    if (r < 0) return r;
+    r = read_inode(fsdesc, dst_ino, &dst);
+    if (r < 0) return r;
+
+    uint32_t used = SIZE_TO_BLOCK(src.size);
+    r = block_refs_full(fsdesc, src.start_block, used);
+    if (r != 0) return r < 0 ? r : 0;
+
+    r = journal_reserve(fsdesc, TABLE_SPAN(used) + TABLE_SPAN(dst.block_count) + INODE_RECORD_SPAN);
+    if (r < 0) return r;
+
+    r = add_block_refs(fsdesc, src.start_block, used, 1);
+    if (r < 0) return r;
+
+    r = block_unref(fsdesc, dst.start_block, dst.block_count);
+    if (r < 0) return r;
+
+    dst.size = src.size;
+    dst.start_block = src.start_block;
+    dst.block_count = used;
+    memcpy(dst.cipher_key, src.cipher_key, FS_KEY_SIZE);
+    dst.cipher_iv = src.cipher_iv;
+    r = write_inode(fsdesc, dst_ino, &dst);
+    if (r < 0) return r;
+
+    return 1;
+}
+
+static uint8_t copy_buffer[BLOCK_SIZE];
+
+ssize_t fs_copy_range(fs_descriptor *fsdesc, fs_ino src_ino, uint64_t src_offset,
+                      fs_ino dst_ino, uint64_t dst_offset, size_t size) {
+    log_printf("fs_copy_range / %d -> %d, size: %zu\n", src_ino, dst_ino, size);
+
+    if (size > FS_IO_MAX_SIZE)
+        return -EINVAL;
+
+    fs_inode_entry src, dst;
+    int64_t r = read_inode(fsdesc, src_ino, &src);
+    if (r < 0) return r;
+    r = read_inode(fsdesc, dst_ino, &dst);
+    if (r < 0) return r;
+
+    if (dst.size < dst_offset)
+        return -EINVAL;
+    if (src_offset >= src.size || size == 0)
+        return 0;
+    if (size > src.size - src_offset)
+        size = src.size - src_offset;
+
+    if (src_ino == dst_ino && src_offset < dst_offset + size && dst_offset < src_offset + size)
+        return -EINVAL;
 
-        entry.block_count = total_block;
+    if (src_ino != dst_ino && src_offset == 0 && dst_offset == 0 && size == src.size
+        && dst.size == 0) {
+        r = clone_blocks(fsdesc, src_ino, dst_ino);
+        if (r != 0) return r < 0 ? r : (ssize_t) size;
     }
 
-    entry.size = offset + size;
-    log_printf("fs_write / updating inode entry, new size: %llu, block_count: %u\n", 
-               entry.size, entry.block_count);
-               
-    r = fsdesc->fsdw((uintptr_t) &entry, entry_addr, INODE_ENTRY_SIZE);
+    // Otherwise the data is decrypted and encrypted again block by block,
+    // as fs_read and fs_write would, but with each file's key expanded once
+    // and without the round trip through a user buffer.
+    r = unshare_blocks(fsdesc, dst_ino, &dst);
     if (r < 0) return r;
 
-    if (aba == 0) {
-        log_printf("fs_write / marking %u blocks as used\n", total_block - new_block);
-        for (uint32_t i = 0; i < total_block - new_block; i++) {
-            r = set_availability(fsdesc, entry.start_block + i, &ZERO);
+    uint64_t end = dst_offset + size;
+    fs_delalloc *slot = delalloc_find(fsdesc, dst_ino);
+    if (slot) {
+        r = delalloc_flush(fsdesc, slot);
+        slot->ino = 0;
+        if (r < 0) return r;
+        r = read_inode(fsdesc, dst_ino, &dst);
+        if (r < 0) return r;
+    }
+    r = ensure_blocks(fsdesc, dst_ino, &dst, SIZE_TO_BLOCK(end));
+    if (r < 0) return r;
+
+    uint32_t first = dst_offset / BLOCK_SIZE;
+    r = journal_reserve(fsdesc, TABLE_SPAN(SIZE_TO_BLOCK(end) - first) + INODE_RECORD_SPAN);
+    if (r < 0) return r;
+
+    // Allocating may have moved the source, or flushed its delayed block.
+    r = read_inode(fsdesc, src_ino, &src);
+    if (r < 0) return r;
+
+    struct AES_ctx src_ctx, dst_ctx;
+    AES_init_ctx(&src_ctx, src.cipher_key);
+    AES_init_ctx(&dst_ctx, dst.cipher_key);
+
+    int64_t src_cached = -1;
+    uint64_t pos = dst_offset;
+    while (pos < end) {
+        uint32_t block_idx = pos / BLOCK_SIZE;
+        size_t block_offset = pos % BLOCK_SIZE;
+        size_t n = MIN((uint64_t) BLOCK_SIZE - block_offset, end - pos);
+
+        if (n < BLOCK_SIZE) {
+            set_block_iv(&dst_ctx, &dst, block_idx);
+            r = decrypt_block(fsdesc, dst.start_block + block_idx, &dst_ctx, block_buffer);
             if (r < 0) return r;
         }
+
+        // The range may straddle two source blocks.
+        for (size_t done = 0; done < n; ) {
+            uint64_t src_pos = src_offset + (pos - dst_offset) + done;
+            uint32_t src_idx = src_pos / BLOCK_SIZE;
+            if (src_idx != src_cached) {
+                if (src_idx < src.block_count) {
+                    set_block_iv(&src_ctx, &src, src_idx);
+                    r = decrypt_block(fsdesc, src.start_block + src_idx, &src_ctx, copy_buffer);
+                } else {
+                    r = read_file_block(fsdesc, src_ino, &src, src_idx, copy_buffer);
+                }
+                if (r < 0) return r;
+                src_cached = src_idx;
+            }
+
+            size_t m = MIN(n - done, (size_t) (BLOCK_SIZE - src_pos % BLOCK_SIZE));
+            memcpy(block_buffer + block_offset + done, copy_buffer + src_pos % BLOCK_SIZE, m);
+            done += m;
+        }
+
+        set_block_iv(&dst_ctx, &dst, block_idx);
+        r = encrypt_block(fsdesc, dst.start_block + block_idx, &dst_ctx, block_buffer);
+        if (r < 0) return r;
+
+        pos += n;
     }
-    
-    log_printf("fs_write / completed successfully, wrote %zu bytes\n", size);
+    r = mark_written(fsdesc, dst.start_block + first, SIZE_TO_BLOCK(end) - first);
+    if (r < 0) return r;
+
+    dst.size = MAX(dst.size, end);
+    r = write_inode(fsdesc, dst_ino, &dst);
+    if (r < 0) return r;
+
     return size;
 }
 
-// Returns a negative value on error. On success, returns the index of the found node and copies it to *dst_node.
-// src_node can be dst_node
-int64_t follow_node(fs_descriptor *fsdesc, fs_node_t* src_node, const char *edge, fs_node_t* dst_node) {
-    log_printf("follow_node / src_node->children_count : %d\n", src_node->children_count);
-    log_printf("follow_node / edge : %s\n", edge);
+// Dentry cache
+//
+//    Maps (parent node, name) to the child node and its value, so that
+//    path lookups do not reread every directory node on the way. Entries
+//    are only added for names that exist; fs_remove drops the entries of
+//    the removed node.
+
+static uint32_t dentry_hash(uint32_t parent, const char *name) {
+    uint32_t h = 2166136261U ^ parent;
+    for (; *name; name++) {
+        h ^= (uint8_t) *name;
+        h *= 16777619U;
+    }
+    return h % FS_DENTRY_CACHE_SIZE;
+}
+
+static fs_dentry *dentry_find(fs_descriptor *fsdesc, uint32_t parent, const char *name) {
+    fs_dentry *d = &fsdesc->dentry_cache[dentry_hash(parent, name)];
+    if (d->node && d->parent == parent && strcmp(d->name, name) == 0)
+        return d;
+    return NULL;
+}
+
+// Reads child node `index` of `parent` and caches its value.
+static int64_t dentry_fill(fs_descriptor *fsdesc, uint32_t parent, const char *name, uint32_t index) {
+    fs_node_t node;
+    int r = fs_meta_read(fsdesc, &node, fsdesc->tree_offset + index * NODE_SIZE, NODE_SIZE);
+    if (r < 0) return r;
+
+    fs_dentry *d = &fsdesc->dentry_cache[dentry_hash(parent, name)];
+    d->parent = parent;
+    d->node = index;
+    d->value = node.value;
+    strcpy(d->name, name);
+
+    return node.value;
+}
+
+static void dentry_invalidate(fs_descriptor *fsdesc, uint32_t node) {
+    for (int i = 0; i < FS_DENTRY_CACHE_SIZE; i++) {
+        fs_dentry *d = &fsdesc->dentry_cache[i];
+        if (d->node == node || d->parent == node)
+            d->node = 0;
+    }
+}
+
+// Returns the node index of child `name` of `parent` and stores its value
+// in *value.
+static int64_t lookup_child(fs_descriptor *fsdesc, uint32_t parent, const char *name, uint32_t *value) {
+    fs_dentry *d = dentry_find(fsdesc, parent, name);
+    if (d) {
+        *value = d->value;
+        return d->node;
+    }
 
+    fs_node_t node;
+    int64_t r = fs_meta_read(fsdesc, &node, fsdesc->tree_offset + parent * NODE_SIZE, NODE_SIZE);
+    if (r < 0) return r;
 
-    for (int i = 0; i < MAX_CHILDREN; i++) {
-        if (strcmp(src_node->children[i].name, edge) == 0) {
-            log_printf("follow_node / node name : %s\n", src_node->children[i].name);
-            log_printf("follow_node / node index : %d\n", src_node->children[i].index);
+    if (node.value)
+        return -ENOTDIR;
 
-            uint32_t node_index = src_node->children[i].index;
-            uintptr_t node_addr = fsdesc->tree_offset + node_index * NODE_SIZE;
+    for (int i = 0; i < node.children_count; i++) {
+        if (strcmp(node.children[i].name, name) == 0) {
+            uint32_t index = node.children[i].index;
 
-            int r = fsdesc->fsdr((uintptr_t) dst_node, node_addr, NODE_SIZE);
+            r = dentry_fill(fsdesc, parent, name, index);
             if (r < 0) return r;
 
-            return node_index;
+            *value = (uint32_t) r;
+            return index;
         }
     }
 
     return -ENOENT;
 }
 
-
-// Returns a negative value on error. On success, returns the index of the found node and copies it to *node.
-int64_t search_node(fs_descriptor *fsdesc, normpath path, fs_node_t *node) {
+// Returns a negative value on error. On success, returns the index of the
+// node at `path` and stores its value in *value.
+static int64_t lookup_path(fs_descriptor *fsdesc, normpath path, uint32_t *value) {
     assert(path.str[0] == '/');
 
-    log_printf("search_node / path : %.*s\n", (int)path.len, path.str);
-
-    int64_t r = fsdesc->fsdr((uintptr_t) node, fsdesc->tree_offset, NODE_SIZE);
-    if (r < 0) return r;
-
     uint32_t node_index = 0;
+    *value = 0;
 
     while (path.len > 0) {
         if (path.str[0] == '/') {
             path.str++;
             path.len--;
+            continue;
         }
         
         char name[NAME_SIZE];
@@ -446,7 +1234,7 @@ int64_t search_node(fs_descriptor *fsdesc, normpath path, fs_node_t *node) {
         
         name[i] = '\0';
 
-        r = follow_node(fsdesc, node, name, node);
+        int64_t r = lookup_child(fsdesc, node_index, name, value);
         if (r < 0) return r;
 
         node_index = (uint32_t) r;
@@ -455,42 +1243,103 @@ int64_t search_node(fs_descriptor *fsdesc, normpath path, fs_node_t *node) {
     return node_index;
 }
 
+// Returns a negative value on error. On success, returns the index of the found node and copies it to *node.
+int64_t search_node(fs_descriptor *fsdesc, normpath path, fs_node_t *node) {
+    log_printf("search_node / path : %.*s\n", (int)path.len, path.str);
+
+    uint32_t value;
+    int64_t r = lookup_path(fsdesc, path, &value);
+    if (r < 0) return r;
+    uint32_t node_index = (uint32_t) r;
+
+    r = fs_meta_read(fsdesc, node, fsdesc->tree_offset + node_index * NODE_SIZE, NODE_SIZE);
+    if (r < 0) return r;
+
+    return node_index;
+}
+
 int64_t fs_getattr(fs_descriptor *fsdesc, normpath path) {
-    fs_node_t node;
+    uint32_t value;
 
-    int64_t r = search_node(fsdesc, path, &node);
+    int64_t r = lookup_path(fsdesc, path, &value);
     if (r < 0) return r;
 
-    return node.value;
+    return value;
 }
 
-int fs_readdir_init(fs_descriptor *fsdesc, normpath path, fs_dirreader *dr) {
-    
-    fs_node_t node;
-    int64_t r = search_node(fsdesc, path, &node);
+int fs_fstat(fs_descriptor *fsdesc, fs_ino ino, struct stat *st) {
+    memset(st, 0, sizeof(*st));
+    st->st_ino = ino;
+
+    if (ino == 0) {
+        st->st_type = DT_DIR;
+        return 0;
+    }
+    if (ino >= fsdesc->metadata.inode_count)
+        return -EINVAL;
+
+    fs_inode_entry entry;
+    int r = read_inode(fsdesc, ino, &entry);
     if (r < 0) return r;
-    uint32_t node_index = (uint32_t) r;
 
-    
-    log_printf("fs_readdir_init / path.str(%d) : %.*s\n", (int)path.len, (int)path.len, path.str);
-    log_printf("fs_readdir_init / node : %d\n", node_index);
+    if (entry.ref == 0)
+        return -ENOENT;
+
+    st->st_type = DT_REG;
+    st->st_size = entry.size;
+    st->st_blocks = entry.block_count;
+    return 0;
+}
 
-    dr->fsdesc = fsdesc;
-    dr->node_index = node_index;
-    dr->offset = 0;
+int fs_stat(fs_descriptor *fsdesc, normpath path, struct stat *st) {
+    int64_t r = fs_getattr(fsdesc, path);
+    if (r < 0) return r;
 
-    return node.children_count;
+    return fs_fstat(fsdesc, (fs_ino) r, st);
 }
 
-int fs_readdir_next(fs_dirreader *dr, char *buffer) {
+// Fills `ents` with up to `count` entries of the directory at `path`,
+// starting with entry number `cookie`. The directory node is read once.
+int fs_getdents(fs_descriptor *fsdesc, normpath path, uint32_t cookie, dirent *ents, int count) {
     fs_node_t node;
-    int64_t r = dr->fsdesc->fsdr((uintptr_t) &node, dr->fsdesc->tree_offset + dr->node_index * NODE_SIZE, NODE_SIZE);
+    int64_t r = search_node(fsdesc, path, &node);
     if (r < 0) return r;
-    
-    strcpy(buffer, node.children[dr->offset].name);
-    dr->offset++;
+    uint32_t node_index = (uint32_t) r;
 
-    return 0;
+    if (node.value)
+        return -ENOTDIR;
+
+    int n = 0;
+    for (uint32_t i = cookie; n < count && i < (uint32_t) node.children_count; i++, n++) {
+        fd_node_child_t *child = &node.children[i];
+        dirent *ent = &ents[n];
+
+        memcpy(ent->d_name, child->name, NAME_SIZE);
+        ent->d_name[NAME_SIZE - 1] = '\0';
+
+        uint32_t value;
+        fs_dentry *d = dentry_find(fsdesc, node_index, ent->d_name);
+        if (d) {
+            value = d->value;
+        } else {
+            r = dentry_fill(fsdesc, node_index, ent->d_name, child->index);
+            if (r < 0) return r;
+            value = (uint32_t) r;
+        }
+
+        ent->d_node = child->index;
+        ent->d_type = value ? DT_REG : DT_DIR;
+        ent->d_size = 0;
+
+        if (value) {
+            fs_inode_entry entry;
+            r = read_inode(fsdesc, value, &entry);
+            if (r < 0) return r;
+            ent->d_size = entry.size;
+        }
+    }
+
+    return n;
 }
 
 
@@ -498,7 +1347,7 @@ int64_t search_available_node(fs_descriptor *fsdesc) {
     for (uint32_t i = 1; i < fsdesc->metadata.node_count; i++) { // 0 is root
         uint8_t used;
 
-        int r = fsdesc->fsdr((uintptr_t) &used, fsdesc->tree_usage_offset + i, 1);
+        int r = fs_meta_read(fsdesc, &used, fsdesc->tree_usage_offset + i, 1);
         if (r < 0) return r;
 
         if (used == 0)
@@ -538,17 +1387,23 @@ int fs_touch(fs_descriptor *fsdesc, string path, uint32_t value) {
     uint32_t child_node_index = (uint32_t) r;
 
     log_printf("fs_touch / child_node_index : %d\n", child_node_index);
+
+    r = journal_reserve(fsdesc, 2 * NODE_RECORD_SPAN + JOURNAL_RECORD_SPAN(1));
+    if (r < 0) return r;
     
     copy_to_buffer(node.children[node.children_count].name, child_name);
     node.children[node.children_count].index = child_node_index;
     node.children_count += 1;
-    fsdesc->fsdw((uintptr_t) &node, fsdesc->tree_offset + parent_node_index * NODE_SIZE, NODE_SIZE);
+    r = fs_meta_write(fsdesc, &node, fsdesc->tree_offset + parent_node_index * NODE_SIZE, NODE_SIZE);
+    if (r < 0) return r;
 
     
     memset(&node, 0, NODE_SIZE);
     node.value = value;
-    fsdesc->fsdw((uintptr_t) &ONE, fsdesc->tree_usage_offset + child_node_index, 1);
-    fsdesc->fsdw((uintptr_t) &node, fsdesc->tree_offset + child_node_index * NODE_SIZE, NODE_SIZE);
+    r = fs_meta_write(fsdesc, &ONE, fsdesc->tree_usage_offset + child_node_index, 1);
+    if (r < 0) return r;
+    r = fs_meta_write(fsdesc, &node, fsdesc->tree_offset + child_node_index * NODE_SIZE, NODE_SIZE);
+    if (r < 0) return r;
 
     return 0;
 }
@@ -577,7 +1432,8 @@ int fs_remove(fs_descriptor *fsdesc, normpath path) {
             assert(child_node_index);
 
             node.children_count -= 1;
-            memcpy(&node.children[i], &node.children[node.children_count-1], sizeof(fd_node_child_t));
+            memcpy(&node.children[i], &node.children[node.children_count], sizeof(fd_node_child_t));
+            memset(&node.children[node.children_count], 0, sizeof(fd_node_child_t));
             break;
         }
     }
@@ -585,21 +1441,37 @@ int fs_remove(fs_descriptor *fsdesc, normpath path) {
     if (!child_node_index)
         return -ENOENT;
 
-    r = fsdesc->fsdw((uintptr_t) &node, fsdesc->tree_offset + parent_node_index * NODE_SIZE, NODE_SIZE);
+    dentry_invalidate(fsdesc, child_node_index);
+
+    fs_node_t child;
+    r = fs_meta_read(fsdesc, &child, fsdesc->tree_offset + child_node_index * NODE_SIZE, NODE_SIZE);
     if (r < 0) return r;
 
-    r = fsdesc->fsdr((uintptr_t) &node, fsdesc->tree_offset + child_node_index * NODE_SIZE, NODE_SIZE);
+    // both nodes, the tree usage byte, and the inode and its blocks
+    size_t span = 2 * NODE_RECORD_SPAN + JOURNAL_RECORD_SPAN(1);
+    if (child.value) {
+        fs_inode_entry entry;
+        r = read_inode(fsdesc, child.value, &entry);
+        if (r < 0) return r;
+        span += INODE_RECORD_SPAN + TABLE_SPAN(entry.block_count);
+    }
+    r = journal_reserve(fsdesc, span);
     if (r < 0) return r;
 
-    if (node.value)
-        unref_inode(fsdesc, node.value);
+    r = fs_meta_write(fsdesc, &node, fsdesc->tree_offset + parent_node_index * NODE_SIZE, NODE_SIZE);
+    if (r < 0) return r;
+
+    if (child.value) {
+        r = unref_inode(fsdesc, child.value);
+        if (r < 0) return r;
+    }
 
     memset(&node, 0, NODE_SIZE);
 
-    r = fsdesc->fsdw((uintptr_t) &node, fsdesc->tree_offset + child_node_index * NODE_SIZE, NODE_SIZE);
+    r = fs_meta_write(fsdesc, &node, fsdesc->tree_offset + child_node_index * NODE_SIZE, NODE_SIZE);
     if (r < 0) return r;
 
-    r = fsdesc->fsdw((uintptr_t) &ZERO, fsdesc->tree_usage_offset + child_node_index, 1);
+    r = fs_meta_write(fsdesc, &ZERO, fsdesc->tree_usage_offset + child_node_index, 1);
     if (r < 0) return r;
 
     return 0;
@@ -1,25 +1,128 @@
 #ifndef __FILESYSTEM_H__
 #define __FILESYSTEM_H__
 
+// Host tools (build/fsck.c, build/mkfs.c) define FS_HOST_TOOL and use the
+// host C library. fsck only needs the on-disk layout; mkfs links against
+// the kernel's filesystem objects and calls the API below, so normpath
+// mirrors lib/string.h.
+#ifdef FS_HOST_TOOL
+#include <stdint.h>
+#include <stddef.h>
+#include <sys/types.h>
+typedef __uint128_t uint128_t;
+typedef struct {
+    const char *str;
+    size_t len;
+} string;
+typedef string normpath;
+#else
 #include "lib.h"
 #include "string.h"
+#endif
 
 #define FS_IO_MAX_SIZE INT64_MAX
 #define FS_KEY_SIZE 256
 #define FS_IV_SIZE 16
 
+// Write-ahead metadata journal: pending metadata writes are batched in
+// memory and committed to a dedicated on-disk region as one record.
+#define FS_JOURNAL_SIZE 8192
+#define FS_JOURNAL_MAGIC 0x4C4E524A /* "JRNL" */
+
+// Geometry used when fs_init finds an unformatted (all-zero) disk.
+// Sized so that build/mkfs can install the programs in /bin.
+#define FS_DEFAULT_INODE_COUNT 32
+#define FS_DEFAULT_BLOCK_COUNT 192
+#define FS_DEFAULT_NODE_COUNT 32
+
+// Allocation policy: delayed blocks kept in memory, and the most blocks
+// preallocated at once for a growing file.
+#define FS_DELALLOC_SLOTS 4
+#define FS_PREALLOC_MAX_BLOCKS 8
+
+// Attribute caches: inode entries and (directory, name) lookups.
+#define FS_INODE_CACHE_SIZE 16
+#define FS_DENTRY_CACHE_SIZE 32
+
+#define FS_BLOCK_SIZE 4096
+#define FS_NAME_SIZE 32
+#define FS_MAX_CHILDREN 32
+
 typedef unsigned int fs_ino;
 
 typedef int (*fs_disk_reader)(uintptr_t ptr, uint64_t start, size_t size);
 typedef int (*fs_disk_writer)(uintptr_t ptr, uint64_t start, size_t size);
 typedef void (*fs_random_generator)(uint8_t *buffer, size_t size);
 
+// On-disk layout, in order: metadata, inode table, block usage table,
+// available block table, tree usage table, tree nodes, journal, data
+// blocks (aligned to FS_BLOCK_SIZE). See fs_init.
+
 typedef struct fs_metadata {
     uint32_t inode_count; /* data index */
     uint32_t block_count;
     uint32_t node_count; /* fs tree nodes */
+    uint32_t relocation_count; /* files moved by copy_block */
+    uint64_t relocated_bytes;
 } fs_metadata;
 
+typedef struct fs_inode_entry {
+    uint8_t ref;
+    uint64_t size;
+    uint32_t start_block;
+    uint32_t block_count;
+    uint8_t cipher_key[FS_KEY_SIZE];
+    uint128_t cipher_iv;
+} fs_inode_entry;
+
+typedef struct fd_node_child {
+    char name[FS_NAME_SIZE];
+    uint32_t index;
+} fd_node_child_t;
+
+// A tree node is a directory if `value` is 0, otherwise a file whose data
+// is inode `value`. Node 0 is the root.
+typedef struct fs_node {
+    uint32_t value;
+    int children_count;
+    fd_node_child_t children[FS_MAX_CHILDREN];
+} fs_node_t;
+
+typedef struct fs_journal_header {
+    uint32_t magic;    /* FS_JOURNAL_MAGIC when a committed record is pending */
+    uint32_t sequence;
+    uint32_t length;   /* bytes of records following the header */
+    uint32_t checksum;
+} fs_journal_header;
+
+// Each journal record is followed by `size` bytes to write at `offset`.
+typedef struct fs_journal_record {
+    uint32_t offset;
+    uint32_t size;
+} fs_journal_record;
+
+#define FS_JOURNAL_CAPACITY (FS_JOURNAL_SIZE - sizeof(fs_journal_header))
+
+// The last block of a growing file, not yet given a disk block.
+typedef struct fs_delalloc {
+    fs_ino ino;         /* 0 if the slot is free */
+    uint32_t block;     /* index of the block in the file */
+    uint64_t size;      /* file size, including this block's data */
+    uint8_t data[FS_BLOCK_SIZE];
+} fs_delalloc;
+
+typedef struct fs_inode_cache {
+    fs_ino ino;         /* 0 if the entry is empty */
+    fs_inode_entry entry;
+} fs_inode_cache;
+
+typedef struct fs_dentry {
+    uint32_t parent;
+    uint32_t node;      /* 0 if the entry is empty */
+    uint32_t value;
+    char name[FS_NAME_SIZE];
+} fs_dentry;
+
 typedef struct fs_descriptor {
     fs_disk_reader fsdr;
     fs_disk_writer fsdw;
@@ -32,19 +135,42 @@ typedef struct fs_descriptor {
     uintptr_t block_usage_offset;
     uintptr_t tree_usage_offset;
     uintptr_t tree_offset;
+    uintptr_t journal_offset;
     uintptr_t data_offset;
+
+    uint32_t alloc_cursor; /* next-fit block allocation */
+    int delalloc_victim;
+    fs_delalloc delalloc[FS_DELALLOC_SLOTS];
+
+    fs_inode_cache inode_cache[FS_INODE_CACHE_SIZE];
+    fs_dentry dentry_cache[FS_DENTRY_CACHE_SIZE];
+
+    uint32_t journal_sequence;
+    size_t journal_length;
+    uint8_t journal_buffer[FS_JOURNAL_CAPACITY];
 } fs_descriptor;
 
+// Computes the region offsets from fsdesc->metadata.
+static inline void fs_layout(fs_descriptor *fsdesc) {
+    const fs_metadata *m = &fsdesc->metadata;
+    fsdesc->inode_table_offset = sizeof(fs_metadata);
+    fsdesc->block_usage_offset = fsdesc->inode_table_offset + m->inode_count * sizeof(fs_inode_entry);
+    fsdesc->avail_block_table_offset = fsdesc->block_usage_offset + m->block_count;
+    fsdesc->tree_usage_offset = fsdesc->avail_block_table_offset + m->block_count;
+    fsdesc->tree_offset = fsdesc->tree_usage_offset + m->node_count;
+    fsdesc->journal_offset = fsdesc->tree_offset + m->node_count * sizeof(fs_node_t);
+    fsdesc->data_offset = (fsdesc->journal_offset + FS_JOURNAL_SIZE + FS_BLOCK_SIZE - 1)
+        / FS_BLOCK_SIZE * FS_BLOCK_SIZE;
+}
 
-typedef struct {
-    fs_descriptor *fsdesc;
-    uint32_t node_index;
-    int offset;
-} fs_dirreader;
- 
 
 int fs_init(fs_descriptor *fsdesc, fs_disk_reader fsdr, fs_disk_writer fsdw, fs_random_generator fsrng);
 
+// Allocates and writes the delayed blocks, then writes every pending
+// metadata update to the journal as a single commit record and
+// checkpoints it to its home location. Called periodically by the kernel.
+int fs_commit(fs_descriptor *fsdesc);
+
 // return value is negative if an error occured
 // return value is 0 is it is a directory
 // return value is positive if it is a file, the value is the inode of the data
@@ -56,8 +182,13 @@ ssize_t fs_read(fs_descriptor *fsdesc, fs_ino ino, void *buf, size_t size, uint6
 
 ssize_t fs_write(fs_descriptor *fsdesc, fs_ino ino, const void *buf, size_t size, uint64_t offset);
 
-int fs_readdir_init(fs_descriptor *fsdesc, normpath path, fs_dirreader *dr);
-int fs_readdir_next(fs_dirreader *dr, char *buffer);
+// Copies `size` bytes at `src_offset` in file `src_ino` to `dst_offset`
+// in file `dst_ino` without going through a caller's buffer. A copy of a
+// whole file into an empty one shares the source's blocks until either
+// file is written. Returns the number of bytes copied, which is short at
+// the end of the source.
+ssize_t fs_copy_range(fs_descriptor *fsdesc, fs_ino src_ino, uint64_t src_offset,
+                      fs_ino dst_ino, uint64_t dst_offset, size_t size);
 
 int fs_touch(fs_descriptor *fsdesc, normpath parent, uint32_t value);
 
@@ -67,4 +198,13 @@ int64_t fs_alloc_inode(fs_descriptor *fsdesc);
 
 int fs_remove(fs_descriptor *fsdesc, normpath path);
 
+#ifndef FS_HOST_TOOL
+
+int fs_stat(fs_descriptor *fsdesc, normpath path, struct stat *st);
+int fs_fstat(fs_descriptor *fsdesc, fs_ino ino, struct stat *st);
+
+int fs_getdents(fs_descriptor *fsdesc, normpath path, uint32_t cookie, dirent *ents, int count);
+
+#endif /* FS_HOST_TOOL */
+
 #endif
@@ -3,10 +3,15 @@
 
 #define ENOENT 2
 #define EIO 5
+#define ENOEXEC 8
+#define EAGAIN 11
+#define ENOMEM 12
+#define EFAULT 14
 #define EEXIST 17
 #define ENOTDIR 20
 #define EINVAL 22
 #define ENOSPC 28
 #define ENAMETOOLONG 36
+#define ENOSYS 38
 
 #endif
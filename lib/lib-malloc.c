@@ -1,8 +1,9 @@
 #include "lib.h"
 #include "process.h"
 
-static uint8_t* heap_top = (uint8_t*) 0x200000;
-static uint8_t* page_top = (uint8_t*) 0x200000;
+// The heap starts 1MB above the program image (PROC_START_ADDR)
+static uint8_t* heap_top = (uint8_t*) 0x300000;
+static uint8_t* page_top = (uint8_t*) 0x300000;
 
 void* malloc(size_t size) {
     while (ROUNDDOWN(heap_top + size, PAGESIZE) >= page_top) {
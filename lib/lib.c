@@ -2,7 +2,7 @@
 #include "x86-64.h"
 
 #if !WEENSYOS_KERNEL          /* user‑process build only */
-#include "process.h"          /* brings in inline sys_getpid()      */
+#include "process.h"          /* brings in inline vdso()            */
 #endif
 
 // lib.c
@@ -12,10 +12,38 @@
 
 // memcpy, memmove, memset, strcmp, strlen, strnlen
 //    We must provide our own implementations.
+//
+//    memcpy, memmove and memset move 8-byte words with `rep movsq` and
+//    `rep stosq` once the destination is aligned. Below MEMOP_WORD_MIN
+//    bytes the string instructions' startup cost dominates, so short
+//    operations use an unrolled word loop and then bytes. These rely on
+//    the direction flag being clear, which k-exception.S ensures on every
+//    kernel entry.
+
+#define MEMOP_WORD_MIN 64
+
+// an unaligned word that may alias any object
+typedef uint64_t __attribute__((may_alias, aligned(1))) memop_word;
 
 void* memcpy(void* dst, const void* src, size_t n) {
+    char* d = (char*) dst;
     const char* s = (const char*) src;
-    for (char* d = (char*) dst; n > 0; --n, ++s, ++d) {
+    if (n >= MEMOP_WORD_MIN) {
+        size_t head = -(uintptr_t) d & 7;
+        size_t words = (n - head) / 8;
+        n = (n - head) % 8;
+        asm volatile("rep movsb" : "+D" (d), "+S" (s), "+c" (head)
+                     : : "memory");
+        asm volatile("rep movsq" : "+D" (d), "+S" (s), "+c" (words)
+                     : : "memory");
+    }
+    for (; n >= 16; n -= 16, s += 16, d += 16) {
+        memop_word a = ((const memop_word*) s)[0];
+        memop_word b = ((const memop_word*) s)[1];
+        ((memop_word*) d)[0] = a;
+        ((memop_word*) d)[1] = b;
+    }
+    for (; n > 0; --n, ++s, ++d) {
         *d = *s;
     }
     return dst;
@@ -24,21 +52,40 @@ void* memcpy(void* dst, const void* src, size_t n) {
 void* memmove(void* dst, const void* src, size_t n) {
     const char* s = (const char*) src;
     char* d = (char*) dst;
-    if (s < d && s + n > d) {
-        s += n, d += n;
-        while (n-- > 0) {
-            *--d = *--s;
-        }
-    } else {
-        while (n-- > 0) {
-            *d++ = *s++;
-        }
+    if (!(s < d && s + n > d)) {
+        // a forward copy never overwrites source bytes it has yet to read
+        return memcpy(dst, src, n);
     }
+
+    // copy backwards: the tail bytes, then words down to the start
+    size_t words = n / 8;
+    size_t tail = n % 8;
+    s += n - 1, d += n - 1;
+    asm volatile("std; rep movsb; cld" : "+D" (d), "+S" (s), "+c" (tail)
+                 : : "memory", "cc");
+    s -= 7, d -= 7;
+    asm volatile("std; rep movsq; cld" : "+D" (d), "+S" (s), "+c" (words)
+                 : : "memory", "cc");
     return dst;
 }
 
 void* memset(void* v, int c, size_t n) {
-    for (char* p = (char*) v; n > 0; ++p, --n) {
+    char* p = (char*) v;
+    uint64_t word = (uint8_t) c * 0x0101010101010101UL;
+    if (n >= MEMOP_WORD_MIN) {
+        size_t head = -(uintptr_t) p & 7;
+        size_t words = (n - head) / 8;
+        n = (n - head) % 8;
+        asm volatile("rep stosb" : "+D" (p), "+c" (head) : "a" (word)
+                     : "memory");
+        asm volatile("rep stosq" : "+D" (p), "+c" (words) : "a" (word)
+                     : "memory");
+    }
+    for (; n >= 16; n -= 16, p += 16) {
+        ((memop_word*) p)[0] = word;
+        ((memop_word*) p)[1] = word;
+    }
+    for (; n > 0; ++p, --n) {
         *p = c;
     }
     return v;
@@ -116,11 +163,8 @@ int rand(void) {
         extern unsigned get_entropy_value(void);
         srand(get_entropy_value());
 #else           // user‑space build
-       unsigned seed = sys_getrandom();     /* 128‑bit kernel entropy */
-       if (!seed) {                         /* fallback if syscall fails */
-           seed = (unsigned) read_cycle_counter() ^ ((unsigned) sys_getpid() << 16);
-       }
-       srand(seed);
+       /* kernel-refreshed seed from the kernel data page: no system call */
+       srand((unsigned) (vdso()->seed[0] ^ read_cycle_counter()));
 #endif
     }
     rand_seed = rand_seed * 1664525U + 1013904223U;   // LCG
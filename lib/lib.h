@@ -109,6 +109,7 @@ void panic(const char* format, ...) __attribute__((noinline, noreturn));
 #define INT_SYS_CHDIR           SYSCALL(18) // 80
 #define INT_SYS_MKDIR           SYSCALL(19) // 83
 #define INT_SYS_GETRANDOM       SYSCALL(20)
+#define INT_SYS_SPAWN           SYSCALL(21)
 
 
 #define INT_SYS_HELLO           SYSCALL(6)
@@ -118,9 +119,119 @@ void panic(const char* format, ...) __attribute__((noinline, noreturn));
 #define INT_SYS_KEYBORD         SYSCALL(9)
 #define INT_SYS_PAGE_ALLOC      SYSCALL(10)
 
-#define INT_SYS_LISTDIR         SYSCALL(21)
 #define INT_SYS_TOUCH           SYSCALL(22)
 #define INT_SYS_REMOVE          SYSCALL(23)
+#define INT_SYS_GETDENTS        SYSCALL(24)
+#define INT_SYS_IORING_SETUP    SYSCALL(25)
+#define INT_SYS_IORING_ENTER    SYSCALL(26)
+#define INT_SYS_PREAD           SYSCALL(27)
+#define INT_SYS_PWRITE          SYSCALL(28)
+#define INT_SYS_READV           SYSCALL(29)
+#define INT_SYS_WRITEV          SYSCALL(30)
+#define INT_SYS_COPY_FILE_RANGE SYSCALL(31)
+#define INT_SYS_MMAP            SYSCALL(32)
+#define INT_SYS_MUNMAP          SYSCALL(33)
+#define INT_SYS_MSYNC           SYSCALL(34)
+
+
+// Directory entries, as returned by sys_getdents
+
+#define DIRENT_NAME_SIZE 32
+
+#define DT_DIR 1
+#define DT_REG 2
+
+typedef struct dirent {
+    char d_name[DIRENT_NAME_SIZE];      // NUL-terminated
+    uint32_t d_node;                    // filesystem tree node
+    uint32_t d_type;                    // DT_DIR or DT_REG
+    uint64_t d_size;                    // size in bytes of a regular file
+} dirent;
+
+
+// File attributes, as returned by sys_stat and sys_fstat
+
+struct stat {
+    uint32_t st_ino;                    // inode, 0 for a directory
+    uint32_t st_type;                   // DT_DIR or DT_REG
+    uint32_t st_blocks;                 // allocated 4096-byte blocks
+    uint64_t st_size;                   // size in bytes
+};
+
+
+
+// Buffers for sys_readv and sys_writev
+
+#define IOV_MAX 16
+
+typedef struct iovec {
+    void* iov_base;
+    size_t iov_len;
+} iovec;
+
+
+// Protection for sys_mmap
+
+#define PROT_READ  1
+#define PROT_WRITE 2
+
+
+// Kernel data page, mapped read-only at VDSO_ADDR in every process (next
+// to the argument page) and kept up to date by the kernel, so reading it
+// needs no system call. See getpid() and friends in process.h.
+
+#define VDSO_ADDR 0x241000
+
+typedef struct vdso_data {
+    pid_t pid;
+    uint32_t ticks;                     // timer interrupts since boot
+    uint32_t hz;                        // timer interrupts per second
+    uint64_t tsc_hz;                    // cycle counter frequency, 0 until
+                                        // measured (about 1s after boot)
+    uint64_t seed[2];                   // random, refreshed by the kernel
+} vdso_data;
+
+
+// I/O ring, shared by a process and the kernel (sys_ioring_setup): the
+// process fills submission entries at `sq_tail`, the kernel consumes them
+// from `sq_head` on sys_ioring_enter and posts a completion for each at
+// `cq_tail`, which the process consumes from `cq_head`. The counters only
+// grow; entry `i` is at index `i % IORING_ENTRIES`.
+//
+// IORING_ADDR is the page reserved for it, after the kernel data page and
+// below the malloc heap.
+
+#define IORING_ENTRIES 64
+#define IORING_ADDR 0x242000
+
+#define IORING_OP_OPEN  1               // addr: path
+#define IORING_OP_READ  2               // fd, addr: buffer, len
+#define IORING_OP_WRITE 3               // fd, addr: buffer, len
+#define IORING_OP_STAT  4               // addr: path, arg: struct stat*
+#define IORING_OP_FSTAT 5               // fd, arg: struct stat*
+
+typedef struct io_sqe {
+    uint32_t op;                        // IORING_OP_*
+    int32_t fd;
+    uint64_t addr;
+    uint64_t len;
+    uint64_t arg;
+    uint64_t user_data;                 // copied to the completion
+} io_sqe;
+
+typedef struct io_cqe {
+    uint64_t user_data;
+    int64_t res;                        // the request's result or -error
+} io_cqe;
+
+typedef struct io_ring {
+    uint32_t sq_head;                   // advanced by the kernel
+    uint32_t sq_tail;                   // advanced by the process
+    uint32_t cq_head;                   // advanced by the process
+    uint32_t cq_tail;                   // advanced by the kernel
+    io_sqe sq[IORING_ENTRIES];
+    io_cqe cq[IORING_ENTRIES];
+} io_ring;
 
 
 
@@ -47,7 +47,7 @@ void panic(const char* format, ...) {
 
 
 int raise(int sig) {
-    return sys_kill(sys_getpid(), sig);
+    return sys_kill(getpid(), sig);
 }
 
 void __attribute((noreturn)) abort(void) {
@@ -140,6 +140,18 @@ void app_print_error(int r) {
         case EIO:
             app_printf(1, "Error: %s\n", "I/O error");
             break;
+        case ENOEXEC:
+            app_printf(1, "Error: %s\n", "Exec format error");
+            break;
+        case EAGAIN:
+            app_printf(1, "Error: %s\n", "Resource temporarily unavailable");
+            break;
+        case ENOMEM:
+            app_printf(1, "Error: %s\n", "Out of memory");
+            break;
+        case EFAULT:
+            app_printf(1, "Error: %s\n", "Bad address");
+            break;
         case ENOTDIR:
             app_printf(1, "Error: %s\n", "Not a directory");
             break;
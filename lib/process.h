@@ -12,20 +12,36 @@
 
 
 // SYSTEM CALLS
+//
+//    System calls use the `syscall` instruction: %rax holds the INT_SYS_*
+//    number, the arguments are in %rdi, %rsi, %rdx and %r10, and the result
+//    comes back in %rax. The processor clobbers %rcx and %r11.
 
 static inline int sys_chdir(const char *path) {
     int result;
-    asm volatile ("int %1" : "=a" (result)
-                  : "i" (INT_SYS_CHDIR), "D" /* %rdi */ (path)
-                  : "cc", "memory");
+    asm volatile ("syscall" : "=a" (result)
+                  : "a" (INT_SYS_CHDIR), "D" /* %rdi */ (path)
+                  : "rcx", "r11", "cc", "memory");
     return result;
 }
 
 static inline int sys_execv(char* path, char* argv[]) {
     int result;
-    asm volatile ("int %1" : "=a" (result)
-                  : "i" (INT_SYS_EXECV), "D" /* %rdi */ (path), "S" /* %rsi */ (argv)
-                  : "cc", "memory");
+    asm volatile ("syscall" : "=a" (result)
+                  : "a" (INT_SYS_EXECV), "D" /* %rdi */ (path), "S" /* %rsi */ (argv)
+                  : "rcx", "r11", "cc", "memory");
+    return result;
+}
+
+// sys_spawn(path, argv)
+//    Start program `path` with arguments `argv` in a new child process.
+//    Returns the child's process ID, 0 if `path` was a kernel builtin
+//    (run without a child), or a negative error code.
+static inline pid_t sys_spawn(char* path, char* argv[]) {
+    pid_t result;
+    asm volatile ("syscall" : "=a" (result)
+                  : "a" (INT_SYS_SPAWN), "D" /* %rdi */ (path), "S" /* %rsi */ (argv)
+                  : "rcx", "r11", "cc", "memory");
     return result;
 }
 
@@ -33,111 +49,231 @@ static inline int sys_execv(char* path, char* argv[]) {
 //    Return current process ID.
 static inline pid_t sys_getpid(void) {
     pid_t result;
-    asm volatile ("int %1" : "=a" (result)
-                  : "i" (INT_SYS_GETPID)
-                  : "cc", "memory");
+    asm volatile ("syscall" : "=a" (result)
+                  : "a" (INT_SYS_GETPID)
+                  : "rcx", "r11", "cc", "memory");
     return result;
 }
 
 static inline void sys_hello(void) {
-    asm volatile ("int %0" :
-                  : "i" (INT_SYS_HELLO)
-                  : "cc", "memory");
+    uint64_t rax;
+    asm volatile ("syscall" : "=a" (rax)
+                  : "a" (INT_SYS_HELLO)
+                  : "rcx", "r11", "cc", "memory");
 }
 
 static inline int sys_open(const char *pathname) {
     int result;
-    asm volatile ("int %1" : "=a" (result)
-                  : "i" (INT_SYS_OPEN), "D" (pathname)
-                  : "cc", "memory");
+    asm volatile ("syscall" : "=a" (result)
+                  : "a" (INT_SYS_OPEN), "D" (pathname)
+                  : "rcx", "r11", "cc", "memory");
     return result;
 }
 
 static inline int sys_remove(const char *pathname) {
     int result;
-    asm volatile ("int %1" : "=a" (result)
-                  : "i" (INT_SYS_REMOVE), "D" (pathname)
-                  : "cc", "memory");
+    asm volatile ("syscall" : "=a" (result)
+                  : "a" (INT_SYS_REMOVE), "D" (pathname)
+                  : "rcx", "r11", "cc", "memory");
     return result;
 }
 
 static inline int sys_keybord(void) {
     int result;
-    asm volatile ("int %1" : "=a" (result)
-                  : "i" (INT_SYS_KEYBORD)
-                  : "cc", "memory");
+    asm volatile ("syscall" : "=a" (result)
+                  : "a" (INT_SYS_KEYBORD)
+                  : "rcx", "r11", "cc", "memory");
     return result;
 }
 
 static inline int sys_kill(pid_t pid, int sig) {
     int result;
-    asm volatile ("int %1" : "=a" (result)
-                  : "i" (INT_SYS_KILL), "D" (pid), "S" (sig)
-                  : "cc", "memory");
+    asm volatile ("syscall" : "=a" (result)
+                  : "a" (INT_SYS_KILL), "D" (pid), "S" (sig)
+                  : "rcx", "r11", "cc", "memory");
     return result;
 }
 
 static inline ssize_t sys_read(int fd, void *buf, size_t count) {
     ssize_t result;
-    asm volatile ("int %1" : "=a" (result)
-                  : "i" (INT_SYS_READ), "D" /* %rdi */ (fd), "S" /* %rsi */ (buf), "d" /* %rdx */ (count)
-                  : "cc", "memory");
+    asm volatile ("syscall" : "=a" (result)
+                  : "a" (INT_SYS_READ), "D" /* %rdi */ (fd), "S" /* %rsi */ (buf), "d" /* %rdx */ (count)
+                  : "rcx", "r11", "cc", "memory");
     return result;
 }
 
 static inline ssize_t sys_write(int fd, const void *buf, size_t count) {
     ssize_t result;
-    asm volatile ("int %1" : "=a" (result)
-                  : "i" (INT_SYS_WRITE), "D" /* %rdi */ (fd), "S" /* %rsi */ (buf), "d" /* %rdx */ (count)
-                  : "cc", "memory");
+    asm volatile ("syscall" : "=a" (result)
+                  : "a" (INT_SYS_WRITE), "D" /* %rdi */ (fd), "S" /* %rsi */ (buf), "d" /* %rdx */ (count)
+                  : "rcx", "r11", "cc", "memory");
+    return result;
+}
+
+// sys_pread(fd, buf, count, offset), sys_pwrite(fd, buf, count, offset)
+//    Like sys_read and sys_write, but at file offset `offset`; the file's
+//    own offset is neither used nor changed.
+static inline ssize_t sys_pread(int fd, void *buf, size_t count, off_t offset) {
+    ssize_t result;
+    register uint64_t r10 asm("r10") = offset;
+    asm volatile ("syscall" : "=a" (result)
+                  : "a" (INT_SYS_PREAD), "D" /* %rdi */ (fd), "S" /* %rsi */ (buf),
+                    "d" /* %rdx */ (count), "r" /* %r10 */ (r10)
+                  : "rcx", "r11", "cc", "memory");
+    return result;
+}
+
+static inline ssize_t sys_pwrite(int fd, const void *buf, size_t count, off_t offset) {
+    ssize_t result;
+    register uint64_t r10 asm("r10") = offset;
+    asm volatile ("syscall" : "=a" (result)
+                  : "a" (INT_SYS_PWRITE), "D" /* %rdi */ (fd), "S" /* %rsi */ (buf),
+                    "d" /* %rdx */ (count), "r" /* %r10 */ (r10)
+                  : "rcx", "r11", "cc", "memory");
+    return result;
+}
+
+// sys_readv(fd, iov, iovcnt), sys_writev(fd, iov, iovcnt)
+//    Like sys_read and sys_write over the `iovcnt` (at most IOV_MAX)
+//    buffers of `iov`, in order, with one system call.
+static inline ssize_t sys_readv(int fd, const iovec *iov, int iovcnt) {
+    ssize_t result;
+    asm volatile ("syscall" : "=a" (result)
+                  : "a" (INT_SYS_READV), "D" /* %rdi */ (fd), "S" /* %rsi */ (iov), "d" /* %rdx */ (iovcnt)
+                  : "rcx", "r11", "cc", "memory");
+    return result;
+}
+
+static inline ssize_t sys_writev(int fd, const iovec *iov, int iovcnt) {
+    ssize_t result;
+    asm volatile ("syscall" : "=a" (result)
+                  : "a" (INT_SYS_WRITEV), "D" /* %rdi */ (fd), "S" /* %rsi */ (iov), "d" /* %rdx */ (iovcnt)
+                  : "rcx", "r11", "cc", "memory");
+    return result;
+}
+
+// sys_copy_file_range(fd_in, fd_out, count)
+//    Copies up to `count` bytes from open file `fd_in` to open file
+//    `fd_out`, each at its file offset, which advances, without the data
+//    passing through the process. Returns the number of bytes copied.
+static inline ssize_t sys_copy_file_range(int fd_in, int fd_out, size_t count) {
+    ssize_t result;
+    asm volatile ("syscall" : "=a" (result)
+                  : "a" (INT_SYS_COPY_FILE_RANGE), "D" /* %rdi */ (fd_in), "S" /* %rsi */ (fd_out),
+                    "d" /* %rdx */ (count)
+                  : "rcx", "r11", "cc", "memory");
+    return result;
+}
+
+// sys_mmap(addr, length, prot, fd)
+//    Maps the first `length` bytes of open file `fd` at page-aligned
+//    address `addr`, readable, and writable if `prot` has PROT_WRITE. The
+//    mapping is shared: writes reach the file at sys_msync, at sys_munmap
+//    or when the process exits, and every mapping of the file sees them.
+//    Writes to the file through a file descriptor show in the mapping.
+//    Returns 0 on success and a negative error code on failure.
+static inline int sys_mmap(void *addr, size_t length, int prot, int fd) {
+    int result;
+    register uint64_t r10 asm("r10") = fd;
+    asm volatile ("syscall" : "=a" (result)
+                  : "a" (INT_SYS_MMAP), "D" /* %rdi */ (addr), "S" /* %rsi */ (length),
+                    "d" /* %rdx */ (prot), "r" /* %r10 */ (r10)
+                  : "rcx", "r11", "cc", "memory");
+    return result;
+}
+
+// sys_munmap(addr, length)
+//    Writes back and removes the mapping made by sys_mmap(addr, length).
+static inline int sys_munmap(void *addr, size_t length) {
+    int result;
+    asm volatile ("syscall" : "=a" (result)
+                  : "a" (INT_SYS_MUNMAP), "D" /* %rdi */ (addr), "S" /* %rsi */ (length)
+                  : "rcx", "r11", "cc", "memory");
+    return result;
+}
+
+// sys_msync(addr, length)
+//    Writes the modified pages of the mappings in [addr, addr+length) back
+//    to their files.
+static inline int sys_msync(void *addr, size_t length) {
+    int result;
+    asm volatile ("syscall" : "=a" (result)
+                  : "a" (INT_SYS_MSYNC), "D" /* %rdi */ (addr), "S" /* %rsi */ (length)
+                  : "rcx", "r11", "cc", "memory");
     return result;
 }
 
 static inline int sys_mkdir(const char *path) {
     int result;
-    asm volatile ("int %1" : "=a" (result)
-                  : "i" (INT_SYS_MKDIR), "D" /* %rdi */ (path)
-                  : "cc", "memory");
+    asm volatile ("syscall" : "=a" (result)
+                  : "a" (INT_SYS_MKDIR), "D" /* %rdi */ (path)
+                  : "rcx", "r11", "cc", "memory");
     return result;
 }
 
 static inline int sys_touch(const char *path) {
     int result;
-    asm volatile ("int %1" : "=a" (result)
-                  : "i" (INT_SYS_TOUCH), "D" /* %rdi */ (path)
-                  : "cc", "memory");
+    asm volatile ("syscall" : "=a" (result)
+                  : "a" (INT_SYS_TOUCH), "D" /* %rdi */ (path)
+                  : "rcx", "r11", "cc", "memory");
+    return result;
+}
+
+// sys_stat(path, st), sys_fstat(fd, st)
+//    Store the attributes of file `path` (or open file `fd`) in `*st`.
+static inline int sys_stat(const char *path, struct stat *st) {
+    int result;
+    asm volatile ("syscall" : "=a" (result)
+                  : "a" (INT_SYS_STAT), "D" /* %rdi */ (path), "S" /* %rsi */ (st)
+                  : "rcx", "r11", "cc", "memory");
     return result;
 }
 
-static inline int sys_listdir(const char *path, char *buffer) {
+static inline int sys_fstat(int fd, struct stat *st) {
     int result;
-    asm volatile ("int %1" : "=a" (result)
-                  : "i" (INT_SYS_LISTDIR), "D" /* %rdi */ (path), "S" /* %rsi */ (buffer)
-                  : "cc", "memory");
+    asm volatile ("syscall" : "=a" (result)
+                  : "a" (INT_SYS_FSTAT), "D" /* %rdi */ (fd), "S" /* %rsi */ (st)
+                  : "rcx", "r11", "cc", "memory");
+    return result;
+}
+
+// sys_getdents(path, ents, len, cookie)
+//    Read the entries of directory `path`, starting with entry number
+//    `cookie`, into `ents`, which is `len` bytes long. Returns the number
+//    of entries read (0 at the end of the directory), or a negative error
+//    (-EINVAL if `len` cannot hold one entry).
+//    The next call should pass `cookie` plus the number of entries read.
+static inline int sys_getdents(const char *path, dirent *ents, size_t len, unsigned cookie) {
+    int result;
+    register uint64_t r10 asm("r10") = cookie;
+    asm volatile ("syscall" : "=a" (result)
+                  : "a" (INT_SYS_GETDENTS), "D" /* %rdi */ (path), "S" /* %rsi */ (ents),
+                    "d" /* %rdx */ (len), "r" /* %r10 */ (r10)
+                  : "rcx", "r11", "cc", "memory");
     return result;
 }
 
 static inline int sys_wait(pid_t pid, int* exit_code) {
     int result;
-    asm volatile ("int %1" : "=a" (result)
-                  : "i" (INT_SYS_WAIT), "D" /* %rdi */ (pid), "S" /* %rsi */ (exit_code)
-                  : "cc", "memory");
+    asm volatile ("syscall" : "=a" (result)
+                  : "a" (INT_SYS_WAIT), "D" /* %rdi */ (pid), "S" /* %rsi */ (exit_code)
+                  : "rcx", "r11", "cc", "memory");
     return result;
 }
 
 static inline int sys_forget(pid_t pid) {
     int result;
-    asm volatile ("int %1" : "=a" (result)
-                  : "i" (INT_SYS_FORGET), "D" /* %rdi */ (pid)
-                  : "cc", "memory");
+    asm volatile ("syscall" : "=a" (result)
+                  : "a" (INT_SYS_FORGET), "D" /* %rdi */ (pid)
+                  : "rcx", "r11", "cc", "memory");
     return result;
 }
 
 static inline int sys_getcwd(char* buffer, size_t size) {
     int result;
-    asm volatile ("int %1" : "=a" (result)
-                  : "i" (INT_SYS_GETCWD), "D" /* %rdi */ (buffer), "S" /* %rsi */ (size)
-                  : "cc", "memory");
+    asm volatile ("syscall" : "=a" (result)
+                  : "a" (INT_SYS_GETCWD), "D" /* %rdi */ (buffer), "S" /* %rsi */ (size)
+                  : "rcx", "r11", "cc", "memory");
     return result;
 }
 
@@ -145,17 +281,18 @@ static inline int sys_getcwd(char* buffer, size_t size) {
 //    Yield control of the CPU to the kernel. The kernel will pick another
 //    process to run, if possible.
 static inline void sys_yield(void) {
-    asm volatile ("int %0" : /* no result */
-                  : "i" (INT_SYS_SCHED_YIELD)
-                  : "cc", "memory");
+    uint64_t rax;
+    asm volatile ("syscall" : "=a" (rax)
+                  : "a" (INT_SYS_SCHED_YIELD)
+                  : "rcx", "r11", "cc", "memory");
 }
 
 /* Random from kernel*/
 static inline unsigned sys_getrandom(void) {
     uint64_t rax;
-    asm volatile ("int %1" : "=a"(rax)
-                  : "i"(INT_SYS_GETRANDOM)
-                  : "cc", "memory");
+    asm volatile ("syscall" : "=a" (rax)
+                  : "a" (INT_SYS_GETRANDOM)
+                  : "rcx", "r11", "cc", "memory");
     return (unsigned) rax;
 }
 
@@ -166,9 +303,32 @@ static inline unsigned sys_getrandom(void) {
 //    on failure.
 static inline int sys_page_alloc(void* addr) {
     int result;
-    asm volatile ("int %1" : "=a" (result)
-                  : "i" (INT_SYS_PAGE_ALLOC), "D" /* %rdi */ (addr)
-                  : "cc", "memory");
+    asm volatile ("syscall" : "=a" (result)
+                  : "a" (INT_SYS_PAGE_ALLOC), "D" /* %rdi */ (addr)
+                  : "rcx", "r11", "cc", "memory");
+    return result;
+}
+
+// sys_ioring_setup(addr)
+//    Map a new, empty I/O ring (see lib.h) at page-aligned address `addr`,
+//    usually IORING_ADDR, where nothing is mapped yet.
+//    Returns 0 on success and a negative error code on failure.
+static inline int sys_ioring_setup(io_ring* addr) {
+    int result;
+    asm volatile ("syscall" : "=a" (result)
+                  : "a" (INT_SYS_IORING_SETUP), "D" /* %rdi */ (addr)
+                  : "rcx", "r11", "cc", "memory");
+    return result;
+}
+
+// sys_ioring_enter()
+//    Run the requests queued in the I/O ring, while the completion ring has
+//    room. Returns the number of requests run.
+static inline int sys_ioring_enter(void) {
+    int result;
+    asm volatile ("syscall" : "=a" (result)
+                  : "a" (INT_SYS_IORING_ENTER)
+                  : "rcx", "r11", "cc", "memory");
     return result;
 }
 
@@ -177,9 +337,9 @@ static inline int sys_page_alloc(void* addr) {
 //    the parent, and return 0 to the child. On failure, return -1.
 static inline pid_t sys_fork(void) {
     pid_t result;
-    asm volatile ("int %1" : "=a" (result)
-                  : "i" (INT_SYS_FORK)
-                  : "cc", "memory");
+    asm volatile ("syscall" : "=a" (result)
+                  : "a" (INT_SYS_FORK)
+                  : "rcx", "r11", "cc", "memory");
     return result;
 }
 
@@ -187,22 +347,47 @@ static inline pid_t sys_fork(void) {
 //    Exit this process. Does not return.
 static inline void sys_exit(int exit_code) __attribute__((noreturn));
 static inline void sys_exit(int exit_code) {
-    asm volatile ("int %0" : /* no result */
-                  : "i" (INT_SYS_EXIT), "D" /* %rdi */ (exit_code)
-                  : "cc", "memory");
+    uint64_t rax;
+    asm volatile ("syscall" : "=a" (rax)
+                  : "a" (INT_SYS_EXIT), "D" /* %rdi */ (exit_code)
+                  : "rcx", "r11", "cc", "memory");
  spinloop: goto spinloop;       // should never get here
 }
 
 // sys_panic(msg)
 //    Panic.
 static inline pid_t __attribute__((noreturn)) sys_panic(const char* msg) {
-    asm volatile ("int %0" : /* no result */
-                  : "i" (INT_SYS_PANIC), "D" (msg)
-                  : "cc", "memory");
+    uint64_t rax;
+    asm volatile ("syscall" : "=a" (rax)
+                  : "a" (INT_SYS_PANIC), "D" (msg)
+                  : "rcx", "r11", "cc", "memory");
  loop: goto loop;
 }
 
 
+// KERNEL DATA PAGE
+//
+//    The kernel keeps a read-only vdso_data (see lib.h) up to date at
+//    VDSO_ADDR. Reading it is a plain memory load, not a system call.
+
+static inline const volatile vdso_data* vdso(void) {
+    return (const volatile vdso_data*) VDSO_ADDR;
+}
+
+// getpid()
+//    Return current process ID, like sys_getpid().
+static inline pid_t getpid(void) {
+    return vdso()->pid;
+}
+
+// getticks()
+//    Return the number of timer interrupts since boot; there are
+//    vdso()->hz per second.
+static inline unsigned getticks(void) {
+    return vdso()->ticks;
+}
+
+
 // OTHER HELPER FUNCTIONS
 
 // app_printf(format, ...)
@@ -158,6 +158,15 @@ DECLARE_X86_FUNCTION(void       cpuid(uint32_t info, uint32_t* eaxp,
                                       uint32_t* ebxp, uint32_t* ecxp,
                                       uint32_t* edxp));
 DECLARE_X86_FUNCTION(uint64_t   read_cycle_counter(void));
+DECLARE_X86_FUNCTION(uint64_t   rdmsr(uint32_t msr));
+DECLARE_X86_FUNCTION(void       wrmsr(uint32_t msr, uint64_t val));
+
+// Model-specific registers (useful for rdmsr() and wrmsr())
+#define MSR_IA32_EFER           0xC0000080      // Extended Feature Enable
+#define MSR_IA32_STAR           0xC0000081      // SYSCALL/SYSRET segments
+#define MSR_IA32_LSTAR          0xC0000082      // SYSCALL entry point
+#define MSR_IA32_FMASK          0xC0000084      // SYSCALL %rflags mask
+#define IA32_EFER_SCE           0x00000001      // SYSCALL Enable
 
 // %cr0 flag bits (useful for lcr0() and rcr0())
 #define CR0_PE                  0x00000001      // Protection Enable
@@ -172,6 +181,11 @@ DECLARE_X86_FUNCTION(uint64_t   read_cycle_counter(void));
 #define CR0_CD                  0x40000000      // Cache Disable
 #define CR0_PG                  0x80000000      // Paging
 
+// %cr3 and %cr4 bits
+#define CR3_NOFLUSH             0x8000000000000000UL // Keep PCID's TLB entries
+#define CR4_PCIDE               0x00020000      // Process-Context IDs Enable
+#define CPUID_1_ECX_PCID        0x00020000      // cpuid(1): PCIDs supported
+
 // eflags bits (useful for read_eflags() and write_eflags())
 #define EFLAGS_CF               0x00000001      // Carry Flag
 #define EFLAGS_PF               0x00000004      // Parity Flag
@@ -321,7 +335,7 @@ static inline void lcr4(uint64_t val) {
 
 static inline uint64_t rcr4(void) {
     uint64_t cr4;
-    asm volatile("movl %%cr4,%0" : "=r" (cr4));
+    asm volatile("movq %%cr4,%0" : "=r" (cr4));
     return cr4;
 }
 
@@ -383,9 +397,20 @@ static inline void cpuid(uint32_t info, uint32_t* eaxp, uint32_t* ebxp,
 }
 
 static inline uint64_t read_cycle_counter(void) {
-    uint64_t tsc;
-    asm volatile("rdtsc" : "=A" (tsc));
-    return tsc;
+    uint32_t lo, hi;
+    asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+    return ((uint64_t) hi << 32) | lo;
+}
+
+static inline uint64_t rdmsr(uint32_t msr) {
+    uint32_t lo, hi;
+    asm volatile("rdmsr" : "=a" (lo), "=d" (hi) : "c" (msr));
+    return ((uint64_t) hi << 32) | lo;
+}
+
+static inline void wrmsr(uint32_t msr, uint64_t val) {
+    asm volatile("wrmsr" : : "c" (msr), "a" ((uint32_t) val),
+                 "d" ((uint32_t) (val >> 32)));
 }
 
 static inline uint32_t fetch_and_addl(uint32_t* object, uint32_t addend) {
@@ -0,0 +1,305 @@
+
+obj/bootsector.full:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000007c00 <boot_start>:
+.set SEGSEL_BOOT_CODE,0x8       # code segment selector
+
+.globl boot_start                               # Entry point
+boot_start:
+        .code16                         # This runs in real mode
+        cli                             # Disable interrupts
+    7c00:	fa                   	cli
+        cld                             # String operations increment
+    7c01:	fc                   	cld
+
+        # All segments are initially 0.
+        # Set up the stack pointer, growing downward from 0x7c00.
+        movw    $boot_start, %sp
+    7c02:	bc                   	.byte 0xbc
+    7c03:	00                   	.byte 0x0
+    7c04:	7c                   	.byte 0x7c
+
+0000000000007c05 <notify_bios64>:
+
+notify_bios64:
+        # Notify the BIOS (the machine's firmware) to optimize itself
+        # for x86-64 code. https://wiki.osdev.org/X86-64
+        movw    $0xEC00, %ax
+    7c05:	b8 00 ec ba 02       	mov    $0x2baec00,%eax
+        movw    $2, %dx
+    7c0a:	00 cd                	add    %cl,%ch
+        int     $0x15
+    7c0c:	15                   	.byte 0x15
+
+0000000000007c0d <init_boot_pagetable>:
+        .set PTE_PS,128
+
+init_boot_pagetable:
+        # clear memory for boot page table
+        .set BOOT_PAGETABLE,0x1000
+        movl    $BOOT_PAGETABLE, %edi
+    7c0d:	66 bf 00 10          	mov    $0x1000,%di
+    7c11:	00 00                	add    %al,(%rax)
+        xorl    %eax, %eax
+    7c13:	66 31 c0             	xor    %ax,%ax
+        movl    $(0x2000 >> 2), %ecx
+    7c16:	66 b9 00 08          	mov    $0x800,%cx
+    7c1a:	00 00                	add    %al,(%rax)
+        rep stosl
+    7c1c:	66 f3 ab             	rep stos %ax,%es:(%rdi)
+        # 0x1000: L4 page table; entries 0, 256, and 511 point to:
+        # 0x2000: L3 page table; entries 0 and 510 map 1st 1GB of physmem
+        # This is the minimal page table that maps all of
+        # low-canonical, high-canonical, and kernel-text addresses to
+        # the first 1GB of physical memory.
+        movl    $BOOT_PAGETABLE, %edi
+    7c1f:	66 bf 00 10          	mov    $0x1000,%di
+    7c23:	00 00                	add    %al,(%rax)
+        leal    0x1000 + PTE_P + PTE_W(%edi), %ecx
+    7c25:	67 66 8d 8f 03 10 00 	lea    0x1003(%edi),%cx
+    7c2c:	00 
+        movl    %ecx, (%edi)
+    7c2d:	67 66 89 0f          	mov    %cx,(%edi)
+        movl    %ecx, 0x800(%edi)
+    7c31:	67 66 89 8f 00 08 00 	mov    %cx,0x800(%edi)
+    7c38:	00 
+        movl    %ecx, 0xFF8(%edi)
+    7c39:	67 66 89 8f f8 0f 00 	mov    %cx,0xff8(%edi)
+    7c40:	00 
+        movl    $(PTE_P + PTE_W + PTE_PS), -3(%ecx)
+    7c41:	67 66 c7 41 fd 83 00 	movw   $0x83,-0x3(%ecx)
+    7c48:	00 00                	add    %al,(%rax)
+        movl    $(PTE_P + PTE_W + PTE_PS), 0xFED(%ecx)
+    7c4a:	67 66 c7 81 ed 0f 00 	movw   $0x83,0xfed(%ecx)
+    7c51:	00 83 00 
+	...
+
+0000000000007c56 <real_to_prot>:
+#   The `gdt` and `gdtdesc` tables below define these segments.
+#   This code loads them into the processor.
+#   We need this setup to ensure the transition to protected mode is smooth.
+
+real_to_prot:
+        movl    %cr4, %eax              # enable physical address extensions
+    7c56:	0f 20 e0             	mov    %cr4,%rax
+        orl     $(CR4_PSE | CR4_PAE), %eax
+    7c59:	66 83 c8 30          	or     $0x30,%ax
+        movl    %eax, %cr4
+    7c5d:	0f 22 e0             	mov    %rax,%cr4
+        movl    %edi, %cr3
+    7c60:	0f 22 df             	mov    %rdi,%cr3
+
+        movl    $MSR_IA32_EFER, %ecx    # turn on 64-bit mode
+    7c63:	66 b9 80 00          	mov    $0x80,%cx
+    7c67:	00 c0                	add    %al,%al
+        rdmsr
+    7c69:	0f 32                	rdmsr
+        orl     $(IA32_EFER_LME | IA32_EFER_SCE | IA32_EFER_NXE), %eax
+    7c6b:	66 0d 01 09          	or     $0x901,%ax
+    7c6f:	00 00                	add    %al,(%rax)
+        wrmsr
+    7c71:	0f 30                	wrmsr
+
+        movl    %cr0, %eax              # turn on protected mode
+    7c73:	0f 20 c0             	mov    %cr0,%rax
+        orl     $(CR0_PE | CR0_WP | CR0_PG), %eax
+    7c76:	66 0d 01 00          	or     $0x1,%ax
+    7c7a:	01 80 0f 22 c0 0f    	add    %eax,0xfc0220f(%rax)
+        movl    %eax, %cr0
+
+        lgdt    gdtdesc + 6             # load GDT
+    7c80:	01 16                	add    %edx,(%rsi)
+    7c82:	a6                   	cmpsb  %es:(%rdi),%ds:(%rsi)
+    7c83:	7c ea                	jl     7c6f <real_to_prot+0x19>
+
+        # CPU magic: jump to relocation, flush prefetch queue, and
+        # reload %cs.  Has the effect of just jmp to the next
+        # instruction, but simultaneously loads CS with
+        # $SEGSEL_BOOT_CODE.
+        ljmp    $SEGSEL_BOOT_CODE, $boot
+    7c85:	52                   	push   %rdx
+    7c86:	7d 08                	jge    7c90 <gdt>
+    7c88:	00 0f                	add    %cl,(%rdi)
+    7c8a:	1f                   	(bad)
+    7c8b:	80 00 00             	addb   $0x0,(%rax)
+	...
+
+0000000000007c90 <gdt>:
+	...
+    7c9c:	00                   	.byte 0x0
+    7c9d:	9a                   	(bad)
+    7c9e:	20 00                	and    %al,(%rax)
+
+0000000000007ca0 <gdtdesc>:
+    7ca0:	00 00                	add    %al,(%rax)
+    7ca2:	00 00                	add    %al,(%rax)
+    7ca4:	00 00                	add    %al,(%rax)
+    7ca6:	0f 00 90 7c 00 00 00 	lldt   0x7c(%rax)
+    7cad:	00 00                	add    %al,(%rax)
+	...
+
+0000000000007cb0 <boot_waitdisk>:
+    asm volatile("int3");
+}
+
+static inline uint8_t inb(int port) {
+    uint8_t data;
+    asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+    7cb0:	ba f7 01 00 00       	mov    $0x1f7,%edx
+    7cb5:	ec                   	in     (%dx),%al
+// boot_waitdisk
+//    Wait for the disk to be ready.
+static void boot_waitdisk(void) {
+    // Wait until the ATA status register says ready (0x40 is on)
+    // & not busy (0x80 is off)
+    while ((inb(0x1F7) & 0xC0) != 0x40) {
+    7cb6:	83 e0 c0             	and    $0xffffffc0,%eax
+    7cb9:	3c 40                	cmp    $0x40,%al
+    7cbb:	75 f8                	jne    7cb5 <boot_waitdisk+0x5>
+        /* do nothing */
+    }
+}
+    7cbd:	c3                   	ret
+
+0000000000007cbe <boot_readsect>:
+
+// boot_readsect(dst, src_sect)
+//    Read disk sector number `src_sect` into address `dst`.
+static void boot_readsect(uintptr_t dst, uint32_t src_sect) {
+    // programmed I/O for "read sector"
+    boot_waitdisk();
+    7cbe:	e8 ed ff ff ff       	call   7cb0 <boot_waitdisk>
+                 : "d" (port), "0" (addr), "1" (cnt)
+                 : "memory", "cc");
+}
+
+static inline void outb(int port, uint8_t data) {
+    asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+    7cc3:	b0 01                	mov    $0x1,%al
+    7cc5:	ba f2 01 00 00       	mov    $0x1f2,%edx
+    7cca:	ee                   	out    %al,(%dx)
+    7ccb:	ba f3 01 00 00       	mov    $0x1f3,%edx
+    7cd0:	89 f0                	mov    %esi,%eax
+    7cd2:	ee                   	out    %al,(%dx)
+    outb(0x1F2, 1);             // send `count = 1` as an ATA argument
+    outb(0x1F3, src_sect);      // send `src_sect`, the sector number
+    outb(0x1F4, src_sect >> 8);
+    7cd3:	89 f0                	mov    %esi,%eax
+    7cd5:	ba f4 01 00 00       	mov    $0x1f4,%edx
+    7cda:	c1 e8 08             	shr    $0x8,%eax
+    7cdd:	ee                   	out    %al,(%dx)
+    outb(0x1F5, src_sect >> 16);
+    7cde:	89 f0                	mov    %esi,%eax
+    7ce0:	ba f5 01 00 00       	mov    $0x1f5,%edx
+    7ce5:	c1 e8 10             	shr    $0x10,%eax
+    7ce8:	ee                   	out    %al,(%dx)
+    outb(0x1F6, (src_sect >> 24) | 0xE0);
+    7ce9:	c1 ee 18             	shr    $0x18,%esi
+    7cec:	ba f6 01 00 00       	mov    $0x1f6,%edx
+    7cf1:	89 f0                	mov    %esi,%eax
+    7cf3:	83 c8 e0             	or     $0xffffffe0,%eax
+    7cf6:	ee                   	out    %al,(%dx)
+    7cf7:	b0 20                	mov    $0x20,%al
+    7cf9:	ba f7 01 00 00       	mov    $0x1f7,%edx
+    7cfe:	ee                   	out    %al,(%dx)
+    outb(0x1F7, 0x20);          // send the command: 0x20 = read sectors
+
+    // then move the data into memory
+    boot_waitdisk();
+    7cff:	e8 ac ff ff ff       	call   7cb0 <boot_waitdisk>
+    asm volatile("cld\n\trepne\n\tinsl"
+    7d04:	b9 80 00 00 00       	mov    $0x80,%ecx
+    7d09:	ba f0 01 00 00       	mov    $0x1f0,%edx
+    7d0e:	fc                   	cld
+    7d0f:	f2 6d                	repnz insl (%dx),%es:(%rdi)
+    insl(0x1F0, (void*) dst, SECTORSIZE/4); // read 128 words from the disk
+}
+    7d11:	c3                   	ret
+
+0000000000007d12 <boot_readseg>:
+                         size_t filesz, size_t memsz) {
+    7d12:	49 89 f8             	mov    %rdi,%r8
+    uintptr_t end_ptr = ptr + filesz;
+    7d15:	4c 8d 0c 17          	lea    (%rdi,%rdx,1),%r9
+    memsz += ptr;
+    7d19:	4c 8d 1c 0f          	lea    (%rdi,%rcx,1),%r11
+                         size_t filesz, size_t memsz) {
+    7d1d:	41 89 f2             	mov    %esi,%r10d
+    ptr &= ~(SECTORSIZE - 1); //TODO: WHY ???
+    7d20:	49 81 e0 00 fe ff ff 	and    $0xfffffffffffffe00,%r8
+    for (; ptr < end_ptr; ptr += SECTORSIZE, ++src_sect) {
+    7d27:	4d 39 c8             	cmp    %r9,%r8
+    7d2a:	73 17                	jae    7d43 <boot_readseg+0x31>
+        boot_readsect(ptr, src_sect);
+    7d2c:	44 89 d6             	mov    %r10d,%esi
+    7d2f:	4c 89 c7             	mov    %r8,%rdi
+    for (; ptr < end_ptr; ptr += SECTORSIZE, ++src_sect) {
+    7d32:	41 ff c2             	inc    %r10d
+    7d35:	49 81 c0 00 02 00 00 	add    $0x200,%r8
+        boot_readsect(ptr, src_sect);
+    7d3c:	e8 7d ff ff ff       	call   7cbe <boot_readsect>
+    for (; ptr < end_ptr; ptr += SECTORSIZE, ++src_sect) {
+    7d41:	eb e4                	jmp    7d27 <boot_readseg+0x15>
+    for (; end_ptr < memsz; ++end_ptr) {
+    7d43:	4d 39 d9             	cmp    %r11,%r9
+    7d46:	73 09                	jae    7d51 <boot_readseg+0x3f>
+        *(uint8_t*) end_ptr = 0;
+    7d48:	41 c6 01 00          	movb   $0x0,(%r9)
+    for (; end_ptr < memsz; ++end_ptr) {
+    7d4c:	49 ff c1             	inc    %r9
+    7d4f:	eb f2                	jmp    7d43 <boot_readseg+0x31>
+}
+    7d51:	c3                   	ret
+
+0000000000007d52 <boot>:
+void boot(void) {
+    7d52:	55                   	push   %rbp
+    boot_readseg((uintptr_t) ELFHDR, 1, PAGESIZE, PAGESIZE);
+    7d53:	b9 00 10 00 00       	mov    $0x1000,%ecx
+    7d58:	ba 00 10 00 00       	mov    $0x1000,%edx
+    7d5d:	be 01 00 00 00       	mov    $0x1,%esi
+void boot(void) {
+    7d62:	53                   	push   %rbx
+    boot_readseg((uintptr_t) ELFHDR, 1, PAGESIZE, PAGESIZE);
+    7d63:	bf 00 00 01 00       	mov    $0x10000,%edi
+void boot(void) {
+    7d68:	50                   	push   %rax
+    boot_readseg((uintptr_t) ELFHDR, 1, PAGESIZE, PAGESIZE);
+    7d69:	e8 a4 ff ff ff       	call   7d12 <boot_readseg>
+    while (ELFHDR->e_magic != ELF_MAGIC) {
+    7d6e:	8b 04 25 00 00 01 00 	mov    0x10000,%eax
+    7d75:	3d 7f 45 4c 46       	cmp    $0x464c457f,%eax
+    7d7a:	75 f9                	jne    7d75 <boot+0x23>
+    elf_program* eph = ph + ELFHDR->e_phnum;
+    7d7c:	0f b7 2c 25 38 00 01 	movzwl 0x10038,%ebp
+    7d83:	00 
+    elf_program* ph = (elf_program*) ((uint8_t*) ELFHDR + ELFHDR->e_phoff);
+    7d84:	48 8b 04 25 20 00 01 	mov    0x10020,%rax
+    7d8b:	00 
+    elf_program* eph = ph + ELFHDR->e_phnum;
+    7d8c:	48 6b ed 38          	imul   $0x38,%rbp,%rbp
+    elf_program* ph = (elf_program*) ((uint8_t*) ELFHDR + ELFHDR->e_phoff);
+    7d90:	48 8d 98 00 00 01 00 	lea    0x10000(%rax),%rbx
+    elf_program* eph = ph + ELFHDR->e_phnum;
+    7d97:	48 01 dd             	add    %rbx,%rbp
+    for (; ph < eph; ++ph) {
+    7d9a:	48 39 eb             	cmp    %rbp,%rbx
+    7d9d:	73 21                	jae    7dc0 <boot+0x6e>
+        boot_readseg(ph->p_va, ph->p_offset / SECTORSIZE + 1,
+    7d9f:	48 8b 73 08          	mov    0x8(%rbx),%rsi
+    7da3:	48 8b 4b 28          	mov    0x28(%rbx),%rcx
+    for (; ph < eph; ++ph) {
+    7da7:	48 83 c3 38          	add    $0x38,%rbx
+        boot_readseg(ph->p_va, ph->p_offset / SECTORSIZE + 1,
+    7dab:	48 8b 53 e8          	mov    -0x18(%rbx),%rdx
+    7daf:	48 8b 7b d8          	mov    -0x28(%rbx),%rdi
+    7db3:	48 c1 ee 09          	shr    $0x9,%rsi
+    7db7:	ff c6                	inc    %esi
+    7db9:	e8 54 ff ff ff       	call   7d12 <boot_readseg>
+    for (; ph < eph; ++ph) {
+    7dbe:	eb da                	jmp    7d9a <boot+0x48>
+    kernel_entry();
+    7dc0:	ff 14 25 18 00 01 00 	call   *0x10018
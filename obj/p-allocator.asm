@@ -0,0 +1,2715 @@
+
+obj/p-allocator.full:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000200000 <process_main>:
+
+// These global variables go on the data page.
+uint8_t* heap_top;
+uint8_t* stack_bottom;
+
+void process_main(void) {
+  200000:	55                   	push   %rbp
+  200001:	48 89 e5             	mov    %rsp,%rbp
+  200004:	41 54                	push   %r12
+  200006:	53                   	push   %rbx
+}
+
+// getpid()
+//    Return current process ID, like sys_getpid().
+static inline pid_t getpid(void) {
+    return vdso()->pid;
+  200007:	8b 1c 25 00 10 24 00 	mov    0x241000,%ebx
+
+    pid_t p = getpid();
+    srand(p);
+  20000e:	89 df                	mov    %ebx,%edi
+  200010:	e8 a7 05 00 00       	call   2005bc <srand>
+    //app_printf(p, "process_main, pid: %d\n", p);
+
+    // The heap starts on the page right after the 'end' symbol,
+    // whose address is the first address not allocated to process code
+    // or data.
+    heap_top = ROUNDUP((uint8_t*) end, PAGESIZE);
+  200015:	48 8d 05 fb 2f 00 00 	lea    0x2ffb(%rip),%rax        # 203017 <end+0xfff>
+  20001c:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  200022:	48 89 05 df 1f 00 00 	mov    %rax,0x1fdf(%rip)        # 202008 <heap_top>
+    return rbp;
+}
+
+static inline uintptr_t read_rsp(void) {
+    uintptr_t rsp;
+    asm volatile("movq %%rsp,%0" : "=r" (rsp));
+  200029:	48 89 e0             	mov    %rsp,%rax
+
+    // The bottom of the stack is the first address on the current
+    // stack page (this process never needs more than one stack page).
+    stack_bottom = ROUNDDOWN((uint8_t*) read_rsp() - 1, PAGESIZE);
+  20002c:	48 83 e8 01          	sub    $0x1,%rax
+  200030:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  200036:	48 89 05 c3 1f 00 00 	mov    %rax,0x1fc3(%rip)        # 202000 <stack_bottom>
+    asm volatile ("syscall" : "=a" (result)
+  20003d:	41 bc 3b 00 00 00    	mov    $0x3b,%r12d
+  200043:	eb 12                	jmp    200057 <process_main+0x57>
+    asm volatile ("syscall" : "=a" (rax)
+  200045:	ba 3c 00 00 00       	mov    $0x3c,%edx
+  20004a:	89 d0                	mov    %edx,%eax
+  20004c:	0f 05                	syscall
+  20004e:	eb fa                	jmp    20004a <process_main+0x4a>
+  200050:	b8 3c 00 00 00       	mov    $0x3c,%eax
+  200055:	0f 05                	syscall
+
+    // Allocate heap pages until (1) hit the stack (out of address space)
+    // or (2) allocation fails (out of physical memory).
+    while (1) {
+        if ((rand() % ALLOC_SLOWDOWN) < p) {
+  200057:	e8 fe 04 00 00       	call   20055a <rand>
+  20005c:	48 63 d0             	movslq %eax,%rdx
+  20005f:	48 69 d2 1f 85 eb 51 	imul   $0x51eb851f,%rdx,%rdx
+  200066:	48 c1 fa 25          	sar    $0x25,%rdx
+  20006a:	89 c1                	mov    %eax,%ecx
+  20006c:	c1 f9 1f             	sar    $0x1f,%ecx
+  20006f:	29 ca                	sub    %ecx,%edx
+  200071:	6b d2 64             	imul   $0x64,%edx,%edx
+  200074:	29 d0                	sub    %edx,%eax
+  200076:	39 d8                	cmp    %ebx,%eax
+  200078:	7d d6                	jge    200050 <process_main+0x50>
+            if (heap_top == stack_bottom || sys_page_alloc(heap_top) < 0) {
+  20007a:	48 8b 3d 87 1f 00 00 	mov    0x1f87(%rip),%rdi        # 202008 <heap_top>
+  200081:	48 3b 3d 78 1f 00 00 	cmp    0x1f78(%rip),%rdi        # 202000 <stack_bottom>
+  200088:	74 bb                	je     200045 <process_main+0x45>
+    asm volatile ("syscall" : "=a" (result)
+  20008a:	44 89 e0             	mov    %r12d,%eax
+  20008d:	0f 05                	syscall
+  20008f:	85 c0                	test   %eax,%eax
+  200091:	78 b2                	js     200045 <process_main+0x45>
+                break;
+            }
+            *heap_top = p;      /* check we have write access to new page */
+  200093:	48 8b 05 6e 1f 00 00 	mov    0x1f6e(%rip),%rax        # 202008 <heap_top>
+  20009a:	88 18                	mov    %bl,(%rax)
+            console[CPOS(24, 79)] = '0' + p;  /* check we can write to console */
+  20009c:	8d 43 30             	lea    0x30(%rbx),%eax
+  20009f:	66 89 05 f8 8e eb ff 	mov    %ax,-0x147108(%rip)        # b8f9e <console+0xf9e>
+	    //*heap_top = *(uint8_t *)(0x80000 - 4); /* read kernel stack /!\ */
+
+            heap_top += PAGESIZE;
+  2000a6:	48 81 05 57 1f 00 00 	addq   $0x1000,0x1f57(%rip)        # 202008 <heap_top>
+  2000ad:	00 10 00 00 
+  2000b1:	eb 9d                	jmp    200050 <process_main+0x50>
+
+00000000002000b3 <vdso>:
+static inline const volatile vdso_data* vdso(void) {
+  2000b3:	55                   	push   %rbp
+  2000b4:	48 89 e5             	mov    %rsp,%rbp
+    return (const volatile vdso_data*) VDSO_ADDR;
+  2000b7:	b8 00 10 24 00       	mov    $0x241000,%eax
+}
+  2000bc:	5d                   	pop    %rbp
+  2000bd:	c3                   	ret
+
+00000000002000be <memcpy>:
+#define MEMOP_WORD_MIN 64
+
+// an unaligned word that may alias any object
+typedef uint64_t __attribute__((may_alias, aligned(1))) memop_word;
+
+void* memcpy(void* dst, const void* src, size_t n) {
+  2000be:	55                   	push   %rbp
+  2000bf:	48 89 e5             	mov    %rsp,%rbp
+  2000c2:	48 83 ec 48          	sub    $0x48,%rsp
+  2000c6:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  2000ca:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  2000ce:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+    char* d = (char*) dst;
+  2000d2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  2000d6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    const char* s = (const char*) src;
+  2000da:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  2000de:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (n >= MEMOP_WORD_MIN) {
+  2000e2:	48 83 7d b8 3f       	cmpq   $0x3f,-0x48(%rbp)
+  2000e7:	0f 86 c5 00 00 00    	jbe    2001b2 <memcpy+0xf4>
+        size_t head = -(uintptr_t) d & 7;
+  2000ed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2000f1:	48 f7 d8             	neg    %rax
+  2000f4:	83 e0 07             	and    $0x7,%eax
+  2000f7:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        size_t words = (n - head) / 8;
+  2000fb:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  2000ff:	48 2b 45 e8          	sub    -0x18(%rbp),%rax
+  200103:	48 c1 e8 03          	shr    $0x3,%rax
+  200107:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+        n = (n - head) % 8;
+  20010b:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  20010f:	48 2b 45 e8          	sub    -0x18(%rbp),%rax
+  200113:	83 e0 07             	and    $0x7,%eax
+  200116:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        asm volatile("rep movsb" : "+D" (d), "+S" (s), "+c" (head)
+  20011a:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  20011e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  200122:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  200126:	48 89 cf             	mov    %rcx,%rdi
+  200129:	48 89 d6             	mov    %rdx,%rsi
+  20012c:	48 89 c1             	mov    %rax,%rcx
+  20012f:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  200131:	48 89 c8             	mov    %rcx,%rax
+  200134:	48 89 f2             	mov    %rsi,%rdx
+  200137:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  20013b:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  20013f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                     : : "memory");
+        asm volatile("rep movsq" : "+D" (d), "+S" (s), "+c" (words)
+  200143:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  200147:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  20014b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  20014f:	48 89 cf             	mov    %rcx,%rdi
+  200152:	48 89 d6             	mov    %rdx,%rsi
+  200155:	48 89 c1             	mov    %rax,%rcx
+  200158:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  20015b:	48 89 c8             	mov    %rcx,%rax
+  20015e:	48 89 f2             	mov    %rsi,%rdx
+  200161:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  200165:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  200169:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+                     : : "memory");
+    }
+    for (; n >= 16; n -= 16, s += 16, d += 16) {
+  20016d:	eb 43                	jmp    2001b2 <memcpy+0xf4>
+        memop_word a = ((const memop_word*) s)[0];
+  20016f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  200173:	48 8b 00             	mov    (%rax),%rax
+  200176:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+        memop_word b = ((const memop_word*) s)[1];
+  20017a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  20017e:	48 83 c0 08          	add    $0x8,%rax
+  200182:	48 8b 00             	mov    (%rax),%rax
+  200185:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+        ((memop_word*) d)[0] = a;
+  200189:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20018d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  200191:	48 89 10             	mov    %rdx,(%rax)
+        ((memop_word*) d)[1] = b;
+  200194:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200198:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  20019c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  2001a0:	48 89 02             	mov    %rax,(%rdx)
+    for (; n >= 16; n -= 16, s += 16, d += 16) {
+  2001a3:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  2001a8:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  2001ad:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  2001b2:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  2001b7:	77 b6                	ja     20016f <memcpy+0xb1>
+    }
+    for (; n > 0; --n, ++s, ++d) {
+  2001b9:	eb 1c                	jmp    2001d7 <memcpy+0x119>
+        *d = *s;
+  2001bb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2001bf:	0f b6 10             	movzbl (%rax),%edx
+  2001c2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2001c6:	88 10                	mov    %dl,(%rax)
+    for (; n > 0; --n, ++s, ++d) {
+  2001c8:	48 83 6d b8 01       	subq   $0x1,-0x48(%rbp)
+  2001cd:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  2001d2:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  2001d7:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  2001dc:	75 dd                	jne    2001bb <memcpy+0xfd>
+    }
+    return dst;
+  2001de:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  2001e2:	c9                   	leave
+  2001e3:	c3                   	ret
+
+00000000002001e4 <memmove>:
+
+void* memmove(void* dst, const void* src, size_t n) {
+  2001e4:	55                   	push   %rbp
+  2001e5:	48 89 e5             	mov    %rsp,%rbp
+  2001e8:	48 83 ec 38          	sub    $0x38,%rsp
+  2001ec:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  2001f0:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  2001f4:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    const char* s = (const char*) src;
+  2001f8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  2001fc:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    char* d = (char*) dst;
+  200200:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  200204:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (!(s < d && s + n > d)) {
+  200208:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20020c:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  200210:	73 11                	jae    200223 <memmove+0x3f>
+  200212:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  200216:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  20021a:	48 01 d0             	add    %rdx,%rax
+  20021d:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  200221:	72 1c                	jb     20023f <memmove+0x5b>
+        // a forward copy never overwrites source bytes it has yet to read
+        return memcpy(dst, src, n);
+  200223:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  200227:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  20022b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  20022f:	48 89 ce             	mov    %rcx,%rsi
+  200232:	48 89 c7             	mov    %rax,%rdi
+  200235:	e8 84 fe ff ff       	call   2000be <memcpy>
+  20023a:	e9 94 00 00 00       	jmp    2002d3 <memmove+0xef>
+    }
+
+    // copy backwards: the tail bytes, then words down to the start
+    size_t words = n / 8;
+  20023f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200243:	48 c1 e8 03          	shr    $0x3,%rax
+  200247:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    size_t tail = n % 8;
+  20024b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  20024f:	83 e0 07             	and    $0x7,%eax
+  200252:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    s += n - 1, d += n - 1;
+  200256:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  20025a:	48 83 e8 01          	sub    $0x1,%rax
+  20025e:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  200262:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200266:	48 83 e8 01          	sub    $0x1,%rax
+  20026a:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    asm volatile("std; rep movsb; cld" : "+D" (d), "+S" (s), "+c" (tail)
+  20026e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  200272:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  200276:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  20027a:	48 89 cf             	mov    %rcx,%rdi
+  20027d:	48 89 d6             	mov    %rdx,%rsi
+  200280:	48 89 c1             	mov    %rax,%rcx
+  200283:	fd                   	std
+  200284:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  200286:	fc                   	cld
+  200287:	48 89 c8             	mov    %rcx,%rax
+  20028a:	48 89 f2             	mov    %rsi,%rdx
+  20028d:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  200291:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  200295:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+                 : : "memory", "cc");
+    s -= 7, d -= 7;
+  200299:	48 83 6d f8 07       	subq   $0x7,-0x8(%rbp)
+  20029e:	48 83 6d f0 07       	subq   $0x7,-0x10(%rbp)
+    asm volatile("std; rep movsq; cld" : "+D" (d), "+S" (s), "+c" (words)
+  2002a3:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  2002a7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  2002ab:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2002af:	48 89 cf             	mov    %rcx,%rdi
+  2002b2:	48 89 d6             	mov    %rdx,%rsi
+  2002b5:	48 89 c1             	mov    %rax,%rcx
+  2002b8:	fd                   	std
+  2002b9:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  2002bc:	fc                   	cld
+  2002bd:	48 89 c8             	mov    %rcx,%rax
+  2002c0:	48 89 f2             	mov    %rsi,%rdx
+  2002c3:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  2002c7:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  2002cb:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 : : "memory", "cc");
+    return dst;
+  2002cf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  2002d3:	c9                   	leave
+  2002d4:	c3                   	ret
+
+00000000002002d5 <memset>:
+
+void* memset(void* v, int c, size_t n) {
+  2002d5:	55                   	push   %rbp
+  2002d6:	48 89 e5             	mov    %rsp,%rbp
+  2002d9:	48 83 ec 38          	sub    $0x38,%rsp
+  2002dd:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  2002e1:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  2002e4:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    char* p = (char*) v;
+  2002e8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  2002ec:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    uint64_t word = (uint8_t) c * 0x0101010101010101UL;
+  2002f0:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  2002f3:	0f b6 c0             	movzbl %al,%eax
+  2002f6:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  2002fd:	01 01 01 
+  200300:	48 0f af c2          	imul   %rdx,%rax
+  200304:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (n >= MEMOP_WORD_MIN) {
+  200308:	48 83 7d c8 3f       	cmpq   $0x3f,-0x38(%rbp)
+  20030d:	0f 86 9e 00 00 00    	jbe    2003b1 <memset+0xdc>
+        size_t head = -(uintptr_t) p & 7;
+  200313:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200317:	48 f7 d8             	neg    %rax
+  20031a:	83 e0 07             	and    $0x7,%eax
+  20031d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        size_t words = (n - head) / 8;
+  200321:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200325:	48 2b 45 e8          	sub    -0x18(%rbp),%rax
+  200329:	48 c1 e8 03          	shr    $0x3,%rax
+  20032d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+        n = (n - head) % 8;
+  200331:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200335:	48 2b 45 e8          	sub    -0x18(%rbp),%rax
+  200339:	83 e0 07             	and    $0x7,%eax
+  20033c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        asm volatile("rep stosb" : "+D" (p), "+c" (head) : "a" (word)
+  200340:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  200344:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  200348:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  20034c:	48 89 ce             	mov    %rcx,%rsi
+  20034f:	48 89 f7             	mov    %rsi,%rdi
+  200352:	48 89 d1             	mov    %rdx,%rcx
+  200355:	f3 aa                	rep stos %al,%es:(%rdi)
+  200357:	48 89 ca             	mov    %rcx,%rdx
+  20035a:	48 89 fe             	mov    %rdi,%rsi
+  20035d:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  200361:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+                     : "memory");
+        asm volatile("rep stosq" : "+D" (p), "+c" (words) : "a" (word)
+  200365:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  200369:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  20036d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  200371:	48 89 ce             	mov    %rcx,%rsi
+  200374:	48 89 f7             	mov    %rsi,%rdi
+  200377:	48 89 d1             	mov    %rdx,%rcx
+  20037a:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  20037d:	48 89 ca             	mov    %rcx,%rdx
+  200380:	48 89 fe             	mov    %rdi,%rsi
+  200383:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  200387:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+                     : "memory");
+    }
+    for (; n >= 16; n -= 16, p += 16) {
+  20038b:	eb 24                	jmp    2003b1 <memset+0xdc>
+        ((memop_word*) p)[0] = word;
+  20038d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200391:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  200395:	48 89 10             	mov    %rdx,(%rax)
+        ((memop_word*) p)[1] = word;
+  200398:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20039c:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  2003a0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2003a4:	48 89 02             	mov    %rax,(%rdx)
+    for (; n >= 16; n -= 16, p += 16) {
+  2003a7:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  2003ac:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  2003b1:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  2003b6:	77 d5                	ja     20038d <memset+0xb8>
+    }
+    for (; n > 0; ++p, --n) {
+  2003b8:	eb 15                	jmp    2003cf <memset+0xfa>
+        *p = c;
+  2003ba:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  2003bd:	89 c2                	mov    %eax,%edx
+  2003bf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2003c3:	88 10                	mov    %dl,(%rax)
+    for (; n > 0; ++p, --n) {
+  2003c5:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  2003ca:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  2003cf:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  2003d4:	75 e4                	jne    2003ba <memset+0xe5>
+    }
+    return v;
+  2003d6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  2003da:	c9                   	leave
+  2003db:	c3                   	ret
+
+00000000002003dc <strlen>:
+
+size_t strlen(const char* s) {
+  2003dc:	55                   	push   %rbp
+  2003dd:	48 89 e5             	mov    %rsp,%rbp
+  2003e0:	48 83 ec 18          	sub    $0x18,%rsp
+  2003e4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    size_t n;
+    for (n = 0; *s != '\0'; ++s) {
+  2003e8:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  2003ef:	00 
+  2003f0:	eb 0a                	jmp    2003fc <strlen+0x20>
+        ++n;
+  2003f2:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    for (n = 0; *s != '\0'; ++s) {
+  2003f7:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  2003fc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  200400:	0f b6 00             	movzbl (%rax),%eax
+  200403:	84 c0                	test   %al,%al
+  200405:	75 eb                	jne    2003f2 <strlen+0x16>
+    }
+    return n;
+  200407:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  20040b:	c9                   	leave
+  20040c:	c3                   	ret
+
+000000000020040d <strnlen>:
+
+size_t strnlen(const char* s, size_t maxlen) {
+  20040d:	55                   	push   %rbp
+  20040e:	48 89 e5             	mov    %rsp,%rbp
+  200411:	48 83 ec 20          	sub    $0x20,%rsp
+  200415:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  200419:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    size_t n;
+    for (n = 0; n != maxlen && *s != '\0'; ++s) {
+  20041d:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  200424:	00 
+  200425:	eb 0a                	jmp    200431 <strnlen+0x24>
+        ++n;
+  200427:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    for (n = 0; n != maxlen && *s != '\0'; ++s) {
+  20042c:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  200431:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200435:	48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+  200439:	74 0b                	je     200446 <strnlen+0x39>
+  20043b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20043f:	0f b6 00             	movzbl (%rax),%eax
+  200442:	84 c0                	test   %al,%al
+  200444:	75 e1                	jne    200427 <strnlen+0x1a>
+    }
+    return n;
+  200446:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  20044a:	c9                   	leave
+  20044b:	c3                   	ret
+
+000000000020044c <strcpy>:
+
+char* strcpy(char* dst, const char* src) {
+  20044c:	55                   	push   %rbp
+  20044d:	48 89 e5             	mov    %rsp,%rbp
+  200450:	48 83 ec 20          	sub    $0x20,%rsp
+  200454:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  200458:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    char* d = dst;
+  20045c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  200460:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    do {
+        *d++ = *src++;
+  200464:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  200468:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  20046c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  200470:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200474:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  200478:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+  20047c:	0f b6 12             	movzbl (%rdx),%edx
+  20047f:	88 10                	mov    %dl,(%rax)
+    } while (d[-1]);
+  200481:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200485:	48 83 e8 01          	sub    $0x1,%rax
+  200489:	0f b6 00             	movzbl (%rax),%eax
+  20048c:	84 c0                	test   %al,%al
+  20048e:	75 d4                	jne    200464 <strcpy+0x18>
+    return dst;
+  200490:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  200494:	c9                   	leave
+  200495:	c3                   	ret
+
+0000000000200496 <strcmp>:
+
+int strcmp(const char* a, const char* b) {
+  200496:	55                   	push   %rbp
+  200497:	48 89 e5             	mov    %rsp,%rbp
+  20049a:	48 83 ec 10          	sub    $0x10,%rsp
+  20049e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  2004a2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    while (*a && *b && *a == *b) {
+  2004a6:	eb 0a                	jmp    2004b2 <strcmp+0x1c>
+        ++a, ++b;
+  2004a8:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  2004ad:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+    while (*a && *b && *a == *b) {
+  2004b2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2004b6:	0f b6 00             	movzbl (%rax),%eax
+  2004b9:	84 c0                	test   %al,%al
+  2004bb:	74 1d                	je     2004da <strcmp+0x44>
+  2004bd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2004c1:	0f b6 00             	movzbl (%rax),%eax
+  2004c4:	84 c0                	test   %al,%al
+  2004c6:	74 12                	je     2004da <strcmp+0x44>
+  2004c8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2004cc:	0f b6 10             	movzbl (%rax),%edx
+  2004cf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2004d3:	0f b6 00             	movzbl (%rax),%eax
+  2004d6:	38 c2                	cmp    %al,%dl
+  2004d8:	74 ce                	je     2004a8 <strcmp+0x12>
+    }
+    return ((unsigned char) *a > (unsigned char) *b)
+  2004da:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2004de:	0f b6 00             	movzbl (%rax),%eax
+  2004e1:	89 c2                	mov    %eax,%edx
+  2004e3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2004e7:	0f b6 00             	movzbl (%rax),%eax
+  2004ea:	38 d0                	cmp    %dl,%al
+  2004ec:	0f 92 c0             	setb   %al
+  2004ef:	0f b6 d0             	movzbl %al,%edx
+        - ((unsigned char) *a < (unsigned char) *b);
+  2004f2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2004f6:	0f b6 00             	movzbl (%rax),%eax
+  2004f9:	89 c1                	mov    %eax,%ecx
+  2004fb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2004ff:	0f b6 00             	movzbl (%rax),%eax
+  200502:	38 c1                	cmp    %al,%cl
+  200504:	0f 92 c0             	setb   %al
+  200507:	0f b6 c0             	movzbl %al,%eax
+  20050a:	29 c2                	sub    %eax,%edx
+  20050c:	89 d0                	mov    %edx,%eax
+}
+  20050e:	c9                   	leave
+  20050f:	c3                   	ret
+
+0000000000200510 <strchr>:
+
+char* strchr(const char* s, int c) {
+  200510:	55                   	push   %rbp
+  200511:	48 89 e5             	mov    %rsp,%rbp
+  200514:	48 83 ec 10          	sub    $0x10,%rsp
+  200518:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  20051c:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    while (*s && *s != (char) c) {
+  20051f:	eb 05                	jmp    200526 <strchr+0x16>
+        ++s;
+  200521:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    while (*s && *s != (char) c) {
+  200526:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20052a:	0f b6 00             	movzbl (%rax),%eax
+  20052d:	84 c0                	test   %al,%al
+  20052f:	74 0e                	je     20053f <strchr+0x2f>
+  200531:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200535:	0f b6 00             	movzbl (%rax),%eax
+  200538:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  20053b:	38 d0                	cmp    %dl,%al
+  20053d:	75 e2                	jne    200521 <strchr+0x11>
+    }
+    if (*s == (char) c) {
+  20053f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200543:	0f b6 00             	movzbl (%rax),%eax
+  200546:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  200549:	38 d0                	cmp    %dl,%al
+  20054b:	75 06                	jne    200553 <strchr+0x43>
+        return (char*) s;
+  20054d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200551:	eb 05                	jmp    200558 <strchr+0x48>
+    } else {
+        return NULL;
+  200553:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+}
+  200558:	c9                   	leave
+  200559:	c3                   	ret
+
+000000000020055a <rand>:
+
+// New randomness implementation
+static int      rand_seed_set;
+static unsigned rand_seed;
+
+int rand(void) {
+  20055a:	55                   	push   %rbp
+  20055b:	48 89 e5             	mov    %rsp,%rbp
+  20055e:	48 83 ec 10          	sub    $0x10,%rsp
+    if (!rand_seed_set) {
+  200562:	8b 05 a8 1a 00 00    	mov    0x1aa8(%rip),%eax        # 202010 <rand_seed_set>
+  200568:	85 c0                	test   %eax,%eax
+  20056a:	75 2c                	jne    200598 <rand+0x3e>
+#if WEENSYOS_KERNEL
+        extern unsigned get_entropy_value(void);
+        srand(get_entropy_value());
+#else           // user‑space build
+       /* kernel-refreshed seed from the kernel data page: no system call */
+       srand((unsigned) (vdso()->seed[0] ^ read_cycle_counter()));
+  20056c:	e8 42 fb ff ff       	call   2000b3 <vdso>
+  200571:	48 8b 40 18          	mov    0x18(%rax),%rax
+  200575:	89 c1                	mov    %eax,%ecx
+    }
+}
+
+static inline uint64_t read_cycle_counter(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+  200577:	0f 31                	rdtsc
+  200579:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  20057c:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    return ((uint64_t) hi << 32) | lo;
+  20057f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  200582:	48 c1 e0 20          	shl    $0x20,%rax
+  200586:	48 89 c2             	mov    %rax,%rdx
+  200589:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  20058c:	48 09 d0             	or     %rdx,%rax
+  20058f:	31 c8                	xor    %ecx,%eax
+  200591:	89 c7                	mov    %eax,%edi
+  200593:	e8 24 00 00 00       	call   2005bc <srand>
+#endif
+    }
+    rand_seed = rand_seed * 1664525U + 1013904223U;   // LCG
+  200598:	8b 05 76 1a 00 00    	mov    0x1a76(%rip),%eax        # 202014 <rand_seed>
+  20059e:	69 c0 0d 66 19 00    	imul   $0x19660d,%eax,%eax
+  2005a4:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+  2005a9:	89 05 65 1a 00 00    	mov    %eax,0x1a65(%rip)        # 202014 <rand_seed>
+    return rand_seed & RAND_MAX;
+  2005af:	8b 05 5f 1a 00 00    	mov    0x1a5f(%rip),%eax        # 202014 <rand_seed>
+  2005b5:	25 ff ff ff 7f       	and    $0x7fffffff,%eax
+}
+  2005ba:	c9                   	leave
+  2005bb:	c3                   	ret
+
+00000000002005bc <srand>:
+
+void srand(unsigned seed) {
+  2005bc:	55                   	push   %rbp
+  2005bd:	48 89 e5             	mov    %rsp,%rbp
+  2005c0:	48 83 ec 08          	sub    $0x8,%rsp
+  2005c4:	89 7d fc             	mov    %edi,-0x4(%rbp)
+    rand_seed      = seed;
+  2005c7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  2005ca:	89 05 44 1a 00 00    	mov    %eax,0x1a44(%rip)        # 202014 <rand_seed>
+    rand_seed_set  = 1;
+  2005d0:	c7 05 36 1a 00 00 01 	movl   $0x1,0x1a36(%rip)        # 202010 <rand_seed_set>
+  2005d7:	00 00 00 
+}
+  2005da:	90                   	nop
+  2005db:	c9                   	leave
+  2005dc:	c3                   	ret
+
+00000000002005dd <fill_numbuf>:
+//    Print a message onto the console, starting at the given cursor position.
+
+// snprintf, vsnprintf
+//    Format a string into a buffer.
+
+static char* fill_numbuf(char* numbuf_end, unsigned long val, int base) {
+  2005dd:	55                   	push   %rbp
+  2005de:	48 89 e5             	mov    %rsp,%rbp
+  2005e1:	48 83 ec 28          	sub    $0x28,%rsp
+  2005e5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  2005e9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  2005ed:	89 55 dc             	mov    %edx,-0x24(%rbp)
+    static const char upper_digits[] = "0123456789ABCDEF";
+    static const char lower_digits[] = "0123456789abcdef";
+
+    const char* digits = upper_digits;
+  2005f0:	48 8d 05 19 16 00 00 	lea    0x1619(%rip),%rax        # 201c10 <upper_digits.1>
+  2005f7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (base < 0) {
+  2005fb:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  2005ff:	79 0e                	jns    20060f <fill_numbuf+0x32>
+        digits = lower_digits;
+  200601:	48 8d 05 28 16 00 00 	lea    0x1628(%rip),%rax        # 201c30 <lower_digits.0>
+  200608:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+        base = -base;
+  20060c:	f7 5d dc             	negl   -0x24(%rbp)
+    }
+
+    *--numbuf_end = '\0';
+  20060f:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  200614:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  200618:	c6 00 00             	movb   $0x0,(%rax)
+    do {
+        *--numbuf_end = digits[val % base];
+  20061b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  20061e:	48 63 c8             	movslq %eax,%rcx
+  200621:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  200625:	ba 00 00 00 00       	mov    $0x0,%edx
+  20062a:	48 f7 f1             	div    %rcx
+  20062d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200631:	48 01 d0             	add    %rdx,%rax
+  200634:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  200639:	0f b6 10             	movzbl (%rax),%edx
+  20063c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  200640:	88 10                	mov    %dl,(%rax)
+        val /= base;
+  200642:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  200645:	48 63 f0             	movslq %eax,%rsi
+  200648:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  20064c:	ba 00 00 00 00       	mov    $0x0,%edx
+  200651:	48 f7 f6             	div    %rsi
+  200654:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    } while (val != 0);
+  200658:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  20065d:	75 bc                	jne    20061b <fill_numbuf+0x3e>
+    return numbuf_end;
+  20065f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  200663:	c9                   	leave
+  200664:	c3                   	ret
+
+0000000000200665 <printer_vprintf>:
+#define FLAG_NUMERIC            (1<<5)
+#define FLAG_SIGNED             (1<<6)
+#define FLAG_NEGATIVE           (1<<7)
+#define FLAG_ALT2               (1<<8)
+
+void printer_vprintf(printer* p, int color, const char* format, va_list val) {
+  200665:	55                   	push   %rbp
+  200666:	48 89 e5             	mov    %rsp,%rbp
+  200669:	53                   	push   %rbx
+  20066a:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  200671:	48 89 bd 78 ff ff ff 	mov    %rdi,-0x88(%rbp)
+  200678:	89 b5 74 ff ff ff    	mov    %esi,-0x8c(%rbp)
+  20067e:	48 89 95 68 ff ff ff 	mov    %rdx,-0x98(%rbp)
+  200685:	48 89 8d 60 ff ff ff 	mov    %rcx,-0xa0(%rbp)
+#define NUMBUFSIZ 24
+    char numbuf[NUMBUFSIZ];
+
+    for (; *format; ++format) {
+  20068c:	e9 be 09 00 00       	jmp    20104f <printer_vprintf+0x9ea>
+        if (*format != '%') {
+  200691:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200698:	0f b6 00             	movzbl (%rax),%eax
+  20069b:	3c 25                	cmp    $0x25,%al
+  20069d:	74 31                	je     2006d0 <printer_vprintf+0x6b>
+            p->putc(p, *format, color);
+  20069f:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  2006a6:	4c 8b 00             	mov    (%rax),%r8
+  2006a9:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  2006b0:	0f b6 00             	movzbl (%rax),%eax
+  2006b3:	0f b6 c8             	movzbl %al,%ecx
+  2006b6:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  2006bc:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  2006c3:	89 ce                	mov    %ecx,%esi
+  2006c5:	48 89 c7             	mov    %rax,%rdi
+  2006c8:	41 ff d0             	call   *%r8
+            continue;
+  2006cb:	e9 77 09 00 00       	jmp    201047 <printer_vprintf+0x9e2>
+        }
+
+        // process flags
+        int flags = 0;
+  2006d0:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+        for (++format; *format; ++format) {
+  2006d7:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  2006de:	01 
+  2006df:	eb 4f                	jmp    200730 <printer_vprintf+0xcb>
+            const char* flagc = strchr(flag_chars, *format);
+  2006e1:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  2006e8:	0f b6 00             	movzbl (%rax),%eax
+  2006eb:	0f be c0             	movsbl %al,%eax
+  2006ee:	89 c6                	mov    %eax,%esi
+  2006f0:	48 8d 05 c9 13 00 00 	lea    0x13c9(%rip),%rax        # 201ac0 <flag_chars>
+  2006f7:	48 89 c7             	mov    %rax,%rdi
+  2006fa:	e8 11 fe ff ff       	call   200510 <strchr>
+  2006ff:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (flagc) {
+  200703:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  200708:	74 36                	je     200740 <printer_vprintf+0xdb>
+                flags |= 1 << (flagc - flag_chars);
+  20070a:	48 8d 05 af 13 00 00 	lea    0x13af(%rip),%rax        # 201ac0 <flag_chars>
+  200711:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  200715:	48 29 c2             	sub    %rax,%rdx
+  200718:	89 d0                	mov    %edx,%eax
+  20071a:	ba 01 00 00 00       	mov    $0x1,%edx
+  20071f:	89 c1                	mov    %eax,%ecx
+  200721:	d3 e2                	shl    %cl,%edx
+  200723:	89 d0                	mov    %edx,%eax
+  200725:	09 45 ec             	or     %eax,-0x14(%rbp)
+        for (++format; *format; ++format) {
+  200728:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  20072f:	01 
+  200730:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200737:	0f b6 00             	movzbl (%rax),%eax
+  20073a:	84 c0                	test   %al,%al
+  20073c:	75 a3                	jne    2006e1 <printer_vprintf+0x7c>
+  20073e:	eb 01                	jmp    200741 <printer_vprintf+0xdc>
+            } else {
+                break;
+  200740:	90                   	nop
+            }
+        }
+
+        // process width
+        int width = -1;
+  200741:	c7 45 e8 ff ff ff ff 	movl   $0xffffffff,-0x18(%rbp)
+        if (*format >= '1' && *format <= '9') {
+  200748:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  20074f:	0f b6 00             	movzbl (%rax),%eax
+  200752:	3c 30                	cmp    $0x30,%al
+  200754:	7e 67                	jle    2007bd <printer_vprintf+0x158>
+  200756:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  20075d:	0f b6 00             	movzbl (%rax),%eax
+  200760:	3c 39                	cmp    $0x39,%al
+  200762:	7f 59                	jg     2007bd <printer_vprintf+0x158>
+            for (width = 0; *format >= '0' && *format <= '9'; ) {
+  200764:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%rbp)
+  20076b:	eb 2e                	jmp    20079b <printer_vprintf+0x136>
+                width = 10 * width + *format++ - '0';
+  20076d:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  200770:	89 d0                	mov    %edx,%eax
+  200772:	c1 e0 02             	shl    $0x2,%eax
+  200775:	01 d0                	add    %edx,%eax
+  200777:	01 c0                	add    %eax,%eax
+  200779:	89 c1                	mov    %eax,%ecx
+  20077b:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200782:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  200786:	48 89 95 68 ff ff ff 	mov    %rdx,-0x98(%rbp)
+  20078d:	0f b6 00             	movzbl (%rax),%eax
+  200790:	0f be c0             	movsbl %al,%eax
+  200793:	01 c8                	add    %ecx,%eax
+  200795:	83 e8 30             	sub    $0x30,%eax
+  200798:	89 45 e8             	mov    %eax,-0x18(%rbp)
+            for (width = 0; *format >= '0' && *format <= '9'; ) {
+  20079b:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  2007a2:	0f b6 00             	movzbl (%rax),%eax
+  2007a5:	3c 2f                	cmp    $0x2f,%al
+  2007a7:	0f 8e 85 00 00 00    	jle    200832 <printer_vprintf+0x1cd>
+  2007ad:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  2007b4:	0f b6 00             	movzbl (%rax),%eax
+  2007b7:	3c 39                	cmp    $0x39,%al
+  2007b9:	7e b2                	jle    20076d <printer_vprintf+0x108>
+        if (*format >= '1' && *format <= '9') {
+  2007bb:	eb 75                	jmp    200832 <printer_vprintf+0x1cd>
+            }
+        } else if (*format == '*') {
+  2007bd:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  2007c4:	0f b6 00             	movzbl (%rax),%eax
+  2007c7:	3c 2a                	cmp    $0x2a,%al
+  2007c9:	75 68                	jne    200833 <printer_vprintf+0x1ce>
+            width = va_arg(val, int);
+  2007cb:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2007d2:	8b 00                	mov    (%rax),%eax
+  2007d4:	83 f8 2f             	cmp    $0x2f,%eax
+  2007d7:	77 30                	ja     200809 <printer_vprintf+0x1a4>
+  2007d9:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2007e0:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  2007e4:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2007eb:	8b 00                	mov    (%rax),%eax
+  2007ed:	89 c0                	mov    %eax,%eax
+  2007ef:	48 01 d0             	add    %rdx,%rax
+  2007f2:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  2007f9:	8b 12                	mov    (%rdx),%edx
+  2007fb:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  2007fe:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200805:	89 0a                	mov    %ecx,(%rdx)
+  200807:	eb 1a                	jmp    200823 <printer_vprintf+0x1be>
+  200809:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200810:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200814:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200818:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  20081f:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200823:	8b 00                	mov    (%rax),%eax
+  200825:	89 45 e8             	mov    %eax,-0x18(%rbp)
+            ++format;
+  200828:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  20082f:	01 
+  200830:	eb 01                	jmp    200833 <printer_vprintf+0x1ce>
+        if (*format >= '1' && *format <= '9') {
+  200832:	90                   	nop
+        }
+
+        // process precision
+        int precision = -1;
+  200833:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%rbp)
+        if (*format == '.') {
+  20083a:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200841:	0f b6 00             	movzbl (%rax),%eax
+  200844:	3c 2e                	cmp    $0x2e,%al
+  200846:	0f 85 00 01 00 00    	jne    20094c <printer_vprintf+0x2e7>
+            ++format;
+  20084c:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  200853:	01 
+            if (*format >= '0' && *format <= '9') {
+  200854:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  20085b:	0f b6 00             	movzbl (%rax),%eax
+  20085e:	3c 2f                	cmp    $0x2f,%al
+  200860:	7e 67                	jle    2008c9 <printer_vprintf+0x264>
+  200862:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200869:	0f b6 00             	movzbl (%rax),%eax
+  20086c:	3c 39                	cmp    $0x39,%al
+  20086e:	7f 59                	jg     2008c9 <printer_vprintf+0x264>
+                for (precision = 0; *format >= '0' && *format <= '9'; ) {
+  200870:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%rbp)
+  200877:	eb 2e                	jmp    2008a7 <printer_vprintf+0x242>
+                    precision = 10 * precision + *format++ - '0';
+  200879:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  20087c:	89 d0                	mov    %edx,%eax
+  20087e:	c1 e0 02             	shl    $0x2,%eax
+  200881:	01 d0                	add    %edx,%eax
+  200883:	01 c0                	add    %eax,%eax
+  200885:	89 c1                	mov    %eax,%ecx
+  200887:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  20088e:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  200892:	48 89 95 68 ff ff ff 	mov    %rdx,-0x98(%rbp)
+  200899:	0f b6 00             	movzbl (%rax),%eax
+  20089c:	0f be c0             	movsbl %al,%eax
+  20089f:	01 c8                	add    %ecx,%eax
+  2008a1:	83 e8 30             	sub    $0x30,%eax
+  2008a4:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+                for (precision = 0; *format >= '0' && *format <= '9'; ) {
+  2008a7:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  2008ae:	0f b6 00             	movzbl (%rax),%eax
+  2008b1:	3c 2f                	cmp    $0x2f,%al
+  2008b3:	0f 8e 85 00 00 00    	jle    20093e <printer_vprintf+0x2d9>
+  2008b9:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  2008c0:	0f b6 00             	movzbl (%rax),%eax
+  2008c3:	3c 39                	cmp    $0x39,%al
+  2008c5:	7e b2                	jle    200879 <printer_vprintf+0x214>
+            if (*format >= '0' && *format <= '9') {
+  2008c7:	eb 75                	jmp    20093e <printer_vprintf+0x2d9>
+                }
+            } else if (*format == '*') {
+  2008c9:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  2008d0:	0f b6 00             	movzbl (%rax),%eax
+  2008d3:	3c 2a                	cmp    $0x2a,%al
+  2008d5:	75 68                	jne    20093f <printer_vprintf+0x2da>
+                precision = va_arg(val, int);
+  2008d7:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2008de:	8b 00                	mov    (%rax),%eax
+  2008e0:	83 f8 2f             	cmp    $0x2f,%eax
+  2008e3:	77 30                	ja     200915 <printer_vprintf+0x2b0>
+  2008e5:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2008ec:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  2008f0:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2008f7:	8b 00                	mov    (%rax),%eax
+  2008f9:	89 c0                	mov    %eax,%eax
+  2008fb:	48 01 d0             	add    %rdx,%rax
+  2008fe:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200905:	8b 12                	mov    (%rdx),%edx
+  200907:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  20090a:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200911:	89 0a                	mov    %ecx,(%rdx)
+  200913:	eb 1a                	jmp    20092f <printer_vprintf+0x2ca>
+  200915:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  20091c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200920:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200924:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  20092b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  20092f:	8b 00                	mov    (%rax),%eax
+  200931:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+                ++format;
+  200934:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  20093b:	01 
+  20093c:	eb 01                	jmp    20093f <printer_vprintf+0x2da>
+            if (*format >= '0' && *format <= '9') {
+  20093e:	90                   	nop
+            }
+            if (precision < 0) {
+  20093f:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  200943:	79 07                	jns    20094c <printer_vprintf+0x2e7>
+                precision = 0;
+  200945:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%rbp)
+            }
+        }
+
+        // process main conversion character
+        int base = 10;
+  20094c:	c7 45 e0 0a 00 00 00 	movl   $0xa,-0x20(%rbp)
+        unsigned long num = 0;
+  200953:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  20095a:	00 
+        int length = 0;
+  20095b:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+        char* data = "";
+  200962:	48 8d 05 5d 11 00 00 	lea    0x115d(%rip),%rax        # 201ac6 <flag_chars+0x6>
+  200969:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    again:
+        switch (*format) {
+  20096d:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200974:	0f b6 00             	movzbl (%rax),%eax
+  200977:	0f be c0             	movsbl %al,%eax
+  20097a:	83 e8 43             	sub    $0x43,%eax
+  20097d:	83 f8 37             	cmp    $0x37,%eax
+  200980:	0f 87 b5 03 00 00    	ja     200d3b <printer_vprintf+0x6d6>
+  200986:	89 c0                	mov    %eax,%eax
+  200988:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  20098f:	00 
+  200990:	48 8d 05 3d 11 00 00 	lea    0x113d(%rip),%rax        # 201ad4 <flag_chars+0x14>
+  200997:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+  20099a:	48 98                	cltq
+  20099c:	48 8d 15 31 11 00 00 	lea    0x1131(%rip),%rdx        # 201ad4 <flag_chars+0x14>
+  2009a3:	48 01 d0             	add    %rdx,%rax
+  2009a6:	ff e0                	jmp    *%rax
+        case 'l':
+        case 'z':
+            length = 1;
+  2009a8:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+            ++format;
+  2009af:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  2009b6:	01 
+            goto again;
+  2009b7:	eb b4                	jmp    20096d <printer_vprintf+0x308>
+        case 'd':
+        case 'i': {
+            long x = length ? va_arg(val, long) : va_arg(val, int);
+  2009b9:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  2009bd:	74 5d                	je     200a1c <printer_vprintf+0x3b7>
+  2009bf:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2009c6:	8b 00                	mov    (%rax),%eax
+  2009c8:	83 f8 2f             	cmp    $0x2f,%eax
+  2009cb:	77 30                	ja     2009fd <printer_vprintf+0x398>
+  2009cd:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2009d4:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  2009d8:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2009df:	8b 00                	mov    (%rax),%eax
+  2009e1:	89 c0                	mov    %eax,%eax
+  2009e3:	48 01 d0             	add    %rdx,%rax
+  2009e6:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  2009ed:	8b 12                	mov    (%rdx),%edx
+  2009ef:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  2009f2:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  2009f9:	89 0a                	mov    %ecx,(%rdx)
+  2009fb:	eb 1a                	jmp    200a17 <printer_vprintf+0x3b2>
+  2009fd:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200a04:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200a08:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200a0c:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200a13:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200a17:	48 8b 00             	mov    (%rax),%rax
+  200a1a:	eb 5c                	jmp    200a78 <printer_vprintf+0x413>
+  200a1c:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200a23:	8b 00                	mov    (%rax),%eax
+  200a25:	83 f8 2f             	cmp    $0x2f,%eax
+  200a28:	77 30                	ja     200a5a <printer_vprintf+0x3f5>
+  200a2a:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200a31:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200a35:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200a3c:	8b 00                	mov    (%rax),%eax
+  200a3e:	89 c0                	mov    %eax,%eax
+  200a40:	48 01 d0             	add    %rdx,%rax
+  200a43:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200a4a:	8b 12                	mov    (%rdx),%edx
+  200a4c:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200a4f:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200a56:	89 0a                	mov    %ecx,(%rdx)
+  200a58:	eb 1a                	jmp    200a74 <printer_vprintf+0x40f>
+  200a5a:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200a61:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200a65:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200a69:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200a70:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200a74:	8b 00                	mov    (%rax),%eax
+  200a76:	48 98                	cltq
+  200a78:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+            int negative = x < 0 ? FLAG_NEGATIVE : 0;
+  200a7c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  200a80:	48 c1 f8 38          	sar    $0x38,%rax
+  200a84:	25 80 00 00 00       	and    $0x80,%eax
+  200a89:	89 45 a4             	mov    %eax,-0x5c(%rbp)
+            num = negative ? -x : x;
+  200a8c:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  200a90:	74 09                	je     200a9b <printer_vprintf+0x436>
+  200a92:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  200a96:	48 f7 d8             	neg    %rax
+  200a99:	eb 04                	jmp    200a9f <printer_vprintf+0x43a>
+  200a9b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  200a9f:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+            flags |= FLAG_NUMERIC | FLAG_SIGNED | negative;
+  200aa3:	8b 45 a4             	mov    -0x5c(%rbp),%eax
+  200aa6:	83 c8 60             	or     $0x60,%eax
+  200aa9:	09 45 ec             	or     %eax,-0x14(%rbp)
+            break;
+  200aac:	e9 cf 02 00 00       	jmp    200d80 <printer_vprintf+0x71b>
+        }
+        case 'u':
+        format_unsigned:
+            num = length ? va_arg(val, unsigned long) : va_arg(val, unsigned);
+  200ab1:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  200ab5:	74 5d                	je     200b14 <printer_vprintf+0x4af>
+  200ab7:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200abe:	8b 00                	mov    (%rax),%eax
+  200ac0:	83 f8 2f             	cmp    $0x2f,%eax
+  200ac3:	77 30                	ja     200af5 <printer_vprintf+0x490>
+  200ac5:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200acc:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200ad0:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200ad7:	8b 00                	mov    (%rax),%eax
+  200ad9:	89 c0                	mov    %eax,%eax
+  200adb:	48 01 d0             	add    %rdx,%rax
+  200ade:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200ae5:	8b 12                	mov    (%rdx),%edx
+  200ae7:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200aea:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200af1:	89 0a                	mov    %ecx,(%rdx)
+  200af3:	eb 1a                	jmp    200b0f <printer_vprintf+0x4aa>
+  200af5:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200afc:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200b00:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200b04:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200b0b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200b0f:	48 8b 00             	mov    (%rax),%rax
+  200b12:	eb 5c                	jmp    200b70 <printer_vprintf+0x50b>
+  200b14:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200b1b:	8b 00                	mov    (%rax),%eax
+  200b1d:	83 f8 2f             	cmp    $0x2f,%eax
+  200b20:	77 30                	ja     200b52 <printer_vprintf+0x4ed>
+  200b22:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200b29:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200b2d:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200b34:	8b 00                	mov    (%rax),%eax
+  200b36:	89 c0                	mov    %eax,%eax
+  200b38:	48 01 d0             	add    %rdx,%rax
+  200b3b:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200b42:	8b 12                	mov    (%rdx),%edx
+  200b44:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200b47:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200b4e:	89 0a                	mov    %ecx,(%rdx)
+  200b50:	eb 1a                	jmp    200b6c <printer_vprintf+0x507>
+  200b52:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200b59:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200b5d:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200b61:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200b68:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200b6c:	8b 00                	mov    (%rax),%eax
+  200b6e:	89 c0                	mov    %eax,%eax
+  200b70:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+            flags |= FLAG_NUMERIC;
+  200b74:	83 4d ec 20          	orl    $0x20,-0x14(%rbp)
+            break;
+  200b78:	e9 03 02 00 00       	jmp    200d80 <printer_vprintf+0x71b>
+        case 'x':
+            base = -16;
+  200b7d:	c7 45 e0 f0 ff ff ff 	movl   $0xfffffff0,-0x20(%rbp)
+            goto format_unsigned;
+  200b84:	e9 28 ff ff ff       	jmp    200ab1 <printer_vprintf+0x44c>
+        case 'X':
+            base = 16;
+  200b89:	c7 45 e0 10 00 00 00 	movl   $0x10,-0x20(%rbp)
+            goto format_unsigned;
+  200b90:	e9 1c ff ff ff       	jmp    200ab1 <printer_vprintf+0x44c>
+        case 'p':
+            num = (uintptr_t) va_arg(val, void*);
+  200b95:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200b9c:	8b 00                	mov    (%rax),%eax
+  200b9e:	83 f8 2f             	cmp    $0x2f,%eax
+  200ba1:	77 30                	ja     200bd3 <printer_vprintf+0x56e>
+  200ba3:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200baa:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200bae:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200bb5:	8b 00                	mov    (%rax),%eax
+  200bb7:	89 c0                	mov    %eax,%eax
+  200bb9:	48 01 d0             	add    %rdx,%rax
+  200bbc:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200bc3:	8b 12                	mov    (%rdx),%edx
+  200bc5:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200bc8:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200bcf:	89 0a                	mov    %ecx,(%rdx)
+  200bd1:	eb 1a                	jmp    200bed <printer_vprintf+0x588>
+  200bd3:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200bda:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200bde:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200be2:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200be9:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200bed:	48 8b 00             	mov    (%rax),%rax
+  200bf0:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+            base = -16;
+  200bf4:	c7 45 e0 f0 ff ff ff 	movl   $0xfffffff0,-0x20(%rbp)
+            flags |= FLAG_ALT | FLAG_ALT2 | FLAG_NUMERIC;
+  200bfb:	81 4d ec 21 01 00 00 	orl    $0x121,-0x14(%rbp)
+            break;
+  200c02:	e9 79 01 00 00       	jmp    200d80 <printer_vprintf+0x71b>
+        case 's':
+            data = va_arg(val, char*);
+  200c07:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c0e:	8b 00                	mov    (%rax),%eax
+  200c10:	83 f8 2f             	cmp    $0x2f,%eax
+  200c13:	77 30                	ja     200c45 <printer_vprintf+0x5e0>
+  200c15:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c1c:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200c20:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c27:	8b 00                	mov    (%rax),%eax
+  200c29:	89 c0                	mov    %eax,%eax
+  200c2b:	48 01 d0             	add    %rdx,%rax
+  200c2e:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200c35:	8b 12                	mov    (%rdx),%edx
+  200c37:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200c3a:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200c41:	89 0a                	mov    %ecx,(%rdx)
+  200c43:	eb 1a                	jmp    200c5f <printer_vprintf+0x5fa>
+  200c45:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c4c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200c50:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200c54:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200c5b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200c5f:	48 8b 00             	mov    (%rax),%rax
+  200c62:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+            break;
+  200c66:	e9 15 01 00 00       	jmp    200d80 <printer_vprintf+0x71b>
+        case 'C':
+            color = va_arg(val, int);
+  200c6b:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c72:	8b 00                	mov    (%rax),%eax
+  200c74:	83 f8 2f             	cmp    $0x2f,%eax
+  200c77:	77 30                	ja     200ca9 <printer_vprintf+0x644>
+  200c79:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c80:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200c84:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c8b:	8b 00                	mov    (%rax),%eax
+  200c8d:	89 c0                	mov    %eax,%eax
+  200c8f:	48 01 d0             	add    %rdx,%rax
+  200c92:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200c99:	8b 12                	mov    (%rdx),%edx
+  200c9b:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200c9e:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200ca5:	89 0a                	mov    %ecx,(%rdx)
+  200ca7:	eb 1a                	jmp    200cc3 <printer_vprintf+0x65e>
+  200ca9:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200cb0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200cb4:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200cb8:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200cbf:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200cc3:	8b 00                	mov    (%rax),%eax
+  200cc5:	89 85 74 ff ff ff    	mov    %eax,-0x8c(%rbp)
+            goto done;
+  200ccb:	e9 77 03 00 00       	jmp    201047 <printer_vprintf+0x9e2>
+        case 'c':
+            data = numbuf;
+  200cd0:	48 8d 45 8c          	lea    -0x74(%rbp),%rax
+  200cd4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+            numbuf[0] = va_arg(val, int);
+  200cd8:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200cdf:	8b 00                	mov    (%rax),%eax
+  200ce1:	83 f8 2f             	cmp    $0x2f,%eax
+  200ce4:	77 30                	ja     200d16 <printer_vprintf+0x6b1>
+  200ce6:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200ced:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200cf1:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200cf8:	8b 00                	mov    (%rax),%eax
+  200cfa:	89 c0                	mov    %eax,%eax
+  200cfc:	48 01 d0             	add    %rdx,%rax
+  200cff:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200d06:	8b 12                	mov    (%rdx),%edx
+  200d08:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200d0b:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200d12:	89 0a                	mov    %ecx,(%rdx)
+  200d14:	eb 1a                	jmp    200d30 <printer_vprintf+0x6cb>
+  200d16:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200d1d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200d21:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200d25:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200d2c:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200d30:	8b 00                	mov    (%rax),%eax
+  200d32:	88 45 8c             	mov    %al,-0x74(%rbp)
+            numbuf[1] = '\0';
+  200d35:	c6 45 8d 00          	movb   $0x0,-0x73(%rbp)
+            break;
+  200d39:	eb 45                	jmp    200d80 <printer_vprintf+0x71b>
+        default:
+            data = numbuf;
+  200d3b:	48 8d 45 8c          	lea    -0x74(%rbp),%rax
+  200d3f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+            numbuf[0] = (*format ? *format : '%');
+  200d43:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200d4a:	0f b6 00             	movzbl (%rax),%eax
+  200d4d:	84 c0                	test   %al,%al
+  200d4f:	74 0c                	je     200d5d <printer_vprintf+0x6f8>
+  200d51:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200d58:	0f b6 00             	movzbl (%rax),%eax
+  200d5b:	eb 05                	jmp    200d62 <printer_vprintf+0x6fd>
+  200d5d:	b8 25 00 00 00       	mov    $0x25,%eax
+  200d62:	88 45 8c             	mov    %al,-0x74(%rbp)
+            numbuf[1] = '\0';
+  200d65:	c6 45 8d 00          	movb   $0x0,-0x73(%rbp)
+            if (!*format) {
+  200d69:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200d70:	0f b6 00             	movzbl (%rax),%eax
+  200d73:	84 c0                	test   %al,%al
+  200d75:	75 08                	jne    200d7f <printer_vprintf+0x71a>
+                format--;
+  200d77:	48 83 ad 68 ff ff ff 	subq   $0x1,-0x98(%rbp)
+  200d7e:	01 
+            }
+            break;
+  200d7f:	90                   	nop
+        }
+
+        if (flags & FLAG_NUMERIC) {
+  200d80:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200d83:	83 e0 20             	and    $0x20,%eax
+  200d86:	85 c0                	test   %eax,%eax
+  200d88:	74 1e                	je     200da8 <printer_vprintf+0x743>
+            data = fill_numbuf(numbuf + NUMBUFSIZ, num, base);
+  200d8a:	48 8d 45 8c          	lea    -0x74(%rbp),%rax
+  200d8e:	48 83 c0 18          	add    $0x18,%rax
+  200d92:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  200d95:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  200d99:	48 89 ce             	mov    %rcx,%rsi
+  200d9c:	48 89 c7             	mov    %rax,%rdi
+  200d9f:	e8 39 f8 ff ff       	call   2005dd <fill_numbuf>
+  200da4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        }
+
+        const char* prefix = "";
+  200da8:	48 8d 05 17 0d 00 00 	lea    0xd17(%rip),%rax        # 201ac6 <flag_chars+0x6>
+  200daf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((flags & FLAG_NUMERIC) && (flags & FLAG_SIGNED)) {
+  200db3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200db6:	83 e0 20             	and    $0x20,%eax
+  200db9:	85 c0                	test   %eax,%eax
+  200dbb:	74 51                	je     200e0e <printer_vprintf+0x7a9>
+  200dbd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200dc0:	83 e0 40             	and    $0x40,%eax
+  200dc3:	85 c0                	test   %eax,%eax
+  200dc5:	74 47                	je     200e0e <printer_vprintf+0x7a9>
+            if (flags & FLAG_NEGATIVE) {
+  200dc7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200dca:	25 80 00 00 00       	and    $0x80,%eax
+  200dcf:	85 c0                	test   %eax,%eax
+  200dd1:	74 0d                	je     200de0 <printer_vprintf+0x77b>
+                prefix = "-";
+  200dd3:	48 8d 05 ed 0c 00 00 	lea    0xced(%rip),%rax        # 201ac7 <flag_chars+0x7>
+  200dda:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            if (flags & FLAG_NEGATIVE) {
+  200dde:	eb 7d                	jmp    200e5d <printer_vprintf+0x7f8>
+            } else if (flags & FLAG_PLUSPOSITIVE) {
+  200de0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200de3:	83 e0 10             	and    $0x10,%eax
+  200de6:	85 c0                	test   %eax,%eax
+  200de8:	74 0d                	je     200df7 <printer_vprintf+0x792>
+                prefix = "+";
+  200dea:	48 8d 05 d8 0c 00 00 	lea    0xcd8(%rip),%rax        # 201ac9 <flag_chars+0x9>
+  200df1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            if (flags & FLAG_NEGATIVE) {
+  200df5:	eb 66                	jmp    200e5d <printer_vprintf+0x7f8>
+            } else if (flags & FLAG_SPACEPOSITIVE) {
+  200df7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200dfa:	83 e0 08             	and    $0x8,%eax
+  200dfd:	85 c0                	test   %eax,%eax
+  200dff:	74 5c                	je     200e5d <printer_vprintf+0x7f8>
+                prefix = " ";
+  200e01:	48 8d 05 c3 0c 00 00 	lea    0xcc3(%rip),%rax        # 201acb <flag_chars+0xb>
+  200e08:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            if (flags & FLAG_NEGATIVE) {
+  200e0c:	eb 4f                	jmp    200e5d <printer_vprintf+0x7f8>
+            }
+        } else if ((flags & FLAG_NUMERIC) && (flags & FLAG_ALT)
+  200e0e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200e11:	83 e0 20             	and    $0x20,%eax
+  200e14:	85 c0                	test   %eax,%eax
+  200e16:	74 46                	je     200e5e <printer_vprintf+0x7f9>
+  200e18:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200e1b:	83 e0 01             	and    $0x1,%eax
+  200e1e:	85 c0                	test   %eax,%eax
+  200e20:	74 3c                	je     200e5e <printer_vprintf+0x7f9>
+                   && (base == 16 || base == -16)
+  200e22:	83 7d e0 10          	cmpl   $0x10,-0x20(%rbp)
+  200e26:	74 06                	je     200e2e <printer_vprintf+0x7c9>
+  200e28:	83 7d e0 f0          	cmpl   $0xfffffff0,-0x20(%rbp)
+  200e2c:	75 30                	jne    200e5e <printer_vprintf+0x7f9>
+                   && (num || (flags & FLAG_ALT2))) {
+  200e2e:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  200e33:	75 0c                	jne    200e41 <printer_vprintf+0x7dc>
+  200e35:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200e38:	25 00 01 00 00       	and    $0x100,%eax
+  200e3d:	85 c0                	test   %eax,%eax
+  200e3f:	74 1d                	je     200e5e <printer_vprintf+0x7f9>
+            prefix = (base == -16 ? "0x" : "0X");
+  200e41:	83 7d e0 f0          	cmpl   $0xfffffff0,-0x20(%rbp)
+  200e45:	75 09                	jne    200e50 <printer_vprintf+0x7eb>
+  200e47:	48 8d 05 7f 0c 00 00 	lea    0xc7f(%rip),%rax        # 201acd <flag_chars+0xd>
+  200e4e:	eb 07                	jmp    200e57 <printer_vprintf+0x7f2>
+  200e50:	48 8d 05 79 0c 00 00 	lea    0xc79(%rip),%rax        # 201ad0 <flag_chars+0x10>
+  200e57:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  200e5b:	eb 01                	jmp    200e5e <printer_vprintf+0x7f9>
+            if (flags & FLAG_NEGATIVE) {
+  200e5d:	90                   	nop
+        }
+
+        int len;
+        if (precision >= 0 && !(flags & FLAG_NUMERIC)) {
+  200e5e:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  200e62:	78 24                	js     200e88 <printer_vprintf+0x823>
+  200e64:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200e67:	83 e0 20             	and    $0x20,%eax
+  200e6a:	85 c0                	test   %eax,%eax
+  200e6c:	75 1a                	jne    200e88 <printer_vprintf+0x823>
+            len = strnlen(data, precision);
+  200e6e:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  200e71:	48 63 d0             	movslq %eax,%rdx
+  200e74:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200e78:	48 89 d6             	mov    %rdx,%rsi
+  200e7b:	48 89 c7             	mov    %rax,%rdi
+  200e7e:	e8 8a f5 ff ff       	call   20040d <strnlen>
+  200e83:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  200e86:	eb 0f                	jmp    200e97 <printer_vprintf+0x832>
+        } else {
+            len = strlen(data);
+  200e88:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200e8c:	48 89 c7             	mov    %rax,%rdi
+  200e8f:	e8 48 f5 ff ff       	call   2003dc <strlen>
+  200e94:	89 45 bc             	mov    %eax,-0x44(%rbp)
+        }
+        int zeros;
+        if ((flags & FLAG_NUMERIC) && precision >= 0) {
+  200e97:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200e9a:	83 e0 20             	and    $0x20,%eax
+  200e9d:	85 c0                	test   %eax,%eax
+  200e9f:	74 20                	je     200ec1 <printer_vprintf+0x85c>
+  200ea1:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  200ea5:	78 1a                	js     200ec1 <printer_vprintf+0x85c>
+            zeros = precision > len ? precision - len : 0;
+  200ea7:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  200eaa:	3b 45 bc             	cmp    -0x44(%rbp),%eax
+  200ead:	7e 08                	jle    200eb7 <printer_vprintf+0x852>
+  200eaf:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  200eb2:	2b 45 bc             	sub    -0x44(%rbp),%eax
+  200eb5:	eb 05                	jmp    200ebc <printer_vprintf+0x857>
+  200eb7:	b8 00 00 00 00       	mov    $0x0,%eax
+  200ebc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  200ebf:	eb 5c                	jmp    200f1d <printer_vprintf+0x8b8>
+        } else if ((flags & FLAG_NUMERIC) && (flags & FLAG_ZERO)
+  200ec1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200ec4:	83 e0 20             	and    $0x20,%eax
+  200ec7:	85 c0                	test   %eax,%eax
+  200ec9:	74 4b                	je     200f16 <printer_vprintf+0x8b1>
+  200ecb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200ece:	83 e0 02             	and    $0x2,%eax
+  200ed1:	85 c0                	test   %eax,%eax
+  200ed3:	74 41                	je     200f16 <printer_vprintf+0x8b1>
+                   && !(flags & FLAG_LEFTJUSTIFY)
+  200ed5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200ed8:	83 e0 04             	and    $0x4,%eax
+  200edb:	85 c0                	test   %eax,%eax
+  200edd:	75 37                	jne    200f16 <printer_vprintf+0x8b1>
+                   && len + (int) strlen(prefix) < width) {
+  200edf:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  200ee3:	48 89 c7             	mov    %rax,%rdi
+  200ee6:	e8 f1 f4 ff ff       	call   2003dc <strlen>
+  200eeb:	89 c2                	mov    %eax,%edx
+  200eed:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  200ef0:	01 d0                	add    %edx,%eax
+  200ef2:	39 45 e8             	cmp    %eax,-0x18(%rbp)
+  200ef5:	7e 1f                	jle    200f16 <printer_vprintf+0x8b1>
+            zeros = width - len - strlen(prefix);
+  200ef7:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  200efa:	2b 45 bc             	sub    -0x44(%rbp),%eax
+  200efd:	89 c3                	mov    %eax,%ebx
+  200eff:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  200f03:	48 89 c7             	mov    %rax,%rdi
+  200f06:	e8 d1 f4 ff ff       	call   2003dc <strlen>
+  200f0b:	89 c2                	mov    %eax,%edx
+  200f0d:	89 d8                	mov    %ebx,%eax
+  200f0f:	29 d0                	sub    %edx,%eax
+  200f11:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  200f14:	eb 07                	jmp    200f1d <printer_vprintf+0x8b8>
+        } else {
+            zeros = 0;
+  200f16:	c7 45 b8 00 00 00 00 	movl   $0x0,-0x48(%rbp)
+        }
+        width -= len + zeros + strlen(prefix);
+  200f1d:	8b 55 bc             	mov    -0x44(%rbp),%edx
+  200f20:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  200f23:	01 d0                	add    %edx,%eax
+  200f25:	48 63 d8             	movslq %eax,%rbx
+  200f28:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  200f2c:	48 89 c7             	mov    %rax,%rdi
+  200f2f:	e8 a8 f4 ff ff       	call   2003dc <strlen>
+  200f34:	48 8d 14 03          	lea    (%rbx,%rax,1),%rdx
+  200f38:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  200f3b:	29 d0                	sub    %edx,%eax
+  200f3d:	89 45 e8             	mov    %eax,-0x18(%rbp)
+        for (; !(flags & FLAG_LEFTJUSTIFY) && width > 0; --width) {
+  200f40:	eb 25                	jmp    200f67 <printer_vprintf+0x902>
+            p->putc(p, ' ', color);
+  200f42:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200f49:	48 8b 08             	mov    (%rax),%rcx
+  200f4c:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  200f52:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200f59:	be 20 00 00 00       	mov    $0x20,%esi
+  200f5e:	48 89 c7             	mov    %rax,%rdi
+  200f61:	ff d1                	call   *%rcx
+        for (; !(flags & FLAG_LEFTJUSTIFY) && width > 0; --width) {
+  200f63:	83 6d e8 01          	subl   $0x1,-0x18(%rbp)
+  200f67:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200f6a:	83 e0 04             	and    $0x4,%eax
+  200f6d:	85 c0                	test   %eax,%eax
+  200f6f:	75 36                	jne    200fa7 <printer_vprintf+0x942>
+  200f71:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  200f75:	7f cb                	jg     200f42 <printer_vprintf+0x8dd>
+        }
+        for (; *prefix; ++prefix) {
+  200f77:	eb 2e                	jmp    200fa7 <printer_vprintf+0x942>
+            p->putc(p, *prefix, color);
+  200f79:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200f80:	4c 8b 00             	mov    (%rax),%r8
+  200f83:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  200f87:	0f b6 00             	movzbl (%rax),%eax
+  200f8a:	0f b6 c8             	movzbl %al,%ecx
+  200f8d:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  200f93:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200f9a:	89 ce                	mov    %ecx,%esi
+  200f9c:	48 89 c7             	mov    %rax,%rdi
+  200f9f:	41 ff d0             	call   *%r8
+        for (; *prefix; ++prefix) {
+  200fa2:	48 83 45 c0 01       	addq   $0x1,-0x40(%rbp)
+  200fa7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  200fab:	0f b6 00             	movzbl (%rax),%eax
+  200fae:	84 c0                	test   %al,%al
+  200fb0:	75 c7                	jne    200f79 <printer_vprintf+0x914>
+        }
+        for (; zeros > 0; --zeros) {
+  200fb2:	eb 25                	jmp    200fd9 <printer_vprintf+0x974>
+            p->putc(p, '0', color);
+  200fb4:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200fbb:	48 8b 08             	mov    (%rax),%rcx
+  200fbe:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  200fc4:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200fcb:	be 30 00 00 00       	mov    $0x30,%esi
+  200fd0:	48 89 c7             	mov    %rax,%rdi
+  200fd3:	ff d1                	call   *%rcx
+        for (; zeros > 0; --zeros) {
+  200fd5:	83 6d b8 01          	subl   $0x1,-0x48(%rbp)
+  200fd9:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  200fdd:	7f d5                	jg     200fb4 <printer_vprintf+0x94f>
+        }
+        for (; len > 0; ++data, --len) {
+  200fdf:	eb 32                	jmp    201013 <printer_vprintf+0x9ae>
+            p->putc(p, *data, color);
+  200fe1:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200fe8:	4c 8b 00             	mov    (%rax),%r8
+  200feb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200fef:	0f b6 00             	movzbl (%rax),%eax
+  200ff2:	0f b6 c8             	movzbl %al,%ecx
+  200ff5:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  200ffb:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  201002:	89 ce                	mov    %ecx,%esi
+  201004:	48 89 c7             	mov    %rax,%rdi
+  201007:	41 ff d0             	call   *%r8
+        for (; len > 0; ++data, --len) {
+  20100a:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  20100f:	83 6d bc 01          	subl   $0x1,-0x44(%rbp)
+  201013:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+  201017:	7f c8                	jg     200fe1 <printer_vprintf+0x97c>
+        }
+        for (; width > 0; --width) {
+  201019:	eb 25                	jmp    201040 <printer_vprintf+0x9db>
+            p->putc(p, ' ', color);
+  20101b:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  201022:	48 8b 08             	mov    (%rax),%rcx
+  201025:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  20102b:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  201032:	be 20 00 00 00       	mov    $0x20,%esi
+  201037:	48 89 c7             	mov    %rax,%rdi
+  20103a:	ff d1                	call   *%rcx
+        for (; width > 0; --width) {
+  20103c:	83 6d e8 01          	subl   $0x1,-0x18(%rbp)
+  201040:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  201044:	7f d5                	jg     20101b <printer_vprintf+0x9b6>
+        }
+    done: ;
+  201046:	90                   	nop
+    for (; *format; ++format) {
+  201047:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  20104e:	01 
+  20104f:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  201056:	0f b6 00             	movzbl (%rax),%eax
+  201059:	84 c0                	test   %al,%al
+  20105b:	0f 85 30 f6 ff ff    	jne    200691 <printer_vprintf+0x2c>
+    }
+}
+  201061:	90                   	nop
+  201062:	90                   	nop
+  201063:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  201067:	c9                   	leave
+  201068:	c3                   	ret
+
+0000000000201069 <console_putc>:
+typedef struct console_printer {
+    printer p;
+    uint16_t* cursor;
+} console_printer;
+
+static void console_putc(printer* p, unsigned char c, int color) {
+  201069:	55                   	push   %rbp
+  20106a:	48 89 e5             	mov    %rsp,%rbp
+  20106d:	48 83 ec 30          	sub    $0x30,%rsp
+  201071:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  201075:	89 f0                	mov    %esi,%eax
+  201077:	89 55 d0             	mov    %edx,-0x30(%rbp)
+  20107a:	88 45 d4             	mov    %al,-0x2c(%rbp)
+    console_printer* cp = (console_printer*) p;
+  20107d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  201081:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    /*if (cp->cursor >= console + CONSOLE_ROWS * CONSOLE_COLUMNS) {
+        cp->cursor = console;
+    }*/
+    if (c == '\n') {
+  201085:	80 7d d4 0a          	cmpb   $0xa,-0x2c(%rbp)
+  201089:	75 7f                	jne    20110a <console_putc+0xa1>
+        int pos = (cp->cursor - console) % CONSOLE_COLUMNS;
+  20108b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20108f:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  201093:	48 8d 05 66 6f eb ff 	lea    -0x14909a(%rip),%rax        # b8000 <console>
+  20109a:	48 29 c2             	sub    %rax,%rdx
+  20109d:	48 89 d0             	mov    %rdx,%rax
+  2010a0:	48 d1 f8             	sar    %rax
+  2010a3:	48 89 c1             	mov    %rax,%rcx
+  2010a6:	48 ba 67 66 66 66 66 	movabs $0x6666666666666667,%rdx
+  2010ad:	66 66 66 
+  2010b0:	48 89 c8             	mov    %rcx,%rax
+  2010b3:	48 f7 ea             	imul   %rdx
+  2010b6:	48 c1 fa 05          	sar    $0x5,%rdx
+  2010ba:	48 89 c8             	mov    %rcx,%rax
+  2010bd:	48 c1 f8 3f          	sar    $0x3f,%rax
+  2010c1:	48 29 c2             	sub    %rax,%rdx
+  2010c4:	48 89 d0             	mov    %rdx,%rax
+  2010c7:	48 c1 e0 02          	shl    $0x2,%rax
+  2010cb:	48 01 d0             	add    %rdx,%rax
+  2010ce:	48 c1 e0 04          	shl    $0x4,%rax
+  2010d2:	48 29 c1             	sub    %rax,%rcx
+  2010d5:	48 89 ca             	mov    %rcx,%rdx
+  2010d8:	89 55 fc             	mov    %edx,-0x4(%rbp)
+        for (; pos != CONSOLE_COLUMNS; pos++) {
+  2010db:	eb 25                	jmp    201102 <console_putc+0x99>
+            *cp->cursor++ = ' ' | color;
+  2010dd:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  2010e0:	83 c8 20             	or     $0x20,%eax
+  2010e3:	89 c6                	mov    %eax,%esi
+  2010e5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2010e9:	48 8b 40 08          	mov    0x8(%rax),%rax
+  2010ed:	48 8d 48 02          	lea    0x2(%rax),%rcx
+  2010f1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  2010f5:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  2010f9:	89 f2                	mov    %esi,%edx
+  2010fb:	66 89 10             	mov    %dx,(%rax)
+        for (; pos != CONSOLE_COLUMNS; pos++) {
+  2010fe:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  201102:	83 7d fc 50          	cmpl   $0x50,-0x4(%rbp)
+  201106:	75 d5                	jne    2010dd <console_putc+0x74>
+  201108:	eb 69                	jmp    201173 <console_putc+0x10a>
+        }
+    } else if (c == '\b') {
+  20110a:	80 7d d4 08          	cmpb   $0x8,-0x2c(%rbp)
+  20110e:	75 3f                	jne    20114f <console_putc+0xe6>
+        if (cp->cursor != console) {
+  201110:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201114:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  201118:	48 8d 05 e1 6e eb ff 	lea    -0x14911f(%rip),%rax        # b8000 <console>
+  20111f:	48 39 c2             	cmp    %rax,%rdx
+  201122:	74 4f                	je     201173 <console_putc+0x10a>
+            *(--cp->cursor) = ' ' | color;
+  201124:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  201127:	83 c8 20             	or     $0x20,%eax
+  20112a:	89 c1                	mov    %eax,%ecx
+  20112c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201130:	48 8b 40 08          	mov    0x8(%rax),%rax
+  201134:	48 8d 50 fe          	lea    -0x2(%rax),%rdx
+  201138:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20113c:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  201140:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201144:	48 8b 40 08          	mov    0x8(%rax),%rax
+  201148:	89 ca                	mov    %ecx,%edx
+  20114a:	66 89 10             	mov    %dx,(%rax)
+  20114d:	eb 24                	jmp    201173 <console_putc+0x10a>
+        }
+    } else {
+        *cp->cursor++ = c | color;
+  20114f:	0f b6 45 d4          	movzbl -0x2c(%rbp),%eax
+  201153:	8b 55 d0             	mov    -0x30(%rbp),%edx
+  201156:	09 d0                	or     %edx,%eax
+  201158:	89 c6                	mov    %eax,%esi
+  20115a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20115e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  201162:	48 8d 48 02          	lea    0x2(%rax),%rcx
+  201166:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  20116a:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  20116e:	89 f2                	mov    %esi,%edx
+  201170:	66 89 10             	mov    %dx,(%rax)
+    }
+
+    const int MAX_ROWS = CONSOLE_ROWS - 2;
+  201173:	c7 45 e4 17 00 00 00 	movl   $0x17,-0x1c(%rbp)
+
+    if (cp->cursor == console + MAX_ROWS * CONSOLE_COLUMNS) {
+  20117a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20117e:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  201182:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  201185:	89 d0                	mov    %edx,%eax
+  201187:	c1 e0 02             	shl    $0x2,%eax
+  20118a:	01 d0                	add    %edx,%eax
+  20118c:	c1 e0 04             	shl    $0x4,%eax
+  20118f:	48 98                	cltq
+  201191:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  201195:	48 8d 05 64 6e eb ff 	lea    -0x14919c(%rip),%rax        # b8000 <console>
+  20119c:	48 01 d0             	add    %rdx,%rax
+  20119f:	48 39 c1             	cmp    %rax,%rcx
+  2011a2:	0f 85 ac 00 00 00    	jne    201254 <console_putc+0x1eb>
+        // Move all characters up by one row, forgetting the first row
+        for (int i = 0; i < (MAX_ROWS - 1) * CONSOLE_COLUMNS; ++i) {
+  2011a8:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  2011af:	eb 30                	jmp    2011e1 <console_putc+0x178>
+            console[i] = console[i + CONSOLE_COLUMNS];
+  2011b1:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  2011b4:	83 c0 50             	add    $0x50,%eax
+  2011b7:	48 98                	cltq
+  2011b9:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  2011bd:	48 8d 05 3c 6e eb ff 	lea    -0x1491c4(%rip),%rax        # b8000 <console>
+  2011c4:	0f b7 04 02          	movzwl (%rdx,%rax,1),%eax
+  2011c8:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  2011cb:	48 63 d2             	movslq %edx,%rdx
+  2011ce:	48 8d 0c 12          	lea    (%rdx,%rdx,1),%rcx
+  2011d2:	48 8d 15 27 6e eb ff 	lea    -0x1491d9(%rip),%rdx        # b8000 <console>
+  2011d9:	66 89 04 11          	mov    %ax,(%rcx,%rdx,1)
+        for (int i = 0; i < (MAX_ROWS - 1) * CONSOLE_COLUMNS; ++i) {
+  2011dd:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+  2011e1:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  2011e4:	8d 50 ff             	lea    -0x1(%rax),%edx
+  2011e7:	89 d0                	mov    %edx,%eax
+  2011e9:	c1 e0 02             	shl    $0x2,%eax
+  2011ec:	01 d0                	add    %edx,%eax
+  2011ee:	c1 e0 04             	shl    $0x4,%eax
+  2011f1:	39 45 f8             	cmp    %eax,-0x8(%rbp)
+  2011f4:	7c bb                	jl     2011b1 <console_putc+0x148>
+        }
+
+        // Fill last column with space
+        for (int i = (MAX_ROWS - 1) * CONSOLE_COLUMNS; i < MAX_ROWS * CONSOLE_COLUMNS; ++i) {
+  2011f6:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  2011f9:	8d 50 ff             	lea    -0x1(%rax),%edx
+  2011fc:	89 d0                	mov    %edx,%eax
+  2011fe:	c1 e0 02             	shl    $0x2,%eax
+  201201:	01 d0                	add    %edx,%eax
+  201203:	c1 e0 04             	shl    $0x4,%eax
+  201206:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  201209:	eb 20                	jmp    20122b <console_putc+0x1c2>
+            console[i] = ' ' | color;
+  20120b:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  20120e:	83 c8 20             	or     $0x20,%eax
+  201211:	89 c1                	mov    %eax,%ecx
+  201213:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  201216:	48 98                	cltq
+  201218:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  20121c:	48 8d 05 dd 6d eb ff 	lea    -0x149223(%rip),%rax        # b8000 <console>
+  201223:	66 89 0c 02          	mov    %cx,(%rdx,%rax,1)
+        for (int i = (MAX_ROWS - 1) * CONSOLE_COLUMNS; i < MAX_ROWS * CONSOLE_COLUMNS; ++i) {
+  201227:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  20122b:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  20122e:	89 d0                	mov    %edx,%eax
+  201230:	c1 e0 02             	shl    $0x2,%eax
+  201233:	01 d0                	add    %edx,%eax
+  201235:	c1 e0 04             	shl    $0x4,%eax
+  201238:	39 45 f4             	cmp    %eax,-0xc(%rbp)
+  20123b:	7c ce                	jl     20120b <console_putc+0x1a2>
+        }
+
+        cp->cursor -= CONSOLE_COLUMNS;
+  20123d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201241:	48 8b 40 08          	mov    0x8(%rax),%rax
+  201245:	48 8d 90 60 ff ff ff 	lea    -0xa0(%rax),%rdx
+  20124c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201250:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    }
+}
+  201254:	90                   	nop
+  201255:	c9                   	leave
+  201256:	c3                   	ret
+
+0000000000201257 <console_vprintf>:
+
+int console_vprintf(int cpos, int color, const char* format, va_list val) {
+  201257:	55                   	push   %rbp
+  201258:	48 89 e5             	mov    %rsp,%rbp
+  20125b:	48 83 ec 30          	sub    $0x30,%rsp
+  20125f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  201262:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  201265:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  201269:	48 89 4d d8          	mov    %rcx,-0x28(%rbp)
+    struct console_printer cp;
+    cp.p.putc = console_putc;
+  20126d:	48 8d 05 f5 fd ff ff 	lea    -0x20b(%rip),%rax        # 201069 <console_putc>
+  201274:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (cpos < 0 || cpos >= CONSOLE_ROWS * CONSOLE_COLUMNS) {
+  201278:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  20127c:	78 09                	js     201287 <console_vprintf+0x30>
+  20127e:	81 7d ec cf 07 00 00 	cmpl   $0x7cf,-0x14(%rbp)
+  201285:	7e 07                	jle    20128e <console_vprintf+0x37>
+        cpos = 0;
+  201287:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+    }
+    cp.cursor = console + cpos;
+  20128e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  201291:	48 98                	cltq
+  201293:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  201297:	48 8d 05 62 6d eb ff 	lea    -0x14929e(%rip),%rax        # b8000 <console>
+  20129e:	48 01 d0             	add    %rdx,%rax
+  2012a1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    printer_vprintf(&cp.p, color, format, val);
+  2012a5:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  2012a9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  2012ad:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  2012b0:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  2012b4:	48 89 c7             	mov    %rax,%rdi
+  2012b7:	e8 a9 f3 ff ff       	call   200665 <printer_vprintf>
+    return cp.cursor - console;
+  2012bc:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  2012c0:	48 8d 05 39 6d eb ff 	lea    -0x1492c7(%rip),%rax        # b8000 <console>
+  2012c7:	48 29 c2             	sub    %rax,%rdx
+  2012ca:	48 89 d0             	mov    %rdx,%rax
+  2012cd:	48 d1 f8             	sar    %rax
+}
+  2012d0:	c9                   	leave
+  2012d1:	c3                   	ret
+
+00000000002012d2 <console_printf>:
+
+int console_printf(int cpos, int color, const char* format, ...) {
+  2012d2:	55                   	push   %rbp
+  2012d3:	48 89 e5             	mov    %rsp,%rbp
+  2012d6:	48 83 ec 60          	sub    $0x60,%rsp
+  2012da:	89 7d ac             	mov    %edi,-0x54(%rbp)
+  2012dd:	89 75 a8             	mov    %esi,-0x58(%rbp)
+  2012e0:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+  2012e4:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  2012e8:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  2012ec:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list val;
+    va_start(val, format);
+  2012f0:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  2012f7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  2012fb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  2012ff:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  201303:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    cpos = console_vprintf(cpos, color, format, val);
+  201307:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  20130b:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  20130f:	8b 75 a8             	mov    -0x58(%rbp),%esi
+  201312:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  201315:	89 c7                	mov    %eax,%edi
+  201317:	e8 3b ff ff ff       	call   201257 <console_vprintf>
+  20131c:	89 45 ac             	mov    %eax,-0x54(%rbp)
+    va_end(val);
+    return cpos;
+  20131f:	8b 45 ac             	mov    -0x54(%rbp),%eax
+}
+  201322:	c9                   	leave
+  201323:	c3                   	ret
+
+0000000000201324 <string_putc>:
+    printer p;
+    char* s;
+    char* end;
+} string_printer;
+
+static void string_putc(printer* p, unsigned char c, int color) {
+  201324:	55                   	push   %rbp
+  201325:	48 89 e5             	mov    %rsp,%rbp
+  201328:	48 83 ec 20          	sub    $0x20,%rsp
+  20132c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  201330:	89 f0                	mov    %esi,%eax
+  201332:	89 55 e0             	mov    %edx,-0x20(%rbp)
+  201335:	88 45 e4             	mov    %al,-0x1c(%rbp)
+    string_printer* sp = (string_printer*) p;
+  201338:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20133c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (sp->s < sp->end) {
+  201340:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  201344:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  201348:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20134c:	48 8b 40 10          	mov    0x10(%rax),%rax
+  201350:	48 39 c2             	cmp    %rax,%rdx
+  201353:	73 1a                	jae    20136f <string_putc+0x4b>
+        *sp->s++ = c;
+  201355:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  201359:	48 8b 40 08          	mov    0x8(%rax),%rax
+  20135d:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  201361:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  201365:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  201369:	0f b6 55 e4          	movzbl -0x1c(%rbp),%edx
+  20136d:	88 10                	mov    %dl,(%rax)
+    }
+    (void) color;
+}
+  20136f:	90                   	nop
+  201370:	c9                   	leave
+  201371:	c3                   	ret
+
+0000000000201372 <vsnprintf>:
+
+int vsnprintf(char* s, size_t size, const char* format, va_list val) {
+  201372:	55                   	push   %rbp
+  201373:	48 89 e5             	mov    %rsp,%rbp
+  201376:	48 83 ec 40          	sub    $0x40,%rsp
+  20137a:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  20137e:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  201382:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  201386:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+    string_printer sp;
+    sp.p.putc = string_putc;
+  20138a:	48 8d 05 93 ff ff ff 	lea    -0x6d(%rip),%rax        # 201324 <string_putc>
+  201391:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    sp.s = s;
+  201395:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  201399:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (size) {
+  20139d:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  2013a2:	74 33                	je     2013d7 <vsnprintf+0x65>
+        sp.end = s + size - 1;
+  2013a4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  2013a8:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  2013ac:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  2013b0:	48 01 d0             	add    %rdx,%rax
+  2013b3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+        printer_vprintf(&sp.p, 0, format, val);
+  2013b7:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  2013bb:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  2013bf:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  2013c3:	be 00 00 00 00       	mov    $0x0,%esi
+  2013c8:	48 89 c7             	mov    %rax,%rdi
+  2013cb:	e8 95 f2 ff ff       	call   200665 <printer_vprintf>
+        *sp.s = 0;
+  2013d0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2013d4:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return sp.s - s;
+  2013d7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2013db:	48 2b 45 d8          	sub    -0x28(%rbp),%rax
+}
+  2013df:	c9                   	leave
+  2013e0:	c3                   	ret
+
+00000000002013e1 <snprintf>:
+
+int snprintf(char* s, size_t size, const char* format, ...) {
+  2013e1:	55                   	push   %rbp
+  2013e2:	48 89 e5             	mov    %rsp,%rbp
+  2013e5:	48 83 ec 70          	sub    $0x70,%rsp
+  2013e9:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  2013ed:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  2013f1:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  2013f5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  2013f9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  2013fd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list val;
+    va_start(val, format);
+  201401:	c7 45 b0 18 00 00 00 	movl   $0x18,-0x50(%rbp)
+  201408:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  20140c:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  201410:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  201414:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    int n = vsnprintf(s, size, format, val);
+  201418:	48 8d 4d b0          	lea    -0x50(%rbp),%rcx
+  20141c:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  201420:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  201424:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  201428:	48 89 c7             	mov    %rax,%rdi
+  20142b:	e8 42 ff ff ff       	call   201372 <vsnprintf>
+  201430:	89 45 cc             	mov    %eax,-0x34(%rbp)
+    va_end(val);
+    return n;
+  201433:	8b 45 cc             	mov    -0x34(%rbp),%eax
+}
+  201436:	c9                   	leave
+  201437:	c3                   	ret
+
+0000000000201438 <console_clear>:
+
+
+// console_clear
+//    Erases the console and moves the cursor to the upper left (CPOS(0, 0)).
+
+void console_clear(void) {
+  201438:	55                   	push   %rbp
+  201439:	48 89 e5             	mov    %rsp,%rbp
+  20143c:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < CONSOLE_ROWS * CONSOLE_COLUMNS; ++i) {
+  201440:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  201447:	eb 1a                	jmp    201463 <console_clear+0x2b>
+        console[i] = ' ' | 0x0700;
+  201449:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  20144c:	48 98                	cltq
+  20144e:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  201452:	48 8d 05 a7 6b eb ff 	lea    -0x149459(%rip),%rax        # b8000 <console>
+  201459:	66 c7 04 02 20 07    	movw   $0x720,(%rdx,%rax,1)
+    for (int i = 0; i < CONSOLE_ROWS * CONSOLE_COLUMNS; ++i) {
+  20145f:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  201463:	81 7d fc cf 07 00 00 	cmpl   $0x7cf,-0x4(%rbp)
+  20146a:	7e dd                	jle    201449 <console_clear+0x11>
+    }
+    cursorpos = 0;
+  20146c:	c7 05 86 7b eb ff 00 	movl   $0x0,-0x14847a(%rip)        # b8ffc <cursorpos>
+  201473:	00 00 00 
+}
+  201476:	90                   	nop
+  201477:	c9                   	leave
+  201478:	c3                   	ret
+
+0000000000201479 <string_to_char>:
+
+
+int string_to_char(const char *str, int *dest) {
+  201479:	55                   	push   %rbp
+  20147a:	48 89 e5             	mov    %rsp,%rbp
+  20147d:	48 83 ec 20          	sub    $0x20,%rsp
+  201481:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  201485:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    if (*str == '\0') return -1;
+  201489:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20148d:	0f b6 00             	movzbl (%rax),%eax
+  201490:	84 c0                	test   %al,%al
+  201492:	75 0a                	jne    20149e <string_to_char+0x25>
+  201494:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  201499:	e9 e0 00 00 00       	jmp    20157e <string_to_char+0x105>
+
+    *dest = 0;
+  20149e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  2014a2:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    for (; *str; str++) {
+  2014a8:	e9 bd 00 00 00       	jmp    20156a <string_to_char+0xf1>
+        int digit = 0;
+  2014ad:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+        switch (*str)
+  2014b4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2014b8:	0f b6 00             	movzbl (%rax),%eax
+  2014bb:	0f be c0             	movsbl %al,%eax
+  2014be:	83 e8 30             	sub    $0x30,%eax
+  2014c1:	83 f8 09             	cmp    $0x9,%eax
+  2014c4:	77 7c                	ja     201542 <string_to_char+0xc9>
+  2014c6:	89 c0                	mov    %eax,%eax
+  2014c8:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  2014cf:	00 
+  2014d0:	48 8d 05 dd 06 00 00 	lea    0x6dd(%rip),%rax        # 201bb4 <flag_chars+0xf4>
+  2014d7:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+  2014da:	48 98                	cltq
+  2014dc:	48 8d 15 d1 06 00 00 	lea    0x6d1(%rip),%rdx        # 201bb4 <flag_chars+0xf4>
+  2014e3:	48 01 d0             	add    %rdx,%rax
+  2014e6:	ff e0                	jmp    *%rax
+        {
+        case '0':
+            digit = 0;
+  2014e8:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+            break;
+  2014ef:	eb 58                	jmp    201549 <string_to_char+0xd0>
+        case '1':
+            digit = 1;
+  2014f1:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+            break;
+  2014f8:	eb 4f                	jmp    201549 <string_to_char+0xd0>
+        case '2':
+            digit = 2;
+  2014fa:	c7 45 fc 02 00 00 00 	movl   $0x2,-0x4(%rbp)
+            break;
+  201501:	eb 46                	jmp    201549 <string_to_char+0xd0>
+        case '3':
+            digit = 3;
+  201503:	c7 45 fc 03 00 00 00 	movl   $0x3,-0x4(%rbp)
+            break;
+  20150a:	eb 3d                	jmp    201549 <string_to_char+0xd0>
+        case '4':
+            digit = 4;
+  20150c:	c7 45 fc 04 00 00 00 	movl   $0x4,-0x4(%rbp)
+            break;
+  201513:	eb 34                	jmp    201549 <string_to_char+0xd0>
+        case '5':
+            digit = 5;
+  201515:	c7 45 fc 05 00 00 00 	movl   $0x5,-0x4(%rbp)
+            break;
+  20151c:	eb 2b                	jmp    201549 <string_to_char+0xd0>
+        case '6':
+            digit = 6;
+  20151e:	c7 45 fc 06 00 00 00 	movl   $0x6,-0x4(%rbp)
+            break;
+  201525:	eb 22                	jmp    201549 <string_to_char+0xd0>
+        case '7':
+            digit = 7;
+  201527:	c7 45 fc 07 00 00 00 	movl   $0x7,-0x4(%rbp)
+            break;
+  20152e:	eb 19                	jmp    201549 <string_to_char+0xd0>
+        case '8':
+            digit = 8;
+  201530:	c7 45 fc 08 00 00 00 	movl   $0x8,-0x4(%rbp)
+            break;
+  201537:	eb 10                	jmp    201549 <string_to_char+0xd0>
+        case '9':
+            digit = 9;
+  201539:	c7 45 fc 09 00 00 00 	movl   $0x9,-0x4(%rbp)
+            break;
+  201540:	eb 07                	jmp    201549 <string_to_char+0xd0>
+        default:
+            return -1;
+  201542:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  201547:	eb 35                	jmp    20157e <string_to_char+0x105>
+        }
+
+        *dest = *dest * 10 + digit;
+  201549:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  20154d:	8b 10                	mov    (%rax),%edx
+  20154f:	89 d0                	mov    %edx,%eax
+  201551:	c1 e0 02             	shl    $0x2,%eax
+  201554:	01 d0                	add    %edx,%eax
+  201556:	01 c0                	add    %eax,%eax
+  201558:	89 c2                	mov    %eax,%edx
+  20155a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  20155d:	01 c2                	add    %eax,%edx
+  20155f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  201563:	89 10                	mov    %edx,(%rax)
+    for (; *str; str++) {
+  201565:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  20156a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20156e:	0f b6 00             	movzbl (%rax),%eax
+  201571:	84 c0                	test   %al,%al
+  201573:	0f 85 34 ff ff ff    	jne    2014ad <string_to_char+0x34>
+    }
+
+    return 0;
+  201579:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  20157e:	c9                   	leave
+  20157f:	c3                   	ret
+
+0000000000201580 <atoi>:
+
+int atoi(const char *str) {
+  201580:	55                   	push   %rbp
+  201581:	48 89 e5             	mov    %rsp,%rbp
+  201584:	48 83 ec 18          	sub    $0x18,%rsp
+  201588:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    if (*str == '\0') return -1;
+  20158c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201590:	0f b6 00             	movzbl (%rax),%eax
+  201593:	84 c0                	test   %al,%al
+  201595:	75 0a                	jne    2015a1 <atoi+0x21>
+  201597:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  20159c:	e9 d7 00 00 00       	jmp    201678 <atoi+0xf8>
+
+    int n = 0;
+  2015a1:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    for (; *str; str++) {
+  2015a8:	e9 b7 00 00 00       	jmp    201664 <atoi+0xe4>
+        int digit = 0;
+  2015ad:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+        switch (*str)
+  2015b4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2015b8:	0f b6 00             	movzbl (%rax),%eax
+  2015bb:	0f be c0             	movsbl %al,%eax
+  2015be:	83 e8 30             	sub    $0x30,%eax
+  2015c1:	83 f8 09             	cmp    $0x9,%eax
+  2015c4:	77 7c                	ja     201642 <atoi+0xc2>
+  2015c6:	89 c0                	mov    %eax,%eax
+  2015c8:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  2015cf:	00 
+  2015d0:	48 8d 05 05 06 00 00 	lea    0x605(%rip),%rax        # 201bdc <flag_chars+0x11c>
+  2015d7:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+  2015da:	48 98                	cltq
+  2015dc:	48 8d 15 f9 05 00 00 	lea    0x5f9(%rip),%rdx        # 201bdc <flag_chars+0x11c>
+  2015e3:	48 01 d0             	add    %rdx,%rax
+  2015e6:	ff e0                	jmp    *%rax
+        {
+        case '0':
+            digit = 0;
+  2015e8:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+            break;
+  2015ef:	eb 58                	jmp    201649 <atoi+0xc9>
+        case '1':
+            digit = 1;
+  2015f1:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+            break;
+  2015f8:	eb 4f                	jmp    201649 <atoi+0xc9>
+        case '2':
+            digit = 2;
+  2015fa:	c7 45 f8 02 00 00 00 	movl   $0x2,-0x8(%rbp)
+            break;
+  201601:	eb 46                	jmp    201649 <atoi+0xc9>
+        case '3':
+            digit = 3;
+  201603:	c7 45 f8 03 00 00 00 	movl   $0x3,-0x8(%rbp)
+            break;
+  20160a:	eb 3d                	jmp    201649 <atoi+0xc9>
+        case '4':
+            digit = 4;
+  20160c:	c7 45 f8 04 00 00 00 	movl   $0x4,-0x8(%rbp)
+            break;
+  201613:	eb 34                	jmp    201649 <atoi+0xc9>
+        case '5':
+            digit = 5;
+  201615:	c7 45 f8 05 00 00 00 	movl   $0x5,-0x8(%rbp)
+            break;
+  20161c:	eb 2b                	jmp    201649 <atoi+0xc9>
+        case '6':
+            digit = 6;
+  20161e:	c7 45 f8 06 00 00 00 	movl   $0x6,-0x8(%rbp)
+            break;
+  201625:	eb 22                	jmp    201649 <atoi+0xc9>
+        case '7':
+            digit = 7;
+  201627:	c7 45 f8 07 00 00 00 	movl   $0x7,-0x8(%rbp)
+            break;
+  20162e:	eb 19                	jmp    201649 <atoi+0xc9>
+        case '8':
+            digit = 8;
+  201630:	c7 45 f8 08 00 00 00 	movl   $0x8,-0x8(%rbp)
+            break;
+  201637:	eb 10                	jmp    201649 <atoi+0xc9>
+        case '9':
+            digit = 9;
+  201639:	c7 45 f8 09 00 00 00 	movl   $0x9,-0x8(%rbp)
+            break;
+  201640:	eb 07                	jmp    201649 <atoi+0xc9>
+        default:
+            return -1;
+  201642:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  201647:	eb 2f                	jmp    201678 <atoi+0xf8>
+        }
+
+        n = n * 10 + digit;
+  201649:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  20164c:	89 d0                	mov    %edx,%eax
+  20164e:	c1 e0 02             	shl    $0x2,%eax
+  201651:	01 d0                	add    %edx,%eax
+  201653:	01 c0                	add    %eax,%eax
+  201655:	89 c2                	mov    %eax,%edx
+  201657:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  20165a:	01 d0                	add    %edx,%eax
+  20165c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    for (; *str; str++) {
+  20165f:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  201664:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201668:	0f b6 00             	movzbl (%rax),%eax
+  20166b:	84 c0                	test   %al,%al
+  20166d:	0f 85 3a ff ff ff    	jne    2015ad <atoi+0x2d>
+    }
+
+    return 0;
+  201673:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  201678:	c9                   	leave
+  201679:	c3                   	ret
+
+000000000020167a <copy_comp>:
+        components[ncomp++] = (comp); \
+    } \
+} while (0)
+
+// Helper to copy a component to dst
+void copy_comp(const char *start, const char *end, char **pdst) {
+  20167a:	55                   	push   %rbp
+  20167b:	48 89 e5             	mov    %rsp,%rbp
+  20167e:	48 83 ec 18          	sub    $0x18,%rsp
+  201682:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  201686:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  20168a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    while (start < end) {
+  20168e:	eb 23                	jmp    2016b3 <copy_comp+0x39>
+        *(*pdst)++ = *start++;
+  201690:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  201694:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  201698:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  20169c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2016a0:	48 8b 00             	mov    (%rax),%rax
+  2016a3:	48 8d 70 01          	lea    0x1(%rax),%rsi
+  2016a7:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  2016ab:	48 89 31             	mov    %rsi,(%rcx)
+  2016ae:	0f b6 12             	movzbl (%rdx),%edx
+  2016b1:	88 10                	mov    %dl,(%rax)
+    while (start < end) {
+  2016b3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2016b7:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  2016bb:	72 d3                	jb     201690 <copy_comp+0x16>
+    }
+}
+  2016bd:	90                   	nop
+  2016be:	90                   	nop
+  2016bf:	c9                   	leave
+  2016c0:	c3                   	ret
+
+00000000002016c1 <join_path>:
+
+
+void join_path(const char *abs_path, const char *path, char *dst) {
+  2016c1:	55                   	push   %rbp
+  2016c2:	48 89 e5             	mov    %rsp,%rbp
+  2016c5:	48 81 ec 68 02 00 00 	sub    $0x268,%rsp
+  2016cc:	48 89 bd a8 fd ff ff 	mov    %rdi,-0x258(%rbp)
+  2016d3:	48 89 b5 a0 fd ff ff 	mov    %rsi,-0x260(%rbp)
+  2016da:	48 89 95 98 fd ff ff 	mov    %rdx,-0x268(%rbp)
+    // If path is absolute, just copy it to dst (removing duplicate slashes, and trailing slash unless root)
+    if (path[0] == '/') {
+  2016e1:	48 8b 85 a0 fd ff ff 	mov    -0x260(%rbp),%rax
+  2016e8:	0f b6 00             	movzbl (%rax),%eax
+  2016eb:	3c 2f                	cmp    $0x2f,%al
+  2016ed:	0f 85 d6 00 00 00    	jne    2017c9 <join_path+0x108>
+        const char *src = path;
+  2016f3:	48 8b 85 a0 fd ff ff 	mov    -0x260(%rbp),%rax
+  2016fa:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+        char *d = dst;
+  2016fe:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  201705:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+        // Always start with a single slash
+        *d++ = '/';
+  201709:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  20170d:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  201711:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  201715:	c6 00 2f             	movb   $0x2f,(%rax)
+        src++;
+  201718:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+        int last_was_slash = 1;
+  20171d:	c7 45 b0 01 00 00 00 	movl   $0x1,-0x50(%rbp)
+        while (*src) {
+  201724:	eb 64                	jmp    20178a <join_path+0xc9>
+            if (*src == '/') {
+  201726:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20172a:	0f b6 00             	movzbl (%rax),%eax
+  20172d:	3c 2f                	cmp    $0x2f,%al
+  20172f:	75 35                	jne    201766 <join_path+0xa5>
+                // Skip consecutive slashes
+                while (*src == '/') src++;
+  201731:	eb 05                	jmp    201738 <join_path+0x77>
+  201733:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  201738:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20173c:	0f b6 00             	movzbl (%rax),%eax
+  20173f:	3c 2f                	cmp    $0x2f,%al
+  201741:	74 f0                	je     201733 <join_path+0x72>
+                if (*src == 0) break;
+  201743:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  201747:	0f b6 00             	movzbl (%rax),%eax
+  20174a:	84 c0                	test   %al,%al
+  20174c:	74 49                	je     201797 <join_path+0xd6>
+                *d++ = '/';
+  20174e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  201752:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  201756:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  20175a:	c6 00 2f             	movb   $0x2f,(%rax)
+                last_was_slash = 1;
+  20175d:	c7 45 b0 01 00 00 00 	movl   $0x1,-0x50(%rbp)
+  201764:	eb 24                	jmp    20178a <join_path+0xc9>
+            } else {
+                *d++ = *src++;
+  201766:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  20176a:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  20176e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  201772:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  201776:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  20177a:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  20177e:	0f b6 12             	movzbl (%rdx),%edx
+  201781:	88 10                	mov    %dl,(%rax)
+                last_was_slash = 0;
+  201783:	c7 45 b0 00 00 00 00 	movl   $0x0,-0x50(%rbp)
+        while (*src) {
+  20178a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20178e:	0f b6 00             	movzbl (%rax),%eax
+  201791:	84 c0                	test   %al,%al
+  201793:	75 91                	jne    201726 <join_path+0x65>
+  201795:	eb 01                	jmp    201798 <join_path+0xd7>
+                if (*src == 0) break;
+  201797:	90                   	nop
+            }
+        }
+        // Remove trailing slash unless the path is just "/"
+        if (d > dst + 1 && *(d-1) == '/') {
+  201798:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  20179f:	48 83 c0 01          	add    $0x1,%rax
+  2017a3:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  2017a7:	73 14                	jae    2017bd <join_path+0xfc>
+  2017a9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2017ad:	48 83 e8 01          	sub    $0x1,%rax
+  2017b1:	0f b6 00             	movzbl (%rax),%eax
+  2017b4:	3c 2f                	cmp    $0x2f,%al
+  2017b6:	75 05                	jne    2017bd <join_path+0xfc>
+            d--;
+  2017b8:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+        }
+        *d = 0;
+  2017bd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2017c1:	c6 00 00             	movb   $0x0,(%rax)
+  2017c4:	e9 e9 02 00 00       	jmp    201ab2 <join_path+0x3f1>
+        return;
+    }
+
+    // Otherwise, start with abs_path
+    const char *src = abs_path;
+  2017c9:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  2017d0:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    char *d = dst;
+  2017d4:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  2017db:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    if (*src != '/') {
+  2017df:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2017e3:	0f b6 00             	movzbl (%rax),%eax
+  2017e6:	3c 2f                	cmp    $0x2f,%al
+  2017e8:	74 2e                	je     201818 <join_path+0x157>
+        *d++ = '/';
+  2017ea:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  2017ee:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  2017f2:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  2017f6:	c6 00 2f             	movb   $0x2f,(%rax)
+    }
+    while (*src) {
+  2017f9:	eb 1d                	jmp    201818 <join_path+0x157>
+        *d++ = *src++;
+  2017fb:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  2017ff:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  201803:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  201807:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  20180b:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  20180f:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  201813:	0f b6 12             	movzbl (%rdx),%edx
+  201816:	88 10                	mov    %dl,(%rax)
+    while (*src) {
+  201818:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20181c:	0f b6 00             	movzbl (%rax),%eax
+  20181f:	84 c0                	test   %al,%al
+  201821:	75 d8                	jne    2017fb <join_path+0x13a>
+    }
+    // Remove trailing slash (unless root)
+    if (d > dst + 1 && *(d-1) == '/') {
+  201823:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  20182a:	48 83 c0 01          	add    $0x1,%rax
+  20182e:	48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+  201832:	73 14                	jae    201848 <join_path+0x187>
+  201834:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  201838:	48 83 e8 01          	sub    $0x1,%rax
+  20183c:	0f b6 00             	movzbl (%rax),%eax
+  20183f:	3c 2f                	cmp    $0x2f,%al
+  201841:	75 05                	jne    201848 <join_path+0x187>
+        d--;
+  201843:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+    }
+    *d = 0;
+  201848:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  20184c:	c6 00 00             	movb   $0x0,(%rax)
+
+    // Now, process path components
+    char temp[512];
+    int tlen = 0;
+  20184f:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    // Copy dst to temp for easier manipulation
+    src = dst;
+  201856:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  20185d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    while (*src && tlen < (int)sizeof(temp)-1) {
+  201861:	eb 22                	jmp    201885 <join_path+0x1c4>
+        temp[tlen++] = *src++;
+  201863:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201867:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  20186b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  20186f:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  201872:	8d 4a 01             	lea    0x1(%rdx),%ecx
+  201875:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  201878:	0f b6 08             	movzbl (%rax),%ecx
+  20187b:	48 63 c2             	movslq %edx,%rax
+  20187e:	88 8c 05 b0 fd ff ff 	mov    %cl,-0x250(%rbp,%rax,1)
+    while (*src && tlen < (int)sizeof(temp)-1) {
+  201885:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201889:	0f b6 00             	movzbl (%rax),%eax
+  20188c:	84 c0                	test   %al,%al
+  20188e:	74 09                	je     201899 <join_path+0x1d8>
+  201890:	81 7d dc fe 01 00 00 	cmpl   $0x1fe,-0x24(%rbp)
+  201897:	7e ca                	jle    201863 <join_path+0x1a2>
+    }
+    temp[tlen] = 0;
+  201899:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  20189c:	48 98                	cltq
+  20189e:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  2018a5:	00 
+
+    // Now, process each component in path
+    src = path;
+  2018a6:	48 8b 85 a0 fd ff ff 	mov    -0x260(%rbp),%rax
+  2018ad:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    while (*src) {
+  2018b1:	e9 65 01 00 00       	jmp    201a1b <join_path+0x35a>
+        // Skip slashes
+        while (*src == '/') src++;
+  2018b6:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  2018bb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2018bf:	0f b6 00             	movzbl (%rax),%eax
+  2018c2:	3c 2f                	cmp    $0x2f,%al
+  2018c4:	74 f0                	je     2018b6 <join_path+0x1f5>
+        if (!*src) break;
+  2018c6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2018ca:	0f b6 00             	movzbl (%rax),%eax
+  2018cd:	84 c0                	test   %al,%al
+  2018cf:	0f 84 57 01 00 00    	je     201a2c <join_path+0x36b>
+
+        // Find end of component
+        const char *comp_start = src;
+  2018d5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2018d9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        while (*src && *src != '/') src++;
+  2018dd:	eb 05                	jmp    2018e4 <join_path+0x223>
+  2018df:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  2018e4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2018e8:	0f b6 00             	movzbl (%rax),%eax
+  2018eb:	84 c0                	test   %al,%al
+  2018ed:	74 0b                	je     2018fa <join_path+0x239>
+  2018ef:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2018f3:	0f b6 00             	movzbl (%rax),%eax
+  2018f6:	3c 2f                	cmp    $0x2f,%al
+  2018f8:	75 e5                	jne    2018df <join_path+0x21e>
+        const char *comp_end = src;
+  2018fa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2018fe:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+
+        int comp_len = comp_end - comp_start;
+  201902:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  201906:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  20190a:	89 45 b4             	mov    %eax,-0x4c(%rbp)
+
+        // Get component string
+        if (comp_len == 1 && comp_start[0] == '.') {
+  20190d:	83 7d b4 01          	cmpl   $0x1,-0x4c(%rbp)
+  201911:	75 10                	jne    201923 <join_path+0x262>
+  201913:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  201917:	0f b6 00             	movzbl (%rax),%eax
+  20191a:	3c 2e                	cmp    $0x2e,%al
+  20191c:	75 05                	jne    201923 <join_path+0x262>
+            // Ignore
+            continue;
+  20191e:	e9 f8 00 00 00       	jmp    201a1b <join_path+0x35a>
+        } else if (comp_len == 2 && comp_start[0] == '.' && comp_start[1] == '.') {
+  201923:	83 7d b4 02          	cmpl   $0x2,-0x4c(%rbp)
+  201927:	75 6e                	jne    201997 <join_path+0x2d6>
+  201929:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  20192d:	0f b6 00             	movzbl (%rax),%eax
+  201930:	3c 2e                	cmp    $0x2e,%al
+  201932:	75 63                	jne    201997 <join_path+0x2d6>
+  201934:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  201938:	48 83 c0 01          	add    $0x1,%rax
+  20193c:	0f b6 00             	movzbl (%rax),%eax
+  20193f:	3c 2e                	cmp    $0x2e,%al
+  201941:	75 54                	jne    201997 <join_path+0x2d6>
+            // Go up one directory, unless at root
+            if (tlen > 1) {
+  201943:	83 7d dc 01          	cmpl   $0x1,-0x24(%rbp)
+  201947:	0f 8e ce 00 00 00    	jle    201a1b <join_path+0x35a>
+                // Remove trailing slash if any
+                if (temp[tlen-1] == '/') tlen--;
+  20194d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201950:	83 e8 01             	sub    $0x1,%eax
+  201953:	48 98                	cltq
+  201955:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  20195c:	ff 
+  20195d:	3c 2f                	cmp    $0x2f,%al
+  20195f:	75 0a                	jne    20196b <join_path+0x2aa>
+  201961:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+                // Remove last component
+                while (tlen > 1 && temp[tlen-1] != '/') tlen--;
+  201965:	eb 04                	jmp    20196b <join_path+0x2aa>
+  201967:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  20196b:	83 7d dc 01          	cmpl   $0x1,-0x24(%rbp)
+  20196f:	7e 14                	jle    201985 <join_path+0x2c4>
+  201971:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201974:	83 e8 01             	sub    $0x1,%eax
+  201977:	48 98                	cltq
+  201979:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  201980:	ff 
+  201981:	3c 2f                	cmp    $0x2f,%al
+  201983:	75 e2                	jne    201967 <join_path+0x2a6>
+                temp[tlen] = 0;
+  201985:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201988:	48 98                	cltq
+  20198a:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  201991:	00 
+            if (tlen > 1) {
+  201992:	e9 84 00 00 00       	jmp    201a1b <join_path+0x35a>
+            }
+        } else if (comp_len > 0) {
+  201997:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  20199b:	7e 7e                	jle    201a1b <join_path+0x35a>
+            // Add slash if not at root
+            if (tlen == 0 || temp[tlen-1] != '/') {
+  20199d:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  2019a1:	74 14                	je     2019b7 <join_path+0x2f6>
+  2019a3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  2019a6:	83 e8 01             	sub    $0x1,%eax
+  2019a9:	48 98                	cltq
+  2019ab:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  2019b2:	ff 
+  2019b3:	3c 2f                	cmp    $0x2f,%al
+  2019b5:	74 1c                	je     2019d3 <join_path+0x312>
+                if (tlen < (int)sizeof(temp)-1) temp[tlen++] = '/';
+  2019b7:	81 7d dc fe 01 00 00 	cmpl   $0x1fe,-0x24(%rbp)
+  2019be:	7f 13                	jg     2019d3 <join_path+0x312>
+  2019c0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  2019c3:	8d 50 01             	lea    0x1(%rax),%edx
+  2019c6:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  2019c9:	48 98                	cltq
+  2019cb:	c6 84 05 b0 fd ff ff 	movb   $0x2f,-0x250(%rbp,%rax,1)
+  2019d2:	2f 
+            }
+            // Copy component
+            for (const char *p = comp_start; p < comp_end && tlen < (int)sizeof(temp)-1; ++p) {
+  2019d3:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  2019d7:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  2019db:	eb 1e                	jmp    2019fb <join_path+0x33a>
+                temp[tlen++] = *p;
+  2019dd:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  2019e0:	8d 50 01             	lea    0x1(%rax),%edx
+  2019e3:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  2019e6:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  2019ea:	0f b6 12             	movzbl (%rdx),%edx
+  2019ed:	48 98                	cltq
+  2019ef:	88 94 05 b0 fd ff ff 	mov    %dl,-0x250(%rbp,%rax,1)
+            for (const char *p = comp_start; p < comp_end && tlen < (int)sizeof(temp)-1; ++p) {
+  2019f6:	48 83 45 d0 01       	addq   $0x1,-0x30(%rbp)
+  2019fb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  2019ff:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  201a03:	73 09                	jae    201a0e <join_path+0x34d>
+  201a05:	81 7d dc fe 01 00 00 	cmpl   $0x1fe,-0x24(%rbp)
+  201a0c:	7e cf                	jle    2019dd <join_path+0x31c>
+            }
+            temp[tlen] = 0;
+  201a0e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201a11:	48 98                	cltq
+  201a13:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  201a1a:	00 
+    while (*src) {
+  201a1b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201a1f:	0f b6 00             	movzbl (%rax),%eax
+  201a22:	84 c0                	test   %al,%al
+  201a24:	0f 85 91 fe ff ff    	jne    2018bb <join_path+0x1fa>
+  201a2a:	eb 01                	jmp    201a2d <join_path+0x36c>
+        if (!*src) break;
+  201a2c:	90                   	nop
+        }
+    }
+
+    // If temp is empty, set to "/"
+    if (tlen == 0) {
+  201a2d:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  201a31:	75 20                	jne    201a53 <join_path+0x392>
+        temp[tlen++] = '/';
+  201a33:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201a36:	8d 50 01             	lea    0x1(%rax),%edx
+  201a39:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  201a3c:	48 98                	cltq
+  201a3e:	c6 84 05 b0 fd ff ff 	movb   $0x2f,-0x250(%rbp,%rax,1)
+  201a45:	2f 
+        temp[tlen] = 0;
+  201a46:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201a49:	48 98                	cltq
+  201a4b:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  201a52:	00 
+    }
+
+    // Remove trailing slash unless the path is just "/"
+    if (tlen > 1 && temp[tlen-1] == '/') {
+  201a53:	83 7d dc 01          	cmpl   $0x1,-0x24(%rbp)
+  201a57:	7e 25                	jle    201a7e <join_path+0x3bd>
+  201a59:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201a5c:	83 e8 01             	sub    $0x1,%eax
+  201a5f:	48 98                	cltq
+  201a61:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  201a68:	ff 
+  201a69:	3c 2f                	cmp    $0x2f,%al
+  201a6b:	75 11                	jne    201a7e <join_path+0x3bd>
+        temp[--tlen] = 0;
+  201a6d:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  201a71:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201a74:	48 98                	cltq
+  201a76:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  201a7d:	00 
+    }
+
+    // Copy temp to dst
+    for (int i = 0; i <= tlen; ++i) {
+  201a7e:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  201a85:	eb 23                	jmp    201aaa <join_path+0x3e9>
+        dst[i] = temp[i];
+  201a87:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  201a8a:	48 63 d0             	movslq %eax,%rdx
+  201a8d:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  201a94:	48 01 c2             	add    %rax,%rdx
+  201a97:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  201a9a:	48 98                	cltq
+  201a9c:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  201aa3:	ff 
+  201aa4:	88 02                	mov    %al,(%rdx)
+    for (int i = 0; i <= tlen; ++i) {
+  201aa6:	83 45 cc 01          	addl   $0x1,-0x34(%rbp)
+  201aaa:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  201aad:	3b 45 dc             	cmp    -0x24(%rbp),%eax
+  201ab0:	7e d5                	jle    201a87 <join_path+0x3c6>
+    }
+}
+  201ab2:	c9                   	leave
+  201ab3:	c3                   	ret
@@ -0,0 +1,3632 @@
+
+obj/p-cat.full:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000200000 <submit>:
+#define BATCH_SIZE 32
+
+static io_ring* ring = (io_ring*) IORING_ADDR;
+
+static void submit(uint32_t op, int fd, const void* addr, size_t len,
+                   void* arg, uint64_t user_data) {
+  200000:	55                   	push   %rbp
+  200001:	48 89 e5             	mov    %rsp,%rbp
+  200004:	53                   	push   %rbx
+  200005:	89 fb                	mov    %edi,%ebx
+  200007:	41 89 f3             	mov    %esi,%r11d
+  20000a:	49 89 d2             	mov    %rdx,%r10
+  20000d:	48 89 cf             	mov    %rcx,%rdi
+    io_sqe* sqe = &ring->sq[ring->sq_tail % IORING_ENTRIES];
+  200010:	8b 0c 25 04 20 24 00 	mov    0x242004,%ecx
+    sqe->op = op;
+  200017:	89 ca                	mov    %ecx,%edx
+  200019:	83 e2 3f             	and    $0x3f,%edx
+  20001c:	48 8d 04 95 00 00 00 	lea    0x0(,%rdx,4),%rax
+  200023:	00 
+  200024:	48 8d 34 10          	lea    (%rax,%rdx,1),%rsi
+  200028:	89 1c f5 10 20 24 00 	mov    %ebx,0x242010(,%rsi,8)
+    sqe->fd = fd;
+  20002f:	44 89 1c f5 14 20 24 	mov    %r11d,0x242014(,%rsi,8)
+  200036:	00 
+    sqe->addr = (uintptr_t) addr;
+  200037:	4c 89 14 f5 18 20 24 	mov    %r10,0x242018(,%rsi,8)
+  20003e:	00 
+    sqe->len = len;
+  20003f:	48 89 3c f5 20 20 24 	mov    %rdi,0x242020(,%rsi,8)
+  200046:	00 
+    sqe->arg = (uintptr_t) arg;
+  200047:	4c 89 04 f5 28 20 24 	mov    %r8,0x242028(,%rsi,8)
+  20004e:	00 
+    sqe->user_data = user_data;
+  20004f:	4c 89 0c f5 30 20 24 	mov    %r9,0x242030(,%rsi,8)
+  200056:	00 
+    ++ring->sq_tail;
+  200057:	83 c1 01             	add    $0x1,%ecx
+  20005a:	89 0c 25 04 20 24 00 	mov    %ecx,0x242004
+}
+  200061:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  200065:	c9                   	leave
+  200066:	c3                   	ret
+
+0000000000200067 <complete>:
+
+// complete(res)
+//    Run the queued requests, storing each result in `res[user_data]`.
+static void complete(int64_t* res) {
+    while (ring->sq_head != ring->sq_tail) {
+  200067:	8b 04 25 04 20 24 00 	mov    0x242004,%eax
+  20006e:	39 04 25 00 20 24 00 	cmp    %eax,0x242000
+  200075:	74 5f                	je     2000d6 <complete+0x6f>
+// sys_ioring_enter()
+//    Run the requests queued in the I/O ring, while the completion ring has
+//    room. Returns the number of requests run.
+static inline int sys_ioring_enter(void) {
+    int result;
+    asm volatile ("syscall" : "=a" (result)
+  200077:	be 4b 00 00 00       	mov    $0x4b,%esi
+        int r = sys_ioring_enter();
+        if (r < 0) handle_error(-r);
+        for (; ring->cq_head != ring->cq_tail; ++ring->cq_head) {
+  20007c:	ba 00 20 24 00       	mov    $0x242000,%edx
+  200081:	eb 14                	jmp    200097 <complete+0x30>
+static void complete(int64_t* res) {
+  200083:	55                   	push   %rbp
+  200084:	48 89 e5             	mov    %rsp,%rbp
+        if (r < 0) handle_error(-r);
+  200087:	f7 d8                	neg    %eax
+  200089:	89 c7                	mov    %eax,%edi
+  20008b:	e8 6e 22 00 00       	call   2022fe <handle_error>
+    while (ring->sq_head != ring->sq_tail) {
+  200090:	8b 42 04             	mov    0x4(%rdx),%eax
+  200093:	39 02                	cmp    %eax,(%rdx)
+  200095:	74 3f                	je     2000d6 <complete+0x6f>
+  200097:	89 f0                	mov    %esi,%eax
+  200099:	0f 05                	syscall
+        if (r < 0) handle_error(-r);
+  20009b:	85 c0                	test   %eax,%eax
+  20009d:	78 e4                	js     200083 <complete+0x1c>
+        for (; ring->cq_head != ring->cq_tail; ++ring->cq_head) {
+  20009f:	8b 42 08             	mov    0x8(%rdx),%eax
+  2000a2:	3b 42 0c             	cmp    0xc(%rdx),%eax
+  2000a5:	74 e9                	je     200090 <complete+0x29>
+            io_cqe* cqe = &ring->cq[ring->cq_head % IORING_ENTRIES];
+            res[cqe->user_data] = cqe->res;
+  2000a7:	83 e0 3f             	and    $0x3f,%eax
+  2000aa:	48 c1 e0 04          	shl    $0x4,%rax
+  2000ae:	48 8b 88 18 2a 24 00 	mov    0x242a18(%rax),%rcx
+  2000b5:	48 05 00 20 24 00    	add    $0x242000,%rax
+  2000bb:	48 8b 80 10 0a 00 00 	mov    0xa10(%rax),%rax
+  2000c2:	48 89 0c c7          	mov    %rcx,(%rdi,%rax,8)
+        for (; ring->cq_head != ring->cq_tail; ++ring->cq_head) {
+  2000c6:	8b 42 08             	mov    0x8(%rdx),%eax
+  2000c9:	83 c0 01             	add    $0x1,%eax
+  2000cc:	89 42 08             	mov    %eax,0x8(%rdx)
+  2000cf:	3b 42 0c             	cmp    0xc(%rdx),%eax
+  2000d2:	75 d3                	jne    2000a7 <complete+0x40>
+  2000d4:	eb ba                	jmp    200090 <complete+0x29>
+  2000d6:	c3                   	ret
+
+00000000002000d7 <usage>:
+void __attribute__((noreturn)) usage(void) {
+  2000d7:	55                   	push   %rbp
+  2000d8:	48 89 e5             	mov    %rsp,%rbp
+    app_printf(0, "%s", usage_str);
+  2000db:	48 8b 15 1e 2f 00 00 	mov    0x2f1e(%rip),%rdx        # 203000 <usage_str>
+  2000e2:	48 8d 35 b7 22 00 00 	lea    0x22b7(%rip),%rsi        # 2023a0 <malloc+0x87>
+  2000e9:	bf 00 00 00 00       	mov    $0x0,%edi
+  2000ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  2000f3:	e8 d2 1c 00 00       	call   201dca <app_printf>
+// sys_exit()
+//    Exit this process. Does not return.
+static inline void sys_exit(int exit_code) __attribute__((noreturn));
+static inline void sys_exit(int exit_code) {
+    uint64_t rax;
+    asm volatile ("syscall" : "=a" (rax)
+  2000f8:	b8 40 00 00 00       	mov    $0x40,%eax
+  2000fd:	bf 01 00 00 00       	mov    $0x1,%edi
+  200102:	0f 05                	syscall
+                  : "a" (INT_SYS_EXIT), "D" /* %rdi */ (exit_code)
+                  : "rcx", "r11", "cc", "memory");
+ spinloop: goto spinloop;       // should never get here
+  200104:	eb fe                	jmp    200104 <usage+0x2d>
+
+0000000000200106 <process_main>:
+        }
+    }
+}
+
+
+void process_main(int argc, char* argv[]) {
+  200106:	55                   	push   %rbp
+  200107:	48 89 e5             	mov    %rsp,%rbp
+  20010a:	41 57                	push   %r15
+  20010c:	41 56                	push   %r14
+  20010e:	41 55                	push   %r13
+  200110:	41 54                	push   %r12
+  200112:	53                   	push   %rbx
+  200113:	48 83 ec 28          	sub    $0x28,%rsp
+    if (argc <= 1) usage();
+  200117:	83 ff 01             	cmp    $0x1,%edi
+  20011a:	0f 8e d5 00 00 00    	jle    2001f5 <process_main+0xef>
+  200120:	89 fb                	mov    %edi,%ebx
+  200122:	49 89 f6             	mov    %rsi,%r14
+    
+    int read_count = 0;
+  200125:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+
+    if (argc == 2) {
+  20012c:	83 ff 02             	cmp    $0x2,%edi
+  20012f:	0f 85 c5 00 00 00    	jne    2001fa <process_main+0xf4>
+        argc++;
+  200135:	bb 03 00 00 00       	mov    $0x3,%ebx
+    asm volatile ("syscall" : "=a" (result)
+  20013a:	b8 4a 00 00 00       	mov    $0x4a,%eax
+  20013f:	bf 00 20 24 00       	mov    $0x242000,%edi
+  200144:	0f 05                	syscall
+    }
+
+    //app_printf(0, "read_count : %d\n", read_count);
+
+    int r = sys_ioring_setup(ring);
+    if (r < 0) handle_error(-r);
+  200146:	85 c0                	test   %eax,%eax
+  200148:	0f 88 d5 00 00 00    	js     200223 <process_main+0x11d>
+
+    static int64_t fds[BATCH_SIZE], counts[BATCH_SIZE];
+    static struct stat st[BATCH_SIZE];
+    static char *bufs[BATCH_SIZE];
+
+    for (int first = 1; first < argc-1; first += BATCH_SIZE) {
+  20014e:	8d 4b ff             	lea    -0x1(%rbx),%ecx
+  200151:	83 f9 01             	cmp    $0x1,%ecx
+  200154:	0f 8e 61 02 00 00    	jle    2003bb <process_main+0x2b5>
+  20015a:	8d 43 fe             	lea    -0x2(%rbx),%eax
+  20015d:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  200160:	49 83 c6 08          	add    $0x8,%r14
+  200164:	c7 45 b8 01 00 00 00 	movl   $0x1,-0x48(%rbp)
+        int n = MIN(argc-1 - first, BATCH_SIZE);
+
+        for (int i = 0; i < n; i++) {
+            submit(IORING_OP_OPEN, 0, argv[first+i], 0, NULL, i);
+        }
+        complete(fds);
+  20016b:	89 4d b0             	mov    %ecx,-0x50(%rbp)
+        int n = MIN(argc-1 - first, BATCH_SIZE);
+  20016e:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  200171:	89 45 b4             	mov    %eax,-0x4c(%rbp)
+  200174:	bb 20 00 00 00       	mov    $0x20,%ebx
+  200179:	39 d8                	cmp    %ebx,%eax
+  20017b:	0f 4e d8             	cmovle %eax,%ebx
+        for (int i = 0; i < n; i++) {
+  20017e:	85 c0                	test   %eax,%eax
+  200180:	0f 8e 3f 01 00 00    	jle    2002c5 <process_main+0x1bf>
+  200186:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            submit(IORING_OP_OPEN, 0, argv[first+i], 0, NULL, i);
+  20018c:	4b 8b 14 e6          	mov    (%r14,%r12,8),%rdx
+  200190:	4d 89 e1             	mov    %r12,%r9
+  200193:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  200199:	b9 00 00 00 00       	mov    $0x0,%ecx
+  20019e:	be 00 00 00 00       	mov    $0x0,%esi
+  2001a3:	bf 01 00 00 00       	mov    $0x1,%edi
+  2001a8:	e8 53 fe ff ff       	call   200000 <submit>
+        for (int i = 0; i < n; i++) {
+  2001ad:	49 83 c4 01          	add    $0x1,%r12
+  2001b1:	44 39 e3             	cmp    %r12d,%ebx
+  2001b4:	7f d6                	jg     20018c <process_main+0x86>
+        complete(fds);
+  2001b6:	48 8d 3d 63 33 00 00 	lea    0x3363(%rip),%rdi        # 203520 <fds.3>
+  2001bd:	e8 a5 fe ff ff       	call   200067 <complete>
+  2001c2:	b8 00 00 00 00       	mov    $0x0,%eax
+        for (int i = 0; i < n; i++) {
+            if (fds[i] < 0) handle_error(-fds[i]);
+  2001c7:	48 8d 0d 52 33 00 00 	lea    0x3352(%rip),%rcx        # 203520 <fds.3>
+  2001ce:	48 8b 3c c1          	mov    (%rcx,%rax,8),%rdi
+  2001d2:	48 85 ff             	test   %rdi,%rdi
+  2001d5:	78 55                	js     20022c <process_main+0x126>
+        for (int i = 0; i < n; i++) {
+  2001d7:	48 83 c0 01          	add    $0x1,%rax
+  2001db:	39 c3                	cmp    %eax,%ebx
+  2001dd:	7f e8                	jg     2001c7 <process_main+0xc1>
+        }
+
+        // Without an explicit count, read the whole file
+        for (int i = 0; i < n; i++) {
+  2001df:	4c 8d 2d 3a 2f 00 00 	lea    0x2f3a(%rip),%r13        # 203120 <st.1>
+        for (int i = 0; i < n; i++) {
+  2001e6:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            counts[i] = read_count;
+  2001ec:	4c 8d 3d 2d 32 00 00 	lea    0x322d(%rip),%r15        # 203420 <counts.2>
+  2001f3:	eb 4f                	jmp    200244 <process_main+0x13e>
+    if (argc <= 1) usage();
+  2001f5:	e8 dd fe ff ff       	call   2000d7 <usage>
+        int r = string_to_char(argv[argc-1], &read_count);
+  2001fa:	48 8d 75 cc          	lea    -0x34(%rbp),%rsi
+  2001fe:	48 63 c7             	movslq %edi,%rax
+  200201:	49 8b 7c c6 f8       	mov    -0x8(%r14,%rax,8),%rdi
+  200206:	e8 84 15 00 00       	call   20178f <string_to_char>
+        if (r < 0) usage();
+  20020b:	85 c0                	test   %eax,%eax
+  20020d:	78 0f                	js     20021e <process_main+0x118>
+        if (read_count == 0) usage();
+  20020f:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  200213:	0f 85 21 ff ff ff    	jne    20013a <process_main+0x34>
+  200219:	e8 b9 fe ff ff       	call   2000d7 <usage>
+        if (r < 0) usage();
+  20021e:	e8 b4 fe ff ff       	call   2000d7 <usage>
+    if (r < 0) handle_error(-r);
+  200223:	f7 d8                	neg    %eax
+  200225:	89 c7                	mov    %eax,%edi
+  200227:	e8 d2 20 00 00       	call   2022fe <handle_error>
+            if (fds[i] < 0) handle_error(-fds[i]);
+  20022c:	f7 df                	neg    %edi
+  20022e:	e8 cb 20 00 00       	call   2022fe <handle_error>
+        for (int i = 0; i < n; i++) {
+  200233:	49 83 c4 01          	add    $0x1,%r12
+  200237:	49 83 c5 18          	add    $0x18,%r13
+  20023b:	44 39 e3             	cmp    %r12d,%ebx
+  20023e:	0f 8e aa 00 00 00    	jle    2002ee <process_main+0x1e8>
+            counts[i] = read_count;
+  200244:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  200247:	48 63 d0             	movslq %eax,%rdx
+  20024a:	4b 89 14 e7          	mov    %rdx,(%r15,%r12,8)
+            if (read_count == 0) {
+  20024e:	85 c0                	test   %eax,%eax
+  200250:	75 e1                	jne    200233 <process_main+0x12d>
+                submit(IORING_OP_FSTAT, fds[i], NULL, 0, &st[i], i);
+  200252:	4d 89 e1             	mov    %r12,%r9
+  200255:	4d 89 e8             	mov    %r13,%r8
+  200258:	b9 00 00 00 00       	mov    $0x0,%ecx
+  20025d:	ba 00 00 00 00       	mov    $0x0,%edx
+  200262:	48 8d 05 b7 32 00 00 	lea    0x32b7(%rip),%rax        # 203520 <fds.3>
+  200269:	42 8b 34 e0          	mov    (%rax,%r12,8),%esi
+  20026d:	bf 05 00 00 00       	mov    $0x5,%edi
+  200272:	e8 89 fd ff ff       	call   200000 <submit>
+  200277:	eb ba                	jmp    200233 <process_main+0x12d>
+            }
+        }
+        if (read_count == 0) {
+            complete(counts);
+  200279:	48 8d 3d a0 31 00 00 	lea    0x31a0(%rip),%rdi        # 203420 <counts.2>
+  200280:	e8 e2 fd ff ff       	call   200067 <complete>
+            for (int i = 0; i < n; i++) {
+  200285:	48 8d 15 94 2e 00 00 	lea    0x2e94(%rip),%rdx        # 203120 <st.1>
+  20028c:	b8 00 00 00 00       	mov    $0x0,%eax
+                if (counts[i] < 0) handle_error(-counts[i]);
+  200291:	48 8d 0d 88 31 00 00 	lea    0x3188(%rip),%rcx        # 203420 <counts.2>
+            for (int i = 0; i < n; i++) {
+  200298:	39 c3                	cmp    %eax,%ebx
+  20029a:	7e 3b                	jle    2002d7 <process_main+0x1d1>
+                if (counts[i] < 0) handle_error(-counts[i]);
+  20029c:	48 8b 3c c1          	mov    (%rcx,%rax,8),%rdi
+  2002a0:	48 83 c2 18          	add    $0x18,%rdx
+  2002a4:	48 85 ff             	test   %rdi,%rdi
+  2002a7:	78 0e                	js     2002b7 <process_main+0x1b1>
+                counts[i] = st[i].st_size;
+  2002a9:	48 8b 72 f8          	mov    -0x8(%rdx),%rsi
+  2002ad:	48 89 34 c1          	mov    %rsi,(%rcx,%rax,8)
+            for (int i = 0; i < n; i++) {
+  2002b1:	48 83 c0 01          	add    $0x1,%rax
+  2002b5:	eb e1                	jmp    200298 <process_main+0x192>
+                if (counts[i] < 0) handle_error(-counts[i]);
+  2002b7:	f7 df                	neg    %edi
+  2002b9:	e8 40 20 00 00       	call   2022fe <handle_error>
+            submit(IORING_OP_READ, fds[i], bufs[i], counts[i], NULL, i);
+        }
+        complete(counts);
+
+        for (int i = 0; i < n; i++) {
+            if (counts[i] < 0) handle_error(-counts[i]);
+  2002be:	f7 df                	neg    %edi
+  2002c0:	e8 39 20 00 00       	call   2022fe <handle_error>
+        complete(fds);
+  2002c5:	48 8d 3d 54 32 00 00 	lea    0x3254(%rip),%rdi        # 203520 <fds.3>
+  2002cc:	e8 96 fd ff ff       	call   200067 <complete>
+        if (read_count == 0) {
+  2002d1:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  2002d5:	74 a2                	je     200279 <process_main+0x173>
+        for (int i = 0; i < n; i++) {
+  2002d7:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  2002db:	7f 17                	jg     2002f4 <process_main+0x1ee>
+        complete(counts);
+  2002dd:	48 8d 3d 3c 31 00 00 	lea    0x313c(%rip),%rdi        # 203420 <counts.2>
+  2002e4:	e8 7e fd ff ff       	call   200067 <complete>
+        for (int i = 0; i < n; i++) {
+  2002e9:	e9 b0 00 00 00       	jmp    20039e <process_main+0x298>
+        if (read_count == 0) {
+  2002ee:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  2002f2:	74 85                	je     200279 <process_main+0x173>
+            for (int i = 0; i < n; i++) {
+  2002f4:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            bufs[i] = (char *) malloc(counts[i]+1);
+  2002fa:	4c 8d 2d 1f 31 00 00 	lea    0x311f(%rip),%r13        # 203420 <counts.2>
+            submit(IORING_OP_READ, fds[i], bufs[i], counts[i], NULL, i);
+  200301:	4c 8d 3d 18 32 00 00 	lea    0x3218(%rip),%r15        # 203520 <fds.3>
+            bufs[i] = (char *) malloc(counts[i]+1);
+  200308:	4b 8b 44 e5 00       	mov    0x0(%r13,%r12,8),%rax
+  20030d:	48 8d 78 01          	lea    0x1(%rax),%rdi
+  200311:	e8 03 20 00 00       	call   202319 <malloc>
+  200316:	48 89 c2             	mov    %rax,%rdx
+  200319:	48 8d 05 00 2d 00 00 	lea    0x2d00(%rip),%rax        # 203020 <bufs.0>
+  200320:	4a 89 14 e0          	mov    %rdx,(%rax,%r12,8)
+            submit(IORING_OP_READ, fds[i], bufs[i], counts[i], NULL, i);
+  200324:	4b 8b 4c e5 00       	mov    0x0(%r13,%r12,8),%rcx
+  200329:	4d 89 e1             	mov    %r12,%r9
+  20032c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  200332:	43 8b 34 e7          	mov    (%r15,%r12,8),%esi
+  200336:	bf 02 00 00 00       	mov    $0x2,%edi
+  20033b:	e8 c0 fc ff ff       	call   200000 <submit>
+        for (int i = 0; i < n; i++) {
+  200340:	49 83 c4 01          	add    $0x1,%r12
+  200344:	44 39 e3             	cmp    %r12d,%ebx
+  200347:	7f bf                	jg     200308 <process_main+0x202>
+        complete(counts);
+  200349:	48 8d 3d d0 30 00 00 	lea    0x30d0(%rip),%rdi        # 203420 <counts.2>
+  200350:	e8 12 fd ff ff       	call   200067 <complete>
+  200355:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            if (counts[i] < 0) handle_error(-counts[i]);
+  20035b:	4c 8d 2d be 30 00 00 	lea    0x30be(%rip),%r13        # 203420 <counts.2>
+            bufs[i][counts[i]] = '\0';
+  200362:	4c 8d 3d b7 2c 00 00 	lea    0x2cb7(%rip),%r15        # 203020 <bufs.0>
+            if (counts[i] < 0) handle_error(-counts[i]);
+  200369:	4b 8b 7c e5 00       	mov    0x0(%r13,%r12,8),%rdi
+  20036e:	48 85 ff             	test   %rdi,%rdi
+  200371:	0f 88 47 ff ff ff    	js     2002be <process_main+0x1b8>
+            bufs[i][counts[i]] = '\0';
+  200377:	4b 8b 14 e7          	mov    (%r15,%r12,8),%rdx
+  20037b:	c6 04 3a 00          	movb   $0x0,(%rdx,%rdi,1)
+            app_printf(4, "%s", bufs[i]);
+  20037f:	48 8d 35 1a 20 00 00 	lea    0x201a(%rip),%rsi        # 2023a0 <malloc+0x87>
+  200386:	bf 04 00 00 00       	mov    $0x4,%edi
+  20038b:	b8 00 00 00 00       	mov    $0x0,%eax
+  200390:	e8 35 1a 00 00       	call   201dca <app_printf>
+        for (int i = 0; i < n; i++) {
+  200395:	49 83 c4 01          	add    $0x1,%r12
+  200399:	44 39 e3             	cmp    %r12d,%ebx
+  20039c:	7f cb                	jg     200369 <process_main+0x263>
+    for (int first = 1; first < argc-1; first += BATCH_SIZE) {
+  20039e:	83 45 b8 20          	addl   $0x20,-0x48(%rbp)
+  2003a2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  2003a5:	83 6d bc 20          	subl   $0x20,-0x44(%rbp)
+  2003a9:	49 81 c6 00 01 00 00 	add    $0x100,%r14
+  2003b0:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  2003b3:	39 f0                	cmp    %esi,%eax
+  2003b5:	0f 8c b3 fd ff ff    	jl     20016e <process_main+0x68>
+    asm volatile ("syscall" : "=a" (rax)
+  2003bb:	b8 40 00 00 00       	mov    $0x40,%eax
+  2003c0:	bf 00 00 00 00       	mov    $0x0,%edi
+  2003c5:	0f 05                	syscall
+ spinloop: goto spinloop;       // should never get here
+  2003c7:	eb fe                	jmp    2003c7 <process_main+0x2c1>
+
+00000000002003c9 <vdso>:
+// KERNEL DATA PAGE
+//
+//    The kernel keeps a read-only vdso_data (see lib.h) up to date at
+//    VDSO_ADDR. Reading it is a plain memory load, not a system call.
+
+static inline const volatile vdso_data* vdso(void) {
+  2003c9:	55                   	push   %rbp
+  2003ca:	48 89 e5             	mov    %rsp,%rbp
+    return (const volatile vdso_data*) VDSO_ADDR;
+  2003cd:	b8 00 10 24 00       	mov    $0x241000,%eax
+}
+  2003d2:	5d                   	pop    %rbp
+  2003d3:	c3                   	ret
+
+00000000002003d4 <memcpy>:
+#define MEMOP_WORD_MIN 64
+
+// an unaligned word that may alias any object
+typedef uint64_t __attribute__((may_alias, aligned(1))) memop_word;
+
+void* memcpy(void* dst, const void* src, size_t n) {
+  2003d4:	55                   	push   %rbp
+  2003d5:	48 89 e5             	mov    %rsp,%rbp
+  2003d8:	48 83 ec 48          	sub    $0x48,%rsp
+  2003dc:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  2003e0:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  2003e4:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+    char* d = (char*) dst;
+  2003e8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  2003ec:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    const char* s = (const char*) src;
+  2003f0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  2003f4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (n >= MEMOP_WORD_MIN) {
+  2003f8:	48 83 7d b8 3f       	cmpq   $0x3f,-0x48(%rbp)
+  2003fd:	0f 86 c5 00 00 00    	jbe    2004c8 <memcpy+0xf4>
+        size_t head = -(uintptr_t) d & 7;
+  200403:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200407:	48 f7 d8             	neg    %rax
+  20040a:	83 e0 07             	and    $0x7,%eax
+  20040d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        size_t words = (n - head) / 8;
+  200411:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  200415:	48 2b 45 e8          	sub    -0x18(%rbp),%rax
+  200419:	48 c1 e8 03          	shr    $0x3,%rax
+  20041d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+        n = (n - head) % 8;
+  200421:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  200425:	48 2b 45 e8          	sub    -0x18(%rbp),%rax
+  200429:	83 e0 07             	and    $0x7,%eax
+  20042c:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        asm volatile("rep movsb" : "+D" (d), "+S" (s), "+c" (head)
+  200430:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  200434:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  200438:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20043c:	48 89 cf             	mov    %rcx,%rdi
+  20043f:	48 89 d6             	mov    %rdx,%rsi
+  200442:	48 89 c1             	mov    %rax,%rcx
+  200445:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  200447:	48 89 c8             	mov    %rcx,%rax
+  20044a:	48 89 f2             	mov    %rsi,%rdx
+  20044d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  200451:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  200455:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                     : : "memory");
+        asm volatile("rep movsq" : "+D" (d), "+S" (s), "+c" (words)
+  200459:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  20045d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  200461:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  200465:	48 89 cf             	mov    %rcx,%rdi
+  200468:	48 89 d6             	mov    %rdx,%rsi
+  20046b:	48 89 c1             	mov    %rax,%rcx
+  20046e:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  200471:	48 89 c8             	mov    %rcx,%rax
+  200474:	48 89 f2             	mov    %rsi,%rdx
+  200477:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  20047b:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  20047f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+                     : : "memory");
+    }
+    for (; n >= 16; n -= 16, s += 16, d += 16) {
+  200483:	eb 43                	jmp    2004c8 <memcpy+0xf4>
+        memop_word a = ((const memop_word*) s)[0];
+  200485:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  200489:	48 8b 00             	mov    (%rax),%rax
+  20048c:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+        memop_word b = ((const memop_word*) s)[1];
+  200490:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  200494:	48 83 c0 08          	add    $0x8,%rax
+  200498:	48 8b 00             	mov    (%rax),%rax
+  20049b:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+        ((memop_word*) d)[0] = a;
+  20049f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2004a3:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  2004a7:	48 89 10             	mov    %rdx,(%rax)
+        ((memop_word*) d)[1] = b;
+  2004aa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2004ae:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  2004b2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  2004b6:	48 89 02             	mov    %rax,(%rdx)
+    for (; n >= 16; n -= 16, s += 16, d += 16) {
+  2004b9:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  2004be:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  2004c3:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  2004c8:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  2004cd:	77 b6                	ja     200485 <memcpy+0xb1>
+    }
+    for (; n > 0; --n, ++s, ++d) {
+  2004cf:	eb 1c                	jmp    2004ed <memcpy+0x119>
+        *d = *s;
+  2004d1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2004d5:	0f b6 10             	movzbl (%rax),%edx
+  2004d8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2004dc:	88 10                	mov    %dl,(%rax)
+    for (; n > 0; --n, ++s, ++d) {
+  2004de:	48 83 6d b8 01       	subq   $0x1,-0x48(%rbp)
+  2004e3:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  2004e8:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  2004ed:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  2004f2:	75 dd                	jne    2004d1 <memcpy+0xfd>
+    }
+    return dst;
+  2004f4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  2004f8:	c9                   	leave
+  2004f9:	c3                   	ret
+
+00000000002004fa <memmove>:
+
+void* memmove(void* dst, const void* src, size_t n) {
+  2004fa:	55                   	push   %rbp
+  2004fb:	48 89 e5             	mov    %rsp,%rbp
+  2004fe:	48 83 ec 38          	sub    $0x38,%rsp
+  200502:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  200506:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  20050a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    const char* s = (const char*) src;
+  20050e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  200512:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    char* d = (char*) dst;
+  200516:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  20051a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (!(s < d && s + n > d)) {
+  20051e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200522:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  200526:	73 11                	jae    200539 <memmove+0x3f>
+  200528:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  20052c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200530:	48 01 d0             	add    %rdx,%rax
+  200533:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  200537:	72 1c                	jb     200555 <memmove+0x5b>
+        // a forward copy never overwrites source bytes it has yet to read
+        return memcpy(dst, src, n);
+  200539:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  20053d:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  200541:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  200545:	48 89 ce             	mov    %rcx,%rsi
+  200548:	48 89 c7             	mov    %rax,%rdi
+  20054b:	e8 84 fe ff ff       	call   2003d4 <memcpy>
+  200550:	e9 94 00 00 00       	jmp    2005e9 <memmove+0xef>
+    }
+
+    // copy backwards: the tail bytes, then words down to the start
+    size_t words = n / 8;
+  200555:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200559:	48 c1 e8 03          	shr    $0x3,%rax
+  20055d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    size_t tail = n % 8;
+  200561:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200565:	83 e0 07             	and    $0x7,%eax
+  200568:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    s += n - 1, d += n - 1;
+  20056c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200570:	48 83 e8 01          	sub    $0x1,%rax
+  200574:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  200578:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  20057c:	48 83 e8 01          	sub    $0x1,%rax
+  200580:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    asm volatile("std; rep movsb; cld" : "+D" (d), "+S" (s), "+c" (tail)
+  200584:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  200588:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  20058c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  200590:	48 89 cf             	mov    %rcx,%rdi
+  200593:	48 89 d6             	mov    %rdx,%rsi
+  200596:	48 89 c1             	mov    %rax,%rcx
+  200599:	fd                   	std
+  20059a:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  20059c:	fc                   	cld
+  20059d:	48 89 c8             	mov    %rcx,%rax
+  2005a0:	48 89 f2             	mov    %rsi,%rdx
+  2005a3:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  2005a7:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  2005ab:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+                 : : "memory", "cc");
+    s -= 7, d -= 7;
+  2005af:	48 83 6d f8 07       	subq   $0x7,-0x8(%rbp)
+  2005b4:	48 83 6d f0 07       	subq   $0x7,-0x10(%rbp)
+    asm volatile("std; rep movsq; cld" : "+D" (d), "+S" (s), "+c" (words)
+  2005b9:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  2005bd:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  2005c1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2005c5:	48 89 cf             	mov    %rcx,%rdi
+  2005c8:	48 89 d6             	mov    %rdx,%rsi
+  2005cb:	48 89 c1             	mov    %rax,%rcx
+  2005ce:	fd                   	std
+  2005cf:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  2005d2:	fc                   	cld
+  2005d3:	48 89 c8             	mov    %rcx,%rax
+  2005d6:	48 89 f2             	mov    %rsi,%rdx
+  2005d9:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  2005dd:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  2005e1:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 : : "memory", "cc");
+    return dst;
+  2005e5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  2005e9:	c9                   	leave
+  2005ea:	c3                   	ret
+
+00000000002005eb <memset>:
+
+void* memset(void* v, int c, size_t n) {
+  2005eb:	55                   	push   %rbp
+  2005ec:	48 89 e5             	mov    %rsp,%rbp
+  2005ef:	48 83 ec 38          	sub    $0x38,%rsp
+  2005f3:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  2005f7:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  2005fa:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    char* p = (char*) v;
+  2005fe:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  200602:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    uint64_t word = (uint8_t) c * 0x0101010101010101UL;
+  200606:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  200609:	0f b6 c0             	movzbl %al,%eax
+  20060c:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  200613:	01 01 01 
+  200616:	48 0f af c2          	imul   %rdx,%rax
+  20061a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (n >= MEMOP_WORD_MIN) {
+  20061e:	48 83 7d c8 3f       	cmpq   $0x3f,-0x38(%rbp)
+  200623:	0f 86 9e 00 00 00    	jbe    2006c7 <memset+0xdc>
+        size_t head = -(uintptr_t) p & 7;
+  200629:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20062d:	48 f7 d8             	neg    %rax
+  200630:	83 e0 07             	and    $0x7,%eax
+  200633:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        size_t words = (n - head) / 8;
+  200637:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  20063b:	48 2b 45 e8          	sub    -0x18(%rbp),%rax
+  20063f:	48 c1 e8 03          	shr    $0x3,%rax
+  200643:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+        n = (n - head) % 8;
+  200647:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  20064b:	48 2b 45 e8          	sub    -0x18(%rbp),%rax
+  20064f:	83 e0 07             	and    $0x7,%eax
+  200652:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        asm volatile("rep stosb" : "+D" (p), "+c" (head) : "a" (word)
+  200656:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  20065a:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  20065e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  200662:	48 89 ce             	mov    %rcx,%rsi
+  200665:	48 89 f7             	mov    %rsi,%rdi
+  200668:	48 89 d1             	mov    %rdx,%rcx
+  20066b:	f3 aa                	rep stos %al,%es:(%rdi)
+  20066d:	48 89 ca             	mov    %rcx,%rdx
+  200670:	48 89 fe             	mov    %rdi,%rsi
+  200673:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  200677:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+                     : "memory");
+        asm volatile("rep stosq" : "+D" (p), "+c" (words) : "a" (word)
+  20067b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  20067f:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  200683:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  200687:	48 89 ce             	mov    %rcx,%rsi
+  20068a:	48 89 f7             	mov    %rsi,%rdi
+  20068d:	48 89 d1             	mov    %rdx,%rcx
+  200690:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  200693:	48 89 ca             	mov    %rcx,%rdx
+  200696:	48 89 fe             	mov    %rdi,%rsi
+  200699:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  20069d:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+                     : "memory");
+    }
+    for (; n >= 16; n -= 16, p += 16) {
+  2006a1:	eb 24                	jmp    2006c7 <memset+0xdc>
+        ((memop_word*) p)[0] = word;
+  2006a3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2006a7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  2006ab:	48 89 10             	mov    %rdx,(%rax)
+        ((memop_word*) p)[1] = word;
+  2006ae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2006b2:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  2006b6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2006ba:	48 89 02             	mov    %rax,(%rdx)
+    for (; n >= 16; n -= 16, p += 16) {
+  2006bd:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  2006c2:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  2006c7:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  2006cc:	77 d5                	ja     2006a3 <memset+0xb8>
+    }
+    for (; n > 0; ++p, --n) {
+  2006ce:	eb 15                	jmp    2006e5 <memset+0xfa>
+        *p = c;
+  2006d0:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  2006d3:	89 c2                	mov    %eax,%edx
+  2006d5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2006d9:	88 10                	mov    %dl,(%rax)
+    for (; n > 0; ++p, --n) {
+  2006db:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  2006e0:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  2006e5:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  2006ea:	75 e4                	jne    2006d0 <memset+0xe5>
+    }
+    return v;
+  2006ec:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  2006f0:	c9                   	leave
+  2006f1:	c3                   	ret
+
+00000000002006f2 <strlen>:
+
+size_t strlen(const char* s) {
+  2006f2:	55                   	push   %rbp
+  2006f3:	48 89 e5             	mov    %rsp,%rbp
+  2006f6:	48 83 ec 18          	sub    $0x18,%rsp
+  2006fa:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    size_t n;
+    for (n = 0; *s != '\0'; ++s) {
+  2006fe:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  200705:	00 
+  200706:	eb 0a                	jmp    200712 <strlen+0x20>
+        ++n;
+  200708:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    for (n = 0; *s != '\0'; ++s) {
+  20070d:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  200712:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  200716:	0f b6 00             	movzbl (%rax),%eax
+  200719:	84 c0                	test   %al,%al
+  20071b:	75 eb                	jne    200708 <strlen+0x16>
+    }
+    return n;
+  20071d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  200721:	c9                   	leave
+  200722:	c3                   	ret
+
+0000000000200723 <strnlen>:
+
+size_t strnlen(const char* s, size_t maxlen) {
+  200723:	55                   	push   %rbp
+  200724:	48 89 e5             	mov    %rsp,%rbp
+  200727:	48 83 ec 20          	sub    $0x20,%rsp
+  20072b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  20072f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    size_t n;
+    for (n = 0; n != maxlen && *s != '\0'; ++s) {
+  200733:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  20073a:	00 
+  20073b:	eb 0a                	jmp    200747 <strnlen+0x24>
+        ++n;
+  20073d:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    for (n = 0; n != maxlen && *s != '\0'; ++s) {
+  200742:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  200747:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20074b:	48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+  20074f:	74 0b                	je     20075c <strnlen+0x39>
+  200751:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  200755:	0f b6 00             	movzbl (%rax),%eax
+  200758:	84 c0                	test   %al,%al
+  20075a:	75 e1                	jne    20073d <strnlen+0x1a>
+    }
+    return n;
+  20075c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  200760:	c9                   	leave
+  200761:	c3                   	ret
+
+0000000000200762 <strcpy>:
+
+char* strcpy(char* dst, const char* src) {
+  200762:	55                   	push   %rbp
+  200763:	48 89 e5             	mov    %rsp,%rbp
+  200766:	48 83 ec 20          	sub    $0x20,%rsp
+  20076a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  20076e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    char* d = dst;
+  200772:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  200776:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    do {
+        *d++ = *src++;
+  20077a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  20077e:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  200782:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  200786:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20078a:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  20078e:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+  200792:	0f b6 12             	movzbl (%rdx),%edx
+  200795:	88 10                	mov    %dl,(%rax)
+    } while (d[-1]);
+  200797:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20079b:	48 83 e8 01          	sub    $0x1,%rax
+  20079f:	0f b6 00             	movzbl (%rax),%eax
+  2007a2:	84 c0                	test   %al,%al
+  2007a4:	75 d4                	jne    20077a <strcpy+0x18>
+    return dst;
+  2007a6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  2007aa:	c9                   	leave
+  2007ab:	c3                   	ret
+
+00000000002007ac <strcmp>:
+
+int strcmp(const char* a, const char* b) {
+  2007ac:	55                   	push   %rbp
+  2007ad:	48 89 e5             	mov    %rsp,%rbp
+  2007b0:	48 83 ec 10          	sub    $0x10,%rsp
+  2007b4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  2007b8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    while (*a && *b && *a == *b) {
+  2007bc:	eb 0a                	jmp    2007c8 <strcmp+0x1c>
+        ++a, ++b;
+  2007be:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  2007c3:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+    while (*a && *b && *a == *b) {
+  2007c8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2007cc:	0f b6 00             	movzbl (%rax),%eax
+  2007cf:	84 c0                	test   %al,%al
+  2007d1:	74 1d                	je     2007f0 <strcmp+0x44>
+  2007d3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2007d7:	0f b6 00             	movzbl (%rax),%eax
+  2007da:	84 c0                	test   %al,%al
+  2007dc:	74 12                	je     2007f0 <strcmp+0x44>
+  2007de:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2007e2:	0f b6 10             	movzbl (%rax),%edx
+  2007e5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2007e9:	0f b6 00             	movzbl (%rax),%eax
+  2007ec:	38 c2                	cmp    %al,%dl
+  2007ee:	74 ce                	je     2007be <strcmp+0x12>
+    }
+    return ((unsigned char) *a > (unsigned char) *b)
+  2007f0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2007f4:	0f b6 00             	movzbl (%rax),%eax
+  2007f7:	89 c2                	mov    %eax,%edx
+  2007f9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2007fd:	0f b6 00             	movzbl (%rax),%eax
+  200800:	38 d0                	cmp    %dl,%al
+  200802:	0f 92 c0             	setb   %al
+  200805:	0f b6 d0             	movzbl %al,%edx
+        - ((unsigned char) *a < (unsigned char) *b);
+  200808:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20080c:	0f b6 00             	movzbl (%rax),%eax
+  20080f:	89 c1                	mov    %eax,%ecx
+  200811:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  200815:	0f b6 00             	movzbl (%rax),%eax
+  200818:	38 c1                	cmp    %al,%cl
+  20081a:	0f 92 c0             	setb   %al
+  20081d:	0f b6 c0             	movzbl %al,%eax
+  200820:	29 c2                	sub    %eax,%edx
+  200822:	89 d0                	mov    %edx,%eax
+}
+  200824:	c9                   	leave
+  200825:	c3                   	ret
+
+0000000000200826 <strchr>:
+
+char* strchr(const char* s, int c) {
+  200826:	55                   	push   %rbp
+  200827:	48 89 e5             	mov    %rsp,%rbp
+  20082a:	48 83 ec 10          	sub    $0x10,%rsp
+  20082e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  200832:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    while (*s && *s != (char) c) {
+  200835:	eb 05                	jmp    20083c <strchr+0x16>
+        ++s;
+  200837:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    while (*s && *s != (char) c) {
+  20083c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200840:	0f b6 00             	movzbl (%rax),%eax
+  200843:	84 c0                	test   %al,%al
+  200845:	74 0e                	je     200855 <strchr+0x2f>
+  200847:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20084b:	0f b6 00             	movzbl (%rax),%eax
+  20084e:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  200851:	38 d0                	cmp    %dl,%al
+  200853:	75 e2                	jne    200837 <strchr+0x11>
+    }
+    if (*s == (char) c) {
+  200855:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200859:	0f b6 00             	movzbl (%rax),%eax
+  20085c:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  20085f:	38 d0                	cmp    %dl,%al
+  200861:	75 06                	jne    200869 <strchr+0x43>
+        return (char*) s;
+  200863:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200867:	eb 05                	jmp    20086e <strchr+0x48>
+    } else {
+        return NULL;
+  200869:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+}
+  20086e:	c9                   	leave
+  20086f:	c3                   	ret
+
+0000000000200870 <rand>:
+
+// New randomness implementation
+static int      rand_seed_set;
+static unsigned rand_seed;
+
+int rand(void) {
+  200870:	55                   	push   %rbp
+  200871:	48 89 e5             	mov    %rsp,%rbp
+  200874:	48 83 ec 10          	sub    $0x10,%rsp
+    if (!rand_seed_set) {
+  200878:	8b 05 a2 2d 00 00    	mov    0x2da2(%rip),%eax        # 203620 <rand_seed_set>
+  20087e:	85 c0                	test   %eax,%eax
+  200880:	75 2c                	jne    2008ae <rand+0x3e>
+#if WEENSYOS_KERNEL
+        extern unsigned get_entropy_value(void);
+        srand(get_entropy_value());
+#else           // user‑space build
+       /* kernel-refreshed seed from the kernel data page: no system call */
+       srand((unsigned) (vdso()->seed[0] ^ read_cycle_counter()));
+  200882:	e8 42 fb ff ff       	call   2003c9 <vdso>
+  200887:	48 8b 40 18          	mov    0x18(%rax),%rax
+  20088b:	89 c1                	mov    %eax,%ecx
+    }
+}
+
+static inline uint64_t read_cycle_counter(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+  20088d:	0f 31                	rdtsc
+  20088f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  200892:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    return ((uint64_t) hi << 32) | lo;
+  200895:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  200898:	48 c1 e0 20          	shl    $0x20,%rax
+  20089c:	48 89 c2             	mov    %rax,%rdx
+  20089f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  2008a2:	48 09 d0             	or     %rdx,%rax
+  2008a5:	31 c8                	xor    %ecx,%eax
+  2008a7:	89 c7                	mov    %eax,%edi
+  2008a9:	e8 24 00 00 00       	call   2008d2 <srand>
+#endif
+    }
+    rand_seed = rand_seed * 1664525U + 1013904223U;   // LCG
+  2008ae:	8b 05 70 2d 00 00    	mov    0x2d70(%rip),%eax        # 203624 <rand_seed>
+  2008b4:	69 c0 0d 66 19 00    	imul   $0x19660d,%eax,%eax
+  2008ba:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+  2008bf:	89 05 5f 2d 00 00    	mov    %eax,0x2d5f(%rip)        # 203624 <rand_seed>
+    return rand_seed & RAND_MAX;
+  2008c5:	8b 05 59 2d 00 00    	mov    0x2d59(%rip),%eax        # 203624 <rand_seed>
+  2008cb:	25 ff ff ff 7f       	and    $0x7fffffff,%eax
+}
+  2008d0:	c9                   	leave
+  2008d1:	c3                   	ret
+
+00000000002008d2 <srand>:
+
+void srand(unsigned seed) {
+  2008d2:	55                   	push   %rbp
+  2008d3:	48 89 e5             	mov    %rsp,%rbp
+  2008d6:	48 83 ec 08          	sub    $0x8,%rsp
+  2008da:	89 7d fc             	mov    %edi,-0x4(%rbp)
+    rand_seed      = seed;
+  2008dd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  2008e0:	89 05 3e 2d 00 00    	mov    %eax,0x2d3e(%rip)        # 203624 <rand_seed>
+    rand_seed_set  = 1;
+  2008e6:	c7 05 30 2d 00 00 01 	movl   $0x1,0x2d30(%rip)        # 203620 <rand_seed_set>
+  2008ed:	00 00 00 
+}
+  2008f0:	90                   	nop
+  2008f1:	c9                   	leave
+  2008f2:	c3                   	ret
+
+00000000002008f3 <fill_numbuf>:
+//    Print a message onto the console, starting at the given cursor position.
+
+// snprintf, vsnprintf
+//    Format a string into a buffer.
+
+static char* fill_numbuf(char* numbuf_end, unsigned long val, int base) {
+  2008f3:	55                   	push   %rbp
+  2008f4:	48 89 e5             	mov    %rsp,%rbp
+  2008f7:	48 83 ec 28          	sub    $0x28,%rsp
+  2008fb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  2008ff:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  200903:	89 55 dc             	mov    %edx,-0x24(%rbp)
+    static const char upper_digits[] = "0123456789ABCDEF";
+    static const char lower_digits[] = "0123456789abcdef";
+
+    const char* digits = upper_digits;
+  200906:	48 8d 05 33 1c 00 00 	lea    0x1c33(%rip),%rax        # 202540 <upper_digits.1>
+  20090d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (base < 0) {
+  200911:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  200915:	79 0e                	jns    200925 <fill_numbuf+0x32>
+        digits = lower_digits;
+  200917:	48 8d 05 42 1c 00 00 	lea    0x1c42(%rip),%rax        # 202560 <lower_digits.0>
+  20091e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+        base = -base;
+  200922:	f7 5d dc             	negl   -0x24(%rbp)
+    }
+
+    *--numbuf_end = '\0';
+  200925:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  20092a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20092e:	c6 00 00             	movb   $0x0,(%rax)
+    do {
+        *--numbuf_end = digits[val % base];
+  200931:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  200934:	48 63 c8             	movslq %eax,%rcx
+  200937:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  20093b:	ba 00 00 00 00       	mov    $0x0,%edx
+  200940:	48 f7 f1             	div    %rcx
+  200943:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200947:	48 01 d0             	add    %rdx,%rax
+  20094a:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  20094f:	0f b6 10             	movzbl (%rax),%edx
+  200952:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  200956:	88 10                	mov    %dl,(%rax)
+        val /= base;
+  200958:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  20095b:	48 63 f0             	movslq %eax,%rsi
+  20095e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  200962:	ba 00 00 00 00       	mov    $0x0,%edx
+  200967:	48 f7 f6             	div    %rsi
+  20096a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    } while (val != 0);
+  20096e:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  200973:	75 bc                	jne    200931 <fill_numbuf+0x3e>
+    return numbuf_end;
+  200975:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  200979:	c9                   	leave
+  20097a:	c3                   	ret
+
+000000000020097b <printer_vprintf>:
+#define FLAG_NUMERIC            (1<<5)
+#define FLAG_SIGNED             (1<<6)
+#define FLAG_NEGATIVE           (1<<7)
+#define FLAG_ALT2               (1<<8)
+
+void printer_vprintf(printer* p, int color, const char* format, va_list val) {
+  20097b:	55                   	push   %rbp
+  20097c:	48 89 e5             	mov    %rsp,%rbp
+  20097f:	53                   	push   %rbx
+  200980:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  200987:	48 89 bd 78 ff ff ff 	mov    %rdi,-0x88(%rbp)
+  20098e:	89 b5 74 ff ff ff    	mov    %esi,-0x8c(%rbp)
+  200994:	48 89 95 68 ff ff ff 	mov    %rdx,-0x98(%rbp)
+  20099b:	48 89 8d 60 ff ff ff 	mov    %rcx,-0xa0(%rbp)
+#define NUMBUFSIZ 24
+    char numbuf[NUMBUFSIZ];
+
+    for (; *format; ++format) {
+  2009a2:	e9 be 09 00 00       	jmp    201365 <printer_vprintf+0x9ea>
+        if (*format != '%') {
+  2009a7:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  2009ae:	0f b6 00             	movzbl (%rax),%eax
+  2009b1:	3c 25                	cmp    $0x25,%al
+  2009b3:	74 31                	je     2009e6 <printer_vprintf+0x6b>
+            p->putc(p, *format, color);
+  2009b5:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  2009bc:	4c 8b 00             	mov    (%rax),%r8
+  2009bf:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  2009c6:	0f b6 00             	movzbl (%rax),%eax
+  2009c9:	0f b6 c8             	movzbl %al,%ecx
+  2009cc:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  2009d2:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  2009d9:	89 ce                	mov    %ecx,%esi
+  2009db:	48 89 c7             	mov    %rax,%rdi
+  2009de:	41 ff d0             	call   *%r8
+            continue;
+  2009e1:	e9 77 09 00 00       	jmp    20135d <printer_vprintf+0x9e2>
+        }
+
+        // process flags
+        int flags = 0;
+  2009e6:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+        for (++format; *format; ++format) {
+  2009ed:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  2009f4:	01 
+  2009f5:	eb 4f                	jmp    200a46 <printer_vprintf+0xcb>
+            const char* flagc = strchr(flag_chars, *format);
+  2009f7:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  2009fe:	0f b6 00             	movzbl (%rax),%eax
+  200a01:	0f be c0             	movsbl %al,%eax
+  200a04:	89 c6                	mov    %eax,%esi
+  200a06:	48 8d 05 e3 19 00 00 	lea    0x19e3(%rip),%rax        # 2023f0 <flag_chars>
+  200a0d:	48 89 c7             	mov    %rax,%rdi
+  200a10:	e8 11 fe ff ff       	call   200826 <strchr>
+  200a15:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (flagc) {
+  200a19:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  200a1e:	74 36                	je     200a56 <printer_vprintf+0xdb>
+                flags |= 1 << (flagc - flag_chars);
+  200a20:	48 8d 05 c9 19 00 00 	lea    0x19c9(%rip),%rax        # 2023f0 <flag_chars>
+  200a27:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  200a2b:	48 29 c2             	sub    %rax,%rdx
+  200a2e:	89 d0                	mov    %edx,%eax
+  200a30:	ba 01 00 00 00       	mov    $0x1,%edx
+  200a35:	89 c1                	mov    %eax,%ecx
+  200a37:	d3 e2                	shl    %cl,%edx
+  200a39:	89 d0                	mov    %edx,%eax
+  200a3b:	09 45 ec             	or     %eax,-0x14(%rbp)
+        for (++format; *format; ++format) {
+  200a3e:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  200a45:	01 
+  200a46:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200a4d:	0f b6 00             	movzbl (%rax),%eax
+  200a50:	84 c0                	test   %al,%al
+  200a52:	75 a3                	jne    2009f7 <printer_vprintf+0x7c>
+  200a54:	eb 01                	jmp    200a57 <printer_vprintf+0xdc>
+            } else {
+                break;
+  200a56:	90                   	nop
+            }
+        }
+
+        // process width
+        int width = -1;
+  200a57:	c7 45 e8 ff ff ff ff 	movl   $0xffffffff,-0x18(%rbp)
+        if (*format >= '1' && *format <= '9') {
+  200a5e:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200a65:	0f b6 00             	movzbl (%rax),%eax
+  200a68:	3c 30                	cmp    $0x30,%al
+  200a6a:	7e 67                	jle    200ad3 <printer_vprintf+0x158>
+  200a6c:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200a73:	0f b6 00             	movzbl (%rax),%eax
+  200a76:	3c 39                	cmp    $0x39,%al
+  200a78:	7f 59                	jg     200ad3 <printer_vprintf+0x158>
+            for (width = 0; *format >= '0' && *format <= '9'; ) {
+  200a7a:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%rbp)
+  200a81:	eb 2e                	jmp    200ab1 <printer_vprintf+0x136>
+                width = 10 * width + *format++ - '0';
+  200a83:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  200a86:	89 d0                	mov    %edx,%eax
+  200a88:	c1 e0 02             	shl    $0x2,%eax
+  200a8b:	01 d0                	add    %edx,%eax
+  200a8d:	01 c0                	add    %eax,%eax
+  200a8f:	89 c1                	mov    %eax,%ecx
+  200a91:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200a98:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  200a9c:	48 89 95 68 ff ff ff 	mov    %rdx,-0x98(%rbp)
+  200aa3:	0f b6 00             	movzbl (%rax),%eax
+  200aa6:	0f be c0             	movsbl %al,%eax
+  200aa9:	01 c8                	add    %ecx,%eax
+  200aab:	83 e8 30             	sub    $0x30,%eax
+  200aae:	89 45 e8             	mov    %eax,-0x18(%rbp)
+            for (width = 0; *format >= '0' && *format <= '9'; ) {
+  200ab1:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200ab8:	0f b6 00             	movzbl (%rax),%eax
+  200abb:	3c 2f                	cmp    $0x2f,%al
+  200abd:	0f 8e 85 00 00 00    	jle    200b48 <printer_vprintf+0x1cd>
+  200ac3:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200aca:	0f b6 00             	movzbl (%rax),%eax
+  200acd:	3c 39                	cmp    $0x39,%al
+  200acf:	7e b2                	jle    200a83 <printer_vprintf+0x108>
+        if (*format >= '1' && *format <= '9') {
+  200ad1:	eb 75                	jmp    200b48 <printer_vprintf+0x1cd>
+            }
+        } else if (*format == '*') {
+  200ad3:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200ada:	0f b6 00             	movzbl (%rax),%eax
+  200add:	3c 2a                	cmp    $0x2a,%al
+  200adf:	75 68                	jne    200b49 <printer_vprintf+0x1ce>
+            width = va_arg(val, int);
+  200ae1:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200ae8:	8b 00                	mov    (%rax),%eax
+  200aea:	83 f8 2f             	cmp    $0x2f,%eax
+  200aed:	77 30                	ja     200b1f <printer_vprintf+0x1a4>
+  200aef:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200af6:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200afa:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200b01:	8b 00                	mov    (%rax),%eax
+  200b03:	89 c0                	mov    %eax,%eax
+  200b05:	48 01 d0             	add    %rdx,%rax
+  200b08:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200b0f:	8b 12                	mov    (%rdx),%edx
+  200b11:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200b14:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200b1b:	89 0a                	mov    %ecx,(%rdx)
+  200b1d:	eb 1a                	jmp    200b39 <printer_vprintf+0x1be>
+  200b1f:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200b26:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200b2a:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200b2e:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200b35:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200b39:	8b 00                	mov    (%rax),%eax
+  200b3b:	89 45 e8             	mov    %eax,-0x18(%rbp)
+            ++format;
+  200b3e:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  200b45:	01 
+  200b46:	eb 01                	jmp    200b49 <printer_vprintf+0x1ce>
+        if (*format >= '1' && *format <= '9') {
+  200b48:	90                   	nop
+        }
+
+        // process precision
+        int precision = -1;
+  200b49:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%rbp)
+        if (*format == '.') {
+  200b50:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200b57:	0f b6 00             	movzbl (%rax),%eax
+  200b5a:	3c 2e                	cmp    $0x2e,%al
+  200b5c:	0f 85 00 01 00 00    	jne    200c62 <printer_vprintf+0x2e7>
+            ++format;
+  200b62:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  200b69:	01 
+            if (*format >= '0' && *format <= '9') {
+  200b6a:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200b71:	0f b6 00             	movzbl (%rax),%eax
+  200b74:	3c 2f                	cmp    $0x2f,%al
+  200b76:	7e 67                	jle    200bdf <printer_vprintf+0x264>
+  200b78:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200b7f:	0f b6 00             	movzbl (%rax),%eax
+  200b82:	3c 39                	cmp    $0x39,%al
+  200b84:	7f 59                	jg     200bdf <printer_vprintf+0x264>
+                for (precision = 0; *format >= '0' && *format <= '9'; ) {
+  200b86:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%rbp)
+  200b8d:	eb 2e                	jmp    200bbd <printer_vprintf+0x242>
+                    precision = 10 * precision + *format++ - '0';
+  200b8f:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  200b92:	89 d0                	mov    %edx,%eax
+  200b94:	c1 e0 02             	shl    $0x2,%eax
+  200b97:	01 d0                	add    %edx,%eax
+  200b99:	01 c0                	add    %eax,%eax
+  200b9b:	89 c1                	mov    %eax,%ecx
+  200b9d:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200ba4:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  200ba8:	48 89 95 68 ff ff ff 	mov    %rdx,-0x98(%rbp)
+  200baf:	0f b6 00             	movzbl (%rax),%eax
+  200bb2:	0f be c0             	movsbl %al,%eax
+  200bb5:	01 c8                	add    %ecx,%eax
+  200bb7:	83 e8 30             	sub    $0x30,%eax
+  200bba:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+                for (precision = 0; *format >= '0' && *format <= '9'; ) {
+  200bbd:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200bc4:	0f b6 00             	movzbl (%rax),%eax
+  200bc7:	3c 2f                	cmp    $0x2f,%al
+  200bc9:	0f 8e 85 00 00 00    	jle    200c54 <printer_vprintf+0x2d9>
+  200bcf:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200bd6:	0f b6 00             	movzbl (%rax),%eax
+  200bd9:	3c 39                	cmp    $0x39,%al
+  200bdb:	7e b2                	jle    200b8f <printer_vprintf+0x214>
+            if (*format >= '0' && *format <= '9') {
+  200bdd:	eb 75                	jmp    200c54 <printer_vprintf+0x2d9>
+                }
+            } else if (*format == '*') {
+  200bdf:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200be6:	0f b6 00             	movzbl (%rax),%eax
+  200be9:	3c 2a                	cmp    $0x2a,%al
+  200beb:	75 68                	jne    200c55 <printer_vprintf+0x2da>
+                precision = va_arg(val, int);
+  200bed:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200bf4:	8b 00                	mov    (%rax),%eax
+  200bf6:	83 f8 2f             	cmp    $0x2f,%eax
+  200bf9:	77 30                	ja     200c2b <printer_vprintf+0x2b0>
+  200bfb:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c02:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200c06:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c0d:	8b 00                	mov    (%rax),%eax
+  200c0f:	89 c0                	mov    %eax,%eax
+  200c11:	48 01 d0             	add    %rdx,%rax
+  200c14:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200c1b:	8b 12                	mov    (%rdx),%edx
+  200c1d:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200c20:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200c27:	89 0a                	mov    %ecx,(%rdx)
+  200c29:	eb 1a                	jmp    200c45 <printer_vprintf+0x2ca>
+  200c2b:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c32:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200c36:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200c3a:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200c41:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200c45:	8b 00                	mov    (%rax),%eax
+  200c47:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+                ++format;
+  200c4a:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  200c51:	01 
+  200c52:	eb 01                	jmp    200c55 <printer_vprintf+0x2da>
+            if (*format >= '0' && *format <= '9') {
+  200c54:	90                   	nop
+            }
+            if (precision < 0) {
+  200c55:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  200c59:	79 07                	jns    200c62 <printer_vprintf+0x2e7>
+                precision = 0;
+  200c5b:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%rbp)
+            }
+        }
+
+        // process main conversion character
+        int base = 10;
+  200c62:	c7 45 e0 0a 00 00 00 	movl   $0xa,-0x20(%rbp)
+        unsigned long num = 0;
+  200c69:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  200c70:	00 
+        int length = 0;
+  200c71:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+        char* data = "";
+  200c78:	48 8d 05 77 17 00 00 	lea    0x1777(%rip),%rax        # 2023f6 <flag_chars+0x6>
+  200c7f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    again:
+        switch (*format) {
+  200c83:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200c8a:	0f b6 00             	movzbl (%rax),%eax
+  200c8d:	0f be c0             	movsbl %al,%eax
+  200c90:	83 e8 43             	sub    $0x43,%eax
+  200c93:	83 f8 37             	cmp    $0x37,%eax
+  200c96:	0f 87 b5 03 00 00    	ja     201051 <printer_vprintf+0x6d6>
+  200c9c:	89 c0                	mov    %eax,%eax
+  200c9e:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  200ca5:	00 
+  200ca6:	48 8d 05 57 17 00 00 	lea    0x1757(%rip),%rax        # 202404 <flag_chars+0x14>
+  200cad:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+  200cb0:	48 98                	cltq
+  200cb2:	48 8d 15 4b 17 00 00 	lea    0x174b(%rip),%rdx        # 202404 <flag_chars+0x14>
+  200cb9:	48 01 d0             	add    %rdx,%rax
+  200cbc:	ff e0                	jmp    *%rax
+        case 'l':
+        case 'z':
+            length = 1;
+  200cbe:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+            ++format;
+  200cc5:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  200ccc:	01 
+            goto again;
+  200ccd:	eb b4                	jmp    200c83 <printer_vprintf+0x308>
+        case 'd':
+        case 'i': {
+            long x = length ? va_arg(val, long) : va_arg(val, int);
+  200ccf:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  200cd3:	74 5d                	je     200d32 <printer_vprintf+0x3b7>
+  200cd5:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200cdc:	8b 00                	mov    (%rax),%eax
+  200cde:	83 f8 2f             	cmp    $0x2f,%eax
+  200ce1:	77 30                	ja     200d13 <printer_vprintf+0x398>
+  200ce3:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200cea:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200cee:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200cf5:	8b 00                	mov    (%rax),%eax
+  200cf7:	89 c0                	mov    %eax,%eax
+  200cf9:	48 01 d0             	add    %rdx,%rax
+  200cfc:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200d03:	8b 12                	mov    (%rdx),%edx
+  200d05:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200d08:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200d0f:	89 0a                	mov    %ecx,(%rdx)
+  200d11:	eb 1a                	jmp    200d2d <printer_vprintf+0x3b2>
+  200d13:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200d1a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200d1e:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200d22:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200d29:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200d2d:	48 8b 00             	mov    (%rax),%rax
+  200d30:	eb 5c                	jmp    200d8e <printer_vprintf+0x413>
+  200d32:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200d39:	8b 00                	mov    (%rax),%eax
+  200d3b:	83 f8 2f             	cmp    $0x2f,%eax
+  200d3e:	77 30                	ja     200d70 <printer_vprintf+0x3f5>
+  200d40:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200d47:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200d4b:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200d52:	8b 00                	mov    (%rax),%eax
+  200d54:	89 c0                	mov    %eax,%eax
+  200d56:	48 01 d0             	add    %rdx,%rax
+  200d59:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200d60:	8b 12                	mov    (%rdx),%edx
+  200d62:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200d65:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200d6c:	89 0a                	mov    %ecx,(%rdx)
+  200d6e:	eb 1a                	jmp    200d8a <printer_vprintf+0x40f>
+  200d70:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200d77:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200d7b:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200d7f:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200d86:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200d8a:	8b 00                	mov    (%rax),%eax
+  200d8c:	48 98                	cltq
+  200d8e:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+            int negative = x < 0 ? FLAG_NEGATIVE : 0;
+  200d92:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  200d96:	48 c1 f8 38          	sar    $0x38,%rax
+  200d9a:	25 80 00 00 00       	and    $0x80,%eax
+  200d9f:	89 45 a4             	mov    %eax,-0x5c(%rbp)
+            num = negative ? -x : x;
+  200da2:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  200da6:	74 09                	je     200db1 <printer_vprintf+0x436>
+  200da8:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  200dac:	48 f7 d8             	neg    %rax
+  200daf:	eb 04                	jmp    200db5 <printer_vprintf+0x43a>
+  200db1:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  200db5:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+            flags |= FLAG_NUMERIC | FLAG_SIGNED | negative;
+  200db9:	8b 45 a4             	mov    -0x5c(%rbp),%eax
+  200dbc:	83 c8 60             	or     $0x60,%eax
+  200dbf:	09 45 ec             	or     %eax,-0x14(%rbp)
+            break;
+  200dc2:	e9 cf 02 00 00       	jmp    201096 <printer_vprintf+0x71b>
+        }
+        case 'u':
+        format_unsigned:
+            num = length ? va_arg(val, unsigned long) : va_arg(val, unsigned);
+  200dc7:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  200dcb:	74 5d                	je     200e2a <printer_vprintf+0x4af>
+  200dcd:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200dd4:	8b 00                	mov    (%rax),%eax
+  200dd6:	83 f8 2f             	cmp    $0x2f,%eax
+  200dd9:	77 30                	ja     200e0b <printer_vprintf+0x490>
+  200ddb:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200de2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200de6:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200ded:	8b 00                	mov    (%rax),%eax
+  200def:	89 c0                	mov    %eax,%eax
+  200df1:	48 01 d0             	add    %rdx,%rax
+  200df4:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200dfb:	8b 12                	mov    (%rdx),%edx
+  200dfd:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200e00:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200e07:	89 0a                	mov    %ecx,(%rdx)
+  200e09:	eb 1a                	jmp    200e25 <printer_vprintf+0x4aa>
+  200e0b:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200e12:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200e16:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200e1a:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200e21:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200e25:	48 8b 00             	mov    (%rax),%rax
+  200e28:	eb 5c                	jmp    200e86 <printer_vprintf+0x50b>
+  200e2a:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200e31:	8b 00                	mov    (%rax),%eax
+  200e33:	83 f8 2f             	cmp    $0x2f,%eax
+  200e36:	77 30                	ja     200e68 <printer_vprintf+0x4ed>
+  200e38:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200e3f:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200e43:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200e4a:	8b 00                	mov    (%rax),%eax
+  200e4c:	89 c0                	mov    %eax,%eax
+  200e4e:	48 01 d0             	add    %rdx,%rax
+  200e51:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200e58:	8b 12                	mov    (%rdx),%edx
+  200e5a:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200e5d:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200e64:	89 0a                	mov    %ecx,(%rdx)
+  200e66:	eb 1a                	jmp    200e82 <printer_vprintf+0x507>
+  200e68:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200e6f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200e73:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200e77:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200e7e:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200e82:	8b 00                	mov    (%rax),%eax
+  200e84:	89 c0                	mov    %eax,%eax
+  200e86:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+            flags |= FLAG_NUMERIC;
+  200e8a:	83 4d ec 20          	orl    $0x20,-0x14(%rbp)
+            break;
+  200e8e:	e9 03 02 00 00       	jmp    201096 <printer_vprintf+0x71b>
+        case 'x':
+            base = -16;
+  200e93:	c7 45 e0 f0 ff ff ff 	movl   $0xfffffff0,-0x20(%rbp)
+            goto format_unsigned;
+  200e9a:	e9 28 ff ff ff       	jmp    200dc7 <printer_vprintf+0x44c>
+        case 'X':
+            base = 16;
+  200e9f:	c7 45 e0 10 00 00 00 	movl   $0x10,-0x20(%rbp)
+            goto format_unsigned;
+  200ea6:	e9 1c ff ff ff       	jmp    200dc7 <printer_vprintf+0x44c>
+        case 'p':
+            num = (uintptr_t) va_arg(val, void*);
+  200eab:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200eb2:	8b 00                	mov    (%rax),%eax
+  200eb4:	83 f8 2f             	cmp    $0x2f,%eax
+  200eb7:	77 30                	ja     200ee9 <printer_vprintf+0x56e>
+  200eb9:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200ec0:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200ec4:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200ecb:	8b 00                	mov    (%rax),%eax
+  200ecd:	89 c0                	mov    %eax,%eax
+  200ecf:	48 01 d0             	add    %rdx,%rax
+  200ed2:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200ed9:	8b 12                	mov    (%rdx),%edx
+  200edb:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200ede:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200ee5:	89 0a                	mov    %ecx,(%rdx)
+  200ee7:	eb 1a                	jmp    200f03 <printer_vprintf+0x588>
+  200ee9:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200ef0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200ef4:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200ef8:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200eff:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200f03:	48 8b 00             	mov    (%rax),%rax
+  200f06:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+            base = -16;
+  200f0a:	c7 45 e0 f0 ff ff ff 	movl   $0xfffffff0,-0x20(%rbp)
+            flags |= FLAG_ALT | FLAG_ALT2 | FLAG_NUMERIC;
+  200f11:	81 4d ec 21 01 00 00 	orl    $0x121,-0x14(%rbp)
+            break;
+  200f18:	e9 79 01 00 00       	jmp    201096 <printer_vprintf+0x71b>
+        case 's':
+            data = va_arg(val, char*);
+  200f1d:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200f24:	8b 00                	mov    (%rax),%eax
+  200f26:	83 f8 2f             	cmp    $0x2f,%eax
+  200f29:	77 30                	ja     200f5b <printer_vprintf+0x5e0>
+  200f2b:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200f32:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200f36:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200f3d:	8b 00                	mov    (%rax),%eax
+  200f3f:	89 c0                	mov    %eax,%eax
+  200f41:	48 01 d0             	add    %rdx,%rax
+  200f44:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200f4b:	8b 12                	mov    (%rdx),%edx
+  200f4d:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200f50:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200f57:	89 0a                	mov    %ecx,(%rdx)
+  200f59:	eb 1a                	jmp    200f75 <printer_vprintf+0x5fa>
+  200f5b:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200f62:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200f66:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200f6a:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200f71:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200f75:	48 8b 00             	mov    (%rax),%rax
+  200f78:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+            break;
+  200f7c:	e9 15 01 00 00       	jmp    201096 <printer_vprintf+0x71b>
+        case 'C':
+            color = va_arg(val, int);
+  200f81:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200f88:	8b 00                	mov    (%rax),%eax
+  200f8a:	83 f8 2f             	cmp    $0x2f,%eax
+  200f8d:	77 30                	ja     200fbf <printer_vprintf+0x644>
+  200f8f:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200f96:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200f9a:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200fa1:	8b 00                	mov    (%rax),%eax
+  200fa3:	89 c0                	mov    %eax,%eax
+  200fa5:	48 01 d0             	add    %rdx,%rax
+  200fa8:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200faf:	8b 12                	mov    (%rdx),%edx
+  200fb1:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200fb4:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200fbb:	89 0a                	mov    %ecx,(%rdx)
+  200fbd:	eb 1a                	jmp    200fd9 <printer_vprintf+0x65e>
+  200fbf:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200fc6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200fca:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200fce:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200fd5:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200fd9:	8b 00                	mov    (%rax),%eax
+  200fdb:	89 85 74 ff ff ff    	mov    %eax,-0x8c(%rbp)
+            goto done;
+  200fe1:	e9 77 03 00 00       	jmp    20135d <printer_vprintf+0x9e2>
+        case 'c':
+            data = numbuf;
+  200fe6:	48 8d 45 8c          	lea    -0x74(%rbp),%rax
+  200fea:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+            numbuf[0] = va_arg(val, int);
+  200fee:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200ff5:	8b 00                	mov    (%rax),%eax
+  200ff7:	83 f8 2f             	cmp    $0x2f,%eax
+  200ffa:	77 30                	ja     20102c <printer_vprintf+0x6b1>
+  200ffc:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  201003:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  201007:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  20100e:	8b 00                	mov    (%rax),%eax
+  201010:	89 c0                	mov    %eax,%eax
+  201012:	48 01 d0             	add    %rdx,%rax
+  201015:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  20101c:	8b 12                	mov    (%rdx),%edx
+  20101e:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  201021:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  201028:	89 0a                	mov    %ecx,(%rdx)
+  20102a:	eb 1a                	jmp    201046 <printer_vprintf+0x6cb>
+  20102c:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  201033:	48 8b 40 08          	mov    0x8(%rax),%rax
+  201037:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  20103b:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  201042:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  201046:	8b 00                	mov    (%rax),%eax
+  201048:	88 45 8c             	mov    %al,-0x74(%rbp)
+            numbuf[1] = '\0';
+  20104b:	c6 45 8d 00          	movb   $0x0,-0x73(%rbp)
+            break;
+  20104f:	eb 45                	jmp    201096 <printer_vprintf+0x71b>
+        default:
+            data = numbuf;
+  201051:	48 8d 45 8c          	lea    -0x74(%rbp),%rax
+  201055:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+            numbuf[0] = (*format ? *format : '%');
+  201059:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  201060:	0f b6 00             	movzbl (%rax),%eax
+  201063:	84 c0                	test   %al,%al
+  201065:	74 0c                	je     201073 <printer_vprintf+0x6f8>
+  201067:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  20106e:	0f b6 00             	movzbl (%rax),%eax
+  201071:	eb 05                	jmp    201078 <printer_vprintf+0x6fd>
+  201073:	b8 25 00 00 00       	mov    $0x25,%eax
+  201078:	88 45 8c             	mov    %al,-0x74(%rbp)
+            numbuf[1] = '\0';
+  20107b:	c6 45 8d 00          	movb   $0x0,-0x73(%rbp)
+            if (!*format) {
+  20107f:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  201086:	0f b6 00             	movzbl (%rax),%eax
+  201089:	84 c0                	test   %al,%al
+  20108b:	75 08                	jne    201095 <printer_vprintf+0x71a>
+                format--;
+  20108d:	48 83 ad 68 ff ff ff 	subq   $0x1,-0x98(%rbp)
+  201094:	01 
+            }
+            break;
+  201095:	90                   	nop
+        }
+
+        if (flags & FLAG_NUMERIC) {
+  201096:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  201099:	83 e0 20             	and    $0x20,%eax
+  20109c:	85 c0                	test   %eax,%eax
+  20109e:	74 1e                	je     2010be <printer_vprintf+0x743>
+            data = fill_numbuf(numbuf + NUMBUFSIZ, num, base);
+  2010a0:	48 8d 45 8c          	lea    -0x74(%rbp),%rax
+  2010a4:	48 83 c0 18          	add    $0x18,%rax
+  2010a8:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  2010ab:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  2010af:	48 89 ce             	mov    %rcx,%rsi
+  2010b2:	48 89 c7             	mov    %rax,%rdi
+  2010b5:	e8 39 f8 ff ff       	call   2008f3 <fill_numbuf>
+  2010ba:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        }
+
+        const char* prefix = "";
+  2010be:	48 8d 05 31 13 00 00 	lea    0x1331(%rip),%rax        # 2023f6 <flag_chars+0x6>
+  2010c5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((flags & FLAG_NUMERIC) && (flags & FLAG_SIGNED)) {
+  2010c9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  2010cc:	83 e0 20             	and    $0x20,%eax
+  2010cf:	85 c0                	test   %eax,%eax
+  2010d1:	74 51                	je     201124 <printer_vprintf+0x7a9>
+  2010d3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  2010d6:	83 e0 40             	and    $0x40,%eax
+  2010d9:	85 c0                	test   %eax,%eax
+  2010db:	74 47                	je     201124 <printer_vprintf+0x7a9>
+            if (flags & FLAG_NEGATIVE) {
+  2010dd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  2010e0:	25 80 00 00 00       	and    $0x80,%eax
+  2010e5:	85 c0                	test   %eax,%eax
+  2010e7:	74 0d                	je     2010f6 <printer_vprintf+0x77b>
+                prefix = "-";
+  2010e9:	48 8d 05 07 13 00 00 	lea    0x1307(%rip),%rax        # 2023f7 <flag_chars+0x7>
+  2010f0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            if (flags & FLAG_NEGATIVE) {
+  2010f4:	eb 7d                	jmp    201173 <printer_vprintf+0x7f8>
+            } else if (flags & FLAG_PLUSPOSITIVE) {
+  2010f6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  2010f9:	83 e0 10             	and    $0x10,%eax
+  2010fc:	85 c0                	test   %eax,%eax
+  2010fe:	74 0d                	je     20110d <printer_vprintf+0x792>
+                prefix = "+";
+  201100:	48 8d 05 f2 12 00 00 	lea    0x12f2(%rip),%rax        # 2023f9 <flag_chars+0x9>
+  201107:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            if (flags & FLAG_NEGATIVE) {
+  20110b:	eb 66                	jmp    201173 <printer_vprintf+0x7f8>
+            } else if (flags & FLAG_SPACEPOSITIVE) {
+  20110d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  201110:	83 e0 08             	and    $0x8,%eax
+  201113:	85 c0                	test   %eax,%eax
+  201115:	74 5c                	je     201173 <printer_vprintf+0x7f8>
+                prefix = " ";
+  201117:	48 8d 05 dd 12 00 00 	lea    0x12dd(%rip),%rax        # 2023fb <flag_chars+0xb>
+  20111e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            if (flags & FLAG_NEGATIVE) {
+  201122:	eb 4f                	jmp    201173 <printer_vprintf+0x7f8>
+            }
+        } else if ((flags & FLAG_NUMERIC) && (flags & FLAG_ALT)
+  201124:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  201127:	83 e0 20             	and    $0x20,%eax
+  20112a:	85 c0                	test   %eax,%eax
+  20112c:	74 46                	je     201174 <printer_vprintf+0x7f9>
+  20112e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  201131:	83 e0 01             	and    $0x1,%eax
+  201134:	85 c0                	test   %eax,%eax
+  201136:	74 3c                	je     201174 <printer_vprintf+0x7f9>
+                   && (base == 16 || base == -16)
+  201138:	83 7d e0 10          	cmpl   $0x10,-0x20(%rbp)
+  20113c:	74 06                	je     201144 <printer_vprintf+0x7c9>
+  20113e:	83 7d e0 f0          	cmpl   $0xfffffff0,-0x20(%rbp)
+  201142:	75 30                	jne    201174 <printer_vprintf+0x7f9>
+                   && (num || (flags & FLAG_ALT2))) {
+  201144:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  201149:	75 0c                	jne    201157 <printer_vprintf+0x7dc>
+  20114b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  20114e:	25 00 01 00 00       	and    $0x100,%eax
+  201153:	85 c0                	test   %eax,%eax
+  201155:	74 1d                	je     201174 <printer_vprintf+0x7f9>
+            prefix = (base == -16 ? "0x" : "0X");
+  201157:	83 7d e0 f0          	cmpl   $0xfffffff0,-0x20(%rbp)
+  20115b:	75 09                	jne    201166 <printer_vprintf+0x7eb>
+  20115d:	48 8d 05 99 12 00 00 	lea    0x1299(%rip),%rax        # 2023fd <flag_chars+0xd>
+  201164:	eb 07                	jmp    20116d <printer_vprintf+0x7f2>
+  201166:	48 8d 05 93 12 00 00 	lea    0x1293(%rip),%rax        # 202400 <flag_chars+0x10>
+  20116d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  201171:	eb 01                	jmp    201174 <printer_vprintf+0x7f9>
+            if (flags & FLAG_NEGATIVE) {
+  201173:	90                   	nop
+        }
+
+        int len;
+        if (precision >= 0 && !(flags & FLAG_NUMERIC)) {
+  201174:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  201178:	78 24                	js     20119e <printer_vprintf+0x823>
+  20117a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  20117d:	83 e0 20             	and    $0x20,%eax
+  201180:	85 c0                	test   %eax,%eax
+  201182:	75 1a                	jne    20119e <printer_vprintf+0x823>
+            len = strnlen(data, precision);
+  201184:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  201187:	48 63 d0             	movslq %eax,%rdx
+  20118a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  20118e:	48 89 d6             	mov    %rdx,%rsi
+  201191:	48 89 c7             	mov    %rax,%rdi
+  201194:	e8 8a f5 ff ff       	call   200723 <strnlen>
+  201199:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  20119c:	eb 0f                	jmp    2011ad <printer_vprintf+0x832>
+        } else {
+            len = strlen(data);
+  20119e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  2011a2:	48 89 c7             	mov    %rax,%rdi
+  2011a5:	e8 48 f5 ff ff       	call   2006f2 <strlen>
+  2011aa:	89 45 bc             	mov    %eax,-0x44(%rbp)
+        }
+        int zeros;
+        if ((flags & FLAG_NUMERIC) && precision >= 0) {
+  2011ad:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  2011b0:	83 e0 20             	and    $0x20,%eax
+  2011b3:	85 c0                	test   %eax,%eax
+  2011b5:	74 20                	je     2011d7 <printer_vprintf+0x85c>
+  2011b7:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  2011bb:	78 1a                	js     2011d7 <printer_vprintf+0x85c>
+            zeros = precision > len ? precision - len : 0;
+  2011bd:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  2011c0:	3b 45 bc             	cmp    -0x44(%rbp),%eax
+  2011c3:	7e 08                	jle    2011cd <printer_vprintf+0x852>
+  2011c5:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  2011c8:	2b 45 bc             	sub    -0x44(%rbp),%eax
+  2011cb:	eb 05                	jmp    2011d2 <printer_vprintf+0x857>
+  2011cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  2011d2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  2011d5:	eb 5c                	jmp    201233 <printer_vprintf+0x8b8>
+        } else if ((flags & FLAG_NUMERIC) && (flags & FLAG_ZERO)
+  2011d7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  2011da:	83 e0 20             	and    $0x20,%eax
+  2011dd:	85 c0                	test   %eax,%eax
+  2011df:	74 4b                	je     20122c <printer_vprintf+0x8b1>
+  2011e1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  2011e4:	83 e0 02             	and    $0x2,%eax
+  2011e7:	85 c0                	test   %eax,%eax
+  2011e9:	74 41                	je     20122c <printer_vprintf+0x8b1>
+                   && !(flags & FLAG_LEFTJUSTIFY)
+  2011eb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  2011ee:	83 e0 04             	and    $0x4,%eax
+  2011f1:	85 c0                	test   %eax,%eax
+  2011f3:	75 37                	jne    20122c <printer_vprintf+0x8b1>
+                   && len + (int) strlen(prefix) < width) {
+  2011f5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  2011f9:	48 89 c7             	mov    %rax,%rdi
+  2011fc:	e8 f1 f4 ff ff       	call   2006f2 <strlen>
+  201201:	89 c2                	mov    %eax,%edx
+  201203:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  201206:	01 d0                	add    %edx,%eax
+  201208:	39 45 e8             	cmp    %eax,-0x18(%rbp)
+  20120b:	7e 1f                	jle    20122c <printer_vprintf+0x8b1>
+            zeros = width - len - strlen(prefix);
+  20120d:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  201210:	2b 45 bc             	sub    -0x44(%rbp),%eax
+  201213:	89 c3                	mov    %eax,%ebx
+  201215:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  201219:	48 89 c7             	mov    %rax,%rdi
+  20121c:	e8 d1 f4 ff ff       	call   2006f2 <strlen>
+  201221:	89 c2                	mov    %eax,%edx
+  201223:	89 d8                	mov    %ebx,%eax
+  201225:	29 d0                	sub    %edx,%eax
+  201227:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  20122a:	eb 07                	jmp    201233 <printer_vprintf+0x8b8>
+        } else {
+            zeros = 0;
+  20122c:	c7 45 b8 00 00 00 00 	movl   $0x0,-0x48(%rbp)
+        }
+        width -= len + zeros + strlen(prefix);
+  201233:	8b 55 bc             	mov    -0x44(%rbp),%edx
+  201236:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  201239:	01 d0                	add    %edx,%eax
+  20123b:	48 63 d8             	movslq %eax,%rbx
+  20123e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  201242:	48 89 c7             	mov    %rax,%rdi
+  201245:	e8 a8 f4 ff ff       	call   2006f2 <strlen>
+  20124a:	48 8d 14 03          	lea    (%rbx,%rax,1),%rdx
+  20124e:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  201251:	29 d0                	sub    %edx,%eax
+  201253:	89 45 e8             	mov    %eax,-0x18(%rbp)
+        for (; !(flags & FLAG_LEFTJUSTIFY) && width > 0; --width) {
+  201256:	eb 25                	jmp    20127d <printer_vprintf+0x902>
+            p->putc(p, ' ', color);
+  201258:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  20125f:	48 8b 08             	mov    (%rax),%rcx
+  201262:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  201268:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  20126f:	be 20 00 00 00       	mov    $0x20,%esi
+  201274:	48 89 c7             	mov    %rax,%rdi
+  201277:	ff d1                	call   *%rcx
+        for (; !(flags & FLAG_LEFTJUSTIFY) && width > 0; --width) {
+  201279:	83 6d e8 01          	subl   $0x1,-0x18(%rbp)
+  20127d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  201280:	83 e0 04             	and    $0x4,%eax
+  201283:	85 c0                	test   %eax,%eax
+  201285:	75 36                	jne    2012bd <printer_vprintf+0x942>
+  201287:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  20128b:	7f cb                	jg     201258 <printer_vprintf+0x8dd>
+        }
+        for (; *prefix; ++prefix) {
+  20128d:	eb 2e                	jmp    2012bd <printer_vprintf+0x942>
+            p->putc(p, *prefix, color);
+  20128f:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  201296:	4c 8b 00             	mov    (%rax),%r8
+  201299:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  20129d:	0f b6 00             	movzbl (%rax),%eax
+  2012a0:	0f b6 c8             	movzbl %al,%ecx
+  2012a3:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  2012a9:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  2012b0:	89 ce                	mov    %ecx,%esi
+  2012b2:	48 89 c7             	mov    %rax,%rdi
+  2012b5:	41 ff d0             	call   *%r8
+        for (; *prefix; ++prefix) {
+  2012b8:	48 83 45 c0 01       	addq   $0x1,-0x40(%rbp)
+  2012bd:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  2012c1:	0f b6 00             	movzbl (%rax),%eax
+  2012c4:	84 c0                	test   %al,%al
+  2012c6:	75 c7                	jne    20128f <printer_vprintf+0x914>
+        }
+        for (; zeros > 0; --zeros) {
+  2012c8:	eb 25                	jmp    2012ef <printer_vprintf+0x974>
+            p->putc(p, '0', color);
+  2012ca:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  2012d1:	48 8b 08             	mov    (%rax),%rcx
+  2012d4:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  2012da:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  2012e1:	be 30 00 00 00       	mov    $0x30,%esi
+  2012e6:	48 89 c7             	mov    %rax,%rdi
+  2012e9:	ff d1                	call   *%rcx
+        for (; zeros > 0; --zeros) {
+  2012eb:	83 6d b8 01          	subl   $0x1,-0x48(%rbp)
+  2012ef:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  2012f3:	7f d5                	jg     2012ca <printer_vprintf+0x94f>
+        }
+        for (; len > 0; ++data, --len) {
+  2012f5:	eb 32                	jmp    201329 <printer_vprintf+0x9ae>
+            p->putc(p, *data, color);
+  2012f7:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  2012fe:	4c 8b 00             	mov    (%rax),%r8
+  201301:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  201305:	0f b6 00             	movzbl (%rax),%eax
+  201308:	0f b6 c8             	movzbl %al,%ecx
+  20130b:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  201311:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  201318:	89 ce                	mov    %ecx,%esi
+  20131a:	48 89 c7             	mov    %rax,%rdi
+  20131d:	41 ff d0             	call   *%r8
+        for (; len > 0; ++data, --len) {
+  201320:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  201325:	83 6d bc 01          	subl   $0x1,-0x44(%rbp)
+  201329:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+  20132d:	7f c8                	jg     2012f7 <printer_vprintf+0x97c>
+        }
+        for (; width > 0; --width) {
+  20132f:	eb 25                	jmp    201356 <printer_vprintf+0x9db>
+            p->putc(p, ' ', color);
+  201331:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  201338:	48 8b 08             	mov    (%rax),%rcx
+  20133b:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  201341:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  201348:	be 20 00 00 00       	mov    $0x20,%esi
+  20134d:	48 89 c7             	mov    %rax,%rdi
+  201350:	ff d1                	call   *%rcx
+        for (; width > 0; --width) {
+  201352:	83 6d e8 01          	subl   $0x1,-0x18(%rbp)
+  201356:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  20135a:	7f d5                	jg     201331 <printer_vprintf+0x9b6>
+        }
+    done: ;
+  20135c:	90                   	nop
+    for (; *format; ++format) {
+  20135d:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  201364:	01 
+  201365:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  20136c:	0f b6 00             	movzbl (%rax),%eax
+  20136f:	84 c0                	test   %al,%al
+  201371:	0f 85 30 f6 ff ff    	jne    2009a7 <printer_vprintf+0x2c>
+    }
+}
+  201377:	90                   	nop
+  201378:	90                   	nop
+  201379:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  20137d:	c9                   	leave
+  20137e:	c3                   	ret
+
+000000000020137f <console_putc>:
+typedef struct console_printer {
+    printer p;
+    uint16_t* cursor;
+} console_printer;
+
+static void console_putc(printer* p, unsigned char c, int color) {
+  20137f:	55                   	push   %rbp
+  201380:	48 89 e5             	mov    %rsp,%rbp
+  201383:	48 83 ec 30          	sub    $0x30,%rsp
+  201387:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  20138b:	89 f0                	mov    %esi,%eax
+  20138d:	89 55 d0             	mov    %edx,-0x30(%rbp)
+  201390:	88 45 d4             	mov    %al,-0x2c(%rbp)
+    console_printer* cp = (console_printer*) p;
+  201393:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  201397:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    /*if (cp->cursor >= console + CONSOLE_ROWS * CONSOLE_COLUMNS) {
+        cp->cursor = console;
+    }*/
+    if (c == '\n') {
+  20139b:	80 7d d4 0a          	cmpb   $0xa,-0x2c(%rbp)
+  20139f:	75 7f                	jne    201420 <console_putc+0xa1>
+        int pos = (cp->cursor - console) % CONSOLE_COLUMNS;
+  2013a1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2013a5:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  2013a9:	48 8d 05 50 6c eb ff 	lea    -0x1493b0(%rip),%rax        # b8000 <console>
+  2013b0:	48 29 c2             	sub    %rax,%rdx
+  2013b3:	48 89 d0             	mov    %rdx,%rax
+  2013b6:	48 d1 f8             	sar    %rax
+  2013b9:	48 89 c1             	mov    %rax,%rcx
+  2013bc:	48 ba 67 66 66 66 66 	movabs $0x6666666666666667,%rdx
+  2013c3:	66 66 66 
+  2013c6:	48 89 c8             	mov    %rcx,%rax
+  2013c9:	48 f7 ea             	imul   %rdx
+  2013cc:	48 c1 fa 05          	sar    $0x5,%rdx
+  2013d0:	48 89 c8             	mov    %rcx,%rax
+  2013d3:	48 c1 f8 3f          	sar    $0x3f,%rax
+  2013d7:	48 29 c2             	sub    %rax,%rdx
+  2013da:	48 89 d0             	mov    %rdx,%rax
+  2013dd:	48 c1 e0 02          	shl    $0x2,%rax
+  2013e1:	48 01 d0             	add    %rdx,%rax
+  2013e4:	48 c1 e0 04          	shl    $0x4,%rax
+  2013e8:	48 29 c1             	sub    %rax,%rcx
+  2013eb:	48 89 ca             	mov    %rcx,%rdx
+  2013ee:	89 55 fc             	mov    %edx,-0x4(%rbp)
+        for (; pos != CONSOLE_COLUMNS; pos++) {
+  2013f1:	eb 25                	jmp    201418 <console_putc+0x99>
+            *cp->cursor++ = ' ' | color;
+  2013f3:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  2013f6:	83 c8 20             	or     $0x20,%eax
+  2013f9:	89 c6                	mov    %eax,%esi
+  2013fb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2013ff:	48 8b 40 08          	mov    0x8(%rax),%rax
+  201403:	48 8d 48 02          	lea    0x2(%rax),%rcx
+  201407:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  20140b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  20140f:	89 f2                	mov    %esi,%edx
+  201411:	66 89 10             	mov    %dx,(%rax)
+        for (; pos != CONSOLE_COLUMNS; pos++) {
+  201414:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  201418:	83 7d fc 50          	cmpl   $0x50,-0x4(%rbp)
+  20141c:	75 d5                	jne    2013f3 <console_putc+0x74>
+  20141e:	eb 69                	jmp    201489 <console_putc+0x10a>
+        }
+    } else if (c == '\b') {
+  201420:	80 7d d4 08          	cmpb   $0x8,-0x2c(%rbp)
+  201424:	75 3f                	jne    201465 <console_putc+0xe6>
+        if (cp->cursor != console) {
+  201426:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20142a:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  20142e:	48 8d 05 cb 6b eb ff 	lea    -0x149435(%rip),%rax        # b8000 <console>
+  201435:	48 39 c2             	cmp    %rax,%rdx
+  201438:	74 4f                	je     201489 <console_putc+0x10a>
+            *(--cp->cursor) = ' ' | color;
+  20143a:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  20143d:	83 c8 20             	or     $0x20,%eax
+  201440:	89 c1                	mov    %eax,%ecx
+  201442:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201446:	48 8b 40 08          	mov    0x8(%rax),%rax
+  20144a:	48 8d 50 fe          	lea    -0x2(%rax),%rdx
+  20144e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201452:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  201456:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20145a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  20145e:	89 ca                	mov    %ecx,%edx
+  201460:	66 89 10             	mov    %dx,(%rax)
+  201463:	eb 24                	jmp    201489 <console_putc+0x10a>
+        }
+    } else {
+        *cp->cursor++ = c | color;
+  201465:	0f b6 45 d4          	movzbl -0x2c(%rbp),%eax
+  201469:	8b 55 d0             	mov    -0x30(%rbp),%edx
+  20146c:	09 d0                	or     %edx,%eax
+  20146e:	89 c6                	mov    %eax,%esi
+  201470:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201474:	48 8b 40 08          	mov    0x8(%rax),%rax
+  201478:	48 8d 48 02          	lea    0x2(%rax),%rcx
+  20147c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  201480:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  201484:	89 f2                	mov    %esi,%edx
+  201486:	66 89 10             	mov    %dx,(%rax)
+    }
+
+    const int MAX_ROWS = CONSOLE_ROWS - 2;
+  201489:	c7 45 e4 17 00 00 00 	movl   $0x17,-0x1c(%rbp)
+
+    if (cp->cursor == console + MAX_ROWS * CONSOLE_COLUMNS) {
+  201490:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201494:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  201498:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  20149b:	89 d0                	mov    %edx,%eax
+  20149d:	c1 e0 02             	shl    $0x2,%eax
+  2014a0:	01 d0                	add    %edx,%eax
+  2014a2:	c1 e0 04             	shl    $0x4,%eax
+  2014a5:	48 98                	cltq
+  2014a7:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  2014ab:	48 8d 05 4e 6b eb ff 	lea    -0x1494b2(%rip),%rax        # b8000 <console>
+  2014b2:	48 01 d0             	add    %rdx,%rax
+  2014b5:	48 39 c1             	cmp    %rax,%rcx
+  2014b8:	0f 85 ac 00 00 00    	jne    20156a <console_putc+0x1eb>
+        // Move all characters up by one row, forgetting the first row
+        for (int i = 0; i < (MAX_ROWS - 1) * CONSOLE_COLUMNS; ++i) {
+  2014be:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  2014c5:	eb 30                	jmp    2014f7 <console_putc+0x178>
+            console[i] = console[i + CONSOLE_COLUMNS];
+  2014c7:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  2014ca:	83 c0 50             	add    $0x50,%eax
+  2014cd:	48 98                	cltq
+  2014cf:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  2014d3:	48 8d 05 26 6b eb ff 	lea    -0x1494da(%rip),%rax        # b8000 <console>
+  2014da:	0f b7 04 02          	movzwl (%rdx,%rax,1),%eax
+  2014de:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  2014e1:	48 63 d2             	movslq %edx,%rdx
+  2014e4:	48 8d 0c 12          	lea    (%rdx,%rdx,1),%rcx
+  2014e8:	48 8d 15 11 6b eb ff 	lea    -0x1494ef(%rip),%rdx        # b8000 <console>
+  2014ef:	66 89 04 11          	mov    %ax,(%rcx,%rdx,1)
+        for (int i = 0; i < (MAX_ROWS - 1) * CONSOLE_COLUMNS; ++i) {
+  2014f3:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+  2014f7:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  2014fa:	8d 50 ff             	lea    -0x1(%rax),%edx
+  2014fd:	89 d0                	mov    %edx,%eax
+  2014ff:	c1 e0 02             	shl    $0x2,%eax
+  201502:	01 d0                	add    %edx,%eax
+  201504:	c1 e0 04             	shl    $0x4,%eax
+  201507:	39 45 f8             	cmp    %eax,-0x8(%rbp)
+  20150a:	7c bb                	jl     2014c7 <console_putc+0x148>
+        }
+
+        // Fill last column with space
+        for (int i = (MAX_ROWS - 1) * CONSOLE_COLUMNS; i < MAX_ROWS * CONSOLE_COLUMNS; ++i) {
+  20150c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  20150f:	8d 50 ff             	lea    -0x1(%rax),%edx
+  201512:	89 d0                	mov    %edx,%eax
+  201514:	c1 e0 02             	shl    $0x2,%eax
+  201517:	01 d0                	add    %edx,%eax
+  201519:	c1 e0 04             	shl    $0x4,%eax
+  20151c:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  20151f:	eb 20                	jmp    201541 <console_putc+0x1c2>
+            console[i] = ' ' | color;
+  201521:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  201524:	83 c8 20             	or     $0x20,%eax
+  201527:	89 c1                	mov    %eax,%ecx
+  201529:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  20152c:	48 98                	cltq
+  20152e:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  201532:	48 8d 05 c7 6a eb ff 	lea    -0x149539(%rip),%rax        # b8000 <console>
+  201539:	66 89 0c 02          	mov    %cx,(%rdx,%rax,1)
+        for (int i = (MAX_ROWS - 1) * CONSOLE_COLUMNS; i < MAX_ROWS * CONSOLE_COLUMNS; ++i) {
+  20153d:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  201541:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  201544:	89 d0                	mov    %edx,%eax
+  201546:	c1 e0 02             	shl    $0x2,%eax
+  201549:	01 d0                	add    %edx,%eax
+  20154b:	c1 e0 04             	shl    $0x4,%eax
+  20154e:	39 45 f4             	cmp    %eax,-0xc(%rbp)
+  201551:	7c ce                	jl     201521 <console_putc+0x1a2>
+        }
+
+        cp->cursor -= CONSOLE_COLUMNS;
+  201553:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201557:	48 8b 40 08          	mov    0x8(%rax),%rax
+  20155b:	48 8d 90 60 ff ff ff 	lea    -0xa0(%rax),%rdx
+  201562:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201566:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    }
+}
+  20156a:	90                   	nop
+  20156b:	c9                   	leave
+  20156c:	c3                   	ret
+
+000000000020156d <console_vprintf>:
+
+int console_vprintf(int cpos, int color, const char* format, va_list val) {
+  20156d:	55                   	push   %rbp
+  20156e:	48 89 e5             	mov    %rsp,%rbp
+  201571:	48 83 ec 30          	sub    $0x30,%rsp
+  201575:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  201578:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  20157b:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  20157f:	48 89 4d d8          	mov    %rcx,-0x28(%rbp)
+    struct console_printer cp;
+    cp.p.putc = console_putc;
+  201583:	48 8d 05 f5 fd ff ff 	lea    -0x20b(%rip),%rax        # 20137f <console_putc>
+  20158a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (cpos < 0 || cpos >= CONSOLE_ROWS * CONSOLE_COLUMNS) {
+  20158e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  201592:	78 09                	js     20159d <console_vprintf+0x30>
+  201594:	81 7d ec cf 07 00 00 	cmpl   $0x7cf,-0x14(%rbp)
+  20159b:	7e 07                	jle    2015a4 <console_vprintf+0x37>
+        cpos = 0;
+  20159d:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+    }
+    cp.cursor = console + cpos;
+  2015a4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  2015a7:	48 98                	cltq
+  2015a9:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  2015ad:	48 8d 05 4c 6a eb ff 	lea    -0x1495b4(%rip),%rax        # b8000 <console>
+  2015b4:	48 01 d0             	add    %rdx,%rax
+  2015b7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    printer_vprintf(&cp.p, color, format, val);
+  2015bb:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  2015bf:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  2015c3:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  2015c6:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  2015ca:	48 89 c7             	mov    %rax,%rdi
+  2015cd:	e8 a9 f3 ff ff       	call   20097b <printer_vprintf>
+    return cp.cursor - console;
+  2015d2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  2015d6:	48 8d 05 23 6a eb ff 	lea    -0x1495dd(%rip),%rax        # b8000 <console>
+  2015dd:	48 29 c2             	sub    %rax,%rdx
+  2015e0:	48 89 d0             	mov    %rdx,%rax
+  2015e3:	48 d1 f8             	sar    %rax
+}
+  2015e6:	c9                   	leave
+  2015e7:	c3                   	ret
+
+00000000002015e8 <console_printf>:
+
+int console_printf(int cpos, int color, const char* format, ...) {
+  2015e8:	55                   	push   %rbp
+  2015e9:	48 89 e5             	mov    %rsp,%rbp
+  2015ec:	48 83 ec 60          	sub    $0x60,%rsp
+  2015f0:	89 7d ac             	mov    %edi,-0x54(%rbp)
+  2015f3:	89 75 a8             	mov    %esi,-0x58(%rbp)
+  2015f6:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+  2015fa:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  2015fe:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  201602:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list val;
+    va_start(val, format);
+  201606:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  20160d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  201611:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  201615:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  201619:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    cpos = console_vprintf(cpos, color, format, val);
+  20161d:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  201621:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  201625:	8b 75 a8             	mov    -0x58(%rbp),%esi
+  201628:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  20162b:	89 c7                	mov    %eax,%edi
+  20162d:	e8 3b ff ff ff       	call   20156d <console_vprintf>
+  201632:	89 45 ac             	mov    %eax,-0x54(%rbp)
+    va_end(val);
+    return cpos;
+  201635:	8b 45 ac             	mov    -0x54(%rbp),%eax
+}
+  201638:	c9                   	leave
+  201639:	c3                   	ret
+
+000000000020163a <string_putc>:
+    printer p;
+    char* s;
+    char* end;
+} string_printer;
+
+static void string_putc(printer* p, unsigned char c, int color) {
+  20163a:	55                   	push   %rbp
+  20163b:	48 89 e5             	mov    %rsp,%rbp
+  20163e:	48 83 ec 20          	sub    $0x20,%rsp
+  201642:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  201646:	89 f0                	mov    %esi,%eax
+  201648:	89 55 e0             	mov    %edx,-0x20(%rbp)
+  20164b:	88 45 e4             	mov    %al,-0x1c(%rbp)
+    string_printer* sp = (string_printer*) p;
+  20164e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201652:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (sp->s < sp->end) {
+  201656:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20165a:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  20165e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  201662:	48 8b 40 10          	mov    0x10(%rax),%rax
+  201666:	48 39 c2             	cmp    %rax,%rdx
+  201669:	73 1a                	jae    201685 <string_putc+0x4b>
+        *sp->s++ = c;
+  20166b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20166f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  201673:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  201677:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  20167b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  20167f:	0f b6 55 e4          	movzbl -0x1c(%rbp),%edx
+  201683:	88 10                	mov    %dl,(%rax)
+    }
+    (void) color;
+}
+  201685:	90                   	nop
+  201686:	c9                   	leave
+  201687:	c3                   	ret
+
+0000000000201688 <vsnprintf>:
+
+int vsnprintf(char* s, size_t size, const char* format, va_list val) {
+  201688:	55                   	push   %rbp
+  201689:	48 89 e5             	mov    %rsp,%rbp
+  20168c:	48 83 ec 40          	sub    $0x40,%rsp
+  201690:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  201694:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  201698:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  20169c:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+    string_printer sp;
+    sp.p.putc = string_putc;
+  2016a0:	48 8d 05 93 ff ff ff 	lea    -0x6d(%rip),%rax        # 20163a <string_putc>
+  2016a7:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    sp.s = s;
+  2016ab:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  2016af:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (size) {
+  2016b3:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  2016b8:	74 33                	je     2016ed <vsnprintf+0x65>
+        sp.end = s + size - 1;
+  2016ba:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  2016be:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  2016c2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  2016c6:	48 01 d0             	add    %rdx,%rax
+  2016c9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+        printer_vprintf(&sp.p, 0, format, val);
+  2016cd:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  2016d1:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  2016d5:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  2016d9:	be 00 00 00 00       	mov    $0x0,%esi
+  2016de:	48 89 c7             	mov    %rax,%rdi
+  2016e1:	e8 95 f2 ff ff       	call   20097b <printer_vprintf>
+        *sp.s = 0;
+  2016e6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2016ea:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return sp.s - s;
+  2016ed:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2016f1:	48 2b 45 d8          	sub    -0x28(%rbp),%rax
+}
+  2016f5:	c9                   	leave
+  2016f6:	c3                   	ret
+
+00000000002016f7 <snprintf>:
+
+int snprintf(char* s, size_t size, const char* format, ...) {
+  2016f7:	55                   	push   %rbp
+  2016f8:	48 89 e5             	mov    %rsp,%rbp
+  2016fb:	48 83 ec 70          	sub    $0x70,%rsp
+  2016ff:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  201703:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  201707:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  20170b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  20170f:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  201713:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list val;
+    va_start(val, format);
+  201717:	c7 45 b0 18 00 00 00 	movl   $0x18,-0x50(%rbp)
+  20171e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  201722:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  201726:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  20172a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    int n = vsnprintf(s, size, format, val);
+  20172e:	48 8d 4d b0          	lea    -0x50(%rbp),%rcx
+  201732:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  201736:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  20173a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  20173e:	48 89 c7             	mov    %rax,%rdi
+  201741:	e8 42 ff ff ff       	call   201688 <vsnprintf>
+  201746:	89 45 cc             	mov    %eax,-0x34(%rbp)
+    va_end(val);
+    return n;
+  201749:	8b 45 cc             	mov    -0x34(%rbp),%eax
+}
+  20174c:	c9                   	leave
+  20174d:	c3                   	ret
+
+000000000020174e <console_clear>:
+
+
+// console_clear
+//    Erases the console and moves the cursor to the upper left (CPOS(0, 0)).
+
+void console_clear(void) {
+  20174e:	55                   	push   %rbp
+  20174f:	48 89 e5             	mov    %rsp,%rbp
+  201752:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < CONSOLE_ROWS * CONSOLE_COLUMNS; ++i) {
+  201756:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  20175d:	eb 1a                	jmp    201779 <console_clear+0x2b>
+        console[i] = ' ' | 0x0700;
+  20175f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  201762:	48 98                	cltq
+  201764:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  201768:	48 8d 05 91 68 eb ff 	lea    -0x14976f(%rip),%rax        # b8000 <console>
+  20176f:	66 c7 04 02 20 07    	movw   $0x720,(%rdx,%rax,1)
+    for (int i = 0; i < CONSOLE_ROWS * CONSOLE_COLUMNS; ++i) {
+  201775:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  201779:	81 7d fc cf 07 00 00 	cmpl   $0x7cf,-0x4(%rbp)
+  201780:	7e dd                	jle    20175f <console_clear+0x11>
+    }
+    cursorpos = 0;
+  201782:	c7 05 70 78 eb ff 00 	movl   $0x0,-0x148790(%rip)        # b8ffc <cursorpos>
+  201789:	00 00 00 
+}
+  20178c:	90                   	nop
+  20178d:	c9                   	leave
+  20178e:	c3                   	ret
+
+000000000020178f <string_to_char>:
+
+
+int string_to_char(const char *str, int *dest) {
+  20178f:	55                   	push   %rbp
+  201790:	48 89 e5             	mov    %rsp,%rbp
+  201793:	48 83 ec 20          	sub    $0x20,%rsp
+  201797:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  20179b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    if (*str == '\0') return -1;
+  20179f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2017a3:	0f b6 00             	movzbl (%rax),%eax
+  2017a6:	84 c0                	test   %al,%al
+  2017a8:	75 0a                	jne    2017b4 <string_to_char+0x25>
+  2017aa:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  2017af:	e9 e0 00 00 00       	jmp    201894 <string_to_char+0x105>
+
+    *dest = 0;
+  2017b4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  2017b8:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    for (; *str; str++) {
+  2017be:	e9 bd 00 00 00       	jmp    201880 <string_to_char+0xf1>
+        int digit = 0;
+  2017c3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+        switch (*str)
+  2017ca:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2017ce:	0f b6 00             	movzbl (%rax),%eax
+  2017d1:	0f be c0             	movsbl %al,%eax
+  2017d4:	83 e8 30             	sub    $0x30,%eax
+  2017d7:	83 f8 09             	cmp    $0x9,%eax
+  2017da:	77 7c                	ja     201858 <string_to_char+0xc9>
+  2017dc:	89 c0                	mov    %eax,%eax
+  2017de:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  2017e5:	00 
+  2017e6:	48 8d 05 f7 0c 00 00 	lea    0xcf7(%rip),%rax        # 2024e4 <flag_chars+0xf4>
+  2017ed:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+  2017f0:	48 98                	cltq
+  2017f2:	48 8d 15 eb 0c 00 00 	lea    0xceb(%rip),%rdx        # 2024e4 <flag_chars+0xf4>
+  2017f9:	48 01 d0             	add    %rdx,%rax
+  2017fc:	ff e0                	jmp    *%rax
+        {
+        case '0':
+            digit = 0;
+  2017fe:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+            break;
+  201805:	eb 58                	jmp    20185f <string_to_char+0xd0>
+        case '1':
+            digit = 1;
+  201807:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+            break;
+  20180e:	eb 4f                	jmp    20185f <string_to_char+0xd0>
+        case '2':
+            digit = 2;
+  201810:	c7 45 fc 02 00 00 00 	movl   $0x2,-0x4(%rbp)
+            break;
+  201817:	eb 46                	jmp    20185f <string_to_char+0xd0>
+        case '3':
+            digit = 3;
+  201819:	c7 45 fc 03 00 00 00 	movl   $0x3,-0x4(%rbp)
+            break;
+  201820:	eb 3d                	jmp    20185f <string_to_char+0xd0>
+        case '4':
+            digit = 4;
+  201822:	c7 45 fc 04 00 00 00 	movl   $0x4,-0x4(%rbp)
+            break;
+  201829:	eb 34                	jmp    20185f <string_to_char+0xd0>
+        case '5':
+            digit = 5;
+  20182b:	c7 45 fc 05 00 00 00 	movl   $0x5,-0x4(%rbp)
+            break;
+  201832:	eb 2b                	jmp    20185f <string_to_char+0xd0>
+        case '6':
+            digit = 6;
+  201834:	c7 45 fc 06 00 00 00 	movl   $0x6,-0x4(%rbp)
+            break;
+  20183b:	eb 22                	jmp    20185f <string_to_char+0xd0>
+        case '7':
+            digit = 7;
+  20183d:	c7 45 fc 07 00 00 00 	movl   $0x7,-0x4(%rbp)
+            break;
+  201844:	eb 19                	jmp    20185f <string_to_char+0xd0>
+        case '8':
+            digit = 8;
+  201846:	c7 45 fc 08 00 00 00 	movl   $0x8,-0x4(%rbp)
+            break;
+  20184d:	eb 10                	jmp    20185f <string_to_char+0xd0>
+        case '9':
+            digit = 9;
+  20184f:	c7 45 fc 09 00 00 00 	movl   $0x9,-0x4(%rbp)
+            break;
+  201856:	eb 07                	jmp    20185f <string_to_char+0xd0>
+        default:
+            return -1;
+  201858:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  20185d:	eb 35                	jmp    201894 <string_to_char+0x105>
+        }
+
+        *dest = *dest * 10 + digit;
+  20185f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  201863:	8b 10                	mov    (%rax),%edx
+  201865:	89 d0                	mov    %edx,%eax
+  201867:	c1 e0 02             	shl    $0x2,%eax
+  20186a:	01 d0                	add    %edx,%eax
+  20186c:	01 c0                	add    %eax,%eax
+  20186e:	89 c2                	mov    %eax,%edx
+  201870:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  201873:	01 c2                	add    %eax,%edx
+  201875:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  201879:	89 10                	mov    %edx,(%rax)
+    for (; *str; str++) {
+  20187b:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  201880:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201884:	0f b6 00             	movzbl (%rax),%eax
+  201887:	84 c0                	test   %al,%al
+  201889:	0f 85 34 ff ff ff    	jne    2017c3 <string_to_char+0x34>
+    }
+
+    return 0;
+  20188f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  201894:	c9                   	leave
+  201895:	c3                   	ret
+
+0000000000201896 <atoi>:
+
+int atoi(const char *str) {
+  201896:	55                   	push   %rbp
+  201897:	48 89 e5             	mov    %rsp,%rbp
+  20189a:	48 83 ec 18          	sub    $0x18,%rsp
+  20189e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    if (*str == '\0') return -1;
+  2018a2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2018a6:	0f b6 00             	movzbl (%rax),%eax
+  2018a9:	84 c0                	test   %al,%al
+  2018ab:	75 0a                	jne    2018b7 <atoi+0x21>
+  2018ad:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  2018b2:	e9 d7 00 00 00       	jmp    20198e <atoi+0xf8>
+
+    int n = 0;
+  2018b7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    for (; *str; str++) {
+  2018be:	e9 b7 00 00 00       	jmp    20197a <atoi+0xe4>
+        int digit = 0;
+  2018c3:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+        switch (*str)
+  2018ca:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2018ce:	0f b6 00             	movzbl (%rax),%eax
+  2018d1:	0f be c0             	movsbl %al,%eax
+  2018d4:	83 e8 30             	sub    $0x30,%eax
+  2018d7:	83 f8 09             	cmp    $0x9,%eax
+  2018da:	77 7c                	ja     201958 <atoi+0xc2>
+  2018dc:	89 c0                	mov    %eax,%eax
+  2018de:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  2018e5:	00 
+  2018e6:	48 8d 05 1f 0c 00 00 	lea    0xc1f(%rip),%rax        # 20250c <flag_chars+0x11c>
+  2018ed:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+  2018f0:	48 98                	cltq
+  2018f2:	48 8d 15 13 0c 00 00 	lea    0xc13(%rip),%rdx        # 20250c <flag_chars+0x11c>
+  2018f9:	48 01 d0             	add    %rdx,%rax
+  2018fc:	ff e0                	jmp    *%rax
+        {
+        case '0':
+            digit = 0;
+  2018fe:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+            break;
+  201905:	eb 58                	jmp    20195f <atoi+0xc9>
+        case '1':
+            digit = 1;
+  201907:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+            break;
+  20190e:	eb 4f                	jmp    20195f <atoi+0xc9>
+        case '2':
+            digit = 2;
+  201910:	c7 45 f8 02 00 00 00 	movl   $0x2,-0x8(%rbp)
+            break;
+  201917:	eb 46                	jmp    20195f <atoi+0xc9>
+        case '3':
+            digit = 3;
+  201919:	c7 45 f8 03 00 00 00 	movl   $0x3,-0x8(%rbp)
+            break;
+  201920:	eb 3d                	jmp    20195f <atoi+0xc9>
+        case '4':
+            digit = 4;
+  201922:	c7 45 f8 04 00 00 00 	movl   $0x4,-0x8(%rbp)
+            break;
+  201929:	eb 34                	jmp    20195f <atoi+0xc9>
+        case '5':
+            digit = 5;
+  20192b:	c7 45 f8 05 00 00 00 	movl   $0x5,-0x8(%rbp)
+            break;
+  201932:	eb 2b                	jmp    20195f <atoi+0xc9>
+        case '6':
+            digit = 6;
+  201934:	c7 45 f8 06 00 00 00 	movl   $0x6,-0x8(%rbp)
+            break;
+  20193b:	eb 22                	jmp    20195f <atoi+0xc9>
+        case '7':
+            digit = 7;
+  20193d:	c7 45 f8 07 00 00 00 	movl   $0x7,-0x8(%rbp)
+            break;
+  201944:	eb 19                	jmp    20195f <atoi+0xc9>
+        case '8':
+            digit = 8;
+  201946:	c7 45 f8 08 00 00 00 	movl   $0x8,-0x8(%rbp)
+            break;
+  20194d:	eb 10                	jmp    20195f <atoi+0xc9>
+        case '9':
+            digit = 9;
+  20194f:	c7 45 f8 09 00 00 00 	movl   $0x9,-0x8(%rbp)
+            break;
+  201956:	eb 07                	jmp    20195f <atoi+0xc9>
+        default:
+            return -1;
+  201958:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  20195d:	eb 2f                	jmp    20198e <atoi+0xf8>
+        }
+
+        n = n * 10 + digit;
+  20195f:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  201962:	89 d0                	mov    %edx,%eax
+  201964:	c1 e0 02             	shl    $0x2,%eax
+  201967:	01 d0                	add    %edx,%eax
+  201969:	01 c0                	add    %eax,%eax
+  20196b:	89 c2                	mov    %eax,%edx
+  20196d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  201970:	01 d0                	add    %edx,%eax
+  201972:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    for (; *str; str++) {
+  201975:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  20197a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20197e:	0f b6 00             	movzbl (%rax),%eax
+  201981:	84 c0                	test   %al,%al
+  201983:	0f 85 3a ff ff ff    	jne    2018c3 <atoi+0x2d>
+    }
+
+    return 0;
+  201989:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  20198e:	c9                   	leave
+  20198f:	c3                   	ret
+
+0000000000201990 <copy_comp>:
+        components[ncomp++] = (comp); \
+    } \
+} while (0)
+
+// Helper to copy a component to dst
+void copy_comp(const char *start, const char *end, char **pdst) {
+  201990:	55                   	push   %rbp
+  201991:	48 89 e5             	mov    %rsp,%rbp
+  201994:	48 83 ec 18          	sub    $0x18,%rsp
+  201998:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  20199c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  2019a0:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    while (start < end) {
+  2019a4:	eb 23                	jmp    2019c9 <copy_comp+0x39>
+        *(*pdst)++ = *start++;
+  2019a6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  2019aa:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  2019ae:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  2019b2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2019b6:	48 8b 00             	mov    (%rax),%rax
+  2019b9:	48 8d 70 01          	lea    0x1(%rax),%rsi
+  2019bd:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  2019c1:	48 89 31             	mov    %rsi,(%rcx)
+  2019c4:	0f b6 12             	movzbl (%rdx),%edx
+  2019c7:	88 10                	mov    %dl,(%rax)
+    while (start < end) {
+  2019c9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2019cd:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  2019d1:	72 d3                	jb     2019a6 <copy_comp+0x16>
+    }
+}
+  2019d3:	90                   	nop
+  2019d4:	90                   	nop
+  2019d5:	c9                   	leave
+  2019d6:	c3                   	ret
+
+00000000002019d7 <join_path>:
+
+
+void join_path(const char *abs_path, const char *path, char *dst) {
+  2019d7:	55                   	push   %rbp
+  2019d8:	48 89 e5             	mov    %rsp,%rbp
+  2019db:	48 81 ec 68 02 00 00 	sub    $0x268,%rsp
+  2019e2:	48 89 bd a8 fd ff ff 	mov    %rdi,-0x258(%rbp)
+  2019e9:	48 89 b5 a0 fd ff ff 	mov    %rsi,-0x260(%rbp)
+  2019f0:	48 89 95 98 fd ff ff 	mov    %rdx,-0x268(%rbp)
+    // If path is absolute, just copy it to dst (removing duplicate slashes, and trailing slash unless root)
+    if (path[0] == '/') {
+  2019f7:	48 8b 85 a0 fd ff ff 	mov    -0x260(%rbp),%rax
+  2019fe:	0f b6 00             	movzbl (%rax),%eax
+  201a01:	3c 2f                	cmp    $0x2f,%al
+  201a03:	0f 85 d6 00 00 00    	jne    201adf <join_path+0x108>
+        const char *src = path;
+  201a09:	48 8b 85 a0 fd ff ff 	mov    -0x260(%rbp),%rax
+  201a10:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+        char *d = dst;
+  201a14:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  201a1b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+        // Always start with a single slash
+        *d++ = '/';
+  201a1f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  201a23:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  201a27:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  201a2b:	c6 00 2f             	movb   $0x2f,(%rax)
+        src++;
+  201a2e:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+        int last_was_slash = 1;
+  201a33:	c7 45 b0 01 00 00 00 	movl   $0x1,-0x50(%rbp)
+        while (*src) {
+  201a3a:	eb 64                	jmp    201aa0 <join_path+0xc9>
+            if (*src == '/') {
+  201a3c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  201a40:	0f b6 00             	movzbl (%rax),%eax
+  201a43:	3c 2f                	cmp    $0x2f,%al
+  201a45:	75 35                	jne    201a7c <join_path+0xa5>
+                // Skip consecutive slashes
+                while (*src == '/') src++;
+  201a47:	eb 05                	jmp    201a4e <join_path+0x77>
+  201a49:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  201a4e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  201a52:	0f b6 00             	movzbl (%rax),%eax
+  201a55:	3c 2f                	cmp    $0x2f,%al
+  201a57:	74 f0                	je     201a49 <join_path+0x72>
+                if (*src == 0) break;
+  201a59:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  201a5d:	0f b6 00             	movzbl (%rax),%eax
+  201a60:	84 c0                	test   %al,%al
+  201a62:	74 49                	je     201aad <join_path+0xd6>
+                *d++ = '/';
+  201a64:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  201a68:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  201a6c:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  201a70:	c6 00 2f             	movb   $0x2f,(%rax)
+                last_was_slash = 1;
+  201a73:	c7 45 b0 01 00 00 00 	movl   $0x1,-0x50(%rbp)
+  201a7a:	eb 24                	jmp    201aa0 <join_path+0xc9>
+            } else {
+                *d++ = *src++;
+  201a7c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  201a80:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  201a84:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  201a88:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  201a8c:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  201a90:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  201a94:	0f b6 12             	movzbl (%rdx),%edx
+  201a97:	88 10                	mov    %dl,(%rax)
+                last_was_slash = 0;
+  201a99:	c7 45 b0 00 00 00 00 	movl   $0x0,-0x50(%rbp)
+        while (*src) {
+  201aa0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  201aa4:	0f b6 00             	movzbl (%rax),%eax
+  201aa7:	84 c0                	test   %al,%al
+  201aa9:	75 91                	jne    201a3c <join_path+0x65>
+  201aab:	eb 01                	jmp    201aae <join_path+0xd7>
+                if (*src == 0) break;
+  201aad:	90                   	nop
+            }
+        }
+        // Remove trailing slash unless the path is just "/"
+        if (d > dst + 1 && *(d-1) == '/') {
+  201aae:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  201ab5:	48 83 c0 01          	add    $0x1,%rax
+  201ab9:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  201abd:	73 14                	jae    201ad3 <join_path+0xfc>
+  201abf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  201ac3:	48 83 e8 01          	sub    $0x1,%rax
+  201ac7:	0f b6 00             	movzbl (%rax),%eax
+  201aca:	3c 2f                	cmp    $0x2f,%al
+  201acc:	75 05                	jne    201ad3 <join_path+0xfc>
+            d--;
+  201ace:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+        }
+        *d = 0;
+  201ad3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  201ad7:	c6 00 00             	movb   $0x0,(%rax)
+  201ada:	e9 e9 02 00 00       	jmp    201dc8 <join_path+0x3f1>
+        return;
+    }
+
+    // Otherwise, start with abs_path
+    const char *src = abs_path;
+  201adf:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  201ae6:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    char *d = dst;
+  201aea:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  201af1:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    if (*src != '/') {
+  201af5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201af9:	0f b6 00             	movzbl (%rax),%eax
+  201afc:	3c 2f                	cmp    $0x2f,%al
+  201afe:	74 2e                	je     201b2e <join_path+0x157>
+        *d++ = '/';
+  201b00:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  201b04:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  201b08:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  201b0c:	c6 00 2f             	movb   $0x2f,(%rax)
+    }
+    while (*src) {
+  201b0f:	eb 1d                	jmp    201b2e <join_path+0x157>
+        *d++ = *src++;
+  201b11:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  201b15:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  201b19:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  201b1d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  201b21:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  201b25:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  201b29:	0f b6 12             	movzbl (%rdx),%edx
+  201b2c:	88 10                	mov    %dl,(%rax)
+    while (*src) {
+  201b2e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201b32:	0f b6 00             	movzbl (%rax),%eax
+  201b35:	84 c0                	test   %al,%al
+  201b37:	75 d8                	jne    201b11 <join_path+0x13a>
+    }
+    // Remove trailing slash (unless root)
+    if (d > dst + 1 && *(d-1) == '/') {
+  201b39:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  201b40:	48 83 c0 01          	add    $0x1,%rax
+  201b44:	48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+  201b48:	73 14                	jae    201b5e <join_path+0x187>
+  201b4a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  201b4e:	48 83 e8 01          	sub    $0x1,%rax
+  201b52:	0f b6 00             	movzbl (%rax),%eax
+  201b55:	3c 2f                	cmp    $0x2f,%al
+  201b57:	75 05                	jne    201b5e <join_path+0x187>
+        d--;
+  201b59:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+    }
+    *d = 0;
+  201b5e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  201b62:	c6 00 00             	movb   $0x0,(%rax)
+
+    // Now, process path components
+    char temp[512];
+    int tlen = 0;
+  201b65:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    // Copy dst to temp for easier manipulation
+    src = dst;
+  201b6c:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  201b73:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    while (*src && tlen < (int)sizeof(temp)-1) {
+  201b77:	eb 22                	jmp    201b9b <join_path+0x1c4>
+        temp[tlen++] = *src++;
+  201b79:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201b7d:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  201b81:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  201b85:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  201b88:	8d 4a 01             	lea    0x1(%rdx),%ecx
+  201b8b:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  201b8e:	0f b6 08             	movzbl (%rax),%ecx
+  201b91:	48 63 c2             	movslq %edx,%rax
+  201b94:	88 8c 05 b0 fd ff ff 	mov    %cl,-0x250(%rbp,%rax,1)
+    while (*src && tlen < (int)sizeof(temp)-1) {
+  201b9b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201b9f:	0f b6 00             	movzbl (%rax),%eax
+  201ba2:	84 c0                	test   %al,%al
+  201ba4:	74 09                	je     201baf <join_path+0x1d8>
+  201ba6:	81 7d dc fe 01 00 00 	cmpl   $0x1fe,-0x24(%rbp)
+  201bad:	7e ca                	jle    201b79 <join_path+0x1a2>
+    }
+    temp[tlen] = 0;
+  201baf:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201bb2:	48 98                	cltq
+  201bb4:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  201bbb:	00 
+
+    // Now, process each component in path
+    src = path;
+  201bbc:	48 8b 85 a0 fd ff ff 	mov    -0x260(%rbp),%rax
+  201bc3:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    while (*src) {
+  201bc7:	e9 65 01 00 00       	jmp    201d31 <join_path+0x35a>
+        // Skip slashes
+        while (*src == '/') src++;
+  201bcc:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  201bd1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201bd5:	0f b6 00             	movzbl (%rax),%eax
+  201bd8:	3c 2f                	cmp    $0x2f,%al
+  201bda:	74 f0                	je     201bcc <join_path+0x1f5>
+        if (!*src) break;
+  201bdc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201be0:	0f b6 00             	movzbl (%rax),%eax
+  201be3:	84 c0                	test   %al,%al
+  201be5:	0f 84 57 01 00 00    	je     201d42 <join_path+0x36b>
+
+        // Find end of component
+        const char *comp_start = src;
+  201beb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201bef:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        while (*src && *src != '/') src++;
+  201bf3:	eb 05                	jmp    201bfa <join_path+0x223>
+  201bf5:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  201bfa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201bfe:	0f b6 00             	movzbl (%rax),%eax
+  201c01:	84 c0                	test   %al,%al
+  201c03:	74 0b                	je     201c10 <join_path+0x239>
+  201c05:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201c09:	0f b6 00             	movzbl (%rax),%eax
+  201c0c:	3c 2f                	cmp    $0x2f,%al
+  201c0e:	75 e5                	jne    201bf5 <join_path+0x21e>
+        const char *comp_end = src;
+  201c10:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201c14:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+
+        int comp_len = comp_end - comp_start;
+  201c18:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  201c1c:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  201c20:	89 45 b4             	mov    %eax,-0x4c(%rbp)
+
+        // Get component string
+        if (comp_len == 1 && comp_start[0] == '.') {
+  201c23:	83 7d b4 01          	cmpl   $0x1,-0x4c(%rbp)
+  201c27:	75 10                	jne    201c39 <join_path+0x262>
+  201c29:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  201c2d:	0f b6 00             	movzbl (%rax),%eax
+  201c30:	3c 2e                	cmp    $0x2e,%al
+  201c32:	75 05                	jne    201c39 <join_path+0x262>
+            // Ignore
+            continue;
+  201c34:	e9 f8 00 00 00       	jmp    201d31 <join_path+0x35a>
+        } else if (comp_len == 2 && comp_start[0] == '.' && comp_start[1] == '.') {
+  201c39:	83 7d b4 02          	cmpl   $0x2,-0x4c(%rbp)
+  201c3d:	75 6e                	jne    201cad <join_path+0x2d6>
+  201c3f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  201c43:	0f b6 00             	movzbl (%rax),%eax
+  201c46:	3c 2e                	cmp    $0x2e,%al
+  201c48:	75 63                	jne    201cad <join_path+0x2d6>
+  201c4a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  201c4e:	48 83 c0 01          	add    $0x1,%rax
+  201c52:	0f b6 00             	movzbl (%rax),%eax
+  201c55:	3c 2e                	cmp    $0x2e,%al
+  201c57:	75 54                	jne    201cad <join_path+0x2d6>
+            // Go up one directory, unless at root
+            if (tlen > 1) {
+  201c59:	83 7d dc 01          	cmpl   $0x1,-0x24(%rbp)
+  201c5d:	0f 8e ce 00 00 00    	jle    201d31 <join_path+0x35a>
+                // Remove trailing slash if any
+                if (temp[tlen-1] == '/') tlen--;
+  201c63:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201c66:	83 e8 01             	sub    $0x1,%eax
+  201c69:	48 98                	cltq
+  201c6b:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  201c72:	ff 
+  201c73:	3c 2f                	cmp    $0x2f,%al
+  201c75:	75 0a                	jne    201c81 <join_path+0x2aa>
+  201c77:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+                // Remove last component
+                while (tlen > 1 && temp[tlen-1] != '/') tlen--;
+  201c7b:	eb 04                	jmp    201c81 <join_path+0x2aa>
+  201c7d:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  201c81:	83 7d dc 01          	cmpl   $0x1,-0x24(%rbp)
+  201c85:	7e 14                	jle    201c9b <join_path+0x2c4>
+  201c87:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201c8a:	83 e8 01             	sub    $0x1,%eax
+  201c8d:	48 98                	cltq
+  201c8f:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  201c96:	ff 
+  201c97:	3c 2f                	cmp    $0x2f,%al
+  201c99:	75 e2                	jne    201c7d <join_path+0x2a6>
+                temp[tlen] = 0;
+  201c9b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201c9e:	48 98                	cltq
+  201ca0:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  201ca7:	00 
+            if (tlen > 1) {
+  201ca8:	e9 84 00 00 00       	jmp    201d31 <join_path+0x35a>
+            }
+        } else if (comp_len > 0) {
+  201cad:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  201cb1:	7e 7e                	jle    201d31 <join_path+0x35a>
+            // Add slash if not at root
+            if (tlen == 0 || temp[tlen-1] != '/') {
+  201cb3:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  201cb7:	74 14                	je     201ccd <join_path+0x2f6>
+  201cb9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201cbc:	83 e8 01             	sub    $0x1,%eax
+  201cbf:	48 98                	cltq
+  201cc1:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  201cc8:	ff 
+  201cc9:	3c 2f                	cmp    $0x2f,%al
+  201ccb:	74 1c                	je     201ce9 <join_path+0x312>
+                if (tlen < (int)sizeof(temp)-1) temp[tlen++] = '/';
+  201ccd:	81 7d dc fe 01 00 00 	cmpl   $0x1fe,-0x24(%rbp)
+  201cd4:	7f 13                	jg     201ce9 <join_path+0x312>
+  201cd6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201cd9:	8d 50 01             	lea    0x1(%rax),%edx
+  201cdc:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  201cdf:	48 98                	cltq
+  201ce1:	c6 84 05 b0 fd ff ff 	movb   $0x2f,-0x250(%rbp,%rax,1)
+  201ce8:	2f 
+            }
+            // Copy component
+            for (const char *p = comp_start; p < comp_end && tlen < (int)sizeof(temp)-1; ++p) {
+  201ce9:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  201ced:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  201cf1:	eb 1e                	jmp    201d11 <join_path+0x33a>
+                temp[tlen++] = *p;
+  201cf3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201cf6:	8d 50 01             	lea    0x1(%rax),%edx
+  201cf9:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  201cfc:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  201d00:	0f b6 12             	movzbl (%rdx),%edx
+  201d03:	48 98                	cltq
+  201d05:	88 94 05 b0 fd ff ff 	mov    %dl,-0x250(%rbp,%rax,1)
+            for (const char *p = comp_start; p < comp_end && tlen < (int)sizeof(temp)-1; ++p) {
+  201d0c:	48 83 45 d0 01       	addq   $0x1,-0x30(%rbp)
+  201d11:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  201d15:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  201d19:	73 09                	jae    201d24 <join_path+0x34d>
+  201d1b:	81 7d dc fe 01 00 00 	cmpl   $0x1fe,-0x24(%rbp)
+  201d22:	7e cf                	jle    201cf3 <join_path+0x31c>
+            }
+            temp[tlen] = 0;
+  201d24:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201d27:	48 98                	cltq
+  201d29:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  201d30:	00 
+    while (*src) {
+  201d31:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201d35:	0f b6 00             	movzbl (%rax),%eax
+  201d38:	84 c0                	test   %al,%al
+  201d3a:	0f 85 91 fe ff ff    	jne    201bd1 <join_path+0x1fa>
+  201d40:	eb 01                	jmp    201d43 <join_path+0x36c>
+        if (!*src) break;
+  201d42:	90                   	nop
+        }
+    }
+
+    // If temp is empty, set to "/"
+    if (tlen == 0) {
+  201d43:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  201d47:	75 20                	jne    201d69 <join_path+0x392>
+        temp[tlen++] = '/';
+  201d49:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201d4c:	8d 50 01             	lea    0x1(%rax),%edx
+  201d4f:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  201d52:	48 98                	cltq
+  201d54:	c6 84 05 b0 fd ff ff 	movb   $0x2f,-0x250(%rbp,%rax,1)
+  201d5b:	2f 
+        temp[tlen] = 0;
+  201d5c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201d5f:	48 98                	cltq
+  201d61:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  201d68:	00 
+    }
+
+    // Remove trailing slash unless the path is just "/"
+    if (tlen > 1 && temp[tlen-1] == '/') {
+  201d69:	83 7d dc 01          	cmpl   $0x1,-0x24(%rbp)
+  201d6d:	7e 25                	jle    201d94 <join_path+0x3bd>
+  201d6f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201d72:	83 e8 01             	sub    $0x1,%eax
+  201d75:	48 98                	cltq
+  201d77:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  201d7e:	ff 
+  201d7f:	3c 2f                	cmp    $0x2f,%al
+  201d81:	75 11                	jne    201d94 <join_path+0x3bd>
+        temp[--tlen] = 0;
+  201d83:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  201d87:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201d8a:	48 98                	cltq
+  201d8c:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  201d93:	00 
+    }
+
+    // Copy temp to dst
+    for (int i = 0; i <= tlen; ++i) {
+  201d94:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  201d9b:	eb 23                	jmp    201dc0 <join_path+0x3e9>
+        dst[i] = temp[i];
+  201d9d:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  201da0:	48 63 d0             	movslq %eax,%rdx
+  201da3:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  201daa:	48 01 c2             	add    %rax,%rdx
+  201dad:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  201db0:	48 98                	cltq
+  201db2:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  201db9:	ff 
+  201dba:	88 02                	mov    %al,(%rdx)
+    for (int i = 0; i <= tlen; ++i) {
+  201dbc:	83 45 cc 01          	addl   $0x1,-0x34(%rbp)
+  201dc0:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  201dc3:	3b 45 dc             	cmp    -0x24(%rbp),%eax
+  201dc6:	7e d5                	jle    201d9d <join_path+0x3c6>
+    }
+}
+  201dc8:	c9                   	leave
+  201dc9:	c3                   	ret
+
+0000000000201dca <app_printf>:
+#include "lib-malloc.h"
+#include "errno.h"
+// app_printf
+//     A version of console_printf that picks a sensible color by process ID.
+
+void app_printf(int colorid, const char* format, ...) {
+  201dca:	55                   	push   %rbp
+  201dcb:	48 89 e5             	mov    %rsp,%rbp
+  201dce:	48 83 ec 50          	sub    $0x50,%rsp
+  201dd2:	49 89 f2             	mov    %rsi,%r10
+  201dd5:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  201dd9:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  201ddd:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  201de1:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    int color;
+    if (colorid < 0) {
+        color = 0x0700;
+  201de5:	be 00 07 00 00       	mov    $0x700,%esi
+    if (colorid < 0) {
+  201dea:	85 ff                	test   %edi,%edi
+  201dec:	78 32                	js     201e20 <app_printf+0x56>
+    } else {
+        static const uint8_t col[] = { 0x0F, 0x0C, 0x0A, 0x09, 0x0E };
+        color = col[colorid % sizeof(col)] << 8;
+  201dee:	48 63 ff             	movslq %edi,%rdi
+  201df1:	48 ba cd cc cc cc cc 	movabs $0xcccccccccccccccd,%rdx
+  201df8:	cc cc cc 
+  201dfb:	48 89 f8             	mov    %rdi,%rax
+  201dfe:	48 f7 e2             	mul    %rdx
+  201e01:	48 89 d0             	mov    %rdx,%rax
+  201e04:	48 c1 e8 02          	shr    $0x2,%rax
+  201e08:	48 83 e2 fc          	and    $0xfffffffffffffffc,%rdx
+  201e0c:	48 01 c2             	add    %rax,%rdx
+  201e0f:	48 29 d7             	sub    %rdx,%rdi
+  201e12:	48 8d 05 1f 09 00 00 	lea    0x91f(%rip),%rax        # 202738 <col.0>
+  201e19:	0f b6 34 38          	movzbl (%rax,%rdi,1),%esi
+  201e1d:	c1 e6 08             	shl    $0x8,%esi
+    }
+
+    va_list val;
+    va_start(val, format);
+  201e20:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  201e27:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  201e2b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  201e2f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  201e33:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    cursorpos = console_vprintf(cursorpos, color, format, val);
+  201e37:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  201e3b:	4c 89 d2             	mov    %r10,%rdx
+  201e3e:	8b 3d b8 71 eb ff    	mov    -0x148e48(%rip),%edi        # b8ffc <cursorpos>
+  201e44:	e8 24 f7 ff ff       	call   20156d <console_vprintf>
+  201e49:	89 05 ad 71 eb ff    	mov    %eax,-0x148e53(%rip)        # b8ffc <cursorpos>
+    va_end(val);
+
+    /*if (CROW(cursorpos) >= 23) {
+        cursorpos = CPOS(0, 0);
+    }*/
+}
+  201e4f:	c9                   	leave
+  201e50:	c3                   	ret
+
+0000000000201e51 <panic>:
+
+
+// panic, assert_fail
+//     Call the INT_SYS_PANIC system call so the kernel loops until Control-C.
+
+void panic(const char* format, ...) {
+  201e51:	55                   	push   %rbp
+  201e52:	48 89 e5             	mov    %rsp,%rbp
+  201e55:	53                   	push   %rbx
+  201e56:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  201e5d:	48 89 fb             	mov    %rdi,%rbx
+  201e60:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  201e64:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  201e68:	48 89 4d d8          	mov    %rcx,-0x28(%rbp)
+  201e6c:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  201e70:	4c 89 4d e8          	mov    %r9,-0x18(%rbp)
+    va_list val;
+    va_start(val, format);
+  201e74:	c7 45 a8 08 00 00 00 	movl   $0x8,-0x58(%rbp)
+  201e7b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  201e7f:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  201e83:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  201e87:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    char buf[160];
+    memcpy(buf, "PANIC: ", 7);
+  201e8b:	48 8d bd 08 ff ff ff 	lea    -0xf8(%rbp),%rdi
+  201e92:	ba 07 00 00 00       	mov    $0x7,%edx
+  201e97:	48 8d 35 d3 06 00 00 	lea    0x6d3(%rip),%rsi        # 202571 <lower_digits.0+0x11>
+  201e9e:	e8 31 e5 ff ff       	call   2003d4 <memcpy>
+    int len = vsnprintf(&buf[7], sizeof(buf) - 7, format, val) + 7;
+  201ea3:	48 8d 4d a8          	lea    -0x58(%rbp),%rcx
+  201ea7:	48 8d bd 0f ff ff ff 	lea    -0xf1(%rbp),%rdi
+  201eae:	48 89 da             	mov    %rbx,%rdx
+  201eb1:	be 99 00 00 00       	mov    $0x99,%esi
+  201eb6:	e8 cd f7 ff ff       	call   201688 <vsnprintf>
+  201ebb:	8d 50 07             	lea    0x7(%rax),%edx
+    va_end(val);
+    if (len > 0 && buf[len - 1] != '\n') {
+  201ebe:	85 d2                	test   %edx,%edx
+  201ec0:	7e 0f                	jle    201ed1 <panic+0x80>
+  201ec2:	83 c0 06             	add    $0x6,%eax
+  201ec5:	48 98                	cltq
+  201ec7:	80 bc 05 08 ff ff ff 	cmpb   $0xa,-0xf8(%rbp,%rax,1)
+  201ece:	0a 
+  201ecf:	75 30                	jne    201f01 <panic+0xb0>
+        strcpy(buf + len - (len == (int) sizeof(buf) - 1), "\n");
+    }
+    (void) console_printf(CPOS(23, 0), 0xC000, "%s", buf);
+  201ed1:	48 8d 8d 08 ff ff ff 	lea    -0xf8(%rbp),%rcx
+  201ed8:	48 8d 15 c1 04 00 00 	lea    0x4c1(%rip),%rdx        # 2023a0 <malloc+0x87>
+  201edf:	be 00 c0 00 00       	mov    $0xc000,%esi
+  201ee4:	bf 30 07 00 00       	mov    $0x730,%edi
+  201ee9:	b8 00 00 00 00       	mov    $0x0,%eax
+  201eee:	e8 f5 f6 ff ff       	call   2015e8 <console_printf>
+    asm volatile ("syscall" : "=a" (rax)
+  201ef3:	b8 30 00 00 00       	mov    $0x30,%eax
+  201ef8:	bf 00 00 00 00       	mov    $0x0,%edi
+  201efd:	0f 05                	syscall
+ loop: goto loop;
+  201eff:	eb fe                	jmp    201eff <panic+0xae>
+        strcpy(buf + len - (len == (int) sizeof(buf) - 1), "\n");
+  201f01:	48 63 c2             	movslq %edx,%rax
+  201f04:	81 fa 9f 00 00 00    	cmp    $0x9f,%edx
+  201f0a:	0f 94 c2             	sete   %dl
+  201f0d:	0f b6 d2             	movzbl %dl,%edx
+  201f10:	48 29 d0             	sub    %rdx,%rax
+  201f13:	48 8d bc 05 08 ff ff 	lea    -0xf8(%rbp,%rax,1),%rdi
+  201f1a:	ff 
+  201f1b:	48 8d 35 2f 07 00 00 	lea    0x72f(%rip),%rsi        # 202651 <lower_digits.0+0xf1>
+  201f22:	e8 3b e8 ff ff       	call   200762 <strcpy>
+  201f27:	eb a8                	jmp    201ed1 <panic+0x80>
+
+0000000000201f29 <raise>:
+
+#define SIGABRT -1
+
+
+
+int raise(int sig) {
+  201f29:	89 fe                	mov    %edi,%esi
+
+// getpid()
+//    Return current process ID, like sys_getpid().
+static inline pid_t getpid(void) {
+    return vdso()->pid;
+  201f2b:	8b 3c 25 00 10 24 00 	mov    0x241000,%edi
+    asm volatile ("syscall" : "=a" (result)
+  201f32:	b8 41 00 00 00       	mov    $0x41,%eax
+  201f37:	0f 05                	syscall
+    return sys_kill(getpid(), sig);
+}
+  201f39:	c3                   	ret
+
+0000000000201f3a <abort>:
+    return vdso()->pid;
+  201f3a:	8b 3c 25 00 10 24 00 	mov    0x241000,%edi
+    asm volatile ("syscall" : "=a" (result)
+  201f41:	b8 41 00 00 00       	mov    $0x41,%eax
+  201f46:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  201f4b:	0f 05                	syscall
+
+void __attribute((noreturn)) abort(void) {
+    raise(SIGABRT);
+ spinloop: goto spinloop;       // should never get here
+  201f4d:	eb fe                	jmp    201f4d <abort+0x13>
+
+0000000000201f4f <assert_fail>:
+}
+
+
+void assert_fail(const char* file, int line, const char* msg) {
+  201f4f:	55                   	push   %rbp
+  201f50:	48 89 e5             	mov    %rsp,%rbp
+  201f53:	48 89 f9             	mov    %rdi,%rcx
+  201f56:	41 89 f0             	mov    %esi,%r8d
+  201f59:	49 89 d1             	mov    %rdx,%r9
+    (void) console_printf(CPOS(23, 0), 0xC000,
+  201f5c:	48 8d 15 f5 06 00 00 	lea    0x6f5(%rip),%rdx        # 202658 <lower_digits.0+0xf8>
+  201f63:	be 00 c0 00 00       	mov    $0xc000,%esi
+  201f68:	bf 30 07 00 00       	mov    $0x730,%edi
+  201f6d:	b8 00 00 00 00       	mov    $0x0,%eax
+  201f72:	e8 71 f6 ff ff       	call   2015e8 <console_printf>
+                          "PANIC: %s:%d: assertion '%s' failed\n",
+                          file, line, msg);
+    abort();
+  201f77:	e8 be ff ff ff       	call   201f3a <abort>
+
+0000000000201f7c <scan_char>:
+    asm volatile ("syscall" : "=a" (result)
+  201f7c:	bf 3a 00 00 00       	mov    $0x3a,%edi
+    asm volatile ("syscall" : "=a" (rax)
+  201f81:	be 3c 00 00 00       	mov    $0x3c,%esi
+    asm volatile ("syscall" : "=a" (result)
+  201f86:	89 f8                	mov    %edi,%eax
+  201f88:	0f 05                	syscall
+  201f8a:	89 c2                	mov    %eax,%edx
+    asm volatile ("syscall" : "=a" (rax)
+  201f8c:	89 f0                	mov    %esi,%eax
+  201f8e:	0f 05                	syscall
+    int c;
+
+    do {
+        c = sys_keybord();
+        sys_yield();
+    } while (c == -1);
+  201f90:	83 fa ff             	cmp    $0xffffffff,%edx
+  201f93:	74 f1                	je     201f86 <scan_char+0xa>
+
+    return c;
+  201f95:	89 d0                	mov    %edx,%eax
+}
+  201f97:	c3                   	ret
+
+0000000000201f98 <scan_line>:
+
+unsigned int scan_line(char* dst, unsigned int length_max) {
+  201f98:	55                   	push   %rbp
+  201f99:	48 89 e5             	mov    %rsp,%rbp
+  201f9c:	41 57                	push   %r15
+  201f9e:	41 56                	push   %r14
+  201fa0:	41 55                	push   %r13
+  201fa2:	41 54                	push   %r12
+  201fa4:	53                   	push   %rbx
+  201fa5:	48 83 ec 08          	sub    $0x8,%rsp
+  201fa9:	49 89 fe             	mov    %rdi,%r14
+  201fac:	41 89 f5             	mov    %esi,%r13d
+    unsigned int length = 0;
+  201faf:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            app_printf(0, "%c", c);
+            dst[length] = '\0';
+            return length;
+        } else if (c >= 32 && c <= 127) {
+            if (length < length_max) {
+                app_printf(0, "%c", c);
+  201fb5:	4c 8d 3d bd 05 00 00 	lea    0x5bd(%rip),%r15        # 202579 <lower_digits.0+0x19>
+  201fbc:	eb 05                	jmp    201fc3 <scan_line+0x2b>
+            if (length != 0) {
+  201fbe:	45 85 e4             	test   %r12d,%r12d
+  201fc1:	75 3e                	jne    202001 <scan_line+0x69>
+        unsigned char c = scan_char();
+  201fc3:	e8 b4 ff ff ff       	call   201f7c <scan_char>
+  201fc8:	89 c3                	mov    %eax,%ebx
+        if (c == '\b') {
+  201fca:	3c 08                	cmp    $0x8,%al
+  201fcc:	74 f0                	je     201fbe <scan_line+0x26>
+        } else if (c == '\n') {
+  201fce:	3c 0a                	cmp    $0xa,%al
+  201fd0:	74 4c                	je     20201e <scan_line+0x86>
+        } else if (c >= 32 && c <= 127) {
+  201fd2:	8d 43 e0             	lea    -0x20(%rbx),%eax
+            if (length < length_max) {
+  201fd5:	3c 5f                	cmp    $0x5f,%al
+  201fd7:	77 ea                	ja     201fc3 <scan_line+0x2b>
+  201fd9:	45 39 ec             	cmp    %r13d,%r12d
+  201fdc:	73 e5                	jae    201fc3 <scan_line+0x2b>
+                app_printf(0, "%c", c);
+  201fde:	0f b6 d3             	movzbl %bl,%edx
+  201fe1:	4c 89 fe             	mov    %r15,%rsi
+  201fe4:	bf 00 00 00 00       	mov    $0x0,%edi
+  201fe9:	b8 00 00 00 00       	mov    $0x0,%eax
+  201fee:	e8 d7 fd ff ff       	call   201dca <app_printf>
+                dst[length++] = c;
+  201ff3:	44 89 e0             	mov    %r12d,%eax
+  201ff6:	41 88 1c 06          	mov    %bl,(%r14,%rax,1)
+  201ffa:	45 8d 64 24 01       	lea    0x1(%r12),%r12d
+  201fff:	eb c2                	jmp    201fc3 <scan_line+0x2b>
+                app_printf(0, "%c", c);
+  202001:	ba 08 00 00 00       	mov    $0x8,%edx
+  202006:	4c 89 fe             	mov    %r15,%rsi
+  202009:	bf 00 00 00 00       	mov    $0x0,%edi
+  20200e:	b8 00 00 00 00       	mov    $0x0,%eax
+  202013:	e8 b2 fd ff ff       	call   201dca <app_printf>
+                length--;
+  202018:	41 83 ec 01          	sub    $0x1,%r12d
+  20201c:	eb a5                	jmp    201fc3 <scan_line+0x2b>
+            app_printf(0, "%c", c);
+  20201e:	ba 0a 00 00 00       	mov    $0xa,%edx
+  202023:	48 8d 35 4f 05 00 00 	lea    0x54f(%rip),%rsi        # 202579 <lower_digits.0+0x19>
+  20202a:	bf 00 00 00 00       	mov    $0x0,%edi
+  20202f:	b8 00 00 00 00       	mov    $0x0,%eax
+  202034:	e8 91 fd ff ff       	call   201dca <app_printf>
+            dst[length] = '\0';
+  202039:	44 89 e0             	mov    %r12d,%eax
+  20203c:	41 c6 04 06 00       	movb   $0x0,(%r14,%rax,1)
+            }
+        }
+    }
+}
+  202041:	44 89 e0             	mov    %r12d,%eax
+  202044:	48 83 c4 08          	add    $0x8,%rsp
+  202048:	5b                   	pop    %rbx
+  202049:	41 5c                	pop    %r12
+  20204b:	41 5d                	pop    %r13
+  20204d:	41 5e                	pop    %r14
+  20204f:	41 5f                	pop    %r15
+  202051:	5d                   	pop    %rbp
+  202052:	c3                   	ret
+
+0000000000202053 <split_string>:
+
+
+char** split_string(char* str, char sep) {
+  202053:	55                   	push   %rbp
+  202054:	48 89 e5             	mov    %rsp,%rbp
+  202057:	41 57                	push   %r15
+  202059:	41 56                	push   %r14
+  20205b:	41 55                	push   %r13
+  20205d:	41 54                	push   %r12
+  20205f:	53                   	push   %rbx
+  202060:	48 83 ec 08          	sub    $0x8,%rsp
+    int s = 1;
+    int n = 0;
+
+    while (str[n]) {
+  202064:	0f b6 07             	movzbl (%rdi),%eax
+  202067:	84 c0                	test   %al,%al
+  202069:	0f 84 ad 00 00 00    	je     20211c <split_string+0xc9>
+  20206f:	48 89 fb             	mov    %rdi,%rbx
+  202072:	41 89 f4             	mov    %esi,%r12d
+  202075:	41 be 01 00 00 00    	mov    $0x1,%r14d
+    int s = 1;
+  20207b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  202080:	eb 03                	jmp    202085 <split_string+0x32>
+  202082:	49 89 d6             	mov    %rdx,%r14
+        if (str[n] == sep)
+            s++;
+  202085:	41 38 c4             	cmp    %al,%r12b
+  202088:	0f 94 c0             	sete   %al
+  20208b:	0f b6 c0             	movzbl %al,%eax
+  20208e:	01 c1                	add    %eax,%ecx
+    while (str[n]) {
+  202090:	49 8d 56 01          	lea    0x1(%r14),%rdx
+  202094:	0f b6 44 13 ff       	movzbl -0x1(%rbx,%rdx,1),%eax
+  202099:	84 c0                	test   %al,%al
+  20209b:	75 e5                	jne    202082 <split_string+0x2f>
+        n++;
+    }
+    
+    char** part = malloc((s+1)*sizeof(char*));
+  20209d:	44 8d 79 01          	lea    0x1(%rcx),%r15d
+  2020a1:	4d 63 ff             	movslq %r15d,%r15
+  2020a4:	49 c1 e7 03          	shl    $0x3,%r15
+  2020a8:	4c 89 ff             	mov    %r15,%rdi
+  2020ab:	e8 69 02 00 00       	call   202319 <malloc>
+  2020b0:	49 89 c5             	mov    %rax,%r13
+    char* buffer = malloc(n+1);
+  2020b3:	41 8d 7e 01          	lea    0x1(%r14),%edi
+  2020b7:	48 63 ff             	movslq %edi,%rdi
+  2020ba:	e8 5a 02 00 00       	call   202319 <malloc>
+
+    int word_n = 0;
+    part[0] = buffer;
+  2020bf:	49 89 45 00          	mov    %rax,0x0(%r13)
+    part[s] = NULL;
+  2020c3:	4b c7 44 3d f8 00 00 	movq   $0x0,-0x8(%r13,%r15,1)
+  2020ca:	00 00 
+    buffer[n] = 0;
+  2020cc:	42 c6 04 30 00       	movb   $0x0,(%rax,%r14,1)
+
+    for (int i = 0; i < n; i++) {
+  2020d1:	45 85 f6             	test   %r14d,%r14d
+  2020d4:	7e 6c                	jle    202142 <split_string+0xef>
+  2020d6:	41 83 ee 01          	sub    $0x1,%r14d
+  2020da:	48 89 da             	mov    %rbx,%rdx
+  2020dd:	48 83 c0 01          	add    $0x1,%rax
+  2020e1:	48 89 c1             	mov    %rax,%rcx
+    int word_n = 0;
+  2020e4:	bf 00 00 00 00       	mov    $0x0,%edi
+  2020e9:	eb 23                	jmp    20210e <split_string+0xbb>
+        if (str[i] == sep) {
+            buffer[i] = 0;
+  2020eb:	c6 41 ff 00          	movb   $0x0,-0x1(%rcx)
+            part[++word_n] = &buffer[i+1];
+  2020ef:	83 c7 01             	add    $0x1,%edi
+  2020f2:	48 63 f7             	movslq %edi,%rsi
+  2020f5:	49 89 4c f5 00       	mov    %rcx,0x0(%r13,%rsi,8)
+    for (int i = 0; i < n; i++) {
+  2020fa:	48 83 c2 01          	add    $0x1,%rdx
+  2020fe:	48 83 c1 01          	add    $0x1,%rcx
+  202102:	89 ce                	mov    %ecx,%esi
+  202104:	29 c6                	sub    %eax,%esi
+  202106:	83 ee 01             	sub    $0x1,%esi
+  202109:	44 39 f6             	cmp    %r14d,%esi
+  20210c:	7d 34                	jge    202142 <split_string+0xef>
+        if (str[i] == sep) {
+  20210e:	0f b6 32             	movzbl (%rdx),%esi
+  202111:	44 38 e6             	cmp    %r12b,%sil
+  202114:	74 d5                	je     2020eb <split_string+0x98>
+        } else {
+            buffer[i] = str[i];
+  202116:	40 88 71 ff          	mov    %sil,-0x1(%rcx)
+  20211a:	eb de                	jmp    2020fa <split_string+0xa7>
+    char** part = malloc((s+1)*sizeof(char*));
+  20211c:	bf 10 00 00 00       	mov    $0x10,%edi
+  202121:	e8 f3 01 00 00       	call   202319 <malloc>
+  202126:	49 89 c5             	mov    %rax,%r13
+    char* buffer = malloc(n+1);
+  202129:	bf 01 00 00 00       	mov    $0x1,%edi
+  20212e:	e8 e6 01 00 00       	call   202319 <malloc>
+    part[0] = buffer;
+  202133:	49 89 45 00          	mov    %rax,0x0(%r13)
+    part[s] = NULL;
+  202137:	49 c7 45 08 00 00 00 	movq   $0x0,0x8(%r13)
+  20213e:	00 
+    buffer[n] = 0;
+  20213f:	c6 00 00             	movb   $0x0,(%rax)
+        }
+    }
+
+    return part;
+}
+  202142:	4c 89 e8             	mov    %r13,%rax
+  202145:	48 83 c4 08          	add    $0x8,%rsp
+  202149:	5b                   	pop    %rbx
+  20214a:	41 5c                	pop    %r12
+  20214c:	41 5d                	pop    %r13
+  20214e:	41 5e                	pop    %r14
+  202150:	41 5f                	pop    %r15
+  202152:	5d                   	pop    %rbp
+  202153:	c3                   	ret
+
+0000000000202154 <app_print_error>:
+
+
+void app_print_error(int r) {
+  202154:	55                   	push   %rbp
+  202155:	48 89 e5             	mov    %rsp,%rbp
+    switch (r) {
+  202158:	83 ff 24             	cmp    $0x24,%edi
+  20215b:	0f 87 79 01 00 00    	ja     2022da <app_print_error+0x186>
+  202161:	89 f8                	mov    %edi,%eax
+  202163:	48 8d 15 3a 05 00 00 	lea    0x53a(%rip),%rdx        # 2026a4 <lower_digits.0+0x144>
+  20216a:	48 63 04 82          	movslq (%rdx,%rax,4),%rax
+  20216e:	48 01 d0             	add    %rdx,%rax
+  202171:	ff e0                	jmp    *%rax
+        case ENOENT:
+            app_printf(1, "Error: %s\n", "No such file or directory");
+  202173:	48 8d 15 02 04 00 00 	lea    0x402(%rip),%rdx        # 20257c <lower_digits.0+0x1c>
+  20217a:	48 8d 35 15 04 00 00 	lea    0x415(%rip),%rsi        # 202596 <lower_digits.0+0x36>
+  202181:	bf 01 00 00 00       	mov    $0x1,%edi
+  202186:	b8 00 00 00 00       	mov    $0x0,%eax
+  20218b:	e8 3a fc ff ff       	call   201dca <app_printf>
+            break;
+        default:
+            app_printf(1, "Error %d: %s\n", r, "Unknown error");
+            break;
+    }
+}
+  202190:	5d                   	pop    %rbp
+  202191:	c3                   	ret
+            app_printf(1, "Error: %s\n", "I/O error");
+  202192:	48 8d 15 08 04 00 00 	lea    0x408(%rip),%rdx        # 2025a1 <lower_digits.0+0x41>
+  202199:	48 8d 35 f6 03 00 00 	lea    0x3f6(%rip),%rsi        # 202596 <lower_digits.0+0x36>
+  2021a0:	bf 01 00 00 00       	mov    $0x1,%edi
+  2021a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  2021aa:	e8 1b fc ff ff       	call   201dca <app_printf>
+            break;
+  2021af:	eb df                	jmp    202190 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Exec format error");
+  2021b1:	48 8d 15 f3 03 00 00 	lea    0x3f3(%rip),%rdx        # 2025ab <lower_digits.0+0x4b>
+  2021b8:	48 8d 35 d7 03 00 00 	lea    0x3d7(%rip),%rsi        # 202596 <lower_digits.0+0x36>
+  2021bf:	bf 01 00 00 00       	mov    $0x1,%edi
+  2021c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  2021c9:	e8 fc fb ff ff       	call   201dca <app_printf>
+            break;
+  2021ce:	eb c0                	jmp    202190 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Resource temporarily unavailable");
+  2021d0:	48 8d 15 a9 04 00 00 	lea    0x4a9(%rip),%rdx        # 202680 <lower_digits.0+0x120>
+  2021d7:	48 8d 35 b8 03 00 00 	lea    0x3b8(%rip),%rsi        # 202596 <lower_digits.0+0x36>
+  2021de:	bf 01 00 00 00       	mov    $0x1,%edi
+  2021e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  2021e8:	e8 dd fb ff ff       	call   201dca <app_printf>
+            break;
+  2021ed:	eb a1                	jmp    202190 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Out of memory");
+  2021ef:	48 8d 15 c7 03 00 00 	lea    0x3c7(%rip),%rdx        # 2025bd <lower_digits.0+0x5d>
+  2021f6:	48 8d 35 99 03 00 00 	lea    0x399(%rip),%rsi        # 202596 <lower_digits.0+0x36>
+  2021fd:	bf 01 00 00 00       	mov    $0x1,%edi
+  202202:	b8 00 00 00 00       	mov    $0x0,%eax
+  202207:	e8 be fb ff ff       	call   201dca <app_printf>
+            break;
+  20220c:	eb 82                	jmp    202190 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Bad address");
+  20220e:	48 8d 15 b6 03 00 00 	lea    0x3b6(%rip),%rdx        # 2025cb <lower_digits.0+0x6b>
+  202215:	48 8d 35 7a 03 00 00 	lea    0x37a(%rip),%rsi        # 202596 <lower_digits.0+0x36>
+  20221c:	bf 01 00 00 00       	mov    $0x1,%edi
+  202221:	b8 00 00 00 00       	mov    $0x0,%eax
+  202226:	e8 9f fb ff ff       	call   201dca <app_printf>
+            break;
+  20222b:	e9 60 ff ff ff       	jmp    202190 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Not a directory");
+  202230:	48 8d 15 a0 03 00 00 	lea    0x3a0(%rip),%rdx        # 2025d7 <lower_digits.0+0x77>
+  202237:	48 8d 35 58 03 00 00 	lea    0x358(%rip),%rsi        # 202596 <lower_digits.0+0x36>
+  20223e:	bf 01 00 00 00       	mov    $0x1,%edi
+  202243:	b8 00 00 00 00       	mov    $0x0,%eax
+  202248:	e8 7d fb ff ff       	call   201dca <app_printf>
+            break;
+  20224d:	e9 3e ff ff ff       	jmp    202190 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Invalid argument");
+  202252:	48 8d 15 8e 03 00 00 	lea    0x38e(%rip),%rdx        # 2025e7 <lower_digits.0+0x87>
+  202259:	48 8d 35 36 03 00 00 	lea    0x336(%rip),%rsi        # 202596 <lower_digits.0+0x36>
+  202260:	bf 01 00 00 00       	mov    $0x1,%edi
+  202265:	b8 00 00 00 00       	mov    $0x0,%eax
+  20226a:	e8 5b fb ff ff       	call   201dca <app_printf>
+            break;
+  20226f:	e9 1c ff ff ff       	jmp    202190 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "No space left on device");
+  202274:	48 8d 15 7d 03 00 00 	lea    0x37d(%rip),%rdx        # 2025f8 <lower_digits.0+0x98>
+  20227b:	48 8d 35 14 03 00 00 	lea    0x314(%rip),%rsi        # 202596 <lower_digits.0+0x36>
+  202282:	bf 01 00 00 00       	mov    $0x1,%edi
+  202287:	b8 00 00 00 00       	mov    $0x0,%eax
+  20228c:	e8 39 fb ff ff       	call   201dca <app_printf>
+            break;
+  202291:	e9 fa fe ff ff       	jmp    202190 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "File already exists");
+  202296:	48 8d 15 73 03 00 00 	lea    0x373(%rip),%rdx        # 202610 <lower_digits.0+0xb0>
+  20229d:	48 8d 35 f2 02 00 00 	lea    0x2f2(%rip),%rsi        # 202596 <lower_digits.0+0x36>
+  2022a4:	bf 01 00 00 00       	mov    $0x1,%edi
+  2022a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  2022ae:	e8 17 fb ff ff       	call   201dca <app_printf>
+            break;
+  2022b3:	e9 d8 fe ff ff       	jmp    202190 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "File name too long");
+  2022b8:	48 8d 15 65 03 00 00 	lea    0x365(%rip),%rdx        # 202624 <lower_digits.0+0xc4>
+  2022bf:	48 8d 35 d0 02 00 00 	lea    0x2d0(%rip),%rsi        # 202596 <lower_digits.0+0x36>
+  2022c6:	bf 01 00 00 00       	mov    $0x1,%edi
+  2022cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  2022d0:	e8 f5 fa ff ff       	call   201dca <app_printf>
+            break;
+  2022d5:	e9 b6 fe ff ff       	jmp    202190 <app_print_error+0x3c>
+            app_printf(1, "Error %d: %s\n", r, "Unknown error");
+  2022da:	48 8d 0d 56 03 00 00 	lea    0x356(%rip),%rcx        # 202637 <lower_digits.0+0xd7>
+  2022e1:	89 fa                	mov    %edi,%edx
+  2022e3:	48 8d 35 5b 03 00 00 	lea    0x35b(%rip),%rsi        # 202645 <lower_digits.0+0xe5>
+  2022ea:	bf 01 00 00 00       	mov    $0x1,%edi
+  2022ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  2022f4:	e8 d1 fa ff ff       	call   201dca <app_printf>
+}
+  2022f9:	e9 92 fe ff ff       	jmp    202190 <app_print_error+0x3c>
+
+00000000002022fe <handle_error>:
+
+__attribute__((noreturn)) void handle_error(int r) {
+  2022fe:	55                   	push   %rbp
+  2022ff:	48 89 e5             	mov    %rsp,%rbp
+  202302:	53                   	push   %rbx
+  202303:	48 83 ec 08          	sub    $0x8,%rsp
+  202307:	89 fb                	mov    %edi,%ebx
+    app_print_error(r);
+  202309:	e8 46 fe ff ff       	call   202154 <app_print_error>
+    asm volatile ("syscall" : "=a" (rax)
+  20230e:	b8 40 00 00 00       	mov    $0x40,%eax
+  202313:	89 df                	mov    %ebx,%edi
+  202315:	0f 05                	syscall
+ spinloop: goto spinloop;       // should never get here
+  202317:	eb fe                	jmp    202317 <handle_error+0x19>
+
+0000000000202319 <malloc>:
+
+// The heap starts 1MB above the program image (PROC_START_ADDR)
+static uint8_t* heap_top = (uint8_t*) 0x300000;
+static uint8_t* page_top = (uint8_t*) 0x300000;
+
+void* malloc(size_t size) {
+  202319:	48 89 fe             	mov    %rdi,%rsi
+    while (ROUNDDOWN(heap_top + size, PAGESIZE) >= page_top) {
+  20231c:	48 8b 05 ed 0c 00 00 	mov    0xced(%rip),%rax        # 203010 <heap_top>
+  202323:	48 8d 14 38          	lea    (%rax,%rdi,1),%rdx
+  202327:	48 8b 3d da 0c 00 00 	mov    0xcda(%rip),%rdi        # 203008 <page_top>
+  20232e:	48 89 d1             	mov    %rdx,%rcx
+  202331:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  202338:	48 39 f9             	cmp    %rdi,%rcx
+  20233b:	72 3e                	jb     20237b <malloc+0x62>
+    asm volatile ("syscall" : "=a" (result)
+  20233d:	41 b8 3b 00 00 00    	mov    $0x3b,%r8d
+  202343:	44 89 c0             	mov    %r8d,%eax
+  202346:	0f 05                	syscall
+        int r = sys_page_alloc(page_top);
+        assert(r >= 0);
+  202348:	85 c0                	test   %eax,%eax
+  20234a:	78 37                	js     202383 <malloc+0x6a>
+        page_top += PAGESIZE;
+  20234c:	48 8b 05 b5 0c 00 00 	mov    0xcb5(%rip),%rax        # 203008 <page_top>
+  202353:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  20235a:	48 89 3d a7 0c 00 00 	mov    %rdi,0xca7(%rip)        # 203008 <page_top>
+    while (ROUNDDOWN(heap_top + size, PAGESIZE) >= page_top) {
+  202361:	48 8b 05 a8 0c 00 00 	mov    0xca8(%rip),%rax        # 203010 <heap_top>
+  202368:	48 8d 14 30          	lea    (%rax,%rsi,1),%rdx
+  20236c:	48 89 d1             	mov    %rdx,%rcx
+  20236f:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  202376:	48 39 f9             	cmp    %rdi,%rcx
+  202379:	73 c8                	jae    202343 <malloc+0x2a>
+    }
+
+    void* addr = heap_top;
+    heap_top += size;
+  20237b:	48 89 15 8e 0c 00 00 	mov    %rdx,0xc8e(%rip)        # 203010 <heap_top>
+    return addr;
+}
+  202382:	c3                   	ret
+void* malloc(size_t size) {
+  202383:	55                   	push   %rbp
+  202384:	48 89 e5             	mov    %rsp,%rbp
+        assert(r >= 0);
+  202387:	48 8d 15 af 03 00 00 	lea    0x3af(%rip),%rdx        # 20273d <col.0+0x5>
+  20238e:	be 0b 00 00 00       	mov    $0xb,%esi
+  202393:	48 8d 3d aa 03 00 00 	lea    0x3aa(%rip),%rdi        # 202744 <col.0+0xc>
+  20239a:	e8 b0 fb ff ff       	call   201f4f <assert_fail>
@@ -0,0 +1,3345 @@
+
+obj/p-cp.full:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000200000 <usage>:
+const char *usage_str =
+    "Usage: cp SOURCE DEST\n"
+    "Copy SOURCE to the new file DEST.\n";
+
+
+void __attribute__((noreturn)) usage(void) {
+  200000:	55                   	push   %rbp
+  200001:	48 89 e5             	mov    %rsp,%rbp
+    app_printf(0, "%s", usage_str);
+  200004:	48 8b 15 f5 2f 00 00 	mov    0x2ff5(%rip),%rdx        # 203000 <usage_str>
+  20000b:	48 8d 35 8e 20 00 00 	lea    0x208e(%rip),%rsi        # 2020a0 <malloc+0x95>
+  200012:	bf 00 00 00 00       	mov    $0x0,%edi
+  200017:	b8 00 00 00 00       	mov    $0x0,%eax
+  20001c:	e8 9b 1a 00 00       	call   201abc <app_printf>
+// sys_exit()
+//    Exit this process. Does not return.
+static inline void sys_exit(int exit_code) __attribute__((noreturn));
+static inline void sys_exit(int exit_code) {
+    uint64_t rax;
+    asm volatile ("syscall" : "=a" (rax)
+  200021:	b8 40 00 00 00       	mov    $0x40,%eax
+  200026:	bf 01 00 00 00       	mov    $0x1,%edi
+  20002b:	0f 05                	syscall
+                  : "a" (INT_SYS_EXIT), "D" /* %rdi */ (exit_code)
+                  : "rcx", "r11", "cc", "memory");
+ spinloop: goto spinloop;       // should never get here
+  20002d:	eb fe                	jmp    20002d <usage+0x2d>
+
+000000000020002f <process_main>:
+
+// The copy happens in the kernel: DEST is new, so it just shares the
+// blocks of SOURCE until one of them is written.
+#define COPY_CHUNK (1 << 20)
+
+void process_main(int argc, char* argv[]) {
+  20002f:	55                   	push   %rbp
+  200030:	48 89 e5             	mov    %rsp,%rbp
+    if (argc != 3) usage();
+  200033:	83 ff 03             	cmp    $0x3,%edi
+  200036:	75 5a                	jne    200092 <process_main+0x63>
+    asm volatile ("syscall" : "=a" (result)
+  200038:	48 8b 7e 08          	mov    0x8(%rsi),%rdi
+  20003c:	b8 33 00 00 00       	mov    $0x33,%eax
+  200041:	0f 05                	syscall
+  200043:	41 89 c0             	mov    %eax,%r8d
+
+    int in = sys_open(argv[1]);
+    if (in < 0) handle_error(-in);
+  200046:	85 c0                	test   %eax,%eax
+  200048:	78 4d                	js     200097 <process_main+0x68>
+    asm volatile ("syscall" : "=a" (result)
+  20004a:	48 8b 7e 10          	mov    0x10(%rsi),%rdi
+  20004e:	b8 47 00 00 00       	mov    $0x47,%eax
+  200053:	0f 05                	syscall
+
+    int r = sys_touch(argv[2]);
+    if (r < 0) handle_error(-r);
+  200055:	85 c0                	test   %eax,%eax
+  200057:	78 47                	js     2000a0 <process_main+0x71>
+    asm volatile ("syscall" : "=a" (result)
+  200059:	48 8b 7e 10          	mov    0x10(%rsi),%rdi
+  20005d:	b8 33 00 00 00       	mov    $0x33,%eax
+  200062:	0f 05                	syscall
+  200064:	89 c6                	mov    %eax,%esi
+
+    int out = sys_open(argv[2]);
+    if (out < 0) handle_error(-out);
+  200066:	85 c0                	test   %eax,%eax
+  200068:	78 3f                	js     2000a9 <process_main+0x7a>
+    asm volatile ("syscall" : "=a" (result)
+  20006a:	41 b9 50 00 00 00    	mov    $0x50,%r9d
+  200070:	ba 00 00 10 00       	mov    $0x100000,%edx
+  200075:	44 89 c8             	mov    %r9d,%eax
+  200078:	44 89 c7             	mov    %r8d,%edi
+  20007b:	0f 05                	syscall
+
+    ssize_t n;
+    while ((n = sys_copy_file_range(in, out, COPY_CHUNK)) > 0) {
+  20007d:	48 85 c0             	test   %rax,%rax
+  200080:	7f f3                	jg     200075 <process_main+0x46>
+    }
+    if (n < 0) handle_error(-n);
+  200082:	78 2e                	js     2000b2 <process_main+0x83>
+    asm volatile ("syscall" : "=a" (rax)
+  200084:	b8 40 00 00 00       	mov    $0x40,%eax
+  200089:	bf 00 00 00 00       	mov    $0x0,%edi
+  20008e:	0f 05                	syscall
+ spinloop: goto spinloop;       // should never get here
+  200090:	eb fe                	jmp    200090 <process_main+0x61>
+    if (argc != 3) usage();
+  200092:	e8 69 ff ff ff       	call   200000 <usage>
+    if (in < 0) handle_error(-in);
+  200097:	89 c7                	mov    %eax,%edi
+  200099:	f7 df                	neg    %edi
+  20009b:	e8 50 1f 00 00       	call   201ff0 <handle_error>
+    if (r < 0) handle_error(-r);
+  2000a0:	f7 d8                	neg    %eax
+  2000a2:	89 c7                	mov    %eax,%edi
+  2000a4:	e8 47 1f 00 00       	call   201ff0 <handle_error>
+    if (out < 0) handle_error(-out);
+  2000a9:	f7 de                	neg    %esi
+  2000ab:	89 f7                	mov    %esi,%edi
+  2000ad:	e8 3e 1f 00 00       	call   201ff0 <handle_error>
+    if (n < 0) handle_error(-n);
+  2000b2:	89 c7                	mov    %eax,%edi
+  2000b4:	f7 df                	neg    %edi
+  2000b6:	e8 35 1f 00 00       	call   201ff0 <handle_error>
+
+00000000002000bb <vdso>:
+// KERNEL DATA PAGE
+//
+//    The kernel keeps a read-only vdso_data (see lib.h) up to date at
+//    VDSO_ADDR. Reading it is a plain memory load, not a system call.
+
+static inline const volatile vdso_data* vdso(void) {
+  2000bb:	55                   	push   %rbp
+  2000bc:	48 89 e5             	mov    %rsp,%rbp
+    return (const volatile vdso_data*) VDSO_ADDR;
+  2000bf:	b8 00 10 24 00       	mov    $0x241000,%eax
+}
+  2000c4:	5d                   	pop    %rbp
+  2000c5:	c3                   	ret
+
+00000000002000c6 <memcpy>:
+#define MEMOP_WORD_MIN 64
+
+// an unaligned word that may alias any object
+typedef uint64_t __attribute__((may_alias, aligned(1))) memop_word;
+
+void* memcpy(void* dst, const void* src, size_t n) {
+  2000c6:	55                   	push   %rbp
+  2000c7:	48 89 e5             	mov    %rsp,%rbp
+  2000ca:	48 83 ec 48          	sub    $0x48,%rsp
+  2000ce:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  2000d2:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  2000d6:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+    char* d = (char*) dst;
+  2000da:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  2000de:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    const char* s = (const char*) src;
+  2000e2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  2000e6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (n >= MEMOP_WORD_MIN) {
+  2000ea:	48 83 7d b8 3f       	cmpq   $0x3f,-0x48(%rbp)
+  2000ef:	0f 86 c5 00 00 00    	jbe    2001ba <memcpy+0xf4>
+        size_t head = -(uintptr_t) d & 7;
+  2000f5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2000f9:	48 f7 d8             	neg    %rax
+  2000fc:	83 e0 07             	and    $0x7,%eax
+  2000ff:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        size_t words = (n - head) / 8;
+  200103:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  200107:	48 2b 45 e8          	sub    -0x18(%rbp),%rax
+  20010b:	48 c1 e8 03          	shr    $0x3,%rax
+  20010f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+        n = (n - head) % 8;
+  200113:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  200117:	48 2b 45 e8          	sub    -0x18(%rbp),%rax
+  20011b:	83 e0 07             	and    $0x7,%eax
+  20011e:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        asm volatile("rep movsb" : "+D" (d), "+S" (s), "+c" (head)
+  200122:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  200126:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  20012a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20012e:	48 89 cf             	mov    %rcx,%rdi
+  200131:	48 89 d6             	mov    %rdx,%rsi
+  200134:	48 89 c1             	mov    %rax,%rcx
+  200137:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  200139:	48 89 c8             	mov    %rcx,%rax
+  20013c:	48 89 f2             	mov    %rsi,%rdx
+  20013f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  200143:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  200147:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                     : : "memory");
+        asm volatile("rep movsq" : "+D" (d), "+S" (s), "+c" (words)
+  20014b:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  20014f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  200153:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  200157:	48 89 cf             	mov    %rcx,%rdi
+  20015a:	48 89 d6             	mov    %rdx,%rsi
+  20015d:	48 89 c1             	mov    %rax,%rcx
+  200160:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  200163:	48 89 c8             	mov    %rcx,%rax
+  200166:	48 89 f2             	mov    %rsi,%rdx
+  200169:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  20016d:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  200171:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+                     : : "memory");
+    }
+    for (; n >= 16; n -= 16, s += 16, d += 16) {
+  200175:	eb 43                	jmp    2001ba <memcpy+0xf4>
+        memop_word a = ((const memop_word*) s)[0];
+  200177:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  20017b:	48 8b 00             	mov    (%rax),%rax
+  20017e:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+        memop_word b = ((const memop_word*) s)[1];
+  200182:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  200186:	48 83 c0 08          	add    $0x8,%rax
+  20018a:	48 8b 00             	mov    (%rax),%rax
+  20018d:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+        ((memop_word*) d)[0] = a;
+  200191:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200195:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  200199:	48 89 10             	mov    %rdx,(%rax)
+        ((memop_word*) d)[1] = b;
+  20019c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2001a0:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  2001a4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  2001a8:	48 89 02             	mov    %rax,(%rdx)
+    for (; n >= 16; n -= 16, s += 16, d += 16) {
+  2001ab:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  2001b0:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  2001b5:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  2001ba:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  2001bf:	77 b6                	ja     200177 <memcpy+0xb1>
+    }
+    for (; n > 0; --n, ++s, ++d) {
+  2001c1:	eb 1c                	jmp    2001df <memcpy+0x119>
+        *d = *s;
+  2001c3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2001c7:	0f b6 10             	movzbl (%rax),%edx
+  2001ca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2001ce:	88 10                	mov    %dl,(%rax)
+    for (; n > 0; --n, ++s, ++d) {
+  2001d0:	48 83 6d b8 01       	subq   $0x1,-0x48(%rbp)
+  2001d5:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  2001da:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  2001df:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  2001e4:	75 dd                	jne    2001c3 <memcpy+0xfd>
+    }
+    return dst;
+  2001e6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  2001ea:	c9                   	leave
+  2001eb:	c3                   	ret
+
+00000000002001ec <memmove>:
+
+void* memmove(void* dst, const void* src, size_t n) {
+  2001ec:	55                   	push   %rbp
+  2001ed:	48 89 e5             	mov    %rsp,%rbp
+  2001f0:	48 83 ec 38          	sub    $0x38,%rsp
+  2001f4:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  2001f8:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  2001fc:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    const char* s = (const char*) src;
+  200200:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  200204:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    char* d = (char*) dst;
+  200208:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  20020c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (!(s < d && s + n > d)) {
+  200210:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200214:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  200218:	73 11                	jae    20022b <memmove+0x3f>
+  20021a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  20021e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200222:	48 01 d0             	add    %rdx,%rax
+  200225:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  200229:	72 1c                	jb     200247 <memmove+0x5b>
+        // a forward copy never overwrites source bytes it has yet to read
+        return memcpy(dst, src, n);
+  20022b:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  20022f:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  200233:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  200237:	48 89 ce             	mov    %rcx,%rsi
+  20023a:	48 89 c7             	mov    %rax,%rdi
+  20023d:	e8 84 fe ff ff       	call   2000c6 <memcpy>
+  200242:	e9 94 00 00 00       	jmp    2002db <memmove+0xef>
+    }
+
+    // copy backwards: the tail bytes, then words down to the start
+    size_t words = n / 8;
+  200247:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  20024b:	48 c1 e8 03          	shr    $0x3,%rax
+  20024f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    size_t tail = n % 8;
+  200253:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200257:	83 e0 07             	and    $0x7,%eax
+  20025a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    s += n - 1, d += n - 1;
+  20025e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200262:	48 83 e8 01          	sub    $0x1,%rax
+  200266:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  20026a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  20026e:	48 83 e8 01          	sub    $0x1,%rax
+  200272:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    asm volatile("std; rep movsb; cld" : "+D" (d), "+S" (s), "+c" (tail)
+  200276:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  20027a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  20027e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  200282:	48 89 cf             	mov    %rcx,%rdi
+  200285:	48 89 d6             	mov    %rdx,%rsi
+  200288:	48 89 c1             	mov    %rax,%rcx
+  20028b:	fd                   	std
+  20028c:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  20028e:	fc                   	cld
+  20028f:	48 89 c8             	mov    %rcx,%rax
+  200292:	48 89 f2             	mov    %rsi,%rdx
+  200295:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  200299:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  20029d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+                 : : "memory", "cc");
+    s -= 7, d -= 7;
+  2002a1:	48 83 6d f8 07       	subq   $0x7,-0x8(%rbp)
+  2002a6:	48 83 6d f0 07       	subq   $0x7,-0x10(%rbp)
+    asm volatile("std; rep movsq; cld" : "+D" (d), "+S" (s), "+c" (words)
+  2002ab:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  2002af:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  2002b3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2002b7:	48 89 cf             	mov    %rcx,%rdi
+  2002ba:	48 89 d6             	mov    %rdx,%rsi
+  2002bd:	48 89 c1             	mov    %rax,%rcx
+  2002c0:	fd                   	std
+  2002c1:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  2002c4:	fc                   	cld
+  2002c5:	48 89 c8             	mov    %rcx,%rax
+  2002c8:	48 89 f2             	mov    %rsi,%rdx
+  2002cb:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  2002cf:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  2002d3:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 : : "memory", "cc");
+    return dst;
+  2002d7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  2002db:	c9                   	leave
+  2002dc:	c3                   	ret
+
+00000000002002dd <memset>:
+
+void* memset(void* v, int c, size_t n) {
+  2002dd:	55                   	push   %rbp
+  2002de:	48 89 e5             	mov    %rsp,%rbp
+  2002e1:	48 83 ec 38          	sub    $0x38,%rsp
+  2002e5:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  2002e9:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  2002ec:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    char* p = (char*) v;
+  2002f0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  2002f4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    uint64_t word = (uint8_t) c * 0x0101010101010101UL;
+  2002f8:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  2002fb:	0f b6 c0             	movzbl %al,%eax
+  2002fe:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  200305:	01 01 01 
+  200308:	48 0f af c2          	imul   %rdx,%rax
+  20030c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (n >= MEMOP_WORD_MIN) {
+  200310:	48 83 7d c8 3f       	cmpq   $0x3f,-0x38(%rbp)
+  200315:	0f 86 9e 00 00 00    	jbe    2003b9 <memset+0xdc>
+        size_t head = -(uintptr_t) p & 7;
+  20031b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20031f:	48 f7 d8             	neg    %rax
+  200322:	83 e0 07             	and    $0x7,%eax
+  200325:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        size_t words = (n - head) / 8;
+  200329:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  20032d:	48 2b 45 e8          	sub    -0x18(%rbp),%rax
+  200331:	48 c1 e8 03          	shr    $0x3,%rax
+  200335:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+        n = (n - head) % 8;
+  200339:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  20033d:	48 2b 45 e8          	sub    -0x18(%rbp),%rax
+  200341:	83 e0 07             	and    $0x7,%eax
+  200344:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        asm volatile("rep stosb" : "+D" (p), "+c" (head) : "a" (word)
+  200348:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  20034c:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  200350:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  200354:	48 89 ce             	mov    %rcx,%rsi
+  200357:	48 89 f7             	mov    %rsi,%rdi
+  20035a:	48 89 d1             	mov    %rdx,%rcx
+  20035d:	f3 aa                	rep stos %al,%es:(%rdi)
+  20035f:	48 89 ca             	mov    %rcx,%rdx
+  200362:	48 89 fe             	mov    %rdi,%rsi
+  200365:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  200369:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+                     : "memory");
+        asm volatile("rep stosq" : "+D" (p), "+c" (words) : "a" (word)
+  20036d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  200371:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  200375:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  200379:	48 89 ce             	mov    %rcx,%rsi
+  20037c:	48 89 f7             	mov    %rsi,%rdi
+  20037f:	48 89 d1             	mov    %rdx,%rcx
+  200382:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  200385:	48 89 ca             	mov    %rcx,%rdx
+  200388:	48 89 fe             	mov    %rdi,%rsi
+  20038b:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  20038f:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+                     : "memory");
+    }
+    for (; n >= 16; n -= 16, p += 16) {
+  200393:	eb 24                	jmp    2003b9 <memset+0xdc>
+        ((memop_word*) p)[0] = word;
+  200395:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200399:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  20039d:	48 89 10             	mov    %rdx,(%rax)
+        ((memop_word*) p)[1] = word;
+  2003a0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2003a4:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  2003a8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2003ac:	48 89 02             	mov    %rax,(%rdx)
+    for (; n >= 16; n -= 16, p += 16) {
+  2003af:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  2003b4:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  2003b9:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  2003be:	77 d5                	ja     200395 <memset+0xb8>
+    }
+    for (; n > 0; ++p, --n) {
+  2003c0:	eb 15                	jmp    2003d7 <memset+0xfa>
+        *p = c;
+  2003c2:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  2003c5:	89 c2                	mov    %eax,%edx
+  2003c7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2003cb:	88 10                	mov    %dl,(%rax)
+    for (; n > 0; ++p, --n) {
+  2003cd:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  2003d2:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  2003d7:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  2003dc:	75 e4                	jne    2003c2 <memset+0xe5>
+    }
+    return v;
+  2003de:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  2003e2:	c9                   	leave
+  2003e3:	c3                   	ret
+
+00000000002003e4 <strlen>:
+
+size_t strlen(const char* s) {
+  2003e4:	55                   	push   %rbp
+  2003e5:	48 89 e5             	mov    %rsp,%rbp
+  2003e8:	48 83 ec 18          	sub    $0x18,%rsp
+  2003ec:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    size_t n;
+    for (n = 0; *s != '\0'; ++s) {
+  2003f0:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  2003f7:	00 
+  2003f8:	eb 0a                	jmp    200404 <strlen+0x20>
+        ++n;
+  2003fa:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    for (n = 0; *s != '\0'; ++s) {
+  2003ff:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  200404:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  200408:	0f b6 00             	movzbl (%rax),%eax
+  20040b:	84 c0                	test   %al,%al
+  20040d:	75 eb                	jne    2003fa <strlen+0x16>
+    }
+    return n;
+  20040f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  200413:	c9                   	leave
+  200414:	c3                   	ret
+
+0000000000200415 <strnlen>:
+
+size_t strnlen(const char* s, size_t maxlen) {
+  200415:	55                   	push   %rbp
+  200416:	48 89 e5             	mov    %rsp,%rbp
+  200419:	48 83 ec 20          	sub    $0x20,%rsp
+  20041d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  200421:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    size_t n;
+    for (n = 0; n != maxlen && *s != '\0'; ++s) {
+  200425:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  20042c:	00 
+  20042d:	eb 0a                	jmp    200439 <strnlen+0x24>
+        ++n;
+  20042f:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    for (n = 0; n != maxlen && *s != '\0'; ++s) {
+  200434:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  200439:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20043d:	48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+  200441:	74 0b                	je     20044e <strnlen+0x39>
+  200443:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  200447:	0f b6 00             	movzbl (%rax),%eax
+  20044a:	84 c0                	test   %al,%al
+  20044c:	75 e1                	jne    20042f <strnlen+0x1a>
+    }
+    return n;
+  20044e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  200452:	c9                   	leave
+  200453:	c3                   	ret
+
+0000000000200454 <strcpy>:
+
+char* strcpy(char* dst, const char* src) {
+  200454:	55                   	push   %rbp
+  200455:	48 89 e5             	mov    %rsp,%rbp
+  200458:	48 83 ec 20          	sub    $0x20,%rsp
+  20045c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  200460:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    char* d = dst;
+  200464:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  200468:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    do {
+        *d++ = *src++;
+  20046c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  200470:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  200474:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  200478:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20047c:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  200480:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+  200484:	0f b6 12             	movzbl (%rdx),%edx
+  200487:	88 10                	mov    %dl,(%rax)
+    } while (d[-1]);
+  200489:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20048d:	48 83 e8 01          	sub    $0x1,%rax
+  200491:	0f b6 00             	movzbl (%rax),%eax
+  200494:	84 c0                	test   %al,%al
+  200496:	75 d4                	jne    20046c <strcpy+0x18>
+    return dst;
+  200498:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  20049c:	c9                   	leave
+  20049d:	c3                   	ret
+
+000000000020049e <strcmp>:
+
+int strcmp(const char* a, const char* b) {
+  20049e:	55                   	push   %rbp
+  20049f:	48 89 e5             	mov    %rsp,%rbp
+  2004a2:	48 83 ec 10          	sub    $0x10,%rsp
+  2004a6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  2004aa:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    while (*a && *b && *a == *b) {
+  2004ae:	eb 0a                	jmp    2004ba <strcmp+0x1c>
+        ++a, ++b;
+  2004b0:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  2004b5:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+    while (*a && *b && *a == *b) {
+  2004ba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2004be:	0f b6 00             	movzbl (%rax),%eax
+  2004c1:	84 c0                	test   %al,%al
+  2004c3:	74 1d                	je     2004e2 <strcmp+0x44>
+  2004c5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2004c9:	0f b6 00             	movzbl (%rax),%eax
+  2004cc:	84 c0                	test   %al,%al
+  2004ce:	74 12                	je     2004e2 <strcmp+0x44>
+  2004d0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2004d4:	0f b6 10             	movzbl (%rax),%edx
+  2004d7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2004db:	0f b6 00             	movzbl (%rax),%eax
+  2004de:	38 c2                	cmp    %al,%dl
+  2004e0:	74 ce                	je     2004b0 <strcmp+0x12>
+    }
+    return ((unsigned char) *a > (unsigned char) *b)
+  2004e2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2004e6:	0f b6 00             	movzbl (%rax),%eax
+  2004e9:	89 c2                	mov    %eax,%edx
+  2004eb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2004ef:	0f b6 00             	movzbl (%rax),%eax
+  2004f2:	38 d0                	cmp    %dl,%al
+  2004f4:	0f 92 c0             	setb   %al
+  2004f7:	0f b6 d0             	movzbl %al,%edx
+        - ((unsigned char) *a < (unsigned char) *b);
+  2004fa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2004fe:	0f b6 00             	movzbl (%rax),%eax
+  200501:	89 c1                	mov    %eax,%ecx
+  200503:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  200507:	0f b6 00             	movzbl (%rax),%eax
+  20050a:	38 c1                	cmp    %al,%cl
+  20050c:	0f 92 c0             	setb   %al
+  20050f:	0f b6 c0             	movzbl %al,%eax
+  200512:	29 c2                	sub    %eax,%edx
+  200514:	89 d0                	mov    %edx,%eax
+}
+  200516:	c9                   	leave
+  200517:	c3                   	ret
+
+0000000000200518 <strchr>:
+
+char* strchr(const char* s, int c) {
+  200518:	55                   	push   %rbp
+  200519:	48 89 e5             	mov    %rsp,%rbp
+  20051c:	48 83 ec 10          	sub    $0x10,%rsp
+  200520:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  200524:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    while (*s && *s != (char) c) {
+  200527:	eb 05                	jmp    20052e <strchr+0x16>
+        ++s;
+  200529:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    while (*s && *s != (char) c) {
+  20052e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200532:	0f b6 00             	movzbl (%rax),%eax
+  200535:	84 c0                	test   %al,%al
+  200537:	74 0e                	je     200547 <strchr+0x2f>
+  200539:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20053d:	0f b6 00             	movzbl (%rax),%eax
+  200540:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  200543:	38 d0                	cmp    %dl,%al
+  200545:	75 e2                	jne    200529 <strchr+0x11>
+    }
+    if (*s == (char) c) {
+  200547:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20054b:	0f b6 00             	movzbl (%rax),%eax
+  20054e:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  200551:	38 d0                	cmp    %dl,%al
+  200553:	75 06                	jne    20055b <strchr+0x43>
+        return (char*) s;
+  200555:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200559:	eb 05                	jmp    200560 <strchr+0x48>
+    } else {
+        return NULL;
+  20055b:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+}
+  200560:	c9                   	leave
+  200561:	c3                   	ret
+
+0000000000200562 <rand>:
+
+// New randomness implementation
+static int      rand_seed_set;
+static unsigned rand_seed;
+
+int rand(void) {
+  200562:	55                   	push   %rbp
+  200563:	48 89 e5             	mov    %rsp,%rbp
+  200566:	48 83 ec 10          	sub    $0x10,%rsp
+    if (!rand_seed_set) {
+  20056a:	8b 05 a8 2a 00 00    	mov    0x2aa8(%rip),%eax        # 203018 <rand_seed_set>
+  200570:	85 c0                	test   %eax,%eax
+  200572:	75 2c                	jne    2005a0 <rand+0x3e>
+#if WEENSYOS_KERNEL
+        extern unsigned get_entropy_value(void);
+        srand(get_entropy_value());
+#else           // user‑space build
+       /* kernel-refreshed seed from the kernel data page: no system call */
+       srand((unsigned) (vdso()->seed[0] ^ read_cycle_counter()));
+  200574:	e8 42 fb ff ff       	call   2000bb <vdso>
+  200579:	48 8b 40 18          	mov    0x18(%rax),%rax
+  20057d:	89 c1                	mov    %eax,%ecx
+    }
+}
+
+static inline uint64_t read_cycle_counter(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+  20057f:	0f 31                	rdtsc
+  200581:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  200584:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    return ((uint64_t) hi << 32) | lo;
+  200587:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  20058a:	48 c1 e0 20          	shl    $0x20,%rax
+  20058e:	48 89 c2             	mov    %rax,%rdx
+  200591:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  200594:	48 09 d0             	or     %rdx,%rax
+  200597:	31 c8                	xor    %ecx,%eax
+  200599:	89 c7                	mov    %eax,%edi
+  20059b:	e8 24 00 00 00       	call   2005c4 <srand>
+#endif
+    }
+    rand_seed = rand_seed * 1664525U + 1013904223U;   // LCG
+  2005a0:	8b 05 76 2a 00 00    	mov    0x2a76(%rip),%eax        # 20301c <rand_seed>
+  2005a6:	69 c0 0d 66 19 00    	imul   $0x19660d,%eax,%eax
+  2005ac:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+  2005b1:	89 05 65 2a 00 00    	mov    %eax,0x2a65(%rip)        # 20301c <rand_seed>
+    return rand_seed & RAND_MAX;
+  2005b7:	8b 05 5f 2a 00 00    	mov    0x2a5f(%rip),%eax        # 20301c <rand_seed>
+  2005bd:	25 ff ff ff 7f       	and    $0x7fffffff,%eax
+}
+  2005c2:	c9                   	leave
+  2005c3:	c3                   	ret
+
+00000000002005c4 <srand>:
+
+void srand(unsigned seed) {
+  2005c4:	55                   	push   %rbp
+  2005c5:	48 89 e5             	mov    %rsp,%rbp
+  2005c8:	48 83 ec 08          	sub    $0x8,%rsp
+  2005cc:	89 7d fc             	mov    %edi,-0x4(%rbp)
+    rand_seed      = seed;
+  2005cf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  2005d2:	89 05 44 2a 00 00    	mov    %eax,0x2a44(%rip)        # 20301c <rand_seed>
+    rand_seed_set  = 1;
+  2005d8:	c7 05 36 2a 00 00 01 	movl   $0x1,0x2a36(%rip)        # 203018 <rand_seed_set>
+  2005df:	00 00 00 
+}
+  2005e2:	90                   	nop
+  2005e3:	c9                   	leave
+  2005e4:	c3                   	ret
+
+00000000002005e5 <fill_numbuf>:
+//    Print a message onto the console, starting at the given cursor position.
+
+// snprintf, vsnprintf
+//    Format a string into a buffer.
+
+static char* fill_numbuf(char* numbuf_end, unsigned long val, int base) {
+  2005e5:	55                   	push   %rbp
+  2005e6:	48 89 e5             	mov    %rsp,%rbp
+  2005e9:	48 83 ec 28          	sub    $0x28,%rsp
+  2005ed:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  2005f1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  2005f5:	89 55 dc             	mov    %edx,-0x24(%rbp)
+    static const char upper_digits[] = "0123456789ABCDEF";
+    static const char lower_digits[] = "0123456789abcdef";
+
+    const char* digits = upper_digits;
+  2005f8:	48 8d 05 41 1c 00 00 	lea    0x1c41(%rip),%rax        # 202240 <upper_digits.1>
+  2005ff:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (base < 0) {
+  200603:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  200607:	79 0e                	jns    200617 <fill_numbuf+0x32>
+        digits = lower_digits;
+  200609:	48 8d 05 50 1c 00 00 	lea    0x1c50(%rip),%rax        # 202260 <lower_digits.0>
+  200610:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+        base = -base;
+  200614:	f7 5d dc             	negl   -0x24(%rbp)
+    }
+
+    *--numbuf_end = '\0';
+  200617:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  20061c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  200620:	c6 00 00             	movb   $0x0,(%rax)
+    do {
+        *--numbuf_end = digits[val % base];
+  200623:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  200626:	48 63 c8             	movslq %eax,%rcx
+  200629:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  20062d:	ba 00 00 00 00       	mov    $0x0,%edx
+  200632:	48 f7 f1             	div    %rcx
+  200635:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200639:	48 01 d0             	add    %rdx,%rax
+  20063c:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  200641:	0f b6 10             	movzbl (%rax),%edx
+  200644:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  200648:	88 10                	mov    %dl,(%rax)
+        val /= base;
+  20064a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  20064d:	48 63 f0             	movslq %eax,%rsi
+  200650:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  200654:	ba 00 00 00 00       	mov    $0x0,%edx
+  200659:	48 f7 f6             	div    %rsi
+  20065c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    } while (val != 0);
+  200660:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  200665:	75 bc                	jne    200623 <fill_numbuf+0x3e>
+    return numbuf_end;
+  200667:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  20066b:	c9                   	leave
+  20066c:	c3                   	ret
+
+000000000020066d <printer_vprintf>:
+#define FLAG_NUMERIC            (1<<5)
+#define FLAG_SIGNED             (1<<6)
+#define FLAG_NEGATIVE           (1<<7)
+#define FLAG_ALT2               (1<<8)
+
+void printer_vprintf(printer* p, int color, const char* format, va_list val) {
+  20066d:	55                   	push   %rbp
+  20066e:	48 89 e5             	mov    %rsp,%rbp
+  200671:	53                   	push   %rbx
+  200672:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  200679:	48 89 bd 78 ff ff ff 	mov    %rdi,-0x88(%rbp)
+  200680:	89 b5 74 ff ff ff    	mov    %esi,-0x8c(%rbp)
+  200686:	48 89 95 68 ff ff ff 	mov    %rdx,-0x98(%rbp)
+  20068d:	48 89 8d 60 ff ff ff 	mov    %rcx,-0xa0(%rbp)
+#define NUMBUFSIZ 24
+    char numbuf[NUMBUFSIZ];
+
+    for (; *format; ++format) {
+  200694:	e9 be 09 00 00       	jmp    201057 <printer_vprintf+0x9ea>
+        if (*format != '%') {
+  200699:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  2006a0:	0f b6 00             	movzbl (%rax),%eax
+  2006a3:	3c 25                	cmp    $0x25,%al
+  2006a5:	74 31                	je     2006d8 <printer_vprintf+0x6b>
+            p->putc(p, *format, color);
+  2006a7:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  2006ae:	4c 8b 00             	mov    (%rax),%r8
+  2006b1:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  2006b8:	0f b6 00             	movzbl (%rax),%eax
+  2006bb:	0f b6 c8             	movzbl %al,%ecx
+  2006be:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  2006c4:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  2006cb:	89 ce                	mov    %ecx,%esi
+  2006cd:	48 89 c7             	mov    %rax,%rdi
+  2006d0:	41 ff d0             	call   *%r8
+            continue;
+  2006d3:	e9 77 09 00 00       	jmp    20104f <printer_vprintf+0x9e2>
+        }
+
+        // process flags
+        int flags = 0;
+  2006d8:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+        for (++format; *format; ++format) {
+  2006df:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  2006e6:	01 
+  2006e7:	eb 4f                	jmp    200738 <printer_vprintf+0xcb>
+            const char* flagc = strchr(flag_chars, *format);
+  2006e9:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  2006f0:	0f b6 00             	movzbl (%rax),%eax
+  2006f3:	0f be c0             	movsbl %al,%eax
+  2006f6:	89 c6                	mov    %eax,%esi
+  2006f8:	48 8d 05 f1 19 00 00 	lea    0x19f1(%rip),%rax        # 2020f0 <flag_chars>
+  2006ff:	48 89 c7             	mov    %rax,%rdi
+  200702:	e8 11 fe ff ff       	call   200518 <strchr>
+  200707:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (flagc) {
+  20070b:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  200710:	74 36                	je     200748 <printer_vprintf+0xdb>
+                flags |= 1 << (flagc - flag_chars);
+  200712:	48 8d 05 d7 19 00 00 	lea    0x19d7(%rip),%rax        # 2020f0 <flag_chars>
+  200719:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  20071d:	48 29 c2             	sub    %rax,%rdx
+  200720:	89 d0                	mov    %edx,%eax
+  200722:	ba 01 00 00 00       	mov    $0x1,%edx
+  200727:	89 c1                	mov    %eax,%ecx
+  200729:	d3 e2                	shl    %cl,%edx
+  20072b:	89 d0                	mov    %edx,%eax
+  20072d:	09 45 ec             	or     %eax,-0x14(%rbp)
+        for (++format; *format; ++format) {
+  200730:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  200737:	01 
+  200738:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  20073f:	0f b6 00             	movzbl (%rax),%eax
+  200742:	84 c0                	test   %al,%al
+  200744:	75 a3                	jne    2006e9 <printer_vprintf+0x7c>
+  200746:	eb 01                	jmp    200749 <printer_vprintf+0xdc>
+            } else {
+                break;
+  200748:	90                   	nop
+            }
+        }
+
+        // process width
+        int width = -1;
+  200749:	c7 45 e8 ff ff ff ff 	movl   $0xffffffff,-0x18(%rbp)
+        if (*format >= '1' && *format <= '9') {
+  200750:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200757:	0f b6 00             	movzbl (%rax),%eax
+  20075a:	3c 30                	cmp    $0x30,%al
+  20075c:	7e 67                	jle    2007c5 <printer_vprintf+0x158>
+  20075e:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200765:	0f b6 00             	movzbl (%rax),%eax
+  200768:	3c 39                	cmp    $0x39,%al
+  20076a:	7f 59                	jg     2007c5 <printer_vprintf+0x158>
+            for (width = 0; *format >= '0' && *format <= '9'; ) {
+  20076c:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%rbp)
+  200773:	eb 2e                	jmp    2007a3 <printer_vprintf+0x136>
+                width = 10 * width + *format++ - '0';
+  200775:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  200778:	89 d0                	mov    %edx,%eax
+  20077a:	c1 e0 02             	shl    $0x2,%eax
+  20077d:	01 d0                	add    %edx,%eax
+  20077f:	01 c0                	add    %eax,%eax
+  200781:	89 c1                	mov    %eax,%ecx
+  200783:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  20078a:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  20078e:	48 89 95 68 ff ff ff 	mov    %rdx,-0x98(%rbp)
+  200795:	0f b6 00             	movzbl (%rax),%eax
+  200798:	0f be c0             	movsbl %al,%eax
+  20079b:	01 c8                	add    %ecx,%eax
+  20079d:	83 e8 30             	sub    $0x30,%eax
+  2007a0:	89 45 e8             	mov    %eax,-0x18(%rbp)
+            for (width = 0; *format >= '0' && *format <= '9'; ) {
+  2007a3:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  2007aa:	0f b6 00             	movzbl (%rax),%eax
+  2007ad:	3c 2f                	cmp    $0x2f,%al
+  2007af:	0f 8e 85 00 00 00    	jle    20083a <printer_vprintf+0x1cd>
+  2007b5:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  2007bc:	0f b6 00             	movzbl (%rax),%eax
+  2007bf:	3c 39                	cmp    $0x39,%al
+  2007c1:	7e b2                	jle    200775 <printer_vprintf+0x108>
+        if (*format >= '1' && *format <= '9') {
+  2007c3:	eb 75                	jmp    20083a <printer_vprintf+0x1cd>
+            }
+        } else if (*format == '*') {
+  2007c5:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  2007cc:	0f b6 00             	movzbl (%rax),%eax
+  2007cf:	3c 2a                	cmp    $0x2a,%al
+  2007d1:	75 68                	jne    20083b <printer_vprintf+0x1ce>
+            width = va_arg(val, int);
+  2007d3:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2007da:	8b 00                	mov    (%rax),%eax
+  2007dc:	83 f8 2f             	cmp    $0x2f,%eax
+  2007df:	77 30                	ja     200811 <printer_vprintf+0x1a4>
+  2007e1:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2007e8:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  2007ec:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2007f3:	8b 00                	mov    (%rax),%eax
+  2007f5:	89 c0                	mov    %eax,%eax
+  2007f7:	48 01 d0             	add    %rdx,%rax
+  2007fa:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200801:	8b 12                	mov    (%rdx),%edx
+  200803:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200806:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  20080d:	89 0a                	mov    %ecx,(%rdx)
+  20080f:	eb 1a                	jmp    20082b <printer_vprintf+0x1be>
+  200811:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200818:	48 8b 40 08          	mov    0x8(%rax),%rax
+  20081c:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200820:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200827:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  20082b:	8b 00                	mov    (%rax),%eax
+  20082d:	89 45 e8             	mov    %eax,-0x18(%rbp)
+            ++format;
+  200830:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  200837:	01 
+  200838:	eb 01                	jmp    20083b <printer_vprintf+0x1ce>
+        if (*format >= '1' && *format <= '9') {
+  20083a:	90                   	nop
+        }
+
+        // process precision
+        int precision = -1;
+  20083b:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%rbp)
+        if (*format == '.') {
+  200842:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200849:	0f b6 00             	movzbl (%rax),%eax
+  20084c:	3c 2e                	cmp    $0x2e,%al
+  20084e:	0f 85 00 01 00 00    	jne    200954 <printer_vprintf+0x2e7>
+            ++format;
+  200854:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  20085b:	01 
+            if (*format >= '0' && *format <= '9') {
+  20085c:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200863:	0f b6 00             	movzbl (%rax),%eax
+  200866:	3c 2f                	cmp    $0x2f,%al
+  200868:	7e 67                	jle    2008d1 <printer_vprintf+0x264>
+  20086a:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200871:	0f b6 00             	movzbl (%rax),%eax
+  200874:	3c 39                	cmp    $0x39,%al
+  200876:	7f 59                	jg     2008d1 <printer_vprintf+0x264>
+                for (precision = 0; *format >= '0' && *format <= '9'; ) {
+  200878:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%rbp)
+  20087f:	eb 2e                	jmp    2008af <printer_vprintf+0x242>
+                    precision = 10 * precision + *format++ - '0';
+  200881:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  200884:	89 d0                	mov    %edx,%eax
+  200886:	c1 e0 02             	shl    $0x2,%eax
+  200889:	01 d0                	add    %edx,%eax
+  20088b:	01 c0                	add    %eax,%eax
+  20088d:	89 c1                	mov    %eax,%ecx
+  20088f:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200896:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  20089a:	48 89 95 68 ff ff ff 	mov    %rdx,-0x98(%rbp)
+  2008a1:	0f b6 00             	movzbl (%rax),%eax
+  2008a4:	0f be c0             	movsbl %al,%eax
+  2008a7:	01 c8                	add    %ecx,%eax
+  2008a9:	83 e8 30             	sub    $0x30,%eax
+  2008ac:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+                for (precision = 0; *format >= '0' && *format <= '9'; ) {
+  2008af:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  2008b6:	0f b6 00             	movzbl (%rax),%eax
+  2008b9:	3c 2f                	cmp    $0x2f,%al
+  2008bb:	0f 8e 85 00 00 00    	jle    200946 <printer_vprintf+0x2d9>
+  2008c1:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  2008c8:	0f b6 00             	movzbl (%rax),%eax
+  2008cb:	3c 39                	cmp    $0x39,%al
+  2008cd:	7e b2                	jle    200881 <printer_vprintf+0x214>
+            if (*format >= '0' && *format <= '9') {
+  2008cf:	eb 75                	jmp    200946 <printer_vprintf+0x2d9>
+                }
+            } else if (*format == '*') {
+  2008d1:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  2008d8:	0f b6 00             	movzbl (%rax),%eax
+  2008db:	3c 2a                	cmp    $0x2a,%al
+  2008dd:	75 68                	jne    200947 <printer_vprintf+0x2da>
+                precision = va_arg(val, int);
+  2008df:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2008e6:	8b 00                	mov    (%rax),%eax
+  2008e8:	83 f8 2f             	cmp    $0x2f,%eax
+  2008eb:	77 30                	ja     20091d <printer_vprintf+0x2b0>
+  2008ed:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2008f4:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  2008f8:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2008ff:	8b 00                	mov    (%rax),%eax
+  200901:	89 c0                	mov    %eax,%eax
+  200903:	48 01 d0             	add    %rdx,%rax
+  200906:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  20090d:	8b 12                	mov    (%rdx),%edx
+  20090f:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200912:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200919:	89 0a                	mov    %ecx,(%rdx)
+  20091b:	eb 1a                	jmp    200937 <printer_vprintf+0x2ca>
+  20091d:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200924:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200928:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  20092c:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200933:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200937:	8b 00                	mov    (%rax),%eax
+  200939:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+                ++format;
+  20093c:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  200943:	01 
+  200944:	eb 01                	jmp    200947 <printer_vprintf+0x2da>
+            if (*format >= '0' && *format <= '9') {
+  200946:	90                   	nop
+            }
+            if (precision < 0) {
+  200947:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  20094b:	79 07                	jns    200954 <printer_vprintf+0x2e7>
+                precision = 0;
+  20094d:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%rbp)
+            }
+        }
+
+        // process main conversion character
+        int base = 10;
+  200954:	c7 45 e0 0a 00 00 00 	movl   $0xa,-0x20(%rbp)
+        unsigned long num = 0;
+  20095b:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  200962:	00 
+        int length = 0;
+  200963:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+        char* data = "";
+  20096a:	48 8d 05 85 17 00 00 	lea    0x1785(%rip),%rax        # 2020f6 <flag_chars+0x6>
+  200971:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    again:
+        switch (*format) {
+  200975:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  20097c:	0f b6 00             	movzbl (%rax),%eax
+  20097f:	0f be c0             	movsbl %al,%eax
+  200982:	83 e8 43             	sub    $0x43,%eax
+  200985:	83 f8 37             	cmp    $0x37,%eax
+  200988:	0f 87 b5 03 00 00    	ja     200d43 <printer_vprintf+0x6d6>
+  20098e:	89 c0                	mov    %eax,%eax
+  200990:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  200997:	00 
+  200998:	48 8d 05 65 17 00 00 	lea    0x1765(%rip),%rax        # 202104 <flag_chars+0x14>
+  20099f:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+  2009a2:	48 98                	cltq
+  2009a4:	48 8d 15 59 17 00 00 	lea    0x1759(%rip),%rdx        # 202104 <flag_chars+0x14>
+  2009ab:	48 01 d0             	add    %rdx,%rax
+  2009ae:	ff e0                	jmp    *%rax
+        case 'l':
+        case 'z':
+            length = 1;
+  2009b0:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+            ++format;
+  2009b7:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  2009be:	01 
+            goto again;
+  2009bf:	eb b4                	jmp    200975 <printer_vprintf+0x308>
+        case 'd':
+        case 'i': {
+            long x = length ? va_arg(val, long) : va_arg(val, int);
+  2009c1:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  2009c5:	74 5d                	je     200a24 <printer_vprintf+0x3b7>
+  2009c7:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2009ce:	8b 00                	mov    (%rax),%eax
+  2009d0:	83 f8 2f             	cmp    $0x2f,%eax
+  2009d3:	77 30                	ja     200a05 <printer_vprintf+0x398>
+  2009d5:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2009dc:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  2009e0:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2009e7:	8b 00                	mov    (%rax),%eax
+  2009e9:	89 c0                	mov    %eax,%eax
+  2009eb:	48 01 d0             	add    %rdx,%rax
+  2009ee:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  2009f5:	8b 12                	mov    (%rdx),%edx
+  2009f7:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  2009fa:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200a01:	89 0a                	mov    %ecx,(%rdx)
+  200a03:	eb 1a                	jmp    200a1f <printer_vprintf+0x3b2>
+  200a05:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200a0c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200a10:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200a14:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200a1b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200a1f:	48 8b 00             	mov    (%rax),%rax
+  200a22:	eb 5c                	jmp    200a80 <printer_vprintf+0x413>
+  200a24:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200a2b:	8b 00                	mov    (%rax),%eax
+  200a2d:	83 f8 2f             	cmp    $0x2f,%eax
+  200a30:	77 30                	ja     200a62 <printer_vprintf+0x3f5>
+  200a32:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200a39:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200a3d:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200a44:	8b 00                	mov    (%rax),%eax
+  200a46:	89 c0                	mov    %eax,%eax
+  200a48:	48 01 d0             	add    %rdx,%rax
+  200a4b:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200a52:	8b 12                	mov    (%rdx),%edx
+  200a54:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200a57:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200a5e:	89 0a                	mov    %ecx,(%rdx)
+  200a60:	eb 1a                	jmp    200a7c <printer_vprintf+0x40f>
+  200a62:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200a69:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200a6d:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200a71:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200a78:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200a7c:	8b 00                	mov    (%rax),%eax
+  200a7e:	48 98                	cltq
+  200a80:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+            int negative = x < 0 ? FLAG_NEGATIVE : 0;
+  200a84:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  200a88:	48 c1 f8 38          	sar    $0x38,%rax
+  200a8c:	25 80 00 00 00       	and    $0x80,%eax
+  200a91:	89 45 a4             	mov    %eax,-0x5c(%rbp)
+            num = negative ? -x : x;
+  200a94:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  200a98:	74 09                	je     200aa3 <printer_vprintf+0x436>
+  200a9a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  200a9e:	48 f7 d8             	neg    %rax
+  200aa1:	eb 04                	jmp    200aa7 <printer_vprintf+0x43a>
+  200aa3:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  200aa7:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+            flags |= FLAG_NUMERIC | FLAG_SIGNED | negative;
+  200aab:	8b 45 a4             	mov    -0x5c(%rbp),%eax
+  200aae:	83 c8 60             	or     $0x60,%eax
+  200ab1:	09 45 ec             	or     %eax,-0x14(%rbp)
+            break;
+  200ab4:	e9 cf 02 00 00       	jmp    200d88 <printer_vprintf+0x71b>
+        }
+        case 'u':
+        format_unsigned:
+            num = length ? va_arg(val, unsigned long) : va_arg(val, unsigned);
+  200ab9:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  200abd:	74 5d                	je     200b1c <printer_vprintf+0x4af>
+  200abf:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200ac6:	8b 00                	mov    (%rax),%eax
+  200ac8:	83 f8 2f             	cmp    $0x2f,%eax
+  200acb:	77 30                	ja     200afd <printer_vprintf+0x490>
+  200acd:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200ad4:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200ad8:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200adf:	8b 00                	mov    (%rax),%eax
+  200ae1:	89 c0                	mov    %eax,%eax
+  200ae3:	48 01 d0             	add    %rdx,%rax
+  200ae6:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200aed:	8b 12                	mov    (%rdx),%edx
+  200aef:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200af2:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200af9:	89 0a                	mov    %ecx,(%rdx)
+  200afb:	eb 1a                	jmp    200b17 <printer_vprintf+0x4aa>
+  200afd:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200b04:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200b08:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200b0c:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200b13:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200b17:	48 8b 00             	mov    (%rax),%rax
+  200b1a:	eb 5c                	jmp    200b78 <printer_vprintf+0x50b>
+  200b1c:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200b23:	8b 00                	mov    (%rax),%eax
+  200b25:	83 f8 2f             	cmp    $0x2f,%eax
+  200b28:	77 30                	ja     200b5a <printer_vprintf+0x4ed>
+  200b2a:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200b31:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200b35:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200b3c:	8b 00                	mov    (%rax),%eax
+  200b3e:	89 c0                	mov    %eax,%eax
+  200b40:	48 01 d0             	add    %rdx,%rax
+  200b43:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200b4a:	8b 12                	mov    (%rdx),%edx
+  200b4c:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200b4f:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200b56:	89 0a                	mov    %ecx,(%rdx)
+  200b58:	eb 1a                	jmp    200b74 <printer_vprintf+0x507>
+  200b5a:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200b61:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200b65:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200b69:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200b70:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200b74:	8b 00                	mov    (%rax),%eax
+  200b76:	89 c0                	mov    %eax,%eax
+  200b78:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+            flags |= FLAG_NUMERIC;
+  200b7c:	83 4d ec 20          	orl    $0x20,-0x14(%rbp)
+            break;
+  200b80:	e9 03 02 00 00       	jmp    200d88 <printer_vprintf+0x71b>
+        case 'x':
+            base = -16;
+  200b85:	c7 45 e0 f0 ff ff ff 	movl   $0xfffffff0,-0x20(%rbp)
+            goto format_unsigned;
+  200b8c:	e9 28 ff ff ff       	jmp    200ab9 <printer_vprintf+0x44c>
+        case 'X':
+            base = 16;
+  200b91:	c7 45 e0 10 00 00 00 	movl   $0x10,-0x20(%rbp)
+            goto format_unsigned;
+  200b98:	e9 1c ff ff ff       	jmp    200ab9 <printer_vprintf+0x44c>
+        case 'p':
+            num = (uintptr_t) va_arg(val, void*);
+  200b9d:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200ba4:	8b 00                	mov    (%rax),%eax
+  200ba6:	83 f8 2f             	cmp    $0x2f,%eax
+  200ba9:	77 30                	ja     200bdb <printer_vprintf+0x56e>
+  200bab:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200bb2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200bb6:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200bbd:	8b 00                	mov    (%rax),%eax
+  200bbf:	89 c0                	mov    %eax,%eax
+  200bc1:	48 01 d0             	add    %rdx,%rax
+  200bc4:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200bcb:	8b 12                	mov    (%rdx),%edx
+  200bcd:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200bd0:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200bd7:	89 0a                	mov    %ecx,(%rdx)
+  200bd9:	eb 1a                	jmp    200bf5 <printer_vprintf+0x588>
+  200bdb:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200be2:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200be6:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200bea:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200bf1:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200bf5:	48 8b 00             	mov    (%rax),%rax
+  200bf8:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+            base = -16;
+  200bfc:	c7 45 e0 f0 ff ff ff 	movl   $0xfffffff0,-0x20(%rbp)
+            flags |= FLAG_ALT | FLAG_ALT2 | FLAG_NUMERIC;
+  200c03:	81 4d ec 21 01 00 00 	orl    $0x121,-0x14(%rbp)
+            break;
+  200c0a:	e9 79 01 00 00       	jmp    200d88 <printer_vprintf+0x71b>
+        case 's':
+            data = va_arg(val, char*);
+  200c0f:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c16:	8b 00                	mov    (%rax),%eax
+  200c18:	83 f8 2f             	cmp    $0x2f,%eax
+  200c1b:	77 30                	ja     200c4d <printer_vprintf+0x5e0>
+  200c1d:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c24:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200c28:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c2f:	8b 00                	mov    (%rax),%eax
+  200c31:	89 c0                	mov    %eax,%eax
+  200c33:	48 01 d0             	add    %rdx,%rax
+  200c36:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200c3d:	8b 12                	mov    (%rdx),%edx
+  200c3f:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200c42:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200c49:	89 0a                	mov    %ecx,(%rdx)
+  200c4b:	eb 1a                	jmp    200c67 <printer_vprintf+0x5fa>
+  200c4d:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c54:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200c58:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200c5c:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200c63:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200c67:	48 8b 00             	mov    (%rax),%rax
+  200c6a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+            break;
+  200c6e:	e9 15 01 00 00       	jmp    200d88 <printer_vprintf+0x71b>
+        case 'C':
+            color = va_arg(val, int);
+  200c73:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c7a:	8b 00                	mov    (%rax),%eax
+  200c7c:	83 f8 2f             	cmp    $0x2f,%eax
+  200c7f:	77 30                	ja     200cb1 <printer_vprintf+0x644>
+  200c81:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c88:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200c8c:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c93:	8b 00                	mov    (%rax),%eax
+  200c95:	89 c0                	mov    %eax,%eax
+  200c97:	48 01 d0             	add    %rdx,%rax
+  200c9a:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200ca1:	8b 12                	mov    (%rdx),%edx
+  200ca3:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200ca6:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200cad:	89 0a                	mov    %ecx,(%rdx)
+  200caf:	eb 1a                	jmp    200ccb <printer_vprintf+0x65e>
+  200cb1:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200cb8:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200cbc:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200cc0:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200cc7:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200ccb:	8b 00                	mov    (%rax),%eax
+  200ccd:	89 85 74 ff ff ff    	mov    %eax,-0x8c(%rbp)
+            goto done;
+  200cd3:	e9 77 03 00 00       	jmp    20104f <printer_vprintf+0x9e2>
+        case 'c':
+            data = numbuf;
+  200cd8:	48 8d 45 8c          	lea    -0x74(%rbp),%rax
+  200cdc:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+            numbuf[0] = va_arg(val, int);
+  200ce0:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200ce7:	8b 00                	mov    (%rax),%eax
+  200ce9:	83 f8 2f             	cmp    $0x2f,%eax
+  200cec:	77 30                	ja     200d1e <printer_vprintf+0x6b1>
+  200cee:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200cf5:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200cf9:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200d00:	8b 00                	mov    (%rax),%eax
+  200d02:	89 c0                	mov    %eax,%eax
+  200d04:	48 01 d0             	add    %rdx,%rax
+  200d07:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200d0e:	8b 12                	mov    (%rdx),%edx
+  200d10:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200d13:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200d1a:	89 0a                	mov    %ecx,(%rdx)
+  200d1c:	eb 1a                	jmp    200d38 <printer_vprintf+0x6cb>
+  200d1e:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200d25:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200d29:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200d2d:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200d34:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200d38:	8b 00                	mov    (%rax),%eax
+  200d3a:	88 45 8c             	mov    %al,-0x74(%rbp)
+            numbuf[1] = '\0';
+  200d3d:	c6 45 8d 00          	movb   $0x0,-0x73(%rbp)
+            break;
+  200d41:	eb 45                	jmp    200d88 <printer_vprintf+0x71b>
+        default:
+            data = numbuf;
+  200d43:	48 8d 45 8c          	lea    -0x74(%rbp),%rax
+  200d47:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+            numbuf[0] = (*format ? *format : '%');
+  200d4b:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200d52:	0f b6 00             	movzbl (%rax),%eax
+  200d55:	84 c0                	test   %al,%al
+  200d57:	74 0c                	je     200d65 <printer_vprintf+0x6f8>
+  200d59:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200d60:	0f b6 00             	movzbl (%rax),%eax
+  200d63:	eb 05                	jmp    200d6a <printer_vprintf+0x6fd>
+  200d65:	b8 25 00 00 00       	mov    $0x25,%eax
+  200d6a:	88 45 8c             	mov    %al,-0x74(%rbp)
+            numbuf[1] = '\0';
+  200d6d:	c6 45 8d 00          	movb   $0x0,-0x73(%rbp)
+            if (!*format) {
+  200d71:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200d78:	0f b6 00             	movzbl (%rax),%eax
+  200d7b:	84 c0                	test   %al,%al
+  200d7d:	75 08                	jne    200d87 <printer_vprintf+0x71a>
+                format--;
+  200d7f:	48 83 ad 68 ff ff ff 	subq   $0x1,-0x98(%rbp)
+  200d86:	01 
+            }
+            break;
+  200d87:	90                   	nop
+        }
+
+        if (flags & FLAG_NUMERIC) {
+  200d88:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200d8b:	83 e0 20             	and    $0x20,%eax
+  200d8e:	85 c0                	test   %eax,%eax
+  200d90:	74 1e                	je     200db0 <printer_vprintf+0x743>
+            data = fill_numbuf(numbuf + NUMBUFSIZ, num, base);
+  200d92:	48 8d 45 8c          	lea    -0x74(%rbp),%rax
+  200d96:	48 83 c0 18          	add    $0x18,%rax
+  200d9a:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  200d9d:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  200da1:	48 89 ce             	mov    %rcx,%rsi
+  200da4:	48 89 c7             	mov    %rax,%rdi
+  200da7:	e8 39 f8 ff ff       	call   2005e5 <fill_numbuf>
+  200dac:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        }
+
+        const char* prefix = "";
+  200db0:	48 8d 05 3f 13 00 00 	lea    0x133f(%rip),%rax        # 2020f6 <flag_chars+0x6>
+  200db7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((flags & FLAG_NUMERIC) && (flags & FLAG_SIGNED)) {
+  200dbb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200dbe:	83 e0 20             	and    $0x20,%eax
+  200dc1:	85 c0                	test   %eax,%eax
+  200dc3:	74 51                	je     200e16 <printer_vprintf+0x7a9>
+  200dc5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200dc8:	83 e0 40             	and    $0x40,%eax
+  200dcb:	85 c0                	test   %eax,%eax
+  200dcd:	74 47                	je     200e16 <printer_vprintf+0x7a9>
+            if (flags & FLAG_NEGATIVE) {
+  200dcf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200dd2:	25 80 00 00 00       	and    $0x80,%eax
+  200dd7:	85 c0                	test   %eax,%eax
+  200dd9:	74 0d                	je     200de8 <printer_vprintf+0x77b>
+                prefix = "-";
+  200ddb:	48 8d 05 15 13 00 00 	lea    0x1315(%rip),%rax        # 2020f7 <flag_chars+0x7>
+  200de2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            if (flags & FLAG_NEGATIVE) {
+  200de6:	eb 7d                	jmp    200e65 <printer_vprintf+0x7f8>
+            } else if (flags & FLAG_PLUSPOSITIVE) {
+  200de8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200deb:	83 e0 10             	and    $0x10,%eax
+  200dee:	85 c0                	test   %eax,%eax
+  200df0:	74 0d                	je     200dff <printer_vprintf+0x792>
+                prefix = "+";
+  200df2:	48 8d 05 00 13 00 00 	lea    0x1300(%rip),%rax        # 2020f9 <flag_chars+0x9>
+  200df9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            if (flags & FLAG_NEGATIVE) {
+  200dfd:	eb 66                	jmp    200e65 <printer_vprintf+0x7f8>
+            } else if (flags & FLAG_SPACEPOSITIVE) {
+  200dff:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200e02:	83 e0 08             	and    $0x8,%eax
+  200e05:	85 c0                	test   %eax,%eax
+  200e07:	74 5c                	je     200e65 <printer_vprintf+0x7f8>
+                prefix = " ";
+  200e09:	48 8d 05 eb 12 00 00 	lea    0x12eb(%rip),%rax        # 2020fb <flag_chars+0xb>
+  200e10:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            if (flags & FLAG_NEGATIVE) {
+  200e14:	eb 4f                	jmp    200e65 <printer_vprintf+0x7f8>
+            }
+        } else if ((flags & FLAG_NUMERIC) && (flags & FLAG_ALT)
+  200e16:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200e19:	83 e0 20             	and    $0x20,%eax
+  200e1c:	85 c0                	test   %eax,%eax
+  200e1e:	74 46                	je     200e66 <printer_vprintf+0x7f9>
+  200e20:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200e23:	83 e0 01             	and    $0x1,%eax
+  200e26:	85 c0                	test   %eax,%eax
+  200e28:	74 3c                	je     200e66 <printer_vprintf+0x7f9>
+                   && (base == 16 || base == -16)
+  200e2a:	83 7d e0 10          	cmpl   $0x10,-0x20(%rbp)
+  200e2e:	74 06                	je     200e36 <printer_vprintf+0x7c9>
+  200e30:	83 7d e0 f0          	cmpl   $0xfffffff0,-0x20(%rbp)
+  200e34:	75 30                	jne    200e66 <printer_vprintf+0x7f9>
+                   && (num || (flags & FLAG_ALT2))) {
+  200e36:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  200e3b:	75 0c                	jne    200e49 <printer_vprintf+0x7dc>
+  200e3d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200e40:	25 00 01 00 00       	and    $0x100,%eax
+  200e45:	85 c0                	test   %eax,%eax
+  200e47:	74 1d                	je     200e66 <printer_vprintf+0x7f9>
+            prefix = (base == -16 ? "0x" : "0X");
+  200e49:	83 7d e0 f0          	cmpl   $0xfffffff0,-0x20(%rbp)
+  200e4d:	75 09                	jne    200e58 <printer_vprintf+0x7eb>
+  200e4f:	48 8d 05 a7 12 00 00 	lea    0x12a7(%rip),%rax        # 2020fd <flag_chars+0xd>
+  200e56:	eb 07                	jmp    200e5f <printer_vprintf+0x7f2>
+  200e58:	48 8d 05 a1 12 00 00 	lea    0x12a1(%rip),%rax        # 202100 <flag_chars+0x10>
+  200e5f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  200e63:	eb 01                	jmp    200e66 <printer_vprintf+0x7f9>
+            if (flags & FLAG_NEGATIVE) {
+  200e65:	90                   	nop
+        }
+
+        int len;
+        if (precision >= 0 && !(flags & FLAG_NUMERIC)) {
+  200e66:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  200e6a:	78 24                	js     200e90 <printer_vprintf+0x823>
+  200e6c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200e6f:	83 e0 20             	and    $0x20,%eax
+  200e72:	85 c0                	test   %eax,%eax
+  200e74:	75 1a                	jne    200e90 <printer_vprintf+0x823>
+            len = strnlen(data, precision);
+  200e76:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  200e79:	48 63 d0             	movslq %eax,%rdx
+  200e7c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200e80:	48 89 d6             	mov    %rdx,%rsi
+  200e83:	48 89 c7             	mov    %rax,%rdi
+  200e86:	e8 8a f5 ff ff       	call   200415 <strnlen>
+  200e8b:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  200e8e:	eb 0f                	jmp    200e9f <printer_vprintf+0x832>
+        } else {
+            len = strlen(data);
+  200e90:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200e94:	48 89 c7             	mov    %rax,%rdi
+  200e97:	e8 48 f5 ff ff       	call   2003e4 <strlen>
+  200e9c:	89 45 bc             	mov    %eax,-0x44(%rbp)
+        }
+        int zeros;
+        if ((flags & FLAG_NUMERIC) && precision >= 0) {
+  200e9f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200ea2:	83 e0 20             	and    $0x20,%eax
+  200ea5:	85 c0                	test   %eax,%eax
+  200ea7:	74 20                	je     200ec9 <printer_vprintf+0x85c>
+  200ea9:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  200ead:	78 1a                	js     200ec9 <printer_vprintf+0x85c>
+            zeros = precision > len ? precision - len : 0;
+  200eaf:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  200eb2:	3b 45 bc             	cmp    -0x44(%rbp),%eax
+  200eb5:	7e 08                	jle    200ebf <printer_vprintf+0x852>
+  200eb7:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  200eba:	2b 45 bc             	sub    -0x44(%rbp),%eax
+  200ebd:	eb 05                	jmp    200ec4 <printer_vprintf+0x857>
+  200ebf:	b8 00 00 00 00       	mov    $0x0,%eax
+  200ec4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  200ec7:	eb 5c                	jmp    200f25 <printer_vprintf+0x8b8>
+        } else if ((flags & FLAG_NUMERIC) && (flags & FLAG_ZERO)
+  200ec9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200ecc:	83 e0 20             	and    $0x20,%eax
+  200ecf:	85 c0                	test   %eax,%eax
+  200ed1:	74 4b                	je     200f1e <printer_vprintf+0x8b1>
+  200ed3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200ed6:	83 e0 02             	and    $0x2,%eax
+  200ed9:	85 c0                	test   %eax,%eax
+  200edb:	74 41                	je     200f1e <printer_vprintf+0x8b1>
+                   && !(flags & FLAG_LEFTJUSTIFY)
+  200edd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200ee0:	83 e0 04             	and    $0x4,%eax
+  200ee3:	85 c0                	test   %eax,%eax
+  200ee5:	75 37                	jne    200f1e <printer_vprintf+0x8b1>
+                   && len + (int) strlen(prefix) < width) {
+  200ee7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  200eeb:	48 89 c7             	mov    %rax,%rdi
+  200eee:	e8 f1 f4 ff ff       	call   2003e4 <strlen>
+  200ef3:	89 c2                	mov    %eax,%edx
+  200ef5:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  200ef8:	01 d0                	add    %edx,%eax
+  200efa:	39 45 e8             	cmp    %eax,-0x18(%rbp)
+  200efd:	7e 1f                	jle    200f1e <printer_vprintf+0x8b1>
+            zeros = width - len - strlen(prefix);
+  200eff:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  200f02:	2b 45 bc             	sub    -0x44(%rbp),%eax
+  200f05:	89 c3                	mov    %eax,%ebx
+  200f07:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  200f0b:	48 89 c7             	mov    %rax,%rdi
+  200f0e:	e8 d1 f4 ff ff       	call   2003e4 <strlen>
+  200f13:	89 c2                	mov    %eax,%edx
+  200f15:	89 d8                	mov    %ebx,%eax
+  200f17:	29 d0                	sub    %edx,%eax
+  200f19:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  200f1c:	eb 07                	jmp    200f25 <printer_vprintf+0x8b8>
+        } else {
+            zeros = 0;
+  200f1e:	c7 45 b8 00 00 00 00 	movl   $0x0,-0x48(%rbp)
+        }
+        width -= len + zeros + strlen(prefix);
+  200f25:	8b 55 bc             	mov    -0x44(%rbp),%edx
+  200f28:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  200f2b:	01 d0                	add    %edx,%eax
+  200f2d:	48 63 d8             	movslq %eax,%rbx
+  200f30:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  200f34:	48 89 c7             	mov    %rax,%rdi
+  200f37:	e8 a8 f4 ff ff       	call   2003e4 <strlen>
+  200f3c:	48 8d 14 03          	lea    (%rbx,%rax,1),%rdx
+  200f40:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  200f43:	29 d0                	sub    %edx,%eax
+  200f45:	89 45 e8             	mov    %eax,-0x18(%rbp)
+        for (; !(flags & FLAG_LEFTJUSTIFY) && width > 0; --width) {
+  200f48:	eb 25                	jmp    200f6f <printer_vprintf+0x902>
+            p->putc(p, ' ', color);
+  200f4a:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200f51:	48 8b 08             	mov    (%rax),%rcx
+  200f54:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  200f5a:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200f61:	be 20 00 00 00       	mov    $0x20,%esi
+  200f66:	48 89 c7             	mov    %rax,%rdi
+  200f69:	ff d1                	call   *%rcx
+        for (; !(flags & FLAG_LEFTJUSTIFY) && width > 0; --width) {
+  200f6b:	83 6d e8 01          	subl   $0x1,-0x18(%rbp)
+  200f6f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200f72:	83 e0 04             	and    $0x4,%eax
+  200f75:	85 c0                	test   %eax,%eax
+  200f77:	75 36                	jne    200faf <printer_vprintf+0x942>
+  200f79:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  200f7d:	7f cb                	jg     200f4a <printer_vprintf+0x8dd>
+        }
+        for (; *prefix; ++prefix) {
+  200f7f:	eb 2e                	jmp    200faf <printer_vprintf+0x942>
+            p->putc(p, *prefix, color);
+  200f81:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200f88:	4c 8b 00             	mov    (%rax),%r8
+  200f8b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  200f8f:	0f b6 00             	movzbl (%rax),%eax
+  200f92:	0f b6 c8             	movzbl %al,%ecx
+  200f95:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  200f9b:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200fa2:	89 ce                	mov    %ecx,%esi
+  200fa4:	48 89 c7             	mov    %rax,%rdi
+  200fa7:	41 ff d0             	call   *%r8
+        for (; *prefix; ++prefix) {
+  200faa:	48 83 45 c0 01       	addq   $0x1,-0x40(%rbp)
+  200faf:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  200fb3:	0f b6 00             	movzbl (%rax),%eax
+  200fb6:	84 c0                	test   %al,%al
+  200fb8:	75 c7                	jne    200f81 <printer_vprintf+0x914>
+        }
+        for (; zeros > 0; --zeros) {
+  200fba:	eb 25                	jmp    200fe1 <printer_vprintf+0x974>
+            p->putc(p, '0', color);
+  200fbc:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200fc3:	48 8b 08             	mov    (%rax),%rcx
+  200fc6:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  200fcc:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200fd3:	be 30 00 00 00       	mov    $0x30,%esi
+  200fd8:	48 89 c7             	mov    %rax,%rdi
+  200fdb:	ff d1                	call   *%rcx
+        for (; zeros > 0; --zeros) {
+  200fdd:	83 6d b8 01          	subl   $0x1,-0x48(%rbp)
+  200fe1:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  200fe5:	7f d5                	jg     200fbc <printer_vprintf+0x94f>
+        }
+        for (; len > 0; ++data, --len) {
+  200fe7:	eb 32                	jmp    20101b <printer_vprintf+0x9ae>
+            p->putc(p, *data, color);
+  200fe9:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200ff0:	4c 8b 00             	mov    (%rax),%r8
+  200ff3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200ff7:	0f b6 00             	movzbl (%rax),%eax
+  200ffa:	0f b6 c8             	movzbl %al,%ecx
+  200ffd:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  201003:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  20100a:	89 ce                	mov    %ecx,%esi
+  20100c:	48 89 c7             	mov    %rax,%rdi
+  20100f:	41 ff d0             	call   *%r8
+        for (; len > 0; ++data, --len) {
+  201012:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  201017:	83 6d bc 01          	subl   $0x1,-0x44(%rbp)
+  20101b:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+  20101f:	7f c8                	jg     200fe9 <printer_vprintf+0x97c>
+        }
+        for (; width > 0; --width) {
+  201021:	eb 25                	jmp    201048 <printer_vprintf+0x9db>
+            p->putc(p, ' ', color);
+  201023:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  20102a:	48 8b 08             	mov    (%rax),%rcx
+  20102d:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  201033:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  20103a:	be 20 00 00 00       	mov    $0x20,%esi
+  20103f:	48 89 c7             	mov    %rax,%rdi
+  201042:	ff d1                	call   *%rcx
+        for (; width > 0; --width) {
+  201044:	83 6d e8 01          	subl   $0x1,-0x18(%rbp)
+  201048:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  20104c:	7f d5                	jg     201023 <printer_vprintf+0x9b6>
+        }
+    done: ;
+  20104e:	90                   	nop
+    for (; *format; ++format) {
+  20104f:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  201056:	01 
+  201057:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  20105e:	0f b6 00             	movzbl (%rax),%eax
+  201061:	84 c0                	test   %al,%al
+  201063:	0f 85 30 f6 ff ff    	jne    200699 <printer_vprintf+0x2c>
+    }
+}
+  201069:	90                   	nop
+  20106a:	90                   	nop
+  20106b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  20106f:	c9                   	leave
+  201070:	c3                   	ret
+
+0000000000201071 <console_putc>:
+typedef struct console_printer {
+    printer p;
+    uint16_t* cursor;
+} console_printer;
+
+static void console_putc(printer* p, unsigned char c, int color) {
+  201071:	55                   	push   %rbp
+  201072:	48 89 e5             	mov    %rsp,%rbp
+  201075:	48 83 ec 30          	sub    $0x30,%rsp
+  201079:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  20107d:	89 f0                	mov    %esi,%eax
+  20107f:	89 55 d0             	mov    %edx,-0x30(%rbp)
+  201082:	88 45 d4             	mov    %al,-0x2c(%rbp)
+    console_printer* cp = (console_printer*) p;
+  201085:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  201089:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    /*if (cp->cursor >= console + CONSOLE_ROWS * CONSOLE_COLUMNS) {
+        cp->cursor = console;
+    }*/
+    if (c == '\n') {
+  20108d:	80 7d d4 0a          	cmpb   $0xa,-0x2c(%rbp)
+  201091:	75 7f                	jne    201112 <console_putc+0xa1>
+        int pos = (cp->cursor - console) % CONSOLE_COLUMNS;
+  201093:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201097:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  20109b:	48 8d 05 5e 6f eb ff 	lea    -0x1490a2(%rip),%rax        # b8000 <console>
+  2010a2:	48 29 c2             	sub    %rax,%rdx
+  2010a5:	48 89 d0             	mov    %rdx,%rax
+  2010a8:	48 d1 f8             	sar    %rax
+  2010ab:	48 89 c1             	mov    %rax,%rcx
+  2010ae:	48 ba 67 66 66 66 66 	movabs $0x6666666666666667,%rdx
+  2010b5:	66 66 66 
+  2010b8:	48 89 c8             	mov    %rcx,%rax
+  2010bb:	48 f7 ea             	imul   %rdx
+  2010be:	48 c1 fa 05          	sar    $0x5,%rdx
+  2010c2:	48 89 c8             	mov    %rcx,%rax
+  2010c5:	48 c1 f8 3f          	sar    $0x3f,%rax
+  2010c9:	48 29 c2             	sub    %rax,%rdx
+  2010cc:	48 89 d0             	mov    %rdx,%rax
+  2010cf:	48 c1 e0 02          	shl    $0x2,%rax
+  2010d3:	48 01 d0             	add    %rdx,%rax
+  2010d6:	48 c1 e0 04          	shl    $0x4,%rax
+  2010da:	48 29 c1             	sub    %rax,%rcx
+  2010dd:	48 89 ca             	mov    %rcx,%rdx
+  2010e0:	89 55 fc             	mov    %edx,-0x4(%rbp)
+        for (; pos != CONSOLE_COLUMNS; pos++) {
+  2010e3:	eb 25                	jmp    20110a <console_putc+0x99>
+            *cp->cursor++ = ' ' | color;
+  2010e5:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  2010e8:	83 c8 20             	or     $0x20,%eax
+  2010eb:	89 c6                	mov    %eax,%esi
+  2010ed:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2010f1:	48 8b 40 08          	mov    0x8(%rax),%rax
+  2010f5:	48 8d 48 02          	lea    0x2(%rax),%rcx
+  2010f9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  2010fd:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  201101:	89 f2                	mov    %esi,%edx
+  201103:	66 89 10             	mov    %dx,(%rax)
+        for (; pos != CONSOLE_COLUMNS; pos++) {
+  201106:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  20110a:	83 7d fc 50          	cmpl   $0x50,-0x4(%rbp)
+  20110e:	75 d5                	jne    2010e5 <console_putc+0x74>
+  201110:	eb 69                	jmp    20117b <console_putc+0x10a>
+        }
+    } else if (c == '\b') {
+  201112:	80 7d d4 08          	cmpb   $0x8,-0x2c(%rbp)
+  201116:	75 3f                	jne    201157 <console_putc+0xe6>
+        if (cp->cursor != console) {
+  201118:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20111c:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  201120:	48 8d 05 d9 6e eb ff 	lea    -0x149127(%rip),%rax        # b8000 <console>
+  201127:	48 39 c2             	cmp    %rax,%rdx
+  20112a:	74 4f                	je     20117b <console_putc+0x10a>
+            *(--cp->cursor) = ' ' | color;
+  20112c:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  20112f:	83 c8 20             	or     $0x20,%eax
+  201132:	89 c1                	mov    %eax,%ecx
+  201134:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201138:	48 8b 40 08          	mov    0x8(%rax),%rax
+  20113c:	48 8d 50 fe          	lea    -0x2(%rax),%rdx
+  201140:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201144:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  201148:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20114c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  201150:	89 ca                	mov    %ecx,%edx
+  201152:	66 89 10             	mov    %dx,(%rax)
+  201155:	eb 24                	jmp    20117b <console_putc+0x10a>
+        }
+    } else {
+        *cp->cursor++ = c | color;
+  201157:	0f b6 45 d4          	movzbl -0x2c(%rbp),%eax
+  20115b:	8b 55 d0             	mov    -0x30(%rbp),%edx
+  20115e:	09 d0                	or     %edx,%eax
+  201160:	89 c6                	mov    %eax,%esi
+  201162:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201166:	48 8b 40 08          	mov    0x8(%rax),%rax
+  20116a:	48 8d 48 02          	lea    0x2(%rax),%rcx
+  20116e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  201172:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  201176:	89 f2                	mov    %esi,%edx
+  201178:	66 89 10             	mov    %dx,(%rax)
+    }
+
+    const int MAX_ROWS = CONSOLE_ROWS - 2;
+  20117b:	c7 45 e4 17 00 00 00 	movl   $0x17,-0x1c(%rbp)
+
+    if (cp->cursor == console + MAX_ROWS * CONSOLE_COLUMNS) {
+  201182:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201186:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  20118a:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  20118d:	89 d0                	mov    %edx,%eax
+  20118f:	c1 e0 02             	shl    $0x2,%eax
+  201192:	01 d0                	add    %edx,%eax
+  201194:	c1 e0 04             	shl    $0x4,%eax
+  201197:	48 98                	cltq
+  201199:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  20119d:	48 8d 05 5c 6e eb ff 	lea    -0x1491a4(%rip),%rax        # b8000 <console>
+  2011a4:	48 01 d0             	add    %rdx,%rax
+  2011a7:	48 39 c1             	cmp    %rax,%rcx
+  2011aa:	0f 85 ac 00 00 00    	jne    20125c <console_putc+0x1eb>
+        // Move all characters up by one row, forgetting the first row
+        for (int i = 0; i < (MAX_ROWS - 1) * CONSOLE_COLUMNS; ++i) {
+  2011b0:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  2011b7:	eb 30                	jmp    2011e9 <console_putc+0x178>
+            console[i] = console[i + CONSOLE_COLUMNS];
+  2011b9:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  2011bc:	83 c0 50             	add    $0x50,%eax
+  2011bf:	48 98                	cltq
+  2011c1:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  2011c5:	48 8d 05 34 6e eb ff 	lea    -0x1491cc(%rip),%rax        # b8000 <console>
+  2011cc:	0f b7 04 02          	movzwl (%rdx,%rax,1),%eax
+  2011d0:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  2011d3:	48 63 d2             	movslq %edx,%rdx
+  2011d6:	48 8d 0c 12          	lea    (%rdx,%rdx,1),%rcx
+  2011da:	48 8d 15 1f 6e eb ff 	lea    -0x1491e1(%rip),%rdx        # b8000 <console>
+  2011e1:	66 89 04 11          	mov    %ax,(%rcx,%rdx,1)
+        for (int i = 0; i < (MAX_ROWS - 1) * CONSOLE_COLUMNS; ++i) {
+  2011e5:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+  2011e9:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  2011ec:	8d 50 ff             	lea    -0x1(%rax),%edx
+  2011ef:	89 d0                	mov    %edx,%eax
+  2011f1:	c1 e0 02             	shl    $0x2,%eax
+  2011f4:	01 d0                	add    %edx,%eax
+  2011f6:	c1 e0 04             	shl    $0x4,%eax
+  2011f9:	39 45 f8             	cmp    %eax,-0x8(%rbp)
+  2011fc:	7c bb                	jl     2011b9 <console_putc+0x148>
+        }
+
+        // Fill last column with space
+        for (int i = (MAX_ROWS - 1) * CONSOLE_COLUMNS; i < MAX_ROWS * CONSOLE_COLUMNS; ++i) {
+  2011fe:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  201201:	8d 50 ff             	lea    -0x1(%rax),%edx
+  201204:	89 d0                	mov    %edx,%eax
+  201206:	c1 e0 02             	shl    $0x2,%eax
+  201209:	01 d0                	add    %edx,%eax
+  20120b:	c1 e0 04             	shl    $0x4,%eax
+  20120e:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  201211:	eb 20                	jmp    201233 <console_putc+0x1c2>
+            console[i] = ' ' | color;
+  201213:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  201216:	83 c8 20             	or     $0x20,%eax
+  201219:	89 c1                	mov    %eax,%ecx
+  20121b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  20121e:	48 98                	cltq
+  201220:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  201224:	48 8d 05 d5 6d eb ff 	lea    -0x14922b(%rip),%rax        # b8000 <console>
+  20122b:	66 89 0c 02          	mov    %cx,(%rdx,%rax,1)
+        for (int i = (MAX_ROWS - 1) * CONSOLE_COLUMNS; i < MAX_ROWS * CONSOLE_COLUMNS; ++i) {
+  20122f:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  201233:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  201236:	89 d0                	mov    %edx,%eax
+  201238:	c1 e0 02             	shl    $0x2,%eax
+  20123b:	01 d0                	add    %edx,%eax
+  20123d:	c1 e0 04             	shl    $0x4,%eax
+  201240:	39 45 f4             	cmp    %eax,-0xc(%rbp)
+  201243:	7c ce                	jl     201213 <console_putc+0x1a2>
+        }
+
+        cp->cursor -= CONSOLE_COLUMNS;
+  201245:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201249:	48 8b 40 08          	mov    0x8(%rax),%rax
+  20124d:	48 8d 90 60 ff ff ff 	lea    -0xa0(%rax),%rdx
+  201254:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201258:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    }
+}
+  20125c:	90                   	nop
+  20125d:	c9                   	leave
+  20125e:	c3                   	ret
+
+000000000020125f <console_vprintf>:
+
+int console_vprintf(int cpos, int color, const char* format, va_list val) {
+  20125f:	55                   	push   %rbp
+  201260:	48 89 e5             	mov    %rsp,%rbp
+  201263:	48 83 ec 30          	sub    $0x30,%rsp
+  201267:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  20126a:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  20126d:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  201271:	48 89 4d d8          	mov    %rcx,-0x28(%rbp)
+    struct console_printer cp;
+    cp.p.putc = console_putc;
+  201275:	48 8d 05 f5 fd ff ff 	lea    -0x20b(%rip),%rax        # 201071 <console_putc>
+  20127c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (cpos < 0 || cpos >= CONSOLE_ROWS * CONSOLE_COLUMNS) {
+  201280:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  201284:	78 09                	js     20128f <console_vprintf+0x30>
+  201286:	81 7d ec cf 07 00 00 	cmpl   $0x7cf,-0x14(%rbp)
+  20128d:	7e 07                	jle    201296 <console_vprintf+0x37>
+        cpos = 0;
+  20128f:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+    }
+    cp.cursor = console + cpos;
+  201296:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  201299:	48 98                	cltq
+  20129b:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  20129f:	48 8d 05 5a 6d eb ff 	lea    -0x1492a6(%rip),%rax        # b8000 <console>
+  2012a6:	48 01 d0             	add    %rdx,%rax
+  2012a9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    printer_vprintf(&cp.p, color, format, val);
+  2012ad:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  2012b1:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  2012b5:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  2012b8:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  2012bc:	48 89 c7             	mov    %rax,%rdi
+  2012bf:	e8 a9 f3 ff ff       	call   20066d <printer_vprintf>
+    return cp.cursor - console;
+  2012c4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  2012c8:	48 8d 05 31 6d eb ff 	lea    -0x1492cf(%rip),%rax        # b8000 <console>
+  2012cf:	48 29 c2             	sub    %rax,%rdx
+  2012d2:	48 89 d0             	mov    %rdx,%rax
+  2012d5:	48 d1 f8             	sar    %rax
+}
+  2012d8:	c9                   	leave
+  2012d9:	c3                   	ret
+
+00000000002012da <console_printf>:
+
+int console_printf(int cpos, int color, const char* format, ...) {
+  2012da:	55                   	push   %rbp
+  2012db:	48 89 e5             	mov    %rsp,%rbp
+  2012de:	48 83 ec 60          	sub    $0x60,%rsp
+  2012e2:	89 7d ac             	mov    %edi,-0x54(%rbp)
+  2012e5:	89 75 a8             	mov    %esi,-0x58(%rbp)
+  2012e8:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+  2012ec:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  2012f0:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  2012f4:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list val;
+    va_start(val, format);
+  2012f8:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  2012ff:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  201303:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  201307:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  20130b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    cpos = console_vprintf(cpos, color, format, val);
+  20130f:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  201313:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  201317:	8b 75 a8             	mov    -0x58(%rbp),%esi
+  20131a:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  20131d:	89 c7                	mov    %eax,%edi
+  20131f:	e8 3b ff ff ff       	call   20125f <console_vprintf>
+  201324:	89 45 ac             	mov    %eax,-0x54(%rbp)
+    va_end(val);
+    return cpos;
+  201327:	8b 45 ac             	mov    -0x54(%rbp),%eax
+}
+  20132a:	c9                   	leave
+  20132b:	c3                   	ret
+
+000000000020132c <string_putc>:
+    printer p;
+    char* s;
+    char* end;
+} string_printer;
+
+static void string_putc(printer* p, unsigned char c, int color) {
+  20132c:	55                   	push   %rbp
+  20132d:	48 89 e5             	mov    %rsp,%rbp
+  201330:	48 83 ec 20          	sub    $0x20,%rsp
+  201334:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  201338:	89 f0                	mov    %esi,%eax
+  20133a:	89 55 e0             	mov    %edx,-0x20(%rbp)
+  20133d:	88 45 e4             	mov    %al,-0x1c(%rbp)
+    string_printer* sp = (string_printer*) p;
+  201340:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201344:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (sp->s < sp->end) {
+  201348:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20134c:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  201350:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  201354:	48 8b 40 10          	mov    0x10(%rax),%rax
+  201358:	48 39 c2             	cmp    %rax,%rdx
+  20135b:	73 1a                	jae    201377 <string_putc+0x4b>
+        *sp->s++ = c;
+  20135d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  201361:	48 8b 40 08          	mov    0x8(%rax),%rax
+  201365:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  201369:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  20136d:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  201371:	0f b6 55 e4          	movzbl -0x1c(%rbp),%edx
+  201375:	88 10                	mov    %dl,(%rax)
+    }
+    (void) color;
+}
+  201377:	90                   	nop
+  201378:	c9                   	leave
+  201379:	c3                   	ret
+
+000000000020137a <vsnprintf>:
+
+int vsnprintf(char* s, size_t size, const char* format, va_list val) {
+  20137a:	55                   	push   %rbp
+  20137b:	48 89 e5             	mov    %rsp,%rbp
+  20137e:	48 83 ec 40          	sub    $0x40,%rsp
+  201382:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  201386:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  20138a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  20138e:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+    string_printer sp;
+    sp.p.putc = string_putc;
+  201392:	48 8d 05 93 ff ff ff 	lea    -0x6d(%rip),%rax        # 20132c <string_putc>
+  201399:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    sp.s = s;
+  20139d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  2013a1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (size) {
+  2013a5:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  2013aa:	74 33                	je     2013df <vsnprintf+0x65>
+        sp.end = s + size - 1;
+  2013ac:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  2013b0:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  2013b4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  2013b8:	48 01 d0             	add    %rdx,%rax
+  2013bb:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+        printer_vprintf(&sp.p, 0, format, val);
+  2013bf:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  2013c3:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  2013c7:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  2013cb:	be 00 00 00 00       	mov    $0x0,%esi
+  2013d0:	48 89 c7             	mov    %rax,%rdi
+  2013d3:	e8 95 f2 ff ff       	call   20066d <printer_vprintf>
+        *sp.s = 0;
+  2013d8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2013dc:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return sp.s - s;
+  2013df:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2013e3:	48 2b 45 d8          	sub    -0x28(%rbp),%rax
+}
+  2013e7:	c9                   	leave
+  2013e8:	c3                   	ret
+
+00000000002013e9 <snprintf>:
+
+int snprintf(char* s, size_t size, const char* format, ...) {
+  2013e9:	55                   	push   %rbp
+  2013ea:	48 89 e5             	mov    %rsp,%rbp
+  2013ed:	48 83 ec 70          	sub    $0x70,%rsp
+  2013f1:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  2013f5:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  2013f9:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  2013fd:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  201401:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  201405:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list val;
+    va_start(val, format);
+  201409:	c7 45 b0 18 00 00 00 	movl   $0x18,-0x50(%rbp)
+  201410:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  201414:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  201418:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  20141c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    int n = vsnprintf(s, size, format, val);
+  201420:	48 8d 4d b0          	lea    -0x50(%rbp),%rcx
+  201424:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  201428:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  20142c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  201430:	48 89 c7             	mov    %rax,%rdi
+  201433:	e8 42 ff ff ff       	call   20137a <vsnprintf>
+  201438:	89 45 cc             	mov    %eax,-0x34(%rbp)
+    va_end(val);
+    return n;
+  20143b:	8b 45 cc             	mov    -0x34(%rbp),%eax
+}
+  20143e:	c9                   	leave
+  20143f:	c3                   	ret
+
+0000000000201440 <console_clear>:
+
+
+// console_clear
+//    Erases the console and moves the cursor to the upper left (CPOS(0, 0)).
+
+void console_clear(void) {
+  201440:	55                   	push   %rbp
+  201441:	48 89 e5             	mov    %rsp,%rbp
+  201444:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < CONSOLE_ROWS * CONSOLE_COLUMNS; ++i) {
+  201448:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  20144f:	eb 1a                	jmp    20146b <console_clear+0x2b>
+        console[i] = ' ' | 0x0700;
+  201451:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  201454:	48 98                	cltq
+  201456:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  20145a:	48 8d 05 9f 6b eb ff 	lea    -0x149461(%rip),%rax        # b8000 <console>
+  201461:	66 c7 04 02 20 07    	movw   $0x720,(%rdx,%rax,1)
+    for (int i = 0; i < CONSOLE_ROWS * CONSOLE_COLUMNS; ++i) {
+  201467:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  20146b:	81 7d fc cf 07 00 00 	cmpl   $0x7cf,-0x4(%rbp)
+  201472:	7e dd                	jle    201451 <console_clear+0x11>
+    }
+    cursorpos = 0;
+  201474:	c7 05 7e 7b eb ff 00 	movl   $0x0,-0x148482(%rip)        # b8ffc <cursorpos>
+  20147b:	00 00 00 
+}
+  20147e:	90                   	nop
+  20147f:	c9                   	leave
+  201480:	c3                   	ret
+
+0000000000201481 <string_to_char>:
+
+
+int string_to_char(const char *str, int *dest) {
+  201481:	55                   	push   %rbp
+  201482:	48 89 e5             	mov    %rsp,%rbp
+  201485:	48 83 ec 20          	sub    $0x20,%rsp
+  201489:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  20148d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    if (*str == '\0') return -1;
+  201491:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201495:	0f b6 00             	movzbl (%rax),%eax
+  201498:	84 c0                	test   %al,%al
+  20149a:	75 0a                	jne    2014a6 <string_to_char+0x25>
+  20149c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  2014a1:	e9 e0 00 00 00       	jmp    201586 <string_to_char+0x105>
+
+    *dest = 0;
+  2014a6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  2014aa:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    for (; *str; str++) {
+  2014b0:	e9 bd 00 00 00       	jmp    201572 <string_to_char+0xf1>
+        int digit = 0;
+  2014b5:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+        switch (*str)
+  2014bc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2014c0:	0f b6 00             	movzbl (%rax),%eax
+  2014c3:	0f be c0             	movsbl %al,%eax
+  2014c6:	83 e8 30             	sub    $0x30,%eax
+  2014c9:	83 f8 09             	cmp    $0x9,%eax
+  2014cc:	77 7c                	ja     20154a <string_to_char+0xc9>
+  2014ce:	89 c0                	mov    %eax,%eax
+  2014d0:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  2014d7:	00 
+  2014d8:	48 8d 05 05 0d 00 00 	lea    0xd05(%rip),%rax        # 2021e4 <flag_chars+0xf4>
+  2014df:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+  2014e2:	48 98                	cltq
+  2014e4:	48 8d 15 f9 0c 00 00 	lea    0xcf9(%rip),%rdx        # 2021e4 <flag_chars+0xf4>
+  2014eb:	48 01 d0             	add    %rdx,%rax
+  2014ee:	ff e0                	jmp    *%rax
+        {
+        case '0':
+            digit = 0;
+  2014f0:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+            break;
+  2014f7:	eb 58                	jmp    201551 <string_to_char+0xd0>
+        case '1':
+            digit = 1;
+  2014f9:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+            break;
+  201500:	eb 4f                	jmp    201551 <string_to_char+0xd0>
+        case '2':
+            digit = 2;
+  201502:	c7 45 fc 02 00 00 00 	movl   $0x2,-0x4(%rbp)
+            break;
+  201509:	eb 46                	jmp    201551 <string_to_char+0xd0>
+        case '3':
+            digit = 3;
+  20150b:	c7 45 fc 03 00 00 00 	movl   $0x3,-0x4(%rbp)
+            break;
+  201512:	eb 3d                	jmp    201551 <string_to_char+0xd0>
+        case '4':
+            digit = 4;
+  201514:	c7 45 fc 04 00 00 00 	movl   $0x4,-0x4(%rbp)
+            break;
+  20151b:	eb 34                	jmp    201551 <string_to_char+0xd0>
+        case '5':
+            digit = 5;
+  20151d:	c7 45 fc 05 00 00 00 	movl   $0x5,-0x4(%rbp)
+            break;
+  201524:	eb 2b                	jmp    201551 <string_to_char+0xd0>
+        case '6':
+            digit = 6;
+  201526:	c7 45 fc 06 00 00 00 	movl   $0x6,-0x4(%rbp)
+            break;
+  20152d:	eb 22                	jmp    201551 <string_to_char+0xd0>
+        case '7':
+            digit = 7;
+  20152f:	c7 45 fc 07 00 00 00 	movl   $0x7,-0x4(%rbp)
+            break;
+  201536:	eb 19                	jmp    201551 <string_to_char+0xd0>
+        case '8':
+            digit = 8;
+  201538:	c7 45 fc 08 00 00 00 	movl   $0x8,-0x4(%rbp)
+            break;
+  20153f:	eb 10                	jmp    201551 <string_to_char+0xd0>
+        case '9':
+            digit = 9;
+  201541:	c7 45 fc 09 00 00 00 	movl   $0x9,-0x4(%rbp)
+            break;
+  201548:	eb 07                	jmp    201551 <string_to_char+0xd0>
+        default:
+            return -1;
+  20154a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  20154f:	eb 35                	jmp    201586 <string_to_char+0x105>
+        }
+
+        *dest = *dest * 10 + digit;
+  201551:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  201555:	8b 10                	mov    (%rax),%edx
+  201557:	89 d0                	mov    %edx,%eax
+  201559:	c1 e0 02             	shl    $0x2,%eax
+  20155c:	01 d0                	add    %edx,%eax
+  20155e:	01 c0                	add    %eax,%eax
+  201560:	89 c2                	mov    %eax,%edx
+  201562:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  201565:	01 c2                	add    %eax,%edx
+  201567:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  20156b:	89 10                	mov    %edx,(%rax)
+    for (; *str; str++) {
+  20156d:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  201572:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201576:	0f b6 00             	movzbl (%rax),%eax
+  201579:	84 c0                	test   %al,%al
+  20157b:	0f 85 34 ff ff ff    	jne    2014b5 <string_to_char+0x34>
+    }
+
+    return 0;
+  201581:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  201586:	c9                   	leave
+  201587:	c3                   	ret
+
+0000000000201588 <atoi>:
+
+int atoi(const char *str) {
+  201588:	55                   	push   %rbp
+  201589:	48 89 e5             	mov    %rsp,%rbp
+  20158c:	48 83 ec 18          	sub    $0x18,%rsp
+  201590:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    if (*str == '\0') return -1;
+  201594:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201598:	0f b6 00             	movzbl (%rax),%eax
+  20159b:	84 c0                	test   %al,%al
+  20159d:	75 0a                	jne    2015a9 <atoi+0x21>
+  20159f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  2015a4:	e9 d7 00 00 00       	jmp    201680 <atoi+0xf8>
+
+    int n = 0;
+  2015a9:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    for (; *str; str++) {
+  2015b0:	e9 b7 00 00 00       	jmp    20166c <atoi+0xe4>
+        int digit = 0;
+  2015b5:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+        switch (*str)
+  2015bc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2015c0:	0f b6 00             	movzbl (%rax),%eax
+  2015c3:	0f be c0             	movsbl %al,%eax
+  2015c6:	83 e8 30             	sub    $0x30,%eax
+  2015c9:	83 f8 09             	cmp    $0x9,%eax
+  2015cc:	77 7c                	ja     20164a <atoi+0xc2>
+  2015ce:	89 c0                	mov    %eax,%eax
+  2015d0:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  2015d7:	00 
+  2015d8:	48 8d 05 2d 0c 00 00 	lea    0xc2d(%rip),%rax        # 20220c <flag_chars+0x11c>
+  2015df:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+  2015e2:	48 98                	cltq
+  2015e4:	48 8d 15 21 0c 00 00 	lea    0xc21(%rip),%rdx        # 20220c <flag_chars+0x11c>
+  2015eb:	48 01 d0             	add    %rdx,%rax
+  2015ee:	ff e0                	jmp    *%rax
+        {
+        case '0':
+            digit = 0;
+  2015f0:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+            break;
+  2015f7:	eb 58                	jmp    201651 <atoi+0xc9>
+        case '1':
+            digit = 1;
+  2015f9:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+            break;
+  201600:	eb 4f                	jmp    201651 <atoi+0xc9>
+        case '2':
+            digit = 2;
+  201602:	c7 45 f8 02 00 00 00 	movl   $0x2,-0x8(%rbp)
+            break;
+  201609:	eb 46                	jmp    201651 <atoi+0xc9>
+        case '3':
+            digit = 3;
+  20160b:	c7 45 f8 03 00 00 00 	movl   $0x3,-0x8(%rbp)
+            break;
+  201612:	eb 3d                	jmp    201651 <atoi+0xc9>
+        case '4':
+            digit = 4;
+  201614:	c7 45 f8 04 00 00 00 	movl   $0x4,-0x8(%rbp)
+            break;
+  20161b:	eb 34                	jmp    201651 <atoi+0xc9>
+        case '5':
+            digit = 5;
+  20161d:	c7 45 f8 05 00 00 00 	movl   $0x5,-0x8(%rbp)
+            break;
+  201624:	eb 2b                	jmp    201651 <atoi+0xc9>
+        case '6':
+            digit = 6;
+  201626:	c7 45 f8 06 00 00 00 	movl   $0x6,-0x8(%rbp)
+            break;
+  20162d:	eb 22                	jmp    201651 <atoi+0xc9>
+        case '7':
+            digit = 7;
+  20162f:	c7 45 f8 07 00 00 00 	movl   $0x7,-0x8(%rbp)
+            break;
+  201636:	eb 19                	jmp    201651 <atoi+0xc9>
+        case '8':
+            digit = 8;
+  201638:	c7 45 f8 08 00 00 00 	movl   $0x8,-0x8(%rbp)
+            break;
+  20163f:	eb 10                	jmp    201651 <atoi+0xc9>
+        case '9':
+            digit = 9;
+  201641:	c7 45 f8 09 00 00 00 	movl   $0x9,-0x8(%rbp)
+            break;
+  201648:	eb 07                	jmp    201651 <atoi+0xc9>
+        default:
+            return -1;
+  20164a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  20164f:	eb 2f                	jmp    201680 <atoi+0xf8>
+        }
+
+        n = n * 10 + digit;
+  201651:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  201654:	89 d0                	mov    %edx,%eax
+  201656:	c1 e0 02             	shl    $0x2,%eax
+  201659:	01 d0                	add    %edx,%eax
+  20165b:	01 c0                	add    %eax,%eax
+  20165d:	89 c2                	mov    %eax,%edx
+  20165f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  201662:	01 d0                	add    %edx,%eax
+  201664:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    for (; *str; str++) {
+  201667:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  20166c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201670:	0f b6 00             	movzbl (%rax),%eax
+  201673:	84 c0                	test   %al,%al
+  201675:	0f 85 3a ff ff ff    	jne    2015b5 <atoi+0x2d>
+    }
+
+    return 0;
+  20167b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  201680:	c9                   	leave
+  201681:	c3                   	ret
+
+0000000000201682 <copy_comp>:
+        components[ncomp++] = (comp); \
+    } \
+} while (0)
+
+// Helper to copy a component to dst
+void copy_comp(const char *start, const char *end, char **pdst) {
+  201682:	55                   	push   %rbp
+  201683:	48 89 e5             	mov    %rsp,%rbp
+  201686:	48 83 ec 18          	sub    $0x18,%rsp
+  20168a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  20168e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  201692:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    while (start < end) {
+  201696:	eb 23                	jmp    2016bb <copy_comp+0x39>
+        *(*pdst)++ = *start++;
+  201698:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  20169c:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  2016a0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  2016a4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2016a8:	48 8b 00             	mov    (%rax),%rax
+  2016ab:	48 8d 70 01          	lea    0x1(%rax),%rsi
+  2016af:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  2016b3:	48 89 31             	mov    %rsi,(%rcx)
+  2016b6:	0f b6 12             	movzbl (%rdx),%edx
+  2016b9:	88 10                	mov    %dl,(%rax)
+    while (start < end) {
+  2016bb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2016bf:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  2016c3:	72 d3                	jb     201698 <copy_comp+0x16>
+    }
+}
+  2016c5:	90                   	nop
+  2016c6:	90                   	nop
+  2016c7:	c9                   	leave
+  2016c8:	c3                   	ret
+
+00000000002016c9 <join_path>:
+
+
+void join_path(const char *abs_path, const char *path, char *dst) {
+  2016c9:	55                   	push   %rbp
+  2016ca:	48 89 e5             	mov    %rsp,%rbp
+  2016cd:	48 81 ec 68 02 00 00 	sub    $0x268,%rsp
+  2016d4:	48 89 bd a8 fd ff ff 	mov    %rdi,-0x258(%rbp)
+  2016db:	48 89 b5 a0 fd ff ff 	mov    %rsi,-0x260(%rbp)
+  2016e2:	48 89 95 98 fd ff ff 	mov    %rdx,-0x268(%rbp)
+    // If path is absolute, just copy it to dst (removing duplicate slashes, and trailing slash unless root)
+    if (path[0] == '/') {
+  2016e9:	48 8b 85 a0 fd ff ff 	mov    -0x260(%rbp),%rax
+  2016f0:	0f b6 00             	movzbl (%rax),%eax
+  2016f3:	3c 2f                	cmp    $0x2f,%al
+  2016f5:	0f 85 d6 00 00 00    	jne    2017d1 <join_path+0x108>
+        const char *src = path;
+  2016fb:	48 8b 85 a0 fd ff ff 	mov    -0x260(%rbp),%rax
+  201702:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+        char *d = dst;
+  201706:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  20170d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+        // Always start with a single slash
+        *d++ = '/';
+  201711:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  201715:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  201719:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  20171d:	c6 00 2f             	movb   $0x2f,(%rax)
+        src++;
+  201720:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+        int last_was_slash = 1;
+  201725:	c7 45 b0 01 00 00 00 	movl   $0x1,-0x50(%rbp)
+        while (*src) {
+  20172c:	eb 64                	jmp    201792 <join_path+0xc9>
+            if (*src == '/') {
+  20172e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  201732:	0f b6 00             	movzbl (%rax),%eax
+  201735:	3c 2f                	cmp    $0x2f,%al
+  201737:	75 35                	jne    20176e <join_path+0xa5>
+                // Skip consecutive slashes
+                while (*src == '/') src++;
+  201739:	eb 05                	jmp    201740 <join_path+0x77>
+  20173b:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  201740:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  201744:	0f b6 00             	movzbl (%rax),%eax
+  201747:	3c 2f                	cmp    $0x2f,%al
+  201749:	74 f0                	je     20173b <join_path+0x72>
+                if (*src == 0) break;
+  20174b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20174f:	0f b6 00             	movzbl (%rax),%eax
+  201752:	84 c0                	test   %al,%al
+  201754:	74 49                	je     20179f <join_path+0xd6>
+                *d++ = '/';
+  201756:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  20175a:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  20175e:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  201762:	c6 00 2f             	movb   $0x2f,(%rax)
+                last_was_slash = 1;
+  201765:	c7 45 b0 01 00 00 00 	movl   $0x1,-0x50(%rbp)
+  20176c:	eb 24                	jmp    201792 <join_path+0xc9>
+            } else {
+                *d++ = *src++;
+  20176e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  201772:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  201776:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  20177a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  20177e:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  201782:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  201786:	0f b6 12             	movzbl (%rdx),%edx
+  201789:	88 10                	mov    %dl,(%rax)
+                last_was_slash = 0;
+  20178b:	c7 45 b0 00 00 00 00 	movl   $0x0,-0x50(%rbp)
+        while (*src) {
+  201792:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  201796:	0f b6 00             	movzbl (%rax),%eax
+  201799:	84 c0                	test   %al,%al
+  20179b:	75 91                	jne    20172e <join_path+0x65>
+  20179d:	eb 01                	jmp    2017a0 <join_path+0xd7>
+                if (*src == 0) break;
+  20179f:	90                   	nop
+            }
+        }
+        // Remove trailing slash unless the path is just "/"
+        if (d > dst + 1 && *(d-1) == '/') {
+  2017a0:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  2017a7:	48 83 c0 01          	add    $0x1,%rax
+  2017ab:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  2017af:	73 14                	jae    2017c5 <join_path+0xfc>
+  2017b1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2017b5:	48 83 e8 01          	sub    $0x1,%rax
+  2017b9:	0f b6 00             	movzbl (%rax),%eax
+  2017bc:	3c 2f                	cmp    $0x2f,%al
+  2017be:	75 05                	jne    2017c5 <join_path+0xfc>
+            d--;
+  2017c0:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+        }
+        *d = 0;
+  2017c5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2017c9:	c6 00 00             	movb   $0x0,(%rax)
+  2017cc:	e9 e9 02 00 00       	jmp    201aba <join_path+0x3f1>
+        return;
+    }
+
+    // Otherwise, start with abs_path
+    const char *src = abs_path;
+  2017d1:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  2017d8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    char *d = dst;
+  2017dc:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  2017e3:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    if (*src != '/') {
+  2017e7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2017eb:	0f b6 00             	movzbl (%rax),%eax
+  2017ee:	3c 2f                	cmp    $0x2f,%al
+  2017f0:	74 2e                	je     201820 <join_path+0x157>
+        *d++ = '/';
+  2017f2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  2017f6:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  2017fa:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  2017fe:	c6 00 2f             	movb   $0x2f,(%rax)
+    }
+    while (*src) {
+  201801:	eb 1d                	jmp    201820 <join_path+0x157>
+        *d++ = *src++;
+  201803:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  201807:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  20180b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  20180f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  201813:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  201817:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  20181b:	0f b6 12             	movzbl (%rdx),%edx
+  20181e:	88 10                	mov    %dl,(%rax)
+    while (*src) {
+  201820:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201824:	0f b6 00             	movzbl (%rax),%eax
+  201827:	84 c0                	test   %al,%al
+  201829:	75 d8                	jne    201803 <join_path+0x13a>
+    }
+    // Remove trailing slash (unless root)
+    if (d > dst + 1 && *(d-1) == '/') {
+  20182b:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  201832:	48 83 c0 01          	add    $0x1,%rax
+  201836:	48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+  20183a:	73 14                	jae    201850 <join_path+0x187>
+  20183c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  201840:	48 83 e8 01          	sub    $0x1,%rax
+  201844:	0f b6 00             	movzbl (%rax),%eax
+  201847:	3c 2f                	cmp    $0x2f,%al
+  201849:	75 05                	jne    201850 <join_path+0x187>
+        d--;
+  20184b:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+    }
+    *d = 0;
+  201850:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  201854:	c6 00 00             	movb   $0x0,(%rax)
+
+    // Now, process path components
+    char temp[512];
+    int tlen = 0;
+  201857:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    // Copy dst to temp for easier manipulation
+    src = dst;
+  20185e:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  201865:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    while (*src && tlen < (int)sizeof(temp)-1) {
+  201869:	eb 22                	jmp    20188d <join_path+0x1c4>
+        temp[tlen++] = *src++;
+  20186b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20186f:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  201873:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  201877:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  20187a:	8d 4a 01             	lea    0x1(%rdx),%ecx
+  20187d:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  201880:	0f b6 08             	movzbl (%rax),%ecx
+  201883:	48 63 c2             	movslq %edx,%rax
+  201886:	88 8c 05 b0 fd ff ff 	mov    %cl,-0x250(%rbp,%rax,1)
+    while (*src && tlen < (int)sizeof(temp)-1) {
+  20188d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201891:	0f b6 00             	movzbl (%rax),%eax
+  201894:	84 c0                	test   %al,%al
+  201896:	74 09                	je     2018a1 <join_path+0x1d8>
+  201898:	81 7d dc fe 01 00 00 	cmpl   $0x1fe,-0x24(%rbp)
+  20189f:	7e ca                	jle    20186b <join_path+0x1a2>
+    }
+    temp[tlen] = 0;
+  2018a1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  2018a4:	48 98                	cltq
+  2018a6:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  2018ad:	00 
+
+    // Now, process each component in path
+    src = path;
+  2018ae:	48 8b 85 a0 fd ff ff 	mov    -0x260(%rbp),%rax
+  2018b5:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    while (*src) {
+  2018b9:	e9 65 01 00 00       	jmp    201a23 <join_path+0x35a>
+        // Skip slashes
+        while (*src == '/') src++;
+  2018be:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  2018c3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2018c7:	0f b6 00             	movzbl (%rax),%eax
+  2018ca:	3c 2f                	cmp    $0x2f,%al
+  2018cc:	74 f0                	je     2018be <join_path+0x1f5>
+        if (!*src) break;
+  2018ce:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2018d2:	0f b6 00             	movzbl (%rax),%eax
+  2018d5:	84 c0                	test   %al,%al
+  2018d7:	0f 84 57 01 00 00    	je     201a34 <join_path+0x36b>
+
+        // Find end of component
+        const char *comp_start = src;
+  2018dd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2018e1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        while (*src && *src != '/') src++;
+  2018e5:	eb 05                	jmp    2018ec <join_path+0x223>
+  2018e7:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  2018ec:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2018f0:	0f b6 00             	movzbl (%rax),%eax
+  2018f3:	84 c0                	test   %al,%al
+  2018f5:	74 0b                	je     201902 <join_path+0x239>
+  2018f7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2018fb:	0f b6 00             	movzbl (%rax),%eax
+  2018fe:	3c 2f                	cmp    $0x2f,%al
+  201900:	75 e5                	jne    2018e7 <join_path+0x21e>
+        const char *comp_end = src;
+  201902:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201906:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+
+        int comp_len = comp_end - comp_start;
+  20190a:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  20190e:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  201912:	89 45 b4             	mov    %eax,-0x4c(%rbp)
+
+        // Get component string
+        if (comp_len == 1 && comp_start[0] == '.') {
+  201915:	83 7d b4 01          	cmpl   $0x1,-0x4c(%rbp)
+  201919:	75 10                	jne    20192b <join_path+0x262>
+  20191b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  20191f:	0f b6 00             	movzbl (%rax),%eax
+  201922:	3c 2e                	cmp    $0x2e,%al
+  201924:	75 05                	jne    20192b <join_path+0x262>
+            // Ignore
+            continue;
+  201926:	e9 f8 00 00 00       	jmp    201a23 <join_path+0x35a>
+        } else if (comp_len == 2 && comp_start[0] == '.' && comp_start[1] == '.') {
+  20192b:	83 7d b4 02          	cmpl   $0x2,-0x4c(%rbp)
+  20192f:	75 6e                	jne    20199f <join_path+0x2d6>
+  201931:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  201935:	0f b6 00             	movzbl (%rax),%eax
+  201938:	3c 2e                	cmp    $0x2e,%al
+  20193a:	75 63                	jne    20199f <join_path+0x2d6>
+  20193c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  201940:	48 83 c0 01          	add    $0x1,%rax
+  201944:	0f b6 00             	movzbl (%rax),%eax
+  201947:	3c 2e                	cmp    $0x2e,%al
+  201949:	75 54                	jne    20199f <join_path+0x2d6>
+            // Go up one directory, unless at root
+            if (tlen > 1) {
+  20194b:	83 7d dc 01          	cmpl   $0x1,-0x24(%rbp)
+  20194f:	0f 8e ce 00 00 00    	jle    201a23 <join_path+0x35a>
+                // Remove trailing slash if any
+                if (temp[tlen-1] == '/') tlen--;
+  201955:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201958:	83 e8 01             	sub    $0x1,%eax
+  20195b:	48 98                	cltq
+  20195d:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  201964:	ff 
+  201965:	3c 2f                	cmp    $0x2f,%al
+  201967:	75 0a                	jne    201973 <join_path+0x2aa>
+  201969:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+                // Remove last component
+                while (tlen > 1 && temp[tlen-1] != '/') tlen--;
+  20196d:	eb 04                	jmp    201973 <join_path+0x2aa>
+  20196f:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  201973:	83 7d dc 01          	cmpl   $0x1,-0x24(%rbp)
+  201977:	7e 14                	jle    20198d <join_path+0x2c4>
+  201979:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  20197c:	83 e8 01             	sub    $0x1,%eax
+  20197f:	48 98                	cltq
+  201981:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  201988:	ff 
+  201989:	3c 2f                	cmp    $0x2f,%al
+  20198b:	75 e2                	jne    20196f <join_path+0x2a6>
+                temp[tlen] = 0;
+  20198d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201990:	48 98                	cltq
+  201992:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  201999:	00 
+            if (tlen > 1) {
+  20199a:	e9 84 00 00 00       	jmp    201a23 <join_path+0x35a>
+            }
+        } else if (comp_len > 0) {
+  20199f:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  2019a3:	7e 7e                	jle    201a23 <join_path+0x35a>
+            // Add slash if not at root
+            if (tlen == 0 || temp[tlen-1] != '/') {
+  2019a5:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  2019a9:	74 14                	je     2019bf <join_path+0x2f6>
+  2019ab:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  2019ae:	83 e8 01             	sub    $0x1,%eax
+  2019b1:	48 98                	cltq
+  2019b3:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  2019ba:	ff 
+  2019bb:	3c 2f                	cmp    $0x2f,%al
+  2019bd:	74 1c                	je     2019db <join_path+0x312>
+                if (tlen < (int)sizeof(temp)-1) temp[tlen++] = '/';
+  2019bf:	81 7d dc fe 01 00 00 	cmpl   $0x1fe,-0x24(%rbp)
+  2019c6:	7f 13                	jg     2019db <join_path+0x312>
+  2019c8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  2019cb:	8d 50 01             	lea    0x1(%rax),%edx
+  2019ce:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  2019d1:	48 98                	cltq
+  2019d3:	c6 84 05 b0 fd ff ff 	movb   $0x2f,-0x250(%rbp,%rax,1)
+  2019da:	2f 
+            }
+            // Copy component
+            for (const char *p = comp_start; p < comp_end && tlen < (int)sizeof(temp)-1; ++p) {
+  2019db:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  2019df:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  2019e3:	eb 1e                	jmp    201a03 <join_path+0x33a>
+                temp[tlen++] = *p;
+  2019e5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  2019e8:	8d 50 01             	lea    0x1(%rax),%edx
+  2019eb:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  2019ee:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  2019f2:	0f b6 12             	movzbl (%rdx),%edx
+  2019f5:	48 98                	cltq
+  2019f7:	88 94 05 b0 fd ff ff 	mov    %dl,-0x250(%rbp,%rax,1)
+            for (const char *p = comp_start; p < comp_end && tlen < (int)sizeof(temp)-1; ++p) {
+  2019fe:	48 83 45 d0 01       	addq   $0x1,-0x30(%rbp)
+  201a03:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  201a07:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  201a0b:	73 09                	jae    201a16 <join_path+0x34d>
+  201a0d:	81 7d dc fe 01 00 00 	cmpl   $0x1fe,-0x24(%rbp)
+  201a14:	7e cf                	jle    2019e5 <join_path+0x31c>
+            }
+            temp[tlen] = 0;
+  201a16:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201a19:	48 98                	cltq
+  201a1b:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  201a22:	00 
+    while (*src) {
+  201a23:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201a27:	0f b6 00             	movzbl (%rax),%eax
+  201a2a:	84 c0                	test   %al,%al
+  201a2c:	0f 85 91 fe ff ff    	jne    2018c3 <join_path+0x1fa>
+  201a32:	eb 01                	jmp    201a35 <join_path+0x36c>
+        if (!*src) break;
+  201a34:	90                   	nop
+        }
+    }
+
+    // If temp is empty, set to "/"
+    if (tlen == 0) {
+  201a35:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  201a39:	75 20                	jne    201a5b <join_path+0x392>
+        temp[tlen++] = '/';
+  201a3b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201a3e:	8d 50 01             	lea    0x1(%rax),%edx
+  201a41:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  201a44:	48 98                	cltq
+  201a46:	c6 84 05 b0 fd ff ff 	movb   $0x2f,-0x250(%rbp,%rax,1)
+  201a4d:	2f 
+        temp[tlen] = 0;
+  201a4e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201a51:	48 98                	cltq
+  201a53:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  201a5a:	00 
+    }
+
+    // Remove trailing slash unless the path is just "/"
+    if (tlen > 1 && temp[tlen-1] == '/') {
+  201a5b:	83 7d dc 01          	cmpl   $0x1,-0x24(%rbp)
+  201a5f:	7e 25                	jle    201a86 <join_path+0x3bd>
+  201a61:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201a64:	83 e8 01             	sub    $0x1,%eax
+  201a67:	48 98                	cltq
+  201a69:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  201a70:	ff 
+  201a71:	3c 2f                	cmp    $0x2f,%al
+  201a73:	75 11                	jne    201a86 <join_path+0x3bd>
+        temp[--tlen] = 0;
+  201a75:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  201a79:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201a7c:	48 98                	cltq
+  201a7e:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  201a85:	00 
+    }
+
+    // Copy temp to dst
+    for (int i = 0; i <= tlen; ++i) {
+  201a86:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  201a8d:	eb 23                	jmp    201ab2 <join_path+0x3e9>
+        dst[i] = temp[i];
+  201a8f:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  201a92:	48 63 d0             	movslq %eax,%rdx
+  201a95:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  201a9c:	48 01 c2             	add    %rax,%rdx
+  201a9f:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  201aa2:	48 98                	cltq
+  201aa4:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  201aab:	ff 
+  201aac:	88 02                	mov    %al,(%rdx)
+    for (int i = 0; i <= tlen; ++i) {
+  201aae:	83 45 cc 01          	addl   $0x1,-0x34(%rbp)
+  201ab2:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  201ab5:	3b 45 dc             	cmp    -0x24(%rbp),%eax
+  201ab8:	7e d5                	jle    201a8f <join_path+0x3c6>
+    }
+}
+  201aba:	c9                   	leave
+  201abb:	c3                   	ret
+
+0000000000201abc <app_printf>:
+#include "lib-malloc.h"
+#include "errno.h"
+// app_printf
+//     A version of console_printf that picks a sensible color by process ID.
+
+void app_printf(int colorid, const char* format, ...) {
+  201abc:	55                   	push   %rbp
+  201abd:	48 89 e5             	mov    %rsp,%rbp
+  201ac0:	48 83 ec 50          	sub    $0x50,%rsp
+  201ac4:	49 89 f2             	mov    %rsi,%r10
+  201ac7:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  201acb:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  201acf:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  201ad3:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    int color;
+    if (colorid < 0) {
+        color = 0x0700;
+  201ad7:	be 00 07 00 00       	mov    $0x700,%esi
+    if (colorid < 0) {
+  201adc:	85 ff                	test   %edi,%edi
+  201ade:	78 32                	js     201b12 <app_printf+0x56>
+    } else {
+        static const uint8_t col[] = { 0x0F, 0x0C, 0x0A, 0x09, 0x0E };
+        color = col[colorid % sizeof(col)] << 8;
+  201ae0:	48 63 ff             	movslq %edi,%rdi
+  201ae3:	48 ba cd cc cc cc cc 	movabs $0xcccccccccccccccd,%rdx
+  201aea:	cc cc cc 
+  201aed:	48 89 f8             	mov    %rdi,%rax
+  201af0:	48 f7 e2             	mul    %rdx
+  201af3:	48 89 d0             	mov    %rdx,%rax
+  201af6:	48 c1 e8 02          	shr    $0x2,%rax
+  201afa:	48 83 e2 fc          	and    $0xfffffffffffffffc,%rdx
+  201afe:	48 01 c2             	add    %rax,%rdx
+  201b01:	48 29 d7             	sub    %rdx,%rdi
+  201b04:	48 8d 05 2d 09 00 00 	lea    0x92d(%rip),%rax        # 202438 <col.0>
+  201b0b:	0f b6 34 38          	movzbl (%rax,%rdi,1),%esi
+  201b0f:	c1 e6 08             	shl    $0x8,%esi
+    }
+
+    va_list val;
+    va_start(val, format);
+  201b12:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  201b19:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  201b1d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  201b21:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  201b25:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    cursorpos = console_vprintf(cursorpos, color, format, val);
+  201b29:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  201b2d:	4c 89 d2             	mov    %r10,%rdx
+  201b30:	8b 3d c6 74 eb ff    	mov    -0x148b3a(%rip),%edi        # b8ffc <cursorpos>
+  201b36:	e8 24 f7 ff ff       	call   20125f <console_vprintf>
+  201b3b:	89 05 bb 74 eb ff    	mov    %eax,-0x148b45(%rip)        # b8ffc <cursorpos>
+    va_end(val);
+
+    /*if (CROW(cursorpos) >= 23) {
+        cursorpos = CPOS(0, 0);
+    }*/
+}
+  201b41:	c9                   	leave
+  201b42:	c3                   	ret
+
+0000000000201b43 <panic>:
+
+
+// panic, assert_fail
+//     Call the INT_SYS_PANIC system call so the kernel loops until Control-C.
+
+void panic(const char* format, ...) {
+  201b43:	55                   	push   %rbp
+  201b44:	48 89 e5             	mov    %rsp,%rbp
+  201b47:	53                   	push   %rbx
+  201b48:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  201b4f:	48 89 fb             	mov    %rdi,%rbx
+  201b52:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  201b56:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  201b5a:	48 89 4d d8          	mov    %rcx,-0x28(%rbp)
+  201b5e:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  201b62:	4c 89 4d e8          	mov    %r9,-0x18(%rbp)
+    va_list val;
+    va_start(val, format);
+  201b66:	c7 45 a8 08 00 00 00 	movl   $0x8,-0x58(%rbp)
+  201b6d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  201b71:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  201b75:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  201b79:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    char buf[160];
+    memcpy(buf, "PANIC: ", 7);
+  201b7d:	48 8d bd 08 ff ff ff 	lea    -0xf8(%rbp),%rdi
+  201b84:	ba 07 00 00 00       	mov    $0x7,%edx
+  201b89:	48 8d 35 e1 06 00 00 	lea    0x6e1(%rip),%rsi        # 202271 <lower_digits.0+0x11>
+  201b90:	e8 31 e5 ff ff       	call   2000c6 <memcpy>
+    int len = vsnprintf(&buf[7], sizeof(buf) - 7, format, val) + 7;
+  201b95:	48 8d 4d a8          	lea    -0x58(%rbp),%rcx
+  201b99:	48 8d bd 0f ff ff ff 	lea    -0xf1(%rbp),%rdi
+  201ba0:	48 89 da             	mov    %rbx,%rdx
+  201ba3:	be 99 00 00 00       	mov    $0x99,%esi
+  201ba8:	e8 cd f7 ff ff       	call   20137a <vsnprintf>
+  201bad:	8d 50 07             	lea    0x7(%rax),%edx
+    va_end(val);
+    if (len > 0 && buf[len - 1] != '\n') {
+  201bb0:	85 d2                	test   %edx,%edx
+  201bb2:	7e 0f                	jle    201bc3 <panic+0x80>
+  201bb4:	83 c0 06             	add    $0x6,%eax
+  201bb7:	48 98                	cltq
+  201bb9:	80 bc 05 08 ff ff ff 	cmpb   $0xa,-0xf8(%rbp,%rax,1)
+  201bc0:	0a 
+  201bc1:	75 30                	jne    201bf3 <panic+0xb0>
+        strcpy(buf + len - (len == (int) sizeof(buf) - 1), "\n");
+    }
+    (void) console_printf(CPOS(23, 0), 0xC000, "%s", buf);
+  201bc3:	48 8d 8d 08 ff ff ff 	lea    -0xf8(%rbp),%rcx
+  201bca:	48 8d 15 cf 04 00 00 	lea    0x4cf(%rip),%rdx        # 2020a0 <malloc+0x95>
+  201bd1:	be 00 c0 00 00       	mov    $0xc000,%esi
+  201bd6:	bf 30 07 00 00       	mov    $0x730,%edi
+  201bdb:	b8 00 00 00 00       	mov    $0x0,%eax
+  201be0:	e8 f5 f6 ff ff       	call   2012da <console_printf>
+    asm volatile ("syscall" : "=a" (rax)
+  201be5:	b8 30 00 00 00       	mov    $0x30,%eax
+  201bea:	bf 00 00 00 00       	mov    $0x0,%edi
+  201bef:	0f 05                	syscall
+ loop: goto loop;
+  201bf1:	eb fe                	jmp    201bf1 <panic+0xae>
+        strcpy(buf + len - (len == (int) sizeof(buf) - 1), "\n");
+  201bf3:	48 63 c2             	movslq %edx,%rax
+  201bf6:	81 fa 9f 00 00 00    	cmp    $0x9f,%edx
+  201bfc:	0f 94 c2             	sete   %dl
+  201bff:	0f b6 d2             	movzbl %dl,%edx
+  201c02:	48 29 d0             	sub    %rdx,%rax
+  201c05:	48 8d bc 05 08 ff ff 	lea    -0xf8(%rbp,%rax,1),%rdi
+  201c0c:	ff 
+  201c0d:	48 8d 35 3d 07 00 00 	lea    0x73d(%rip),%rsi        # 202351 <lower_digits.0+0xf1>
+  201c14:	e8 3b e8 ff ff       	call   200454 <strcpy>
+  201c19:	eb a8                	jmp    201bc3 <panic+0x80>
+
+0000000000201c1b <raise>:
+
+#define SIGABRT -1
+
+
+
+int raise(int sig) {
+  201c1b:	89 fe                	mov    %edi,%esi
+
+// getpid()
+//    Return current process ID, like sys_getpid().
+static inline pid_t getpid(void) {
+    return vdso()->pid;
+  201c1d:	8b 3c 25 00 10 24 00 	mov    0x241000,%edi
+    asm volatile ("syscall" : "=a" (result)
+  201c24:	b8 41 00 00 00       	mov    $0x41,%eax
+  201c29:	0f 05                	syscall
+    return sys_kill(getpid(), sig);
+}
+  201c2b:	c3                   	ret
+
+0000000000201c2c <abort>:
+    return vdso()->pid;
+  201c2c:	8b 3c 25 00 10 24 00 	mov    0x241000,%edi
+    asm volatile ("syscall" : "=a" (result)
+  201c33:	b8 41 00 00 00       	mov    $0x41,%eax
+  201c38:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  201c3d:	0f 05                	syscall
+
+void __attribute((noreturn)) abort(void) {
+    raise(SIGABRT);
+ spinloop: goto spinloop;       // should never get here
+  201c3f:	eb fe                	jmp    201c3f <abort+0x13>
+
+0000000000201c41 <assert_fail>:
+}
+
+
+void assert_fail(const char* file, int line, const char* msg) {
+  201c41:	55                   	push   %rbp
+  201c42:	48 89 e5             	mov    %rsp,%rbp
+  201c45:	48 89 f9             	mov    %rdi,%rcx
+  201c48:	41 89 f0             	mov    %esi,%r8d
+  201c4b:	49 89 d1             	mov    %rdx,%r9
+    (void) console_printf(CPOS(23, 0), 0xC000,
+  201c4e:	48 8d 15 03 07 00 00 	lea    0x703(%rip),%rdx        # 202358 <lower_digits.0+0xf8>
+  201c55:	be 00 c0 00 00       	mov    $0xc000,%esi
+  201c5a:	bf 30 07 00 00       	mov    $0x730,%edi
+  201c5f:	b8 00 00 00 00       	mov    $0x0,%eax
+  201c64:	e8 71 f6 ff ff       	call   2012da <console_printf>
+                          "PANIC: %s:%d: assertion '%s' failed\n",
+                          file, line, msg);
+    abort();
+  201c69:	e8 be ff ff ff       	call   201c2c <abort>
+
+0000000000201c6e <scan_char>:
+    asm volatile ("syscall" : "=a" (result)
+  201c6e:	bf 3a 00 00 00       	mov    $0x3a,%edi
+    asm volatile ("syscall" : "=a" (rax)
+  201c73:	be 3c 00 00 00       	mov    $0x3c,%esi
+    asm volatile ("syscall" : "=a" (result)
+  201c78:	89 f8                	mov    %edi,%eax
+  201c7a:	0f 05                	syscall
+  201c7c:	89 c2                	mov    %eax,%edx
+    asm volatile ("syscall" : "=a" (rax)
+  201c7e:	89 f0                	mov    %esi,%eax
+  201c80:	0f 05                	syscall
+    int c;
+
+    do {
+        c = sys_keybord();
+        sys_yield();
+    } while (c == -1);
+  201c82:	83 fa ff             	cmp    $0xffffffff,%edx
+  201c85:	74 f1                	je     201c78 <scan_char+0xa>
+
+    return c;
+  201c87:	89 d0                	mov    %edx,%eax
+}
+  201c89:	c3                   	ret
+
+0000000000201c8a <scan_line>:
+
+unsigned int scan_line(char* dst, unsigned int length_max) {
+  201c8a:	55                   	push   %rbp
+  201c8b:	48 89 e5             	mov    %rsp,%rbp
+  201c8e:	41 57                	push   %r15
+  201c90:	41 56                	push   %r14
+  201c92:	41 55                	push   %r13
+  201c94:	41 54                	push   %r12
+  201c96:	53                   	push   %rbx
+  201c97:	48 83 ec 08          	sub    $0x8,%rsp
+  201c9b:	49 89 fe             	mov    %rdi,%r14
+  201c9e:	41 89 f5             	mov    %esi,%r13d
+    unsigned int length = 0;
+  201ca1:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            app_printf(0, "%c", c);
+            dst[length] = '\0';
+            return length;
+        } else if (c >= 32 && c <= 127) {
+            if (length < length_max) {
+                app_printf(0, "%c", c);
+  201ca7:	4c 8d 3d cb 05 00 00 	lea    0x5cb(%rip),%r15        # 202279 <lower_digits.0+0x19>
+  201cae:	eb 05                	jmp    201cb5 <scan_line+0x2b>
+            if (length != 0) {
+  201cb0:	45 85 e4             	test   %r12d,%r12d
+  201cb3:	75 3e                	jne    201cf3 <scan_line+0x69>
+        unsigned char c = scan_char();
+  201cb5:	e8 b4 ff ff ff       	call   201c6e <scan_char>
+  201cba:	89 c3                	mov    %eax,%ebx
+        if (c == '\b') {
+  201cbc:	3c 08                	cmp    $0x8,%al
+  201cbe:	74 f0                	je     201cb0 <scan_line+0x26>
+        } else if (c == '\n') {
+  201cc0:	3c 0a                	cmp    $0xa,%al
+  201cc2:	74 4c                	je     201d10 <scan_line+0x86>
+        } else if (c >= 32 && c <= 127) {
+  201cc4:	8d 43 e0             	lea    -0x20(%rbx),%eax
+            if (length < length_max) {
+  201cc7:	3c 5f                	cmp    $0x5f,%al
+  201cc9:	77 ea                	ja     201cb5 <scan_line+0x2b>
+  201ccb:	45 39 ec             	cmp    %r13d,%r12d
+  201cce:	73 e5                	jae    201cb5 <scan_line+0x2b>
+                app_printf(0, "%c", c);
+  201cd0:	0f b6 d3             	movzbl %bl,%edx
+  201cd3:	4c 89 fe             	mov    %r15,%rsi
+  201cd6:	bf 00 00 00 00       	mov    $0x0,%edi
+  201cdb:	b8 00 00 00 00       	mov    $0x0,%eax
+  201ce0:	e8 d7 fd ff ff       	call   201abc <app_printf>
+                dst[length++] = c;
+  201ce5:	44 89 e0             	mov    %r12d,%eax
+  201ce8:	41 88 1c 06          	mov    %bl,(%r14,%rax,1)
+  201cec:	45 8d 64 24 01       	lea    0x1(%r12),%r12d
+  201cf1:	eb c2                	jmp    201cb5 <scan_line+0x2b>
+                app_printf(0, "%c", c);
+  201cf3:	ba 08 00 00 00       	mov    $0x8,%edx
+  201cf8:	4c 89 fe             	mov    %r15,%rsi
+  201cfb:	bf 00 00 00 00       	mov    $0x0,%edi
+  201d00:	b8 00 00 00 00       	mov    $0x0,%eax
+  201d05:	e8 b2 fd ff ff       	call   201abc <app_printf>
+                length--;
+  201d0a:	41 83 ec 01          	sub    $0x1,%r12d
+  201d0e:	eb a5                	jmp    201cb5 <scan_line+0x2b>
+            app_printf(0, "%c", c);
+  201d10:	ba 0a 00 00 00       	mov    $0xa,%edx
+  201d15:	48 8d 35 5d 05 00 00 	lea    0x55d(%rip),%rsi        # 202279 <lower_digits.0+0x19>
+  201d1c:	bf 00 00 00 00       	mov    $0x0,%edi
+  201d21:	b8 00 00 00 00       	mov    $0x0,%eax
+  201d26:	e8 91 fd ff ff       	call   201abc <app_printf>
+            dst[length] = '\0';
+  201d2b:	44 89 e0             	mov    %r12d,%eax
+  201d2e:	41 c6 04 06 00       	movb   $0x0,(%r14,%rax,1)
+            }
+        }
+    }
+}
+  201d33:	44 89 e0             	mov    %r12d,%eax
+  201d36:	48 83 c4 08          	add    $0x8,%rsp
+  201d3a:	5b                   	pop    %rbx
+  201d3b:	41 5c                	pop    %r12
+  201d3d:	41 5d                	pop    %r13
+  201d3f:	41 5e                	pop    %r14
+  201d41:	41 5f                	pop    %r15
+  201d43:	5d                   	pop    %rbp
+  201d44:	c3                   	ret
+
+0000000000201d45 <split_string>:
+
+
+char** split_string(char* str, char sep) {
+  201d45:	55                   	push   %rbp
+  201d46:	48 89 e5             	mov    %rsp,%rbp
+  201d49:	41 57                	push   %r15
+  201d4b:	41 56                	push   %r14
+  201d4d:	41 55                	push   %r13
+  201d4f:	41 54                	push   %r12
+  201d51:	53                   	push   %rbx
+  201d52:	48 83 ec 08          	sub    $0x8,%rsp
+    int s = 1;
+    int n = 0;
+
+    while (str[n]) {
+  201d56:	0f b6 07             	movzbl (%rdi),%eax
+  201d59:	84 c0                	test   %al,%al
+  201d5b:	0f 84 ad 00 00 00    	je     201e0e <split_string+0xc9>
+  201d61:	48 89 fb             	mov    %rdi,%rbx
+  201d64:	41 89 f4             	mov    %esi,%r12d
+  201d67:	41 be 01 00 00 00    	mov    $0x1,%r14d
+    int s = 1;
+  201d6d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  201d72:	eb 03                	jmp    201d77 <split_string+0x32>
+  201d74:	49 89 d6             	mov    %rdx,%r14
+        if (str[n] == sep)
+            s++;
+  201d77:	41 38 c4             	cmp    %al,%r12b
+  201d7a:	0f 94 c0             	sete   %al
+  201d7d:	0f b6 c0             	movzbl %al,%eax
+  201d80:	01 c1                	add    %eax,%ecx
+    while (str[n]) {
+  201d82:	49 8d 56 01          	lea    0x1(%r14),%rdx
+  201d86:	0f b6 44 13 ff       	movzbl -0x1(%rbx,%rdx,1),%eax
+  201d8b:	84 c0                	test   %al,%al
+  201d8d:	75 e5                	jne    201d74 <split_string+0x2f>
+        n++;
+    }
+    
+    char** part = malloc((s+1)*sizeof(char*));
+  201d8f:	44 8d 79 01          	lea    0x1(%rcx),%r15d
+  201d93:	4d 63 ff             	movslq %r15d,%r15
+  201d96:	49 c1 e7 03          	shl    $0x3,%r15
+  201d9a:	4c 89 ff             	mov    %r15,%rdi
+  201d9d:	e8 69 02 00 00       	call   20200b <malloc>
+  201da2:	49 89 c5             	mov    %rax,%r13
+    char* buffer = malloc(n+1);
+  201da5:	41 8d 7e 01          	lea    0x1(%r14),%edi
+  201da9:	48 63 ff             	movslq %edi,%rdi
+  201dac:	e8 5a 02 00 00       	call   20200b <malloc>
+
+    int word_n = 0;
+    part[0] = buffer;
+  201db1:	49 89 45 00          	mov    %rax,0x0(%r13)
+    part[s] = NULL;
+  201db5:	4b c7 44 3d f8 00 00 	movq   $0x0,-0x8(%r13,%r15,1)
+  201dbc:	00 00 
+    buffer[n] = 0;
+  201dbe:	42 c6 04 30 00       	movb   $0x0,(%rax,%r14,1)
+
+    for (int i = 0; i < n; i++) {
+  201dc3:	45 85 f6             	test   %r14d,%r14d
+  201dc6:	7e 6c                	jle    201e34 <split_string+0xef>
+  201dc8:	41 83 ee 01          	sub    $0x1,%r14d
+  201dcc:	48 89 da             	mov    %rbx,%rdx
+  201dcf:	48 83 c0 01          	add    $0x1,%rax
+  201dd3:	48 89 c1             	mov    %rax,%rcx
+    int word_n = 0;
+  201dd6:	bf 00 00 00 00       	mov    $0x0,%edi
+  201ddb:	eb 23                	jmp    201e00 <split_string+0xbb>
+        if (str[i] == sep) {
+            buffer[i] = 0;
+  201ddd:	c6 41 ff 00          	movb   $0x0,-0x1(%rcx)
+            part[++word_n] = &buffer[i+1];
+  201de1:	83 c7 01             	add    $0x1,%edi
+  201de4:	48 63 f7             	movslq %edi,%rsi
+  201de7:	49 89 4c f5 00       	mov    %rcx,0x0(%r13,%rsi,8)
+    for (int i = 0; i < n; i++) {
+  201dec:	48 83 c2 01          	add    $0x1,%rdx
+  201df0:	48 83 c1 01          	add    $0x1,%rcx
+  201df4:	89 ce                	mov    %ecx,%esi
+  201df6:	29 c6                	sub    %eax,%esi
+  201df8:	83 ee 01             	sub    $0x1,%esi
+  201dfb:	44 39 f6             	cmp    %r14d,%esi
+  201dfe:	7d 34                	jge    201e34 <split_string+0xef>
+        if (str[i] == sep) {
+  201e00:	0f b6 32             	movzbl (%rdx),%esi
+  201e03:	44 38 e6             	cmp    %r12b,%sil
+  201e06:	74 d5                	je     201ddd <split_string+0x98>
+        } else {
+            buffer[i] = str[i];
+  201e08:	40 88 71 ff          	mov    %sil,-0x1(%rcx)
+  201e0c:	eb de                	jmp    201dec <split_string+0xa7>
+    char** part = malloc((s+1)*sizeof(char*));
+  201e0e:	bf 10 00 00 00       	mov    $0x10,%edi
+  201e13:	e8 f3 01 00 00       	call   20200b <malloc>
+  201e18:	49 89 c5             	mov    %rax,%r13
+    char* buffer = malloc(n+1);
+  201e1b:	bf 01 00 00 00       	mov    $0x1,%edi
+  201e20:	e8 e6 01 00 00       	call   20200b <malloc>
+    part[0] = buffer;
+  201e25:	49 89 45 00          	mov    %rax,0x0(%r13)
+    part[s] = NULL;
+  201e29:	49 c7 45 08 00 00 00 	movq   $0x0,0x8(%r13)
+  201e30:	00 
+    buffer[n] = 0;
+  201e31:	c6 00 00             	movb   $0x0,(%rax)
+        }
+    }
+
+    return part;
+}
+  201e34:	4c 89 e8             	mov    %r13,%rax
+  201e37:	48 83 c4 08          	add    $0x8,%rsp
+  201e3b:	5b                   	pop    %rbx
+  201e3c:	41 5c                	pop    %r12
+  201e3e:	41 5d                	pop    %r13
+  201e40:	41 5e                	pop    %r14
+  201e42:	41 5f                	pop    %r15
+  201e44:	5d                   	pop    %rbp
+  201e45:	c3                   	ret
+
+0000000000201e46 <app_print_error>:
+
+
+void app_print_error(int r) {
+  201e46:	55                   	push   %rbp
+  201e47:	48 89 e5             	mov    %rsp,%rbp
+    switch (r) {
+  201e4a:	83 ff 24             	cmp    $0x24,%edi
+  201e4d:	0f 87 79 01 00 00    	ja     201fcc <app_print_error+0x186>
+  201e53:	89 f8                	mov    %edi,%eax
+  201e55:	48 8d 15 48 05 00 00 	lea    0x548(%rip),%rdx        # 2023a4 <lower_digits.0+0x144>
+  201e5c:	48 63 04 82          	movslq (%rdx,%rax,4),%rax
+  201e60:	48 01 d0             	add    %rdx,%rax
+  201e63:	ff e0                	jmp    *%rax
+        case ENOENT:
+            app_printf(1, "Error: %s\n", "No such file or directory");
+  201e65:	48 8d 15 10 04 00 00 	lea    0x410(%rip),%rdx        # 20227c <lower_digits.0+0x1c>
+  201e6c:	48 8d 35 23 04 00 00 	lea    0x423(%rip),%rsi        # 202296 <lower_digits.0+0x36>
+  201e73:	bf 01 00 00 00       	mov    $0x1,%edi
+  201e78:	b8 00 00 00 00       	mov    $0x0,%eax
+  201e7d:	e8 3a fc ff ff       	call   201abc <app_printf>
+            break;
+        default:
+            app_printf(1, "Error %d: %s\n", r, "Unknown error");
+            break;
+    }
+}
+  201e82:	5d                   	pop    %rbp
+  201e83:	c3                   	ret
+            app_printf(1, "Error: %s\n", "I/O error");
+  201e84:	48 8d 15 16 04 00 00 	lea    0x416(%rip),%rdx        # 2022a1 <lower_digits.0+0x41>
+  201e8b:	48 8d 35 04 04 00 00 	lea    0x404(%rip),%rsi        # 202296 <lower_digits.0+0x36>
+  201e92:	bf 01 00 00 00       	mov    $0x1,%edi
+  201e97:	b8 00 00 00 00       	mov    $0x0,%eax
+  201e9c:	e8 1b fc ff ff       	call   201abc <app_printf>
+            break;
+  201ea1:	eb df                	jmp    201e82 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Exec format error");
+  201ea3:	48 8d 15 01 04 00 00 	lea    0x401(%rip),%rdx        # 2022ab <lower_digits.0+0x4b>
+  201eaa:	48 8d 35 e5 03 00 00 	lea    0x3e5(%rip),%rsi        # 202296 <lower_digits.0+0x36>
+  201eb1:	bf 01 00 00 00       	mov    $0x1,%edi
+  201eb6:	b8 00 00 00 00       	mov    $0x0,%eax
+  201ebb:	e8 fc fb ff ff       	call   201abc <app_printf>
+            break;
+  201ec0:	eb c0                	jmp    201e82 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Resource temporarily unavailable");
+  201ec2:	48 8d 15 b7 04 00 00 	lea    0x4b7(%rip),%rdx        # 202380 <lower_digits.0+0x120>
+  201ec9:	48 8d 35 c6 03 00 00 	lea    0x3c6(%rip),%rsi        # 202296 <lower_digits.0+0x36>
+  201ed0:	bf 01 00 00 00       	mov    $0x1,%edi
+  201ed5:	b8 00 00 00 00       	mov    $0x0,%eax
+  201eda:	e8 dd fb ff ff       	call   201abc <app_printf>
+            break;
+  201edf:	eb a1                	jmp    201e82 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Out of memory");
+  201ee1:	48 8d 15 d5 03 00 00 	lea    0x3d5(%rip),%rdx        # 2022bd <lower_digits.0+0x5d>
+  201ee8:	48 8d 35 a7 03 00 00 	lea    0x3a7(%rip),%rsi        # 202296 <lower_digits.0+0x36>
+  201eef:	bf 01 00 00 00       	mov    $0x1,%edi
+  201ef4:	b8 00 00 00 00       	mov    $0x0,%eax
+  201ef9:	e8 be fb ff ff       	call   201abc <app_printf>
+            break;
+  201efe:	eb 82                	jmp    201e82 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Bad address");
+  201f00:	48 8d 15 c4 03 00 00 	lea    0x3c4(%rip),%rdx        # 2022cb <lower_digits.0+0x6b>
+  201f07:	48 8d 35 88 03 00 00 	lea    0x388(%rip),%rsi        # 202296 <lower_digits.0+0x36>
+  201f0e:	bf 01 00 00 00       	mov    $0x1,%edi
+  201f13:	b8 00 00 00 00       	mov    $0x0,%eax
+  201f18:	e8 9f fb ff ff       	call   201abc <app_printf>
+            break;
+  201f1d:	e9 60 ff ff ff       	jmp    201e82 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Not a directory");
+  201f22:	48 8d 15 ae 03 00 00 	lea    0x3ae(%rip),%rdx        # 2022d7 <lower_digits.0+0x77>
+  201f29:	48 8d 35 66 03 00 00 	lea    0x366(%rip),%rsi        # 202296 <lower_digits.0+0x36>
+  201f30:	bf 01 00 00 00       	mov    $0x1,%edi
+  201f35:	b8 00 00 00 00       	mov    $0x0,%eax
+  201f3a:	e8 7d fb ff ff       	call   201abc <app_printf>
+            break;
+  201f3f:	e9 3e ff ff ff       	jmp    201e82 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Invalid argument");
+  201f44:	48 8d 15 9c 03 00 00 	lea    0x39c(%rip),%rdx        # 2022e7 <lower_digits.0+0x87>
+  201f4b:	48 8d 35 44 03 00 00 	lea    0x344(%rip),%rsi        # 202296 <lower_digits.0+0x36>
+  201f52:	bf 01 00 00 00       	mov    $0x1,%edi
+  201f57:	b8 00 00 00 00       	mov    $0x0,%eax
+  201f5c:	e8 5b fb ff ff       	call   201abc <app_printf>
+            break;
+  201f61:	e9 1c ff ff ff       	jmp    201e82 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "No space left on device");
+  201f66:	48 8d 15 8b 03 00 00 	lea    0x38b(%rip),%rdx        # 2022f8 <lower_digits.0+0x98>
+  201f6d:	48 8d 35 22 03 00 00 	lea    0x322(%rip),%rsi        # 202296 <lower_digits.0+0x36>
+  201f74:	bf 01 00 00 00       	mov    $0x1,%edi
+  201f79:	b8 00 00 00 00       	mov    $0x0,%eax
+  201f7e:	e8 39 fb ff ff       	call   201abc <app_printf>
+            break;
+  201f83:	e9 fa fe ff ff       	jmp    201e82 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "File already exists");
+  201f88:	48 8d 15 81 03 00 00 	lea    0x381(%rip),%rdx        # 202310 <lower_digits.0+0xb0>
+  201f8f:	48 8d 35 00 03 00 00 	lea    0x300(%rip),%rsi        # 202296 <lower_digits.0+0x36>
+  201f96:	bf 01 00 00 00       	mov    $0x1,%edi
+  201f9b:	b8 00 00 00 00       	mov    $0x0,%eax
+  201fa0:	e8 17 fb ff ff       	call   201abc <app_printf>
+            break;
+  201fa5:	e9 d8 fe ff ff       	jmp    201e82 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "File name too long");
+  201faa:	48 8d 15 73 03 00 00 	lea    0x373(%rip),%rdx        # 202324 <lower_digits.0+0xc4>
+  201fb1:	48 8d 35 de 02 00 00 	lea    0x2de(%rip),%rsi        # 202296 <lower_digits.0+0x36>
+  201fb8:	bf 01 00 00 00       	mov    $0x1,%edi
+  201fbd:	b8 00 00 00 00       	mov    $0x0,%eax
+  201fc2:	e8 f5 fa ff ff       	call   201abc <app_printf>
+            break;
+  201fc7:	e9 b6 fe ff ff       	jmp    201e82 <app_print_error+0x3c>
+            app_printf(1, "Error %d: %s\n", r, "Unknown error");
+  201fcc:	48 8d 0d 64 03 00 00 	lea    0x364(%rip),%rcx        # 202337 <lower_digits.0+0xd7>
+  201fd3:	89 fa                	mov    %edi,%edx
+  201fd5:	48 8d 35 69 03 00 00 	lea    0x369(%rip),%rsi        # 202345 <lower_digits.0+0xe5>
+  201fdc:	bf 01 00 00 00       	mov    $0x1,%edi
+  201fe1:	b8 00 00 00 00       	mov    $0x0,%eax
+  201fe6:	e8 d1 fa ff ff       	call   201abc <app_printf>
+}
+  201feb:	e9 92 fe ff ff       	jmp    201e82 <app_print_error+0x3c>
+
+0000000000201ff0 <handle_error>:
+
+__attribute__((noreturn)) void handle_error(int r) {
+  201ff0:	55                   	push   %rbp
+  201ff1:	48 89 e5             	mov    %rsp,%rbp
+  201ff4:	53                   	push   %rbx
+  201ff5:	48 83 ec 08          	sub    $0x8,%rsp
+  201ff9:	89 fb                	mov    %edi,%ebx
+    app_print_error(r);
+  201ffb:	e8 46 fe ff ff       	call   201e46 <app_print_error>
+    asm volatile ("syscall" : "=a" (rax)
+  202000:	b8 40 00 00 00       	mov    $0x40,%eax
+  202005:	89 df                	mov    %ebx,%edi
+  202007:	0f 05                	syscall
+ spinloop: goto spinloop;       // should never get here
+  202009:	eb fe                	jmp    202009 <handle_error+0x19>
+
+000000000020200b <malloc>:
+
+// The heap starts 1MB above the program image (PROC_START_ADDR)
+static uint8_t* heap_top = (uint8_t*) 0x300000;
+static uint8_t* page_top = (uint8_t*) 0x300000;
+
+void* malloc(size_t size) {
+  20200b:	48 89 fe             	mov    %rdi,%rsi
+    while (ROUNDDOWN(heap_top + size, PAGESIZE) >= page_top) {
+  20200e:	48 8b 05 fb 0f 00 00 	mov    0xffb(%rip),%rax        # 203010 <heap_top>
+  202015:	48 8d 14 38          	lea    (%rax,%rdi,1),%rdx
+  202019:	48 8b 3d e8 0f 00 00 	mov    0xfe8(%rip),%rdi        # 203008 <page_top>
+  202020:	48 89 d1             	mov    %rdx,%rcx
+  202023:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  20202a:	48 39 f9             	cmp    %rdi,%rcx
+  20202d:	72 3e                	jb     20206d <malloc+0x62>
+    asm volatile ("syscall" : "=a" (result)
+  20202f:	41 b8 3b 00 00 00    	mov    $0x3b,%r8d
+  202035:	44 89 c0             	mov    %r8d,%eax
+  202038:	0f 05                	syscall
+        int r = sys_page_alloc(page_top);
+        assert(r >= 0);
+  20203a:	85 c0                	test   %eax,%eax
+  20203c:	78 37                	js     202075 <malloc+0x6a>
+        page_top += PAGESIZE;
+  20203e:	48 8b 05 c3 0f 00 00 	mov    0xfc3(%rip),%rax        # 203008 <page_top>
+  202045:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  20204c:	48 89 3d b5 0f 00 00 	mov    %rdi,0xfb5(%rip)        # 203008 <page_top>
+    while (ROUNDDOWN(heap_top + size, PAGESIZE) >= page_top) {
+  202053:	48 8b 05 b6 0f 00 00 	mov    0xfb6(%rip),%rax        # 203010 <heap_top>
+  20205a:	48 8d 14 30          	lea    (%rax,%rsi,1),%rdx
+  20205e:	48 89 d1             	mov    %rdx,%rcx
+  202061:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  202068:	48 39 f9             	cmp    %rdi,%rcx
+  20206b:	73 c8                	jae    202035 <malloc+0x2a>
+    }
+
+    void* addr = heap_top;
+    heap_top += size;
+  20206d:	48 89 15 9c 0f 00 00 	mov    %rdx,0xf9c(%rip)        # 203010 <heap_top>
+    return addr;
+}
+  202074:	c3                   	ret
+void* malloc(size_t size) {
+  202075:	55                   	push   %rbp
+  202076:	48 89 e5             	mov    %rsp,%rbp
+        assert(r >= 0);
+  202079:	48 8d 15 bd 03 00 00 	lea    0x3bd(%rip),%rdx        # 20243d <col.0+0x5>
+  202080:	be 0b 00 00 00       	mov    $0xb,%esi
+  202085:	48 8d 3d b8 03 00 00 	lea    0x3b8(%rip),%rdi        # 202444 <col.0+0xc>
+  20208c:	e8 b0 fb ff ff       	call   201c41 <assert_fail>
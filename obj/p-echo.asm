@@ -0,0 +1,3272 @@
+
+obj/p-echo.full:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000200000 <process_main>:
+#include "process.h"
+
+void process_main(int argc, char* argv[]) {
+  200000:	55                   	push   %rbp
+  200001:	48 89 e5             	mov    %rsp,%rbp
+  200004:	41 55                	push   %r13
+  200006:	41 54                	push   %r12
+  200008:	53                   	push   %rbx
+  200009:	48 83 ec 08          	sub    $0x8,%rsp
+
+    for (int i = 1; i < argc; i++) {
+  20000d:	83 ff 01             	cmp    $0x1,%edi
+  200010:	7e 31                	jle    200043 <process_main+0x43>
+  200012:	48 8d 5e 08          	lea    0x8(%rsi),%rbx
+  200016:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  200019:	4c 8d 6c c6 10       	lea    0x10(%rsi,%rax,8),%r13
+        app_printf(0, "%s ", argv[i]);
+  20001e:	4c 8d 25 1b 20 00 00 	lea    0x201b(%rip),%r12        # 202040 <malloc+0x95>
+  200025:	48 8b 13             	mov    (%rbx),%rdx
+  200028:	4c 89 e6             	mov    %r12,%rsi
+  20002b:	bf 00 00 00 00       	mov    $0x0,%edi
+  200030:	b8 00 00 00 00       	mov    $0x0,%eax
+  200035:	e8 22 1a 00 00       	call   201a5c <app_printf>
+    for (int i = 1; i < argc; i++) {
+  20003a:	48 83 c3 08          	add    $0x8,%rbx
+  20003e:	4c 39 eb             	cmp    %r13,%rbx
+  200041:	75 e2                	jne    200025 <process_main+0x25>
+    }
+
+    assert(0);
+  200043:	48 8d 15 68 23 00 00 	lea    0x2368(%rip),%rdx        # 2023b2 <col.0+0xa>
+  20004a:	be 09 00 00 00       	mov    $0x9,%esi
+  20004f:	48 8d 3d ee 1f 00 00 	lea    0x1fee(%rip),%rdi        # 202044 <malloc+0x99>
+  200056:	e8 86 1b 00 00       	call   201be1 <assert_fail>
+
+000000000020005b <vdso>:
+// KERNEL DATA PAGE
+//
+//    The kernel keeps a read-only vdso_data (see lib.h) up to date at
+//    VDSO_ADDR. Reading it is a plain memory load, not a system call.
+
+static inline const volatile vdso_data* vdso(void) {
+  20005b:	55                   	push   %rbp
+  20005c:	48 89 e5             	mov    %rsp,%rbp
+    return (const volatile vdso_data*) VDSO_ADDR;
+  20005f:	b8 00 10 24 00       	mov    $0x241000,%eax
+}
+  200064:	5d                   	pop    %rbp
+  200065:	c3                   	ret
+
+0000000000200066 <memcpy>:
+#define MEMOP_WORD_MIN 64
+
+// an unaligned word that may alias any object
+typedef uint64_t __attribute__((may_alias, aligned(1))) memop_word;
+
+void* memcpy(void* dst, const void* src, size_t n) {
+  200066:	55                   	push   %rbp
+  200067:	48 89 e5             	mov    %rsp,%rbp
+  20006a:	48 83 ec 48          	sub    $0x48,%rsp
+  20006e:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  200072:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  200076:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+    char* d = (char*) dst;
+  20007a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  20007e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    const char* s = (const char*) src;
+  200082:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  200086:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (n >= MEMOP_WORD_MIN) {
+  20008a:	48 83 7d b8 3f       	cmpq   $0x3f,-0x48(%rbp)
+  20008f:	0f 86 c5 00 00 00    	jbe    20015a <memcpy+0xf4>
+        size_t head = -(uintptr_t) d & 7;
+  200095:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200099:	48 f7 d8             	neg    %rax
+  20009c:	83 e0 07             	and    $0x7,%eax
+  20009f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        size_t words = (n - head) / 8;
+  2000a3:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  2000a7:	48 2b 45 e8          	sub    -0x18(%rbp),%rax
+  2000ab:	48 c1 e8 03          	shr    $0x3,%rax
+  2000af:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+        n = (n - head) % 8;
+  2000b3:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  2000b7:	48 2b 45 e8          	sub    -0x18(%rbp),%rax
+  2000bb:	83 e0 07             	and    $0x7,%eax
+  2000be:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        asm volatile("rep movsb" : "+D" (d), "+S" (s), "+c" (head)
+  2000c2:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  2000c6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  2000ca:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2000ce:	48 89 cf             	mov    %rcx,%rdi
+  2000d1:	48 89 d6             	mov    %rdx,%rsi
+  2000d4:	48 89 c1             	mov    %rax,%rcx
+  2000d7:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  2000d9:	48 89 c8             	mov    %rcx,%rax
+  2000dc:	48 89 f2             	mov    %rsi,%rdx
+  2000df:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  2000e3:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  2000e7:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                     : : "memory");
+        asm volatile("rep movsq" : "+D" (d), "+S" (s), "+c" (words)
+  2000eb:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  2000ef:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  2000f3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  2000f7:	48 89 cf             	mov    %rcx,%rdi
+  2000fa:	48 89 d6             	mov    %rdx,%rsi
+  2000fd:	48 89 c1             	mov    %rax,%rcx
+  200100:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  200103:	48 89 c8             	mov    %rcx,%rax
+  200106:	48 89 f2             	mov    %rsi,%rdx
+  200109:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  20010d:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  200111:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+                     : : "memory");
+    }
+    for (; n >= 16; n -= 16, s += 16, d += 16) {
+  200115:	eb 43                	jmp    20015a <memcpy+0xf4>
+        memop_word a = ((const memop_word*) s)[0];
+  200117:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  20011b:	48 8b 00             	mov    (%rax),%rax
+  20011e:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+        memop_word b = ((const memop_word*) s)[1];
+  200122:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  200126:	48 83 c0 08          	add    $0x8,%rax
+  20012a:	48 8b 00             	mov    (%rax),%rax
+  20012d:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+        ((memop_word*) d)[0] = a;
+  200131:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200135:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  200139:	48 89 10             	mov    %rdx,(%rax)
+        ((memop_word*) d)[1] = b;
+  20013c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200140:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  200144:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  200148:	48 89 02             	mov    %rax,(%rdx)
+    for (; n >= 16; n -= 16, s += 16, d += 16) {
+  20014b:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  200150:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  200155:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  20015a:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  20015f:	77 b6                	ja     200117 <memcpy+0xb1>
+    }
+    for (; n > 0; --n, ++s, ++d) {
+  200161:	eb 1c                	jmp    20017f <memcpy+0x119>
+        *d = *s;
+  200163:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  200167:	0f b6 10             	movzbl (%rax),%edx
+  20016a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20016e:	88 10                	mov    %dl,(%rax)
+    for (; n > 0; --n, ++s, ++d) {
+  200170:	48 83 6d b8 01       	subq   $0x1,-0x48(%rbp)
+  200175:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  20017a:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  20017f:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  200184:	75 dd                	jne    200163 <memcpy+0xfd>
+    }
+    return dst;
+  200186:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  20018a:	c9                   	leave
+  20018b:	c3                   	ret
+
+000000000020018c <memmove>:
+
+void* memmove(void* dst, const void* src, size_t n) {
+  20018c:	55                   	push   %rbp
+  20018d:	48 89 e5             	mov    %rsp,%rbp
+  200190:	48 83 ec 38          	sub    $0x38,%rsp
+  200194:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  200198:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  20019c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    const char* s = (const char*) src;
+  2001a0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  2001a4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    char* d = (char*) dst;
+  2001a8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  2001ac:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (!(s < d && s + n > d)) {
+  2001b0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2001b4:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  2001b8:	73 11                	jae    2001cb <memmove+0x3f>
+  2001ba:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  2001be:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  2001c2:	48 01 d0             	add    %rdx,%rax
+  2001c5:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  2001c9:	72 1c                	jb     2001e7 <memmove+0x5b>
+        // a forward copy never overwrites source bytes it has yet to read
+        return memcpy(dst, src, n);
+  2001cb:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  2001cf:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  2001d3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  2001d7:	48 89 ce             	mov    %rcx,%rsi
+  2001da:	48 89 c7             	mov    %rax,%rdi
+  2001dd:	e8 84 fe ff ff       	call   200066 <memcpy>
+  2001e2:	e9 94 00 00 00       	jmp    20027b <memmove+0xef>
+    }
+
+    // copy backwards: the tail bytes, then words down to the start
+    size_t words = n / 8;
+  2001e7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  2001eb:	48 c1 e8 03          	shr    $0x3,%rax
+  2001ef:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    size_t tail = n % 8;
+  2001f3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  2001f7:	83 e0 07             	and    $0x7,%eax
+  2001fa:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    s += n - 1, d += n - 1;
+  2001fe:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200202:	48 83 e8 01          	sub    $0x1,%rax
+  200206:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  20020a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  20020e:	48 83 e8 01          	sub    $0x1,%rax
+  200212:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    asm volatile("std; rep movsb; cld" : "+D" (d), "+S" (s), "+c" (tail)
+  200216:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  20021a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  20021e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  200222:	48 89 cf             	mov    %rcx,%rdi
+  200225:	48 89 d6             	mov    %rdx,%rsi
+  200228:	48 89 c1             	mov    %rax,%rcx
+  20022b:	fd                   	std
+  20022c:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  20022e:	fc                   	cld
+  20022f:	48 89 c8             	mov    %rcx,%rax
+  200232:	48 89 f2             	mov    %rsi,%rdx
+  200235:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  200239:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  20023d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+                 : : "memory", "cc");
+    s -= 7, d -= 7;
+  200241:	48 83 6d f8 07       	subq   $0x7,-0x8(%rbp)
+  200246:	48 83 6d f0 07       	subq   $0x7,-0x10(%rbp)
+    asm volatile("std; rep movsq; cld" : "+D" (d), "+S" (s), "+c" (words)
+  20024b:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  20024f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  200253:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  200257:	48 89 cf             	mov    %rcx,%rdi
+  20025a:	48 89 d6             	mov    %rdx,%rsi
+  20025d:	48 89 c1             	mov    %rax,%rcx
+  200260:	fd                   	std
+  200261:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  200264:	fc                   	cld
+  200265:	48 89 c8             	mov    %rcx,%rax
+  200268:	48 89 f2             	mov    %rsi,%rdx
+  20026b:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  20026f:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  200273:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 : : "memory", "cc");
+    return dst;
+  200277:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  20027b:	c9                   	leave
+  20027c:	c3                   	ret
+
+000000000020027d <memset>:
+
+void* memset(void* v, int c, size_t n) {
+  20027d:	55                   	push   %rbp
+  20027e:	48 89 e5             	mov    %rsp,%rbp
+  200281:	48 83 ec 38          	sub    $0x38,%rsp
+  200285:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  200289:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  20028c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    char* p = (char*) v;
+  200290:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  200294:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    uint64_t word = (uint8_t) c * 0x0101010101010101UL;
+  200298:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  20029b:	0f b6 c0             	movzbl %al,%eax
+  20029e:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  2002a5:	01 01 01 
+  2002a8:	48 0f af c2          	imul   %rdx,%rax
+  2002ac:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (n >= MEMOP_WORD_MIN) {
+  2002b0:	48 83 7d c8 3f       	cmpq   $0x3f,-0x38(%rbp)
+  2002b5:	0f 86 9e 00 00 00    	jbe    200359 <memset+0xdc>
+        size_t head = -(uintptr_t) p & 7;
+  2002bb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2002bf:	48 f7 d8             	neg    %rax
+  2002c2:	83 e0 07             	and    $0x7,%eax
+  2002c5:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        size_t words = (n - head) / 8;
+  2002c9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  2002cd:	48 2b 45 e8          	sub    -0x18(%rbp),%rax
+  2002d1:	48 c1 e8 03          	shr    $0x3,%rax
+  2002d5:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+        n = (n - head) % 8;
+  2002d9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  2002dd:	48 2b 45 e8          	sub    -0x18(%rbp),%rax
+  2002e1:	83 e0 07             	and    $0x7,%eax
+  2002e4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        asm volatile("rep stosb" : "+D" (p), "+c" (head) : "a" (word)
+  2002e8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2002ec:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  2002f0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  2002f4:	48 89 ce             	mov    %rcx,%rsi
+  2002f7:	48 89 f7             	mov    %rsi,%rdi
+  2002fa:	48 89 d1             	mov    %rdx,%rcx
+  2002fd:	f3 aa                	rep stos %al,%es:(%rdi)
+  2002ff:	48 89 ca             	mov    %rcx,%rdx
+  200302:	48 89 fe             	mov    %rdi,%rsi
+  200305:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  200309:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+                     : "memory");
+        asm volatile("rep stosq" : "+D" (p), "+c" (words) : "a" (word)
+  20030d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  200311:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  200315:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  200319:	48 89 ce             	mov    %rcx,%rsi
+  20031c:	48 89 f7             	mov    %rsi,%rdi
+  20031f:	48 89 d1             	mov    %rdx,%rcx
+  200322:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  200325:	48 89 ca             	mov    %rcx,%rdx
+  200328:	48 89 fe             	mov    %rdi,%rsi
+  20032b:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  20032f:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+                     : "memory");
+    }
+    for (; n >= 16; n -= 16, p += 16) {
+  200333:	eb 24                	jmp    200359 <memset+0xdc>
+        ((memop_word*) p)[0] = word;
+  200335:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200339:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  20033d:	48 89 10             	mov    %rdx,(%rax)
+        ((memop_word*) p)[1] = word;
+  200340:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200344:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  200348:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  20034c:	48 89 02             	mov    %rax,(%rdx)
+    for (; n >= 16; n -= 16, p += 16) {
+  20034f:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  200354:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  200359:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  20035e:	77 d5                	ja     200335 <memset+0xb8>
+    }
+    for (; n > 0; ++p, --n) {
+  200360:	eb 15                	jmp    200377 <memset+0xfa>
+        *p = c;
+  200362:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  200365:	89 c2                	mov    %eax,%edx
+  200367:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20036b:	88 10                	mov    %dl,(%rax)
+    for (; n > 0; ++p, --n) {
+  20036d:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  200372:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  200377:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  20037c:	75 e4                	jne    200362 <memset+0xe5>
+    }
+    return v;
+  20037e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  200382:	c9                   	leave
+  200383:	c3                   	ret
+
+0000000000200384 <strlen>:
+
+size_t strlen(const char* s) {
+  200384:	55                   	push   %rbp
+  200385:	48 89 e5             	mov    %rsp,%rbp
+  200388:	48 83 ec 18          	sub    $0x18,%rsp
+  20038c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    size_t n;
+    for (n = 0; *s != '\0'; ++s) {
+  200390:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  200397:	00 
+  200398:	eb 0a                	jmp    2003a4 <strlen+0x20>
+        ++n;
+  20039a:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    for (n = 0; *s != '\0'; ++s) {
+  20039f:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  2003a4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2003a8:	0f b6 00             	movzbl (%rax),%eax
+  2003ab:	84 c0                	test   %al,%al
+  2003ad:	75 eb                	jne    20039a <strlen+0x16>
+    }
+    return n;
+  2003af:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  2003b3:	c9                   	leave
+  2003b4:	c3                   	ret
+
+00000000002003b5 <strnlen>:
+
+size_t strnlen(const char* s, size_t maxlen) {
+  2003b5:	55                   	push   %rbp
+  2003b6:	48 89 e5             	mov    %rsp,%rbp
+  2003b9:	48 83 ec 20          	sub    $0x20,%rsp
+  2003bd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  2003c1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    size_t n;
+    for (n = 0; n != maxlen && *s != '\0'; ++s) {
+  2003c5:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  2003cc:	00 
+  2003cd:	eb 0a                	jmp    2003d9 <strnlen+0x24>
+        ++n;
+  2003cf:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    for (n = 0; n != maxlen && *s != '\0'; ++s) {
+  2003d4:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  2003d9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2003dd:	48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+  2003e1:	74 0b                	je     2003ee <strnlen+0x39>
+  2003e3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2003e7:	0f b6 00             	movzbl (%rax),%eax
+  2003ea:	84 c0                	test   %al,%al
+  2003ec:	75 e1                	jne    2003cf <strnlen+0x1a>
+    }
+    return n;
+  2003ee:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  2003f2:	c9                   	leave
+  2003f3:	c3                   	ret
+
+00000000002003f4 <strcpy>:
+
+char* strcpy(char* dst, const char* src) {
+  2003f4:	55                   	push   %rbp
+  2003f5:	48 89 e5             	mov    %rsp,%rbp
+  2003f8:	48 83 ec 20          	sub    $0x20,%rsp
+  2003fc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  200400:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    char* d = dst;
+  200404:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  200408:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    do {
+        *d++ = *src++;
+  20040c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  200410:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  200414:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  200418:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20041c:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  200420:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+  200424:	0f b6 12             	movzbl (%rdx),%edx
+  200427:	88 10                	mov    %dl,(%rax)
+    } while (d[-1]);
+  200429:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20042d:	48 83 e8 01          	sub    $0x1,%rax
+  200431:	0f b6 00             	movzbl (%rax),%eax
+  200434:	84 c0                	test   %al,%al
+  200436:	75 d4                	jne    20040c <strcpy+0x18>
+    return dst;
+  200438:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  20043c:	c9                   	leave
+  20043d:	c3                   	ret
+
+000000000020043e <strcmp>:
+
+int strcmp(const char* a, const char* b) {
+  20043e:	55                   	push   %rbp
+  20043f:	48 89 e5             	mov    %rsp,%rbp
+  200442:	48 83 ec 10          	sub    $0x10,%rsp
+  200446:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  20044a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    while (*a && *b && *a == *b) {
+  20044e:	eb 0a                	jmp    20045a <strcmp+0x1c>
+        ++a, ++b;
+  200450:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  200455:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+    while (*a && *b && *a == *b) {
+  20045a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20045e:	0f b6 00             	movzbl (%rax),%eax
+  200461:	84 c0                	test   %al,%al
+  200463:	74 1d                	je     200482 <strcmp+0x44>
+  200465:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  200469:	0f b6 00             	movzbl (%rax),%eax
+  20046c:	84 c0                	test   %al,%al
+  20046e:	74 12                	je     200482 <strcmp+0x44>
+  200470:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200474:	0f b6 10             	movzbl (%rax),%edx
+  200477:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  20047b:	0f b6 00             	movzbl (%rax),%eax
+  20047e:	38 c2                	cmp    %al,%dl
+  200480:	74 ce                	je     200450 <strcmp+0x12>
+    }
+    return ((unsigned char) *a > (unsigned char) *b)
+  200482:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200486:	0f b6 00             	movzbl (%rax),%eax
+  200489:	89 c2                	mov    %eax,%edx
+  20048b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  20048f:	0f b6 00             	movzbl (%rax),%eax
+  200492:	38 d0                	cmp    %dl,%al
+  200494:	0f 92 c0             	setb   %al
+  200497:	0f b6 d0             	movzbl %al,%edx
+        - ((unsigned char) *a < (unsigned char) *b);
+  20049a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20049e:	0f b6 00             	movzbl (%rax),%eax
+  2004a1:	89 c1                	mov    %eax,%ecx
+  2004a3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2004a7:	0f b6 00             	movzbl (%rax),%eax
+  2004aa:	38 c1                	cmp    %al,%cl
+  2004ac:	0f 92 c0             	setb   %al
+  2004af:	0f b6 c0             	movzbl %al,%eax
+  2004b2:	29 c2                	sub    %eax,%edx
+  2004b4:	89 d0                	mov    %edx,%eax
+}
+  2004b6:	c9                   	leave
+  2004b7:	c3                   	ret
+
+00000000002004b8 <strchr>:
+
+char* strchr(const char* s, int c) {
+  2004b8:	55                   	push   %rbp
+  2004b9:	48 89 e5             	mov    %rsp,%rbp
+  2004bc:	48 83 ec 10          	sub    $0x10,%rsp
+  2004c0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  2004c4:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    while (*s && *s != (char) c) {
+  2004c7:	eb 05                	jmp    2004ce <strchr+0x16>
+        ++s;
+  2004c9:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    while (*s && *s != (char) c) {
+  2004ce:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2004d2:	0f b6 00             	movzbl (%rax),%eax
+  2004d5:	84 c0                	test   %al,%al
+  2004d7:	74 0e                	je     2004e7 <strchr+0x2f>
+  2004d9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2004dd:	0f b6 00             	movzbl (%rax),%eax
+  2004e0:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  2004e3:	38 d0                	cmp    %dl,%al
+  2004e5:	75 e2                	jne    2004c9 <strchr+0x11>
+    }
+    if (*s == (char) c) {
+  2004e7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2004eb:	0f b6 00             	movzbl (%rax),%eax
+  2004ee:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  2004f1:	38 d0                	cmp    %dl,%al
+  2004f3:	75 06                	jne    2004fb <strchr+0x43>
+        return (char*) s;
+  2004f5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2004f9:	eb 05                	jmp    200500 <strchr+0x48>
+    } else {
+        return NULL;
+  2004fb:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+}
+  200500:	c9                   	leave
+  200501:	c3                   	ret
+
+0000000000200502 <rand>:
+
+// New randomness implementation
+static int      rand_seed_set;
+static unsigned rand_seed;
+
+int rand(void) {
+  200502:	55                   	push   %rbp
+  200503:	48 89 e5             	mov    %rsp,%rbp
+  200506:	48 83 ec 10          	sub    $0x10,%rsp
+    if (!rand_seed_set) {
+  20050a:	8b 05 00 2b 00 00    	mov    0x2b00(%rip),%eax        # 203010 <rand_seed_set>
+  200510:	85 c0                	test   %eax,%eax
+  200512:	75 2c                	jne    200540 <rand+0x3e>
+#if WEENSYOS_KERNEL
+        extern unsigned get_entropy_value(void);
+        srand(get_entropy_value());
+#else           // user‑space build
+       /* kernel-refreshed seed from the kernel data page: no system call */
+       srand((unsigned) (vdso()->seed[0] ^ read_cycle_counter()));
+  200514:	e8 42 fb ff ff       	call   20005b <vdso>
+  200519:	48 8b 40 18          	mov    0x18(%rax),%rax
+  20051d:	89 c1                	mov    %eax,%ecx
+    }
+}
+
+static inline uint64_t read_cycle_counter(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+  20051f:	0f 31                	rdtsc
+  200521:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  200524:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    return ((uint64_t) hi << 32) | lo;
+  200527:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  20052a:	48 c1 e0 20          	shl    $0x20,%rax
+  20052e:	48 89 c2             	mov    %rax,%rdx
+  200531:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  200534:	48 09 d0             	or     %rdx,%rax
+  200537:	31 c8                	xor    %ecx,%eax
+  200539:	89 c7                	mov    %eax,%edi
+  20053b:	e8 24 00 00 00       	call   200564 <srand>
+#endif
+    }
+    rand_seed = rand_seed * 1664525U + 1013904223U;   // LCG
+  200540:	8b 05 ce 2a 00 00    	mov    0x2ace(%rip),%eax        # 203014 <rand_seed>
+  200546:	69 c0 0d 66 19 00    	imul   $0x19660d,%eax,%eax
+  20054c:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+  200551:	89 05 bd 2a 00 00    	mov    %eax,0x2abd(%rip)        # 203014 <rand_seed>
+    return rand_seed & RAND_MAX;
+  200557:	8b 05 b7 2a 00 00    	mov    0x2ab7(%rip),%eax        # 203014 <rand_seed>
+  20055d:	25 ff ff ff 7f       	and    $0x7fffffff,%eax
+}
+  200562:	c9                   	leave
+  200563:	c3                   	ret
+
+0000000000200564 <srand>:
+
+void srand(unsigned seed) {
+  200564:	55                   	push   %rbp
+  200565:	48 89 e5             	mov    %rsp,%rbp
+  200568:	48 83 ec 08          	sub    $0x8,%rsp
+  20056c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+    rand_seed      = seed;
+  20056f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  200572:	89 05 9c 2a 00 00    	mov    %eax,0x2a9c(%rip)        # 203014 <rand_seed>
+    rand_seed_set  = 1;
+  200578:	c7 05 8e 2a 00 00 01 	movl   $0x1,0x2a8e(%rip)        # 203010 <rand_seed_set>
+  20057f:	00 00 00 
+}
+  200582:	90                   	nop
+  200583:	c9                   	leave
+  200584:	c3                   	ret
+
+0000000000200585 <fill_numbuf>:
+//    Print a message onto the console, starting at the given cursor position.
+
+// snprintf, vsnprintf
+//    Format a string into a buffer.
+
+static char* fill_numbuf(char* numbuf_end, unsigned long val, int base) {
+  200585:	55                   	push   %rbp
+  200586:	48 89 e5             	mov    %rsp,%rbp
+  200589:	48 83 ec 28          	sub    $0x28,%rsp
+  20058d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  200591:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  200595:	89 55 dc             	mov    %edx,-0x24(%rbp)
+    static const char upper_digits[] = "0123456789ABCDEF";
+    static const char lower_digits[] = "0123456789abcdef";
+
+    const char* digits = upper_digits;
+  200598:	48 8d 05 11 1c 00 00 	lea    0x1c11(%rip),%rax        # 2021b0 <upper_digits.1>
+  20059f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (base < 0) {
+  2005a3:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  2005a7:	79 0e                	jns    2005b7 <fill_numbuf+0x32>
+        digits = lower_digits;
+  2005a9:	48 8d 05 20 1c 00 00 	lea    0x1c20(%rip),%rax        # 2021d0 <lower_digits.0>
+  2005b0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+        base = -base;
+  2005b4:	f7 5d dc             	negl   -0x24(%rbp)
+    }
+
+    *--numbuf_end = '\0';
+  2005b7:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  2005bc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2005c0:	c6 00 00             	movb   $0x0,(%rax)
+    do {
+        *--numbuf_end = digits[val % base];
+  2005c3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  2005c6:	48 63 c8             	movslq %eax,%rcx
+  2005c9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  2005cd:	ba 00 00 00 00       	mov    $0x0,%edx
+  2005d2:	48 f7 f1             	div    %rcx
+  2005d5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2005d9:	48 01 d0             	add    %rdx,%rax
+  2005dc:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  2005e1:	0f b6 10             	movzbl (%rax),%edx
+  2005e4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2005e8:	88 10                	mov    %dl,(%rax)
+        val /= base;
+  2005ea:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  2005ed:	48 63 f0             	movslq %eax,%rsi
+  2005f0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  2005f4:	ba 00 00 00 00       	mov    $0x0,%edx
+  2005f9:	48 f7 f6             	div    %rsi
+  2005fc:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    } while (val != 0);
+  200600:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  200605:	75 bc                	jne    2005c3 <fill_numbuf+0x3e>
+    return numbuf_end;
+  200607:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  20060b:	c9                   	leave
+  20060c:	c3                   	ret
+
+000000000020060d <printer_vprintf>:
+#define FLAG_NUMERIC            (1<<5)
+#define FLAG_SIGNED             (1<<6)
+#define FLAG_NEGATIVE           (1<<7)
+#define FLAG_ALT2               (1<<8)
+
+void printer_vprintf(printer* p, int color, const char* format, va_list val) {
+  20060d:	55                   	push   %rbp
+  20060e:	48 89 e5             	mov    %rsp,%rbp
+  200611:	53                   	push   %rbx
+  200612:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  200619:	48 89 bd 78 ff ff ff 	mov    %rdi,-0x88(%rbp)
+  200620:	89 b5 74 ff ff ff    	mov    %esi,-0x8c(%rbp)
+  200626:	48 89 95 68 ff ff ff 	mov    %rdx,-0x98(%rbp)
+  20062d:	48 89 8d 60 ff ff ff 	mov    %rcx,-0xa0(%rbp)
+#define NUMBUFSIZ 24
+    char numbuf[NUMBUFSIZ];
+
+    for (; *format; ++format) {
+  200634:	e9 be 09 00 00       	jmp    200ff7 <printer_vprintf+0x9ea>
+        if (*format != '%') {
+  200639:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200640:	0f b6 00             	movzbl (%rax),%eax
+  200643:	3c 25                	cmp    $0x25,%al
+  200645:	74 31                	je     200678 <printer_vprintf+0x6b>
+            p->putc(p, *format, color);
+  200647:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  20064e:	4c 8b 00             	mov    (%rax),%r8
+  200651:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200658:	0f b6 00             	movzbl (%rax),%eax
+  20065b:	0f b6 c8             	movzbl %al,%ecx
+  20065e:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  200664:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  20066b:	89 ce                	mov    %ecx,%esi
+  20066d:	48 89 c7             	mov    %rax,%rdi
+  200670:	41 ff d0             	call   *%r8
+            continue;
+  200673:	e9 77 09 00 00       	jmp    200fef <printer_vprintf+0x9e2>
+        }
+
+        // process flags
+        int flags = 0;
+  200678:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+        for (++format; *format; ++format) {
+  20067f:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  200686:	01 
+  200687:	eb 4f                	jmp    2006d8 <printer_vprintf+0xcb>
+            const char* flagc = strchr(flag_chars, *format);
+  200689:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200690:	0f b6 00             	movzbl (%rax),%eax
+  200693:	0f be c0             	movsbl %al,%eax
+  200696:	89 c6                	mov    %eax,%esi
+  200698:	48 8d 05 c1 19 00 00 	lea    0x19c1(%rip),%rax        # 202060 <flag_chars>
+  20069f:	48 89 c7             	mov    %rax,%rdi
+  2006a2:	e8 11 fe ff ff       	call   2004b8 <strchr>
+  2006a7:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (flagc) {
+  2006ab:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  2006b0:	74 36                	je     2006e8 <printer_vprintf+0xdb>
+                flags |= 1 << (flagc - flag_chars);
+  2006b2:	48 8d 05 a7 19 00 00 	lea    0x19a7(%rip),%rax        # 202060 <flag_chars>
+  2006b9:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  2006bd:	48 29 c2             	sub    %rax,%rdx
+  2006c0:	89 d0                	mov    %edx,%eax
+  2006c2:	ba 01 00 00 00       	mov    $0x1,%edx
+  2006c7:	89 c1                	mov    %eax,%ecx
+  2006c9:	d3 e2                	shl    %cl,%edx
+  2006cb:	89 d0                	mov    %edx,%eax
+  2006cd:	09 45 ec             	or     %eax,-0x14(%rbp)
+        for (++format; *format; ++format) {
+  2006d0:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  2006d7:	01 
+  2006d8:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  2006df:	0f b6 00             	movzbl (%rax),%eax
+  2006e2:	84 c0                	test   %al,%al
+  2006e4:	75 a3                	jne    200689 <printer_vprintf+0x7c>
+  2006e6:	eb 01                	jmp    2006e9 <printer_vprintf+0xdc>
+            } else {
+                break;
+  2006e8:	90                   	nop
+            }
+        }
+
+        // process width
+        int width = -1;
+  2006e9:	c7 45 e8 ff ff ff ff 	movl   $0xffffffff,-0x18(%rbp)
+        if (*format >= '1' && *format <= '9') {
+  2006f0:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  2006f7:	0f b6 00             	movzbl (%rax),%eax
+  2006fa:	3c 30                	cmp    $0x30,%al
+  2006fc:	7e 67                	jle    200765 <printer_vprintf+0x158>
+  2006fe:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200705:	0f b6 00             	movzbl (%rax),%eax
+  200708:	3c 39                	cmp    $0x39,%al
+  20070a:	7f 59                	jg     200765 <printer_vprintf+0x158>
+            for (width = 0; *format >= '0' && *format <= '9'; ) {
+  20070c:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%rbp)
+  200713:	eb 2e                	jmp    200743 <printer_vprintf+0x136>
+                width = 10 * width + *format++ - '0';
+  200715:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  200718:	89 d0                	mov    %edx,%eax
+  20071a:	c1 e0 02             	shl    $0x2,%eax
+  20071d:	01 d0                	add    %edx,%eax
+  20071f:	01 c0                	add    %eax,%eax
+  200721:	89 c1                	mov    %eax,%ecx
+  200723:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  20072a:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  20072e:	48 89 95 68 ff ff ff 	mov    %rdx,-0x98(%rbp)
+  200735:	0f b6 00             	movzbl (%rax),%eax
+  200738:	0f be c0             	movsbl %al,%eax
+  20073b:	01 c8                	add    %ecx,%eax
+  20073d:	83 e8 30             	sub    $0x30,%eax
+  200740:	89 45 e8             	mov    %eax,-0x18(%rbp)
+            for (width = 0; *format >= '0' && *format <= '9'; ) {
+  200743:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  20074a:	0f b6 00             	movzbl (%rax),%eax
+  20074d:	3c 2f                	cmp    $0x2f,%al
+  20074f:	0f 8e 85 00 00 00    	jle    2007da <printer_vprintf+0x1cd>
+  200755:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  20075c:	0f b6 00             	movzbl (%rax),%eax
+  20075f:	3c 39                	cmp    $0x39,%al
+  200761:	7e b2                	jle    200715 <printer_vprintf+0x108>
+        if (*format >= '1' && *format <= '9') {
+  200763:	eb 75                	jmp    2007da <printer_vprintf+0x1cd>
+            }
+        } else if (*format == '*') {
+  200765:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  20076c:	0f b6 00             	movzbl (%rax),%eax
+  20076f:	3c 2a                	cmp    $0x2a,%al
+  200771:	75 68                	jne    2007db <printer_vprintf+0x1ce>
+            width = va_arg(val, int);
+  200773:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  20077a:	8b 00                	mov    (%rax),%eax
+  20077c:	83 f8 2f             	cmp    $0x2f,%eax
+  20077f:	77 30                	ja     2007b1 <printer_vprintf+0x1a4>
+  200781:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200788:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  20078c:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200793:	8b 00                	mov    (%rax),%eax
+  200795:	89 c0                	mov    %eax,%eax
+  200797:	48 01 d0             	add    %rdx,%rax
+  20079a:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  2007a1:	8b 12                	mov    (%rdx),%edx
+  2007a3:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  2007a6:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  2007ad:	89 0a                	mov    %ecx,(%rdx)
+  2007af:	eb 1a                	jmp    2007cb <printer_vprintf+0x1be>
+  2007b1:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2007b8:	48 8b 40 08          	mov    0x8(%rax),%rax
+  2007bc:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  2007c0:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  2007c7:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  2007cb:	8b 00                	mov    (%rax),%eax
+  2007cd:	89 45 e8             	mov    %eax,-0x18(%rbp)
+            ++format;
+  2007d0:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  2007d7:	01 
+  2007d8:	eb 01                	jmp    2007db <printer_vprintf+0x1ce>
+        if (*format >= '1' && *format <= '9') {
+  2007da:	90                   	nop
+        }
+
+        // process precision
+        int precision = -1;
+  2007db:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%rbp)
+        if (*format == '.') {
+  2007e2:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  2007e9:	0f b6 00             	movzbl (%rax),%eax
+  2007ec:	3c 2e                	cmp    $0x2e,%al
+  2007ee:	0f 85 00 01 00 00    	jne    2008f4 <printer_vprintf+0x2e7>
+            ++format;
+  2007f4:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  2007fb:	01 
+            if (*format >= '0' && *format <= '9') {
+  2007fc:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200803:	0f b6 00             	movzbl (%rax),%eax
+  200806:	3c 2f                	cmp    $0x2f,%al
+  200808:	7e 67                	jle    200871 <printer_vprintf+0x264>
+  20080a:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200811:	0f b6 00             	movzbl (%rax),%eax
+  200814:	3c 39                	cmp    $0x39,%al
+  200816:	7f 59                	jg     200871 <printer_vprintf+0x264>
+                for (precision = 0; *format >= '0' && *format <= '9'; ) {
+  200818:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%rbp)
+  20081f:	eb 2e                	jmp    20084f <printer_vprintf+0x242>
+                    precision = 10 * precision + *format++ - '0';
+  200821:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  200824:	89 d0                	mov    %edx,%eax
+  200826:	c1 e0 02             	shl    $0x2,%eax
+  200829:	01 d0                	add    %edx,%eax
+  20082b:	01 c0                	add    %eax,%eax
+  20082d:	89 c1                	mov    %eax,%ecx
+  20082f:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200836:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  20083a:	48 89 95 68 ff ff ff 	mov    %rdx,-0x98(%rbp)
+  200841:	0f b6 00             	movzbl (%rax),%eax
+  200844:	0f be c0             	movsbl %al,%eax
+  200847:	01 c8                	add    %ecx,%eax
+  200849:	83 e8 30             	sub    $0x30,%eax
+  20084c:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+                for (precision = 0; *format >= '0' && *format <= '9'; ) {
+  20084f:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200856:	0f b6 00             	movzbl (%rax),%eax
+  200859:	3c 2f                	cmp    $0x2f,%al
+  20085b:	0f 8e 85 00 00 00    	jle    2008e6 <printer_vprintf+0x2d9>
+  200861:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200868:	0f b6 00             	movzbl (%rax),%eax
+  20086b:	3c 39                	cmp    $0x39,%al
+  20086d:	7e b2                	jle    200821 <printer_vprintf+0x214>
+            if (*format >= '0' && *format <= '9') {
+  20086f:	eb 75                	jmp    2008e6 <printer_vprintf+0x2d9>
+                }
+            } else if (*format == '*') {
+  200871:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200878:	0f b6 00             	movzbl (%rax),%eax
+  20087b:	3c 2a                	cmp    $0x2a,%al
+  20087d:	75 68                	jne    2008e7 <printer_vprintf+0x2da>
+                precision = va_arg(val, int);
+  20087f:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200886:	8b 00                	mov    (%rax),%eax
+  200888:	83 f8 2f             	cmp    $0x2f,%eax
+  20088b:	77 30                	ja     2008bd <printer_vprintf+0x2b0>
+  20088d:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200894:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200898:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  20089f:	8b 00                	mov    (%rax),%eax
+  2008a1:	89 c0                	mov    %eax,%eax
+  2008a3:	48 01 d0             	add    %rdx,%rax
+  2008a6:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  2008ad:	8b 12                	mov    (%rdx),%edx
+  2008af:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  2008b2:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  2008b9:	89 0a                	mov    %ecx,(%rdx)
+  2008bb:	eb 1a                	jmp    2008d7 <printer_vprintf+0x2ca>
+  2008bd:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2008c4:	48 8b 40 08          	mov    0x8(%rax),%rax
+  2008c8:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  2008cc:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  2008d3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  2008d7:	8b 00                	mov    (%rax),%eax
+  2008d9:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+                ++format;
+  2008dc:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  2008e3:	01 
+  2008e4:	eb 01                	jmp    2008e7 <printer_vprintf+0x2da>
+            if (*format >= '0' && *format <= '9') {
+  2008e6:	90                   	nop
+            }
+            if (precision < 0) {
+  2008e7:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  2008eb:	79 07                	jns    2008f4 <printer_vprintf+0x2e7>
+                precision = 0;
+  2008ed:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%rbp)
+            }
+        }
+
+        // process main conversion character
+        int base = 10;
+  2008f4:	c7 45 e0 0a 00 00 00 	movl   $0xa,-0x20(%rbp)
+        unsigned long num = 0;
+  2008fb:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  200902:	00 
+        int length = 0;
+  200903:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+        char* data = "";
+  20090a:	48 8d 05 55 17 00 00 	lea    0x1755(%rip),%rax        # 202066 <flag_chars+0x6>
+  200911:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    again:
+        switch (*format) {
+  200915:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  20091c:	0f b6 00             	movzbl (%rax),%eax
+  20091f:	0f be c0             	movsbl %al,%eax
+  200922:	83 e8 43             	sub    $0x43,%eax
+  200925:	83 f8 37             	cmp    $0x37,%eax
+  200928:	0f 87 b5 03 00 00    	ja     200ce3 <printer_vprintf+0x6d6>
+  20092e:	89 c0                	mov    %eax,%eax
+  200930:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  200937:	00 
+  200938:	48 8d 05 35 17 00 00 	lea    0x1735(%rip),%rax        # 202074 <flag_chars+0x14>
+  20093f:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+  200942:	48 98                	cltq
+  200944:	48 8d 15 29 17 00 00 	lea    0x1729(%rip),%rdx        # 202074 <flag_chars+0x14>
+  20094b:	48 01 d0             	add    %rdx,%rax
+  20094e:	ff e0                	jmp    *%rax
+        case 'l':
+        case 'z':
+            length = 1;
+  200950:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+            ++format;
+  200957:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  20095e:	01 
+            goto again;
+  20095f:	eb b4                	jmp    200915 <printer_vprintf+0x308>
+        case 'd':
+        case 'i': {
+            long x = length ? va_arg(val, long) : va_arg(val, int);
+  200961:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  200965:	74 5d                	je     2009c4 <printer_vprintf+0x3b7>
+  200967:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  20096e:	8b 00                	mov    (%rax),%eax
+  200970:	83 f8 2f             	cmp    $0x2f,%eax
+  200973:	77 30                	ja     2009a5 <printer_vprintf+0x398>
+  200975:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  20097c:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200980:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200987:	8b 00                	mov    (%rax),%eax
+  200989:	89 c0                	mov    %eax,%eax
+  20098b:	48 01 d0             	add    %rdx,%rax
+  20098e:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200995:	8b 12                	mov    (%rdx),%edx
+  200997:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  20099a:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  2009a1:	89 0a                	mov    %ecx,(%rdx)
+  2009a3:	eb 1a                	jmp    2009bf <printer_vprintf+0x3b2>
+  2009a5:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2009ac:	48 8b 40 08          	mov    0x8(%rax),%rax
+  2009b0:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  2009b4:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  2009bb:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  2009bf:	48 8b 00             	mov    (%rax),%rax
+  2009c2:	eb 5c                	jmp    200a20 <printer_vprintf+0x413>
+  2009c4:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2009cb:	8b 00                	mov    (%rax),%eax
+  2009cd:	83 f8 2f             	cmp    $0x2f,%eax
+  2009d0:	77 30                	ja     200a02 <printer_vprintf+0x3f5>
+  2009d2:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2009d9:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  2009dd:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2009e4:	8b 00                	mov    (%rax),%eax
+  2009e6:	89 c0                	mov    %eax,%eax
+  2009e8:	48 01 d0             	add    %rdx,%rax
+  2009eb:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  2009f2:	8b 12                	mov    (%rdx),%edx
+  2009f4:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  2009f7:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  2009fe:	89 0a                	mov    %ecx,(%rdx)
+  200a00:	eb 1a                	jmp    200a1c <printer_vprintf+0x40f>
+  200a02:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200a09:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200a0d:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200a11:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200a18:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200a1c:	8b 00                	mov    (%rax),%eax
+  200a1e:	48 98                	cltq
+  200a20:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+            int negative = x < 0 ? FLAG_NEGATIVE : 0;
+  200a24:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  200a28:	48 c1 f8 38          	sar    $0x38,%rax
+  200a2c:	25 80 00 00 00       	and    $0x80,%eax
+  200a31:	89 45 a4             	mov    %eax,-0x5c(%rbp)
+            num = negative ? -x : x;
+  200a34:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  200a38:	74 09                	je     200a43 <printer_vprintf+0x436>
+  200a3a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  200a3e:	48 f7 d8             	neg    %rax
+  200a41:	eb 04                	jmp    200a47 <printer_vprintf+0x43a>
+  200a43:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  200a47:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+            flags |= FLAG_NUMERIC | FLAG_SIGNED | negative;
+  200a4b:	8b 45 a4             	mov    -0x5c(%rbp),%eax
+  200a4e:	83 c8 60             	or     $0x60,%eax
+  200a51:	09 45 ec             	or     %eax,-0x14(%rbp)
+            break;
+  200a54:	e9 cf 02 00 00       	jmp    200d28 <printer_vprintf+0x71b>
+        }
+        case 'u':
+        format_unsigned:
+            num = length ? va_arg(val, unsigned long) : va_arg(val, unsigned);
+  200a59:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  200a5d:	74 5d                	je     200abc <printer_vprintf+0x4af>
+  200a5f:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200a66:	8b 00                	mov    (%rax),%eax
+  200a68:	83 f8 2f             	cmp    $0x2f,%eax
+  200a6b:	77 30                	ja     200a9d <printer_vprintf+0x490>
+  200a6d:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200a74:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200a78:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200a7f:	8b 00                	mov    (%rax),%eax
+  200a81:	89 c0                	mov    %eax,%eax
+  200a83:	48 01 d0             	add    %rdx,%rax
+  200a86:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200a8d:	8b 12                	mov    (%rdx),%edx
+  200a8f:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200a92:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200a99:	89 0a                	mov    %ecx,(%rdx)
+  200a9b:	eb 1a                	jmp    200ab7 <printer_vprintf+0x4aa>
+  200a9d:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200aa4:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200aa8:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200aac:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200ab3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200ab7:	48 8b 00             	mov    (%rax),%rax
+  200aba:	eb 5c                	jmp    200b18 <printer_vprintf+0x50b>
+  200abc:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200ac3:	8b 00                	mov    (%rax),%eax
+  200ac5:	83 f8 2f             	cmp    $0x2f,%eax
+  200ac8:	77 30                	ja     200afa <printer_vprintf+0x4ed>
+  200aca:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200ad1:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200ad5:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200adc:	8b 00                	mov    (%rax),%eax
+  200ade:	89 c0                	mov    %eax,%eax
+  200ae0:	48 01 d0             	add    %rdx,%rax
+  200ae3:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200aea:	8b 12                	mov    (%rdx),%edx
+  200aec:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200aef:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200af6:	89 0a                	mov    %ecx,(%rdx)
+  200af8:	eb 1a                	jmp    200b14 <printer_vprintf+0x507>
+  200afa:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200b01:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200b05:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200b09:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200b10:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200b14:	8b 00                	mov    (%rax),%eax
+  200b16:	89 c0                	mov    %eax,%eax
+  200b18:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+            flags |= FLAG_NUMERIC;
+  200b1c:	83 4d ec 20          	orl    $0x20,-0x14(%rbp)
+            break;
+  200b20:	e9 03 02 00 00       	jmp    200d28 <printer_vprintf+0x71b>
+        case 'x':
+            base = -16;
+  200b25:	c7 45 e0 f0 ff ff ff 	movl   $0xfffffff0,-0x20(%rbp)
+            goto format_unsigned;
+  200b2c:	e9 28 ff ff ff       	jmp    200a59 <printer_vprintf+0x44c>
+        case 'X':
+            base = 16;
+  200b31:	c7 45 e0 10 00 00 00 	movl   $0x10,-0x20(%rbp)
+            goto format_unsigned;
+  200b38:	e9 1c ff ff ff       	jmp    200a59 <printer_vprintf+0x44c>
+        case 'p':
+            num = (uintptr_t) va_arg(val, void*);
+  200b3d:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200b44:	8b 00                	mov    (%rax),%eax
+  200b46:	83 f8 2f             	cmp    $0x2f,%eax
+  200b49:	77 30                	ja     200b7b <printer_vprintf+0x56e>
+  200b4b:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200b52:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200b56:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200b5d:	8b 00                	mov    (%rax),%eax
+  200b5f:	89 c0                	mov    %eax,%eax
+  200b61:	48 01 d0             	add    %rdx,%rax
+  200b64:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200b6b:	8b 12                	mov    (%rdx),%edx
+  200b6d:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200b70:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200b77:	89 0a                	mov    %ecx,(%rdx)
+  200b79:	eb 1a                	jmp    200b95 <printer_vprintf+0x588>
+  200b7b:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200b82:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200b86:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200b8a:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200b91:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200b95:	48 8b 00             	mov    (%rax),%rax
+  200b98:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+            base = -16;
+  200b9c:	c7 45 e0 f0 ff ff ff 	movl   $0xfffffff0,-0x20(%rbp)
+            flags |= FLAG_ALT | FLAG_ALT2 | FLAG_NUMERIC;
+  200ba3:	81 4d ec 21 01 00 00 	orl    $0x121,-0x14(%rbp)
+            break;
+  200baa:	e9 79 01 00 00       	jmp    200d28 <printer_vprintf+0x71b>
+        case 's':
+            data = va_arg(val, char*);
+  200baf:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200bb6:	8b 00                	mov    (%rax),%eax
+  200bb8:	83 f8 2f             	cmp    $0x2f,%eax
+  200bbb:	77 30                	ja     200bed <printer_vprintf+0x5e0>
+  200bbd:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200bc4:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200bc8:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200bcf:	8b 00                	mov    (%rax),%eax
+  200bd1:	89 c0                	mov    %eax,%eax
+  200bd3:	48 01 d0             	add    %rdx,%rax
+  200bd6:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200bdd:	8b 12                	mov    (%rdx),%edx
+  200bdf:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200be2:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200be9:	89 0a                	mov    %ecx,(%rdx)
+  200beb:	eb 1a                	jmp    200c07 <printer_vprintf+0x5fa>
+  200bed:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200bf4:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200bf8:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200bfc:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200c03:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200c07:	48 8b 00             	mov    (%rax),%rax
+  200c0a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+            break;
+  200c0e:	e9 15 01 00 00       	jmp    200d28 <printer_vprintf+0x71b>
+        case 'C':
+            color = va_arg(val, int);
+  200c13:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c1a:	8b 00                	mov    (%rax),%eax
+  200c1c:	83 f8 2f             	cmp    $0x2f,%eax
+  200c1f:	77 30                	ja     200c51 <printer_vprintf+0x644>
+  200c21:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c28:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200c2c:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c33:	8b 00                	mov    (%rax),%eax
+  200c35:	89 c0                	mov    %eax,%eax
+  200c37:	48 01 d0             	add    %rdx,%rax
+  200c3a:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200c41:	8b 12                	mov    (%rdx),%edx
+  200c43:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200c46:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200c4d:	89 0a                	mov    %ecx,(%rdx)
+  200c4f:	eb 1a                	jmp    200c6b <printer_vprintf+0x65e>
+  200c51:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c58:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200c5c:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200c60:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200c67:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200c6b:	8b 00                	mov    (%rax),%eax
+  200c6d:	89 85 74 ff ff ff    	mov    %eax,-0x8c(%rbp)
+            goto done;
+  200c73:	e9 77 03 00 00       	jmp    200fef <printer_vprintf+0x9e2>
+        case 'c':
+            data = numbuf;
+  200c78:	48 8d 45 8c          	lea    -0x74(%rbp),%rax
+  200c7c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+            numbuf[0] = va_arg(val, int);
+  200c80:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c87:	8b 00                	mov    (%rax),%eax
+  200c89:	83 f8 2f             	cmp    $0x2f,%eax
+  200c8c:	77 30                	ja     200cbe <printer_vprintf+0x6b1>
+  200c8e:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c95:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200c99:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200ca0:	8b 00                	mov    (%rax),%eax
+  200ca2:	89 c0                	mov    %eax,%eax
+  200ca4:	48 01 d0             	add    %rdx,%rax
+  200ca7:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200cae:	8b 12                	mov    (%rdx),%edx
+  200cb0:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200cb3:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200cba:	89 0a                	mov    %ecx,(%rdx)
+  200cbc:	eb 1a                	jmp    200cd8 <printer_vprintf+0x6cb>
+  200cbe:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200cc5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200cc9:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200ccd:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200cd4:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200cd8:	8b 00                	mov    (%rax),%eax
+  200cda:	88 45 8c             	mov    %al,-0x74(%rbp)
+            numbuf[1] = '\0';
+  200cdd:	c6 45 8d 00          	movb   $0x0,-0x73(%rbp)
+            break;
+  200ce1:	eb 45                	jmp    200d28 <printer_vprintf+0x71b>
+        default:
+            data = numbuf;
+  200ce3:	48 8d 45 8c          	lea    -0x74(%rbp),%rax
+  200ce7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+            numbuf[0] = (*format ? *format : '%');
+  200ceb:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200cf2:	0f b6 00             	movzbl (%rax),%eax
+  200cf5:	84 c0                	test   %al,%al
+  200cf7:	74 0c                	je     200d05 <printer_vprintf+0x6f8>
+  200cf9:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200d00:	0f b6 00             	movzbl (%rax),%eax
+  200d03:	eb 05                	jmp    200d0a <printer_vprintf+0x6fd>
+  200d05:	b8 25 00 00 00       	mov    $0x25,%eax
+  200d0a:	88 45 8c             	mov    %al,-0x74(%rbp)
+            numbuf[1] = '\0';
+  200d0d:	c6 45 8d 00          	movb   $0x0,-0x73(%rbp)
+            if (!*format) {
+  200d11:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200d18:	0f b6 00             	movzbl (%rax),%eax
+  200d1b:	84 c0                	test   %al,%al
+  200d1d:	75 08                	jne    200d27 <printer_vprintf+0x71a>
+                format--;
+  200d1f:	48 83 ad 68 ff ff ff 	subq   $0x1,-0x98(%rbp)
+  200d26:	01 
+            }
+            break;
+  200d27:	90                   	nop
+        }
+
+        if (flags & FLAG_NUMERIC) {
+  200d28:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200d2b:	83 e0 20             	and    $0x20,%eax
+  200d2e:	85 c0                	test   %eax,%eax
+  200d30:	74 1e                	je     200d50 <printer_vprintf+0x743>
+            data = fill_numbuf(numbuf + NUMBUFSIZ, num, base);
+  200d32:	48 8d 45 8c          	lea    -0x74(%rbp),%rax
+  200d36:	48 83 c0 18          	add    $0x18,%rax
+  200d3a:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  200d3d:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  200d41:	48 89 ce             	mov    %rcx,%rsi
+  200d44:	48 89 c7             	mov    %rax,%rdi
+  200d47:	e8 39 f8 ff ff       	call   200585 <fill_numbuf>
+  200d4c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        }
+
+        const char* prefix = "";
+  200d50:	48 8d 05 0f 13 00 00 	lea    0x130f(%rip),%rax        # 202066 <flag_chars+0x6>
+  200d57:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((flags & FLAG_NUMERIC) && (flags & FLAG_SIGNED)) {
+  200d5b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200d5e:	83 e0 20             	and    $0x20,%eax
+  200d61:	85 c0                	test   %eax,%eax
+  200d63:	74 51                	je     200db6 <printer_vprintf+0x7a9>
+  200d65:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200d68:	83 e0 40             	and    $0x40,%eax
+  200d6b:	85 c0                	test   %eax,%eax
+  200d6d:	74 47                	je     200db6 <printer_vprintf+0x7a9>
+            if (flags & FLAG_NEGATIVE) {
+  200d6f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200d72:	25 80 00 00 00       	and    $0x80,%eax
+  200d77:	85 c0                	test   %eax,%eax
+  200d79:	74 0d                	je     200d88 <printer_vprintf+0x77b>
+                prefix = "-";
+  200d7b:	48 8d 05 e5 12 00 00 	lea    0x12e5(%rip),%rax        # 202067 <flag_chars+0x7>
+  200d82:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            if (flags & FLAG_NEGATIVE) {
+  200d86:	eb 7d                	jmp    200e05 <printer_vprintf+0x7f8>
+            } else if (flags & FLAG_PLUSPOSITIVE) {
+  200d88:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200d8b:	83 e0 10             	and    $0x10,%eax
+  200d8e:	85 c0                	test   %eax,%eax
+  200d90:	74 0d                	je     200d9f <printer_vprintf+0x792>
+                prefix = "+";
+  200d92:	48 8d 05 d0 12 00 00 	lea    0x12d0(%rip),%rax        # 202069 <flag_chars+0x9>
+  200d99:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            if (flags & FLAG_NEGATIVE) {
+  200d9d:	eb 66                	jmp    200e05 <printer_vprintf+0x7f8>
+            } else if (flags & FLAG_SPACEPOSITIVE) {
+  200d9f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200da2:	83 e0 08             	and    $0x8,%eax
+  200da5:	85 c0                	test   %eax,%eax
+  200da7:	74 5c                	je     200e05 <printer_vprintf+0x7f8>
+                prefix = " ";
+  200da9:	48 8d 05 bb 12 00 00 	lea    0x12bb(%rip),%rax        # 20206b <flag_chars+0xb>
+  200db0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            if (flags & FLAG_NEGATIVE) {
+  200db4:	eb 4f                	jmp    200e05 <printer_vprintf+0x7f8>
+            }
+        } else if ((flags & FLAG_NUMERIC) && (flags & FLAG_ALT)
+  200db6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200db9:	83 e0 20             	and    $0x20,%eax
+  200dbc:	85 c0                	test   %eax,%eax
+  200dbe:	74 46                	je     200e06 <printer_vprintf+0x7f9>
+  200dc0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200dc3:	83 e0 01             	and    $0x1,%eax
+  200dc6:	85 c0                	test   %eax,%eax
+  200dc8:	74 3c                	je     200e06 <printer_vprintf+0x7f9>
+                   && (base == 16 || base == -16)
+  200dca:	83 7d e0 10          	cmpl   $0x10,-0x20(%rbp)
+  200dce:	74 06                	je     200dd6 <printer_vprintf+0x7c9>
+  200dd0:	83 7d e0 f0          	cmpl   $0xfffffff0,-0x20(%rbp)
+  200dd4:	75 30                	jne    200e06 <printer_vprintf+0x7f9>
+                   && (num || (flags & FLAG_ALT2))) {
+  200dd6:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  200ddb:	75 0c                	jne    200de9 <printer_vprintf+0x7dc>
+  200ddd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200de0:	25 00 01 00 00       	and    $0x100,%eax
+  200de5:	85 c0                	test   %eax,%eax
+  200de7:	74 1d                	je     200e06 <printer_vprintf+0x7f9>
+            prefix = (base == -16 ? "0x" : "0X");
+  200de9:	83 7d e0 f0          	cmpl   $0xfffffff0,-0x20(%rbp)
+  200ded:	75 09                	jne    200df8 <printer_vprintf+0x7eb>
+  200def:	48 8d 05 77 12 00 00 	lea    0x1277(%rip),%rax        # 20206d <flag_chars+0xd>
+  200df6:	eb 07                	jmp    200dff <printer_vprintf+0x7f2>
+  200df8:	48 8d 05 71 12 00 00 	lea    0x1271(%rip),%rax        # 202070 <flag_chars+0x10>
+  200dff:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  200e03:	eb 01                	jmp    200e06 <printer_vprintf+0x7f9>
+            if (flags & FLAG_NEGATIVE) {
+  200e05:	90                   	nop
+        }
+
+        int len;
+        if (precision >= 0 && !(flags & FLAG_NUMERIC)) {
+  200e06:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  200e0a:	78 24                	js     200e30 <printer_vprintf+0x823>
+  200e0c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200e0f:	83 e0 20             	and    $0x20,%eax
+  200e12:	85 c0                	test   %eax,%eax
+  200e14:	75 1a                	jne    200e30 <printer_vprintf+0x823>
+            len = strnlen(data, precision);
+  200e16:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  200e19:	48 63 d0             	movslq %eax,%rdx
+  200e1c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200e20:	48 89 d6             	mov    %rdx,%rsi
+  200e23:	48 89 c7             	mov    %rax,%rdi
+  200e26:	e8 8a f5 ff ff       	call   2003b5 <strnlen>
+  200e2b:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  200e2e:	eb 0f                	jmp    200e3f <printer_vprintf+0x832>
+        } else {
+            len = strlen(data);
+  200e30:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200e34:	48 89 c7             	mov    %rax,%rdi
+  200e37:	e8 48 f5 ff ff       	call   200384 <strlen>
+  200e3c:	89 45 bc             	mov    %eax,-0x44(%rbp)
+        }
+        int zeros;
+        if ((flags & FLAG_NUMERIC) && precision >= 0) {
+  200e3f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200e42:	83 e0 20             	and    $0x20,%eax
+  200e45:	85 c0                	test   %eax,%eax
+  200e47:	74 20                	je     200e69 <printer_vprintf+0x85c>
+  200e49:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  200e4d:	78 1a                	js     200e69 <printer_vprintf+0x85c>
+            zeros = precision > len ? precision - len : 0;
+  200e4f:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  200e52:	3b 45 bc             	cmp    -0x44(%rbp),%eax
+  200e55:	7e 08                	jle    200e5f <printer_vprintf+0x852>
+  200e57:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  200e5a:	2b 45 bc             	sub    -0x44(%rbp),%eax
+  200e5d:	eb 05                	jmp    200e64 <printer_vprintf+0x857>
+  200e5f:	b8 00 00 00 00       	mov    $0x0,%eax
+  200e64:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  200e67:	eb 5c                	jmp    200ec5 <printer_vprintf+0x8b8>
+        } else if ((flags & FLAG_NUMERIC) && (flags & FLAG_ZERO)
+  200e69:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200e6c:	83 e0 20             	and    $0x20,%eax
+  200e6f:	85 c0                	test   %eax,%eax
+  200e71:	74 4b                	je     200ebe <printer_vprintf+0x8b1>
+  200e73:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200e76:	83 e0 02             	and    $0x2,%eax
+  200e79:	85 c0                	test   %eax,%eax
+  200e7b:	74 41                	je     200ebe <printer_vprintf+0x8b1>
+                   && !(flags & FLAG_LEFTJUSTIFY)
+  200e7d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200e80:	83 e0 04             	and    $0x4,%eax
+  200e83:	85 c0                	test   %eax,%eax
+  200e85:	75 37                	jne    200ebe <printer_vprintf+0x8b1>
+                   && len + (int) strlen(prefix) < width) {
+  200e87:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  200e8b:	48 89 c7             	mov    %rax,%rdi
+  200e8e:	e8 f1 f4 ff ff       	call   200384 <strlen>
+  200e93:	89 c2                	mov    %eax,%edx
+  200e95:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  200e98:	01 d0                	add    %edx,%eax
+  200e9a:	39 45 e8             	cmp    %eax,-0x18(%rbp)
+  200e9d:	7e 1f                	jle    200ebe <printer_vprintf+0x8b1>
+            zeros = width - len - strlen(prefix);
+  200e9f:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  200ea2:	2b 45 bc             	sub    -0x44(%rbp),%eax
+  200ea5:	89 c3                	mov    %eax,%ebx
+  200ea7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  200eab:	48 89 c7             	mov    %rax,%rdi
+  200eae:	e8 d1 f4 ff ff       	call   200384 <strlen>
+  200eb3:	89 c2                	mov    %eax,%edx
+  200eb5:	89 d8                	mov    %ebx,%eax
+  200eb7:	29 d0                	sub    %edx,%eax
+  200eb9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  200ebc:	eb 07                	jmp    200ec5 <printer_vprintf+0x8b8>
+        } else {
+            zeros = 0;
+  200ebe:	c7 45 b8 00 00 00 00 	movl   $0x0,-0x48(%rbp)
+        }
+        width -= len + zeros + strlen(prefix);
+  200ec5:	8b 55 bc             	mov    -0x44(%rbp),%edx
+  200ec8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  200ecb:	01 d0                	add    %edx,%eax
+  200ecd:	48 63 d8             	movslq %eax,%rbx
+  200ed0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  200ed4:	48 89 c7             	mov    %rax,%rdi
+  200ed7:	e8 a8 f4 ff ff       	call   200384 <strlen>
+  200edc:	48 8d 14 03          	lea    (%rbx,%rax,1),%rdx
+  200ee0:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  200ee3:	29 d0                	sub    %edx,%eax
+  200ee5:	89 45 e8             	mov    %eax,-0x18(%rbp)
+        for (; !(flags & FLAG_LEFTJUSTIFY) && width > 0; --width) {
+  200ee8:	eb 25                	jmp    200f0f <printer_vprintf+0x902>
+            p->putc(p, ' ', color);
+  200eea:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200ef1:	48 8b 08             	mov    (%rax),%rcx
+  200ef4:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  200efa:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200f01:	be 20 00 00 00       	mov    $0x20,%esi
+  200f06:	48 89 c7             	mov    %rax,%rdi
+  200f09:	ff d1                	call   *%rcx
+        for (; !(flags & FLAG_LEFTJUSTIFY) && width > 0; --width) {
+  200f0b:	83 6d e8 01          	subl   $0x1,-0x18(%rbp)
+  200f0f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200f12:	83 e0 04             	and    $0x4,%eax
+  200f15:	85 c0                	test   %eax,%eax
+  200f17:	75 36                	jne    200f4f <printer_vprintf+0x942>
+  200f19:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  200f1d:	7f cb                	jg     200eea <printer_vprintf+0x8dd>
+        }
+        for (; *prefix; ++prefix) {
+  200f1f:	eb 2e                	jmp    200f4f <printer_vprintf+0x942>
+            p->putc(p, *prefix, color);
+  200f21:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200f28:	4c 8b 00             	mov    (%rax),%r8
+  200f2b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  200f2f:	0f b6 00             	movzbl (%rax),%eax
+  200f32:	0f b6 c8             	movzbl %al,%ecx
+  200f35:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  200f3b:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200f42:	89 ce                	mov    %ecx,%esi
+  200f44:	48 89 c7             	mov    %rax,%rdi
+  200f47:	41 ff d0             	call   *%r8
+        for (; *prefix; ++prefix) {
+  200f4a:	48 83 45 c0 01       	addq   $0x1,-0x40(%rbp)
+  200f4f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  200f53:	0f b6 00             	movzbl (%rax),%eax
+  200f56:	84 c0                	test   %al,%al
+  200f58:	75 c7                	jne    200f21 <printer_vprintf+0x914>
+        }
+        for (; zeros > 0; --zeros) {
+  200f5a:	eb 25                	jmp    200f81 <printer_vprintf+0x974>
+            p->putc(p, '0', color);
+  200f5c:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200f63:	48 8b 08             	mov    (%rax),%rcx
+  200f66:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  200f6c:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200f73:	be 30 00 00 00       	mov    $0x30,%esi
+  200f78:	48 89 c7             	mov    %rax,%rdi
+  200f7b:	ff d1                	call   *%rcx
+        for (; zeros > 0; --zeros) {
+  200f7d:	83 6d b8 01          	subl   $0x1,-0x48(%rbp)
+  200f81:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  200f85:	7f d5                	jg     200f5c <printer_vprintf+0x94f>
+        }
+        for (; len > 0; ++data, --len) {
+  200f87:	eb 32                	jmp    200fbb <printer_vprintf+0x9ae>
+            p->putc(p, *data, color);
+  200f89:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200f90:	4c 8b 00             	mov    (%rax),%r8
+  200f93:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200f97:	0f b6 00             	movzbl (%rax),%eax
+  200f9a:	0f b6 c8             	movzbl %al,%ecx
+  200f9d:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  200fa3:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200faa:	89 ce                	mov    %ecx,%esi
+  200fac:	48 89 c7             	mov    %rax,%rdi
+  200faf:	41 ff d0             	call   *%r8
+        for (; len > 0; ++data, --len) {
+  200fb2:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  200fb7:	83 6d bc 01          	subl   $0x1,-0x44(%rbp)
+  200fbb:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+  200fbf:	7f c8                	jg     200f89 <printer_vprintf+0x97c>
+        }
+        for (; width > 0; --width) {
+  200fc1:	eb 25                	jmp    200fe8 <printer_vprintf+0x9db>
+            p->putc(p, ' ', color);
+  200fc3:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200fca:	48 8b 08             	mov    (%rax),%rcx
+  200fcd:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  200fd3:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200fda:	be 20 00 00 00       	mov    $0x20,%esi
+  200fdf:	48 89 c7             	mov    %rax,%rdi
+  200fe2:	ff d1                	call   *%rcx
+        for (; width > 0; --width) {
+  200fe4:	83 6d e8 01          	subl   $0x1,-0x18(%rbp)
+  200fe8:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  200fec:	7f d5                	jg     200fc3 <printer_vprintf+0x9b6>
+        }
+    done: ;
+  200fee:	90                   	nop
+    for (; *format; ++format) {
+  200fef:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  200ff6:	01 
+  200ff7:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200ffe:	0f b6 00             	movzbl (%rax),%eax
+  201001:	84 c0                	test   %al,%al
+  201003:	0f 85 30 f6 ff ff    	jne    200639 <printer_vprintf+0x2c>
+    }
+}
+  201009:	90                   	nop
+  20100a:	90                   	nop
+  20100b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  20100f:	c9                   	leave
+  201010:	c3                   	ret
+
+0000000000201011 <console_putc>:
+typedef struct console_printer {
+    printer p;
+    uint16_t* cursor;
+} console_printer;
+
+static void console_putc(printer* p, unsigned char c, int color) {
+  201011:	55                   	push   %rbp
+  201012:	48 89 e5             	mov    %rsp,%rbp
+  201015:	48 83 ec 30          	sub    $0x30,%rsp
+  201019:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  20101d:	89 f0                	mov    %esi,%eax
+  20101f:	89 55 d0             	mov    %edx,-0x30(%rbp)
+  201022:	88 45 d4             	mov    %al,-0x2c(%rbp)
+    console_printer* cp = (console_printer*) p;
+  201025:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  201029:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    /*if (cp->cursor >= console + CONSOLE_ROWS * CONSOLE_COLUMNS) {
+        cp->cursor = console;
+    }*/
+    if (c == '\n') {
+  20102d:	80 7d d4 0a          	cmpb   $0xa,-0x2c(%rbp)
+  201031:	75 7f                	jne    2010b2 <console_putc+0xa1>
+        int pos = (cp->cursor - console) % CONSOLE_COLUMNS;
+  201033:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201037:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  20103b:	48 8d 05 be 6f eb ff 	lea    -0x149042(%rip),%rax        # b8000 <console>
+  201042:	48 29 c2             	sub    %rax,%rdx
+  201045:	48 89 d0             	mov    %rdx,%rax
+  201048:	48 d1 f8             	sar    %rax
+  20104b:	48 89 c1             	mov    %rax,%rcx
+  20104e:	48 ba 67 66 66 66 66 	movabs $0x6666666666666667,%rdx
+  201055:	66 66 66 
+  201058:	48 89 c8             	mov    %rcx,%rax
+  20105b:	48 f7 ea             	imul   %rdx
+  20105e:	48 c1 fa 05          	sar    $0x5,%rdx
+  201062:	48 89 c8             	mov    %rcx,%rax
+  201065:	48 c1 f8 3f          	sar    $0x3f,%rax
+  201069:	48 29 c2             	sub    %rax,%rdx
+  20106c:	48 89 d0             	mov    %rdx,%rax
+  20106f:	48 c1 e0 02          	shl    $0x2,%rax
+  201073:	48 01 d0             	add    %rdx,%rax
+  201076:	48 c1 e0 04          	shl    $0x4,%rax
+  20107a:	48 29 c1             	sub    %rax,%rcx
+  20107d:	48 89 ca             	mov    %rcx,%rdx
+  201080:	89 55 fc             	mov    %edx,-0x4(%rbp)
+        for (; pos != CONSOLE_COLUMNS; pos++) {
+  201083:	eb 25                	jmp    2010aa <console_putc+0x99>
+            *cp->cursor++ = ' ' | color;
+  201085:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  201088:	83 c8 20             	or     $0x20,%eax
+  20108b:	89 c6                	mov    %eax,%esi
+  20108d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201091:	48 8b 40 08          	mov    0x8(%rax),%rax
+  201095:	48 8d 48 02          	lea    0x2(%rax),%rcx
+  201099:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  20109d:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  2010a1:	89 f2                	mov    %esi,%edx
+  2010a3:	66 89 10             	mov    %dx,(%rax)
+        for (; pos != CONSOLE_COLUMNS; pos++) {
+  2010a6:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  2010aa:	83 7d fc 50          	cmpl   $0x50,-0x4(%rbp)
+  2010ae:	75 d5                	jne    201085 <console_putc+0x74>
+  2010b0:	eb 69                	jmp    20111b <console_putc+0x10a>
+        }
+    } else if (c == '\b') {
+  2010b2:	80 7d d4 08          	cmpb   $0x8,-0x2c(%rbp)
+  2010b6:	75 3f                	jne    2010f7 <console_putc+0xe6>
+        if (cp->cursor != console) {
+  2010b8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2010bc:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  2010c0:	48 8d 05 39 6f eb ff 	lea    -0x1490c7(%rip),%rax        # b8000 <console>
+  2010c7:	48 39 c2             	cmp    %rax,%rdx
+  2010ca:	74 4f                	je     20111b <console_putc+0x10a>
+            *(--cp->cursor) = ' ' | color;
+  2010cc:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  2010cf:	83 c8 20             	or     $0x20,%eax
+  2010d2:	89 c1                	mov    %eax,%ecx
+  2010d4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2010d8:	48 8b 40 08          	mov    0x8(%rax),%rax
+  2010dc:	48 8d 50 fe          	lea    -0x2(%rax),%rdx
+  2010e0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2010e4:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  2010e8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2010ec:	48 8b 40 08          	mov    0x8(%rax),%rax
+  2010f0:	89 ca                	mov    %ecx,%edx
+  2010f2:	66 89 10             	mov    %dx,(%rax)
+  2010f5:	eb 24                	jmp    20111b <console_putc+0x10a>
+        }
+    } else {
+        *cp->cursor++ = c | color;
+  2010f7:	0f b6 45 d4          	movzbl -0x2c(%rbp),%eax
+  2010fb:	8b 55 d0             	mov    -0x30(%rbp),%edx
+  2010fe:	09 d0                	or     %edx,%eax
+  201100:	89 c6                	mov    %eax,%esi
+  201102:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201106:	48 8b 40 08          	mov    0x8(%rax),%rax
+  20110a:	48 8d 48 02          	lea    0x2(%rax),%rcx
+  20110e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  201112:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  201116:	89 f2                	mov    %esi,%edx
+  201118:	66 89 10             	mov    %dx,(%rax)
+    }
+
+    const int MAX_ROWS = CONSOLE_ROWS - 2;
+  20111b:	c7 45 e4 17 00 00 00 	movl   $0x17,-0x1c(%rbp)
+
+    if (cp->cursor == console + MAX_ROWS * CONSOLE_COLUMNS) {
+  201122:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201126:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  20112a:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  20112d:	89 d0                	mov    %edx,%eax
+  20112f:	c1 e0 02             	shl    $0x2,%eax
+  201132:	01 d0                	add    %edx,%eax
+  201134:	c1 e0 04             	shl    $0x4,%eax
+  201137:	48 98                	cltq
+  201139:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  20113d:	48 8d 05 bc 6e eb ff 	lea    -0x149144(%rip),%rax        # b8000 <console>
+  201144:	48 01 d0             	add    %rdx,%rax
+  201147:	48 39 c1             	cmp    %rax,%rcx
+  20114a:	0f 85 ac 00 00 00    	jne    2011fc <console_putc+0x1eb>
+        // Move all characters up by one row, forgetting the first row
+        for (int i = 0; i < (MAX_ROWS - 1) * CONSOLE_COLUMNS; ++i) {
+  201150:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  201157:	eb 30                	jmp    201189 <console_putc+0x178>
+            console[i] = console[i + CONSOLE_COLUMNS];
+  201159:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  20115c:	83 c0 50             	add    $0x50,%eax
+  20115f:	48 98                	cltq
+  201161:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  201165:	48 8d 05 94 6e eb ff 	lea    -0x14916c(%rip),%rax        # b8000 <console>
+  20116c:	0f b7 04 02          	movzwl (%rdx,%rax,1),%eax
+  201170:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  201173:	48 63 d2             	movslq %edx,%rdx
+  201176:	48 8d 0c 12          	lea    (%rdx,%rdx,1),%rcx
+  20117a:	48 8d 15 7f 6e eb ff 	lea    -0x149181(%rip),%rdx        # b8000 <console>
+  201181:	66 89 04 11          	mov    %ax,(%rcx,%rdx,1)
+        for (int i = 0; i < (MAX_ROWS - 1) * CONSOLE_COLUMNS; ++i) {
+  201185:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+  201189:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  20118c:	8d 50 ff             	lea    -0x1(%rax),%edx
+  20118f:	89 d0                	mov    %edx,%eax
+  201191:	c1 e0 02             	shl    $0x2,%eax
+  201194:	01 d0                	add    %edx,%eax
+  201196:	c1 e0 04             	shl    $0x4,%eax
+  201199:	39 45 f8             	cmp    %eax,-0x8(%rbp)
+  20119c:	7c bb                	jl     201159 <console_putc+0x148>
+        }
+
+        // Fill last column with space
+        for (int i = (MAX_ROWS - 1) * CONSOLE_COLUMNS; i < MAX_ROWS * CONSOLE_COLUMNS; ++i) {
+  20119e:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  2011a1:	8d 50 ff             	lea    -0x1(%rax),%edx
+  2011a4:	89 d0                	mov    %edx,%eax
+  2011a6:	c1 e0 02             	shl    $0x2,%eax
+  2011a9:	01 d0                	add    %edx,%eax
+  2011ab:	c1 e0 04             	shl    $0x4,%eax
+  2011ae:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  2011b1:	eb 20                	jmp    2011d3 <console_putc+0x1c2>
+            console[i] = ' ' | color;
+  2011b3:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  2011b6:	83 c8 20             	or     $0x20,%eax
+  2011b9:	89 c1                	mov    %eax,%ecx
+  2011bb:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  2011be:	48 98                	cltq
+  2011c0:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  2011c4:	48 8d 05 35 6e eb ff 	lea    -0x1491cb(%rip),%rax        # b8000 <console>
+  2011cb:	66 89 0c 02          	mov    %cx,(%rdx,%rax,1)
+        for (int i = (MAX_ROWS - 1) * CONSOLE_COLUMNS; i < MAX_ROWS * CONSOLE_COLUMNS; ++i) {
+  2011cf:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  2011d3:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  2011d6:	89 d0                	mov    %edx,%eax
+  2011d8:	c1 e0 02             	shl    $0x2,%eax
+  2011db:	01 d0                	add    %edx,%eax
+  2011dd:	c1 e0 04             	shl    $0x4,%eax
+  2011e0:	39 45 f4             	cmp    %eax,-0xc(%rbp)
+  2011e3:	7c ce                	jl     2011b3 <console_putc+0x1a2>
+        }
+
+        cp->cursor -= CONSOLE_COLUMNS;
+  2011e5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2011e9:	48 8b 40 08          	mov    0x8(%rax),%rax
+  2011ed:	48 8d 90 60 ff ff ff 	lea    -0xa0(%rax),%rdx
+  2011f4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2011f8:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    }
+}
+  2011fc:	90                   	nop
+  2011fd:	c9                   	leave
+  2011fe:	c3                   	ret
+
+00000000002011ff <console_vprintf>:
+
+int console_vprintf(int cpos, int color, const char* format, va_list val) {
+  2011ff:	55                   	push   %rbp
+  201200:	48 89 e5             	mov    %rsp,%rbp
+  201203:	48 83 ec 30          	sub    $0x30,%rsp
+  201207:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  20120a:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  20120d:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  201211:	48 89 4d d8          	mov    %rcx,-0x28(%rbp)
+    struct console_printer cp;
+    cp.p.putc = console_putc;
+  201215:	48 8d 05 f5 fd ff ff 	lea    -0x20b(%rip),%rax        # 201011 <console_putc>
+  20121c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (cpos < 0 || cpos >= CONSOLE_ROWS * CONSOLE_COLUMNS) {
+  201220:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  201224:	78 09                	js     20122f <console_vprintf+0x30>
+  201226:	81 7d ec cf 07 00 00 	cmpl   $0x7cf,-0x14(%rbp)
+  20122d:	7e 07                	jle    201236 <console_vprintf+0x37>
+        cpos = 0;
+  20122f:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+    }
+    cp.cursor = console + cpos;
+  201236:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  201239:	48 98                	cltq
+  20123b:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  20123f:	48 8d 05 ba 6d eb ff 	lea    -0x149246(%rip),%rax        # b8000 <console>
+  201246:	48 01 d0             	add    %rdx,%rax
+  201249:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    printer_vprintf(&cp.p, color, format, val);
+  20124d:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  201251:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  201255:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  201258:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  20125c:	48 89 c7             	mov    %rax,%rdi
+  20125f:	e8 a9 f3 ff ff       	call   20060d <printer_vprintf>
+    return cp.cursor - console;
+  201264:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  201268:	48 8d 05 91 6d eb ff 	lea    -0x14926f(%rip),%rax        # b8000 <console>
+  20126f:	48 29 c2             	sub    %rax,%rdx
+  201272:	48 89 d0             	mov    %rdx,%rax
+  201275:	48 d1 f8             	sar    %rax
+}
+  201278:	c9                   	leave
+  201279:	c3                   	ret
+
+000000000020127a <console_printf>:
+
+int console_printf(int cpos, int color, const char* format, ...) {
+  20127a:	55                   	push   %rbp
+  20127b:	48 89 e5             	mov    %rsp,%rbp
+  20127e:	48 83 ec 60          	sub    $0x60,%rsp
+  201282:	89 7d ac             	mov    %edi,-0x54(%rbp)
+  201285:	89 75 a8             	mov    %esi,-0x58(%rbp)
+  201288:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+  20128c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  201290:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  201294:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list val;
+    va_start(val, format);
+  201298:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  20129f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  2012a3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  2012a7:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  2012ab:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    cpos = console_vprintf(cpos, color, format, val);
+  2012af:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  2012b3:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  2012b7:	8b 75 a8             	mov    -0x58(%rbp),%esi
+  2012ba:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  2012bd:	89 c7                	mov    %eax,%edi
+  2012bf:	e8 3b ff ff ff       	call   2011ff <console_vprintf>
+  2012c4:	89 45 ac             	mov    %eax,-0x54(%rbp)
+    va_end(val);
+    return cpos;
+  2012c7:	8b 45 ac             	mov    -0x54(%rbp),%eax
+}
+  2012ca:	c9                   	leave
+  2012cb:	c3                   	ret
+
+00000000002012cc <string_putc>:
+    printer p;
+    char* s;
+    char* end;
+} string_printer;
+
+static void string_putc(printer* p, unsigned char c, int color) {
+  2012cc:	55                   	push   %rbp
+  2012cd:	48 89 e5             	mov    %rsp,%rbp
+  2012d0:	48 83 ec 20          	sub    $0x20,%rsp
+  2012d4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  2012d8:	89 f0                	mov    %esi,%eax
+  2012da:	89 55 e0             	mov    %edx,-0x20(%rbp)
+  2012dd:	88 45 e4             	mov    %al,-0x1c(%rbp)
+    string_printer* sp = (string_printer*) p;
+  2012e0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2012e4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (sp->s < sp->end) {
+  2012e8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2012ec:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  2012f0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2012f4:	48 8b 40 10          	mov    0x10(%rax),%rax
+  2012f8:	48 39 c2             	cmp    %rax,%rdx
+  2012fb:	73 1a                	jae    201317 <string_putc+0x4b>
+        *sp->s++ = c;
+  2012fd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  201301:	48 8b 40 08          	mov    0x8(%rax),%rax
+  201305:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  201309:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  20130d:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  201311:	0f b6 55 e4          	movzbl -0x1c(%rbp),%edx
+  201315:	88 10                	mov    %dl,(%rax)
+    }
+    (void) color;
+}
+  201317:	90                   	nop
+  201318:	c9                   	leave
+  201319:	c3                   	ret
+
+000000000020131a <vsnprintf>:
+
+int vsnprintf(char* s, size_t size, const char* format, va_list val) {
+  20131a:	55                   	push   %rbp
+  20131b:	48 89 e5             	mov    %rsp,%rbp
+  20131e:	48 83 ec 40          	sub    $0x40,%rsp
+  201322:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  201326:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  20132a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  20132e:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+    string_printer sp;
+    sp.p.putc = string_putc;
+  201332:	48 8d 05 93 ff ff ff 	lea    -0x6d(%rip),%rax        # 2012cc <string_putc>
+  201339:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    sp.s = s;
+  20133d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  201341:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (size) {
+  201345:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  20134a:	74 33                	je     20137f <vsnprintf+0x65>
+        sp.end = s + size - 1;
+  20134c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  201350:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  201354:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  201358:	48 01 d0             	add    %rdx,%rax
+  20135b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+        printer_vprintf(&sp.p, 0, format, val);
+  20135f:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  201363:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  201367:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  20136b:	be 00 00 00 00       	mov    $0x0,%esi
+  201370:	48 89 c7             	mov    %rax,%rdi
+  201373:	e8 95 f2 ff ff       	call   20060d <printer_vprintf>
+        *sp.s = 0;
+  201378:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  20137c:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return sp.s - s;
+  20137f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  201383:	48 2b 45 d8          	sub    -0x28(%rbp),%rax
+}
+  201387:	c9                   	leave
+  201388:	c3                   	ret
+
+0000000000201389 <snprintf>:
+
+int snprintf(char* s, size_t size, const char* format, ...) {
+  201389:	55                   	push   %rbp
+  20138a:	48 89 e5             	mov    %rsp,%rbp
+  20138d:	48 83 ec 70          	sub    $0x70,%rsp
+  201391:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  201395:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  201399:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  20139d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  2013a1:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  2013a5:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list val;
+    va_start(val, format);
+  2013a9:	c7 45 b0 18 00 00 00 	movl   $0x18,-0x50(%rbp)
+  2013b0:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  2013b4:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  2013b8:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  2013bc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    int n = vsnprintf(s, size, format, val);
+  2013c0:	48 8d 4d b0          	lea    -0x50(%rbp),%rcx
+  2013c4:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  2013c8:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  2013cc:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  2013d0:	48 89 c7             	mov    %rax,%rdi
+  2013d3:	e8 42 ff ff ff       	call   20131a <vsnprintf>
+  2013d8:	89 45 cc             	mov    %eax,-0x34(%rbp)
+    va_end(val);
+    return n;
+  2013db:	8b 45 cc             	mov    -0x34(%rbp),%eax
+}
+  2013de:	c9                   	leave
+  2013df:	c3                   	ret
+
+00000000002013e0 <console_clear>:
+
+
+// console_clear
+//    Erases the console and moves the cursor to the upper left (CPOS(0, 0)).
+
+void console_clear(void) {
+  2013e0:	55                   	push   %rbp
+  2013e1:	48 89 e5             	mov    %rsp,%rbp
+  2013e4:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < CONSOLE_ROWS * CONSOLE_COLUMNS; ++i) {
+  2013e8:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  2013ef:	eb 1a                	jmp    20140b <console_clear+0x2b>
+        console[i] = ' ' | 0x0700;
+  2013f1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  2013f4:	48 98                	cltq
+  2013f6:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  2013fa:	48 8d 05 ff 6b eb ff 	lea    -0x149401(%rip),%rax        # b8000 <console>
+  201401:	66 c7 04 02 20 07    	movw   $0x720,(%rdx,%rax,1)
+    for (int i = 0; i < CONSOLE_ROWS * CONSOLE_COLUMNS; ++i) {
+  201407:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  20140b:	81 7d fc cf 07 00 00 	cmpl   $0x7cf,-0x4(%rbp)
+  201412:	7e dd                	jle    2013f1 <console_clear+0x11>
+    }
+    cursorpos = 0;
+  201414:	c7 05 de 7b eb ff 00 	movl   $0x0,-0x148422(%rip)        # b8ffc <cursorpos>
+  20141b:	00 00 00 
+}
+  20141e:	90                   	nop
+  20141f:	c9                   	leave
+  201420:	c3                   	ret
+
+0000000000201421 <string_to_char>:
+
+
+int string_to_char(const char *str, int *dest) {
+  201421:	55                   	push   %rbp
+  201422:	48 89 e5             	mov    %rsp,%rbp
+  201425:	48 83 ec 20          	sub    $0x20,%rsp
+  201429:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  20142d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    if (*str == '\0') return -1;
+  201431:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201435:	0f b6 00             	movzbl (%rax),%eax
+  201438:	84 c0                	test   %al,%al
+  20143a:	75 0a                	jne    201446 <string_to_char+0x25>
+  20143c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  201441:	e9 e0 00 00 00       	jmp    201526 <string_to_char+0x105>
+
+    *dest = 0;
+  201446:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  20144a:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    for (; *str; str++) {
+  201450:	e9 bd 00 00 00       	jmp    201512 <string_to_char+0xf1>
+        int digit = 0;
+  201455:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+        switch (*str)
+  20145c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201460:	0f b6 00             	movzbl (%rax),%eax
+  201463:	0f be c0             	movsbl %al,%eax
+  201466:	83 e8 30             	sub    $0x30,%eax
+  201469:	83 f8 09             	cmp    $0x9,%eax
+  20146c:	77 7c                	ja     2014ea <string_to_char+0xc9>
+  20146e:	89 c0                	mov    %eax,%eax
+  201470:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  201477:	00 
+  201478:	48 8d 05 d5 0c 00 00 	lea    0xcd5(%rip),%rax        # 202154 <flag_chars+0xf4>
+  20147f:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+  201482:	48 98                	cltq
+  201484:	48 8d 15 c9 0c 00 00 	lea    0xcc9(%rip),%rdx        # 202154 <flag_chars+0xf4>
+  20148b:	48 01 d0             	add    %rdx,%rax
+  20148e:	ff e0                	jmp    *%rax
+        {
+        case '0':
+            digit = 0;
+  201490:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+            break;
+  201497:	eb 58                	jmp    2014f1 <string_to_char+0xd0>
+        case '1':
+            digit = 1;
+  201499:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+            break;
+  2014a0:	eb 4f                	jmp    2014f1 <string_to_char+0xd0>
+        case '2':
+            digit = 2;
+  2014a2:	c7 45 fc 02 00 00 00 	movl   $0x2,-0x4(%rbp)
+            break;
+  2014a9:	eb 46                	jmp    2014f1 <string_to_char+0xd0>
+        case '3':
+            digit = 3;
+  2014ab:	c7 45 fc 03 00 00 00 	movl   $0x3,-0x4(%rbp)
+            break;
+  2014b2:	eb 3d                	jmp    2014f1 <string_to_char+0xd0>
+        case '4':
+            digit = 4;
+  2014b4:	c7 45 fc 04 00 00 00 	movl   $0x4,-0x4(%rbp)
+            break;
+  2014bb:	eb 34                	jmp    2014f1 <string_to_char+0xd0>
+        case '5':
+            digit = 5;
+  2014bd:	c7 45 fc 05 00 00 00 	movl   $0x5,-0x4(%rbp)
+            break;
+  2014c4:	eb 2b                	jmp    2014f1 <string_to_char+0xd0>
+        case '6':
+            digit = 6;
+  2014c6:	c7 45 fc 06 00 00 00 	movl   $0x6,-0x4(%rbp)
+            break;
+  2014cd:	eb 22                	jmp    2014f1 <string_to_char+0xd0>
+        case '7':
+            digit = 7;
+  2014cf:	c7 45 fc 07 00 00 00 	movl   $0x7,-0x4(%rbp)
+            break;
+  2014d6:	eb 19                	jmp    2014f1 <string_to_char+0xd0>
+        case '8':
+            digit = 8;
+  2014d8:	c7 45 fc 08 00 00 00 	movl   $0x8,-0x4(%rbp)
+            break;
+  2014df:	eb 10                	jmp    2014f1 <string_to_char+0xd0>
+        case '9':
+            digit = 9;
+  2014e1:	c7 45 fc 09 00 00 00 	movl   $0x9,-0x4(%rbp)
+            break;
+  2014e8:	eb 07                	jmp    2014f1 <string_to_char+0xd0>
+        default:
+            return -1;
+  2014ea:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  2014ef:	eb 35                	jmp    201526 <string_to_char+0x105>
+        }
+
+        *dest = *dest * 10 + digit;
+  2014f1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  2014f5:	8b 10                	mov    (%rax),%edx
+  2014f7:	89 d0                	mov    %edx,%eax
+  2014f9:	c1 e0 02             	shl    $0x2,%eax
+  2014fc:	01 d0                	add    %edx,%eax
+  2014fe:	01 c0                	add    %eax,%eax
+  201500:	89 c2                	mov    %eax,%edx
+  201502:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  201505:	01 c2                	add    %eax,%edx
+  201507:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  20150b:	89 10                	mov    %edx,(%rax)
+    for (; *str; str++) {
+  20150d:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  201512:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201516:	0f b6 00             	movzbl (%rax),%eax
+  201519:	84 c0                	test   %al,%al
+  20151b:	0f 85 34 ff ff ff    	jne    201455 <string_to_char+0x34>
+    }
+
+    return 0;
+  201521:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  201526:	c9                   	leave
+  201527:	c3                   	ret
+
+0000000000201528 <atoi>:
+
+int atoi(const char *str) {
+  201528:	55                   	push   %rbp
+  201529:	48 89 e5             	mov    %rsp,%rbp
+  20152c:	48 83 ec 18          	sub    $0x18,%rsp
+  201530:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    if (*str == '\0') return -1;
+  201534:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201538:	0f b6 00             	movzbl (%rax),%eax
+  20153b:	84 c0                	test   %al,%al
+  20153d:	75 0a                	jne    201549 <atoi+0x21>
+  20153f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  201544:	e9 d7 00 00 00       	jmp    201620 <atoi+0xf8>
+
+    int n = 0;
+  201549:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    for (; *str; str++) {
+  201550:	e9 b7 00 00 00       	jmp    20160c <atoi+0xe4>
+        int digit = 0;
+  201555:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+        switch (*str)
+  20155c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201560:	0f b6 00             	movzbl (%rax),%eax
+  201563:	0f be c0             	movsbl %al,%eax
+  201566:	83 e8 30             	sub    $0x30,%eax
+  201569:	83 f8 09             	cmp    $0x9,%eax
+  20156c:	77 7c                	ja     2015ea <atoi+0xc2>
+  20156e:	89 c0                	mov    %eax,%eax
+  201570:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  201577:	00 
+  201578:	48 8d 05 fd 0b 00 00 	lea    0xbfd(%rip),%rax        # 20217c <flag_chars+0x11c>
+  20157f:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+  201582:	48 98                	cltq
+  201584:	48 8d 15 f1 0b 00 00 	lea    0xbf1(%rip),%rdx        # 20217c <flag_chars+0x11c>
+  20158b:	48 01 d0             	add    %rdx,%rax
+  20158e:	ff e0                	jmp    *%rax
+        {
+        case '0':
+            digit = 0;
+  201590:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+            break;
+  201597:	eb 58                	jmp    2015f1 <atoi+0xc9>
+        case '1':
+            digit = 1;
+  201599:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+            break;
+  2015a0:	eb 4f                	jmp    2015f1 <atoi+0xc9>
+        case '2':
+            digit = 2;
+  2015a2:	c7 45 f8 02 00 00 00 	movl   $0x2,-0x8(%rbp)
+            break;
+  2015a9:	eb 46                	jmp    2015f1 <atoi+0xc9>
+        case '3':
+            digit = 3;
+  2015ab:	c7 45 f8 03 00 00 00 	movl   $0x3,-0x8(%rbp)
+            break;
+  2015b2:	eb 3d                	jmp    2015f1 <atoi+0xc9>
+        case '4':
+            digit = 4;
+  2015b4:	c7 45 f8 04 00 00 00 	movl   $0x4,-0x8(%rbp)
+            break;
+  2015bb:	eb 34                	jmp    2015f1 <atoi+0xc9>
+        case '5':
+            digit = 5;
+  2015bd:	c7 45 f8 05 00 00 00 	movl   $0x5,-0x8(%rbp)
+            break;
+  2015c4:	eb 2b                	jmp    2015f1 <atoi+0xc9>
+        case '6':
+            digit = 6;
+  2015c6:	c7 45 f8 06 00 00 00 	movl   $0x6,-0x8(%rbp)
+            break;
+  2015cd:	eb 22                	jmp    2015f1 <atoi+0xc9>
+        case '7':
+            digit = 7;
+  2015cf:	c7 45 f8 07 00 00 00 	movl   $0x7,-0x8(%rbp)
+            break;
+  2015d6:	eb 19                	jmp    2015f1 <atoi+0xc9>
+        case '8':
+            digit = 8;
+  2015d8:	c7 45 f8 08 00 00 00 	movl   $0x8,-0x8(%rbp)
+            break;
+  2015df:	eb 10                	jmp    2015f1 <atoi+0xc9>
+        case '9':
+            digit = 9;
+  2015e1:	c7 45 f8 09 00 00 00 	movl   $0x9,-0x8(%rbp)
+            break;
+  2015e8:	eb 07                	jmp    2015f1 <atoi+0xc9>
+        default:
+            return -1;
+  2015ea:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  2015ef:	eb 2f                	jmp    201620 <atoi+0xf8>
+        }
+
+        n = n * 10 + digit;
+  2015f1:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  2015f4:	89 d0                	mov    %edx,%eax
+  2015f6:	c1 e0 02             	shl    $0x2,%eax
+  2015f9:	01 d0                	add    %edx,%eax
+  2015fb:	01 c0                	add    %eax,%eax
+  2015fd:	89 c2                	mov    %eax,%edx
+  2015ff:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  201602:	01 d0                	add    %edx,%eax
+  201604:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    for (; *str; str++) {
+  201607:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  20160c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201610:	0f b6 00             	movzbl (%rax),%eax
+  201613:	84 c0                	test   %al,%al
+  201615:	0f 85 3a ff ff ff    	jne    201555 <atoi+0x2d>
+    }
+
+    return 0;
+  20161b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  201620:	c9                   	leave
+  201621:	c3                   	ret
+
+0000000000201622 <copy_comp>:
+        components[ncomp++] = (comp); \
+    } \
+} while (0)
+
+// Helper to copy a component to dst
+void copy_comp(const char *start, const char *end, char **pdst) {
+  201622:	55                   	push   %rbp
+  201623:	48 89 e5             	mov    %rsp,%rbp
+  201626:	48 83 ec 18          	sub    $0x18,%rsp
+  20162a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  20162e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  201632:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    while (start < end) {
+  201636:	eb 23                	jmp    20165b <copy_comp+0x39>
+        *(*pdst)++ = *start++;
+  201638:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  20163c:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  201640:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  201644:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201648:	48 8b 00             	mov    (%rax),%rax
+  20164b:	48 8d 70 01          	lea    0x1(%rax),%rsi
+  20164f:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  201653:	48 89 31             	mov    %rsi,(%rcx)
+  201656:	0f b6 12             	movzbl (%rdx),%edx
+  201659:	88 10                	mov    %dl,(%rax)
+    while (start < end) {
+  20165b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20165f:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  201663:	72 d3                	jb     201638 <copy_comp+0x16>
+    }
+}
+  201665:	90                   	nop
+  201666:	90                   	nop
+  201667:	c9                   	leave
+  201668:	c3                   	ret
+
+0000000000201669 <join_path>:
+
+
+void join_path(const char *abs_path, const char *path, char *dst) {
+  201669:	55                   	push   %rbp
+  20166a:	48 89 e5             	mov    %rsp,%rbp
+  20166d:	48 81 ec 68 02 00 00 	sub    $0x268,%rsp
+  201674:	48 89 bd a8 fd ff ff 	mov    %rdi,-0x258(%rbp)
+  20167b:	48 89 b5 a0 fd ff ff 	mov    %rsi,-0x260(%rbp)
+  201682:	48 89 95 98 fd ff ff 	mov    %rdx,-0x268(%rbp)
+    // If path is absolute, just copy it to dst (removing duplicate slashes, and trailing slash unless root)
+    if (path[0] == '/') {
+  201689:	48 8b 85 a0 fd ff ff 	mov    -0x260(%rbp),%rax
+  201690:	0f b6 00             	movzbl (%rax),%eax
+  201693:	3c 2f                	cmp    $0x2f,%al
+  201695:	0f 85 d6 00 00 00    	jne    201771 <join_path+0x108>
+        const char *src = path;
+  20169b:	48 8b 85 a0 fd ff ff 	mov    -0x260(%rbp),%rax
+  2016a2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+        char *d = dst;
+  2016a6:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  2016ad:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+        // Always start with a single slash
+        *d++ = '/';
+  2016b1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2016b5:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  2016b9:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  2016bd:	c6 00 2f             	movb   $0x2f,(%rax)
+        src++;
+  2016c0:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+        int last_was_slash = 1;
+  2016c5:	c7 45 b0 01 00 00 00 	movl   $0x1,-0x50(%rbp)
+        while (*src) {
+  2016cc:	eb 64                	jmp    201732 <join_path+0xc9>
+            if (*src == '/') {
+  2016ce:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2016d2:	0f b6 00             	movzbl (%rax),%eax
+  2016d5:	3c 2f                	cmp    $0x2f,%al
+  2016d7:	75 35                	jne    20170e <join_path+0xa5>
+                // Skip consecutive slashes
+                while (*src == '/') src++;
+  2016d9:	eb 05                	jmp    2016e0 <join_path+0x77>
+  2016db:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  2016e0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2016e4:	0f b6 00             	movzbl (%rax),%eax
+  2016e7:	3c 2f                	cmp    $0x2f,%al
+  2016e9:	74 f0                	je     2016db <join_path+0x72>
+                if (*src == 0) break;
+  2016eb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2016ef:	0f b6 00             	movzbl (%rax),%eax
+  2016f2:	84 c0                	test   %al,%al
+  2016f4:	74 49                	je     20173f <join_path+0xd6>
+                *d++ = '/';
+  2016f6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2016fa:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  2016fe:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  201702:	c6 00 2f             	movb   $0x2f,(%rax)
+                last_was_slash = 1;
+  201705:	c7 45 b0 01 00 00 00 	movl   $0x1,-0x50(%rbp)
+  20170c:	eb 24                	jmp    201732 <join_path+0xc9>
+            } else {
+                *d++ = *src++;
+  20170e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  201712:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  201716:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  20171a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  20171e:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  201722:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  201726:	0f b6 12             	movzbl (%rdx),%edx
+  201729:	88 10                	mov    %dl,(%rax)
+                last_was_slash = 0;
+  20172b:	c7 45 b0 00 00 00 00 	movl   $0x0,-0x50(%rbp)
+        while (*src) {
+  201732:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  201736:	0f b6 00             	movzbl (%rax),%eax
+  201739:	84 c0                	test   %al,%al
+  20173b:	75 91                	jne    2016ce <join_path+0x65>
+  20173d:	eb 01                	jmp    201740 <join_path+0xd7>
+                if (*src == 0) break;
+  20173f:	90                   	nop
+            }
+        }
+        // Remove trailing slash unless the path is just "/"
+        if (d > dst + 1 && *(d-1) == '/') {
+  201740:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  201747:	48 83 c0 01          	add    $0x1,%rax
+  20174b:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  20174f:	73 14                	jae    201765 <join_path+0xfc>
+  201751:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  201755:	48 83 e8 01          	sub    $0x1,%rax
+  201759:	0f b6 00             	movzbl (%rax),%eax
+  20175c:	3c 2f                	cmp    $0x2f,%al
+  20175e:	75 05                	jne    201765 <join_path+0xfc>
+            d--;
+  201760:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+        }
+        *d = 0;
+  201765:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  201769:	c6 00 00             	movb   $0x0,(%rax)
+  20176c:	e9 e9 02 00 00       	jmp    201a5a <join_path+0x3f1>
+        return;
+    }
+
+    // Otherwise, start with abs_path
+    const char *src = abs_path;
+  201771:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  201778:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    char *d = dst;
+  20177c:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  201783:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    if (*src != '/') {
+  201787:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20178b:	0f b6 00             	movzbl (%rax),%eax
+  20178e:	3c 2f                	cmp    $0x2f,%al
+  201790:	74 2e                	je     2017c0 <join_path+0x157>
+        *d++ = '/';
+  201792:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  201796:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  20179a:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  20179e:	c6 00 2f             	movb   $0x2f,(%rax)
+    }
+    while (*src) {
+  2017a1:	eb 1d                	jmp    2017c0 <join_path+0x157>
+        *d++ = *src++;
+  2017a3:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  2017a7:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  2017ab:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  2017af:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  2017b3:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  2017b7:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  2017bb:	0f b6 12             	movzbl (%rdx),%edx
+  2017be:	88 10                	mov    %dl,(%rax)
+    while (*src) {
+  2017c0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2017c4:	0f b6 00             	movzbl (%rax),%eax
+  2017c7:	84 c0                	test   %al,%al
+  2017c9:	75 d8                	jne    2017a3 <join_path+0x13a>
+    }
+    // Remove trailing slash (unless root)
+    if (d > dst + 1 && *(d-1) == '/') {
+  2017cb:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  2017d2:	48 83 c0 01          	add    $0x1,%rax
+  2017d6:	48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+  2017da:	73 14                	jae    2017f0 <join_path+0x187>
+  2017dc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  2017e0:	48 83 e8 01          	sub    $0x1,%rax
+  2017e4:	0f b6 00             	movzbl (%rax),%eax
+  2017e7:	3c 2f                	cmp    $0x2f,%al
+  2017e9:	75 05                	jne    2017f0 <join_path+0x187>
+        d--;
+  2017eb:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+    }
+    *d = 0;
+  2017f0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  2017f4:	c6 00 00             	movb   $0x0,(%rax)
+
+    // Now, process path components
+    char temp[512];
+    int tlen = 0;
+  2017f7:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    // Copy dst to temp for easier manipulation
+    src = dst;
+  2017fe:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  201805:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    while (*src && tlen < (int)sizeof(temp)-1) {
+  201809:	eb 22                	jmp    20182d <join_path+0x1c4>
+        temp[tlen++] = *src++;
+  20180b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20180f:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  201813:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  201817:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  20181a:	8d 4a 01             	lea    0x1(%rdx),%ecx
+  20181d:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  201820:	0f b6 08             	movzbl (%rax),%ecx
+  201823:	48 63 c2             	movslq %edx,%rax
+  201826:	88 8c 05 b0 fd ff ff 	mov    %cl,-0x250(%rbp,%rax,1)
+    while (*src && tlen < (int)sizeof(temp)-1) {
+  20182d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201831:	0f b6 00             	movzbl (%rax),%eax
+  201834:	84 c0                	test   %al,%al
+  201836:	74 09                	je     201841 <join_path+0x1d8>
+  201838:	81 7d dc fe 01 00 00 	cmpl   $0x1fe,-0x24(%rbp)
+  20183f:	7e ca                	jle    20180b <join_path+0x1a2>
+    }
+    temp[tlen] = 0;
+  201841:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201844:	48 98                	cltq
+  201846:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  20184d:	00 
+
+    // Now, process each component in path
+    src = path;
+  20184e:	48 8b 85 a0 fd ff ff 	mov    -0x260(%rbp),%rax
+  201855:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    while (*src) {
+  201859:	e9 65 01 00 00       	jmp    2019c3 <join_path+0x35a>
+        // Skip slashes
+        while (*src == '/') src++;
+  20185e:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  201863:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201867:	0f b6 00             	movzbl (%rax),%eax
+  20186a:	3c 2f                	cmp    $0x2f,%al
+  20186c:	74 f0                	je     20185e <join_path+0x1f5>
+        if (!*src) break;
+  20186e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201872:	0f b6 00             	movzbl (%rax),%eax
+  201875:	84 c0                	test   %al,%al
+  201877:	0f 84 57 01 00 00    	je     2019d4 <join_path+0x36b>
+
+        // Find end of component
+        const char *comp_start = src;
+  20187d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201881:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        while (*src && *src != '/') src++;
+  201885:	eb 05                	jmp    20188c <join_path+0x223>
+  201887:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  20188c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201890:	0f b6 00             	movzbl (%rax),%eax
+  201893:	84 c0                	test   %al,%al
+  201895:	74 0b                	je     2018a2 <join_path+0x239>
+  201897:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20189b:	0f b6 00             	movzbl (%rax),%eax
+  20189e:	3c 2f                	cmp    $0x2f,%al
+  2018a0:	75 e5                	jne    201887 <join_path+0x21e>
+        const char *comp_end = src;
+  2018a2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2018a6:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+
+        int comp_len = comp_end - comp_start;
+  2018aa:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  2018ae:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  2018b2:	89 45 b4             	mov    %eax,-0x4c(%rbp)
+
+        // Get component string
+        if (comp_len == 1 && comp_start[0] == '.') {
+  2018b5:	83 7d b4 01          	cmpl   $0x1,-0x4c(%rbp)
+  2018b9:	75 10                	jne    2018cb <join_path+0x262>
+  2018bb:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  2018bf:	0f b6 00             	movzbl (%rax),%eax
+  2018c2:	3c 2e                	cmp    $0x2e,%al
+  2018c4:	75 05                	jne    2018cb <join_path+0x262>
+            // Ignore
+            continue;
+  2018c6:	e9 f8 00 00 00       	jmp    2019c3 <join_path+0x35a>
+        } else if (comp_len == 2 && comp_start[0] == '.' && comp_start[1] == '.') {
+  2018cb:	83 7d b4 02          	cmpl   $0x2,-0x4c(%rbp)
+  2018cf:	75 6e                	jne    20193f <join_path+0x2d6>
+  2018d1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  2018d5:	0f b6 00             	movzbl (%rax),%eax
+  2018d8:	3c 2e                	cmp    $0x2e,%al
+  2018da:	75 63                	jne    20193f <join_path+0x2d6>
+  2018dc:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  2018e0:	48 83 c0 01          	add    $0x1,%rax
+  2018e4:	0f b6 00             	movzbl (%rax),%eax
+  2018e7:	3c 2e                	cmp    $0x2e,%al
+  2018e9:	75 54                	jne    20193f <join_path+0x2d6>
+            // Go up one directory, unless at root
+            if (tlen > 1) {
+  2018eb:	83 7d dc 01          	cmpl   $0x1,-0x24(%rbp)
+  2018ef:	0f 8e ce 00 00 00    	jle    2019c3 <join_path+0x35a>
+                // Remove trailing slash if any
+                if (temp[tlen-1] == '/') tlen--;
+  2018f5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  2018f8:	83 e8 01             	sub    $0x1,%eax
+  2018fb:	48 98                	cltq
+  2018fd:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  201904:	ff 
+  201905:	3c 2f                	cmp    $0x2f,%al
+  201907:	75 0a                	jne    201913 <join_path+0x2aa>
+  201909:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+                // Remove last component
+                while (tlen > 1 && temp[tlen-1] != '/') tlen--;
+  20190d:	eb 04                	jmp    201913 <join_path+0x2aa>
+  20190f:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  201913:	83 7d dc 01          	cmpl   $0x1,-0x24(%rbp)
+  201917:	7e 14                	jle    20192d <join_path+0x2c4>
+  201919:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  20191c:	83 e8 01             	sub    $0x1,%eax
+  20191f:	48 98                	cltq
+  201921:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  201928:	ff 
+  201929:	3c 2f                	cmp    $0x2f,%al
+  20192b:	75 e2                	jne    20190f <join_path+0x2a6>
+                temp[tlen] = 0;
+  20192d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201930:	48 98                	cltq
+  201932:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  201939:	00 
+            if (tlen > 1) {
+  20193a:	e9 84 00 00 00       	jmp    2019c3 <join_path+0x35a>
+            }
+        } else if (comp_len > 0) {
+  20193f:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  201943:	7e 7e                	jle    2019c3 <join_path+0x35a>
+            // Add slash if not at root
+            if (tlen == 0 || temp[tlen-1] != '/') {
+  201945:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  201949:	74 14                	je     20195f <join_path+0x2f6>
+  20194b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  20194e:	83 e8 01             	sub    $0x1,%eax
+  201951:	48 98                	cltq
+  201953:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  20195a:	ff 
+  20195b:	3c 2f                	cmp    $0x2f,%al
+  20195d:	74 1c                	je     20197b <join_path+0x312>
+                if (tlen < (int)sizeof(temp)-1) temp[tlen++] = '/';
+  20195f:	81 7d dc fe 01 00 00 	cmpl   $0x1fe,-0x24(%rbp)
+  201966:	7f 13                	jg     20197b <join_path+0x312>
+  201968:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  20196b:	8d 50 01             	lea    0x1(%rax),%edx
+  20196e:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  201971:	48 98                	cltq
+  201973:	c6 84 05 b0 fd ff ff 	movb   $0x2f,-0x250(%rbp,%rax,1)
+  20197a:	2f 
+            }
+            // Copy component
+            for (const char *p = comp_start; p < comp_end && tlen < (int)sizeof(temp)-1; ++p) {
+  20197b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  20197f:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  201983:	eb 1e                	jmp    2019a3 <join_path+0x33a>
+                temp[tlen++] = *p;
+  201985:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201988:	8d 50 01             	lea    0x1(%rax),%edx
+  20198b:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  20198e:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  201992:	0f b6 12             	movzbl (%rdx),%edx
+  201995:	48 98                	cltq
+  201997:	88 94 05 b0 fd ff ff 	mov    %dl,-0x250(%rbp,%rax,1)
+            for (const char *p = comp_start; p < comp_end && tlen < (int)sizeof(temp)-1; ++p) {
+  20199e:	48 83 45 d0 01       	addq   $0x1,-0x30(%rbp)
+  2019a3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  2019a7:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  2019ab:	73 09                	jae    2019b6 <join_path+0x34d>
+  2019ad:	81 7d dc fe 01 00 00 	cmpl   $0x1fe,-0x24(%rbp)
+  2019b4:	7e cf                	jle    201985 <join_path+0x31c>
+            }
+            temp[tlen] = 0;
+  2019b6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  2019b9:	48 98                	cltq
+  2019bb:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  2019c2:	00 
+    while (*src) {
+  2019c3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2019c7:	0f b6 00             	movzbl (%rax),%eax
+  2019ca:	84 c0                	test   %al,%al
+  2019cc:	0f 85 91 fe ff ff    	jne    201863 <join_path+0x1fa>
+  2019d2:	eb 01                	jmp    2019d5 <join_path+0x36c>
+        if (!*src) break;
+  2019d4:	90                   	nop
+        }
+    }
+
+    // If temp is empty, set to "/"
+    if (tlen == 0) {
+  2019d5:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  2019d9:	75 20                	jne    2019fb <join_path+0x392>
+        temp[tlen++] = '/';
+  2019db:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  2019de:	8d 50 01             	lea    0x1(%rax),%edx
+  2019e1:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  2019e4:	48 98                	cltq
+  2019e6:	c6 84 05 b0 fd ff ff 	movb   $0x2f,-0x250(%rbp,%rax,1)
+  2019ed:	2f 
+        temp[tlen] = 0;
+  2019ee:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  2019f1:	48 98                	cltq
+  2019f3:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  2019fa:	00 
+    }
+
+    // Remove trailing slash unless the path is just "/"
+    if (tlen > 1 && temp[tlen-1] == '/') {
+  2019fb:	83 7d dc 01          	cmpl   $0x1,-0x24(%rbp)
+  2019ff:	7e 25                	jle    201a26 <join_path+0x3bd>
+  201a01:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201a04:	83 e8 01             	sub    $0x1,%eax
+  201a07:	48 98                	cltq
+  201a09:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  201a10:	ff 
+  201a11:	3c 2f                	cmp    $0x2f,%al
+  201a13:	75 11                	jne    201a26 <join_path+0x3bd>
+        temp[--tlen] = 0;
+  201a15:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  201a19:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201a1c:	48 98                	cltq
+  201a1e:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  201a25:	00 
+    }
+
+    // Copy temp to dst
+    for (int i = 0; i <= tlen; ++i) {
+  201a26:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  201a2d:	eb 23                	jmp    201a52 <join_path+0x3e9>
+        dst[i] = temp[i];
+  201a2f:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  201a32:	48 63 d0             	movslq %eax,%rdx
+  201a35:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  201a3c:	48 01 c2             	add    %rax,%rdx
+  201a3f:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  201a42:	48 98                	cltq
+  201a44:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  201a4b:	ff 
+  201a4c:	88 02                	mov    %al,(%rdx)
+    for (int i = 0; i <= tlen; ++i) {
+  201a4e:	83 45 cc 01          	addl   $0x1,-0x34(%rbp)
+  201a52:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  201a55:	3b 45 dc             	cmp    -0x24(%rbp),%eax
+  201a58:	7e d5                	jle    201a2f <join_path+0x3c6>
+    }
+}
+  201a5a:	c9                   	leave
+  201a5b:	c3                   	ret
+
+0000000000201a5c <app_printf>:
+#include "lib-malloc.h"
+#include "errno.h"
+// app_printf
+//     A version of console_printf that picks a sensible color by process ID.
+
+void app_printf(int colorid, const char* format, ...) {
+  201a5c:	55                   	push   %rbp
+  201a5d:	48 89 e5             	mov    %rsp,%rbp
+  201a60:	48 83 ec 50          	sub    $0x50,%rsp
+  201a64:	49 89 f2             	mov    %rsi,%r10
+  201a67:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  201a6b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  201a6f:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  201a73:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    int color;
+    if (colorid < 0) {
+        color = 0x0700;
+  201a77:	be 00 07 00 00       	mov    $0x700,%esi
+    if (colorid < 0) {
+  201a7c:	85 ff                	test   %edi,%edi
+  201a7e:	78 32                	js     201ab2 <app_printf+0x56>
+    } else {
+        static const uint8_t col[] = { 0x0F, 0x0C, 0x0A, 0x09, 0x0E };
+        color = col[colorid % sizeof(col)] << 8;
+  201a80:	48 63 ff             	movslq %edi,%rdi
+  201a83:	48 ba cd cc cc cc cc 	movabs $0xcccccccccccccccd,%rdx
+  201a8a:	cc cc cc 
+  201a8d:	48 89 f8             	mov    %rdi,%rax
+  201a90:	48 f7 e2             	mul    %rdx
+  201a93:	48 89 d0             	mov    %rdx,%rax
+  201a96:	48 c1 e8 02          	shr    $0x2,%rax
+  201a9a:	48 83 e2 fc          	and    $0xfffffffffffffffc,%rdx
+  201a9e:	48 01 c2             	add    %rax,%rdx
+  201aa1:	48 29 d7             	sub    %rdx,%rdi
+  201aa4:	48 8d 05 fd 08 00 00 	lea    0x8fd(%rip),%rax        # 2023a8 <col.0>
+  201aab:	0f b6 34 38          	movzbl (%rax,%rdi,1),%esi
+  201aaf:	c1 e6 08             	shl    $0x8,%esi
+    }
+
+    va_list val;
+    va_start(val, format);
+  201ab2:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  201ab9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  201abd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  201ac1:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  201ac5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    cursorpos = console_vprintf(cursorpos, color, format, val);
+  201ac9:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  201acd:	4c 89 d2             	mov    %r10,%rdx
+  201ad0:	8b 3d 26 75 eb ff    	mov    -0x148ada(%rip),%edi        # b8ffc <cursorpos>
+  201ad6:	e8 24 f7 ff ff       	call   2011ff <console_vprintf>
+  201adb:	89 05 1b 75 eb ff    	mov    %eax,-0x148ae5(%rip)        # b8ffc <cursorpos>
+    va_end(val);
+
+    /*if (CROW(cursorpos) >= 23) {
+        cursorpos = CPOS(0, 0);
+    }*/
+}
+  201ae1:	c9                   	leave
+  201ae2:	c3                   	ret
+
+0000000000201ae3 <panic>:
+
+
+// panic, assert_fail
+//     Call the INT_SYS_PANIC system call so the kernel loops until Control-C.
+
+void panic(const char* format, ...) {
+  201ae3:	55                   	push   %rbp
+  201ae4:	48 89 e5             	mov    %rsp,%rbp
+  201ae7:	53                   	push   %rbx
+  201ae8:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  201aef:	48 89 fb             	mov    %rdi,%rbx
+  201af2:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  201af6:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  201afa:	48 89 4d d8          	mov    %rcx,-0x28(%rbp)
+  201afe:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  201b02:	4c 89 4d e8          	mov    %r9,-0x18(%rbp)
+    va_list val;
+    va_start(val, format);
+  201b06:	c7 45 a8 08 00 00 00 	movl   $0x8,-0x58(%rbp)
+  201b0d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  201b11:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  201b15:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  201b19:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    char buf[160];
+    memcpy(buf, "PANIC: ", 7);
+  201b1d:	48 8d bd 08 ff ff ff 	lea    -0xf8(%rbp),%rdi
+  201b24:	ba 07 00 00 00       	mov    $0x7,%edx
+  201b29:	48 8d 35 b1 06 00 00 	lea    0x6b1(%rip),%rsi        # 2021e1 <lower_digits.0+0x11>
+  201b30:	e8 31 e5 ff ff       	call   200066 <memcpy>
+    int len = vsnprintf(&buf[7], sizeof(buf) - 7, format, val) + 7;
+  201b35:	48 8d 4d a8          	lea    -0x58(%rbp),%rcx
+  201b39:	48 8d bd 0f ff ff ff 	lea    -0xf1(%rbp),%rdi
+  201b40:	48 89 da             	mov    %rbx,%rdx
+  201b43:	be 99 00 00 00       	mov    $0x99,%esi
+  201b48:	e8 cd f7 ff ff       	call   20131a <vsnprintf>
+  201b4d:	8d 50 07             	lea    0x7(%rax),%edx
+    va_end(val);
+    if (len > 0 && buf[len - 1] != '\n') {
+  201b50:	85 d2                	test   %edx,%edx
+  201b52:	7e 0f                	jle    201b63 <panic+0x80>
+  201b54:	83 c0 06             	add    $0x6,%eax
+  201b57:	48 98                	cltq
+  201b59:	80 bc 05 08 ff ff ff 	cmpb   $0xa,-0xf8(%rbp,%rax,1)
+  201b60:	0a 
+  201b61:	75 30                	jne    201b93 <panic+0xb0>
+        strcpy(buf + len - (len == (int) sizeof(buf) - 1), "\n");
+    }
+    (void) console_printf(CPOS(23, 0), 0xC000, "%s", buf);
+  201b63:	48 8d 8d 08 ff ff ff 	lea    -0xf8(%rbp),%rcx
+  201b6a:	48 8d 15 78 06 00 00 	lea    0x678(%rip),%rdx        # 2021e9 <lower_digits.0+0x19>
+  201b71:	be 00 c0 00 00       	mov    $0xc000,%esi
+  201b76:	bf 30 07 00 00       	mov    $0x730,%edi
+  201b7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  201b80:	e8 f5 f6 ff ff       	call   20127a <console_printf>
+    asm volatile ("syscall" : "=a" (rax)
+  201b85:	b8 30 00 00 00       	mov    $0x30,%eax
+  201b8a:	bf 00 00 00 00       	mov    $0x0,%edi
+  201b8f:	0f 05                	syscall
+ loop: goto loop;
+  201b91:	eb fe                	jmp    201b91 <panic+0xae>
+        strcpy(buf + len - (len == (int) sizeof(buf) - 1), "\n");
+  201b93:	48 63 c2             	movslq %edx,%rax
+  201b96:	81 fa 9f 00 00 00    	cmp    $0x9f,%edx
+  201b9c:	0f 94 c2             	sete   %dl
+  201b9f:	0f b6 d2             	movzbl %dl,%edx
+  201ba2:	48 29 d0             	sub    %rdx,%rax
+  201ba5:	48 8d bc 05 08 ff ff 	lea    -0xf8(%rbp,%rax,1),%rdi
+  201bac:	ff 
+  201bad:	48 8d 35 10 07 00 00 	lea    0x710(%rip),%rsi        # 2022c4 <lower_digits.0+0xf4>
+  201bb4:	e8 3b e8 ff ff       	call   2003f4 <strcpy>
+  201bb9:	eb a8                	jmp    201b63 <panic+0x80>
+
+0000000000201bbb <raise>:
+
+#define SIGABRT -1
+
+
+
+int raise(int sig) {
+  201bbb:	89 fe                	mov    %edi,%esi
+
+// getpid()
+//    Return current process ID, like sys_getpid().
+static inline pid_t getpid(void) {
+    return vdso()->pid;
+  201bbd:	8b 3c 25 00 10 24 00 	mov    0x241000,%edi
+    asm volatile ("syscall" : "=a" (result)
+  201bc4:	b8 41 00 00 00       	mov    $0x41,%eax
+  201bc9:	0f 05                	syscall
+    return sys_kill(getpid(), sig);
+}
+  201bcb:	c3                   	ret
+
+0000000000201bcc <abort>:
+    return vdso()->pid;
+  201bcc:	8b 3c 25 00 10 24 00 	mov    0x241000,%edi
+    asm volatile ("syscall" : "=a" (result)
+  201bd3:	b8 41 00 00 00       	mov    $0x41,%eax
+  201bd8:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  201bdd:	0f 05                	syscall
+
+void __attribute((noreturn)) abort(void) {
+    raise(SIGABRT);
+ spinloop: goto spinloop;       // should never get here
+  201bdf:	eb fe                	jmp    201bdf <abort+0x13>
+
+0000000000201be1 <assert_fail>:
+}
+
+
+void assert_fail(const char* file, int line, const char* msg) {
+  201be1:	55                   	push   %rbp
+  201be2:	48 89 e5             	mov    %rsp,%rbp
+  201be5:	48 89 f9             	mov    %rdi,%rcx
+  201be8:	41 89 f0             	mov    %esi,%r8d
+  201beb:	49 89 d1             	mov    %rdx,%r9
+    (void) console_printf(CPOS(23, 0), 0xC000,
+  201bee:	48 8d 15 d3 06 00 00 	lea    0x6d3(%rip),%rdx        # 2022c8 <lower_digits.0+0xf8>
+  201bf5:	be 00 c0 00 00       	mov    $0xc000,%esi
+  201bfa:	bf 30 07 00 00       	mov    $0x730,%edi
+  201bff:	b8 00 00 00 00       	mov    $0x0,%eax
+  201c04:	e8 71 f6 ff ff       	call   20127a <console_printf>
+                          "PANIC: %s:%d: assertion '%s' failed\n",
+                          file, line, msg);
+    abort();
+  201c09:	e8 be ff ff ff       	call   201bcc <abort>
+
+0000000000201c0e <scan_char>:
+    asm volatile ("syscall" : "=a" (result)
+  201c0e:	bf 3a 00 00 00       	mov    $0x3a,%edi
+    asm volatile ("syscall" : "=a" (rax)
+  201c13:	be 3c 00 00 00       	mov    $0x3c,%esi
+    asm volatile ("syscall" : "=a" (result)
+  201c18:	89 f8                	mov    %edi,%eax
+  201c1a:	0f 05                	syscall
+  201c1c:	89 c2                	mov    %eax,%edx
+    asm volatile ("syscall" : "=a" (rax)
+  201c1e:	89 f0                	mov    %esi,%eax
+  201c20:	0f 05                	syscall
+    int c;
+
+    do {
+        c = sys_keybord();
+        sys_yield();
+    } while (c == -1);
+  201c22:	83 fa ff             	cmp    $0xffffffff,%edx
+  201c25:	74 f1                	je     201c18 <scan_char+0xa>
+
+    return c;
+  201c27:	89 d0                	mov    %edx,%eax
+}
+  201c29:	c3                   	ret
+
+0000000000201c2a <scan_line>:
+
+unsigned int scan_line(char* dst, unsigned int length_max) {
+  201c2a:	55                   	push   %rbp
+  201c2b:	48 89 e5             	mov    %rsp,%rbp
+  201c2e:	41 57                	push   %r15
+  201c30:	41 56                	push   %r14
+  201c32:	41 55                	push   %r13
+  201c34:	41 54                	push   %r12
+  201c36:	53                   	push   %rbx
+  201c37:	48 83 ec 08          	sub    $0x8,%rsp
+  201c3b:	49 89 fe             	mov    %rdi,%r14
+  201c3e:	41 89 f5             	mov    %esi,%r13d
+    unsigned int length = 0;
+  201c41:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            app_printf(0, "%c", c);
+            dst[length] = '\0';
+            return length;
+        } else if (c >= 32 && c <= 127) {
+            if (length < length_max) {
+                app_printf(0, "%c", c);
+  201c47:	4c 8d 3d 9e 05 00 00 	lea    0x59e(%rip),%r15        # 2021ec <lower_digits.0+0x1c>
+  201c4e:	eb 05                	jmp    201c55 <scan_line+0x2b>
+            if (length != 0) {
+  201c50:	45 85 e4             	test   %r12d,%r12d
+  201c53:	75 3e                	jne    201c93 <scan_line+0x69>
+        unsigned char c = scan_char();
+  201c55:	e8 b4 ff ff ff       	call   201c0e <scan_char>
+  201c5a:	89 c3                	mov    %eax,%ebx
+        if (c == '\b') {
+  201c5c:	3c 08                	cmp    $0x8,%al
+  201c5e:	74 f0                	je     201c50 <scan_line+0x26>
+        } else if (c == '\n') {
+  201c60:	3c 0a                	cmp    $0xa,%al
+  201c62:	74 4c                	je     201cb0 <scan_line+0x86>
+        } else if (c >= 32 && c <= 127) {
+  201c64:	8d 43 e0             	lea    -0x20(%rbx),%eax
+            if (length < length_max) {
+  201c67:	3c 5f                	cmp    $0x5f,%al
+  201c69:	77 ea                	ja     201c55 <scan_line+0x2b>
+  201c6b:	45 39 ec             	cmp    %r13d,%r12d
+  201c6e:	73 e5                	jae    201c55 <scan_line+0x2b>
+                app_printf(0, "%c", c);
+  201c70:	0f b6 d3             	movzbl %bl,%edx
+  201c73:	4c 89 fe             	mov    %r15,%rsi
+  201c76:	bf 00 00 00 00       	mov    $0x0,%edi
+  201c7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  201c80:	e8 d7 fd ff ff       	call   201a5c <app_printf>
+                dst[length++] = c;
+  201c85:	44 89 e0             	mov    %r12d,%eax
+  201c88:	41 88 1c 06          	mov    %bl,(%r14,%rax,1)
+  201c8c:	45 8d 64 24 01       	lea    0x1(%r12),%r12d
+  201c91:	eb c2                	jmp    201c55 <scan_line+0x2b>
+                app_printf(0, "%c", c);
+  201c93:	ba 08 00 00 00       	mov    $0x8,%edx
+  201c98:	4c 89 fe             	mov    %r15,%rsi
+  201c9b:	bf 00 00 00 00       	mov    $0x0,%edi
+  201ca0:	b8 00 00 00 00       	mov    $0x0,%eax
+  201ca5:	e8 b2 fd ff ff       	call   201a5c <app_printf>
+                length--;
+  201caa:	41 83 ec 01          	sub    $0x1,%r12d
+  201cae:	eb a5                	jmp    201c55 <scan_line+0x2b>
+            app_printf(0, "%c", c);
+  201cb0:	ba 0a 00 00 00       	mov    $0xa,%edx
+  201cb5:	48 8d 35 30 05 00 00 	lea    0x530(%rip),%rsi        # 2021ec <lower_digits.0+0x1c>
+  201cbc:	bf 00 00 00 00       	mov    $0x0,%edi
+  201cc1:	b8 00 00 00 00       	mov    $0x0,%eax
+  201cc6:	e8 91 fd ff ff       	call   201a5c <app_printf>
+            dst[length] = '\0';
+  201ccb:	44 89 e0             	mov    %r12d,%eax
+  201cce:	41 c6 04 06 00       	movb   $0x0,(%r14,%rax,1)
+            }
+        }
+    }
+}
+  201cd3:	44 89 e0             	mov    %r12d,%eax
+  201cd6:	48 83 c4 08          	add    $0x8,%rsp
+  201cda:	5b                   	pop    %rbx
+  201cdb:	41 5c                	pop    %r12
+  201cdd:	41 5d                	pop    %r13
+  201cdf:	41 5e                	pop    %r14
+  201ce1:	41 5f                	pop    %r15
+  201ce3:	5d                   	pop    %rbp
+  201ce4:	c3                   	ret
+
+0000000000201ce5 <split_string>:
+
+
+char** split_string(char* str, char sep) {
+  201ce5:	55                   	push   %rbp
+  201ce6:	48 89 e5             	mov    %rsp,%rbp
+  201ce9:	41 57                	push   %r15
+  201ceb:	41 56                	push   %r14
+  201ced:	41 55                	push   %r13
+  201cef:	41 54                	push   %r12
+  201cf1:	53                   	push   %rbx
+  201cf2:	48 83 ec 08          	sub    $0x8,%rsp
+    int s = 1;
+    int n = 0;
+
+    while (str[n]) {
+  201cf6:	0f b6 07             	movzbl (%rdi),%eax
+  201cf9:	84 c0                	test   %al,%al
+  201cfb:	0f 84 ad 00 00 00    	je     201dae <split_string+0xc9>
+  201d01:	48 89 fb             	mov    %rdi,%rbx
+  201d04:	41 89 f4             	mov    %esi,%r12d
+  201d07:	41 be 01 00 00 00    	mov    $0x1,%r14d
+    int s = 1;
+  201d0d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  201d12:	eb 03                	jmp    201d17 <split_string+0x32>
+  201d14:	49 89 d6             	mov    %rdx,%r14
+        if (str[n] == sep)
+            s++;
+  201d17:	41 38 c4             	cmp    %al,%r12b
+  201d1a:	0f 94 c0             	sete   %al
+  201d1d:	0f b6 c0             	movzbl %al,%eax
+  201d20:	01 c1                	add    %eax,%ecx
+    while (str[n]) {
+  201d22:	49 8d 56 01          	lea    0x1(%r14),%rdx
+  201d26:	0f b6 44 13 ff       	movzbl -0x1(%rbx,%rdx,1),%eax
+  201d2b:	84 c0                	test   %al,%al
+  201d2d:	75 e5                	jne    201d14 <split_string+0x2f>
+        n++;
+    }
+    
+    char** part = malloc((s+1)*sizeof(char*));
+  201d2f:	44 8d 79 01          	lea    0x1(%rcx),%r15d
+  201d33:	4d 63 ff             	movslq %r15d,%r15
+  201d36:	49 c1 e7 03          	shl    $0x3,%r15
+  201d3a:	4c 89 ff             	mov    %r15,%rdi
+  201d3d:	e8 69 02 00 00       	call   201fab <malloc>
+  201d42:	49 89 c5             	mov    %rax,%r13
+    char* buffer = malloc(n+1);
+  201d45:	41 8d 7e 01          	lea    0x1(%r14),%edi
+  201d49:	48 63 ff             	movslq %edi,%rdi
+  201d4c:	e8 5a 02 00 00       	call   201fab <malloc>
+
+    int word_n = 0;
+    part[0] = buffer;
+  201d51:	49 89 45 00          	mov    %rax,0x0(%r13)
+    part[s] = NULL;
+  201d55:	4b c7 44 3d f8 00 00 	movq   $0x0,-0x8(%r13,%r15,1)
+  201d5c:	00 00 
+    buffer[n] = 0;
+  201d5e:	42 c6 04 30 00       	movb   $0x0,(%rax,%r14,1)
+
+    for (int i = 0; i < n; i++) {
+  201d63:	45 85 f6             	test   %r14d,%r14d
+  201d66:	7e 6c                	jle    201dd4 <split_string+0xef>
+  201d68:	41 83 ee 01          	sub    $0x1,%r14d
+  201d6c:	48 89 da             	mov    %rbx,%rdx
+  201d6f:	48 83 c0 01          	add    $0x1,%rax
+  201d73:	48 89 c1             	mov    %rax,%rcx
+    int word_n = 0;
+  201d76:	bf 00 00 00 00       	mov    $0x0,%edi
+  201d7b:	eb 23                	jmp    201da0 <split_string+0xbb>
+        if (str[i] == sep) {
+            buffer[i] = 0;
+  201d7d:	c6 41 ff 00          	movb   $0x0,-0x1(%rcx)
+            part[++word_n] = &buffer[i+1];
+  201d81:	83 c7 01             	add    $0x1,%edi
+  201d84:	48 63 f7             	movslq %edi,%rsi
+  201d87:	49 89 4c f5 00       	mov    %rcx,0x0(%r13,%rsi,8)
+    for (int i = 0; i < n; i++) {
+  201d8c:	48 83 c2 01          	add    $0x1,%rdx
+  201d90:	48 83 c1 01          	add    $0x1,%rcx
+  201d94:	89 ce                	mov    %ecx,%esi
+  201d96:	29 c6                	sub    %eax,%esi
+  201d98:	83 ee 01             	sub    $0x1,%esi
+  201d9b:	44 39 f6             	cmp    %r14d,%esi
+  201d9e:	7d 34                	jge    201dd4 <split_string+0xef>
+        if (str[i] == sep) {
+  201da0:	0f b6 32             	movzbl (%rdx),%esi
+  201da3:	44 38 e6             	cmp    %r12b,%sil
+  201da6:	74 d5                	je     201d7d <split_string+0x98>
+        } else {
+            buffer[i] = str[i];
+  201da8:	40 88 71 ff          	mov    %sil,-0x1(%rcx)
+  201dac:	eb de                	jmp    201d8c <split_string+0xa7>
+    char** part = malloc((s+1)*sizeof(char*));
+  201dae:	bf 10 00 00 00       	mov    $0x10,%edi
+  201db3:	e8 f3 01 00 00       	call   201fab <malloc>
+  201db8:	49 89 c5             	mov    %rax,%r13
+    char* buffer = malloc(n+1);
+  201dbb:	bf 01 00 00 00       	mov    $0x1,%edi
+  201dc0:	e8 e6 01 00 00       	call   201fab <malloc>
+    part[0] = buffer;
+  201dc5:	49 89 45 00          	mov    %rax,0x0(%r13)
+    part[s] = NULL;
+  201dc9:	49 c7 45 08 00 00 00 	movq   $0x0,0x8(%r13)
+  201dd0:	00 
+    buffer[n] = 0;
+  201dd1:	c6 00 00             	movb   $0x0,(%rax)
+        }
+    }
+
+    return part;
+}
+  201dd4:	4c 89 e8             	mov    %r13,%rax
+  201dd7:	48 83 c4 08          	add    $0x8,%rsp
+  201ddb:	5b                   	pop    %rbx
+  201ddc:	41 5c                	pop    %r12
+  201dde:	41 5d                	pop    %r13
+  201de0:	41 5e                	pop    %r14
+  201de2:	41 5f                	pop    %r15
+  201de4:	5d                   	pop    %rbp
+  201de5:	c3                   	ret
+
+0000000000201de6 <app_print_error>:
+
+
+void app_print_error(int r) {
+  201de6:	55                   	push   %rbp
+  201de7:	48 89 e5             	mov    %rsp,%rbp
+    switch (r) {
+  201dea:	83 ff 24             	cmp    $0x24,%edi
+  201ded:	0f 87 79 01 00 00    	ja     201f6c <app_print_error+0x186>
+  201df3:	89 f8                	mov    %edi,%eax
+  201df5:	48 8d 15 18 05 00 00 	lea    0x518(%rip),%rdx        # 202314 <lower_digits.0+0x144>
+  201dfc:	48 63 04 82          	movslq (%rdx,%rax,4),%rax
+  201e00:	48 01 d0             	add    %rdx,%rax
+  201e03:	ff e0                	jmp    *%rax
+        case ENOENT:
+            app_printf(1, "Error: %s\n", "No such file or directory");
+  201e05:	48 8d 15 e3 03 00 00 	lea    0x3e3(%rip),%rdx        # 2021ef <lower_digits.0+0x1f>
+  201e0c:	48 8d 35 f6 03 00 00 	lea    0x3f6(%rip),%rsi        # 202209 <lower_digits.0+0x39>
+  201e13:	bf 01 00 00 00       	mov    $0x1,%edi
+  201e18:	b8 00 00 00 00       	mov    $0x0,%eax
+  201e1d:	e8 3a fc ff ff       	call   201a5c <app_printf>
+            break;
+        default:
+            app_printf(1, "Error %d: %s\n", r, "Unknown error");
+            break;
+    }
+}
+  201e22:	5d                   	pop    %rbp
+  201e23:	c3                   	ret
+            app_printf(1, "Error: %s\n", "I/O error");
+  201e24:	48 8d 15 e9 03 00 00 	lea    0x3e9(%rip),%rdx        # 202214 <lower_digits.0+0x44>
+  201e2b:	48 8d 35 d7 03 00 00 	lea    0x3d7(%rip),%rsi        # 202209 <lower_digits.0+0x39>
+  201e32:	bf 01 00 00 00       	mov    $0x1,%edi
+  201e37:	b8 00 00 00 00       	mov    $0x0,%eax
+  201e3c:	e8 1b fc ff ff       	call   201a5c <app_printf>
+            break;
+  201e41:	eb df                	jmp    201e22 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Exec format error");
+  201e43:	48 8d 15 d4 03 00 00 	lea    0x3d4(%rip),%rdx        # 20221e <lower_digits.0+0x4e>
+  201e4a:	48 8d 35 b8 03 00 00 	lea    0x3b8(%rip),%rsi        # 202209 <lower_digits.0+0x39>
+  201e51:	bf 01 00 00 00       	mov    $0x1,%edi
+  201e56:	b8 00 00 00 00       	mov    $0x0,%eax
+  201e5b:	e8 fc fb ff ff       	call   201a5c <app_printf>
+            break;
+  201e60:	eb c0                	jmp    201e22 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Resource temporarily unavailable");
+  201e62:	48 8d 15 87 04 00 00 	lea    0x487(%rip),%rdx        # 2022f0 <lower_digits.0+0x120>
+  201e69:	48 8d 35 99 03 00 00 	lea    0x399(%rip),%rsi        # 202209 <lower_digits.0+0x39>
+  201e70:	bf 01 00 00 00       	mov    $0x1,%edi
+  201e75:	b8 00 00 00 00       	mov    $0x0,%eax
+  201e7a:	e8 dd fb ff ff       	call   201a5c <app_printf>
+            break;
+  201e7f:	eb a1                	jmp    201e22 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Out of memory");
+  201e81:	48 8d 15 a8 03 00 00 	lea    0x3a8(%rip),%rdx        # 202230 <lower_digits.0+0x60>
+  201e88:	48 8d 35 7a 03 00 00 	lea    0x37a(%rip),%rsi        # 202209 <lower_digits.0+0x39>
+  201e8f:	bf 01 00 00 00       	mov    $0x1,%edi
+  201e94:	b8 00 00 00 00       	mov    $0x0,%eax
+  201e99:	e8 be fb ff ff       	call   201a5c <app_printf>
+            break;
+  201e9e:	eb 82                	jmp    201e22 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Bad address");
+  201ea0:	48 8d 15 97 03 00 00 	lea    0x397(%rip),%rdx        # 20223e <lower_digits.0+0x6e>
+  201ea7:	48 8d 35 5b 03 00 00 	lea    0x35b(%rip),%rsi        # 202209 <lower_digits.0+0x39>
+  201eae:	bf 01 00 00 00       	mov    $0x1,%edi
+  201eb3:	b8 00 00 00 00       	mov    $0x0,%eax
+  201eb8:	e8 9f fb ff ff       	call   201a5c <app_printf>
+            break;
+  201ebd:	e9 60 ff ff ff       	jmp    201e22 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Not a directory");
+  201ec2:	48 8d 15 81 03 00 00 	lea    0x381(%rip),%rdx        # 20224a <lower_digits.0+0x7a>
+  201ec9:	48 8d 35 39 03 00 00 	lea    0x339(%rip),%rsi        # 202209 <lower_digits.0+0x39>
+  201ed0:	bf 01 00 00 00       	mov    $0x1,%edi
+  201ed5:	b8 00 00 00 00       	mov    $0x0,%eax
+  201eda:	e8 7d fb ff ff       	call   201a5c <app_printf>
+            break;
+  201edf:	e9 3e ff ff ff       	jmp    201e22 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Invalid argument");
+  201ee4:	48 8d 15 6f 03 00 00 	lea    0x36f(%rip),%rdx        # 20225a <lower_digits.0+0x8a>
+  201eeb:	48 8d 35 17 03 00 00 	lea    0x317(%rip),%rsi        # 202209 <lower_digits.0+0x39>
+  201ef2:	bf 01 00 00 00       	mov    $0x1,%edi
+  201ef7:	b8 00 00 00 00       	mov    $0x0,%eax
+  201efc:	e8 5b fb ff ff       	call   201a5c <app_printf>
+            break;
+  201f01:	e9 1c ff ff ff       	jmp    201e22 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "No space left on device");
+  201f06:	48 8d 15 5e 03 00 00 	lea    0x35e(%rip),%rdx        # 20226b <lower_digits.0+0x9b>
+  201f0d:	48 8d 35 f5 02 00 00 	lea    0x2f5(%rip),%rsi        # 202209 <lower_digits.0+0x39>
+  201f14:	bf 01 00 00 00       	mov    $0x1,%edi
+  201f19:	b8 00 00 00 00       	mov    $0x0,%eax
+  201f1e:	e8 39 fb ff ff       	call   201a5c <app_printf>
+            break;
+  201f23:	e9 fa fe ff ff       	jmp    201e22 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "File already exists");
+  201f28:	48 8d 15 54 03 00 00 	lea    0x354(%rip),%rdx        # 202283 <lower_digits.0+0xb3>
+  201f2f:	48 8d 35 d3 02 00 00 	lea    0x2d3(%rip),%rsi        # 202209 <lower_digits.0+0x39>
+  201f36:	bf 01 00 00 00       	mov    $0x1,%edi
+  201f3b:	b8 00 00 00 00       	mov    $0x0,%eax
+  201f40:	e8 17 fb ff ff       	call   201a5c <app_printf>
+            break;
+  201f45:	e9 d8 fe ff ff       	jmp    201e22 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "File name too long");
+  201f4a:	48 8d 15 46 03 00 00 	lea    0x346(%rip),%rdx        # 202297 <lower_digits.0+0xc7>
+  201f51:	48 8d 35 b1 02 00 00 	lea    0x2b1(%rip),%rsi        # 202209 <lower_digits.0+0x39>
+  201f58:	bf 01 00 00 00       	mov    $0x1,%edi
+  201f5d:	b8 00 00 00 00       	mov    $0x0,%eax
+  201f62:	e8 f5 fa ff ff       	call   201a5c <app_printf>
+            break;
+  201f67:	e9 b6 fe ff ff       	jmp    201e22 <app_print_error+0x3c>
+            app_printf(1, "Error %d: %s\n", r, "Unknown error");
+  201f6c:	48 8d 0d 37 03 00 00 	lea    0x337(%rip),%rcx        # 2022aa <lower_digits.0+0xda>
+  201f73:	89 fa                	mov    %edi,%edx
+  201f75:	48 8d 35 3c 03 00 00 	lea    0x33c(%rip),%rsi        # 2022b8 <lower_digits.0+0xe8>
+  201f7c:	bf 01 00 00 00       	mov    $0x1,%edi
+  201f81:	b8 00 00 00 00       	mov    $0x0,%eax
+  201f86:	e8 d1 fa ff ff       	call   201a5c <app_printf>
+}
+  201f8b:	e9 92 fe ff ff       	jmp    201e22 <app_print_error+0x3c>
+
+0000000000201f90 <handle_error>:
+
+__attribute__((noreturn)) void handle_error(int r) {
+  201f90:	55                   	push   %rbp
+  201f91:	48 89 e5             	mov    %rsp,%rbp
+  201f94:	53                   	push   %rbx
+  201f95:	48 83 ec 08          	sub    $0x8,%rsp
+  201f99:	89 fb                	mov    %edi,%ebx
+    app_print_error(r);
+  201f9b:	e8 46 fe ff ff       	call   201de6 <app_print_error>
+    asm volatile ("syscall" : "=a" (rax)
+  201fa0:	b8 40 00 00 00       	mov    $0x40,%eax
+  201fa5:	89 df                	mov    %ebx,%edi
+  201fa7:	0f 05                	syscall
+ spinloop: goto spinloop;       // should never get here
+  201fa9:	eb fe                	jmp    201fa9 <handle_error+0x19>
+
+0000000000201fab <malloc>:
+
+// The heap starts 1MB above the program image (PROC_START_ADDR)
+static uint8_t* heap_top = (uint8_t*) 0x300000;
+static uint8_t* page_top = (uint8_t*) 0x300000;
+
+void* malloc(size_t size) {
+  201fab:	48 89 fe             	mov    %rdi,%rsi
+    while (ROUNDDOWN(heap_top + size, PAGESIZE) >= page_top) {
+  201fae:	48 8b 05 53 10 00 00 	mov    0x1053(%rip),%rax        # 203008 <heap_top>
+  201fb5:	48 8d 14 38          	lea    (%rax,%rdi,1),%rdx
+  201fb9:	48 8b 3d 40 10 00 00 	mov    0x1040(%rip),%rdi        # 203000 <page_top>
+  201fc0:	48 89 d1             	mov    %rdx,%rcx
+  201fc3:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  201fca:	48 39 f9             	cmp    %rdi,%rcx
+  201fcd:	72 3e                	jb     20200d <malloc+0x62>
+    asm volatile ("syscall" : "=a" (result)
+  201fcf:	41 b8 3b 00 00 00    	mov    $0x3b,%r8d
+  201fd5:	44 89 c0             	mov    %r8d,%eax
+  201fd8:	0f 05                	syscall
+        int r = sys_page_alloc(page_top);
+        assert(r >= 0);
+  201fda:	85 c0                	test   %eax,%eax
+  201fdc:	78 37                	js     202015 <malloc+0x6a>
+        page_top += PAGESIZE;
+  201fde:	48 8b 05 1b 10 00 00 	mov    0x101b(%rip),%rax        # 203000 <page_top>
+  201fe5:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  201fec:	48 89 3d 0d 10 00 00 	mov    %rdi,0x100d(%rip)        # 203000 <page_top>
+    while (ROUNDDOWN(heap_top + size, PAGESIZE) >= page_top) {
+  201ff3:	48 8b 05 0e 10 00 00 	mov    0x100e(%rip),%rax        # 203008 <heap_top>
+  201ffa:	48 8d 14 30          	lea    (%rax,%rsi,1),%rdx
+  201ffe:	48 89 d1             	mov    %rdx,%rcx
+  202001:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  202008:	48 39 f9             	cmp    %rdi,%rcx
+  20200b:	73 c8                	jae    201fd5 <malloc+0x2a>
+    }
+
+    void* addr = heap_top;
+    heap_top += size;
+  20200d:	48 89 15 f4 0f 00 00 	mov    %rdx,0xff4(%rip)        # 203008 <heap_top>
+    return addr;
+}
+  202014:	c3                   	ret
+void* malloc(size_t size) {
+  202015:	55                   	push   %rbp
+  202016:	48 89 e5             	mov    %rsp,%rbp
+        assert(r >= 0);
+  202019:	48 8d 15 8d 03 00 00 	lea    0x38d(%rip),%rdx        # 2023ad <col.0+0x5>
+  202020:	be 0b 00 00 00       	mov    $0xb,%esi
+  202025:	48 8d 3d 88 03 00 00 	lea    0x388(%rip),%rdi        # 2023b4 <col.0+0xc>
+  20202c:	e8 b0 fb ff ff       	call   201be1 <assert_fail>
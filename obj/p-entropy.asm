@@ -0,0 +1,3286 @@
+
+obj/p-entropy.full:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000200000 <process_main>:
+#include "process.h"
+#include "lib.h"
+
+void process_main(void) {
+  200000:	55                   	push   %rbp
+  200001:	48 89 e5             	mov    %rsp,%rbp
+  200004:	41 54                	push   %r12
+  200006:	53                   	push   %rbx
+    for (int i = 0; ; ++i) {
+  200007:	bb 00 00 00 00       	mov    $0x0,%ebx
+        unsigned v = sys_getrandom();          // kernel random number generator (RNG)
+        app_printf(0, "%d: %u\n", i, v);
+  20000c:	4c 8d 25 2d 20 00 00 	lea    0x202d(%rip),%r12        # 202040 <malloc+0x91>
+  200013:	eb 03                	jmp    200018 <process_main+0x18>
+    for (int i = 0; ; ++i) {
+  200015:	83 c3 01             	add    $0x1,%ebx
+}
+
+/* Random from kernel*/
+static inline unsigned sys_getrandom(void) {
+    uint64_t rax;
+    asm volatile ("syscall" : "=a" (rax)
+  200018:	b8 45 00 00 00       	mov    $0x45,%eax
+  20001d:	0f 05                	syscall
+        app_printf(0, "%d: %u\n", i, v);
+  20001f:	89 c1                	mov    %eax,%ecx
+  200021:	89 da                	mov    %ebx,%edx
+  200023:	4c 89 e6             	mov    %r12,%rsi
+  200026:	bf 00 00 00 00       	mov    $0x0,%edi
+  20002b:	b8 00 00 00 00       	mov    $0x0,%eax
+  200030:	e8 2b 1a 00 00       	call   201a60 <app_printf>
+         if (i % 50 == 49)
+  200035:	48 63 c3             	movslq %ebx,%rax
+  200038:	48 69 c0 1f 85 eb 51 	imul   $0x51eb851f,%rax,%rax
+  20003f:	48 c1 f8 24          	sar    $0x24,%rax
+  200043:	89 da                	mov    %ebx,%edx
+  200045:	c1 fa 1f             	sar    $0x1f,%edx
+  200048:	29 d0                	sub    %edx,%eax
+  20004a:	6b c0 32             	imul   $0x32,%eax,%eax
+  20004d:	89 da                	mov    %ebx,%edx
+  20004f:	29 c2                	sub    %eax,%edx
+  200051:	83 fa 31             	cmp    $0x31,%edx
+  200054:	75 bf                	jne    200015 <process_main+0x15>
+    asm volatile ("syscall" : "=a" (rax)
+  200056:	b8 3c 00 00 00       	mov    $0x3c,%eax
+  20005b:	0f 05                	syscall
+}
+  20005d:	eb b6                	jmp    200015 <process_main+0x15>
+
+000000000020005f <vdso>:
+// KERNEL DATA PAGE
+//
+//    The kernel keeps a read-only vdso_data (see lib.h) up to date at
+//    VDSO_ADDR. Reading it is a plain memory load, not a system call.
+
+static inline const volatile vdso_data* vdso(void) {
+  20005f:	55                   	push   %rbp
+  200060:	48 89 e5             	mov    %rsp,%rbp
+    return (const volatile vdso_data*) VDSO_ADDR;
+  200063:	b8 00 10 24 00       	mov    $0x241000,%eax
+}
+  200068:	5d                   	pop    %rbp
+  200069:	c3                   	ret
+
+000000000020006a <memcpy>:
+#define MEMOP_WORD_MIN 64
+
+// an unaligned word that may alias any object
+typedef uint64_t __attribute__((may_alias, aligned(1))) memop_word;
+
+void* memcpy(void* dst, const void* src, size_t n) {
+  20006a:	55                   	push   %rbp
+  20006b:	48 89 e5             	mov    %rsp,%rbp
+  20006e:	48 83 ec 48          	sub    $0x48,%rsp
+  200072:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  200076:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  20007a:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+    char* d = (char*) dst;
+  20007e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200082:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    const char* s = (const char*) src;
+  200086:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  20008a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (n >= MEMOP_WORD_MIN) {
+  20008e:	48 83 7d b8 3f       	cmpq   $0x3f,-0x48(%rbp)
+  200093:	0f 86 c5 00 00 00    	jbe    20015e <memcpy+0xf4>
+        size_t head = -(uintptr_t) d & 7;
+  200099:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20009d:	48 f7 d8             	neg    %rax
+  2000a0:	83 e0 07             	and    $0x7,%eax
+  2000a3:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        size_t words = (n - head) / 8;
+  2000a7:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  2000ab:	48 2b 45 e8          	sub    -0x18(%rbp),%rax
+  2000af:	48 c1 e8 03          	shr    $0x3,%rax
+  2000b3:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+        n = (n - head) % 8;
+  2000b7:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  2000bb:	48 2b 45 e8          	sub    -0x18(%rbp),%rax
+  2000bf:	83 e0 07             	and    $0x7,%eax
+  2000c2:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        asm volatile("rep movsb" : "+D" (d), "+S" (s), "+c" (head)
+  2000c6:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  2000ca:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  2000ce:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2000d2:	48 89 cf             	mov    %rcx,%rdi
+  2000d5:	48 89 d6             	mov    %rdx,%rsi
+  2000d8:	48 89 c1             	mov    %rax,%rcx
+  2000db:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  2000dd:	48 89 c8             	mov    %rcx,%rax
+  2000e0:	48 89 f2             	mov    %rsi,%rdx
+  2000e3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  2000e7:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  2000eb:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                     : : "memory");
+        asm volatile("rep movsq" : "+D" (d), "+S" (s), "+c" (words)
+  2000ef:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  2000f3:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  2000f7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  2000fb:	48 89 cf             	mov    %rcx,%rdi
+  2000fe:	48 89 d6             	mov    %rdx,%rsi
+  200101:	48 89 c1             	mov    %rax,%rcx
+  200104:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  200107:	48 89 c8             	mov    %rcx,%rax
+  20010a:	48 89 f2             	mov    %rsi,%rdx
+  20010d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  200111:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  200115:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+                     : : "memory");
+    }
+    for (; n >= 16; n -= 16, s += 16, d += 16) {
+  200119:	eb 43                	jmp    20015e <memcpy+0xf4>
+        memop_word a = ((const memop_word*) s)[0];
+  20011b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  20011f:	48 8b 00             	mov    (%rax),%rax
+  200122:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+        memop_word b = ((const memop_word*) s)[1];
+  200126:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  20012a:	48 83 c0 08          	add    $0x8,%rax
+  20012e:	48 8b 00             	mov    (%rax),%rax
+  200131:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+        ((memop_word*) d)[0] = a;
+  200135:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200139:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  20013d:	48 89 10             	mov    %rdx,(%rax)
+        ((memop_word*) d)[1] = b;
+  200140:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200144:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  200148:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  20014c:	48 89 02             	mov    %rax,(%rdx)
+    for (; n >= 16; n -= 16, s += 16, d += 16) {
+  20014f:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  200154:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  200159:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  20015e:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  200163:	77 b6                	ja     20011b <memcpy+0xb1>
+    }
+    for (; n > 0; --n, ++s, ++d) {
+  200165:	eb 1c                	jmp    200183 <memcpy+0x119>
+        *d = *s;
+  200167:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  20016b:	0f b6 10             	movzbl (%rax),%edx
+  20016e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200172:	88 10                	mov    %dl,(%rax)
+    for (; n > 0; --n, ++s, ++d) {
+  200174:	48 83 6d b8 01       	subq   $0x1,-0x48(%rbp)
+  200179:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  20017e:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  200183:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  200188:	75 dd                	jne    200167 <memcpy+0xfd>
+    }
+    return dst;
+  20018a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  20018e:	c9                   	leave
+  20018f:	c3                   	ret
+
+0000000000200190 <memmove>:
+
+void* memmove(void* dst, const void* src, size_t n) {
+  200190:	55                   	push   %rbp
+  200191:	48 89 e5             	mov    %rsp,%rbp
+  200194:	48 83 ec 38          	sub    $0x38,%rsp
+  200198:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  20019c:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  2001a0:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    const char* s = (const char*) src;
+  2001a4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  2001a8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    char* d = (char*) dst;
+  2001ac:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  2001b0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (!(s < d && s + n > d)) {
+  2001b4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2001b8:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  2001bc:	73 11                	jae    2001cf <memmove+0x3f>
+  2001be:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  2001c2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  2001c6:	48 01 d0             	add    %rdx,%rax
+  2001c9:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  2001cd:	72 1c                	jb     2001eb <memmove+0x5b>
+        // a forward copy never overwrites source bytes it has yet to read
+        return memcpy(dst, src, n);
+  2001cf:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  2001d3:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  2001d7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  2001db:	48 89 ce             	mov    %rcx,%rsi
+  2001de:	48 89 c7             	mov    %rax,%rdi
+  2001e1:	e8 84 fe ff ff       	call   20006a <memcpy>
+  2001e6:	e9 94 00 00 00       	jmp    20027f <memmove+0xef>
+    }
+
+    // copy backwards: the tail bytes, then words down to the start
+    size_t words = n / 8;
+  2001eb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  2001ef:	48 c1 e8 03          	shr    $0x3,%rax
+  2001f3:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    size_t tail = n % 8;
+  2001f7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  2001fb:	83 e0 07             	and    $0x7,%eax
+  2001fe:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    s += n - 1, d += n - 1;
+  200202:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200206:	48 83 e8 01          	sub    $0x1,%rax
+  20020a:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  20020e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200212:	48 83 e8 01          	sub    $0x1,%rax
+  200216:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    asm volatile("std; rep movsb; cld" : "+D" (d), "+S" (s), "+c" (tail)
+  20021a:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  20021e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  200222:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  200226:	48 89 cf             	mov    %rcx,%rdi
+  200229:	48 89 d6             	mov    %rdx,%rsi
+  20022c:	48 89 c1             	mov    %rax,%rcx
+  20022f:	fd                   	std
+  200230:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  200232:	fc                   	cld
+  200233:	48 89 c8             	mov    %rcx,%rax
+  200236:	48 89 f2             	mov    %rsi,%rdx
+  200239:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  20023d:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  200241:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+                 : : "memory", "cc");
+    s -= 7, d -= 7;
+  200245:	48 83 6d f8 07       	subq   $0x7,-0x8(%rbp)
+  20024a:	48 83 6d f0 07       	subq   $0x7,-0x10(%rbp)
+    asm volatile("std; rep movsq; cld" : "+D" (d), "+S" (s), "+c" (words)
+  20024f:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  200253:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  200257:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20025b:	48 89 cf             	mov    %rcx,%rdi
+  20025e:	48 89 d6             	mov    %rdx,%rsi
+  200261:	48 89 c1             	mov    %rax,%rcx
+  200264:	fd                   	std
+  200265:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  200268:	fc                   	cld
+  200269:	48 89 c8             	mov    %rcx,%rax
+  20026c:	48 89 f2             	mov    %rsi,%rdx
+  20026f:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  200273:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  200277:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 : : "memory", "cc");
+    return dst;
+  20027b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  20027f:	c9                   	leave
+  200280:	c3                   	ret
+
+0000000000200281 <memset>:
+
+void* memset(void* v, int c, size_t n) {
+  200281:	55                   	push   %rbp
+  200282:	48 89 e5             	mov    %rsp,%rbp
+  200285:	48 83 ec 38          	sub    $0x38,%rsp
+  200289:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  20028d:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  200290:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    char* p = (char*) v;
+  200294:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  200298:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    uint64_t word = (uint8_t) c * 0x0101010101010101UL;
+  20029c:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  20029f:	0f b6 c0             	movzbl %al,%eax
+  2002a2:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  2002a9:	01 01 01 
+  2002ac:	48 0f af c2          	imul   %rdx,%rax
+  2002b0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (n >= MEMOP_WORD_MIN) {
+  2002b4:	48 83 7d c8 3f       	cmpq   $0x3f,-0x38(%rbp)
+  2002b9:	0f 86 9e 00 00 00    	jbe    20035d <memset+0xdc>
+        size_t head = -(uintptr_t) p & 7;
+  2002bf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2002c3:	48 f7 d8             	neg    %rax
+  2002c6:	83 e0 07             	and    $0x7,%eax
+  2002c9:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        size_t words = (n - head) / 8;
+  2002cd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  2002d1:	48 2b 45 e8          	sub    -0x18(%rbp),%rax
+  2002d5:	48 c1 e8 03          	shr    $0x3,%rax
+  2002d9:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+        n = (n - head) % 8;
+  2002dd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  2002e1:	48 2b 45 e8          	sub    -0x18(%rbp),%rax
+  2002e5:	83 e0 07             	and    $0x7,%eax
+  2002e8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        asm volatile("rep stosb" : "+D" (p), "+c" (head) : "a" (word)
+  2002ec:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2002f0:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  2002f4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  2002f8:	48 89 ce             	mov    %rcx,%rsi
+  2002fb:	48 89 f7             	mov    %rsi,%rdi
+  2002fe:	48 89 d1             	mov    %rdx,%rcx
+  200301:	f3 aa                	rep stos %al,%es:(%rdi)
+  200303:	48 89 ca             	mov    %rcx,%rdx
+  200306:	48 89 fe             	mov    %rdi,%rsi
+  200309:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  20030d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+                     : "memory");
+        asm volatile("rep stosq" : "+D" (p), "+c" (words) : "a" (word)
+  200311:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  200315:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  200319:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  20031d:	48 89 ce             	mov    %rcx,%rsi
+  200320:	48 89 f7             	mov    %rsi,%rdi
+  200323:	48 89 d1             	mov    %rdx,%rcx
+  200326:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  200329:	48 89 ca             	mov    %rcx,%rdx
+  20032c:	48 89 fe             	mov    %rdi,%rsi
+  20032f:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  200333:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+                     : "memory");
+    }
+    for (; n >= 16; n -= 16, p += 16) {
+  200337:	eb 24                	jmp    20035d <memset+0xdc>
+        ((memop_word*) p)[0] = word;
+  200339:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20033d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  200341:	48 89 10             	mov    %rdx,(%rax)
+        ((memop_word*) p)[1] = word;
+  200344:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200348:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  20034c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  200350:	48 89 02             	mov    %rax,(%rdx)
+    for (; n >= 16; n -= 16, p += 16) {
+  200353:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  200358:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  20035d:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  200362:	77 d5                	ja     200339 <memset+0xb8>
+    }
+    for (; n > 0; ++p, --n) {
+  200364:	eb 15                	jmp    20037b <memset+0xfa>
+        *p = c;
+  200366:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  200369:	89 c2                	mov    %eax,%edx
+  20036b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20036f:	88 10                	mov    %dl,(%rax)
+    for (; n > 0; ++p, --n) {
+  200371:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  200376:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  20037b:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  200380:	75 e4                	jne    200366 <memset+0xe5>
+    }
+    return v;
+  200382:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  200386:	c9                   	leave
+  200387:	c3                   	ret
+
+0000000000200388 <strlen>:
+
+size_t strlen(const char* s) {
+  200388:	55                   	push   %rbp
+  200389:	48 89 e5             	mov    %rsp,%rbp
+  20038c:	48 83 ec 18          	sub    $0x18,%rsp
+  200390:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    size_t n;
+    for (n = 0; *s != '\0'; ++s) {
+  200394:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  20039b:	00 
+  20039c:	eb 0a                	jmp    2003a8 <strlen+0x20>
+        ++n;
+  20039e:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    for (n = 0; *s != '\0'; ++s) {
+  2003a3:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  2003a8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2003ac:	0f b6 00             	movzbl (%rax),%eax
+  2003af:	84 c0                	test   %al,%al
+  2003b1:	75 eb                	jne    20039e <strlen+0x16>
+    }
+    return n;
+  2003b3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  2003b7:	c9                   	leave
+  2003b8:	c3                   	ret
+
+00000000002003b9 <strnlen>:
+
+size_t strnlen(const char* s, size_t maxlen) {
+  2003b9:	55                   	push   %rbp
+  2003ba:	48 89 e5             	mov    %rsp,%rbp
+  2003bd:	48 83 ec 20          	sub    $0x20,%rsp
+  2003c1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  2003c5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    size_t n;
+    for (n = 0; n != maxlen && *s != '\0'; ++s) {
+  2003c9:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  2003d0:	00 
+  2003d1:	eb 0a                	jmp    2003dd <strnlen+0x24>
+        ++n;
+  2003d3:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    for (n = 0; n != maxlen && *s != '\0'; ++s) {
+  2003d8:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  2003dd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2003e1:	48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+  2003e5:	74 0b                	je     2003f2 <strnlen+0x39>
+  2003e7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2003eb:	0f b6 00             	movzbl (%rax),%eax
+  2003ee:	84 c0                	test   %al,%al
+  2003f0:	75 e1                	jne    2003d3 <strnlen+0x1a>
+    }
+    return n;
+  2003f2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  2003f6:	c9                   	leave
+  2003f7:	c3                   	ret
+
+00000000002003f8 <strcpy>:
+
+char* strcpy(char* dst, const char* src) {
+  2003f8:	55                   	push   %rbp
+  2003f9:	48 89 e5             	mov    %rsp,%rbp
+  2003fc:	48 83 ec 20          	sub    $0x20,%rsp
+  200400:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  200404:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    char* d = dst;
+  200408:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20040c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    do {
+        *d++ = *src++;
+  200410:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  200414:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  200418:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  20041c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200420:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  200424:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+  200428:	0f b6 12             	movzbl (%rdx),%edx
+  20042b:	88 10                	mov    %dl,(%rax)
+    } while (d[-1]);
+  20042d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200431:	48 83 e8 01          	sub    $0x1,%rax
+  200435:	0f b6 00             	movzbl (%rax),%eax
+  200438:	84 c0                	test   %al,%al
+  20043a:	75 d4                	jne    200410 <strcpy+0x18>
+    return dst;
+  20043c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  200440:	c9                   	leave
+  200441:	c3                   	ret
+
+0000000000200442 <strcmp>:
+
+int strcmp(const char* a, const char* b) {
+  200442:	55                   	push   %rbp
+  200443:	48 89 e5             	mov    %rsp,%rbp
+  200446:	48 83 ec 10          	sub    $0x10,%rsp
+  20044a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  20044e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    while (*a && *b && *a == *b) {
+  200452:	eb 0a                	jmp    20045e <strcmp+0x1c>
+        ++a, ++b;
+  200454:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  200459:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+    while (*a && *b && *a == *b) {
+  20045e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200462:	0f b6 00             	movzbl (%rax),%eax
+  200465:	84 c0                	test   %al,%al
+  200467:	74 1d                	je     200486 <strcmp+0x44>
+  200469:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  20046d:	0f b6 00             	movzbl (%rax),%eax
+  200470:	84 c0                	test   %al,%al
+  200472:	74 12                	je     200486 <strcmp+0x44>
+  200474:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200478:	0f b6 10             	movzbl (%rax),%edx
+  20047b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  20047f:	0f b6 00             	movzbl (%rax),%eax
+  200482:	38 c2                	cmp    %al,%dl
+  200484:	74 ce                	je     200454 <strcmp+0x12>
+    }
+    return ((unsigned char) *a > (unsigned char) *b)
+  200486:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20048a:	0f b6 00             	movzbl (%rax),%eax
+  20048d:	89 c2                	mov    %eax,%edx
+  20048f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  200493:	0f b6 00             	movzbl (%rax),%eax
+  200496:	38 d0                	cmp    %dl,%al
+  200498:	0f 92 c0             	setb   %al
+  20049b:	0f b6 d0             	movzbl %al,%edx
+        - ((unsigned char) *a < (unsigned char) *b);
+  20049e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2004a2:	0f b6 00             	movzbl (%rax),%eax
+  2004a5:	89 c1                	mov    %eax,%ecx
+  2004a7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2004ab:	0f b6 00             	movzbl (%rax),%eax
+  2004ae:	38 c1                	cmp    %al,%cl
+  2004b0:	0f 92 c0             	setb   %al
+  2004b3:	0f b6 c0             	movzbl %al,%eax
+  2004b6:	29 c2                	sub    %eax,%edx
+  2004b8:	89 d0                	mov    %edx,%eax
+}
+  2004ba:	c9                   	leave
+  2004bb:	c3                   	ret
+
+00000000002004bc <strchr>:
+
+char* strchr(const char* s, int c) {
+  2004bc:	55                   	push   %rbp
+  2004bd:	48 89 e5             	mov    %rsp,%rbp
+  2004c0:	48 83 ec 10          	sub    $0x10,%rsp
+  2004c4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  2004c8:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    while (*s && *s != (char) c) {
+  2004cb:	eb 05                	jmp    2004d2 <strchr+0x16>
+        ++s;
+  2004cd:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    while (*s && *s != (char) c) {
+  2004d2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2004d6:	0f b6 00             	movzbl (%rax),%eax
+  2004d9:	84 c0                	test   %al,%al
+  2004db:	74 0e                	je     2004eb <strchr+0x2f>
+  2004dd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2004e1:	0f b6 00             	movzbl (%rax),%eax
+  2004e4:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  2004e7:	38 d0                	cmp    %dl,%al
+  2004e9:	75 e2                	jne    2004cd <strchr+0x11>
+    }
+    if (*s == (char) c) {
+  2004eb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2004ef:	0f b6 00             	movzbl (%rax),%eax
+  2004f2:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  2004f5:	38 d0                	cmp    %dl,%al
+  2004f7:	75 06                	jne    2004ff <strchr+0x43>
+        return (char*) s;
+  2004f9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2004fd:	eb 05                	jmp    200504 <strchr+0x48>
+    } else {
+        return NULL;
+  2004ff:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+}
+  200504:	c9                   	leave
+  200505:	c3                   	ret
+
+0000000000200506 <rand>:
+
+// New randomness implementation
+static int      rand_seed_set;
+static unsigned rand_seed;
+
+int rand(void) {
+  200506:	55                   	push   %rbp
+  200507:	48 89 e5             	mov    %rsp,%rbp
+  20050a:	48 83 ec 10          	sub    $0x10,%rsp
+    if (!rand_seed_set) {
+  20050e:	8b 05 fc 2a 00 00    	mov    0x2afc(%rip),%eax        # 203010 <rand_seed_set>
+  200514:	85 c0                	test   %eax,%eax
+  200516:	75 2c                	jne    200544 <rand+0x3e>
+#if WEENSYOS_KERNEL
+        extern unsigned get_entropy_value(void);
+        srand(get_entropy_value());
+#else           // user‑space build
+       /* kernel-refreshed seed from the kernel data page: no system call */
+       srand((unsigned) (vdso()->seed[0] ^ read_cycle_counter()));
+  200518:	e8 42 fb ff ff       	call   20005f <vdso>
+  20051d:	48 8b 40 18          	mov    0x18(%rax),%rax
+  200521:	89 c1                	mov    %eax,%ecx
+    }
+}
+
+static inline uint64_t read_cycle_counter(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+  200523:	0f 31                	rdtsc
+  200525:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  200528:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    return ((uint64_t) hi << 32) | lo;
+  20052b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  20052e:	48 c1 e0 20          	shl    $0x20,%rax
+  200532:	48 89 c2             	mov    %rax,%rdx
+  200535:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  200538:	48 09 d0             	or     %rdx,%rax
+  20053b:	31 c8                	xor    %ecx,%eax
+  20053d:	89 c7                	mov    %eax,%edi
+  20053f:	e8 24 00 00 00       	call   200568 <srand>
+#endif
+    }
+    rand_seed = rand_seed * 1664525U + 1013904223U;   // LCG
+  200544:	8b 05 ca 2a 00 00    	mov    0x2aca(%rip),%eax        # 203014 <rand_seed>
+  20054a:	69 c0 0d 66 19 00    	imul   $0x19660d,%eax,%eax
+  200550:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+  200555:	89 05 b9 2a 00 00    	mov    %eax,0x2ab9(%rip)        # 203014 <rand_seed>
+    return rand_seed & RAND_MAX;
+  20055b:	8b 05 b3 2a 00 00    	mov    0x2ab3(%rip),%eax        # 203014 <rand_seed>
+  200561:	25 ff ff ff 7f       	and    $0x7fffffff,%eax
+}
+  200566:	c9                   	leave
+  200567:	c3                   	ret
+
+0000000000200568 <srand>:
+
+void srand(unsigned seed) {
+  200568:	55                   	push   %rbp
+  200569:	48 89 e5             	mov    %rsp,%rbp
+  20056c:	48 83 ec 08          	sub    $0x8,%rsp
+  200570:	89 7d fc             	mov    %edi,-0x4(%rbp)
+    rand_seed      = seed;
+  200573:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  200576:	89 05 98 2a 00 00    	mov    %eax,0x2a98(%rip)        # 203014 <rand_seed>
+    rand_seed_set  = 1;
+  20057c:	c7 05 8a 2a 00 00 01 	movl   $0x1,0x2a8a(%rip)        # 203010 <rand_seed_set>
+  200583:	00 00 00 
+}
+  200586:	90                   	nop
+  200587:	c9                   	leave
+  200588:	c3                   	ret
+
+0000000000200589 <fill_numbuf>:
+//    Print a message onto the console, starting at the given cursor position.
+
+// snprintf, vsnprintf
+//    Format a string into a buffer.
+
+static char* fill_numbuf(char* numbuf_end, unsigned long val, int base) {
+  200589:	55                   	push   %rbp
+  20058a:	48 89 e5             	mov    %rsp,%rbp
+  20058d:	48 83 ec 28          	sub    $0x28,%rsp
+  200591:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  200595:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  200599:	89 55 dc             	mov    %edx,-0x24(%rbp)
+    static const char upper_digits[] = "0123456789ABCDEF";
+    static const char lower_digits[] = "0123456789abcdef";
+
+    const char* digits = upper_digits;
+  20059c:	48 8d 05 fd 1b 00 00 	lea    0x1bfd(%rip),%rax        # 2021a0 <upper_digits.1>
+  2005a3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (base < 0) {
+  2005a7:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  2005ab:	79 0e                	jns    2005bb <fill_numbuf+0x32>
+        digits = lower_digits;
+  2005ad:	48 8d 05 0c 1c 00 00 	lea    0x1c0c(%rip),%rax        # 2021c0 <lower_digits.0>
+  2005b4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+        base = -base;
+  2005b8:	f7 5d dc             	negl   -0x24(%rbp)
+    }
+
+    *--numbuf_end = '\0';
+  2005bb:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  2005c0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2005c4:	c6 00 00             	movb   $0x0,(%rax)
+    do {
+        *--numbuf_end = digits[val % base];
+  2005c7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  2005ca:	48 63 c8             	movslq %eax,%rcx
+  2005cd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  2005d1:	ba 00 00 00 00       	mov    $0x0,%edx
+  2005d6:	48 f7 f1             	div    %rcx
+  2005d9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2005dd:	48 01 d0             	add    %rdx,%rax
+  2005e0:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  2005e5:	0f b6 10             	movzbl (%rax),%edx
+  2005e8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2005ec:	88 10                	mov    %dl,(%rax)
+        val /= base;
+  2005ee:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  2005f1:	48 63 f0             	movslq %eax,%rsi
+  2005f4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  2005f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  2005fd:	48 f7 f6             	div    %rsi
+  200600:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    } while (val != 0);
+  200604:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  200609:	75 bc                	jne    2005c7 <fill_numbuf+0x3e>
+    return numbuf_end;
+  20060b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  20060f:	c9                   	leave
+  200610:	c3                   	ret
+
+0000000000200611 <printer_vprintf>:
+#define FLAG_NUMERIC            (1<<5)
+#define FLAG_SIGNED             (1<<6)
+#define FLAG_NEGATIVE           (1<<7)
+#define FLAG_ALT2               (1<<8)
+
+void printer_vprintf(printer* p, int color, const char* format, va_list val) {
+  200611:	55                   	push   %rbp
+  200612:	48 89 e5             	mov    %rsp,%rbp
+  200615:	53                   	push   %rbx
+  200616:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  20061d:	48 89 bd 78 ff ff ff 	mov    %rdi,-0x88(%rbp)
+  200624:	89 b5 74 ff ff ff    	mov    %esi,-0x8c(%rbp)
+  20062a:	48 89 95 68 ff ff ff 	mov    %rdx,-0x98(%rbp)
+  200631:	48 89 8d 60 ff ff ff 	mov    %rcx,-0xa0(%rbp)
+#define NUMBUFSIZ 24
+    char numbuf[NUMBUFSIZ];
+
+    for (; *format; ++format) {
+  200638:	e9 be 09 00 00       	jmp    200ffb <printer_vprintf+0x9ea>
+        if (*format != '%') {
+  20063d:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200644:	0f b6 00             	movzbl (%rax),%eax
+  200647:	3c 25                	cmp    $0x25,%al
+  200649:	74 31                	je     20067c <printer_vprintf+0x6b>
+            p->putc(p, *format, color);
+  20064b:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200652:	4c 8b 00             	mov    (%rax),%r8
+  200655:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  20065c:	0f b6 00             	movzbl (%rax),%eax
+  20065f:	0f b6 c8             	movzbl %al,%ecx
+  200662:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  200668:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  20066f:	89 ce                	mov    %ecx,%esi
+  200671:	48 89 c7             	mov    %rax,%rdi
+  200674:	41 ff d0             	call   *%r8
+            continue;
+  200677:	e9 77 09 00 00       	jmp    200ff3 <printer_vprintf+0x9e2>
+        }
+
+        // process flags
+        int flags = 0;
+  20067c:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+        for (++format; *format; ++format) {
+  200683:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  20068a:	01 
+  20068b:	eb 4f                	jmp    2006dc <printer_vprintf+0xcb>
+            const char* flagc = strchr(flag_chars, *format);
+  20068d:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200694:	0f b6 00             	movzbl (%rax),%eax
+  200697:	0f be c0             	movsbl %al,%eax
+  20069a:	89 c6                	mov    %eax,%esi
+  20069c:	48 8d 05 ad 19 00 00 	lea    0x19ad(%rip),%rax        # 202050 <flag_chars>
+  2006a3:	48 89 c7             	mov    %rax,%rdi
+  2006a6:	e8 11 fe ff ff       	call   2004bc <strchr>
+  2006ab:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (flagc) {
+  2006af:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  2006b4:	74 36                	je     2006ec <printer_vprintf+0xdb>
+                flags |= 1 << (flagc - flag_chars);
+  2006b6:	48 8d 05 93 19 00 00 	lea    0x1993(%rip),%rax        # 202050 <flag_chars>
+  2006bd:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  2006c1:	48 29 c2             	sub    %rax,%rdx
+  2006c4:	89 d0                	mov    %edx,%eax
+  2006c6:	ba 01 00 00 00       	mov    $0x1,%edx
+  2006cb:	89 c1                	mov    %eax,%ecx
+  2006cd:	d3 e2                	shl    %cl,%edx
+  2006cf:	89 d0                	mov    %edx,%eax
+  2006d1:	09 45 ec             	or     %eax,-0x14(%rbp)
+        for (++format; *format; ++format) {
+  2006d4:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  2006db:	01 
+  2006dc:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  2006e3:	0f b6 00             	movzbl (%rax),%eax
+  2006e6:	84 c0                	test   %al,%al
+  2006e8:	75 a3                	jne    20068d <printer_vprintf+0x7c>
+  2006ea:	eb 01                	jmp    2006ed <printer_vprintf+0xdc>
+            } else {
+                break;
+  2006ec:	90                   	nop
+            }
+        }
+
+        // process width
+        int width = -1;
+  2006ed:	c7 45 e8 ff ff ff ff 	movl   $0xffffffff,-0x18(%rbp)
+        if (*format >= '1' && *format <= '9') {
+  2006f4:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  2006fb:	0f b6 00             	movzbl (%rax),%eax
+  2006fe:	3c 30                	cmp    $0x30,%al
+  200700:	7e 67                	jle    200769 <printer_vprintf+0x158>
+  200702:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200709:	0f b6 00             	movzbl (%rax),%eax
+  20070c:	3c 39                	cmp    $0x39,%al
+  20070e:	7f 59                	jg     200769 <printer_vprintf+0x158>
+            for (width = 0; *format >= '0' && *format <= '9'; ) {
+  200710:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%rbp)
+  200717:	eb 2e                	jmp    200747 <printer_vprintf+0x136>
+                width = 10 * width + *format++ - '0';
+  200719:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  20071c:	89 d0                	mov    %edx,%eax
+  20071e:	c1 e0 02             	shl    $0x2,%eax
+  200721:	01 d0                	add    %edx,%eax
+  200723:	01 c0                	add    %eax,%eax
+  200725:	89 c1                	mov    %eax,%ecx
+  200727:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  20072e:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  200732:	48 89 95 68 ff ff ff 	mov    %rdx,-0x98(%rbp)
+  200739:	0f b6 00             	movzbl (%rax),%eax
+  20073c:	0f be c0             	movsbl %al,%eax
+  20073f:	01 c8                	add    %ecx,%eax
+  200741:	83 e8 30             	sub    $0x30,%eax
+  200744:	89 45 e8             	mov    %eax,-0x18(%rbp)
+            for (width = 0; *format >= '0' && *format <= '9'; ) {
+  200747:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  20074e:	0f b6 00             	movzbl (%rax),%eax
+  200751:	3c 2f                	cmp    $0x2f,%al
+  200753:	0f 8e 85 00 00 00    	jle    2007de <printer_vprintf+0x1cd>
+  200759:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200760:	0f b6 00             	movzbl (%rax),%eax
+  200763:	3c 39                	cmp    $0x39,%al
+  200765:	7e b2                	jle    200719 <printer_vprintf+0x108>
+        if (*format >= '1' && *format <= '9') {
+  200767:	eb 75                	jmp    2007de <printer_vprintf+0x1cd>
+            }
+        } else if (*format == '*') {
+  200769:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200770:	0f b6 00             	movzbl (%rax),%eax
+  200773:	3c 2a                	cmp    $0x2a,%al
+  200775:	75 68                	jne    2007df <printer_vprintf+0x1ce>
+            width = va_arg(val, int);
+  200777:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  20077e:	8b 00                	mov    (%rax),%eax
+  200780:	83 f8 2f             	cmp    $0x2f,%eax
+  200783:	77 30                	ja     2007b5 <printer_vprintf+0x1a4>
+  200785:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  20078c:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200790:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200797:	8b 00                	mov    (%rax),%eax
+  200799:	89 c0                	mov    %eax,%eax
+  20079b:	48 01 d0             	add    %rdx,%rax
+  20079e:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  2007a5:	8b 12                	mov    (%rdx),%edx
+  2007a7:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  2007aa:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  2007b1:	89 0a                	mov    %ecx,(%rdx)
+  2007b3:	eb 1a                	jmp    2007cf <printer_vprintf+0x1be>
+  2007b5:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2007bc:	48 8b 40 08          	mov    0x8(%rax),%rax
+  2007c0:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  2007c4:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  2007cb:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  2007cf:	8b 00                	mov    (%rax),%eax
+  2007d1:	89 45 e8             	mov    %eax,-0x18(%rbp)
+            ++format;
+  2007d4:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  2007db:	01 
+  2007dc:	eb 01                	jmp    2007df <printer_vprintf+0x1ce>
+        if (*format >= '1' && *format <= '9') {
+  2007de:	90                   	nop
+        }
+
+        // process precision
+        int precision = -1;
+  2007df:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%rbp)
+        if (*format == '.') {
+  2007e6:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  2007ed:	0f b6 00             	movzbl (%rax),%eax
+  2007f0:	3c 2e                	cmp    $0x2e,%al
+  2007f2:	0f 85 00 01 00 00    	jne    2008f8 <printer_vprintf+0x2e7>
+            ++format;
+  2007f8:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  2007ff:	01 
+            if (*format >= '0' && *format <= '9') {
+  200800:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200807:	0f b6 00             	movzbl (%rax),%eax
+  20080a:	3c 2f                	cmp    $0x2f,%al
+  20080c:	7e 67                	jle    200875 <printer_vprintf+0x264>
+  20080e:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200815:	0f b6 00             	movzbl (%rax),%eax
+  200818:	3c 39                	cmp    $0x39,%al
+  20081a:	7f 59                	jg     200875 <printer_vprintf+0x264>
+                for (precision = 0; *format >= '0' && *format <= '9'; ) {
+  20081c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%rbp)
+  200823:	eb 2e                	jmp    200853 <printer_vprintf+0x242>
+                    precision = 10 * precision + *format++ - '0';
+  200825:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  200828:	89 d0                	mov    %edx,%eax
+  20082a:	c1 e0 02             	shl    $0x2,%eax
+  20082d:	01 d0                	add    %edx,%eax
+  20082f:	01 c0                	add    %eax,%eax
+  200831:	89 c1                	mov    %eax,%ecx
+  200833:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  20083a:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  20083e:	48 89 95 68 ff ff ff 	mov    %rdx,-0x98(%rbp)
+  200845:	0f b6 00             	movzbl (%rax),%eax
+  200848:	0f be c0             	movsbl %al,%eax
+  20084b:	01 c8                	add    %ecx,%eax
+  20084d:	83 e8 30             	sub    $0x30,%eax
+  200850:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+                for (precision = 0; *format >= '0' && *format <= '9'; ) {
+  200853:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  20085a:	0f b6 00             	movzbl (%rax),%eax
+  20085d:	3c 2f                	cmp    $0x2f,%al
+  20085f:	0f 8e 85 00 00 00    	jle    2008ea <printer_vprintf+0x2d9>
+  200865:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  20086c:	0f b6 00             	movzbl (%rax),%eax
+  20086f:	3c 39                	cmp    $0x39,%al
+  200871:	7e b2                	jle    200825 <printer_vprintf+0x214>
+            if (*format >= '0' && *format <= '9') {
+  200873:	eb 75                	jmp    2008ea <printer_vprintf+0x2d9>
+                }
+            } else if (*format == '*') {
+  200875:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  20087c:	0f b6 00             	movzbl (%rax),%eax
+  20087f:	3c 2a                	cmp    $0x2a,%al
+  200881:	75 68                	jne    2008eb <printer_vprintf+0x2da>
+                precision = va_arg(val, int);
+  200883:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  20088a:	8b 00                	mov    (%rax),%eax
+  20088c:	83 f8 2f             	cmp    $0x2f,%eax
+  20088f:	77 30                	ja     2008c1 <printer_vprintf+0x2b0>
+  200891:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200898:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  20089c:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2008a3:	8b 00                	mov    (%rax),%eax
+  2008a5:	89 c0                	mov    %eax,%eax
+  2008a7:	48 01 d0             	add    %rdx,%rax
+  2008aa:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  2008b1:	8b 12                	mov    (%rdx),%edx
+  2008b3:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  2008b6:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  2008bd:	89 0a                	mov    %ecx,(%rdx)
+  2008bf:	eb 1a                	jmp    2008db <printer_vprintf+0x2ca>
+  2008c1:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2008c8:	48 8b 40 08          	mov    0x8(%rax),%rax
+  2008cc:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  2008d0:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  2008d7:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  2008db:	8b 00                	mov    (%rax),%eax
+  2008dd:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+                ++format;
+  2008e0:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  2008e7:	01 
+  2008e8:	eb 01                	jmp    2008eb <printer_vprintf+0x2da>
+            if (*format >= '0' && *format <= '9') {
+  2008ea:	90                   	nop
+            }
+            if (precision < 0) {
+  2008eb:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  2008ef:	79 07                	jns    2008f8 <printer_vprintf+0x2e7>
+                precision = 0;
+  2008f1:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%rbp)
+            }
+        }
+
+        // process main conversion character
+        int base = 10;
+  2008f8:	c7 45 e0 0a 00 00 00 	movl   $0xa,-0x20(%rbp)
+        unsigned long num = 0;
+  2008ff:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  200906:	00 
+        int length = 0;
+  200907:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+        char* data = "";
+  20090e:	48 8d 05 41 17 00 00 	lea    0x1741(%rip),%rax        # 202056 <flag_chars+0x6>
+  200915:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    again:
+        switch (*format) {
+  200919:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200920:	0f b6 00             	movzbl (%rax),%eax
+  200923:	0f be c0             	movsbl %al,%eax
+  200926:	83 e8 43             	sub    $0x43,%eax
+  200929:	83 f8 37             	cmp    $0x37,%eax
+  20092c:	0f 87 b5 03 00 00    	ja     200ce7 <printer_vprintf+0x6d6>
+  200932:	89 c0                	mov    %eax,%eax
+  200934:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  20093b:	00 
+  20093c:	48 8d 05 21 17 00 00 	lea    0x1721(%rip),%rax        # 202064 <flag_chars+0x14>
+  200943:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+  200946:	48 98                	cltq
+  200948:	48 8d 15 15 17 00 00 	lea    0x1715(%rip),%rdx        # 202064 <flag_chars+0x14>
+  20094f:	48 01 d0             	add    %rdx,%rax
+  200952:	ff e0                	jmp    *%rax
+        case 'l':
+        case 'z':
+            length = 1;
+  200954:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+            ++format;
+  20095b:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  200962:	01 
+            goto again;
+  200963:	eb b4                	jmp    200919 <printer_vprintf+0x308>
+        case 'd':
+        case 'i': {
+            long x = length ? va_arg(val, long) : va_arg(val, int);
+  200965:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  200969:	74 5d                	je     2009c8 <printer_vprintf+0x3b7>
+  20096b:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200972:	8b 00                	mov    (%rax),%eax
+  200974:	83 f8 2f             	cmp    $0x2f,%eax
+  200977:	77 30                	ja     2009a9 <printer_vprintf+0x398>
+  200979:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200980:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200984:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  20098b:	8b 00                	mov    (%rax),%eax
+  20098d:	89 c0                	mov    %eax,%eax
+  20098f:	48 01 d0             	add    %rdx,%rax
+  200992:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200999:	8b 12                	mov    (%rdx),%edx
+  20099b:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  20099e:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  2009a5:	89 0a                	mov    %ecx,(%rdx)
+  2009a7:	eb 1a                	jmp    2009c3 <printer_vprintf+0x3b2>
+  2009a9:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2009b0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  2009b4:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  2009b8:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  2009bf:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  2009c3:	48 8b 00             	mov    (%rax),%rax
+  2009c6:	eb 5c                	jmp    200a24 <printer_vprintf+0x413>
+  2009c8:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2009cf:	8b 00                	mov    (%rax),%eax
+  2009d1:	83 f8 2f             	cmp    $0x2f,%eax
+  2009d4:	77 30                	ja     200a06 <printer_vprintf+0x3f5>
+  2009d6:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2009dd:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  2009e1:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2009e8:	8b 00                	mov    (%rax),%eax
+  2009ea:	89 c0                	mov    %eax,%eax
+  2009ec:	48 01 d0             	add    %rdx,%rax
+  2009ef:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  2009f6:	8b 12                	mov    (%rdx),%edx
+  2009f8:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  2009fb:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200a02:	89 0a                	mov    %ecx,(%rdx)
+  200a04:	eb 1a                	jmp    200a20 <printer_vprintf+0x40f>
+  200a06:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200a0d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200a11:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200a15:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200a1c:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200a20:	8b 00                	mov    (%rax),%eax
+  200a22:	48 98                	cltq
+  200a24:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+            int negative = x < 0 ? FLAG_NEGATIVE : 0;
+  200a28:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  200a2c:	48 c1 f8 38          	sar    $0x38,%rax
+  200a30:	25 80 00 00 00       	and    $0x80,%eax
+  200a35:	89 45 a4             	mov    %eax,-0x5c(%rbp)
+            num = negative ? -x : x;
+  200a38:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  200a3c:	74 09                	je     200a47 <printer_vprintf+0x436>
+  200a3e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  200a42:	48 f7 d8             	neg    %rax
+  200a45:	eb 04                	jmp    200a4b <printer_vprintf+0x43a>
+  200a47:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  200a4b:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+            flags |= FLAG_NUMERIC | FLAG_SIGNED | negative;
+  200a4f:	8b 45 a4             	mov    -0x5c(%rbp),%eax
+  200a52:	83 c8 60             	or     $0x60,%eax
+  200a55:	09 45 ec             	or     %eax,-0x14(%rbp)
+            break;
+  200a58:	e9 cf 02 00 00       	jmp    200d2c <printer_vprintf+0x71b>
+        }
+        case 'u':
+        format_unsigned:
+            num = length ? va_arg(val, unsigned long) : va_arg(val, unsigned);
+  200a5d:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  200a61:	74 5d                	je     200ac0 <printer_vprintf+0x4af>
+  200a63:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200a6a:	8b 00                	mov    (%rax),%eax
+  200a6c:	83 f8 2f             	cmp    $0x2f,%eax
+  200a6f:	77 30                	ja     200aa1 <printer_vprintf+0x490>
+  200a71:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200a78:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200a7c:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200a83:	8b 00                	mov    (%rax),%eax
+  200a85:	89 c0                	mov    %eax,%eax
+  200a87:	48 01 d0             	add    %rdx,%rax
+  200a8a:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200a91:	8b 12                	mov    (%rdx),%edx
+  200a93:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200a96:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200a9d:	89 0a                	mov    %ecx,(%rdx)
+  200a9f:	eb 1a                	jmp    200abb <printer_vprintf+0x4aa>
+  200aa1:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200aa8:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200aac:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200ab0:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200ab7:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200abb:	48 8b 00             	mov    (%rax),%rax
+  200abe:	eb 5c                	jmp    200b1c <printer_vprintf+0x50b>
+  200ac0:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200ac7:	8b 00                	mov    (%rax),%eax
+  200ac9:	83 f8 2f             	cmp    $0x2f,%eax
+  200acc:	77 30                	ja     200afe <printer_vprintf+0x4ed>
+  200ace:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200ad5:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200ad9:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200ae0:	8b 00                	mov    (%rax),%eax
+  200ae2:	89 c0                	mov    %eax,%eax
+  200ae4:	48 01 d0             	add    %rdx,%rax
+  200ae7:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200aee:	8b 12                	mov    (%rdx),%edx
+  200af0:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200af3:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200afa:	89 0a                	mov    %ecx,(%rdx)
+  200afc:	eb 1a                	jmp    200b18 <printer_vprintf+0x507>
+  200afe:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200b05:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200b09:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200b0d:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200b14:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200b18:	8b 00                	mov    (%rax),%eax
+  200b1a:	89 c0                	mov    %eax,%eax
+  200b1c:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+            flags |= FLAG_NUMERIC;
+  200b20:	83 4d ec 20          	orl    $0x20,-0x14(%rbp)
+            break;
+  200b24:	e9 03 02 00 00       	jmp    200d2c <printer_vprintf+0x71b>
+        case 'x':
+            base = -16;
+  200b29:	c7 45 e0 f0 ff ff ff 	movl   $0xfffffff0,-0x20(%rbp)
+            goto format_unsigned;
+  200b30:	e9 28 ff ff ff       	jmp    200a5d <printer_vprintf+0x44c>
+        case 'X':
+            base = 16;
+  200b35:	c7 45 e0 10 00 00 00 	movl   $0x10,-0x20(%rbp)
+            goto format_unsigned;
+  200b3c:	e9 1c ff ff ff       	jmp    200a5d <printer_vprintf+0x44c>
+        case 'p':
+            num = (uintptr_t) va_arg(val, void*);
+  200b41:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200b48:	8b 00                	mov    (%rax),%eax
+  200b4a:	83 f8 2f             	cmp    $0x2f,%eax
+  200b4d:	77 30                	ja     200b7f <printer_vprintf+0x56e>
+  200b4f:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200b56:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200b5a:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200b61:	8b 00                	mov    (%rax),%eax
+  200b63:	89 c0                	mov    %eax,%eax
+  200b65:	48 01 d0             	add    %rdx,%rax
+  200b68:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200b6f:	8b 12                	mov    (%rdx),%edx
+  200b71:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200b74:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200b7b:	89 0a                	mov    %ecx,(%rdx)
+  200b7d:	eb 1a                	jmp    200b99 <printer_vprintf+0x588>
+  200b7f:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200b86:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200b8a:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200b8e:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200b95:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200b99:	48 8b 00             	mov    (%rax),%rax
+  200b9c:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+            base = -16;
+  200ba0:	c7 45 e0 f0 ff ff ff 	movl   $0xfffffff0,-0x20(%rbp)
+            flags |= FLAG_ALT | FLAG_ALT2 | FLAG_NUMERIC;
+  200ba7:	81 4d ec 21 01 00 00 	orl    $0x121,-0x14(%rbp)
+            break;
+  200bae:	e9 79 01 00 00       	jmp    200d2c <printer_vprintf+0x71b>
+        case 's':
+            data = va_arg(val, char*);
+  200bb3:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200bba:	8b 00                	mov    (%rax),%eax
+  200bbc:	83 f8 2f             	cmp    $0x2f,%eax
+  200bbf:	77 30                	ja     200bf1 <printer_vprintf+0x5e0>
+  200bc1:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200bc8:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200bcc:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200bd3:	8b 00                	mov    (%rax),%eax
+  200bd5:	89 c0                	mov    %eax,%eax
+  200bd7:	48 01 d0             	add    %rdx,%rax
+  200bda:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200be1:	8b 12                	mov    (%rdx),%edx
+  200be3:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200be6:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200bed:	89 0a                	mov    %ecx,(%rdx)
+  200bef:	eb 1a                	jmp    200c0b <printer_vprintf+0x5fa>
+  200bf1:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200bf8:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200bfc:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200c00:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200c07:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200c0b:	48 8b 00             	mov    (%rax),%rax
+  200c0e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+            break;
+  200c12:	e9 15 01 00 00       	jmp    200d2c <printer_vprintf+0x71b>
+        case 'C':
+            color = va_arg(val, int);
+  200c17:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c1e:	8b 00                	mov    (%rax),%eax
+  200c20:	83 f8 2f             	cmp    $0x2f,%eax
+  200c23:	77 30                	ja     200c55 <printer_vprintf+0x644>
+  200c25:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c2c:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200c30:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c37:	8b 00                	mov    (%rax),%eax
+  200c39:	89 c0                	mov    %eax,%eax
+  200c3b:	48 01 d0             	add    %rdx,%rax
+  200c3e:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200c45:	8b 12                	mov    (%rdx),%edx
+  200c47:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200c4a:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200c51:	89 0a                	mov    %ecx,(%rdx)
+  200c53:	eb 1a                	jmp    200c6f <printer_vprintf+0x65e>
+  200c55:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c5c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200c60:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200c64:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200c6b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200c6f:	8b 00                	mov    (%rax),%eax
+  200c71:	89 85 74 ff ff ff    	mov    %eax,-0x8c(%rbp)
+            goto done;
+  200c77:	e9 77 03 00 00       	jmp    200ff3 <printer_vprintf+0x9e2>
+        case 'c':
+            data = numbuf;
+  200c7c:	48 8d 45 8c          	lea    -0x74(%rbp),%rax
+  200c80:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+            numbuf[0] = va_arg(val, int);
+  200c84:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c8b:	8b 00                	mov    (%rax),%eax
+  200c8d:	83 f8 2f             	cmp    $0x2f,%eax
+  200c90:	77 30                	ja     200cc2 <printer_vprintf+0x6b1>
+  200c92:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c99:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200c9d:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200ca4:	8b 00                	mov    (%rax),%eax
+  200ca6:	89 c0                	mov    %eax,%eax
+  200ca8:	48 01 d0             	add    %rdx,%rax
+  200cab:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200cb2:	8b 12                	mov    (%rdx),%edx
+  200cb4:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200cb7:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200cbe:	89 0a                	mov    %ecx,(%rdx)
+  200cc0:	eb 1a                	jmp    200cdc <printer_vprintf+0x6cb>
+  200cc2:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200cc9:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200ccd:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200cd1:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200cd8:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200cdc:	8b 00                	mov    (%rax),%eax
+  200cde:	88 45 8c             	mov    %al,-0x74(%rbp)
+            numbuf[1] = '\0';
+  200ce1:	c6 45 8d 00          	movb   $0x0,-0x73(%rbp)
+            break;
+  200ce5:	eb 45                	jmp    200d2c <printer_vprintf+0x71b>
+        default:
+            data = numbuf;
+  200ce7:	48 8d 45 8c          	lea    -0x74(%rbp),%rax
+  200ceb:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+            numbuf[0] = (*format ? *format : '%');
+  200cef:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200cf6:	0f b6 00             	movzbl (%rax),%eax
+  200cf9:	84 c0                	test   %al,%al
+  200cfb:	74 0c                	je     200d09 <printer_vprintf+0x6f8>
+  200cfd:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200d04:	0f b6 00             	movzbl (%rax),%eax
+  200d07:	eb 05                	jmp    200d0e <printer_vprintf+0x6fd>
+  200d09:	b8 25 00 00 00       	mov    $0x25,%eax
+  200d0e:	88 45 8c             	mov    %al,-0x74(%rbp)
+            numbuf[1] = '\0';
+  200d11:	c6 45 8d 00          	movb   $0x0,-0x73(%rbp)
+            if (!*format) {
+  200d15:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200d1c:	0f b6 00             	movzbl (%rax),%eax
+  200d1f:	84 c0                	test   %al,%al
+  200d21:	75 08                	jne    200d2b <printer_vprintf+0x71a>
+                format--;
+  200d23:	48 83 ad 68 ff ff ff 	subq   $0x1,-0x98(%rbp)
+  200d2a:	01 
+            }
+            break;
+  200d2b:	90                   	nop
+        }
+
+        if (flags & FLAG_NUMERIC) {
+  200d2c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200d2f:	83 e0 20             	and    $0x20,%eax
+  200d32:	85 c0                	test   %eax,%eax
+  200d34:	74 1e                	je     200d54 <printer_vprintf+0x743>
+            data = fill_numbuf(numbuf + NUMBUFSIZ, num, base);
+  200d36:	48 8d 45 8c          	lea    -0x74(%rbp),%rax
+  200d3a:	48 83 c0 18          	add    $0x18,%rax
+  200d3e:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  200d41:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  200d45:	48 89 ce             	mov    %rcx,%rsi
+  200d48:	48 89 c7             	mov    %rax,%rdi
+  200d4b:	e8 39 f8 ff ff       	call   200589 <fill_numbuf>
+  200d50:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        }
+
+        const char* prefix = "";
+  200d54:	48 8d 05 fb 12 00 00 	lea    0x12fb(%rip),%rax        # 202056 <flag_chars+0x6>
+  200d5b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((flags & FLAG_NUMERIC) && (flags & FLAG_SIGNED)) {
+  200d5f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200d62:	83 e0 20             	and    $0x20,%eax
+  200d65:	85 c0                	test   %eax,%eax
+  200d67:	74 51                	je     200dba <printer_vprintf+0x7a9>
+  200d69:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200d6c:	83 e0 40             	and    $0x40,%eax
+  200d6f:	85 c0                	test   %eax,%eax
+  200d71:	74 47                	je     200dba <printer_vprintf+0x7a9>
+            if (flags & FLAG_NEGATIVE) {
+  200d73:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200d76:	25 80 00 00 00       	and    $0x80,%eax
+  200d7b:	85 c0                	test   %eax,%eax
+  200d7d:	74 0d                	je     200d8c <printer_vprintf+0x77b>
+                prefix = "-";
+  200d7f:	48 8d 05 d1 12 00 00 	lea    0x12d1(%rip),%rax        # 202057 <flag_chars+0x7>
+  200d86:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            if (flags & FLAG_NEGATIVE) {
+  200d8a:	eb 7d                	jmp    200e09 <printer_vprintf+0x7f8>
+            } else if (flags & FLAG_PLUSPOSITIVE) {
+  200d8c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200d8f:	83 e0 10             	and    $0x10,%eax
+  200d92:	85 c0                	test   %eax,%eax
+  200d94:	74 0d                	je     200da3 <printer_vprintf+0x792>
+                prefix = "+";
+  200d96:	48 8d 05 bc 12 00 00 	lea    0x12bc(%rip),%rax        # 202059 <flag_chars+0x9>
+  200d9d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            if (flags & FLAG_NEGATIVE) {
+  200da1:	eb 66                	jmp    200e09 <printer_vprintf+0x7f8>
+            } else if (flags & FLAG_SPACEPOSITIVE) {
+  200da3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200da6:	83 e0 08             	and    $0x8,%eax
+  200da9:	85 c0                	test   %eax,%eax
+  200dab:	74 5c                	je     200e09 <printer_vprintf+0x7f8>
+                prefix = " ";
+  200dad:	48 8d 05 a7 12 00 00 	lea    0x12a7(%rip),%rax        # 20205b <flag_chars+0xb>
+  200db4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            if (flags & FLAG_NEGATIVE) {
+  200db8:	eb 4f                	jmp    200e09 <printer_vprintf+0x7f8>
+            }
+        } else if ((flags & FLAG_NUMERIC) && (flags & FLAG_ALT)
+  200dba:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200dbd:	83 e0 20             	and    $0x20,%eax
+  200dc0:	85 c0                	test   %eax,%eax
+  200dc2:	74 46                	je     200e0a <printer_vprintf+0x7f9>
+  200dc4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200dc7:	83 e0 01             	and    $0x1,%eax
+  200dca:	85 c0                	test   %eax,%eax
+  200dcc:	74 3c                	je     200e0a <printer_vprintf+0x7f9>
+                   && (base == 16 || base == -16)
+  200dce:	83 7d e0 10          	cmpl   $0x10,-0x20(%rbp)
+  200dd2:	74 06                	je     200dda <printer_vprintf+0x7c9>
+  200dd4:	83 7d e0 f0          	cmpl   $0xfffffff0,-0x20(%rbp)
+  200dd8:	75 30                	jne    200e0a <printer_vprintf+0x7f9>
+                   && (num || (flags & FLAG_ALT2))) {
+  200dda:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  200ddf:	75 0c                	jne    200ded <printer_vprintf+0x7dc>
+  200de1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200de4:	25 00 01 00 00       	and    $0x100,%eax
+  200de9:	85 c0                	test   %eax,%eax
+  200deb:	74 1d                	je     200e0a <printer_vprintf+0x7f9>
+            prefix = (base == -16 ? "0x" : "0X");
+  200ded:	83 7d e0 f0          	cmpl   $0xfffffff0,-0x20(%rbp)
+  200df1:	75 09                	jne    200dfc <printer_vprintf+0x7eb>
+  200df3:	48 8d 05 63 12 00 00 	lea    0x1263(%rip),%rax        # 20205d <flag_chars+0xd>
+  200dfa:	eb 07                	jmp    200e03 <printer_vprintf+0x7f2>
+  200dfc:	48 8d 05 5d 12 00 00 	lea    0x125d(%rip),%rax        # 202060 <flag_chars+0x10>
+  200e03:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  200e07:	eb 01                	jmp    200e0a <printer_vprintf+0x7f9>
+            if (flags & FLAG_NEGATIVE) {
+  200e09:	90                   	nop
+        }
+
+        int len;
+        if (precision >= 0 && !(flags & FLAG_NUMERIC)) {
+  200e0a:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  200e0e:	78 24                	js     200e34 <printer_vprintf+0x823>
+  200e10:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200e13:	83 e0 20             	and    $0x20,%eax
+  200e16:	85 c0                	test   %eax,%eax
+  200e18:	75 1a                	jne    200e34 <printer_vprintf+0x823>
+            len = strnlen(data, precision);
+  200e1a:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  200e1d:	48 63 d0             	movslq %eax,%rdx
+  200e20:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200e24:	48 89 d6             	mov    %rdx,%rsi
+  200e27:	48 89 c7             	mov    %rax,%rdi
+  200e2a:	e8 8a f5 ff ff       	call   2003b9 <strnlen>
+  200e2f:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  200e32:	eb 0f                	jmp    200e43 <printer_vprintf+0x832>
+        } else {
+            len = strlen(data);
+  200e34:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200e38:	48 89 c7             	mov    %rax,%rdi
+  200e3b:	e8 48 f5 ff ff       	call   200388 <strlen>
+  200e40:	89 45 bc             	mov    %eax,-0x44(%rbp)
+        }
+        int zeros;
+        if ((flags & FLAG_NUMERIC) && precision >= 0) {
+  200e43:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200e46:	83 e0 20             	and    $0x20,%eax
+  200e49:	85 c0                	test   %eax,%eax
+  200e4b:	74 20                	je     200e6d <printer_vprintf+0x85c>
+  200e4d:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  200e51:	78 1a                	js     200e6d <printer_vprintf+0x85c>
+            zeros = precision > len ? precision - len : 0;
+  200e53:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  200e56:	3b 45 bc             	cmp    -0x44(%rbp),%eax
+  200e59:	7e 08                	jle    200e63 <printer_vprintf+0x852>
+  200e5b:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  200e5e:	2b 45 bc             	sub    -0x44(%rbp),%eax
+  200e61:	eb 05                	jmp    200e68 <printer_vprintf+0x857>
+  200e63:	b8 00 00 00 00       	mov    $0x0,%eax
+  200e68:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  200e6b:	eb 5c                	jmp    200ec9 <printer_vprintf+0x8b8>
+        } else if ((flags & FLAG_NUMERIC) && (flags & FLAG_ZERO)
+  200e6d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200e70:	83 e0 20             	and    $0x20,%eax
+  200e73:	85 c0                	test   %eax,%eax
+  200e75:	74 4b                	je     200ec2 <printer_vprintf+0x8b1>
+  200e77:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200e7a:	83 e0 02             	and    $0x2,%eax
+  200e7d:	85 c0                	test   %eax,%eax
+  200e7f:	74 41                	je     200ec2 <printer_vprintf+0x8b1>
+                   && !(flags & FLAG_LEFTJUSTIFY)
+  200e81:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200e84:	83 e0 04             	and    $0x4,%eax
+  200e87:	85 c0                	test   %eax,%eax
+  200e89:	75 37                	jne    200ec2 <printer_vprintf+0x8b1>
+                   && len + (int) strlen(prefix) < width) {
+  200e8b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  200e8f:	48 89 c7             	mov    %rax,%rdi
+  200e92:	e8 f1 f4 ff ff       	call   200388 <strlen>
+  200e97:	89 c2                	mov    %eax,%edx
+  200e99:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  200e9c:	01 d0                	add    %edx,%eax
+  200e9e:	39 45 e8             	cmp    %eax,-0x18(%rbp)
+  200ea1:	7e 1f                	jle    200ec2 <printer_vprintf+0x8b1>
+            zeros = width - len - strlen(prefix);
+  200ea3:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  200ea6:	2b 45 bc             	sub    -0x44(%rbp),%eax
+  200ea9:	89 c3                	mov    %eax,%ebx
+  200eab:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  200eaf:	48 89 c7             	mov    %rax,%rdi
+  200eb2:	e8 d1 f4 ff ff       	call   200388 <strlen>
+  200eb7:	89 c2                	mov    %eax,%edx
+  200eb9:	89 d8                	mov    %ebx,%eax
+  200ebb:	29 d0                	sub    %edx,%eax
+  200ebd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  200ec0:	eb 07                	jmp    200ec9 <printer_vprintf+0x8b8>
+        } else {
+            zeros = 0;
+  200ec2:	c7 45 b8 00 00 00 00 	movl   $0x0,-0x48(%rbp)
+        }
+        width -= len + zeros + strlen(prefix);
+  200ec9:	8b 55 bc             	mov    -0x44(%rbp),%edx
+  200ecc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  200ecf:	01 d0                	add    %edx,%eax
+  200ed1:	48 63 d8             	movslq %eax,%rbx
+  200ed4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  200ed8:	48 89 c7             	mov    %rax,%rdi
+  200edb:	e8 a8 f4 ff ff       	call   200388 <strlen>
+  200ee0:	48 8d 14 03          	lea    (%rbx,%rax,1),%rdx
+  200ee4:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  200ee7:	29 d0                	sub    %edx,%eax
+  200ee9:	89 45 e8             	mov    %eax,-0x18(%rbp)
+        for (; !(flags & FLAG_LEFTJUSTIFY) && width > 0; --width) {
+  200eec:	eb 25                	jmp    200f13 <printer_vprintf+0x902>
+            p->putc(p, ' ', color);
+  200eee:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200ef5:	48 8b 08             	mov    (%rax),%rcx
+  200ef8:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  200efe:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200f05:	be 20 00 00 00       	mov    $0x20,%esi
+  200f0a:	48 89 c7             	mov    %rax,%rdi
+  200f0d:	ff d1                	call   *%rcx
+        for (; !(flags & FLAG_LEFTJUSTIFY) && width > 0; --width) {
+  200f0f:	83 6d e8 01          	subl   $0x1,-0x18(%rbp)
+  200f13:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200f16:	83 e0 04             	and    $0x4,%eax
+  200f19:	85 c0                	test   %eax,%eax
+  200f1b:	75 36                	jne    200f53 <printer_vprintf+0x942>
+  200f1d:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  200f21:	7f cb                	jg     200eee <printer_vprintf+0x8dd>
+        }
+        for (; *prefix; ++prefix) {
+  200f23:	eb 2e                	jmp    200f53 <printer_vprintf+0x942>
+            p->putc(p, *prefix, color);
+  200f25:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200f2c:	4c 8b 00             	mov    (%rax),%r8
+  200f2f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  200f33:	0f b6 00             	movzbl (%rax),%eax
+  200f36:	0f b6 c8             	movzbl %al,%ecx
+  200f39:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  200f3f:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200f46:	89 ce                	mov    %ecx,%esi
+  200f48:	48 89 c7             	mov    %rax,%rdi
+  200f4b:	41 ff d0             	call   *%r8
+        for (; *prefix; ++prefix) {
+  200f4e:	48 83 45 c0 01       	addq   $0x1,-0x40(%rbp)
+  200f53:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  200f57:	0f b6 00             	movzbl (%rax),%eax
+  200f5a:	84 c0                	test   %al,%al
+  200f5c:	75 c7                	jne    200f25 <printer_vprintf+0x914>
+        }
+        for (; zeros > 0; --zeros) {
+  200f5e:	eb 25                	jmp    200f85 <printer_vprintf+0x974>
+            p->putc(p, '0', color);
+  200f60:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200f67:	48 8b 08             	mov    (%rax),%rcx
+  200f6a:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  200f70:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200f77:	be 30 00 00 00       	mov    $0x30,%esi
+  200f7c:	48 89 c7             	mov    %rax,%rdi
+  200f7f:	ff d1                	call   *%rcx
+        for (; zeros > 0; --zeros) {
+  200f81:	83 6d b8 01          	subl   $0x1,-0x48(%rbp)
+  200f85:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  200f89:	7f d5                	jg     200f60 <printer_vprintf+0x94f>
+        }
+        for (; len > 0; ++data, --len) {
+  200f8b:	eb 32                	jmp    200fbf <printer_vprintf+0x9ae>
+            p->putc(p, *data, color);
+  200f8d:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200f94:	4c 8b 00             	mov    (%rax),%r8
+  200f97:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200f9b:	0f b6 00             	movzbl (%rax),%eax
+  200f9e:	0f b6 c8             	movzbl %al,%ecx
+  200fa1:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  200fa7:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200fae:	89 ce                	mov    %ecx,%esi
+  200fb0:	48 89 c7             	mov    %rax,%rdi
+  200fb3:	41 ff d0             	call   *%r8
+        for (; len > 0; ++data, --len) {
+  200fb6:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  200fbb:	83 6d bc 01          	subl   $0x1,-0x44(%rbp)
+  200fbf:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+  200fc3:	7f c8                	jg     200f8d <printer_vprintf+0x97c>
+        }
+        for (; width > 0; --width) {
+  200fc5:	eb 25                	jmp    200fec <printer_vprintf+0x9db>
+            p->putc(p, ' ', color);
+  200fc7:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200fce:	48 8b 08             	mov    (%rax),%rcx
+  200fd1:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  200fd7:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200fde:	be 20 00 00 00       	mov    $0x20,%esi
+  200fe3:	48 89 c7             	mov    %rax,%rdi
+  200fe6:	ff d1                	call   *%rcx
+        for (; width > 0; --width) {
+  200fe8:	83 6d e8 01          	subl   $0x1,-0x18(%rbp)
+  200fec:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  200ff0:	7f d5                	jg     200fc7 <printer_vprintf+0x9b6>
+        }
+    done: ;
+  200ff2:	90                   	nop
+    for (; *format; ++format) {
+  200ff3:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  200ffa:	01 
+  200ffb:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  201002:	0f b6 00             	movzbl (%rax),%eax
+  201005:	84 c0                	test   %al,%al
+  201007:	0f 85 30 f6 ff ff    	jne    20063d <printer_vprintf+0x2c>
+    }
+}
+  20100d:	90                   	nop
+  20100e:	90                   	nop
+  20100f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  201013:	c9                   	leave
+  201014:	c3                   	ret
+
+0000000000201015 <console_putc>:
+typedef struct console_printer {
+    printer p;
+    uint16_t* cursor;
+} console_printer;
+
+static void console_putc(printer* p, unsigned char c, int color) {
+  201015:	55                   	push   %rbp
+  201016:	48 89 e5             	mov    %rsp,%rbp
+  201019:	48 83 ec 30          	sub    $0x30,%rsp
+  20101d:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  201021:	89 f0                	mov    %esi,%eax
+  201023:	89 55 d0             	mov    %edx,-0x30(%rbp)
+  201026:	88 45 d4             	mov    %al,-0x2c(%rbp)
+    console_printer* cp = (console_printer*) p;
+  201029:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  20102d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    /*if (cp->cursor >= console + CONSOLE_ROWS * CONSOLE_COLUMNS) {
+        cp->cursor = console;
+    }*/
+    if (c == '\n') {
+  201031:	80 7d d4 0a          	cmpb   $0xa,-0x2c(%rbp)
+  201035:	75 7f                	jne    2010b6 <console_putc+0xa1>
+        int pos = (cp->cursor - console) % CONSOLE_COLUMNS;
+  201037:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20103b:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  20103f:	48 8d 05 ba 6f eb ff 	lea    -0x149046(%rip),%rax        # b8000 <console>
+  201046:	48 29 c2             	sub    %rax,%rdx
+  201049:	48 89 d0             	mov    %rdx,%rax
+  20104c:	48 d1 f8             	sar    %rax
+  20104f:	48 89 c1             	mov    %rax,%rcx
+  201052:	48 ba 67 66 66 66 66 	movabs $0x6666666666666667,%rdx
+  201059:	66 66 66 
+  20105c:	48 89 c8             	mov    %rcx,%rax
+  20105f:	48 f7 ea             	imul   %rdx
+  201062:	48 c1 fa 05          	sar    $0x5,%rdx
+  201066:	48 89 c8             	mov    %rcx,%rax
+  201069:	48 c1 f8 3f          	sar    $0x3f,%rax
+  20106d:	48 29 c2             	sub    %rax,%rdx
+  201070:	48 89 d0             	mov    %rdx,%rax
+  201073:	48 c1 e0 02          	shl    $0x2,%rax
+  201077:	48 01 d0             	add    %rdx,%rax
+  20107a:	48 c1 e0 04          	shl    $0x4,%rax
+  20107e:	48 29 c1             	sub    %rax,%rcx
+  201081:	48 89 ca             	mov    %rcx,%rdx
+  201084:	89 55 fc             	mov    %edx,-0x4(%rbp)
+        for (; pos != CONSOLE_COLUMNS; pos++) {
+  201087:	eb 25                	jmp    2010ae <console_putc+0x99>
+            *cp->cursor++ = ' ' | color;
+  201089:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  20108c:	83 c8 20             	or     $0x20,%eax
+  20108f:	89 c6                	mov    %eax,%esi
+  201091:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201095:	48 8b 40 08          	mov    0x8(%rax),%rax
+  201099:	48 8d 48 02          	lea    0x2(%rax),%rcx
+  20109d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  2010a1:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  2010a5:	89 f2                	mov    %esi,%edx
+  2010a7:	66 89 10             	mov    %dx,(%rax)
+        for (; pos != CONSOLE_COLUMNS; pos++) {
+  2010aa:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  2010ae:	83 7d fc 50          	cmpl   $0x50,-0x4(%rbp)
+  2010b2:	75 d5                	jne    201089 <console_putc+0x74>
+  2010b4:	eb 69                	jmp    20111f <console_putc+0x10a>
+        }
+    } else if (c == '\b') {
+  2010b6:	80 7d d4 08          	cmpb   $0x8,-0x2c(%rbp)
+  2010ba:	75 3f                	jne    2010fb <console_putc+0xe6>
+        if (cp->cursor != console) {
+  2010bc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2010c0:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  2010c4:	48 8d 05 35 6f eb ff 	lea    -0x1490cb(%rip),%rax        # b8000 <console>
+  2010cb:	48 39 c2             	cmp    %rax,%rdx
+  2010ce:	74 4f                	je     20111f <console_putc+0x10a>
+            *(--cp->cursor) = ' ' | color;
+  2010d0:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  2010d3:	83 c8 20             	or     $0x20,%eax
+  2010d6:	89 c1                	mov    %eax,%ecx
+  2010d8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2010dc:	48 8b 40 08          	mov    0x8(%rax),%rax
+  2010e0:	48 8d 50 fe          	lea    -0x2(%rax),%rdx
+  2010e4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2010e8:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  2010ec:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2010f0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  2010f4:	89 ca                	mov    %ecx,%edx
+  2010f6:	66 89 10             	mov    %dx,(%rax)
+  2010f9:	eb 24                	jmp    20111f <console_putc+0x10a>
+        }
+    } else {
+        *cp->cursor++ = c | color;
+  2010fb:	0f b6 45 d4          	movzbl -0x2c(%rbp),%eax
+  2010ff:	8b 55 d0             	mov    -0x30(%rbp),%edx
+  201102:	09 d0                	or     %edx,%eax
+  201104:	89 c6                	mov    %eax,%esi
+  201106:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20110a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  20110e:	48 8d 48 02          	lea    0x2(%rax),%rcx
+  201112:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  201116:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  20111a:	89 f2                	mov    %esi,%edx
+  20111c:	66 89 10             	mov    %dx,(%rax)
+    }
+
+    const int MAX_ROWS = CONSOLE_ROWS - 2;
+  20111f:	c7 45 e4 17 00 00 00 	movl   $0x17,-0x1c(%rbp)
+
+    if (cp->cursor == console + MAX_ROWS * CONSOLE_COLUMNS) {
+  201126:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20112a:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  20112e:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  201131:	89 d0                	mov    %edx,%eax
+  201133:	c1 e0 02             	shl    $0x2,%eax
+  201136:	01 d0                	add    %edx,%eax
+  201138:	c1 e0 04             	shl    $0x4,%eax
+  20113b:	48 98                	cltq
+  20113d:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  201141:	48 8d 05 b8 6e eb ff 	lea    -0x149148(%rip),%rax        # b8000 <console>
+  201148:	48 01 d0             	add    %rdx,%rax
+  20114b:	48 39 c1             	cmp    %rax,%rcx
+  20114e:	0f 85 ac 00 00 00    	jne    201200 <console_putc+0x1eb>
+        // Move all characters up by one row, forgetting the first row
+        for (int i = 0; i < (MAX_ROWS - 1) * CONSOLE_COLUMNS; ++i) {
+  201154:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  20115b:	eb 30                	jmp    20118d <console_putc+0x178>
+            console[i] = console[i + CONSOLE_COLUMNS];
+  20115d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  201160:	83 c0 50             	add    $0x50,%eax
+  201163:	48 98                	cltq
+  201165:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  201169:	48 8d 05 90 6e eb ff 	lea    -0x149170(%rip),%rax        # b8000 <console>
+  201170:	0f b7 04 02          	movzwl (%rdx,%rax,1),%eax
+  201174:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  201177:	48 63 d2             	movslq %edx,%rdx
+  20117a:	48 8d 0c 12          	lea    (%rdx,%rdx,1),%rcx
+  20117e:	48 8d 15 7b 6e eb ff 	lea    -0x149185(%rip),%rdx        # b8000 <console>
+  201185:	66 89 04 11          	mov    %ax,(%rcx,%rdx,1)
+        for (int i = 0; i < (MAX_ROWS - 1) * CONSOLE_COLUMNS; ++i) {
+  201189:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+  20118d:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  201190:	8d 50 ff             	lea    -0x1(%rax),%edx
+  201193:	89 d0                	mov    %edx,%eax
+  201195:	c1 e0 02             	shl    $0x2,%eax
+  201198:	01 d0                	add    %edx,%eax
+  20119a:	c1 e0 04             	shl    $0x4,%eax
+  20119d:	39 45 f8             	cmp    %eax,-0x8(%rbp)
+  2011a0:	7c bb                	jl     20115d <console_putc+0x148>
+        }
+
+        // Fill last column with space
+        for (int i = (MAX_ROWS - 1) * CONSOLE_COLUMNS; i < MAX_ROWS * CONSOLE_COLUMNS; ++i) {
+  2011a2:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  2011a5:	8d 50 ff             	lea    -0x1(%rax),%edx
+  2011a8:	89 d0                	mov    %edx,%eax
+  2011aa:	c1 e0 02             	shl    $0x2,%eax
+  2011ad:	01 d0                	add    %edx,%eax
+  2011af:	c1 e0 04             	shl    $0x4,%eax
+  2011b2:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  2011b5:	eb 20                	jmp    2011d7 <console_putc+0x1c2>
+            console[i] = ' ' | color;
+  2011b7:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  2011ba:	83 c8 20             	or     $0x20,%eax
+  2011bd:	89 c1                	mov    %eax,%ecx
+  2011bf:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  2011c2:	48 98                	cltq
+  2011c4:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  2011c8:	48 8d 05 31 6e eb ff 	lea    -0x1491cf(%rip),%rax        # b8000 <console>
+  2011cf:	66 89 0c 02          	mov    %cx,(%rdx,%rax,1)
+        for (int i = (MAX_ROWS - 1) * CONSOLE_COLUMNS; i < MAX_ROWS * CONSOLE_COLUMNS; ++i) {
+  2011d3:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  2011d7:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  2011da:	89 d0                	mov    %edx,%eax
+  2011dc:	c1 e0 02             	shl    $0x2,%eax
+  2011df:	01 d0                	add    %edx,%eax
+  2011e1:	c1 e0 04             	shl    $0x4,%eax
+  2011e4:	39 45 f4             	cmp    %eax,-0xc(%rbp)
+  2011e7:	7c ce                	jl     2011b7 <console_putc+0x1a2>
+        }
+
+        cp->cursor -= CONSOLE_COLUMNS;
+  2011e9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2011ed:	48 8b 40 08          	mov    0x8(%rax),%rax
+  2011f1:	48 8d 90 60 ff ff ff 	lea    -0xa0(%rax),%rdx
+  2011f8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2011fc:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    }
+}
+  201200:	90                   	nop
+  201201:	c9                   	leave
+  201202:	c3                   	ret
+
+0000000000201203 <console_vprintf>:
+
+int console_vprintf(int cpos, int color, const char* format, va_list val) {
+  201203:	55                   	push   %rbp
+  201204:	48 89 e5             	mov    %rsp,%rbp
+  201207:	48 83 ec 30          	sub    $0x30,%rsp
+  20120b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  20120e:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  201211:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  201215:	48 89 4d d8          	mov    %rcx,-0x28(%rbp)
+    struct console_printer cp;
+    cp.p.putc = console_putc;
+  201219:	48 8d 05 f5 fd ff ff 	lea    -0x20b(%rip),%rax        # 201015 <console_putc>
+  201220:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (cpos < 0 || cpos >= CONSOLE_ROWS * CONSOLE_COLUMNS) {
+  201224:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  201228:	78 09                	js     201233 <console_vprintf+0x30>
+  20122a:	81 7d ec cf 07 00 00 	cmpl   $0x7cf,-0x14(%rbp)
+  201231:	7e 07                	jle    20123a <console_vprintf+0x37>
+        cpos = 0;
+  201233:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+    }
+    cp.cursor = console + cpos;
+  20123a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  20123d:	48 98                	cltq
+  20123f:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  201243:	48 8d 05 b6 6d eb ff 	lea    -0x14924a(%rip),%rax        # b8000 <console>
+  20124a:	48 01 d0             	add    %rdx,%rax
+  20124d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    printer_vprintf(&cp.p, color, format, val);
+  201251:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  201255:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  201259:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  20125c:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  201260:	48 89 c7             	mov    %rax,%rdi
+  201263:	e8 a9 f3 ff ff       	call   200611 <printer_vprintf>
+    return cp.cursor - console;
+  201268:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  20126c:	48 8d 05 8d 6d eb ff 	lea    -0x149273(%rip),%rax        # b8000 <console>
+  201273:	48 29 c2             	sub    %rax,%rdx
+  201276:	48 89 d0             	mov    %rdx,%rax
+  201279:	48 d1 f8             	sar    %rax
+}
+  20127c:	c9                   	leave
+  20127d:	c3                   	ret
+
+000000000020127e <console_printf>:
+
+int console_printf(int cpos, int color, const char* format, ...) {
+  20127e:	55                   	push   %rbp
+  20127f:	48 89 e5             	mov    %rsp,%rbp
+  201282:	48 83 ec 60          	sub    $0x60,%rsp
+  201286:	89 7d ac             	mov    %edi,-0x54(%rbp)
+  201289:	89 75 a8             	mov    %esi,-0x58(%rbp)
+  20128c:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+  201290:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  201294:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  201298:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list val;
+    va_start(val, format);
+  20129c:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  2012a3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  2012a7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  2012ab:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  2012af:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    cpos = console_vprintf(cpos, color, format, val);
+  2012b3:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  2012b7:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  2012bb:	8b 75 a8             	mov    -0x58(%rbp),%esi
+  2012be:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  2012c1:	89 c7                	mov    %eax,%edi
+  2012c3:	e8 3b ff ff ff       	call   201203 <console_vprintf>
+  2012c8:	89 45 ac             	mov    %eax,-0x54(%rbp)
+    va_end(val);
+    return cpos;
+  2012cb:	8b 45 ac             	mov    -0x54(%rbp),%eax
+}
+  2012ce:	c9                   	leave
+  2012cf:	c3                   	ret
+
+00000000002012d0 <string_putc>:
+    printer p;
+    char* s;
+    char* end;
+} string_printer;
+
+static void string_putc(printer* p, unsigned char c, int color) {
+  2012d0:	55                   	push   %rbp
+  2012d1:	48 89 e5             	mov    %rsp,%rbp
+  2012d4:	48 83 ec 20          	sub    $0x20,%rsp
+  2012d8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  2012dc:	89 f0                	mov    %esi,%eax
+  2012de:	89 55 e0             	mov    %edx,-0x20(%rbp)
+  2012e1:	88 45 e4             	mov    %al,-0x1c(%rbp)
+    string_printer* sp = (string_printer*) p;
+  2012e4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2012e8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (sp->s < sp->end) {
+  2012ec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2012f0:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  2012f4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2012f8:	48 8b 40 10          	mov    0x10(%rax),%rax
+  2012fc:	48 39 c2             	cmp    %rax,%rdx
+  2012ff:	73 1a                	jae    20131b <string_putc+0x4b>
+        *sp->s++ = c;
+  201301:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  201305:	48 8b 40 08          	mov    0x8(%rax),%rax
+  201309:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  20130d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  201311:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  201315:	0f b6 55 e4          	movzbl -0x1c(%rbp),%edx
+  201319:	88 10                	mov    %dl,(%rax)
+    }
+    (void) color;
+}
+  20131b:	90                   	nop
+  20131c:	c9                   	leave
+  20131d:	c3                   	ret
+
+000000000020131e <vsnprintf>:
+
+int vsnprintf(char* s, size_t size, const char* format, va_list val) {
+  20131e:	55                   	push   %rbp
+  20131f:	48 89 e5             	mov    %rsp,%rbp
+  201322:	48 83 ec 40          	sub    $0x40,%rsp
+  201326:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  20132a:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  20132e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  201332:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+    string_printer sp;
+    sp.p.putc = string_putc;
+  201336:	48 8d 05 93 ff ff ff 	lea    -0x6d(%rip),%rax        # 2012d0 <string_putc>
+  20133d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    sp.s = s;
+  201341:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  201345:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (size) {
+  201349:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  20134e:	74 33                	je     201383 <vsnprintf+0x65>
+        sp.end = s + size - 1;
+  201350:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  201354:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  201358:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  20135c:	48 01 d0             	add    %rdx,%rax
+  20135f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+        printer_vprintf(&sp.p, 0, format, val);
+  201363:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  201367:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  20136b:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  20136f:	be 00 00 00 00       	mov    $0x0,%esi
+  201374:	48 89 c7             	mov    %rax,%rdi
+  201377:	e8 95 f2 ff ff       	call   200611 <printer_vprintf>
+        *sp.s = 0;
+  20137c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  201380:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return sp.s - s;
+  201383:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  201387:	48 2b 45 d8          	sub    -0x28(%rbp),%rax
+}
+  20138b:	c9                   	leave
+  20138c:	c3                   	ret
+
+000000000020138d <snprintf>:
+
+int snprintf(char* s, size_t size, const char* format, ...) {
+  20138d:	55                   	push   %rbp
+  20138e:	48 89 e5             	mov    %rsp,%rbp
+  201391:	48 83 ec 70          	sub    $0x70,%rsp
+  201395:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  201399:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  20139d:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  2013a1:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  2013a5:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  2013a9:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list val;
+    va_start(val, format);
+  2013ad:	c7 45 b0 18 00 00 00 	movl   $0x18,-0x50(%rbp)
+  2013b4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  2013b8:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  2013bc:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  2013c0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    int n = vsnprintf(s, size, format, val);
+  2013c4:	48 8d 4d b0          	lea    -0x50(%rbp),%rcx
+  2013c8:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  2013cc:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  2013d0:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  2013d4:	48 89 c7             	mov    %rax,%rdi
+  2013d7:	e8 42 ff ff ff       	call   20131e <vsnprintf>
+  2013dc:	89 45 cc             	mov    %eax,-0x34(%rbp)
+    va_end(val);
+    return n;
+  2013df:	8b 45 cc             	mov    -0x34(%rbp),%eax
+}
+  2013e2:	c9                   	leave
+  2013e3:	c3                   	ret
+
+00000000002013e4 <console_clear>:
+
+
+// console_clear
+//    Erases the console and moves the cursor to the upper left (CPOS(0, 0)).
+
+void console_clear(void) {
+  2013e4:	55                   	push   %rbp
+  2013e5:	48 89 e5             	mov    %rsp,%rbp
+  2013e8:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < CONSOLE_ROWS * CONSOLE_COLUMNS; ++i) {
+  2013ec:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  2013f3:	eb 1a                	jmp    20140f <console_clear+0x2b>
+        console[i] = ' ' | 0x0700;
+  2013f5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  2013f8:	48 98                	cltq
+  2013fa:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  2013fe:	48 8d 05 fb 6b eb ff 	lea    -0x149405(%rip),%rax        # b8000 <console>
+  201405:	66 c7 04 02 20 07    	movw   $0x720,(%rdx,%rax,1)
+    for (int i = 0; i < CONSOLE_ROWS * CONSOLE_COLUMNS; ++i) {
+  20140b:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  20140f:	81 7d fc cf 07 00 00 	cmpl   $0x7cf,-0x4(%rbp)
+  201416:	7e dd                	jle    2013f5 <console_clear+0x11>
+    }
+    cursorpos = 0;
+  201418:	c7 05 da 7b eb ff 00 	movl   $0x0,-0x148426(%rip)        # b8ffc <cursorpos>
+  20141f:	00 00 00 
+}
+  201422:	90                   	nop
+  201423:	c9                   	leave
+  201424:	c3                   	ret
+
+0000000000201425 <string_to_char>:
+
+
+int string_to_char(const char *str, int *dest) {
+  201425:	55                   	push   %rbp
+  201426:	48 89 e5             	mov    %rsp,%rbp
+  201429:	48 83 ec 20          	sub    $0x20,%rsp
+  20142d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  201431:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    if (*str == '\0') return -1;
+  201435:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201439:	0f b6 00             	movzbl (%rax),%eax
+  20143c:	84 c0                	test   %al,%al
+  20143e:	75 0a                	jne    20144a <string_to_char+0x25>
+  201440:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  201445:	e9 e0 00 00 00       	jmp    20152a <string_to_char+0x105>
+
+    *dest = 0;
+  20144a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  20144e:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    for (; *str; str++) {
+  201454:	e9 bd 00 00 00       	jmp    201516 <string_to_char+0xf1>
+        int digit = 0;
+  201459:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+        switch (*str)
+  201460:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201464:	0f b6 00             	movzbl (%rax),%eax
+  201467:	0f be c0             	movsbl %al,%eax
+  20146a:	83 e8 30             	sub    $0x30,%eax
+  20146d:	83 f8 09             	cmp    $0x9,%eax
+  201470:	77 7c                	ja     2014ee <string_to_char+0xc9>
+  201472:	89 c0                	mov    %eax,%eax
+  201474:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  20147b:	00 
+  20147c:	48 8d 05 c1 0c 00 00 	lea    0xcc1(%rip),%rax        # 202144 <flag_chars+0xf4>
+  201483:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+  201486:	48 98                	cltq
+  201488:	48 8d 15 b5 0c 00 00 	lea    0xcb5(%rip),%rdx        # 202144 <flag_chars+0xf4>
+  20148f:	48 01 d0             	add    %rdx,%rax
+  201492:	ff e0                	jmp    *%rax
+        {
+        case '0':
+            digit = 0;
+  201494:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+            break;
+  20149b:	eb 58                	jmp    2014f5 <string_to_char+0xd0>
+        case '1':
+            digit = 1;
+  20149d:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+            break;
+  2014a4:	eb 4f                	jmp    2014f5 <string_to_char+0xd0>
+        case '2':
+            digit = 2;
+  2014a6:	c7 45 fc 02 00 00 00 	movl   $0x2,-0x4(%rbp)
+            break;
+  2014ad:	eb 46                	jmp    2014f5 <string_to_char+0xd0>
+        case '3':
+            digit = 3;
+  2014af:	c7 45 fc 03 00 00 00 	movl   $0x3,-0x4(%rbp)
+            break;
+  2014b6:	eb 3d                	jmp    2014f5 <string_to_char+0xd0>
+        case '4':
+            digit = 4;
+  2014b8:	c7 45 fc 04 00 00 00 	movl   $0x4,-0x4(%rbp)
+            break;
+  2014bf:	eb 34                	jmp    2014f5 <string_to_char+0xd0>
+        case '5':
+            digit = 5;
+  2014c1:	c7 45 fc 05 00 00 00 	movl   $0x5,-0x4(%rbp)
+            break;
+  2014c8:	eb 2b                	jmp    2014f5 <string_to_char+0xd0>
+        case '6':
+            digit = 6;
+  2014ca:	c7 45 fc 06 00 00 00 	movl   $0x6,-0x4(%rbp)
+            break;
+  2014d1:	eb 22                	jmp    2014f5 <string_to_char+0xd0>
+        case '7':
+            digit = 7;
+  2014d3:	c7 45 fc 07 00 00 00 	movl   $0x7,-0x4(%rbp)
+            break;
+  2014da:	eb 19                	jmp    2014f5 <string_to_char+0xd0>
+        case '8':
+            digit = 8;
+  2014dc:	c7 45 fc 08 00 00 00 	movl   $0x8,-0x4(%rbp)
+            break;
+  2014e3:	eb 10                	jmp    2014f5 <string_to_char+0xd0>
+        case '9':
+            digit = 9;
+  2014e5:	c7 45 fc 09 00 00 00 	movl   $0x9,-0x4(%rbp)
+            break;
+  2014ec:	eb 07                	jmp    2014f5 <string_to_char+0xd0>
+        default:
+            return -1;
+  2014ee:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  2014f3:	eb 35                	jmp    20152a <string_to_char+0x105>
+        }
+
+        *dest = *dest * 10 + digit;
+  2014f5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  2014f9:	8b 10                	mov    (%rax),%edx
+  2014fb:	89 d0                	mov    %edx,%eax
+  2014fd:	c1 e0 02             	shl    $0x2,%eax
+  201500:	01 d0                	add    %edx,%eax
+  201502:	01 c0                	add    %eax,%eax
+  201504:	89 c2                	mov    %eax,%edx
+  201506:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  201509:	01 c2                	add    %eax,%edx
+  20150b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  20150f:	89 10                	mov    %edx,(%rax)
+    for (; *str; str++) {
+  201511:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  201516:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20151a:	0f b6 00             	movzbl (%rax),%eax
+  20151d:	84 c0                	test   %al,%al
+  20151f:	0f 85 34 ff ff ff    	jne    201459 <string_to_char+0x34>
+    }
+
+    return 0;
+  201525:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  20152a:	c9                   	leave
+  20152b:	c3                   	ret
+
+000000000020152c <atoi>:
+
+int atoi(const char *str) {
+  20152c:	55                   	push   %rbp
+  20152d:	48 89 e5             	mov    %rsp,%rbp
+  201530:	48 83 ec 18          	sub    $0x18,%rsp
+  201534:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    if (*str == '\0') return -1;
+  201538:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20153c:	0f b6 00             	movzbl (%rax),%eax
+  20153f:	84 c0                	test   %al,%al
+  201541:	75 0a                	jne    20154d <atoi+0x21>
+  201543:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  201548:	e9 d7 00 00 00       	jmp    201624 <atoi+0xf8>
+
+    int n = 0;
+  20154d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    for (; *str; str++) {
+  201554:	e9 b7 00 00 00       	jmp    201610 <atoi+0xe4>
+        int digit = 0;
+  201559:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+        switch (*str)
+  201560:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201564:	0f b6 00             	movzbl (%rax),%eax
+  201567:	0f be c0             	movsbl %al,%eax
+  20156a:	83 e8 30             	sub    $0x30,%eax
+  20156d:	83 f8 09             	cmp    $0x9,%eax
+  201570:	77 7c                	ja     2015ee <atoi+0xc2>
+  201572:	89 c0                	mov    %eax,%eax
+  201574:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  20157b:	00 
+  20157c:	48 8d 05 e9 0b 00 00 	lea    0xbe9(%rip),%rax        # 20216c <flag_chars+0x11c>
+  201583:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+  201586:	48 98                	cltq
+  201588:	48 8d 15 dd 0b 00 00 	lea    0xbdd(%rip),%rdx        # 20216c <flag_chars+0x11c>
+  20158f:	48 01 d0             	add    %rdx,%rax
+  201592:	ff e0                	jmp    *%rax
+        {
+        case '0':
+            digit = 0;
+  201594:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+            break;
+  20159b:	eb 58                	jmp    2015f5 <atoi+0xc9>
+        case '1':
+            digit = 1;
+  20159d:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+            break;
+  2015a4:	eb 4f                	jmp    2015f5 <atoi+0xc9>
+        case '2':
+            digit = 2;
+  2015a6:	c7 45 f8 02 00 00 00 	movl   $0x2,-0x8(%rbp)
+            break;
+  2015ad:	eb 46                	jmp    2015f5 <atoi+0xc9>
+        case '3':
+            digit = 3;
+  2015af:	c7 45 f8 03 00 00 00 	movl   $0x3,-0x8(%rbp)
+            break;
+  2015b6:	eb 3d                	jmp    2015f5 <atoi+0xc9>
+        case '4':
+            digit = 4;
+  2015b8:	c7 45 f8 04 00 00 00 	movl   $0x4,-0x8(%rbp)
+            break;
+  2015bf:	eb 34                	jmp    2015f5 <atoi+0xc9>
+        case '5':
+            digit = 5;
+  2015c1:	c7 45 f8 05 00 00 00 	movl   $0x5,-0x8(%rbp)
+            break;
+  2015c8:	eb 2b                	jmp    2015f5 <atoi+0xc9>
+        case '6':
+            digit = 6;
+  2015ca:	c7 45 f8 06 00 00 00 	movl   $0x6,-0x8(%rbp)
+            break;
+  2015d1:	eb 22                	jmp    2015f5 <atoi+0xc9>
+        case '7':
+            digit = 7;
+  2015d3:	c7 45 f8 07 00 00 00 	movl   $0x7,-0x8(%rbp)
+            break;
+  2015da:	eb 19                	jmp    2015f5 <atoi+0xc9>
+        case '8':
+            digit = 8;
+  2015dc:	c7 45 f8 08 00 00 00 	movl   $0x8,-0x8(%rbp)
+            break;
+  2015e3:	eb 10                	jmp    2015f5 <atoi+0xc9>
+        case '9':
+            digit = 9;
+  2015e5:	c7 45 f8 09 00 00 00 	movl   $0x9,-0x8(%rbp)
+            break;
+  2015ec:	eb 07                	jmp    2015f5 <atoi+0xc9>
+        default:
+            return -1;
+  2015ee:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  2015f3:	eb 2f                	jmp    201624 <atoi+0xf8>
+        }
+
+        n = n * 10 + digit;
+  2015f5:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  2015f8:	89 d0                	mov    %edx,%eax
+  2015fa:	c1 e0 02             	shl    $0x2,%eax
+  2015fd:	01 d0                	add    %edx,%eax
+  2015ff:	01 c0                	add    %eax,%eax
+  201601:	89 c2                	mov    %eax,%edx
+  201603:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  201606:	01 d0                	add    %edx,%eax
+  201608:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    for (; *str; str++) {
+  20160b:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  201610:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201614:	0f b6 00             	movzbl (%rax),%eax
+  201617:	84 c0                	test   %al,%al
+  201619:	0f 85 3a ff ff ff    	jne    201559 <atoi+0x2d>
+    }
+
+    return 0;
+  20161f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  201624:	c9                   	leave
+  201625:	c3                   	ret
+
+0000000000201626 <copy_comp>:
+        components[ncomp++] = (comp); \
+    } \
+} while (0)
+
+// Helper to copy a component to dst
+void copy_comp(const char *start, const char *end, char **pdst) {
+  201626:	55                   	push   %rbp
+  201627:	48 89 e5             	mov    %rsp,%rbp
+  20162a:	48 83 ec 18          	sub    $0x18,%rsp
+  20162e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  201632:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  201636:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    while (start < end) {
+  20163a:	eb 23                	jmp    20165f <copy_comp+0x39>
+        *(*pdst)++ = *start++;
+  20163c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  201640:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  201644:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  201648:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20164c:	48 8b 00             	mov    (%rax),%rax
+  20164f:	48 8d 70 01          	lea    0x1(%rax),%rsi
+  201653:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  201657:	48 89 31             	mov    %rsi,(%rcx)
+  20165a:	0f b6 12             	movzbl (%rdx),%edx
+  20165d:	88 10                	mov    %dl,(%rax)
+    while (start < end) {
+  20165f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  201663:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  201667:	72 d3                	jb     20163c <copy_comp+0x16>
+    }
+}
+  201669:	90                   	nop
+  20166a:	90                   	nop
+  20166b:	c9                   	leave
+  20166c:	c3                   	ret
+
+000000000020166d <join_path>:
+
+
+void join_path(const char *abs_path, const char *path, char *dst) {
+  20166d:	55                   	push   %rbp
+  20166e:	48 89 e5             	mov    %rsp,%rbp
+  201671:	48 81 ec 68 02 00 00 	sub    $0x268,%rsp
+  201678:	48 89 bd a8 fd ff ff 	mov    %rdi,-0x258(%rbp)
+  20167f:	48 89 b5 a0 fd ff ff 	mov    %rsi,-0x260(%rbp)
+  201686:	48 89 95 98 fd ff ff 	mov    %rdx,-0x268(%rbp)
+    // If path is absolute, just copy it to dst (removing duplicate slashes, and trailing slash unless root)
+    if (path[0] == '/') {
+  20168d:	48 8b 85 a0 fd ff ff 	mov    -0x260(%rbp),%rax
+  201694:	0f b6 00             	movzbl (%rax),%eax
+  201697:	3c 2f                	cmp    $0x2f,%al
+  201699:	0f 85 d6 00 00 00    	jne    201775 <join_path+0x108>
+        const char *src = path;
+  20169f:	48 8b 85 a0 fd ff ff 	mov    -0x260(%rbp),%rax
+  2016a6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+        char *d = dst;
+  2016aa:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  2016b1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+        // Always start with a single slash
+        *d++ = '/';
+  2016b5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2016b9:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  2016bd:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  2016c1:	c6 00 2f             	movb   $0x2f,(%rax)
+        src++;
+  2016c4:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+        int last_was_slash = 1;
+  2016c9:	c7 45 b0 01 00 00 00 	movl   $0x1,-0x50(%rbp)
+        while (*src) {
+  2016d0:	eb 64                	jmp    201736 <join_path+0xc9>
+            if (*src == '/') {
+  2016d2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2016d6:	0f b6 00             	movzbl (%rax),%eax
+  2016d9:	3c 2f                	cmp    $0x2f,%al
+  2016db:	75 35                	jne    201712 <join_path+0xa5>
+                // Skip consecutive slashes
+                while (*src == '/') src++;
+  2016dd:	eb 05                	jmp    2016e4 <join_path+0x77>
+  2016df:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  2016e4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2016e8:	0f b6 00             	movzbl (%rax),%eax
+  2016eb:	3c 2f                	cmp    $0x2f,%al
+  2016ed:	74 f0                	je     2016df <join_path+0x72>
+                if (*src == 0) break;
+  2016ef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2016f3:	0f b6 00             	movzbl (%rax),%eax
+  2016f6:	84 c0                	test   %al,%al
+  2016f8:	74 49                	je     201743 <join_path+0xd6>
+                *d++ = '/';
+  2016fa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2016fe:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  201702:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  201706:	c6 00 2f             	movb   $0x2f,(%rax)
+                last_was_slash = 1;
+  201709:	c7 45 b0 01 00 00 00 	movl   $0x1,-0x50(%rbp)
+  201710:	eb 24                	jmp    201736 <join_path+0xc9>
+            } else {
+                *d++ = *src++;
+  201712:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  201716:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  20171a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  20171e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  201722:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  201726:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  20172a:	0f b6 12             	movzbl (%rdx),%edx
+  20172d:	88 10                	mov    %dl,(%rax)
+                last_was_slash = 0;
+  20172f:	c7 45 b0 00 00 00 00 	movl   $0x0,-0x50(%rbp)
+        while (*src) {
+  201736:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20173a:	0f b6 00             	movzbl (%rax),%eax
+  20173d:	84 c0                	test   %al,%al
+  20173f:	75 91                	jne    2016d2 <join_path+0x65>
+  201741:	eb 01                	jmp    201744 <join_path+0xd7>
+                if (*src == 0) break;
+  201743:	90                   	nop
+            }
+        }
+        // Remove trailing slash unless the path is just "/"
+        if (d > dst + 1 && *(d-1) == '/') {
+  201744:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  20174b:	48 83 c0 01          	add    $0x1,%rax
+  20174f:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  201753:	73 14                	jae    201769 <join_path+0xfc>
+  201755:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  201759:	48 83 e8 01          	sub    $0x1,%rax
+  20175d:	0f b6 00             	movzbl (%rax),%eax
+  201760:	3c 2f                	cmp    $0x2f,%al
+  201762:	75 05                	jne    201769 <join_path+0xfc>
+            d--;
+  201764:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+        }
+        *d = 0;
+  201769:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  20176d:	c6 00 00             	movb   $0x0,(%rax)
+  201770:	e9 e9 02 00 00       	jmp    201a5e <join_path+0x3f1>
+        return;
+    }
+
+    // Otherwise, start with abs_path
+    const char *src = abs_path;
+  201775:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  20177c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    char *d = dst;
+  201780:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  201787:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    if (*src != '/') {
+  20178b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20178f:	0f b6 00             	movzbl (%rax),%eax
+  201792:	3c 2f                	cmp    $0x2f,%al
+  201794:	74 2e                	je     2017c4 <join_path+0x157>
+        *d++ = '/';
+  201796:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  20179a:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  20179e:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  2017a2:	c6 00 2f             	movb   $0x2f,(%rax)
+    }
+    while (*src) {
+  2017a5:	eb 1d                	jmp    2017c4 <join_path+0x157>
+        *d++ = *src++;
+  2017a7:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  2017ab:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  2017af:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  2017b3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  2017b7:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  2017bb:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  2017bf:	0f b6 12             	movzbl (%rdx),%edx
+  2017c2:	88 10                	mov    %dl,(%rax)
+    while (*src) {
+  2017c4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2017c8:	0f b6 00             	movzbl (%rax),%eax
+  2017cb:	84 c0                	test   %al,%al
+  2017cd:	75 d8                	jne    2017a7 <join_path+0x13a>
+    }
+    // Remove trailing slash (unless root)
+    if (d > dst + 1 && *(d-1) == '/') {
+  2017cf:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  2017d6:	48 83 c0 01          	add    $0x1,%rax
+  2017da:	48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+  2017de:	73 14                	jae    2017f4 <join_path+0x187>
+  2017e0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  2017e4:	48 83 e8 01          	sub    $0x1,%rax
+  2017e8:	0f b6 00             	movzbl (%rax),%eax
+  2017eb:	3c 2f                	cmp    $0x2f,%al
+  2017ed:	75 05                	jne    2017f4 <join_path+0x187>
+        d--;
+  2017ef:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+    }
+    *d = 0;
+  2017f4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  2017f8:	c6 00 00             	movb   $0x0,(%rax)
+
+    // Now, process path components
+    char temp[512];
+    int tlen = 0;
+  2017fb:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    // Copy dst to temp for easier manipulation
+    src = dst;
+  201802:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  201809:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    while (*src && tlen < (int)sizeof(temp)-1) {
+  20180d:	eb 22                	jmp    201831 <join_path+0x1c4>
+        temp[tlen++] = *src++;
+  20180f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201813:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  201817:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  20181b:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  20181e:	8d 4a 01             	lea    0x1(%rdx),%ecx
+  201821:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  201824:	0f b6 08             	movzbl (%rax),%ecx
+  201827:	48 63 c2             	movslq %edx,%rax
+  20182a:	88 8c 05 b0 fd ff ff 	mov    %cl,-0x250(%rbp,%rax,1)
+    while (*src && tlen < (int)sizeof(temp)-1) {
+  201831:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201835:	0f b6 00             	movzbl (%rax),%eax
+  201838:	84 c0                	test   %al,%al
+  20183a:	74 09                	je     201845 <join_path+0x1d8>
+  20183c:	81 7d dc fe 01 00 00 	cmpl   $0x1fe,-0x24(%rbp)
+  201843:	7e ca                	jle    20180f <join_path+0x1a2>
+    }
+    temp[tlen] = 0;
+  201845:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201848:	48 98                	cltq
+  20184a:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  201851:	00 
+
+    // Now, process each component in path
+    src = path;
+  201852:	48 8b 85 a0 fd ff ff 	mov    -0x260(%rbp),%rax
+  201859:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    while (*src) {
+  20185d:	e9 65 01 00 00       	jmp    2019c7 <join_path+0x35a>
+        // Skip slashes
+        while (*src == '/') src++;
+  201862:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  201867:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20186b:	0f b6 00             	movzbl (%rax),%eax
+  20186e:	3c 2f                	cmp    $0x2f,%al
+  201870:	74 f0                	je     201862 <join_path+0x1f5>
+        if (!*src) break;
+  201872:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201876:	0f b6 00             	movzbl (%rax),%eax
+  201879:	84 c0                	test   %al,%al
+  20187b:	0f 84 57 01 00 00    	je     2019d8 <join_path+0x36b>
+
+        // Find end of component
+        const char *comp_start = src;
+  201881:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201885:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        while (*src && *src != '/') src++;
+  201889:	eb 05                	jmp    201890 <join_path+0x223>
+  20188b:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  201890:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201894:	0f b6 00             	movzbl (%rax),%eax
+  201897:	84 c0                	test   %al,%al
+  201899:	74 0b                	je     2018a6 <join_path+0x239>
+  20189b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20189f:	0f b6 00             	movzbl (%rax),%eax
+  2018a2:	3c 2f                	cmp    $0x2f,%al
+  2018a4:	75 e5                	jne    20188b <join_path+0x21e>
+        const char *comp_end = src;
+  2018a6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2018aa:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+
+        int comp_len = comp_end - comp_start;
+  2018ae:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  2018b2:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  2018b6:	89 45 b4             	mov    %eax,-0x4c(%rbp)
+
+        // Get component string
+        if (comp_len == 1 && comp_start[0] == '.') {
+  2018b9:	83 7d b4 01          	cmpl   $0x1,-0x4c(%rbp)
+  2018bd:	75 10                	jne    2018cf <join_path+0x262>
+  2018bf:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  2018c3:	0f b6 00             	movzbl (%rax),%eax
+  2018c6:	3c 2e                	cmp    $0x2e,%al
+  2018c8:	75 05                	jne    2018cf <join_path+0x262>
+            // Ignore
+            continue;
+  2018ca:	e9 f8 00 00 00       	jmp    2019c7 <join_path+0x35a>
+        } else if (comp_len == 2 && comp_start[0] == '.' && comp_start[1] == '.') {
+  2018cf:	83 7d b4 02          	cmpl   $0x2,-0x4c(%rbp)
+  2018d3:	75 6e                	jne    201943 <join_path+0x2d6>
+  2018d5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  2018d9:	0f b6 00             	movzbl (%rax),%eax
+  2018dc:	3c 2e                	cmp    $0x2e,%al
+  2018de:	75 63                	jne    201943 <join_path+0x2d6>
+  2018e0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  2018e4:	48 83 c0 01          	add    $0x1,%rax
+  2018e8:	0f b6 00             	movzbl (%rax),%eax
+  2018eb:	3c 2e                	cmp    $0x2e,%al
+  2018ed:	75 54                	jne    201943 <join_path+0x2d6>
+            // Go up one directory, unless at root
+            if (tlen > 1) {
+  2018ef:	83 7d dc 01          	cmpl   $0x1,-0x24(%rbp)
+  2018f3:	0f 8e ce 00 00 00    	jle    2019c7 <join_path+0x35a>
+                // Remove trailing slash if any
+                if (temp[tlen-1] == '/') tlen--;
+  2018f9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  2018fc:	83 e8 01             	sub    $0x1,%eax
+  2018ff:	48 98                	cltq
+  201901:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  201908:	ff 
+  201909:	3c 2f                	cmp    $0x2f,%al
+  20190b:	75 0a                	jne    201917 <join_path+0x2aa>
+  20190d:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+                // Remove last component
+                while (tlen > 1 && temp[tlen-1] != '/') tlen--;
+  201911:	eb 04                	jmp    201917 <join_path+0x2aa>
+  201913:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  201917:	83 7d dc 01          	cmpl   $0x1,-0x24(%rbp)
+  20191b:	7e 14                	jle    201931 <join_path+0x2c4>
+  20191d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201920:	83 e8 01             	sub    $0x1,%eax
+  201923:	48 98                	cltq
+  201925:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  20192c:	ff 
+  20192d:	3c 2f                	cmp    $0x2f,%al
+  20192f:	75 e2                	jne    201913 <join_path+0x2a6>
+                temp[tlen] = 0;
+  201931:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201934:	48 98                	cltq
+  201936:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  20193d:	00 
+            if (tlen > 1) {
+  20193e:	e9 84 00 00 00       	jmp    2019c7 <join_path+0x35a>
+            }
+        } else if (comp_len > 0) {
+  201943:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  201947:	7e 7e                	jle    2019c7 <join_path+0x35a>
+            // Add slash if not at root
+            if (tlen == 0 || temp[tlen-1] != '/') {
+  201949:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  20194d:	74 14                	je     201963 <join_path+0x2f6>
+  20194f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201952:	83 e8 01             	sub    $0x1,%eax
+  201955:	48 98                	cltq
+  201957:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  20195e:	ff 
+  20195f:	3c 2f                	cmp    $0x2f,%al
+  201961:	74 1c                	je     20197f <join_path+0x312>
+                if (tlen < (int)sizeof(temp)-1) temp[tlen++] = '/';
+  201963:	81 7d dc fe 01 00 00 	cmpl   $0x1fe,-0x24(%rbp)
+  20196a:	7f 13                	jg     20197f <join_path+0x312>
+  20196c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  20196f:	8d 50 01             	lea    0x1(%rax),%edx
+  201972:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  201975:	48 98                	cltq
+  201977:	c6 84 05 b0 fd ff ff 	movb   $0x2f,-0x250(%rbp,%rax,1)
+  20197e:	2f 
+            }
+            // Copy component
+            for (const char *p = comp_start; p < comp_end && tlen < (int)sizeof(temp)-1; ++p) {
+  20197f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  201983:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  201987:	eb 1e                	jmp    2019a7 <join_path+0x33a>
+                temp[tlen++] = *p;
+  201989:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  20198c:	8d 50 01             	lea    0x1(%rax),%edx
+  20198f:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  201992:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  201996:	0f b6 12             	movzbl (%rdx),%edx
+  201999:	48 98                	cltq
+  20199b:	88 94 05 b0 fd ff ff 	mov    %dl,-0x250(%rbp,%rax,1)
+            for (const char *p = comp_start; p < comp_end && tlen < (int)sizeof(temp)-1; ++p) {
+  2019a2:	48 83 45 d0 01       	addq   $0x1,-0x30(%rbp)
+  2019a7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  2019ab:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  2019af:	73 09                	jae    2019ba <join_path+0x34d>
+  2019b1:	81 7d dc fe 01 00 00 	cmpl   $0x1fe,-0x24(%rbp)
+  2019b8:	7e cf                	jle    201989 <join_path+0x31c>
+            }
+            temp[tlen] = 0;
+  2019ba:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  2019bd:	48 98                	cltq
+  2019bf:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  2019c6:	00 
+    while (*src) {
+  2019c7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2019cb:	0f b6 00             	movzbl (%rax),%eax
+  2019ce:	84 c0                	test   %al,%al
+  2019d0:	0f 85 91 fe ff ff    	jne    201867 <join_path+0x1fa>
+  2019d6:	eb 01                	jmp    2019d9 <join_path+0x36c>
+        if (!*src) break;
+  2019d8:	90                   	nop
+        }
+    }
+
+    // If temp is empty, set to "/"
+    if (tlen == 0) {
+  2019d9:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  2019dd:	75 20                	jne    2019ff <join_path+0x392>
+        temp[tlen++] = '/';
+  2019df:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  2019e2:	8d 50 01             	lea    0x1(%rax),%edx
+  2019e5:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  2019e8:	48 98                	cltq
+  2019ea:	c6 84 05 b0 fd ff ff 	movb   $0x2f,-0x250(%rbp,%rax,1)
+  2019f1:	2f 
+        temp[tlen] = 0;
+  2019f2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  2019f5:	48 98                	cltq
+  2019f7:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  2019fe:	00 
+    }
+
+    // Remove trailing slash unless the path is just "/"
+    if (tlen > 1 && temp[tlen-1] == '/') {
+  2019ff:	83 7d dc 01          	cmpl   $0x1,-0x24(%rbp)
+  201a03:	7e 25                	jle    201a2a <join_path+0x3bd>
+  201a05:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201a08:	83 e8 01             	sub    $0x1,%eax
+  201a0b:	48 98                	cltq
+  201a0d:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  201a14:	ff 
+  201a15:	3c 2f                	cmp    $0x2f,%al
+  201a17:	75 11                	jne    201a2a <join_path+0x3bd>
+        temp[--tlen] = 0;
+  201a19:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  201a1d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201a20:	48 98                	cltq
+  201a22:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  201a29:	00 
+    }
+
+    // Copy temp to dst
+    for (int i = 0; i <= tlen; ++i) {
+  201a2a:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  201a31:	eb 23                	jmp    201a56 <join_path+0x3e9>
+        dst[i] = temp[i];
+  201a33:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  201a36:	48 63 d0             	movslq %eax,%rdx
+  201a39:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  201a40:	48 01 c2             	add    %rax,%rdx
+  201a43:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  201a46:	48 98                	cltq
+  201a48:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  201a4f:	ff 
+  201a50:	88 02                	mov    %al,(%rdx)
+    for (int i = 0; i <= tlen; ++i) {
+  201a52:	83 45 cc 01          	addl   $0x1,-0x34(%rbp)
+  201a56:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  201a59:	3b 45 dc             	cmp    -0x24(%rbp),%eax
+  201a5c:	7e d5                	jle    201a33 <join_path+0x3c6>
+    }
+}
+  201a5e:	c9                   	leave
+  201a5f:	c3                   	ret
+
+0000000000201a60 <app_printf>:
+#include "lib-malloc.h"
+#include "errno.h"
+// app_printf
+//     A version of console_printf that picks a sensible color by process ID.
+
+void app_printf(int colorid, const char* format, ...) {
+  201a60:	55                   	push   %rbp
+  201a61:	48 89 e5             	mov    %rsp,%rbp
+  201a64:	48 83 ec 50          	sub    $0x50,%rsp
+  201a68:	49 89 f2             	mov    %rsi,%r10
+  201a6b:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  201a6f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  201a73:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  201a77:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    int color;
+    if (colorid < 0) {
+        color = 0x0700;
+  201a7b:	be 00 07 00 00       	mov    $0x700,%esi
+    if (colorid < 0) {
+  201a80:	85 ff                	test   %edi,%edi
+  201a82:	78 32                	js     201ab6 <app_printf+0x56>
+    } else {
+        static const uint8_t col[] = { 0x0F, 0x0C, 0x0A, 0x09, 0x0E };
+        color = col[colorid % sizeof(col)] << 8;
+  201a84:	48 63 ff             	movslq %edi,%rdi
+  201a87:	48 ba cd cc cc cc cc 	movabs $0xcccccccccccccccd,%rdx
+  201a8e:	cc cc cc 
+  201a91:	48 89 f8             	mov    %rdi,%rax
+  201a94:	48 f7 e2             	mul    %rdx
+  201a97:	48 89 d0             	mov    %rdx,%rax
+  201a9a:	48 c1 e8 02          	shr    $0x2,%rax
+  201a9e:	48 83 e2 fc          	and    $0xfffffffffffffffc,%rdx
+  201aa2:	48 01 c2             	add    %rax,%rdx
+  201aa5:	48 29 d7             	sub    %rdx,%rdi
+  201aa8:	48 8d 05 e9 08 00 00 	lea    0x8e9(%rip),%rax        # 202398 <col.0>
+  201aaf:	0f b6 34 38          	movzbl (%rax,%rdi,1),%esi
+  201ab3:	c1 e6 08             	shl    $0x8,%esi
+    }
+
+    va_list val;
+    va_start(val, format);
+  201ab6:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  201abd:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  201ac1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  201ac5:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  201ac9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    cursorpos = console_vprintf(cursorpos, color, format, val);
+  201acd:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  201ad1:	4c 89 d2             	mov    %r10,%rdx
+  201ad4:	8b 3d 22 75 eb ff    	mov    -0x148ade(%rip),%edi        # b8ffc <cursorpos>
+  201ada:	e8 24 f7 ff ff       	call   201203 <console_vprintf>
+  201adf:	89 05 17 75 eb ff    	mov    %eax,-0x148ae9(%rip)        # b8ffc <cursorpos>
+    va_end(val);
+
+    /*if (CROW(cursorpos) >= 23) {
+        cursorpos = CPOS(0, 0);
+    }*/
+}
+  201ae5:	c9                   	leave
+  201ae6:	c3                   	ret
+
+0000000000201ae7 <panic>:
+
+
+// panic, assert_fail
+//     Call the INT_SYS_PANIC system call so the kernel loops until Control-C.
+
+void panic(const char* format, ...) {
+  201ae7:	55                   	push   %rbp
+  201ae8:	48 89 e5             	mov    %rsp,%rbp
+  201aeb:	53                   	push   %rbx
+  201aec:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  201af3:	48 89 fb             	mov    %rdi,%rbx
+  201af6:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  201afa:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  201afe:	48 89 4d d8          	mov    %rcx,-0x28(%rbp)
+  201b02:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  201b06:	4c 89 4d e8          	mov    %r9,-0x18(%rbp)
+    va_list val;
+    va_start(val, format);
+  201b0a:	c7 45 a8 08 00 00 00 	movl   $0x8,-0x58(%rbp)
+  201b11:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  201b15:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  201b19:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  201b1d:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    char buf[160];
+    memcpy(buf, "PANIC: ", 7);
+  201b21:	48 8d bd 08 ff ff ff 	lea    -0xf8(%rbp),%rdi
+  201b28:	ba 07 00 00 00       	mov    $0x7,%edx
+  201b2d:	48 8d 35 9d 06 00 00 	lea    0x69d(%rip),%rsi        # 2021d1 <lower_digits.0+0x11>
+  201b34:	e8 31 e5 ff ff       	call   20006a <memcpy>
+    int len = vsnprintf(&buf[7], sizeof(buf) - 7, format, val) + 7;
+  201b39:	48 8d 4d a8          	lea    -0x58(%rbp),%rcx
+  201b3d:	48 8d bd 0f ff ff ff 	lea    -0xf1(%rbp),%rdi
+  201b44:	48 89 da             	mov    %rbx,%rdx
+  201b47:	be 99 00 00 00       	mov    $0x99,%esi
+  201b4c:	e8 cd f7 ff ff       	call   20131e <vsnprintf>
+  201b51:	8d 50 07             	lea    0x7(%rax),%edx
+    va_end(val);
+    if (len > 0 && buf[len - 1] != '\n') {
+  201b54:	85 d2                	test   %edx,%edx
+  201b56:	7e 0f                	jle    201b67 <panic+0x80>
+  201b58:	83 c0 06             	add    $0x6,%eax
+  201b5b:	48 98                	cltq
+  201b5d:	80 bc 05 08 ff ff ff 	cmpb   $0xa,-0xf8(%rbp,%rax,1)
+  201b64:	0a 
+  201b65:	75 30                	jne    201b97 <panic+0xb0>
+        strcpy(buf + len - (len == (int) sizeof(buf) - 1), "\n");
+    }
+    (void) console_printf(CPOS(23, 0), 0xC000, "%s", buf);
+  201b67:	48 8d 8d 08 ff ff ff 	lea    -0xf8(%rbp),%rcx
+  201b6e:	48 8d 15 64 06 00 00 	lea    0x664(%rip),%rdx        # 2021d9 <lower_digits.0+0x19>
+  201b75:	be 00 c0 00 00       	mov    $0xc000,%esi
+  201b7a:	bf 30 07 00 00       	mov    $0x730,%edi
+  201b7f:	b8 00 00 00 00       	mov    $0x0,%eax
+  201b84:	e8 f5 f6 ff ff       	call   20127e <console_printf>
+    asm volatile ("syscall" : "=a" (rax)
+  201b89:	b8 30 00 00 00       	mov    $0x30,%eax
+  201b8e:	bf 00 00 00 00       	mov    $0x0,%edi
+  201b93:	0f 05                	syscall
+ loop: goto loop;
+  201b95:	eb fe                	jmp    201b95 <panic+0xae>
+        strcpy(buf + len - (len == (int) sizeof(buf) - 1), "\n");
+  201b97:	48 63 c2             	movslq %edx,%rax
+  201b9a:	81 fa 9f 00 00 00    	cmp    $0x9f,%edx
+  201ba0:	0f 94 c2             	sete   %dl
+  201ba3:	0f b6 d2             	movzbl %dl,%edx
+  201ba6:	48 29 d0             	sub    %rdx,%rax
+  201ba9:	48 8d bc 05 08 ff ff 	lea    -0xf8(%rbp,%rax,1),%rdi
+  201bb0:	ff 
+  201bb1:	48 8d 35 fc 06 00 00 	lea    0x6fc(%rip),%rsi        # 2022b4 <lower_digits.0+0xf4>
+  201bb8:	e8 3b e8 ff ff       	call   2003f8 <strcpy>
+  201bbd:	eb a8                	jmp    201b67 <panic+0x80>
+
+0000000000201bbf <raise>:
+
+#define SIGABRT -1
+
+
+
+int raise(int sig) {
+  201bbf:	89 fe                	mov    %edi,%esi
+
+// getpid()
+//    Return current process ID, like sys_getpid().
+static inline pid_t getpid(void) {
+    return vdso()->pid;
+  201bc1:	8b 3c 25 00 10 24 00 	mov    0x241000,%edi
+    asm volatile ("syscall" : "=a" (result)
+  201bc8:	b8 41 00 00 00       	mov    $0x41,%eax
+  201bcd:	0f 05                	syscall
+    return sys_kill(getpid(), sig);
+}
+  201bcf:	c3                   	ret
+
+0000000000201bd0 <abort>:
+    return vdso()->pid;
+  201bd0:	8b 3c 25 00 10 24 00 	mov    0x241000,%edi
+    asm volatile ("syscall" : "=a" (result)
+  201bd7:	b8 41 00 00 00       	mov    $0x41,%eax
+  201bdc:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  201be1:	0f 05                	syscall
+
+void __attribute((noreturn)) abort(void) {
+    raise(SIGABRT);
+ spinloop: goto spinloop;       // should never get here
+  201be3:	eb fe                	jmp    201be3 <abort+0x13>
+
+0000000000201be5 <assert_fail>:
+}
+
+
+void assert_fail(const char* file, int line, const char* msg) {
+  201be5:	55                   	push   %rbp
+  201be6:	48 89 e5             	mov    %rsp,%rbp
+  201be9:	48 89 f9             	mov    %rdi,%rcx
+  201bec:	41 89 f0             	mov    %esi,%r8d
+  201bef:	49 89 d1             	mov    %rdx,%r9
+    (void) console_printf(CPOS(23, 0), 0xC000,
+  201bf2:	48 8d 15 bf 06 00 00 	lea    0x6bf(%rip),%rdx        # 2022b8 <lower_digits.0+0xf8>
+  201bf9:	be 00 c0 00 00       	mov    $0xc000,%esi
+  201bfe:	bf 30 07 00 00       	mov    $0x730,%edi
+  201c03:	b8 00 00 00 00       	mov    $0x0,%eax
+  201c08:	e8 71 f6 ff ff       	call   20127e <console_printf>
+                          "PANIC: %s:%d: assertion '%s' failed\n",
+                          file, line, msg);
+    abort();
+  201c0d:	e8 be ff ff ff       	call   201bd0 <abort>
+
+0000000000201c12 <scan_char>:
+    asm volatile ("syscall" : "=a" (result)
+  201c12:	bf 3a 00 00 00       	mov    $0x3a,%edi
+    asm volatile ("syscall" : "=a" (rax)
+  201c17:	be 3c 00 00 00       	mov    $0x3c,%esi
+    asm volatile ("syscall" : "=a" (result)
+  201c1c:	89 f8                	mov    %edi,%eax
+  201c1e:	0f 05                	syscall
+  201c20:	89 c2                	mov    %eax,%edx
+    asm volatile ("syscall" : "=a" (rax)
+  201c22:	89 f0                	mov    %esi,%eax
+  201c24:	0f 05                	syscall
+    int c;
+
+    do {
+        c = sys_keybord();
+        sys_yield();
+    } while (c == -1);
+  201c26:	83 fa ff             	cmp    $0xffffffff,%edx
+  201c29:	74 f1                	je     201c1c <scan_char+0xa>
+
+    return c;
+  201c2b:	89 d0                	mov    %edx,%eax
+}
+  201c2d:	c3                   	ret
+
+0000000000201c2e <scan_line>:
+
+unsigned int scan_line(char* dst, unsigned int length_max) {
+  201c2e:	55                   	push   %rbp
+  201c2f:	48 89 e5             	mov    %rsp,%rbp
+  201c32:	41 57                	push   %r15
+  201c34:	41 56                	push   %r14
+  201c36:	41 55                	push   %r13
+  201c38:	41 54                	push   %r12
+  201c3a:	53                   	push   %rbx
+  201c3b:	48 83 ec 08          	sub    $0x8,%rsp
+  201c3f:	49 89 fe             	mov    %rdi,%r14
+  201c42:	41 89 f5             	mov    %esi,%r13d
+    unsigned int length = 0;
+  201c45:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            app_printf(0, "%c", c);
+            dst[length] = '\0';
+            return length;
+        } else if (c >= 32 && c <= 127) {
+            if (length < length_max) {
+                app_printf(0, "%c", c);
+  201c4b:	4c 8d 3d 8a 05 00 00 	lea    0x58a(%rip),%r15        # 2021dc <lower_digits.0+0x1c>
+  201c52:	eb 05                	jmp    201c59 <scan_line+0x2b>
+            if (length != 0) {
+  201c54:	45 85 e4             	test   %r12d,%r12d
+  201c57:	75 3e                	jne    201c97 <scan_line+0x69>
+        unsigned char c = scan_char();
+  201c59:	e8 b4 ff ff ff       	call   201c12 <scan_char>
+  201c5e:	89 c3                	mov    %eax,%ebx
+        if (c == '\b') {
+  201c60:	3c 08                	cmp    $0x8,%al
+  201c62:	74 f0                	je     201c54 <scan_line+0x26>
+        } else if (c == '\n') {
+  201c64:	3c 0a                	cmp    $0xa,%al
+  201c66:	74 4c                	je     201cb4 <scan_line+0x86>
+        } else if (c >= 32 && c <= 127) {
+  201c68:	8d 43 e0             	lea    -0x20(%rbx),%eax
+            if (length < length_max) {
+  201c6b:	3c 5f                	cmp    $0x5f,%al
+  201c6d:	77 ea                	ja     201c59 <scan_line+0x2b>
+  201c6f:	45 39 ec             	cmp    %r13d,%r12d
+  201c72:	73 e5                	jae    201c59 <scan_line+0x2b>
+                app_printf(0, "%c", c);
+  201c74:	0f b6 d3             	movzbl %bl,%edx
+  201c77:	4c 89 fe             	mov    %r15,%rsi
+  201c7a:	bf 00 00 00 00       	mov    $0x0,%edi
+  201c7f:	b8 00 00 00 00       	mov    $0x0,%eax
+  201c84:	e8 d7 fd ff ff       	call   201a60 <app_printf>
+                dst[length++] = c;
+  201c89:	44 89 e0             	mov    %r12d,%eax
+  201c8c:	41 88 1c 06          	mov    %bl,(%r14,%rax,1)
+  201c90:	45 8d 64 24 01       	lea    0x1(%r12),%r12d
+  201c95:	eb c2                	jmp    201c59 <scan_line+0x2b>
+                app_printf(0, "%c", c);
+  201c97:	ba 08 00 00 00       	mov    $0x8,%edx
+  201c9c:	4c 89 fe             	mov    %r15,%rsi
+  201c9f:	bf 00 00 00 00       	mov    $0x0,%edi
+  201ca4:	b8 00 00 00 00       	mov    $0x0,%eax
+  201ca9:	e8 b2 fd ff ff       	call   201a60 <app_printf>
+                length--;
+  201cae:	41 83 ec 01          	sub    $0x1,%r12d
+  201cb2:	eb a5                	jmp    201c59 <scan_line+0x2b>
+            app_printf(0, "%c", c);
+  201cb4:	ba 0a 00 00 00       	mov    $0xa,%edx
+  201cb9:	48 8d 35 1c 05 00 00 	lea    0x51c(%rip),%rsi        # 2021dc <lower_digits.0+0x1c>
+  201cc0:	bf 00 00 00 00       	mov    $0x0,%edi
+  201cc5:	b8 00 00 00 00       	mov    $0x0,%eax
+  201cca:	e8 91 fd ff ff       	call   201a60 <app_printf>
+            dst[length] = '\0';
+  201ccf:	44 89 e0             	mov    %r12d,%eax
+  201cd2:	41 c6 04 06 00       	movb   $0x0,(%r14,%rax,1)
+            }
+        }
+    }
+}
+  201cd7:	44 89 e0             	mov    %r12d,%eax
+  201cda:	48 83 c4 08          	add    $0x8,%rsp
+  201cde:	5b                   	pop    %rbx
+  201cdf:	41 5c                	pop    %r12
+  201ce1:	41 5d                	pop    %r13
+  201ce3:	41 5e                	pop    %r14
+  201ce5:	41 5f                	pop    %r15
+  201ce7:	5d                   	pop    %rbp
+  201ce8:	c3                   	ret
+
+0000000000201ce9 <split_string>:
+
+
+char** split_string(char* str, char sep) {
+  201ce9:	55                   	push   %rbp
+  201cea:	48 89 e5             	mov    %rsp,%rbp
+  201ced:	41 57                	push   %r15
+  201cef:	41 56                	push   %r14
+  201cf1:	41 55                	push   %r13
+  201cf3:	41 54                	push   %r12
+  201cf5:	53                   	push   %rbx
+  201cf6:	48 83 ec 08          	sub    $0x8,%rsp
+    int s = 1;
+    int n = 0;
+
+    while (str[n]) {
+  201cfa:	0f b6 07             	movzbl (%rdi),%eax
+  201cfd:	84 c0                	test   %al,%al
+  201cff:	0f 84 ad 00 00 00    	je     201db2 <split_string+0xc9>
+  201d05:	48 89 fb             	mov    %rdi,%rbx
+  201d08:	41 89 f4             	mov    %esi,%r12d
+  201d0b:	41 be 01 00 00 00    	mov    $0x1,%r14d
+    int s = 1;
+  201d11:	b9 01 00 00 00       	mov    $0x1,%ecx
+  201d16:	eb 03                	jmp    201d1b <split_string+0x32>
+  201d18:	49 89 d6             	mov    %rdx,%r14
+        if (str[n] == sep)
+            s++;
+  201d1b:	41 38 c4             	cmp    %al,%r12b
+  201d1e:	0f 94 c0             	sete   %al
+  201d21:	0f b6 c0             	movzbl %al,%eax
+  201d24:	01 c1                	add    %eax,%ecx
+    while (str[n]) {
+  201d26:	49 8d 56 01          	lea    0x1(%r14),%rdx
+  201d2a:	0f b6 44 13 ff       	movzbl -0x1(%rbx,%rdx,1),%eax
+  201d2f:	84 c0                	test   %al,%al
+  201d31:	75 e5                	jne    201d18 <split_string+0x2f>
+        n++;
+    }
+    
+    char** part = malloc((s+1)*sizeof(char*));
+  201d33:	44 8d 79 01          	lea    0x1(%rcx),%r15d
+  201d37:	4d 63 ff             	movslq %r15d,%r15
+  201d3a:	49 c1 e7 03          	shl    $0x3,%r15
+  201d3e:	4c 89 ff             	mov    %r15,%rdi
+  201d41:	e8 69 02 00 00       	call   201faf <malloc>
+  201d46:	49 89 c5             	mov    %rax,%r13
+    char* buffer = malloc(n+1);
+  201d49:	41 8d 7e 01          	lea    0x1(%r14),%edi
+  201d4d:	48 63 ff             	movslq %edi,%rdi
+  201d50:	e8 5a 02 00 00       	call   201faf <malloc>
+
+    int word_n = 0;
+    part[0] = buffer;
+  201d55:	49 89 45 00          	mov    %rax,0x0(%r13)
+    part[s] = NULL;
+  201d59:	4b c7 44 3d f8 00 00 	movq   $0x0,-0x8(%r13,%r15,1)
+  201d60:	00 00 
+    buffer[n] = 0;
+  201d62:	42 c6 04 30 00       	movb   $0x0,(%rax,%r14,1)
+
+    for (int i = 0; i < n; i++) {
+  201d67:	45 85 f6             	test   %r14d,%r14d
+  201d6a:	7e 6c                	jle    201dd8 <split_string+0xef>
+  201d6c:	41 83 ee 01          	sub    $0x1,%r14d
+  201d70:	48 89 da             	mov    %rbx,%rdx
+  201d73:	48 83 c0 01          	add    $0x1,%rax
+  201d77:	48 89 c1             	mov    %rax,%rcx
+    int word_n = 0;
+  201d7a:	bf 00 00 00 00       	mov    $0x0,%edi
+  201d7f:	eb 23                	jmp    201da4 <split_string+0xbb>
+        if (str[i] == sep) {
+            buffer[i] = 0;
+  201d81:	c6 41 ff 00          	movb   $0x0,-0x1(%rcx)
+            part[++word_n] = &buffer[i+1];
+  201d85:	83 c7 01             	add    $0x1,%edi
+  201d88:	48 63 f7             	movslq %edi,%rsi
+  201d8b:	49 89 4c f5 00       	mov    %rcx,0x0(%r13,%rsi,8)
+    for (int i = 0; i < n; i++) {
+  201d90:	48 83 c2 01          	add    $0x1,%rdx
+  201d94:	48 83 c1 01          	add    $0x1,%rcx
+  201d98:	89 ce                	mov    %ecx,%esi
+  201d9a:	29 c6                	sub    %eax,%esi
+  201d9c:	83 ee 01             	sub    $0x1,%esi
+  201d9f:	44 39 f6             	cmp    %r14d,%esi
+  201da2:	7d 34                	jge    201dd8 <split_string+0xef>
+        if (str[i] == sep) {
+  201da4:	0f b6 32             	movzbl (%rdx),%esi
+  201da7:	44 38 e6             	cmp    %r12b,%sil
+  201daa:	74 d5                	je     201d81 <split_string+0x98>
+        } else {
+            buffer[i] = str[i];
+  201dac:	40 88 71 ff          	mov    %sil,-0x1(%rcx)
+  201db0:	eb de                	jmp    201d90 <split_string+0xa7>
+    char** part = malloc((s+1)*sizeof(char*));
+  201db2:	bf 10 00 00 00       	mov    $0x10,%edi
+  201db7:	e8 f3 01 00 00       	call   201faf <malloc>
+  201dbc:	49 89 c5             	mov    %rax,%r13
+    char* buffer = malloc(n+1);
+  201dbf:	bf 01 00 00 00       	mov    $0x1,%edi
+  201dc4:	e8 e6 01 00 00       	call   201faf <malloc>
+    part[0] = buffer;
+  201dc9:	49 89 45 00          	mov    %rax,0x0(%r13)
+    part[s] = NULL;
+  201dcd:	49 c7 45 08 00 00 00 	movq   $0x0,0x8(%r13)
+  201dd4:	00 
+    buffer[n] = 0;
+  201dd5:	c6 00 00             	movb   $0x0,(%rax)
+        }
+    }
+
+    return part;
+}
+  201dd8:	4c 89 e8             	mov    %r13,%rax
+  201ddb:	48 83 c4 08          	add    $0x8,%rsp
+  201ddf:	5b                   	pop    %rbx
+  201de0:	41 5c                	pop    %r12
+  201de2:	41 5d                	pop    %r13
+  201de4:	41 5e                	pop    %r14
+  201de6:	41 5f                	pop    %r15
+  201de8:	5d                   	pop    %rbp
+  201de9:	c3                   	ret
+
+0000000000201dea <app_print_error>:
+
+
+void app_print_error(int r) {
+  201dea:	55                   	push   %rbp
+  201deb:	48 89 e5             	mov    %rsp,%rbp
+    switch (r) {
+  201dee:	83 ff 24             	cmp    $0x24,%edi
+  201df1:	0f 87 79 01 00 00    	ja     201f70 <app_print_error+0x186>
+  201df7:	89 f8                	mov    %edi,%eax
+  201df9:	48 8d 15 04 05 00 00 	lea    0x504(%rip),%rdx        # 202304 <lower_digits.0+0x144>
+  201e00:	48 63 04 82          	movslq (%rdx,%rax,4),%rax
+  201e04:	48 01 d0             	add    %rdx,%rax
+  201e07:	ff e0                	jmp    *%rax
+        case ENOENT:
+            app_printf(1, "Error: %s\n", "No such file or directory");
+  201e09:	48 8d 15 cf 03 00 00 	lea    0x3cf(%rip),%rdx        # 2021df <lower_digits.0+0x1f>
+  201e10:	48 8d 35 e2 03 00 00 	lea    0x3e2(%rip),%rsi        # 2021f9 <lower_digits.0+0x39>
+  201e17:	bf 01 00 00 00       	mov    $0x1,%edi
+  201e1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  201e21:	e8 3a fc ff ff       	call   201a60 <app_printf>
+            break;
+        default:
+            app_printf(1, "Error %d: %s\n", r, "Unknown error");
+            break;
+    }
+}
+  201e26:	5d                   	pop    %rbp
+  201e27:	c3                   	ret
+            app_printf(1, "Error: %s\n", "I/O error");
+  201e28:	48 8d 15 d5 03 00 00 	lea    0x3d5(%rip),%rdx        # 202204 <lower_digits.0+0x44>
+  201e2f:	48 8d 35 c3 03 00 00 	lea    0x3c3(%rip),%rsi        # 2021f9 <lower_digits.0+0x39>
+  201e36:	bf 01 00 00 00       	mov    $0x1,%edi
+  201e3b:	b8 00 00 00 00       	mov    $0x0,%eax
+  201e40:	e8 1b fc ff ff       	call   201a60 <app_printf>
+            break;
+  201e45:	eb df                	jmp    201e26 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Exec format error");
+  201e47:	48 8d 15 c0 03 00 00 	lea    0x3c0(%rip),%rdx        # 20220e <lower_digits.0+0x4e>
+  201e4e:	48 8d 35 a4 03 00 00 	lea    0x3a4(%rip),%rsi        # 2021f9 <lower_digits.0+0x39>
+  201e55:	bf 01 00 00 00       	mov    $0x1,%edi
+  201e5a:	b8 00 00 00 00       	mov    $0x0,%eax
+  201e5f:	e8 fc fb ff ff       	call   201a60 <app_printf>
+            break;
+  201e64:	eb c0                	jmp    201e26 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Resource temporarily unavailable");
+  201e66:	48 8d 15 73 04 00 00 	lea    0x473(%rip),%rdx        # 2022e0 <lower_digits.0+0x120>
+  201e6d:	48 8d 35 85 03 00 00 	lea    0x385(%rip),%rsi        # 2021f9 <lower_digits.0+0x39>
+  201e74:	bf 01 00 00 00       	mov    $0x1,%edi
+  201e79:	b8 00 00 00 00       	mov    $0x0,%eax
+  201e7e:	e8 dd fb ff ff       	call   201a60 <app_printf>
+            break;
+  201e83:	eb a1                	jmp    201e26 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Out of memory");
+  201e85:	48 8d 15 94 03 00 00 	lea    0x394(%rip),%rdx        # 202220 <lower_digits.0+0x60>
+  201e8c:	48 8d 35 66 03 00 00 	lea    0x366(%rip),%rsi        # 2021f9 <lower_digits.0+0x39>
+  201e93:	bf 01 00 00 00       	mov    $0x1,%edi
+  201e98:	b8 00 00 00 00       	mov    $0x0,%eax
+  201e9d:	e8 be fb ff ff       	call   201a60 <app_printf>
+            break;
+  201ea2:	eb 82                	jmp    201e26 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Bad address");
+  201ea4:	48 8d 15 83 03 00 00 	lea    0x383(%rip),%rdx        # 20222e <lower_digits.0+0x6e>
+  201eab:	48 8d 35 47 03 00 00 	lea    0x347(%rip),%rsi        # 2021f9 <lower_digits.0+0x39>
+  201eb2:	bf 01 00 00 00       	mov    $0x1,%edi
+  201eb7:	b8 00 00 00 00       	mov    $0x0,%eax
+  201ebc:	e8 9f fb ff ff       	call   201a60 <app_printf>
+            break;
+  201ec1:	e9 60 ff ff ff       	jmp    201e26 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Not a directory");
+  201ec6:	48 8d 15 6d 03 00 00 	lea    0x36d(%rip),%rdx        # 20223a <lower_digits.0+0x7a>
+  201ecd:	48 8d 35 25 03 00 00 	lea    0x325(%rip),%rsi        # 2021f9 <lower_digits.0+0x39>
+  201ed4:	bf 01 00 00 00       	mov    $0x1,%edi
+  201ed9:	b8 00 00 00 00       	mov    $0x0,%eax
+  201ede:	e8 7d fb ff ff       	call   201a60 <app_printf>
+            break;
+  201ee3:	e9 3e ff ff ff       	jmp    201e26 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Invalid argument");
+  201ee8:	48 8d 15 5b 03 00 00 	lea    0x35b(%rip),%rdx        # 20224a <lower_digits.0+0x8a>
+  201eef:	48 8d 35 03 03 00 00 	lea    0x303(%rip),%rsi        # 2021f9 <lower_digits.0+0x39>
+  201ef6:	bf 01 00 00 00       	mov    $0x1,%edi
+  201efb:	b8 00 00 00 00       	mov    $0x0,%eax
+  201f00:	e8 5b fb ff ff       	call   201a60 <app_printf>
+            break;
+  201f05:	e9 1c ff ff ff       	jmp    201e26 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "No space left on device");
+  201f0a:	48 8d 15 4a 03 00 00 	lea    0x34a(%rip),%rdx        # 20225b <lower_digits.0+0x9b>
+  201f11:	48 8d 35 e1 02 00 00 	lea    0x2e1(%rip),%rsi        # 2021f9 <lower_digits.0+0x39>
+  201f18:	bf 01 00 00 00       	mov    $0x1,%edi
+  201f1d:	b8 00 00 00 00       	mov    $0x0,%eax
+  201f22:	e8 39 fb ff ff       	call   201a60 <app_printf>
+            break;
+  201f27:	e9 fa fe ff ff       	jmp    201e26 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "File already exists");
+  201f2c:	48 8d 15 40 03 00 00 	lea    0x340(%rip),%rdx        # 202273 <lower_digits.0+0xb3>
+  201f33:	48 8d 35 bf 02 00 00 	lea    0x2bf(%rip),%rsi        # 2021f9 <lower_digits.0+0x39>
+  201f3a:	bf 01 00 00 00       	mov    $0x1,%edi
+  201f3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  201f44:	e8 17 fb ff ff       	call   201a60 <app_printf>
+            break;
+  201f49:	e9 d8 fe ff ff       	jmp    201e26 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "File name too long");
+  201f4e:	48 8d 15 32 03 00 00 	lea    0x332(%rip),%rdx        # 202287 <lower_digits.0+0xc7>
+  201f55:	48 8d 35 9d 02 00 00 	lea    0x29d(%rip),%rsi        # 2021f9 <lower_digits.0+0x39>
+  201f5c:	bf 01 00 00 00       	mov    $0x1,%edi
+  201f61:	b8 00 00 00 00       	mov    $0x0,%eax
+  201f66:	e8 f5 fa ff ff       	call   201a60 <app_printf>
+            break;
+  201f6b:	e9 b6 fe ff ff       	jmp    201e26 <app_print_error+0x3c>
+            app_printf(1, "Error %d: %s\n", r, "Unknown error");
+  201f70:	48 8d 0d 23 03 00 00 	lea    0x323(%rip),%rcx        # 20229a <lower_digits.0+0xda>
+  201f77:	89 fa                	mov    %edi,%edx
+  201f79:	48 8d 35 28 03 00 00 	lea    0x328(%rip),%rsi        # 2022a8 <lower_digits.0+0xe8>
+  201f80:	bf 01 00 00 00       	mov    $0x1,%edi
+  201f85:	b8 00 00 00 00       	mov    $0x0,%eax
+  201f8a:	e8 d1 fa ff ff       	call   201a60 <app_printf>
+}
+  201f8f:	e9 92 fe ff ff       	jmp    201e26 <app_print_error+0x3c>
+
+0000000000201f94 <handle_error>:
+
+__attribute__((noreturn)) void handle_error(int r) {
+  201f94:	55                   	push   %rbp
+  201f95:	48 89 e5             	mov    %rsp,%rbp
+  201f98:	53                   	push   %rbx
+  201f99:	48 83 ec 08          	sub    $0x8,%rsp
+  201f9d:	89 fb                	mov    %edi,%ebx
+    app_print_error(r);
+  201f9f:	e8 46 fe ff ff       	call   201dea <app_print_error>
+    asm volatile ("syscall" : "=a" (rax)
+  201fa4:	b8 40 00 00 00       	mov    $0x40,%eax
+  201fa9:	89 df                	mov    %ebx,%edi
+  201fab:	0f 05                	syscall
+ spinloop: goto spinloop;       // should never get here
+  201fad:	eb fe                	jmp    201fad <handle_error+0x19>
+
+0000000000201faf <malloc>:
+
+// The heap starts 1MB above the program image (PROC_START_ADDR)
+static uint8_t* heap_top = (uint8_t*) 0x300000;
+static uint8_t* page_top = (uint8_t*) 0x300000;
+
+void* malloc(size_t size) {
+  201faf:	48 89 fe             	mov    %rdi,%rsi
+    while (ROUNDDOWN(heap_top + size, PAGESIZE) >= page_top) {
+  201fb2:	48 8b 05 4f 10 00 00 	mov    0x104f(%rip),%rax        # 203008 <heap_top>
+  201fb9:	48 8d 14 38          	lea    (%rax,%rdi,1),%rdx
+  201fbd:	48 8b 3d 3c 10 00 00 	mov    0x103c(%rip),%rdi        # 203000 <page_top>
+  201fc4:	48 89 d1             	mov    %rdx,%rcx
+  201fc7:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  201fce:	48 39 f9             	cmp    %rdi,%rcx
+  201fd1:	72 3e                	jb     202011 <malloc+0x62>
+    asm volatile ("syscall" : "=a" (result)
+  201fd3:	41 b8 3b 00 00 00    	mov    $0x3b,%r8d
+  201fd9:	44 89 c0             	mov    %r8d,%eax
+  201fdc:	0f 05                	syscall
+        int r = sys_page_alloc(page_top);
+        assert(r >= 0);
+  201fde:	85 c0                	test   %eax,%eax
+  201fe0:	78 37                	js     202019 <malloc+0x6a>
+        page_top += PAGESIZE;
+  201fe2:	48 8b 05 17 10 00 00 	mov    0x1017(%rip),%rax        # 203000 <page_top>
+  201fe9:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  201ff0:	48 89 3d 09 10 00 00 	mov    %rdi,0x1009(%rip)        # 203000 <page_top>
+    while (ROUNDDOWN(heap_top + size, PAGESIZE) >= page_top) {
+  201ff7:	48 8b 05 0a 10 00 00 	mov    0x100a(%rip),%rax        # 203008 <heap_top>
+  201ffe:	48 8d 14 30          	lea    (%rax,%rsi,1),%rdx
+  202002:	48 89 d1             	mov    %rdx,%rcx
+  202005:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  20200c:	48 39 f9             	cmp    %rdi,%rcx
+  20200f:	73 c8                	jae    201fd9 <malloc+0x2a>
+    }
+
+    void* addr = heap_top;
+    heap_top += size;
+  202011:	48 89 15 f0 0f 00 00 	mov    %rdx,0xff0(%rip)        # 203008 <heap_top>
+    return addr;
+}
+  202018:	c3                   	ret
+void* malloc(size_t size) {
+  202019:	55                   	push   %rbp
+  20201a:	48 89 e5             	mov    %rsp,%rbp
+        assert(r >= 0);
+  20201d:	48 8d 15 79 03 00 00 	lea    0x379(%rip),%rdx        # 20239d <col.0+0x5>
+  202024:	be 0b 00 00 00       	mov    $0xb,%esi
+  202029:	48 8d 3d 74 03 00 00 	lea    0x374(%rip),%rdi        # 2023a4 <col.0+0xc>
+  202030:	e8 b0 fb ff ff       	call   201be5 <assert_fail>
@@ -0,0 +1,3311 @@
+
+obj/p-fork.full:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000200000 <process_main>:
+
+// These global variables go on the data page.
+uint8_t* heap_top;
+uint8_t* stack_bottom;
+
+void process_main(void) {
+  200000:	55                   	push   %rbp
+  200001:	48 89 e5             	mov    %rsp,%rbp
+// sys_fork()
+//    Fork the current process. On success, return the child's process ID to
+//    the parent, and return 0 to the child. On failure, return -1.
+static inline pid_t sys_fork(void) {
+    pid_t result;
+    asm volatile ("syscall" : "=a" (result)
+  200004:	b8 3e 00 00 00       	mov    $0x3e,%eax
+  200009:	0f 05                	syscall
+    // Fork a total of three new copies.
+    pid_t p1 = sys_fork();
+    assert(p1 >= 0);
+  20000b:	85 c0                	test   %eax,%eax
+  20000d:	78 2c                	js     20003b <process_main+0x3b>
+  20000f:	89 c2                	mov    %eax,%edx
+  200011:	b8 3e 00 00 00       	mov    $0x3e,%eax
+  200016:	0f 05                	syscall
+    pid_t p2 = sys_fork();
+    assert(p2 >= 0);
+  200018:	85 c0                	test   %eax,%eax
+  20001a:	78 37                	js     200053 <process_main+0x53>
+}
+
+// getpid()
+//    Return current process ID, like sys_getpid().
+static inline pid_t getpid(void) {
+    return vdso()->pid;
+  20001c:	8b 0c 25 00 10 24 00 	mov    0x241000,%ecx
+
+    // Check fork return values: fork should return 0 to child.
+    if (getpid() == 1) {
+  200023:	83 f9 01             	cmp    $0x1,%ecx
+  200026:	74 43                	je     20006b <process_main+0x6b>
+        //assert(p1 != 0);
+        assert(p1 != 0 && p2 != 0 && p1 != p2);
+    } else {
+        //assert(p1 == 0);
+        assert(p1 == 0 || p2 == 0);
+  200028:	85 d2                	test   %edx,%edx
+  20002a:	74 04                	je     200030 <process_main+0x30>
+  20002c:	85 c0                	test   %eax,%eax
+  20002e:	75 65                	jne    200095 <process_main+0x95>
+    asm volatile ("syscall" : "=a" (rax)
+  200030:	ba 3c 00 00 00       	mov    $0x3c,%edx
+  200035:	89 d0                	mov    %edx,%eax
+  200037:	0f 05                	syscall
+  200039:	eb fa                	jmp    200035 <process_main+0x35>
+    assert(p1 >= 0);
+  20003b:	48 8d 15 4e 20 00 00 	lea    0x204e(%rip),%rdx        # 202090 <malloc+0x93>
+  200042:	be 0e 00 00 00       	mov    $0xe,%esi
+  200047:	48 8d 3d 4a 20 00 00 	lea    0x204a(%rip),%rdi        # 202098 <malloc+0x9b>
+  20004e:	e8 e0 1b 00 00       	call   201c33 <assert_fail>
+    assert(p2 >= 0);
+  200053:	48 8d 15 51 20 00 00 	lea    0x2051(%rip),%rdx        # 2020ab <malloc+0xae>
+  20005a:	be 10 00 00 00       	mov    $0x10,%esi
+  20005f:	48 8d 3d 32 20 00 00 	lea    0x2032(%rip),%rdi        # 202098 <malloc+0x9b>
+  200066:	e8 c8 1b 00 00       	call   201c33 <assert_fail>
+        assert(p1 != 0 && p2 != 0 && p1 != p2);
+  20006b:	85 c0                	test   %eax,%eax
+  20006d:	0f 94 c1             	sete   %cl
+  200070:	39 c2                	cmp    %eax,%edx
+  200072:	0f 94 c0             	sete   %al
+  200075:	08 c1                	or     %al,%cl
+  200077:	75 04                	jne    20007d <process_main+0x7d>
+  200079:	85 d2                	test   %edx,%edx
+  20007b:	75 b3                	jne    200030 <process_main+0x30>
+  20007d:	48 8d 15 44 20 00 00 	lea    0x2044(%rip),%rdx        # 2020c8 <malloc+0xcb>
+  200084:	be 15 00 00 00       	mov    $0x15,%esi
+  200089:	48 8d 3d 08 20 00 00 	lea    0x2008(%rip),%rdi        # 202098 <malloc+0x9b>
+  200090:	e8 9e 1b 00 00       	call   201c33 <assert_fail>
+        assert(p1 == 0 || p2 == 0);
+  200095:	48 8d 15 17 20 00 00 	lea    0x2017(%rip),%rdx        # 2020b3 <malloc+0xb6>
+  20009c:	be 18 00 00 00       	mov    $0x18,%esi
+  2000a1:	48 8d 3d f0 1f 00 00 	lea    0x1ff0(%rip),%rdi        # 202098 <malloc+0x9b>
+  2000a8:	e8 86 1b 00 00       	call   201c33 <assert_fail>
+
+00000000002000ad <vdso>:
+static inline const volatile vdso_data* vdso(void) {
+  2000ad:	55                   	push   %rbp
+  2000ae:	48 89 e5             	mov    %rsp,%rbp
+    return (const volatile vdso_data*) VDSO_ADDR;
+  2000b1:	b8 00 10 24 00       	mov    $0x241000,%eax
+}
+  2000b6:	5d                   	pop    %rbp
+  2000b7:	c3                   	ret
+
+00000000002000b8 <memcpy>:
+#define MEMOP_WORD_MIN 64
+
+// an unaligned word that may alias any object
+typedef uint64_t __attribute__((may_alias, aligned(1))) memop_word;
+
+void* memcpy(void* dst, const void* src, size_t n) {
+  2000b8:	55                   	push   %rbp
+  2000b9:	48 89 e5             	mov    %rsp,%rbp
+  2000bc:	48 83 ec 48          	sub    $0x48,%rsp
+  2000c0:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  2000c4:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  2000c8:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+    char* d = (char*) dst;
+  2000cc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  2000d0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    const char* s = (const char*) src;
+  2000d4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  2000d8:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (n >= MEMOP_WORD_MIN) {
+  2000dc:	48 83 7d b8 3f       	cmpq   $0x3f,-0x48(%rbp)
+  2000e1:	0f 86 c5 00 00 00    	jbe    2001ac <memcpy+0xf4>
+        size_t head = -(uintptr_t) d & 7;
+  2000e7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2000eb:	48 f7 d8             	neg    %rax
+  2000ee:	83 e0 07             	and    $0x7,%eax
+  2000f1:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        size_t words = (n - head) / 8;
+  2000f5:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  2000f9:	48 2b 45 e8          	sub    -0x18(%rbp),%rax
+  2000fd:	48 c1 e8 03          	shr    $0x3,%rax
+  200101:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+        n = (n - head) % 8;
+  200105:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  200109:	48 2b 45 e8          	sub    -0x18(%rbp),%rax
+  20010d:	83 e0 07             	and    $0x7,%eax
+  200110:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        asm volatile("rep movsb" : "+D" (d), "+S" (s), "+c" (head)
+  200114:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  200118:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  20011c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  200120:	48 89 cf             	mov    %rcx,%rdi
+  200123:	48 89 d6             	mov    %rdx,%rsi
+  200126:	48 89 c1             	mov    %rax,%rcx
+  200129:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  20012b:	48 89 c8             	mov    %rcx,%rax
+  20012e:	48 89 f2             	mov    %rsi,%rdx
+  200131:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  200135:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  200139:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                     : : "memory");
+        asm volatile("rep movsq" : "+D" (d), "+S" (s), "+c" (words)
+  20013d:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  200141:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  200145:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  200149:	48 89 cf             	mov    %rcx,%rdi
+  20014c:	48 89 d6             	mov    %rdx,%rsi
+  20014f:	48 89 c1             	mov    %rax,%rcx
+  200152:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  200155:	48 89 c8             	mov    %rcx,%rax
+  200158:	48 89 f2             	mov    %rsi,%rdx
+  20015b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  20015f:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  200163:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+                     : : "memory");
+    }
+    for (; n >= 16; n -= 16, s += 16, d += 16) {
+  200167:	eb 43                	jmp    2001ac <memcpy+0xf4>
+        memop_word a = ((const memop_word*) s)[0];
+  200169:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  20016d:	48 8b 00             	mov    (%rax),%rax
+  200170:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+        memop_word b = ((const memop_word*) s)[1];
+  200174:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  200178:	48 83 c0 08          	add    $0x8,%rax
+  20017c:	48 8b 00             	mov    (%rax),%rax
+  20017f:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+        ((memop_word*) d)[0] = a;
+  200183:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200187:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  20018b:	48 89 10             	mov    %rdx,(%rax)
+        ((memop_word*) d)[1] = b;
+  20018e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200192:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  200196:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  20019a:	48 89 02             	mov    %rax,(%rdx)
+    for (; n >= 16; n -= 16, s += 16, d += 16) {
+  20019d:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  2001a2:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  2001a7:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  2001ac:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  2001b1:	77 b6                	ja     200169 <memcpy+0xb1>
+    }
+    for (; n > 0; --n, ++s, ++d) {
+  2001b3:	eb 1c                	jmp    2001d1 <memcpy+0x119>
+        *d = *s;
+  2001b5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2001b9:	0f b6 10             	movzbl (%rax),%edx
+  2001bc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2001c0:	88 10                	mov    %dl,(%rax)
+    for (; n > 0; --n, ++s, ++d) {
+  2001c2:	48 83 6d b8 01       	subq   $0x1,-0x48(%rbp)
+  2001c7:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  2001cc:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  2001d1:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  2001d6:	75 dd                	jne    2001b5 <memcpy+0xfd>
+    }
+    return dst;
+  2001d8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  2001dc:	c9                   	leave
+  2001dd:	c3                   	ret
+
+00000000002001de <memmove>:
+
+void* memmove(void* dst, const void* src, size_t n) {
+  2001de:	55                   	push   %rbp
+  2001df:	48 89 e5             	mov    %rsp,%rbp
+  2001e2:	48 83 ec 38          	sub    $0x38,%rsp
+  2001e6:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  2001ea:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  2001ee:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    const char* s = (const char*) src;
+  2001f2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  2001f6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    char* d = (char*) dst;
+  2001fa:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  2001fe:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (!(s < d && s + n > d)) {
+  200202:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200206:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  20020a:	73 11                	jae    20021d <memmove+0x3f>
+  20020c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  200210:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200214:	48 01 d0             	add    %rdx,%rax
+  200217:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  20021b:	72 1c                	jb     200239 <memmove+0x5b>
+        // a forward copy never overwrites source bytes it has yet to read
+        return memcpy(dst, src, n);
+  20021d:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  200221:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  200225:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  200229:	48 89 ce             	mov    %rcx,%rsi
+  20022c:	48 89 c7             	mov    %rax,%rdi
+  20022f:	e8 84 fe ff ff       	call   2000b8 <memcpy>
+  200234:	e9 94 00 00 00       	jmp    2002cd <memmove+0xef>
+    }
+
+    // copy backwards: the tail bytes, then words down to the start
+    size_t words = n / 8;
+  200239:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  20023d:	48 c1 e8 03          	shr    $0x3,%rax
+  200241:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    size_t tail = n % 8;
+  200245:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200249:	83 e0 07             	and    $0x7,%eax
+  20024c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    s += n - 1, d += n - 1;
+  200250:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200254:	48 83 e8 01          	sub    $0x1,%rax
+  200258:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  20025c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200260:	48 83 e8 01          	sub    $0x1,%rax
+  200264:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    asm volatile("std; rep movsb; cld" : "+D" (d), "+S" (s), "+c" (tail)
+  200268:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  20026c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  200270:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  200274:	48 89 cf             	mov    %rcx,%rdi
+  200277:	48 89 d6             	mov    %rdx,%rsi
+  20027a:	48 89 c1             	mov    %rax,%rcx
+  20027d:	fd                   	std
+  20027e:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  200280:	fc                   	cld
+  200281:	48 89 c8             	mov    %rcx,%rax
+  200284:	48 89 f2             	mov    %rsi,%rdx
+  200287:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  20028b:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  20028f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+                 : : "memory", "cc");
+    s -= 7, d -= 7;
+  200293:	48 83 6d f8 07       	subq   $0x7,-0x8(%rbp)
+  200298:	48 83 6d f0 07       	subq   $0x7,-0x10(%rbp)
+    asm volatile("std; rep movsq; cld" : "+D" (d), "+S" (s), "+c" (words)
+  20029d:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  2002a1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  2002a5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2002a9:	48 89 cf             	mov    %rcx,%rdi
+  2002ac:	48 89 d6             	mov    %rdx,%rsi
+  2002af:	48 89 c1             	mov    %rax,%rcx
+  2002b2:	fd                   	std
+  2002b3:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  2002b6:	fc                   	cld
+  2002b7:	48 89 c8             	mov    %rcx,%rax
+  2002ba:	48 89 f2             	mov    %rsi,%rdx
+  2002bd:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  2002c1:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  2002c5:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 : : "memory", "cc");
+    return dst;
+  2002c9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  2002cd:	c9                   	leave
+  2002ce:	c3                   	ret
+
+00000000002002cf <memset>:
+
+void* memset(void* v, int c, size_t n) {
+  2002cf:	55                   	push   %rbp
+  2002d0:	48 89 e5             	mov    %rsp,%rbp
+  2002d3:	48 83 ec 38          	sub    $0x38,%rsp
+  2002d7:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  2002db:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  2002de:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    char* p = (char*) v;
+  2002e2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  2002e6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    uint64_t word = (uint8_t) c * 0x0101010101010101UL;
+  2002ea:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  2002ed:	0f b6 c0             	movzbl %al,%eax
+  2002f0:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  2002f7:	01 01 01 
+  2002fa:	48 0f af c2          	imul   %rdx,%rax
+  2002fe:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (n >= MEMOP_WORD_MIN) {
+  200302:	48 83 7d c8 3f       	cmpq   $0x3f,-0x38(%rbp)
+  200307:	0f 86 9e 00 00 00    	jbe    2003ab <memset+0xdc>
+        size_t head = -(uintptr_t) p & 7;
+  20030d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200311:	48 f7 d8             	neg    %rax
+  200314:	83 e0 07             	and    $0x7,%eax
+  200317:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        size_t words = (n - head) / 8;
+  20031b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  20031f:	48 2b 45 e8          	sub    -0x18(%rbp),%rax
+  200323:	48 c1 e8 03          	shr    $0x3,%rax
+  200327:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+        n = (n - head) % 8;
+  20032b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  20032f:	48 2b 45 e8          	sub    -0x18(%rbp),%rax
+  200333:	83 e0 07             	and    $0x7,%eax
+  200336:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        asm volatile("rep stosb" : "+D" (p), "+c" (head) : "a" (word)
+  20033a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  20033e:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  200342:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  200346:	48 89 ce             	mov    %rcx,%rsi
+  200349:	48 89 f7             	mov    %rsi,%rdi
+  20034c:	48 89 d1             	mov    %rdx,%rcx
+  20034f:	f3 aa                	rep stos %al,%es:(%rdi)
+  200351:	48 89 ca             	mov    %rcx,%rdx
+  200354:	48 89 fe             	mov    %rdi,%rsi
+  200357:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  20035b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+                     : "memory");
+        asm volatile("rep stosq" : "+D" (p), "+c" (words) : "a" (word)
+  20035f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  200363:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  200367:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  20036b:	48 89 ce             	mov    %rcx,%rsi
+  20036e:	48 89 f7             	mov    %rsi,%rdi
+  200371:	48 89 d1             	mov    %rdx,%rcx
+  200374:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  200377:	48 89 ca             	mov    %rcx,%rdx
+  20037a:	48 89 fe             	mov    %rdi,%rsi
+  20037d:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  200381:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+                     : "memory");
+    }
+    for (; n >= 16; n -= 16, p += 16) {
+  200385:	eb 24                	jmp    2003ab <memset+0xdc>
+        ((memop_word*) p)[0] = word;
+  200387:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20038b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  20038f:	48 89 10             	mov    %rdx,(%rax)
+        ((memop_word*) p)[1] = word;
+  200392:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200396:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  20039a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  20039e:	48 89 02             	mov    %rax,(%rdx)
+    for (; n >= 16; n -= 16, p += 16) {
+  2003a1:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  2003a6:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  2003ab:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  2003b0:	77 d5                	ja     200387 <memset+0xb8>
+    }
+    for (; n > 0; ++p, --n) {
+  2003b2:	eb 15                	jmp    2003c9 <memset+0xfa>
+        *p = c;
+  2003b4:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  2003b7:	89 c2                	mov    %eax,%edx
+  2003b9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2003bd:	88 10                	mov    %dl,(%rax)
+    for (; n > 0; ++p, --n) {
+  2003bf:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  2003c4:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  2003c9:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  2003ce:	75 e4                	jne    2003b4 <memset+0xe5>
+    }
+    return v;
+  2003d0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  2003d4:	c9                   	leave
+  2003d5:	c3                   	ret
+
+00000000002003d6 <strlen>:
+
+size_t strlen(const char* s) {
+  2003d6:	55                   	push   %rbp
+  2003d7:	48 89 e5             	mov    %rsp,%rbp
+  2003da:	48 83 ec 18          	sub    $0x18,%rsp
+  2003de:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    size_t n;
+    for (n = 0; *s != '\0'; ++s) {
+  2003e2:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  2003e9:	00 
+  2003ea:	eb 0a                	jmp    2003f6 <strlen+0x20>
+        ++n;
+  2003ec:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    for (n = 0; *s != '\0'; ++s) {
+  2003f1:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  2003f6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2003fa:	0f b6 00             	movzbl (%rax),%eax
+  2003fd:	84 c0                	test   %al,%al
+  2003ff:	75 eb                	jne    2003ec <strlen+0x16>
+    }
+    return n;
+  200401:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  200405:	c9                   	leave
+  200406:	c3                   	ret
+
+0000000000200407 <strnlen>:
+
+size_t strnlen(const char* s, size_t maxlen) {
+  200407:	55                   	push   %rbp
+  200408:	48 89 e5             	mov    %rsp,%rbp
+  20040b:	48 83 ec 20          	sub    $0x20,%rsp
+  20040f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  200413:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    size_t n;
+    for (n = 0; n != maxlen && *s != '\0'; ++s) {
+  200417:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  20041e:	00 
+  20041f:	eb 0a                	jmp    20042b <strnlen+0x24>
+        ++n;
+  200421:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    for (n = 0; n != maxlen && *s != '\0'; ++s) {
+  200426:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  20042b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20042f:	48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+  200433:	74 0b                	je     200440 <strnlen+0x39>
+  200435:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  200439:	0f b6 00             	movzbl (%rax),%eax
+  20043c:	84 c0                	test   %al,%al
+  20043e:	75 e1                	jne    200421 <strnlen+0x1a>
+    }
+    return n;
+  200440:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  200444:	c9                   	leave
+  200445:	c3                   	ret
+
+0000000000200446 <strcpy>:
+
+char* strcpy(char* dst, const char* src) {
+  200446:	55                   	push   %rbp
+  200447:	48 89 e5             	mov    %rsp,%rbp
+  20044a:	48 83 ec 20          	sub    $0x20,%rsp
+  20044e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  200452:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    char* d = dst;
+  200456:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20045a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    do {
+        *d++ = *src++;
+  20045e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  200462:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  200466:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  20046a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20046e:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  200472:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+  200476:	0f b6 12             	movzbl (%rdx),%edx
+  200479:	88 10                	mov    %dl,(%rax)
+    } while (d[-1]);
+  20047b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20047f:	48 83 e8 01          	sub    $0x1,%rax
+  200483:	0f b6 00             	movzbl (%rax),%eax
+  200486:	84 c0                	test   %al,%al
+  200488:	75 d4                	jne    20045e <strcpy+0x18>
+    return dst;
+  20048a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  20048e:	c9                   	leave
+  20048f:	c3                   	ret
+
+0000000000200490 <strcmp>:
+
+int strcmp(const char* a, const char* b) {
+  200490:	55                   	push   %rbp
+  200491:	48 89 e5             	mov    %rsp,%rbp
+  200494:	48 83 ec 10          	sub    $0x10,%rsp
+  200498:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  20049c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    while (*a && *b && *a == *b) {
+  2004a0:	eb 0a                	jmp    2004ac <strcmp+0x1c>
+        ++a, ++b;
+  2004a2:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  2004a7:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+    while (*a && *b && *a == *b) {
+  2004ac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2004b0:	0f b6 00             	movzbl (%rax),%eax
+  2004b3:	84 c0                	test   %al,%al
+  2004b5:	74 1d                	je     2004d4 <strcmp+0x44>
+  2004b7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2004bb:	0f b6 00             	movzbl (%rax),%eax
+  2004be:	84 c0                	test   %al,%al
+  2004c0:	74 12                	je     2004d4 <strcmp+0x44>
+  2004c2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2004c6:	0f b6 10             	movzbl (%rax),%edx
+  2004c9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2004cd:	0f b6 00             	movzbl (%rax),%eax
+  2004d0:	38 c2                	cmp    %al,%dl
+  2004d2:	74 ce                	je     2004a2 <strcmp+0x12>
+    }
+    return ((unsigned char) *a > (unsigned char) *b)
+  2004d4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2004d8:	0f b6 00             	movzbl (%rax),%eax
+  2004db:	89 c2                	mov    %eax,%edx
+  2004dd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2004e1:	0f b6 00             	movzbl (%rax),%eax
+  2004e4:	38 d0                	cmp    %dl,%al
+  2004e6:	0f 92 c0             	setb   %al
+  2004e9:	0f b6 d0             	movzbl %al,%edx
+        - ((unsigned char) *a < (unsigned char) *b);
+  2004ec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2004f0:	0f b6 00             	movzbl (%rax),%eax
+  2004f3:	89 c1                	mov    %eax,%ecx
+  2004f5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2004f9:	0f b6 00             	movzbl (%rax),%eax
+  2004fc:	38 c1                	cmp    %al,%cl
+  2004fe:	0f 92 c0             	setb   %al
+  200501:	0f b6 c0             	movzbl %al,%eax
+  200504:	29 c2                	sub    %eax,%edx
+  200506:	89 d0                	mov    %edx,%eax
+}
+  200508:	c9                   	leave
+  200509:	c3                   	ret
+
+000000000020050a <strchr>:
+
+char* strchr(const char* s, int c) {
+  20050a:	55                   	push   %rbp
+  20050b:	48 89 e5             	mov    %rsp,%rbp
+  20050e:	48 83 ec 10          	sub    $0x10,%rsp
+  200512:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  200516:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    while (*s && *s != (char) c) {
+  200519:	eb 05                	jmp    200520 <strchr+0x16>
+        ++s;
+  20051b:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    while (*s && *s != (char) c) {
+  200520:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200524:	0f b6 00             	movzbl (%rax),%eax
+  200527:	84 c0                	test   %al,%al
+  200529:	74 0e                	je     200539 <strchr+0x2f>
+  20052b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20052f:	0f b6 00             	movzbl (%rax),%eax
+  200532:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  200535:	38 d0                	cmp    %dl,%al
+  200537:	75 e2                	jne    20051b <strchr+0x11>
+    }
+    if (*s == (char) c) {
+  200539:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20053d:	0f b6 00             	movzbl (%rax),%eax
+  200540:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  200543:	38 d0                	cmp    %dl,%al
+  200545:	75 06                	jne    20054d <strchr+0x43>
+        return (char*) s;
+  200547:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20054b:	eb 05                	jmp    200552 <strchr+0x48>
+    } else {
+        return NULL;
+  20054d:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+}
+  200552:	c9                   	leave
+  200553:	c3                   	ret
+
+0000000000200554 <rand>:
+
+// New randomness implementation
+static int      rand_seed_set;
+static unsigned rand_seed;
+
+int rand(void) {
+  200554:	55                   	push   %rbp
+  200555:	48 89 e5             	mov    %rsp,%rbp
+  200558:	48 83 ec 10          	sub    $0x10,%rsp
+    if (!rand_seed_set) {
+  20055c:	8b 05 ae 2a 00 00    	mov    0x2aae(%rip),%eax        # 203010 <rand_seed_set>
+  200562:	85 c0                	test   %eax,%eax
+  200564:	75 2c                	jne    200592 <rand+0x3e>
+#if WEENSYOS_KERNEL
+        extern unsigned get_entropy_value(void);
+        srand(get_entropy_value());
+#else           // user‑space build
+       /* kernel-refreshed seed from the kernel data page: no system call */
+       srand((unsigned) (vdso()->seed[0] ^ read_cycle_counter()));
+  200566:	e8 42 fb ff ff       	call   2000ad <vdso>
+  20056b:	48 8b 40 18          	mov    0x18(%rax),%rax
+  20056f:	89 c1                	mov    %eax,%ecx
+    }
+}
+
+static inline uint64_t read_cycle_counter(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+  200571:	0f 31                	rdtsc
+  200573:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  200576:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    return ((uint64_t) hi << 32) | lo;
+  200579:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  20057c:	48 c1 e0 20          	shl    $0x20,%rax
+  200580:	48 89 c2             	mov    %rax,%rdx
+  200583:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  200586:	48 09 d0             	or     %rdx,%rax
+  200589:	31 c8                	xor    %ecx,%eax
+  20058b:	89 c7                	mov    %eax,%edi
+  20058d:	e8 24 00 00 00       	call   2005b6 <srand>
+#endif
+    }
+    rand_seed = rand_seed * 1664525U + 1013904223U;   // LCG
+  200592:	8b 05 7c 2a 00 00    	mov    0x2a7c(%rip),%eax        # 203014 <rand_seed>
+  200598:	69 c0 0d 66 19 00    	imul   $0x19660d,%eax,%eax
+  20059e:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+  2005a3:	89 05 6b 2a 00 00    	mov    %eax,0x2a6b(%rip)        # 203014 <rand_seed>
+    return rand_seed & RAND_MAX;
+  2005a9:	8b 05 65 2a 00 00    	mov    0x2a65(%rip),%eax        # 203014 <rand_seed>
+  2005af:	25 ff ff ff 7f       	and    $0x7fffffff,%eax
+}
+  2005b4:	c9                   	leave
+  2005b5:	c3                   	ret
+
+00000000002005b6 <srand>:
+
+void srand(unsigned seed) {
+  2005b6:	55                   	push   %rbp
+  2005b7:	48 89 e5             	mov    %rsp,%rbp
+  2005ba:	48 83 ec 08          	sub    $0x8,%rsp
+  2005be:	89 7d fc             	mov    %edi,-0x4(%rbp)
+    rand_seed      = seed;
+  2005c1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  2005c4:	89 05 4a 2a 00 00    	mov    %eax,0x2a4a(%rip)        # 203014 <rand_seed>
+    rand_seed_set  = 1;
+  2005ca:	c7 05 3c 2a 00 00 01 	movl   $0x1,0x2a3c(%rip)        # 203010 <rand_seed_set>
+  2005d1:	00 00 00 
+}
+  2005d4:	90                   	nop
+  2005d5:	c9                   	leave
+  2005d6:	c3                   	ret
+
+00000000002005d7 <fill_numbuf>:
+//    Print a message onto the console, starting at the given cursor position.
+
+// snprintf, vsnprintf
+//    Format a string into a buffer.
+
+static char* fill_numbuf(char* numbuf_end, unsigned long val, int base) {
+  2005d7:	55                   	push   %rbp
+  2005d8:	48 89 e5             	mov    %rsp,%rbp
+  2005db:	48 83 ec 28          	sub    $0x28,%rsp
+  2005df:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  2005e3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  2005e7:	89 55 dc             	mov    %edx,-0x24(%rbp)
+    static const char upper_digits[] = "0123456789ABCDEF";
+    static const char lower_digits[] = "0123456789abcdef";
+
+    const char* digits = upper_digits;
+  2005ea:	48 8d 05 4f 1c 00 00 	lea    0x1c4f(%rip),%rax        # 202240 <upper_digits.1>
+  2005f1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (base < 0) {
+  2005f5:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  2005f9:	79 0e                	jns    200609 <fill_numbuf+0x32>
+        digits = lower_digits;
+  2005fb:	48 8d 05 5e 1c 00 00 	lea    0x1c5e(%rip),%rax        # 202260 <lower_digits.0>
+  200602:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+        base = -base;
+  200606:	f7 5d dc             	negl   -0x24(%rbp)
+    }
+
+    *--numbuf_end = '\0';
+  200609:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  20060e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  200612:	c6 00 00             	movb   $0x0,(%rax)
+    do {
+        *--numbuf_end = digits[val % base];
+  200615:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  200618:	48 63 c8             	movslq %eax,%rcx
+  20061b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  20061f:	ba 00 00 00 00       	mov    $0x0,%edx
+  200624:	48 f7 f1             	div    %rcx
+  200627:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20062b:	48 01 d0             	add    %rdx,%rax
+  20062e:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  200633:	0f b6 10             	movzbl (%rax),%edx
+  200636:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20063a:	88 10                	mov    %dl,(%rax)
+        val /= base;
+  20063c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  20063f:	48 63 f0             	movslq %eax,%rsi
+  200642:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  200646:	ba 00 00 00 00       	mov    $0x0,%edx
+  20064b:	48 f7 f6             	div    %rsi
+  20064e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    } while (val != 0);
+  200652:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  200657:	75 bc                	jne    200615 <fill_numbuf+0x3e>
+    return numbuf_end;
+  200659:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  20065d:	c9                   	leave
+  20065e:	c3                   	ret
+
+000000000020065f <printer_vprintf>:
+#define FLAG_NUMERIC            (1<<5)
+#define FLAG_SIGNED             (1<<6)
+#define FLAG_NEGATIVE           (1<<7)
+#define FLAG_ALT2               (1<<8)
+
+void printer_vprintf(printer* p, int color, const char* format, va_list val) {
+  20065f:	55                   	push   %rbp
+  200660:	48 89 e5             	mov    %rsp,%rbp
+  200663:	53                   	push   %rbx
+  200664:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  20066b:	48 89 bd 78 ff ff ff 	mov    %rdi,-0x88(%rbp)
+  200672:	89 b5 74 ff ff ff    	mov    %esi,-0x8c(%rbp)
+  200678:	48 89 95 68 ff ff ff 	mov    %rdx,-0x98(%rbp)
+  20067f:	48 89 8d 60 ff ff ff 	mov    %rcx,-0xa0(%rbp)
+#define NUMBUFSIZ 24
+    char numbuf[NUMBUFSIZ];
+
+    for (; *format; ++format) {
+  200686:	e9 be 09 00 00       	jmp    201049 <printer_vprintf+0x9ea>
+        if (*format != '%') {
+  20068b:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200692:	0f b6 00             	movzbl (%rax),%eax
+  200695:	3c 25                	cmp    $0x25,%al
+  200697:	74 31                	je     2006ca <printer_vprintf+0x6b>
+            p->putc(p, *format, color);
+  200699:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  2006a0:	4c 8b 00             	mov    (%rax),%r8
+  2006a3:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  2006aa:	0f b6 00             	movzbl (%rax),%eax
+  2006ad:	0f b6 c8             	movzbl %al,%ecx
+  2006b0:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  2006b6:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  2006bd:	89 ce                	mov    %ecx,%esi
+  2006bf:	48 89 c7             	mov    %rax,%rdi
+  2006c2:	41 ff d0             	call   *%r8
+            continue;
+  2006c5:	e9 77 09 00 00       	jmp    201041 <printer_vprintf+0x9e2>
+        }
+
+        // process flags
+        int flags = 0;
+  2006ca:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+        for (++format; *format; ++format) {
+  2006d1:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  2006d8:	01 
+  2006d9:	eb 4f                	jmp    20072a <printer_vprintf+0xcb>
+            const char* flagc = strchr(flag_chars, *format);
+  2006db:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  2006e2:	0f b6 00             	movzbl (%rax),%eax
+  2006e5:	0f be c0             	movsbl %al,%eax
+  2006e8:	89 c6                	mov    %eax,%esi
+  2006ea:	48 8d 05 ff 19 00 00 	lea    0x19ff(%rip),%rax        # 2020f0 <flag_chars>
+  2006f1:	48 89 c7             	mov    %rax,%rdi
+  2006f4:	e8 11 fe ff ff       	call   20050a <strchr>
+  2006f9:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (flagc) {
+  2006fd:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  200702:	74 36                	je     20073a <printer_vprintf+0xdb>
+                flags |= 1 << (flagc - flag_chars);
+  200704:	48 8d 05 e5 19 00 00 	lea    0x19e5(%rip),%rax        # 2020f0 <flag_chars>
+  20070b:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  20070f:	48 29 c2             	sub    %rax,%rdx
+  200712:	89 d0                	mov    %edx,%eax
+  200714:	ba 01 00 00 00       	mov    $0x1,%edx
+  200719:	89 c1                	mov    %eax,%ecx
+  20071b:	d3 e2                	shl    %cl,%edx
+  20071d:	89 d0                	mov    %edx,%eax
+  20071f:	09 45 ec             	or     %eax,-0x14(%rbp)
+        for (++format; *format; ++format) {
+  200722:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  200729:	01 
+  20072a:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200731:	0f b6 00             	movzbl (%rax),%eax
+  200734:	84 c0                	test   %al,%al
+  200736:	75 a3                	jne    2006db <printer_vprintf+0x7c>
+  200738:	eb 01                	jmp    20073b <printer_vprintf+0xdc>
+            } else {
+                break;
+  20073a:	90                   	nop
+            }
+        }
+
+        // process width
+        int width = -1;
+  20073b:	c7 45 e8 ff ff ff ff 	movl   $0xffffffff,-0x18(%rbp)
+        if (*format >= '1' && *format <= '9') {
+  200742:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200749:	0f b6 00             	movzbl (%rax),%eax
+  20074c:	3c 30                	cmp    $0x30,%al
+  20074e:	7e 67                	jle    2007b7 <printer_vprintf+0x158>
+  200750:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200757:	0f b6 00             	movzbl (%rax),%eax
+  20075a:	3c 39                	cmp    $0x39,%al
+  20075c:	7f 59                	jg     2007b7 <printer_vprintf+0x158>
+            for (width = 0; *format >= '0' && *format <= '9'; ) {
+  20075e:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%rbp)
+  200765:	eb 2e                	jmp    200795 <printer_vprintf+0x136>
+                width = 10 * width + *format++ - '0';
+  200767:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  20076a:	89 d0                	mov    %edx,%eax
+  20076c:	c1 e0 02             	shl    $0x2,%eax
+  20076f:	01 d0                	add    %edx,%eax
+  200771:	01 c0                	add    %eax,%eax
+  200773:	89 c1                	mov    %eax,%ecx
+  200775:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  20077c:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  200780:	48 89 95 68 ff ff ff 	mov    %rdx,-0x98(%rbp)
+  200787:	0f b6 00             	movzbl (%rax),%eax
+  20078a:	0f be c0             	movsbl %al,%eax
+  20078d:	01 c8                	add    %ecx,%eax
+  20078f:	83 e8 30             	sub    $0x30,%eax
+  200792:	89 45 e8             	mov    %eax,-0x18(%rbp)
+            for (width = 0; *format >= '0' && *format <= '9'; ) {
+  200795:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  20079c:	0f b6 00             	movzbl (%rax),%eax
+  20079f:	3c 2f                	cmp    $0x2f,%al
+  2007a1:	0f 8e 85 00 00 00    	jle    20082c <printer_vprintf+0x1cd>
+  2007a7:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  2007ae:	0f b6 00             	movzbl (%rax),%eax
+  2007b1:	3c 39                	cmp    $0x39,%al
+  2007b3:	7e b2                	jle    200767 <printer_vprintf+0x108>
+        if (*format >= '1' && *format <= '9') {
+  2007b5:	eb 75                	jmp    20082c <printer_vprintf+0x1cd>
+            }
+        } else if (*format == '*') {
+  2007b7:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  2007be:	0f b6 00             	movzbl (%rax),%eax
+  2007c1:	3c 2a                	cmp    $0x2a,%al
+  2007c3:	75 68                	jne    20082d <printer_vprintf+0x1ce>
+            width = va_arg(val, int);
+  2007c5:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2007cc:	8b 00                	mov    (%rax),%eax
+  2007ce:	83 f8 2f             	cmp    $0x2f,%eax
+  2007d1:	77 30                	ja     200803 <printer_vprintf+0x1a4>
+  2007d3:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2007da:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  2007de:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2007e5:	8b 00                	mov    (%rax),%eax
+  2007e7:	89 c0                	mov    %eax,%eax
+  2007e9:	48 01 d0             	add    %rdx,%rax
+  2007ec:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  2007f3:	8b 12                	mov    (%rdx),%edx
+  2007f5:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  2007f8:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  2007ff:	89 0a                	mov    %ecx,(%rdx)
+  200801:	eb 1a                	jmp    20081d <printer_vprintf+0x1be>
+  200803:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  20080a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  20080e:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200812:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200819:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  20081d:	8b 00                	mov    (%rax),%eax
+  20081f:	89 45 e8             	mov    %eax,-0x18(%rbp)
+            ++format;
+  200822:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  200829:	01 
+  20082a:	eb 01                	jmp    20082d <printer_vprintf+0x1ce>
+        if (*format >= '1' && *format <= '9') {
+  20082c:	90                   	nop
+        }
+
+        // process precision
+        int precision = -1;
+  20082d:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%rbp)
+        if (*format == '.') {
+  200834:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  20083b:	0f b6 00             	movzbl (%rax),%eax
+  20083e:	3c 2e                	cmp    $0x2e,%al
+  200840:	0f 85 00 01 00 00    	jne    200946 <printer_vprintf+0x2e7>
+            ++format;
+  200846:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  20084d:	01 
+            if (*format >= '0' && *format <= '9') {
+  20084e:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200855:	0f b6 00             	movzbl (%rax),%eax
+  200858:	3c 2f                	cmp    $0x2f,%al
+  20085a:	7e 67                	jle    2008c3 <printer_vprintf+0x264>
+  20085c:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200863:	0f b6 00             	movzbl (%rax),%eax
+  200866:	3c 39                	cmp    $0x39,%al
+  200868:	7f 59                	jg     2008c3 <printer_vprintf+0x264>
+                for (precision = 0; *format >= '0' && *format <= '9'; ) {
+  20086a:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%rbp)
+  200871:	eb 2e                	jmp    2008a1 <printer_vprintf+0x242>
+                    precision = 10 * precision + *format++ - '0';
+  200873:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  200876:	89 d0                	mov    %edx,%eax
+  200878:	c1 e0 02             	shl    $0x2,%eax
+  20087b:	01 d0                	add    %edx,%eax
+  20087d:	01 c0                	add    %eax,%eax
+  20087f:	89 c1                	mov    %eax,%ecx
+  200881:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200888:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  20088c:	48 89 95 68 ff ff ff 	mov    %rdx,-0x98(%rbp)
+  200893:	0f b6 00             	movzbl (%rax),%eax
+  200896:	0f be c0             	movsbl %al,%eax
+  200899:	01 c8                	add    %ecx,%eax
+  20089b:	83 e8 30             	sub    $0x30,%eax
+  20089e:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+                for (precision = 0; *format >= '0' && *format <= '9'; ) {
+  2008a1:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  2008a8:	0f b6 00             	movzbl (%rax),%eax
+  2008ab:	3c 2f                	cmp    $0x2f,%al
+  2008ad:	0f 8e 85 00 00 00    	jle    200938 <printer_vprintf+0x2d9>
+  2008b3:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  2008ba:	0f b6 00             	movzbl (%rax),%eax
+  2008bd:	3c 39                	cmp    $0x39,%al
+  2008bf:	7e b2                	jle    200873 <printer_vprintf+0x214>
+            if (*format >= '0' && *format <= '9') {
+  2008c1:	eb 75                	jmp    200938 <printer_vprintf+0x2d9>
+                }
+            } else if (*format == '*') {
+  2008c3:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  2008ca:	0f b6 00             	movzbl (%rax),%eax
+  2008cd:	3c 2a                	cmp    $0x2a,%al
+  2008cf:	75 68                	jne    200939 <printer_vprintf+0x2da>
+                precision = va_arg(val, int);
+  2008d1:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2008d8:	8b 00                	mov    (%rax),%eax
+  2008da:	83 f8 2f             	cmp    $0x2f,%eax
+  2008dd:	77 30                	ja     20090f <printer_vprintf+0x2b0>
+  2008df:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2008e6:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  2008ea:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2008f1:	8b 00                	mov    (%rax),%eax
+  2008f3:	89 c0                	mov    %eax,%eax
+  2008f5:	48 01 d0             	add    %rdx,%rax
+  2008f8:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  2008ff:	8b 12                	mov    (%rdx),%edx
+  200901:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200904:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  20090b:	89 0a                	mov    %ecx,(%rdx)
+  20090d:	eb 1a                	jmp    200929 <printer_vprintf+0x2ca>
+  20090f:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200916:	48 8b 40 08          	mov    0x8(%rax),%rax
+  20091a:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  20091e:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200925:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200929:	8b 00                	mov    (%rax),%eax
+  20092b:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+                ++format;
+  20092e:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  200935:	01 
+  200936:	eb 01                	jmp    200939 <printer_vprintf+0x2da>
+            if (*format >= '0' && *format <= '9') {
+  200938:	90                   	nop
+            }
+            if (precision < 0) {
+  200939:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  20093d:	79 07                	jns    200946 <printer_vprintf+0x2e7>
+                precision = 0;
+  20093f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%rbp)
+            }
+        }
+
+        // process main conversion character
+        int base = 10;
+  200946:	c7 45 e0 0a 00 00 00 	movl   $0xa,-0x20(%rbp)
+        unsigned long num = 0;
+  20094d:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  200954:	00 
+        int length = 0;
+  200955:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+        char* data = "";
+  20095c:	48 8d 05 93 17 00 00 	lea    0x1793(%rip),%rax        # 2020f6 <flag_chars+0x6>
+  200963:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    again:
+        switch (*format) {
+  200967:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  20096e:	0f b6 00             	movzbl (%rax),%eax
+  200971:	0f be c0             	movsbl %al,%eax
+  200974:	83 e8 43             	sub    $0x43,%eax
+  200977:	83 f8 37             	cmp    $0x37,%eax
+  20097a:	0f 87 b5 03 00 00    	ja     200d35 <printer_vprintf+0x6d6>
+  200980:	89 c0                	mov    %eax,%eax
+  200982:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  200989:	00 
+  20098a:	48 8d 05 73 17 00 00 	lea    0x1773(%rip),%rax        # 202104 <flag_chars+0x14>
+  200991:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+  200994:	48 98                	cltq
+  200996:	48 8d 15 67 17 00 00 	lea    0x1767(%rip),%rdx        # 202104 <flag_chars+0x14>
+  20099d:	48 01 d0             	add    %rdx,%rax
+  2009a0:	ff e0                	jmp    *%rax
+        case 'l':
+        case 'z':
+            length = 1;
+  2009a2:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+            ++format;
+  2009a9:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  2009b0:	01 
+            goto again;
+  2009b1:	eb b4                	jmp    200967 <printer_vprintf+0x308>
+        case 'd':
+        case 'i': {
+            long x = length ? va_arg(val, long) : va_arg(val, int);
+  2009b3:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  2009b7:	74 5d                	je     200a16 <printer_vprintf+0x3b7>
+  2009b9:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2009c0:	8b 00                	mov    (%rax),%eax
+  2009c2:	83 f8 2f             	cmp    $0x2f,%eax
+  2009c5:	77 30                	ja     2009f7 <printer_vprintf+0x398>
+  2009c7:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2009ce:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  2009d2:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2009d9:	8b 00                	mov    (%rax),%eax
+  2009db:	89 c0                	mov    %eax,%eax
+  2009dd:	48 01 d0             	add    %rdx,%rax
+  2009e0:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  2009e7:	8b 12                	mov    (%rdx),%edx
+  2009e9:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  2009ec:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  2009f3:	89 0a                	mov    %ecx,(%rdx)
+  2009f5:	eb 1a                	jmp    200a11 <printer_vprintf+0x3b2>
+  2009f7:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2009fe:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200a02:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200a06:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200a0d:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200a11:	48 8b 00             	mov    (%rax),%rax
+  200a14:	eb 5c                	jmp    200a72 <printer_vprintf+0x413>
+  200a16:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200a1d:	8b 00                	mov    (%rax),%eax
+  200a1f:	83 f8 2f             	cmp    $0x2f,%eax
+  200a22:	77 30                	ja     200a54 <printer_vprintf+0x3f5>
+  200a24:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200a2b:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200a2f:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200a36:	8b 00                	mov    (%rax),%eax
+  200a38:	89 c0                	mov    %eax,%eax
+  200a3a:	48 01 d0             	add    %rdx,%rax
+  200a3d:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200a44:	8b 12                	mov    (%rdx),%edx
+  200a46:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200a49:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200a50:	89 0a                	mov    %ecx,(%rdx)
+  200a52:	eb 1a                	jmp    200a6e <printer_vprintf+0x40f>
+  200a54:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200a5b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200a5f:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200a63:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200a6a:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200a6e:	8b 00                	mov    (%rax),%eax
+  200a70:	48 98                	cltq
+  200a72:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+            int negative = x < 0 ? FLAG_NEGATIVE : 0;
+  200a76:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  200a7a:	48 c1 f8 38          	sar    $0x38,%rax
+  200a7e:	25 80 00 00 00       	and    $0x80,%eax
+  200a83:	89 45 a4             	mov    %eax,-0x5c(%rbp)
+            num = negative ? -x : x;
+  200a86:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  200a8a:	74 09                	je     200a95 <printer_vprintf+0x436>
+  200a8c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  200a90:	48 f7 d8             	neg    %rax
+  200a93:	eb 04                	jmp    200a99 <printer_vprintf+0x43a>
+  200a95:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  200a99:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+            flags |= FLAG_NUMERIC | FLAG_SIGNED | negative;
+  200a9d:	8b 45 a4             	mov    -0x5c(%rbp),%eax
+  200aa0:	83 c8 60             	or     $0x60,%eax
+  200aa3:	09 45 ec             	or     %eax,-0x14(%rbp)
+            break;
+  200aa6:	e9 cf 02 00 00       	jmp    200d7a <printer_vprintf+0x71b>
+        }
+        case 'u':
+        format_unsigned:
+            num = length ? va_arg(val, unsigned long) : va_arg(val, unsigned);
+  200aab:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  200aaf:	74 5d                	je     200b0e <printer_vprintf+0x4af>
+  200ab1:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200ab8:	8b 00                	mov    (%rax),%eax
+  200aba:	83 f8 2f             	cmp    $0x2f,%eax
+  200abd:	77 30                	ja     200aef <printer_vprintf+0x490>
+  200abf:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200ac6:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200aca:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200ad1:	8b 00                	mov    (%rax),%eax
+  200ad3:	89 c0                	mov    %eax,%eax
+  200ad5:	48 01 d0             	add    %rdx,%rax
+  200ad8:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200adf:	8b 12                	mov    (%rdx),%edx
+  200ae1:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200ae4:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200aeb:	89 0a                	mov    %ecx,(%rdx)
+  200aed:	eb 1a                	jmp    200b09 <printer_vprintf+0x4aa>
+  200aef:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200af6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200afa:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200afe:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200b05:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200b09:	48 8b 00             	mov    (%rax),%rax
+  200b0c:	eb 5c                	jmp    200b6a <printer_vprintf+0x50b>
+  200b0e:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200b15:	8b 00                	mov    (%rax),%eax
+  200b17:	83 f8 2f             	cmp    $0x2f,%eax
+  200b1a:	77 30                	ja     200b4c <printer_vprintf+0x4ed>
+  200b1c:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200b23:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200b27:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200b2e:	8b 00                	mov    (%rax),%eax
+  200b30:	89 c0                	mov    %eax,%eax
+  200b32:	48 01 d0             	add    %rdx,%rax
+  200b35:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200b3c:	8b 12                	mov    (%rdx),%edx
+  200b3e:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200b41:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200b48:	89 0a                	mov    %ecx,(%rdx)
+  200b4a:	eb 1a                	jmp    200b66 <printer_vprintf+0x507>
+  200b4c:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200b53:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200b57:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200b5b:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200b62:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200b66:	8b 00                	mov    (%rax),%eax
+  200b68:	89 c0                	mov    %eax,%eax
+  200b6a:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+            flags |= FLAG_NUMERIC;
+  200b6e:	83 4d ec 20          	orl    $0x20,-0x14(%rbp)
+            break;
+  200b72:	e9 03 02 00 00       	jmp    200d7a <printer_vprintf+0x71b>
+        case 'x':
+            base = -16;
+  200b77:	c7 45 e0 f0 ff ff ff 	movl   $0xfffffff0,-0x20(%rbp)
+            goto format_unsigned;
+  200b7e:	e9 28 ff ff ff       	jmp    200aab <printer_vprintf+0x44c>
+        case 'X':
+            base = 16;
+  200b83:	c7 45 e0 10 00 00 00 	movl   $0x10,-0x20(%rbp)
+            goto format_unsigned;
+  200b8a:	e9 1c ff ff ff       	jmp    200aab <printer_vprintf+0x44c>
+        case 'p':
+            num = (uintptr_t) va_arg(val, void*);
+  200b8f:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200b96:	8b 00                	mov    (%rax),%eax
+  200b98:	83 f8 2f             	cmp    $0x2f,%eax
+  200b9b:	77 30                	ja     200bcd <printer_vprintf+0x56e>
+  200b9d:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200ba4:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200ba8:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200baf:	8b 00                	mov    (%rax),%eax
+  200bb1:	89 c0                	mov    %eax,%eax
+  200bb3:	48 01 d0             	add    %rdx,%rax
+  200bb6:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200bbd:	8b 12                	mov    (%rdx),%edx
+  200bbf:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200bc2:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200bc9:	89 0a                	mov    %ecx,(%rdx)
+  200bcb:	eb 1a                	jmp    200be7 <printer_vprintf+0x588>
+  200bcd:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200bd4:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200bd8:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200bdc:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200be3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200be7:	48 8b 00             	mov    (%rax),%rax
+  200bea:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+            base = -16;
+  200bee:	c7 45 e0 f0 ff ff ff 	movl   $0xfffffff0,-0x20(%rbp)
+            flags |= FLAG_ALT | FLAG_ALT2 | FLAG_NUMERIC;
+  200bf5:	81 4d ec 21 01 00 00 	orl    $0x121,-0x14(%rbp)
+            break;
+  200bfc:	e9 79 01 00 00       	jmp    200d7a <printer_vprintf+0x71b>
+        case 's':
+            data = va_arg(val, char*);
+  200c01:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c08:	8b 00                	mov    (%rax),%eax
+  200c0a:	83 f8 2f             	cmp    $0x2f,%eax
+  200c0d:	77 30                	ja     200c3f <printer_vprintf+0x5e0>
+  200c0f:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c16:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200c1a:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c21:	8b 00                	mov    (%rax),%eax
+  200c23:	89 c0                	mov    %eax,%eax
+  200c25:	48 01 d0             	add    %rdx,%rax
+  200c28:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200c2f:	8b 12                	mov    (%rdx),%edx
+  200c31:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200c34:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200c3b:	89 0a                	mov    %ecx,(%rdx)
+  200c3d:	eb 1a                	jmp    200c59 <printer_vprintf+0x5fa>
+  200c3f:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c46:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200c4a:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200c4e:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200c55:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200c59:	48 8b 00             	mov    (%rax),%rax
+  200c5c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+            break;
+  200c60:	e9 15 01 00 00       	jmp    200d7a <printer_vprintf+0x71b>
+        case 'C':
+            color = va_arg(val, int);
+  200c65:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c6c:	8b 00                	mov    (%rax),%eax
+  200c6e:	83 f8 2f             	cmp    $0x2f,%eax
+  200c71:	77 30                	ja     200ca3 <printer_vprintf+0x644>
+  200c73:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c7a:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200c7e:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c85:	8b 00                	mov    (%rax),%eax
+  200c87:	89 c0                	mov    %eax,%eax
+  200c89:	48 01 d0             	add    %rdx,%rax
+  200c8c:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200c93:	8b 12                	mov    (%rdx),%edx
+  200c95:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200c98:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200c9f:	89 0a                	mov    %ecx,(%rdx)
+  200ca1:	eb 1a                	jmp    200cbd <printer_vprintf+0x65e>
+  200ca3:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200caa:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200cae:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200cb2:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200cb9:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200cbd:	8b 00                	mov    (%rax),%eax
+  200cbf:	89 85 74 ff ff ff    	mov    %eax,-0x8c(%rbp)
+            goto done;
+  200cc5:	e9 77 03 00 00       	jmp    201041 <printer_vprintf+0x9e2>
+        case 'c':
+            data = numbuf;
+  200cca:	48 8d 45 8c          	lea    -0x74(%rbp),%rax
+  200cce:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+            numbuf[0] = va_arg(val, int);
+  200cd2:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200cd9:	8b 00                	mov    (%rax),%eax
+  200cdb:	83 f8 2f             	cmp    $0x2f,%eax
+  200cde:	77 30                	ja     200d10 <printer_vprintf+0x6b1>
+  200ce0:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200ce7:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200ceb:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200cf2:	8b 00                	mov    (%rax),%eax
+  200cf4:	89 c0                	mov    %eax,%eax
+  200cf6:	48 01 d0             	add    %rdx,%rax
+  200cf9:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200d00:	8b 12                	mov    (%rdx),%edx
+  200d02:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200d05:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200d0c:	89 0a                	mov    %ecx,(%rdx)
+  200d0e:	eb 1a                	jmp    200d2a <printer_vprintf+0x6cb>
+  200d10:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200d17:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200d1b:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200d1f:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200d26:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200d2a:	8b 00                	mov    (%rax),%eax
+  200d2c:	88 45 8c             	mov    %al,-0x74(%rbp)
+            numbuf[1] = '\0';
+  200d2f:	c6 45 8d 00          	movb   $0x0,-0x73(%rbp)
+            break;
+  200d33:	eb 45                	jmp    200d7a <printer_vprintf+0x71b>
+        default:
+            data = numbuf;
+  200d35:	48 8d 45 8c          	lea    -0x74(%rbp),%rax
+  200d39:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+            numbuf[0] = (*format ? *format : '%');
+  200d3d:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200d44:	0f b6 00             	movzbl (%rax),%eax
+  200d47:	84 c0                	test   %al,%al
+  200d49:	74 0c                	je     200d57 <printer_vprintf+0x6f8>
+  200d4b:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200d52:	0f b6 00             	movzbl (%rax),%eax
+  200d55:	eb 05                	jmp    200d5c <printer_vprintf+0x6fd>
+  200d57:	b8 25 00 00 00       	mov    $0x25,%eax
+  200d5c:	88 45 8c             	mov    %al,-0x74(%rbp)
+            numbuf[1] = '\0';
+  200d5f:	c6 45 8d 00          	movb   $0x0,-0x73(%rbp)
+            if (!*format) {
+  200d63:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200d6a:	0f b6 00             	movzbl (%rax),%eax
+  200d6d:	84 c0                	test   %al,%al
+  200d6f:	75 08                	jne    200d79 <printer_vprintf+0x71a>
+                format--;
+  200d71:	48 83 ad 68 ff ff ff 	subq   $0x1,-0x98(%rbp)
+  200d78:	01 
+            }
+            break;
+  200d79:	90                   	nop
+        }
+
+        if (flags & FLAG_NUMERIC) {
+  200d7a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200d7d:	83 e0 20             	and    $0x20,%eax
+  200d80:	85 c0                	test   %eax,%eax
+  200d82:	74 1e                	je     200da2 <printer_vprintf+0x743>
+            data = fill_numbuf(numbuf + NUMBUFSIZ, num, base);
+  200d84:	48 8d 45 8c          	lea    -0x74(%rbp),%rax
+  200d88:	48 83 c0 18          	add    $0x18,%rax
+  200d8c:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  200d8f:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  200d93:	48 89 ce             	mov    %rcx,%rsi
+  200d96:	48 89 c7             	mov    %rax,%rdi
+  200d99:	e8 39 f8 ff ff       	call   2005d7 <fill_numbuf>
+  200d9e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        }
+
+        const char* prefix = "";
+  200da2:	48 8d 05 4d 13 00 00 	lea    0x134d(%rip),%rax        # 2020f6 <flag_chars+0x6>
+  200da9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((flags & FLAG_NUMERIC) && (flags & FLAG_SIGNED)) {
+  200dad:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200db0:	83 e0 20             	and    $0x20,%eax
+  200db3:	85 c0                	test   %eax,%eax
+  200db5:	74 51                	je     200e08 <printer_vprintf+0x7a9>
+  200db7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200dba:	83 e0 40             	and    $0x40,%eax
+  200dbd:	85 c0                	test   %eax,%eax
+  200dbf:	74 47                	je     200e08 <printer_vprintf+0x7a9>
+            if (flags & FLAG_NEGATIVE) {
+  200dc1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200dc4:	25 80 00 00 00       	and    $0x80,%eax
+  200dc9:	85 c0                	test   %eax,%eax
+  200dcb:	74 0d                	je     200dda <printer_vprintf+0x77b>
+                prefix = "-";
+  200dcd:	48 8d 05 23 13 00 00 	lea    0x1323(%rip),%rax        # 2020f7 <flag_chars+0x7>
+  200dd4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            if (flags & FLAG_NEGATIVE) {
+  200dd8:	eb 7d                	jmp    200e57 <printer_vprintf+0x7f8>
+            } else if (flags & FLAG_PLUSPOSITIVE) {
+  200dda:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200ddd:	83 e0 10             	and    $0x10,%eax
+  200de0:	85 c0                	test   %eax,%eax
+  200de2:	74 0d                	je     200df1 <printer_vprintf+0x792>
+                prefix = "+";
+  200de4:	48 8d 05 0e 13 00 00 	lea    0x130e(%rip),%rax        # 2020f9 <flag_chars+0x9>
+  200deb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            if (flags & FLAG_NEGATIVE) {
+  200def:	eb 66                	jmp    200e57 <printer_vprintf+0x7f8>
+            } else if (flags & FLAG_SPACEPOSITIVE) {
+  200df1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200df4:	83 e0 08             	and    $0x8,%eax
+  200df7:	85 c0                	test   %eax,%eax
+  200df9:	74 5c                	je     200e57 <printer_vprintf+0x7f8>
+                prefix = " ";
+  200dfb:	48 8d 05 f9 12 00 00 	lea    0x12f9(%rip),%rax        # 2020fb <flag_chars+0xb>
+  200e02:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            if (flags & FLAG_NEGATIVE) {
+  200e06:	eb 4f                	jmp    200e57 <printer_vprintf+0x7f8>
+            }
+        } else if ((flags & FLAG_NUMERIC) && (flags & FLAG_ALT)
+  200e08:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200e0b:	83 e0 20             	and    $0x20,%eax
+  200e0e:	85 c0                	test   %eax,%eax
+  200e10:	74 46                	je     200e58 <printer_vprintf+0x7f9>
+  200e12:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200e15:	83 e0 01             	and    $0x1,%eax
+  200e18:	85 c0                	test   %eax,%eax
+  200e1a:	74 3c                	je     200e58 <printer_vprintf+0x7f9>
+                   && (base == 16 || base == -16)
+  200e1c:	83 7d e0 10          	cmpl   $0x10,-0x20(%rbp)
+  200e20:	74 06                	je     200e28 <printer_vprintf+0x7c9>
+  200e22:	83 7d e0 f0          	cmpl   $0xfffffff0,-0x20(%rbp)
+  200e26:	75 30                	jne    200e58 <printer_vprintf+0x7f9>
+                   && (num || (flags & FLAG_ALT2))) {
+  200e28:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  200e2d:	75 0c                	jne    200e3b <printer_vprintf+0x7dc>
+  200e2f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200e32:	25 00 01 00 00       	and    $0x100,%eax
+  200e37:	85 c0                	test   %eax,%eax
+  200e39:	74 1d                	je     200e58 <printer_vprintf+0x7f9>
+            prefix = (base == -16 ? "0x" : "0X");
+  200e3b:	83 7d e0 f0          	cmpl   $0xfffffff0,-0x20(%rbp)
+  200e3f:	75 09                	jne    200e4a <printer_vprintf+0x7eb>
+  200e41:	48 8d 05 b5 12 00 00 	lea    0x12b5(%rip),%rax        # 2020fd <flag_chars+0xd>
+  200e48:	eb 07                	jmp    200e51 <printer_vprintf+0x7f2>
+  200e4a:	48 8d 05 af 12 00 00 	lea    0x12af(%rip),%rax        # 202100 <flag_chars+0x10>
+  200e51:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  200e55:	eb 01                	jmp    200e58 <printer_vprintf+0x7f9>
+            if (flags & FLAG_NEGATIVE) {
+  200e57:	90                   	nop
+        }
+
+        int len;
+        if (precision >= 0 && !(flags & FLAG_NUMERIC)) {
+  200e58:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  200e5c:	78 24                	js     200e82 <printer_vprintf+0x823>
+  200e5e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200e61:	83 e0 20             	and    $0x20,%eax
+  200e64:	85 c0                	test   %eax,%eax
+  200e66:	75 1a                	jne    200e82 <printer_vprintf+0x823>
+            len = strnlen(data, precision);
+  200e68:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  200e6b:	48 63 d0             	movslq %eax,%rdx
+  200e6e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200e72:	48 89 d6             	mov    %rdx,%rsi
+  200e75:	48 89 c7             	mov    %rax,%rdi
+  200e78:	e8 8a f5 ff ff       	call   200407 <strnlen>
+  200e7d:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  200e80:	eb 0f                	jmp    200e91 <printer_vprintf+0x832>
+        } else {
+            len = strlen(data);
+  200e82:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200e86:	48 89 c7             	mov    %rax,%rdi
+  200e89:	e8 48 f5 ff ff       	call   2003d6 <strlen>
+  200e8e:	89 45 bc             	mov    %eax,-0x44(%rbp)
+        }
+        int zeros;
+        if ((flags & FLAG_NUMERIC) && precision >= 0) {
+  200e91:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200e94:	83 e0 20             	and    $0x20,%eax
+  200e97:	85 c0                	test   %eax,%eax
+  200e99:	74 20                	je     200ebb <printer_vprintf+0x85c>
+  200e9b:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  200e9f:	78 1a                	js     200ebb <printer_vprintf+0x85c>
+            zeros = precision > len ? precision - len : 0;
+  200ea1:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  200ea4:	3b 45 bc             	cmp    -0x44(%rbp),%eax
+  200ea7:	7e 08                	jle    200eb1 <printer_vprintf+0x852>
+  200ea9:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  200eac:	2b 45 bc             	sub    -0x44(%rbp),%eax
+  200eaf:	eb 05                	jmp    200eb6 <printer_vprintf+0x857>
+  200eb1:	b8 00 00 00 00       	mov    $0x0,%eax
+  200eb6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  200eb9:	eb 5c                	jmp    200f17 <printer_vprintf+0x8b8>
+        } else if ((flags & FLAG_NUMERIC) && (flags & FLAG_ZERO)
+  200ebb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200ebe:	83 e0 20             	and    $0x20,%eax
+  200ec1:	85 c0                	test   %eax,%eax
+  200ec3:	74 4b                	je     200f10 <printer_vprintf+0x8b1>
+  200ec5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200ec8:	83 e0 02             	and    $0x2,%eax
+  200ecb:	85 c0                	test   %eax,%eax
+  200ecd:	74 41                	je     200f10 <printer_vprintf+0x8b1>
+                   && !(flags & FLAG_LEFTJUSTIFY)
+  200ecf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200ed2:	83 e0 04             	and    $0x4,%eax
+  200ed5:	85 c0                	test   %eax,%eax
+  200ed7:	75 37                	jne    200f10 <printer_vprintf+0x8b1>
+                   && len + (int) strlen(prefix) < width) {
+  200ed9:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  200edd:	48 89 c7             	mov    %rax,%rdi
+  200ee0:	e8 f1 f4 ff ff       	call   2003d6 <strlen>
+  200ee5:	89 c2                	mov    %eax,%edx
+  200ee7:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  200eea:	01 d0                	add    %edx,%eax
+  200eec:	39 45 e8             	cmp    %eax,-0x18(%rbp)
+  200eef:	7e 1f                	jle    200f10 <printer_vprintf+0x8b1>
+            zeros = width - len - strlen(prefix);
+  200ef1:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  200ef4:	2b 45 bc             	sub    -0x44(%rbp),%eax
+  200ef7:	89 c3                	mov    %eax,%ebx
+  200ef9:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  200efd:	48 89 c7             	mov    %rax,%rdi
+  200f00:	e8 d1 f4 ff ff       	call   2003d6 <strlen>
+  200f05:	89 c2                	mov    %eax,%edx
+  200f07:	89 d8                	mov    %ebx,%eax
+  200f09:	29 d0                	sub    %edx,%eax
+  200f0b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  200f0e:	eb 07                	jmp    200f17 <printer_vprintf+0x8b8>
+        } else {
+            zeros = 0;
+  200f10:	c7 45 b8 00 00 00 00 	movl   $0x0,-0x48(%rbp)
+        }
+        width -= len + zeros + strlen(prefix);
+  200f17:	8b 55 bc             	mov    -0x44(%rbp),%edx
+  200f1a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  200f1d:	01 d0                	add    %edx,%eax
+  200f1f:	48 63 d8             	movslq %eax,%rbx
+  200f22:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  200f26:	48 89 c7             	mov    %rax,%rdi
+  200f29:	e8 a8 f4 ff ff       	call   2003d6 <strlen>
+  200f2e:	48 8d 14 03          	lea    (%rbx,%rax,1),%rdx
+  200f32:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  200f35:	29 d0                	sub    %edx,%eax
+  200f37:	89 45 e8             	mov    %eax,-0x18(%rbp)
+        for (; !(flags & FLAG_LEFTJUSTIFY) && width > 0; --width) {
+  200f3a:	eb 25                	jmp    200f61 <printer_vprintf+0x902>
+            p->putc(p, ' ', color);
+  200f3c:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200f43:	48 8b 08             	mov    (%rax),%rcx
+  200f46:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  200f4c:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200f53:	be 20 00 00 00       	mov    $0x20,%esi
+  200f58:	48 89 c7             	mov    %rax,%rdi
+  200f5b:	ff d1                	call   *%rcx
+        for (; !(flags & FLAG_LEFTJUSTIFY) && width > 0; --width) {
+  200f5d:	83 6d e8 01          	subl   $0x1,-0x18(%rbp)
+  200f61:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200f64:	83 e0 04             	and    $0x4,%eax
+  200f67:	85 c0                	test   %eax,%eax
+  200f69:	75 36                	jne    200fa1 <printer_vprintf+0x942>
+  200f6b:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  200f6f:	7f cb                	jg     200f3c <printer_vprintf+0x8dd>
+        }
+        for (; *prefix; ++prefix) {
+  200f71:	eb 2e                	jmp    200fa1 <printer_vprintf+0x942>
+            p->putc(p, *prefix, color);
+  200f73:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200f7a:	4c 8b 00             	mov    (%rax),%r8
+  200f7d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  200f81:	0f b6 00             	movzbl (%rax),%eax
+  200f84:	0f b6 c8             	movzbl %al,%ecx
+  200f87:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  200f8d:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200f94:	89 ce                	mov    %ecx,%esi
+  200f96:	48 89 c7             	mov    %rax,%rdi
+  200f99:	41 ff d0             	call   *%r8
+        for (; *prefix; ++prefix) {
+  200f9c:	48 83 45 c0 01       	addq   $0x1,-0x40(%rbp)
+  200fa1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  200fa5:	0f b6 00             	movzbl (%rax),%eax
+  200fa8:	84 c0                	test   %al,%al
+  200faa:	75 c7                	jne    200f73 <printer_vprintf+0x914>
+        }
+        for (; zeros > 0; --zeros) {
+  200fac:	eb 25                	jmp    200fd3 <printer_vprintf+0x974>
+            p->putc(p, '0', color);
+  200fae:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200fb5:	48 8b 08             	mov    (%rax),%rcx
+  200fb8:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  200fbe:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200fc5:	be 30 00 00 00       	mov    $0x30,%esi
+  200fca:	48 89 c7             	mov    %rax,%rdi
+  200fcd:	ff d1                	call   *%rcx
+        for (; zeros > 0; --zeros) {
+  200fcf:	83 6d b8 01          	subl   $0x1,-0x48(%rbp)
+  200fd3:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  200fd7:	7f d5                	jg     200fae <printer_vprintf+0x94f>
+        }
+        for (; len > 0; ++data, --len) {
+  200fd9:	eb 32                	jmp    20100d <printer_vprintf+0x9ae>
+            p->putc(p, *data, color);
+  200fdb:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200fe2:	4c 8b 00             	mov    (%rax),%r8
+  200fe5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200fe9:	0f b6 00             	movzbl (%rax),%eax
+  200fec:	0f b6 c8             	movzbl %al,%ecx
+  200fef:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  200ff5:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200ffc:	89 ce                	mov    %ecx,%esi
+  200ffe:	48 89 c7             	mov    %rax,%rdi
+  201001:	41 ff d0             	call   *%r8
+        for (; len > 0; ++data, --len) {
+  201004:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  201009:	83 6d bc 01          	subl   $0x1,-0x44(%rbp)
+  20100d:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+  201011:	7f c8                	jg     200fdb <printer_vprintf+0x97c>
+        }
+        for (; width > 0; --width) {
+  201013:	eb 25                	jmp    20103a <printer_vprintf+0x9db>
+            p->putc(p, ' ', color);
+  201015:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  20101c:	48 8b 08             	mov    (%rax),%rcx
+  20101f:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  201025:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  20102c:	be 20 00 00 00       	mov    $0x20,%esi
+  201031:	48 89 c7             	mov    %rax,%rdi
+  201034:	ff d1                	call   *%rcx
+        for (; width > 0; --width) {
+  201036:	83 6d e8 01          	subl   $0x1,-0x18(%rbp)
+  20103a:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  20103e:	7f d5                	jg     201015 <printer_vprintf+0x9b6>
+        }
+    done: ;
+  201040:	90                   	nop
+    for (; *format; ++format) {
+  201041:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  201048:	01 
+  201049:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  201050:	0f b6 00             	movzbl (%rax),%eax
+  201053:	84 c0                	test   %al,%al
+  201055:	0f 85 30 f6 ff ff    	jne    20068b <printer_vprintf+0x2c>
+    }
+}
+  20105b:	90                   	nop
+  20105c:	90                   	nop
+  20105d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  201061:	c9                   	leave
+  201062:	c3                   	ret
+
+0000000000201063 <console_putc>:
+typedef struct console_printer {
+    printer p;
+    uint16_t* cursor;
+} console_printer;
+
+static void console_putc(printer* p, unsigned char c, int color) {
+  201063:	55                   	push   %rbp
+  201064:	48 89 e5             	mov    %rsp,%rbp
+  201067:	48 83 ec 30          	sub    $0x30,%rsp
+  20106b:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  20106f:	89 f0                	mov    %esi,%eax
+  201071:	89 55 d0             	mov    %edx,-0x30(%rbp)
+  201074:	88 45 d4             	mov    %al,-0x2c(%rbp)
+    console_printer* cp = (console_printer*) p;
+  201077:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  20107b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    /*if (cp->cursor >= console + CONSOLE_ROWS * CONSOLE_COLUMNS) {
+        cp->cursor = console;
+    }*/
+    if (c == '\n') {
+  20107f:	80 7d d4 0a          	cmpb   $0xa,-0x2c(%rbp)
+  201083:	75 7f                	jne    201104 <console_putc+0xa1>
+        int pos = (cp->cursor - console) % CONSOLE_COLUMNS;
+  201085:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201089:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  20108d:	48 8d 05 6c 6f eb ff 	lea    -0x149094(%rip),%rax        # b8000 <console>
+  201094:	48 29 c2             	sub    %rax,%rdx
+  201097:	48 89 d0             	mov    %rdx,%rax
+  20109a:	48 d1 f8             	sar    %rax
+  20109d:	48 89 c1             	mov    %rax,%rcx
+  2010a0:	48 ba 67 66 66 66 66 	movabs $0x6666666666666667,%rdx
+  2010a7:	66 66 66 
+  2010aa:	48 89 c8             	mov    %rcx,%rax
+  2010ad:	48 f7 ea             	imul   %rdx
+  2010b0:	48 c1 fa 05          	sar    $0x5,%rdx
+  2010b4:	48 89 c8             	mov    %rcx,%rax
+  2010b7:	48 c1 f8 3f          	sar    $0x3f,%rax
+  2010bb:	48 29 c2             	sub    %rax,%rdx
+  2010be:	48 89 d0             	mov    %rdx,%rax
+  2010c1:	48 c1 e0 02          	shl    $0x2,%rax
+  2010c5:	48 01 d0             	add    %rdx,%rax
+  2010c8:	48 c1 e0 04          	shl    $0x4,%rax
+  2010cc:	48 29 c1             	sub    %rax,%rcx
+  2010cf:	48 89 ca             	mov    %rcx,%rdx
+  2010d2:	89 55 fc             	mov    %edx,-0x4(%rbp)
+        for (; pos != CONSOLE_COLUMNS; pos++) {
+  2010d5:	eb 25                	jmp    2010fc <console_putc+0x99>
+            *cp->cursor++ = ' ' | color;
+  2010d7:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  2010da:	83 c8 20             	or     $0x20,%eax
+  2010dd:	89 c6                	mov    %eax,%esi
+  2010df:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2010e3:	48 8b 40 08          	mov    0x8(%rax),%rax
+  2010e7:	48 8d 48 02          	lea    0x2(%rax),%rcx
+  2010eb:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  2010ef:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  2010f3:	89 f2                	mov    %esi,%edx
+  2010f5:	66 89 10             	mov    %dx,(%rax)
+        for (; pos != CONSOLE_COLUMNS; pos++) {
+  2010f8:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  2010fc:	83 7d fc 50          	cmpl   $0x50,-0x4(%rbp)
+  201100:	75 d5                	jne    2010d7 <console_putc+0x74>
+  201102:	eb 69                	jmp    20116d <console_putc+0x10a>
+        }
+    } else if (c == '\b') {
+  201104:	80 7d d4 08          	cmpb   $0x8,-0x2c(%rbp)
+  201108:	75 3f                	jne    201149 <console_putc+0xe6>
+        if (cp->cursor != console) {
+  20110a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20110e:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  201112:	48 8d 05 e7 6e eb ff 	lea    -0x149119(%rip),%rax        # b8000 <console>
+  201119:	48 39 c2             	cmp    %rax,%rdx
+  20111c:	74 4f                	je     20116d <console_putc+0x10a>
+            *(--cp->cursor) = ' ' | color;
+  20111e:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  201121:	83 c8 20             	or     $0x20,%eax
+  201124:	89 c1                	mov    %eax,%ecx
+  201126:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20112a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  20112e:	48 8d 50 fe          	lea    -0x2(%rax),%rdx
+  201132:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201136:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  20113a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20113e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  201142:	89 ca                	mov    %ecx,%edx
+  201144:	66 89 10             	mov    %dx,(%rax)
+  201147:	eb 24                	jmp    20116d <console_putc+0x10a>
+        }
+    } else {
+        *cp->cursor++ = c | color;
+  201149:	0f b6 45 d4          	movzbl -0x2c(%rbp),%eax
+  20114d:	8b 55 d0             	mov    -0x30(%rbp),%edx
+  201150:	09 d0                	or     %edx,%eax
+  201152:	89 c6                	mov    %eax,%esi
+  201154:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201158:	48 8b 40 08          	mov    0x8(%rax),%rax
+  20115c:	48 8d 48 02          	lea    0x2(%rax),%rcx
+  201160:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  201164:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  201168:	89 f2                	mov    %esi,%edx
+  20116a:	66 89 10             	mov    %dx,(%rax)
+    }
+
+    const int MAX_ROWS = CONSOLE_ROWS - 2;
+  20116d:	c7 45 e4 17 00 00 00 	movl   $0x17,-0x1c(%rbp)
+
+    if (cp->cursor == console + MAX_ROWS * CONSOLE_COLUMNS) {
+  201174:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201178:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  20117c:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  20117f:	89 d0                	mov    %edx,%eax
+  201181:	c1 e0 02             	shl    $0x2,%eax
+  201184:	01 d0                	add    %edx,%eax
+  201186:	c1 e0 04             	shl    $0x4,%eax
+  201189:	48 98                	cltq
+  20118b:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  20118f:	48 8d 05 6a 6e eb ff 	lea    -0x149196(%rip),%rax        # b8000 <console>
+  201196:	48 01 d0             	add    %rdx,%rax
+  201199:	48 39 c1             	cmp    %rax,%rcx
+  20119c:	0f 85 ac 00 00 00    	jne    20124e <console_putc+0x1eb>
+        // Move all characters up by one row, forgetting the first row
+        for (int i = 0; i < (MAX_ROWS - 1) * CONSOLE_COLUMNS; ++i) {
+  2011a2:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  2011a9:	eb 30                	jmp    2011db <console_putc+0x178>
+            console[i] = console[i + CONSOLE_COLUMNS];
+  2011ab:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  2011ae:	83 c0 50             	add    $0x50,%eax
+  2011b1:	48 98                	cltq
+  2011b3:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  2011b7:	48 8d 05 42 6e eb ff 	lea    -0x1491be(%rip),%rax        # b8000 <console>
+  2011be:	0f b7 04 02          	movzwl (%rdx,%rax,1),%eax
+  2011c2:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  2011c5:	48 63 d2             	movslq %edx,%rdx
+  2011c8:	48 8d 0c 12          	lea    (%rdx,%rdx,1),%rcx
+  2011cc:	48 8d 15 2d 6e eb ff 	lea    -0x1491d3(%rip),%rdx        # b8000 <console>
+  2011d3:	66 89 04 11          	mov    %ax,(%rcx,%rdx,1)
+        for (int i = 0; i < (MAX_ROWS - 1) * CONSOLE_COLUMNS; ++i) {
+  2011d7:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+  2011db:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  2011de:	8d 50 ff             	lea    -0x1(%rax),%edx
+  2011e1:	89 d0                	mov    %edx,%eax
+  2011e3:	c1 e0 02             	shl    $0x2,%eax
+  2011e6:	01 d0                	add    %edx,%eax
+  2011e8:	c1 e0 04             	shl    $0x4,%eax
+  2011eb:	39 45 f8             	cmp    %eax,-0x8(%rbp)
+  2011ee:	7c bb                	jl     2011ab <console_putc+0x148>
+        }
+
+        // Fill last column with space
+        for (int i = (MAX_ROWS - 1) * CONSOLE_COLUMNS; i < MAX_ROWS * CONSOLE_COLUMNS; ++i) {
+  2011f0:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  2011f3:	8d 50 ff             	lea    -0x1(%rax),%edx
+  2011f6:	89 d0                	mov    %edx,%eax
+  2011f8:	c1 e0 02             	shl    $0x2,%eax
+  2011fb:	01 d0                	add    %edx,%eax
+  2011fd:	c1 e0 04             	shl    $0x4,%eax
+  201200:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  201203:	eb 20                	jmp    201225 <console_putc+0x1c2>
+            console[i] = ' ' | color;
+  201205:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  201208:	83 c8 20             	or     $0x20,%eax
+  20120b:	89 c1                	mov    %eax,%ecx
+  20120d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  201210:	48 98                	cltq
+  201212:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  201216:	48 8d 05 e3 6d eb ff 	lea    -0x14921d(%rip),%rax        # b8000 <console>
+  20121d:	66 89 0c 02          	mov    %cx,(%rdx,%rax,1)
+        for (int i = (MAX_ROWS - 1) * CONSOLE_COLUMNS; i < MAX_ROWS * CONSOLE_COLUMNS; ++i) {
+  201221:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  201225:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  201228:	89 d0                	mov    %edx,%eax
+  20122a:	c1 e0 02             	shl    $0x2,%eax
+  20122d:	01 d0                	add    %edx,%eax
+  20122f:	c1 e0 04             	shl    $0x4,%eax
+  201232:	39 45 f4             	cmp    %eax,-0xc(%rbp)
+  201235:	7c ce                	jl     201205 <console_putc+0x1a2>
+        }
+
+        cp->cursor -= CONSOLE_COLUMNS;
+  201237:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20123b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  20123f:	48 8d 90 60 ff ff ff 	lea    -0xa0(%rax),%rdx
+  201246:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20124a:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    }
+}
+  20124e:	90                   	nop
+  20124f:	c9                   	leave
+  201250:	c3                   	ret
+
+0000000000201251 <console_vprintf>:
+
+int console_vprintf(int cpos, int color, const char* format, va_list val) {
+  201251:	55                   	push   %rbp
+  201252:	48 89 e5             	mov    %rsp,%rbp
+  201255:	48 83 ec 30          	sub    $0x30,%rsp
+  201259:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  20125c:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  20125f:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  201263:	48 89 4d d8          	mov    %rcx,-0x28(%rbp)
+    struct console_printer cp;
+    cp.p.putc = console_putc;
+  201267:	48 8d 05 f5 fd ff ff 	lea    -0x20b(%rip),%rax        # 201063 <console_putc>
+  20126e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (cpos < 0 || cpos >= CONSOLE_ROWS * CONSOLE_COLUMNS) {
+  201272:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  201276:	78 09                	js     201281 <console_vprintf+0x30>
+  201278:	81 7d ec cf 07 00 00 	cmpl   $0x7cf,-0x14(%rbp)
+  20127f:	7e 07                	jle    201288 <console_vprintf+0x37>
+        cpos = 0;
+  201281:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+    }
+    cp.cursor = console + cpos;
+  201288:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  20128b:	48 98                	cltq
+  20128d:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  201291:	48 8d 05 68 6d eb ff 	lea    -0x149298(%rip),%rax        # b8000 <console>
+  201298:	48 01 d0             	add    %rdx,%rax
+  20129b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    printer_vprintf(&cp.p, color, format, val);
+  20129f:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  2012a3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  2012a7:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  2012aa:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  2012ae:	48 89 c7             	mov    %rax,%rdi
+  2012b1:	e8 a9 f3 ff ff       	call   20065f <printer_vprintf>
+    return cp.cursor - console;
+  2012b6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  2012ba:	48 8d 05 3f 6d eb ff 	lea    -0x1492c1(%rip),%rax        # b8000 <console>
+  2012c1:	48 29 c2             	sub    %rax,%rdx
+  2012c4:	48 89 d0             	mov    %rdx,%rax
+  2012c7:	48 d1 f8             	sar    %rax
+}
+  2012ca:	c9                   	leave
+  2012cb:	c3                   	ret
+
+00000000002012cc <console_printf>:
+
+int console_printf(int cpos, int color, const char* format, ...) {
+  2012cc:	55                   	push   %rbp
+  2012cd:	48 89 e5             	mov    %rsp,%rbp
+  2012d0:	48 83 ec 60          	sub    $0x60,%rsp
+  2012d4:	89 7d ac             	mov    %edi,-0x54(%rbp)
+  2012d7:	89 75 a8             	mov    %esi,-0x58(%rbp)
+  2012da:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+  2012de:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  2012e2:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  2012e6:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list val;
+    va_start(val, format);
+  2012ea:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  2012f1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  2012f5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  2012f9:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  2012fd:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    cpos = console_vprintf(cpos, color, format, val);
+  201301:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  201305:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  201309:	8b 75 a8             	mov    -0x58(%rbp),%esi
+  20130c:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  20130f:	89 c7                	mov    %eax,%edi
+  201311:	e8 3b ff ff ff       	call   201251 <console_vprintf>
+  201316:	89 45 ac             	mov    %eax,-0x54(%rbp)
+    va_end(val);
+    return cpos;
+  201319:	8b 45 ac             	mov    -0x54(%rbp),%eax
+}
+  20131c:	c9                   	leave
+  20131d:	c3                   	ret
+
+000000000020131e <string_putc>:
+    printer p;
+    char* s;
+    char* end;
+} string_printer;
+
+static void string_putc(printer* p, unsigned char c, int color) {
+  20131e:	55                   	push   %rbp
+  20131f:	48 89 e5             	mov    %rsp,%rbp
+  201322:	48 83 ec 20          	sub    $0x20,%rsp
+  201326:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  20132a:	89 f0                	mov    %esi,%eax
+  20132c:	89 55 e0             	mov    %edx,-0x20(%rbp)
+  20132f:	88 45 e4             	mov    %al,-0x1c(%rbp)
+    string_printer* sp = (string_printer*) p;
+  201332:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201336:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (sp->s < sp->end) {
+  20133a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20133e:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  201342:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  201346:	48 8b 40 10          	mov    0x10(%rax),%rax
+  20134a:	48 39 c2             	cmp    %rax,%rdx
+  20134d:	73 1a                	jae    201369 <string_putc+0x4b>
+        *sp->s++ = c;
+  20134f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  201353:	48 8b 40 08          	mov    0x8(%rax),%rax
+  201357:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  20135b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  20135f:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  201363:	0f b6 55 e4          	movzbl -0x1c(%rbp),%edx
+  201367:	88 10                	mov    %dl,(%rax)
+    }
+    (void) color;
+}
+  201369:	90                   	nop
+  20136a:	c9                   	leave
+  20136b:	c3                   	ret
+
+000000000020136c <vsnprintf>:
+
+int vsnprintf(char* s, size_t size, const char* format, va_list val) {
+  20136c:	55                   	push   %rbp
+  20136d:	48 89 e5             	mov    %rsp,%rbp
+  201370:	48 83 ec 40          	sub    $0x40,%rsp
+  201374:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  201378:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  20137c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  201380:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+    string_printer sp;
+    sp.p.putc = string_putc;
+  201384:	48 8d 05 93 ff ff ff 	lea    -0x6d(%rip),%rax        # 20131e <string_putc>
+  20138b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    sp.s = s;
+  20138f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  201393:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (size) {
+  201397:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  20139c:	74 33                	je     2013d1 <vsnprintf+0x65>
+        sp.end = s + size - 1;
+  20139e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  2013a2:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  2013a6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  2013aa:	48 01 d0             	add    %rdx,%rax
+  2013ad:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+        printer_vprintf(&sp.p, 0, format, val);
+  2013b1:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  2013b5:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  2013b9:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  2013bd:	be 00 00 00 00       	mov    $0x0,%esi
+  2013c2:	48 89 c7             	mov    %rax,%rdi
+  2013c5:	e8 95 f2 ff ff       	call   20065f <printer_vprintf>
+        *sp.s = 0;
+  2013ca:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2013ce:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return sp.s - s;
+  2013d1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2013d5:	48 2b 45 d8          	sub    -0x28(%rbp),%rax
+}
+  2013d9:	c9                   	leave
+  2013da:	c3                   	ret
+
+00000000002013db <snprintf>:
+
+int snprintf(char* s, size_t size, const char* format, ...) {
+  2013db:	55                   	push   %rbp
+  2013dc:	48 89 e5             	mov    %rsp,%rbp
+  2013df:	48 83 ec 70          	sub    $0x70,%rsp
+  2013e3:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  2013e7:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  2013eb:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  2013ef:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  2013f3:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  2013f7:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list val;
+    va_start(val, format);
+  2013fb:	c7 45 b0 18 00 00 00 	movl   $0x18,-0x50(%rbp)
+  201402:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  201406:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  20140a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  20140e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    int n = vsnprintf(s, size, format, val);
+  201412:	48 8d 4d b0          	lea    -0x50(%rbp),%rcx
+  201416:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  20141a:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  20141e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  201422:	48 89 c7             	mov    %rax,%rdi
+  201425:	e8 42 ff ff ff       	call   20136c <vsnprintf>
+  20142a:	89 45 cc             	mov    %eax,-0x34(%rbp)
+    va_end(val);
+    return n;
+  20142d:	8b 45 cc             	mov    -0x34(%rbp),%eax
+}
+  201430:	c9                   	leave
+  201431:	c3                   	ret
+
+0000000000201432 <console_clear>:
+
+
+// console_clear
+//    Erases the console and moves the cursor to the upper left (CPOS(0, 0)).
+
+void console_clear(void) {
+  201432:	55                   	push   %rbp
+  201433:	48 89 e5             	mov    %rsp,%rbp
+  201436:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < CONSOLE_ROWS * CONSOLE_COLUMNS; ++i) {
+  20143a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  201441:	eb 1a                	jmp    20145d <console_clear+0x2b>
+        console[i] = ' ' | 0x0700;
+  201443:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  201446:	48 98                	cltq
+  201448:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  20144c:	48 8d 05 ad 6b eb ff 	lea    -0x149453(%rip),%rax        # b8000 <console>
+  201453:	66 c7 04 02 20 07    	movw   $0x720,(%rdx,%rax,1)
+    for (int i = 0; i < CONSOLE_ROWS * CONSOLE_COLUMNS; ++i) {
+  201459:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  20145d:	81 7d fc cf 07 00 00 	cmpl   $0x7cf,-0x4(%rbp)
+  201464:	7e dd                	jle    201443 <console_clear+0x11>
+    }
+    cursorpos = 0;
+  201466:	c7 05 8c 7b eb ff 00 	movl   $0x0,-0x148474(%rip)        # b8ffc <cursorpos>
+  20146d:	00 00 00 
+}
+  201470:	90                   	nop
+  201471:	c9                   	leave
+  201472:	c3                   	ret
+
+0000000000201473 <string_to_char>:
+
+
+int string_to_char(const char *str, int *dest) {
+  201473:	55                   	push   %rbp
+  201474:	48 89 e5             	mov    %rsp,%rbp
+  201477:	48 83 ec 20          	sub    $0x20,%rsp
+  20147b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  20147f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    if (*str == '\0') return -1;
+  201483:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201487:	0f b6 00             	movzbl (%rax),%eax
+  20148a:	84 c0                	test   %al,%al
+  20148c:	75 0a                	jne    201498 <string_to_char+0x25>
+  20148e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  201493:	e9 e0 00 00 00       	jmp    201578 <string_to_char+0x105>
+
+    *dest = 0;
+  201498:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  20149c:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    for (; *str; str++) {
+  2014a2:	e9 bd 00 00 00       	jmp    201564 <string_to_char+0xf1>
+        int digit = 0;
+  2014a7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+        switch (*str)
+  2014ae:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2014b2:	0f b6 00             	movzbl (%rax),%eax
+  2014b5:	0f be c0             	movsbl %al,%eax
+  2014b8:	83 e8 30             	sub    $0x30,%eax
+  2014bb:	83 f8 09             	cmp    $0x9,%eax
+  2014be:	77 7c                	ja     20153c <string_to_char+0xc9>
+  2014c0:	89 c0                	mov    %eax,%eax
+  2014c2:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  2014c9:	00 
+  2014ca:	48 8d 05 13 0d 00 00 	lea    0xd13(%rip),%rax        # 2021e4 <flag_chars+0xf4>
+  2014d1:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+  2014d4:	48 98                	cltq
+  2014d6:	48 8d 15 07 0d 00 00 	lea    0xd07(%rip),%rdx        # 2021e4 <flag_chars+0xf4>
+  2014dd:	48 01 d0             	add    %rdx,%rax
+  2014e0:	ff e0                	jmp    *%rax
+        {
+        case '0':
+            digit = 0;
+  2014e2:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+            break;
+  2014e9:	eb 58                	jmp    201543 <string_to_char+0xd0>
+        case '1':
+            digit = 1;
+  2014eb:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+            break;
+  2014f2:	eb 4f                	jmp    201543 <string_to_char+0xd0>
+        case '2':
+            digit = 2;
+  2014f4:	c7 45 fc 02 00 00 00 	movl   $0x2,-0x4(%rbp)
+            break;
+  2014fb:	eb 46                	jmp    201543 <string_to_char+0xd0>
+        case '3':
+            digit = 3;
+  2014fd:	c7 45 fc 03 00 00 00 	movl   $0x3,-0x4(%rbp)
+            break;
+  201504:	eb 3d                	jmp    201543 <string_to_char+0xd0>
+        case '4':
+            digit = 4;
+  201506:	c7 45 fc 04 00 00 00 	movl   $0x4,-0x4(%rbp)
+            break;
+  20150d:	eb 34                	jmp    201543 <string_to_char+0xd0>
+        case '5':
+            digit = 5;
+  20150f:	c7 45 fc 05 00 00 00 	movl   $0x5,-0x4(%rbp)
+            break;
+  201516:	eb 2b                	jmp    201543 <string_to_char+0xd0>
+        case '6':
+            digit = 6;
+  201518:	c7 45 fc 06 00 00 00 	movl   $0x6,-0x4(%rbp)
+            break;
+  20151f:	eb 22                	jmp    201543 <string_to_char+0xd0>
+        case '7':
+            digit = 7;
+  201521:	c7 45 fc 07 00 00 00 	movl   $0x7,-0x4(%rbp)
+            break;
+  201528:	eb 19                	jmp    201543 <string_to_char+0xd0>
+        case '8':
+            digit = 8;
+  20152a:	c7 45 fc 08 00 00 00 	movl   $0x8,-0x4(%rbp)
+            break;
+  201531:	eb 10                	jmp    201543 <string_to_char+0xd0>
+        case '9':
+            digit = 9;
+  201533:	c7 45 fc 09 00 00 00 	movl   $0x9,-0x4(%rbp)
+            break;
+  20153a:	eb 07                	jmp    201543 <string_to_char+0xd0>
+        default:
+            return -1;
+  20153c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  201541:	eb 35                	jmp    201578 <string_to_char+0x105>
+        }
+
+        *dest = *dest * 10 + digit;
+  201543:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  201547:	8b 10                	mov    (%rax),%edx
+  201549:	89 d0                	mov    %edx,%eax
+  20154b:	c1 e0 02             	shl    $0x2,%eax
+  20154e:	01 d0                	add    %edx,%eax
+  201550:	01 c0                	add    %eax,%eax
+  201552:	89 c2                	mov    %eax,%edx
+  201554:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  201557:	01 c2                	add    %eax,%edx
+  201559:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  20155d:	89 10                	mov    %edx,(%rax)
+    for (; *str; str++) {
+  20155f:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  201564:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201568:	0f b6 00             	movzbl (%rax),%eax
+  20156b:	84 c0                	test   %al,%al
+  20156d:	0f 85 34 ff ff ff    	jne    2014a7 <string_to_char+0x34>
+    }
+
+    return 0;
+  201573:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  201578:	c9                   	leave
+  201579:	c3                   	ret
+
+000000000020157a <atoi>:
+
+int atoi(const char *str) {
+  20157a:	55                   	push   %rbp
+  20157b:	48 89 e5             	mov    %rsp,%rbp
+  20157e:	48 83 ec 18          	sub    $0x18,%rsp
+  201582:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    if (*str == '\0') return -1;
+  201586:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20158a:	0f b6 00             	movzbl (%rax),%eax
+  20158d:	84 c0                	test   %al,%al
+  20158f:	75 0a                	jne    20159b <atoi+0x21>
+  201591:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  201596:	e9 d7 00 00 00       	jmp    201672 <atoi+0xf8>
+
+    int n = 0;
+  20159b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    for (; *str; str++) {
+  2015a2:	e9 b7 00 00 00       	jmp    20165e <atoi+0xe4>
+        int digit = 0;
+  2015a7:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+        switch (*str)
+  2015ae:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2015b2:	0f b6 00             	movzbl (%rax),%eax
+  2015b5:	0f be c0             	movsbl %al,%eax
+  2015b8:	83 e8 30             	sub    $0x30,%eax
+  2015bb:	83 f8 09             	cmp    $0x9,%eax
+  2015be:	77 7c                	ja     20163c <atoi+0xc2>
+  2015c0:	89 c0                	mov    %eax,%eax
+  2015c2:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  2015c9:	00 
+  2015ca:	48 8d 05 3b 0c 00 00 	lea    0xc3b(%rip),%rax        # 20220c <flag_chars+0x11c>
+  2015d1:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+  2015d4:	48 98                	cltq
+  2015d6:	48 8d 15 2f 0c 00 00 	lea    0xc2f(%rip),%rdx        # 20220c <flag_chars+0x11c>
+  2015dd:	48 01 d0             	add    %rdx,%rax
+  2015e0:	ff e0                	jmp    *%rax
+        {
+        case '0':
+            digit = 0;
+  2015e2:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+            break;
+  2015e9:	eb 58                	jmp    201643 <atoi+0xc9>
+        case '1':
+            digit = 1;
+  2015eb:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+            break;
+  2015f2:	eb 4f                	jmp    201643 <atoi+0xc9>
+        case '2':
+            digit = 2;
+  2015f4:	c7 45 f8 02 00 00 00 	movl   $0x2,-0x8(%rbp)
+            break;
+  2015fb:	eb 46                	jmp    201643 <atoi+0xc9>
+        case '3':
+            digit = 3;
+  2015fd:	c7 45 f8 03 00 00 00 	movl   $0x3,-0x8(%rbp)
+            break;
+  201604:	eb 3d                	jmp    201643 <atoi+0xc9>
+        case '4':
+            digit = 4;
+  201606:	c7 45 f8 04 00 00 00 	movl   $0x4,-0x8(%rbp)
+            break;
+  20160d:	eb 34                	jmp    201643 <atoi+0xc9>
+        case '5':
+            digit = 5;
+  20160f:	c7 45 f8 05 00 00 00 	movl   $0x5,-0x8(%rbp)
+            break;
+  201616:	eb 2b                	jmp    201643 <atoi+0xc9>
+        case '6':
+            digit = 6;
+  201618:	c7 45 f8 06 00 00 00 	movl   $0x6,-0x8(%rbp)
+            break;
+  20161f:	eb 22                	jmp    201643 <atoi+0xc9>
+        case '7':
+            digit = 7;
+  201621:	c7 45 f8 07 00 00 00 	movl   $0x7,-0x8(%rbp)
+            break;
+  201628:	eb 19                	jmp    201643 <atoi+0xc9>
+        case '8':
+            digit = 8;
+  20162a:	c7 45 f8 08 00 00 00 	movl   $0x8,-0x8(%rbp)
+            break;
+  201631:	eb 10                	jmp    201643 <atoi+0xc9>
+        case '9':
+            digit = 9;
+  201633:	c7 45 f8 09 00 00 00 	movl   $0x9,-0x8(%rbp)
+            break;
+  20163a:	eb 07                	jmp    201643 <atoi+0xc9>
+        default:
+            return -1;
+  20163c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  201641:	eb 2f                	jmp    201672 <atoi+0xf8>
+        }
+
+        n = n * 10 + digit;
+  201643:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  201646:	89 d0                	mov    %edx,%eax
+  201648:	c1 e0 02             	shl    $0x2,%eax
+  20164b:	01 d0                	add    %edx,%eax
+  20164d:	01 c0                	add    %eax,%eax
+  20164f:	89 c2                	mov    %eax,%edx
+  201651:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  201654:	01 d0                	add    %edx,%eax
+  201656:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    for (; *str; str++) {
+  201659:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  20165e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201662:	0f b6 00             	movzbl (%rax),%eax
+  201665:	84 c0                	test   %al,%al
+  201667:	0f 85 3a ff ff ff    	jne    2015a7 <atoi+0x2d>
+    }
+
+    return 0;
+  20166d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  201672:	c9                   	leave
+  201673:	c3                   	ret
+
+0000000000201674 <copy_comp>:
+        components[ncomp++] = (comp); \
+    } \
+} while (0)
+
+// Helper to copy a component to dst
+void copy_comp(const char *start, const char *end, char **pdst) {
+  201674:	55                   	push   %rbp
+  201675:	48 89 e5             	mov    %rsp,%rbp
+  201678:	48 83 ec 18          	sub    $0x18,%rsp
+  20167c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  201680:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  201684:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    while (start < end) {
+  201688:	eb 23                	jmp    2016ad <copy_comp+0x39>
+        *(*pdst)++ = *start++;
+  20168a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  20168e:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  201692:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  201696:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20169a:	48 8b 00             	mov    (%rax),%rax
+  20169d:	48 8d 70 01          	lea    0x1(%rax),%rsi
+  2016a1:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  2016a5:	48 89 31             	mov    %rsi,(%rcx)
+  2016a8:	0f b6 12             	movzbl (%rdx),%edx
+  2016ab:	88 10                	mov    %dl,(%rax)
+    while (start < end) {
+  2016ad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2016b1:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  2016b5:	72 d3                	jb     20168a <copy_comp+0x16>
+    }
+}
+  2016b7:	90                   	nop
+  2016b8:	90                   	nop
+  2016b9:	c9                   	leave
+  2016ba:	c3                   	ret
+
+00000000002016bb <join_path>:
+
+
+void join_path(const char *abs_path, const char *path, char *dst) {
+  2016bb:	55                   	push   %rbp
+  2016bc:	48 89 e5             	mov    %rsp,%rbp
+  2016bf:	48 81 ec 68 02 00 00 	sub    $0x268,%rsp
+  2016c6:	48 89 bd a8 fd ff ff 	mov    %rdi,-0x258(%rbp)
+  2016cd:	48 89 b5 a0 fd ff ff 	mov    %rsi,-0x260(%rbp)
+  2016d4:	48 89 95 98 fd ff ff 	mov    %rdx,-0x268(%rbp)
+    // If path is absolute, just copy it to dst (removing duplicate slashes, and trailing slash unless root)
+    if (path[0] == '/') {
+  2016db:	48 8b 85 a0 fd ff ff 	mov    -0x260(%rbp),%rax
+  2016e2:	0f b6 00             	movzbl (%rax),%eax
+  2016e5:	3c 2f                	cmp    $0x2f,%al
+  2016e7:	0f 85 d6 00 00 00    	jne    2017c3 <join_path+0x108>
+        const char *src = path;
+  2016ed:	48 8b 85 a0 fd ff ff 	mov    -0x260(%rbp),%rax
+  2016f4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+        char *d = dst;
+  2016f8:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  2016ff:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+        // Always start with a single slash
+        *d++ = '/';
+  201703:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  201707:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  20170b:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  20170f:	c6 00 2f             	movb   $0x2f,(%rax)
+        src++;
+  201712:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+        int last_was_slash = 1;
+  201717:	c7 45 b0 01 00 00 00 	movl   $0x1,-0x50(%rbp)
+        while (*src) {
+  20171e:	eb 64                	jmp    201784 <join_path+0xc9>
+            if (*src == '/') {
+  201720:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  201724:	0f b6 00             	movzbl (%rax),%eax
+  201727:	3c 2f                	cmp    $0x2f,%al
+  201729:	75 35                	jne    201760 <join_path+0xa5>
+                // Skip consecutive slashes
+                while (*src == '/') src++;
+  20172b:	eb 05                	jmp    201732 <join_path+0x77>
+  20172d:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  201732:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  201736:	0f b6 00             	movzbl (%rax),%eax
+  201739:	3c 2f                	cmp    $0x2f,%al
+  20173b:	74 f0                	je     20172d <join_path+0x72>
+                if (*src == 0) break;
+  20173d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  201741:	0f b6 00             	movzbl (%rax),%eax
+  201744:	84 c0                	test   %al,%al
+  201746:	74 49                	je     201791 <join_path+0xd6>
+                *d++ = '/';
+  201748:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  20174c:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  201750:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  201754:	c6 00 2f             	movb   $0x2f,(%rax)
+                last_was_slash = 1;
+  201757:	c7 45 b0 01 00 00 00 	movl   $0x1,-0x50(%rbp)
+  20175e:	eb 24                	jmp    201784 <join_path+0xc9>
+            } else {
+                *d++ = *src++;
+  201760:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  201764:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  201768:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  20176c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  201770:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  201774:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  201778:	0f b6 12             	movzbl (%rdx),%edx
+  20177b:	88 10                	mov    %dl,(%rax)
+                last_was_slash = 0;
+  20177d:	c7 45 b0 00 00 00 00 	movl   $0x0,-0x50(%rbp)
+        while (*src) {
+  201784:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  201788:	0f b6 00             	movzbl (%rax),%eax
+  20178b:	84 c0                	test   %al,%al
+  20178d:	75 91                	jne    201720 <join_path+0x65>
+  20178f:	eb 01                	jmp    201792 <join_path+0xd7>
+                if (*src == 0) break;
+  201791:	90                   	nop
+            }
+        }
+        // Remove trailing slash unless the path is just "/"
+        if (d > dst + 1 && *(d-1) == '/') {
+  201792:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  201799:	48 83 c0 01          	add    $0x1,%rax
+  20179d:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  2017a1:	73 14                	jae    2017b7 <join_path+0xfc>
+  2017a3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2017a7:	48 83 e8 01          	sub    $0x1,%rax
+  2017ab:	0f b6 00             	movzbl (%rax),%eax
+  2017ae:	3c 2f                	cmp    $0x2f,%al
+  2017b0:	75 05                	jne    2017b7 <join_path+0xfc>
+            d--;
+  2017b2:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+        }
+        *d = 0;
+  2017b7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2017bb:	c6 00 00             	movb   $0x0,(%rax)
+  2017be:	e9 e9 02 00 00       	jmp    201aac <join_path+0x3f1>
+        return;
+    }
+
+    // Otherwise, start with abs_path
+    const char *src = abs_path;
+  2017c3:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  2017ca:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    char *d = dst;
+  2017ce:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  2017d5:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    if (*src != '/') {
+  2017d9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2017dd:	0f b6 00             	movzbl (%rax),%eax
+  2017e0:	3c 2f                	cmp    $0x2f,%al
+  2017e2:	74 2e                	je     201812 <join_path+0x157>
+        *d++ = '/';
+  2017e4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  2017e8:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  2017ec:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  2017f0:	c6 00 2f             	movb   $0x2f,(%rax)
+    }
+    while (*src) {
+  2017f3:	eb 1d                	jmp    201812 <join_path+0x157>
+        *d++ = *src++;
+  2017f5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  2017f9:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  2017fd:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  201801:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  201805:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  201809:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  20180d:	0f b6 12             	movzbl (%rdx),%edx
+  201810:	88 10                	mov    %dl,(%rax)
+    while (*src) {
+  201812:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201816:	0f b6 00             	movzbl (%rax),%eax
+  201819:	84 c0                	test   %al,%al
+  20181b:	75 d8                	jne    2017f5 <join_path+0x13a>
+    }
+    // Remove trailing slash (unless root)
+    if (d > dst + 1 && *(d-1) == '/') {
+  20181d:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  201824:	48 83 c0 01          	add    $0x1,%rax
+  201828:	48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+  20182c:	73 14                	jae    201842 <join_path+0x187>
+  20182e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  201832:	48 83 e8 01          	sub    $0x1,%rax
+  201836:	0f b6 00             	movzbl (%rax),%eax
+  201839:	3c 2f                	cmp    $0x2f,%al
+  20183b:	75 05                	jne    201842 <join_path+0x187>
+        d--;
+  20183d:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+    }
+    *d = 0;
+  201842:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  201846:	c6 00 00             	movb   $0x0,(%rax)
+
+    // Now, process path components
+    char temp[512];
+    int tlen = 0;
+  201849:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    // Copy dst to temp for easier manipulation
+    src = dst;
+  201850:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  201857:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    while (*src && tlen < (int)sizeof(temp)-1) {
+  20185b:	eb 22                	jmp    20187f <join_path+0x1c4>
+        temp[tlen++] = *src++;
+  20185d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201861:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  201865:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  201869:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  20186c:	8d 4a 01             	lea    0x1(%rdx),%ecx
+  20186f:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  201872:	0f b6 08             	movzbl (%rax),%ecx
+  201875:	48 63 c2             	movslq %edx,%rax
+  201878:	88 8c 05 b0 fd ff ff 	mov    %cl,-0x250(%rbp,%rax,1)
+    while (*src && tlen < (int)sizeof(temp)-1) {
+  20187f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201883:	0f b6 00             	movzbl (%rax),%eax
+  201886:	84 c0                	test   %al,%al
+  201888:	74 09                	je     201893 <join_path+0x1d8>
+  20188a:	81 7d dc fe 01 00 00 	cmpl   $0x1fe,-0x24(%rbp)
+  201891:	7e ca                	jle    20185d <join_path+0x1a2>
+    }
+    temp[tlen] = 0;
+  201893:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201896:	48 98                	cltq
+  201898:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  20189f:	00 
+
+    // Now, process each component in path
+    src = path;
+  2018a0:	48 8b 85 a0 fd ff ff 	mov    -0x260(%rbp),%rax
+  2018a7:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    while (*src) {
+  2018ab:	e9 65 01 00 00       	jmp    201a15 <join_path+0x35a>
+        // Skip slashes
+        while (*src == '/') src++;
+  2018b0:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  2018b5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2018b9:	0f b6 00             	movzbl (%rax),%eax
+  2018bc:	3c 2f                	cmp    $0x2f,%al
+  2018be:	74 f0                	je     2018b0 <join_path+0x1f5>
+        if (!*src) break;
+  2018c0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2018c4:	0f b6 00             	movzbl (%rax),%eax
+  2018c7:	84 c0                	test   %al,%al
+  2018c9:	0f 84 57 01 00 00    	je     201a26 <join_path+0x36b>
+
+        // Find end of component
+        const char *comp_start = src;
+  2018cf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2018d3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        while (*src && *src != '/') src++;
+  2018d7:	eb 05                	jmp    2018de <join_path+0x223>
+  2018d9:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  2018de:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2018e2:	0f b6 00             	movzbl (%rax),%eax
+  2018e5:	84 c0                	test   %al,%al
+  2018e7:	74 0b                	je     2018f4 <join_path+0x239>
+  2018e9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2018ed:	0f b6 00             	movzbl (%rax),%eax
+  2018f0:	3c 2f                	cmp    $0x2f,%al
+  2018f2:	75 e5                	jne    2018d9 <join_path+0x21e>
+        const char *comp_end = src;
+  2018f4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2018f8:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+
+        int comp_len = comp_end - comp_start;
+  2018fc:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  201900:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  201904:	89 45 b4             	mov    %eax,-0x4c(%rbp)
+
+        // Get component string
+        if (comp_len == 1 && comp_start[0] == '.') {
+  201907:	83 7d b4 01          	cmpl   $0x1,-0x4c(%rbp)
+  20190b:	75 10                	jne    20191d <join_path+0x262>
+  20190d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  201911:	0f b6 00             	movzbl (%rax),%eax
+  201914:	3c 2e                	cmp    $0x2e,%al
+  201916:	75 05                	jne    20191d <join_path+0x262>
+            // Ignore
+            continue;
+  201918:	e9 f8 00 00 00       	jmp    201a15 <join_path+0x35a>
+        } else if (comp_len == 2 && comp_start[0] == '.' && comp_start[1] == '.') {
+  20191d:	83 7d b4 02          	cmpl   $0x2,-0x4c(%rbp)
+  201921:	75 6e                	jne    201991 <join_path+0x2d6>
+  201923:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  201927:	0f b6 00             	movzbl (%rax),%eax
+  20192a:	3c 2e                	cmp    $0x2e,%al
+  20192c:	75 63                	jne    201991 <join_path+0x2d6>
+  20192e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  201932:	48 83 c0 01          	add    $0x1,%rax
+  201936:	0f b6 00             	movzbl (%rax),%eax
+  201939:	3c 2e                	cmp    $0x2e,%al
+  20193b:	75 54                	jne    201991 <join_path+0x2d6>
+            // Go up one directory, unless at root
+            if (tlen > 1) {
+  20193d:	83 7d dc 01          	cmpl   $0x1,-0x24(%rbp)
+  201941:	0f 8e ce 00 00 00    	jle    201a15 <join_path+0x35a>
+                // Remove trailing slash if any
+                if (temp[tlen-1] == '/') tlen--;
+  201947:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  20194a:	83 e8 01             	sub    $0x1,%eax
+  20194d:	48 98                	cltq
+  20194f:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  201956:	ff 
+  201957:	3c 2f                	cmp    $0x2f,%al
+  201959:	75 0a                	jne    201965 <join_path+0x2aa>
+  20195b:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+                // Remove last component
+                while (tlen > 1 && temp[tlen-1] != '/') tlen--;
+  20195f:	eb 04                	jmp    201965 <join_path+0x2aa>
+  201961:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  201965:	83 7d dc 01          	cmpl   $0x1,-0x24(%rbp)
+  201969:	7e 14                	jle    20197f <join_path+0x2c4>
+  20196b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  20196e:	83 e8 01             	sub    $0x1,%eax
+  201971:	48 98                	cltq
+  201973:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  20197a:	ff 
+  20197b:	3c 2f                	cmp    $0x2f,%al
+  20197d:	75 e2                	jne    201961 <join_path+0x2a6>
+                temp[tlen] = 0;
+  20197f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201982:	48 98                	cltq
+  201984:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  20198b:	00 
+            if (tlen > 1) {
+  20198c:	e9 84 00 00 00       	jmp    201a15 <join_path+0x35a>
+            }
+        } else if (comp_len > 0) {
+  201991:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  201995:	7e 7e                	jle    201a15 <join_path+0x35a>
+            // Add slash if not at root
+            if (tlen == 0 || temp[tlen-1] != '/') {
+  201997:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  20199b:	74 14                	je     2019b1 <join_path+0x2f6>
+  20199d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  2019a0:	83 e8 01             	sub    $0x1,%eax
+  2019a3:	48 98                	cltq
+  2019a5:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  2019ac:	ff 
+  2019ad:	3c 2f                	cmp    $0x2f,%al
+  2019af:	74 1c                	je     2019cd <join_path+0x312>
+                if (tlen < (int)sizeof(temp)-1) temp[tlen++] = '/';
+  2019b1:	81 7d dc fe 01 00 00 	cmpl   $0x1fe,-0x24(%rbp)
+  2019b8:	7f 13                	jg     2019cd <join_path+0x312>
+  2019ba:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  2019bd:	8d 50 01             	lea    0x1(%rax),%edx
+  2019c0:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  2019c3:	48 98                	cltq
+  2019c5:	c6 84 05 b0 fd ff ff 	movb   $0x2f,-0x250(%rbp,%rax,1)
+  2019cc:	2f 
+            }
+            // Copy component
+            for (const char *p = comp_start; p < comp_end && tlen < (int)sizeof(temp)-1; ++p) {
+  2019cd:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  2019d1:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  2019d5:	eb 1e                	jmp    2019f5 <join_path+0x33a>
+                temp[tlen++] = *p;
+  2019d7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  2019da:	8d 50 01             	lea    0x1(%rax),%edx
+  2019dd:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  2019e0:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  2019e4:	0f b6 12             	movzbl (%rdx),%edx
+  2019e7:	48 98                	cltq
+  2019e9:	88 94 05 b0 fd ff ff 	mov    %dl,-0x250(%rbp,%rax,1)
+            for (const char *p = comp_start; p < comp_end && tlen < (int)sizeof(temp)-1; ++p) {
+  2019f0:	48 83 45 d0 01       	addq   $0x1,-0x30(%rbp)
+  2019f5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  2019f9:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  2019fd:	73 09                	jae    201a08 <join_path+0x34d>
+  2019ff:	81 7d dc fe 01 00 00 	cmpl   $0x1fe,-0x24(%rbp)
+  201a06:	7e cf                	jle    2019d7 <join_path+0x31c>
+            }
+            temp[tlen] = 0;
+  201a08:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201a0b:	48 98                	cltq
+  201a0d:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  201a14:	00 
+    while (*src) {
+  201a15:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201a19:	0f b6 00             	movzbl (%rax),%eax
+  201a1c:	84 c0                	test   %al,%al
+  201a1e:	0f 85 91 fe ff ff    	jne    2018b5 <join_path+0x1fa>
+  201a24:	eb 01                	jmp    201a27 <join_path+0x36c>
+        if (!*src) break;
+  201a26:	90                   	nop
+        }
+    }
+
+    // If temp is empty, set to "/"
+    if (tlen == 0) {
+  201a27:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  201a2b:	75 20                	jne    201a4d <join_path+0x392>
+        temp[tlen++] = '/';
+  201a2d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201a30:	8d 50 01             	lea    0x1(%rax),%edx
+  201a33:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  201a36:	48 98                	cltq
+  201a38:	c6 84 05 b0 fd ff ff 	movb   $0x2f,-0x250(%rbp,%rax,1)
+  201a3f:	2f 
+        temp[tlen] = 0;
+  201a40:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201a43:	48 98                	cltq
+  201a45:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  201a4c:	00 
+    }
+
+    // Remove trailing slash unless the path is just "/"
+    if (tlen > 1 && temp[tlen-1] == '/') {
+  201a4d:	83 7d dc 01          	cmpl   $0x1,-0x24(%rbp)
+  201a51:	7e 25                	jle    201a78 <join_path+0x3bd>
+  201a53:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201a56:	83 e8 01             	sub    $0x1,%eax
+  201a59:	48 98                	cltq
+  201a5b:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  201a62:	ff 
+  201a63:	3c 2f                	cmp    $0x2f,%al
+  201a65:	75 11                	jne    201a78 <join_path+0x3bd>
+        temp[--tlen] = 0;
+  201a67:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  201a6b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201a6e:	48 98                	cltq
+  201a70:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  201a77:	00 
+    }
+
+    // Copy temp to dst
+    for (int i = 0; i <= tlen; ++i) {
+  201a78:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  201a7f:	eb 23                	jmp    201aa4 <join_path+0x3e9>
+        dst[i] = temp[i];
+  201a81:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  201a84:	48 63 d0             	movslq %eax,%rdx
+  201a87:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  201a8e:	48 01 c2             	add    %rax,%rdx
+  201a91:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  201a94:	48 98                	cltq
+  201a96:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  201a9d:	ff 
+  201a9e:	88 02                	mov    %al,(%rdx)
+    for (int i = 0; i <= tlen; ++i) {
+  201aa0:	83 45 cc 01          	addl   $0x1,-0x34(%rbp)
+  201aa4:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  201aa7:	3b 45 dc             	cmp    -0x24(%rbp),%eax
+  201aaa:	7e d5                	jle    201a81 <join_path+0x3c6>
+    }
+}
+  201aac:	c9                   	leave
+  201aad:	c3                   	ret
+
+0000000000201aae <app_printf>:
+#include "lib-malloc.h"
+#include "errno.h"
+// app_printf
+//     A version of console_printf that picks a sensible color by process ID.
+
+void app_printf(int colorid, const char* format, ...) {
+  201aae:	55                   	push   %rbp
+  201aaf:	48 89 e5             	mov    %rsp,%rbp
+  201ab2:	48 83 ec 50          	sub    $0x50,%rsp
+  201ab6:	49 89 f2             	mov    %rsi,%r10
+  201ab9:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  201abd:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  201ac1:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  201ac5:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    int color;
+    if (colorid < 0) {
+        color = 0x0700;
+  201ac9:	be 00 07 00 00       	mov    $0x700,%esi
+    if (colorid < 0) {
+  201ace:	85 ff                	test   %edi,%edi
+  201ad0:	78 32                	js     201b04 <app_printf+0x56>
+    } else {
+        static const uint8_t col[] = { 0x0F, 0x0C, 0x0A, 0x09, 0x0E };
+        color = col[colorid % sizeof(col)] << 8;
+  201ad2:	48 63 ff             	movslq %edi,%rdi
+  201ad5:	48 ba cd cc cc cc cc 	movabs $0xcccccccccccccccd,%rdx
+  201adc:	cc cc cc 
+  201adf:	48 89 f8             	mov    %rdi,%rax
+  201ae2:	48 f7 e2             	mul    %rdx
+  201ae5:	48 89 d0             	mov    %rdx,%rax
+  201ae8:	48 c1 e8 02          	shr    $0x2,%rax
+  201aec:	48 83 e2 fc          	and    $0xfffffffffffffffc,%rdx
+  201af0:	48 01 c2             	add    %rax,%rdx
+  201af3:	48 29 d7             	sub    %rdx,%rdi
+  201af6:	48 8d 05 3b 09 00 00 	lea    0x93b(%rip),%rax        # 202438 <col.0>
+  201afd:	0f b6 34 38          	movzbl (%rax,%rdi,1),%esi
+  201b01:	c1 e6 08             	shl    $0x8,%esi
+    }
+
+    va_list val;
+    va_start(val, format);
+  201b04:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  201b0b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  201b0f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  201b13:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  201b17:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    cursorpos = console_vprintf(cursorpos, color, format, val);
+  201b1b:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  201b1f:	4c 89 d2             	mov    %r10,%rdx
+  201b22:	8b 3d d4 74 eb ff    	mov    -0x148b2c(%rip),%edi        # b8ffc <cursorpos>
+  201b28:	e8 24 f7 ff ff       	call   201251 <console_vprintf>
+  201b2d:	89 05 c9 74 eb ff    	mov    %eax,-0x148b37(%rip)        # b8ffc <cursorpos>
+    va_end(val);
+
+    /*if (CROW(cursorpos) >= 23) {
+        cursorpos = CPOS(0, 0);
+    }*/
+}
+  201b33:	c9                   	leave
+  201b34:	c3                   	ret
+
+0000000000201b35 <panic>:
+
+
+// panic, assert_fail
+//     Call the INT_SYS_PANIC system call so the kernel loops until Control-C.
+
+void panic(const char* format, ...) {
+  201b35:	55                   	push   %rbp
+  201b36:	48 89 e5             	mov    %rsp,%rbp
+  201b39:	53                   	push   %rbx
+  201b3a:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  201b41:	48 89 fb             	mov    %rdi,%rbx
+  201b44:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  201b48:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  201b4c:	48 89 4d d8          	mov    %rcx,-0x28(%rbp)
+  201b50:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  201b54:	4c 89 4d e8          	mov    %r9,-0x18(%rbp)
+    va_list val;
+    va_start(val, format);
+  201b58:	c7 45 a8 08 00 00 00 	movl   $0x8,-0x58(%rbp)
+  201b5f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  201b63:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  201b67:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  201b6b:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    char buf[160];
+    memcpy(buf, "PANIC: ", 7);
+  201b6f:	48 8d bd 08 ff ff ff 	lea    -0xf8(%rbp),%rdi
+  201b76:	ba 07 00 00 00       	mov    $0x7,%edx
+  201b7b:	48 8d 35 ef 06 00 00 	lea    0x6ef(%rip),%rsi        # 202271 <lower_digits.0+0x11>
+  201b82:	e8 31 e5 ff ff       	call   2000b8 <memcpy>
+    int len = vsnprintf(&buf[7], sizeof(buf) - 7, format, val) + 7;
+  201b87:	48 8d 4d a8          	lea    -0x58(%rbp),%rcx
+  201b8b:	48 8d bd 0f ff ff ff 	lea    -0xf1(%rbp),%rdi
+  201b92:	48 89 da             	mov    %rbx,%rdx
+  201b95:	be 99 00 00 00       	mov    $0x99,%esi
+  201b9a:	e8 cd f7 ff ff       	call   20136c <vsnprintf>
+  201b9f:	8d 50 07             	lea    0x7(%rax),%edx
+    va_end(val);
+    if (len > 0 && buf[len - 1] != '\n') {
+  201ba2:	85 d2                	test   %edx,%edx
+  201ba4:	7e 0f                	jle    201bb5 <panic+0x80>
+  201ba6:	83 c0 06             	add    $0x6,%eax
+  201ba9:	48 98                	cltq
+  201bab:	80 bc 05 08 ff ff ff 	cmpb   $0xa,-0xf8(%rbp,%rax,1)
+  201bb2:	0a 
+  201bb3:	75 30                	jne    201be5 <panic+0xb0>
+        strcpy(buf + len - (len == (int) sizeof(buf) - 1), "\n");
+    }
+    (void) console_printf(CPOS(23, 0), 0xC000, "%s", buf);
+  201bb5:	48 8d 8d 08 ff ff ff 	lea    -0xf8(%rbp),%rcx
+  201bbc:	48 8d 15 b6 06 00 00 	lea    0x6b6(%rip),%rdx        # 202279 <lower_digits.0+0x19>
+  201bc3:	be 00 c0 00 00       	mov    $0xc000,%esi
+  201bc8:	bf 30 07 00 00       	mov    $0x730,%edi
+  201bcd:	b8 00 00 00 00       	mov    $0x0,%eax
+  201bd2:	e8 f5 f6 ff ff       	call   2012cc <console_printf>
+    asm volatile ("syscall" : "=a" (rax)
+  201bd7:	b8 30 00 00 00       	mov    $0x30,%eax
+  201bdc:	bf 00 00 00 00       	mov    $0x0,%edi
+  201be1:	0f 05                	syscall
+ loop: goto loop;
+  201be3:	eb fe                	jmp    201be3 <panic+0xae>
+        strcpy(buf + len - (len == (int) sizeof(buf) - 1), "\n");
+  201be5:	48 63 c2             	movslq %edx,%rax
+  201be8:	81 fa 9f 00 00 00    	cmp    $0x9f,%edx
+  201bee:	0f 94 c2             	sete   %dl
+  201bf1:	0f b6 d2             	movzbl %dl,%edx
+  201bf4:	48 29 d0             	sub    %rdx,%rax
+  201bf7:	48 8d bc 05 08 ff ff 	lea    -0xf8(%rbp,%rax,1),%rdi
+  201bfe:	ff 
+  201bff:	48 8d 35 4e 07 00 00 	lea    0x74e(%rip),%rsi        # 202354 <lower_digits.0+0xf4>
+  201c06:	e8 3b e8 ff ff       	call   200446 <strcpy>
+  201c0b:	eb a8                	jmp    201bb5 <panic+0x80>
+
+0000000000201c0d <raise>:
+
+#define SIGABRT -1
+
+
+
+int raise(int sig) {
+  201c0d:	89 fe                	mov    %edi,%esi
+    return vdso()->pid;
+  201c0f:	8b 3c 25 00 10 24 00 	mov    0x241000,%edi
+    asm volatile ("syscall" : "=a" (result)
+  201c16:	b8 41 00 00 00       	mov    $0x41,%eax
+  201c1b:	0f 05                	syscall
+    return sys_kill(getpid(), sig);
+}
+  201c1d:	c3                   	ret
+
+0000000000201c1e <abort>:
+    return vdso()->pid;
+  201c1e:	8b 3c 25 00 10 24 00 	mov    0x241000,%edi
+    asm volatile ("syscall" : "=a" (result)
+  201c25:	b8 41 00 00 00       	mov    $0x41,%eax
+  201c2a:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  201c2f:	0f 05                	syscall
+
+void __attribute((noreturn)) abort(void) {
+    raise(SIGABRT);
+ spinloop: goto spinloop;       // should never get here
+  201c31:	eb fe                	jmp    201c31 <abort+0x13>
+
+0000000000201c33 <assert_fail>:
+}
+
+
+void assert_fail(const char* file, int line, const char* msg) {
+  201c33:	55                   	push   %rbp
+  201c34:	48 89 e5             	mov    %rsp,%rbp
+  201c37:	48 89 f9             	mov    %rdi,%rcx
+  201c3a:	41 89 f0             	mov    %esi,%r8d
+  201c3d:	49 89 d1             	mov    %rdx,%r9
+    (void) console_printf(CPOS(23, 0), 0xC000,
+  201c40:	48 8d 15 11 07 00 00 	lea    0x711(%rip),%rdx        # 202358 <lower_digits.0+0xf8>
+  201c47:	be 00 c0 00 00       	mov    $0xc000,%esi
+  201c4c:	bf 30 07 00 00       	mov    $0x730,%edi
+  201c51:	b8 00 00 00 00       	mov    $0x0,%eax
+  201c56:	e8 71 f6 ff ff       	call   2012cc <console_printf>
+                          "PANIC: %s:%d: assertion '%s' failed\n",
+                          file, line, msg);
+    abort();
+  201c5b:	e8 be ff ff ff       	call   201c1e <abort>
+
+0000000000201c60 <scan_char>:
+    asm volatile ("syscall" : "=a" (result)
+  201c60:	bf 3a 00 00 00       	mov    $0x3a,%edi
+    asm volatile ("syscall" : "=a" (rax)
+  201c65:	be 3c 00 00 00       	mov    $0x3c,%esi
+    asm volatile ("syscall" : "=a" (result)
+  201c6a:	89 f8                	mov    %edi,%eax
+  201c6c:	0f 05                	syscall
+  201c6e:	89 c2                	mov    %eax,%edx
+    asm volatile ("syscall" : "=a" (rax)
+  201c70:	89 f0                	mov    %esi,%eax
+  201c72:	0f 05                	syscall
+    int c;
+
+    do {
+        c = sys_keybord();
+        sys_yield();
+    } while (c == -1);
+  201c74:	83 fa ff             	cmp    $0xffffffff,%edx
+  201c77:	74 f1                	je     201c6a <scan_char+0xa>
+
+    return c;
+  201c79:	89 d0                	mov    %edx,%eax
+}
+  201c7b:	c3                   	ret
+
+0000000000201c7c <scan_line>:
+
+unsigned int scan_line(char* dst, unsigned int length_max) {
+  201c7c:	55                   	push   %rbp
+  201c7d:	48 89 e5             	mov    %rsp,%rbp
+  201c80:	41 57                	push   %r15
+  201c82:	41 56                	push   %r14
+  201c84:	41 55                	push   %r13
+  201c86:	41 54                	push   %r12
+  201c88:	53                   	push   %rbx
+  201c89:	48 83 ec 08          	sub    $0x8,%rsp
+  201c8d:	49 89 fe             	mov    %rdi,%r14
+  201c90:	41 89 f5             	mov    %esi,%r13d
+    unsigned int length = 0;
+  201c93:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            app_printf(0, "%c", c);
+            dst[length] = '\0';
+            return length;
+        } else if (c >= 32 && c <= 127) {
+            if (length < length_max) {
+                app_printf(0, "%c", c);
+  201c99:	4c 8d 3d dc 05 00 00 	lea    0x5dc(%rip),%r15        # 20227c <lower_digits.0+0x1c>
+  201ca0:	eb 05                	jmp    201ca7 <scan_line+0x2b>
+            if (length != 0) {
+  201ca2:	45 85 e4             	test   %r12d,%r12d
+  201ca5:	75 3e                	jne    201ce5 <scan_line+0x69>
+        unsigned char c = scan_char();
+  201ca7:	e8 b4 ff ff ff       	call   201c60 <scan_char>
+  201cac:	89 c3                	mov    %eax,%ebx
+        if (c == '\b') {
+  201cae:	3c 08                	cmp    $0x8,%al
+  201cb0:	74 f0                	je     201ca2 <scan_line+0x26>
+        } else if (c == '\n') {
+  201cb2:	3c 0a                	cmp    $0xa,%al
+  201cb4:	74 4c                	je     201d02 <scan_line+0x86>
+        } else if (c >= 32 && c <= 127) {
+  201cb6:	8d 43 e0             	lea    -0x20(%rbx),%eax
+            if (length < length_max) {
+  201cb9:	3c 5f                	cmp    $0x5f,%al
+  201cbb:	77 ea                	ja     201ca7 <scan_line+0x2b>
+  201cbd:	45 39 ec             	cmp    %r13d,%r12d
+  201cc0:	73 e5                	jae    201ca7 <scan_line+0x2b>
+                app_printf(0, "%c", c);
+  201cc2:	0f b6 d3             	movzbl %bl,%edx
+  201cc5:	4c 89 fe             	mov    %r15,%rsi
+  201cc8:	bf 00 00 00 00       	mov    $0x0,%edi
+  201ccd:	b8 00 00 00 00       	mov    $0x0,%eax
+  201cd2:	e8 d7 fd ff ff       	call   201aae <app_printf>
+                dst[length++] = c;
+  201cd7:	44 89 e0             	mov    %r12d,%eax
+  201cda:	41 88 1c 06          	mov    %bl,(%r14,%rax,1)
+  201cde:	45 8d 64 24 01       	lea    0x1(%r12),%r12d
+  201ce3:	eb c2                	jmp    201ca7 <scan_line+0x2b>
+                app_printf(0, "%c", c);
+  201ce5:	ba 08 00 00 00       	mov    $0x8,%edx
+  201cea:	4c 89 fe             	mov    %r15,%rsi
+  201ced:	bf 00 00 00 00       	mov    $0x0,%edi
+  201cf2:	b8 00 00 00 00       	mov    $0x0,%eax
+  201cf7:	e8 b2 fd ff ff       	call   201aae <app_printf>
+                length--;
+  201cfc:	41 83 ec 01          	sub    $0x1,%r12d
+  201d00:	eb a5                	jmp    201ca7 <scan_line+0x2b>
+            app_printf(0, "%c", c);
+  201d02:	ba 0a 00 00 00       	mov    $0xa,%edx
+  201d07:	48 8d 35 6e 05 00 00 	lea    0x56e(%rip),%rsi        # 20227c <lower_digits.0+0x1c>
+  201d0e:	bf 00 00 00 00       	mov    $0x0,%edi
+  201d13:	b8 00 00 00 00       	mov    $0x0,%eax
+  201d18:	e8 91 fd ff ff       	call   201aae <app_printf>
+            dst[length] = '\0';
+  201d1d:	44 89 e0             	mov    %r12d,%eax
+  201d20:	41 c6 04 06 00       	movb   $0x0,(%r14,%rax,1)
+            }
+        }
+    }
+}
+  201d25:	44 89 e0             	mov    %r12d,%eax
+  201d28:	48 83 c4 08          	add    $0x8,%rsp
+  201d2c:	5b                   	pop    %rbx
+  201d2d:	41 5c                	pop    %r12
+  201d2f:	41 5d                	pop    %r13
+  201d31:	41 5e                	pop    %r14
+  201d33:	41 5f                	pop    %r15
+  201d35:	5d                   	pop    %rbp
+  201d36:	c3                   	ret
+
+0000000000201d37 <split_string>:
+
+
+char** split_string(char* str, char sep) {
+  201d37:	55                   	push   %rbp
+  201d38:	48 89 e5             	mov    %rsp,%rbp
+  201d3b:	41 57                	push   %r15
+  201d3d:	41 56                	push   %r14
+  201d3f:	41 55                	push   %r13
+  201d41:	41 54                	push   %r12
+  201d43:	53                   	push   %rbx
+  201d44:	48 83 ec 08          	sub    $0x8,%rsp
+    int s = 1;
+    int n = 0;
+
+    while (str[n]) {
+  201d48:	0f b6 07             	movzbl (%rdi),%eax
+  201d4b:	84 c0                	test   %al,%al
+  201d4d:	0f 84 ad 00 00 00    	je     201e00 <split_string+0xc9>
+  201d53:	48 89 fb             	mov    %rdi,%rbx
+  201d56:	41 89 f4             	mov    %esi,%r12d
+  201d59:	41 be 01 00 00 00    	mov    $0x1,%r14d
+    int s = 1;
+  201d5f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  201d64:	eb 03                	jmp    201d69 <split_string+0x32>
+  201d66:	49 89 d6             	mov    %rdx,%r14
+        if (str[n] == sep)
+            s++;
+  201d69:	41 38 c4             	cmp    %al,%r12b
+  201d6c:	0f 94 c0             	sete   %al
+  201d6f:	0f b6 c0             	movzbl %al,%eax
+  201d72:	01 c1                	add    %eax,%ecx
+    while (str[n]) {
+  201d74:	49 8d 56 01          	lea    0x1(%r14),%rdx
+  201d78:	0f b6 44 13 ff       	movzbl -0x1(%rbx,%rdx,1),%eax
+  201d7d:	84 c0                	test   %al,%al
+  201d7f:	75 e5                	jne    201d66 <split_string+0x2f>
+        n++;
+    }
+    
+    char** part = malloc((s+1)*sizeof(char*));
+  201d81:	44 8d 79 01          	lea    0x1(%rcx),%r15d
+  201d85:	4d 63 ff             	movslq %r15d,%r15
+  201d88:	49 c1 e7 03          	shl    $0x3,%r15
+  201d8c:	4c 89 ff             	mov    %r15,%rdi
+  201d8f:	e8 69 02 00 00       	call   201ffd <malloc>
+  201d94:	49 89 c5             	mov    %rax,%r13
+    char* buffer = malloc(n+1);
+  201d97:	41 8d 7e 01          	lea    0x1(%r14),%edi
+  201d9b:	48 63 ff             	movslq %edi,%rdi
+  201d9e:	e8 5a 02 00 00       	call   201ffd <malloc>
+
+    int word_n = 0;
+    part[0] = buffer;
+  201da3:	49 89 45 00          	mov    %rax,0x0(%r13)
+    part[s] = NULL;
+  201da7:	4b c7 44 3d f8 00 00 	movq   $0x0,-0x8(%r13,%r15,1)
+  201dae:	00 00 
+    buffer[n] = 0;
+  201db0:	42 c6 04 30 00       	movb   $0x0,(%rax,%r14,1)
+
+    for (int i = 0; i < n; i++) {
+  201db5:	45 85 f6             	test   %r14d,%r14d
+  201db8:	7e 6c                	jle    201e26 <split_string+0xef>
+  201dba:	41 83 ee 01          	sub    $0x1,%r14d
+  201dbe:	48 89 da             	mov    %rbx,%rdx
+  201dc1:	48 83 c0 01          	add    $0x1,%rax
+  201dc5:	48 89 c1             	mov    %rax,%rcx
+    int word_n = 0;
+  201dc8:	bf 00 00 00 00       	mov    $0x0,%edi
+  201dcd:	eb 23                	jmp    201df2 <split_string+0xbb>
+        if (str[i] == sep) {
+            buffer[i] = 0;
+  201dcf:	c6 41 ff 00          	movb   $0x0,-0x1(%rcx)
+            part[++word_n] = &buffer[i+1];
+  201dd3:	83 c7 01             	add    $0x1,%edi
+  201dd6:	48 63 f7             	movslq %edi,%rsi
+  201dd9:	49 89 4c f5 00       	mov    %rcx,0x0(%r13,%rsi,8)
+    for (int i = 0; i < n; i++) {
+  201dde:	48 83 c2 01          	add    $0x1,%rdx
+  201de2:	48 83 c1 01          	add    $0x1,%rcx
+  201de6:	89 ce                	mov    %ecx,%esi
+  201de8:	29 c6                	sub    %eax,%esi
+  201dea:	83 ee 01             	sub    $0x1,%esi
+  201ded:	44 39 f6             	cmp    %r14d,%esi
+  201df0:	7d 34                	jge    201e26 <split_string+0xef>
+        if (str[i] == sep) {
+  201df2:	0f b6 32             	movzbl (%rdx),%esi
+  201df5:	44 38 e6             	cmp    %r12b,%sil
+  201df8:	74 d5                	je     201dcf <split_string+0x98>
+        } else {
+            buffer[i] = str[i];
+  201dfa:	40 88 71 ff          	mov    %sil,-0x1(%rcx)
+  201dfe:	eb de                	jmp    201dde <split_string+0xa7>
+    char** part = malloc((s+1)*sizeof(char*));
+  201e00:	bf 10 00 00 00       	mov    $0x10,%edi
+  201e05:	e8 f3 01 00 00       	call   201ffd <malloc>
+  201e0a:	49 89 c5             	mov    %rax,%r13
+    char* buffer = malloc(n+1);
+  201e0d:	bf 01 00 00 00       	mov    $0x1,%edi
+  201e12:	e8 e6 01 00 00       	call   201ffd <malloc>
+    part[0] = buffer;
+  201e17:	49 89 45 00          	mov    %rax,0x0(%r13)
+    part[s] = NULL;
+  201e1b:	49 c7 45 08 00 00 00 	movq   $0x0,0x8(%r13)
+  201e22:	00 
+    buffer[n] = 0;
+  201e23:	c6 00 00             	movb   $0x0,(%rax)
+        }
+    }
+
+    return part;
+}
+  201e26:	4c 89 e8             	mov    %r13,%rax
+  201e29:	48 83 c4 08          	add    $0x8,%rsp
+  201e2d:	5b                   	pop    %rbx
+  201e2e:	41 5c                	pop    %r12
+  201e30:	41 5d                	pop    %r13
+  201e32:	41 5e                	pop    %r14
+  201e34:	41 5f                	pop    %r15
+  201e36:	5d                   	pop    %rbp
+  201e37:	c3                   	ret
+
+0000000000201e38 <app_print_error>:
+
+
+void app_print_error(int r) {
+  201e38:	55                   	push   %rbp
+  201e39:	48 89 e5             	mov    %rsp,%rbp
+    switch (r) {
+  201e3c:	83 ff 24             	cmp    $0x24,%edi
+  201e3f:	0f 87 79 01 00 00    	ja     201fbe <app_print_error+0x186>
+  201e45:	89 f8                	mov    %edi,%eax
+  201e47:	48 8d 15 56 05 00 00 	lea    0x556(%rip),%rdx        # 2023a4 <lower_digits.0+0x144>
+  201e4e:	48 63 04 82          	movslq (%rdx,%rax,4),%rax
+  201e52:	48 01 d0             	add    %rdx,%rax
+  201e55:	ff e0                	jmp    *%rax
+        case ENOENT:
+            app_printf(1, "Error: %s\n", "No such file or directory");
+  201e57:	48 8d 15 21 04 00 00 	lea    0x421(%rip),%rdx        # 20227f <lower_digits.0+0x1f>
+  201e5e:	48 8d 35 34 04 00 00 	lea    0x434(%rip),%rsi        # 202299 <lower_digits.0+0x39>
+  201e65:	bf 01 00 00 00       	mov    $0x1,%edi
+  201e6a:	b8 00 00 00 00       	mov    $0x0,%eax
+  201e6f:	e8 3a fc ff ff       	call   201aae <app_printf>
+            break;
+        default:
+            app_printf(1, "Error %d: %s\n", r, "Unknown error");
+            break;
+    }
+}
+  201e74:	5d                   	pop    %rbp
+  201e75:	c3                   	ret
+            app_printf(1, "Error: %s\n", "I/O error");
+  201e76:	48 8d 15 27 04 00 00 	lea    0x427(%rip),%rdx        # 2022a4 <lower_digits.0+0x44>
+  201e7d:	48 8d 35 15 04 00 00 	lea    0x415(%rip),%rsi        # 202299 <lower_digits.0+0x39>
+  201e84:	bf 01 00 00 00       	mov    $0x1,%edi
+  201e89:	b8 00 00 00 00       	mov    $0x0,%eax
+  201e8e:	e8 1b fc ff ff       	call   201aae <app_printf>
+            break;
+  201e93:	eb df                	jmp    201e74 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Exec format error");
+  201e95:	48 8d 15 12 04 00 00 	lea    0x412(%rip),%rdx        # 2022ae <lower_digits.0+0x4e>
+  201e9c:	48 8d 35 f6 03 00 00 	lea    0x3f6(%rip),%rsi        # 202299 <lower_digits.0+0x39>
+  201ea3:	bf 01 00 00 00       	mov    $0x1,%edi
+  201ea8:	b8 00 00 00 00       	mov    $0x0,%eax
+  201ead:	e8 fc fb ff ff       	call   201aae <app_printf>
+            break;
+  201eb2:	eb c0                	jmp    201e74 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Resource temporarily unavailable");
+  201eb4:	48 8d 15 c5 04 00 00 	lea    0x4c5(%rip),%rdx        # 202380 <lower_digits.0+0x120>
+  201ebb:	48 8d 35 d7 03 00 00 	lea    0x3d7(%rip),%rsi        # 202299 <lower_digits.0+0x39>
+  201ec2:	bf 01 00 00 00       	mov    $0x1,%edi
+  201ec7:	b8 00 00 00 00       	mov    $0x0,%eax
+  201ecc:	e8 dd fb ff ff       	call   201aae <app_printf>
+            break;
+  201ed1:	eb a1                	jmp    201e74 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Out of memory");
+  201ed3:	48 8d 15 e6 03 00 00 	lea    0x3e6(%rip),%rdx        # 2022c0 <lower_digits.0+0x60>
+  201eda:	48 8d 35 b8 03 00 00 	lea    0x3b8(%rip),%rsi        # 202299 <lower_digits.0+0x39>
+  201ee1:	bf 01 00 00 00       	mov    $0x1,%edi
+  201ee6:	b8 00 00 00 00       	mov    $0x0,%eax
+  201eeb:	e8 be fb ff ff       	call   201aae <app_printf>
+            break;
+  201ef0:	eb 82                	jmp    201e74 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Bad address");
+  201ef2:	48 8d 15 d5 03 00 00 	lea    0x3d5(%rip),%rdx        # 2022ce <lower_digits.0+0x6e>
+  201ef9:	48 8d 35 99 03 00 00 	lea    0x399(%rip),%rsi        # 202299 <lower_digits.0+0x39>
+  201f00:	bf 01 00 00 00       	mov    $0x1,%edi
+  201f05:	b8 00 00 00 00       	mov    $0x0,%eax
+  201f0a:	e8 9f fb ff ff       	call   201aae <app_printf>
+            break;
+  201f0f:	e9 60 ff ff ff       	jmp    201e74 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Not a directory");
+  201f14:	48 8d 15 bf 03 00 00 	lea    0x3bf(%rip),%rdx        # 2022da <lower_digits.0+0x7a>
+  201f1b:	48 8d 35 77 03 00 00 	lea    0x377(%rip),%rsi        # 202299 <lower_digits.0+0x39>
+  201f22:	bf 01 00 00 00       	mov    $0x1,%edi
+  201f27:	b8 00 00 00 00       	mov    $0x0,%eax
+  201f2c:	e8 7d fb ff ff       	call   201aae <app_printf>
+            break;
+  201f31:	e9 3e ff ff ff       	jmp    201e74 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Invalid argument");
+  201f36:	48 8d 15 ad 03 00 00 	lea    0x3ad(%rip),%rdx        # 2022ea <lower_digits.0+0x8a>
+  201f3d:	48 8d 35 55 03 00 00 	lea    0x355(%rip),%rsi        # 202299 <lower_digits.0+0x39>
+  201f44:	bf 01 00 00 00       	mov    $0x1,%edi
+  201f49:	b8 00 00 00 00       	mov    $0x0,%eax
+  201f4e:	e8 5b fb ff ff       	call   201aae <app_printf>
+            break;
+  201f53:	e9 1c ff ff ff       	jmp    201e74 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "No space left on device");
+  201f58:	48 8d 15 9c 03 00 00 	lea    0x39c(%rip),%rdx        # 2022fb <lower_digits.0+0x9b>
+  201f5f:	48 8d 35 33 03 00 00 	lea    0x333(%rip),%rsi        # 202299 <lower_digits.0+0x39>
+  201f66:	bf 01 00 00 00       	mov    $0x1,%edi
+  201f6b:	b8 00 00 00 00       	mov    $0x0,%eax
+  201f70:	e8 39 fb ff ff       	call   201aae <app_printf>
+            break;
+  201f75:	e9 fa fe ff ff       	jmp    201e74 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "File already exists");
+  201f7a:	48 8d 15 92 03 00 00 	lea    0x392(%rip),%rdx        # 202313 <lower_digits.0+0xb3>
+  201f81:	48 8d 35 11 03 00 00 	lea    0x311(%rip),%rsi        # 202299 <lower_digits.0+0x39>
+  201f88:	bf 01 00 00 00       	mov    $0x1,%edi
+  201f8d:	b8 00 00 00 00       	mov    $0x0,%eax
+  201f92:	e8 17 fb ff ff       	call   201aae <app_printf>
+            break;
+  201f97:	e9 d8 fe ff ff       	jmp    201e74 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "File name too long");
+  201f9c:	48 8d 15 84 03 00 00 	lea    0x384(%rip),%rdx        # 202327 <lower_digits.0+0xc7>
+  201fa3:	48 8d 35 ef 02 00 00 	lea    0x2ef(%rip),%rsi        # 202299 <lower_digits.0+0x39>
+  201faa:	bf 01 00 00 00       	mov    $0x1,%edi
+  201faf:	b8 00 00 00 00       	mov    $0x0,%eax
+  201fb4:	e8 f5 fa ff ff       	call   201aae <app_printf>
+            break;
+  201fb9:	e9 b6 fe ff ff       	jmp    201e74 <app_print_error+0x3c>
+            app_printf(1, "Error %d: %s\n", r, "Unknown error");
+  201fbe:	48 8d 0d 75 03 00 00 	lea    0x375(%rip),%rcx        # 20233a <lower_digits.0+0xda>
+  201fc5:	89 fa                	mov    %edi,%edx
+  201fc7:	48 8d 35 7a 03 00 00 	lea    0x37a(%rip),%rsi        # 202348 <lower_digits.0+0xe8>
+  201fce:	bf 01 00 00 00       	mov    $0x1,%edi
+  201fd3:	b8 00 00 00 00       	mov    $0x0,%eax
+  201fd8:	e8 d1 fa ff ff       	call   201aae <app_printf>
+}
+  201fdd:	e9 92 fe ff ff       	jmp    201e74 <app_print_error+0x3c>
+
+0000000000201fe2 <handle_error>:
+
+__attribute__((noreturn)) void handle_error(int r) {
+  201fe2:	55                   	push   %rbp
+  201fe3:	48 89 e5             	mov    %rsp,%rbp
+  201fe6:	53                   	push   %rbx
+  201fe7:	48 83 ec 08          	sub    $0x8,%rsp
+  201feb:	89 fb                	mov    %edi,%ebx
+    app_print_error(r);
+  201fed:	e8 46 fe ff ff       	call   201e38 <app_print_error>
+    asm volatile ("syscall" : "=a" (rax)
+  201ff2:	b8 40 00 00 00       	mov    $0x40,%eax
+  201ff7:	89 df                	mov    %ebx,%edi
+  201ff9:	0f 05                	syscall
+ spinloop: goto spinloop;       // should never get here
+  201ffb:	eb fe                	jmp    201ffb <handle_error+0x19>
+
+0000000000201ffd <malloc>:
+
+// The heap starts 1MB above the program image (PROC_START_ADDR)
+static uint8_t* heap_top = (uint8_t*) 0x300000;
+static uint8_t* page_top = (uint8_t*) 0x300000;
+
+void* malloc(size_t size) {
+  201ffd:	48 89 fe             	mov    %rdi,%rsi
+    while (ROUNDDOWN(heap_top + size, PAGESIZE) >= page_top) {
+  202000:	48 8b 05 01 10 00 00 	mov    0x1001(%rip),%rax        # 203008 <heap_top>
+  202007:	48 8d 14 38          	lea    (%rax,%rdi,1),%rdx
+  20200b:	48 8b 3d ee 0f 00 00 	mov    0xfee(%rip),%rdi        # 203000 <page_top>
+  202012:	48 89 d1             	mov    %rdx,%rcx
+  202015:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  20201c:	48 39 f9             	cmp    %rdi,%rcx
+  20201f:	72 3e                	jb     20205f <malloc+0x62>
+    asm volatile ("syscall" : "=a" (result)
+  202021:	41 b8 3b 00 00 00    	mov    $0x3b,%r8d
+  202027:	44 89 c0             	mov    %r8d,%eax
+  20202a:	0f 05                	syscall
+        int r = sys_page_alloc(page_top);
+        assert(r >= 0);
+  20202c:	85 c0                	test   %eax,%eax
+  20202e:	78 37                	js     202067 <malloc+0x6a>
+        page_top += PAGESIZE;
+  202030:	48 8b 05 c9 0f 00 00 	mov    0xfc9(%rip),%rax        # 203000 <page_top>
+  202037:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  20203e:	48 89 3d bb 0f 00 00 	mov    %rdi,0xfbb(%rip)        # 203000 <page_top>
+    while (ROUNDDOWN(heap_top + size, PAGESIZE) >= page_top) {
+  202045:	48 8b 05 bc 0f 00 00 	mov    0xfbc(%rip),%rax        # 203008 <heap_top>
+  20204c:	48 8d 14 30          	lea    (%rax,%rsi,1),%rdx
+  202050:	48 89 d1             	mov    %rdx,%rcx
+  202053:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  20205a:	48 39 f9             	cmp    %rdi,%rcx
+  20205d:	73 c8                	jae    202027 <malloc+0x2a>
+    }
+
+    void* addr = heap_top;
+    heap_top += size;
+  20205f:	48 89 15 a2 0f 00 00 	mov    %rdx,0xfa2(%rip)        # 203008 <heap_top>
+    return addr;
+}
+  202066:	c3                   	ret
+void* malloc(size_t size) {
+  202067:	55                   	push   %rbp
+  202068:	48 89 e5             	mov    %rsp,%rbp
+        assert(r >= 0);
+  20206b:	48 8d 15 cb 03 00 00 	lea    0x3cb(%rip),%rdx        # 20243d <col.0+0x5>
+  202072:	be 0b 00 00 00       	mov    $0xb,%esi
+  202077:	48 8d 3d c6 03 00 00 	lea    0x3c6(%rip),%rdi        # 202444 <col.0+0xc>
+  20207e:	e8 b0 fb ff ff       	call   201c33 <assert_fail>
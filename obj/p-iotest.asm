@@ -0,0 +1,3558 @@
+
+obj/p-iotest.full:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000200000 <fail>:
+
+static char data[PIECES][PIECE_SIZE];
+static char back[PIECES][PIECE_SIZE];
+
+
+static void __attribute__((noreturn)) fail(const char* step, ssize_t r) {
+  200000:	55                   	push   %rbp
+  200001:	48 89 e5             	mov    %rsp,%rbp
+  200004:	48 89 fa             	mov    %rdi,%rdx
+    app_printf(1, "iotest: %s failed (%d)\n", step, (int) r);
+  200007:	89 f1                	mov    %esi,%ecx
+  200009:	48 8d 35 40 23 00 00 	lea    0x2340(%rip),%rsi        # 202350 <malloc+0x92>
+  200010:	bf 01 00 00 00       	mov    $0x1,%edi
+  200015:	b8 00 00 00 00       	mov    $0x0,%eax
+  20001a:	e8 50 1d 00 00       	call   201d6f <app_printf>
+    return result;
+}
+
+static inline int sys_remove(const char *pathname) {
+    int result;
+    asm volatile ("syscall" : "=a" (result)
+  20001f:	b8 48 00 00 00       	mov    $0x48,%eax
+  200024:	48 8d 3d 3d 23 00 00 	lea    0x233d(%rip),%rdi        # 202368 <malloc+0xaa>
+  20002b:	0f 05                	syscall
+// sys_exit()
+//    Exit this process. Does not return.
+static inline void sys_exit(int exit_code) __attribute__((noreturn));
+static inline void sys_exit(int exit_code) {
+    uint64_t rax;
+    asm volatile ("syscall" : "=a" (rax)
+  20002d:	b8 40 00 00 00       	mov    $0x40,%eax
+  200032:	bf 01 00 00 00       	mov    $0x1,%edi
+  200037:	0f 05                	syscall
+                  : "a" (INT_SYS_EXIT), "D" /* %rdi */ (exit_code)
+                  : "rcx", "r11", "cc", "memory");
+ spinloop: goto spinloop;       // should never get here
+  200039:	eb fe                	jmp    200039 <fail+0x39>
+
+000000000020003b <process_main>:
+    }
+    return 1;
+}
+
+
+void process_main(void) {
+  20003b:	55                   	push   %rbp
+  20003c:	48 89 e5             	mov    %rsp,%rbp
+  20003f:	48 83 ec 40          	sub    $0x40,%rsp
+    for (int i = 0; i < PIECES; ++i) {
+  200043:	4c 8d 05 56 47 00 00 	lea    0x4756(%rip),%r8        # 2047a0 <data>
+  20004a:	45 89 c1             	mov    %r8d,%r9d
+  20004d:	41 f7 d9             	neg    %r9d
+  200050:	49 8d b8 dc 05 00 00 	lea    0x5dc(%r8),%rdi
+  200057:	4c 8d 97 70 17 00 00 	lea    0x1770(%rdi),%r10
+        for (int j = 0; j < PIECE_SIZE; ++j) {
+  20005e:	48 8d 8f 24 fa ff ff 	lea    -0x5dc(%rdi),%rcx
+            data[i][j] = 'a' + (i * 7 + j) % 26;
+  200065:	41 8d 14 09          	lea    (%r9,%rcx,1),%edx
+  200069:	48 63 c2             	movslq %edx,%rax
+  20006c:	48 69 c0 4f ec c4 4e 	imul   $0x4ec4ec4f,%rax,%rax
+  200073:	48 c1 f8 23          	sar    $0x23,%rax
+  200077:	89 d6                	mov    %edx,%esi
+  200079:	c1 fe 1f             	sar    $0x1f,%esi
+  20007c:	29 f0                	sub    %esi,%eax
+  20007e:	6b c0 1a             	imul   $0x1a,%eax,%eax
+  200081:	29 c2                	sub    %eax,%edx
+  200083:	83 c2 61             	add    $0x61,%edx
+  200086:	88 11                	mov    %dl,(%rcx)
+        for (int j = 0; j < PIECE_SIZE; ++j) {
+  200088:	48 83 c1 01          	add    $0x1,%rcx
+  20008c:	48 39 f9             	cmp    %rdi,%rcx
+  20008f:	75 d4                	jne    200065 <process_main+0x2a>
+    for (int i = 0; i < PIECES; ++i) {
+  200091:	41 81 e9 d5 05 00 00 	sub    $0x5d5,%r9d
+  200098:	48 81 c7 dc 05 00 00 	add    $0x5dc,%rdi
+  20009f:	4c 39 d7             	cmp    %r10,%rdi
+  2000a2:	75 ba                	jne    20005e <process_main+0x23>
+    asm volatile ("syscall" : "=a" (result)
+  2000a4:	b8 47 00 00 00       	mov    $0x47,%eax
+  2000a9:	48 8d 3d b8 22 00 00 	lea    0x22b8(%rip),%rdi        # 202368 <malloc+0xaa>
+  2000b0:	0f 05                	syscall
+        }
+    }
+
+    int r = sys_touch(PATH);
+    if (r < 0) handle_error(-r);
+  2000b2:	85 c0                	test   %eax,%eax
+  2000b4:	0f 88 cc 01 00 00    	js     200286 <process_main+0x24b>
+    asm volatile ("syscall" : "=a" (result)
+  2000ba:	b8 33 00 00 00       	mov    $0x33,%eax
+  2000bf:	48 8d 3d a2 22 00 00 	lea    0x22a2(%rip),%rdi        # 202368 <malloc+0xaa>
+  2000c6:	0f 05                	syscall
+  2000c8:	89 c7                	mov    %eax,%edi
+
+    int fd = sys_open(PATH);
+    if (fd < 0) fail("open", fd);
+  2000ca:	85 c0                	test   %eax,%eax
+  2000cc:	0f 88 bd 01 00 00    	js     20028f <process_main+0x254>
+
+    iovec iov[PIECES];
+    for (int i = 0; i < PIECES; ++i) {
+        iov[i].iov_base = data[i];
+  2000d2:	48 8d 05 c7 46 00 00 	lea    0x46c7(%rip),%rax        # 2047a0 <data>
+  2000d9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        iov[i].iov_len = PIECE_SIZE;
+  2000dd:	48 c7 45 c8 dc 05 00 	movq   $0x5dc,-0x38(%rbp)
+  2000e4:	00 
+        iov[i].iov_base = data[i];
+  2000e5:	48 8d 80 dc 05 00 00 	lea    0x5dc(%rax),%rax
+  2000ec:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+        iov[i].iov_len = PIECE_SIZE;
+  2000f0:	48 c7 45 d8 dc 05 00 	movq   $0x5dc,-0x28(%rbp)
+  2000f7:	00 
+        iov[i].iov_base = data[i];
+  2000f8:	48 8d 80 dc 05 00 00 	lea    0x5dc(%rax),%rax
+  2000ff:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+        iov[i].iov_len = PIECE_SIZE;
+  200103:	48 c7 45 e8 dc 05 00 	movq   $0x5dc,-0x18(%rbp)
+  20010a:	00 
+        iov[i].iov_base = data[i];
+  20010b:	48 8d 80 dc 05 00 00 	lea    0x5dc(%rax),%rax
+  200112:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+        iov[i].iov_len = PIECE_SIZE;
+  200116:	48 c7 45 f8 dc 05 00 	movq   $0x5dc,-0x8(%rbp)
+  20011d:	00 
+    asm volatile ("syscall" : "=a" (result)
+  20011e:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  200122:	b8 4f 00 00 00       	mov    $0x4f,%eax
+  200127:	ba 04 00 00 00       	mov    $0x4,%edx
+  20012c:	0f 05                	syscall
+    }
+    ssize_t n = sys_writev(fd, iov, PIECES);
+    if (n != PIECES * PIECE_SIZE) fail("writev", n);
+  20012e:	ba 00 00 00 00       	mov    $0x0,%edx
+
+    // overwrite piece 2 in place, then read it alone
+    for (int j = 0; j < PIECE_SIZE; ++j) {
+        data[2][j] = '0' + j % 10;
+  200133:	4c 8d 0d 1e 52 00 00 	lea    0x521e(%rip),%r9        # 205358 <data+0xbb8>
+    if (n != PIECES * PIECE_SIZE) fail("writev", n);
+  20013a:	48 3d 70 17 00 00    	cmp    $0x1770,%rax
+  200140:	0f 85 58 01 00 00    	jne    20029e <process_main+0x263>
+        data[2][j] = '0' + j % 10;
+  200146:	48 63 c2             	movslq %edx,%rax
+  200149:	48 69 c0 67 66 66 66 	imul   $0x66666667,%rax,%rax
+  200150:	48 c1 f8 22          	sar    $0x22,%rax
+  200154:	89 d1                	mov    %edx,%ecx
+  200156:	c1 f9 1f             	sar    $0x1f,%ecx
+  200159:	29 c8                	sub    %ecx,%eax
+  20015b:	8d 0c 80             	lea    (%rax,%rax,4),%ecx
+  20015e:	01 c9                	add    %ecx,%ecx
+  200160:	89 d0                	mov    %edx,%eax
+  200162:	29 c8                	sub    %ecx,%eax
+  200164:	83 c0 30             	add    $0x30,%eax
+  200167:	41 88 04 11          	mov    %al,(%r9,%rdx,1)
+    for (int j = 0; j < PIECE_SIZE; ++j) {
+  20016b:	48 83 c2 01          	add    $0x1,%rdx
+  20016f:	48 81 fa dc 05 00 00 	cmp    $0x5dc,%rdx
+  200176:	75 ce                	jne    200146 <process_main+0x10b>
+    register uint64_t r10 asm("r10") = offset;
+  200178:	41 ba b8 0b 00 00    	mov    $0xbb8,%r10d
+    asm volatile ("syscall" : "=a" (result)
+  20017e:	b8 4d 00 00 00       	mov    $0x4d,%eax
+  200183:	48 8d 35 ce 51 00 00 	lea    0x51ce(%rip),%rsi        # 205358 <data+0xbb8>
+  20018a:	0f 05                	syscall
+    }
+    n = sys_pwrite(fd, data[2], PIECE_SIZE, 2 * PIECE_SIZE);
+    if (n != PIECE_SIZE) fail("pwrite", n);
+  20018c:	48 3d dc 05 00 00    	cmp    $0x5dc,%rax
+  200192:	0f 85 15 01 00 00    	jne    2002ad <process_main+0x272>
+    register uint64_t r10 asm("r10") = offset;
+  200198:	41 ba b8 0b 00 00    	mov    $0xbb8,%r10d
+    asm volatile ("syscall" : "=a" (result)
+  20019e:	b8 4c 00 00 00       	mov    $0x4c,%eax
+  2001a3:	48 8d 35 2e 3a 00 00 	lea    0x3a2e(%rip),%rsi        # 203bd8 <back+0xbb8>
+  2001aa:	ba dc 05 00 00       	mov    $0x5dc,%edx
+  2001af:	0f 05                	syscall
+  2001b1:	48 89 c6             	mov    %rax,%rsi
+
+    n = sys_pread(fd, back[2], PIECE_SIZE, 2 * PIECE_SIZE);
+    if (n != PIECE_SIZE || !same(back[2], data[2], PIECE_SIZE)) fail("pread", n);
+  2001b4:	48 3d dc 05 00 00    	cmp    $0x5dc,%rax
+  2001ba:	0f 85 fc 00 00 00    	jne    2002bc <process_main+0x281>
+    for (size_t i = 0; i < n; ++i) {
+  2001c0:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (a[i] != b[i]) {
+  2001c5:	48 8d 0d 0c 3a 00 00 	lea    0x3a0c(%rip),%rcx        # 203bd8 <back+0xbb8>
+  2001cc:	48 8d 05 85 51 00 00 	lea    0x5185(%rip),%rax        # 205358 <data+0xbb8>
+  2001d3:	44 0f b6 1c 10       	movzbl (%rax,%rdx,1),%r11d
+  2001d8:	44 38 1c 11          	cmp    %r11b,(%rcx,%rdx,1)
+  2001dc:	0f 85 da 00 00 00    	jne    2002bc <process_main+0x281>
+    for (size_t i = 0; i < n; ++i) {
+  2001e2:	48 83 c2 01          	add    $0x1,%rdx
+  2001e6:	48 81 fa dc 05 00 00 	cmp    $0x5dc,%rdx
+  2001ed:	75 e4                	jne    2001d3 <process_main+0x198>
+    asm volatile ("syscall" : "=a" (result)
+  2001ef:	b8 31 00 00 00       	mov    $0x31,%eax
+  2001f4:	48 8d 35 25 2e 00 00 	lea    0x2e25(%rip),%rsi        # 203020 <back>
+  2001fb:	ba dc 05 00 00       	mov    $0x5dc,%edx
+  200200:	0f 05                	syscall
+
+    // pwrite left the offset at the end of the file: nothing to read
+    n = sys_read(fd, back[0], PIECE_SIZE);
+    if (n != 0) fail("read at end", n);
+  200202:	48 85 c0             	test   %rax,%rax
+  200205:	0f 85 bd 00 00 00    	jne    2002c8 <process_main+0x28d>
+    asm volatile ("syscall" : "=a" (result)
+  20020b:	b8 33 00 00 00       	mov    $0x33,%eax
+  200210:	48 8d 3d 51 21 00 00 	lea    0x2151(%rip),%rdi        # 202368 <malloc+0xaa>
+  200217:	0f 05                	syscall
+  200219:	89 c7                	mov    %eax,%edi
+
+    // a new descriptor reads the whole file from the start
+    fd = sys_open(PATH);
+    if (fd < 0) fail("open", fd);
+  20021b:	85 c0                	test   %eax,%eax
+  20021d:	0f 88 b4 00 00 00    	js     2002d7 <process_main+0x29c>
+    for (int i = 0; i < PIECES; ++i) {
+        iov[i].iov_base = back[i];
+  200223:	48 8d 05 f6 2d 00 00 	lea    0x2df6(%rip),%rax        # 203020 <back>
+  20022a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  20022e:	48 8d 80 dc 05 00 00 	lea    0x5dc(%rax),%rax
+  200235:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  200239:	48 8d 80 dc 05 00 00 	lea    0x5dc(%rax),%rax
+  200240:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  200244:	48 8d 80 dc 05 00 00 	lea    0x5dc(%rax),%rax
+  20024b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    asm volatile ("syscall" : "=a" (result)
+  20024f:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  200253:	b8 4e 00 00 00       	mov    $0x4e,%eax
+  200258:	ba 04 00 00 00       	mov    $0x4,%edx
+  20025d:	0f 05                	syscall
+    }
+    n = sys_readv(fd, iov, PIECES);
+    if (n != PIECES * PIECE_SIZE) fail("readv", n);
+  20025f:	48 8d 0d ba 2d 00 00 	lea    0x2dba(%rip),%rcx        # 203020 <back>
+    for (int i = 0; i < PIECES; ++i) {
+  200266:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (n != PIECES * PIECE_SIZE) fail("readv", n);
+  20026b:	48 3d 70 17 00 00    	cmp    $0x1770,%rax
+  200271:	0f 84 94 00 00 00    	je     20030b <process_main+0x2d0>
+  200277:	48 89 c6             	mov    %rax,%rsi
+  20027a:	48 8d 3d 18 21 00 00 	lea    0x2118(%rip),%rdi        # 202399 <malloc+0xdb>
+  200281:	e8 7a fd ff ff       	call   200000 <fail>
+    if (r < 0) handle_error(-r);
+  200286:	f7 d8                	neg    %eax
+  200288:	89 c7                	mov    %eax,%edi
+  20028a:	e8 14 20 00 00       	call   2022a3 <handle_error>
+    if (fd < 0) fail("open", fd);
+  20028f:	48 63 f0             	movslq %eax,%rsi
+  200292:	48 8d 3d db 20 00 00 	lea    0x20db(%rip),%rdi        # 202374 <malloc+0xb6>
+  200299:	e8 62 fd ff ff       	call   200000 <fail>
+    if (n != PIECES * PIECE_SIZE) fail("writev", n);
+  20029e:	48 89 c6             	mov    %rax,%rsi
+  2002a1:	48 8d 3d d1 20 00 00 	lea    0x20d1(%rip),%rdi        # 202379 <malloc+0xbb>
+  2002a8:	e8 53 fd ff ff       	call   200000 <fail>
+    if (n != PIECE_SIZE) fail("pwrite", n);
+  2002ad:	48 89 c6             	mov    %rax,%rsi
+  2002b0:	48 8d 3d c9 20 00 00 	lea    0x20c9(%rip),%rdi        # 202380 <malloc+0xc2>
+  2002b7:	e8 44 fd ff ff       	call   200000 <fail>
+    if (n != PIECE_SIZE || !same(back[2], data[2], PIECE_SIZE)) fail("pread", n);
+  2002bc:	48 8d 3d c4 20 00 00 	lea    0x20c4(%rip),%rdi        # 202387 <malloc+0xc9>
+  2002c3:	e8 38 fd ff ff       	call   200000 <fail>
+    if (n != 0) fail("read at end", n);
+  2002c8:	48 89 c6             	mov    %rax,%rsi
+  2002cb:	48 8d 3d bb 20 00 00 	lea    0x20bb(%rip),%rdi        # 20238d <malloc+0xcf>
+  2002d2:	e8 29 fd ff ff       	call   200000 <fail>
+    if (fd < 0) fail("open", fd);
+  2002d7:	48 63 f0             	movslq %eax,%rsi
+  2002da:	48 8d 3d 93 20 00 00 	lea    0x2093(%rip),%rdi        # 202374 <malloc+0xb6>
+  2002e1:	e8 1a fd ff ff       	call   200000 <fail>
+        if (!same(back[i], data[i], PIECE_SIZE)) fail("readv", i);
+  2002e6:	48 63 f2             	movslq %edx,%rsi
+  2002e9:	48 8d 3d a9 20 00 00 	lea    0x20a9(%rip),%rdi        # 202399 <malloc+0xdb>
+  2002f0:	e8 0b fd ff ff       	call   200000 <fail>
+    for (int i = 0; i < PIECES; ++i) {
+  2002f5:	83 c2 01             	add    $0x1,%edx
+  2002f8:	48 81 c1 dc 05 00 00 	add    $0x5dc,%rcx
+  2002ff:	49 81 c0 dc 05 00 00 	add    $0x5dc,%r8
+  200306:	83 fa 04             	cmp    $0x4,%edx
+  200309:	74 24                	je     20032f <process_main+0x2f4>
+        if (!same(back[i], data[i], PIECE_SIZE)) fail("readv", i);
+  20030b:	4c 89 c7             	mov    %r8,%rdi
+  20030e:	48 89 ce             	mov    %rcx,%rsi
+    for (size_t i = 0; i < n; ++i) {
+  200311:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (a[i] != b[i]) {
+  200316:	44 0f b6 1c 07       	movzbl (%rdi,%rax,1),%r11d
+  20031b:	44 38 1c 06          	cmp    %r11b,(%rsi,%rax,1)
+  20031f:	75 c5                	jne    2002e6 <process_main+0x2ab>
+    for (size_t i = 0; i < n; ++i) {
+  200321:	48 83 c0 01          	add    $0x1,%rax
+  200325:	48 3d dc 05 00 00    	cmp    $0x5dc,%rax
+  20032b:	75 e9                	jne    200316 <process_main+0x2db>
+  20032d:	eb c6                	jmp    2002f5 <process_main+0x2ba>
+    asm volatile ("syscall" : "=a" (result)
+  20032f:	b8 48 00 00 00       	mov    $0x48,%eax
+  200334:	48 8d 3d 2d 20 00 00 	lea    0x202d(%rip),%rdi        # 202368 <malloc+0xaa>
+  20033b:	0f 05                	syscall
+    }
+
+    r = sys_remove(PATH);
+    if (r < 0) handle_error(-r);
+  20033d:	85 c0                	test   %eax,%eax
+  20033f:	79 09                	jns    20034a <process_main+0x30f>
+  200341:	f7 d8                	neg    %eax
+  200343:	89 c7                	mov    %eax,%edi
+  200345:	e8 59 1f 00 00       	call   2022a3 <handle_error>
+
+    app_printf(0, "iotest: ok\n");
+  20034a:	48 8d 35 4e 20 00 00 	lea    0x204e(%rip),%rsi        # 20239f <malloc+0xe1>
+  200351:	bf 00 00 00 00       	mov    $0x0,%edi
+  200356:	b8 00 00 00 00       	mov    $0x0,%eax
+  20035b:	e8 0f 1a 00 00       	call   201d6f <app_printf>
+    asm volatile ("syscall" : "=a" (rax)
+  200360:	b8 40 00 00 00       	mov    $0x40,%eax
+  200365:	bf 00 00 00 00       	mov    $0x0,%edi
+  20036a:	0f 05                	syscall
+ spinloop: goto spinloop;       // should never get here
+  20036c:	eb fe                	jmp    20036c <process_main+0x331>
+
+000000000020036e <vdso>:
+// KERNEL DATA PAGE
+//
+//    The kernel keeps a read-only vdso_data (see lib.h) up to date at
+//    VDSO_ADDR. Reading it is a plain memory load, not a system call.
+
+static inline const volatile vdso_data* vdso(void) {
+  20036e:	55                   	push   %rbp
+  20036f:	48 89 e5             	mov    %rsp,%rbp
+    return (const volatile vdso_data*) VDSO_ADDR;
+  200372:	b8 00 10 24 00       	mov    $0x241000,%eax
+}
+  200377:	5d                   	pop    %rbp
+  200378:	c3                   	ret
+
+0000000000200379 <memcpy>:
+#define MEMOP_WORD_MIN 64
+
+// an unaligned word that may alias any object
+typedef uint64_t __attribute__((may_alias, aligned(1))) memop_word;
+
+void* memcpy(void* dst, const void* src, size_t n) {
+  200379:	55                   	push   %rbp
+  20037a:	48 89 e5             	mov    %rsp,%rbp
+  20037d:	48 83 ec 48          	sub    $0x48,%rsp
+  200381:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  200385:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  200389:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+    char* d = (char*) dst;
+  20038d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200391:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    const char* s = (const char*) src;
+  200395:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  200399:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (n >= MEMOP_WORD_MIN) {
+  20039d:	48 83 7d b8 3f       	cmpq   $0x3f,-0x48(%rbp)
+  2003a2:	0f 86 c5 00 00 00    	jbe    20046d <memcpy+0xf4>
+        size_t head = -(uintptr_t) d & 7;
+  2003a8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2003ac:	48 f7 d8             	neg    %rax
+  2003af:	83 e0 07             	and    $0x7,%eax
+  2003b2:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        size_t words = (n - head) / 8;
+  2003b6:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  2003ba:	48 2b 45 e8          	sub    -0x18(%rbp),%rax
+  2003be:	48 c1 e8 03          	shr    $0x3,%rax
+  2003c2:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+        n = (n - head) % 8;
+  2003c6:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  2003ca:	48 2b 45 e8          	sub    -0x18(%rbp),%rax
+  2003ce:	83 e0 07             	and    $0x7,%eax
+  2003d1:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        asm volatile("rep movsb" : "+D" (d), "+S" (s), "+c" (head)
+  2003d5:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  2003d9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  2003dd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2003e1:	48 89 cf             	mov    %rcx,%rdi
+  2003e4:	48 89 d6             	mov    %rdx,%rsi
+  2003e7:	48 89 c1             	mov    %rax,%rcx
+  2003ea:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  2003ec:	48 89 c8             	mov    %rcx,%rax
+  2003ef:	48 89 f2             	mov    %rsi,%rdx
+  2003f2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  2003f6:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  2003fa:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                     : : "memory");
+        asm volatile("rep movsq" : "+D" (d), "+S" (s), "+c" (words)
+  2003fe:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  200402:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  200406:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  20040a:	48 89 cf             	mov    %rcx,%rdi
+  20040d:	48 89 d6             	mov    %rdx,%rsi
+  200410:	48 89 c1             	mov    %rax,%rcx
+  200413:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  200416:	48 89 c8             	mov    %rcx,%rax
+  200419:	48 89 f2             	mov    %rsi,%rdx
+  20041c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  200420:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  200424:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+                     : : "memory");
+    }
+    for (; n >= 16; n -= 16, s += 16, d += 16) {
+  200428:	eb 43                	jmp    20046d <memcpy+0xf4>
+        memop_word a = ((const memop_word*) s)[0];
+  20042a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  20042e:	48 8b 00             	mov    (%rax),%rax
+  200431:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+        memop_word b = ((const memop_word*) s)[1];
+  200435:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  200439:	48 83 c0 08          	add    $0x8,%rax
+  20043d:	48 8b 00             	mov    (%rax),%rax
+  200440:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+        ((memop_word*) d)[0] = a;
+  200444:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200448:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  20044c:	48 89 10             	mov    %rdx,(%rax)
+        ((memop_word*) d)[1] = b;
+  20044f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200453:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  200457:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  20045b:	48 89 02             	mov    %rax,(%rdx)
+    for (; n >= 16; n -= 16, s += 16, d += 16) {
+  20045e:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  200463:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  200468:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  20046d:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  200472:	77 b6                	ja     20042a <memcpy+0xb1>
+    }
+    for (; n > 0; --n, ++s, ++d) {
+  200474:	eb 1c                	jmp    200492 <memcpy+0x119>
+        *d = *s;
+  200476:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  20047a:	0f b6 10             	movzbl (%rax),%edx
+  20047d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200481:	88 10                	mov    %dl,(%rax)
+    for (; n > 0; --n, ++s, ++d) {
+  200483:	48 83 6d b8 01       	subq   $0x1,-0x48(%rbp)
+  200488:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  20048d:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  200492:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  200497:	75 dd                	jne    200476 <memcpy+0xfd>
+    }
+    return dst;
+  200499:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  20049d:	c9                   	leave
+  20049e:	c3                   	ret
+
+000000000020049f <memmove>:
+
+void* memmove(void* dst, const void* src, size_t n) {
+  20049f:	55                   	push   %rbp
+  2004a0:	48 89 e5             	mov    %rsp,%rbp
+  2004a3:	48 83 ec 38          	sub    $0x38,%rsp
+  2004a7:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  2004ab:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  2004af:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    const char* s = (const char*) src;
+  2004b3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  2004b7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    char* d = (char*) dst;
+  2004bb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  2004bf:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (!(s < d && s + n > d)) {
+  2004c3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2004c7:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  2004cb:	73 11                	jae    2004de <memmove+0x3f>
+  2004cd:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  2004d1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  2004d5:	48 01 d0             	add    %rdx,%rax
+  2004d8:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  2004dc:	72 1c                	jb     2004fa <memmove+0x5b>
+        // a forward copy never overwrites source bytes it has yet to read
+        return memcpy(dst, src, n);
+  2004de:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  2004e2:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  2004e6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  2004ea:	48 89 ce             	mov    %rcx,%rsi
+  2004ed:	48 89 c7             	mov    %rax,%rdi
+  2004f0:	e8 84 fe ff ff       	call   200379 <memcpy>
+  2004f5:	e9 94 00 00 00       	jmp    20058e <memmove+0xef>
+    }
+
+    // copy backwards: the tail bytes, then words down to the start
+    size_t words = n / 8;
+  2004fa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  2004fe:	48 c1 e8 03          	shr    $0x3,%rax
+  200502:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    size_t tail = n % 8;
+  200506:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  20050a:	83 e0 07             	and    $0x7,%eax
+  20050d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    s += n - 1, d += n - 1;
+  200511:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200515:	48 83 e8 01          	sub    $0x1,%rax
+  200519:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  20051d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200521:	48 83 e8 01          	sub    $0x1,%rax
+  200525:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    asm volatile("std; rep movsb; cld" : "+D" (d), "+S" (s), "+c" (tail)
+  200529:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  20052d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  200531:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  200535:	48 89 cf             	mov    %rcx,%rdi
+  200538:	48 89 d6             	mov    %rdx,%rsi
+  20053b:	48 89 c1             	mov    %rax,%rcx
+  20053e:	fd                   	std
+  20053f:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  200541:	fc                   	cld
+  200542:	48 89 c8             	mov    %rcx,%rax
+  200545:	48 89 f2             	mov    %rsi,%rdx
+  200548:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  20054c:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  200550:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+                 : : "memory", "cc");
+    s -= 7, d -= 7;
+  200554:	48 83 6d f8 07       	subq   $0x7,-0x8(%rbp)
+  200559:	48 83 6d f0 07       	subq   $0x7,-0x10(%rbp)
+    asm volatile("std; rep movsq; cld" : "+D" (d), "+S" (s), "+c" (words)
+  20055e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  200562:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  200566:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20056a:	48 89 cf             	mov    %rcx,%rdi
+  20056d:	48 89 d6             	mov    %rdx,%rsi
+  200570:	48 89 c1             	mov    %rax,%rcx
+  200573:	fd                   	std
+  200574:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  200577:	fc                   	cld
+  200578:	48 89 c8             	mov    %rcx,%rax
+  20057b:	48 89 f2             	mov    %rsi,%rdx
+  20057e:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  200582:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  200586:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 : : "memory", "cc");
+    return dst;
+  20058a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  20058e:	c9                   	leave
+  20058f:	c3                   	ret
+
+0000000000200590 <memset>:
+
+void* memset(void* v, int c, size_t n) {
+  200590:	55                   	push   %rbp
+  200591:	48 89 e5             	mov    %rsp,%rbp
+  200594:	48 83 ec 38          	sub    $0x38,%rsp
+  200598:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  20059c:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  20059f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    char* p = (char*) v;
+  2005a3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  2005a7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    uint64_t word = (uint8_t) c * 0x0101010101010101UL;
+  2005ab:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  2005ae:	0f b6 c0             	movzbl %al,%eax
+  2005b1:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  2005b8:	01 01 01 
+  2005bb:	48 0f af c2          	imul   %rdx,%rax
+  2005bf:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (n >= MEMOP_WORD_MIN) {
+  2005c3:	48 83 7d c8 3f       	cmpq   $0x3f,-0x38(%rbp)
+  2005c8:	0f 86 9e 00 00 00    	jbe    20066c <memset+0xdc>
+        size_t head = -(uintptr_t) p & 7;
+  2005ce:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2005d2:	48 f7 d8             	neg    %rax
+  2005d5:	83 e0 07             	and    $0x7,%eax
+  2005d8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        size_t words = (n - head) / 8;
+  2005dc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  2005e0:	48 2b 45 e8          	sub    -0x18(%rbp),%rax
+  2005e4:	48 c1 e8 03          	shr    $0x3,%rax
+  2005e8:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+        n = (n - head) % 8;
+  2005ec:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  2005f0:	48 2b 45 e8          	sub    -0x18(%rbp),%rax
+  2005f4:	83 e0 07             	and    $0x7,%eax
+  2005f7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        asm volatile("rep stosb" : "+D" (p), "+c" (head) : "a" (word)
+  2005fb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2005ff:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  200603:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  200607:	48 89 ce             	mov    %rcx,%rsi
+  20060a:	48 89 f7             	mov    %rsi,%rdi
+  20060d:	48 89 d1             	mov    %rdx,%rcx
+  200610:	f3 aa                	rep stos %al,%es:(%rdi)
+  200612:	48 89 ca             	mov    %rcx,%rdx
+  200615:	48 89 fe             	mov    %rdi,%rsi
+  200618:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  20061c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+                     : "memory");
+        asm volatile("rep stosq" : "+D" (p), "+c" (words) : "a" (word)
+  200620:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  200624:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  200628:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  20062c:	48 89 ce             	mov    %rcx,%rsi
+  20062f:	48 89 f7             	mov    %rsi,%rdi
+  200632:	48 89 d1             	mov    %rdx,%rcx
+  200635:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  200638:	48 89 ca             	mov    %rcx,%rdx
+  20063b:	48 89 fe             	mov    %rdi,%rsi
+  20063e:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  200642:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+                     : "memory");
+    }
+    for (; n >= 16; n -= 16, p += 16) {
+  200646:	eb 24                	jmp    20066c <memset+0xdc>
+        ((memop_word*) p)[0] = word;
+  200648:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20064c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  200650:	48 89 10             	mov    %rdx,(%rax)
+        ((memop_word*) p)[1] = word;
+  200653:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200657:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  20065b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  20065f:	48 89 02             	mov    %rax,(%rdx)
+    for (; n >= 16; n -= 16, p += 16) {
+  200662:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  200667:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  20066c:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  200671:	77 d5                	ja     200648 <memset+0xb8>
+    }
+    for (; n > 0; ++p, --n) {
+  200673:	eb 15                	jmp    20068a <memset+0xfa>
+        *p = c;
+  200675:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  200678:	89 c2                	mov    %eax,%edx
+  20067a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20067e:	88 10                	mov    %dl,(%rax)
+    for (; n > 0; ++p, --n) {
+  200680:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  200685:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  20068a:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  20068f:	75 e4                	jne    200675 <memset+0xe5>
+    }
+    return v;
+  200691:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  200695:	c9                   	leave
+  200696:	c3                   	ret
+
+0000000000200697 <strlen>:
+
+size_t strlen(const char* s) {
+  200697:	55                   	push   %rbp
+  200698:	48 89 e5             	mov    %rsp,%rbp
+  20069b:	48 83 ec 18          	sub    $0x18,%rsp
+  20069f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    size_t n;
+    for (n = 0; *s != '\0'; ++s) {
+  2006a3:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  2006aa:	00 
+  2006ab:	eb 0a                	jmp    2006b7 <strlen+0x20>
+        ++n;
+  2006ad:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    for (n = 0; *s != '\0'; ++s) {
+  2006b2:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  2006b7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2006bb:	0f b6 00             	movzbl (%rax),%eax
+  2006be:	84 c0                	test   %al,%al
+  2006c0:	75 eb                	jne    2006ad <strlen+0x16>
+    }
+    return n;
+  2006c2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  2006c6:	c9                   	leave
+  2006c7:	c3                   	ret
+
+00000000002006c8 <strnlen>:
+
+size_t strnlen(const char* s, size_t maxlen) {
+  2006c8:	55                   	push   %rbp
+  2006c9:	48 89 e5             	mov    %rsp,%rbp
+  2006cc:	48 83 ec 20          	sub    $0x20,%rsp
+  2006d0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  2006d4:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    size_t n;
+    for (n = 0; n != maxlen && *s != '\0'; ++s) {
+  2006d8:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  2006df:	00 
+  2006e0:	eb 0a                	jmp    2006ec <strnlen+0x24>
+        ++n;
+  2006e2:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    for (n = 0; n != maxlen && *s != '\0'; ++s) {
+  2006e7:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  2006ec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2006f0:	48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+  2006f4:	74 0b                	je     200701 <strnlen+0x39>
+  2006f6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2006fa:	0f b6 00             	movzbl (%rax),%eax
+  2006fd:	84 c0                	test   %al,%al
+  2006ff:	75 e1                	jne    2006e2 <strnlen+0x1a>
+    }
+    return n;
+  200701:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  200705:	c9                   	leave
+  200706:	c3                   	ret
+
+0000000000200707 <strcpy>:
+
+char* strcpy(char* dst, const char* src) {
+  200707:	55                   	push   %rbp
+  200708:	48 89 e5             	mov    %rsp,%rbp
+  20070b:	48 83 ec 20          	sub    $0x20,%rsp
+  20070f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  200713:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    char* d = dst;
+  200717:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20071b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    do {
+        *d++ = *src++;
+  20071f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  200723:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  200727:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  20072b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20072f:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  200733:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+  200737:	0f b6 12             	movzbl (%rdx),%edx
+  20073a:	88 10                	mov    %dl,(%rax)
+    } while (d[-1]);
+  20073c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200740:	48 83 e8 01          	sub    $0x1,%rax
+  200744:	0f b6 00             	movzbl (%rax),%eax
+  200747:	84 c0                	test   %al,%al
+  200749:	75 d4                	jne    20071f <strcpy+0x18>
+    return dst;
+  20074b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  20074f:	c9                   	leave
+  200750:	c3                   	ret
+
+0000000000200751 <strcmp>:
+
+int strcmp(const char* a, const char* b) {
+  200751:	55                   	push   %rbp
+  200752:	48 89 e5             	mov    %rsp,%rbp
+  200755:	48 83 ec 10          	sub    $0x10,%rsp
+  200759:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  20075d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    while (*a && *b && *a == *b) {
+  200761:	eb 0a                	jmp    20076d <strcmp+0x1c>
+        ++a, ++b;
+  200763:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  200768:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+    while (*a && *b && *a == *b) {
+  20076d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200771:	0f b6 00             	movzbl (%rax),%eax
+  200774:	84 c0                	test   %al,%al
+  200776:	74 1d                	je     200795 <strcmp+0x44>
+  200778:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  20077c:	0f b6 00             	movzbl (%rax),%eax
+  20077f:	84 c0                	test   %al,%al
+  200781:	74 12                	je     200795 <strcmp+0x44>
+  200783:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200787:	0f b6 10             	movzbl (%rax),%edx
+  20078a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  20078e:	0f b6 00             	movzbl (%rax),%eax
+  200791:	38 c2                	cmp    %al,%dl
+  200793:	74 ce                	je     200763 <strcmp+0x12>
+    }
+    return ((unsigned char) *a > (unsigned char) *b)
+  200795:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200799:	0f b6 00             	movzbl (%rax),%eax
+  20079c:	89 c2                	mov    %eax,%edx
+  20079e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2007a2:	0f b6 00             	movzbl (%rax),%eax
+  2007a5:	38 d0                	cmp    %dl,%al
+  2007a7:	0f 92 c0             	setb   %al
+  2007aa:	0f b6 d0             	movzbl %al,%edx
+        - ((unsigned char) *a < (unsigned char) *b);
+  2007ad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2007b1:	0f b6 00             	movzbl (%rax),%eax
+  2007b4:	89 c1                	mov    %eax,%ecx
+  2007b6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2007ba:	0f b6 00             	movzbl (%rax),%eax
+  2007bd:	38 c1                	cmp    %al,%cl
+  2007bf:	0f 92 c0             	setb   %al
+  2007c2:	0f b6 c0             	movzbl %al,%eax
+  2007c5:	29 c2                	sub    %eax,%edx
+  2007c7:	89 d0                	mov    %edx,%eax
+}
+  2007c9:	c9                   	leave
+  2007ca:	c3                   	ret
+
+00000000002007cb <strchr>:
+
+char* strchr(const char* s, int c) {
+  2007cb:	55                   	push   %rbp
+  2007cc:	48 89 e5             	mov    %rsp,%rbp
+  2007cf:	48 83 ec 10          	sub    $0x10,%rsp
+  2007d3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  2007d7:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    while (*s && *s != (char) c) {
+  2007da:	eb 05                	jmp    2007e1 <strchr+0x16>
+        ++s;
+  2007dc:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    while (*s && *s != (char) c) {
+  2007e1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2007e5:	0f b6 00             	movzbl (%rax),%eax
+  2007e8:	84 c0                	test   %al,%al
+  2007ea:	74 0e                	je     2007fa <strchr+0x2f>
+  2007ec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2007f0:	0f b6 00             	movzbl (%rax),%eax
+  2007f3:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  2007f6:	38 d0                	cmp    %dl,%al
+  2007f8:	75 e2                	jne    2007dc <strchr+0x11>
+    }
+    if (*s == (char) c) {
+  2007fa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2007fe:	0f b6 00             	movzbl (%rax),%eax
+  200801:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  200804:	38 d0                	cmp    %dl,%al
+  200806:	75 06                	jne    20080e <strchr+0x43>
+        return (char*) s;
+  200808:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20080c:	eb 05                	jmp    200813 <strchr+0x48>
+    } else {
+        return NULL;
+  20080e:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+}
+  200813:	c9                   	leave
+  200814:	c3                   	ret
+
+0000000000200815 <rand>:
+
+// New randomness implementation
+static int      rand_seed_set;
+static unsigned rand_seed;
+
+int rand(void) {
+  200815:	55                   	push   %rbp
+  200816:	48 89 e5             	mov    %rsp,%rbp
+  200819:	48 83 ec 10          	sub    $0x10,%rsp
+    if (!rand_seed_set) {
+  20081d:	8b 05 ed 56 00 00    	mov    0x56ed(%rip),%eax        # 205f10 <rand_seed_set>
+  200823:	85 c0                	test   %eax,%eax
+  200825:	75 2c                	jne    200853 <rand+0x3e>
+#if WEENSYOS_KERNEL
+        extern unsigned get_entropy_value(void);
+        srand(get_entropy_value());
+#else           // user‑space build
+       /* kernel-refreshed seed from the kernel data page: no system call */
+       srand((unsigned) (vdso()->seed[0] ^ read_cycle_counter()));
+  200827:	e8 42 fb ff ff       	call   20036e <vdso>
+  20082c:	48 8b 40 18          	mov    0x18(%rax),%rax
+  200830:	89 c1                	mov    %eax,%ecx
+    }
+}
+
+static inline uint64_t read_cycle_counter(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+  200832:	0f 31                	rdtsc
+  200834:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  200837:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    return ((uint64_t) hi << 32) | lo;
+  20083a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  20083d:	48 c1 e0 20          	shl    $0x20,%rax
+  200841:	48 89 c2             	mov    %rax,%rdx
+  200844:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  200847:	48 09 d0             	or     %rdx,%rax
+  20084a:	31 c8                	xor    %ecx,%eax
+  20084c:	89 c7                	mov    %eax,%edi
+  20084e:	e8 24 00 00 00       	call   200877 <srand>
+#endif
+    }
+    rand_seed = rand_seed * 1664525U + 1013904223U;   // LCG
+  200853:	8b 05 bb 56 00 00    	mov    0x56bb(%rip),%eax        # 205f14 <rand_seed>
+  200859:	69 c0 0d 66 19 00    	imul   $0x19660d,%eax,%eax
+  20085f:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+  200864:	89 05 aa 56 00 00    	mov    %eax,0x56aa(%rip)        # 205f14 <rand_seed>
+    return rand_seed & RAND_MAX;
+  20086a:	8b 05 a4 56 00 00    	mov    0x56a4(%rip),%eax        # 205f14 <rand_seed>
+  200870:	25 ff ff ff 7f       	and    $0x7fffffff,%eax
+}
+  200875:	c9                   	leave
+  200876:	c3                   	ret
+
+0000000000200877 <srand>:
+
+void srand(unsigned seed) {
+  200877:	55                   	push   %rbp
+  200878:	48 89 e5             	mov    %rsp,%rbp
+  20087b:	48 83 ec 08          	sub    $0x8,%rsp
+  20087f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+    rand_seed      = seed;
+  200882:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  200885:	89 05 89 56 00 00    	mov    %eax,0x5689(%rip)        # 205f14 <rand_seed>
+    rand_seed_set  = 1;
+  20088b:	c7 05 7b 56 00 00 01 	movl   $0x1,0x567b(%rip)        # 205f10 <rand_seed_set>
+  200892:	00 00 00 
+}
+  200895:	90                   	nop
+  200896:	c9                   	leave
+  200897:	c3                   	ret
+
+0000000000200898 <fill_numbuf>:
+//    Print a message onto the console, starting at the given cursor position.
+
+// snprintf, vsnprintf
+//    Format a string into a buffer.
+
+static char* fill_numbuf(char* numbuf_end, unsigned long val, int base) {
+  200898:	55                   	push   %rbp
+  200899:	48 89 e5             	mov    %rsp,%rbp
+  20089c:	48 83 ec 28          	sub    $0x28,%rsp
+  2008a0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  2008a4:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  2008a8:	89 55 dc             	mov    %edx,-0x24(%rbp)
+    static const char upper_digits[] = "0123456789ABCDEF";
+    static const char lower_digits[] = "0123456789abcdef";
+
+    const char* digits = upper_digits;
+  2008ab:	48 8d 05 4e 1c 00 00 	lea    0x1c4e(%rip),%rax        # 202500 <upper_digits.1>
+  2008b2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (base < 0) {
+  2008b6:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  2008ba:	79 0e                	jns    2008ca <fill_numbuf+0x32>
+        digits = lower_digits;
+  2008bc:	48 8d 05 5d 1c 00 00 	lea    0x1c5d(%rip),%rax        # 202520 <lower_digits.0>
+  2008c3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+        base = -base;
+  2008c7:	f7 5d dc             	negl   -0x24(%rbp)
+    }
+
+    *--numbuf_end = '\0';
+  2008ca:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  2008cf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2008d3:	c6 00 00             	movb   $0x0,(%rax)
+    do {
+        *--numbuf_end = digits[val % base];
+  2008d6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  2008d9:	48 63 c8             	movslq %eax,%rcx
+  2008dc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  2008e0:	ba 00 00 00 00       	mov    $0x0,%edx
+  2008e5:	48 f7 f1             	div    %rcx
+  2008e8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2008ec:	48 01 d0             	add    %rdx,%rax
+  2008ef:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  2008f4:	0f b6 10             	movzbl (%rax),%edx
+  2008f7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2008fb:	88 10                	mov    %dl,(%rax)
+        val /= base;
+  2008fd:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  200900:	48 63 f0             	movslq %eax,%rsi
+  200903:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  200907:	ba 00 00 00 00       	mov    $0x0,%edx
+  20090c:	48 f7 f6             	div    %rsi
+  20090f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    } while (val != 0);
+  200913:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  200918:	75 bc                	jne    2008d6 <fill_numbuf+0x3e>
+    return numbuf_end;
+  20091a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  20091e:	c9                   	leave
+  20091f:	c3                   	ret
+
+0000000000200920 <printer_vprintf>:
+#define FLAG_NUMERIC            (1<<5)
+#define FLAG_SIGNED             (1<<6)
+#define FLAG_NEGATIVE           (1<<7)
+#define FLAG_ALT2               (1<<8)
+
+void printer_vprintf(printer* p, int color, const char* format, va_list val) {
+  200920:	55                   	push   %rbp
+  200921:	48 89 e5             	mov    %rsp,%rbp
+  200924:	53                   	push   %rbx
+  200925:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  20092c:	48 89 bd 78 ff ff ff 	mov    %rdi,-0x88(%rbp)
+  200933:	89 b5 74 ff ff ff    	mov    %esi,-0x8c(%rbp)
+  200939:	48 89 95 68 ff ff ff 	mov    %rdx,-0x98(%rbp)
+  200940:	48 89 8d 60 ff ff ff 	mov    %rcx,-0xa0(%rbp)
+#define NUMBUFSIZ 24
+    char numbuf[NUMBUFSIZ];
+
+    for (; *format; ++format) {
+  200947:	e9 be 09 00 00       	jmp    20130a <printer_vprintf+0x9ea>
+        if (*format != '%') {
+  20094c:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200953:	0f b6 00             	movzbl (%rax),%eax
+  200956:	3c 25                	cmp    $0x25,%al
+  200958:	74 31                	je     20098b <printer_vprintf+0x6b>
+            p->putc(p, *format, color);
+  20095a:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200961:	4c 8b 00             	mov    (%rax),%r8
+  200964:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  20096b:	0f b6 00             	movzbl (%rax),%eax
+  20096e:	0f b6 c8             	movzbl %al,%ecx
+  200971:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  200977:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  20097e:	89 ce                	mov    %ecx,%esi
+  200980:	48 89 c7             	mov    %rax,%rdi
+  200983:	41 ff d0             	call   *%r8
+            continue;
+  200986:	e9 77 09 00 00       	jmp    201302 <printer_vprintf+0x9e2>
+        }
+
+        // process flags
+        int flags = 0;
+  20098b:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+        for (++format; *format; ++format) {
+  200992:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  200999:	01 
+  20099a:	eb 4f                	jmp    2009eb <printer_vprintf+0xcb>
+            const char* flagc = strchr(flag_chars, *format);
+  20099c:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  2009a3:	0f b6 00             	movzbl (%rax),%eax
+  2009a6:	0f be c0             	movsbl %al,%eax
+  2009a9:	89 c6                	mov    %eax,%esi
+  2009ab:	48 8d 05 fe 19 00 00 	lea    0x19fe(%rip),%rax        # 2023b0 <flag_chars>
+  2009b2:	48 89 c7             	mov    %rax,%rdi
+  2009b5:	e8 11 fe ff ff       	call   2007cb <strchr>
+  2009ba:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (flagc) {
+  2009be:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  2009c3:	74 36                	je     2009fb <printer_vprintf+0xdb>
+                flags |= 1 << (flagc - flag_chars);
+  2009c5:	48 8d 05 e4 19 00 00 	lea    0x19e4(%rip),%rax        # 2023b0 <flag_chars>
+  2009cc:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  2009d0:	48 29 c2             	sub    %rax,%rdx
+  2009d3:	89 d0                	mov    %edx,%eax
+  2009d5:	ba 01 00 00 00       	mov    $0x1,%edx
+  2009da:	89 c1                	mov    %eax,%ecx
+  2009dc:	d3 e2                	shl    %cl,%edx
+  2009de:	89 d0                	mov    %edx,%eax
+  2009e0:	09 45 ec             	or     %eax,-0x14(%rbp)
+        for (++format; *format; ++format) {
+  2009e3:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  2009ea:	01 
+  2009eb:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  2009f2:	0f b6 00             	movzbl (%rax),%eax
+  2009f5:	84 c0                	test   %al,%al
+  2009f7:	75 a3                	jne    20099c <printer_vprintf+0x7c>
+  2009f9:	eb 01                	jmp    2009fc <printer_vprintf+0xdc>
+            } else {
+                break;
+  2009fb:	90                   	nop
+            }
+        }
+
+        // process width
+        int width = -1;
+  2009fc:	c7 45 e8 ff ff ff ff 	movl   $0xffffffff,-0x18(%rbp)
+        if (*format >= '1' && *format <= '9') {
+  200a03:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200a0a:	0f b6 00             	movzbl (%rax),%eax
+  200a0d:	3c 30                	cmp    $0x30,%al
+  200a0f:	7e 67                	jle    200a78 <printer_vprintf+0x158>
+  200a11:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200a18:	0f b6 00             	movzbl (%rax),%eax
+  200a1b:	3c 39                	cmp    $0x39,%al
+  200a1d:	7f 59                	jg     200a78 <printer_vprintf+0x158>
+            for (width = 0; *format >= '0' && *format <= '9'; ) {
+  200a1f:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%rbp)
+  200a26:	eb 2e                	jmp    200a56 <printer_vprintf+0x136>
+                width = 10 * width + *format++ - '0';
+  200a28:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  200a2b:	89 d0                	mov    %edx,%eax
+  200a2d:	c1 e0 02             	shl    $0x2,%eax
+  200a30:	01 d0                	add    %edx,%eax
+  200a32:	01 c0                	add    %eax,%eax
+  200a34:	89 c1                	mov    %eax,%ecx
+  200a36:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200a3d:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  200a41:	48 89 95 68 ff ff ff 	mov    %rdx,-0x98(%rbp)
+  200a48:	0f b6 00             	movzbl (%rax),%eax
+  200a4b:	0f be c0             	movsbl %al,%eax
+  200a4e:	01 c8                	add    %ecx,%eax
+  200a50:	83 e8 30             	sub    $0x30,%eax
+  200a53:	89 45 e8             	mov    %eax,-0x18(%rbp)
+            for (width = 0; *format >= '0' && *format <= '9'; ) {
+  200a56:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200a5d:	0f b6 00             	movzbl (%rax),%eax
+  200a60:	3c 2f                	cmp    $0x2f,%al
+  200a62:	0f 8e 85 00 00 00    	jle    200aed <printer_vprintf+0x1cd>
+  200a68:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200a6f:	0f b6 00             	movzbl (%rax),%eax
+  200a72:	3c 39                	cmp    $0x39,%al
+  200a74:	7e b2                	jle    200a28 <printer_vprintf+0x108>
+        if (*format >= '1' && *format <= '9') {
+  200a76:	eb 75                	jmp    200aed <printer_vprintf+0x1cd>
+            }
+        } else if (*format == '*') {
+  200a78:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200a7f:	0f b6 00             	movzbl (%rax),%eax
+  200a82:	3c 2a                	cmp    $0x2a,%al
+  200a84:	75 68                	jne    200aee <printer_vprintf+0x1ce>
+            width = va_arg(val, int);
+  200a86:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200a8d:	8b 00                	mov    (%rax),%eax
+  200a8f:	83 f8 2f             	cmp    $0x2f,%eax
+  200a92:	77 30                	ja     200ac4 <printer_vprintf+0x1a4>
+  200a94:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200a9b:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200a9f:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200aa6:	8b 00                	mov    (%rax),%eax
+  200aa8:	89 c0                	mov    %eax,%eax
+  200aaa:	48 01 d0             	add    %rdx,%rax
+  200aad:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200ab4:	8b 12                	mov    (%rdx),%edx
+  200ab6:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200ab9:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200ac0:	89 0a                	mov    %ecx,(%rdx)
+  200ac2:	eb 1a                	jmp    200ade <printer_vprintf+0x1be>
+  200ac4:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200acb:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200acf:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200ad3:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200ada:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200ade:	8b 00                	mov    (%rax),%eax
+  200ae0:	89 45 e8             	mov    %eax,-0x18(%rbp)
+            ++format;
+  200ae3:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  200aea:	01 
+  200aeb:	eb 01                	jmp    200aee <printer_vprintf+0x1ce>
+        if (*format >= '1' && *format <= '9') {
+  200aed:	90                   	nop
+        }
+
+        // process precision
+        int precision = -1;
+  200aee:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%rbp)
+        if (*format == '.') {
+  200af5:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200afc:	0f b6 00             	movzbl (%rax),%eax
+  200aff:	3c 2e                	cmp    $0x2e,%al
+  200b01:	0f 85 00 01 00 00    	jne    200c07 <printer_vprintf+0x2e7>
+            ++format;
+  200b07:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  200b0e:	01 
+            if (*format >= '0' && *format <= '9') {
+  200b0f:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200b16:	0f b6 00             	movzbl (%rax),%eax
+  200b19:	3c 2f                	cmp    $0x2f,%al
+  200b1b:	7e 67                	jle    200b84 <printer_vprintf+0x264>
+  200b1d:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200b24:	0f b6 00             	movzbl (%rax),%eax
+  200b27:	3c 39                	cmp    $0x39,%al
+  200b29:	7f 59                	jg     200b84 <printer_vprintf+0x264>
+                for (precision = 0; *format >= '0' && *format <= '9'; ) {
+  200b2b:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%rbp)
+  200b32:	eb 2e                	jmp    200b62 <printer_vprintf+0x242>
+                    precision = 10 * precision + *format++ - '0';
+  200b34:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  200b37:	89 d0                	mov    %edx,%eax
+  200b39:	c1 e0 02             	shl    $0x2,%eax
+  200b3c:	01 d0                	add    %edx,%eax
+  200b3e:	01 c0                	add    %eax,%eax
+  200b40:	89 c1                	mov    %eax,%ecx
+  200b42:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200b49:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  200b4d:	48 89 95 68 ff ff ff 	mov    %rdx,-0x98(%rbp)
+  200b54:	0f b6 00             	movzbl (%rax),%eax
+  200b57:	0f be c0             	movsbl %al,%eax
+  200b5a:	01 c8                	add    %ecx,%eax
+  200b5c:	83 e8 30             	sub    $0x30,%eax
+  200b5f:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+                for (precision = 0; *format >= '0' && *format <= '9'; ) {
+  200b62:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200b69:	0f b6 00             	movzbl (%rax),%eax
+  200b6c:	3c 2f                	cmp    $0x2f,%al
+  200b6e:	0f 8e 85 00 00 00    	jle    200bf9 <printer_vprintf+0x2d9>
+  200b74:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200b7b:	0f b6 00             	movzbl (%rax),%eax
+  200b7e:	3c 39                	cmp    $0x39,%al
+  200b80:	7e b2                	jle    200b34 <printer_vprintf+0x214>
+            if (*format >= '0' && *format <= '9') {
+  200b82:	eb 75                	jmp    200bf9 <printer_vprintf+0x2d9>
+                }
+            } else if (*format == '*') {
+  200b84:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200b8b:	0f b6 00             	movzbl (%rax),%eax
+  200b8e:	3c 2a                	cmp    $0x2a,%al
+  200b90:	75 68                	jne    200bfa <printer_vprintf+0x2da>
+                precision = va_arg(val, int);
+  200b92:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200b99:	8b 00                	mov    (%rax),%eax
+  200b9b:	83 f8 2f             	cmp    $0x2f,%eax
+  200b9e:	77 30                	ja     200bd0 <printer_vprintf+0x2b0>
+  200ba0:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200ba7:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200bab:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200bb2:	8b 00                	mov    (%rax),%eax
+  200bb4:	89 c0                	mov    %eax,%eax
+  200bb6:	48 01 d0             	add    %rdx,%rax
+  200bb9:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200bc0:	8b 12                	mov    (%rdx),%edx
+  200bc2:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200bc5:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200bcc:	89 0a                	mov    %ecx,(%rdx)
+  200bce:	eb 1a                	jmp    200bea <printer_vprintf+0x2ca>
+  200bd0:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200bd7:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200bdb:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200bdf:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200be6:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200bea:	8b 00                	mov    (%rax),%eax
+  200bec:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+                ++format;
+  200bef:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  200bf6:	01 
+  200bf7:	eb 01                	jmp    200bfa <printer_vprintf+0x2da>
+            if (*format >= '0' && *format <= '9') {
+  200bf9:	90                   	nop
+            }
+            if (precision < 0) {
+  200bfa:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  200bfe:	79 07                	jns    200c07 <printer_vprintf+0x2e7>
+                precision = 0;
+  200c00:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%rbp)
+            }
+        }
+
+        // process main conversion character
+        int base = 10;
+  200c07:	c7 45 e0 0a 00 00 00 	movl   $0xa,-0x20(%rbp)
+        unsigned long num = 0;
+  200c0e:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  200c15:	00 
+        int length = 0;
+  200c16:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+        char* data = "";
+  200c1d:	48 8d 05 92 17 00 00 	lea    0x1792(%rip),%rax        # 2023b6 <flag_chars+0x6>
+  200c24:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    again:
+        switch (*format) {
+  200c28:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200c2f:	0f b6 00             	movzbl (%rax),%eax
+  200c32:	0f be c0             	movsbl %al,%eax
+  200c35:	83 e8 43             	sub    $0x43,%eax
+  200c38:	83 f8 37             	cmp    $0x37,%eax
+  200c3b:	0f 87 b5 03 00 00    	ja     200ff6 <printer_vprintf+0x6d6>
+  200c41:	89 c0                	mov    %eax,%eax
+  200c43:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  200c4a:	00 
+  200c4b:	48 8d 05 72 17 00 00 	lea    0x1772(%rip),%rax        # 2023c4 <flag_chars+0x14>
+  200c52:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+  200c55:	48 98                	cltq
+  200c57:	48 8d 15 66 17 00 00 	lea    0x1766(%rip),%rdx        # 2023c4 <flag_chars+0x14>
+  200c5e:	48 01 d0             	add    %rdx,%rax
+  200c61:	ff e0                	jmp    *%rax
+        case 'l':
+        case 'z':
+            length = 1;
+  200c63:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+            ++format;
+  200c6a:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  200c71:	01 
+            goto again;
+  200c72:	eb b4                	jmp    200c28 <printer_vprintf+0x308>
+        case 'd':
+        case 'i': {
+            long x = length ? va_arg(val, long) : va_arg(val, int);
+  200c74:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  200c78:	74 5d                	je     200cd7 <printer_vprintf+0x3b7>
+  200c7a:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c81:	8b 00                	mov    (%rax),%eax
+  200c83:	83 f8 2f             	cmp    $0x2f,%eax
+  200c86:	77 30                	ja     200cb8 <printer_vprintf+0x398>
+  200c88:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c8f:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200c93:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c9a:	8b 00                	mov    (%rax),%eax
+  200c9c:	89 c0                	mov    %eax,%eax
+  200c9e:	48 01 d0             	add    %rdx,%rax
+  200ca1:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200ca8:	8b 12                	mov    (%rdx),%edx
+  200caa:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200cad:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200cb4:	89 0a                	mov    %ecx,(%rdx)
+  200cb6:	eb 1a                	jmp    200cd2 <printer_vprintf+0x3b2>
+  200cb8:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200cbf:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200cc3:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200cc7:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200cce:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200cd2:	48 8b 00             	mov    (%rax),%rax
+  200cd5:	eb 5c                	jmp    200d33 <printer_vprintf+0x413>
+  200cd7:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200cde:	8b 00                	mov    (%rax),%eax
+  200ce0:	83 f8 2f             	cmp    $0x2f,%eax
+  200ce3:	77 30                	ja     200d15 <printer_vprintf+0x3f5>
+  200ce5:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200cec:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200cf0:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200cf7:	8b 00                	mov    (%rax),%eax
+  200cf9:	89 c0                	mov    %eax,%eax
+  200cfb:	48 01 d0             	add    %rdx,%rax
+  200cfe:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200d05:	8b 12                	mov    (%rdx),%edx
+  200d07:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200d0a:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200d11:	89 0a                	mov    %ecx,(%rdx)
+  200d13:	eb 1a                	jmp    200d2f <printer_vprintf+0x40f>
+  200d15:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200d1c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200d20:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200d24:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200d2b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200d2f:	8b 00                	mov    (%rax),%eax
+  200d31:	48 98                	cltq
+  200d33:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+            int negative = x < 0 ? FLAG_NEGATIVE : 0;
+  200d37:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  200d3b:	48 c1 f8 38          	sar    $0x38,%rax
+  200d3f:	25 80 00 00 00       	and    $0x80,%eax
+  200d44:	89 45 a4             	mov    %eax,-0x5c(%rbp)
+            num = negative ? -x : x;
+  200d47:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  200d4b:	74 09                	je     200d56 <printer_vprintf+0x436>
+  200d4d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  200d51:	48 f7 d8             	neg    %rax
+  200d54:	eb 04                	jmp    200d5a <printer_vprintf+0x43a>
+  200d56:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  200d5a:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+            flags |= FLAG_NUMERIC | FLAG_SIGNED | negative;
+  200d5e:	8b 45 a4             	mov    -0x5c(%rbp),%eax
+  200d61:	83 c8 60             	or     $0x60,%eax
+  200d64:	09 45 ec             	or     %eax,-0x14(%rbp)
+            break;
+  200d67:	e9 cf 02 00 00       	jmp    20103b <printer_vprintf+0x71b>
+        }
+        case 'u':
+        format_unsigned:
+            num = length ? va_arg(val, unsigned long) : va_arg(val, unsigned);
+  200d6c:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  200d70:	74 5d                	je     200dcf <printer_vprintf+0x4af>
+  200d72:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200d79:	8b 00                	mov    (%rax),%eax
+  200d7b:	83 f8 2f             	cmp    $0x2f,%eax
+  200d7e:	77 30                	ja     200db0 <printer_vprintf+0x490>
+  200d80:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200d87:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200d8b:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200d92:	8b 00                	mov    (%rax),%eax
+  200d94:	89 c0                	mov    %eax,%eax
+  200d96:	48 01 d0             	add    %rdx,%rax
+  200d99:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200da0:	8b 12                	mov    (%rdx),%edx
+  200da2:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200da5:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200dac:	89 0a                	mov    %ecx,(%rdx)
+  200dae:	eb 1a                	jmp    200dca <printer_vprintf+0x4aa>
+  200db0:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200db7:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200dbb:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200dbf:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200dc6:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200dca:	48 8b 00             	mov    (%rax),%rax
+  200dcd:	eb 5c                	jmp    200e2b <printer_vprintf+0x50b>
+  200dcf:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200dd6:	8b 00                	mov    (%rax),%eax
+  200dd8:	83 f8 2f             	cmp    $0x2f,%eax
+  200ddb:	77 30                	ja     200e0d <printer_vprintf+0x4ed>
+  200ddd:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200de4:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200de8:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200def:	8b 00                	mov    (%rax),%eax
+  200df1:	89 c0                	mov    %eax,%eax
+  200df3:	48 01 d0             	add    %rdx,%rax
+  200df6:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200dfd:	8b 12                	mov    (%rdx),%edx
+  200dff:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200e02:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200e09:	89 0a                	mov    %ecx,(%rdx)
+  200e0b:	eb 1a                	jmp    200e27 <printer_vprintf+0x507>
+  200e0d:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200e14:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200e18:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200e1c:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200e23:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200e27:	8b 00                	mov    (%rax),%eax
+  200e29:	89 c0                	mov    %eax,%eax
+  200e2b:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+            flags |= FLAG_NUMERIC;
+  200e2f:	83 4d ec 20          	orl    $0x20,-0x14(%rbp)
+            break;
+  200e33:	e9 03 02 00 00       	jmp    20103b <printer_vprintf+0x71b>
+        case 'x':
+            base = -16;
+  200e38:	c7 45 e0 f0 ff ff ff 	movl   $0xfffffff0,-0x20(%rbp)
+            goto format_unsigned;
+  200e3f:	e9 28 ff ff ff       	jmp    200d6c <printer_vprintf+0x44c>
+        case 'X':
+            base = 16;
+  200e44:	c7 45 e0 10 00 00 00 	movl   $0x10,-0x20(%rbp)
+            goto format_unsigned;
+  200e4b:	e9 1c ff ff ff       	jmp    200d6c <printer_vprintf+0x44c>
+        case 'p':
+            num = (uintptr_t) va_arg(val, void*);
+  200e50:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200e57:	8b 00                	mov    (%rax),%eax
+  200e59:	83 f8 2f             	cmp    $0x2f,%eax
+  200e5c:	77 30                	ja     200e8e <printer_vprintf+0x56e>
+  200e5e:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200e65:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200e69:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200e70:	8b 00                	mov    (%rax),%eax
+  200e72:	89 c0                	mov    %eax,%eax
+  200e74:	48 01 d0             	add    %rdx,%rax
+  200e77:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200e7e:	8b 12                	mov    (%rdx),%edx
+  200e80:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200e83:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200e8a:	89 0a                	mov    %ecx,(%rdx)
+  200e8c:	eb 1a                	jmp    200ea8 <printer_vprintf+0x588>
+  200e8e:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200e95:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200e99:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200e9d:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200ea4:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200ea8:	48 8b 00             	mov    (%rax),%rax
+  200eab:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+            base = -16;
+  200eaf:	c7 45 e0 f0 ff ff ff 	movl   $0xfffffff0,-0x20(%rbp)
+            flags |= FLAG_ALT | FLAG_ALT2 | FLAG_NUMERIC;
+  200eb6:	81 4d ec 21 01 00 00 	orl    $0x121,-0x14(%rbp)
+            break;
+  200ebd:	e9 79 01 00 00       	jmp    20103b <printer_vprintf+0x71b>
+        case 's':
+            data = va_arg(val, char*);
+  200ec2:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200ec9:	8b 00                	mov    (%rax),%eax
+  200ecb:	83 f8 2f             	cmp    $0x2f,%eax
+  200ece:	77 30                	ja     200f00 <printer_vprintf+0x5e0>
+  200ed0:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200ed7:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200edb:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200ee2:	8b 00                	mov    (%rax),%eax
+  200ee4:	89 c0                	mov    %eax,%eax
+  200ee6:	48 01 d0             	add    %rdx,%rax
+  200ee9:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200ef0:	8b 12                	mov    (%rdx),%edx
+  200ef2:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200ef5:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200efc:	89 0a                	mov    %ecx,(%rdx)
+  200efe:	eb 1a                	jmp    200f1a <printer_vprintf+0x5fa>
+  200f00:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200f07:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200f0b:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200f0f:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200f16:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200f1a:	48 8b 00             	mov    (%rax),%rax
+  200f1d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+            break;
+  200f21:	e9 15 01 00 00       	jmp    20103b <printer_vprintf+0x71b>
+        case 'C':
+            color = va_arg(val, int);
+  200f26:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200f2d:	8b 00                	mov    (%rax),%eax
+  200f2f:	83 f8 2f             	cmp    $0x2f,%eax
+  200f32:	77 30                	ja     200f64 <printer_vprintf+0x644>
+  200f34:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200f3b:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200f3f:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200f46:	8b 00                	mov    (%rax),%eax
+  200f48:	89 c0                	mov    %eax,%eax
+  200f4a:	48 01 d0             	add    %rdx,%rax
+  200f4d:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200f54:	8b 12                	mov    (%rdx),%edx
+  200f56:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200f59:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200f60:	89 0a                	mov    %ecx,(%rdx)
+  200f62:	eb 1a                	jmp    200f7e <printer_vprintf+0x65e>
+  200f64:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200f6b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200f6f:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200f73:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200f7a:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200f7e:	8b 00                	mov    (%rax),%eax
+  200f80:	89 85 74 ff ff ff    	mov    %eax,-0x8c(%rbp)
+            goto done;
+  200f86:	e9 77 03 00 00       	jmp    201302 <printer_vprintf+0x9e2>
+        case 'c':
+            data = numbuf;
+  200f8b:	48 8d 45 8c          	lea    -0x74(%rbp),%rax
+  200f8f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+            numbuf[0] = va_arg(val, int);
+  200f93:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200f9a:	8b 00                	mov    (%rax),%eax
+  200f9c:	83 f8 2f             	cmp    $0x2f,%eax
+  200f9f:	77 30                	ja     200fd1 <printer_vprintf+0x6b1>
+  200fa1:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200fa8:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200fac:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200fb3:	8b 00                	mov    (%rax),%eax
+  200fb5:	89 c0                	mov    %eax,%eax
+  200fb7:	48 01 d0             	add    %rdx,%rax
+  200fba:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200fc1:	8b 12                	mov    (%rdx),%edx
+  200fc3:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200fc6:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200fcd:	89 0a                	mov    %ecx,(%rdx)
+  200fcf:	eb 1a                	jmp    200feb <printer_vprintf+0x6cb>
+  200fd1:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200fd8:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200fdc:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200fe0:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200fe7:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200feb:	8b 00                	mov    (%rax),%eax
+  200fed:	88 45 8c             	mov    %al,-0x74(%rbp)
+            numbuf[1] = '\0';
+  200ff0:	c6 45 8d 00          	movb   $0x0,-0x73(%rbp)
+            break;
+  200ff4:	eb 45                	jmp    20103b <printer_vprintf+0x71b>
+        default:
+            data = numbuf;
+  200ff6:	48 8d 45 8c          	lea    -0x74(%rbp),%rax
+  200ffa:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+            numbuf[0] = (*format ? *format : '%');
+  200ffe:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  201005:	0f b6 00             	movzbl (%rax),%eax
+  201008:	84 c0                	test   %al,%al
+  20100a:	74 0c                	je     201018 <printer_vprintf+0x6f8>
+  20100c:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  201013:	0f b6 00             	movzbl (%rax),%eax
+  201016:	eb 05                	jmp    20101d <printer_vprintf+0x6fd>
+  201018:	b8 25 00 00 00       	mov    $0x25,%eax
+  20101d:	88 45 8c             	mov    %al,-0x74(%rbp)
+            numbuf[1] = '\0';
+  201020:	c6 45 8d 00          	movb   $0x0,-0x73(%rbp)
+            if (!*format) {
+  201024:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  20102b:	0f b6 00             	movzbl (%rax),%eax
+  20102e:	84 c0                	test   %al,%al
+  201030:	75 08                	jne    20103a <printer_vprintf+0x71a>
+                format--;
+  201032:	48 83 ad 68 ff ff ff 	subq   $0x1,-0x98(%rbp)
+  201039:	01 
+            }
+            break;
+  20103a:	90                   	nop
+        }
+
+        if (flags & FLAG_NUMERIC) {
+  20103b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  20103e:	83 e0 20             	and    $0x20,%eax
+  201041:	85 c0                	test   %eax,%eax
+  201043:	74 1e                	je     201063 <printer_vprintf+0x743>
+            data = fill_numbuf(numbuf + NUMBUFSIZ, num, base);
+  201045:	48 8d 45 8c          	lea    -0x74(%rbp),%rax
+  201049:	48 83 c0 18          	add    $0x18,%rax
+  20104d:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  201050:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  201054:	48 89 ce             	mov    %rcx,%rsi
+  201057:	48 89 c7             	mov    %rax,%rdi
+  20105a:	e8 39 f8 ff ff       	call   200898 <fill_numbuf>
+  20105f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        }
+
+        const char* prefix = "";
+  201063:	48 8d 05 4c 13 00 00 	lea    0x134c(%rip),%rax        # 2023b6 <flag_chars+0x6>
+  20106a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((flags & FLAG_NUMERIC) && (flags & FLAG_SIGNED)) {
+  20106e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  201071:	83 e0 20             	and    $0x20,%eax
+  201074:	85 c0                	test   %eax,%eax
+  201076:	74 51                	je     2010c9 <printer_vprintf+0x7a9>
+  201078:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  20107b:	83 e0 40             	and    $0x40,%eax
+  20107e:	85 c0                	test   %eax,%eax
+  201080:	74 47                	je     2010c9 <printer_vprintf+0x7a9>
+            if (flags & FLAG_NEGATIVE) {
+  201082:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  201085:	25 80 00 00 00       	and    $0x80,%eax
+  20108a:	85 c0                	test   %eax,%eax
+  20108c:	74 0d                	je     20109b <printer_vprintf+0x77b>
+                prefix = "-";
+  20108e:	48 8d 05 22 13 00 00 	lea    0x1322(%rip),%rax        # 2023b7 <flag_chars+0x7>
+  201095:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            if (flags & FLAG_NEGATIVE) {
+  201099:	eb 7d                	jmp    201118 <printer_vprintf+0x7f8>
+            } else if (flags & FLAG_PLUSPOSITIVE) {
+  20109b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  20109e:	83 e0 10             	and    $0x10,%eax
+  2010a1:	85 c0                	test   %eax,%eax
+  2010a3:	74 0d                	je     2010b2 <printer_vprintf+0x792>
+                prefix = "+";
+  2010a5:	48 8d 05 0d 13 00 00 	lea    0x130d(%rip),%rax        # 2023b9 <flag_chars+0x9>
+  2010ac:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            if (flags & FLAG_NEGATIVE) {
+  2010b0:	eb 66                	jmp    201118 <printer_vprintf+0x7f8>
+            } else if (flags & FLAG_SPACEPOSITIVE) {
+  2010b2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  2010b5:	83 e0 08             	and    $0x8,%eax
+  2010b8:	85 c0                	test   %eax,%eax
+  2010ba:	74 5c                	je     201118 <printer_vprintf+0x7f8>
+                prefix = " ";
+  2010bc:	48 8d 05 f8 12 00 00 	lea    0x12f8(%rip),%rax        # 2023bb <flag_chars+0xb>
+  2010c3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            if (flags & FLAG_NEGATIVE) {
+  2010c7:	eb 4f                	jmp    201118 <printer_vprintf+0x7f8>
+            }
+        } else if ((flags & FLAG_NUMERIC) && (flags & FLAG_ALT)
+  2010c9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  2010cc:	83 e0 20             	and    $0x20,%eax
+  2010cf:	85 c0                	test   %eax,%eax
+  2010d1:	74 46                	je     201119 <printer_vprintf+0x7f9>
+  2010d3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  2010d6:	83 e0 01             	and    $0x1,%eax
+  2010d9:	85 c0                	test   %eax,%eax
+  2010db:	74 3c                	je     201119 <printer_vprintf+0x7f9>
+                   && (base == 16 || base == -16)
+  2010dd:	83 7d e0 10          	cmpl   $0x10,-0x20(%rbp)
+  2010e1:	74 06                	je     2010e9 <printer_vprintf+0x7c9>
+  2010e3:	83 7d e0 f0          	cmpl   $0xfffffff0,-0x20(%rbp)
+  2010e7:	75 30                	jne    201119 <printer_vprintf+0x7f9>
+                   && (num || (flags & FLAG_ALT2))) {
+  2010e9:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  2010ee:	75 0c                	jne    2010fc <printer_vprintf+0x7dc>
+  2010f0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  2010f3:	25 00 01 00 00       	and    $0x100,%eax
+  2010f8:	85 c0                	test   %eax,%eax
+  2010fa:	74 1d                	je     201119 <printer_vprintf+0x7f9>
+            prefix = (base == -16 ? "0x" : "0X");
+  2010fc:	83 7d e0 f0          	cmpl   $0xfffffff0,-0x20(%rbp)
+  201100:	75 09                	jne    20110b <printer_vprintf+0x7eb>
+  201102:	48 8d 05 b4 12 00 00 	lea    0x12b4(%rip),%rax        # 2023bd <flag_chars+0xd>
+  201109:	eb 07                	jmp    201112 <printer_vprintf+0x7f2>
+  20110b:	48 8d 05 ae 12 00 00 	lea    0x12ae(%rip),%rax        # 2023c0 <flag_chars+0x10>
+  201112:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  201116:	eb 01                	jmp    201119 <printer_vprintf+0x7f9>
+            if (flags & FLAG_NEGATIVE) {
+  201118:	90                   	nop
+        }
+
+        int len;
+        if (precision >= 0 && !(flags & FLAG_NUMERIC)) {
+  201119:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  20111d:	78 24                	js     201143 <printer_vprintf+0x823>
+  20111f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  201122:	83 e0 20             	and    $0x20,%eax
+  201125:	85 c0                	test   %eax,%eax
+  201127:	75 1a                	jne    201143 <printer_vprintf+0x823>
+            len = strnlen(data, precision);
+  201129:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  20112c:	48 63 d0             	movslq %eax,%rdx
+  20112f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  201133:	48 89 d6             	mov    %rdx,%rsi
+  201136:	48 89 c7             	mov    %rax,%rdi
+  201139:	e8 8a f5 ff ff       	call   2006c8 <strnlen>
+  20113e:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  201141:	eb 0f                	jmp    201152 <printer_vprintf+0x832>
+        } else {
+            len = strlen(data);
+  201143:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  201147:	48 89 c7             	mov    %rax,%rdi
+  20114a:	e8 48 f5 ff ff       	call   200697 <strlen>
+  20114f:	89 45 bc             	mov    %eax,-0x44(%rbp)
+        }
+        int zeros;
+        if ((flags & FLAG_NUMERIC) && precision >= 0) {
+  201152:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  201155:	83 e0 20             	and    $0x20,%eax
+  201158:	85 c0                	test   %eax,%eax
+  20115a:	74 20                	je     20117c <printer_vprintf+0x85c>
+  20115c:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  201160:	78 1a                	js     20117c <printer_vprintf+0x85c>
+            zeros = precision > len ? precision - len : 0;
+  201162:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  201165:	3b 45 bc             	cmp    -0x44(%rbp),%eax
+  201168:	7e 08                	jle    201172 <printer_vprintf+0x852>
+  20116a:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  20116d:	2b 45 bc             	sub    -0x44(%rbp),%eax
+  201170:	eb 05                	jmp    201177 <printer_vprintf+0x857>
+  201172:	b8 00 00 00 00       	mov    $0x0,%eax
+  201177:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  20117a:	eb 5c                	jmp    2011d8 <printer_vprintf+0x8b8>
+        } else if ((flags & FLAG_NUMERIC) && (flags & FLAG_ZERO)
+  20117c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  20117f:	83 e0 20             	and    $0x20,%eax
+  201182:	85 c0                	test   %eax,%eax
+  201184:	74 4b                	je     2011d1 <printer_vprintf+0x8b1>
+  201186:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  201189:	83 e0 02             	and    $0x2,%eax
+  20118c:	85 c0                	test   %eax,%eax
+  20118e:	74 41                	je     2011d1 <printer_vprintf+0x8b1>
+                   && !(flags & FLAG_LEFTJUSTIFY)
+  201190:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  201193:	83 e0 04             	and    $0x4,%eax
+  201196:	85 c0                	test   %eax,%eax
+  201198:	75 37                	jne    2011d1 <printer_vprintf+0x8b1>
+                   && len + (int) strlen(prefix) < width) {
+  20119a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  20119e:	48 89 c7             	mov    %rax,%rdi
+  2011a1:	e8 f1 f4 ff ff       	call   200697 <strlen>
+  2011a6:	89 c2                	mov    %eax,%edx
+  2011a8:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  2011ab:	01 d0                	add    %edx,%eax
+  2011ad:	39 45 e8             	cmp    %eax,-0x18(%rbp)
+  2011b0:	7e 1f                	jle    2011d1 <printer_vprintf+0x8b1>
+            zeros = width - len - strlen(prefix);
+  2011b2:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  2011b5:	2b 45 bc             	sub    -0x44(%rbp),%eax
+  2011b8:	89 c3                	mov    %eax,%ebx
+  2011ba:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  2011be:	48 89 c7             	mov    %rax,%rdi
+  2011c1:	e8 d1 f4 ff ff       	call   200697 <strlen>
+  2011c6:	89 c2                	mov    %eax,%edx
+  2011c8:	89 d8                	mov    %ebx,%eax
+  2011ca:	29 d0                	sub    %edx,%eax
+  2011cc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  2011cf:	eb 07                	jmp    2011d8 <printer_vprintf+0x8b8>
+        } else {
+            zeros = 0;
+  2011d1:	c7 45 b8 00 00 00 00 	movl   $0x0,-0x48(%rbp)
+        }
+        width -= len + zeros + strlen(prefix);
+  2011d8:	8b 55 bc             	mov    -0x44(%rbp),%edx
+  2011db:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  2011de:	01 d0                	add    %edx,%eax
+  2011e0:	48 63 d8             	movslq %eax,%rbx
+  2011e3:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  2011e7:	48 89 c7             	mov    %rax,%rdi
+  2011ea:	e8 a8 f4 ff ff       	call   200697 <strlen>
+  2011ef:	48 8d 14 03          	lea    (%rbx,%rax,1),%rdx
+  2011f3:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  2011f6:	29 d0                	sub    %edx,%eax
+  2011f8:	89 45 e8             	mov    %eax,-0x18(%rbp)
+        for (; !(flags & FLAG_LEFTJUSTIFY) && width > 0; --width) {
+  2011fb:	eb 25                	jmp    201222 <printer_vprintf+0x902>
+            p->putc(p, ' ', color);
+  2011fd:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  201204:	48 8b 08             	mov    (%rax),%rcx
+  201207:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  20120d:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  201214:	be 20 00 00 00       	mov    $0x20,%esi
+  201219:	48 89 c7             	mov    %rax,%rdi
+  20121c:	ff d1                	call   *%rcx
+        for (; !(flags & FLAG_LEFTJUSTIFY) && width > 0; --width) {
+  20121e:	83 6d e8 01          	subl   $0x1,-0x18(%rbp)
+  201222:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  201225:	83 e0 04             	and    $0x4,%eax
+  201228:	85 c0                	test   %eax,%eax
+  20122a:	75 36                	jne    201262 <printer_vprintf+0x942>
+  20122c:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  201230:	7f cb                	jg     2011fd <printer_vprintf+0x8dd>
+        }
+        for (; *prefix; ++prefix) {
+  201232:	eb 2e                	jmp    201262 <printer_vprintf+0x942>
+            p->putc(p, *prefix, color);
+  201234:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  20123b:	4c 8b 00             	mov    (%rax),%r8
+  20123e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  201242:	0f b6 00             	movzbl (%rax),%eax
+  201245:	0f b6 c8             	movzbl %al,%ecx
+  201248:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  20124e:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  201255:	89 ce                	mov    %ecx,%esi
+  201257:	48 89 c7             	mov    %rax,%rdi
+  20125a:	41 ff d0             	call   *%r8
+        for (; *prefix; ++prefix) {
+  20125d:	48 83 45 c0 01       	addq   $0x1,-0x40(%rbp)
+  201262:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  201266:	0f b6 00             	movzbl (%rax),%eax
+  201269:	84 c0                	test   %al,%al
+  20126b:	75 c7                	jne    201234 <printer_vprintf+0x914>
+        }
+        for (; zeros > 0; --zeros) {
+  20126d:	eb 25                	jmp    201294 <printer_vprintf+0x974>
+            p->putc(p, '0', color);
+  20126f:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  201276:	48 8b 08             	mov    (%rax),%rcx
+  201279:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  20127f:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  201286:	be 30 00 00 00       	mov    $0x30,%esi
+  20128b:	48 89 c7             	mov    %rax,%rdi
+  20128e:	ff d1                	call   *%rcx
+        for (; zeros > 0; --zeros) {
+  201290:	83 6d b8 01          	subl   $0x1,-0x48(%rbp)
+  201294:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  201298:	7f d5                	jg     20126f <printer_vprintf+0x94f>
+        }
+        for (; len > 0; ++data, --len) {
+  20129a:	eb 32                	jmp    2012ce <printer_vprintf+0x9ae>
+            p->putc(p, *data, color);
+  20129c:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  2012a3:	4c 8b 00             	mov    (%rax),%r8
+  2012a6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  2012aa:	0f b6 00             	movzbl (%rax),%eax
+  2012ad:	0f b6 c8             	movzbl %al,%ecx
+  2012b0:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  2012b6:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  2012bd:	89 ce                	mov    %ecx,%esi
+  2012bf:	48 89 c7             	mov    %rax,%rdi
+  2012c2:	41 ff d0             	call   *%r8
+        for (; len > 0; ++data, --len) {
+  2012c5:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  2012ca:	83 6d bc 01          	subl   $0x1,-0x44(%rbp)
+  2012ce:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+  2012d2:	7f c8                	jg     20129c <printer_vprintf+0x97c>
+        }
+        for (; width > 0; --width) {
+  2012d4:	eb 25                	jmp    2012fb <printer_vprintf+0x9db>
+            p->putc(p, ' ', color);
+  2012d6:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  2012dd:	48 8b 08             	mov    (%rax),%rcx
+  2012e0:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  2012e6:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  2012ed:	be 20 00 00 00       	mov    $0x20,%esi
+  2012f2:	48 89 c7             	mov    %rax,%rdi
+  2012f5:	ff d1                	call   *%rcx
+        for (; width > 0; --width) {
+  2012f7:	83 6d e8 01          	subl   $0x1,-0x18(%rbp)
+  2012fb:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  2012ff:	7f d5                	jg     2012d6 <printer_vprintf+0x9b6>
+        }
+    done: ;
+  201301:	90                   	nop
+    for (; *format; ++format) {
+  201302:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  201309:	01 
+  20130a:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  201311:	0f b6 00             	movzbl (%rax),%eax
+  201314:	84 c0                	test   %al,%al
+  201316:	0f 85 30 f6 ff ff    	jne    20094c <printer_vprintf+0x2c>
+    }
+}
+  20131c:	90                   	nop
+  20131d:	90                   	nop
+  20131e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  201322:	c9                   	leave
+  201323:	c3                   	ret
+
+0000000000201324 <console_putc>:
+typedef struct console_printer {
+    printer p;
+    uint16_t* cursor;
+} console_printer;
+
+static void console_putc(printer* p, unsigned char c, int color) {
+  201324:	55                   	push   %rbp
+  201325:	48 89 e5             	mov    %rsp,%rbp
+  201328:	48 83 ec 30          	sub    $0x30,%rsp
+  20132c:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  201330:	89 f0                	mov    %esi,%eax
+  201332:	89 55 d0             	mov    %edx,-0x30(%rbp)
+  201335:	88 45 d4             	mov    %al,-0x2c(%rbp)
+    console_printer* cp = (console_printer*) p;
+  201338:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  20133c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    /*if (cp->cursor >= console + CONSOLE_ROWS * CONSOLE_COLUMNS) {
+        cp->cursor = console;
+    }*/
+    if (c == '\n') {
+  201340:	80 7d d4 0a          	cmpb   $0xa,-0x2c(%rbp)
+  201344:	75 7f                	jne    2013c5 <console_putc+0xa1>
+        int pos = (cp->cursor - console) % CONSOLE_COLUMNS;
+  201346:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20134a:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  20134e:	48 8d 05 ab 6c eb ff 	lea    -0x149355(%rip),%rax        # b8000 <console>
+  201355:	48 29 c2             	sub    %rax,%rdx
+  201358:	48 89 d0             	mov    %rdx,%rax
+  20135b:	48 d1 f8             	sar    %rax
+  20135e:	48 89 c1             	mov    %rax,%rcx
+  201361:	48 ba 67 66 66 66 66 	movabs $0x6666666666666667,%rdx
+  201368:	66 66 66 
+  20136b:	48 89 c8             	mov    %rcx,%rax
+  20136e:	48 f7 ea             	imul   %rdx
+  201371:	48 c1 fa 05          	sar    $0x5,%rdx
+  201375:	48 89 c8             	mov    %rcx,%rax
+  201378:	48 c1 f8 3f          	sar    $0x3f,%rax
+  20137c:	48 29 c2             	sub    %rax,%rdx
+  20137f:	48 89 d0             	mov    %rdx,%rax
+  201382:	48 c1 e0 02          	shl    $0x2,%rax
+  201386:	48 01 d0             	add    %rdx,%rax
+  201389:	48 c1 e0 04          	shl    $0x4,%rax
+  20138d:	48 29 c1             	sub    %rax,%rcx
+  201390:	48 89 ca             	mov    %rcx,%rdx
+  201393:	89 55 fc             	mov    %edx,-0x4(%rbp)
+        for (; pos != CONSOLE_COLUMNS; pos++) {
+  201396:	eb 25                	jmp    2013bd <console_putc+0x99>
+            *cp->cursor++ = ' ' | color;
+  201398:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  20139b:	83 c8 20             	or     $0x20,%eax
+  20139e:	89 c6                	mov    %eax,%esi
+  2013a0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2013a4:	48 8b 40 08          	mov    0x8(%rax),%rax
+  2013a8:	48 8d 48 02          	lea    0x2(%rax),%rcx
+  2013ac:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  2013b0:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  2013b4:	89 f2                	mov    %esi,%edx
+  2013b6:	66 89 10             	mov    %dx,(%rax)
+        for (; pos != CONSOLE_COLUMNS; pos++) {
+  2013b9:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  2013bd:	83 7d fc 50          	cmpl   $0x50,-0x4(%rbp)
+  2013c1:	75 d5                	jne    201398 <console_putc+0x74>
+  2013c3:	eb 69                	jmp    20142e <console_putc+0x10a>
+        }
+    } else if (c == '\b') {
+  2013c5:	80 7d d4 08          	cmpb   $0x8,-0x2c(%rbp)
+  2013c9:	75 3f                	jne    20140a <console_putc+0xe6>
+        if (cp->cursor != console) {
+  2013cb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2013cf:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  2013d3:	48 8d 05 26 6c eb ff 	lea    -0x1493da(%rip),%rax        # b8000 <console>
+  2013da:	48 39 c2             	cmp    %rax,%rdx
+  2013dd:	74 4f                	je     20142e <console_putc+0x10a>
+            *(--cp->cursor) = ' ' | color;
+  2013df:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  2013e2:	83 c8 20             	or     $0x20,%eax
+  2013e5:	89 c1                	mov    %eax,%ecx
+  2013e7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2013eb:	48 8b 40 08          	mov    0x8(%rax),%rax
+  2013ef:	48 8d 50 fe          	lea    -0x2(%rax),%rdx
+  2013f3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2013f7:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  2013fb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2013ff:	48 8b 40 08          	mov    0x8(%rax),%rax
+  201403:	89 ca                	mov    %ecx,%edx
+  201405:	66 89 10             	mov    %dx,(%rax)
+  201408:	eb 24                	jmp    20142e <console_putc+0x10a>
+        }
+    } else {
+        *cp->cursor++ = c | color;
+  20140a:	0f b6 45 d4          	movzbl -0x2c(%rbp),%eax
+  20140e:	8b 55 d0             	mov    -0x30(%rbp),%edx
+  201411:	09 d0                	or     %edx,%eax
+  201413:	89 c6                	mov    %eax,%esi
+  201415:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201419:	48 8b 40 08          	mov    0x8(%rax),%rax
+  20141d:	48 8d 48 02          	lea    0x2(%rax),%rcx
+  201421:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  201425:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  201429:	89 f2                	mov    %esi,%edx
+  20142b:	66 89 10             	mov    %dx,(%rax)
+    }
+
+    const int MAX_ROWS = CONSOLE_ROWS - 2;
+  20142e:	c7 45 e4 17 00 00 00 	movl   $0x17,-0x1c(%rbp)
+
+    if (cp->cursor == console + MAX_ROWS * CONSOLE_COLUMNS) {
+  201435:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201439:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  20143d:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  201440:	89 d0                	mov    %edx,%eax
+  201442:	c1 e0 02             	shl    $0x2,%eax
+  201445:	01 d0                	add    %edx,%eax
+  201447:	c1 e0 04             	shl    $0x4,%eax
+  20144a:	48 98                	cltq
+  20144c:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  201450:	48 8d 05 a9 6b eb ff 	lea    -0x149457(%rip),%rax        # b8000 <console>
+  201457:	48 01 d0             	add    %rdx,%rax
+  20145a:	48 39 c1             	cmp    %rax,%rcx
+  20145d:	0f 85 ac 00 00 00    	jne    20150f <console_putc+0x1eb>
+        // Move all characters up by one row, forgetting the first row
+        for (int i = 0; i < (MAX_ROWS - 1) * CONSOLE_COLUMNS; ++i) {
+  201463:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  20146a:	eb 30                	jmp    20149c <console_putc+0x178>
+            console[i] = console[i + CONSOLE_COLUMNS];
+  20146c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  20146f:	83 c0 50             	add    $0x50,%eax
+  201472:	48 98                	cltq
+  201474:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  201478:	48 8d 05 81 6b eb ff 	lea    -0x14947f(%rip),%rax        # b8000 <console>
+  20147f:	0f b7 04 02          	movzwl (%rdx,%rax,1),%eax
+  201483:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  201486:	48 63 d2             	movslq %edx,%rdx
+  201489:	48 8d 0c 12          	lea    (%rdx,%rdx,1),%rcx
+  20148d:	48 8d 15 6c 6b eb ff 	lea    -0x149494(%rip),%rdx        # b8000 <console>
+  201494:	66 89 04 11          	mov    %ax,(%rcx,%rdx,1)
+        for (int i = 0; i < (MAX_ROWS - 1) * CONSOLE_COLUMNS; ++i) {
+  201498:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+  20149c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  20149f:	8d 50 ff             	lea    -0x1(%rax),%edx
+  2014a2:	89 d0                	mov    %edx,%eax
+  2014a4:	c1 e0 02             	shl    $0x2,%eax
+  2014a7:	01 d0                	add    %edx,%eax
+  2014a9:	c1 e0 04             	shl    $0x4,%eax
+  2014ac:	39 45 f8             	cmp    %eax,-0x8(%rbp)
+  2014af:	7c bb                	jl     20146c <console_putc+0x148>
+        }
+
+        // Fill last column with space
+        for (int i = (MAX_ROWS - 1) * CONSOLE_COLUMNS; i < MAX_ROWS * CONSOLE_COLUMNS; ++i) {
+  2014b1:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  2014b4:	8d 50 ff             	lea    -0x1(%rax),%edx
+  2014b7:	89 d0                	mov    %edx,%eax
+  2014b9:	c1 e0 02             	shl    $0x2,%eax
+  2014bc:	01 d0                	add    %edx,%eax
+  2014be:	c1 e0 04             	shl    $0x4,%eax
+  2014c1:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  2014c4:	eb 20                	jmp    2014e6 <console_putc+0x1c2>
+            console[i] = ' ' | color;
+  2014c6:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  2014c9:	83 c8 20             	or     $0x20,%eax
+  2014cc:	89 c1                	mov    %eax,%ecx
+  2014ce:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  2014d1:	48 98                	cltq
+  2014d3:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  2014d7:	48 8d 05 22 6b eb ff 	lea    -0x1494de(%rip),%rax        # b8000 <console>
+  2014de:	66 89 0c 02          	mov    %cx,(%rdx,%rax,1)
+        for (int i = (MAX_ROWS - 1) * CONSOLE_COLUMNS; i < MAX_ROWS * CONSOLE_COLUMNS; ++i) {
+  2014e2:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  2014e6:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  2014e9:	89 d0                	mov    %edx,%eax
+  2014eb:	c1 e0 02             	shl    $0x2,%eax
+  2014ee:	01 d0                	add    %edx,%eax
+  2014f0:	c1 e0 04             	shl    $0x4,%eax
+  2014f3:	39 45 f4             	cmp    %eax,-0xc(%rbp)
+  2014f6:	7c ce                	jl     2014c6 <console_putc+0x1a2>
+        }
+
+        cp->cursor -= CONSOLE_COLUMNS;
+  2014f8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2014fc:	48 8b 40 08          	mov    0x8(%rax),%rax
+  201500:	48 8d 90 60 ff ff ff 	lea    -0xa0(%rax),%rdx
+  201507:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20150b:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    }
+}
+  20150f:	90                   	nop
+  201510:	c9                   	leave
+  201511:	c3                   	ret
+
+0000000000201512 <console_vprintf>:
+
+int console_vprintf(int cpos, int color, const char* format, va_list val) {
+  201512:	55                   	push   %rbp
+  201513:	48 89 e5             	mov    %rsp,%rbp
+  201516:	48 83 ec 30          	sub    $0x30,%rsp
+  20151a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  20151d:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  201520:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  201524:	48 89 4d d8          	mov    %rcx,-0x28(%rbp)
+    struct console_printer cp;
+    cp.p.putc = console_putc;
+  201528:	48 8d 05 f5 fd ff ff 	lea    -0x20b(%rip),%rax        # 201324 <console_putc>
+  20152f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (cpos < 0 || cpos >= CONSOLE_ROWS * CONSOLE_COLUMNS) {
+  201533:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  201537:	78 09                	js     201542 <console_vprintf+0x30>
+  201539:	81 7d ec cf 07 00 00 	cmpl   $0x7cf,-0x14(%rbp)
+  201540:	7e 07                	jle    201549 <console_vprintf+0x37>
+        cpos = 0;
+  201542:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+    }
+    cp.cursor = console + cpos;
+  201549:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  20154c:	48 98                	cltq
+  20154e:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  201552:	48 8d 05 a7 6a eb ff 	lea    -0x149559(%rip),%rax        # b8000 <console>
+  201559:	48 01 d0             	add    %rdx,%rax
+  20155c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    printer_vprintf(&cp.p, color, format, val);
+  201560:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  201564:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  201568:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  20156b:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  20156f:	48 89 c7             	mov    %rax,%rdi
+  201572:	e8 a9 f3 ff ff       	call   200920 <printer_vprintf>
+    return cp.cursor - console;
+  201577:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  20157b:	48 8d 05 7e 6a eb ff 	lea    -0x149582(%rip),%rax        # b8000 <console>
+  201582:	48 29 c2             	sub    %rax,%rdx
+  201585:	48 89 d0             	mov    %rdx,%rax
+  201588:	48 d1 f8             	sar    %rax
+}
+  20158b:	c9                   	leave
+  20158c:	c3                   	ret
+
+000000000020158d <console_printf>:
+
+int console_printf(int cpos, int color, const char* format, ...) {
+  20158d:	55                   	push   %rbp
+  20158e:	48 89 e5             	mov    %rsp,%rbp
+  201591:	48 83 ec 60          	sub    $0x60,%rsp
+  201595:	89 7d ac             	mov    %edi,-0x54(%rbp)
+  201598:	89 75 a8             	mov    %esi,-0x58(%rbp)
+  20159b:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+  20159f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  2015a3:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  2015a7:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list val;
+    va_start(val, format);
+  2015ab:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  2015b2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  2015b6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  2015ba:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  2015be:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    cpos = console_vprintf(cpos, color, format, val);
+  2015c2:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  2015c6:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  2015ca:	8b 75 a8             	mov    -0x58(%rbp),%esi
+  2015cd:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  2015d0:	89 c7                	mov    %eax,%edi
+  2015d2:	e8 3b ff ff ff       	call   201512 <console_vprintf>
+  2015d7:	89 45 ac             	mov    %eax,-0x54(%rbp)
+    va_end(val);
+    return cpos;
+  2015da:	8b 45 ac             	mov    -0x54(%rbp),%eax
+}
+  2015dd:	c9                   	leave
+  2015de:	c3                   	ret
+
+00000000002015df <string_putc>:
+    printer p;
+    char* s;
+    char* end;
+} string_printer;
+
+static void string_putc(printer* p, unsigned char c, int color) {
+  2015df:	55                   	push   %rbp
+  2015e0:	48 89 e5             	mov    %rsp,%rbp
+  2015e3:	48 83 ec 20          	sub    $0x20,%rsp
+  2015e7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  2015eb:	89 f0                	mov    %esi,%eax
+  2015ed:	89 55 e0             	mov    %edx,-0x20(%rbp)
+  2015f0:	88 45 e4             	mov    %al,-0x1c(%rbp)
+    string_printer* sp = (string_printer*) p;
+  2015f3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2015f7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (sp->s < sp->end) {
+  2015fb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2015ff:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  201603:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  201607:	48 8b 40 10          	mov    0x10(%rax),%rax
+  20160b:	48 39 c2             	cmp    %rax,%rdx
+  20160e:	73 1a                	jae    20162a <string_putc+0x4b>
+        *sp->s++ = c;
+  201610:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  201614:	48 8b 40 08          	mov    0x8(%rax),%rax
+  201618:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  20161c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  201620:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  201624:	0f b6 55 e4          	movzbl -0x1c(%rbp),%edx
+  201628:	88 10                	mov    %dl,(%rax)
+    }
+    (void) color;
+}
+  20162a:	90                   	nop
+  20162b:	c9                   	leave
+  20162c:	c3                   	ret
+
+000000000020162d <vsnprintf>:
+
+int vsnprintf(char* s, size_t size, const char* format, va_list val) {
+  20162d:	55                   	push   %rbp
+  20162e:	48 89 e5             	mov    %rsp,%rbp
+  201631:	48 83 ec 40          	sub    $0x40,%rsp
+  201635:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  201639:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  20163d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  201641:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+    string_printer sp;
+    sp.p.putc = string_putc;
+  201645:	48 8d 05 93 ff ff ff 	lea    -0x6d(%rip),%rax        # 2015df <string_putc>
+  20164c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    sp.s = s;
+  201650:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  201654:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (size) {
+  201658:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  20165d:	74 33                	je     201692 <vsnprintf+0x65>
+        sp.end = s + size - 1;
+  20165f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  201663:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  201667:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  20166b:	48 01 d0             	add    %rdx,%rax
+  20166e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+        printer_vprintf(&sp.p, 0, format, val);
+  201672:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  201676:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  20167a:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  20167e:	be 00 00 00 00       	mov    $0x0,%esi
+  201683:	48 89 c7             	mov    %rax,%rdi
+  201686:	e8 95 f2 ff ff       	call   200920 <printer_vprintf>
+        *sp.s = 0;
+  20168b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  20168f:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return sp.s - s;
+  201692:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  201696:	48 2b 45 d8          	sub    -0x28(%rbp),%rax
+}
+  20169a:	c9                   	leave
+  20169b:	c3                   	ret
+
+000000000020169c <snprintf>:
+
+int snprintf(char* s, size_t size, const char* format, ...) {
+  20169c:	55                   	push   %rbp
+  20169d:	48 89 e5             	mov    %rsp,%rbp
+  2016a0:	48 83 ec 70          	sub    $0x70,%rsp
+  2016a4:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  2016a8:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  2016ac:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  2016b0:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  2016b4:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  2016b8:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list val;
+    va_start(val, format);
+  2016bc:	c7 45 b0 18 00 00 00 	movl   $0x18,-0x50(%rbp)
+  2016c3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  2016c7:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  2016cb:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  2016cf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    int n = vsnprintf(s, size, format, val);
+  2016d3:	48 8d 4d b0          	lea    -0x50(%rbp),%rcx
+  2016d7:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  2016db:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  2016df:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  2016e3:	48 89 c7             	mov    %rax,%rdi
+  2016e6:	e8 42 ff ff ff       	call   20162d <vsnprintf>
+  2016eb:	89 45 cc             	mov    %eax,-0x34(%rbp)
+    va_end(val);
+    return n;
+  2016ee:	8b 45 cc             	mov    -0x34(%rbp),%eax
+}
+  2016f1:	c9                   	leave
+  2016f2:	c3                   	ret
+
+00000000002016f3 <console_clear>:
+
+
+// console_clear
+//    Erases the console and moves the cursor to the upper left (CPOS(0, 0)).
+
+void console_clear(void) {
+  2016f3:	55                   	push   %rbp
+  2016f4:	48 89 e5             	mov    %rsp,%rbp
+  2016f7:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < CONSOLE_ROWS * CONSOLE_COLUMNS; ++i) {
+  2016fb:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  201702:	eb 1a                	jmp    20171e <console_clear+0x2b>
+        console[i] = ' ' | 0x0700;
+  201704:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  201707:	48 98                	cltq
+  201709:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  20170d:	48 8d 05 ec 68 eb ff 	lea    -0x149714(%rip),%rax        # b8000 <console>
+  201714:	66 c7 04 02 20 07    	movw   $0x720,(%rdx,%rax,1)
+    for (int i = 0; i < CONSOLE_ROWS * CONSOLE_COLUMNS; ++i) {
+  20171a:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  20171e:	81 7d fc cf 07 00 00 	cmpl   $0x7cf,-0x4(%rbp)
+  201725:	7e dd                	jle    201704 <console_clear+0x11>
+    }
+    cursorpos = 0;
+  201727:	c7 05 cb 78 eb ff 00 	movl   $0x0,-0x148735(%rip)        # b8ffc <cursorpos>
+  20172e:	00 00 00 
+}
+  201731:	90                   	nop
+  201732:	c9                   	leave
+  201733:	c3                   	ret
+
+0000000000201734 <string_to_char>:
+
+
+int string_to_char(const char *str, int *dest) {
+  201734:	55                   	push   %rbp
+  201735:	48 89 e5             	mov    %rsp,%rbp
+  201738:	48 83 ec 20          	sub    $0x20,%rsp
+  20173c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  201740:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    if (*str == '\0') return -1;
+  201744:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201748:	0f b6 00             	movzbl (%rax),%eax
+  20174b:	84 c0                	test   %al,%al
+  20174d:	75 0a                	jne    201759 <string_to_char+0x25>
+  20174f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  201754:	e9 e0 00 00 00       	jmp    201839 <string_to_char+0x105>
+
+    *dest = 0;
+  201759:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  20175d:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    for (; *str; str++) {
+  201763:	e9 bd 00 00 00       	jmp    201825 <string_to_char+0xf1>
+        int digit = 0;
+  201768:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+        switch (*str)
+  20176f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201773:	0f b6 00             	movzbl (%rax),%eax
+  201776:	0f be c0             	movsbl %al,%eax
+  201779:	83 e8 30             	sub    $0x30,%eax
+  20177c:	83 f8 09             	cmp    $0x9,%eax
+  20177f:	77 7c                	ja     2017fd <string_to_char+0xc9>
+  201781:	89 c0                	mov    %eax,%eax
+  201783:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  20178a:	00 
+  20178b:	48 8d 05 12 0d 00 00 	lea    0xd12(%rip),%rax        # 2024a4 <flag_chars+0xf4>
+  201792:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+  201795:	48 98                	cltq
+  201797:	48 8d 15 06 0d 00 00 	lea    0xd06(%rip),%rdx        # 2024a4 <flag_chars+0xf4>
+  20179e:	48 01 d0             	add    %rdx,%rax
+  2017a1:	ff e0                	jmp    *%rax
+        {
+        case '0':
+            digit = 0;
+  2017a3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+            break;
+  2017aa:	eb 58                	jmp    201804 <string_to_char+0xd0>
+        case '1':
+            digit = 1;
+  2017ac:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+            break;
+  2017b3:	eb 4f                	jmp    201804 <string_to_char+0xd0>
+        case '2':
+            digit = 2;
+  2017b5:	c7 45 fc 02 00 00 00 	movl   $0x2,-0x4(%rbp)
+            break;
+  2017bc:	eb 46                	jmp    201804 <string_to_char+0xd0>
+        case '3':
+            digit = 3;
+  2017be:	c7 45 fc 03 00 00 00 	movl   $0x3,-0x4(%rbp)
+            break;
+  2017c5:	eb 3d                	jmp    201804 <string_to_char+0xd0>
+        case '4':
+            digit = 4;
+  2017c7:	c7 45 fc 04 00 00 00 	movl   $0x4,-0x4(%rbp)
+            break;
+  2017ce:	eb 34                	jmp    201804 <string_to_char+0xd0>
+        case '5':
+            digit = 5;
+  2017d0:	c7 45 fc 05 00 00 00 	movl   $0x5,-0x4(%rbp)
+            break;
+  2017d7:	eb 2b                	jmp    201804 <string_to_char+0xd0>
+        case '6':
+            digit = 6;
+  2017d9:	c7 45 fc 06 00 00 00 	movl   $0x6,-0x4(%rbp)
+            break;
+  2017e0:	eb 22                	jmp    201804 <string_to_char+0xd0>
+        case '7':
+            digit = 7;
+  2017e2:	c7 45 fc 07 00 00 00 	movl   $0x7,-0x4(%rbp)
+            break;
+  2017e9:	eb 19                	jmp    201804 <string_to_char+0xd0>
+        case '8':
+            digit = 8;
+  2017eb:	c7 45 fc 08 00 00 00 	movl   $0x8,-0x4(%rbp)
+            break;
+  2017f2:	eb 10                	jmp    201804 <string_to_char+0xd0>
+        case '9':
+            digit = 9;
+  2017f4:	c7 45 fc 09 00 00 00 	movl   $0x9,-0x4(%rbp)
+            break;
+  2017fb:	eb 07                	jmp    201804 <string_to_char+0xd0>
+        default:
+            return -1;
+  2017fd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  201802:	eb 35                	jmp    201839 <string_to_char+0x105>
+        }
+
+        *dest = *dest * 10 + digit;
+  201804:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  201808:	8b 10                	mov    (%rax),%edx
+  20180a:	89 d0                	mov    %edx,%eax
+  20180c:	c1 e0 02             	shl    $0x2,%eax
+  20180f:	01 d0                	add    %edx,%eax
+  201811:	01 c0                	add    %eax,%eax
+  201813:	89 c2                	mov    %eax,%edx
+  201815:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  201818:	01 c2                	add    %eax,%edx
+  20181a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  20181e:	89 10                	mov    %edx,(%rax)
+    for (; *str; str++) {
+  201820:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  201825:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201829:	0f b6 00             	movzbl (%rax),%eax
+  20182c:	84 c0                	test   %al,%al
+  20182e:	0f 85 34 ff ff ff    	jne    201768 <string_to_char+0x34>
+    }
+
+    return 0;
+  201834:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  201839:	c9                   	leave
+  20183a:	c3                   	ret
+
+000000000020183b <atoi>:
+
+int atoi(const char *str) {
+  20183b:	55                   	push   %rbp
+  20183c:	48 89 e5             	mov    %rsp,%rbp
+  20183f:	48 83 ec 18          	sub    $0x18,%rsp
+  201843:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    if (*str == '\0') return -1;
+  201847:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20184b:	0f b6 00             	movzbl (%rax),%eax
+  20184e:	84 c0                	test   %al,%al
+  201850:	75 0a                	jne    20185c <atoi+0x21>
+  201852:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  201857:	e9 d7 00 00 00       	jmp    201933 <atoi+0xf8>
+
+    int n = 0;
+  20185c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    for (; *str; str++) {
+  201863:	e9 b7 00 00 00       	jmp    20191f <atoi+0xe4>
+        int digit = 0;
+  201868:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+        switch (*str)
+  20186f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201873:	0f b6 00             	movzbl (%rax),%eax
+  201876:	0f be c0             	movsbl %al,%eax
+  201879:	83 e8 30             	sub    $0x30,%eax
+  20187c:	83 f8 09             	cmp    $0x9,%eax
+  20187f:	77 7c                	ja     2018fd <atoi+0xc2>
+  201881:	89 c0                	mov    %eax,%eax
+  201883:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  20188a:	00 
+  20188b:	48 8d 05 3a 0c 00 00 	lea    0xc3a(%rip),%rax        # 2024cc <flag_chars+0x11c>
+  201892:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+  201895:	48 98                	cltq
+  201897:	48 8d 15 2e 0c 00 00 	lea    0xc2e(%rip),%rdx        # 2024cc <flag_chars+0x11c>
+  20189e:	48 01 d0             	add    %rdx,%rax
+  2018a1:	ff e0                	jmp    *%rax
+        {
+        case '0':
+            digit = 0;
+  2018a3:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+            break;
+  2018aa:	eb 58                	jmp    201904 <atoi+0xc9>
+        case '1':
+            digit = 1;
+  2018ac:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+            break;
+  2018b3:	eb 4f                	jmp    201904 <atoi+0xc9>
+        case '2':
+            digit = 2;
+  2018b5:	c7 45 f8 02 00 00 00 	movl   $0x2,-0x8(%rbp)
+            break;
+  2018bc:	eb 46                	jmp    201904 <atoi+0xc9>
+        case '3':
+            digit = 3;
+  2018be:	c7 45 f8 03 00 00 00 	movl   $0x3,-0x8(%rbp)
+            break;
+  2018c5:	eb 3d                	jmp    201904 <atoi+0xc9>
+        case '4':
+            digit = 4;
+  2018c7:	c7 45 f8 04 00 00 00 	movl   $0x4,-0x8(%rbp)
+            break;
+  2018ce:	eb 34                	jmp    201904 <atoi+0xc9>
+        case '5':
+            digit = 5;
+  2018d0:	c7 45 f8 05 00 00 00 	movl   $0x5,-0x8(%rbp)
+            break;
+  2018d7:	eb 2b                	jmp    201904 <atoi+0xc9>
+        case '6':
+            digit = 6;
+  2018d9:	c7 45 f8 06 00 00 00 	movl   $0x6,-0x8(%rbp)
+            break;
+  2018e0:	eb 22                	jmp    201904 <atoi+0xc9>
+        case '7':
+            digit = 7;
+  2018e2:	c7 45 f8 07 00 00 00 	movl   $0x7,-0x8(%rbp)
+            break;
+  2018e9:	eb 19                	jmp    201904 <atoi+0xc9>
+        case '8':
+            digit = 8;
+  2018eb:	c7 45 f8 08 00 00 00 	movl   $0x8,-0x8(%rbp)
+            break;
+  2018f2:	eb 10                	jmp    201904 <atoi+0xc9>
+        case '9':
+            digit = 9;
+  2018f4:	c7 45 f8 09 00 00 00 	movl   $0x9,-0x8(%rbp)
+            break;
+  2018fb:	eb 07                	jmp    201904 <atoi+0xc9>
+        default:
+            return -1;
+  2018fd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  201902:	eb 2f                	jmp    201933 <atoi+0xf8>
+        }
+
+        n = n * 10 + digit;
+  201904:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  201907:	89 d0                	mov    %edx,%eax
+  201909:	c1 e0 02             	shl    $0x2,%eax
+  20190c:	01 d0                	add    %edx,%eax
+  20190e:	01 c0                	add    %eax,%eax
+  201910:	89 c2                	mov    %eax,%edx
+  201912:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  201915:	01 d0                	add    %edx,%eax
+  201917:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    for (; *str; str++) {
+  20191a:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  20191f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201923:	0f b6 00             	movzbl (%rax),%eax
+  201926:	84 c0                	test   %al,%al
+  201928:	0f 85 3a ff ff ff    	jne    201868 <atoi+0x2d>
+    }
+
+    return 0;
+  20192e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  201933:	c9                   	leave
+  201934:	c3                   	ret
+
+0000000000201935 <copy_comp>:
+        components[ncomp++] = (comp); \
+    } \
+} while (0)
+
+// Helper to copy a component to dst
+void copy_comp(const char *start, const char *end, char **pdst) {
+  201935:	55                   	push   %rbp
+  201936:	48 89 e5             	mov    %rsp,%rbp
+  201939:	48 83 ec 18          	sub    $0x18,%rsp
+  20193d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  201941:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  201945:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    while (start < end) {
+  201949:	eb 23                	jmp    20196e <copy_comp+0x39>
+        *(*pdst)++ = *start++;
+  20194b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  20194f:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  201953:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  201957:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20195b:	48 8b 00             	mov    (%rax),%rax
+  20195e:	48 8d 70 01          	lea    0x1(%rax),%rsi
+  201962:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  201966:	48 89 31             	mov    %rsi,(%rcx)
+  201969:	0f b6 12             	movzbl (%rdx),%edx
+  20196c:	88 10                	mov    %dl,(%rax)
+    while (start < end) {
+  20196e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  201972:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  201976:	72 d3                	jb     20194b <copy_comp+0x16>
+    }
+}
+  201978:	90                   	nop
+  201979:	90                   	nop
+  20197a:	c9                   	leave
+  20197b:	c3                   	ret
+
+000000000020197c <join_path>:
+
+
+void join_path(const char *abs_path, const char *path, char *dst) {
+  20197c:	55                   	push   %rbp
+  20197d:	48 89 e5             	mov    %rsp,%rbp
+  201980:	48 81 ec 68 02 00 00 	sub    $0x268,%rsp
+  201987:	48 89 bd a8 fd ff ff 	mov    %rdi,-0x258(%rbp)
+  20198e:	48 89 b5 a0 fd ff ff 	mov    %rsi,-0x260(%rbp)
+  201995:	48 89 95 98 fd ff ff 	mov    %rdx,-0x268(%rbp)
+    // If path is absolute, just copy it to dst (removing duplicate slashes, and trailing slash unless root)
+    if (path[0] == '/') {
+  20199c:	48 8b 85 a0 fd ff ff 	mov    -0x260(%rbp),%rax
+  2019a3:	0f b6 00             	movzbl (%rax),%eax
+  2019a6:	3c 2f                	cmp    $0x2f,%al
+  2019a8:	0f 85 d6 00 00 00    	jne    201a84 <join_path+0x108>
+        const char *src = path;
+  2019ae:	48 8b 85 a0 fd ff ff 	mov    -0x260(%rbp),%rax
+  2019b5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+        char *d = dst;
+  2019b9:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  2019c0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+        // Always start with a single slash
+        *d++ = '/';
+  2019c4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2019c8:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  2019cc:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  2019d0:	c6 00 2f             	movb   $0x2f,(%rax)
+        src++;
+  2019d3:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+        int last_was_slash = 1;
+  2019d8:	c7 45 b0 01 00 00 00 	movl   $0x1,-0x50(%rbp)
+        while (*src) {
+  2019df:	eb 64                	jmp    201a45 <join_path+0xc9>
+            if (*src == '/') {
+  2019e1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2019e5:	0f b6 00             	movzbl (%rax),%eax
+  2019e8:	3c 2f                	cmp    $0x2f,%al
+  2019ea:	75 35                	jne    201a21 <join_path+0xa5>
+                // Skip consecutive slashes
+                while (*src == '/') src++;
+  2019ec:	eb 05                	jmp    2019f3 <join_path+0x77>
+  2019ee:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  2019f3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2019f7:	0f b6 00             	movzbl (%rax),%eax
+  2019fa:	3c 2f                	cmp    $0x2f,%al
+  2019fc:	74 f0                	je     2019ee <join_path+0x72>
+                if (*src == 0) break;
+  2019fe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  201a02:	0f b6 00             	movzbl (%rax),%eax
+  201a05:	84 c0                	test   %al,%al
+  201a07:	74 49                	je     201a52 <join_path+0xd6>
+                *d++ = '/';
+  201a09:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  201a0d:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  201a11:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  201a15:	c6 00 2f             	movb   $0x2f,(%rax)
+                last_was_slash = 1;
+  201a18:	c7 45 b0 01 00 00 00 	movl   $0x1,-0x50(%rbp)
+  201a1f:	eb 24                	jmp    201a45 <join_path+0xc9>
+            } else {
+                *d++ = *src++;
+  201a21:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  201a25:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  201a29:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  201a2d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  201a31:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  201a35:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  201a39:	0f b6 12             	movzbl (%rdx),%edx
+  201a3c:	88 10                	mov    %dl,(%rax)
+                last_was_slash = 0;
+  201a3e:	c7 45 b0 00 00 00 00 	movl   $0x0,-0x50(%rbp)
+        while (*src) {
+  201a45:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  201a49:	0f b6 00             	movzbl (%rax),%eax
+  201a4c:	84 c0                	test   %al,%al
+  201a4e:	75 91                	jne    2019e1 <join_path+0x65>
+  201a50:	eb 01                	jmp    201a53 <join_path+0xd7>
+                if (*src == 0) break;
+  201a52:	90                   	nop
+            }
+        }
+        // Remove trailing slash unless the path is just "/"
+        if (d > dst + 1 && *(d-1) == '/') {
+  201a53:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  201a5a:	48 83 c0 01          	add    $0x1,%rax
+  201a5e:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  201a62:	73 14                	jae    201a78 <join_path+0xfc>
+  201a64:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  201a68:	48 83 e8 01          	sub    $0x1,%rax
+  201a6c:	0f b6 00             	movzbl (%rax),%eax
+  201a6f:	3c 2f                	cmp    $0x2f,%al
+  201a71:	75 05                	jne    201a78 <join_path+0xfc>
+            d--;
+  201a73:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+        }
+        *d = 0;
+  201a78:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  201a7c:	c6 00 00             	movb   $0x0,(%rax)
+  201a7f:	e9 e9 02 00 00       	jmp    201d6d <join_path+0x3f1>
+        return;
+    }
+
+    // Otherwise, start with abs_path
+    const char *src = abs_path;
+  201a84:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  201a8b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    char *d = dst;
+  201a8f:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  201a96:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    if (*src != '/') {
+  201a9a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201a9e:	0f b6 00             	movzbl (%rax),%eax
+  201aa1:	3c 2f                	cmp    $0x2f,%al
+  201aa3:	74 2e                	je     201ad3 <join_path+0x157>
+        *d++ = '/';
+  201aa5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  201aa9:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  201aad:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  201ab1:	c6 00 2f             	movb   $0x2f,(%rax)
+    }
+    while (*src) {
+  201ab4:	eb 1d                	jmp    201ad3 <join_path+0x157>
+        *d++ = *src++;
+  201ab6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  201aba:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  201abe:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  201ac2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  201ac6:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  201aca:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  201ace:	0f b6 12             	movzbl (%rdx),%edx
+  201ad1:	88 10                	mov    %dl,(%rax)
+    while (*src) {
+  201ad3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201ad7:	0f b6 00             	movzbl (%rax),%eax
+  201ada:	84 c0                	test   %al,%al
+  201adc:	75 d8                	jne    201ab6 <join_path+0x13a>
+    }
+    // Remove trailing slash (unless root)
+    if (d > dst + 1 && *(d-1) == '/') {
+  201ade:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  201ae5:	48 83 c0 01          	add    $0x1,%rax
+  201ae9:	48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+  201aed:	73 14                	jae    201b03 <join_path+0x187>
+  201aef:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  201af3:	48 83 e8 01          	sub    $0x1,%rax
+  201af7:	0f b6 00             	movzbl (%rax),%eax
+  201afa:	3c 2f                	cmp    $0x2f,%al
+  201afc:	75 05                	jne    201b03 <join_path+0x187>
+        d--;
+  201afe:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+    }
+    *d = 0;
+  201b03:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  201b07:	c6 00 00             	movb   $0x0,(%rax)
+
+    // Now, process path components
+    char temp[512];
+    int tlen = 0;
+  201b0a:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    // Copy dst to temp for easier manipulation
+    src = dst;
+  201b11:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  201b18:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    while (*src && tlen < (int)sizeof(temp)-1) {
+  201b1c:	eb 22                	jmp    201b40 <join_path+0x1c4>
+        temp[tlen++] = *src++;
+  201b1e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201b22:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  201b26:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  201b2a:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  201b2d:	8d 4a 01             	lea    0x1(%rdx),%ecx
+  201b30:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  201b33:	0f b6 08             	movzbl (%rax),%ecx
+  201b36:	48 63 c2             	movslq %edx,%rax
+  201b39:	88 8c 05 b0 fd ff ff 	mov    %cl,-0x250(%rbp,%rax,1)
+    while (*src && tlen < (int)sizeof(temp)-1) {
+  201b40:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201b44:	0f b6 00             	movzbl (%rax),%eax
+  201b47:	84 c0                	test   %al,%al
+  201b49:	74 09                	je     201b54 <join_path+0x1d8>
+  201b4b:	81 7d dc fe 01 00 00 	cmpl   $0x1fe,-0x24(%rbp)
+  201b52:	7e ca                	jle    201b1e <join_path+0x1a2>
+    }
+    temp[tlen] = 0;
+  201b54:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201b57:	48 98                	cltq
+  201b59:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  201b60:	00 
+
+    // Now, process each component in path
+    src = path;
+  201b61:	48 8b 85 a0 fd ff ff 	mov    -0x260(%rbp),%rax
+  201b68:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    while (*src) {
+  201b6c:	e9 65 01 00 00       	jmp    201cd6 <join_path+0x35a>
+        // Skip slashes
+        while (*src == '/') src++;
+  201b71:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  201b76:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201b7a:	0f b6 00             	movzbl (%rax),%eax
+  201b7d:	3c 2f                	cmp    $0x2f,%al
+  201b7f:	74 f0                	je     201b71 <join_path+0x1f5>
+        if (!*src) break;
+  201b81:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201b85:	0f b6 00             	movzbl (%rax),%eax
+  201b88:	84 c0                	test   %al,%al
+  201b8a:	0f 84 57 01 00 00    	je     201ce7 <join_path+0x36b>
+
+        // Find end of component
+        const char *comp_start = src;
+  201b90:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201b94:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        while (*src && *src != '/') src++;
+  201b98:	eb 05                	jmp    201b9f <join_path+0x223>
+  201b9a:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  201b9f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201ba3:	0f b6 00             	movzbl (%rax),%eax
+  201ba6:	84 c0                	test   %al,%al
+  201ba8:	74 0b                	je     201bb5 <join_path+0x239>
+  201baa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201bae:	0f b6 00             	movzbl (%rax),%eax
+  201bb1:	3c 2f                	cmp    $0x2f,%al
+  201bb3:	75 e5                	jne    201b9a <join_path+0x21e>
+        const char *comp_end = src;
+  201bb5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201bb9:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+
+        int comp_len = comp_end - comp_start;
+  201bbd:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  201bc1:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  201bc5:	89 45 b4             	mov    %eax,-0x4c(%rbp)
+
+        // Get component string
+        if (comp_len == 1 && comp_start[0] == '.') {
+  201bc8:	83 7d b4 01          	cmpl   $0x1,-0x4c(%rbp)
+  201bcc:	75 10                	jne    201bde <join_path+0x262>
+  201bce:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  201bd2:	0f b6 00             	movzbl (%rax),%eax
+  201bd5:	3c 2e                	cmp    $0x2e,%al
+  201bd7:	75 05                	jne    201bde <join_path+0x262>
+            // Ignore
+            continue;
+  201bd9:	e9 f8 00 00 00       	jmp    201cd6 <join_path+0x35a>
+        } else if (comp_len == 2 && comp_start[0] == '.' && comp_start[1] == '.') {
+  201bde:	83 7d b4 02          	cmpl   $0x2,-0x4c(%rbp)
+  201be2:	75 6e                	jne    201c52 <join_path+0x2d6>
+  201be4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  201be8:	0f b6 00             	movzbl (%rax),%eax
+  201beb:	3c 2e                	cmp    $0x2e,%al
+  201bed:	75 63                	jne    201c52 <join_path+0x2d6>
+  201bef:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  201bf3:	48 83 c0 01          	add    $0x1,%rax
+  201bf7:	0f b6 00             	movzbl (%rax),%eax
+  201bfa:	3c 2e                	cmp    $0x2e,%al
+  201bfc:	75 54                	jne    201c52 <join_path+0x2d6>
+            // Go up one directory, unless at root
+            if (tlen > 1) {
+  201bfe:	83 7d dc 01          	cmpl   $0x1,-0x24(%rbp)
+  201c02:	0f 8e ce 00 00 00    	jle    201cd6 <join_path+0x35a>
+                // Remove trailing slash if any
+                if (temp[tlen-1] == '/') tlen--;
+  201c08:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201c0b:	83 e8 01             	sub    $0x1,%eax
+  201c0e:	48 98                	cltq
+  201c10:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  201c17:	ff 
+  201c18:	3c 2f                	cmp    $0x2f,%al
+  201c1a:	75 0a                	jne    201c26 <join_path+0x2aa>
+  201c1c:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+                // Remove last component
+                while (tlen > 1 && temp[tlen-1] != '/') tlen--;
+  201c20:	eb 04                	jmp    201c26 <join_path+0x2aa>
+  201c22:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  201c26:	83 7d dc 01          	cmpl   $0x1,-0x24(%rbp)
+  201c2a:	7e 14                	jle    201c40 <join_path+0x2c4>
+  201c2c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201c2f:	83 e8 01             	sub    $0x1,%eax
+  201c32:	48 98                	cltq
+  201c34:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  201c3b:	ff 
+  201c3c:	3c 2f                	cmp    $0x2f,%al
+  201c3e:	75 e2                	jne    201c22 <join_path+0x2a6>
+                temp[tlen] = 0;
+  201c40:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201c43:	48 98                	cltq
+  201c45:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  201c4c:	00 
+            if (tlen > 1) {
+  201c4d:	e9 84 00 00 00       	jmp    201cd6 <join_path+0x35a>
+            }
+        } else if (comp_len > 0) {
+  201c52:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  201c56:	7e 7e                	jle    201cd6 <join_path+0x35a>
+            // Add slash if not at root
+            if (tlen == 0 || temp[tlen-1] != '/') {
+  201c58:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  201c5c:	74 14                	je     201c72 <join_path+0x2f6>
+  201c5e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201c61:	83 e8 01             	sub    $0x1,%eax
+  201c64:	48 98                	cltq
+  201c66:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  201c6d:	ff 
+  201c6e:	3c 2f                	cmp    $0x2f,%al
+  201c70:	74 1c                	je     201c8e <join_path+0x312>
+                if (tlen < (int)sizeof(temp)-1) temp[tlen++] = '/';
+  201c72:	81 7d dc fe 01 00 00 	cmpl   $0x1fe,-0x24(%rbp)
+  201c79:	7f 13                	jg     201c8e <join_path+0x312>
+  201c7b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201c7e:	8d 50 01             	lea    0x1(%rax),%edx
+  201c81:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  201c84:	48 98                	cltq
+  201c86:	c6 84 05 b0 fd ff ff 	movb   $0x2f,-0x250(%rbp,%rax,1)
+  201c8d:	2f 
+            }
+            // Copy component
+            for (const char *p = comp_start; p < comp_end && tlen < (int)sizeof(temp)-1; ++p) {
+  201c8e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  201c92:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  201c96:	eb 1e                	jmp    201cb6 <join_path+0x33a>
+                temp[tlen++] = *p;
+  201c98:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201c9b:	8d 50 01             	lea    0x1(%rax),%edx
+  201c9e:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  201ca1:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  201ca5:	0f b6 12             	movzbl (%rdx),%edx
+  201ca8:	48 98                	cltq
+  201caa:	88 94 05 b0 fd ff ff 	mov    %dl,-0x250(%rbp,%rax,1)
+            for (const char *p = comp_start; p < comp_end && tlen < (int)sizeof(temp)-1; ++p) {
+  201cb1:	48 83 45 d0 01       	addq   $0x1,-0x30(%rbp)
+  201cb6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  201cba:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  201cbe:	73 09                	jae    201cc9 <join_path+0x34d>
+  201cc0:	81 7d dc fe 01 00 00 	cmpl   $0x1fe,-0x24(%rbp)
+  201cc7:	7e cf                	jle    201c98 <join_path+0x31c>
+            }
+            temp[tlen] = 0;
+  201cc9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201ccc:	48 98                	cltq
+  201cce:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  201cd5:	00 
+    while (*src) {
+  201cd6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201cda:	0f b6 00             	movzbl (%rax),%eax
+  201cdd:	84 c0                	test   %al,%al
+  201cdf:	0f 85 91 fe ff ff    	jne    201b76 <join_path+0x1fa>
+  201ce5:	eb 01                	jmp    201ce8 <join_path+0x36c>
+        if (!*src) break;
+  201ce7:	90                   	nop
+        }
+    }
+
+    // If temp is empty, set to "/"
+    if (tlen == 0) {
+  201ce8:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  201cec:	75 20                	jne    201d0e <join_path+0x392>
+        temp[tlen++] = '/';
+  201cee:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201cf1:	8d 50 01             	lea    0x1(%rax),%edx
+  201cf4:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  201cf7:	48 98                	cltq
+  201cf9:	c6 84 05 b0 fd ff ff 	movb   $0x2f,-0x250(%rbp,%rax,1)
+  201d00:	2f 
+        temp[tlen] = 0;
+  201d01:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201d04:	48 98                	cltq
+  201d06:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  201d0d:	00 
+    }
+
+    // Remove trailing slash unless the path is just "/"
+    if (tlen > 1 && temp[tlen-1] == '/') {
+  201d0e:	83 7d dc 01          	cmpl   $0x1,-0x24(%rbp)
+  201d12:	7e 25                	jle    201d39 <join_path+0x3bd>
+  201d14:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201d17:	83 e8 01             	sub    $0x1,%eax
+  201d1a:	48 98                	cltq
+  201d1c:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  201d23:	ff 
+  201d24:	3c 2f                	cmp    $0x2f,%al
+  201d26:	75 11                	jne    201d39 <join_path+0x3bd>
+        temp[--tlen] = 0;
+  201d28:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  201d2c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201d2f:	48 98                	cltq
+  201d31:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  201d38:	00 
+    }
+
+    // Copy temp to dst
+    for (int i = 0; i <= tlen; ++i) {
+  201d39:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  201d40:	eb 23                	jmp    201d65 <join_path+0x3e9>
+        dst[i] = temp[i];
+  201d42:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  201d45:	48 63 d0             	movslq %eax,%rdx
+  201d48:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  201d4f:	48 01 c2             	add    %rax,%rdx
+  201d52:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  201d55:	48 98                	cltq
+  201d57:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  201d5e:	ff 
+  201d5f:	88 02                	mov    %al,(%rdx)
+    for (int i = 0; i <= tlen; ++i) {
+  201d61:	83 45 cc 01          	addl   $0x1,-0x34(%rbp)
+  201d65:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  201d68:	3b 45 dc             	cmp    -0x24(%rbp),%eax
+  201d6b:	7e d5                	jle    201d42 <join_path+0x3c6>
+    }
+}
+  201d6d:	c9                   	leave
+  201d6e:	c3                   	ret
+
+0000000000201d6f <app_printf>:
+#include "lib-malloc.h"
+#include "errno.h"
+// app_printf
+//     A version of console_printf that picks a sensible color by process ID.
+
+void app_printf(int colorid, const char* format, ...) {
+  201d6f:	55                   	push   %rbp
+  201d70:	48 89 e5             	mov    %rsp,%rbp
+  201d73:	48 83 ec 50          	sub    $0x50,%rsp
+  201d77:	49 89 f2             	mov    %rsi,%r10
+  201d7a:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  201d7e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  201d82:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  201d86:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    int color;
+    if (colorid < 0) {
+        color = 0x0700;
+  201d8a:	be 00 07 00 00       	mov    $0x700,%esi
+    if (colorid < 0) {
+  201d8f:	85 ff                	test   %edi,%edi
+  201d91:	78 32                	js     201dc5 <app_printf+0x56>
+    } else {
+        static const uint8_t col[] = { 0x0F, 0x0C, 0x0A, 0x09, 0x0E };
+        color = col[colorid % sizeof(col)] << 8;
+  201d93:	48 63 ff             	movslq %edi,%rdi
+  201d96:	48 ba cd cc cc cc cc 	movabs $0xcccccccccccccccd,%rdx
+  201d9d:	cc cc cc 
+  201da0:	48 89 f8             	mov    %rdi,%rax
+  201da3:	48 f7 e2             	mul    %rdx
+  201da6:	48 89 d0             	mov    %rdx,%rax
+  201da9:	48 c1 e8 02          	shr    $0x2,%rax
+  201dad:	48 83 e2 fc          	and    $0xfffffffffffffffc,%rdx
+  201db1:	48 01 c2             	add    %rax,%rdx
+  201db4:	48 29 d7             	sub    %rdx,%rdi
+  201db7:	48 8d 05 3a 09 00 00 	lea    0x93a(%rip),%rax        # 2026f8 <col.0>
+  201dbe:	0f b6 34 38          	movzbl (%rax,%rdi,1),%esi
+  201dc2:	c1 e6 08             	shl    $0x8,%esi
+    }
+
+    va_list val;
+    va_start(val, format);
+  201dc5:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  201dcc:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  201dd0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  201dd4:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  201dd8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    cursorpos = console_vprintf(cursorpos, color, format, val);
+  201ddc:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  201de0:	4c 89 d2             	mov    %r10,%rdx
+  201de3:	8b 3d 13 72 eb ff    	mov    -0x148ded(%rip),%edi        # b8ffc <cursorpos>
+  201de9:	e8 24 f7 ff ff       	call   201512 <console_vprintf>
+  201dee:	89 05 08 72 eb ff    	mov    %eax,-0x148df8(%rip)        # b8ffc <cursorpos>
+    va_end(val);
+
+    /*if (CROW(cursorpos) >= 23) {
+        cursorpos = CPOS(0, 0);
+    }*/
+}
+  201df4:	c9                   	leave
+  201df5:	c3                   	ret
+
+0000000000201df6 <panic>:
+
+
+// panic, assert_fail
+//     Call the INT_SYS_PANIC system call so the kernel loops until Control-C.
+
+void panic(const char* format, ...) {
+  201df6:	55                   	push   %rbp
+  201df7:	48 89 e5             	mov    %rsp,%rbp
+  201dfa:	53                   	push   %rbx
+  201dfb:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  201e02:	48 89 fb             	mov    %rdi,%rbx
+  201e05:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  201e09:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  201e0d:	48 89 4d d8          	mov    %rcx,-0x28(%rbp)
+  201e11:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  201e15:	4c 89 4d e8          	mov    %r9,-0x18(%rbp)
+    va_list val;
+    va_start(val, format);
+  201e19:	c7 45 a8 08 00 00 00 	movl   $0x8,-0x58(%rbp)
+  201e20:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  201e24:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  201e28:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  201e2c:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    char buf[160];
+    memcpy(buf, "PANIC: ", 7);
+  201e30:	48 8d bd 08 ff ff ff 	lea    -0xf8(%rbp),%rdi
+  201e37:	ba 07 00 00 00       	mov    $0x7,%edx
+  201e3c:	48 8d 35 ee 06 00 00 	lea    0x6ee(%rip),%rsi        # 202531 <lower_digits.0+0x11>
+  201e43:	e8 31 e5 ff ff       	call   200379 <memcpy>
+    int len = vsnprintf(&buf[7], sizeof(buf) - 7, format, val) + 7;
+  201e48:	48 8d 4d a8          	lea    -0x58(%rbp),%rcx
+  201e4c:	48 8d bd 0f ff ff ff 	lea    -0xf1(%rbp),%rdi
+  201e53:	48 89 da             	mov    %rbx,%rdx
+  201e56:	be 99 00 00 00       	mov    $0x99,%esi
+  201e5b:	e8 cd f7 ff ff       	call   20162d <vsnprintf>
+  201e60:	8d 50 07             	lea    0x7(%rax),%edx
+    va_end(val);
+    if (len > 0 && buf[len - 1] != '\n') {
+  201e63:	85 d2                	test   %edx,%edx
+  201e65:	7e 0f                	jle    201e76 <panic+0x80>
+  201e67:	83 c0 06             	add    $0x6,%eax
+  201e6a:	48 98                	cltq
+  201e6c:	80 bc 05 08 ff ff ff 	cmpb   $0xa,-0xf8(%rbp,%rax,1)
+  201e73:	0a 
+  201e74:	75 30                	jne    201ea6 <panic+0xb0>
+        strcpy(buf + len - (len == (int) sizeof(buf) - 1), "\n");
+    }
+    (void) console_printf(CPOS(23, 0), 0xC000, "%s", buf);
+  201e76:	48 8d 8d 08 ff ff ff 	lea    -0xf8(%rbp),%rcx
+  201e7d:	48 8d 15 b5 06 00 00 	lea    0x6b5(%rip),%rdx        # 202539 <lower_digits.0+0x19>
+  201e84:	be 00 c0 00 00       	mov    $0xc000,%esi
+  201e89:	bf 30 07 00 00       	mov    $0x730,%edi
+  201e8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  201e93:	e8 f5 f6 ff ff       	call   20158d <console_printf>
+    asm volatile ("syscall" : "=a" (rax)
+  201e98:	b8 30 00 00 00       	mov    $0x30,%eax
+  201e9d:	bf 00 00 00 00       	mov    $0x0,%edi
+  201ea2:	0f 05                	syscall
+ loop: goto loop;
+  201ea4:	eb fe                	jmp    201ea4 <panic+0xae>
+        strcpy(buf + len - (len == (int) sizeof(buf) - 1), "\n");
+  201ea6:	48 63 c2             	movslq %edx,%rax
+  201ea9:	81 fa 9f 00 00 00    	cmp    $0x9f,%edx
+  201eaf:	0f 94 c2             	sete   %dl
+  201eb2:	0f b6 d2             	movzbl %dl,%edx
+  201eb5:	48 29 d0             	sub    %rdx,%rax
+  201eb8:	48 8d bc 05 08 ff ff 	lea    -0xf8(%rbp,%rax,1),%rdi
+  201ebf:	ff 
+  201ec0:	48 8d 35 9f 04 00 00 	lea    0x49f(%rip),%rsi        # 202366 <malloc+0xa8>
+  201ec7:	e8 3b e8 ff ff       	call   200707 <strcpy>
+  201ecc:	eb a8                	jmp    201e76 <panic+0x80>
+
+0000000000201ece <raise>:
+
+#define SIGABRT -1
+
+
+
+int raise(int sig) {
+  201ece:	89 fe                	mov    %edi,%esi
+
+// getpid()
+//    Return current process ID, like sys_getpid().
+static inline pid_t getpid(void) {
+    return vdso()->pid;
+  201ed0:	8b 3c 25 00 10 24 00 	mov    0x241000,%edi
+    asm volatile ("syscall" : "=a" (result)
+  201ed7:	b8 41 00 00 00       	mov    $0x41,%eax
+  201edc:	0f 05                	syscall
+    return sys_kill(getpid(), sig);
+}
+  201ede:	c3                   	ret
+
+0000000000201edf <abort>:
+    return vdso()->pid;
+  201edf:	8b 3c 25 00 10 24 00 	mov    0x241000,%edi
+    asm volatile ("syscall" : "=a" (result)
+  201ee6:	b8 41 00 00 00       	mov    $0x41,%eax
+  201eeb:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  201ef0:	0f 05                	syscall
+
+void __attribute((noreturn)) abort(void) {
+    raise(SIGABRT);
+ spinloop: goto spinloop;       // should never get here
+  201ef2:	eb fe                	jmp    201ef2 <abort+0x13>
+
+0000000000201ef4 <assert_fail>:
+}
+
+
+void assert_fail(const char* file, int line, const char* msg) {
+  201ef4:	55                   	push   %rbp
+  201ef5:	48 89 e5             	mov    %rsp,%rbp
+  201ef8:	48 89 f9             	mov    %rdi,%rcx
+  201efb:	41 89 f0             	mov    %esi,%r8d
+  201efe:	49 89 d1             	mov    %rdx,%r9
+    (void) console_printf(CPOS(23, 0), 0xC000,
+  201f01:	48 8d 15 10 07 00 00 	lea    0x710(%rip),%rdx        # 202618 <lower_digits.0+0xf8>
+  201f08:	be 00 c0 00 00       	mov    $0xc000,%esi
+  201f0d:	bf 30 07 00 00       	mov    $0x730,%edi
+  201f12:	b8 00 00 00 00       	mov    $0x0,%eax
+  201f17:	e8 71 f6 ff ff       	call   20158d <console_printf>
+                          "PANIC: %s:%d: assertion '%s' failed\n",
+                          file, line, msg);
+    abort();
+  201f1c:	e8 be ff ff ff       	call   201edf <abort>
+
+0000000000201f21 <scan_char>:
+    asm volatile ("syscall" : "=a" (result)
+  201f21:	bf 3a 00 00 00       	mov    $0x3a,%edi
+    asm volatile ("syscall" : "=a" (rax)
+  201f26:	be 3c 00 00 00       	mov    $0x3c,%esi
+    asm volatile ("syscall" : "=a" (result)
+  201f2b:	89 f8                	mov    %edi,%eax
+  201f2d:	0f 05                	syscall
+  201f2f:	89 c2                	mov    %eax,%edx
+    asm volatile ("syscall" : "=a" (rax)
+  201f31:	89 f0                	mov    %esi,%eax
+  201f33:	0f 05                	syscall
+    int c;
+
+    do {
+        c = sys_keybord();
+        sys_yield();
+    } while (c == -1);
+  201f35:	83 fa ff             	cmp    $0xffffffff,%edx
+  201f38:	74 f1                	je     201f2b <scan_char+0xa>
+
+    return c;
+  201f3a:	89 d0                	mov    %edx,%eax
+}
+  201f3c:	c3                   	ret
+
+0000000000201f3d <scan_line>:
+
+unsigned int scan_line(char* dst, unsigned int length_max) {
+  201f3d:	55                   	push   %rbp
+  201f3e:	48 89 e5             	mov    %rsp,%rbp
+  201f41:	41 57                	push   %r15
+  201f43:	41 56                	push   %r14
+  201f45:	41 55                	push   %r13
+  201f47:	41 54                	push   %r12
+  201f49:	53                   	push   %rbx
+  201f4a:	48 83 ec 08          	sub    $0x8,%rsp
+  201f4e:	49 89 fe             	mov    %rdi,%r14
+  201f51:	41 89 f5             	mov    %esi,%r13d
+    unsigned int length = 0;
+  201f54:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            app_printf(0, "%c", c);
+            dst[length] = '\0';
+            return length;
+        } else if (c >= 32 && c <= 127) {
+            if (length < length_max) {
+                app_printf(0, "%c", c);
+  201f5a:	4c 8d 3d db 05 00 00 	lea    0x5db(%rip),%r15        # 20253c <lower_digits.0+0x1c>
+  201f61:	eb 05                	jmp    201f68 <scan_line+0x2b>
+            if (length != 0) {
+  201f63:	45 85 e4             	test   %r12d,%r12d
+  201f66:	75 3e                	jne    201fa6 <scan_line+0x69>
+        unsigned char c = scan_char();
+  201f68:	e8 b4 ff ff ff       	call   201f21 <scan_char>
+  201f6d:	89 c3                	mov    %eax,%ebx
+        if (c == '\b') {
+  201f6f:	3c 08                	cmp    $0x8,%al
+  201f71:	74 f0                	je     201f63 <scan_line+0x26>
+        } else if (c == '\n') {
+  201f73:	3c 0a                	cmp    $0xa,%al
+  201f75:	74 4c                	je     201fc3 <scan_line+0x86>
+        } else if (c >= 32 && c <= 127) {
+  201f77:	8d 43 e0             	lea    -0x20(%rbx),%eax
+            if (length < length_max) {
+  201f7a:	3c 5f                	cmp    $0x5f,%al
+  201f7c:	77 ea                	ja     201f68 <scan_line+0x2b>
+  201f7e:	45 39 ec             	cmp    %r13d,%r12d
+  201f81:	73 e5                	jae    201f68 <scan_line+0x2b>
+                app_printf(0, "%c", c);
+  201f83:	0f b6 d3             	movzbl %bl,%edx
+  201f86:	4c 89 fe             	mov    %r15,%rsi
+  201f89:	bf 00 00 00 00       	mov    $0x0,%edi
+  201f8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  201f93:	e8 d7 fd ff ff       	call   201d6f <app_printf>
+                dst[length++] = c;
+  201f98:	44 89 e0             	mov    %r12d,%eax
+  201f9b:	41 88 1c 06          	mov    %bl,(%r14,%rax,1)
+  201f9f:	45 8d 64 24 01       	lea    0x1(%r12),%r12d
+  201fa4:	eb c2                	jmp    201f68 <scan_line+0x2b>
+                app_printf(0, "%c", c);
+  201fa6:	ba 08 00 00 00       	mov    $0x8,%edx
+  201fab:	4c 89 fe             	mov    %r15,%rsi
+  201fae:	bf 00 00 00 00       	mov    $0x0,%edi
+  201fb3:	b8 00 00 00 00       	mov    $0x0,%eax
+  201fb8:	e8 b2 fd ff ff       	call   201d6f <app_printf>
+                length--;
+  201fbd:	41 83 ec 01          	sub    $0x1,%r12d
+  201fc1:	eb a5                	jmp    201f68 <scan_line+0x2b>
+            app_printf(0, "%c", c);
+  201fc3:	ba 0a 00 00 00       	mov    $0xa,%edx
+  201fc8:	48 8d 35 6d 05 00 00 	lea    0x56d(%rip),%rsi        # 20253c <lower_digits.0+0x1c>
+  201fcf:	bf 00 00 00 00       	mov    $0x0,%edi
+  201fd4:	b8 00 00 00 00       	mov    $0x0,%eax
+  201fd9:	e8 91 fd ff ff       	call   201d6f <app_printf>
+            dst[length] = '\0';
+  201fde:	44 89 e0             	mov    %r12d,%eax
+  201fe1:	41 c6 04 06 00       	movb   $0x0,(%r14,%rax,1)
+            }
+        }
+    }
+}
+  201fe6:	44 89 e0             	mov    %r12d,%eax
+  201fe9:	48 83 c4 08          	add    $0x8,%rsp
+  201fed:	5b                   	pop    %rbx
+  201fee:	41 5c                	pop    %r12
+  201ff0:	41 5d                	pop    %r13
+  201ff2:	41 5e                	pop    %r14
+  201ff4:	41 5f                	pop    %r15
+  201ff6:	5d                   	pop    %rbp
+  201ff7:	c3                   	ret
+
+0000000000201ff8 <split_string>:
+
+
+char** split_string(char* str, char sep) {
+  201ff8:	55                   	push   %rbp
+  201ff9:	48 89 e5             	mov    %rsp,%rbp
+  201ffc:	41 57                	push   %r15
+  201ffe:	41 56                	push   %r14
+  202000:	41 55                	push   %r13
+  202002:	41 54                	push   %r12
+  202004:	53                   	push   %rbx
+  202005:	48 83 ec 08          	sub    $0x8,%rsp
+    int s = 1;
+    int n = 0;
+
+    while (str[n]) {
+  202009:	0f b6 07             	movzbl (%rdi),%eax
+  20200c:	84 c0                	test   %al,%al
+  20200e:	0f 84 ad 00 00 00    	je     2020c1 <split_string+0xc9>
+  202014:	48 89 fb             	mov    %rdi,%rbx
+  202017:	41 89 f4             	mov    %esi,%r12d
+  20201a:	41 be 01 00 00 00    	mov    $0x1,%r14d
+    int s = 1;
+  202020:	b9 01 00 00 00       	mov    $0x1,%ecx
+  202025:	eb 03                	jmp    20202a <split_string+0x32>
+  202027:	49 89 d6             	mov    %rdx,%r14
+        if (str[n] == sep)
+            s++;
+  20202a:	41 38 c4             	cmp    %al,%r12b
+  20202d:	0f 94 c0             	sete   %al
+  202030:	0f b6 c0             	movzbl %al,%eax
+  202033:	01 c1                	add    %eax,%ecx
+    while (str[n]) {
+  202035:	49 8d 56 01          	lea    0x1(%r14),%rdx
+  202039:	0f b6 44 13 ff       	movzbl -0x1(%rbx,%rdx,1),%eax
+  20203e:	84 c0                	test   %al,%al
+  202040:	75 e5                	jne    202027 <split_string+0x2f>
+        n++;
+    }
+    
+    char** part = malloc((s+1)*sizeof(char*));
+  202042:	44 8d 79 01          	lea    0x1(%rcx),%r15d
+  202046:	4d 63 ff             	movslq %r15d,%r15
+  202049:	49 c1 e7 03          	shl    $0x3,%r15
+  20204d:	4c 89 ff             	mov    %r15,%rdi
+  202050:	e8 69 02 00 00       	call   2022be <malloc>
+  202055:	49 89 c5             	mov    %rax,%r13
+    char* buffer = malloc(n+1);
+  202058:	41 8d 7e 01          	lea    0x1(%r14),%edi
+  20205c:	48 63 ff             	movslq %edi,%rdi
+  20205f:	e8 5a 02 00 00       	call   2022be <malloc>
+
+    int word_n = 0;
+    part[0] = buffer;
+  202064:	49 89 45 00          	mov    %rax,0x0(%r13)
+    part[s] = NULL;
+  202068:	4b c7 44 3d f8 00 00 	movq   $0x0,-0x8(%r13,%r15,1)
+  20206f:	00 00 
+    buffer[n] = 0;
+  202071:	42 c6 04 30 00       	movb   $0x0,(%rax,%r14,1)
+
+    for (int i = 0; i < n; i++) {
+  202076:	45 85 f6             	test   %r14d,%r14d
+  202079:	7e 6c                	jle    2020e7 <split_string+0xef>
+  20207b:	41 83 ee 01          	sub    $0x1,%r14d
+  20207f:	48 89 da             	mov    %rbx,%rdx
+  202082:	48 83 c0 01          	add    $0x1,%rax
+  202086:	48 89 c1             	mov    %rax,%rcx
+    int word_n = 0;
+  202089:	bf 00 00 00 00       	mov    $0x0,%edi
+  20208e:	eb 23                	jmp    2020b3 <split_string+0xbb>
+        if (str[i] == sep) {
+            buffer[i] = 0;
+  202090:	c6 41 ff 00          	movb   $0x0,-0x1(%rcx)
+            part[++word_n] = &buffer[i+1];
+  202094:	83 c7 01             	add    $0x1,%edi
+  202097:	48 63 f7             	movslq %edi,%rsi
+  20209a:	49 89 4c f5 00       	mov    %rcx,0x0(%r13,%rsi,8)
+    for (int i = 0; i < n; i++) {
+  20209f:	48 83 c2 01          	add    $0x1,%rdx
+  2020a3:	48 83 c1 01          	add    $0x1,%rcx
+  2020a7:	89 ce                	mov    %ecx,%esi
+  2020a9:	29 c6                	sub    %eax,%esi
+  2020ab:	83 ee 01             	sub    $0x1,%esi
+  2020ae:	44 39 f6             	cmp    %r14d,%esi
+  2020b1:	7d 34                	jge    2020e7 <split_string+0xef>
+        if (str[i] == sep) {
+  2020b3:	0f b6 32             	movzbl (%rdx),%esi
+  2020b6:	44 38 e6             	cmp    %r12b,%sil
+  2020b9:	74 d5                	je     202090 <split_string+0x98>
+        } else {
+            buffer[i] = str[i];
+  2020bb:	40 88 71 ff          	mov    %sil,-0x1(%rcx)
+  2020bf:	eb de                	jmp    20209f <split_string+0xa7>
+    char** part = malloc((s+1)*sizeof(char*));
+  2020c1:	bf 10 00 00 00       	mov    $0x10,%edi
+  2020c6:	e8 f3 01 00 00       	call   2022be <malloc>
+  2020cb:	49 89 c5             	mov    %rax,%r13
+    char* buffer = malloc(n+1);
+  2020ce:	bf 01 00 00 00       	mov    $0x1,%edi
+  2020d3:	e8 e6 01 00 00       	call   2022be <malloc>
+    part[0] = buffer;
+  2020d8:	49 89 45 00          	mov    %rax,0x0(%r13)
+    part[s] = NULL;
+  2020dc:	49 c7 45 08 00 00 00 	movq   $0x0,0x8(%r13)
+  2020e3:	00 
+    buffer[n] = 0;
+  2020e4:	c6 00 00             	movb   $0x0,(%rax)
+        }
+    }
+
+    return part;
+}
+  2020e7:	4c 89 e8             	mov    %r13,%rax
+  2020ea:	48 83 c4 08          	add    $0x8,%rsp
+  2020ee:	5b                   	pop    %rbx
+  2020ef:	41 5c                	pop    %r12
+  2020f1:	41 5d                	pop    %r13
+  2020f3:	41 5e                	pop    %r14
+  2020f5:	41 5f                	pop    %r15
+  2020f7:	5d                   	pop    %rbp
+  2020f8:	c3                   	ret
+
+00000000002020f9 <app_print_error>:
+
+
+void app_print_error(int r) {
+  2020f9:	55                   	push   %rbp
+  2020fa:	48 89 e5             	mov    %rsp,%rbp
+    switch (r) {
+  2020fd:	83 ff 24             	cmp    $0x24,%edi
+  202100:	0f 87 79 01 00 00    	ja     20227f <app_print_error+0x186>
+  202106:	89 f8                	mov    %edi,%eax
+  202108:	48 8d 15 55 05 00 00 	lea    0x555(%rip),%rdx        # 202664 <lower_digits.0+0x144>
+  20210f:	48 63 04 82          	movslq (%rdx,%rax,4),%rax
+  202113:	48 01 d0             	add    %rdx,%rax
+  202116:	ff e0                	jmp    *%rax
+        case ENOENT:
+            app_printf(1, "Error: %s\n", "No such file or directory");
+  202118:	48 8d 15 20 04 00 00 	lea    0x420(%rip),%rdx        # 20253f <lower_digits.0+0x1f>
+  20211f:	48 8d 35 33 04 00 00 	lea    0x433(%rip),%rsi        # 202559 <lower_digits.0+0x39>
+  202126:	bf 01 00 00 00       	mov    $0x1,%edi
+  20212b:	b8 00 00 00 00       	mov    $0x0,%eax
+  202130:	e8 3a fc ff ff       	call   201d6f <app_printf>
+            break;
+        default:
+            app_printf(1, "Error %d: %s\n", r, "Unknown error");
+            break;
+    }
+}
+  202135:	5d                   	pop    %rbp
+  202136:	c3                   	ret
+            app_printf(1, "Error: %s\n", "I/O error");
+  202137:	48 8d 15 26 04 00 00 	lea    0x426(%rip),%rdx        # 202564 <lower_digits.0+0x44>
+  20213e:	48 8d 35 14 04 00 00 	lea    0x414(%rip),%rsi        # 202559 <lower_digits.0+0x39>
+  202145:	bf 01 00 00 00       	mov    $0x1,%edi
+  20214a:	b8 00 00 00 00       	mov    $0x0,%eax
+  20214f:	e8 1b fc ff ff       	call   201d6f <app_printf>
+            break;
+  202154:	eb df                	jmp    202135 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Exec format error");
+  202156:	48 8d 15 11 04 00 00 	lea    0x411(%rip),%rdx        # 20256e <lower_digits.0+0x4e>
+  20215d:	48 8d 35 f5 03 00 00 	lea    0x3f5(%rip),%rsi        # 202559 <lower_digits.0+0x39>
+  202164:	bf 01 00 00 00       	mov    $0x1,%edi
+  202169:	b8 00 00 00 00       	mov    $0x0,%eax
+  20216e:	e8 fc fb ff ff       	call   201d6f <app_printf>
+            break;
+  202173:	eb c0                	jmp    202135 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Resource temporarily unavailable");
+  202175:	48 8d 15 c4 04 00 00 	lea    0x4c4(%rip),%rdx        # 202640 <lower_digits.0+0x120>
+  20217c:	48 8d 35 d6 03 00 00 	lea    0x3d6(%rip),%rsi        # 202559 <lower_digits.0+0x39>
+  202183:	bf 01 00 00 00       	mov    $0x1,%edi
+  202188:	b8 00 00 00 00       	mov    $0x0,%eax
+  20218d:	e8 dd fb ff ff       	call   201d6f <app_printf>
+            break;
+  202192:	eb a1                	jmp    202135 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Out of memory");
+  202194:	48 8d 15 e5 03 00 00 	lea    0x3e5(%rip),%rdx        # 202580 <lower_digits.0+0x60>
+  20219b:	48 8d 35 b7 03 00 00 	lea    0x3b7(%rip),%rsi        # 202559 <lower_digits.0+0x39>
+  2021a2:	bf 01 00 00 00       	mov    $0x1,%edi
+  2021a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  2021ac:	e8 be fb ff ff       	call   201d6f <app_printf>
+            break;
+  2021b1:	eb 82                	jmp    202135 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Bad address");
+  2021b3:	48 8d 15 d4 03 00 00 	lea    0x3d4(%rip),%rdx        # 20258e <lower_digits.0+0x6e>
+  2021ba:	48 8d 35 98 03 00 00 	lea    0x398(%rip),%rsi        # 202559 <lower_digits.0+0x39>
+  2021c1:	bf 01 00 00 00       	mov    $0x1,%edi
+  2021c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  2021cb:	e8 9f fb ff ff       	call   201d6f <app_printf>
+            break;
+  2021d0:	e9 60 ff ff ff       	jmp    202135 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Not a directory");
+  2021d5:	48 8d 15 be 03 00 00 	lea    0x3be(%rip),%rdx        # 20259a <lower_digits.0+0x7a>
+  2021dc:	48 8d 35 76 03 00 00 	lea    0x376(%rip),%rsi        # 202559 <lower_digits.0+0x39>
+  2021e3:	bf 01 00 00 00       	mov    $0x1,%edi
+  2021e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  2021ed:	e8 7d fb ff ff       	call   201d6f <app_printf>
+            break;
+  2021f2:	e9 3e ff ff ff       	jmp    202135 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Invalid argument");
+  2021f7:	48 8d 15 ac 03 00 00 	lea    0x3ac(%rip),%rdx        # 2025aa <lower_digits.0+0x8a>
+  2021fe:	48 8d 35 54 03 00 00 	lea    0x354(%rip),%rsi        # 202559 <lower_digits.0+0x39>
+  202205:	bf 01 00 00 00       	mov    $0x1,%edi
+  20220a:	b8 00 00 00 00       	mov    $0x0,%eax
+  20220f:	e8 5b fb ff ff       	call   201d6f <app_printf>
+            break;
+  202214:	e9 1c ff ff ff       	jmp    202135 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "No space left on device");
+  202219:	48 8d 15 9b 03 00 00 	lea    0x39b(%rip),%rdx        # 2025bb <lower_digits.0+0x9b>
+  202220:	48 8d 35 32 03 00 00 	lea    0x332(%rip),%rsi        # 202559 <lower_digits.0+0x39>
+  202227:	bf 01 00 00 00       	mov    $0x1,%edi
+  20222c:	b8 00 00 00 00       	mov    $0x0,%eax
+  202231:	e8 39 fb ff ff       	call   201d6f <app_printf>
+            break;
+  202236:	e9 fa fe ff ff       	jmp    202135 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "File already exists");
+  20223b:	48 8d 15 91 03 00 00 	lea    0x391(%rip),%rdx        # 2025d3 <lower_digits.0+0xb3>
+  202242:	48 8d 35 10 03 00 00 	lea    0x310(%rip),%rsi        # 202559 <lower_digits.0+0x39>
+  202249:	bf 01 00 00 00       	mov    $0x1,%edi
+  20224e:	b8 00 00 00 00       	mov    $0x0,%eax
+  202253:	e8 17 fb ff ff       	call   201d6f <app_printf>
+            break;
+  202258:	e9 d8 fe ff ff       	jmp    202135 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "File name too long");
+  20225d:	48 8d 15 83 03 00 00 	lea    0x383(%rip),%rdx        # 2025e7 <lower_digits.0+0xc7>
+  202264:	48 8d 35 ee 02 00 00 	lea    0x2ee(%rip),%rsi        # 202559 <lower_digits.0+0x39>
+  20226b:	bf 01 00 00 00       	mov    $0x1,%edi
+  202270:	b8 00 00 00 00       	mov    $0x0,%eax
+  202275:	e8 f5 fa ff ff       	call   201d6f <app_printf>
+            break;
+  20227a:	e9 b6 fe ff ff       	jmp    202135 <app_print_error+0x3c>
+            app_printf(1, "Error %d: %s\n", r, "Unknown error");
+  20227f:	48 8d 0d 74 03 00 00 	lea    0x374(%rip),%rcx        # 2025fa <lower_digits.0+0xda>
+  202286:	89 fa                	mov    %edi,%edx
+  202288:	48 8d 35 79 03 00 00 	lea    0x379(%rip),%rsi        # 202608 <lower_digits.0+0xe8>
+  20228f:	bf 01 00 00 00       	mov    $0x1,%edi
+  202294:	b8 00 00 00 00       	mov    $0x0,%eax
+  202299:	e8 d1 fa ff ff       	call   201d6f <app_printf>
+}
+  20229e:	e9 92 fe ff ff       	jmp    202135 <app_print_error+0x3c>
+
+00000000002022a3 <handle_error>:
+
+__attribute__((noreturn)) void handle_error(int r) {
+  2022a3:	55                   	push   %rbp
+  2022a4:	48 89 e5             	mov    %rsp,%rbp
+  2022a7:	53                   	push   %rbx
+  2022a8:	48 83 ec 08          	sub    $0x8,%rsp
+  2022ac:	89 fb                	mov    %edi,%ebx
+    app_print_error(r);
+  2022ae:	e8 46 fe ff ff       	call   2020f9 <app_print_error>
+    asm volatile ("syscall" : "=a" (rax)
+  2022b3:	b8 40 00 00 00       	mov    $0x40,%eax
+  2022b8:	89 df                	mov    %ebx,%edi
+  2022ba:	0f 05                	syscall
+ spinloop: goto spinloop;       // should never get here
+  2022bc:	eb fe                	jmp    2022bc <handle_error+0x19>
+
+00000000002022be <malloc>:
+
+// The heap starts 1MB above the program image (PROC_START_ADDR)
+static uint8_t* heap_top = (uint8_t*) 0x300000;
+static uint8_t* page_top = (uint8_t*) 0x300000;
+
+void* malloc(size_t size) {
+  2022be:	48 89 fe             	mov    %rdi,%rsi
+    while (ROUNDDOWN(heap_top + size, PAGESIZE) >= page_top) {
+  2022c1:	48 8b 05 40 0d 00 00 	mov    0xd40(%rip),%rax        # 203008 <heap_top>
+  2022c8:	48 8d 14 38          	lea    (%rax,%rdi,1),%rdx
+  2022cc:	48 8b 3d 2d 0d 00 00 	mov    0xd2d(%rip),%rdi        # 203000 <page_top>
+  2022d3:	48 89 d1             	mov    %rdx,%rcx
+  2022d6:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  2022dd:	48 39 f9             	cmp    %rdi,%rcx
+  2022e0:	72 3e                	jb     202320 <malloc+0x62>
+    asm volatile ("syscall" : "=a" (result)
+  2022e2:	41 b8 3b 00 00 00    	mov    $0x3b,%r8d
+  2022e8:	44 89 c0             	mov    %r8d,%eax
+  2022eb:	0f 05                	syscall
+        int r = sys_page_alloc(page_top);
+        assert(r >= 0);
+  2022ed:	85 c0                	test   %eax,%eax
+  2022ef:	78 37                	js     202328 <malloc+0x6a>
+        page_top += PAGESIZE;
+  2022f1:	48 8b 05 08 0d 00 00 	mov    0xd08(%rip),%rax        # 203000 <page_top>
+  2022f8:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  2022ff:	48 89 3d fa 0c 00 00 	mov    %rdi,0xcfa(%rip)        # 203000 <page_top>
+    while (ROUNDDOWN(heap_top + size, PAGESIZE) >= page_top) {
+  202306:	48 8b 05 fb 0c 00 00 	mov    0xcfb(%rip),%rax        # 203008 <heap_top>
+  20230d:	48 8d 14 30          	lea    (%rax,%rsi,1),%rdx
+  202311:	48 89 d1             	mov    %rdx,%rcx
+  202314:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  20231b:	48 39 f9             	cmp    %rdi,%rcx
+  20231e:	73 c8                	jae    2022e8 <malloc+0x2a>
+    }
+
+    void* addr = heap_top;
+    heap_top += size;
+  202320:	48 89 15 e1 0c 00 00 	mov    %rdx,0xce1(%rip)        # 203008 <heap_top>
+    return addr;
+}
+  202327:	c3                   	ret
+void* malloc(size_t size) {
+  202328:	55                   	push   %rbp
+  202329:	48 89 e5             	mov    %rsp,%rbp
+        assert(r >= 0);
+  20232c:	48 8d 15 ca 03 00 00 	lea    0x3ca(%rip),%rdx        # 2026fd <col.0+0x5>
+  202333:	be 0b 00 00 00       	mov    $0xb,%esi
+  202338:	48 8d 3d c5 03 00 00 	lea    0x3c5(%rip),%rdi        # 202704 <col.0+0xc>
+  20233f:	e8 b0 fb ff ff       	call   201ef4 <assert_fail>
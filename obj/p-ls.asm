@@ -0,0 +1,3357 @@
+
+obj/p-ls.full:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000200000 <process_main>:
+    app_printf(0, "%s", usage_str);
+    sys_exit(1);
+}*/
+
+
+void process_main(int argc, char* argv[]) {
+  200000:	55                   	push   %rbp
+  200001:	48 89 e5             	mov    %rsp,%rbp
+  200004:	41 57                	push   %r15
+  200006:	41 56                	push   %r14
+  200008:	41 55                	push   %r13
+  20000a:	41 54                	push   %r12
+  20000c:	53                   	push   %rbx
+  20000d:	48 81 ec 98 01 00 00 	sub    $0x198,%rsp
+
+    char *path;
+
+    if (argc == 1) {
+        path = ".";
+  200014:	48 8d 05 e5 20 00 00 	lea    0x20e5(%rip),%rax        # 202100 <malloc+0x93>
+  20001b:	48 89 85 40 fe ff ff 	mov    %rax,-0x1c0(%rbp)
+    if (argc == 1) {
+  200022:	83 ff 01             	cmp    $0x1,%edi
+  200025:	74 0b                	je     200032 <process_main+0x32>
+    } else {
+        path = argv[1];
+  200027:	48 8b 46 08          	mov    0x8(%rsi),%rax
+  20002b:	48 89 85 40 fe ff ff 	mov    %rax,-0x1c0(%rbp)
+//    of entries read (0 at the end of the directory), or a negative error
+//    (-EINVAL if `len` cannot hold one entry).
+//    The next call should pass `cookie` plus the number of entries read.
+static inline int sys_getdents(const char *path, dirent *ents, size_t len, unsigned cookie) {
+    int result;
+    register uint64_t r10 asm("r10") = cookie;
+  200032:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+    asm volatile ("syscall" : "=a" (result)
+  200038:	48 8d b5 50 fe ff ff 	lea    -0x1b0(%rbp),%rsi
+  20003f:	b8 49 00 00 00       	mov    $0x49,%eax
+  200044:	ba 80 01 00 00       	mov    $0x180,%edx
+  200049:	48 8b bd 40 fe ff ff 	mov    -0x1c0(%rbp),%rdi
+  200050:	0f 05                	syscall
+  200052:	89 85 4c fe ff ff    	mov    %eax,-0x1b4(%rbp)
+    }
+
+    dirent ents[8];
+    unsigned cookie = 0;
+  200058:	c7 85 48 fe ff ff 00 	movl   $0x0,-0x1b8(%rbp)
+  20005f:	00 00 00 
+            handle_error(-r);
+        if (r == 0)
+            break;
+
+        for (int i = 0; i < r; i++) {
+            app_printf(0, "%s%s\n", ents[i].d_name, ents[i].d_type == DT_DIR ? "/" : "");
+  200062:	4c 8d 3d 0c 23 00 00 	lea    0x230c(%rip),%r15        # 202375 <lower_digits.0+0xf5>
+  200069:	4c 8d 35 92 20 00 00 	lea    0x2092(%rip),%r14        # 202102 <malloc+0x95>
+  200070:	4c 8d 2d 8d 20 00 00 	lea    0x208d(%rip),%r13        # 202104 <malloc+0x97>
+        if (r < 0)
+  200077:	85 c0                	test   %eax,%eax
+  200079:	79 46                	jns    2000c1 <process_main+0xc1>
+            handle_error(-r);
+  20007b:	8b bd 4c fe ff ff    	mov    -0x1b4(%rbp),%edi
+  200081:	f7 df                	neg    %edi
+  200083:	e8 ca 1f 00 00       	call   202052 <handle_error>
+        }
+        cookie += r;
+  200088:	8b b5 4c fe ff ff    	mov    -0x1b4(%rbp),%esi
+  20008e:	01 b5 48 fe ff ff    	add    %esi,-0x1b8(%rbp)
+  200094:	8b 85 48 fe ff ff    	mov    -0x1b8(%rbp),%eax
+    register uint64_t r10 asm("r10") = cookie;
+  20009a:	41 89 c2             	mov    %eax,%r10d
+    asm volatile ("syscall" : "=a" (result)
+  20009d:	48 8d b5 50 fe ff ff 	lea    -0x1b0(%rbp),%rsi
+  2000a4:	ba 80 01 00 00       	mov    $0x180,%edx
+  2000a9:	b8 49 00 00 00       	mov    $0x49,%eax
+  2000ae:	48 8b bd 40 fe ff ff 	mov    -0x1c0(%rbp),%rdi
+  2000b5:	0f 05                	syscall
+  2000b7:	89 85 4c fe ff ff    	mov    %eax,-0x1b4(%rbp)
+        if (r < 0)
+  2000bd:	85 c0                	test   %eax,%eax
+  2000bf:	78 ba                	js     20007b <process_main+0x7b>
+        if (r == 0)
+  2000c1:	8b 85 4c fe ff ff    	mov    -0x1b4(%rbp),%eax
+  2000c7:	85 c0                	test   %eax,%eax
+  2000c9:	74 44                	je     20010f <process_main+0x10f>
+        for (int i = 0; i < r; i++) {
+  2000cb:	7e bb                	jle    200088 <process_main+0x88>
+  2000cd:	48 8d 9d 50 fe ff ff 	lea    -0x1b0(%rbp),%rbx
+  2000d4:	48 98                	cltq
+  2000d6:	4c 8d 24 40          	lea    (%rax,%rax,2),%r12
+  2000da:	49 c1 e4 04          	shl    $0x4,%r12
+  2000de:	49 01 dc             	add    %rbx,%r12
+            app_printf(0, "%s%s\n", ents[i].d_name, ents[i].d_type == DT_DIR ? "/" : "");
+  2000e1:	48 89 da             	mov    %rbx,%rdx
+  2000e4:	83 7b 24 01          	cmpl   $0x1,0x24(%rbx)
+  2000e8:	4c 89 f1             	mov    %r14,%rcx
+  2000eb:	49 0f 45 cf          	cmovne %r15,%rcx
+  2000ef:	4c 89 ee             	mov    %r13,%rsi
+  2000f2:	bf 00 00 00 00       	mov    $0x0,%edi
+  2000f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  2000fc:	e8 1d 1a 00 00       	call   201b1e <app_printf>
+        for (int i = 0; i < r; i++) {
+  200101:	48 83 c3 30          	add    $0x30,%rbx
+  200105:	4c 39 e3             	cmp    %r12,%rbx
+  200108:	75 d7                	jne    2000e1 <process_main+0xe1>
+  20010a:	e9 79 ff ff ff       	jmp    200088 <process_main+0x88>
+// sys_exit()
+//    Exit this process. Does not return.
+static inline void sys_exit(int exit_code) __attribute__((noreturn));
+static inline void sys_exit(int exit_code) {
+    uint64_t rax;
+    asm volatile ("syscall" : "=a" (rax)
+  20010f:	b8 40 00 00 00       	mov    $0x40,%eax
+  200114:	bf 00 00 00 00       	mov    $0x0,%edi
+  200119:	0f 05                	syscall
+                  : "a" (INT_SYS_EXIT), "D" /* %rdi */ (exit_code)
+                  : "rcx", "r11", "cc", "memory");
+ spinloop: goto spinloop;       // should never get here
+  20011b:	eb fe                	jmp    20011b <process_main+0x11b>
+
+000000000020011d <vdso>:
+// KERNEL DATA PAGE
+//
+//    The kernel keeps a read-only vdso_data (see lib.h) up to date at
+//    VDSO_ADDR. Reading it is a plain memory load, not a system call.
+
+static inline const volatile vdso_data* vdso(void) {
+  20011d:	55                   	push   %rbp
+  20011e:	48 89 e5             	mov    %rsp,%rbp
+    return (const volatile vdso_data*) VDSO_ADDR;
+  200121:	b8 00 10 24 00       	mov    $0x241000,%eax
+}
+  200126:	5d                   	pop    %rbp
+  200127:	c3                   	ret
+
+0000000000200128 <memcpy>:
+#define MEMOP_WORD_MIN 64
+
+// an unaligned word that may alias any object
+typedef uint64_t __attribute__((may_alias, aligned(1))) memop_word;
+
+void* memcpy(void* dst, const void* src, size_t n) {
+  200128:	55                   	push   %rbp
+  200129:	48 89 e5             	mov    %rsp,%rbp
+  20012c:	48 83 ec 48          	sub    $0x48,%rsp
+  200130:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  200134:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  200138:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+    char* d = (char*) dst;
+  20013c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200140:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    const char* s = (const char*) src;
+  200144:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  200148:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (n >= MEMOP_WORD_MIN) {
+  20014c:	48 83 7d b8 3f       	cmpq   $0x3f,-0x48(%rbp)
+  200151:	0f 86 c5 00 00 00    	jbe    20021c <memcpy+0xf4>
+        size_t head = -(uintptr_t) d & 7;
+  200157:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20015b:	48 f7 d8             	neg    %rax
+  20015e:	83 e0 07             	and    $0x7,%eax
+  200161:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        size_t words = (n - head) / 8;
+  200165:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  200169:	48 2b 45 e8          	sub    -0x18(%rbp),%rax
+  20016d:	48 c1 e8 03          	shr    $0x3,%rax
+  200171:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+        n = (n - head) % 8;
+  200175:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  200179:	48 2b 45 e8          	sub    -0x18(%rbp),%rax
+  20017d:	83 e0 07             	and    $0x7,%eax
+  200180:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        asm volatile("rep movsb" : "+D" (d), "+S" (s), "+c" (head)
+  200184:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  200188:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  20018c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  200190:	48 89 cf             	mov    %rcx,%rdi
+  200193:	48 89 d6             	mov    %rdx,%rsi
+  200196:	48 89 c1             	mov    %rax,%rcx
+  200199:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  20019b:	48 89 c8             	mov    %rcx,%rax
+  20019e:	48 89 f2             	mov    %rsi,%rdx
+  2001a1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  2001a5:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  2001a9:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                     : : "memory");
+        asm volatile("rep movsq" : "+D" (d), "+S" (s), "+c" (words)
+  2001ad:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  2001b1:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  2001b5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  2001b9:	48 89 cf             	mov    %rcx,%rdi
+  2001bc:	48 89 d6             	mov    %rdx,%rsi
+  2001bf:	48 89 c1             	mov    %rax,%rcx
+  2001c2:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  2001c5:	48 89 c8             	mov    %rcx,%rax
+  2001c8:	48 89 f2             	mov    %rsi,%rdx
+  2001cb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  2001cf:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  2001d3:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+                     : : "memory");
+    }
+    for (; n >= 16; n -= 16, s += 16, d += 16) {
+  2001d7:	eb 43                	jmp    20021c <memcpy+0xf4>
+        memop_word a = ((const memop_word*) s)[0];
+  2001d9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2001dd:	48 8b 00             	mov    (%rax),%rax
+  2001e0:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+        memop_word b = ((const memop_word*) s)[1];
+  2001e4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2001e8:	48 83 c0 08          	add    $0x8,%rax
+  2001ec:	48 8b 00             	mov    (%rax),%rax
+  2001ef:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+        ((memop_word*) d)[0] = a;
+  2001f3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2001f7:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  2001fb:	48 89 10             	mov    %rdx,(%rax)
+        ((memop_word*) d)[1] = b;
+  2001fe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200202:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  200206:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  20020a:	48 89 02             	mov    %rax,(%rdx)
+    for (; n >= 16; n -= 16, s += 16, d += 16) {
+  20020d:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  200212:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  200217:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  20021c:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  200221:	77 b6                	ja     2001d9 <memcpy+0xb1>
+    }
+    for (; n > 0; --n, ++s, ++d) {
+  200223:	eb 1c                	jmp    200241 <memcpy+0x119>
+        *d = *s;
+  200225:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  200229:	0f b6 10             	movzbl (%rax),%edx
+  20022c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200230:	88 10                	mov    %dl,(%rax)
+    for (; n > 0; --n, ++s, ++d) {
+  200232:	48 83 6d b8 01       	subq   $0x1,-0x48(%rbp)
+  200237:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  20023c:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  200241:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  200246:	75 dd                	jne    200225 <memcpy+0xfd>
+    }
+    return dst;
+  200248:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  20024c:	c9                   	leave
+  20024d:	c3                   	ret
+
+000000000020024e <memmove>:
+
+void* memmove(void* dst, const void* src, size_t n) {
+  20024e:	55                   	push   %rbp
+  20024f:	48 89 e5             	mov    %rsp,%rbp
+  200252:	48 83 ec 38          	sub    $0x38,%rsp
+  200256:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  20025a:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  20025e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    const char* s = (const char*) src;
+  200262:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  200266:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    char* d = (char*) dst;
+  20026a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  20026e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (!(s < d && s + n > d)) {
+  200272:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200276:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  20027a:	73 11                	jae    20028d <memmove+0x3f>
+  20027c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  200280:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200284:	48 01 d0             	add    %rdx,%rax
+  200287:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  20028b:	72 1c                	jb     2002a9 <memmove+0x5b>
+        // a forward copy never overwrites source bytes it has yet to read
+        return memcpy(dst, src, n);
+  20028d:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  200291:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  200295:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  200299:	48 89 ce             	mov    %rcx,%rsi
+  20029c:	48 89 c7             	mov    %rax,%rdi
+  20029f:	e8 84 fe ff ff       	call   200128 <memcpy>
+  2002a4:	e9 94 00 00 00       	jmp    20033d <memmove+0xef>
+    }
+
+    // copy backwards: the tail bytes, then words down to the start
+    size_t words = n / 8;
+  2002a9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  2002ad:	48 c1 e8 03          	shr    $0x3,%rax
+  2002b1:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    size_t tail = n % 8;
+  2002b5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  2002b9:	83 e0 07             	and    $0x7,%eax
+  2002bc:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    s += n - 1, d += n - 1;
+  2002c0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  2002c4:	48 83 e8 01          	sub    $0x1,%rax
+  2002c8:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  2002cc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  2002d0:	48 83 e8 01          	sub    $0x1,%rax
+  2002d4:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    asm volatile("std; rep movsb; cld" : "+D" (d), "+S" (s), "+c" (tail)
+  2002d8:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  2002dc:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  2002e0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  2002e4:	48 89 cf             	mov    %rcx,%rdi
+  2002e7:	48 89 d6             	mov    %rdx,%rsi
+  2002ea:	48 89 c1             	mov    %rax,%rcx
+  2002ed:	fd                   	std
+  2002ee:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  2002f0:	fc                   	cld
+  2002f1:	48 89 c8             	mov    %rcx,%rax
+  2002f4:	48 89 f2             	mov    %rsi,%rdx
+  2002f7:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  2002fb:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  2002ff:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+                 : : "memory", "cc");
+    s -= 7, d -= 7;
+  200303:	48 83 6d f8 07       	subq   $0x7,-0x8(%rbp)
+  200308:	48 83 6d f0 07       	subq   $0x7,-0x10(%rbp)
+    asm volatile("std; rep movsq; cld" : "+D" (d), "+S" (s), "+c" (words)
+  20030d:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  200311:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  200315:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  200319:	48 89 cf             	mov    %rcx,%rdi
+  20031c:	48 89 d6             	mov    %rdx,%rsi
+  20031f:	48 89 c1             	mov    %rax,%rcx
+  200322:	fd                   	std
+  200323:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  200326:	fc                   	cld
+  200327:	48 89 c8             	mov    %rcx,%rax
+  20032a:	48 89 f2             	mov    %rsi,%rdx
+  20032d:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  200331:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  200335:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 : : "memory", "cc");
+    return dst;
+  200339:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  20033d:	c9                   	leave
+  20033e:	c3                   	ret
+
+000000000020033f <memset>:
+
+void* memset(void* v, int c, size_t n) {
+  20033f:	55                   	push   %rbp
+  200340:	48 89 e5             	mov    %rsp,%rbp
+  200343:	48 83 ec 38          	sub    $0x38,%rsp
+  200347:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  20034b:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  20034e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    char* p = (char*) v;
+  200352:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  200356:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    uint64_t word = (uint8_t) c * 0x0101010101010101UL;
+  20035a:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  20035d:	0f b6 c0             	movzbl %al,%eax
+  200360:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  200367:	01 01 01 
+  20036a:	48 0f af c2          	imul   %rdx,%rax
+  20036e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (n >= MEMOP_WORD_MIN) {
+  200372:	48 83 7d c8 3f       	cmpq   $0x3f,-0x38(%rbp)
+  200377:	0f 86 9e 00 00 00    	jbe    20041b <memset+0xdc>
+        size_t head = -(uintptr_t) p & 7;
+  20037d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200381:	48 f7 d8             	neg    %rax
+  200384:	83 e0 07             	and    $0x7,%eax
+  200387:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        size_t words = (n - head) / 8;
+  20038b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  20038f:	48 2b 45 e8          	sub    -0x18(%rbp),%rax
+  200393:	48 c1 e8 03          	shr    $0x3,%rax
+  200397:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+        n = (n - head) % 8;
+  20039b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  20039f:	48 2b 45 e8          	sub    -0x18(%rbp),%rax
+  2003a3:	83 e0 07             	and    $0x7,%eax
+  2003a6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        asm volatile("rep stosb" : "+D" (p), "+c" (head) : "a" (word)
+  2003aa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2003ae:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  2003b2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  2003b6:	48 89 ce             	mov    %rcx,%rsi
+  2003b9:	48 89 f7             	mov    %rsi,%rdi
+  2003bc:	48 89 d1             	mov    %rdx,%rcx
+  2003bf:	f3 aa                	rep stos %al,%es:(%rdi)
+  2003c1:	48 89 ca             	mov    %rcx,%rdx
+  2003c4:	48 89 fe             	mov    %rdi,%rsi
+  2003c7:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  2003cb:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+                     : "memory");
+        asm volatile("rep stosq" : "+D" (p), "+c" (words) : "a" (word)
+  2003cf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2003d3:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  2003d7:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  2003db:	48 89 ce             	mov    %rcx,%rsi
+  2003de:	48 89 f7             	mov    %rsi,%rdi
+  2003e1:	48 89 d1             	mov    %rdx,%rcx
+  2003e4:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  2003e7:	48 89 ca             	mov    %rcx,%rdx
+  2003ea:	48 89 fe             	mov    %rdi,%rsi
+  2003ed:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  2003f1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+                     : "memory");
+    }
+    for (; n >= 16; n -= 16, p += 16) {
+  2003f5:	eb 24                	jmp    20041b <memset+0xdc>
+        ((memop_word*) p)[0] = word;
+  2003f7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2003fb:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  2003ff:	48 89 10             	mov    %rdx,(%rax)
+        ((memop_word*) p)[1] = word;
+  200402:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200406:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  20040a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  20040e:	48 89 02             	mov    %rax,(%rdx)
+    for (; n >= 16; n -= 16, p += 16) {
+  200411:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  200416:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  20041b:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  200420:	77 d5                	ja     2003f7 <memset+0xb8>
+    }
+    for (; n > 0; ++p, --n) {
+  200422:	eb 15                	jmp    200439 <memset+0xfa>
+        *p = c;
+  200424:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  200427:	89 c2                	mov    %eax,%edx
+  200429:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20042d:	88 10                	mov    %dl,(%rax)
+    for (; n > 0; ++p, --n) {
+  20042f:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  200434:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  200439:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  20043e:	75 e4                	jne    200424 <memset+0xe5>
+    }
+    return v;
+  200440:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  200444:	c9                   	leave
+  200445:	c3                   	ret
+
+0000000000200446 <strlen>:
+
+size_t strlen(const char* s) {
+  200446:	55                   	push   %rbp
+  200447:	48 89 e5             	mov    %rsp,%rbp
+  20044a:	48 83 ec 18          	sub    $0x18,%rsp
+  20044e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    size_t n;
+    for (n = 0; *s != '\0'; ++s) {
+  200452:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  200459:	00 
+  20045a:	eb 0a                	jmp    200466 <strlen+0x20>
+        ++n;
+  20045c:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    for (n = 0; *s != '\0'; ++s) {
+  200461:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  200466:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20046a:	0f b6 00             	movzbl (%rax),%eax
+  20046d:	84 c0                	test   %al,%al
+  20046f:	75 eb                	jne    20045c <strlen+0x16>
+    }
+    return n;
+  200471:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  200475:	c9                   	leave
+  200476:	c3                   	ret
+
+0000000000200477 <strnlen>:
+
+size_t strnlen(const char* s, size_t maxlen) {
+  200477:	55                   	push   %rbp
+  200478:	48 89 e5             	mov    %rsp,%rbp
+  20047b:	48 83 ec 20          	sub    $0x20,%rsp
+  20047f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  200483:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    size_t n;
+    for (n = 0; n != maxlen && *s != '\0'; ++s) {
+  200487:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  20048e:	00 
+  20048f:	eb 0a                	jmp    20049b <strnlen+0x24>
+        ++n;
+  200491:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    for (n = 0; n != maxlen && *s != '\0'; ++s) {
+  200496:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  20049b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20049f:	48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+  2004a3:	74 0b                	je     2004b0 <strnlen+0x39>
+  2004a5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2004a9:	0f b6 00             	movzbl (%rax),%eax
+  2004ac:	84 c0                	test   %al,%al
+  2004ae:	75 e1                	jne    200491 <strnlen+0x1a>
+    }
+    return n;
+  2004b0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  2004b4:	c9                   	leave
+  2004b5:	c3                   	ret
+
+00000000002004b6 <strcpy>:
+
+char* strcpy(char* dst, const char* src) {
+  2004b6:	55                   	push   %rbp
+  2004b7:	48 89 e5             	mov    %rsp,%rbp
+  2004ba:	48 83 ec 20          	sub    $0x20,%rsp
+  2004be:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  2004c2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    char* d = dst;
+  2004c6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2004ca:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    do {
+        *d++ = *src++;
+  2004ce:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  2004d2:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  2004d6:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  2004da:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2004de:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  2004e2:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+  2004e6:	0f b6 12             	movzbl (%rdx),%edx
+  2004e9:	88 10                	mov    %dl,(%rax)
+    } while (d[-1]);
+  2004eb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2004ef:	48 83 e8 01          	sub    $0x1,%rax
+  2004f3:	0f b6 00             	movzbl (%rax),%eax
+  2004f6:	84 c0                	test   %al,%al
+  2004f8:	75 d4                	jne    2004ce <strcpy+0x18>
+    return dst;
+  2004fa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  2004fe:	c9                   	leave
+  2004ff:	c3                   	ret
+
+0000000000200500 <strcmp>:
+
+int strcmp(const char* a, const char* b) {
+  200500:	55                   	push   %rbp
+  200501:	48 89 e5             	mov    %rsp,%rbp
+  200504:	48 83 ec 10          	sub    $0x10,%rsp
+  200508:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  20050c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    while (*a && *b && *a == *b) {
+  200510:	eb 0a                	jmp    20051c <strcmp+0x1c>
+        ++a, ++b;
+  200512:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  200517:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+    while (*a && *b && *a == *b) {
+  20051c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200520:	0f b6 00             	movzbl (%rax),%eax
+  200523:	84 c0                	test   %al,%al
+  200525:	74 1d                	je     200544 <strcmp+0x44>
+  200527:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  20052b:	0f b6 00             	movzbl (%rax),%eax
+  20052e:	84 c0                	test   %al,%al
+  200530:	74 12                	je     200544 <strcmp+0x44>
+  200532:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200536:	0f b6 10             	movzbl (%rax),%edx
+  200539:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  20053d:	0f b6 00             	movzbl (%rax),%eax
+  200540:	38 c2                	cmp    %al,%dl
+  200542:	74 ce                	je     200512 <strcmp+0x12>
+    }
+    return ((unsigned char) *a > (unsigned char) *b)
+  200544:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200548:	0f b6 00             	movzbl (%rax),%eax
+  20054b:	89 c2                	mov    %eax,%edx
+  20054d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  200551:	0f b6 00             	movzbl (%rax),%eax
+  200554:	38 d0                	cmp    %dl,%al
+  200556:	0f 92 c0             	setb   %al
+  200559:	0f b6 d0             	movzbl %al,%edx
+        - ((unsigned char) *a < (unsigned char) *b);
+  20055c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200560:	0f b6 00             	movzbl (%rax),%eax
+  200563:	89 c1                	mov    %eax,%ecx
+  200565:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  200569:	0f b6 00             	movzbl (%rax),%eax
+  20056c:	38 c1                	cmp    %al,%cl
+  20056e:	0f 92 c0             	setb   %al
+  200571:	0f b6 c0             	movzbl %al,%eax
+  200574:	29 c2                	sub    %eax,%edx
+  200576:	89 d0                	mov    %edx,%eax
+}
+  200578:	c9                   	leave
+  200579:	c3                   	ret
+
+000000000020057a <strchr>:
+
+char* strchr(const char* s, int c) {
+  20057a:	55                   	push   %rbp
+  20057b:	48 89 e5             	mov    %rsp,%rbp
+  20057e:	48 83 ec 10          	sub    $0x10,%rsp
+  200582:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  200586:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    while (*s && *s != (char) c) {
+  200589:	eb 05                	jmp    200590 <strchr+0x16>
+        ++s;
+  20058b:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    while (*s && *s != (char) c) {
+  200590:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200594:	0f b6 00             	movzbl (%rax),%eax
+  200597:	84 c0                	test   %al,%al
+  200599:	74 0e                	je     2005a9 <strchr+0x2f>
+  20059b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20059f:	0f b6 00             	movzbl (%rax),%eax
+  2005a2:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  2005a5:	38 d0                	cmp    %dl,%al
+  2005a7:	75 e2                	jne    20058b <strchr+0x11>
+    }
+    if (*s == (char) c) {
+  2005a9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2005ad:	0f b6 00             	movzbl (%rax),%eax
+  2005b0:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  2005b3:	38 d0                	cmp    %dl,%al
+  2005b5:	75 06                	jne    2005bd <strchr+0x43>
+        return (char*) s;
+  2005b7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2005bb:	eb 05                	jmp    2005c2 <strchr+0x48>
+    } else {
+        return NULL;
+  2005bd:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+}
+  2005c2:	c9                   	leave
+  2005c3:	c3                   	ret
+
+00000000002005c4 <rand>:
+
+// New randomness implementation
+static int      rand_seed_set;
+static unsigned rand_seed;
+
+int rand(void) {
+  2005c4:	55                   	push   %rbp
+  2005c5:	48 89 e5             	mov    %rsp,%rbp
+  2005c8:	48 83 ec 10          	sub    $0x10,%rsp
+    if (!rand_seed_set) {
+  2005cc:	8b 05 3e 2a 00 00    	mov    0x2a3e(%rip),%eax        # 203010 <rand_seed_set>
+  2005d2:	85 c0                	test   %eax,%eax
+  2005d4:	75 2c                	jne    200602 <rand+0x3e>
+#if WEENSYOS_KERNEL
+        extern unsigned get_entropy_value(void);
+        srand(get_entropy_value());
+#else           // user‑space build
+       /* kernel-refreshed seed from the kernel data page: no system call */
+       srand((unsigned) (vdso()->seed[0] ^ read_cycle_counter()));
+  2005d6:	e8 42 fb ff ff       	call   20011d <vdso>
+  2005db:	48 8b 40 18          	mov    0x18(%rax),%rax
+  2005df:	89 c1                	mov    %eax,%ecx
+    }
+}
+
+static inline uint64_t read_cycle_counter(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+  2005e1:	0f 31                	rdtsc
+  2005e3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  2005e6:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    return ((uint64_t) hi << 32) | lo;
+  2005e9:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  2005ec:	48 c1 e0 20          	shl    $0x20,%rax
+  2005f0:	48 89 c2             	mov    %rax,%rdx
+  2005f3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  2005f6:	48 09 d0             	or     %rdx,%rax
+  2005f9:	31 c8                	xor    %ecx,%eax
+  2005fb:	89 c7                	mov    %eax,%edi
+  2005fd:	e8 24 00 00 00       	call   200626 <srand>
+#endif
+    }
+    rand_seed = rand_seed * 1664525U + 1013904223U;   // LCG
+  200602:	8b 05 0c 2a 00 00    	mov    0x2a0c(%rip),%eax        # 203014 <rand_seed>
+  200608:	69 c0 0d 66 19 00    	imul   $0x19660d,%eax,%eax
+  20060e:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+  200613:	89 05 fb 29 00 00    	mov    %eax,0x29fb(%rip)        # 203014 <rand_seed>
+    return rand_seed & RAND_MAX;
+  200619:	8b 05 f5 29 00 00    	mov    0x29f5(%rip),%eax        # 203014 <rand_seed>
+  20061f:	25 ff ff ff 7f       	and    $0x7fffffff,%eax
+}
+  200624:	c9                   	leave
+  200625:	c3                   	ret
+
+0000000000200626 <srand>:
+
+void srand(unsigned seed) {
+  200626:	55                   	push   %rbp
+  200627:	48 89 e5             	mov    %rsp,%rbp
+  20062a:	48 83 ec 08          	sub    $0x8,%rsp
+  20062e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+    rand_seed      = seed;
+  200631:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  200634:	89 05 da 29 00 00    	mov    %eax,0x29da(%rip)        # 203014 <rand_seed>
+    rand_seed_set  = 1;
+  20063a:	c7 05 cc 29 00 00 01 	movl   $0x1,0x29cc(%rip)        # 203010 <rand_seed_set>
+  200641:	00 00 00 
+}
+  200644:	90                   	nop
+  200645:	c9                   	leave
+  200646:	c3                   	ret
+
+0000000000200647 <fill_numbuf>:
+//    Print a message onto the console, starting at the given cursor position.
+
+// snprintf, vsnprintf
+//    Format a string into a buffer.
+
+static char* fill_numbuf(char* numbuf_end, unsigned long val, int base) {
+  200647:	55                   	push   %rbp
+  200648:	48 89 e5             	mov    %rsp,%rbp
+  20064b:	48 83 ec 28          	sub    $0x28,%rsp
+  20064f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  200653:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  200657:	89 55 dc             	mov    %edx,-0x24(%rbp)
+    static const char upper_digits[] = "0123456789ABCDEF";
+    static const char lower_digits[] = "0123456789abcdef";
+
+    const char* digits = upper_digits;
+  20065a:	48 8d 05 ff 1b 00 00 	lea    0x1bff(%rip),%rax        # 202260 <upper_digits.1>
+  200661:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (base < 0) {
+  200665:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  200669:	79 0e                	jns    200679 <fill_numbuf+0x32>
+        digits = lower_digits;
+  20066b:	48 8d 05 0e 1c 00 00 	lea    0x1c0e(%rip),%rax        # 202280 <lower_digits.0>
+  200672:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+        base = -base;
+  200676:	f7 5d dc             	negl   -0x24(%rbp)
+    }
+
+    *--numbuf_end = '\0';
+  200679:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  20067e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  200682:	c6 00 00             	movb   $0x0,(%rax)
+    do {
+        *--numbuf_end = digits[val % base];
+  200685:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  200688:	48 63 c8             	movslq %eax,%rcx
+  20068b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  20068f:	ba 00 00 00 00       	mov    $0x0,%edx
+  200694:	48 f7 f1             	div    %rcx
+  200697:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20069b:	48 01 d0             	add    %rdx,%rax
+  20069e:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  2006a3:	0f b6 10             	movzbl (%rax),%edx
+  2006a6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2006aa:	88 10                	mov    %dl,(%rax)
+        val /= base;
+  2006ac:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  2006af:	48 63 f0             	movslq %eax,%rsi
+  2006b2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  2006b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  2006bb:	48 f7 f6             	div    %rsi
+  2006be:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    } while (val != 0);
+  2006c2:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  2006c7:	75 bc                	jne    200685 <fill_numbuf+0x3e>
+    return numbuf_end;
+  2006c9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  2006cd:	c9                   	leave
+  2006ce:	c3                   	ret
+
+00000000002006cf <printer_vprintf>:
+#define FLAG_NUMERIC            (1<<5)
+#define FLAG_SIGNED             (1<<6)
+#define FLAG_NEGATIVE           (1<<7)
+#define FLAG_ALT2               (1<<8)
+
+void printer_vprintf(printer* p, int color, const char* format, va_list val) {
+  2006cf:	55                   	push   %rbp
+  2006d0:	48 89 e5             	mov    %rsp,%rbp
+  2006d3:	53                   	push   %rbx
+  2006d4:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  2006db:	48 89 bd 78 ff ff ff 	mov    %rdi,-0x88(%rbp)
+  2006e2:	89 b5 74 ff ff ff    	mov    %esi,-0x8c(%rbp)
+  2006e8:	48 89 95 68 ff ff ff 	mov    %rdx,-0x98(%rbp)
+  2006ef:	48 89 8d 60 ff ff ff 	mov    %rcx,-0xa0(%rbp)
+#define NUMBUFSIZ 24
+    char numbuf[NUMBUFSIZ];
+
+    for (; *format; ++format) {
+  2006f6:	e9 be 09 00 00       	jmp    2010b9 <printer_vprintf+0x9ea>
+        if (*format != '%') {
+  2006fb:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200702:	0f b6 00             	movzbl (%rax),%eax
+  200705:	3c 25                	cmp    $0x25,%al
+  200707:	74 31                	je     20073a <printer_vprintf+0x6b>
+            p->putc(p, *format, color);
+  200709:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200710:	4c 8b 00             	mov    (%rax),%r8
+  200713:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  20071a:	0f b6 00             	movzbl (%rax),%eax
+  20071d:	0f b6 c8             	movzbl %al,%ecx
+  200720:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  200726:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  20072d:	89 ce                	mov    %ecx,%esi
+  20072f:	48 89 c7             	mov    %rax,%rdi
+  200732:	41 ff d0             	call   *%r8
+            continue;
+  200735:	e9 77 09 00 00       	jmp    2010b1 <printer_vprintf+0x9e2>
+        }
+
+        // process flags
+        int flags = 0;
+  20073a:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+        for (++format; *format; ++format) {
+  200741:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  200748:	01 
+  200749:	eb 4f                	jmp    20079a <printer_vprintf+0xcb>
+            const char* flagc = strchr(flag_chars, *format);
+  20074b:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200752:	0f b6 00             	movzbl (%rax),%eax
+  200755:	0f be c0             	movsbl %al,%eax
+  200758:	89 c6                	mov    %eax,%esi
+  20075a:	48 8d 05 af 19 00 00 	lea    0x19af(%rip),%rax        # 202110 <flag_chars>
+  200761:	48 89 c7             	mov    %rax,%rdi
+  200764:	e8 11 fe ff ff       	call   20057a <strchr>
+  200769:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (flagc) {
+  20076d:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  200772:	74 36                	je     2007aa <printer_vprintf+0xdb>
+                flags |= 1 << (flagc - flag_chars);
+  200774:	48 8d 05 95 19 00 00 	lea    0x1995(%rip),%rax        # 202110 <flag_chars>
+  20077b:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  20077f:	48 29 c2             	sub    %rax,%rdx
+  200782:	89 d0                	mov    %edx,%eax
+  200784:	ba 01 00 00 00       	mov    $0x1,%edx
+  200789:	89 c1                	mov    %eax,%ecx
+  20078b:	d3 e2                	shl    %cl,%edx
+  20078d:	89 d0                	mov    %edx,%eax
+  20078f:	09 45 ec             	or     %eax,-0x14(%rbp)
+        for (++format; *format; ++format) {
+  200792:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  200799:	01 
+  20079a:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  2007a1:	0f b6 00             	movzbl (%rax),%eax
+  2007a4:	84 c0                	test   %al,%al
+  2007a6:	75 a3                	jne    20074b <printer_vprintf+0x7c>
+  2007a8:	eb 01                	jmp    2007ab <printer_vprintf+0xdc>
+            } else {
+                break;
+  2007aa:	90                   	nop
+            }
+        }
+
+        // process width
+        int width = -1;
+  2007ab:	c7 45 e8 ff ff ff ff 	movl   $0xffffffff,-0x18(%rbp)
+        if (*format >= '1' && *format <= '9') {
+  2007b2:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  2007b9:	0f b6 00             	movzbl (%rax),%eax
+  2007bc:	3c 30                	cmp    $0x30,%al
+  2007be:	7e 67                	jle    200827 <printer_vprintf+0x158>
+  2007c0:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  2007c7:	0f b6 00             	movzbl (%rax),%eax
+  2007ca:	3c 39                	cmp    $0x39,%al
+  2007cc:	7f 59                	jg     200827 <printer_vprintf+0x158>
+            for (width = 0; *format >= '0' && *format <= '9'; ) {
+  2007ce:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%rbp)
+  2007d5:	eb 2e                	jmp    200805 <printer_vprintf+0x136>
+                width = 10 * width + *format++ - '0';
+  2007d7:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  2007da:	89 d0                	mov    %edx,%eax
+  2007dc:	c1 e0 02             	shl    $0x2,%eax
+  2007df:	01 d0                	add    %edx,%eax
+  2007e1:	01 c0                	add    %eax,%eax
+  2007e3:	89 c1                	mov    %eax,%ecx
+  2007e5:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  2007ec:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  2007f0:	48 89 95 68 ff ff ff 	mov    %rdx,-0x98(%rbp)
+  2007f7:	0f b6 00             	movzbl (%rax),%eax
+  2007fa:	0f be c0             	movsbl %al,%eax
+  2007fd:	01 c8                	add    %ecx,%eax
+  2007ff:	83 e8 30             	sub    $0x30,%eax
+  200802:	89 45 e8             	mov    %eax,-0x18(%rbp)
+            for (width = 0; *format >= '0' && *format <= '9'; ) {
+  200805:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  20080c:	0f b6 00             	movzbl (%rax),%eax
+  20080f:	3c 2f                	cmp    $0x2f,%al
+  200811:	0f 8e 85 00 00 00    	jle    20089c <printer_vprintf+0x1cd>
+  200817:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  20081e:	0f b6 00             	movzbl (%rax),%eax
+  200821:	3c 39                	cmp    $0x39,%al
+  200823:	7e b2                	jle    2007d7 <printer_vprintf+0x108>
+        if (*format >= '1' && *format <= '9') {
+  200825:	eb 75                	jmp    20089c <printer_vprintf+0x1cd>
+            }
+        } else if (*format == '*') {
+  200827:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  20082e:	0f b6 00             	movzbl (%rax),%eax
+  200831:	3c 2a                	cmp    $0x2a,%al
+  200833:	75 68                	jne    20089d <printer_vprintf+0x1ce>
+            width = va_arg(val, int);
+  200835:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  20083c:	8b 00                	mov    (%rax),%eax
+  20083e:	83 f8 2f             	cmp    $0x2f,%eax
+  200841:	77 30                	ja     200873 <printer_vprintf+0x1a4>
+  200843:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  20084a:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  20084e:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200855:	8b 00                	mov    (%rax),%eax
+  200857:	89 c0                	mov    %eax,%eax
+  200859:	48 01 d0             	add    %rdx,%rax
+  20085c:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200863:	8b 12                	mov    (%rdx),%edx
+  200865:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200868:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  20086f:	89 0a                	mov    %ecx,(%rdx)
+  200871:	eb 1a                	jmp    20088d <printer_vprintf+0x1be>
+  200873:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  20087a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  20087e:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200882:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200889:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  20088d:	8b 00                	mov    (%rax),%eax
+  20088f:	89 45 e8             	mov    %eax,-0x18(%rbp)
+            ++format;
+  200892:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  200899:	01 
+  20089a:	eb 01                	jmp    20089d <printer_vprintf+0x1ce>
+        if (*format >= '1' && *format <= '9') {
+  20089c:	90                   	nop
+        }
+
+        // process precision
+        int precision = -1;
+  20089d:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%rbp)
+        if (*format == '.') {
+  2008a4:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  2008ab:	0f b6 00             	movzbl (%rax),%eax
+  2008ae:	3c 2e                	cmp    $0x2e,%al
+  2008b0:	0f 85 00 01 00 00    	jne    2009b6 <printer_vprintf+0x2e7>
+            ++format;
+  2008b6:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  2008bd:	01 
+            if (*format >= '0' && *format <= '9') {
+  2008be:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  2008c5:	0f b6 00             	movzbl (%rax),%eax
+  2008c8:	3c 2f                	cmp    $0x2f,%al
+  2008ca:	7e 67                	jle    200933 <printer_vprintf+0x264>
+  2008cc:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  2008d3:	0f b6 00             	movzbl (%rax),%eax
+  2008d6:	3c 39                	cmp    $0x39,%al
+  2008d8:	7f 59                	jg     200933 <printer_vprintf+0x264>
+                for (precision = 0; *format >= '0' && *format <= '9'; ) {
+  2008da:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%rbp)
+  2008e1:	eb 2e                	jmp    200911 <printer_vprintf+0x242>
+                    precision = 10 * precision + *format++ - '0';
+  2008e3:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  2008e6:	89 d0                	mov    %edx,%eax
+  2008e8:	c1 e0 02             	shl    $0x2,%eax
+  2008eb:	01 d0                	add    %edx,%eax
+  2008ed:	01 c0                	add    %eax,%eax
+  2008ef:	89 c1                	mov    %eax,%ecx
+  2008f1:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  2008f8:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  2008fc:	48 89 95 68 ff ff ff 	mov    %rdx,-0x98(%rbp)
+  200903:	0f b6 00             	movzbl (%rax),%eax
+  200906:	0f be c0             	movsbl %al,%eax
+  200909:	01 c8                	add    %ecx,%eax
+  20090b:	83 e8 30             	sub    $0x30,%eax
+  20090e:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+                for (precision = 0; *format >= '0' && *format <= '9'; ) {
+  200911:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200918:	0f b6 00             	movzbl (%rax),%eax
+  20091b:	3c 2f                	cmp    $0x2f,%al
+  20091d:	0f 8e 85 00 00 00    	jle    2009a8 <printer_vprintf+0x2d9>
+  200923:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  20092a:	0f b6 00             	movzbl (%rax),%eax
+  20092d:	3c 39                	cmp    $0x39,%al
+  20092f:	7e b2                	jle    2008e3 <printer_vprintf+0x214>
+            if (*format >= '0' && *format <= '9') {
+  200931:	eb 75                	jmp    2009a8 <printer_vprintf+0x2d9>
+                }
+            } else if (*format == '*') {
+  200933:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  20093a:	0f b6 00             	movzbl (%rax),%eax
+  20093d:	3c 2a                	cmp    $0x2a,%al
+  20093f:	75 68                	jne    2009a9 <printer_vprintf+0x2da>
+                precision = va_arg(val, int);
+  200941:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200948:	8b 00                	mov    (%rax),%eax
+  20094a:	83 f8 2f             	cmp    $0x2f,%eax
+  20094d:	77 30                	ja     20097f <printer_vprintf+0x2b0>
+  20094f:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200956:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  20095a:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200961:	8b 00                	mov    (%rax),%eax
+  200963:	89 c0                	mov    %eax,%eax
+  200965:	48 01 d0             	add    %rdx,%rax
+  200968:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  20096f:	8b 12                	mov    (%rdx),%edx
+  200971:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200974:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  20097b:	89 0a                	mov    %ecx,(%rdx)
+  20097d:	eb 1a                	jmp    200999 <printer_vprintf+0x2ca>
+  20097f:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200986:	48 8b 40 08          	mov    0x8(%rax),%rax
+  20098a:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  20098e:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200995:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200999:	8b 00                	mov    (%rax),%eax
+  20099b:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+                ++format;
+  20099e:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  2009a5:	01 
+  2009a6:	eb 01                	jmp    2009a9 <printer_vprintf+0x2da>
+            if (*format >= '0' && *format <= '9') {
+  2009a8:	90                   	nop
+            }
+            if (precision < 0) {
+  2009a9:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  2009ad:	79 07                	jns    2009b6 <printer_vprintf+0x2e7>
+                precision = 0;
+  2009af:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%rbp)
+            }
+        }
+
+        // process main conversion character
+        int base = 10;
+  2009b6:	c7 45 e0 0a 00 00 00 	movl   $0xa,-0x20(%rbp)
+        unsigned long num = 0;
+  2009bd:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  2009c4:	00 
+        int length = 0;
+  2009c5:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+        char* data = "";
+  2009cc:	48 8d 05 43 17 00 00 	lea    0x1743(%rip),%rax        # 202116 <flag_chars+0x6>
+  2009d3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    again:
+        switch (*format) {
+  2009d7:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  2009de:	0f b6 00             	movzbl (%rax),%eax
+  2009e1:	0f be c0             	movsbl %al,%eax
+  2009e4:	83 e8 43             	sub    $0x43,%eax
+  2009e7:	83 f8 37             	cmp    $0x37,%eax
+  2009ea:	0f 87 b5 03 00 00    	ja     200da5 <printer_vprintf+0x6d6>
+  2009f0:	89 c0                	mov    %eax,%eax
+  2009f2:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  2009f9:	00 
+  2009fa:	48 8d 05 23 17 00 00 	lea    0x1723(%rip),%rax        # 202124 <flag_chars+0x14>
+  200a01:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+  200a04:	48 98                	cltq
+  200a06:	48 8d 15 17 17 00 00 	lea    0x1717(%rip),%rdx        # 202124 <flag_chars+0x14>
+  200a0d:	48 01 d0             	add    %rdx,%rax
+  200a10:	ff e0                	jmp    *%rax
+        case 'l':
+        case 'z':
+            length = 1;
+  200a12:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+            ++format;
+  200a19:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  200a20:	01 
+            goto again;
+  200a21:	eb b4                	jmp    2009d7 <printer_vprintf+0x308>
+        case 'd':
+        case 'i': {
+            long x = length ? va_arg(val, long) : va_arg(val, int);
+  200a23:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  200a27:	74 5d                	je     200a86 <printer_vprintf+0x3b7>
+  200a29:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200a30:	8b 00                	mov    (%rax),%eax
+  200a32:	83 f8 2f             	cmp    $0x2f,%eax
+  200a35:	77 30                	ja     200a67 <printer_vprintf+0x398>
+  200a37:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200a3e:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200a42:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200a49:	8b 00                	mov    (%rax),%eax
+  200a4b:	89 c0                	mov    %eax,%eax
+  200a4d:	48 01 d0             	add    %rdx,%rax
+  200a50:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200a57:	8b 12                	mov    (%rdx),%edx
+  200a59:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200a5c:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200a63:	89 0a                	mov    %ecx,(%rdx)
+  200a65:	eb 1a                	jmp    200a81 <printer_vprintf+0x3b2>
+  200a67:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200a6e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200a72:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200a76:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200a7d:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200a81:	48 8b 00             	mov    (%rax),%rax
+  200a84:	eb 5c                	jmp    200ae2 <printer_vprintf+0x413>
+  200a86:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200a8d:	8b 00                	mov    (%rax),%eax
+  200a8f:	83 f8 2f             	cmp    $0x2f,%eax
+  200a92:	77 30                	ja     200ac4 <printer_vprintf+0x3f5>
+  200a94:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200a9b:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200a9f:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200aa6:	8b 00                	mov    (%rax),%eax
+  200aa8:	89 c0                	mov    %eax,%eax
+  200aaa:	48 01 d0             	add    %rdx,%rax
+  200aad:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200ab4:	8b 12                	mov    (%rdx),%edx
+  200ab6:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200ab9:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200ac0:	89 0a                	mov    %ecx,(%rdx)
+  200ac2:	eb 1a                	jmp    200ade <printer_vprintf+0x40f>
+  200ac4:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200acb:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200acf:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200ad3:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200ada:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200ade:	8b 00                	mov    (%rax),%eax
+  200ae0:	48 98                	cltq
+  200ae2:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+            int negative = x < 0 ? FLAG_NEGATIVE : 0;
+  200ae6:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  200aea:	48 c1 f8 38          	sar    $0x38,%rax
+  200aee:	25 80 00 00 00       	and    $0x80,%eax
+  200af3:	89 45 a4             	mov    %eax,-0x5c(%rbp)
+            num = negative ? -x : x;
+  200af6:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  200afa:	74 09                	je     200b05 <printer_vprintf+0x436>
+  200afc:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  200b00:	48 f7 d8             	neg    %rax
+  200b03:	eb 04                	jmp    200b09 <printer_vprintf+0x43a>
+  200b05:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  200b09:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+            flags |= FLAG_NUMERIC | FLAG_SIGNED | negative;
+  200b0d:	8b 45 a4             	mov    -0x5c(%rbp),%eax
+  200b10:	83 c8 60             	or     $0x60,%eax
+  200b13:	09 45 ec             	or     %eax,-0x14(%rbp)
+            break;
+  200b16:	e9 cf 02 00 00       	jmp    200dea <printer_vprintf+0x71b>
+        }
+        case 'u':
+        format_unsigned:
+            num = length ? va_arg(val, unsigned long) : va_arg(val, unsigned);
+  200b1b:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  200b1f:	74 5d                	je     200b7e <printer_vprintf+0x4af>
+  200b21:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200b28:	8b 00                	mov    (%rax),%eax
+  200b2a:	83 f8 2f             	cmp    $0x2f,%eax
+  200b2d:	77 30                	ja     200b5f <printer_vprintf+0x490>
+  200b2f:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200b36:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200b3a:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200b41:	8b 00                	mov    (%rax),%eax
+  200b43:	89 c0                	mov    %eax,%eax
+  200b45:	48 01 d0             	add    %rdx,%rax
+  200b48:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200b4f:	8b 12                	mov    (%rdx),%edx
+  200b51:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200b54:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200b5b:	89 0a                	mov    %ecx,(%rdx)
+  200b5d:	eb 1a                	jmp    200b79 <printer_vprintf+0x4aa>
+  200b5f:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200b66:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200b6a:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200b6e:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200b75:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200b79:	48 8b 00             	mov    (%rax),%rax
+  200b7c:	eb 5c                	jmp    200bda <printer_vprintf+0x50b>
+  200b7e:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200b85:	8b 00                	mov    (%rax),%eax
+  200b87:	83 f8 2f             	cmp    $0x2f,%eax
+  200b8a:	77 30                	ja     200bbc <printer_vprintf+0x4ed>
+  200b8c:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200b93:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200b97:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200b9e:	8b 00                	mov    (%rax),%eax
+  200ba0:	89 c0                	mov    %eax,%eax
+  200ba2:	48 01 d0             	add    %rdx,%rax
+  200ba5:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200bac:	8b 12                	mov    (%rdx),%edx
+  200bae:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200bb1:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200bb8:	89 0a                	mov    %ecx,(%rdx)
+  200bba:	eb 1a                	jmp    200bd6 <printer_vprintf+0x507>
+  200bbc:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200bc3:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200bc7:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200bcb:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200bd2:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200bd6:	8b 00                	mov    (%rax),%eax
+  200bd8:	89 c0                	mov    %eax,%eax
+  200bda:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+            flags |= FLAG_NUMERIC;
+  200bde:	83 4d ec 20          	orl    $0x20,-0x14(%rbp)
+            break;
+  200be2:	e9 03 02 00 00       	jmp    200dea <printer_vprintf+0x71b>
+        case 'x':
+            base = -16;
+  200be7:	c7 45 e0 f0 ff ff ff 	movl   $0xfffffff0,-0x20(%rbp)
+            goto format_unsigned;
+  200bee:	e9 28 ff ff ff       	jmp    200b1b <printer_vprintf+0x44c>
+        case 'X':
+            base = 16;
+  200bf3:	c7 45 e0 10 00 00 00 	movl   $0x10,-0x20(%rbp)
+            goto format_unsigned;
+  200bfa:	e9 1c ff ff ff       	jmp    200b1b <printer_vprintf+0x44c>
+        case 'p':
+            num = (uintptr_t) va_arg(val, void*);
+  200bff:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c06:	8b 00                	mov    (%rax),%eax
+  200c08:	83 f8 2f             	cmp    $0x2f,%eax
+  200c0b:	77 30                	ja     200c3d <printer_vprintf+0x56e>
+  200c0d:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c14:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200c18:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c1f:	8b 00                	mov    (%rax),%eax
+  200c21:	89 c0                	mov    %eax,%eax
+  200c23:	48 01 d0             	add    %rdx,%rax
+  200c26:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200c2d:	8b 12                	mov    (%rdx),%edx
+  200c2f:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200c32:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200c39:	89 0a                	mov    %ecx,(%rdx)
+  200c3b:	eb 1a                	jmp    200c57 <printer_vprintf+0x588>
+  200c3d:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c44:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200c48:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200c4c:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200c53:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200c57:	48 8b 00             	mov    (%rax),%rax
+  200c5a:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+            base = -16;
+  200c5e:	c7 45 e0 f0 ff ff ff 	movl   $0xfffffff0,-0x20(%rbp)
+            flags |= FLAG_ALT | FLAG_ALT2 | FLAG_NUMERIC;
+  200c65:	81 4d ec 21 01 00 00 	orl    $0x121,-0x14(%rbp)
+            break;
+  200c6c:	e9 79 01 00 00       	jmp    200dea <printer_vprintf+0x71b>
+        case 's':
+            data = va_arg(val, char*);
+  200c71:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c78:	8b 00                	mov    (%rax),%eax
+  200c7a:	83 f8 2f             	cmp    $0x2f,%eax
+  200c7d:	77 30                	ja     200caf <printer_vprintf+0x5e0>
+  200c7f:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c86:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200c8a:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c91:	8b 00                	mov    (%rax),%eax
+  200c93:	89 c0                	mov    %eax,%eax
+  200c95:	48 01 d0             	add    %rdx,%rax
+  200c98:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200c9f:	8b 12                	mov    (%rdx),%edx
+  200ca1:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200ca4:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200cab:	89 0a                	mov    %ecx,(%rdx)
+  200cad:	eb 1a                	jmp    200cc9 <printer_vprintf+0x5fa>
+  200caf:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200cb6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200cba:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200cbe:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200cc5:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200cc9:	48 8b 00             	mov    (%rax),%rax
+  200ccc:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+            break;
+  200cd0:	e9 15 01 00 00       	jmp    200dea <printer_vprintf+0x71b>
+        case 'C':
+            color = va_arg(val, int);
+  200cd5:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200cdc:	8b 00                	mov    (%rax),%eax
+  200cde:	83 f8 2f             	cmp    $0x2f,%eax
+  200ce1:	77 30                	ja     200d13 <printer_vprintf+0x644>
+  200ce3:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200cea:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200cee:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200cf5:	8b 00                	mov    (%rax),%eax
+  200cf7:	89 c0                	mov    %eax,%eax
+  200cf9:	48 01 d0             	add    %rdx,%rax
+  200cfc:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200d03:	8b 12                	mov    (%rdx),%edx
+  200d05:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200d08:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200d0f:	89 0a                	mov    %ecx,(%rdx)
+  200d11:	eb 1a                	jmp    200d2d <printer_vprintf+0x65e>
+  200d13:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200d1a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200d1e:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200d22:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200d29:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200d2d:	8b 00                	mov    (%rax),%eax
+  200d2f:	89 85 74 ff ff ff    	mov    %eax,-0x8c(%rbp)
+            goto done;
+  200d35:	e9 77 03 00 00       	jmp    2010b1 <printer_vprintf+0x9e2>
+        case 'c':
+            data = numbuf;
+  200d3a:	48 8d 45 8c          	lea    -0x74(%rbp),%rax
+  200d3e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+            numbuf[0] = va_arg(val, int);
+  200d42:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200d49:	8b 00                	mov    (%rax),%eax
+  200d4b:	83 f8 2f             	cmp    $0x2f,%eax
+  200d4e:	77 30                	ja     200d80 <printer_vprintf+0x6b1>
+  200d50:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200d57:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200d5b:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200d62:	8b 00                	mov    (%rax),%eax
+  200d64:	89 c0                	mov    %eax,%eax
+  200d66:	48 01 d0             	add    %rdx,%rax
+  200d69:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200d70:	8b 12                	mov    (%rdx),%edx
+  200d72:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200d75:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200d7c:	89 0a                	mov    %ecx,(%rdx)
+  200d7e:	eb 1a                	jmp    200d9a <printer_vprintf+0x6cb>
+  200d80:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200d87:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200d8b:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200d8f:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200d96:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200d9a:	8b 00                	mov    (%rax),%eax
+  200d9c:	88 45 8c             	mov    %al,-0x74(%rbp)
+            numbuf[1] = '\0';
+  200d9f:	c6 45 8d 00          	movb   $0x0,-0x73(%rbp)
+            break;
+  200da3:	eb 45                	jmp    200dea <printer_vprintf+0x71b>
+        default:
+            data = numbuf;
+  200da5:	48 8d 45 8c          	lea    -0x74(%rbp),%rax
+  200da9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+            numbuf[0] = (*format ? *format : '%');
+  200dad:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200db4:	0f b6 00             	movzbl (%rax),%eax
+  200db7:	84 c0                	test   %al,%al
+  200db9:	74 0c                	je     200dc7 <printer_vprintf+0x6f8>
+  200dbb:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200dc2:	0f b6 00             	movzbl (%rax),%eax
+  200dc5:	eb 05                	jmp    200dcc <printer_vprintf+0x6fd>
+  200dc7:	b8 25 00 00 00       	mov    $0x25,%eax
+  200dcc:	88 45 8c             	mov    %al,-0x74(%rbp)
+            numbuf[1] = '\0';
+  200dcf:	c6 45 8d 00          	movb   $0x0,-0x73(%rbp)
+            if (!*format) {
+  200dd3:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200dda:	0f b6 00             	movzbl (%rax),%eax
+  200ddd:	84 c0                	test   %al,%al
+  200ddf:	75 08                	jne    200de9 <printer_vprintf+0x71a>
+                format--;
+  200de1:	48 83 ad 68 ff ff ff 	subq   $0x1,-0x98(%rbp)
+  200de8:	01 
+            }
+            break;
+  200de9:	90                   	nop
+        }
+
+        if (flags & FLAG_NUMERIC) {
+  200dea:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200ded:	83 e0 20             	and    $0x20,%eax
+  200df0:	85 c0                	test   %eax,%eax
+  200df2:	74 1e                	je     200e12 <printer_vprintf+0x743>
+            data = fill_numbuf(numbuf + NUMBUFSIZ, num, base);
+  200df4:	48 8d 45 8c          	lea    -0x74(%rbp),%rax
+  200df8:	48 83 c0 18          	add    $0x18,%rax
+  200dfc:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  200dff:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  200e03:	48 89 ce             	mov    %rcx,%rsi
+  200e06:	48 89 c7             	mov    %rax,%rdi
+  200e09:	e8 39 f8 ff ff       	call   200647 <fill_numbuf>
+  200e0e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        }
+
+        const char* prefix = "";
+  200e12:	48 8d 05 fd 12 00 00 	lea    0x12fd(%rip),%rax        # 202116 <flag_chars+0x6>
+  200e19:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((flags & FLAG_NUMERIC) && (flags & FLAG_SIGNED)) {
+  200e1d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200e20:	83 e0 20             	and    $0x20,%eax
+  200e23:	85 c0                	test   %eax,%eax
+  200e25:	74 51                	je     200e78 <printer_vprintf+0x7a9>
+  200e27:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200e2a:	83 e0 40             	and    $0x40,%eax
+  200e2d:	85 c0                	test   %eax,%eax
+  200e2f:	74 47                	je     200e78 <printer_vprintf+0x7a9>
+            if (flags & FLAG_NEGATIVE) {
+  200e31:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200e34:	25 80 00 00 00       	and    $0x80,%eax
+  200e39:	85 c0                	test   %eax,%eax
+  200e3b:	74 0d                	je     200e4a <printer_vprintf+0x77b>
+                prefix = "-";
+  200e3d:	48 8d 05 d3 12 00 00 	lea    0x12d3(%rip),%rax        # 202117 <flag_chars+0x7>
+  200e44:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            if (flags & FLAG_NEGATIVE) {
+  200e48:	eb 7d                	jmp    200ec7 <printer_vprintf+0x7f8>
+            } else if (flags & FLAG_PLUSPOSITIVE) {
+  200e4a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200e4d:	83 e0 10             	and    $0x10,%eax
+  200e50:	85 c0                	test   %eax,%eax
+  200e52:	74 0d                	je     200e61 <printer_vprintf+0x792>
+                prefix = "+";
+  200e54:	48 8d 05 be 12 00 00 	lea    0x12be(%rip),%rax        # 202119 <flag_chars+0x9>
+  200e5b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            if (flags & FLAG_NEGATIVE) {
+  200e5f:	eb 66                	jmp    200ec7 <printer_vprintf+0x7f8>
+            } else if (flags & FLAG_SPACEPOSITIVE) {
+  200e61:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200e64:	83 e0 08             	and    $0x8,%eax
+  200e67:	85 c0                	test   %eax,%eax
+  200e69:	74 5c                	je     200ec7 <printer_vprintf+0x7f8>
+                prefix = " ";
+  200e6b:	48 8d 05 a9 12 00 00 	lea    0x12a9(%rip),%rax        # 20211b <flag_chars+0xb>
+  200e72:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            if (flags & FLAG_NEGATIVE) {
+  200e76:	eb 4f                	jmp    200ec7 <printer_vprintf+0x7f8>
+            }
+        } else if ((flags & FLAG_NUMERIC) && (flags & FLAG_ALT)
+  200e78:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200e7b:	83 e0 20             	and    $0x20,%eax
+  200e7e:	85 c0                	test   %eax,%eax
+  200e80:	74 46                	je     200ec8 <printer_vprintf+0x7f9>
+  200e82:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200e85:	83 e0 01             	and    $0x1,%eax
+  200e88:	85 c0                	test   %eax,%eax
+  200e8a:	74 3c                	je     200ec8 <printer_vprintf+0x7f9>
+                   && (base == 16 || base == -16)
+  200e8c:	83 7d e0 10          	cmpl   $0x10,-0x20(%rbp)
+  200e90:	74 06                	je     200e98 <printer_vprintf+0x7c9>
+  200e92:	83 7d e0 f0          	cmpl   $0xfffffff0,-0x20(%rbp)
+  200e96:	75 30                	jne    200ec8 <printer_vprintf+0x7f9>
+                   && (num || (flags & FLAG_ALT2))) {
+  200e98:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  200e9d:	75 0c                	jne    200eab <printer_vprintf+0x7dc>
+  200e9f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200ea2:	25 00 01 00 00       	and    $0x100,%eax
+  200ea7:	85 c0                	test   %eax,%eax
+  200ea9:	74 1d                	je     200ec8 <printer_vprintf+0x7f9>
+            prefix = (base == -16 ? "0x" : "0X");
+  200eab:	83 7d e0 f0          	cmpl   $0xfffffff0,-0x20(%rbp)
+  200eaf:	75 09                	jne    200eba <printer_vprintf+0x7eb>
+  200eb1:	48 8d 05 65 12 00 00 	lea    0x1265(%rip),%rax        # 20211d <flag_chars+0xd>
+  200eb8:	eb 07                	jmp    200ec1 <printer_vprintf+0x7f2>
+  200eba:	48 8d 05 5f 12 00 00 	lea    0x125f(%rip),%rax        # 202120 <flag_chars+0x10>
+  200ec1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  200ec5:	eb 01                	jmp    200ec8 <printer_vprintf+0x7f9>
+            if (flags & FLAG_NEGATIVE) {
+  200ec7:	90                   	nop
+        }
+
+        int len;
+        if (precision >= 0 && !(flags & FLAG_NUMERIC)) {
+  200ec8:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  200ecc:	78 24                	js     200ef2 <printer_vprintf+0x823>
+  200ece:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200ed1:	83 e0 20             	and    $0x20,%eax
+  200ed4:	85 c0                	test   %eax,%eax
+  200ed6:	75 1a                	jne    200ef2 <printer_vprintf+0x823>
+            len = strnlen(data, precision);
+  200ed8:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  200edb:	48 63 d0             	movslq %eax,%rdx
+  200ede:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200ee2:	48 89 d6             	mov    %rdx,%rsi
+  200ee5:	48 89 c7             	mov    %rax,%rdi
+  200ee8:	e8 8a f5 ff ff       	call   200477 <strnlen>
+  200eed:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  200ef0:	eb 0f                	jmp    200f01 <printer_vprintf+0x832>
+        } else {
+            len = strlen(data);
+  200ef2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200ef6:	48 89 c7             	mov    %rax,%rdi
+  200ef9:	e8 48 f5 ff ff       	call   200446 <strlen>
+  200efe:	89 45 bc             	mov    %eax,-0x44(%rbp)
+        }
+        int zeros;
+        if ((flags & FLAG_NUMERIC) && precision >= 0) {
+  200f01:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200f04:	83 e0 20             	and    $0x20,%eax
+  200f07:	85 c0                	test   %eax,%eax
+  200f09:	74 20                	je     200f2b <printer_vprintf+0x85c>
+  200f0b:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  200f0f:	78 1a                	js     200f2b <printer_vprintf+0x85c>
+            zeros = precision > len ? precision - len : 0;
+  200f11:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  200f14:	3b 45 bc             	cmp    -0x44(%rbp),%eax
+  200f17:	7e 08                	jle    200f21 <printer_vprintf+0x852>
+  200f19:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  200f1c:	2b 45 bc             	sub    -0x44(%rbp),%eax
+  200f1f:	eb 05                	jmp    200f26 <printer_vprintf+0x857>
+  200f21:	b8 00 00 00 00       	mov    $0x0,%eax
+  200f26:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  200f29:	eb 5c                	jmp    200f87 <printer_vprintf+0x8b8>
+        } else if ((flags & FLAG_NUMERIC) && (flags & FLAG_ZERO)
+  200f2b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200f2e:	83 e0 20             	and    $0x20,%eax
+  200f31:	85 c0                	test   %eax,%eax
+  200f33:	74 4b                	je     200f80 <printer_vprintf+0x8b1>
+  200f35:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200f38:	83 e0 02             	and    $0x2,%eax
+  200f3b:	85 c0                	test   %eax,%eax
+  200f3d:	74 41                	je     200f80 <printer_vprintf+0x8b1>
+                   && !(flags & FLAG_LEFTJUSTIFY)
+  200f3f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200f42:	83 e0 04             	and    $0x4,%eax
+  200f45:	85 c0                	test   %eax,%eax
+  200f47:	75 37                	jne    200f80 <printer_vprintf+0x8b1>
+                   && len + (int) strlen(prefix) < width) {
+  200f49:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  200f4d:	48 89 c7             	mov    %rax,%rdi
+  200f50:	e8 f1 f4 ff ff       	call   200446 <strlen>
+  200f55:	89 c2                	mov    %eax,%edx
+  200f57:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  200f5a:	01 d0                	add    %edx,%eax
+  200f5c:	39 45 e8             	cmp    %eax,-0x18(%rbp)
+  200f5f:	7e 1f                	jle    200f80 <printer_vprintf+0x8b1>
+            zeros = width - len - strlen(prefix);
+  200f61:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  200f64:	2b 45 bc             	sub    -0x44(%rbp),%eax
+  200f67:	89 c3                	mov    %eax,%ebx
+  200f69:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  200f6d:	48 89 c7             	mov    %rax,%rdi
+  200f70:	e8 d1 f4 ff ff       	call   200446 <strlen>
+  200f75:	89 c2                	mov    %eax,%edx
+  200f77:	89 d8                	mov    %ebx,%eax
+  200f79:	29 d0                	sub    %edx,%eax
+  200f7b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  200f7e:	eb 07                	jmp    200f87 <printer_vprintf+0x8b8>
+        } else {
+            zeros = 0;
+  200f80:	c7 45 b8 00 00 00 00 	movl   $0x0,-0x48(%rbp)
+        }
+        width -= len + zeros + strlen(prefix);
+  200f87:	8b 55 bc             	mov    -0x44(%rbp),%edx
+  200f8a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  200f8d:	01 d0                	add    %edx,%eax
+  200f8f:	48 63 d8             	movslq %eax,%rbx
+  200f92:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  200f96:	48 89 c7             	mov    %rax,%rdi
+  200f99:	e8 a8 f4 ff ff       	call   200446 <strlen>
+  200f9e:	48 8d 14 03          	lea    (%rbx,%rax,1),%rdx
+  200fa2:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  200fa5:	29 d0                	sub    %edx,%eax
+  200fa7:	89 45 e8             	mov    %eax,-0x18(%rbp)
+        for (; !(flags & FLAG_LEFTJUSTIFY) && width > 0; --width) {
+  200faa:	eb 25                	jmp    200fd1 <printer_vprintf+0x902>
+            p->putc(p, ' ', color);
+  200fac:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200fb3:	48 8b 08             	mov    (%rax),%rcx
+  200fb6:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  200fbc:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200fc3:	be 20 00 00 00       	mov    $0x20,%esi
+  200fc8:	48 89 c7             	mov    %rax,%rdi
+  200fcb:	ff d1                	call   *%rcx
+        for (; !(flags & FLAG_LEFTJUSTIFY) && width > 0; --width) {
+  200fcd:	83 6d e8 01          	subl   $0x1,-0x18(%rbp)
+  200fd1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200fd4:	83 e0 04             	and    $0x4,%eax
+  200fd7:	85 c0                	test   %eax,%eax
+  200fd9:	75 36                	jne    201011 <printer_vprintf+0x942>
+  200fdb:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  200fdf:	7f cb                	jg     200fac <printer_vprintf+0x8dd>
+        }
+        for (; *prefix; ++prefix) {
+  200fe1:	eb 2e                	jmp    201011 <printer_vprintf+0x942>
+            p->putc(p, *prefix, color);
+  200fe3:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200fea:	4c 8b 00             	mov    (%rax),%r8
+  200fed:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  200ff1:	0f b6 00             	movzbl (%rax),%eax
+  200ff4:	0f b6 c8             	movzbl %al,%ecx
+  200ff7:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  200ffd:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  201004:	89 ce                	mov    %ecx,%esi
+  201006:	48 89 c7             	mov    %rax,%rdi
+  201009:	41 ff d0             	call   *%r8
+        for (; *prefix; ++prefix) {
+  20100c:	48 83 45 c0 01       	addq   $0x1,-0x40(%rbp)
+  201011:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  201015:	0f b6 00             	movzbl (%rax),%eax
+  201018:	84 c0                	test   %al,%al
+  20101a:	75 c7                	jne    200fe3 <printer_vprintf+0x914>
+        }
+        for (; zeros > 0; --zeros) {
+  20101c:	eb 25                	jmp    201043 <printer_vprintf+0x974>
+            p->putc(p, '0', color);
+  20101e:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  201025:	48 8b 08             	mov    (%rax),%rcx
+  201028:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  20102e:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  201035:	be 30 00 00 00       	mov    $0x30,%esi
+  20103a:	48 89 c7             	mov    %rax,%rdi
+  20103d:	ff d1                	call   *%rcx
+        for (; zeros > 0; --zeros) {
+  20103f:	83 6d b8 01          	subl   $0x1,-0x48(%rbp)
+  201043:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  201047:	7f d5                	jg     20101e <printer_vprintf+0x94f>
+        }
+        for (; len > 0; ++data, --len) {
+  201049:	eb 32                	jmp    20107d <printer_vprintf+0x9ae>
+            p->putc(p, *data, color);
+  20104b:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  201052:	4c 8b 00             	mov    (%rax),%r8
+  201055:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  201059:	0f b6 00             	movzbl (%rax),%eax
+  20105c:	0f b6 c8             	movzbl %al,%ecx
+  20105f:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  201065:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  20106c:	89 ce                	mov    %ecx,%esi
+  20106e:	48 89 c7             	mov    %rax,%rdi
+  201071:	41 ff d0             	call   *%r8
+        for (; len > 0; ++data, --len) {
+  201074:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  201079:	83 6d bc 01          	subl   $0x1,-0x44(%rbp)
+  20107d:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+  201081:	7f c8                	jg     20104b <printer_vprintf+0x97c>
+        }
+        for (; width > 0; --width) {
+  201083:	eb 25                	jmp    2010aa <printer_vprintf+0x9db>
+            p->putc(p, ' ', color);
+  201085:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  20108c:	48 8b 08             	mov    (%rax),%rcx
+  20108f:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  201095:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  20109c:	be 20 00 00 00       	mov    $0x20,%esi
+  2010a1:	48 89 c7             	mov    %rax,%rdi
+  2010a4:	ff d1                	call   *%rcx
+        for (; width > 0; --width) {
+  2010a6:	83 6d e8 01          	subl   $0x1,-0x18(%rbp)
+  2010aa:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  2010ae:	7f d5                	jg     201085 <printer_vprintf+0x9b6>
+        }
+    done: ;
+  2010b0:	90                   	nop
+    for (; *format; ++format) {
+  2010b1:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  2010b8:	01 
+  2010b9:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  2010c0:	0f b6 00             	movzbl (%rax),%eax
+  2010c3:	84 c0                	test   %al,%al
+  2010c5:	0f 85 30 f6 ff ff    	jne    2006fb <printer_vprintf+0x2c>
+    }
+}
+  2010cb:	90                   	nop
+  2010cc:	90                   	nop
+  2010cd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  2010d1:	c9                   	leave
+  2010d2:	c3                   	ret
+
+00000000002010d3 <console_putc>:
+typedef struct console_printer {
+    printer p;
+    uint16_t* cursor;
+} console_printer;
+
+static void console_putc(printer* p, unsigned char c, int color) {
+  2010d3:	55                   	push   %rbp
+  2010d4:	48 89 e5             	mov    %rsp,%rbp
+  2010d7:	48 83 ec 30          	sub    $0x30,%rsp
+  2010db:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  2010df:	89 f0                	mov    %esi,%eax
+  2010e1:	89 55 d0             	mov    %edx,-0x30(%rbp)
+  2010e4:	88 45 d4             	mov    %al,-0x2c(%rbp)
+    console_printer* cp = (console_printer*) p;
+  2010e7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  2010eb:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    /*if (cp->cursor >= console + CONSOLE_ROWS * CONSOLE_COLUMNS) {
+        cp->cursor = console;
+    }*/
+    if (c == '\n') {
+  2010ef:	80 7d d4 0a          	cmpb   $0xa,-0x2c(%rbp)
+  2010f3:	75 7f                	jne    201174 <console_putc+0xa1>
+        int pos = (cp->cursor - console) % CONSOLE_COLUMNS;
+  2010f5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2010f9:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  2010fd:	48 8d 05 fc 6e eb ff 	lea    -0x149104(%rip),%rax        # b8000 <console>
+  201104:	48 29 c2             	sub    %rax,%rdx
+  201107:	48 89 d0             	mov    %rdx,%rax
+  20110a:	48 d1 f8             	sar    %rax
+  20110d:	48 89 c1             	mov    %rax,%rcx
+  201110:	48 ba 67 66 66 66 66 	movabs $0x6666666666666667,%rdx
+  201117:	66 66 66 
+  20111a:	48 89 c8             	mov    %rcx,%rax
+  20111d:	48 f7 ea             	imul   %rdx
+  201120:	48 c1 fa 05          	sar    $0x5,%rdx
+  201124:	48 89 c8             	mov    %rcx,%rax
+  201127:	48 c1 f8 3f          	sar    $0x3f,%rax
+  20112b:	48 29 c2             	sub    %rax,%rdx
+  20112e:	48 89 d0             	mov    %rdx,%rax
+  201131:	48 c1 e0 02          	shl    $0x2,%rax
+  201135:	48 01 d0             	add    %rdx,%rax
+  201138:	48 c1 e0 04          	shl    $0x4,%rax
+  20113c:	48 29 c1             	sub    %rax,%rcx
+  20113f:	48 89 ca             	mov    %rcx,%rdx
+  201142:	89 55 fc             	mov    %edx,-0x4(%rbp)
+        for (; pos != CONSOLE_COLUMNS; pos++) {
+  201145:	eb 25                	jmp    20116c <console_putc+0x99>
+            *cp->cursor++ = ' ' | color;
+  201147:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  20114a:	83 c8 20             	or     $0x20,%eax
+  20114d:	89 c6                	mov    %eax,%esi
+  20114f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201153:	48 8b 40 08          	mov    0x8(%rax),%rax
+  201157:	48 8d 48 02          	lea    0x2(%rax),%rcx
+  20115b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  20115f:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  201163:	89 f2                	mov    %esi,%edx
+  201165:	66 89 10             	mov    %dx,(%rax)
+        for (; pos != CONSOLE_COLUMNS; pos++) {
+  201168:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  20116c:	83 7d fc 50          	cmpl   $0x50,-0x4(%rbp)
+  201170:	75 d5                	jne    201147 <console_putc+0x74>
+  201172:	eb 69                	jmp    2011dd <console_putc+0x10a>
+        }
+    } else if (c == '\b') {
+  201174:	80 7d d4 08          	cmpb   $0x8,-0x2c(%rbp)
+  201178:	75 3f                	jne    2011b9 <console_putc+0xe6>
+        if (cp->cursor != console) {
+  20117a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20117e:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  201182:	48 8d 05 77 6e eb ff 	lea    -0x149189(%rip),%rax        # b8000 <console>
+  201189:	48 39 c2             	cmp    %rax,%rdx
+  20118c:	74 4f                	je     2011dd <console_putc+0x10a>
+            *(--cp->cursor) = ' ' | color;
+  20118e:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  201191:	83 c8 20             	or     $0x20,%eax
+  201194:	89 c1                	mov    %eax,%ecx
+  201196:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20119a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  20119e:	48 8d 50 fe          	lea    -0x2(%rax),%rdx
+  2011a2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2011a6:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  2011aa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2011ae:	48 8b 40 08          	mov    0x8(%rax),%rax
+  2011b2:	89 ca                	mov    %ecx,%edx
+  2011b4:	66 89 10             	mov    %dx,(%rax)
+  2011b7:	eb 24                	jmp    2011dd <console_putc+0x10a>
+        }
+    } else {
+        *cp->cursor++ = c | color;
+  2011b9:	0f b6 45 d4          	movzbl -0x2c(%rbp),%eax
+  2011bd:	8b 55 d0             	mov    -0x30(%rbp),%edx
+  2011c0:	09 d0                	or     %edx,%eax
+  2011c2:	89 c6                	mov    %eax,%esi
+  2011c4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2011c8:	48 8b 40 08          	mov    0x8(%rax),%rax
+  2011cc:	48 8d 48 02          	lea    0x2(%rax),%rcx
+  2011d0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  2011d4:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  2011d8:	89 f2                	mov    %esi,%edx
+  2011da:	66 89 10             	mov    %dx,(%rax)
+    }
+
+    const int MAX_ROWS = CONSOLE_ROWS - 2;
+  2011dd:	c7 45 e4 17 00 00 00 	movl   $0x17,-0x1c(%rbp)
+
+    if (cp->cursor == console + MAX_ROWS * CONSOLE_COLUMNS) {
+  2011e4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2011e8:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  2011ec:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  2011ef:	89 d0                	mov    %edx,%eax
+  2011f1:	c1 e0 02             	shl    $0x2,%eax
+  2011f4:	01 d0                	add    %edx,%eax
+  2011f6:	c1 e0 04             	shl    $0x4,%eax
+  2011f9:	48 98                	cltq
+  2011fb:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  2011ff:	48 8d 05 fa 6d eb ff 	lea    -0x149206(%rip),%rax        # b8000 <console>
+  201206:	48 01 d0             	add    %rdx,%rax
+  201209:	48 39 c1             	cmp    %rax,%rcx
+  20120c:	0f 85 ac 00 00 00    	jne    2012be <console_putc+0x1eb>
+        // Move all characters up by one row, forgetting the first row
+        for (int i = 0; i < (MAX_ROWS - 1) * CONSOLE_COLUMNS; ++i) {
+  201212:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  201219:	eb 30                	jmp    20124b <console_putc+0x178>
+            console[i] = console[i + CONSOLE_COLUMNS];
+  20121b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  20121e:	83 c0 50             	add    $0x50,%eax
+  201221:	48 98                	cltq
+  201223:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  201227:	48 8d 05 d2 6d eb ff 	lea    -0x14922e(%rip),%rax        # b8000 <console>
+  20122e:	0f b7 04 02          	movzwl (%rdx,%rax,1),%eax
+  201232:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  201235:	48 63 d2             	movslq %edx,%rdx
+  201238:	48 8d 0c 12          	lea    (%rdx,%rdx,1),%rcx
+  20123c:	48 8d 15 bd 6d eb ff 	lea    -0x149243(%rip),%rdx        # b8000 <console>
+  201243:	66 89 04 11          	mov    %ax,(%rcx,%rdx,1)
+        for (int i = 0; i < (MAX_ROWS - 1) * CONSOLE_COLUMNS; ++i) {
+  201247:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+  20124b:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  20124e:	8d 50 ff             	lea    -0x1(%rax),%edx
+  201251:	89 d0                	mov    %edx,%eax
+  201253:	c1 e0 02             	shl    $0x2,%eax
+  201256:	01 d0                	add    %edx,%eax
+  201258:	c1 e0 04             	shl    $0x4,%eax
+  20125b:	39 45 f8             	cmp    %eax,-0x8(%rbp)
+  20125e:	7c bb                	jl     20121b <console_putc+0x148>
+        }
+
+        // Fill last column with space
+        for (int i = (MAX_ROWS - 1) * CONSOLE_COLUMNS; i < MAX_ROWS * CONSOLE_COLUMNS; ++i) {
+  201260:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  201263:	8d 50 ff             	lea    -0x1(%rax),%edx
+  201266:	89 d0                	mov    %edx,%eax
+  201268:	c1 e0 02             	shl    $0x2,%eax
+  20126b:	01 d0                	add    %edx,%eax
+  20126d:	c1 e0 04             	shl    $0x4,%eax
+  201270:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  201273:	eb 20                	jmp    201295 <console_putc+0x1c2>
+            console[i] = ' ' | color;
+  201275:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  201278:	83 c8 20             	or     $0x20,%eax
+  20127b:	89 c1                	mov    %eax,%ecx
+  20127d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  201280:	48 98                	cltq
+  201282:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  201286:	48 8d 05 73 6d eb ff 	lea    -0x14928d(%rip),%rax        # b8000 <console>
+  20128d:	66 89 0c 02          	mov    %cx,(%rdx,%rax,1)
+        for (int i = (MAX_ROWS - 1) * CONSOLE_COLUMNS; i < MAX_ROWS * CONSOLE_COLUMNS; ++i) {
+  201291:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  201295:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  201298:	89 d0                	mov    %edx,%eax
+  20129a:	c1 e0 02             	shl    $0x2,%eax
+  20129d:	01 d0                	add    %edx,%eax
+  20129f:	c1 e0 04             	shl    $0x4,%eax
+  2012a2:	39 45 f4             	cmp    %eax,-0xc(%rbp)
+  2012a5:	7c ce                	jl     201275 <console_putc+0x1a2>
+        }
+
+        cp->cursor -= CONSOLE_COLUMNS;
+  2012a7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2012ab:	48 8b 40 08          	mov    0x8(%rax),%rax
+  2012af:	48 8d 90 60 ff ff ff 	lea    -0xa0(%rax),%rdx
+  2012b6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2012ba:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    }
+}
+  2012be:	90                   	nop
+  2012bf:	c9                   	leave
+  2012c0:	c3                   	ret
+
+00000000002012c1 <console_vprintf>:
+
+int console_vprintf(int cpos, int color, const char* format, va_list val) {
+  2012c1:	55                   	push   %rbp
+  2012c2:	48 89 e5             	mov    %rsp,%rbp
+  2012c5:	48 83 ec 30          	sub    $0x30,%rsp
+  2012c9:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  2012cc:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  2012cf:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  2012d3:	48 89 4d d8          	mov    %rcx,-0x28(%rbp)
+    struct console_printer cp;
+    cp.p.putc = console_putc;
+  2012d7:	48 8d 05 f5 fd ff ff 	lea    -0x20b(%rip),%rax        # 2010d3 <console_putc>
+  2012de:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (cpos < 0 || cpos >= CONSOLE_ROWS * CONSOLE_COLUMNS) {
+  2012e2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  2012e6:	78 09                	js     2012f1 <console_vprintf+0x30>
+  2012e8:	81 7d ec cf 07 00 00 	cmpl   $0x7cf,-0x14(%rbp)
+  2012ef:	7e 07                	jle    2012f8 <console_vprintf+0x37>
+        cpos = 0;
+  2012f1:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+    }
+    cp.cursor = console + cpos;
+  2012f8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  2012fb:	48 98                	cltq
+  2012fd:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  201301:	48 8d 05 f8 6c eb ff 	lea    -0x149308(%rip),%rax        # b8000 <console>
+  201308:	48 01 d0             	add    %rdx,%rax
+  20130b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    printer_vprintf(&cp.p, color, format, val);
+  20130f:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  201313:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  201317:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  20131a:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  20131e:	48 89 c7             	mov    %rax,%rdi
+  201321:	e8 a9 f3 ff ff       	call   2006cf <printer_vprintf>
+    return cp.cursor - console;
+  201326:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  20132a:	48 8d 05 cf 6c eb ff 	lea    -0x149331(%rip),%rax        # b8000 <console>
+  201331:	48 29 c2             	sub    %rax,%rdx
+  201334:	48 89 d0             	mov    %rdx,%rax
+  201337:	48 d1 f8             	sar    %rax
+}
+  20133a:	c9                   	leave
+  20133b:	c3                   	ret
+
+000000000020133c <console_printf>:
+
+int console_printf(int cpos, int color, const char* format, ...) {
+  20133c:	55                   	push   %rbp
+  20133d:	48 89 e5             	mov    %rsp,%rbp
+  201340:	48 83 ec 60          	sub    $0x60,%rsp
+  201344:	89 7d ac             	mov    %edi,-0x54(%rbp)
+  201347:	89 75 a8             	mov    %esi,-0x58(%rbp)
+  20134a:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+  20134e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  201352:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  201356:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list val;
+    va_start(val, format);
+  20135a:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  201361:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  201365:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  201369:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  20136d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    cpos = console_vprintf(cpos, color, format, val);
+  201371:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  201375:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  201379:	8b 75 a8             	mov    -0x58(%rbp),%esi
+  20137c:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  20137f:	89 c7                	mov    %eax,%edi
+  201381:	e8 3b ff ff ff       	call   2012c1 <console_vprintf>
+  201386:	89 45 ac             	mov    %eax,-0x54(%rbp)
+    va_end(val);
+    return cpos;
+  201389:	8b 45 ac             	mov    -0x54(%rbp),%eax
+}
+  20138c:	c9                   	leave
+  20138d:	c3                   	ret
+
+000000000020138e <string_putc>:
+    printer p;
+    char* s;
+    char* end;
+} string_printer;
+
+static void string_putc(printer* p, unsigned char c, int color) {
+  20138e:	55                   	push   %rbp
+  20138f:	48 89 e5             	mov    %rsp,%rbp
+  201392:	48 83 ec 20          	sub    $0x20,%rsp
+  201396:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  20139a:	89 f0                	mov    %esi,%eax
+  20139c:	89 55 e0             	mov    %edx,-0x20(%rbp)
+  20139f:	88 45 e4             	mov    %al,-0x1c(%rbp)
+    string_printer* sp = (string_printer*) p;
+  2013a2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2013a6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (sp->s < sp->end) {
+  2013aa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2013ae:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  2013b2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2013b6:	48 8b 40 10          	mov    0x10(%rax),%rax
+  2013ba:	48 39 c2             	cmp    %rax,%rdx
+  2013bd:	73 1a                	jae    2013d9 <string_putc+0x4b>
+        *sp->s++ = c;
+  2013bf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2013c3:	48 8b 40 08          	mov    0x8(%rax),%rax
+  2013c7:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  2013cb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  2013cf:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  2013d3:	0f b6 55 e4          	movzbl -0x1c(%rbp),%edx
+  2013d7:	88 10                	mov    %dl,(%rax)
+    }
+    (void) color;
+}
+  2013d9:	90                   	nop
+  2013da:	c9                   	leave
+  2013db:	c3                   	ret
+
+00000000002013dc <vsnprintf>:
+
+int vsnprintf(char* s, size_t size, const char* format, va_list val) {
+  2013dc:	55                   	push   %rbp
+  2013dd:	48 89 e5             	mov    %rsp,%rbp
+  2013e0:	48 83 ec 40          	sub    $0x40,%rsp
+  2013e4:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  2013e8:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  2013ec:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  2013f0:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+    string_printer sp;
+    sp.p.putc = string_putc;
+  2013f4:	48 8d 05 93 ff ff ff 	lea    -0x6d(%rip),%rax        # 20138e <string_putc>
+  2013fb:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    sp.s = s;
+  2013ff:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  201403:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (size) {
+  201407:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  20140c:	74 33                	je     201441 <vsnprintf+0x65>
+        sp.end = s + size - 1;
+  20140e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  201412:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  201416:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  20141a:	48 01 d0             	add    %rdx,%rax
+  20141d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+        printer_vprintf(&sp.p, 0, format, val);
+  201421:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  201425:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  201429:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  20142d:	be 00 00 00 00       	mov    $0x0,%esi
+  201432:	48 89 c7             	mov    %rax,%rdi
+  201435:	e8 95 f2 ff ff       	call   2006cf <printer_vprintf>
+        *sp.s = 0;
+  20143a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  20143e:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return sp.s - s;
+  201441:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  201445:	48 2b 45 d8          	sub    -0x28(%rbp),%rax
+}
+  201449:	c9                   	leave
+  20144a:	c3                   	ret
+
+000000000020144b <snprintf>:
+
+int snprintf(char* s, size_t size, const char* format, ...) {
+  20144b:	55                   	push   %rbp
+  20144c:	48 89 e5             	mov    %rsp,%rbp
+  20144f:	48 83 ec 70          	sub    $0x70,%rsp
+  201453:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  201457:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  20145b:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  20145f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  201463:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  201467:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list val;
+    va_start(val, format);
+  20146b:	c7 45 b0 18 00 00 00 	movl   $0x18,-0x50(%rbp)
+  201472:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  201476:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  20147a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  20147e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    int n = vsnprintf(s, size, format, val);
+  201482:	48 8d 4d b0          	lea    -0x50(%rbp),%rcx
+  201486:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  20148a:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  20148e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  201492:	48 89 c7             	mov    %rax,%rdi
+  201495:	e8 42 ff ff ff       	call   2013dc <vsnprintf>
+  20149a:	89 45 cc             	mov    %eax,-0x34(%rbp)
+    va_end(val);
+    return n;
+  20149d:	8b 45 cc             	mov    -0x34(%rbp),%eax
+}
+  2014a0:	c9                   	leave
+  2014a1:	c3                   	ret
+
+00000000002014a2 <console_clear>:
+
+
+// console_clear
+//    Erases the console and moves the cursor to the upper left (CPOS(0, 0)).
+
+void console_clear(void) {
+  2014a2:	55                   	push   %rbp
+  2014a3:	48 89 e5             	mov    %rsp,%rbp
+  2014a6:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < CONSOLE_ROWS * CONSOLE_COLUMNS; ++i) {
+  2014aa:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  2014b1:	eb 1a                	jmp    2014cd <console_clear+0x2b>
+        console[i] = ' ' | 0x0700;
+  2014b3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  2014b6:	48 98                	cltq
+  2014b8:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  2014bc:	48 8d 05 3d 6b eb ff 	lea    -0x1494c3(%rip),%rax        # b8000 <console>
+  2014c3:	66 c7 04 02 20 07    	movw   $0x720,(%rdx,%rax,1)
+    for (int i = 0; i < CONSOLE_ROWS * CONSOLE_COLUMNS; ++i) {
+  2014c9:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  2014cd:	81 7d fc cf 07 00 00 	cmpl   $0x7cf,-0x4(%rbp)
+  2014d4:	7e dd                	jle    2014b3 <console_clear+0x11>
+    }
+    cursorpos = 0;
+  2014d6:	c7 05 1c 7b eb ff 00 	movl   $0x0,-0x1484e4(%rip)        # b8ffc <cursorpos>
+  2014dd:	00 00 00 
+}
+  2014e0:	90                   	nop
+  2014e1:	c9                   	leave
+  2014e2:	c3                   	ret
+
+00000000002014e3 <string_to_char>:
+
+
+int string_to_char(const char *str, int *dest) {
+  2014e3:	55                   	push   %rbp
+  2014e4:	48 89 e5             	mov    %rsp,%rbp
+  2014e7:	48 83 ec 20          	sub    $0x20,%rsp
+  2014eb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  2014ef:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    if (*str == '\0') return -1;
+  2014f3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2014f7:	0f b6 00             	movzbl (%rax),%eax
+  2014fa:	84 c0                	test   %al,%al
+  2014fc:	75 0a                	jne    201508 <string_to_char+0x25>
+  2014fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  201503:	e9 e0 00 00 00       	jmp    2015e8 <string_to_char+0x105>
+
+    *dest = 0;
+  201508:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  20150c:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    for (; *str; str++) {
+  201512:	e9 bd 00 00 00       	jmp    2015d4 <string_to_char+0xf1>
+        int digit = 0;
+  201517:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+        switch (*str)
+  20151e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201522:	0f b6 00             	movzbl (%rax),%eax
+  201525:	0f be c0             	movsbl %al,%eax
+  201528:	83 e8 30             	sub    $0x30,%eax
+  20152b:	83 f8 09             	cmp    $0x9,%eax
+  20152e:	77 7c                	ja     2015ac <string_to_char+0xc9>
+  201530:	89 c0                	mov    %eax,%eax
+  201532:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  201539:	00 
+  20153a:	48 8d 05 c3 0c 00 00 	lea    0xcc3(%rip),%rax        # 202204 <flag_chars+0xf4>
+  201541:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+  201544:	48 98                	cltq
+  201546:	48 8d 15 b7 0c 00 00 	lea    0xcb7(%rip),%rdx        # 202204 <flag_chars+0xf4>
+  20154d:	48 01 d0             	add    %rdx,%rax
+  201550:	ff e0                	jmp    *%rax
+        {
+        case '0':
+            digit = 0;
+  201552:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+            break;
+  201559:	eb 58                	jmp    2015b3 <string_to_char+0xd0>
+        case '1':
+            digit = 1;
+  20155b:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+            break;
+  201562:	eb 4f                	jmp    2015b3 <string_to_char+0xd0>
+        case '2':
+            digit = 2;
+  201564:	c7 45 fc 02 00 00 00 	movl   $0x2,-0x4(%rbp)
+            break;
+  20156b:	eb 46                	jmp    2015b3 <string_to_char+0xd0>
+        case '3':
+            digit = 3;
+  20156d:	c7 45 fc 03 00 00 00 	movl   $0x3,-0x4(%rbp)
+            break;
+  201574:	eb 3d                	jmp    2015b3 <string_to_char+0xd0>
+        case '4':
+            digit = 4;
+  201576:	c7 45 fc 04 00 00 00 	movl   $0x4,-0x4(%rbp)
+            break;
+  20157d:	eb 34                	jmp    2015b3 <string_to_char+0xd0>
+        case '5':
+            digit = 5;
+  20157f:	c7 45 fc 05 00 00 00 	movl   $0x5,-0x4(%rbp)
+            break;
+  201586:	eb 2b                	jmp    2015b3 <string_to_char+0xd0>
+        case '6':
+            digit = 6;
+  201588:	c7 45 fc 06 00 00 00 	movl   $0x6,-0x4(%rbp)
+            break;
+  20158f:	eb 22                	jmp    2015b3 <string_to_char+0xd0>
+        case '7':
+            digit = 7;
+  201591:	c7 45 fc 07 00 00 00 	movl   $0x7,-0x4(%rbp)
+            break;
+  201598:	eb 19                	jmp    2015b3 <string_to_char+0xd0>
+        case '8':
+            digit = 8;
+  20159a:	c7 45 fc 08 00 00 00 	movl   $0x8,-0x4(%rbp)
+            break;
+  2015a1:	eb 10                	jmp    2015b3 <string_to_char+0xd0>
+        case '9':
+            digit = 9;
+  2015a3:	c7 45 fc 09 00 00 00 	movl   $0x9,-0x4(%rbp)
+            break;
+  2015aa:	eb 07                	jmp    2015b3 <string_to_char+0xd0>
+        default:
+            return -1;
+  2015ac:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  2015b1:	eb 35                	jmp    2015e8 <string_to_char+0x105>
+        }
+
+        *dest = *dest * 10 + digit;
+  2015b3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  2015b7:	8b 10                	mov    (%rax),%edx
+  2015b9:	89 d0                	mov    %edx,%eax
+  2015bb:	c1 e0 02             	shl    $0x2,%eax
+  2015be:	01 d0                	add    %edx,%eax
+  2015c0:	01 c0                	add    %eax,%eax
+  2015c2:	89 c2                	mov    %eax,%edx
+  2015c4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  2015c7:	01 c2                	add    %eax,%edx
+  2015c9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  2015cd:	89 10                	mov    %edx,(%rax)
+    for (; *str; str++) {
+  2015cf:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  2015d4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2015d8:	0f b6 00             	movzbl (%rax),%eax
+  2015db:	84 c0                	test   %al,%al
+  2015dd:	0f 85 34 ff ff ff    	jne    201517 <string_to_char+0x34>
+    }
+
+    return 0;
+  2015e3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  2015e8:	c9                   	leave
+  2015e9:	c3                   	ret
+
+00000000002015ea <atoi>:
+
+int atoi(const char *str) {
+  2015ea:	55                   	push   %rbp
+  2015eb:	48 89 e5             	mov    %rsp,%rbp
+  2015ee:	48 83 ec 18          	sub    $0x18,%rsp
+  2015f2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    if (*str == '\0') return -1;
+  2015f6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2015fa:	0f b6 00             	movzbl (%rax),%eax
+  2015fd:	84 c0                	test   %al,%al
+  2015ff:	75 0a                	jne    20160b <atoi+0x21>
+  201601:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  201606:	e9 d7 00 00 00       	jmp    2016e2 <atoi+0xf8>
+
+    int n = 0;
+  20160b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    for (; *str; str++) {
+  201612:	e9 b7 00 00 00       	jmp    2016ce <atoi+0xe4>
+        int digit = 0;
+  201617:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+        switch (*str)
+  20161e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201622:	0f b6 00             	movzbl (%rax),%eax
+  201625:	0f be c0             	movsbl %al,%eax
+  201628:	83 e8 30             	sub    $0x30,%eax
+  20162b:	83 f8 09             	cmp    $0x9,%eax
+  20162e:	77 7c                	ja     2016ac <atoi+0xc2>
+  201630:	89 c0                	mov    %eax,%eax
+  201632:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  201639:	00 
+  20163a:	48 8d 05 eb 0b 00 00 	lea    0xbeb(%rip),%rax        # 20222c <flag_chars+0x11c>
+  201641:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+  201644:	48 98                	cltq
+  201646:	48 8d 15 df 0b 00 00 	lea    0xbdf(%rip),%rdx        # 20222c <flag_chars+0x11c>
+  20164d:	48 01 d0             	add    %rdx,%rax
+  201650:	ff e0                	jmp    *%rax
+        {
+        case '0':
+            digit = 0;
+  201652:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+            break;
+  201659:	eb 58                	jmp    2016b3 <atoi+0xc9>
+        case '1':
+            digit = 1;
+  20165b:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+            break;
+  201662:	eb 4f                	jmp    2016b3 <atoi+0xc9>
+        case '2':
+            digit = 2;
+  201664:	c7 45 f8 02 00 00 00 	movl   $0x2,-0x8(%rbp)
+            break;
+  20166b:	eb 46                	jmp    2016b3 <atoi+0xc9>
+        case '3':
+            digit = 3;
+  20166d:	c7 45 f8 03 00 00 00 	movl   $0x3,-0x8(%rbp)
+            break;
+  201674:	eb 3d                	jmp    2016b3 <atoi+0xc9>
+        case '4':
+            digit = 4;
+  201676:	c7 45 f8 04 00 00 00 	movl   $0x4,-0x8(%rbp)
+            break;
+  20167d:	eb 34                	jmp    2016b3 <atoi+0xc9>
+        case '5':
+            digit = 5;
+  20167f:	c7 45 f8 05 00 00 00 	movl   $0x5,-0x8(%rbp)
+            break;
+  201686:	eb 2b                	jmp    2016b3 <atoi+0xc9>
+        case '6':
+            digit = 6;
+  201688:	c7 45 f8 06 00 00 00 	movl   $0x6,-0x8(%rbp)
+            break;
+  20168f:	eb 22                	jmp    2016b3 <atoi+0xc9>
+        case '7':
+            digit = 7;
+  201691:	c7 45 f8 07 00 00 00 	movl   $0x7,-0x8(%rbp)
+            break;
+  201698:	eb 19                	jmp    2016b3 <atoi+0xc9>
+        case '8':
+            digit = 8;
+  20169a:	c7 45 f8 08 00 00 00 	movl   $0x8,-0x8(%rbp)
+            break;
+  2016a1:	eb 10                	jmp    2016b3 <atoi+0xc9>
+        case '9':
+            digit = 9;
+  2016a3:	c7 45 f8 09 00 00 00 	movl   $0x9,-0x8(%rbp)
+            break;
+  2016aa:	eb 07                	jmp    2016b3 <atoi+0xc9>
+        default:
+            return -1;
+  2016ac:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  2016b1:	eb 2f                	jmp    2016e2 <atoi+0xf8>
+        }
+
+        n = n * 10 + digit;
+  2016b3:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  2016b6:	89 d0                	mov    %edx,%eax
+  2016b8:	c1 e0 02             	shl    $0x2,%eax
+  2016bb:	01 d0                	add    %edx,%eax
+  2016bd:	01 c0                	add    %eax,%eax
+  2016bf:	89 c2                	mov    %eax,%edx
+  2016c1:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  2016c4:	01 d0                	add    %edx,%eax
+  2016c6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    for (; *str; str++) {
+  2016c9:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  2016ce:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2016d2:	0f b6 00             	movzbl (%rax),%eax
+  2016d5:	84 c0                	test   %al,%al
+  2016d7:	0f 85 3a ff ff ff    	jne    201617 <atoi+0x2d>
+    }
+
+    return 0;
+  2016dd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  2016e2:	c9                   	leave
+  2016e3:	c3                   	ret
+
+00000000002016e4 <copy_comp>:
+        components[ncomp++] = (comp); \
+    } \
+} while (0)
+
+// Helper to copy a component to dst
+void copy_comp(const char *start, const char *end, char **pdst) {
+  2016e4:	55                   	push   %rbp
+  2016e5:	48 89 e5             	mov    %rsp,%rbp
+  2016e8:	48 83 ec 18          	sub    $0x18,%rsp
+  2016ec:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  2016f0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  2016f4:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    while (start < end) {
+  2016f8:	eb 23                	jmp    20171d <copy_comp+0x39>
+        *(*pdst)++ = *start++;
+  2016fa:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  2016fe:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  201702:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  201706:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20170a:	48 8b 00             	mov    (%rax),%rax
+  20170d:	48 8d 70 01          	lea    0x1(%rax),%rsi
+  201711:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  201715:	48 89 31             	mov    %rsi,(%rcx)
+  201718:	0f b6 12             	movzbl (%rdx),%edx
+  20171b:	88 10                	mov    %dl,(%rax)
+    while (start < end) {
+  20171d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  201721:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  201725:	72 d3                	jb     2016fa <copy_comp+0x16>
+    }
+}
+  201727:	90                   	nop
+  201728:	90                   	nop
+  201729:	c9                   	leave
+  20172a:	c3                   	ret
+
+000000000020172b <join_path>:
+
+
+void join_path(const char *abs_path, const char *path, char *dst) {
+  20172b:	55                   	push   %rbp
+  20172c:	48 89 e5             	mov    %rsp,%rbp
+  20172f:	48 81 ec 68 02 00 00 	sub    $0x268,%rsp
+  201736:	48 89 bd a8 fd ff ff 	mov    %rdi,-0x258(%rbp)
+  20173d:	48 89 b5 a0 fd ff ff 	mov    %rsi,-0x260(%rbp)
+  201744:	48 89 95 98 fd ff ff 	mov    %rdx,-0x268(%rbp)
+    // If path is absolute, just copy it to dst (removing duplicate slashes, and trailing slash unless root)
+    if (path[0] == '/') {
+  20174b:	48 8b 85 a0 fd ff ff 	mov    -0x260(%rbp),%rax
+  201752:	0f b6 00             	movzbl (%rax),%eax
+  201755:	3c 2f                	cmp    $0x2f,%al
+  201757:	0f 85 d6 00 00 00    	jne    201833 <join_path+0x108>
+        const char *src = path;
+  20175d:	48 8b 85 a0 fd ff ff 	mov    -0x260(%rbp),%rax
+  201764:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+        char *d = dst;
+  201768:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  20176f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+        // Always start with a single slash
+        *d++ = '/';
+  201773:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  201777:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  20177b:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  20177f:	c6 00 2f             	movb   $0x2f,(%rax)
+        src++;
+  201782:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+        int last_was_slash = 1;
+  201787:	c7 45 b0 01 00 00 00 	movl   $0x1,-0x50(%rbp)
+        while (*src) {
+  20178e:	eb 64                	jmp    2017f4 <join_path+0xc9>
+            if (*src == '/') {
+  201790:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  201794:	0f b6 00             	movzbl (%rax),%eax
+  201797:	3c 2f                	cmp    $0x2f,%al
+  201799:	75 35                	jne    2017d0 <join_path+0xa5>
+                // Skip consecutive slashes
+                while (*src == '/') src++;
+  20179b:	eb 05                	jmp    2017a2 <join_path+0x77>
+  20179d:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  2017a2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2017a6:	0f b6 00             	movzbl (%rax),%eax
+  2017a9:	3c 2f                	cmp    $0x2f,%al
+  2017ab:	74 f0                	je     20179d <join_path+0x72>
+                if (*src == 0) break;
+  2017ad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2017b1:	0f b6 00             	movzbl (%rax),%eax
+  2017b4:	84 c0                	test   %al,%al
+  2017b6:	74 49                	je     201801 <join_path+0xd6>
+                *d++ = '/';
+  2017b8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2017bc:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  2017c0:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  2017c4:	c6 00 2f             	movb   $0x2f,(%rax)
+                last_was_slash = 1;
+  2017c7:	c7 45 b0 01 00 00 00 	movl   $0x1,-0x50(%rbp)
+  2017ce:	eb 24                	jmp    2017f4 <join_path+0xc9>
+            } else {
+                *d++ = *src++;
+  2017d0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  2017d4:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  2017d8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  2017dc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2017e0:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  2017e4:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  2017e8:	0f b6 12             	movzbl (%rdx),%edx
+  2017eb:	88 10                	mov    %dl,(%rax)
+                last_was_slash = 0;
+  2017ed:	c7 45 b0 00 00 00 00 	movl   $0x0,-0x50(%rbp)
+        while (*src) {
+  2017f4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2017f8:	0f b6 00             	movzbl (%rax),%eax
+  2017fb:	84 c0                	test   %al,%al
+  2017fd:	75 91                	jne    201790 <join_path+0x65>
+  2017ff:	eb 01                	jmp    201802 <join_path+0xd7>
+                if (*src == 0) break;
+  201801:	90                   	nop
+            }
+        }
+        // Remove trailing slash unless the path is just "/"
+        if (d > dst + 1 && *(d-1) == '/') {
+  201802:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  201809:	48 83 c0 01          	add    $0x1,%rax
+  20180d:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  201811:	73 14                	jae    201827 <join_path+0xfc>
+  201813:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  201817:	48 83 e8 01          	sub    $0x1,%rax
+  20181b:	0f b6 00             	movzbl (%rax),%eax
+  20181e:	3c 2f                	cmp    $0x2f,%al
+  201820:	75 05                	jne    201827 <join_path+0xfc>
+            d--;
+  201822:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+        }
+        *d = 0;
+  201827:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  20182b:	c6 00 00             	movb   $0x0,(%rax)
+  20182e:	e9 e9 02 00 00       	jmp    201b1c <join_path+0x3f1>
+        return;
+    }
+
+    // Otherwise, start with abs_path
+    const char *src = abs_path;
+  201833:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  20183a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    char *d = dst;
+  20183e:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  201845:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    if (*src != '/') {
+  201849:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20184d:	0f b6 00             	movzbl (%rax),%eax
+  201850:	3c 2f                	cmp    $0x2f,%al
+  201852:	74 2e                	je     201882 <join_path+0x157>
+        *d++ = '/';
+  201854:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  201858:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  20185c:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  201860:	c6 00 2f             	movb   $0x2f,(%rax)
+    }
+    while (*src) {
+  201863:	eb 1d                	jmp    201882 <join_path+0x157>
+        *d++ = *src++;
+  201865:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  201869:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  20186d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  201871:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  201875:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  201879:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  20187d:	0f b6 12             	movzbl (%rdx),%edx
+  201880:	88 10                	mov    %dl,(%rax)
+    while (*src) {
+  201882:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201886:	0f b6 00             	movzbl (%rax),%eax
+  201889:	84 c0                	test   %al,%al
+  20188b:	75 d8                	jne    201865 <join_path+0x13a>
+    }
+    // Remove trailing slash (unless root)
+    if (d > dst + 1 && *(d-1) == '/') {
+  20188d:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  201894:	48 83 c0 01          	add    $0x1,%rax
+  201898:	48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+  20189c:	73 14                	jae    2018b2 <join_path+0x187>
+  20189e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  2018a2:	48 83 e8 01          	sub    $0x1,%rax
+  2018a6:	0f b6 00             	movzbl (%rax),%eax
+  2018a9:	3c 2f                	cmp    $0x2f,%al
+  2018ab:	75 05                	jne    2018b2 <join_path+0x187>
+        d--;
+  2018ad:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+    }
+    *d = 0;
+  2018b2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  2018b6:	c6 00 00             	movb   $0x0,(%rax)
+
+    // Now, process path components
+    char temp[512];
+    int tlen = 0;
+  2018b9:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    // Copy dst to temp for easier manipulation
+    src = dst;
+  2018c0:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  2018c7:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    while (*src && tlen < (int)sizeof(temp)-1) {
+  2018cb:	eb 22                	jmp    2018ef <join_path+0x1c4>
+        temp[tlen++] = *src++;
+  2018cd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2018d1:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  2018d5:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  2018d9:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  2018dc:	8d 4a 01             	lea    0x1(%rdx),%ecx
+  2018df:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  2018e2:	0f b6 08             	movzbl (%rax),%ecx
+  2018e5:	48 63 c2             	movslq %edx,%rax
+  2018e8:	88 8c 05 b0 fd ff ff 	mov    %cl,-0x250(%rbp,%rax,1)
+    while (*src && tlen < (int)sizeof(temp)-1) {
+  2018ef:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2018f3:	0f b6 00             	movzbl (%rax),%eax
+  2018f6:	84 c0                	test   %al,%al
+  2018f8:	74 09                	je     201903 <join_path+0x1d8>
+  2018fa:	81 7d dc fe 01 00 00 	cmpl   $0x1fe,-0x24(%rbp)
+  201901:	7e ca                	jle    2018cd <join_path+0x1a2>
+    }
+    temp[tlen] = 0;
+  201903:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201906:	48 98                	cltq
+  201908:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  20190f:	00 
+
+    // Now, process each component in path
+    src = path;
+  201910:	48 8b 85 a0 fd ff ff 	mov    -0x260(%rbp),%rax
+  201917:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    while (*src) {
+  20191b:	e9 65 01 00 00       	jmp    201a85 <join_path+0x35a>
+        // Skip slashes
+        while (*src == '/') src++;
+  201920:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  201925:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201929:	0f b6 00             	movzbl (%rax),%eax
+  20192c:	3c 2f                	cmp    $0x2f,%al
+  20192e:	74 f0                	je     201920 <join_path+0x1f5>
+        if (!*src) break;
+  201930:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201934:	0f b6 00             	movzbl (%rax),%eax
+  201937:	84 c0                	test   %al,%al
+  201939:	0f 84 57 01 00 00    	je     201a96 <join_path+0x36b>
+
+        // Find end of component
+        const char *comp_start = src;
+  20193f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201943:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        while (*src && *src != '/') src++;
+  201947:	eb 05                	jmp    20194e <join_path+0x223>
+  201949:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  20194e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201952:	0f b6 00             	movzbl (%rax),%eax
+  201955:	84 c0                	test   %al,%al
+  201957:	74 0b                	je     201964 <join_path+0x239>
+  201959:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20195d:	0f b6 00             	movzbl (%rax),%eax
+  201960:	3c 2f                	cmp    $0x2f,%al
+  201962:	75 e5                	jne    201949 <join_path+0x21e>
+        const char *comp_end = src;
+  201964:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201968:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+
+        int comp_len = comp_end - comp_start;
+  20196c:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  201970:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  201974:	89 45 b4             	mov    %eax,-0x4c(%rbp)
+
+        // Get component string
+        if (comp_len == 1 && comp_start[0] == '.') {
+  201977:	83 7d b4 01          	cmpl   $0x1,-0x4c(%rbp)
+  20197b:	75 10                	jne    20198d <join_path+0x262>
+  20197d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  201981:	0f b6 00             	movzbl (%rax),%eax
+  201984:	3c 2e                	cmp    $0x2e,%al
+  201986:	75 05                	jne    20198d <join_path+0x262>
+            // Ignore
+            continue;
+  201988:	e9 f8 00 00 00       	jmp    201a85 <join_path+0x35a>
+        } else if (comp_len == 2 && comp_start[0] == '.' && comp_start[1] == '.') {
+  20198d:	83 7d b4 02          	cmpl   $0x2,-0x4c(%rbp)
+  201991:	75 6e                	jne    201a01 <join_path+0x2d6>
+  201993:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  201997:	0f b6 00             	movzbl (%rax),%eax
+  20199a:	3c 2e                	cmp    $0x2e,%al
+  20199c:	75 63                	jne    201a01 <join_path+0x2d6>
+  20199e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  2019a2:	48 83 c0 01          	add    $0x1,%rax
+  2019a6:	0f b6 00             	movzbl (%rax),%eax
+  2019a9:	3c 2e                	cmp    $0x2e,%al
+  2019ab:	75 54                	jne    201a01 <join_path+0x2d6>
+            // Go up one directory, unless at root
+            if (tlen > 1) {
+  2019ad:	83 7d dc 01          	cmpl   $0x1,-0x24(%rbp)
+  2019b1:	0f 8e ce 00 00 00    	jle    201a85 <join_path+0x35a>
+                // Remove trailing slash if any
+                if (temp[tlen-1] == '/') tlen--;
+  2019b7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  2019ba:	83 e8 01             	sub    $0x1,%eax
+  2019bd:	48 98                	cltq
+  2019bf:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  2019c6:	ff 
+  2019c7:	3c 2f                	cmp    $0x2f,%al
+  2019c9:	75 0a                	jne    2019d5 <join_path+0x2aa>
+  2019cb:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+                // Remove last component
+                while (tlen > 1 && temp[tlen-1] != '/') tlen--;
+  2019cf:	eb 04                	jmp    2019d5 <join_path+0x2aa>
+  2019d1:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  2019d5:	83 7d dc 01          	cmpl   $0x1,-0x24(%rbp)
+  2019d9:	7e 14                	jle    2019ef <join_path+0x2c4>
+  2019db:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  2019de:	83 e8 01             	sub    $0x1,%eax
+  2019e1:	48 98                	cltq
+  2019e3:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  2019ea:	ff 
+  2019eb:	3c 2f                	cmp    $0x2f,%al
+  2019ed:	75 e2                	jne    2019d1 <join_path+0x2a6>
+                temp[tlen] = 0;
+  2019ef:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  2019f2:	48 98                	cltq
+  2019f4:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  2019fb:	00 
+            if (tlen > 1) {
+  2019fc:	e9 84 00 00 00       	jmp    201a85 <join_path+0x35a>
+            }
+        } else if (comp_len > 0) {
+  201a01:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  201a05:	7e 7e                	jle    201a85 <join_path+0x35a>
+            // Add slash if not at root
+            if (tlen == 0 || temp[tlen-1] != '/') {
+  201a07:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  201a0b:	74 14                	je     201a21 <join_path+0x2f6>
+  201a0d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201a10:	83 e8 01             	sub    $0x1,%eax
+  201a13:	48 98                	cltq
+  201a15:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  201a1c:	ff 
+  201a1d:	3c 2f                	cmp    $0x2f,%al
+  201a1f:	74 1c                	je     201a3d <join_path+0x312>
+                if (tlen < (int)sizeof(temp)-1) temp[tlen++] = '/';
+  201a21:	81 7d dc fe 01 00 00 	cmpl   $0x1fe,-0x24(%rbp)
+  201a28:	7f 13                	jg     201a3d <join_path+0x312>
+  201a2a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201a2d:	8d 50 01             	lea    0x1(%rax),%edx
+  201a30:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  201a33:	48 98                	cltq
+  201a35:	c6 84 05 b0 fd ff ff 	movb   $0x2f,-0x250(%rbp,%rax,1)
+  201a3c:	2f 
+            }
+            // Copy component
+            for (const char *p = comp_start; p < comp_end && tlen < (int)sizeof(temp)-1; ++p) {
+  201a3d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  201a41:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  201a45:	eb 1e                	jmp    201a65 <join_path+0x33a>
+                temp[tlen++] = *p;
+  201a47:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201a4a:	8d 50 01             	lea    0x1(%rax),%edx
+  201a4d:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  201a50:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  201a54:	0f b6 12             	movzbl (%rdx),%edx
+  201a57:	48 98                	cltq
+  201a59:	88 94 05 b0 fd ff ff 	mov    %dl,-0x250(%rbp,%rax,1)
+            for (const char *p = comp_start; p < comp_end && tlen < (int)sizeof(temp)-1; ++p) {
+  201a60:	48 83 45 d0 01       	addq   $0x1,-0x30(%rbp)
+  201a65:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  201a69:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  201a6d:	73 09                	jae    201a78 <join_path+0x34d>
+  201a6f:	81 7d dc fe 01 00 00 	cmpl   $0x1fe,-0x24(%rbp)
+  201a76:	7e cf                	jle    201a47 <join_path+0x31c>
+            }
+            temp[tlen] = 0;
+  201a78:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201a7b:	48 98                	cltq
+  201a7d:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  201a84:	00 
+    while (*src) {
+  201a85:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201a89:	0f b6 00             	movzbl (%rax),%eax
+  201a8c:	84 c0                	test   %al,%al
+  201a8e:	0f 85 91 fe ff ff    	jne    201925 <join_path+0x1fa>
+  201a94:	eb 01                	jmp    201a97 <join_path+0x36c>
+        if (!*src) break;
+  201a96:	90                   	nop
+        }
+    }
+
+    // If temp is empty, set to "/"
+    if (tlen == 0) {
+  201a97:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  201a9b:	75 20                	jne    201abd <join_path+0x392>
+        temp[tlen++] = '/';
+  201a9d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201aa0:	8d 50 01             	lea    0x1(%rax),%edx
+  201aa3:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  201aa6:	48 98                	cltq
+  201aa8:	c6 84 05 b0 fd ff ff 	movb   $0x2f,-0x250(%rbp,%rax,1)
+  201aaf:	2f 
+        temp[tlen] = 0;
+  201ab0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201ab3:	48 98                	cltq
+  201ab5:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  201abc:	00 
+    }
+
+    // Remove trailing slash unless the path is just "/"
+    if (tlen > 1 && temp[tlen-1] == '/') {
+  201abd:	83 7d dc 01          	cmpl   $0x1,-0x24(%rbp)
+  201ac1:	7e 25                	jle    201ae8 <join_path+0x3bd>
+  201ac3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201ac6:	83 e8 01             	sub    $0x1,%eax
+  201ac9:	48 98                	cltq
+  201acb:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  201ad2:	ff 
+  201ad3:	3c 2f                	cmp    $0x2f,%al
+  201ad5:	75 11                	jne    201ae8 <join_path+0x3bd>
+        temp[--tlen] = 0;
+  201ad7:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  201adb:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201ade:	48 98                	cltq
+  201ae0:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  201ae7:	00 
+    }
+
+    // Copy temp to dst
+    for (int i = 0; i <= tlen; ++i) {
+  201ae8:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  201aef:	eb 23                	jmp    201b14 <join_path+0x3e9>
+        dst[i] = temp[i];
+  201af1:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  201af4:	48 63 d0             	movslq %eax,%rdx
+  201af7:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  201afe:	48 01 c2             	add    %rax,%rdx
+  201b01:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  201b04:	48 98                	cltq
+  201b06:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  201b0d:	ff 
+  201b0e:	88 02                	mov    %al,(%rdx)
+    for (int i = 0; i <= tlen; ++i) {
+  201b10:	83 45 cc 01          	addl   $0x1,-0x34(%rbp)
+  201b14:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  201b17:	3b 45 dc             	cmp    -0x24(%rbp),%eax
+  201b1a:	7e d5                	jle    201af1 <join_path+0x3c6>
+    }
+}
+  201b1c:	c9                   	leave
+  201b1d:	c3                   	ret
+
+0000000000201b1e <app_printf>:
+#include "lib-malloc.h"
+#include "errno.h"
+// app_printf
+//     A version of console_printf that picks a sensible color by process ID.
+
+void app_printf(int colorid, const char* format, ...) {
+  201b1e:	55                   	push   %rbp
+  201b1f:	48 89 e5             	mov    %rsp,%rbp
+  201b22:	48 83 ec 50          	sub    $0x50,%rsp
+  201b26:	49 89 f2             	mov    %rsi,%r10
+  201b29:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  201b2d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  201b31:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  201b35:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    int color;
+    if (colorid < 0) {
+        color = 0x0700;
+  201b39:	be 00 07 00 00       	mov    $0x700,%esi
+    if (colorid < 0) {
+  201b3e:	85 ff                	test   %edi,%edi
+  201b40:	78 32                	js     201b74 <app_printf+0x56>
+    } else {
+        static const uint8_t col[] = { 0x0F, 0x0C, 0x0A, 0x09, 0x0E };
+        color = col[colorid % sizeof(col)] << 8;
+  201b42:	48 63 ff             	movslq %edi,%rdi
+  201b45:	48 ba cd cc cc cc cc 	movabs $0xcccccccccccccccd,%rdx
+  201b4c:	cc cc cc 
+  201b4f:	48 89 f8             	mov    %rdi,%rax
+  201b52:	48 f7 e2             	mul    %rdx
+  201b55:	48 89 d0             	mov    %rdx,%rax
+  201b58:	48 c1 e8 02          	shr    $0x2,%rax
+  201b5c:	48 83 e2 fc          	and    $0xfffffffffffffffc,%rdx
+  201b60:	48 01 c2             	add    %rax,%rdx
+  201b63:	48 29 d7             	sub    %rdx,%rdi
+  201b66:	48 8d 05 eb 08 00 00 	lea    0x8eb(%rip),%rax        # 202458 <col.0>
+  201b6d:	0f b6 34 38          	movzbl (%rax,%rdi,1),%esi
+  201b71:	c1 e6 08             	shl    $0x8,%esi
+    }
+
+    va_list val;
+    va_start(val, format);
+  201b74:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  201b7b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  201b7f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  201b83:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  201b87:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    cursorpos = console_vprintf(cursorpos, color, format, val);
+  201b8b:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  201b8f:	4c 89 d2             	mov    %r10,%rdx
+  201b92:	8b 3d 64 74 eb ff    	mov    -0x148b9c(%rip),%edi        # b8ffc <cursorpos>
+  201b98:	e8 24 f7 ff ff       	call   2012c1 <console_vprintf>
+  201b9d:	89 05 59 74 eb ff    	mov    %eax,-0x148ba7(%rip)        # b8ffc <cursorpos>
+    va_end(val);
+
+    /*if (CROW(cursorpos) >= 23) {
+        cursorpos = CPOS(0, 0);
+    }*/
+}
+  201ba3:	c9                   	leave
+  201ba4:	c3                   	ret
+
+0000000000201ba5 <panic>:
+
+
+// panic, assert_fail
+//     Call the INT_SYS_PANIC system call so the kernel loops until Control-C.
+
+void panic(const char* format, ...) {
+  201ba5:	55                   	push   %rbp
+  201ba6:	48 89 e5             	mov    %rsp,%rbp
+  201ba9:	53                   	push   %rbx
+  201baa:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  201bb1:	48 89 fb             	mov    %rdi,%rbx
+  201bb4:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  201bb8:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  201bbc:	48 89 4d d8          	mov    %rcx,-0x28(%rbp)
+  201bc0:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  201bc4:	4c 89 4d e8          	mov    %r9,-0x18(%rbp)
+    va_list val;
+    va_start(val, format);
+  201bc8:	c7 45 a8 08 00 00 00 	movl   $0x8,-0x58(%rbp)
+  201bcf:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  201bd3:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  201bd7:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  201bdb:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    char buf[160];
+    memcpy(buf, "PANIC: ", 7);
+  201bdf:	48 8d bd 08 ff ff ff 	lea    -0xf8(%rbp),%rdi
+  201be6:	ba 07 00 00 00       	mov    $0x7,%edx
+  201beb:	48 8d 35 9f 06 00 00 	lea    0x69f(%rip),%rsi        # 202291 <lower_digits.0+0x11>
+  201bf2:	e8 31 e5 ff ff       	call   200128 <memcpy>
+    int len = vsnprintf(&buf[7], sizeof(buf) - 7, format, val) + 7;
+  201bf7:	48 8d 4d a8          	lea    -0x58(%rbp),%rcx
+  201bfb:	48 8d bd 0f ff ff ff 	lea    -0xf1(%rbp),%rdi
+  201c02:	48 89 da             	mov    %rbx,%rdx
+  201c05:	be 99 00 00 00       	mov    $0x99,%esi
+  201c0a:	e8 cd f7 ff ff       	call   2013dc <vsnprintf>
+  201c0f:	8d 50 07             	lea    0x7(%rax),%edx
+    va_end(val);
+    if (len > 0 && buf[len - 1] != '\n') {
+  201c12:	85 d2                	test   %edx,%edx
+  201c14:	7e 0f                	jle    201c25 <panic+0x80>
+  201c16:	83 c0 06             	add    $0x6,%eax
+  201c19:	48 98                	cltq
+  201c1b:	80 bc 05 08 ff ff ff 	cmpb   $0xa,-0xf8(%rbp,%rax,1)
+  201c22:	0a 
+  201c23:	75 30                	jne    201c55 <panic+0xb0>
+        strcpy(buf + len - (len == (int) sizeof(buf) - 1), "\n");
+    }
+    (void) console_printf(CPOS(23, 0), 0xC000, "%s", buf);
+  201c25:	48 8d 8d 08 ff ff ff 	lea    -0xf8(%rbp),%rcx
+  201c2c:	48 8d 15 66 06 00 00 	lea    0x666(%rip),%rdx        # 202299 <lower_digits.0+0x19>
+  201c33:	be 00 c0 00 00       	mov    $0xc000,%esi
+  201c38:	bf 30 07 00 00       	mov    $0x730,%edi
+  201c3d:	b8 00 00 00 00       	mov    $0x0,%eax
+  201c42:	e8 f5 f6 ff ff       	call   20133c <console_printf>
+    asm volatile ("syscall" : "=a" (rax)
+  201c47:	b8 30 00 00 00       	mov    $0x30,%eax
+  201c4c:	bf 00 00 00 00       	mov    $0x0,%edi
+  201c51:	0f 05                	syscall
+ loop: goto loop;
+  201c53:	eb fe                	jmp    201c53 <panic+0xae>
+        strcpy(buf + len - (len == (int) sizeof(buf) - 1), "\n");
+  201c55:	48 63 c2             	movslq %edx,%rax
+  201c58:	81 fa 9f 00 00 00    	cmp    $0x9f,%edx
+  201c5e:	0f 94 c2             	sete   %dl
+  201c61:	0f b6 d2             	movzbl %dl,%edx
+  201c64:	48 29 d0             	sub    %rdx,%rax
+  201c67:	48 8d bc 05 08 ff ff 	lea    -0xf8(%rbp,%rax,1),%rdi
+  201c6e:	ff 
+  201c6f:	48 8d 35 fe 06 00 00 	lea    0x6fe(%rip),%rsi        # 202374 <lower_digits.0+0xf4>
+  201c76:	e8 3b e8 ff ff       	call   2004b6 <strcpy>
+  201c7b:	eb a8                	jmp    201c25 <panic+0x80>
+
+0000000000201c7d <raise>:
+
+#define SIGABRT -1
+
+
+
+int raise(int sig) {
+  201c7d:	89 fe                	mov    %edi,%esi
+
+// getpid()
+//    Return current process ID, like sys_getpid().
+static inline pid_t getpid(void) {
+    return vdso()->pid;
+  201c7f:	8b 3c 25 00 10 24 00 	mov    0x241000,%edi
+    asm volatile ("syscall" : "=a" (result)
+  201c86:	b8 41 00 00 00       	mov    $0x41,%eax
+  201c8b:	0f 05                	syscall
+    return sys_kill(getpid(), sig);
+}
+  201c8d:	c3                   	ret
+
+0000000000201c8e <abort>:
+    return vdso()->pid;
+  201c8e:	8b 3c 25 00 10 24 00 	mov    0x241000,%edi
+    asm volatile ("syscall" : "=a" (result)
+  201c95:	b8 41 00 00 00       	mov    $0x41,%eax
+  201c9a:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  201c9f:	0f 05                	syscall
+
+void __attribute((noreturn)) abort(void) {
+    raise(SIGABRT);
+ spinloop: goto spinloop;       // should never get here
+  201ca1:	eb fe                	jmp    201ca1 <abort+0x13>
+
+0000000000201ca3 <assert_fail>:
+}
+
+
+void assert_fail(const char* file, int line, const char* msg) {
+  201ca3:	55                   	push   %rbp
+  201ca4:	48 89 e5             	mov    %rsp,%rbp
+  201ca7:	48 89 f9             	mov    %rdi,%rcx
+  201caa:	41 89 f0             	mov    %esi,%r8d
+  201cad:	49 89 d1             	mov    %rdx,%r9
+    (void) console_printf(CPOS(23, 0), 0xC000,
+  201cb0:	48 8d 15 c1 06 00 00 	lea    0x6c1(%rip),%rdx        # 202378 <lower_digits.0+0xf8>
+  201cb7:	be 00 c0 00 00       	mov    $0xc000,%esi
+  201cbc:	bf 30 07 00 00       	mov    $0x730,%edi
+  201cc1:	b8 00 00 00 00       	mov    $0x0,%eax
+  201cc6:	e8 71 f6 ff ff       	call   20133c <console_printf>
+                          "PANIC: %s:%d: assertion '%s' failed\n",
+                          file, line, msg);
+    abort();
+  201ccb:	e8 be ff ff ff       	call   201c8e <abort>
+
+0000000000201cd0 <scan_char>:
+    asm volatile ("syscall" : "=a" (result)
+  201cd0:	bf 3a 00 00 00       	mov    $0x3a,%edi
+    asm volatile ("syscall" : "=a" (rax)
+  201cd5:	be 3c 00 00 00       	mov    $0x3c,%esi
+    asm volatile ("syscall" : "=a" (result)
+  201cda:	89 f8                	mov    %edi,%eax
+  201cdc:	0f 05                	syscall
+  201cde:	89 c2                	mov    %eax,%edx
+    asm volatile ("syscall" : "=a" (rax)
+  201ce0:	89 f0                	mov    %esi,%eax
+  201ce2:	0f 05                	syscall
+    int c;
+
+    do {
+        c = sys_keybord();
+        sys_yield();
+    } while (c == -1);
+  201ce4:	83 fa ff             	cmp    $0xffffffff,%edx
+  201ce7:	74 f1                	je     201cda <scan_char+0xa>
+
+    return c;
+  201ce9:	89 d0                	mov    %edx,%eax
+}
+  201ceb:	c3                   	ret
+
+0000000000201cec <scan_line>:
+
+unsigned int scan_line(char* dst, unsigned int length_max) {
+  201cec:	55                   	push   %rbp
+  201ced:	48 89 e5             	mov    %rsp,%rbp
+  201cf0:	41 57                	push   %r15
+  201cf2:	41 56                	push   %r14
+  201cf4:	41 55                	push   %r13
+  201cf6:	41 54                	push   %r12
+  201cf8:	53                   	push   %rbx
+  201cf9:	48 83 ec 08          	sub    $0x8,%rsp
+  201cfd:	49 89 fe             	mov    %rdi,%r14
+  201d00:	41 89 f5             	mov    %esi,%r13d
+    unsigned int length = 0;
+  201d03:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            app_printf(0, "%c", c);
+            dst[length] = '\0';
+            return length;
+        } else if (c >= 32 && c <= 127) {
+            if (length < length_max) {
+                app_printf(0, "%c", c);
+  201d09:	4c 8d 3d 8c 05 00 00 	lea    0x58c(%rip),%r15        # 20229c <lower_digits.0+0x1c>
+  201d10:	eb 05                	jmp    201d17 <scan_line+0x2b>
+            if (length != 0) {
+  201d12:	45 85 e4             	test   %r12d,%r12d
+  201d15:	75 3e                	jne    201d55 <scan_line+0x69>
+        unsigned char c = scan_char();
+  201d17:	e8 b4 ff ff ff       	call   201cd0 <scan_char>
+  201d1c:	89 c3                	mov    %eax,%ebx
+        if (c == '\b') {
+  201d1e:	3c 08                	cmp    $0x8,%al
+  201d20:	74 f0                	je     201d12 <scan_line+0x26>
+        } else if (c == '\n') {
+  201d22:	3c 0a                	cmp    $0xa,%al
+  201d24:	74 4c                	je     201d72 <scan_line+0x86>
+        } else if (c >= 32 && c <= 127) {
+  201d26:	8d 43 e0             	lea    -0x20(%rbx),%eax
+            if (length < length_max) {
+  201d29:	3c 5f                	cmp    $0x5f,%al
+  201d2b:	77 ea                	ja     201d17 <scan_line+0x2b>
+  201d2d:	45 39 ec             	cmp    %r13d,%r12d
+  201d30:	73 e5                	jae    201d17 <scan_line+0x2b>
+                app_printf(0, "%c", c);
+  201d32:	0f b6 d3             	movzbl %bl,%edx
+  201d35:	4c 89 fe             	mov    %r15,%rsi
+  201d38:	bf 00 00 00 00       	mov    $0x0,%edi
+  201d3d:	b8 00 00 00 00       	mov    $0x0,%eax
+  201d42:	e8 d7 fd ff ff       	call   201b1e <app_printf>
+                dst[length++] = c;
+  201d47:	44 89 e0             	mov    %r12d,%eax
+  201d4a:	41 88 1c 06          	mov    %bl,(%r14,%rax,1)
+  201d4e:	45 8d 64 24 01       	lea    0x1(%r12),%r12d
+  201d53:	eb c2                	jmp    201d17 <scan_line+0x2b>
+                app_printf(0, "%c", c);
+  201d55:	ba 08 00 00 00       	mov    $0x8,%edx
+  201d5a:	4c 89 fe             	mov    %r15,%rsi
+  201d5d:	bf 00 00 00 00       	mov    $0x0,%edi
+  201d62:	b8 00 00 00 00       	mov    $0x0,%eax
+  201d67:	e8 b2 fd ff ff       	call   201b1e <app_printf>
+                length--;
+  201d6c:	41 83 ec 01          	sub    $0x1,%r12d
+  201d70:	eb a5                	jmp    201d17 <scan_line+0x2b>
+            app_printf(0, "%c", c);
+  201d72:	ba 0a 00 00 00       	mov    $0xa,%edx
+  201d77:	48 8d 35 1e 05 00 00 	lea    0x51e(%rip),%rsi        # 20229c <lower_digits.0+0x1c>
+  201d7e:	bf 00 00 00 00       	mov    $0x0,%edi
+  201d83:	b8 00 00 00 00       	mov    $0x0,%eax
+  201d88:	e8 91 fd ff ff       	call   201b1e <app_printf>
+            dst[length] = '\0';
+  201d8d:	44 89 e0             	mov    %r12d,%eax
+  201d90:	41 c6 04 06 00       	movb   $0x0,(%r14,%rax,1)
+            }
+        }
+    }
+}
+  201d95:	44 89 e0             	mov    %r12d,%eax
+  201d98:	48 83 c4 08          	add    $0x8,%rsp
+  201d9c:	5b                   	pop    %rbx
+  201d9d:	41 5c                	pop    %r12
+  201d9f:	41 5d                	pop    %r13
+  201da1:	41 5e                	pop    %r14
+  201da3:	41 5f                	pop    %r15
+  201da5:	5d                   	pop    %rbp
+  201da6:	c3                   	ret
+
+0000000000201da7 <split_string>:
+
+
+char** split_string(char* str, char sep) {
+  201da7:	55                   	push   %rbp
+  201da8:	48 89 e5             	mov    %rsp,%rbp
+  201dab:	41 57                	push   %r15
+  201dad:	41 56                	push   %r14
+  201daf:	41 55                	push   %r13
+  201db1:	41 54                	push   %r12
+  201db3:	53                   	push   %rbx
+  201db4:	48 83 ec 08          	sub    $0x8,%rsp
+    int s = 1;
+    int n = 0;
+
+    while (str[n]) {
+  201db8:	0f b6 07             	movzbl (%rdi),%eax
+  201dbb:	84 c0                	test   %al,%al
+  201dbd:	0f 84 ad 00 00 00    	je     201e70 <split_string+0xc9>
+  201dc3:	48 89 fb             	mov    %rdi,%rbx
+  201dc6:	41 89 f4             	mov    %esi,%r12d
+  201dc9:	41 be 01 00 00 00    	mov    $0x1,%r14d
+    int s = 1;
+  201dcf:	b9 01 00 00 00       	mov    $0x1,%ecx
+  201dd4:	eb 03                	jmp    201dd9 <split_string+0x32>
+  201dd6:	49 89 d6             	mov    %rdx,%r14
+        if (str[n] == sep)
+            s++;
+  201dd9:	41 38 c4             	cmp    %al,%r12b
+  201ddc:	0f 94 c0             	sete   %al
+  201ddf:	0f b6 c0             	movzbl %al,%eax
+  201de2:	01 c1                	add    %eax,%ecx
+    while (str[n]) {
+  201de4:	49 8d 56 01          	lea    0x1(%r14),%rdx
+  201de8:	0f b6 44 13 ff       	movzbl -0x1(%rbx,%rdx,1),%eax
+  201ded:	84 c0                	test   %al,%al
+  201def:	75 e5                	jne    201dd6 <split_string+0x2f>
+        n++;
+    }
+    
+    char** part = malloc((s+1)*sizeof(char*));
+  201df1:	44 8d 79 01          	lea    0x1(%rcx),%r15d
+  201df5:	4d 63 ff             	movslq %r15d,%r15
+  201df8:	49 c1 e7 03          	shl    $0x3,%r15
+  201dfc:	4c 89 ff             	mov    %r15,%rdi
+  201dff:	e8 69 02 00 00       	call   20206d <malloc>
+  201e04:	49 89 c5             	mov    %rax,%r13
+    char* buffer = malloc(n+1);
+  201e07:	41 8d 7e 01          	lea    0x1(%r14),%edi
+  201e0b:	48 63 ff             	movslq %edi,%rdi
+  201e0e:	e8 5a 02 00 00       	call   20206d <malloc>
+
+    int word_n = 0;
+    part[0] = buffer;
+  201e13:	49 89 45 00          	mov    %rax,0x0(%r13)
+    part[s] = NULL;
+  201e17:	4b c7 44 3d f8 00 00 	movq   $0x0,-0x8(%r13,%r15,1)
+  201e1e:	00 00 
+    buffer[n] = 0;
+  201e20:	42 c6 04 30 00       	movb   $0x0,(%rax,%r14,1)
+
+    for (int i = 0; i < n; i++) {
+  201e25:	45 85 f6             	test   %r14d,%r14d
+  201e28:	7e 6c                	jle    201e96 <split_string+0xef>
+  201e2a:	41 83 ee 01          	sub    $0x1,%r14d
+  201e2e:	48 89 da             	mov    %rbx,%rdx
+  201e31:	48 83 c0 01          	add    $0x1,%rax
+  201e35:	48 89 c1             	mov    %rax,%rcx
+    int word_n = 0;
+  201e38:	bf 00 00 00 00       	mov    $0x0,%edi
+  201e3d:	eb 23                	jmp    201e62 <split_string+0xbb>
+        if (str[i] == sep) {
+            buffer[i] = 0;
+  201e3f:	c6 41 ff 00          	movb   $0x0,-0x1(%rcx)
+            part[++word_n] = &buffer[i+1];
+  201e43:	83 c7 01             	add    $0x1,%edi
+  201e46:	48 63 f7             	movslq %edi,%rsi
+  201e49:	49 89 4c f5 00       	mov    %rcx,0x0(%r13,%rsi,8)
+    for (int i = 0; i < n; i++) {
+  201e4e:	48 83 c2 01          	add    $0x1,%rdx
+  201e52:	48 83 c1 01          	add    $0x1,%rcx
+  201e56:	89 ce                	mov    %ecx,%esi
+  201e58:	29 c6                	sub    %eax,%esi
+  201e5a:	83 ee 01             	sub    $0x1,%esi
+  201e5d:	44 39 f6             	cmp    %r14d,%esi
+  201e60:	7d 34                	jge    201e96 <split_string+0xef>
+        if (str[i] == sep) {
+  201e62:	0f b6 32             	movzbl (%rdx),%esi
+  201e65:	44 38 e6             	cmp    %r12b,%sil
+  201e68:	74 d5                	je     201e3f <split_string+0x98>
+        } else {
+            buffer[i] = str[i];
+  201e6a:	40 88 71 ff          	mov    %sil,-0x1(%rcx)
+  201e6e:	eb de                	jmp    201e4e <split_string+0xa7>
+    char** part = malloc((s+1)*sizeof(char*));
+  201e70:	bf 10 00 00 00       	mov    $0x10,%edi
+  201e75:	e8 f3 01 00 00       	call   20206d <malloc>
+  201e7a:	49 89 c5             	mov    %rax,%r13
+    char* buffer = malloc(n+1);
+  201e7d:	bf 01 00 00 00       	mov    $0x1,%edi
+  201e82:	e8 e6 01 00 00       	call   20206d <malloc>
+    part[0] = buffer;
+  201e87:	49 89 45 00          	mov    %rax,0x0(%r13)
+    part[s] = NULL;
+  201e8b:	49 c7 45 08 00 00 00 	movq   $0x0,0x8(%r13)
+  201e92:	00 
+    buffer[n] = 0;
+  201e93:	c6 00 00             	movb   $0x0,(%rax)
+        }
+    }
+
+    return part;
+}
+  201e96:	4c 89 e8             	mov    %r13,%rax
+  201e99:	48 83 c4 08          	add    $0x8,%rsp
+  201e9d:	5b                   	pop    %rbx
+  201e9e:	41 5c                	pop    %r12
+  201ea0:	41 5d                	pop    %r13
+  201ea2:	41 5e                	pop    %r14
+  201ea4:	41 5f                	pop    %r15
+  201ea6:	5d                   	pop    %rbp
+  201ea7:	c3                   	ret
+
+0000000000201ea8 <app_print_error>:
+
+
+void app_print_error(int r) {
+  201ea8:	55                   	push   %rbp
+  201ea9:	48 89 e5             	mov    %rsp,%rbp
+    switch (r) {
+  201eac:	83 ff 24             	cmp    $0x24,%edi
+  201eaf:	0f 87 79 01 00 00    	ja     20202e <app_print_error+0x186>
+  201eb5:	89 f8                	mov    %edi,%eax
+  201eb7:	48 8d 15 06 05 00 00 	lea    0x506(%rip),%rdx        # 2023c4 <lower_digits.0+0x144>
+  201ebe:	48 63 04 82          	movslq (%rdx,%rax,4),%rax
+  201ec2:	48 01 d0             	add    %rdx,%rax
+  201ec5:	ff e0                	jmp    *%rax
+        case ENOENT:
+            app_printf(1, "Error: %s\n", "No such file or directory");
+  201ec7:	48 8d 15 d1 03 00 00 	lea    0x3d1(%rip),%rdx        # 20229f <lower_digits.0+0x1f>
+  201ece:	48 8d 35 e4 03 00 00 	lea    0x3e4(%rip),%rsi        # 2022b9 <lower_digits.0+0x39>
+  201ed5:	bf 01 00 00 00       	mov    $0x1,%edi
+  201eda:	b8 00 00 00 00       	mov    $0x0,%eax
+  201edf:	e8 3a fc ff ff       	call   201b1e <app_printf>
+            break;
+        default:
+            app_printf(1, "Error %d: %s\n", r, "Unknown error");
+            break;
+    }
+}
+  201ee4:	5d                   	pop    %rbp
+  201ee5:	c3                   	ret
+            app_printf(1, "Error: %s\n", "I/O error");
+  201ee6:	48 8d 15 d7 03 00 00 	lea    0x3d7(%rip),%rdx        # 2022c4 <lower_digits.0+0x44>
+  201eed:	48 8d 35 c5 03 00 00 	lea    0x3c5(%rip),%rsi        # 2022b9 <lower_digits.0+0x39>
+  201ef4:	bf 01 00 00 00       	mov    $0x1,%edi
+  201ef9:	b8 00 00 00 00       	mov    $0x0,%eax
+  201efe:	e8 1b fc ff ff       	call   201b1e <app_printf>
+            break;
+  201f03:	eb df                	jmp    201ee4 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Exec format error");
+  201f05:	48 8d 15 c2 03 00 00 	lea    0x3c2(%rip),%rdx        # 2022ce <lower_digits.0+0x4e>
+  201f0c:	48 8d 35 a6 03 00 00 	lea    0x3a6(%rip),%rsi        # 2022b9 <lower_digits.0+0x39>
+  201f13:	bf 01 00 00 00       	mov    $0x1,%edi
+  201f18:	b8 00 00 00 00       	mov    $0x0,%eax
+  201f1d:	e8 fc fb ff ff       	call   201b1e <app_printf>
+            break;
+  201f22:	eb c0                	jmp    201ee4 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Resource temporarily unavailable");
+  201f24:	48 8d 15 75 04 00 00 	lea    0x475(%rip),%rdx        # 2023a0 <lower_digits.0+0x120>
+  201f2b:	48 8d 35 87 03 00 00 	lea    0x387(%rip),%rsi        # 2022b9 <lower_digits.0+0x39>
+  201f32:	bf 01 00 00 00       	mov    $0x1,%edi
+  201f37:	b8 00 00 00 00       	mov    $0x0,%eax
+  201f3c:	e8 dd fb ff ff       	call   201b1e <app_printf>
+            break;
+  201f41:	eb a1                	jmp    201ee4 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Out of memory");
+  201f43:	48 8d 15 96 03 00 00 	lea    0x396(%rip),%rdx        # 2022e0 <lower_digits.0+0x60>
+  201f4a:	48 8d 35 68 03 00 00 	lea    0x368(%rip),%rsi        # 2022b9 <lower_digits.0+0x39>
+  201f51:	bf 01 00 00 00       	mov    $0x1,%edi
+  201f56:	b8 00 00 00 00       	mov    $0x0,%eax
+  201f5b:	e8 be fb ff ff       	call   201b1e <app_printf>
+            break;
+  201f60:	eb 82                	jmp    201ee4 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Bad address");
+  201f62:	48 8d 15 85 03 00 00 	lea    0x385(%rip),%rdx        # 2022ee <lower_digits.0+0x6e>
+  201f69:	48 8d 35 49 03 00 00 	lea    0x349(%rip),%rsi        # 2022b9 <lower_digits.0+0x39>
+  201f70:	bf 01 00 00 00       	mov    $0x1,%edi
+  201f75:	b8 00 00 00 00       	mov    $0x0,%eax
+  201f7a:	e8 9f fb ff ff       	call   201b1e <app_printf>
+            break;
+  201f7f:	e9 60 ff ff ff       	jmp    201ee4 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Not a directory");
+  201f84:	48 8d 15 6f 03 00 00 	lea    0x36f(%rip),%rdx        # 2022fa <lower_digits.0+0x7a>
+  201f8b:	48 8d 35 27 03 00 00 	lea    0x327(%rip),%rsi        # 2022b9 <lower_digits.0+0x39>
+  201f92:	bf 01 00 00 00       	mov    $0x1,%edi
+  201f97:	b8 00 00 00 00       	mov    $0x0,%eax
+  201f9c:	e8 7d fb ff ff       	call   201b1e <app_printf>
+            break;
+  201fa1:	e9 3e ff ff ff       	jmp    201ee4 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Invalid argument");
+  201fa6:	48 8d 15 5d 03 00 00 	lea    0x35d(%rip),%rdx        # 20230a <lower_digits.0+0x8a>
+  201fad:	48 8d 35 05 03 00 00 	lea    0x305(%rip),%rsi        # 2022b9 <lower_digits.0+0x39>
+  201fb4:	bf 01 00 00 00       	mov    $0x1,%edi
+  201fb9:	b8 00 00 00 00       	mov    $0x0,%eax
+  201fbe:	e8 5b fb ff ff       	call   201b1e <app_printf>
+            break;
+  201fc3:	e9 1c ff ff ff       	jmp    201ee4 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "No space left on device");
+  201fc8:	48 8d 15 4c 03 00 00 	lea    0x34c(%rip),%rdx        # 20231b <lower_digits.0+0x9b>
+  201fcf:	48 8d 35 e3 02 00 00 	lea    0x2e3(%rip),%rsi        # 2022b9 <lower_digits.0+0x39>
+  201fd6:	bf 01 00 00 00       	mov    $0x1,%edi
+  201fdb:	b8 00 00 00 00       	mov    $0x0,%eax
+  201fe0:	e8 39 fb ff ff       	call   201b1e <app_printf>
+            break;
+  201fe5:	e9 fa fe ff ff       	jmp    201ee4 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "File already exists");
+  201fea:	48 8d 15 42 03 00 00 	lea    0x342(%rip),%rdx        # 202333 <lower_digits.0+0xb3>
+  201ff1:	48 8d 35 c1 02 00 00 	lea    0x2c1(%rip),%rsi        # 2022b9 <lower_digits.0+0x39>
+  201ff8:	bf 01 00 00 00       	mov    $0x1,%edi
+  201ffd:	b8 00 00 00 00       	mov    $0x0,%eax
+  202002:	e8 17 fb ff ff       	call   201b1e <app_printf>
+            break;
+  202007:	e9 d8 fe ff ff       	jmp    201ee4 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "File name too long");
+  20200c:	48 8d 15 34 03 00 00 	lea    0x334(%rip),%rdx        # 202347 <lower_digits.0+0xc7>
+  202013:	48 8d 35 9f 02 00 00 	lea    0x29f(%rip),%rsi        # 2022b9 <lower_digits.0+0x39>
+  20201a:	bf 01 00 00 00       	mov    $0x1,%edi
+  20201f:	b8 00 00 00 00       	mov    $0x0,%eax
+  202024:	e8 f5 fa ff ff       	call   201b1e <app_printf>
+            break;
+  202029:	e9 b6 fe ff ff       	jmp    201ee4 <app_print_error+0x3c>
+            app_printf(1, "Error %d: %s\n", r, "Unknown error");
+  20202e:	48 8d 0d 25 03 00 00 	lea    0x325(%rip),%rcx        # 20235a <lower_digits.0+0xda>
+  202035:	89 fa                	mov    %edi,%edx
+  202037:	48 8d 35 2a 03 00 00 	lea    0x32a(%rip),%rsi        # 202368 <lower_digits.0+0xe8>
+  20203e:	bf 01 00 00 00       	mov    $0x1,%edi
+  202043:	b8 00 00 00 00       	mov    $0x0,%eax
+  202048:	e8 d1 fa ff ff       	call   201b1e <app_printf>
+}
+  20204d:	e9 92 fe ff ff       	jmp    201ee4 <app_print_error+0x3c>
+
+0000000000202052 <handle_error>:
+
+__attribute__((noreturn)) void handle_error(int r) {
+  202052:	55                   	push   %rbp
+  202053:	48 89 e5             	mov    %rsp,%rbp
+  202056:	53                   	push   %rbx
+  202057:	48 83 ec 08          	sub    $0x8,%rsp
+  20205b:	89 fb                	mov    %edi,%ebx
+    app_print_error(r);
+  20205d:	e8 46 fe ff ff       	call   201ea8 <app_print_error>
+    asm volatile ("syscall" : "=a" (rax)
+  202062:	b8 40 00 00 00       	mov    $0x40,%eax
+  202067:	89 df                	mov    %ebx,%edi
+  202069:	0f 05                	syscall
+ spinloop: goto spinloop;       // should never get here
+  20206b:	eb fe                	jmp    20206b <handle_error+0x19>
+
+000000000020206d <malloc>:
+
+// The heap starts 1MB above the program image (PROC_START_ADDR)
+static uint8_t* heap_top = (uint8_t*) 0x300000;
+static uint8_t* page_top = (uint8_t*) 0x300000;
+
+void* malloc(size_t size) {
+  20206d:	48 89 fe             	mov    %rdi,%rsi
+    while (ROUNDDOWN(heap_top + size, PAGESIZE) >= page_top) {
+  202070:	48 8b 05 91 0f 00 00 	mov    0xf91(%rip),%rax        # 203008 <heap_top>
+  202077:	48 8d 14 38          	lea    (%rax,%rdi,1),%rdx
+  20207b:	48 8b 3d 7e 0f 00 00 	mov    0xf7e(%rip),%rdi        # 203000 <page_top>
+  202082:	48 89 d1             	mov    %rdx,%rcx
+  202085:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  20208c:	48 39 f9             	cmp    %rdi,%rcx
+  20208f:	72 3e                	jb     2020cf <malloc+0x62>
+    asm volatile ("syscall" : "=a" (result)
+  202091:	41 b8 3b 00 00 00    	mov    $0x3b,%r8d
+  202097:	44 89 c0             	mov    %r8d,%eax
+  20209a:	0f 05                	syscall
+        int r = sys_page_alloc(page_top);
+        assert(r >= 0);
+  20209c:	85 c0                	test   %eax,%eax
+  20209e:	78 37                	js     2020d7 <malloc+0x6a>
+        page_top += PAGESIZE;
+  2020a0:	48 8b 05 59 0f 00 00 	mov    0xf59(%rip),%rax        # 203000 <page_top>
+  2020a7:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  2020ae:	48 89 3d 4b 0f 00 00 	mov    %rdi,0xf4b(%rip)        # 203000 <page_top>
+    while (ROUNDDOWN(heap_top + size, PAGESIZE) >= page_top) {
+  2020b5:	48 8b 05 4c 0f 00 00 	mov    0xf4c(%rip),%rax        # 203008 <heap_top>
+  2020bc:	48 8d 14 30          	lea    (%rax,%rsi,1),%rdx
+  2020c0:	48 89 d1             	mov    %rdx,%rcx
+  2020c3:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  2020ca:	48 39 f9             	cmp    %rdi,%rcx
+  2020cd:	73 c8                	jae    202097 <malloc+0x2a>
+    }
+
+    void* addr = heap_top;
+    heap_top += size;
+  2020cf:	48 89 15 32 0f 00 00 	mov    %rdx,0xf32(%rip)        # 203008 <heap_top>
+    return addr;
+}
+  2020d6:	c3                   	ret
+void* malloc(size_t size) {
+  2020d7:	55                   	push   %rbp
+  2020d8:	48 89 e5             	mov    %rsp,%rbp
+        assert(r >= 0);
+  2020db:	48 8d 15 7b 03 00 00 	lea    0x37b(%rip),%rdx        # 20245d <col.0+0x5>
+  2020e2:	be 0b 00 00 00       	mov    $0xb,%esi
+  2020e7:	48 8d 3d 76 03 00 00 	lea    0x376(%rip),%rdi        # 202464 <col.0+0xc>
+  2020ee:	e8 b0 fb ff ff       	call   201ca3 <assert_fail>
@@ -0,0 +1,3458 @@
+
+obj/p-membench.full:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000200000 <process_main>:
+    }
+    return (read_cycle_counter() - start) / ROUNDS;
+}
+
+
+void process_main(void) {
+  200000:	55                   	push   %rbp
+  200001:	48 89 e5             	mov    %rsp,%rbp
+  200004:	41 57                	push   %r15
+  200006:	41 56                	push   %r14
+  200008:	41 55                	push   %r13
+  20000a:	41 54                	push   %r12
+  20000c:	53                   	push   %rbx
+  20000d:	48 83 ec 28          	sub    $0x28,%rsp
+    for (size_t i = 0; i < sizeof(src); ++i) {
+  200011:	b8 00 00 00 00       	mov    $0x0,%eax
+        src[i] = i;
+  200016:	48 8d 15 23 70 00 00 	lea    0x7023(%rip),%rdx        # 207040 <src>
+  20001d:	88 04 02             	mov    %al,(%rdx,%rax,1)
+    for (size_t i = 0; i < sizeof(src); ++i) {
+  200020:	48 83 c0 01          	add    $0x1,%rax
+  200024:	48 3d 10 40 00 00    	cmp    $0x4010,%rax
+  20002a:	75 f1                	jne    20001d <process_main+0x1d>
+    }
+    // touch every page first so page faults stay out of the timings
+    memset(dst, 0, sizeof(dst));
+  20002c:	ba 10 40 00 00       	mov    $0x4010,%edx
+  200031:	be 00 00 00 00       	mov    $0x0,%esi
+  200036:	48 8d 3d e3 2f 00 00 	lea    0x2fe3(%rip),%rdi        # 203020 <dst>
+  20003d:	e8 1f 04 00 00       	call   200461 <memset>
+
+    app_printf(0, "%6s %9s %9s %9s %9s %9s %9s\n", "bytes",
+  200042:	48 83 ec 08          	sub    $0x8,%rsp
+  200046:	48 8d 15 db 21 00 00 	lea    0x21db(%rip),%rdx        # 202228 <malloc+0x99>
+  20004d:	52                   	push   %rdx
+  20004e:	48 8d 05 fd 21 00 00 	lea    0x21fd(%rip),%rax        # 202252 <malloc+0xc3>
+  200055:	50                   	push   %rax
+  200056:	52                   	push   %rdx
+  200057:	4c 8d 0d c2 21 00 00 	lea    0x21c2(%rip),%r9        # 202220 <malloc+0x91>
+  20005e:	49 89 d0             	mov    %rdx,%r8
+  200061:	48 8d 0d c6 21 00 00 	lea    0x21c6(%rip),%rcx        # 20222e <malloc+0x9f>
+  200068:	48 8d 35 c6 21 00 00 	lea    0x21c6(%rip),%rsi        # 202235 <malloc+0xa6>
+  20006f:	bf 00 00 00 00       	mov    $0x0,%edi
+  200074:	b8 00 00 00 00       	mov    $0x0,%eax
+  200079:	e8 c2 1b 00 00       	call   201c40 <app_printf>
+               "memcpy", "bytes", "memmove", "bytes", "memset", "bytes");
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i) {
+  20007e:	48 8d 1d 1b 22 00 00 	lea    0x221b(%rip),%rbx        # 2022a0 <sizes>
+  200085:	48 83 c4 20          	add    $0x20,%rsp
+    char* d = dst + misalign;
+  200089:	4c 8d 35 90 2f 00 00 	lea    0x2f90(%rip),%r14        # 203020 <dst>
+  200090:	e9 63 01 00 00       	jmp    2001f8 <process_main+0x1f8>
+    for (; n > 0; --n) {
+  200095:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200099:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  20009d:	48 8d 0c 38          	lea    (%rax,%rdi,1),%rcx
+  2000a1:	48 85 ff             	test   %rdi,%rdi
+  2000a4:	74 4f                	je     2000f5 <process_main+0xf5>
+        *vd++ = c;
+  2000a6:	48 89 c2             	mov    %rax,%rdx
+  2000a9:	48 83 c0 01          	add    $0x1,%rax
+  2000ad:	88 1a                	mov    %bl,(%rdx)
+    for (; n > 0; --n) {
+  2000af:	48 39 c1             	cmp    %rax,%rcx
+  2000b2:	75 f2                	jne    2000a6 <process_main+0xa6>
+  2000b4:	eb 3f                	jmp    2000f5 <process_main+0xf5>
+    volatile char* vd = (volatile char*) d;
+  2000b6:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+    const char* cs = (const char*) s;
+  2000ba:	48 8d 05 7f 6f 00 00 	lea    0x6f7f(%rip),%rax        # 207040 <src>
+    for (; n > 0; --n) {
+  2000c1:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  2000c6:	74 2d                	je     2000f5 <process_main+0xf5>
+        *vd++ = *cs++;
+  2000c8:	48 83 c0 01          	add    $0x1,%rax
+  2000cc:	48 89 d1             	mov    %rdx,%rcx
+  2000cf:	48 83 c2 01          	add    $0x1,%rdx
+  2000d3:	0f b6 70 ff          	movzbl -0x1(%rax),%esi
+  2000d7:	40 88 31             	mov    %sil,(%rcx)
+    for (; n > 0; --n) {
+  2000da:	4c 39 f8             	cmp    %r15,%rax
+  2000dd:	75 e9                	jne    2000c8 <process_main+0xc8>
+  2000df:	eb 14                	jmp    2000f5 <process_main+0xf5>
+        case 0: memcpy(d, src, n); break;
+  2000e1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  2000e5:	48 8d 35 54 6f 00 00 	lea    0x6f54(%rip),%rsi        # 207040 <src>
+  2000ec:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  2000f0:	e8 55 01 00 00       	call   20024a <memcpy>
+    for (int i = 0; i < ROUNDS; ++i) {
+  2000f5:	83 c3 01             	add    $0x1,%ebx
+  2000f8:	83 fb 40             	cmp    $0x40,%ebx
+  2000fb:	74 5f                	je     20015c <process_main+0x15c>
+        switch (op) {
+  2000fd:	41 83 fc 05          	cmp    $0x5,%r12d
+  200101:	77 f2                	ja     2000f5 <process_main+0xf5>
+  200103:	44 89 e0             	mov    %r12d,%eax
+  200106:	49 63 44 85 00       	movslq 0x0(%r13,%rax,4),%rax
+  20010b:	4c 01 e8             	add    %r13,%rax
+  20010e:	ff e0                	jmp    *%rax
+        case 2: memmove(d, d - misalign, n); break;
+  200110:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  200114:	4c 89 f6             	mov    %r14,%rsi
+  200117:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  20011b:	e8 50 02 00 00       	call   200370 <memmove>
+  200120:	eb d3                	jmp    2000f5 <process_main+0xf5>
+    volatile char* vd = (volatile char*) d + n;
+  200122:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200126:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  20012a:	48 8d 14 38          	lea    (%rax,%rdi,1),%rdx
+    const char* cs = (const char*) s + n;
+  20012e:	4a 8d 04 37          	lea    (%rdi,%r14,1),%rax
+    for (; n > 0; --n) {
+  200132:	48 85 ff             	test   %rdi,%rdi
+  200135:	74 be                	je     2000f5 <process_main+0xf5>
+        *--vd = *--cs;
+  200137:	48 83 e8 01          	sub    $0x1,%rax
+  20013b:	48 83 ea 01          	sub    $0x1,%rdx
+  20013f:	0f b6 08             	movzbl (%rax),%ecx
+  200142:	88 0a                	mov    %cl,(%rdx)
+    for (; n > 0; --n) {
+  200144:	4c 39 f0             	cmp    %r14,%rax
+  200147:	75 ee                	jne    200137 <process_main+0x137>
+  200149:	eb aa                	jmp    2000f5 <process_main+0xf5>
+        case 4: memset(d, i, n); break;
+  20014b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  20014f:	89 de                	mov    %ebx,%esi
+  200151:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  200155:	e8 07 03 00 00       	call   200461 <memset>
+  20015a:	eb 99                	jmp    2000f5 <process_main+0xf5>
+    }
+}
+
+static inline uint64_t read_cycle_counter(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+  20015c:	0f 31                	rdtsc
+    return ((uint64_t) hi << 32) | lo;
+  20015e:	48 c1 e2 20          	shl    $0x20,%rdx
+  200162:	89 c0                	mov    %eax,%eax
+  200164:	48 09 c2             	or     %rax,%rdx
+    return (read_cycle_counter() - start) / ROUNDS;
+  200167:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  20016b:	48 29 c2             	sub    %rax,%rdx
+  20016e:	48 c1 ea 06          	shr    $0x6,%rdx
+        size_t n = sizes[i];
+        app_printf(0, "%6u", (unsigned) n);
+        for (int op = 0; op < 6; ++op) {
+            // memmove overlaps source and destination by 8 bytes less 3
+            app_printf(0, " %9u", (unsigned) bench(op, n, op == 2 || op == 3 ? 5 : 0));
+  200172:	48 8d 35 e4 20 00 00 	lea    0x20e4(%rip),%rsi        # 20225d <malloc+0xce>
+  200179:	bf 00 00 00 00       	mov    $0x0,%edi
+  20017e:	b8 00 00 00 00       	mov    $0x0,%eax
+  200183:	e8 b8 1a 00 00       	call   201c40 <app_printf>
+        for (int op = 0; op < 6; ++op) {
+  200188:	41 83 c4 01          	add    $0x1,%r12d
+  20018c:	41 83 fc 06          	cmp    $0x6,%r12d
+  200190:	74 35                	je     2001c7 <process_main+0x1c7>
+            app_printf(0, " %9u", (unsigned) bench(op, n, op == 2 || op == 3 ? 5 : 0));
+  200192:	41 8d 44 24 fe       	lea    -0x2(%r12),%eax
+  200197:	83 f8 02             	cmp    $0x2,%eax
+  20019a:	48 19 c0             	sbb    %rax,%rax
+  20019d:	83 e0 05             	and    $0x5,%eax
+    char* d = dst + misalign;
+  2001a0:	4c 01 f0             	add    %r14,%rax
+  2001a3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+  2001a7:	0f 31                	rdtsc
+    return ((uint64_t) hi << 32) | lo;
+  2001a9:	48 c1 e2 20          	shl    $0x20,%rdx
+  2001ad:	89 c0                	mov    %eax,%eax
+  2001af:	48 09 c2             	or     %rax,%rdx
+  2001b2:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+    for (int i = 0; i < ROUNDS; ++i) {
+  2001b6:	bb 00 00 00 00       	mov    $0x0,%ebx
+        switch (op) {
+  2001bb:	4c 8d 2d be 20 00 00 	lea    0x20be(%rip),%r13        # 202280 <malloc+0xf1>
+  2001c2:	e9 36 ff ff ff       	jmp    2000fd <process_main+0xfd>
+        }
+        app_printf(0, "\n");
+  2001c7:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+  2001cb:	48 8d 35 62 23 00 00 	lea    0x2362(%rip),%rsi        # 202534 <lower_digits.0+0xf4>
+  2001d2:	bf 00 00 00 00       	mov    $0x0,%edi
+  2001d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  2001dc:	e8 5f 1a 00 00       	call   201c40 <app_printf>
+// sys_yield
+//    Yield control of the CPU to the kernel. The kernel will pick another
+//    process to run, if possible.
+static inline void sys_yield(void) {
+    uint64_t rax;
+    asm volatile ("syscall" : "=a" (rax)
+  2001e1:	b8 3c 00 00 00       	mov    $0x3c,%eax
+  2001e6:	0f 05                	syscall
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i) {
+  2001e8:	48 83 c3 08          	add    $0x8,%rbx
+  2001ec:	48 8d 05 dd 20 00 00 	lea    0x20dd(%rip),%rax        # 2022d0 <flag_chars>
+  2001f3:	48 39 d8             	cmp    %rbx,%rax
+  2001f6:	74 39                	je     200231 <process_main+0x231>
+        size_t n = sizes[i];
+  2001f8:	4c 8b 3b             	mov    (%rbx),%r15
+  2001fb:	4c 89 7d c0          	mov    %r15,-0x40(%rbp)
+        app_printf(0, "%6u", (unsigned) n);
+  2001ff:	44 89 fa             	mov    %r15d,%edx
+  200202:	48 8d 35 50 20 00 00 	lea    0x2050(%rip),%rsi        # 202259 <malloc+0xca>
+  200209:	bf 00 00 00 00       	mov    $0x0,%edi
+  20020e:	b8 00 00 00 00       	mov    $0x0,%eax
+  200213:	e8 28 1a 00 00       	call   201c40 <app_printf>
+        for (int op = 0; op < 6; ++op) {
+  200218:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  20021e:	48 8d 05 1b 6e 00 00 	lea    0x6e1b(%rip),%rax        # 207040 <src>
+  200225:	49 01 c7             	add    %rax,%r15
+  200228:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+  20022c:	e9 61 ff ff ff       	jmp    200192 <process_main+0x192>
+// sys_exit()
+//    Exit this process. Does not return.
+static inline void sys_exit(int exit_code) __attribute__((noreturn));
+static inline void sys_exit(int exit_code) {
+    uint64_t rax;
+    asm volatile ("syscall" : "=a" (rax)
+  200231:	b8 40 00 00 00       	mov    $0x40,%eax
+  200236:	bf 00 00 00 00       	mov    $0x0,%edi
+  20023b:	0f 05                	syscall
+                  : "a" (INT_SYS_EXIT), "D" /* %rdi */ (exit_code)
+                  : "rcx", "r11", "cc", "memory");
+ spinloop: goto spinloop;       // should never get here
+  20023d:	eb fe                	jmp    20023d <process_main+0x23d>
+
+000000000020023f <vdso>:
+// KERNEL DATA PAGE
+//
+//    The kernel keeps a read-only vdso_data (see lib.h) up to date at
+//    VDSO_ADDR. Reading it is a plain memory load, not a system call.
+
+static inline const volatile vdso_data* vdso(void) {
+  20023f:	55                   	push   %rbp
+  200240:	48 89 e5             	mov    %rsp,%rbp
+    return (const volatile vdso_data*) VDSO_ADDR;
+  200243:	b8 00 10 24 00       	mov    $0x241000,%eax
+}
+  200248:	5d                   	pop    %rbp
+  200249:	c3                   	ret
+
+000000000020024a <memcpy>:
+#define MEMOP_WORD_MIN 64
+
+// an unaligned word that may alias any object
+typedef uint64_t __attribute__((may_alias, aligned(1))) memop_word;
+
+void* memcpy(void* dst, const void* src, size_t n) {
+  20024a:	55                   	push   %rbp
+  20024b:	48 89 e5             	mov    %rsp,%rbp
+  20024e:	48 83 ec 48          	sub    $0x48,%rsp
+  200252:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  200256:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  20025a:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+    char* d = (char*) dst;
+  20025e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200262:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    const char* s = (const char*) src;
+  200266:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  20026a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (n >= MEMOP_WORD_MIN) {
+  20026e:	48 83 7d b8 3f       	cmpq   $0x3f,-0x48(%rbp)
+  200273:	0f 86 c5 00 00 00    	jbe    20033e <memcpy+0xf4>
+        size_t head = -(uintptr_t) d & 7;
+  200279:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20027d:	48 f7 d8             	neg    %rax
+  200280:	83 e0 07             	and    $0x7,%eax
+  200283:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        size_t words = (n - head) / 8;
+  200287:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  20028b:	48 2b 45 e8          	sub    -0x18(%rbp),%rax
+  20028f:	48 c1 e8 03          	shr    $0x3,%rax
+  200293:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+        n = (n - head) % 8;
+  200297:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  20029b:	48 2b 45 e8          	sub    -0x18(%rbp),%rax
+  20029f:	83 e0 07             	and    $0x7,%eax
+  2002a2:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        asm volatile("rep movsb" : "+D" (d), "+S" (s), "+c" (head)
+  2002a6:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  2002aa:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  2002ae:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2002b2:	48 89 cf             	mov    %rcx,%rdi
+  2002b5:	48 89 d6             	mov    %rdx,%rsi
+  2002b8:	48 89 c1             	mov    %rax,%rcx
+  2002bb:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  2002bd:	48 89 c8             	mov    %rcx,%rax
+  2002c0:	48 89 f2             	mov    %rsi,%rdx
+  2002c3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  2002c7:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  2002cb:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                     : : "memory");
+        asm volatile("rep movsq" : "+D" (d), "+S" (s), "+c" (words)
+  2002cf:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  2002d3:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  2002d7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  2002db:	48 89 cf             	mov    %rcx,%rdi
+  2002de:	48 89 d6             	mov    %rdx,%rsi
+  2002e1:	48 89 c1             	mov    %rax,%rcx
+  2002e4:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  2002e7:	48 89 c8             	mov    %rcx,%rax
+  2002ea:	48 89 f2             	mov    %rsi,%rdx
+  2002ed:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  2002f1:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  2002f5:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+                     : : "memory");
+    }
+    for (; n >= 16; n -= 16, s += 16, d += 16) {
+  2002f9:	eb 43                	jmp    20033e <memcpy+0xf4>
+        memop_word a = ((const memop_word*) s)[0];
+  2002fb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2002ff:	48 8b 00             	mov    (%rax),%rax
+  200302:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+        memop_word b = ((const memop_word*) s)[1];
+  200306:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  20030a:	48 83 c0 08          	add    $0x8,%rax
+  20030e:	48 8b 00             	mov    (%rax),%rax
+  200311:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+        ((memop_word*) d)[0] = a;
+  200315:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200319:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  20031d:	48 89 10             	mov    %rdx,(%rax)
+        ((memop_word*) d)[1] = b;
+  200320:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200324:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  200328:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  20032c:	48 89 02             	mov    %rax,(%rdx)
+    for (; n >= 16; n -= 16, s += 16, d += 16) {
+  20032f:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  200334:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  200339:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  20033e:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  200343:	77 b6                	ja     2002fb <memcpy+0xb1>
+    }
+    for (; n > 0; --n, ++s, ++d) {
+  200345:	eb 1c                	jmp    200363 <memcpy+0x119>
+        *d = *s;
+  200347:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  20034b:	0f b6 10             	movzbl (%rax),%edx
+  20034e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200352:	88 10                	mov    %dl,(%rax)
+    for (; n > 0; --n, ++s, ++d) {
+  200354:	48 83 6d b8 01       	subq   $0x1,-0x48(%rbp)
+  200359:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  20035e:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  200363:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  200368:	75 dd                	jne    200347 <memcpy+0xfd>
+    }
+    return dst;
+  20036a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  20036e:	c9                   	leave
+  20036f:	c3                   	ret
+
+0000000000200370 <memmove>:
+
+void* memmove(void* dst, const void* src, size_t n) {
+  200370:	55                   	push   %rbp
+  200371:	48 89 e5             	mov    %rsp,%rbp
+  200374:	48 83 ec 38          	sub    $0x38,%rsp
+  200378:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  20037c:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  200380:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    const char* s = (const char*) src;
+  200384:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  200388:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    char* d = (char*) dst;
+  20038c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  200390:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (!(s < d && s + n > d)) {
+  200394:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200398:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  20039c:	73 11                	jae    2003af <memmove+0x3f>
+  20039e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  2003a2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  2003a6:	48 01 d0             	add    %rdx,%rax
+  2003a9:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  2003ad:	72 1c                	jb     2003cb <memmove+0x5b>
+        // a forward copy never overwrites source bytes it has yet to read
+        return memcpy(dst, src, n);
+  2003af:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  2003b3:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  2003b7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  2003bb:	48 89 ce             	mov    %rcx,%rsi
+  2003be:	48 89 c7             	mov    %rax,%rdi
+  2003c1:	e8 84 fe ff ff       	call   20024a <memcpy>
+  2003c6:	e9 94 00 00 00       	jmp    20045f <memmove+0xef>
+    }
+
+    // copy backwards: the tail bytes, then words down to the start
+    size_t words = n / 8;
+  2003cb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  2003cf:	48 c1 e8 03          	shr    $0x3,%rax
+  2003d3:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    size_t tail = n % 8;
+  2003d7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  2003db:	83 e0 07             	and    $0x7,%eax
+  2003de:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    s += n - 1, d += n - 1;
+  2003e2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  2003e6:	48 83 e8 01          	sub    $0x1,%rax
+  2003ea:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  2003ee:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  2003f2:	48 83 e8 01          	sub    $0x1,%rax
+  2003f6:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    asm volatile("std; rep movsb; cld" : "+D" (d), "+S" (s), "+c" (tail)
+  2003fa:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  2003fe:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  200402:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  200406:	48 89 cf             	mov    %rcx,%rdi
+  200409:	48 89 d6             	mov    %rdx,%rsi
+  20040c:	48 89 c1             	mov    %rax,%rcx
+  20040f:	fd                   	std
+  200410:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  200412:	fc                   	cld
+  200413:	48 89 c8             	mov    %rcx,%rax
+  200416:	48 89 f2             	mov    %rsi,%rdx
+  200419:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  20041d:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  200421:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+                 : : "memory", "cc");
+    s -= 7, d -= 7;
+  200425:	48 83 6d f8 07       	subq   $0x7,-0x8(%rbp)
+  20042a:	48 83 6d f0 07       	subq   $0x7,-0x10(%rbp)
+    asm volatile("std; rep movsq; cld" : "+D" (d), "+S" (s), "+c" (words)
+  20042f:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  200433:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  200437:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20043b:	48 89 cf             	mov    %rcx,%rdi
+  20043e:	48 89 d6             	mov    %rdx,%rsi
+  200441:	48 89 c1             	mov    %rax,%rcx
+  200444:	fd                   	std
+  200445:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  200448:	fc                   	cld
+  200449:	48 89 c8             	mov    %rcx,%rax
+  20044c:	48 89 f2             	mov    %rsi,%rdx
+  20044f:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  200453:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  200457:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 : : "memory", "cc");
+    return dst;
+  20045b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  20045f:	c9                   	leave
+  200460:	c3                   	ret
+
+0000000000200461 <memset>:
+
+void* memset(void* v, int c, size_t n) {
+  200461:	55                   	push   %rbp
+  200462:	48 89 e5             	mov    %rsp,%rbp
+  200465:	48 83 ec 38          	sub    $0x38,%rsp
+  200469:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  20046d:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  200470:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    char* p = (char*) v;
+  200474:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  200478:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    uint64_t word = (uint8_t) c * 0x0101010101010101UL;
+  20047c:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  20047f:	0f b6 c0             	movzbl %al,%eax
+  200482:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  200489:	01 01 01 
+  20048c:	48 0f af c2          	imul   %rdx,%rax
+  200490:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (n >= MEMOP_WORD_MIN) {
+  200494:	48 83 7d c8 3f       	cmpq   $0x3f,-0x38(%rbp)
+  200499:	0f 86 9e 00 00 00    	jbe    20053d <memset+0xdc>
+        size_t head = -(uintptr_t) p & 7;
+  20049f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2004a3:	48 f7 d8             	neg    %rax
+  2004a6:	83 e0 07             	and    $0x7,%eax
+  2004a9:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        size_t words = (n - head) / 8;
+  2004ad:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  2004b1:	48 2b 45 e8          	sub    -0x18(%rbp),%rax
+  2004b5:	48 c1 e8 03          	shr    $0x3,%rax
+  2004b9:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+        n = (n - head) % 8;
+  2004bd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  2004c1:	48 2b 45 e8          	sub    -0x18(%rbp),%rax
+  2004c5:	83 e0 07             	and    $0x7,%eax
+  2004c8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        asm volatile("rep stosb" : "+D" (p), "+c" (head) : "a" (word)
+  2004cc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2004d0:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  2004d4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  2004d8:	48 89 ce             	mov    %rcx,%rsi
+  2004db:	48 89 f7             	mov    %rsi,%rdi
+  2004de:	48 89 d1             	mov    %rdx,%rcx
+  2004e1:	f3 aa                	rep stos %al,%es:(%rdi)
+  2004e3:	48 89 ca             	mov    %rcx,%rdx
+  2004e6:	48 89 fe             	mov    %rdi,%rsi
+  2004e9:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  2004ed:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+                     : "memory");
+        asm volatile("rep stosq" : "+D" (p), "+c" (words) : "a" (word)
+  2004f1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2004f5:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  2004f9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  2004fd:	48 89 ce             	mov    %rcx,%rsi
+  200500:	48 89 f7             	mov    %rsi,%rdi
+  200503:	48 89 d1             	mov    %rdx,%rcx
+  200506:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  200509:	48 89 ca             	mov    %rcx,%rdx
+  20050c:	48 89 fe             	mov    %rdi,%rsi
+  20050f:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  200513:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+                     : "memory");
+    }
+    for (; n >= 16; n -= 16, p += 16) {
+  200517:	eb 24                	jmp    20053d <memset+0xdc>
+        ((memop_word*) p)[0] = word;
+  200519:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20051d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  200521:	48 89 10             	mov    %rdx,(%rax)
+        ((memop_word*) p)[1] = word;
+  200524:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200528:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  20052c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  200530:	48 89 02             	mov    %rax,(%rdx)
+    for (; n >= 16; n -= 16, p += 16) {
+  200533:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  200538:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  20053d:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  200542:	77 d5                	ja     200519 <memset+0xb8>
+    }
+    for (; n > 0; ++p, --n) {
+  200544:	eb 15                	jmp    20055b <memset+0xfa>
+        *p = c;
+  200546:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  200549:	89 c2                	mov    %eax,%edx
+  20054b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20054f:	88 10                	mov    %dl,(%rax)
+    for (; n > 0; ++p, --n) {
+  200551:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  200556:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  20055b:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  200560:	75 e4                	jne    200546 <memset+0xe5>
+    }
+    return v;
+  200562:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  200566:	c9                   	leave
+  200567:	c3                   	ret
+
+0000000000200568 <strlen>:
+
+size_t strlen(const char* s) {
+  200568:	55                   	push   %rbp
+  200569:	48 89 e5             	mov    %rsp,%rbp
+  20056c:	48 83 ec 18          	sub    $0x18,%rsp
+  200570:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    size_t n;
+    for (n = 0; *s != '\0'; ++s) {
+  200574:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  20057b:	00 
+  20057c:	eb 0a                	jmp    200588 <strlen+0x20>
+        ++n;
+  20057e:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    for (n = 0; *s != '\0'; ++s) {
+  200583:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  200588:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20058c:	0f b6 00             	movzbl (%rax),%eax
+  20058f:	84 c0                	test   %al,%al
+  200591:	75 eb                	jne    20057e <strlen+0x16>
+    }
+    return n;
+  200593:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  200597:	c9                   	leave
+  200598:	c3                   	ret
+
+0000000000200599 <strnlen>:
+
+size_t strnlen(const char* s, size_t maxlen) {
+  200599:	55                   	push   %rbp
+  20059a:	48 89 e5             	mov    %rsp,%rbp
+  20059d:	48 83 ec 20          	sub    $0x20,%rsp
+  2005a1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  2005a5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    size_t n;
+    for (n = 0; n != maxlen && *s != '\0'; ++s) {
+  2005a9:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  2005b0:	00 
+  2005b1:	eb 0a                	jmp    2005bd <strnlen+0x24>
+        ++n;
+  2005b3:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    for (n = 0; n != maxlen && *s != '\0'; ++s) {
+  2005b8:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  2005bd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2005c1:	48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+  2005c5:	74 0b                	je     2005d2 <strnlen+0x39>
+  2005c7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2005cb:	0f b6 00             	movzbl (%rax),%eax
+  2005ce:	84 c0                	test   %al,%al
+  2005d0:	75 e1                	jne    2005b3 <strnlen+0x1a>
+    }
+    return n;
+  2005d2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  2005d6:	c9                   	leave
+  2005d7:	c3                   	ret
+
+00000000002005d8 <strcpy>:
+
+char* strcpy(char* dst, const char* src) {
+  2005d8:	55                   	push   %rbp
+  2005d9:	48 89 e5             	mov    %rsp,%rbp
+  2005dc:	48 83 ec 20          	sub    $0x20,%rsp
+  2005e0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  2005e4:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    char* d = dst;
+  2005e8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2005ec:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    do {
+        *d++ = *src++;
+  2005f0:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  2005f4:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  2005f8:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  2005fc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200600:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  200604:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+  200608:	0f b6 12             	movzbl (%rdx),%edx
+  20060b:	88 10                	mov    %dl,(%rax)
+    } while (d[-1]);
+  20060d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200611:	48 83 e8 01          	sub    $0x1,%rax
+  200615:	0f b6 00             	movzbl (%rax),%eax
+  200618:	84 c0                	test   %al,%al
+  20061a:	75 d4                	jne    2005f0 <strcpy+0x18>
+    return dst;
+  20061c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  200620:	c9                   	leave
+  200621:	c3                   	ret
+
+0000000000200622 <strcmp>:
+
+int strcmp(const char* a, const char* b) {
+  200622:	55                   	push   %rbp
+  200623:	48 89 e5             	mov    %rsp,%rbp
+  200626:	48 83 ec 10          	sub    $0x10,%rsp
+  20062a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  20062e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    while (*a && *b && *a == *b) {
+  200632:	eb 0a                	jmp    20063e <strcmp+0x1c>
+        ++a, ++b;
+  200634:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  200639:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+    while (*a && *b && *a == *b) {
+  20063e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200642:	0f b6 00             	movzbl (%rax),%eax
+  200645:	84 c0                	test   %al,%al
+  200647:	74 1d                	je     200666 <strcmp+0x44>
+  200649:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  20064d:	0f b6 00             	movzbl (%rax),%eax
+  200650:	84 c0                	test   %al,%al
+  200652:	74 12                	je     200666 <strcmp+0x44>
+  200654:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200658:	0f b6 10             	movzbl (%rax),%edx
+  20065b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  20065f:	0f b6 00             	movzbl (%rax),%eax
+  200662:	38 c2                	cmp    %al,%dl
+  200664:	74 ce                	je     200634 <strcmp+0x12>
+    }
+    return ((unsigned char) *a > (unsigned char) *b)
+  200666:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20066a:	0f b6 00             	movzbl (%rax),%eax
+  20066d:	89 c2                	mov    %eax,%edx
+  20066f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  200673:	0f b6 00             	movzbl (%rax),%eax
+  200676:	38 d0                	cmp    %dl,%al
+  200678:	0f 92 c0             	setb   %al
+  20067b:	0f b6 d0             	movzbl %al,%edx
+        - ((unsigned char) *a < (unsigned char) *b);
+  20067e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200682:	0f b6 00             	movzbl (%rax),%eax
+  200685:	89 c1                	mov    %eax,%ecx
+  200687:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  20068b:	0f b6 00             	movzbl (%rax),%eax
+  20068e:	38 c1                	cmp    %al,%cl
+  200690:	0f 92 c0             	setb   %al
+  200693:	0f b6 c0             	movzbl %al,%eax
+  200696:	29 c2                	sub    %eax,%edx
+  200698:	89 d0                	mov    %edx,%eax
+}
+  20069a:	c9                   	leave
+  20069b:	c3                   	ret
+
+000000000020069c <strchr>:
+
+char* strchr(const char* s, int c) {
+  20069c:	55                   	push   %rbp
+  20069d:	48 89 e5             	mov    %rsp,%rbp
+  2006a0:	48 83 ec 10          	sub    $0x10,%rsp
+  2006a4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  2006a8:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    while (*s && *s != (char) c) {
+  2006ab:	eb 05                	jmp    2006b2 <strchr+0x16>
+        ++s;
+  2006ad:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    while (*s && *s != (char) c) {
+  2006b2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2006b6:	0f b6 00             	movzbl (%rax),%eax
+  2006b9:	84 c0                	test   %al,%al
+  2006bb:	74 0e                	je     2006cb <strchr+0x2f>
+  2006bd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2006c1:	0f b6 00             	movzbl (%rax),%eax
+  2006c4:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  2006c7:	38 d0                	cmp    %dl,%al
+  2006c9:	75 e2                	jne    2006ad <strchr+0x11>
+    }
+    if (*s == (char) c) {
+  2006cb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2006cf:	0f b6 00             	movzbl (%rax),%eax
+  2006d2:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  2006d5:	38 d0                	cmp    %dl,%al
+  2006d7:	75 06                	jne    2006df <strchr+0x43>
+        return (char*) s;
+  2006d9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2006dd:	eb 05                	jmp    2006e4 <strchr+0x48>
+    } else {
+        return NULL;
+  2006df:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+}
+  2006e4:	c9                   	leave
+  2006e5:	c3                   	ret
+
+00000000002006e6 <rand>:
+
+// New randomness implementation
+static int      rand_seed_set;
+static unsigned rand_seed;
+
+int rand(void) {
+  2006e6:	55                   	push   %rbp
+  2006e7:	48 89 e5             	mov    %rsp,%rbp
+  2006ea:	48 83 ec 10          	sub    $0x10,%rsp
+    if (!rand_seed_set) {
+  2006ee:	8b 05 5c a9 00 00    	mov    0xa95c(%rip),%eax        # 20b050 <rand_seed_set>
+  2006f4:	85 c0                	test   %eax,%eax
+  2006f6:	75 2c                	jne    200724 <rand+0x3e>
+#if WEENSYOS_KERNEL
+        extern unsigned get_entropy_value(void);
+        srand(get_entropy_value());
+#else           // user‑space build
+       /* kernel-refreshed seed from the kernel data page: no system call */
+       srand((unsigned) (vdso()->seed[0] ^ read_cycle_counter()));
+  2006f8:	e8 42 fb ff ff       	call   20023f <vdso>
+  2006fd:	48 8b 40 18          	mov    0x18(%rax),%rax
+  200701:	89 c1                	mov    %eax,%ecx
+    asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+  200703:	0f 31                	rdtsc
+  200705:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  200708:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    return ((uint64_t) hi << 32) | lo;
+  20070b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  20070e:	48 c1 e0 20          	shl    $0x20,%rax
+  200712:	48 89 c2             	mov    %rax,%rdx
+  200715:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  200718:	48 09 d0             	or     %rdx,%rax
+  20071b:	31 c8                	xor    %ecx,%eax
+  20071d:	89 c7                	mov    %eax,%edi
+  20071f:	e8 24 00 00 00       	call   200748 <srand>
+#endif
+    }
+    rand_seed = rand_seed * 1664525U + 1013904223U;   // LCG
+  200724:	8b 05 2a a9 00 00    	mov    0xa92a(%rip),%eax        # 20b054 <rand_seed>
+  20072a:	69 c0 0d 66 19 00    	imul   $0x19660d,%eax,%eax
+  200730:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+  200735:	89 05 19 a9 00 00    	mov    %eax,0xa919(%rip)        # 20b054 <rand_seed>
+    return rand_seed & RAND_MAX;
+  20073b:	8b 05 13 a9 00 00    	mov    0xa913(%rip),%eax        # 20b054 <rand_seed>
+  200741:	25 ff ff ff 7f       	and    $0x7fffffff,%eax
+}
+  200746:	c9                   	leave
+  200747:	c3                   	ret
+
+0000000000200748 <srand>:
+
+void srand(unsigned seed) {
+  200748:	55                   	push   %rbp
+  200749:	48 89 e5             	mov    %rsp,%rbp
+  20074c:	48 83 ec 08          	sub    $0x8,%rsp
+  200750:	89 7d fc             	mov    %edi,-0x4(%rbp)
+    rand_seed      = seed;
+  200753:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  200756:	89 05 f8 a8 00 00    	mov    %eax,0xa8f8(%rip)        # 20b054 <rand_seed>
+    rand_seed_set  = 1;
+  20075c:	c7 05 ea a8 00 00 01 	movl   $0x1,0xa8ea(%rip)        # 20b050 <rand_seed_set>
+  200763:	00 00 00 
+}
+  200766:	90                   	nop
+  200767:	c9                   	leave
+  200768:	c3                   	ret
+
+0000000000200769 <fill_numbuf>:
+//    Print a message onto the console, starting at the given cursor position.
+
+// snprintf, vsnprintf
+//    Format a string into a buffer.
+
+static char* fill_numbuf(char* numbuf_end, unsigned long val, int base) {
+  200769:	55                   	push   %rbp
+  20076a:	48 89 e5             	mov    %rsp,%rbp
+  20076d:	48 83 ec 28          	sub    $0x28,%rsp
+  200771:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  200775:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  200779:	89 55 dc             	mov    %edx,-0x24(%rbp)
+    static const char upper_digits[] = "0123456789ABCDEF";
+    static const char lower_digits[] = "0123456789abcdef";
+
+    const char* digits = upper_digits;
+  20077c:	48 8d 05 9d 1c 00 00 	lea    0x1c9d(%rip),%rax        # 202420 <upper_digits.1>
+  200783:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (base < 0) {
+  200787:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  20078b:	79 0e                	jns    20079b <fill_numbuf+0x32>
+        digits = lower_digits;
+  20078d:	48 8d 05 ac 1c 00 00 	lea    0x1cac(%rip),%rax        # 202440 <lower_digits.0>
+  200794:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+        base = -base;
+  200798:	f7 5d dc             	negl   -0x24(%rbp)
+    }
+
+    *--numbuf_end = '\0';
+  20079b:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  2007a0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2007a4:	c6 00 00             	movb   $0x0,(%rax)
+    do {
+        *--numbuf_end = digits[val % base];
+  2007a7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  2007aa:	48 63 c8             	movslq %eax,%rcx
+  2007ad:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  2007b1:	ba 00 00 00 00       	mov    $0x0,%edx
+  2007b6:	48 f7 f1             	div    %rcx
+  2007b9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2007bd:	48 01 d0             	add    %rdx,%rax
+  2007c0:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  2007c5:	0f b6 10             	movzbl (%rax),%edx
+  2007c8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2007cc:	88 10                	mov    %dl,(%rax)
+        val /= base;
+  2007ce:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  2007d1:	48 63 f0             	movslq %eax,%rsi
+  2007d4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  2007d8:	ba 00 00 00 00       	mov    $0x0,%edx
+  2007dd:	48 f7 f6             	div    %rsi
+  2007e0:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    } while (val != 0);
+  2007e4:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  2007e9:	75 bc                	jne    2007a7 <fill_numbuf+0x3e>
+    return numbuf_end;
+  2007eb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  2007ef:	c9                   	leave
+  2007f0:	c3                   	ret
+
+00000000002007f1 <printer_vprintf>:
+#define FLAG_NUMERIC            (1<<5)
+#define FLAG_SIGNED             (1<<6)
+#define FLAG_NEGATIVE           (1<<7)
+#define FLAG_ALT2               (1<<8)
+
+void printer_vprintf(printer* p, int color, const char* format, va_list val) {
+  2007f1:	55                   	push   %rbp
+  2007f2:	48 89 e5             	mov    %rsp,%rbp
+  2007f5:	53                   	push   %rbx
+  2007f6:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  2007fd:	48 89 bd 78 ff ff ff 	mov    %rdi,-0x88(%rbp)
+  200804:	89 b5 74 ff ff ff    	mov    %esi,-0x8c(%rbp)
+  20080a:	48 89 95 68 ff ff ff 	mov    %rdx,-0x98(%rbp)
+  200811:	48 89 8d 60 ff ff ff 	mov    %rcx,-0xa0(%rbp)
+#define NUMBUFSIZ 24
+    char numbuf[NUMBUFSIZ];
+
+    for (; *format; ++format) {
+  200818:	e9 be 09 00 00       	jmp    2011db <printer_vprintf+0x9ea>
+        if (*format != '%') {
+  20081d:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200824:	0f b6 00             	movzbl (%rax),%eax
+  200827:	3c 25                	cmp    $0x25,%al
+  200829:	74 31                	je     20085c <printer_vprintf+0x6b>
+            p->putc(p, *format, color);
+  20082b:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200832:	4c 8b 00             	mov    (%rax),%r8
+  200835:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  20083c:	0f b6 00             	movzbl (%rax),%eax
+  20083f:	0f b6 c8             	movzbl %al,%ecx
+  200842:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  200848:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  20084f:	89 ce                	mov    %ecx,%esi
+  200851:	48 89 c7             	mov    %rax,%rdi
+  200854:	41 ff d0             	call   *%r8
+            continue;
+  200857:	e9 77 09 00 00       	jmp    2011d3 <printer_vprintf+0x9e2>
+        }
+
+        // process flags
+        int flags = 0;
+  20085c:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+        for (++format; *format; ++format) {
+  200863:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  20086a:	01 
+  20086b:	eb 4f                	jmp    2008bc <printer_vprintf+0xcb>
+            const char* flagc = strchr(flag_chars, *format);
+  20086d:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200874:	0f b6 00             	movzbl (%rax),%eax
+  200877:	0f be c0             	movsbl %al,%eax
+  20087a:	89 c6                	mov    %eax,%esi
+  20087c:	48 8d 05 4d 1a 00 00 	lea    0x1a4d(%rip),%rax        # 2022d0 <flag_chars>
+  200883:	48 89 c7             	mov    %rax,%rdi
+  200886:	e8 11 fe ff ff       	call   20069c <strchr>
+  20088b:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (flagc) {
+  20088f:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  200894:	74 36                	je     2008cc <printer_vprintf+0xdb>
+                flags |= 1 << (flagc - flag_chars);
+  200896:	48 8d 05 33 1a 00 00 	lea    0x1a33(%rip),%rax        # 2022d0 <flag_chars>
+  20089d:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  2008a1:	48 29 c2             	sub    %rax,%rdx
+  2008a4:	89 d0                	mov    %edx,%eax
+  2008a6:	ba 01 00 00 00       	mov    $0x1,%edx
+  2008ab:	89 c1                	mov    %eax,%ecx
+  2008ad:	d3 e2                	shl    %cl,%edx
+  2008af:	89 d0                	mov    %edx,%eax
+  2008b1:	09 45 ec             	or     %eax,-0x14(%rbp)
+        for (++format; *format; ++format) {
+  2008b4:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  2008bb:	01 
+  2008bc:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  2008c3:	0f b6 00             	movzbl (%rax),%eax
+  2008c6:	84 c0                	test   %al,%al
+  2008c8:	75 a3                	jne    20086d <printer_vprintf+0x7c>
+  2008ca:	eb 01                	jmp    2008cd <printer_vprintf+0xdc>
+            } else {
+                break;
+  2008cc:	90                   	nop
+            }
+        }
+
+        // process width
+        int width = -1;
+  2008cd:	c7 45 e8 ff ff ff ff 	movl   $0xffffffff,-0x18(%rbp)
+        if (*format >= '1' && *format <= '9') {
+  2008d4:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  2008db:	0f b6 00             	movzbl (%rax),%eax
+  2008de:	3c 30                	cmp    $0x30,%al
+  2008e0:	7e 67                	jle    200949 <printer_vprintf+0x158>
+  2008e2:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  2008e9:	0f b6 00             	movzbl (%rax),%eax
+  2008ec:	3c 39                	cmp    $0x39,%al
+  2008ee:	7f 59                	jg     200949 <printer_vprintf+0x158>
+            for (width = 0; *format >= '0' && *format <= '9'; ) {
+  2008f0:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%rbp)
+  2008f7:	eb 2e                	jmp    200927 <printer_vprintf+0x136>
+                width = 10 * width + *format++ - '0';
+  2008f9:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  2008fc:	89 d0                	mov    %edx,%eax
+  2008fe:	c1 e0 02             	shl    $0x2,%eax
+  200901:	01 d0                	add    %edx,%eax
+  200903:	01 c0                	add    %eax,%eax
+  200905:	89 c1                	mov    %eax,%ecx
+  200907:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  20090e:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  200912:	48 89 95 68 ff ff ff 	mov    %rdx,-0x98(%rbp)
+  200919:	0f b6 00             	movzbl (%rax),%eax
+  20091c:	0f be c0             	movsbl %al,%eax
+  20091f:	01 c8                	add    %ecx,%eax
+  200921:	83 e8 30             	sub    $0x30,%eax
+  200924:	89 45 e8             	mov    %eax,-0x18(%rbp)
+            for (width = 0; *format >= '0' && *format <= '9'; ) {
+  200927:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  20092e:	0f b6 00             	movzbl (%rax),%eax
+  200931:	3c 2f                	cmp    $0x2f,%al
+  200933:	0f 8e 85 00 00 00    	jle    2009be <printer_vprintf+0x1cd>
+  200939:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200940:	0f b6 00             	movzbl (%rax),%eax
+  200943:	3c 39                	cmp    $0x39,%al
+  200945:	7e b2                	jle    2008f9 <printer_vprintf+0x108>
+        if (*format >= '1' && *format <= '9') {
+  200947:	eb 75                	jmp    2009be <printer_vprintf+0x1cd>
+            }
+        } else if (*format == '*') {
+  200949:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200950:	0f b6 00             	movzbl (%rax),%eax
+  200953:	3c 2a                	cmp    $0x2a,%al
+  200955:	75 68                	jne    2009bf <printer_vprintf+0x1ce>
+            width = va_arg(val, int);
+  200957:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  20095e:	8b 00                	mov    (%rax),%eax
+  200960:	83 f8 2f             	cmp    $0x2f,%eax
+  200963:	77 30                	ja     200995 <printer_vprintf+0x1a4>
+  200965:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  20096c:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200970:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200977:	8b 00                	mov    (%rax),%eax
+  200979:	89 c0                	mov    %eax,%eax
+  20097b:	48 01 d0             	add    %rdx,%rax
+  20097e:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200985:	8b 12                	mov    (%rdx),%edx
+  200987:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  20098a:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200991:	89 0a                	mov    %ecx,(%rdx)
+  200993:	eb 1a                	jmp    2009af <printer_vprintf+0x1be>
+  200995:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  20099c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  2009a0:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  2009a4:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  2009ab:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  2009af:	8b 00                	mov    (%rax),%eax
+  2009b1:	89 45 e8             	mov    %eax,-0x18(%rbp)
+            ++format;
+  2009b4:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  2009bb:	01 
+  2009bc:	eb 01                	jmp    2009bf <printer_vprintf+0x1ce>
+        if (*format >= '1' && *format <= '9') {
+  2009be:	90                   	nop
+        }
+
+        // process precision
+        int precision = -1;
+  2009bf:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%rbp)
+        if (*format == '.') {
+  2009c6:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  2009cd:	0f b6 00             	movzbl (%rax),%eax
+  2009d0:	3c 2e                	cmp    $0x2e,%al
+  2009d2:	0f 85 00 01 00 00    	jne    200ad8 <printer_vprintf+0x2e7>
+            ++format;
+  2009d8:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  2009df:	01 
+            if (*format >= '0' && *format <= '9') {
+  2009e0:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  2009e7:	0f b6 00             	movzbl (%rax),%eax
+  2009ea:	3c 2f                	cmp    $0x2f,%al
+  2009ec:	7e 67                	jle    200a55 <printer_vprintf+0x264>
+  2009ee:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  2009f5:	0f b6 00             	movzbl (%rax),%eax
+  2009f8:	3c 39                	cmp    $0x39,%al
+  2009fa:	7f 59                	jg     200a55 <printer_vprintf+0x264>
+                for (precision = 0; *format >= '0' && *format <= '9'; ) {
+  2009fc:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%rbp)
+  200a03:	eb 2e                	jmp    200a33 <printer_vprintf+0x242>
+                    precision = 10 * precision + *format++ - '0';
+  200a05:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  200a08:	89 d0                	mov    %edx,%eax
+  200a0a:	c1 e0 02             	shl    $0x2,%eax
+  200a0d:	01 d0                	add    %edx,%eax
+  200a0f:	01 c0                	add    %eax,%eax
+  200a11:	89 c1                	mov    %eax,%ecx
+  200a13:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200a1a:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  200a1e:	48 89 95 68 ff ff ff 	mov    %rdx,-0x98(%rbp)
+  200a25:	0f b6 00             	movzbl (%rax),%eax
+  200a28:	0f be c0             	movsbl %al,%eax
+  200a2b:	01 c8                	add    %ecx,%eax
+  200a2d:	83 e8 30             	sub    $0x30,%eax
+  200a30:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+                for (precision = 0; *format >= '0' && *format <= '9'; ) {
+  200a33:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200a3a:	0f b6 00             	movzbl (%rax),%eax
+  200a3d:	3c 2f                	cmp    $0x2f,%al
+  200a3f:	0f 8e 85 00 00 00    	jle    200aca <printer_vprintf+0x2d9>
+  200a45:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200a4c:	0f b6 00             	movzbl (%rax),%eax
+  200a4f:	3c 39                	cmp    $0x39,%al
+  200a51:	7e b2                	jle    200a05 <printer_vprintf+0x214>
+            if (*format >= '0' && *format <= '9') {
+  200a53:	eb 75                	jmp    200aca <printer_vprintf+0x2d9>
+                }
+            } else if (*format == '*') {
+  200a55:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200a5c:	0f b6 00             	movzbl (%rax),%eax
+  200a5f:	3c 2a                	cmp    $0x2a,%al
+  200a61:	75 68                	jne    200acb <printer_vprintf+0x2da>
+                precision = va_arg(val, int);
+  200a63:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200a6a:	8b 00                	mov    (%rax),%eax
+  200a6c:	83 f8 2f             	cmp    $0x2f,%eax
+  200a6f:	77 30                	ja     200aa1 <printer_vprintf+0x2b0>
+  200a71:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200a78:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200a7c:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200a83:	8b 00                	mov    (%rax),%eax
+  200a85:	89 c0                	mov    %eax,%eax
+  200a87:	48 01 d0             	add    %rdx,%rax
+  200a8a:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200a91:	8b 12                	mov    (%rdx),%edx
+  200a93:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200a96:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200a9d:	89 0a                	mov    %ecx,(%rdx)
+  200a9f:	eb 1a                	jmp    200abb <printer_vprintf+0x2ca>
+  200aa1:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200aa8:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200aac:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200ab0:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200ab7:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200abb:	8b 00                	mov    (%rax),%eax
+  200abd:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+                ++format;
+  200ac0:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  200ac7:	01 
+  200ac8:	eb 01                	jmp    200acb <printer_vprintf+0x2da>
+            if (*format >= '0' && *format <= '9') {
+  200aca:	90                   	nop
+            }
+            if (precision < 0) {
+  200acb:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  200acf:	79 07                	jns    200ad8 <printer_vprintf+0x2e7>
+                precision = 0;
+  200ad1:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%rbp)
+            }
+        }
+
+        // process main conversion character
+        int base = 10;
+  200ad8:	c7 45 e0 0a 00 00 00 	movl   $0xa,-0x20(%rbp)
+        unsigned long num = 0;
+  200adf:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  200ae6:	00 
+        int length = 0;
+  200ae7:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+        char* data = "";
+  200aee:	48 8d 05 e1 17 00 00 	lea    0x17e1(%rip),%rax        # 2022d6 <flag_chars+0x6>
+  200af5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    again:
+        switch (*format) {
+  200af9:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200b00:	0f b6 00             	movzbl (%rax),%eax
+  200b03:	0f be c0             	movsbl %al,%eax
+  200b06:	83 e8 43             	sub    $0x43,%eax
+  200b09:	83 f8 37             	cmp    $0x37,%eax
+  200b0c:	0f 87 b5 03 00 00    	ja     200ec7 <printer_vprintf+0x6d6>
+  200b12:	89 c0                	mov    %eax,%eax
+  200b14:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  200b1b:	00 
+  200b1c:	48 8d 05 c1 17 00 00 	lea    0x17c1(%rip),%rax        # 2022e4 <flag_chars+0x14>
+  200b23:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+  200b26:	48 98                	cltq
+  200b28:	48 8d 15 b5 17 00 00 	lea    0x17b5(%rip),%rdx        # 2022e4 <flag_chars+0x14>
+  200b2f:	48 01 d0             	add    %rdx,%rax
+  200b32:	ff e0                	jmp    *%rax
+        case 'l':
+        case 'z':
+            length = 1;
+  200b34:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+            ++format;
+  200b3b:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  200b42:	01 
+            goto again;
+  200b43:	eb b4                	jmp    200af9 <printer_vprintf+0x308>
+        case 'd':
+        case 'i': {
+            long x = length ? va_arg(val, long) : va_arg(val, int);
+  200b45:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  200b49:	74 5d                	je     200ba8 <printer_vprintf+0x3b7>
+  200b4b:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200b52:	8b 00                	mov    (%rax),%eax
+  200b54:	83 f8 2f             	cmp    $0x2f,%eax
+  200b57:	77 30                	ja     200b89 <printer_vprintf+0x398>
+  200b59:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200b60:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200b64:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200b6b:	8b 00                	mov    (%rax),%eax
+  200b6d:	89 c0                	mov    %eax,%eax
+  200b6f:	48 01 d0             	add    %rdx,%rax
+  200b72:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200b79:	8b 12                	mov    (%rdx),%edx
+  200b7b:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200b7e:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200b85:	89 0a                	mov    %ecx,(%rdx)
+  200b87:	eb 1a                	jmp    200ba3 <printer_vprintf+0x3b2>
+  200b89:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200b90:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200b94:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200b98:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200b9f:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200ba3:	48 8b 00             	mov    (%rax),%rax
+  200ba6:	eb 5c                	jmp    200c04 <printer_vprintf+0x413>
+  200ba8:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200baf:	8b 00                	mov    (%rax),%eax
+  200bb1:	83 f8 2f             	cmp    $0x2f,%eax
+  200bb4:	77 30                	ja     200be6 <printer_vprintf+0x3f5>
+  200bb6:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200bbd:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200bc1:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200bc8:	8b 00                	mov    (%rax),%eax
+  200bca:	89 c0                	mov    %eax,%eax
+  200bcc:	48 01 d0             	add    %rdx,%rax
+  200bcf:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200bd6:	8b 12                	mov    (%rdx),%edx
+  200bd8:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200bdb:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200be2:	89 0a                	mov    %ecx,(%rdx)
+  200be4:	eb 1a                	jmp    200c00 <printer_vprintf+0x40f>
+  200be6:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200bed:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200bf1:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200bf5:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200bfc:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200c00:	8b 00                	mov    (%rax),%eax
+  200c02:	48 98                	cltq
+  200c04:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+            int negative = x < 0 ? FLAG_NEGATIVE : 0;
+  200c08:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  200c0c:	48 c1 f8 38          	sar    $0x38,%rax
+  200c10:	25 80 00 00 00       	and    $0x80,%eax
+  200c15:	89 45 a4             	mov    %eax,-0x5c(%rbp)
+            num = negative ? -x : x;
+  200c18:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  200c1c:	74 09                	je     200c27 <printer_vprintf+0x436>
+  200c1e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  200c22:	48 f7 d8             	neg    %rax
+  200c25:	eb 04                	jmp    200c2b <printer_vprintf+0x43a>
+  200c27:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  200c2b:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+            flags |= FLAG_NUMERIC | FLAG_SIGNED | negative;
+  200c2f:	8b 45 a4             	mov    -0x5c(%rbp),%eax
+  200c32:	83 c8 60             	or     $0x60,%eax
+  200c35:	09 45 ec             	or     %eax,-0x14(%rbp)
+            break;
+  200c38:	e9 cf 02 00 00       	jmp    200f0c <printer_vprintf+0x71b>
+        }
+        case 'u':
+        format_unsigned:
+            num = length ? va_arg(val, unsigned long) : va_arg(val, unsigned);
+  200c3d:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  200c41:	74 5d                	je     200ca0 <printer_vprintf+0x4af>
+  200c43:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c4a:	8b 00                	mov    (%rax),%eax
+  200c4c:	83 f8 2f             	cmp    $0x2f,%eax
+  200c4f:	77 30                	ja     200c81 <printer_vprintf+0x490>
+  200c51:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c58:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200c5c:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c63:	8b 00                	mov    (%rax),%eax
+  200c65:	89 c0                	mov    %eax,%eax
+  200c67:	48 01 d0             	add    %rdx,%rax
+  200c6a:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200c71:	8b 12                	mov    (%rdx),%edx
+  200c73:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200c76:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200c7d:	89 0a                	mov    %ecx,(%rdx)
+  200c7f:	eb 1a                	jmp    200c9b <printer_vprintf+0x4aa>
+  200c81:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c88:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200c8c:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200c90:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200c97:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200c9b:	48 8b 00             	mov    (%rax),%rax
+  200c9e:	eb 5c                	jmp    200cfc <printer_vprintf+0x50b>
+  200ca0:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200ca7:	8b 00                	mov    (%rax),%eax
+  200ca9:	83 f8 2f             	cmp    $0x2f,%eax
+  200cac:	77 30                	ja     200cde <printer_vprintf+0x4ed>
+  200cae:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200cb5:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200cb9:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200cc0:	8b 00                	mov    (%rax),%eax
+  200cc2:	89 c0                	mov    %eax,%eax
+  200cc4:	48 01 d0             	add    %rdx,%rax
+  200cc7:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200cce:	8b 12                	mov    (%rdx),%edx
+  200cd0:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200cd3:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200cda:	89 0a                	mov    %ecx,(%rdx)
+  200cdc:	eb 1a                	jmp    200cf8 <printer_vprintf+0x507>
+  200cde:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200ce5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200ce9:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200ced:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200cf4:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200cf8:	8b 00                	mov    (%rax),%eax
+  200cfa:	89 c0                	mov    %eax,%eax
+  200cfc:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+            flags |= FLAG_NUMERIC;
+  200d00:	83 4d ec 20          	orl    $0x20,-0x14(%rbp)
+            break;
+  200d04:	e9 03 02 00 00       	jmp    200f0c <printer_vprintf+0x71b>
+        case 'x':
+            base = -16;
+  200d09:	c7 45 e0 f0 ff ff ff 	movl   $0xfffffff0,-0x20(%rbp)
+            goto format_unsigned;
+  200d10:	e9 28 ff ff ff       	jmp    200c3d <printer_vprintf+0x44c>
+        case 'X':
+            base = 16;
+  200d15:	c7 45 e0 10 00 00 00 	movl   $0x10,-0x20(%rbp)
+            goto format_unsigned;
+  200d1c:	e9 1c ff ff ff       	jmp    200c3d <printer_vprintf+0x44c>
+        case 'p':
+            num = (uintptr_t) va_arg(val, void*);
+  200d21:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200d28:	8b 00                	mov    (%rax),%eax
+  200d2a:	83 f8 2f             	cmp    $0x2f,%eax
+  200d2d:	77 30                	ja     200d5f <printer_vprintf+0x56e>
+  200d2f:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200d36:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200d3a:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200d41:	8b 00                	mov    (%rax),%eax
+  200d43:	89 c0                	mov    %eax,%eax
+  200d45:	48 01 d0             	add    %rdx,%rax
+  200d48:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200d4f:	8b 12                	mov    (%rdx),%edx
+  200d51:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200d54:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200d5b:	89 0a                	mov    %ecx,(%rdx)
+  200d5d:	eb 1a                	jmp    200d79 <printer_vprintf+0x588>
+  200d5f:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200d66:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200d6a:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200d6e:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200d75:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200d79:	48 8b 00             	mov    (%rax),%rax
+  200d7c:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+            base = -16;
+  200d80:	c7 45 e0 f0 ff ff ff 	movl   $0xfffffff0,-0x20(%rbp)
+            flags |= FLAG_ALT | FLAG_ALT2 | FLAG_NUMERIC;
+  200d87:	81 4d ec 21 01 00 00 	orl    $0x121,-0x14(%rbp)
+            break;
+  200d8e:	e9 79 01 00 00       	jmp    200f0c <printer_vprintf+0x71b>
+        case 's':
+            data = va_arg(val, char*);
+  200d93:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200d9a:	8b 00                	mov    (%rax),%eax
+  200d9c:	83 f8 2f             	cmp    $0x2f,%eax
+  200d9f:	77 30                	ja     200dd1 <printer_vprintf+0x5e0>
+  200da1:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200da8:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200dac:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200db3:	8b 00                	mov    (%rax),%eax
+  200db5:	89 c0                	mov    %eax,%eax
+  200db7:	48 01 d0             	add    %rdx,%rax
+  200dba:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200dc1:	8b 12                	mov    (%rdx),%edx
+  200dc3:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200dc6:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200dcd:	89 0a                	mov    %ecx,(%rdx)
+  200dcf:	eb 1a                	jmp    200deb <printer_vprintf+0x5fa>
+  200dd1:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200dd8:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200ddc:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200de0:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200de7:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200deb:	48 8b 00             	mov    (%rax),%rax
+  200dee:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+            break;
+  200df2:	e9 15 01 00 00       	jmp    200f0c <printer_vprintf+0x71b>
+        case 'C':
+            color = va_arg(val, int);
+  200df7:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200dfe:	8b 00                	mov    (%rax),%eax
+  200e00:	83 f8 2f             	cmp    $0x2f,%eax
+  200e03:	77 30                	ja     200e35 <printer_vprintf+0x644>
+  200e05:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200e0c:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200e10:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200e17:	8b 00                	mov    (%rax),%eax
+  200e19:	89 c0                	mov    %eax,%eax
+  200e1b:	48 01 d0             	add    %rdx,%rax
+  200e1e:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200e25:	8b 12                	mov    (%rdx),%edx
+  200e27:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200e2a:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200e31:	89 0a                	mov    %ecx,(%rdx)
+  200e33:	eb 1a                	jmp    200e4f <printer_vprintf+0x65e>
+  200e35:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200e3c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200e40:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200e44:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200e4b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200e4f:	8b 00                	mov    (%rax),%eax
+  200e51:	89 85 74 ff ff ff    	mov    %eax,-0x8c(%rbp)
+            goto done;
+  200e57:	e9 77 03 00 00       	jmp    2011d3 <printer_vprintf+0x9e2>
+        case 'c':
+            data = numbuf;
+  200e5c:	48 8d 45 8c          	lea    -0x74(%rbp),%rax
+  200e60:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+            numbuf[0] = va_arg(val, int);
+  200e64:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200e6b:	8b 00                	mov    (%rax),%eax
+  200e6d:	83 f8 2f             	cmp    $0x2f,%eax
+  200e70:	77 30                	ja     200ea2 <printer_vprintf+0x6b1>
+  200e72:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200e79:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200e7d:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200e84:	8b 00                	mov    (%rax),%eax
+  200e86:	89 c0                	mov    %eax,%eax
+  200e88:	48 01 d0             	add    %rdx,%rax
+  200e8b:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200e92:	8b 12                	mov    (%rdx),%edx
+  200e94:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200e97:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200e9e:	89 0a                	mov    %ecx,(%rdx)
+  200ea0:	eb 1a                	jmp    200ebc <printer_vprintf+0x6cb>
+  200ea2:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200ea9:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200ead:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200eb1:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200eb8:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200ebc:	8b 00                	mov    (%rax),%eax
+  200ebe:	88 45 8c             	mov    %al,-0x74(%rbp)
+            numbuf[1] = '\0';
+  200ec1:	c6 45 8d 00          	movb   $0x0,-0x73(%rbp)
+            break;
+  200ec5:	eb 45                	jmp    200f0c <printer_vprintf+0x71b>
+        default:
+            data = numbuf;
+  200ec7:	48 8d 45 8c          	lea    -0x74(%rbp),%rax
+  200ecb:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+            numbuf[0] = (*format ? *format : '%');
+  200ecf:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200ed6:	0f b6 00             	movzbl (%rax),%eax
+  200ed9:	84 c0                	test   %al,%al
+  200edb:	74 0c                	je     200ee9 <printer_vprintf+0x6f8>
+  200edd:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200ee4:	0f b6 00             	movzbl (%rax),%eax
+  200ee7:	eb 05                	jmp    200eee <printer_vprintf+0x6fd>
+  200ee9:	b8 25 00 00 00       	mov    $0x25,%eax
+  200eee:	88 45 8c             	mov    %al,-0x74(%rbp)
+            numbuf[1] = '\0';
+  200ef1:	c6 45 8d 00          	movb   $0x0,-0x73(%rbp)
+            if (!*format) {
+  200ef5:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200efc:	0f b6 00             	movzbl (%rax),%eax
+  200eff:	84 c0                	test   %al,%al
+  200f01:	75 08                	jne    200f0b <printer_vprintf+0x71a>
+                format--;
+  200f03:	48 83 ad 68 ff ff ff 	subq   $0x1,-0x98(%rbp)
+  200f0a:	01 
+            }
+            break;
+  200f0b:	90                   	nop
+        }
+
+        if (flags & FLAG_NUMERIC) {
+  200f0c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200f0f:	83 e0 20             	and    $0x20,%eax
+  200f12:	85 c0                	test   %eax,%eax
+  200f14:	74 1e                	je     200f34 <printer_vprintf+0x743>
+            data = fill_numbuf(numbuf + NUMBUFSIZ, num, base);
+  200f16:	48 8d 45 8c          	lea    -0x74(%rbp),%rax
+  200f1a:	48 83 c0 18          	add    $0x18,%rax
+  200f1e:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  200f21:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  200f25:	48 89 ce             	mov    %rcx,%rsi
+  200f28:	48 89 c7             	mov    %rax,%rdi
+  200f2b:	e8 39 f8 ff ff       	call   200769 <fill_numbuf>
+  200f30:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        }
+
+        const char* prefix = "";
+  200f34:	48 8d 05 9b 13 00 00 	lea    0x139b(%rip),%rax        # 2022d6 <flag_chars+0x6>
+  200f3b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((flags & FLAG_NUMERIC) && (flags & FLAG_SIGNED)) {
+  200f3f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200f42:	83 e0 20             	and    $0x20,%eax
+  200f45:	85 c0                	test   %eax,%eax
+  200f47:	74 51                	je     200f9a <printer_vprintf+0x7a9>
+  200f49:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200f4c:	83 e0 40             	and    $0x40,%eax
+  200f4f:	85 c0                	test   %eax,%eax
+  200f51:	74 47                	je     200f9a <printer_vprintf+0x7a9>
+            if (flags & FLAG_NEGATIVE) {
+  200f53:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200f56:	25 80 00 00 00       	and    $0x80,%eax
+  200f5b:	85 c0                	test   %eax,%eax
+  200f5d:	74 0d                	je     200f6c <printer_vprintf+0x77b>
+                prefix = "-";
+  200f5f:	48 8d 05 71 13 00 00 	lea    0x1371(%rip),%rax        # 2022d7 <flag_chars+0x7>
+  200f66:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            if (flags & FLAG_NEGATIVE) {
+  200f6a:	eb 7d                	jmp    200fe9 <printer_vprintf+0x7f8>
+            } else if (flags & FLAG_PLUSPOSITIVE) {
+  200f6c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200f6f:	83 e0 10             	and    $0x10,%eax
+  200f72:	85 c0                	test   %eax,%eax
+  200f74:	74 0d                	je     200f83 <printer_vprintf+0x792>
+                prefix = "+";
+  200f76:	48 8d 05 5c 13 00 00 	lea    0x135c(%rip),%rax        # 2022d9 <flag_chars+0x9>
+  200f7d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            if (flags & FLAG_NEGATIVE) {
+  200f81:	eb 66                	jmp    200fe9 <printer_vprintf+0x7f8>
+            } else if (flags & FLAG_SPACEPOSITIVE) {
+  200f83:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200f86:	83 e0 08             	and    $0x8,%eax
+  200f89:	85 c0                	test   %eax,%eax
+  200f8b:	74 5c                	je     200fe9 <printer_vprintf+0x7f8>
+                prefix = " ";
+  200f8d:	48 8d 05 47 13 00 00 	lea    0x1347(%rip),%rax        # 2022db <flag_chars+0xb>
+  200f94:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            if (flags & FLAG_NEGATIVE) {
+  200f98:	eb 4f                	jmp    200fe9 <printer_vprintf+0x7f8>
+            }
+        } else if ((flags & FLAG_NUMERIC) && (flags & FLAG_ALT)
+  200f9a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200f9d:	83 e0 20             	and    $0x20,%eax
+  200fa0:	85 c0                	test   %eax,%eax
+  200fa2:	74 46                	je     200fea <printer_vprintf+0x7f9>
+  200fa4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200fa7:	83 e0 01             	and    $0x1,%eax
+  200faa:	85 c0                	test   %eax,%eax
+  200fac:	74 3c                	je     200fea <printer_vprintf+0x7f9>
+                   && (base == 16 || base == -16)
+  200fae:	83 7d e0 10          	cmpl   $0x10,-0x20(%rbp)
+  200fb2:	74 06                	je     200fba <printer_vprintf+0x7c9>
+  200fb4:	83 7d e0 f0          	cmpl   $0xfffffff0,-0x20(%rbp)
+  200fb8:	75 30                	jne    200fea <printer_vprintf+0x7f9>
+                   && (num || (flags & FLAG_ALT2))) {
+  200fba:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  200fbf:	75 0c                	jne    200fcd <printer_vprintf+0x7dc>
+  200fc1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200fc4:	25 00 01 00 00       	and    $0x100,%eax
+  200fc9:	85 c0                	test   %eax,%eax
+  200fcb:	74 1d                	je     200fea <printer_vprintf+0x7f9>
+            prefix = (base == -16 ? "0x" : "0X");
+  200fcd:	83 7d e0 f0          	cmpl   $0xfffffff0,-0x20(%rbp)
+  200fd1:	75 09                	jne    200fdc <printer_vprintf+0x7eb>
+  200fd3:	48 8d 05 03 13 00 00 	lea    0x1303(%rip),%rax        # 2022dd <flag_chars+0xd>
+  200fda:	eb 07                	jmp    200fe3 <printer_vprintf+0x7f2>
+  200fdc:	48 8d 05 fd 12 00 00 	lea    0x12fd(%rip),%rax        # 2022e0 <flag_chars+0x10>
+  200fe3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  200fe7:	eb 01                	jmp    200fea <printer_vprintf+0x7f9>
+            if (flags & FLAG_NEGATIVE) {
+  200fe9:	90                   	nop
+        }
+
+        int len;
+        if (precision >= 0 && !(flags & FLAG_NUMERIC)) {
+  200fea:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  200fee:	78 24                	js     201014 <printer_vprintf+0x823>
+  200ff0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200ff3:	83 e0 20             	and    $0x20,%eax
+  200ff6:	85 c0                	test   %eax,%eax
+  200ff8:	75 1a                	jne    201014 <printer_vprintf+0x823>
+            len = strnlen(data, precision);
+  200ffa:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  200ffd:	48 63 d0             	movslq %eax,%rdx
+  201000:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  201004:	48 89 d6             	mov    %rdx,%rsi
+  201007:	48 89 c7             	mov    %rax,%rdi
+  20100a:	e8 8a f5 ff ff       	call   200599 <strnlen>
+  20100f:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  201012:	eb 0f                	jmp    201023 <printer_vprintf+0x832>
+        } else {
+            len = strlen(data);
+  201014:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  201018:	48 89 c7             	mov    %rax,%rdi
+  20101b:	e8 48 f5 ff ff       	call   200568 <strlen>
+  201020:	89 45 bc             	mov    %eax,-0x44(%rbp)
+        }
+        int zeros;
+        if ((flags & FLAG_NUMERIC) && precision >= 0) {
+  201023:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  201026:	83 e0 20             	and    $0x20,%eax
+  201029:	85 c0                	test   %eax,%eax
+  20102b:	74 20                	je     20104d <printer_vprintf+0x85c>
+  20102d:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  201031:	78 1a                	js     20104d <printer_vprintf+0x85c>
+            zeros = precision > len ? precision - len : 0;
+  201033:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  201036:	3b 45 bc             	cmp    -0x44(%rbp),%eax
+  201039:	7e 08                	jle    201043 <printer_vprintf+0x852>
+  20103b:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  20103e:	2b 45 bc             	sub    -0x44(%rbp),%eax
+  201041:	eb 05                	jmp    201048 <printer_vprintf+0x857>
+  201043:	b8 00 00 00 00       	mov    $0x0,%eax
+  201048:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  20104b:	eb 5c                	jmp    2010a9 <printer_vprintf+0x8b8>
+        } else if ((flags & FLAG_NUMERIC) && (flags & FLAG_ZERO)
+  20104d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  201050:	83 e0 20             	and    $0x20,%eax
+  201053:	85 c0                	test   %eax,%eax
+  201055:	74 4b                	je     2010a2 <printer_vprintf+0x8b1>
+  201057:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  20105a:	83 e0 02             	and    $0x2,%eax
+  20105d:	85 c0                	test   %eax,%eax
+  20105f:	74 41                	je     2010a2 <printer_vprintf+0x8b1>
+                   && !(flags & FLAG_LEFTJUSTIFY)
+  201061:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  201064:	83 e0 04             	and    $0x4,%eax
+  201067:	85 c0                	test   %eax,%eax
+  201069:	75 37                	jne    2010a2 <printer_vprintf+0x8b1>
+                   && len + (int) strlen(prefix) < width) {
+  20106b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  20106f:	48 89 c7             	mov    %rax,%rdi
+  201072:	e8 f1 f4 ff ff       	call   200568 <strlen>
+  201077:	89 c2                	mov    %eax,%edx
+  201079:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  20107c:	01 d0                	add    %edx,%eax
+  20107e:	39 45 e8             	cmp    %eax,-0x18(%rbp)
+  201081:	7e 1f                	jle    2010a2 <printer_vprintf+0x8b1>
+            zeros = width - len - strlen(prefix);
+  201083:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  201086:	2b 45 bc             	sub    -0x44(%rbp),%eax
+  201089:	89 c3                	mov    %eax,%ebx
+  20108b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  20108f:	48 89 c7             	mov    %rax,%rdi
+  201092:	e8 d1 f4 ff ff       	call   200568 <strlen>
+  201097:	89 c2                	mov    %eax,%edx
+  201099:	89 d8                	mov    %ebx,%eax
+  20109b:	29 d0                	sub    %edx,%eax
+  20109d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  2010a0:	eb 07                	jmp    2010a9 <printer_vprintf+0x8b8>
+        } else {
+            zeros = 0;
+  2010a2:	c7 45 b8 00 00 00 00 	movl   $0x0,-0x48(%rbp)
+        }
+        width -= len + zeros + strlen(prefix);
+  2010a9:	8b 55 bc             	mov    -0x44(%rbp),%edx
+  2010ac:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  2010af:	01 d0                	add    %edx,%eax
+  2010b1:	48 63 d8             	movslq %eax,%rbx
+  2010b4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  2010b8:	48 89 c7             	mov    %rax,%rdi
+  2010bb:	e8 a8 f4 ff ff       	call   200568 <strlen>
+  2010c0:	48 8d 14 03          	lea    (%rbx,%rax,1),%rdx
+  2010c4:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  2010c7:	29 d0                	sub    %edx,%eax
+  2010c9:	89 45 e8             	mov    %eax,-0x18(%rbp)
+        for (; !(flags & FLAG_LEFTJUSTIFY) && width > 0; --width) {
+  2010cc:	eb 25                	jmp    2010f3 <printer_vprintf+0x902>
+            p->putc(p, ' ', color);
+  2010ce:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  2010d5:	48 8b 08             	mov    (%rax),%rcx
+  2010d8:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  2010de:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  2010e5:	be 20 00 00 00       	mov    $0x20,%esi
+  2010ea:	48 89 c7             	mov    %rax,%rdi
+  2010ed:	ff d1                	call   *%rcx
+        for (; !(flags & FLAG_LEFTJUSTIFY) && width > 0; --width) {
+  2010ef:	83 6d e8 01          	subl   $0x1,-0x18(%rbp)
+  2010f3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  2010f6:	83 e0 04             	and    $0x4,%eax
+  2010f9:	85 c0                	test   %eax,%eax
+  2010fb:	75 36                	jne    201133 <printer_vprintf+0x942>
+  2010fd:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  201101:	7f cb                	jg     2010ce <printer_vprintf+0x8dd>
+        }
+        for (; *prefix; ++prefix) {
+  201103:	eb 2e                	jmp    201133 <printer_vprintf+0x942>
+            p->putc(p, *prefix, color);
+  201105:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  20110c:	4c 8b 00             	mov    (%rax),%r8
+  20110f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  201113:	0f b6 00             	movzbl (%rax),%eax
+  201116:	0f b6 c8             	movzbl %al,%ecx
+  201119:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  20111f:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  201126:	89 ce                	mov    %ecx,%esi
+  201128:	48 89 c7             	mov    %rax,%rdi
+  20112b:	41 ff d0             	call   *%r8
+        for (; *prefix; ++prefix) {
+  20112e:	48 83 45 c0 01       	addq   $0x1,-0x40(%rbp)
+  201133:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  201137:	0f b6 00             	movzbl (%rax),%eax
+  20113a:	84 c0                	test   %al,%al
+  20113c:	75 c7                	jne    201105 <printer_vprintf+0x914>
+        }
+        for (; zeros > 0; --zeros) {
+  20113e:	eb 25                	jmp    201165 <printer_vprintf+0x974>
+            p->putc(p, '0', color);
+  201140:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  201147:	48 8b 08             	mov    (%rax),%rcx
+  20114a:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  201150:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  201157:	be 30 00 00 00       	mov    $0x30,%esi
+  20115c:	48 89 c7             	mov    %rax,%rdi
+  20115f:	ff d1                	call   *%rcx
+        for (; zeros > 0; --zeros) {
+  201161:	83 6d b8 01          	subl   $0x1,-0x48(%rbp)
+  201165:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  201169:	7f d5                	jg     201140 <printer_vprintf+0x94f>
+        }
+        for (; len > 0; ++data, --len) {
+  20116b:	eb 32                	jmp    20119f <printer_vprintf+0x9ae>
+            p->putc(p, *data, color);
+  20116d:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  201174:	4c 8b 00             	mov    (%rax),%r8
+  201177:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  20117b:	0f b6 00             	movzbl (%rax),%eax
+  20117e:	0f b6 c8             	movzbl %al,%ecx
+  201181:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  201187:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  20118e:	89 ce                	mov    %ecx,%esi
+  201190:	48 89 c7             	mov    %rax,%rdi
+  201193:	41 ff d0             	call   *%r8
+        for (; len > 0; ++data, --len) {
+  201196:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  20119b:	83 6d bc 01          	subl   $0x1,-0x44(%rbp)
+  20119f:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+  2011a3:	7f c8                	jg     20116d <printer_vprintf+0x97c>
+        }
+        for (; width > 0; --width) {
+  2011a5:	eb 25                	jmp    2011cc <printer_vprintf+0x9db>
+            p->putc(p, ' ', color);
+  2011a7:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  2011ae:	48 8b 08             	mov    (%rax),%rcx
+  2011b1:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  2011b7:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  2011be:	be 20 00 00 00       	mov    $0x20,%esi
+  2011c3:	48 89 c7             	mov    %rax,%rdi
+  2011c6:	ff d1                	call   *%rcx
+        for (; width > 0; --width) {
+  2011c8:	83 6d e8 01          	subl   $0x1,-0x18(%rbp)
+  2011cc:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  2011d0:	7f d5                	jg     2011a7 <printer_vprintf+0x9b6>
+        }
+    done: ;
+  2011d2:	90                   	nop
+    for (; *format; ++format) {
+  2011d3:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  2011da:	01 
+  2011db:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  2011e2:	0f b6 00             	movzbl (%rax),%eax
+  2011e5:	84 c0                	test   %al,%al
+  2011e7:	0f 85 30 f6 ff ff    	jne    20081d <printer_vprintf+0x2c>
+    }
+}
+  2011ed:	90                   	nop
+  2011ee:	90                   	nop
+  2011ef:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  2011f3:	c9                   	leave
+  2011f4:	c3                   	ret
+
+00000000002011f5 <console_putc>:
+typedef struct console_printer {
+    printer p;
+    uint16_t* cursor;
+} console_printer;
+
+static void console_putc(printer* p, unsigned char c, int color) {
+  2011f5:	55                   	push   %rbp
+  2011f6:	48 89 e5             	mov    %rsp,%rbp
+  2011f9:	48 83 ec 30          	sub    $0x30,%rsp
+  2011fd:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  201201:	89 f0                	mov    %esi,%eax
+  201203:	89 55 d0             	mov    %edx,-0x30(%rbp)
+  201206:	88 45 d4             	mov    %al,-0x2c(%rbp)
+    console_printer* cp = (console_printer*) p;
+  201209:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  20120d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    /*if (cp->cursor >= console + CONSOLE_ROWS * CONSOLE_COLUMNS) {
+        cp->cursor = console;
+    }*/
+    if (c == '\n') {
+  201211:	80 7d d4 0a          	cmpb   $0xa,-0x2c(%rbp)
+  201215:	75 7f                	jne    201296 <console_putc+0xa1>
+        int pos = (cp->cursor - console) % CONSOLE_COLUMNS;
+  201217:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20121b:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  20121f:	48 8d 05 da 6d eb ff 	lea    -0x149226(%rip),%rax        # b8000 <console>
+  201226:	48 29 c2             	sub    %rax,%rdx
+  201229:	48 89 d0             	mov    %rdx,%rax
+  20122c:	48 d1 f8             	sar    %rax
+  20122f:	48 89 c1             	mov    %rax,%rcx
+  201232:	48 ba 67 66 66 66 66 	movabs $0x6666666666666667,%rdx
+  201239:	66 66 66 
+  20123c:	48 89 c8             	mov    %rcx,%rax
+  20123f:	48 f7 ea             	imul   %rdx
+  201242:	48 c1 fa 05          	sar    $0x5,%rdx
+  201246:	48 89 c8             	mov    %rcx,%rax
+  201249:	48 c1 f8 3f          	sar    $0x3f,%rax
+  20124d:	48 29 c2             	sub    %rax,%rdx
+  201250:	48 89 d0             	mov    %rdx,%rax
+  201253:	48 c1 e0 02          	shl    $0x2,%rax
+  201257:	48 01 d0             	add    %rdx,%rax
+  20125a:	48 c1 e0 04          	shl    $0x4,%rax
+  20125e:	48 29 c1             	sub    %rax,%rcx
+  201261:	48 89 ca             	mov    %rcx,%rdx
+  201264:	89 55 fc             	mov    %edx,-0x4(%rbp)
+        for (; pos != CONSOLE_COLUMNS; pos++) {
+  201267:	eb 25                	jmp    20128e <console_putc+0x99>
+            *cp->cursor++ = ' ' | color;
+  201269:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  20126c:	83 c8 20             	or     $0x20,%eax
+  20126f:	89 c6                	mov    %eax,%esi
+  201271:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201275:	48 8b 40 08          	mov    0x8(%rax),%rax
+  201279:	48 8d 48 02          	lea    0x2(%rax),%rcx
+  20127d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  201281:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  201285:	89 f2                	mov    %esi,%edx
+  201287:	66 89 10             	mov    %dx,(%rax)
+        for (; pos != CONSOLE_COLUMNS; pos++) {
+  20128a:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  20128e:	83 7d fc 50          	cmpl   $0x50,-0x4(%rbp)
+  201292:	75 d5                	jne    201269 <console_putc+0x74>
+  201294:	eb 69                	jmp    2012ff <console_putc+0x10a>
+        }
+    } else if (c == '\b') {
+  201296:	80 7d d4 08          	cmpb   $0x8,-0x2c(%rbp)
+  20129a:	75 3f                	jne    2012db <console_putc+0xe6>
+        if (cp->cursor != console) {
+  20129c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2012a0:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  2012a4:	48 8d 05 55 6d eb ff 	lea    -0x1492ab(%rip),%rax        # b8000 <console>
+  2012ab:	48 39 c2             	cmp    %rax,%rdx
+  2012ae:	74 4f                	je     2012ff <console_putc+0x10a>
+            *(--cp->cursor) = ' ' | color;
+  2012b0:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  2012b3:	83 c8 20             	or     $0x20,%eax
+  2012b6:	89 c1                	mov    %eax,%ecx
+  2012b8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2012bc:	48 8b 40 08          	mov    0x8(%rax),%rax
+  2012c0:	48 8d 50 fe          	lea    -0x2(%rax),%rdx
+  2012c4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2012c8:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  2012cc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2012d0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  2012d4:	89 ca                	mov    %ecx,%edx
+  2012d6:	66 89 10             	mov    %dx,(%rax)
+  2012d9:	eb 24                	jmp    2012ff <console_putc+0x10a>
+        }
+    } else {
+        *cp->cursor++ = c | color;
+  2012db:	0f b6 45 d4          	movzbl -0x2c(%rbp),%eax
+  2012df:	8b 55 d0             	mov    -0x30(%rbp),%edx
+  2012e2:	09 d0                	or     %edx,%eax
+  2012e4:	89 c6                	mov    %eax,%esi
+  2012e6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2012ea:	48 8b 40 08          	mov    0x8(%rax),%rax
+  2012ee:	48 8d 48 02          	lea    0x2(%rax),%rcx
+  2012f2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  2012f6:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  2012fa:	89 f2                	mov    %esi,%edx
+  2012fc:	66 89 10             	mov    %dx,(%rax)
+    }
+
+    const int MAX_ROWS = CONSOLE_ROWS - 2;
+  2012ff:	c7 45 e4 17 00 00 00 	movl   $0x17,-0x1c(%rbp)
+
+    if (cp->cursor == console + MAX_ROWS * CONSOLE_COLUMNS) {
+  201306:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20130a:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  20130e:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  201311:	89 d0                	mov    %edx,%eax
+  201313:	c1 e0 02             	shl    $0x2,%eax
+  201316:	01 d0                	add    %edx,%eax
+  201318:	c1 e0 04             	shl    $0x4,%eax
+  20131b:	48 98                	cltq
+  20131d:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  201321:	48 8d 05 d8 6c eb ff 	lea    -0x149328(%rip),%rax        # b8000 <console>
+  201328:	48 01 d0             	add    %rdx,%rax
+  20132b:	48 39 c1             	cmp    %rax,%rcx
+  20132e:	0f 85 ac 00 00 00    	jne    2013e0 <console_putc+0x1eb>
+        // Move all characters up by one row, forgetting the first row
+        for (int i = 0; i < (MAX_ROWS - 1) * CONSOLE_COLUMNS; ++i) {
+  201334:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  20133b:	eb 30                	jmp    20136d <console_putc+0x178>
+            console[i] = console[i + CONSOLE_COLUMNS];
+  20133d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  201340:	83 c0 50             	add    $0x50,%eax
+  201343:	48 98                	cltq
+  201345:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  201349:	48 8d 05 b0 6c eb ff 	lea    -0x149350(%rip),%rax        # b8000 <console>
+  201350:	0f b7 04 02          	movzwl (%rdx,%rax,1),%eax
+  201354:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  201357:	48 63 d2             	movslq %edx,%rdx
+  20135a:	48 8d 0c 12          	lea    (%rdx,%rdx,1),%rcx
+  20135e:	48 8d 15 9b 6c eb ff 	lea    -0x149365(%rip),%rdx        # b8000 <console>
+  201365:	66 89 04 11          	mov    %ax,(%rcx,%rdx,1)
+        for (int i = 0; i < (MAX_ROWS - 1) * CONSOLE_COLUMNS; ++i) {
+  201369:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+  20136d:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  201370:	8d 50 ff             	lea    -0x1(%rax),%edx
+  201373:	89 d0                	mov    %edx,%eax
+  201375:	c1 e0 02             	shl    $0x2,%eax
+  201378:	01 d0                	add    %edx,%eax
+  20137a:	c1 e0 04             	shl    $0x4,%eax
+  20137d:	39 45 f8             	cmp    %eax,-0x8(%rbp)
+  201380:	7c bb                	jl     20133d <console_putc+0x148>
+        }
+
+        // Fill last column with space
+        for (int i = (MAX_ROWS - 1) * CONSOLE_COLUMNS; i < MAX_ROWS * CONSOLE_COLUMNS; ++i) {
+  201382:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  201385:	8d 50 ff             	lea    -0x1(%rax),%edx
+  201388:	89 d0                	mov    %edx,%eax
+  20138a:	c1 e0 02             	shl    $0x2,%eax
+  20138d:	01 d0                	add    %edx,%eax
+  20138f:	c1 e0 04             	shl    $0x4,%eax
+  201392:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  201395:	eb 20                	jmp    2013b7 <console_putc+0x1c2>
+            console[i] = ' ' | color;
+  201397:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  20139a:	83 c8 20             	or     $0x20,%eax
+  20139d:	89 c1                	mov    %eax,%ecx
+  20139f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  2013a2:	48 98                	cltq
+  2013a4:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  2013a8:	48 8d 05 51 6c eb ff 	lea    -0x1493af(%rip),%rax        # b8000 <console>
+  2013af:	66 89 0c 02          	mov    %cx,(%rdx,%rax,1)
+        for (int i = (MAX_ROWS - 1) * CONSOLE_COLUMNS; i < MAX_ROWS * CONSOLE_COLUMNS; ++i) {
+  2013b3:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  2013b7:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  2013ba:	89 d0                	mov    %edx,%eax
+  2013bc:	c1 e0 02             	shl    $0x2,%eax
+  2013bf:	01 d0                	add    %edx,%eax
+  2013c1:	c1 e0 04             	shl    $0x4,%eax
+  2013c4:	39 45 f4             	cmp    %eax,-0xc(%rbp)
+  2013c7:	7c ce                	jl     201397 <console_putc+0x1a2>
+        }
+
+        cp->cursor -= CONSOLE_COLUMNS;
+  2013c9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2013cd:	48 8b 40 08          	mov    0x8(%rax),%rax
+  2013d1:	48 8d 90 60 ff ff ff 	lea    -0xa0(%rax),%rdx
+  2013d8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2013dc:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    }
+}
+  2013e0:	90                   	nop
+  2013e1:	c9                   	leave
+  2013e2:	c3                   	ret
+
+00000000002013e3 <console_vprintf>:
+
+int console_vprintf(int cpos, int color, const char* format, va_list val) {
+  2013e3:	55                   	push   %rbp
+  2013e4:	48 89 e5             	mov    %rsp,%rbp
+  2013e7:	48 83 ec 30          	sub    $0x30,%rsp
+  2013eb:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  2013ee:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  2013f1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  2013f5:	48 89 4d d8          	mov    %rcx,-0x28(%rbp)
+    struct console_printer cp;
+    cp.p.putc = console_putc;
+  2013f9:	48 8d 05 f5 fd ff ff 	lea    -0x20b(%rip),%rax        # 2011f5 <console_putc>
+  201400:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (cpos < 0 || cpos >= CONSOLE_ROWS * CONSOLE_COLUMNS) {
+  201404:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  201408:	78 09                	js     201413 <console_vprintf+0x30>
+  20140a:	81 7d ec cf 07 00 00 	cmpl   $0x7cf,-0x14(%rbp)
+  201411:	7e 07                	jle    20141a <console_vprintf+0x37>
+        cpos = 0;
+  201413:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+    }
+    cp.cursor = console + cpos;
+  20141a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  20141d:	48 98                	cltq
+  20141f:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  201423:	48 8d 05 d6 6b eb ff 	lea    -0x14942a(%rip),%rax        # b8000 <console>
+  20142a:	48 01 d0             	add    %rdx,%rax
+  20142d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    printer_vprintf(&cp.p, color, format, val);
+  201431:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  201435:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  201439:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  20143c:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  201440:	48 89 c7             	mov    %rax,%rdi
+  201443:	e8 a9 f3 ff ff       	call   2007f1 <printer_vprintf>
+    return cp.cursor - console;
+  201448:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  20144c:	48 8d 05 ad 6b eb ff 	lea    -0x149453(%rip),%rax        # b8000 <console>
+  201453:	48 29 c2             	sub    %rax,%rdx
+  201456:	48 89 d0             	mov    %rdx,%rax
+  201459:	48 d1 f8             	sar    %rax
+}
+  20145c:	c9                   	leave
+  20145d:	c3                   	ret
+
+000000000020145e <console_printf>:
+
+int console_printf(int cpos, int color, const char* format, ...) {
+  20145e:	55                   	push   %rbp
+  20145f:	48 89 e5             	mov    %rsp,%rbp
+  201462:	48 83 ec 60          	sub    $0x60,%rsp
+  201466:	89 7d ac             	mov    %edi,-0x54(%rbp)
+  201469:	89 75 a8             	mov    %esi,-0x58(%rbp)
+  20146c:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+  201470:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  201474:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  201478:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list val;
+    va_start(val, format);
+  20147c:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  201483:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  201487:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  20148b:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  20148f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    cpos = console_vprintf(cpos, color, format, val);
+  201493:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  201497:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  20149b:	8b 75 a8             	mov    -0x58(%rbp),%esi
+  20149e:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  2014a1:	89 c7                	mov    %eax,%edi
+  2014a3:	e8 3b ff ff ff       	call   2013e3 <console_vprintf>
+  2014a8:	89 45 ac             	mov    %eax,-0x54(%rbp)
+    va_end(val);
+    return cpos;
+  2014ab:	8b 45 ac             	mov    -0x54(%rbp),%eax
+}
+  2014ae:	c9                   	leave
+  2014af:	c3                   	ret
+
+00000000002014b0 <string_putc>:
+    printer p;
+    char* s;
+    char* end;
+} string_printer;
+
+static void string_putc(printer* p, unsigned char c, int color) {
+  2014b0:	55                   	push   %rbp
+  2014b1:	48 89 e5             	mov    %rsp,%rbp
+  2014b4:	48 83 ec 20          	sub    $0x20,%rsp
+  2014b8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  2014bc:	89 f0                	mov    %esi,%eax
+  2014be:	89 55 e0             	mov    %edx,-0x20(%rbp)
+  2014c1:	88 45 e4             	mov    %al,-0x1c(%rbp)
+    string_printer* sp = (string_printer*) p;
+  2014c4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2014c8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (sp->s < sp->end) {
+  2014cc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2014d0:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  2014d4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2014d8:	48 8b 40 10          	mov    0x10(%rax),%rax
+  2014dc:	48 39 c2             	cmp    %rax,%rdx
+  2014df:	73 1a                	jae    2014fb <string_putc+0x4b>
+        *sp->s++ = c;
+  2014e1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2014e5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  2014e9:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  2014ed:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  2014f1:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  2014f5:	0f b6 55 e4          	movzbl -0x1c(%rbp),%edx
+  2014f9:	88 10                	mov    %dl,(%rax)
+    }
+    (void) color;
+}
+  2014fb:	90                   	nop
+  2014fc:	c9                   	leave
+  2014fd:	c3                   	ret
+
+00000000002014fe <vsnprintf>:
+
+int vsnprintf(char* s, size_t size, const char* format, va_list val) {
+  2014fe:	55                   	push   %rbp
+  2014ff:	48 89 e5             	mov    %rsp,%rbp
+  201502:	48 83 ec 40          	sub    $0x40,%rsp
+  201506:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  20150a:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  20150e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  201512:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+    string_printer sp;
+    sp.p.putc = string_putc;
+  201516:	48 8d 05 93 ff ff ff 	lea    -0x6d(%rip),%rax        # 2014b0 <string_putc>
+  20151d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    sp.s = s;
+  201521:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  201525:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (size) {
+  201529:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  20152e:	74 33                	je     201563 <vsnprintf+0x65>
+        sp.end = s + size - 1;
+  201530:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  201534:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  201538:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  20153c:	48 01 d0             	add    %rdx,%rax
+  20153f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+        printer_vprintf(&sp.p, 0, format, val);
+  201543:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  201547:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  20154b:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  20154f:	be 00 00 00 00       	mov    $0x0,%esi
+  201554:	48 89 c7             	mov    %rax,%rdi
+  201557:	e8 95 f2 ff ff       	call   2007f1 <printer_vprintf>
+        *sp.s = 0;
+  20155c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  201560:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return sp.s - s;
+  201563:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  201567:	48 2b 45 d8          	sub    -0x28(%rbp),%rax
+}
+  20156b:	c9                   	leave
+  20156c:	c3                   	ret
+
+000000000020156d <snprintf>:
+
+int snprintf(char* s, size_t size, const char* format, ...) {
+  20156d:	55                   	push   %rbp
+  20156e:	48 89 e5             	mov    %rsp,%rbp
+  201571:	48 83 ec 70          	sub    $0x70,%rsp
+  201575:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  201579:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  20157d:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  201581:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  201585:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  201589:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list val;
+    va_start(val, format);
+  20158d:	c7 45 b0 18 00 00 00 	movl   $0x18,-0x50(%rbp)
+  201594:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  201598:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  20159c:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  2015a0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    int n = vsnprintf(s, size, format, val);
+  2015a4:	48 8d 4d b0          	lea    -0x50(%rbp),%rcx
+  2015a8:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  2015ac:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  2015b0:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  2015b4:	48 89 c7             	mov    %rax,%rdi
+  2015b7:	e8 42 ff ff ff       	call   2014fe <vsnprintf>
+  2015bc:	89 45 cc             	mov    %eax,-0x34(%rbp)
+    va_end(val);
+    return n;
+  2015bf:	8b 45 cc             	mov    -0x34(%rbp),%eax
+}
+  2015c2:	c9                   	leave
+  2015c3:	c3                   	ret
+
+00000000002015c4 <console_clear>:
+
+
+// console_clear
+//    Erases the console and moves the cursor to the upper left (CPOS(0, 0)).
+
+void console_clear(void) {
+  2015c4:	55                   	push   %rbp
+  2015c5:	48 89 e5             	mov    %rsp,%rbp
+  2015c8:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < CONSOLE_ROWS * CONSOLE_COLUMNS; ++i) {
+  2015cc:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  2015d3:	eb 1a                	jmp    2015ef <console_clear+0x2b>
+        console[i] = ' ' | 0x0700;
+  2015d5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  2015d8:	48 98                	cltq
+  2015da:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  2015de:	48 8d 05 1b 6a eb ff 	lea    -0x1495e5(%rip),%rax        # b8000 <console>
+  2015e5:	66 c7 04 02 20 07    	movw   $0x720,(%rdx,%rax,1)
+    for (int i = 0; i < CONSOLE_ROWS * CONSOLE_COLUMNS; ++i) {
+  2015eb:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  2015ef:	81 7d fc cf 07 00 00 	cmpl   $0x7cf,-0x4(%rbp)
+  2015f6:	7e dd                	jle    2015d5 <console_clear+0x11>
+    }
+    cursorpos = 0;
+  2015f8:	c7 05 fa 79 eb ff 00 	movl   $0x0,-0x148606(%rip)        # b8ffc <cursorpos>
+  2015ff:	00 00 00 
+}
+  201602:	90                   	nop
+  201603:	c9                   	leave
+  201604:	c3                   	ret
+
+0000000000201605 <string_to_char>:
+
+
+int string_to_char(const char *str, int *dest) {
+  201605:	55                   	push   %rbp
+  201606:	48 89 e5             	mov    %rsp,%rbp
+  201609:	48 83 ec 20          	sub    $0x20,%rsp
+  20160d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  201611:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    if (*str == '\0') return -1;
+  201615:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201619:	0f b6 00             	movzbl (%rax),%eax
+  20161c:	84 c0                	test   %al,%al
+  20161e:	75 0a                	jne    20162a <string_to_char+0x25>
+  201620:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  201625:	e9 e0 00 00 00       	jmp    20170a <string_to_char+0x105>
+
+    *dest = 0;
+  20162a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  20162e:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    for (; *str; str++) {
+  201634:	e9 bd 00 00 00       	jmp    2016f6 <string_to_char+0xf1>
+        int digit = 0;
+  201639:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+        switch (*str)
+  201640:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201644:	0f b6 00             	movzbl (%rax),%eax
+  201647:	0f be c0             	movsbl %al,%eax
+  20164a:	83 e8 30             	sub    $0x30,%eax
+  20164d:	83 f8 09             	cmp    $0x9,%eax
+  201650:	77 7c                	ja     2016ce <string_to_char+0xc9>
+  201652:	89 c0                	mov    %eax,%eax
+  201654:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  20165b:	00 
+  20165c:	48 8d 05 61 0d 00 00 	lea    0xd61(%rip),%rax        # 2023c4 <flag_chars+0xf4>
+  201663:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+  201666:	48 98                	cltq
+  201668:	48 8d 15 55 0d 00 00 	lea    0xd55(%rip),%rdx        # 2023c4 <flag_chars+0xf4>
+  20166f:	48 01 d0             	add    %rdx,%rax
+  201672:	ff e0                	jmp    *%rax
+        {
+        case '0':
+            digit = 0;
+  201674:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+            break;
+  20167b:	eb 58                	jmp    2016d5 <string_to_char+0xd0>
+        case '1':
+            digit = 1;
+  20167d:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+            break;
+  201684:	eb 4f                	jmp    2016d5 <string_to_char+0xd0>
+        case '2':
+            digit = 2;
+  201686:	c7 45 fc 02 00 00 00 	movl   $0x2,-0x4(%rbp)
+            break;
+  20168d:	eb 46                	jmp    2016d5 <string_to_char+0xd0>
+        case '3':
+            digit = 3;
+  20168f:	c7 45 fc 03 00 00 00 	movl   $0x3,-0x4(%rbp)
+            break;
+  201696:	eb 3d                	jmp    2016d5 <string_to_char+0xd0>
+        case '4':
+            digit = 4;
+  201698:	c7 45 fc 04 00 00 00 	movl   $0x4,-0x4(%rbp)
+            break;
+  20169f:	eb 34                	jmp    2016d5 <string_to_char+0xd0>
+        case '5':
+            digit = 5;
+  2016a1:	c7 45 fc 05 00 00 00 	movl   $0x5,-0x4(%rbp)
+            break;
+  2016a8:	eb 2b                	jmp    2016d5 <string_to_char+0xd0>
+        case '6':
+            digit = 6;
+  2016aa:	c7 45 fc 06 00 00 00 	movl   $0x6,-0x4(%rbp)
+            break;
+  2016b1:	eb 22                	jmp    2016d5 <string_to_char+0xd0>
+        case '7':
+            digit = 7;
+  2016b3:	c7 45 fc 07 00 00 00 	movl   $0x7,-0x4(%rbp)
+            break;
+  2016ba:	eb 19                	jmp    2016d5 <string_to_char+0xd0>
+        case '8':
+            digit = 8;
+  2016bc:	c7 45 fc 08 00 00 00 	movl   $0x8,-0x4(%rbp)
+            break;
+  2016c3:	eb 10                	jmp    2016d5 <string_to_char+0xd0>
+        case '9':
+            digit = 9;
+  2016c5:	c7 45 fc 09 00 00 00 	movl   $0x9,-0x4(%rbp)
+            break;
+  2016cc:	eb 07                	jmp    2016d5 <string_to_char+0xd0>
+        default:
+            return -1;
+  2016ce:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  2016d3:	eb 35                	jmp    20170a <string_to_char+0x105>
+        }
+
+        *dest = *dest * 10 + digit;
+  2016d5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  2016d9:	8b 10                	mov    (%rax),%edx
+  2016db:	89 d0                	mov    %edx,%eax
+  2016dd:	c1 e0 02             	shl    $0x2,%eax
+  2016e0:	01 d0                	add    %edx,%eax
+  2016e2:	01 c0                	add    %eax,%eax
+  2016e4:	89 c2                	mov    %eax,%edx
+  2016e6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  2016e9:	01 c2                	add    %eax,%edx
+  2016eb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  2016ef:	89 10                	mov    %edx,(%rax)
+    for (; *str; str++) {
+  2016f1:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  2016f6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2016fa:	0f b6 00             	movzbl (%rax),%eax
+  2016fd:	84 c0                	test   %al,%al
+  2016ff:	0f 85 34 ff ff ff    	jne    201639 <string_to_char+0x34>
+    }
+
+    return 0;
+  201705:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  20170a:	c9                   	leave
+  20170b:	c3                   	ret
+
+000000000020170c <atoi>:
+
+int atoi(const char *str) {
+  20170c:	55                   	push   %rbp
+  20170d:	48 89 e5             	mov    %rsp,%rbp
+  201710:	48 83 ec 18          	sub    $0x18,%rsp
+  201714:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    if (*str == '\0') return -1;
+  201718:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20171c:	0f b6 00             	movzbl (%rax),%eax
+  20171f:	84 c0                	test   %al,%al
+  201721:	75 0a                	jne    20172d <atoi+0x21>
+  201723:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  201728:	e9 d7 00 00 00       	jmp    201804 <atoi+0xf8>
+
+    int n = 0;
+  20172d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    for (; *str; str++) {
+  201734:	e9 b7 00 00 00       	jmp    2017f0 <atoi+0xe4>
+        int digit = 0;
+  201739:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+        switch (*str)
+  201740:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201744:	0f b6 00             	movzbl (%rax),%eax
+  201747:	0f be c0             	movsbl %al,%eax
+  20174a:	83 e8 30             	sub    $0x30,%eax
+  20174d:	83 f8 09             	cmp    $0x9,%eax
+  201750:	77 7c                	ja     2017ce <atoi+0xc2>
+  201752:	89 c0                	mov    %eax,%eax
+  201754:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  20175b:	00 
+  20175c:	48 8d 05 89 0c 00 00 	lea    0xc89(%rip),%rax        # 2023ec <flag_chars+0x11c>
+  201763:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+  201766:	48 98                	cltq
+  201768:	48 8d 15 7d 0c 00 00 	lea    0xc7d(%rip),%rdx        # 2023ec <flag_chars+0x11c>
+  20176f:	48 01 d0             	add    %rdx,%rax
+  201772:	ff e0                	jmp    *%rax
+        {
+        case '0':
+            digit = 0;
+  201774:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+            break;
+  20177b:	eb 58                	jmp    2017d5 <atoi+0xc9>
+        case '1':
+            digit = 1;
+  20177d:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+            break;
+  201784:	eb 4f                	jmp    2017d5 <atoi+0xc9>
+        case '2':
+            digit = 2;
+  201786:	c7 45 f8 02 00 00 00 	movl   $0x2,-0x8(%rbp)
+            break;
+  20178d:	eb 46                	jmp    2017d5 <atoi+0xc9>
+        case '3':
+            digit = 3;
+  20178f:	c7 45 f8 03 00 00 00 	movl   $0x3,-0x8(%rbp)
+            break;
+  201796:	eb 3d                	jmp    2017d5 <atoi+0xc9>
+        case '4':
+            digit = 4;
+  201798:	c7 45 f8 04 00 00 00 	movl   $0x4,-0x8(%rbp)
+            break;
+  20179f:	eb 34                	jmp    2017d5 <atoi+0xc9>
+        case '5':
+            digit = 5;
+  2017a1:	c7 45 f8 05 00 00 00 	movl   $0x5,-0x8(%rbp)
+            break;
+  2017a8:	eb 2b                	jmp    2017d5 <atoi+0xc9>
+        case '6':
+            digit = 6;
+  2017aa:	c7 45 f8 06 00 00 00 	movl   $0x6,-0x8(%rbp)
+            break;
+  2017b1:	eb 22                	jmp    2017d5 <atoi+0xc9>
+        case '7':
+            digit = 7;
+  2017b3:	c7 45 f8 07 00 00 00 	movl   $0x7,-0x8(%rbp)
+            break;
+  2017ba:	eb 19                	jmp    2017d5 <atoi+0xc9>
+        case '8':
+            digit = 8;
+  2017bc:	c7 45 f8 08 00 00 00 	movl   $0x8,-0x8(%rbp)
+            break;
+  2017c3:	eb 10                	jmp    2017d5 <atoi+0xc9>
+        case '9':
+            digit = 9;
+  2017c5:	c7 45 f8 09 00 00 00 	movl   $0x9,-0x8(%rbp)
+            break;
+  2017cc:	eb 07                	jmp    2017d5 <atoi+0xc9>
+        default:
+            return -1;
+  2017ce:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  2017d3:	eb 2f                	jmp    201804 <atoi+0xf8>
+        }
+
+        n = n * 10 + digit;
+  2017d5:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  2017d8:	89 d0                	mov    %edx,%eax
+  2017da:	c1 e0 02             	shl    $0x2,%eax
+  2017dd:	01 d0                	add    %edx,%eax
+  2017df:	01 c0                	add    %eax,%eax
+  2017e1:	89 c2                	mov    %eax,%edx
+  2017e3:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  2017e6:	01 d0                	add    %edx,%eax
+  2017e8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    for (; *str; str++) {
+  2017eb:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  2017f0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2017f4:	0f b6 00             	movzbl (%rax),%eax
+  2017f7:	84 c0                	test   %al,%al
+  2017f9:	0f 85 3a ff ff ff    	jne    201739 <atoi+0x2d>
+    }
+
+    return 0;
+  2017ff:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  201804:	c9                   	leave
+  201805:	c3                   	ret
+
+0000000000201806 <copy_comp>:
+        components[ncomp++] = (comp); \
+    } \
+} while (0)
+
+// Helper to copy a component to dst
+void copy_comp(const char *start, const char *end, char **pdst) {
+  201806:	55                   	push   %rbp
+  201807:	48 89 e5             	mov    %rsp,%rbp
+  20180a:	48 83 ec 18          	sub    $0x18,%rsp
+  20180e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  201812:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  201816:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    while (start < end) {
+  20181a:	eb 23                	jmp    20183f <copy_comp+0x39>
+        *(*pdst)++ = *start++;
+  20181c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  201820:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  201824:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  201828:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20182c:	48 8b 00             	mov    (%rax),%rax
+  20182f:	48 8d 70 01          	lea    0x1(%rax),%rsi
+  201833:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  201837:	48 89 31             	mov    %rsi,(%rcx)
+  20183a:	0f b6 12             	movzbl (%rdx),%edx
+  20183d:	88 10                	mov    %dl,(%rax)
+    while (start < end) {
+  20183f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  201843:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  201847:	72 d3                	jb     20181c <copy_comp+0x16>
+    }
+}
+  201849:	90                   	nop
+  20184a:	90                   	nop
+  20184b:	c9                   	leave
+  20184c:	c3                   	ret
+
+000000000020184d <join_path>:
+
+
+void join_path(const char *abs_path, const char *path, char *dst) {
+  20184d:	55                   	push   %rbp
+  20184e:	48 89 e5             	mov    %rsp,%rbp
+  201851:	48 81 ec 68 02 00 00 	sub    $0x268,%rsp
+  201858:	48 89 bd a8 fd ff ff 	mov    %rdi,-0x258(%rbp)
+  20185f:	48 89 b5 a0 fd ff ff 	mov    %rsi,-0x260(%rbp)
+  201866:	48 89 95 98 fd ff ff 	mov    %rdx,-0x268(%rbp)
+    // If path is absolute, just copy it to dst (removing duplicate slashes, and trailing slash unless root)
+    if (path[0] == '/') {
+  20186d:	48 8b 85 a0 fd ff ff 	mov    -0x260(%rbp),%rax
+  201874:	0f b6 00             	movzbl (%rax),%eax
+  201877:	3c 2f                	cmp    $0x2f,%al
+  201879:	0f 85 d6 00 00 00    	jne    201955 <join_path+0x108>
+        const char *src = path;
+  20187f:	48 8b 85 a0 fd ff ff 	mov    -0x260(%rbp),%rax
+  201886:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+        char *d = dst;
+  20188a:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  201891:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+        // Always start with a single slash
+        *d++ = '/';
+  201895:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  201899:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  20189d:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  2018a1:	c6 00 2f             	movb   $0x2f,(%rax)
+        src++;
+  2018a4:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+        int last_was_slash = 1;
+  2018a9:	c7 45 b0 01 00 00 00 	movl   $0x1,-0x50(%rbp)
+        while (*src) {
+  2018b0:	eb 64                	jmp    201916 <join_path+0xc9>
+            if (*src == '/') {
+  2018b2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2018b6:	0f b6 00             	movzbl (%rax),%eax
+  2018b9:	3c 2f                	cmp    $0x2f,%al
+  2018bb:	75 35                	jne    2018f2 <join_path+0xa5>
+                // Skip consecutive slashes
+                while (*src == '/') src++;
+  2018bd:	eb 05                	jmp    2018c4 <join_path+0x77>
+  2018bf:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  2018c4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2018c8:	0f b6 00             	movzbl (%rax),%eax
+  2018cb:	3c 2f                	cmp    $0x2f,%al
+  2018cd:	74 f0                	je     2018bf <join_path+0x72>
+                if (*src == 0) break;
+  2018cf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2018d3:	0f b6 00             	movzbl (%rax),%eax
+  2018d6:	84 c0                	test   %al,%al
+  2018d8:	74 49                	je     201923 <join_path+0xd6>
+                *d++ = '/';
+  2018da:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2018de:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  2018e2:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  2018e6:	c6 00 2f             	movb   $0x2f,(%rax)
+                last_was_slash = 1;
+  2018e9:	c7 45 b0 01 00 00 00 	movl   $0x1,-0x50(%rbp)
+  2018f0:	eb 24                	jmp    201916 <join_path+0xc9>
+            } else {
+                *d++ = *src++;
+  2018f2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  2018f6:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  2018fa:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  2018fe:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  201902:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  201906:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  20190a:	0f b6 12             	movzbl (%rdx),%edx
+  20190d:	88 10                	mov    %dl,(%rax)
+                last_was_slash = 0;
+  20190f:	c7 45 b0 00 00 00 00 	movl   $0x0,-0x50(%rbp)
+        while (*src) {
+  201916:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20191a:	0f b6 00             	movzbl (%rax),%eax
+  20191d:	84 c0                	test   %al,%al
+  20191f:	75 91                	jne    2018b2 <join_path+0x65>
+  201921:	eb 01                	jmp    201924 <join_path+0xd7>
+                if (*src == 0) break;
+  201923:	90                   	nop
+            }
+        }
+        // Remove trailing slash unless the path is just "/"
+        if (d > dst + 1 && *(d-1) == '/') {
+  201924:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  20192b:	48 83 c0 01          	add    $0x1,%rax
+  20192f:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  201933:	73 14                	jae    201949 <join_path+0xfc>
+  201935:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  201939:	48 83 e8 01          	sub    $0x1,%rax
+  20193d:	0f b6 00             	movzbl (%rax),%eax
+  201940:	3c 2f                	cmp    $0x2f,%al
+  201942:	75 05                	jne    201949 <join_path+0xfc>
+            d--;
+  201944:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+        }
+        *d = 0;
+  201949:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  20194d:	c6 00 00             	movb   $0x0,(%rax)
+  201950:	e9 e9 02 00 00       	jmp    201c3e <join_path+0x3f1>
+        return;
+    }
+
+    // Otherwise, start with abs_path
+    const char *src = abs_path;
+  201955:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  20195c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    char *d = dst;
+  201960:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  201967:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    if (*src != '/') {
+  20196b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20196f:	0f b6 00             	movzbl (%rax),%eax
+  201972:	3c 2f                	cmp    $0x2f,%al
+  201974:	74 2e                	je     2019a4 <join_path+0x157>
+        *d++ = '/';
+  201976:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  20197a:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  20197e:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  201982:	c6 00 2f             	movb   $0x2f,(%rax)
+    }
+    while (*src) {
+  201985:	eb 1d                	jmp    2019a4 <join_path+0x157>
+        *d++ = *src++;
+  201987:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  20198b:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  20198f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  201993:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  201997:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  20199b:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  20199f:	0f b6 12             	movzbl (%rdx),%edx
+  2019a2:	88 10                	mov    %dl,(%rax)
+    while (*src) {
+  2019a4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2019a8:	0f b6 00             	movzbl (%rax),%eax
+  2019ab:	84 c0                	test   %al,%al
+  2019ad:	75 d8                	jne    201987 <join_path+0x13a>
+    }
+    // Remove trailing slash (unless root)
+    if (d > dst + 1 && *(d-1) == '/') {
+  2019af:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  2019b6:	48 83 c0 01          	add    $0x1,%rax
+  2019ba:	48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+  2019be:	73 14                	jae    2019d4 <join_path+0x187>
+  2019c0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  2019c4:	48 83 e8 01          	sub    $0x1,%rax
+  2019c8:	0f b6 00             	movzbl (%rax),%eax
+  2019cb:	3c 2f                	cmp    $0x2f,%al
+  2019cd:	75 05                	jne    2019d4 <join_path+0x187>
+        d--;
+  2019cf:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+    }
+    *d = 0;
+  2019d4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  2019d8:	c6 00 00             	movb   $0x0,(%rax)
+
+    // Now, process path components
+    char temp[512];
+    int tlen = 0;
+  2019db:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    // Copy dst to temp for easier manipulation
+    src = dst;
+  2019e2:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  2019e9:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    while (*src && tlen < (int)sizeof(temp)-1) {
+  2019ed:	eb 22                	jmp    201a11 <join_path+0x1c4>
+        temp[tlen++] = *src++;
+  2019ef:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2019f3:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  2019f7:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  2019fb:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  2019fe:	8d 4a 01             	lea    0x1(%rdx),%ecx
+  201a01:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  201a04:	0f b6 08             	movzbl (%rax),%ecx
+  201a07:	48 63 c2             	movslq %edx,%rax
+  201a0a:	88 8c 05 b0 fd ff ff 	mov    %cl,-0x250(%rbp,%rax,1)
+    while (*src && tlen < (int)sizeof(temp)-1) {
+  201a11:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201a15:	0f b6 00             	movzbl (%rax),%eax
+  201a18:	84 c0                	test   %al,%al
+  201a1a:	74 09                	je     201a25 <join_path+0x1d8>
+  201a1c:	81 7d dc fe 01 00 00 	cmpl   $0x1fe,-0x24(%rbp)
+  201a23:	7e ca                	jle    2019ef <join_path+0x1a2>
+    }
+    temp[tlen] = 0;
+  201a25:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201a28:	48 98                	cltq
+  201a2a:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  201a31:	00 
+
+    // Now, process each component in path
+    src = path;
+  201a32:	48 8b 85 a0 fd ff ff 	mov    -0x260(%rbp),%rax
+  201a39:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    while (*src) {
+  201a3d:	e9 65 01 00 00       	jmp    201ba7 <join_path+0x35a>
+        // Skip slashes
+        while (*src == '/') src++;
+  201a42:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  201a47:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201a4b:	0f b6 00             	movzbl (%rax),%eax
+  201a4e:	3c 2f                	cmp    $0x2f,%al
+  201a50:	74 f0                	je     201a42 <join_path+0x1f5>
+        if (!*src) break;
+  201a52:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201a56:	0f b6 00             	movzbl (%rax),%eax
+  201a59:	84 c0                	test   %al,%al
+  201a5b:	0f 84 57 01 00 00    	je     201bb8 <join_path+0x36b>
+
+        // Find end of component
+        const char *comp_start = src;
+  201a61:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201a65:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        while (*src && *src != '/') src++;
+  201a69:	eb 05                	jmp    201a70 <join_path+0x223>
+  201a6b:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  201a70:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201a74:	0f b6 00             	movzbl (%rax),%eax
+  201a77:	84 c0                	test   %al,%al
+  201a79:	74 0b                	je     201a86 <join_path+0x239>
+  201a7b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201a7f:	0f b6 00             	movzbl (%rax),%eax
+  201a82:	3c 2f                	cmp    $0x2f,%al
+  201a84:	75 e5                	jne    201a6b <join_path+0x21e>
+        const char *comp_end = src;
+  201a86:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201a8a:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+
+        int comp_len = comp_end - comp_start;
+  201a8e:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  201a92:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  201a96:	89 45 b4             	mov    %eax,-0x4c(%rbp)
+
+        // Get component string
+        if (comp_len == 1 && comp_start[0] == '.') {
+  201a99:	83 7d b4 01          	cmpl   $0x1,-0x4c(%rbp)
+  201a9d:	75 10                	jne    201aaf <join_path+0x262>
+  201a9f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  201aa3:	0f b6 00             	movzbl (%rax),%eax
+  201aa6:	3c 2e                	cmp    $0x2e,%al
+  201aa8:	75 05                	jne    201aaf <join_path+0x262>
+            // Ignore
+            continue;
+  201aaa:	e9 f8 00 00 00       	jmp    201ba7 <join_path+0x35a>
+        } else if (comp_len == 2 && comp_start[0] == '.' && comp_start[1] == '.') {
+  201aaf:	83 7d b4 02          	cmpl   $0x2,-0x4c(%rbp)
+  201ab3:	75 6e                	jne    201b23 <join_path+0x2d6>
+  201ab5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  201ab9:	0f b6 00             	movzbl (%rax),%eax
+  201abc:	3c 2e                	cmp    $0x2e,%al
+  201abe:	75 63                	jne    201b23 <join_path+0x2d6>
+  201ac0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  201ac4:	48 83 c0 01          	add    $0x1,%rax
+  201ac8:	0f b6 00             	movzbl (%rax),%eax
+  201acb:	3c 2e                	cmp    $0x2e,%al
+  201acd:	75 54                	jne    201b23 <join_path+0x2d6>
+            // Go up one directory, unless at root
+            if (tlen > 1) {
+  201acf:	83 7d dc 01          	cmpl   $0x1,-0x24(%rbp)
+  201ad3:	0f 8e ce 00 00 00    	jle    201ba7 <join_path+0x35a>
+                // Remove trailing slash if any
+                if (temp[tlen-1] == '/') tlen--;
+  201ad9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201adc:	83 e8 01             	sub    $0x1,%eax
+  201adf:	48 98                	cltq
+  201ae1:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  201ae8:	ff 
+  201ae9:	3c 2f                	cmp    $0x2f,%al
+  201aeb:	75 0a                	jne    201af7 <join_path+0x2aa>
+  201aed:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+                // Remove last component
+                while (tlen > 1 && temp[tlen-1] != '/') tlen--;
+  201af1:	eb 04                	jmp    201af7 <join_path+0x2aa>
+  201af3:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  201af7:	83 7d dc 01          	cmpl   $0x1,-0x24(%rbp)
+  201afb:	7e 14                	jle    201b11 <join_path+0x2c4>
+  201afd:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201b00:	83 e8 01             	sub    $0x1,%eax
+  201b03:	48 98                	cltq
+  201b05:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  201b0c:	ff 
+  201b0d:	3c 2f                	cmp    $0x2f,%al
+  201b0f:	75 e2                	jne    201af3 <join_path+0x2a6>
+                temp[tlen] = 0;
+  201b11:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201b14:	48 98                	cltq
+  201b16:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  201b1d:	00 
+            if (tlen > 1) {
+  201b1e:	e9 84 00 00 00       	jmp    201ba7 <join_path+0x35a>
+            }
+        } else if (comp_len > 0) {
+  201b23:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  201b27:	7e 7e                	jle    201ba7 <join_path+0x35a>
+            // Add slash if not at root
+            if (tlen == 0 || temp[tlen-1] != '/') {
+  201b29:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  201b2d:	74 14                	je     201b43 <join_path+0x2f6>
+  201b2f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201b32:	83 e8 01             	sub    $0x1,%eax
+  201b35:	48 98                	cltq
+  201b37:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  201b3e:	ff 
+  201b3f:	3c 2f                	cmp    $0x2f,%al
+  201b41:	74 1c                	je     201b5f <join_path+0x312>
+                if (tlen < (int)sizeof(temp)-1) temp[tlen++] = '/';
+  201b43:	81 7d dc fe 01 00 00 	cmpl   $0x1fe,-0x24(%rbp)
+  201b4a:	7f 13                	jg     201b5f <join_path+0x312>
+  201b4c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201b4f:	8d 50 01             	lea    0x1(%rax),%edx
+  201b52:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  201b55:	48 98                	cltq
+  201b57:	c6 84 05 b0 fd ff ff 	movb   $0x2f,-0x250(%rbp,%rax,1)
+  201b5e:	2f 
+            }
+            // Copy component
+            for (const char *p = comp_start; p < comp_end && tlen < (int)sizeof(temp)-1; ++p) {
+  201b5f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  201b63:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  201b67:	eb 1e                	jmp    201b87 <join_path+0x33a>
+                temp[tlen++] = *p;
+  201b69:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201b6c:	8d 50 01             	lea    0x1(%rax),%edx
+  201b6f:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  201b72:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  201b76:	0f b6 12             	movzbl (%rdx),%edx
+  201b79:	48 98                	cltq
+  201b7b:	88 94 05 b0 fd ff ff 	mov    %dl,-0x250(%rbp,%rax,1)
+            for (const char *p = comp_start; p < comp_end && tlen < (int)sizeof(temp)-1; ++p) {
+  201b82:	48 83 45 d0 01       	addq   $0x1,-0x30(%rbp)
+  201b87:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  201b8b:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  201b8f:	73 09                	jae    201b9a <join_path+0x34d>
+  201b91:	81 7d dc fe 01 00 00 	cmpl   $0x1fe,-0x24(%rbp)
+  201b98:	7e cf                	jle    201b69 <join_path+0x31c>
+            }
+            temp[tlen] = 0;
+  201b9a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201b9d:	48 98                	cltq
+  201b9f:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  201ba6:	00 
+    while (*src) {
+  201ba7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201bab:	0f b6 00             	movzbl (%rax),%eax
+  201bae:	84 c0                	test   %al,%al
+  201bb0:	0f 85 91 fe ff ff    	jne    201a47 <join_path+0x1fa>
+  201bb6:	eb 01                	jmp    201bb9 <join_path+0x36c>
+        if (!*src) break;
+  201bb8:	90                   	nop
+        }
+    }
+
+    // If temp is empty, set to "/"
+    if (tlen == 0) {
+  201bb9:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  201bbd:	75 20                	jne    201bdf <join_path+0x392>
+        temp[tlen++] = '/';
+  201bbf:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201bc2:	8d 50 01             	lea    0x1(%rax),%edx
+  201bc5:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  201bc8:	48 98                	cltq
+  201bca:	c6 84 05 b0 fd ff ff 	movb   $0x2f,-0x250(%rbp,%rax,1)
+  201bd1:	2f 
+        temp[tlen] = 0;
+  201bd2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201bd5:	48 98                	cltq
+  201bd7:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  201bde:	00 
+    }
+
+    // Remove trailing slash unless the path is just "/"
+    if (tlen > 1 && temp[tlen-1] == '/') {
+  201bdf:	83 7d dc 01          	cmpl   $0x1,-0x24(%rbp)
+  201be3:	7e 25                	jle    201c0a <join_path+0x3bd>
+  201be5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201be8:	83 e8 01             	sub    $0x1,%eax
+  201beb:	48 98                	cltq
+  201bed:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  201bf4:	ff 
+  201bf5:	3c 2f                	cmp    $0x2f,%al
+  201bf7:	75 11                	jne    201c0a <join_path+0x3bd>
+        temp[--tlen] = 0;
+  201bf9:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  201bfd:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201c00:	48 98                	cltq
+  201c02:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  201c09:	00 
+    }
+
+    // Copy temp to dst
+    for (int i = 0; i <= tlen; ++i) {
+  201c0a:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  201c11:	eb 23                	jmp    201c36 <join_path+0x3e9>
+        dst[i] = temp[i];
+  201c13:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  201c16:	48 63 d0             	movslq %eax,%rdx
+  201c19:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  201c20:	48 01 c2             	add    %rax,%rdx
+  201c23:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  201c26:	48 98                	cltq
+  201c28:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  201c2f:	ff 
+  201c30:	88 02                	mov    %al,(%rdx)
+    for (int i = 0; i <= tlen; ++i) {
+  201c32:	83 45 cc 01          	addl   $0x1,-0x34(%rbp)
+  201c36:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  201c39:	3b 45 dc             	cmp    -0x24(%rbp),%eax
+  201c3c:	7e d5                	jle    201c13 <join_path+0x3c6>
+    }
+}
+  201c3e:	c9                   	leave
+  201c3f:	c3                   	ret
+
+0000000000201c40 <app_printf>:
+#include "lib-malloc.h"
+#include "errno.h"
+// app_printf
+//     A version of console_printf that picks a sensible color by process ID.
+
+void app_printf(int colorid, const char* format, ...) {
+  201c40:	55                   	push   %rbp
+  201c41:	48 89 e5             	mov    %rsp,%rbp
+  201c44:	48 83 ec 50          	sub    $0x50,%rsp
+  201c48:	49 89 f2             	mov    %rsi,%r10
+  201c4b:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  201c4f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  201c53:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  201c57:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    int color;
+    if (colorid < 0) {
+        color = 0x0700;
+  201c5b:	be 00 07 00 00       	mov    $0x700,%esi
+    if (colorid < 0) {
+  201c60:	85 ff                	test   %edi,%edi
+  201c62:	78 32                	js     201c96 <app_printf+0x56>
+    } else {
+        static const uint8_t col[] = { 0x0F, 0x0C, 0x0A, 0x09, 0x0E };
+        color = col[colorid % sizeof(col)] << 8;
+  201c64:	48 63 ff             	movslq %edi,%rdi
+  201c67:	48 ba cd cc cc cc cc 	movabs $0xcccccccccccccccd,%rdx
+  201c6e:	cc cc cc 
+  201c71:	48 89 f8             	mov    %rdi,%rax
+  201c74:	48 f7 e2             	mul    %rdx
+  201c77:	48 89 d0             	mov    %rdx,%rax
+  201c7a:	48 c1 e8 02          	shr    $0x2,%rax
+  201c7e:	48 83 e2 fc          	and    $0xfffffffffffffffc,%rdx
+  201c82:	48 01 c2             	add    %rax,%rdx
+  201c85:	48 29 d7             	sub    %rdx,%rdi
+  201c88:	48 8d 05 89 09 00 00 	lea    0x989(%rip),%rax        # 202618 <col.0>
+  201c8f:	0f b6 34 38          	movzbl (%rax,%rdi,1),%esi
+  201c93:	c1 e6 08             	shl    $0x8,%esi
+    }
+
+    va_list val;
+    va_start(val, format);
+  201c96:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  201c9d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  201ca1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  201ca5:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  201ca9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    cursorpos = console_vprintf(cursorpos, color, format, val);
+  201cad:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  201cb1:	4c 89 d2             	mov    %r10,%rdx
+  201cb4:	8b 3d 42 73 eb ff    	mov    -0x148cbe(%rip),%edi        # b8ffc <cursorpos>
+  201cba:	e8 24 f7 ff ff       	call   2013e3 <console_vprintf>
+  201cbf:	89 05 37 73 eb ff    	mov    %eax,-0x148cc9(%rip)        # b8ffc <cursorpos>
+    va_end(val);
+
+    /*if (CROW(cursorpos) >= 23) {
+        cursorpos = CPOS(0, 0);
+    }*/
+}
+  201cc5:	c9                   	leave
+  201cc6:	c3                   	ret
+
+0000000000201cc7 <panic>:
+
+
+// panic, assert_fail
+//     Call the INT_SYS_PANIC system call so the kernel loops until Control-C.
+
+void panic(const char* format, ...) {
+  201cc7:	55                   	push   %rbp
+  201cc8:	48 89 e5             	mov    %rsp,%rbp
+  201ccb:	53                   	push   %rbx
+  201ccc:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  201cd3:	48 89 fb             	mov    %rdi,%rbx
+  201cd6:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  201cda:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  201cde:	48 89 4d d8          	mov    %rcx,-0x28(%rbp)
+  201ce2:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  201ce6:	4c 89 4d e8          	mov    %r9,-0x18(%rbp)
+    va_list val;
+    va_start(val, format);
+  201cea:	c7 45 a8 08 00 00 00 	movl   $0x8,-0x58(%rbp)
+  201cf1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  201cf5:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  201cf9:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  201cfd:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    char buf[160];
+    memcpy(buf, "PANIC: ", 7);
+  201d01:	48 8d bd 08 ff ff ff 	lea    -0xf8(%rbp),%rdi
+  201d08:	ba 07 00 00 00       	mov    $0x7,%edx
+  201d0d:	48 8d 35 3d 07 00 00 	lea    0x73d(%rip),%rsi        # 202451 <lower_digits.0+0x11>
+  201d14:	e8 31 e5 ff ff       	call   20024a <memcpy>
+    int len = vsnprintf(&buf[7], sizeof(buf) - 7, format, val) + 7;
+  201d19:	48 8d 4d a8          	lea    -0x58(%rbp),%rcx
+  201d1d:	48 8d bd 0f ff ff ff 	lea    -0xf1(%rbp),%rdi
+  201d24:	48 89 da             	mov    %rbx,%rdx
+  201d27:	be 99 00 00 00       	mov    $0x99,%esi
+  201d2c:	e8 cd f7 ff ff       	call   2014fe <vsnprintf>
+  201d31:	8d 50 07             	lea    0x7(%rax),%edx
+    va_end(val);
+    if (len > 0 && buf[len - 1] != '\n') {
+  201d34:	85 d2                	test   %edx,%edx
+  201d36:	7e 0f                	jle    201d47 <panic+0x80>
+  201d38:	83 c0 06             	add    $0x6,%eax
+  201d3b:	48 98                	cltq
+  201d3d:	80 bc 05 08 ff ff ff 	cmpb   $0xa,-0xf8(%rbp,%rax,1)
+  201d44:	0a 
+  201d45:	75 30                	jne    201d77 <panic+0xb0>
+        strcpy(buf + len - (len == (int) sizeof(buf) - 1), "\n");
+    }
+    (void) console_printf(CPOS(23, 0), 0xC000, "%s", buf);
+  201d47:	48 8d 8d 08 ff ff ff 	lea    -0xf8(%rbp),%rcx
+  201d4e:	48 8d 15 04 07 00 00 	lea    0x704(%rip),%rdx        # 202459 <lower_digits.0+0x19>
+  201d55:	be 00 c0 00 00       	mov    $0xc000,%esi
+  201d5a:	bf 30 07 00 00       	mov    $0x730,%edi
+  201d5f:	b8 00 00 00 00       	mov    $0x0,%eax
+  201d64:	e8 f5 f6 ff ff       	call   20145e <console_printf>
+    asm volatile ("syscall" : "=a" (rax)
+  201d69:	b8 30 00 00 00       	mov    $0x30,%eax
+  201d6e:	bf 00 00 00 00       	mov    $0x0,%edi
+  201d73:	0f 05                	syscall
+ loop: goto loop;
+  201d75:	eb fe                	jmp    201d75 <panic+0xae>
+        strcpy(buf + len - (len == (int) sizeof(buf) - 1), "\n");
+  201d77:	48 63 c2             	movslq %edx,%rax
+  201d7a:	81 fa 9f 00 00 00    	cmp    $0x9f,%edx
+  201d80:	0f 94 c2             	sete   %dl
+  201d83:	0f b6 d2             	movzbl %dl,%edx
+  201d86:	48 29 d0             	sub    %rdx,%rax
+  201d89:	48 8d bc 05 08 ff ff 	lea    -0xf8(%rbp,%rax,1),%rdi
+  201d90:	ff 
+  201d91:	48 8d 35 9c 07 00 00 	lea    0x79c(%rip),%rsi        # 202534 <lower_digits.0+0xf4>
+  201d98:	e8 3b e8 ff ff       	call   2005d8 <strcpy>
+  201d9d:	eb a8                	jmp    201d47 <panic+0x80>
+
+0000000000201d9f <raise>:
+
+#define SIGABRT -1
+
+
+
+int raise(int sig) {
+  201d9f:	89 fe                	mov    %edi,%esi
+
+// getpid()
+//    Return current process ID, like sys_getpid().
+static inline pid_t getpid(void) {
+    return vdso()->pid;
+  201da1:	8b 3c 25 00 10 24 00 	mov    0x241000,%edi
+    asm volatile ("syscall" : "=a" (result)
+  201da8:	b8 41 00 00 00       	mov    $0x41,%eax
+  201dad:	0f 05                	syscall
+    return sys_kill(getpid(), sig);
+}
+  201daf:	c3                   	ret
+
+0000000000201db0 <abort>:
+    return vdso()->pid;
+  201db0:	8b 3c 25 00 10 24 00 	mov    0x241000,%edi
+    asm volatile ("syscall" : "=a" (result)
+  201db7:	b8 41 00 00 00       	mov    $0x41,%eax
+  201dbc:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  201dc1:	0f 05                	syscall
+
+void __attribute((noreturn)) abort(void) {
+    raise(SIGABRT);
+ spinloop: goto spinloop;       // should never get here
+  201dc3:	eb fe                	jmp    201dc3 <abort+0x13>
+
+0000000000201dc5 <assert_fail>:
+}
+
+
+void assert_fail(const char* file, int line, const char* msg) {
+  201dc5:	55                   	push   %rbp
+  201dc6:	48 89 e5             	mov    %rsp,%rbp
+  201dc9:	48 89 f9             	mov    %rdi,%rcx
+  201dcc:	41 89 f0             	mov    %esi,%r8d
+  201dcf:	49 89 d1             	mov    %rdx,%r9
+    (void) console_printf(CPOS(23, 0), 0xC000,
+  201dd2:	48 8d 15 5f 07 00 00 	lea    0x75f(%rip),%rdx        # 202538 <lower_digits.0+0xf8>
+  201dd9:	be 00 c0 00 00       	mov    $0xc000,%esi
+  201dde:	bf 30 07 00 00       	mov    $0x730,%edi
+  201de3:	b8 00 00 00 00       	mov    $0x0,%eax
+  201de8:	e8 71 f6 ff ff       	call   20145e <console_printf>
+                          "PANIC: %s:%d: assertion '%s' failed\n",
+                          file, line, msg);
+    abort();
+  201ded:	e8 be ff ff ff       	call   201db0 <abort>
+
+0000000000201df2 <scan_char>:
+    asm volatile ("syscall" : "=a" (result)
+  201df2:	bf 3a 00 00 00       	mov    $0x3a,%edi
+    asm volatile ("syscall" : "=a" (rax)
+  201df7:	be 3c 00 00 00       	mov    $0x3c,%esi
+    asm volatile ("syscall" : "=a" (result)
+  201dfc:	89 f8                	mov    %edi,%eax
+  201dfe:	0f 05                	syscall
+  201e00:	89 c2                	mov    %eax,%edx
+    asm volatile ("syscall" : "=a" (rax)
+  201e02:	89 f0                	mov    %esi,%eax
+  201e04:	0f 05                	syscall
+    int c;
+
+    do {
+        c = sys_keybord();
+        sys_yield();
+    } while (c == -1);
+  201e06:	83 fa ff             	cmp    $0xffffffff,%edx
+  201e09:	74 f1                	je     201dfc <scan_char+0xa>
+
+    return c;
+  201e0b:	89 d0                	mov    %edx,%eax
+}
+  201e0d:	c3                   	ret
+
+0000000000201e0e <scan_line>:
+
+unsigned int scan_line(char* dst, unsigned int length_max) {
+  201e0e:	55                   	push   %rbp
+  201e0f:	48 89 e5             	mov    %rsp,%rbp
+  201e12:	41 57                	push   %r15
+  201e14:	41 56                	push   %r14
+  201e16:	41 55                	push   %r13
+  201e18:	41 54                	push   %r12
+  201e1a:	53                   	push   %rbx
+  201e1b:	48 83 ec 08          	sub    $0x8,%rsp
+  201e1f:	49 89 fe             	mov    %rdi,%r14
+  201e22:	41 89 f5             	mov    %esi,%r13d
+    unsigned int length = 0;
+  201e25:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            app_printf(0, "%c", c);
+            dst[length] = '\0';
+            return length;
+        } else if (c >= 32 && c <= 127) {
+            if (length < length_max) {
+                app_printf(0, "%c", c);
+  201e2b:	4c 8d 3d 2a 06 00 00 	lea    0x62a(%rip),%r15        # 20245c <lower_digits.0+0x1c>
+  201e32:	eb 05                	jmp    201e39 <scan_line+0x2b>
+            if (length != 0) {
+  201e34:	45 85 e4             	test   %r12d,%r12d
+  201e37:	75 3e                	jne    201e77 <scan_line+0x69>
+        unsigned char c = scan_char();
+  201e39:	e8 b4 ff ff ff       	call   201df2 <scan_char>
+  201e3e:	89 c3                	mov    %eax,%ebx
+        if (c == '\b') {
+  201e40:	3c 08                	cmp    $0x8,%al
+  201e42:	74 f0                	je     201e34 <scan_line+0x26>
+        } else if (c == '\n') {
+  201e44:	3c 0a                	cmp    $0xa,%al
+  201e46:	74 4c                	je     201e94 <scan_line+0x86>
+        } else if (c >= 32 && c <= 127) {
+  201e48:	8d 43 e0             	lea    -0x20(%rbx),%eax
+            if (length < length_max) {
+  201e4b:	3c 5f                	cmp    $0x5f,%al
+  201e4d:	77 ea                	ja     201e39 <scan_line+0x2b>
+  201e4f:	45 39 ec             	cmp    %r13d,%r12d
+  201e52:	73 e5                	jae    201e39 <scan_line+0x2b>
+                app_printf(0, "%c", c);
+  201e54:	0f b6 d3             	movzbl %bl,%edx
+  201e57:	4c 89 fe             	mov    %r15,%rsi
+  201e5a:	bf 00 00 00 00       	mov    $0x0,%edi
+  201e5f:	b8 00 00 00 00       	mov    $0x0,%eax
+  201e64:	e8 d7 fd ff ff       	call   201c40 <app_printf>
+                dst[length++] = c;
+  201e69:	44 89 e0             	mov    %r12d,%eax
+  201e6c:	41 88 1c 06          	mov    %bl,(%r14,%rax,1)
+  201e70:	45 8d 64 24 01       	lea    0x1(%r12),%r12d
+  201e75:	eb c2                	jmp    201e39 <scan_line+0x2b>
+                app_printf(0, "%c", c);
+  201e77:	ba 08 00 00 00       	mov    $0x8,%edx
+  201e7c:	4c 89 fe             	mov    %r15,%rsi
+  201e7f:	bf 00 00 00 00       	mov    $0x0,%edi
+  201e84:	b8 00 00 00 00       	mov    $0x0,%eax
+  201e89:	e8 b2 fd ff ff       	call   201c40 <app_printf>
+                length--;
+  201e8e:	41 83 ec 01          	sub    $0x1,%r12d
+  201e92:	eb a5                	jmp    201e39 <scan_line+0x2b>
+            app_printf(0, "%c", c);
+  201e94:	ba 0a 00 00 00       	mov    $0xa,%edx
+  201e99:	48 8d 35 bc 05 00 00 	lea    0x5bc(%rip),%rsi        # 20245c <lower_digits.0+0x1c>
+  201ea0:	bf 00 00 00 00       	mov    $0x0,%edi
+  201ea5:	b8 00 00 00 00       	mov    $0x0,%eax
+  201eaa:	e8 91 fd ff ff       	call   201c40 <app_printf>
+            dst[length] = '\0';
+  201eaf:	44 89 e0             	mov    %r12d,%eax
+  201eb2:	41 c6 04 06 00       	movb   $0x0,(%r14,%rax,1)
+            }
+        }
+    }
+}
+  201eb7:	44 89 e0             	mov    %r12d,%eax
+  201eba:	48 83 c4 08          	add    $0x8,%rsp
+  201ebe:	5b                   	pop    %rbx
+  201ebf:	41 5c                	pop    %r12
+  201ec1:	41 5d                	pop    %r13
+  201ec3:	41 5e                	pop    %r14
+  201ec5:	41 5f                	pop    %r15
+  201ec7:	5d                   	pop    %rbp
+  201ec8:	c3                   	ret
+
+0000000000201ec9 <split_string>:
+
+
+char** split_string(char* str, char sep) {
+  201ec9:	55                   	push   %rbp
+  201eca:	48 89 e5             	mov    %rsp,%rbp
+  201ecd:	41 57                	push   %r15
+  201ecf:	41 56                	push   %r14
+  201ed1:	41 55                	push   %r13
+  201ed3:	41 54                	push   %r12
+  201ed5:	53                   	push   %rbx
+  201ed6:	48 83 ec 08          	sub    $0x8,%rsp
+    int s = 1;
+    int n = 0;
+
+    while (str[n]) {
+  201eda:	0f b6 07             	movzbl (%rdi),%eax
+  201edd:	84 c0                	test   %al,%al
+  201edf:	0f 84 ad 00 00 00    	je     201f92 <split_string+0xc9>
+  201ee5:	48 89 fb             	mov    %rdi,%rbx
+  201ee8:	41 89 f4             	mov    %esi,%r12d
+  201eeb:	41 be 01 00 00 00    	mov    $0x1,%r14d
+    int s = 1;
+  201ef1:	b9 01 00 00 00       	mov    $0x1,%ecx
+  201ef6:	eb 03                	jmp    201efb <split_string+0x32>
+  201ef8:	49 89 d6             	mov    %rdx,%r14
+        if (str[n] == sep)
+            s++;
+  201efb:	41 38 c4             	cmp    %al,%r12b
+  201efe:	0f 94 c0             	sete   %al
+  201f01:	0f b6 c0             	movzbl %al,%eax
+  201f04:	01 c1                	add    %eax,%ecx
+    while (str[n]) {
+  201f06:	49 8d 56 01          	lea    0x1(%r14),%rdx
+  201f0a:	0f b6 44 13 ff       	movzbl -0x1(%rbx,%rdx,1),%eax
+  201f0f:	84 c0                	test   %al,%al
+  201f11:	75 e5                	jne    201ef8 <split_string+0x2f>
+        n++;
+    }
+    
+    char** part = malloc((s+1)*sizeof(char*));
+  201f13:	44 8d 79 01          	lea    0x1(%rcx),%r15d
+  201f17:	4d 63 ff             	movslq %r15d,%r15
+  201f1a:	49 c1 e7 03          	shl    $0x3,%r15
+  201f1e:	4c 89 ff             	mov    %r15,%rdi
+  201f21:	e8 69 02 00 00       	call   20218f <malloc>
+  201f26:	49 89 c5             	mov    %rax,%r13
+    char* buffer = malloc(n+1);
+  201f29:	41 8d 7e 01          	lea    0x1(%r14),%edi
+  201f2d:	48 63 ff             	movslq %edi,%rdi
+  201f30:	e8 5a 02 00 00       	call   20218f <malloc>
+
+    int word_n = 0;
+    part[0] = buffer;
+  201f35:	49 89 45 00          	mov    %rax,0x0(%r13)
+    part[s] = NULL;
+  201f39:	4b c7 44 3d f8 00 00 	movq   $0x0,-0x8(%r13,%r15,1)
+  201f40:	00 00 
+    buffer[n] = 0;
+  201f42:	42 c6 04 30 00       	movb   $0x0,(%rax,%r14,1)
+
+    for (int i = 0; i < n; i++) {
+  201f47:	45 85 f6             	test   %r14d,%r14d
+  201f4a:	7e 6c                	jle    201fb8 <split_string+0xef>
+  201f4c:	41 83 ee 01          	sub    $0x1,%r14d
+  201f50:	48 89 da             	mov    %rbx,%rdx
+  201f53:	48 83 c0 01          	add    $0x1,%rax
+  201f57:	48 89 c1             	mov    %rax,%rcx
+    int word_n = 0;
+  201f5a:	bf 00 00 00 00       	mov    $0x0,%edi
+  201f5f:	eb 23                	jmp    201f84 <split_string+0xbb>
+        if (str[i] == sep) {
+            buffer[i] = 0;
+  201f61:	c6 41 ff 00          	movb   $0x0,-0x1(%rcx)
+            part[++word_n] = &buffer[i+1];
+  201f65:	83 c7 01             	add    $0x1,%edi
+  201f68:	48 63 f7             	movslq %edi,%rsi
+  201f6b:	49 89 4c f5 00       	mov    %rcx,0x0(%r13,%rsi,8)
+    for (int i = 0; i < n; i++) {
+  201f70:	48 83 c2 01          	add    $0x1,%rdx
+  201f74:	48 83 c1 01          	add    $0x1,%rcx
+  201f78:	89 ce                	mov    %ecx,%esi
+  201f7a:	29 c6                	sub    %eax,%esi
+  201f7c:	83 ee 01             	sub    $0x1,%esi
+  201f7f:	44 39 f6             	cmp    %r14d,%esi
+  201f82:	7d 34                	jge    201fb8 <split_string+0xef>
+        if (str[i] == sep) {
+  201f84:	0f b6 32             	movzbl (%rdx),%esi
+  201f87:	44 38 e6             	cmp    %r12b,%sil
+  201f8a:	74 d5                	je     201f61 <split_string+0x98>
+        } else {
+            buffer[i] = str[i];
+  201f8c:	40 88 71 ff          	mov    %sil,-0x1(%rcx)
+  201f90:	eb de                	jmp    201f70 <split_string+0xa7>
+    char** part = malloc((s+1)*sizeof(char*));
+  201f92:	bf 10 00 00 00       	mov    $0x10,%edi
+  201f97:	e8 f3 01 00 00       	call   20218f <malloc>
+  201f9c:	49 89 c5             	mov    %rax,%r13
+    char* buffer = malloc(n+1);
+  201f9f:	bf 01 00 00 00       	mov    $0x1,%edi
+  201fa4:	e8 e6 01 00 00       	call   20218f <malloc>
+    part[0] = buffer;
+  201fa9:	49 89 45 00          	mov    %rax,0x0(%r13)
+    part[s] = NULL;
+  201fad:	49 c7 45 08 00 00 00 	movq   $0x0,0x8(%r13)
+  201fb4:	00 
+    buffer[n] = 0;
+  201fb5:	c6 00 00             	movb   $0x0,(%rax)
+        }
+    }
+
+    return part;
+}
+  201fb8:	4c 89 e8             	mov    %r13,%rax
+  201fbb:	48 83 c4 08          	add    $0x8,%rsp
+  201fbf:	5b                   	pop    %rbx
+  201fc0:	41 5c                	pop    %r12
+  201fc2:	41 5d                	pop    %r13
+  201fc4:	41 5e                	pop    %r14
+  201fc6:	41 5f                	pop    %r15
+  201fc8:	5d                   	pop    %rbp
+  201fc9:	c3                   	ret
+
+0000000000201fca <app_print_error>:
+
+
+void app_print_error(int r) {
+  201fca:	55                   	push   %rbp
+  201fcb:	48 89 e5             	mov    %rsp,%rbp
+    switch (r) {
+  201fce:	83 ff 24             	cmp    $0x24,%edi
+  201fd1:	0f 87 79 01 00 00    	ja     202150 <app_print_error+0x186>
+  201fd7:	89 f8                	mov    %edi,%eax
+  201fd9:	48 8d 15 a4 05 00 00 	lea    0x5a4(%rip),%rdx        # 202584 <lower_digits.0+0x144>
+  201fe0:	48 63 04 82          	movslq (%rdx,%rax,4),%rax
+  201fe4:	48 01 d0             	add    %rdx,%rax
+  201fe7:	ff e0                	jmp    *%rax
+        case ENOENT:
+            app_printf(1, "Error: %s\n", "No such file or directory");
+  201fe9:	48 8d 15 6f 04 00 00 	lea    0x46f(%rip),%rdx        # 20245f <lower_digits.0+0x1f>
+  201ff0:	48 8d 35 82 04 00 00 	lea    0x482(%rip),%rsi        # 202479 <lower_digits.0+0x39>
+  201ff7:	bf 01 00 00 00       	mov    $0x1,%edi
+  201ffc:	b8 00 00 00 00       	mov    $0x0,%eax
+  202001:	e8 3a fc ff ff       	call   201c40 <app_printf>
+            break;
+        default:
+            app_printf(1, "Error %d: %s\n", r, "Unknown error");
+            break;
+    }
+}
+  202006:	5d                   	pop    %rbp
+  202007:	c3                   	ret
+            app_printf(1, "Error: %s\n", "I/O error");
+  202008:	48 8d 15 75 04 00 00 	lea    0x475(%rip),%rdx        # 202484 <lower_digits.0+0x44>
+  20200f:	48 8d 35 63 04 00 00 	lea    0x463(%rip),%rsi        # 202479 <lower_digits.0+0x39>
+  202016:	bf 01 00 00 00       	mov    $0x1,%edi
+  20201b:	b8 00 00 00 00       	mov    $0x0,%eax
+  202020:	e8 1b fc ff ff       	call   201c40 <app_printf>
+            break;
+  202025:	eb df                	jmp    202006 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Exec format error");
+  202027:	48 8d 15 60 04 00 00 	lea    0x460(%rip),%rdx        # 20248e <lower_digits.0+0x4e>
+  20202e:	48 8d 35 44 04 00 00 	lea    0x444(%rip),%rsi        # 202479 <lower_digits.0+0x39>
+  202035:	bf 01 00 00 00       	mov    $0x1,%edi
+  20203a:	b8 00 00 00 00       	mov    $0x0,%eax
+  20203f:	e8 fc fb ff ff       	call   201c40 <app_printf>
+            break;
+  202044:	eb c0                	jmp    202006 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Resource temporarily unavailable");
+  202046:	48 8d 15 13 05 00 00 	lea    0x513(%rip),%rdx        # 202560 <lower_digits.0+0x120>
+  20204d:	48 8d 35 25 04 00 00 	lea    0x425(%rip),%rsi        # 202479 <lower_digits.0+0x39>
+  202054:	bf 01 00 00 00       	mov    $0x1,%edi
+  202059:	b8 00 00 00 00       	mov    $0x0,%eax
+  20205e:	e8 dd fb ff ff       	call   201c40 <app_printf>
+            break;
+  202063:	eb a1                	jmp    202006 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Out of memory");
+  202065:	48 8d 15 34 04 00 00 	lea    0x434(%rip),%rdx        # 2024a0 <lower_digits.0+0x60>
+  20206c:	48 8d 35 06 04 00 00 	lea    0x406(%rip),%rsi        # 202479 <lower_digits.0+0x39>
+  202073:	bf 01 00 00 00       	mov    $0x1,%edi
+  202078:	b8 00 00 00 00       	mov    $0x0,%eax
+  20207d:	e8 be fb ff ff       	call   201c40 <app_printf>
+            break;
+  202082:	eb 82                	jmp    202006 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Bad address");
+  202084:	48 8d 15 23 04 00 00 	lea    0x423(%rip),%rdx        # 2024ae <lower_digits.0+0x6e>
+  20208b:	48 8d 35 e7 03 00 00 	lea    0x3e7(%rip),%rsi        # 202479 <lower_digits.0+0x39>
+  202092:	bf 01 00 00 00       	mov    $0x1,%edi
+  202097:	b8 00 00 00 00       	mov    $0x0,%eax
+  20209c:	e8 9f fb ff ff       	call   201c40 <app_printf>
+            break;
+  2020a1:	e9 60 ff ff ff       	jmp    202006 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Not a directory");
+  2020a6:	48 8d 15 0d 04 00 00 	lea    0x40d(%rip),%rdx        # 2024ba <lower_digits.0+0x7a>
+  2020ad:	48 8d 35 c5 03 00 00 	lea    0x3c5(%rip),%rsi        # 202479 <lower_digits.0+0x39>
+  2020b4:	bf 01 00 00 00       	mov    $0x1,%edi
+  2020b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  2020be:	e8 7d fb ff ff       	call   201c40 <app_printf>
+            break;
+  2020c3:	e9 3e ff ff ff       	jmp    202006 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Invalid argument");
+  2020c8:	48 8d 15 fb 03 00 00 	lea    0x3fb(%rip),%rdx        # 2024ca <lower_digits.0+0x8a>
+  2020cf:	48 8d 35 a3 03 00 00 	lea    0x3a3(%rip),%rsi        # 202479 <lower_digits.0+0x39>
+  2020d6:	bf 01 00 00 00       	mov    $0x1,%edi
+  2020db:	b8 00 00 00 00       	mov    $0x0,%eax
+  2020e0:	e8 5b fb ff ff       	call   201c40 <app_printf>
+            break;
+  2020e5:	e9 1c ff ff ff       	jmp    202006 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "No space left on device");
+  2020ea:	48 8d 15 ea 03 00 00 	lea    0x3ea(%rip),%rdx        # 2024db <lower_digits.0+0x9b>
+  2020f1:	48 8d 35 81 03 00 00 	lea    0x381(%rip),%rsi        # 202479 <lower_digits.0+0x39>
+  2020f8:	bf 01 00 00 00       	mov    $0x1,%edi
+  2020fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  202102:	e8 39 fb ff ff       	call   201c40 <app_printf>
+            break;
+  202107:	e9 fa fe ff ff       	jmp    202006 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "File already exists");
+  20210c:	48 8d 15 e0 03 00 00 	lea    0x3e0(%rip),%rdx        # 2024f3 <lower_digits.0+0xb3>
+  202113:	48 8d 35 5f 03 00 00 	lea    0x35f(%rip),%rsi        # 202479 <lower_digits.0+0x39>
+  20211a:	bf 01 00 00 00       	mov    $0x1,%edi
+  20211f:	b8 00 00 00 00       	mov    $0x0,%eax
+  202124:	e8 17 fb ff ff       	call   201c40 <app_printf>
+            break;
+  202129:	e9 d8 fe ff ff       	jmp    202006 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "File name too long");
+  20212e:	48 8d 15 d2 03 00 00 	lea    0x3d2(%rip),%rdx        # 202507 <lower_digits.0+0xc7>
+  202135:	48 8d 35 3d 03 00 00 	lea    0x33d(%rip),%rsi        # 202479 <lower_digits.0+0x39>
+  20213c:	bf 01 00 00 00       	mov    $0x1,%edi
+  202141:	b8 00 00 00 00       	mov    $0x0,%eax
+  202146:	e8 f5 fa ff ff       	call   201c40 <app_printf>
+            break;
+  20214b:	e9 b6 fe ff ff       	jmp    202006 <app_print_error+0x3c>
+            app_printf(1, "Error %d: %s\n", r, "Unknown error");
+  202150:	48 8d 0d c3 03 00 00 	lea    0x3c3(%rip),%rcx        # 20251a <lower_digits.0+0xda>
+  202157:	89 fa                	mov    %edi,%edx
+  202159:	48 8d 35 c8 03 00 00 	lea    0x3c8(%rip),%rsi        # 202528 <lower_digits.0+0xe8>
+  202160:	bf 01 00 00 00       	mov    $0x1,%edi
+  202165:	b8 00 00 00 00       	mov    $0x0,%eax
+  20216a:	e8 d1 fa ff ff       	call   201c40 <app_printf>
+}
+  20216f:	e9 92 fe ff ff       	jmp    202006 <app_print_error+0x3c>
+
+0000000000202174 <handle_error>:
+
+__attribute__((noreturn)) void handle_error(int r) {
+  202174:	55                   	push   %rbp
+  202175:	48 89 e5             	mov    %rsp,%rbp
+  202178:	53                   	push   %rbx
+  202179:	48 83 ec 08          	sub    $0x8,%rsp
+  20217d:	89 fb                	mov    %edi,%ebx
+    app_print_error(r);
+  20217f:	e8 46 fe ff ff       	call   201fca <app_print_error>
+    asm volatile ("syscall" : "=a" (rax)
+  202184:	b8 40 00 00 00       	mov    $0x40,%eax
+  202189:	89 df                	mov    %ebx,%edi
+  20218b:	0f 05                	syscall
+ spinloop: goto spinloop;       // should never get here
+  20218d:	eb fe                	jmp    20218d <handle_error+0x19>
+
+000000000020218f <malloc>:
+
+// The heap starts 1MB above the program image (PROC_START_ADDR)
+static uint8_t* heap_top = (uint8_t*) 0x300000;
+static uint8_t* page_top = (uint8_t*) 0x300000;
+
+void* malloc(size_t size) {
+  20218f:	48 89 fe             	mov    %rdi,%rsi
+    while (ROUNDDOWN(heap_top + size, PAGESIZE) >= page_top) {
+  202192:	48 8b 05 6f 0e 00 00 	mov    0xe6f(%rip),%rax        # 203008 <heap_top>
+  202199:	48 8d 14 38          	lea    (%rax,%rdi,1),%rdx
+  20219d:	48 8b 3d 5c 0e 00 00 	mov    0xe5c(%rip),%rdi        # 203000 <page_top>
+  2021a4:	48 89 d1             	mov    %rdx,%rcx
+  2021a7:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  2021ae:	48 39 f9             	cmp    %rdi,%rcx
+  2021b1:	72 3e                	jb     2021f1 <malloc+0x62>
+    asm volatile ("syscall" : "=a" (result)
+  2021b3:	41 b8 3b 00 00 00    	mov    $0x3b,%r8d
+  2021b9:	44 89 c0             	mov    %r8d,%eax
+  2021bc:	0f 05                	syscall
+        int r = sys_page_alloc(page_top);
+        assert(r >= 0);
+  2021be:	85 c0                	test   %eax,%eax
+  2021c0:	78 37                	js     2021f9 <malloc+0x6a>
+        page_top += PAGESIZE;
+  2021c2:	48 8b 05 37 0e 00 00 	mov    0xe37(%rip),%rax        # 203000 <page_top>
+  2021c9:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  2021d0:	48 89 3d 29 0e 00 00 	mov    %rdi,0xe29(%rip)        # 203000 <page_top>
+    while (ROUNDDOWN(heap_top + size, PAGESIZE) >= page_top) {
+  2021d7:	48 8b 05 2a 0e 00 00 	mov    0xe2a(%rip),%rax        # 203008 <heap_top>
+  2021de:	48 8d 14 30          	lea    (%rax,%rsi,1),%rdx
+  2021e2:	48 89 d1             	mov    %rdx,%rcx
+  2021e5:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  2021ec:	48 39 f9             	cmp    %rdi,%rcx
+  2021ef:	73 c8                	jae    2021b9 <malloc+0x2a>
+    }
+
+    void* addr = heap_top;
+    heap_top += size;
+  2021f1:	48 89 15 10 0e 00 00 	mov    %rdx,0xe10(%rip)        # 203008 <heap_top>
+    return addr;
+}
+  2021f8:	c3                   	ret
+void* malloc(size_t size) {
+  2021f9:	55                   	push   %rbp
+  2021fa:	48 89 e5             	mov    %rsp,%rbp
+        assert(r >= 0);
+  2021fd:	48 8d 15 19 04 00 00 	lea    0x419(%rip),%rdx        # 20261d <col.0+0x5>
+  202204:	be 0b 00 00 00       	mov    $0xb,%esi
+  202209:	48 8d 3d 14 04 00 00 	lea    0x414(%rip),%rdi        # 202624 <col.0+0xc>
+  202210:	e8 b0 fb ff ff       	call   201dc5 <assert_fail>
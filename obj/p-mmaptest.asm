@@ -0,0 +1,3662 @@
+
+obj/p-mmaptest.full:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000200000 <fail>:
+
+static char data[FILE_SIZE];
+static char back[FILE_SIZE];
+
+
+static void __attribute__((noreturn)) fail(const char* step, ssize_t r) {
+  200000:	55                   	push   %rbp
+  200001:	48 89 e5             	mov    %rsp,%rbp
+  200004:	48 89 fa             	mov    %rdi,%rdx
+    app_printf(1, "mmaptest: %s failed (%d)\n", step, (int) r);
+  200007:	89 f1                	mov    %esi,%ecx
+  200009:	48 8d 35 50 24 00 00 	lea    0x2450(%rip),%rsi        # 202460 <malloc+0x92>
+  200010:	bf 01 00 00 00       	mov    $0x1,%edi
+  200015:	b8 00 00 00 00       	mov    $0x0,%eax
+  20001a:	e8 60 1e 00 00       	call   201e7f <app_printf>
+    return result;
+}
+
+static inline int sys_remove(const char *pathname) {
+    int result;
+    asm volatile ("syscall" : "=a" (result)
+  20001f:	b8 48 00 00 00       	mov    $0x48,%eax
+  200024:	48 8d 3d 4f 24 00 00 	lea    0x244f(%rip),%rdi        # 20247a <malloc+0xac>
+  20002b:	0f 05                	syscall
+// sys_exit()
+//    Exit this process. Does not return.
+static inline void sys_exit(int exit_code) __attribute__((noreturn));
+static inline void sys_exit(int exit_code) {
+    uint64_t rax;
+    asm volatile ("syscall" : "=a" (rax)
+  20002d:	b8 40 00 00 00       	mov    $0x40,%eax
+  200032:	bf 01 00 00 00       	mov    $0x1,%edi
+  200037:	0f 05                	syscall
+                  : "a" (INT_SYS_EXIT), "D" /* %rdi */ (exit_code)
+                  : "rcx", "r11", "cc", "memory");
+ spinloop: goto spinloop;       // should never get here
+  200039:	eb fe                	jmp    200039 <fail+0x39>
+
+000000000020003b <check_file>:
+    return 1;
+}
+
+// check_file(step)
+//    Read the whole file through a new descriptor and compare it to `data`.
+static void check_file(const char* step) {
+  20003b:	55                   	push   %rbp
+  20003c:	48 89 e5             	mov    %rsp,%rbp
+  20003f:	49 89 f8             	mov    %rdi,%r8
+    asm volatile ("syscall" : "=a" (result)
+  200042:	b8 33 00 00 00       	mov    $0x33,%eax
+  200047:	48 8d 3d 2c 24 00 00 	lea    0x242c(%rip),%rdi        # 20247a <malloc+0xac>
+  20004e:	0f 05                	syscall
+  200050:	89 c7                	mov    %eax,%edi
+    int fd = sys_open(PATH);
+    if (fd < 0) fail(step, fd);
+  200052:	85 c0                	test   %eax,%eax
+  200054:	78 46                	js     20009c <check_file+0x61>
+    register uint64_t r10 asm("r10") = offset;
+  200056:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+    asm volatile ("syscall" : "=a" (result)
+  20005c:	b8 4c 00 00 00       	mov    $0x4c,%eax
+  200061:	48 8d 35 b8 2f 00 00 	lea    0x2fb8(%rip),%rsi        # 203020 <back>
+  200068:	ba 28 23 00 00       	mov    $0x2328,%edx
+  20006d:	0f 05                	syscall
+    ssize_t n = sys_pread(fd, back, FILE_SIZE, 0);
+    if (n != FILE_SIZE || !same(back, data, FILE_SIZE)) fail(step, n);
+  20006f:	48 3d 28 23 00 00    	cmp    $0x2328,%rax
+  200075:	75 30                	jne    2000a7 <check_file+0x6c>
+    for (size_t i = 0; i < n; ++i) {
+  200077:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (a[i] != b[i]) {
+  20007c:	48 8d 0d dd 52 00 00 	lea    0x52dd(%rip),%rcx        # 205360 <data>
+  200083:	0f b6 3c 11          	movzbl (%rcx,%rdx,1),%edi
+  200087:	40 38 3c 16          	cmp    %dil,(%rsi,%rdx,1)
+  20008b:	75 1a                	jne    2000a7 <check_file+0x6c>
+    for (size_t i = 0; i < n; ++i) {
+  20008d:	48 83 c2 01          	add    $0x1,%rdx
+  200091:	48 81 fa 28 23 00 00 	cmp    $0x2328,%rdx
+  200098:	75 e9                	jne    200083 <check_file+0x48>
+}
+  20009a:	5d                   	pop    %rbp
+  20009b:	c3                   	ret
+    if (fd < 0) fail(step, fd);
+  20009c:	48 63 f0             	movslq %eax,%rsi
+  20009f:	4c 89 c7             	mov    %r8,%rdi
+  2000a2:	e8 59 ff ff ff       	call   200000 <fail>
+    if (n != FILE_SIZE || !same(back, data, FILE_SIZE)) fail(step, n);
+  2000a7:	48 89 c6             	mov    %rax,%rsi
+  2000aa:	4c 89 c7             	mov    %r8,%rdi
+  2000ad:	e8 4e ff ff ff       	call   200000 <fail>
+
+00000000002000b2 <process_main>:
+
+
+void process_main(void) {
+  2000b2:	55                   	push   %rbp
+  2000b3:	48 89 e5             	mov    %rsp,%rbp
+  2000b6:	41 56                	push   %r14
+  2000b8:	41 55                	push   %r13
+  2000ba:	41 54                	push   %r12
+  2000bc:	53                   	push   %rbx
+  2000bd:	ba 00 00 00 00       	mov    $0x0,%edx
+    for (int i = 0; i < FILE_SIZE; ++i) {
+        data[i] = 'a' + i % 26;
+  2000c2:	48 8d 35 97 52 00 00 	lea    0x5297(%rip),%rsi        # 205360 <data>
+  2000c9:	48 63 c2             	movslq %edx,%rax
+  2000cc:	48 69 c0 4f ec c4 4e 	imul   $0x4ec4ec4f,%rax,%rax
+  2000d3:	48 c1 f8 23          	sar    $0x23,%rax
+  2000d7:	89 d1                	mov    %edx,%ecx
+  2000d9:	c1 f9 1f             	sar    $0x1f,%ecx
+  2000dc:	29 c8                	sub    %ecx,%eax
+  2000de:	6b c0 1a             	imul   $0x1a,%eax,%eax
+  2000e1:	89 d1                	mov    %edx,%ecx
+  2000e3:	29 c1                	sub    %eax,%ecx
+  2000e5:	8d 41 61             	lea    0x61(%rcx),%eax
+  2000e8:	88 04 16             	mov    %al,(%rsi,%rdx,1)
+    for (int i = 0; i < FILE_SIZE; ++i) {
+  2000eb:	48 83 c2 01          	add    $0x1,%rdx
+  2000ef:	48 81 fa 28 23 00 00 	cmp    $0x2328,%rdx
+  2000f6:	75 d1                	jne    2000c9 <process_main+0x17>
+    asm volatile ("syscall" : "=a" (result)
+  2000f8:	b8 47 00 00 00       	mov    $0x47,%eax
+  2000fd:	48 8d 3d 76 23 00 00 	lea    0x2376(%rip),%rdi        # 20247a <malloc+0xac>
+  200104:	0f 05                	syscall
+    }
+
+    int r = sys_touch(PATH);
+    if (r < 0) handle_error(-r);
+  200106:	85 c0                	test   %eax,%eax
+  200108:	0f 88 07 01 00 00    	js     200215 <process_main+0x163>
+    asm volatile ("syscall" : "=a" (result)
+  20010e:	b8 33 00 00 00       	mov    $0x33,%eax
+  200113:	48 8d 3d 60 23 00 00 	lea    0x2360(%rip),%rdi        # 20247a <malloc+0xac>
+  20011a:	0f 05                	syscall
+  20011c:	89 c3                	mov    %eax,%ebx
+
+    int fd = sys_open(PATH);
+    if (fd < 0) fail("open", fd);
+  20011e:	85 c0                	test   %eax,%eax
+  200120:	0f 88 f8 00 00 00    	js     20021e <process_main+0x16c>
+    asm volatile ("syscall" : "=a" (result)
+  200126:	b8 32 00 00 00       	mov    $0x32,%eax
+  20012b:	48 8d 35 2e 52 00 00 	lea    0x522e(%rip),%rsi        # 205360 <data>
+  200132:	ba 28 23 00 00       	mov    $0x2328,%edx
+  200137:	89 df                	mov    %ebx,%edi
+  200139:	0f 05                	syscall
+    ssize_t n = sys_write(fd, data, FILE_SIZE);
+    if (n != FILE_SIZE) fail("write", n);
+  20013b:	48 3d 28 23 00 00    	cmp    $0x2328,%rax
+  200141:	0f 85 e6 00 00 00    	jne    20022d <process_main+0x17b>
+    register uint64_t r10 asm("r10") = fd;
+  200147:	4c 63 e3             	movslq %ebx,%r12
+  20014a:	4d 89 e2             	mov    %r12,%r10
+    asm volatile ("syscall" : "=a" (result)
+  20014d:	b8 51 00 00 00       	mov    $0x51,%eax
+  200152:	bf 00 00 28 00       	mov    $0x280000,%edi
+  200157:	be 28 23 00 00       	mov    $0x2328,%esi
+  20015c:	ba 03 00 00 00       	mov    $0x3,%edx
+  200161:	0f 05                	syscall
+
+    r = sys_mmap(MAP_ADDR, FILE_SIZE, PROT_READ | PROT_WRITE, fd);
+    if (r < 0) fail("mmap", r);
+  200163:	ba 00 00 28 00       	mov    $0x280000,%edx
+        if (a[i] != b[i]) {
+  200168:	48 8d 0d f1 51 d8 ff 	lea    -0x27ae0f(%rip),%rcx        # fffffffffff85360 <rand_seed+0xffffffffffd7dcd4>
+    if (r < 0) fail("mmap", r);
+  20016f:	85 c0                	test   %eax,%eax
+  200171:	0f 88 c5 00 00 00    	js     20023c <process_main+0x18a>
+        if (a[i] != b[i]) {
+  200177:	0f b6 04 11          	movzbl (%rcx,%rdx,1),%eax
+  20017b:	38 02                	cmp    %al,(%rdx)
+  20017d:	0f 85 ea 02 00 00    	jne    20046d <process_main+0x3bb>
+    for (size_t i = 0; i < n; ++i) {
+  200183:	48 83 c2 01          	add    $0x1,%rdx
+  200187:	48 81 fa 28 23 28 00 	cmp    $0x282328,%rdx
+  20018e:	75 e7                	jne    200177 <process_main+0xc5>
+  200190:	b8 00 00 28 00       	mov    $0x280000,%eax
+    if (!same(MAP_ADDR, data, FILE_SIZE)) fail("mapped read", 0);
+
+    // writes through the mapping reach the file at msync
+    for (int i = 0; i < FILE_SIZE; i += 1000) {
+        MAP_ADDR[i] = data[i] = '#';
+  200195:	48 8d 15 c4 51 d8 ff 	lea    -0x27ae3c(%rip),%rdx        # fffffffffff85360 <rand_seed+0xffffffffffd7dcd4>
+  20019c:	c6 04 02 23          	movb   $0x23,(%rdx,%rax,1)
+  2001a0:	c6 00 23             	movb   $0x23,(%rax)
+    for (int i = 0; i < FILE_SIZE; i += 1000) {
+  2001a3:	48 05 e8 03 00 00    	add    $0x3e8,%rax
+  2001a9:	48 3d 28 23 28 00    	cmp    $0x282328,%rax
+  2001af:	75 eb                	jne    20019c <process_main+0xea>
+    asm volatile ("syscall" : "=a" (result)
+  2001b1:	b8 53 00 00 00       	mov    $0x53,%eax
+  2001b6:	bf 00 00 28 00       	mov    $0x280000,%edi
+  2001bb:	be 28 23 00 00       	mov    $0x2328,%esi
+  2001c0:	0f 05                	syscall
+    }
+    r = sys_msync(MAP_ADDR, FILE_SIZE);
+    if (r < 0) fail("msync", r);
+  2001c2:	85 c0                	test   %eax,%eax
+  2001c4:	0f 88 81 00 00 00    	js     20024b <process_main+0x199>
+    check_file("read after msync");
+  2001ca:	48 8d 3d bc 22 00 00 	lea    0x22bc(%rip),%rdi        # 20248d <malloc+0xbf>
+  2001d1:	e8 65 fe ff ff       	call   20003b <check_file>
+
+    // writes through a descriptor show in the mapping
+    data[4100] = MAP_ADDR[4100] = '*';
+  2001d6:	c6 04 25 04 10 28 00 	movb   $0x2a,0x281004
+  2001dd:	2a 
+  2001de:	c6 05 7f 61 00 00 2a 	movb   $0x2a,0x617f(%rip)        # 206364 <data+0x1004>
+    register uint64_t r10 asm("r10") = offset;
+  2001e5:	41 ba 88 13 00 00    	mov    $0x1388,%r10d
+    asm volatile ("syscall" : "=a" (result)
+  2001eb:	b8 4d 00 00 00       	mov    $0x4d,%eax
+  2001f0:	48 8d 35 a7 22 00 00 	lea    0x22a7(%rip),%rsi        # 20249e <malloc+0xd0>
+  2001f7:	ba 0a 00 00 00       	mov    $0xa,%edx
+  2001fc:	89 df                	mov    %ebx,%edi
+  2001fe:	0f 05                	syscall
+    n = sys_pwrite(fd, "0123456789", 10, 5000);
+    if (n != 10) fail("pwrite", n);
+  200200:	48 83 f8 0a          	cmp    $0xa,%rax
+  200204:	74 54                	je     20025a <process_main+0x1a8>
+  200206:	48 89 c6             	mov    %rax,%rsi
+  200209:	48 8d 3d 14 23 00 00 	lea    0x2314(%rip),%rdi        # 202524 <malloc+0x156>
+  200210:	e8 eb fd ff ff       	call   200000 <fail>
+    if (r < 0) handle_error(-r);
+  200215:	f7 d8                	neg    %eax
+  200217:	89 c7                	mov    %eax,%edi
+  200219:	e8 95 21 00 00       	call   2023b3 <handle_error>
+    if (fd < 0) fail("open", fd);
+  20021e:	48 63 f0             	movslq %eax,%rsi
+  200221:	48 8d 3d 60 22 00 00 	lea    0x2260(%rip),%rdi        # 202488 <malloc+0xba>
+  200228:	e8 d3 fd ff ff       	call   200000 <fail>
+    if (n != FILE_SIZE) fail("write", n);
+  20022d:	48 89 c6             	mov    %rax,%rsi
+  200230:	48 8d 3d 88 22 00 00 	lea    0x2288(%rip),%rdi        # 2024bf <malloc+0xf1>
+  200237:	e8 c4 fd ff ff       	call   200000 <fail>
+    if (r < 0) fail("mmap", r);
+  20023c:	48 63 f0             	movslq %eax,%rsi
+  20023f:	48 8d 3d 83 22 00 00 	lea    0x2283(%rip),%rdi        # 2024c9 <malloc+0xfb>
+  200246:	e8 b5 fd ff ff       	call   200000 <fail>
+    if (r < 0) fail("msync", r);
+  20024b:	48 63 f0             	movslq %eax,%rsi
+  20024e:	48 8d 3d 43 22 00 00 	lea    0x2243(%rip),%rdi        # 202498 <malloc+0xca>
+  200255:	e8 a6 fd ff ff       	call   200000 <fail>
+    memcpy(data + 5000, "0123456789", 10);
+  20025a:	ba 0a 00 00 00       	mov    $0xa,%edx
+  20025f:	48 8d 35 38 22 00 00 	lea    0x2238(%rip),%rsi        # 20249e <malloc+0xd0>
+  200266:	48 8d 3d 7b 64 00 00 	lea    0x647b(%rip),%rdi        # 2066e8 <data+0x1388>
+  20026d:	e8 17 02 00 00       	call   200489 <memcpy>
+  200272:	b8 00 00 28 00       	mov    $0x280000,%eax
+        if (a[i] != b[i]) {
+  200277:	48 8d 15 e2 50 d8 ff 	lea    -0x27af1e(%rip),%rdx        # fffffffffff85360 <rand_seed+0xffffffffffd7dcd4>
+  20027e:	0f b6 3c 02          	movzbl (%rdx,%rax,1),%edi
+  200282:	40 38 38             	cmp    %dil,(%rax)
+  200285:	0f 85 d1 01 00 00    	jne    20045c <process_main+0x3aa>
+    for (size_t i = 0; i < n; ++i) {
+  20028b:	48 83 c0 01          	add    $0x1,%rax
+  20028f:	48 3d 28 23 28 00    	cmp    $0x282328,%rax
+  200295:	75 e7                	jne    20027e <process_main+0x1cc>
+    asm volatile ("syscall" : "=a" (result)
+  200297:	b8 52 00 00 00       	mov    $0x52,%eax
+  20029c:	bf 00 00 28 00       	mov    $0x280000,%edi
+  2002a1:	be 28 23 00 00       	mov    $0x2328,%esi
+  2002a6:	0f 05                	syscall
+    if (!same(MAP_ADDR, data, FILE_SIZE)) fail("mapped read after pwrite", 0);
+
+    // and are not undone by the writeback at munmap
+    r = sys_munmap(MAP_ADDR, FILE_SIZE);
+    if (r < 0) fail("munmap", r);
+  2002a8:	85 c0                	test   %eax,%eax
+  2002aa:	0f 88 f2 00 00 00    	js     2003a2 <process_main+0x2f0>
+    check_file("read after munmap");
+  2002b0:	48 8d 3d f2 21 00 00 	lea    0x21f2(%rip),%rdi        # 2024a9 <malloc+0xdb>
+  2002b7:	e8 7f fd ff ff       	call   20003b <check_file>
+  2002bc:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+
+    // reading the whole big mapping evicts page 0, dirty, on the way
+    for (int i = 0; i < BIG_PAGES; ++i) {
+        memset(back, 'A' + i % 26, PAGESIZE);
+  2002c2:	4c 8d 35 57 2d 00 00 	lea    0x2d57(%rip),%r14        # 203020 <back>
+  2002c9:	b9 1a 00 00 00       	mov    $0x1a,%ecx
+  2002ce:	44 89 e8             	mov    %r13d,%eax
+  2002d1:	99                   	cltd
+  2002d2:	f7 f9                	idiv   %ecx
+  2002d4:	8d 72 41             	lea    0x41(%rdx),%esi
+  2002d7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  2002dc:	4c 89 f7             	mov    %r14,%rdi
+  2002df:	e8 bc 03 00 00       	call   2006a0 <memset>
+    register uint64_t r10 asm("r10") = offset;
+  2002e4:	4d 89 ea             	mov    %r13,%r10
+  2002e7:	49 c1 e2 0c          	shl    $0xc,%r10
+    asm volatile ("syscall" : "=a" (result)
+  2002eb:	b8 4d 00 00 00       	mov    $0x4d,%eax
+  2002f0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  2002f5:	89 df                	mov    %ebx,%edi
+  2002f7:	4c 89 f6             	mov    %r14,%rsi
+  2002fa:	0f 05                	syscall
+        n = sys_pwrite(fd, back, PAGESIZE, (off_t) i * PAGESIZE);
+        if (n != PAGESIZE) fail("big write", n);
+  2002fc:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  200302:	0f 85 a9 00 00 00    	jne    2003b1 <process_main+0x2ff>
+    for (int i = 0; i < BIG_PAGES; ++i) {
+  200308:	49 83 c5 01          	add    $0x1,%r13
+  20030c:	49 83 fd 44          	cmp    $0x44,%r13
+  200310:	75 b7                	jne    2002c9 <process_main+0x217>
+    register uint64_t r10 asm("r10") = fd;
+  200312:	4d 89 e2             	mov    %r12,%r10
+    asm volatile ("syscall" : "=a" (result)
+  200315:	b8 51 00 00 00       	mov    $0x51,%eax
+  20031a:	bf 00 00 28 00       	mov    $0x280000,%edi
+  20031f:	be 00 40 04 00       	mov    $0x44000,%esi
+  200324:	ba 03 00 00 00       	mov    $0x3,%edx
+  200329:	0f 05                	syscall
+    }
+    r = sys_mmap(MAP_ADDR, BIG_PAGES * PAGESIZE, PROT_READ | PROT_WRITE, fd);
+    if (r < 0) fail("big mmap", r);
+  20032b:	85 c0                	test   %eax,%eax
+  20032d:	0f 88 8d 00 00 00    	js     2003c0 <process_main+0x30e>
+    MAP_ADDR[0] = '#';
+  200333:	c6 04 25 00 00 28 00 	movb   $0x23,0x280000
+  20033a:	23 
+  20033b:	b9 01 00 00 00       	mov    $0x1,%ecx
+    for (int i = 1; i < BIG_PAGES; ++i) {
+        if (MAP_ADDR[i * PAGESIZE] != 'A' + i % 26) fail("big mapped read", i);
+  200340:	be 1a 00 00 00       	mov    $0x1a,%esi
+  200345:	48 89 c8             	mov    %rcx,%rax
+  200348:	48 c1 e0 0c          	shl    $0xc,%rax
+  20034c:	0f be b8 00 00 28 00 	movsbl 0x280000(%rax),%edi
+  200353:	89 c8                	mov    %ecx,%eax
+  200355:	99                   	cltd
+  200356:	f7 fe                	idiv   %esi
+  200358:	83 c2 41             	add    $0x41,%edx
+  20035b:	39 d7                	cmp    %edx,%edi
+  20035d:	75 70                	jne    2003cf <process_main+0x31d>
+    for (int i = 1; i < BIG_PAGES; ++i) {
+  20035f:	48 83 c1 01          	add    $0x1,%rcx
+  200363:	48 83 f9 44          	cmp    $0x44,%rcx
+  200367:	75 dc                	jne    200345 <process_main+0x293>
+    register uint64_t r10 asm("r10") = offset;
+  200369:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+    asm volatile ("syscall" : "=a" (result)
+  20036f:	b8 4c 00 00 00       	mov    $0x4c,%eax
+  200374:	48 8d 35 a5 2c 00 00 	lea    0x2ca5(%rip),%rsi        # 203020 <back>
+  20037b:	ba 01 00 00 00       	mov    $0x1,%edx
+  200380:	89 df                	mov    %ebx,%edi
+  200382:	0f 05                	syscall
+    }
+    n = sys_pread(fd, back, 1, 0);
+    if (n != 1 || back[0] != '#') fail("read after eviction", n);
+  200384:	48 83 f8 01          	cmp    $0x1,%rax
+  200388:	75 09                	jne    200393 <process_main+0x2e1>
+  20038a:	80 3d 8f 2c 00 00 23 	cmpb   $0x23,0x2c8f(%rip)        # 203020 <back>
+  200391:	74 4b                	je     2003de <process_main+0x32c>
+  200393:	48 89 c6             	mov    %rax,%rsi
+  200396:	48 8d 3d 48 21 00 00 	lea    0x2148(%rip),%rdi        # 2024e5 <malloc+0x117>
+  20039d:	e8 5e fc ff ff       	call   200000 <fail>
+    if (r < 0) fail("munmap", r);
+  2003a2:	48 63 f0             	movslq %eax,%rsi
+  2003a5:	48 8d 3d 51 21 00 00 	lea    0x2151(%rip),%rdi        # 2024fd <malloc+0x12f>
+  2003ac:	e8 4f fc ff ff       	call   200000 <fail>
+        if (n != PAGESIZE) fail("big write", n);
+  2003b1:	48 89 c6             	mov    %rax,%rsi
+  2003b4:	48 8d 3d 00 21 00 00 	lea    0x2100(%rip),%rdi        # 2024bb <malloc+0xed>
+  2003bb:	e8 40 fc ff ff       	call   200000 <fail>
+    if (r < 0) fail("big mmap", r);
+  2003c0:	48 63 f0             	movslq %eax,%rsi
+  2003c3:	48 8d 3d fb 20 00 00 	lea    0x20fb(%rip),%rdi        # 2024c5 <malloc+0xf7>
+  2003ca:	e8 31 fc ff ff       	call   200000 <fail>
+        if (MAP_ADDR[i * PAGESIZE] != 'A' + i % 26) fail("big mapped read", i);
+  2003cf:	48 63 f1             	movslq %ecx,%rsi
+  2003d2:	48 8d 3d f5 20 00 00 	lea    0x20f5(%rip),%rdi        # 2024ce <malloc+0x100>
+  2003d9:	e8 22 fc ff ff       	call   200000 <fail>
+    if (MAP_ADDR[0] != '#') fail("mapped read after eviction", 0);
+  2003de:	80 3c 25 00 00 28 00 	cmpb   $0x23,0x280000
+  2003e5:	23 
+  2003e6:	75 30                	jne    200418 <process_main+0x366>
+    asm volatile ("syscall" : "=a" (result)
+  2003e8:	b8 52 00 00 00       	mov    $0x52,%eax
+  2003ed:	bf 00 00 28 00       	mov    $0x280000,%edi
+  2003f2:	be 00 40 04 00       	mov    $0x44000,%esi
+  2003f7:	0f 05                	syscall
+    r = sys_munmap(MAP_ADDR, BIG_PAGES * PAGESIZE);
+    if (r < 0) fail("big munmap", r);
+  2003f9:	85 c0                	test   %eax,%eax
+  2003fb:	78 2c                	js     200429 <process_main+0x377>
+    asm volatile ("syscall" : "=a" (result)
+  2003fd:	b8 48 00 00 00       	mov    $0x48,%eax
+  200402:	48 8d 3d 71 20 00 00 	lea    0x2071(%rip),%rdi        # 20247a <malloc+0xac>
+  200409:	0f 05                	syscall
+
+    r = sys_remove(PATH);
+    if (r < 0) handle_error(-r);
+  20040b:	85 c0                	test   %eax,%eax
+  20040d:	79 29                	jns    200438 <process_main+0x386>
+  20040f:	f7 d8                	neg    %eax
+  200411:	89 c7                	mov    %eax,%edi
+  200413:	e8 9b 1f 00 00       	call   2023b3 <handle_error>
+    if (MAP_ADDR[0] != '#') fail("mapped read after eviction", 0);
+  200418:	be 00 00 00 00       	mov    $0x0,%esi
+  20041d:	48 8d 3d ba 20 00 00 	lea    0x20ba(%rip),%rdi        # 2024de <malloc+0x110>
+  200424:	e8 d7 fb ff ff       	call   200000 <fail>
+    if (r < 0) fail("big munmap", r);
+  200429:	48 63 f0             	movslq %eax,%rsi
+  20042c:	48 8d 3d c6 20 00 00 	lea    0x20c6(%rip),%rdi        # 2024f9 <malloc+0x12b>
+  200433:	e8 c8 fb ff ff       	call   200000 <fail>
+
+    app_printf(0, "mmaptest: ok\n");
+  200438:	48 8d 35 c5 20 00 00 	lea    0x20c5(%rip),%rsi        # 202504 <malloc+0x136>
+  20043f:	bf 00 00 00 00       	mov    $0x0,%edi
+  200444:	b8 00 00 00 00       	mov    $0x0,%eax
+  200449:	e8 31 1a 00 00       	call   201e7f <app_printf>
+    asm volatile ("syscall" : "=a" (rax)
+  20044e:	b8 40 00 00 00       	mov    $0x40,%eax
+  200453:	bf 00 00 00 00       	mov    $0x0,%edi
+  200458:	0f 05                	syscall
+ spinloop: goto spinloop;       // should never get here
+  20045a:	eb fe                	jmp    20045a <process_main+0x3a8>
+    if (!same(MAP_ADDR, data, FILE_SIZE)) fail("mapped read after pwrite", 0);
+  20045c:	be 00 00 00 00       	mov    $0x0,%esi
+  200461:	48 8d 3d aa 20 00 00 	lea    0x20aa(%rip),%rdi        # 202512 <malloc+0x144>
+  200468:	e8 93 fb ff ff       	call   200000 <fail>
+    if (!same(MAP_ADDR, data, FILE_SIZE)) fail("mapped read", 0);
+  20046d:	be 00 00 00 00       	mov    $0x0,%esi
+  200472:	48 8d 3d 59 20 00 00 	lea    0x2059(%rip),%rdi        # 2024d2 <malloc+0x104>
+  200479:	e8 82 fb ff ff       	call   200000 <fail>
+
+000000000020047e <vdso>:
+// KERNEL DATA PAGE
+//
+//    The kernel keeps a read-only vdso_data (see lib.h) up to date at
+//    VDSO_ADDR. Reading it is a plain memory load, not a system call.
+
+static inline const volatile vdso_data* vdso(void) {
+  20047e:	55                   	push   %rbp
+  20047f:	48 89 e5             	mov    %rsp,%rbp
+    return (const volatile vdso_data*) VDSO_ADDR;
+  200482:	b8 00 10 24 00       	mov    $0x241000,%eax
+}
+  200487:	5d                   	pop    %rbp
+  200488:	c3                   	ret
+
+0000000000200489 <memcpy>:
+#define MEMOP_WORD_MIN 64
+
+// an unaligned word that may alias any object
+typedef uint64_t __attribute__((may_alias, aligned(1))) memop_word;
+
+void* memcpy(void* dst, const void* src, size_t n) {
+  200489:	55                   	push   %rbp
+  20048a:	48 89 e5             	mov    %rsp,%rbp
+  20048d:	48 83 ec 48          	sub    $0x48,%rsp
+  200491:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  200495:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  200499:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+    char* d = (char*) dst;
+  20049d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  2004a1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    const char* s = (const char*) src;
+  2004a5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  2004a9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (n >= MEMOP_WORD_MIN) {
+  2004ad:	48 83 7d b8 3f       	cmpq   $0x3f,-0x48(%rbp)
+  2004b2:	0f 86 c5 00 00 00    	jbe    20057d <memcpy+0xf4>
+        size_t head = -(uintptr_t) d & 7;
+  2004b8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2004bc:	48 f7 d8             	neg    %rax
+  2004bf:	83 e0 07             	and    $0x7,%eax
+  2004c2:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        size_t words = (n - head) / 8;
+  2004c6:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  2004ca:	48 2b 45 e8          	sub    -0x18(%rbp),%rax
+  2004ce:	48 c1 e8 03          	shr    $0x3,%rax
+  2004d2:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+        n = (n - head) % 8;
+  2004d6:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  2004da:	48 2b 45 e8          	sub    -0x18(%rbp),%rax
+  2004de:	83 e0 07             	and    $0x7,%eax
+  2004e1:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        asm volatile("rep movsb" : "+D" (d), "+S" (s), "+c" (head)
+  2004e5:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  2004e9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  2004ed:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2004f1:	48 89 cf             	mov    %rcx,%rdi
+  2004f4:	48 89 d6             	mov    %rdx,%rsi
+  2004f7:	48 89 c1             	mov    %rax,%rcx
+  2004fa:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  2004fc:	48 89 c8             	mov    %rcx,%rax
+  2004ff:	48 89 f2             	mov    %rsi,%rdx
+  200502:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  200506:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  20050a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                     : : "memory");
+        asm volatile("rep movsq" : "+D" (d), "+S" (s), "+c" (words)
+  20050e:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  200512:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  200516:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  20051a:	48 89 cf             	mov    %rcx,%rdi
+  20051d:	48 89 d6             	mov    %rdx,%rsi
+  200520:	48 89 c1             	mov    %rax,%rcx
+  200523:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  200526:	48 89 c8             	mov    %rcx,%rax
+  200529:	48 89 f2             	mov    %rsi,%rdx
+  20052c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  200530:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  200534:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+                     : : "memory");
+    }
+    for (; n >= 16; n -= 16, s += 16, d += 16) {
+  200538:	eb 43                	jmp    20057d <memcpy+0xf4>
+        memop_word a = ((const memop_word*) s)[0];
+  20053a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  20053e:	48 8b 00             	mov    (%rax),%rax
+  200541:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+        memop_word b = ((const memop_word*) s)[1];
+  200545:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  200549:	48 83 c0 08          	add    $0x8,%rax
+  20054d:	48 8b 00             	mov    (%rax),%rax
+  200550:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+        ((memop_word*) d)[0] = a;
+  200554:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200558:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  20055c:	48 89 10             	mov    %rdx,(%rax)
+        ((memop_word*) d)[1] = b;
+  20055f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200563:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  200567:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  20056b:	48 89 02             	mov    %rax,(%rdx)
+    for (; n >= 16; n -= 16, s += 16, d += 16) {
+  20056e:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  200573:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  200578:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  20057d:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  200582:	77 b6                	ja     20053a <memcpy+0xb1>
+    }
+    for (; n > 0; --n, ++s, ++d) {
+  200584:	eb 1c                	jmp    2005a2 <memcpy+0x119>
+        *d = *s;
+  200586:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  20058a:	0f b6 10             	movzbl (%rax),%edx
+  20058d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200591:	88 10                	mov    %dl,(%rax)
+    for (; n > 0; --n, ++s, ++d) {
+  200593:	48 83 6d b8 01       	subq   $0x1,-0x48(%rbp)
+  200598:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  20059d:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  2005a2:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  2005a7:	75 dd                	jne    200586 <memcpy+0xfd>
+    }
+    return dst;
+  2005a9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  2005ad:	c9                   	leave
+  2005ae:	c3                   	ret
+
+00000000002005af <memmove>:
+
+void* memmove(void* dst, const void* src, size_t n) {
+  2005af:	55                   	push   %rbp
+  2005b0:	48 89 e5             	mov    %rsp,%rbp
+  2005b3:	48 83 ec 38          	sub    $0x38,%rsp
+  2005b7:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  2005bb:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  2005bf:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    const char* s = (const char*) src;
+  2005c3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  2005c7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    char* d = (char*) dst;
+  2005cb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  2005cf:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (!(s < d && s + n > d)) {
+  2005d3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2005d7:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  2005db:	73 11                	jae    2005ee <memmove+0x3f>
+  2005dd:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  2005e1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  2005e5:	48 01 d0             	add    %rdx,%rax
+  2005e8:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  2005ec:	72 1c                	jb     20060a <memmove+0x5b>
+        // a forward copy never overwrites source bytes it has yet to read
+        return memcpy(dst, src, n);
+  2005ee:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  2005f2:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  2005f6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  2005fa:	48 89 ce             	mov    %rcx,%rsi
+  2005fd:	48 89 c7             	mov    %rax,%rdi
+  200600:	e8 84 fe ff ff       	call   200489 <memcpy>
+  200605:	e9 94 00 00 00       	jmp    20069e <memmove+0xef>
+    }
+
+    // copy backwards: the tail bytes, then words down to the start
+    size_t words = n / 8;
+  20060a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  20060e:	48 c1 e8 03          	shr    $0x3,%rax
+  200612:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    size_t tail = n % 8;
+  200616:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  20061a:	83 e0 07             	and    $0x7,%eax
+  20061d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    s += n - 1, d += n - 1;
+  200621:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200625:	48 83 e8 01          	sub    $0x1,%rax
+  200629:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  20062d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200631:	48 83 e8 01          	sub    $0x1,%rax
+  200635:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    asm volatile("std; rep movsb; cld" : "+D" (d), "+S" (s), "+c" (tail)
+  200639:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  20063d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  200641:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  200645:	48 89 cf             	mov    %rcx,%rdi
+  200648:	48 89 d6             	mov    %rdx,%rsi
+  20064b:	48 89 c1             	mov    %rax,%rcx
+  20064e:	fd                   	std
+  20064f:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  200651:	fc                   	cld
+  200652:	48 89 c8             	mov    %rcx,%rax
+  200655:	48 89 f2             	mov    %rsi,%rdx
+  200658:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  20065c:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  200660:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+                 : : "memory", "cc");
+    s -= 7, d -= 7;
+  200664:	48 83 6d f8 07       	subq   $0x7,-0x8(%rbp)
+  200669:	48 83 6d f0 07       	subq   $0x7,-0x10(%rbp)
+    asm volatile("std; rep movsq; cld" : "+D" (d), "+S" (s), "+c" (words)
+  20066e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  200672:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  200676:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20067a:	48 89 cf             	mov    %rcx,%rdi
+  20067d:	48 89 d6             	mov    %rdx,%rsi
+  200680:	48 89 c1             	mov    %rax,%rcx
+  200683:	fd                   	std
+  200684:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  200687:	fc                   	cld
+  200688:	48 89 c8             	mov    %rcx,%rax
+  20068b:	48 89 f2             	mov    %rsi,%rdx
+  20068e:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  200692:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  200696:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 : : "memory", "cc");
+    return dst;
+  20069a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  20069e:	c9                   	leave
+  20069f:	c3                   	ret
+
+00000000002006a0 <memset>:
+
+void* memset(void* v, int c, size_t n) {
+  2006a0:	55                   	push   %rbp
+  2006a1:	48 89 e5             	mov    %rsp,%rbp
+  2006a4:	48 83 ec 38          	sub    $0x38,%rsp
+  2006a8:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  2006ac:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  2006af:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    char* p = (char*) v;
+  2006b3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  2006b7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    uint64_t word = (uint8_t) c * 0x0101010101010101UL;
+  2006bb:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  2006be:	0f b6 c0             	movzbl %al,%eax
+  2006c1:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  2006c8:	01 01 01 
+  2006cb:	48 0f af c2          	imul   %rdx,%rax
+  2006cf:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (n >= MEMOP_WORD_MIN) {
+  2006d3:	48 83 7d c8 3f       	cmpq   $0x3f,-0x38(%rbp)
+  2006d8:	0f 86 9e 00 00 00    	jbe    20077c <memset+0xdc>
+        size_t head = -(uintptr_t) p & 7;
+  2006de:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2006e2:	48 f7 d8             	neg    %rax
+  2006e5:	83 e0 07             	and    $0x7,%eax
+  2006e8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        size_t words = (n - head) / 8;
+  2006ec:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  2006f0:	48 2b 45 e8          	sub    -0x18(%rbp),%rax
+  2006f4:	48 c1 e8 03          	shr    $0x3,%rax
+  2006f8:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+        n = (n - head) % 8;
+  2006fc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200700:	48 2b 45 e8          	sub    -0x18(%rbp),%rax
+  200704:	83 e0 07             	and    $0x7,%eax
+  200707:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        asm volatile("rep stosb" : "+D" (p), "+c" (head) : "a" (word)
+  20070b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  20070f:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  200713:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  200717:	48 89 ce             	mov    %rcx,%rsi
+  20071a:	48 89 f7             	mov    %rsi,%rdi
+  20071d:	48 89 d1             	mov    %rdx,%rcx
+  200720:	f3 aa                	rep stos %al,%es:(%rdi)
+  200722:	48 89 ca             	mov    %rcx,%rdx
+  200725:	48 89 fe             	mov    %rdi,%rsi
+  200728:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  20072c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+                     : "memory");
+        asm volatile("rep stosq" : "+D" (p), "+c" (words) : "a" (word)
+  200730:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  200734:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  200738:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  20073c:	48 89 ce             	mov    %rcx,%rsi
+  20073f:	48 89 f7             	mov    %rsi,%rdi
+  200742:	48 89 d1             	mov    %rdx,%rcx
+  200745:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  200748:	48 89 ca             	mov    %rcx,%rdx
+  20074b:	48 89 fe             	mov    %rdi,%rsi
+  20074e:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  200752:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+                     : "memory");
+    }
+    for (; n >= 16; n -= 16, p += 16) {
+  200756:	eb 24                	jmp    20077c <memset+0xdc>
+        ((memop_word*) p)[0] = word;
+  200758:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20075c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  200760:	48 89 10             	mov    %rdx,(%rax)
+        ((memop_word*) p)[1] = word;
+  200763:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200767:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  20076b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  20076f:	48 89 02             	mov    %rax,(%rdx)
+    for (; n >= 16; n -= 16, p += 16) {
+  200772:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  200777:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  20077c:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  200781:	77 d5                	ja     200758 <memset+0xb8>
+    }
+    for (; n > 0; ++p, --n) {
+  200783:	eb 15                	jmp    20079a <memset+0xfa>
+        *p = c;
+  200785:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  200788:	89 c2                	mov    %eax,%edx
+  20078a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20078e:	88 10                	mov    %dl,(%rax)
+    for (; n > 0; ++p, --n) {
+  200790:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  200795:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  20079a:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  20079f:	75 e4                	jne    200785 <memset+0xe5>
+    }
+    return v;
+  2007a1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  2007a5:	c9                   	leave
+  2007a6:	c3                   	ret
+
+00000000002007a7 <strlen>:
+
+size_t strlen(const char* s) {
+  2007a7:	55                   	push   %rbp
+  2007a8:	48 89 e5             	mov    %rsp,%rbp
+  2007ab:	48 83 ec 18          	sub    $0x18,%rsp
+  2007af:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    size_t n;
+    for (n = 0; *s != '\0'; ++s) {
+  2007b3:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  2007ba:	00 
+  2007bb:	eb 0a                	jmp    2007c7 <strlen+0x20>
+        ++n;
+  2007bd:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    for (n = 0; *s != '\0'; ++s) {
+  2007c2:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  2007c7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2007cb:	0f b6 00             	movzbl (%rax),%eax
+  2007ce:	84 c0                	test   %al,%al
+  2007d0:	75 eb                	jne    2007bd <strlen+0x16>
+    }
+    return n;
+  2007d2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  2007d6:	c9                   	leave
+  2007d7:	c3                   	ret
+
+00000000002007d8 <strnlen>:
+
+size_t strnlen(const char* s, size_t maxlen) {
+  2007d8:	55                   	push   %rbp
+  2007d9:	48 89 e5             	mov    %rsp,%rbp
+  2007dc:	48 83 ec 20          	sub    $0x20,%rsp
+  2007e0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  2007e4:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    size_t n;
+    for (n = 0; n != maxlen && *s != '\0'; ++s) {
+  2007e8:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  2007ef:	00 
+  2007f0:	eb 0a                	jmp    2007fc <strnlen+0x24>
+        ++n;
+  2007f2:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    for (n = 0; n != maxlen && *s != '\0'; ++s) {
+  2007f7:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  2007fc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200800:	48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+  200804:	74 0b                	je     200811 <strnlen+0x39>
+  200806:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20080a:	0f b6 00             	movzbl (%rax),%eax
+  20080d:	84 c0                	test   %al,%al
+  20080f:	75 e1                	jne    2007f2 <strnlen+0x1a>
+    }
+    return n;
+  200811:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  200815:	c9                   	leave
+  200816:	c3                   	ret
+
+0000000000200817 <strcpy>:
+
+char* strcpy(char* dst, const char* src) {
+  200817:	55                   	push   %rbp
+  200818:	48 89 e5             	mov    %rsp,%rbp
+  20081b:	48 83 ec 20          	sub    $0x20,%rsp
+  20081f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  200823:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    char* d = dst;
+  200827:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20082b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    do {
+        *d++ = *src++;
+  20082f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  200833:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  200837:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  20083b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20083f:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  200843:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+  200847:	0f b6 12             	movzbl (%rdx),%edx
+  20084a:	88 10                	mov    %dl,(%rax)
+    } while (d[-1]);
+  20084c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200850:	48 83 e8 01          	sub    $0x1,%rax
+  200854:	0f b6 00             	movzbl (%rax),%eax
+  200857:	84 c0                	test   %al,%al
+  200859:	75 d4                	jne    20082f <strcpy+0x18>
+    return dst;
+  20085b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  20085f:	c9                   	leave
+  200860:	c3                   	ret
+
+0000000000200861 <strcmp>:
+
+int strcmp(const char* a, const char* b) {
+  200861:	55                   	push   %rbp
+  200862:	48 89 e5             	mov    %rsp,%rbp
+  200865:	48 83 ec 10          	sub    $0x10,%rsp
+  200869:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  20086d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    while (*a && *b && *a == *b) {
+  200871:	eb 0a                	jmp    20087d <strcmp+0x1c>
+        ++a, ++b;
+  200873:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  200878:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+    while (*a && *b && *a == *b) {
+  20087d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200881:	0f b6 00             	movzbl (%rax),%eax
+  200884:	84 c0                	test   %al,%al
+  200886:	74 1d                	je     2008a5 <strcmp+0x44>
+  200888:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  20088c:	0f b6 00             	movzbl (%rax),%eax
+  20088f:	84 c0                	test   %al,%al
+  200891:	74 12                	je     2008a5 <strcmp+0x44>
+  200893:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200897:	0f b6 10             	movzbl (%rax),%edx
+  20089a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  20089e:	0f b6 00             	movzbl (%rax),%eax
+  2008a1:	38 c2                	cmp    %al,%dl
+  2008a3:	74 ce                	je     200873 <strcmp+0x12>
+    }
+    return ((unsigned char) *a > (unsigned char) *b)
+  2008a5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2008a9:	0f b6 00             	movzbl (%rax),%eax
+  2008ac:	89 c2                	mov    %eax,%edx
+  2008ae:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2008b2:	0f b6 00             	movzbl (%rax),%eax
+  2008b5:	38 d0                	cmp    %dl,%al
+  2008b7:	0f 92 c0             	setb   %al
+  2008ba:	0f b6 d0             	movzbl %al,%edx
+        - ((unsigned char) *a < (unsigned char) *b);
+  2008bd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2008c1:	0f b6 00             	movzbl (%rax),%eax
+  2008c4:	89 c1                	mov    %eax,%ecx
+  2008c6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2008ca:	0f b6 00             	movzbl (%rax),%eax
+  2008cd:	38 c1                	cmp    %al,%cl
+  2008cf:	0f 92 c0             	setb   %al
+  2008d2:	0f b6 c0             	movzbl %al,%eax
+  2008d5:	29 c2                	sub    %eax,%edx
+  2008d7:	89 d0                	mov    %edx,%eax
+}
+  2008d9:	c9                   	leave
+  2008da:	c3                   	ret
+
+00000000002008db <strchr>:
+
+char* strchr(const char* s, int c) {
+  2008db:	55                   	push   %rbp
+  2008dc:	48 89 e5             	mov    %rsp,%rbp
+  2008df:	48 83 ec 10          	sub    $0x10,%rsp
+  2008e3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  2008e7:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    while (*s && *s != (char) c) {
+  2008ea:	eb 05                	jmp    2008f1 <strchr+0x16>
+        ++s;
+  2008ec:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    while (*s && *s != (char) c) {
+  2008f1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2008f5:	0f b6 00             	movzbl (%rax),%eax
+  2008f8:	84 c0                	test   %al,%al
+  2008fa:	74 0e                	je     20090a <strchr+0x2f>
+  2008fc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200900:	0f b6 00             	movzbl (%rax),%eax
+  200903:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  200906:	38 d0                	cmp    %dl,%al
+  200908:	75 e2                	jne    2008ec <strchr+0x11>
+    }
+    if (*s == (char) c) {
+  20090a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20090e:	0f b6 00             	movzbl (%rax),%eax
+  200911:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  200914:	38 d0                	cmp    %dl,%al
+  200916:	75 06                	jne    20091e <strchr+0x43>
+        return (char*) s;
+  200918:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20091c:	eb 05                	jmp    200923 <strchr+0x48>
+    } else {
+        return NULL;
+  20091e:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+}
+  200923:	c9                   	leave
+  200924:	c3                   	ret
+
+0000000000200925 <rand>:
+
+// New randomness implementation
+static int      rand_seed_set;
+static unsigned rand_seed;
+
+int rand(void) {
+  200925:	55                   	push   %rbp
+  200926:	48 89 e5             	mov    %rsp,%rbp
+  200929:	48 83 ec 10          	sub    $0x10,%rsp
+    if (!rand_seed_set) {
+  20092d:	8b 05 55 6d 00 00    	mov    0x6d55(%rip),%eax        # 207688 <rand_seed_set>
+  200933:	85 c0                	test   %eax,%eax
+  200935:	75 2c                	jne    200963 <rand+0x3e>
+#if WEENSYOS_KERNEL
+        extern unsigned get_entropy_value(void);
+        srand(get_entropy_value());
+#else           // user‑space build
+       /* kernel-refreshed seed from the kernel data page: no system call */
+       srand((unsigned) (vdso()->seed[0] ^ read_cycle_counter()));
+  200937:	e8 42 fb ff ff       	call   20047e <vdso>
+  20093c:	48 8b 40 18          	mov    0x18(%rax),%rax
+  200940:	89 c1                	mov    %eax,%ecx
+    }
+}
+
+static inline uint64_t read_cycle_counter(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+  200942:	0f 31                	rdtsc
+  200944:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  200947:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    return ((uint64_t) hi << 32) | lo;
+  20094a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  20094d:	48 c1 e0 20          	shl    $0x20,%rax
+  200951:	48 89 c2             	mov    %rax,%rdx
+  200954:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  200957:	48 09 d0             	or     %rdx,%rax
+  20095a:	31 c8                	xor    %ecx,%eax
+  20095c:	89 c7                	mov    %eax,%edi
+  20095e:	e8 24 00 00 00       	call   200987 <srand>
+#endif
+    }
+    rand_seed = rand_seed * 1664525U + 1013904223U;   // LCG
+  200963:	8b 05 23 6d 00 00    	mov    0x6d23(%rip),%eax        # 20768c <rand_seed>
+  200969:	69 c0 0d 66 19 00    	imul   $0x19660d,%eax,%eax
+  20096f:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+  200974:	89 05 12 6d 00 00    	mov    %eax,0x6d12(%rip)        # 20768c <rand_seed>
+    return rand_seed & RAND_MAX;
+  20097a:	8b 05 0c 6d 00 00    	mov    0x6d0c(%rip),%eax        # 20768c <rand_seed>
+  200980:	25 ff ff ff 7f       	and    $0x7fffffff,%eax
+}
+  200985:	c9                   	leave
+  200986:	c3                   	ret
+
+0000000000200987 <srand>:
+
+void srand(unsigned seed) {
+  200987:	55                   	push   %rbp
+  200988:	48 89 e5             	mov    %rsp,%rbp
+  20098b:	48 83 ec 08          	sub    $0x8,%rsp
+  20098f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+    rand_seed      = seed;
+  200992:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  200995:	89 05 f1 6c 00 00    	mov    %eax,0x6cf1(%rip)        # 20768c <rand_seed>
+    rand_seed_set  = 1;
+  20099b:	c7 05 e3 6c 00 00 01 	movl   $0x1,0x6ce3(%rip)        # 207688 <rand_seed_set>
+  2009a2:	00 00 00 
+}
+  2009a5:	90                   	nop
+  2009a6:	c9                   	leave
+  2009a7:	c3                   	ret
+
+00000000002009a8 <fill_numbuf>:
+//    Print a message onto the console, starting at the given cursor position.
+
+// snprintf, vsnprintf
+//    Format a string into a buffer.
+
+static char* fill_numbuf(char* numbuf_end, unsigned long val, int base) {
+  2009a8:	55                   	push   %rbp
+  2009a9:	48 89 e5             	mov    %rsp,%rbp
+  2009ac:	48 83 ec 28          	sub    $0x28,%rsp
+  2009b0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  2009b4:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  2009b8:	89 55 dc             	mov    %edx,-0x24(%rbp)
+    static const char upper_digits[] = "0123456789ABCDEF";
+    static const char lower_digits[] = "0123456789abcdef";
+
+    const char* digits = upper_digits;
+  2009bb:	48 8d 05 be 1c 00 00 	lea    0x1cbe(%rip),%rax        # 202680 <upper_digits.1>
+  2009c2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (base < 0) {
+  2009c6:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  2009ca:	79 0e                	jns    2009da <fill_numbuf+0x32>
+        digits = lower_digits;
+  2009cc:	48 8d 05 cd 1c 00 00 	lea    0x1ccd(%rip),%rax        # 2026a0 <lower_digits.0>
+  2009d3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+        base = -base;
+  2009d7:	f7 5d dc             	negl   -0x24(%rbp)
+    }
+
+    *--numbuf_end = '\0';
+  2009da:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  2009df:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2009e3:	c6 00 00             	movb   $0x0,(%rax)
+    do {
+        *--numbuf_end = digits[val % base];
+  2009e6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  2009e9:	48 63 c8             	movslq %eax,%rcx
+  2009ec:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  2009f0:	ba 00 00 00 00       	mov    $0x0,%edx
+  2009f5:	48 f7 f1             	div    %rcx
+  2009f8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2009fc:	48 01 d0             	add    %rdx,%rax
+  2009ff:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  200a04:	0f b6 10             	movzbl (%rax),%edx
+  200a07:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  200a0b:	88 10                	mov    %dl,(%rax)
+        val /= base;
+  200a0d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  200a10:	48 63 f0             	movslq %eax,%rsi
+  200a13:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  200a17:	ba 00 00 00 00       	mov    $0x0,%edx
+  200a1c:	48 f7 f6             	div    %rsi
+  200a1f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    } while (val != 0);
+  200a23:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  200a28:	75 bc                	jne    2009e6 <fill_numbuf+0x3e>
+    return numbuf_end;
+  200a2a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  200a2e:	c9                   	leave
+  200a2f:	c3                   	ret
+
+0000000000200a30 <printer_vprintf>:
+#define FLAG_NUMERIC            (1<<5)
+#define FLAG_SIGNED             (1<<6)
+#define FLAG_NEGATIVE           (1<<7)
+#define FLAG_ALT2               (1<<8)
+
+void printer_vprintf(printer* p, int color, const char* format, va_list val) {
+  200a30:	55                   	push   %rbp
+  200a31:	48 89 e5             	mov    %rsp,%rbp
+  200a34:	53                   	push   %rbx
+  200a35:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  200a3c:	48 89 bd 78 ff ff ff 	mov    %rdi,-0x88(%rbp)
+  200a43:	89 b5 74 ff ff ff    	mov    %esi,-0x8c(%rbp)
+  200a49:	48 89 95 68 ff ff ff 	mov    %rdx,-0x98(%rbp)
+  200a50:	48 89 8d 60 ff ff ff 	mov    %rcx,-0xa0(%rbp)
+#define NUMBUFSIZ 24
+    char numbuf[NUMBUFSIZ];
+
+    for (; *format; ++format) {
+  200a57:	e9 be 09 00 00       	jmp    20141a <printer_vprintf+0x9ea>
+        if (*format != '%') {
+  200a5c:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200a63:	0f b6 00             	movzbl (%rax),%eax
+  200a66:	3c 25                	cmp    $0x25,%al
+  200a68:	74 31                	je     200a9b <printer_vprintf+0x6b>
+            p->putc(p, *format, color);
+  200a6a:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200a71:	4c 8b 00             	mov    (%rax),%r8
+  200a74:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200a7b:	0f b6 00             	movzbl (%rax),%eax
+  200a7e:	0f b6 c8             	movzbl %al,%ecx
+  200a81:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  200a87:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200a8e:	89 ce                	mov    %ecx,%esi
+  200a90:	48 89 c7             	mov    %rax,%rdi
+  200a93:	41 ff d0             	call   *%r8
+            continue;
+  200a96:	e9 77 09 00 00       	jmp    201412 <printer_vprintf+0x9e2>
+        }
+
+        // process flags
+        int flags = 0;
+  200a9b:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+        for (++format; *format; ++format) {
+  200aa2:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  200aa9:	01 
+  200aaa:	eb 4f                	jmp    200afb <printer_vprintf+0xcb>
+            const char* flagc = strchr(flag_chars, *format);
+  200aac:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200ab3:	0f b6 00             	movzbl (%rax),%eax
+  200ab6:	0f be c0             	movsbl %al,%eax
+  200ab9:	89 c6                	mov    %eax,%esi
+  200abb:	48 8d 05 6e 1a 00 00 	lea    0x1a6e(%rip),%rax        # 202530 <flag_chars>
+  200ac2:	48 89 c7             	mov    %rax,%rdi
+  200ac5:	e8 11 fe ff ff       	call   2008db <strchr>
+  200aca:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (flagc) {
+  200ace:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  200ad3:	74 36                	je     200b0b <printer_vprintf+0xdb>
+                flags |= 1 << (flagc - flag_chars);
+  200ad5:	48 8d 05 54 1a 00 00 	lea    0x1a54(%rip),%rax        # 202530 <flag_chars>
+  200adc:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  200ae0:	48 29 c2             	sub    %rax,%rdx
+  200ae3:	89 d0                	mov    %edx,%eax
+  200ae5:	ba 01 00 00 00       	mov    $0x1,%edx
+  200aea:	89 c1                	mov    %eax,%ecx
+  200aec:	d3 e2                	shl    %cl,%edx
+  200aee:	89 d0                	mov    %edx,%eax
+  200af0:	09 45 ec             	or     %eax,-0x14(%rbp)
+        for (++format; *format; ++format) {
+  200af3:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  200afa:	01 
+  200afb:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200b02:	0f b6 00             	movzbl (%rax),%eax
+  200b05:	84 c0                	test   %al,%al
+  200b07:	75 a3                	jne    200aac <printer_vprintf+0x7c>
+  200b09:	eb 01                	jmp    200b0c <printer_vprintf+0xdc>
+            } else {
+                break;
+  200b0b:	90                   	nop
+            }
+        }
+
+        // process width
+        int width = -1;
+  200b0c:	c7 45 e8 ff ff ff ff 	movl   $0xffffffff,-0x18(%rbp)
+        if (*format >= '1' && *format <= '9') {
+  200b13:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200b1a:	0f b6 00             	movzbl (%rax),%eax
+  200b1d:	3c 30                	cmp    $0x30,%al
+  200b1f:	7e 67                	jle    200b88 <printer_vprintf+0x158>
+  200b21:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200b28:	0f b6 00             	movzbl (%rax),%eax
+  200b2b:	3c 39                	cmp    $0x39,%al
+  200b2d:	7f 59                	jg     200b88 <printer_vprintf+0x158>
+            for (width = 0; *format >= '0' && *format <= '9'; ) {
+  200b2f:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%rbp)
+  200b36:	eb 2e                	jmp    200b66 <printer_vprintf+0x136>
+                width = 10 * width + *format++ - '0';
+  200b38:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  200b3b:	89 d0                	mov    %edx,%eax
+  200b3d:	c1 e0 02             	shl    $0x2,%eax
+  200b40:	01 d0                	add    %edx,%eax
+  200b42:	01 c0                	add    %eax,%eax
+  200b44:	89 c1                	mov    %eax,%ecx
+  200b46:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200b4d:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  200b51:	48 89 95 68 ff ff ff 	mov    %rdx,-0x98(%rbp)
+  200b58:	0f b6 00             	movzbl (%rax),%eax
+  200b5b:	0f be c0             	movsbl %al,%eax
+  200b5e:	01 c8                	add    %ecx,%eax
+  200b60:	83 e8 30             	sub    $0x30,%eax
+  200b63:	89 45 e8             	mov    %eax,-0x18(%rbp)
+            for (width = 0; *format >= '0' && *format <= '9'; ) {
+  200b66:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200b6d:	0f b6 00             	movzbl (%rax),%eax
+  200b70:	3c 2f                	cmp    $0x2f,%al
+  200b72:	0f 8e 85 00 00 00    	jle    200bfd <printer_vprintf+0x1cd>
+  200b78:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200b7f:	0f b6 00             	movzbl (%rax),%eax
+  200b82:	3c 39                	cmp    $0x39,%al
+  200b84:	7e b2                	jle    200b38 <printer_vprintf+0x108>
+        if (*format >= '1' && *format <= '9') {
+  200b86:	eb 75                	jmp    200bfd <printer_vprintf+0x1cd>
+            }
+        } else if (*format == '*') {
+  200b88:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200b8f:	0f b6 00             	movzbl (%rax),%eax
+  200b92:	3c 2a                	cmp    $0x2a,%al
+  200b94:	75 68                	jne    200bfe <printer_vprintf+0x1ce>
+            width = va_arg(val, int);
+  200b96:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200b9d:	8b 00                	mov    (%rax),%eax
+  200b9f:	83 f8 2f             	cmp    $0x2f,%eax
+  200ba2:	77 30                	ja     200bd4 <printer_vprintf+0x1a4>
+  200ba4:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200bab:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200baf:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200bb6:	8b 00                	mov    (%rax),%eax
+  200bb8:	89 c0                	mov    %eax,%eax
+  200bba:	48 01 d0             	add    %rdx,%rax
+  200bbd:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200bc4:	8b 12                	mov    (%rdx),%edx
+  200bc6:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200bc9:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200bd0:	89 0a                	mov    %ecx,(%rdx)
+  200bd2:	eb 1a                	jmp    200bee <printer_vprintf+0x1be>
+  200bd4:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200bdb:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200bdf:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200be3:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200bea:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200bee:	8b 00                	mov    (%rax),%eax
+  200bf0:	89 45 e8             	mov    %eax,-0x18(%rbp)
+            ++format;
+  200bf3:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  200bfa:	01 
+  200bfb:	eb 01                	jmp    200bfe <printer_vprintf+0x1ce>
+        if (*format >= '1' && *format <= '9') {
+  200bfd:	90                   	nop
+        }
+
+        // process precision
+        int precision = -1;
+  200bfe:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%rbp)
+        if (*format == '.') {
+  200c05:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200c0c:	0f b6 00             	movzbl (%rax),%eax
+  200c0f:	3c 2e                	cmp    $0x2e,%al
+  200c11:	0f 85 00 01 00 00    	jne    200d17 <printer_vprintf+0x2e7>
+            ++format;
+  200c17:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  200c1e:	01 
+            if (*format >= '0' && *format <= '9') {
+  200c1f:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200c26:	0f b6 00             	movzbl (%rax),%eax
+  200c29:	3c 2f                	cmp    $0x2f,%al
+  200c2b:	7e 67                	jle    200c94 <printer_vprintf+0x264>
+  200c2d:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200c34:	0f b6 00             	movzbl (%rax),%eax
+  200c37:	3c 39                	cmp    $0x39,%al
+  200c39:	7f 59                	jg     200c94 <printer_vprintf+0x264>
+                for (precision = 0; *format >= '0' && *format <= '9'; ) {
+  200c3b:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%rbp)
+  200c42:	eb 2e                	jmp    200c72 <printer_vprintf+0x242>
+                    precision = 10 * precision + *format++ - '0';
+  200c44:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  200c47:	89 d0                	mov    %edx,%eax
+  200c49:	c1 e0 02             	shl    $0x2,%eax
+  200c4c:	01 d0                	add    %edx,%eax
+  200c4e:	01 c0                	add    %eax,%eax
+  200c50:	89 c1                	mov    %eax,%ecx
+  200c52:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200c59:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  200c5d:	48 89 95 68 ff ff ff 	mov    %rdx,-0x98(%rbp)
+  200c64:	0f b6 00             	movzbl (%rax),%eax
+  200c67:	0f be c0             	movsbl %al,%eax
+  200c6a:	01 c8                	add    %ecx,%eax
+  200c6c:	83 e8 30             	sub    $0x30,%eax
+  200c6f:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+                for (precision = 0; *format >= '0' && *format <= '9'; ) {
+  200c72:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200c79:	0f b6 00             	movzbl (%rax),%eax
+  200c7c:	3c 2f                	cmp    $0x2f,%al
+  200c7e:	0f 8e 85 00 00 00    	jle    200d09 <printer_vprintf+0x2d9>
+  200c84:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200c8b:	0f b6 00             	movzbl (%rax),%eax
+  200c8e:	3c 39                	cmp    $0x39,%al
+  200c90:	7e b2                	jle    200c44 <printer_vprintf+0x214>
+            if (*format >= '0' && *format <= '9') {
+  200c92:	eb 75                	jmp    200d09 <printer_vprintf+0x2d9>
+                }
+            } else if (*format == '*') {
+  200c94:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200c9b:	0f b6 00             	movzbl (%rax),%eax
+  200c9e:	3c 2a                	cmp    $0x2a,%al
+  200ca0:	75 68                	jne    200d0a <printer_vprintf+0x2da>
+                precision = va_arg(val, int);
+  200ca2:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200ca9:	8b 00                	mov    (%rax),%eax
+  200cab:	83 f8 2f             	cmp    $0x2f,%eax
+  200cae:	77 30                	ja     200ce0 <printer_vprintf+0x2b0>
+  200cb0:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200cb7:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200cbb:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200cc2:	8b 00                	mov    (%rax),%eax
+  200cc4:	89 c0                	mov    %eax,%eax
+  200cc6:	48 01 d0             	add    %rdx,%rax
+  200cc9:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200cd0:	8b 12                	mov    (%rdx),%edx
+  200cd2:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200cd5:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200cdc:	89 0a                	mov    %ecx,(%rdx)
+  200cde:	eb 1a                	jmp    200cfa <printer_vprintf+0x2ca>
+  200ce0:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200ce7:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200ceb:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200cef:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200cf6:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200cfa:	8b 00                	mov    (%rax),%eax
+  200cfc:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+                ++format;
+  200cff:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  200d06:	01 
+  200d07:	eb 01                	jmp    200d0a <printer_vprintf+0x2da>
+            if (*format >= '0' && *format <= '9') {
+  200d09:	90                   	nop
+            }
+            if (precision < 0) {
+  200d0a:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  200d0e:	79 07                	jns    200d17 <printer_vprintf+0x2e7>
+                precision = 0;
+  200d10:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%rbp)
+            }
+        }
+
+        // process main conversion character
+        int base = 10;
+  200d17:	c7 45 e0 0a 00 00 00 	movl   $0xa,-0x20(%rbp)
+        unsigned long num = 0;
+  200d1e:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  200d25:	00 
+        int length = 0;
+  200d26:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+        char* data = "";
+  200d2d:	48 8d 05 02 18 00 00 	lea    0x1802(%rip),%rax        # 202536 <flag_chars+0x6>
+  200d34:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    again:
+        switch (*format) {
+  200d38:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200d3f:	0f b6 00             	movzbl (%rax),%eax
+  200d42:	0f be c0             	movsbl %al,%eax
+  200d45:	83 e8 43             	sub    $0x43,%eax
+  200d48:	83 f8 37             	cmp    $0x37,%eax
+  200d4b:	0f 87 b5 03 00 00    	ja     201106 <printer_vprintf+0x6d6>
+  200d51:	89 c0                	mov    %eax,%eax
+  200d53:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  200d5a:	00 
+  200d5b:	48 8d 05 e2 17 00 00 	lea    0x17e2(%rip),%rax        # 202544 <flag_chars+0x14>
+  200d62:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+  200d65:	48 98                	cltq
+  200d67:	48 8d 15 d6 17 00 00 	lea    0x17d6(%rip),%rdx        # 202544 <flag_chars+0x14>
+  200d6e:	48 01 d0             	add    %rdx,%rax
+  200d71:	ff e0                	jmp    *%rax
+        case 'l':
+        case 'z':
+            length = 1;
+  200d73:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+            ++format;
+  200d7a:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  200d81:	01 
+            goto again;
+  200d82:	eb b4                	jmp    200d38 <printer_vprintf+0x308>
+        case 'd':
+        case 'i': {
+            long x = length ? va_arg(val, long) : va_arg(val, int);
+  200d84:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  200d88:	74 5d                	je     200de7 <printer_vprintf+0x3b7>
+  200d8a:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200d91:	8b 00                	mov    (%rax),%eax
+  200d93:	83 f8 2f             	cmp    $0x2f,%eax
+  200d96:	77 30                	ja     200dc8 <printer_vprintf+0x398>
+  200d98:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200d9f:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200da3:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200daa:	8b 00                	mov    (%rax),%eax
+  200dac:	89 c0                	mov    %eax,%eax
+  200dae:	48 01 d0             	add    %rdx,%rax
+  200db1:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200db8:	8b 12                	mov    (%rdx),%edx
+  200dba:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200dbd:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200dc4:	89 0a                	mov    %ecx,(%rdx)
+  200dc6:	eb 1a                	jmp    200de2 <printer_vprintf+0x3b2>
+  200dc8:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200dcf:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200dd3:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200dd7:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200dde:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200de2:	48 8b 00             	mov    (%rax),%rax
+  200de5:	eb 5c                	jmp    200e43 <printer_vprintf+0x413>
+  200de7:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200dee:	8b 00                	mov    (%rax),%eax
+  200df0:	83 f8 2f             	cmp    $0x2f,%eax
+  200df3:	77 30                	ja     200e25 <printer_vprintf+0x3f5>
+  200df5:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200dfc:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200e00:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200e07:	8b 00                	mov    (%rax),%eax
+  200e09:	89 c0                	mov    %eax,%eax
+  200e0b:	48 01 d0             	add    %rdx,%rax
+  200e0e:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200e15:	8b 12                	mov    (%rdx),%edx
+  200e17:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200e1a:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200e21:	89 0a                	mov    %ecx,(%rdx)
+  200e23:	eb 1a                	jmp    200e3f <printer_vprintf+0x40f>
+  200e25:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200e2c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200e30:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200e34:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200e3b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200e3f:	8b 00                	mov    (%rax),%eax
+  200e41:	48 98                	cltq
+  200e43:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+            int negative = x < 0 ? FLAG_NEGATIVE : 0;
+  200e47:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  200e4b:	48 c1 f8 38          	sar    $0x38,%rax
+  200e4f:	25 80 00 00 00       	and    $0x80,%eax
+  200e54:	89 45 a4             	mov    %eax,-0x5c(%rbp)
+            num = negative ? -x : x;
+  200e57:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  200e5b:	74 09                	je     200e66 <printer_vprintf+0x436>
+  200e5d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  200e61:	48 f7 d8             	neg    %rax
+  200e64:	eb 04                	jmp    200e6a <printer_vprintf+0x43a>
+  200e66:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  200e6a:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+            flags |= FLAG_NUMERIC | FLAG_SIGNED | negative;
+  200e6e:	8b 45 a4             	mov    -0x5c(%rbp),%eax
+  200e71:	83 c8 60             	or     $0x60,%eax
+  200e74:	09 45 ec             	or     %eax,-0x14(%rbp)
+            break;
+  200e77:	e9 cf 02 00 00       	jmp    20114b <printer_vprintf+0x71b>
+        }
+        case 'u':
+        format_unsigned:
+            num = length ? va_arg(val, unsigned long) : va_arg(val, unsigned);
+  200e7c:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  200e80:	74 5d                	je     200edf <printer_vprintf+0x4af>
+  200e82:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200e89:	8b 00                	mov    (%rax),%eax
+  200e8b:	83 f8 2f             	cmp    $0x2f,%eax
+  200e8e:	77 30                	ja     200ec0 <printer_vprintf+0x490>
+  200e90:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200e97:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200e9b:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200ea2:	8b 00                	mov    (%rax),%eax
+  200ea4:	89 c0                	mov    %eax,%eax
+  200ea6:	48 01 d0             	add    %rdx,%rax
+  200ea9:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200eb0:	8b 12                	mov    (%rdx),%edx
+  200eb2:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200eb5:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200ebc:	89 0a                	mov    %ecx,(%rdx)
+  200ebe:	eb 1a                	jmp    200eda <printer_vprintf+0x4aa>
+  200ec0:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200ec7:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200ecb:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200ecf:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200ed6:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200eda:	48 8b 00             	mov    (%rax),%rax
+  200edd:	eb 5c                	jmp    200f3b <printer_vprintf+0x50b>
+  200edf:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200ee6:	8b 00                	mov    (%rax),%eax
+  200ee8:	83 f8 2f             	cmp    $0x2f,%eax
+  200eeb:	77 30                	ja     200f1d <printer_vprintf+0x4ed>
+  200eed:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200ef4:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200ef8:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200eff:	8b 00                	mov    (%rax),%eax
+  200f01:	89 c0                	mov    %eax,%eax
+  200f03:	48 01 d0             	add    %rdx,%rax
+  200f06:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200f0d:	8b 12                	mov    (%rdx),%edx
+  200f0f:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200f12:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200f19:	89 0a                	mov    %ecx,(%rdx)
+  200f1b:	eb 1a                	jmp    200f37 <printer_vprintf+0x507>
+  200f1d:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200f24:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200f28:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200f2c:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200f33:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200f37:	8b 00                	mov    (%rax),%eax
+  200f39:	89 c0                	mov    %eax,%eax
+  200f3b:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+            flags |= FLAG_NUMERIC;
+  200f3f:	83 4d ec 20          	orl    $0x20,-0x14(%rbp)
+            break;
+  200f43:	e9 03 02 00 00       	jmp    20114b <printer_vprintf+0x71b>
+        case 'x':
+            base = -16;
+  200f48:	c7 45 e0 f0 ff ff ff 	movl   $0xfffffff0,-0x20(%rbp)
+            goto format_unsigned;
+  200f4f:	e9 28 ff ff ff       	jmp    200e7c <printer_vprintf+0x44c>
+        case 'X':
+            base = 16;
+  200f54:	c7 45 e0 10 00 00 00 	movl   $0x10,-0x20(%rbp)
+            goto format_unsigned;
+  200f5b:	e9 1c ff ff ff       	jmp    200e7c <printer_vprintf+0x44c>
+        case 'p':
+            num = (uintptr_t) va_arg(val, void*);
+  200f60:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200f67:	8b 00                	mov    (%rax),%eax
+  200f69:	83 f8 2f             	cmp    $0x2f,%eax
+  200f6c:	77 30                	ja     200f9e <printer_vprintf+0x56e>
+  200f6e:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200f75:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200f79:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200f80:	8b 00                	mov    (%rax),%eax
+  200f82:	89 c0                	mov    %eax,%eax
+  200f84:	48 01 d0             	add    %rdx,%rax
+  200f87:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200f8e:	8b 12                	mov    (%rdx),%edx
+  200f90:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200f93:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200f9a:	89 0a                	mov    %ecx,(%rdx)
+  200f9c:	eb 1a                	jmp    200fb8 <printer_vprintf+0x588>
+  200f9e:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200fa5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200fa9:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200fad:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200fb4:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200fb8:	48 8b 00             	mov    (%rax),%rax
+  200fbb:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+            base = -16;
+  200fbf:	c7 45 e0 f0 ff ff ff 	movl   $0xfffffff0,-0x20(%rbp)
+            flags |= FLAG_ALT | FLAG_ALT2 | FLAG_NUMERIC;
+  200fc6:	81 4d ec 21 01 00 00 	orl    $0x121,-0x14(%rbp)
+            break;
+  200fcd:	e9 79 01 00 00       	jmp    20114b <printer_vprintf+0x71b>
+        case 's':
+            data = va_arg(val, char*);
+  200fd2:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200fd9:	8b 00                	mov    (%rax),%eax
+  200fdb:	83 f8 2f             	cmp    $0x2f,%eax
+  200fde:	77 30                	ja     201010 <printer_vprintf+0x5e0>
+  200fe0:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200fe7:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200feb:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200ff2:	8b 00                	mov    (%rax),%eax
+  200ff4:	89 c0                	mov    %eax,%eax
+  200ff6:	48 01 d0             	add    %rdx,%rax
+  200ff9:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  201000:	8b 12                	mov    (%rdx),%edx
+  201002:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  201005:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  20100c:	89 0a                	mov    %ecx,(%rdx)
+  20100e:	eb 1a                	jmp    20102a <printer_vprintf+0x5fa>
+  201010:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  201017:	48 8b 40 08          	mov    0x8(%rax),%rax
+  20101b:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  20101f:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  201026:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  20102a:	48 8b 00             	mov    (%rax),%rax
+  20102d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+            break;
+  201031:	e9 15 01 00 00       	jmp    20114b <printer_vprintf+0x71b>
+        case 'C':
+            color = va_arg(val, int);
+  201036:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  20103d:	8b 00                	mov    (%rax),%eax
+  20103f:	83 f8 2f             	cmp    $0x2f,%eax
+  201042:	77 30                	ja     201074 <printer_vprintf+0x644>
+  201044:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  20104b:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  20104f:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  201056:	8b 00                	mov    (%rax),%eax
+  201058:	89 c0                	mov    %eax,%eax
+  20105a:	48 01 d0             	add    %rdx,%rax
+  20105d:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  201064:	8b 12                	mov    (%rdx),%edx
+  201066:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  201069:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  201070:	89 0a                	mov    %ecx,(%rdx)
+  201072:	eb 1a                	jmp    20108e <printer_vprintf+0x65e>
+  201074:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  20107b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  20107f:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  201083:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  20108a:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  20108e:	8b 00                	mov    (%rax),%eax
+  201090:	89 85 74 ff ff ff    	mov    %eax,-0x8c(%rbp)
+            goto done;
+  201096:	e9 77 03 00 00       	jmp    201412 <printer_vprintf+0x9e2>
+        case 'c':
+            data = numbuf;
+  20109b:	48 8d 45 8c          	lea    -0x74(%rbp),%rax
+  20109f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+            numbuf[0] = va_arg(val, int);
+  2010a3:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2010aa:	8b 00                	mov    (%rax),%eax
+  2010ac:	83 f8 2f             	cmp    $0x2f,%eax
+  2010af:	77 30                	ja     2010e1 <printer_vprintf+0x6b1>
+  2010b1:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2010b8:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  2010bc:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2010c3:	8b 00                	mov    (%rax),%eax
+  2010c5:	89 c0                	mov    %eax,%eax
+  2010c7:	48 01 d0             	add    %rdx,%rax
+  2010ca:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  2010d1:	8b 12                	mov    (%rdx),%edx
+  2010d3:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  2010d6:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  2010dd:	89 0a                	mov    %ecx,(%rdx)
+  2010df:	eb 1a                	jmp    2010fb <printer_vprintf+0x6cb>
+  2010e1:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2010e8:	48 8b 40 08          	mov    0x8(%rax),%rax
+  2010ec:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  2010f0:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  2010f7:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  2010fb:	8b 00                	mov    (%rax),%eax
+  2010fd:	88 45 8c             	mov    %al,-0x74(%rbp)
+            numbuf[1] = '\0';
+  201100:	c6 45 8d 00          	movb   $0x0,-0x73(%rbp)
+            break;
+  201104:	eb 45                	jmp    20114b <printer_vprintf+0x71b>
+        default:
+            data = numbuf;
+  201106:	48 8d 45 8c          	lea    -0x74(%rbp),%rax
+  20110a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+            numbuf[0] = (*format ? *format : '%');
+  20110e:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  201115:	0f b6 00             	movzbl (%rax),%eax
+  201118:	84 c0                	test   %al,%al
+  20111a:	74 0c                	je     201128 <printer_vprintf+0x6f8>
+  20111c:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  201123:	0f b6 00             	movzbl (%rax),%eax
+  201126:	eb 05                	jmp    20112d <printer_vprintf+0x6fd>
+  201128:	b8 25 00 00 00       	mov    $0x25,%eax
+  20112d:	88 45 8c             	mov    %al,-0x74(%rbp)
+            numbuf[1] = '\0';
+  201130:	c6 45 8d 00          	movb   $0x0,-0x73(%rbp)
+            if (!*format) {
+  201134:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  20113b:	0f b6 00             	movzbl (%rax),%eax
+  20113e:	84 c0                	test   %al,%al
+  201140:	75 08                	jne    20114a <printer_vprintf+0x71a>
+                format--;
+  201142:	48 83 ad 68 ff ff ff 	subq   $0x1,-0x98(%rbp)
+  201149:	01 
+            }
+            break;
+  20114a:	90                   	nop
+        }
+
+        if (flags & FLAG_NUMERIC) {
+  20114b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  20114e:	83 e0 20             	and    $0x20,%eax
+  201151:	85 c0                	test   %eax,%eax
+  201153:	74 1e                	je     201173 <printer_vprintf+0x743>
+            data = fill_numbuf(numbuf + NUMBUFSIZ, num, base);
+  201155:	48 8d 45 8c          	lea    -0x74(%rbp),%rax
+  201159:	48 83 c0 18          	add    $0x18,%rax
+  20115d:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  201160:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  201164:	48 89 ce             	mov    %rcx,%rsi
+  201167:	48 89 c7             	mov    %rax,%rdi
+  20116a:	e8 39 f8 ff ff       	call   2009a8 <fill_numbuf>
+  20116f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        }
+
+        const char* prefix = "";
+  201173:	48 8d 05 bc 13 00 00 	lea    0x13bc(%rip),%rax        # 202536 <flag_chars+0x6>
+  20117a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((flags & FLAG_NUMERIC) && (flags & FLAG_SIGNED)) {
+  20117e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  201181:	83 e0 20             	and    $0x20,%eax
+  201184:	85 c0                	test   %eax,%eax
+  201186:	74 51                	je     2011d9 <printer_vprintf+0x7a9>
+  201188:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  20118b:	83 e0 40             	and    $0x40,%eax
+  20118e:	85 c0                	test   %eax,%eax
+  201190:	74 47                	je     2011d9 <printer_vprintf+0x7a9>
+            if (flags & FLAG_NEGATIVE) {
+  201192:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  201195:	25 80 00 00 00       	and    $0x80,%eax
+  20119a:	85 c0                	test   %eax,%eax
+  20119c:	74 0d                	je     2011ab <printer_vprintf+0x77b>
+                prefix = "-";
+  20119e:	48 8d 05 92 13 00 00 	lea    0x1392(%rip),%rax        # 202537 <flag_chars+0x7>
+  2011a5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            if (flags & FLAG_NEGATIVE) {
+  2011a9:	eb 7d                	jmp    201228 <printer_vprintf+0x7f8>
+            } else if (flags & FLAG_PLUSPOSITIVE) {
+  2011ab:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  2011ae:	83 e0 10             	and    $0x10,%eax
+  2011b1:	85 c0                	test   %eax,%eax
+  2011b3:	74 0d                	je     2011c2 <printer_vprintf+0x792>
+                prefix = "+";
+  2011b5:	48 8d 05 7d 13 00 00 	lea    0x137d(%rip),%rax        # 202539 <flag_chars+0x9>
+  2011bc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            if (flags & FLAG_NEGATIVE) {
+  2011c0:	eb 66                	jmp    201228 <printer_vprintf+0x7f8>
+            } else if (flags & FLAG_SPACEPOSITIVE) {
+  2011c2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  2011c5:	83 e0 08             	and    $0x8,%eax
+  2011c8:	85 c0                	test   %eax,%eax
+  2011ca:	74 5c                	je     201228 <printer_vprintf+0x7f8>
+                prefix = " ";
+  2011cc:	48 8d 05 68 13 00 00 	lea    0x1368(%rip),%rax        # 20253b <flag_chars+0xb>
+  2011d3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            if (flags & FLAG_NEGATIVE) {
+  2011d7:	eb 4f                	jmp    201228 <printer_vprintf+0x7f8>
+            }
+        } else if ((flags & FLAG_NUMERIC) && (flags & FLAG_ALT)
+  2011d9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  2011dc:	83 e0 20             	and    $0x20,%eax
+  2011df:	85 c0                	test   %eax,%eax
+  2011e1:	74 46                	je     201229 <printer_vprintf+0x7f9>
+  2011e3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  2011e6:	83 e0 01             	and    $0x1,%eax
+  2011e9:	85 c0                	test   %eax,%eax
+  2011eb:	74 3c                	je     201229 <printer_vprintf+0x7f9>
+                   && (base == 16 || base == -16)
+  2011ed:	83 7d e0 10          	cmpl   $0x10,-0x20(%rbp)
+  2011f1:	74 06                	je     2011f9 <printer_vprintf+0x7c9>
+  2011f3:	83 7d e0 f0          	cmpl   $0xfffffff0,-0x20(%rbp)
+  2011f7:	75 30                	jne    201229 <printer_vprintf+0x7f9>
+                   && (num || (flags & FLAG_ALT2))) {
+  2011f9:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  2011fe:	75 0c                	jne    20120c <printer_vprintf+0x7dc>
+  201200:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  201203:	25 00 01 00 00       	and    $0x100,%eax
+  201208:	85 c0                	test   %eax,%eax
+  20120a:	74 1d                	je     201229 <printer_vprintf+0x7f9>
+            prefix = (base == -16 ? "0x" : "0X");
+  20120c:	83 7d e0 f0          	cmpl   $0xfffffff0,-0x20(%rbp)
+  201210:	75 09                	jne    20121b <printer_vprintf+0x7eb>
+  201212:	48 8d 05 24 13 00 00 	lea    0x1324(%rip),%rax        # 20253d <flag_chars+0xd>
+  201219:	eb 07                	jmp    201222 <printer_vprintf+0x7f2>
+  20121b:	48 8d 05 1e 13 00 00 	lea    0x131e(%rip),%rax        # 202540 <flag_chars+0x10>
+  201222:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  201226:	eb 01                	jmp    201229 <printer_vprintf+0x7f9>
+            if (flags & FLAG_NEGATIVE) {
+  201228:	90                   	nop
+        }
+
+        int len;
+        if (precision >= 0 && !(flags & FLAG_NUMERIC)) {
+  201229:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  20122d:	78 24                	js     201253 <printer_vprintf+0x823>
+  20122f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  201232:	83 e0 20             	and    $0x20,%eax
+  201235:	85 c0                	test   %eax,%eax
+  201237:	75 1a                	jne    201253 <printer_vprintf+0x823>
+            len = strnlen(data, precision);
+  201239:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  20123c:	48 63 d0             	movslq %eax,%rdx
+  20123f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  201243:	48 89 d6             	mov    %rdx,%rsi
+  201246:	48 89 c7             	mov    %rax,%rdi
+  201249:	e8 8a f5 ff ff       	call   2007d8 <strnlen>
+  20124e:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  201251:	eb 0f                	jmp    201262 <printer_vprintf+0x832>
+        } else {
+            len = strlen(data);
+  201253:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  201257:	48 89 c7             	mov    %rax,%rdi
+  20125a:	e8 48 f5 ff ff       	call   2007a7 <strlen>
+  20125f:	89 45 bc             	mov    %eax,-0x44(%rbp)
+        }
+        int zeros;
+        if ((flags & FLAG_NUMERIC) && precision >= 0) {
+  201262:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  201265:	83 e0 20             	and    $0x20,%eax
+  201268:	85 c0                	test   %eax,%eax
+  20126a:	74 20                	je     20128c <printer_vprintf+0x85c>
+  20126c:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  201270:	78 1a                	js     20128c <printer_vprintf+0x85c>
+            zeros = precision > len ? precision - len : 0;
+  201272:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  201275:	3b 45 bc             	cmp    -0x44(%rbp),%eax
+  201278:	7e 08                	jle    201282 <printer_vprintf+0x852>
+  20127a:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  20127d:	2b 45 bc             	sub    -0x44(%rbp),%eax
+  201280:	eb 05                	jmp    201287 <printer_vprintf+0x857>
+  201282:	b8 00 00 00 00       	mov    $0x0,%eax
+  201287:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  20128a:	eb 5c                	jmp    2012e8 <printer_vprintf+0x8b8>
+        } else if ((flags & FLAG_NUMERIC) && (flags & FLAG_ZERO)
+  20128c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  20128f:	83 e0 20             	and    $0x20,%eax
+  201292:	85 c0                	test   %eax,%eax
+  201294:	74 4b                	je     2012e1 <printer_vprintf+0x8b1>
+  201296:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  201299:	83 e0 02             	and    $0x2,%eax
+  20129c:	85 c0                	test   %eax,%eax
+  20129e:	74 41                	je     2012e1 <printer_vprintf+0x8b1>
+                   && !(flags & FLAG_LEFTJUSTIFY)
+  2012a0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  2012a3:	83 e0 04             	and    $0x4,%eax
+  2012a6:	85 c0                	test   %eax,%eax
+  2012a8:	75 37                	jne    2012e1 <printer_vprintf+0x8b1>
+                   && len + (int) strlen(prefix) < width) {
+  2012aa:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  2012ae:	48 89 c7             	mov    %rax,%rdi
+  2012b1:	e8 f1 f4 ff ff       	call   2007a7 <strlen>
+  2012b6:	89 c2                	mov    %eax,%edx
+  2012b8:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  2012bb:	01 d0                	add    %edx,%eax
+  2012bd:	39 45 e8             	cmp    %eax,-0x18(%rbp)
+  2012c0:	7e 1f                	jle    2012e1 <printer_vprintf+0x8b1>
+            zeros = width - len - strlen(prefix);
+  2012c2:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  2012c5:	2b 45 bc             	sub    -0x44(%rbp),%eax
+  2012c8:	89 c3                	mov    %eax,%ebx
+  2012ca:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  2012ce:	48 89 c7             	mov    %rax,%rdi
+  2012d1:	e8 d1 f4 ff ff       	call   2007a7 <strlen>
+  2012d6:	89 c2                	mov    %eax,%edx
+  2012d8:	89 d8                	mov    %ebx,%eax
+  2012da:	29 d0                	sub    %edx,%eax
+  2012dc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  2012df:	eb 07                	jmp    2012e8 <printer_vprintf+0x8b8>
+        } else {
+            zeros = 0;
+  2012e1:	c7 45 b8 00 00 00 00 	movl   $0x0,-0x48(%rbp)
+        }
+        width -= len + zeros + strlen(prefix);
+  2012e8:	8b 55 bc             	mov    -0x44(%rbp),%edx
+  2012eb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  2012ee:	01 d0                	add    %edx,%eax
+  2012f0:	48 63 d8             	movslq %eax,%rbx
+  2012f3:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  2012f7:	48 89 c7             	mov    %rax,%rdi
+  2012fa:	e8 a8 f4 ff ff       	call   2007a7 <strlen>
+  2012ff:	48 8d 14 03          	lea    (%rbx,%rax,1),%rdx
+  201303:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  201306:	29 d0                	sub    %edx,%eax
+  201308:	89 45 e8             	mov    %eax,-0x18(%rbp)
+        for (; !(flags & FLAG_LEFTJUSTIFY) && width > 0; --width) {
+  20130b:	eb 25                	jmp    201332 <printer_vprintf+0x902>
+            p->putc(p, ' ', color);
+  20130d:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  201314:	48 8b 08             	mov    (%rax),%rcx
+  201317:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  20131d:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  201324:	be 20 00 00 00       	mov    $0x20,%esi
+  201329:	48 89 c7             	mov    %rax,%rdi
+  20132c:	ff d1                	call   *%rcx
+        for (; !(flags & FLAG_LEFTJUSTIFY) && width > 0; --width) {
+  20132e:	83 6d e8 01          	subl   $0x1,-0x18(%rbp)
+  201332:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  201335:	83 e0 04             	and    $0x4,%eax
+  201338:	85 c0                	test   %eax,%eax
+  20133a:	75 36                	jne    201372 <printer_vprintf+0x942>
+  20133c:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  201340:	7f cb                	jg     20130d <printer_vprintf+0x8dd>
+        }
+        for (; *prefix; ++prefix) {
+  201342:	eb 2e                	jmp    201372 <printer_vprintf+0x942>
+            p->putc(p, *prefix, color);
+  201344:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  20134b:	4c 8b 00             	mov    (%rax),%r8
+  20134e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  201352:	0f b6 00             	movzbl (%rax),%eax
+  201355:	0f b6 c8             	movzbl %al,%ecx
+  201358:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  20135e:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  201365:	89 ce                	mov    %ecx,%esi
+  201367:	48 89 c7             	mov    %rax,%rdi
+  20136a:	41 ff d0             	call   *%r8
+        for (; *prefix; ++prefix) {
+  20136d:	48 83 45 c0 01       	addq   $0x1,-0x40(%rbp)
+  201372:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  201376:	0f b6 00             	movzbl (%rax),%eax
+  201379:	84 c0                	test   %al,%al
+  20137b:	75 c7                	jne    201344 <printer_vprintf+0x914>
+        }
+        for (; zeros > 0; --zeros) {
+  20137d:	eb 25                	jmp    2013a4 <printer_vprintf+0x974>
+            p->putc(p, '0', color);
+  20137f:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  201386:	48 8b 08             	mov    (%rax),%rcx
+  201389:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  20138f:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  201396:	be 30 00 00 00       	mov    $0x30,%esi
+  20139b:	48 89 c7             	mov    %rax,%rdi
+  20139e:	ff d1                	call   *%rcx
+        for (; zeros > 0; --zeros) {
+  2013a0:	83 6d b8 01          	subl   $0x1,-0x48(%rbp)
+  2013a4:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  2013a8:	7f d5                	jg     20137f <printer_vprintf+0x94f>
+        }
+        for (; len > 0; ++data, --len) {
+  2013aa:	eb 32                	jmp    2013de <printer_vprintf+0x9ae>
+            p->putc(p, *data, color);
+  2013ac:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  2013b3:	4c 8b 00             	mov    (%rax),%r8
+  2013b6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  2013ba:	0f b6 00             	movzbl (%rax),%eax
+  2013bd:	0f b6 c8             	movzbl %al,%ecx
+  2013c0:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  2013c6:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  2013cd:	89 ce                	mov    %ecx,%esi
+  2013cf:	48 89 c7             	mov    %rax,%rdi
+  2013d2:	41 ff d0             	call   *%r8
+        for (; len > 0; ++data, --len) {
+  2013d5:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  2013da:	83 6d bc 01          	subl   $0x1,-0x44(%rbp)
+  2013de:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+  2013e2:	7f c8                	jg     2013ac <printer_vprintf+0x97c>
+        }
+        for (; width > 0; --width) {
+  2013e4:	eb 25                	jmp    20140b <printer_vprintf+0x9db>
+            p->putc(p, ' ', color);
+  2013e6:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  2013ed:	48 8b 08             	mov    (%rax),%rcx
+  2013f0:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  2013f6:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  2013fd:	be 20 00 00 00       	mov    $0x20,%esi
+  201402:	48 89 c7             	mov    %rax,%rdi
+  201405:	ff d1                	call   *%rcx
+        for (; width > 0; --width) {
+  201407:	83 6d e8 01          	subl   $0x1,-0x18(%rbp)
+  20140b:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  20140f:	7f d5                	jg     2013e6 <printer_vprintf+0x9b6>
+        }
+    done: ;
+  201411:	90                   	nop
+    for (; *format; ++format) {
+  201412:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  201419:	01 
+  20141a:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  201421:	0f b6 00             	movzbl (%rax),%eax
+  201424:	84 c0                	test   %al,%al
+  201426:	0f 85 30 f6 ff ff    	jne    200a5c <printer_vprintf+0x2c>
+    }
+}
+  20142c:	90                   	nop
+  20142d:	90                   	nop
+  20142e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  201432:	c9                   	leave
+  201433:	c3                   	ret
+
+0000000000201434 <console_putc>:
+typedef struct console_printer {
+    printer p;
+    uint16_t* cursor;
+} console_printer;
+
+static void console_putc(printer* p, unsigned char c, int color) {
+  201434:	55                   	push   %rbp
+  201435:	48 89 e5             	mov    %rsp,%rbp
+  201438:	48 83 ec 30          	sub    $0x30,%rsp
+  20143c:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  201440:	89 f0                	mov    %esi,%eax
+  201442:	89 55 d0             	mov    %edx,-0x30(%rbp)
+  201445:	88 45 d4             	mov    %al,-0x2c(%rbp)
+    console_printer* cp = (console_printer*) p;
+  201448:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  20144c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    /*if (cp->cursor >= console + CONSOLE_ROWS * CONSOLE_COLUMNS) {
+        cp->cursor = console;
+    }*/
+    if (c == '\n') {
+  201450:	80 7d d4 0a          	cmpb   $0xa,-0x2c(%rbp)
+  201454:	75 7f                	jne    2014d5 <console_putc+0xa1>
+        int pos = (cp->cursor - console) % CONSOLE_COLUMNS;
+  201456:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20145a:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  20145e:	48 8d 05 9b 6b eb ff 	lea    -0x149465(%rip),%rax        # b8000 <console>
+  201465:	48 29 c2             	sub    %rax,%rdx
+  201468:	48 89 d0             	mov    %rdx,%rax
+  20146b:	48 d1 f8             	sar    %rax
+  20146e:	48 89 c1             	mov    %rax,%rcx
+  201471:	48 ba 67 66 66 66 66 	movabs $0x6666666666666667,%rdx
+  201478:	66 66 66 
+  20147b:	48 89 c8             	mov    %rcx,%rax
+  20147e:	48 f7 ea             	imul   %rdx
+  201481:	48 c1 fa 05          	sar    $0x5,%rdx
+  201485:	48 89 c8             	mov    %rcx,%rax
+  201488:	48 c1 f8 3f          	sar    $0x3f,%rax
+  20148c:	48 29 c2             	sub    %rax,%rdx
+  20148f:	48 89 d0             	mov    %rdx,%rax
+  201492:	48 c1 e0 02          	shl    $0x2,%rax
+  201496:	48 01 d0             	add    %rdx,%rax
+  201499:	48 c1 e0 04          	shl    $0x4,%rax
+  20149d:	48 29 c1             	sub    %rax,%rcx
+  2014a0:	48 89 ca             	mov    %rcx,%rdx
+  2014a3:	89 55 fc             	mov    %edx,-0x4(%rbp)
+        for (; pos != CONSOLE_COLUMNS; pos++) {
+  2014a6:	eb 25                	jmp    2014cd <console_putc+0x99>
+            *cp->cursor++ = ' ' | color;
+  2014a8:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  2014ab:	83 c8 20             	or     $0x20,%eax
+  2014ae:	89 c6                	mov    %eax,%esi
+  2014b0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2014b4:	48 8b 40 08          	mov    0x8(%rax),%rax
+  2014b8:	48 8d 48 02          	lea    0x2(%rax),%rcx
+  2014bc:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  2014c0:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  2014c4:	89 f2                	mov    %esi,%edx
+  2014c6:	66 89 10             	mov    %dx,(%rax)
+        for (; pos != CONSOLE_COLUMNS; pos++) {
+  2014c9:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  2014cd:	83 7d fc 50          	cmpl   $0x50,-0x4(%rbp)
+  2014d1:	75 d5                	jne    2014a8 <console_putc+0x74>
+  2014d3:	eb 69                	jmp    20153e <console_putc+0x10a>
+        }
+    } else if (c == '\b') {
+  2014d5:	80 7d d4 08          	cmpb   $0x8,-0x2c(%rbp)
+  2014d9:	75 3f                	jne    20151a <console_putc+0xe6>
+        if (cp->cursor != console) {
+  2014db:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2014df:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  2014e3:	48 8d 05 16 6b eb ff 	lea    -0x1494ea(%rip),%rax        # b8000 <console>
+  2014ea:	48 39 c2             	cmp    %rax,%rdx
+  2014ed:	74 4f                	je     20153e <console_putc+0x10a>
+            *(--cp->cursor) = ' ' | color;
+  2014ef:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  2014f2:	83 c8 20             	or     $0x20,%eax
+  2014f5:	89 c1                	mov    %eax,%ecx
+  2014f7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2014fb:	48 8b 40 08          	mov    0x8(%rax),%rax
+  2014ff:	48 8d 50 fe          	lea    -0x2(%rax),%rdx
+  201503:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201507:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  20150b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20150f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  201513:	89 ca                	mov    %ecx,%edx
+  201515:	66 89 10             	mov    %dx,(%rax)
+  201518:	eb 24                	jmp    20153e <console_putc+0x10a>
+        }
+    } else {
+        *cp->cursor++ = c | color;
+  20151a:	0f b6 45 d4          	movzbl -0x2c(%rbp),%eax
+  20151e:	8b 55 d0             	mov    -0x30(%rbp),%edx
+  201521:	09 d0                	or     %edx,%eax
+  201523:	89 c6                	mov    %eax,%esi
+  201525:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201529:	48 8b 40 08          	mov    0x8(%rax),%rax
+  20152d:	48 8d 48 02          	lea    0x2(%rax),%rcx
+  201531:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  201535:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  201539:	89 f2                	mov    %esi,%edx
+  20153b:	66 89 10             	mov    %dx,(%rax)
+    }
+
+    const int MAX_ROWS = CONSOLE_ROWS - 2;
+  20153e:	c7 45 e4 17 00 00 00 	movl   $0x17,-0x1c(%rbp)
+
+    if (cp->cursor == console + MAX_ROWS * CONSOLE_COLUMNS) {
+  201545:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201549:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  20154d:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  201550:	89 d0                	mov    %edx,%eax
+  201552:	c1 e0 02             	shl    $0x2,%eax
+  201555:	01 d0                	add    %edx,%eax
+  201557:	c1 e0 04             	shl    $0x4,%eax
+  20155a:	48 98                	cltq
+  20155c:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  201560:	48 8d 05 99 6a eb ff 	lea    -0x149567(%rip),%rax        # b8000 <console>
+  201567:	48 01 d0             	add    %rdx,%rax
+  20156a:	48 39 c1             	cmp    %rax,%rcx
+  20156d:	0f 85 ac 00 00 00    	jne    20161f <console_putc+0x1eb>
+        // Move all characters up by one row, forgetting the first row
+        for (int i = 0; i < (MAX_ROWS - 1) * CONSOLE_COLUMNS; ++i) {
+  201573:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  20157a:	eb 30                	jmp    2015ac <console_putc+0x178>
+            console[i] = console[i + CONSOLE_COLUMNS];
+  20157c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  20157f:	83 c0 50             	add    $0x50,%eax
+  201582:	48 98                	cltq
+  201584:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  201588:	48 8d 05 71 6a eb ff 	lea    -0x14958f(%rip),%rax        # b8000 <console>
+  20158f:	0f b7 04 02          	movzwl (%rdx,%rax,1),%eax
+  201593:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  201596:	48 63 d2             	movslq %edx,%rdx
+  201599:	48 8d 0c 12          	lea    (%rdx,%rdx,1),%rcx
+  20159d:	48 8d 15 5c 6a eb ff 	lea    -0x1495a4(%rip),%rdx        # b8000 <console>
+  2015a4:	66 89 04 11          	mov    %ax,(%rcx,%rdx,1)
+        for (int i = 0; i < (MAX_ROWS - 1) * CONSOLE_COLUMNS; ++i) {
+  2015a8:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+  2015ac:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  2015af:	8d 50 ff             	lea    -0x1(%rax),%edx
+  2015b2:	89 d0                	mov    %edx,%eax
+  2015b4:	c1 e0 02             	shl    $0x2,%eax
+  2015b7:	01 d0                	add    %edx,%eax
+  2015b9:	c1 e0 04             	shl    $0x4,%eax
+  2015bc:	39 45 f8             	cmp    %eax,-0x8(%rbp)
+  2015bf:	7c bb                	jl     20157c <console_putc+0x148>
+        }
+
+        // Fill last column with space
+        for (int i = (MAX_ROWS - 1) * CONSOLE_COLUMNS; i < MAX_ROWS * CONSOLE_COLUMNS; ++i) {
+  2015c1:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  2015c4:	8d 50 ff             	lea    -0x1(%rax),%edx
+  2015c7:	89 d0                	mov    %edx,%eax
+  2015c9:	c1 e0 02             	shl    $0x2,%eax
+  2015cc:	01 d0                	add    %edx,%eax
+  2015ce:	c1 e0 04             	shl    $0x4,%eax
+  2015d1:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  2015d4:	eb 20                	jmp    2015f6 <console_putc+0x1c2>
+            console[i] = ' ' | color;
+  2015d6:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  2015d9:	83 c8 20             	or     $0x20,%eax
+  2015dc:	89 c1                	mov    %eax,%ecx
+  2015de:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  2015e1:	48 98                	cltq
+  2015e3:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  2015e7:	48 8d 05 12 6a eb ff 	lea    -0x1495ee(%rip),%rax        # b8000 <console>
+  2015ee:	66 89 0c 02          	mov    %cx,(%rdx,%rax,1)
+        for (int i = (MAX_ROWS - 1) * CONSOLE_COLUMNS; i < MAX_ROWS * CONSOLE_COLUMNS; ++i) {
+  2015f2:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  2015f6:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  2015f9:	89 d0                	mov    %edx,%eax
+  2015fb:	c1 e0 02             	shl    $0x2,%eax
+  2015fe:	01 d0                	add    %edx,%eax
+  201600:	c1 e0 04             	shl    $0x4,%eax
+  201603:	39 45 f4             	cmp    %eax,-0xc(%rbp)
+  201606:	7c ce                	jl     2015d6 <console_putc+0x1a2>
+        }
+
+        cp->cursor -= CONSOLE_COLUMNS;
+  201608:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20160c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  201610:	48 8d 90 60 ff ff ff 	lea    -0xa0(%rax),%rdx
+  201617:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20161b:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    }
+}
+  20161f:	90                   	nop
+  201620:	c9                   	leave
+  201621:	c3                   	ret
+
+0000000000201622 <console_vprintf>:
+
+int console_vprintf(int cpos, int color, const char* format, va_list val) {
+  201622:	55                   	push   %rbp
+  201623:	48 89 e5             	mov    %rsp,%rbp
+  201626:	48 83 ec 30          	sub    $0x30,%rsp
+  20162a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  20162d:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  201630:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  201634:	48 89 4d d8          	mov    %rcx,-0x28(%rbp)
+    struct console_printer cp;
+    cp.p.putc = console_putc;
+  201638:	48 8d 05 f5 fd ff ff 	lea    -0x20b(%rip),%rax        # 201434 <console_putc>
+  20163f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (cpos < 0 || cpos >= CONSOLE_ROWS * CONSOLE_COLUMNS) {
+  201643:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  201647:	78 09                	js     201652 <console_vprintf+0x30>
+  201649:	81 7d ec cf 07 00 00 	cmpl   $0x7cf,-0x14(%rbp)
+  201650:	7e 07                	jle    201659 <console_vprintf+0x37>
+        cpos = 0;
+  201652:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+    }
+    cp.cursor = console + cpos;
+  201659:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  20165c:	48 98                	cltq
+  20165e:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  201662:	48 8d 05 97 69 eb ff 	lea    -0x149669(%rip),%rax        # b8000 <console>
+  201669:	48 01 d0             	add    %rdx,%rax
+  20166c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    printer_vprintf(&cp.p, color, format, val);
+  201670:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  201674:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  201678:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  20167b:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  20167f:	48 89 c7             	mov    %rax,%rdi
+  201682:	e8 a9 f3 ff ff       	call   200a30 <printer_vprintf>
+    return cp.cursor - console;
+  201687:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  20168b:	48 8d 05 6e 69 eb ff 	lea    -0x149692(%rip),%rax        # b8000 <console>
+  201692:	48 29 c2             	sub    %rax,%rdx
+  201695:	48 89 d0             	mov    %rdx,%rax
+  201698:	48 d1 f8             	sar    %rax
+}
+  20169b:	c9                   	leave
+  20169c:	c3                   	ret
+
+000000000020169d <console_printf>:
+
+int console_printf(int cpos, int color, const char* format, ...) {
+  20169d:	55                   	push   %rbp
+  20169e:	48 89 e5             	mov    %rsp,%rbp
+  2016a1:	48 83 ec 60          	sub    $0x60,%rsp
+  2016a5:	89 7d ac             	mov    %edi,-0x54(%rbp)
+  2016a8:	89 75 a8             	mov    %esi,-0x58(%rbp)
+  2016ab:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+  2016af:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  2016b3:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  2016b7:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list val;
+    va_start(val, format);
+  2016bb:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  2016c2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  2016c6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  2016ca:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  2016ce:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    cpos = console_vprintf(cpos, color, format, val);
+  2016d2:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  2016d6:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  2016da:	8b 75 a8             	mov    -0x58(%rbp),%esi
+  2016dd:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  2016e0:	89 c7                	mov    %eax,%edi
+  2016e2:	e8 3b ff ff ff       	call   201622 <console_vprintf>
+  2016e7:	89 45 ac             	mov    %eax,-0x54(%rbp)
+    va_end(val);
+    return cpos;
+  2016ea:	8b 45 ac             	mov    -0x54(%rbp),%eax
+}
+  2016ed:	c9                   	leave
+  2016ee:	c3                   	ret
+
+00000000002016ef <string_putc>:
+    printer p;
+    char* s;
+    char* end;
+} string_printer;
+
+static void string_putc(printer* p, unsigned char c, int color) {
+  2016ef:	55                   	push   %rbp
+  2016f0:	48 89 e5             	mov    %rsp,%rbp
+  2016f3:	48 83 ec 20          	sub    $0x20,%rsp
+  2016f7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  2016fb:	89 f0                	mov    %esi,%eax
+  2016fd:	89 55 e0             	mov    %edx,-0x20(%rbp)
+  201700:	88 45 e4             	mov    %al,-0x1c(%rbp)
+    string_printer* sp = (string_printer*) p;
+  201703:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201707:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (sp->s < sp->end) {
+  20170b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20170f:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  201713:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  201717:	48 8b 40 10          	mov    0x10(%rax),%rax
+  20171b:	48 39 c2             	cmp    %rax,%rdx
+  20171e:	73 1a                	jae    20173a <string_putc+0x4b>
+        *sp->s++ = c;
+  201720:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  201724:	48 8b 40 08          	mov    0x8(%rax),%rax
+  201728:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  20172c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  201730:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  201734:	0f b6 55 e4          	movzbl -0x1c(%rbp),%edx
+  201738:	88 10                	mov    %dl,(%rax)
+    }
+    (void) color;
+}
+  20173a:	90                   	nop
+  20173b:	c9                   	leave
+  20173c:	c3                   	ret
+
+000000000020173d <vsnprintf>:
+
+int vsnprintf(char* s, size_t size, const char* format, va_list val) {
+  20173d:	55                   	push   %rbp
+  20173e:	48 89 e5             	mov    %rsp,%rbp
+  201741:	48 83 ec 40          	sub    $0x40,%rsp
+  201745:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  201749:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  20174d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  201751:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+    string_printer sp;
+    sp.p.putc = string_putc;
+  201755:	48 8d 05 93 ff ff ff 	lea    -0x6d(%rip),%rax        # 2016ef <string_putc>
+  20175c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    sp.s = s;
+  201760:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  201764:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (size) {
+  201768:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  20176d:	74 33                	je     2017a2 <vsnprintf+0x65>
+        sp.end = s + size - 1;
+  20176f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  201773:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  201777:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  20177b:	48 01 d0             	add    %rdx,%rax
+  20177e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+        printer_vprintf(&sp.p, 0, format, val);
+  201782:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  201786:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  20178a:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  20178e:	be 00 00 00 00       	mov    $0x0,%esi
+  201793:	48 89 c7             	mov    %rax,%rdi
+  201796:	e8 95 f2 ff ff       	call   200a30 <printer_vprintf>
+        *sp.s = 0;
+  20179b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  20179f:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return sp.s - s;
+  2017a2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2017a6:	48 2b 45 d8          	sub    -0x28(%rbp),%rax
+}
+  2017aa:	c9                   	leave
+  2017ab:	c3                   	ret
+
+00000000002017ac <snprintf>:
+
+int snprintf(char* s, size_t size, const char* format, ...) {
+  2017ac:	55                   	push   %rbp
+  2017ad:	48 89 e5             	mov    %rsp,%rbp
+  2017b0:	48 83 ec 70          	sub    $0x70,%rsp
+  2017b4:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  2017b8:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  2017bc:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  2017c0:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  2017c4:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  2017c8:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list val;
+    va_start(val, format);
+  2017cc:	c7 45 b0 18 00 00 00 	movl   $0x18,-0x50(%rbp)
+  2017d3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  2017d7:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  2017db:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  2017df:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    int n = vsnprintf(s, size, format, val);
+  2017e3:	48 8d 4d b0          	lea    -0x50(%rbp),%rcx
+  2017e7:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  2017eb:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  2017ef:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  2017f3:	48 89 c7             	mov    %rax,%rdi
+  2017f6:	e8 42 ff ff ff       	call   20173d <vsnprintf>
+  2017fb:	89 45 cc             	mov    %eax,-0x34(%rbp)
+    va_end(val);
+    return n;
+  2017fe:	8b 45 cc             	mov    -0x34(%rbp),%eax
+}
+  201801:	c9                   	leave
+  201802:	c3                   	ret
+
+0000000000201803 <console_clear>:
+
+
+// console_clear
+//    Erases the console and moves the cursor to the upper left (CPOS(0, 0)).
+
+void console_clear(void) {
+  201803:	55                   	push   %rbp
+  201804:	48 89 e5             	mov    %rsp,%rbp
+  201807:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < CONSOLE_ROWS * CONSOLE_COLUMNS; ++i) {
+  20180b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  201812:	eb 1a                	jmp    20182e <console_clear+0x2b>
+        console[i] = ' ' | 0x0700;
+  201814:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  201817:	48 98                	cltq
+  201819:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  20181d:	48 8d 05 dc 67 eb ff 	lea    -0x149824(%rip),%rax        # b8000 <console>
+  201824:	66 c7 04 02 20 07    	movw   $0x720,(%rdx,%rax,1)
+    for (int i = 0; i < CONSOLE_ROWS * CONSOLE_COLUMNS; ++i) {
+  20182a:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  20182e:	81 7d fc cf 07 00 00 	cmpl   $0x7cf,-0x4(%rbp)
+  201835:	7e dd                	jle    201814 <console_clear+0x11>
+    }
+    cursorpos = 0;
+  201837:	c7 05 bb 77 eb ff 00 	movl   $0x0,-0x148845(%rip)        # b8ffc <cursorpos>
+  20183e:	00 00 00 
+}
+  201841:	90                   	nop
+  201842:	c9                   	leave
+  201843:	c3                   	ret
+
+0000000000201844 <string_to_char>:
+
+
+int string_to_char(const char *str, int *dest) {
+  201844:	55                   	push   %rbp
+  201845:	48 89 e5             	mov    %rsp,%rbp
+  201848:	48 83 ec 20          	sub    $0x20,%rsp
+  20184c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  201850:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    if (*str == '\0') return -1;
+  201854:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201858:	0f b6 00             	movzbl (%rax),%eax
+  20185b:	84 c0                	test   %al,%al
+  20185d:	75 0a                	jne    201869 <string_to_char+0x25>
+  20185f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  201864:	e9 e0 00 00 00       	jmp    201949 <string_to_char+0x105>
+
+    *dest = 0;
+  201869:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  20186d:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    for (; *str; str++) {
+  201873:	e9 bd 00 00 00       	jmp    201935 <string_to_char+0xf1>
+        int digit = 0;
+  201878:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+        switch (*str)
+  20187f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201883:	0f b6 00             	movzbl (%rax),%eax
+  201886:	0f be c0             	movsbl %al,%eax
+  201889:	83 e8 30             	sub    $0x30,%eax
+  20188c:	83 f8 09             	cmp    $0x9,%eax
+  20188f:	77 7c                	ja     20190d <string_to_char+0xc9>
+  201891:	89 c0                	mov    %eax,%eax
+  201893:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  20189a:	00 
+  20189b:	48 8d 05 82 0d 00 00 	lea    0xd82(%rip),%rax        # 202624 <flag_chars+0xf4>
+  2018a2:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+  2018a5:	48 98                	cltq
+  2018a7:	48 8d 15 76 0d 00 00 	lea    0xd76(%rip),%rdx        # 202624 <flag_chars+0xf4>
+  2018ae:	48 01 d0             	add    %rdx,%rax
+  2018b1:	ff e0                	jmp    *%rax
+        {
+        case '0':
+            digit = 0;
+  2018b3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+            break;
+  2018ba:	eb 58                	jmp    201914 <string_to_char+0xd0>
+        case '1':
+            digit = 1;
+  2018bc:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+            break;
+  2018c3:	eb 4f                	jmp    201914 <string_to_char+0xd0>
+        case '2':
+            digit = 2;
+  2018c5:	c7 45 fc 02 00 00 00 	movl   $0x2,-0x4(%rbp)
+            break;
+  2018cc:	eb 46                	jmp    201914 <string_to_char+0xd0>
+        case '3':
+            digit = 3;
+  2018ce:	c7 45 fc 03 00 00 00 	movl   $0x3,-0x4(%rbp)
+            break;
+  2018d5:	eb 3d                	jmp    201914 <string_to_char+0xd0>
+        case '4':
+            digit = 4;
+  2018d7:	c7 45 fc 04 00 00 00 	movl   $0x4,-0x4(%rbp)
+            break;
+  2018de:	eb 34                	jmp    201914 <string_to_char+0xd0>
+        case '5':
+            digit = 5;
+  2018e0:	c7 45 fc 05 00 00 00 	movl   $0x5,-0x4(%rbp)
+            break;
+  2018e7:	eb 2b                	jmp    201914 <string_to_char+0xd0>
+        case '6':
+            digit = 6;
+  2018e9:	c7 45 fc 06 00 00 00 	movl   $0x6,-0x4(%rbp)
+            break;
+  2018f0:	eb 22                	jmp    201914 <string_to_char+0xd0>
+        case '7':
+            digit = 7;
+  2018f2:	c7 45 fc 07 00 00 00 	movl   $0x7,-0x4(%rbp)
+            break;
+  2018f9:	eb 19                	jmp    201914 <string_to_char+0xd0>
+        case '8':
+            digit = 8;
+  2018fb:	c7 45 fc 08 00 00 00 	movl   $0x8,-0x4(%rbp)
+            break;
+  201902:	eb 10                	jmp    201914 <string_to_char+0xd0>
+        case '9':
+            digit = 9;
+  201904:	c7 45 fc 09 00 00 00 	movl   $0x9,-0x4(%rbp)
+            break;
+  20190b:	eb 07                	jmp    201914 <string_to_char+0xd0>
+        default:
+            return -1;
+  20190d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  201912:	eb 35                	jmp    201949 <string_to_char+0x105>
+        }
+
+        *dest = *dest * 10 + digit;
+  201914:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  201918:	8b 10                	mov    (%rax),%edx
+  20191a:	89 d0                	mov    %edx,%eax
+  20191c:	c1 e0 02             	shl    $0x2,%eax
+  20191f:	01 d0                	add    %edx,%eax
+  201921:	01 c0                	add    %eax,%eax
+  201923:	89 c2                	mov    %eax,%edx
+  201925:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  201928:	01 c2                	add    %eax,%edx
+  20192a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  20192e:	89 10                	mov    %edx,(%rax)
+    for (; *str; str++) {
+  201930:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  201935:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201939:	0f b6 00             	movzbl (%rax),%eax
+  20193c:	84 c0                	test   %al,%al
+  20193e:	0f 85 34 ff ff ff    	jne    201878 <string_to_char+0x34>
+    }
+
+    return 0;
+  201944:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  201949:	c9                   	leave
+  20194a:	c3                   	ret
+
+000000000020194b <atoi>:
+
+int atoi(const char *str) {
+  20194b:	55                   	push   %rbp
+  20194c:	48 89 e5             	mov    %rsp,%rbp
+  20194f:	48 83 ec 18          	sub    $0x18,%rsp
+  201953:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    if (*str == '\0') return -1;
+  201957:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20195b:	0f b6 00             	movzbl (%rax),%eax
+  20195e:	84 c0                	test   %al,%al
+  201960:	75 0a                	jne    20196c <atoi+0x21>
+  201962:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  201967:	e9 d7 00 00 00       	jmp    201a43 <atoi+0xf8>
+
+    int n = 0;
+  20196c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    for (; *str; str++) {
+  201973:	e9 b7 00 00 00       	jmp    201a2f <atoi+0xe4>
+        int digit = 0;
+  201978:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+        switch (*str)
+  20197f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201983:	0f b6 00             	movzbl (%rax),%eax
+  201986:	0f be c0             	movsbl %al,%eax
+  201989:	83 e8 30             	sub    $0x30,%eax
+  20198c:	83 f8 09             	cmp    $0x9,%eax
+  20198f:	77 7c                	ja     201a0d <atoi+0xc2>
+  201991:	89 c0                	mov    %eax,%eax
+  201993:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  20199a:	00 
+  20199b:	48 8d 05 aa 0c 00 00 	lea    0xcaa(%rip),%rax        # 20264c <flag_chars+0x11c>
+  2019a2:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+  2019a5:	48 98                	cltq
+  2019a7:	48 8d 15 9e 0c 00 00 	lea    0xc9e(%rip),%rdx        # 20264c <flag_chars+0x11c>
+  2019ae:	48 01 d0             	add    %rdx,%rax
+  2019b1:	ff e0                	jmp    *%rax
+        {
+        case '0':
+            digit = 0;
+  2019b3:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+            break;
+  2019ba:	eb 58                	jmp    201a14 <atoi+0xc9>
+        case '1':
+            digit = 1;
+  2019bc:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+            break;
+  2019c3:	eb 4f                	jmp    201a14 <atoi+0xc9>
+        case '2':
+            digit = 2;
+  2019c5:	c7 45 f8 02 00 00 00 	movl   $0x2,-0x8(%rbp)
+            break;
+  2019cc:	eb 46                	jmp    201a14 <atoi+0xc9>
+        case '3':
+            digit = 3;
+  2019ce:	c7 45 f8 03 00 00 00 	movl   $0x3,-0x8(%rbp)
+            break;
+  2019d5:	eb 3d                	jmp    201a14 <atoi+0xc9>
+        case '4':
+            digit = 4;
+  2019d7:	c7 45 f8 04 00 00 00 	movl   $0x4,-0x8(%rbp)
+            break;
+  2019de:	eb 34                	jmp    201a14 <atoi+0xc9>
+        case '5':
+            digit = 5;
+  2019e0:	c7 45 f8 05 00 00 00 	movl   $0x5,-0x8(%rbp)
+            break;
+  2019e7:	eb 2b                	jmp    201a14 <atoi+0xc9>
+        case '6':
+            digit = 6;
+  2019e9:	c7 45 f8 06 00 00 00 	movl   $0x6,-0x8(%rbp)
+            break;
+  2019f0:	eb 22                	jmp    201a14 <atoi+0xc9>
+        case '7':
+            digit = 7;
+  2019f2:	c7 45 f8 07 00 00 00 	movl   $0x7,-0x8(%rbp)
+            break;
+  2019f9:	eb 19                	jmp    201a14 <atoi+0xc9>
+        case '8':
+            digit = 8;
+  2019fb:	c7 45 f8 08 00 00 00 	movl   $0x8,-0x8(%rbp)
+            break;
+  201a02:	eb 10                	jmp    201a14 <atoi+0xc9>
+        case '9':
+            digit = 9;
+  201a04:	c7 45 f8 09 00 00 00 	movl   $0x9,-0x8(%rbp)
+            break;
+  201a0b:	eb 07                	jmp    201a14 <atoi+0xc9>
+        default:
+            return -1;
+  201a0d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  201a12:	eb 2f                	jmp    201a43 <atoi+0xf8>
+        }
+
+        n = n * 10 + digit;
+  201a14:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  201a17:	89 d0                	mov    %edx,%eax
+  201a19:	c1 e0 02             	shl    $0x2,%eax
+  201a1c:	01 d0                	add    %edx,%eax
+  201a1e:	01 c0                	add    %eax,%eax
+  201a20:	89 c2                	mov    %eax,%edx
+  201a22:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  201a25:	01 d0                	add    %edx,%eax
+  201a27:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    for (; *str; str++) {
+  201a2a:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  201a2f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201a33:	0f b6 00             	movzbl (%rax),%eax
+  201a36:	84 c0                	test   %al,%al
+  201a38:	0f 85 3a ff ff ff    	jne    201978 <atoi+0x2d>
+    }
+
+    return 0;
+  201a3e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  201a43:	c9                   	leave
+  201a44:	c3                   	ret
+
+0000000000201a45 <copy_comp>:
+        components[ncomp++] = (comp); \
+    } \
+} while (0)
+
+// Helper to copy a component to dst
+void copy_comp(const char *start, const char *end, char **pdst) {
+  201a45:	55                   	push   %rbp
+  201a46:	48 89 e5             	mov    %rsp,%rbp
+  201a49:	48 83 ec 18          	sub    $0x18,%rsp
+  201a4d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  201a51:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  201a55:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    while (start < end) {
+  201a59:	eb 23                	jmp    201a7e <copy_comp+0x39>
+        *(*pdst)++ = *start++;
+  201a5b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  201a5f:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  201a63:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  201a67:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201a6b:	48 8b 00             	mov    (%rax),%rax
+  201a6e:	48 8d 70 01          	lea    0x1(%rax),%rsi
+  201a72:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  201a76:	48 89 31             	mov    %rsi,(%rcx)
+  201a79:	0f b6 12             	movzbl (%rdx),%edx
+  201a7c:	88 10                	mov    %dl,(%rax)
+    while (start < end) {
+  201a7e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  201a82:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  201a86:	72 d3                	jb     201a5b <copy_comp+0x16>
+    }
+}
+  201a88:	90                   	nop
+  201a89:	90                   	nop
+  201a8a:	c9                   	leave
+  201a8b:	c3                   	ret
+
+0000000000201a8c <join_path>:
+
+
+void join_path(const char *abs_path, const char *path, char *dst) {
+  201a8c:	55                   	push   %rbp
+  201a8d:	48 89 e5             	mov    %rsp,%rbp
+  201a90:	48 81 ec 68 02 00 00 	sub    $0x268,%rsp
+  201a97:	48 89 bd a8 fd ff ff 	mov    %rdi,-0x258(%rbp)
+  201a9e:	48 89 b5 a0 fd ff ff 	mov    %rsi,-0x260(%rbp)
+  201aa5:	48 89 95 98 fd ff ff 	mov    %rdx,-0x268(%rbp)
+    // If path is absolute, just copy it to dst (removing duplicate slashes, and trailing slash unless root)
+    if (path[0] == '/') {
+  201aac:	48 8b 85 a0 fd ff ff 	mov    -0x260(%rbp),%rax
+  201ab3:	0f b6 00             	movzbl (%rax),%eax
+  201ab6:	3c 2f                	cmp    $0x2f,%al
+  201ab8:	0f 85 d6 00 00 00    	jne    201b94 <join_path+0x108>
+        const char *src = path;
+  201abe:	48 8b 85 a0 fd ff ff 	mov    -0x260(%rbp),%rax
+  201ac5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+        char *d = dst;
+  201ac9:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  201ad0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+        // Always start with a single slash
+        *d++ = '/';
+  201ad4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  201ad8:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  201adc:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  201ae0:	c6 00 2f             	movb   $0x2f,(%rax)
+        src++;
+  201ae3:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+        int last_was_slash = 1;
+  201ae8:	c7 45 b0 01 00 00 00 	movl   $0x1,-0x50(%rbp)
+        while (*src) {
+  201aef:	eb 64                	jmp    201b55 <join_path+0xc9>
+            if (*src == '/') {
+  201af1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  201af5:	0f b6 00             	movzbl (%rax),%eax
+  201af8:	3c 2f                	cmp    $0x2f,%al
+  201afa:	75 35                	jne    201b31 <join_path+0xa5>
+                // Skip consecutive slashes
+                while (*src == '/') src++;
+  201afc:	eb 05                	jmp    201b03 <join_path+0x77>
+  201afe:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  201b03:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  201b07:	0f b6 00             	movzbl (%rax),%eax
+  201b0a:	3c 2f                	cmp    $0x2f,%al
+  201b0c:	74 f0                	je     201afe <join_path+0x72>
+                if (*src == 0) break;
+  201b0e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  201b12:	0f b6 00             	movzbl (%rax),%eax
+  201b15:	84 c0                	test   %al,%al
+  201b17:	74 49                	je     201b62 <join_path+0xd6>
+                *d++ = '/';
+  201b19:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  201b1d:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  201b21:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  201b25:	c6 00 2f             	movb   $0x2f,(%rax)
+                last_was_slash = 1;
+  201b28:	c7 45 b0 01 00 00 00 	movl   $0x1,-0x50(%rbp)
+  201b2f:	eb 24                	jmp    201b55 <join_path+0xc9>
+            } else {
+                *d++ = *src++;
+  201b31:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  201b35:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  201b39:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  201b3d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  201b41:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  201b45:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  201b49:	0f b6 12             	movzbl (%rdx),%edx
+  201b4c:	88 10                	mov    %dl,(%rax)
+                last_was_slash = 0;
+  201b4e:	c7 45 b0 00 00 00 00 	movl   $0x0,-0x50(%rbp)
+        while (*src) {
+  201b55:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  201b59:	0f b6 00             	movzbl (%rax),%eax
+  201b5c:	84 c0                	test   %al,%al
+  201b5e:	75 91                	jne    201af1 <join_path+0x65>
+  201b60:	eb 01                	jmp    201b63 <join_path+0xd7>
+                if (*src == 0) break;
+  201b62:	90                   	nop
+            }
+        }
+        // Remove trailing slash unless the path is just "/"
+        if (d > dst + 1 && *(d-1) == '/') {
+  201b63:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  201b6a:	48 83 c0 01          	add    $0x1,%rax
+  201b6e:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  201b72:	73 14                	jae    201b88 <join_path+0xfc>
+  201b74:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  201b78:	48 83 e8 01          	sub    $0x1,%rax
+  201b7c:	0f b6 00             	movzbl (%rax),%eax
+  201b7f:	3c 2f                	cmp    $0x2f,%al
+  201b81:	75 05                	jne    201b88 <join_path+0xfc>
+            d--;
+  201b83:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+        }
+        *d = 0;
+  201b88:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  201b8c:	c6 00 00             	movb   $0x0,(%rax)
+  201b8f:	e9 e9 02 00 00       	jmp    201e7d <join_path+0x3f1>
+        return;
+    }
+
+    // Otherwise, start with abs_path
+    const char *src = abs_path;
+  201b94:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  201b9b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    char *d = dst;
+  201b9f:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  201ba6:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    if (*src != '/') {
+  201baa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201bae:	0f b6 00             	movzbl (%rax),%eax
+  201bb1:	3c 2f                	cmp    $0x2f,%al
+  201bb3:	74 2e                	je     201be3 <join_path+0x157>
+        *d++ = '/';
+  201bb5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  201bb9:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  201bbd:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  201bc1:	c6 00 2f             	movb   $0x2f,(%rax)
+    }
+    while (*src) {
+  201bc4:	eb 1d                	jmp    201be3 <join_path+0x157>
+        *d++ = *src++;
+  201bc6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  201bca:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  201bce:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  201bd2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  201bd6:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  201bda:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  201bde:	0f b6 12             	movzbl (%rdx),%edx
+  201be1:	88 10                	mov    %dl,(%rax)
+    while (*src) {
+  201be3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201be7:	0f b6 00             	movzbl (%rax),%eax
+  201bea:	84 c0                	test   %al,%al
+  201bec:	75 d8                	jne    201bc6 <join_path+0x13a>
+    }
+    // Remove trailing slash (unless root)
+    if (d > dst + 1 && *(d-1) == '/') {
+  201bee:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  201bf5:	48 83 c0 01          	add    $0x1,%rax
+  201bf9:	48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+  201bfd:	73 14                	jae    201c13 <join_path+0x187>
+  201bff:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  201c03:	48 83 e8 01          	sub    $0x1,%rax
+  201c07:	0f b6 00             	movzbl (%rax),%eax
+  201c0a:	3c 2f                	cmp    $0x2f,%al
+  201c0c:	75 05                	jne    201c13 <join_path+0x187>
+        d--;
+  201c0e:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+    }
+    *d = 0;
+  201c13:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  201c17:	c6 00 00             	movb   $0x0,(%rax)
+
+    // Now, process path components
+    char temp[512];
+    int tlen = 0;
+  201c1a:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    // Copy dst to temp for easier manipulation
+    src = dst;
+  201c21:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  201c28:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    while (*src && tlen < (int)sizeof(temp)-1) {
+  201c2c:	eb 22                	jmp    201c50 <join_path+0x1c4>
+        temp[tlen++] = *src++;
+  201c2e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201c32:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  201c36:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  201c3a:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  201c3d:	8d 4a 01             	lea    0x1(%rdx),%ecx
+  201c40:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  201c43:	0f b6 08             	movzbl (%rax),%ecx
+  201c46:	48 63 c2             	movslq %edx,%rax
+  201c49:	88 8c 05 b0 fd ff ff 	mov    %cl,-0x250(%rbp,%rax,1)
+    while (*src && tlen < (int)sizeof(temp)-1) {
+  201c50:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201c54:	0f b6 00             	movzbl (%rax),%eax
+  201c57:	84 c0                	test   %al,%al
+  201c59:	74 09                	je     201c64 <join_path+0x1d8>
+  201c5b:	81 7d dc fe 01 00 00 	cmpl   $0x1fe,-0x24(%rbp)
+  201c62:	7e ca                	jle    201c2e <join_path+0x1a2>
+    }
+    temp[tlen] = 0;
+  201c64:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201c67:	48 98                	cltq
+  201c69:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  201c70:	00 
+
+    // Now, process each component in path
+    src = path;
+  201c71:	48 8b 85 a0 fd ff ff 	mov    -0x260(%rbp),%rax
+  201c78:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    while (*src) {
+  201c7c:	e9 65 01 00 00       	jmp    201de6 <join_path+0x35a>
+        // Skip slashes
+        while (*src == '/') src++;
+  201c81:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  201c86:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201c8a:	0f b6 00             	movzbl (%rax),%eax
+  201c8d:	3c 2f                	cmp    $0x2f,%al
+  201c8f:	74 f0                	je     201c81 <join_path+0x1f5>
+        if (!*src) break;
+  201c91:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201c95:	0f b6 00             	movzbl (%rax),%eax
+  201c98:	84 c0                	test   %al,%al
+  201c9a:	0f 84 57 01 00 00    	je     201df7 <join_path+0x36b>
+
+        // Find end of component
+        const char *comp_start = src;
+  201ca0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201ca4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        while (*src && *src != '/') src++;
+  201ca8:	eb 05                	jmp    201caf <join_path+0x223>
+  201caa:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  201caf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201cb3:	0f b6 00             	movzbl (%rax),%eax
+  201cb6:	84 c0                	test   %al,%al
+  201cb8:	74 0b                	je     201cc5 <join_path+0x239>
+  201cba:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201cbe:	0f b6 00             	movzbl (%rax),%eax
+  201cc1:	3c 2f                	cmp    $0x2f,%al
+  201cc3:	75 e5                	jne    201caa <join_path+0x21e>
+        const char *comp_end = src;
+  201cc5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201cc9:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+
+        int comp_len = comp_end - comp_start;
+  201ccd:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  201cd1:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  201cd5:	89 45 b4             	mov    %eax,-0x4c(%rbp)
+
+        // Get component string
+        if (comp_len == 1 && comp_start[0] == '.') {
+  201cd8:	83 7d b4 01          	cmpl   $0x1,-0x4c(%rbp)
+  201cdc:	75 10                	jne    201cee <join_path+0x262>
+  201cde:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  201ce2:	0f b6 00             	movzbl (%rax),%eax
+  201ce5:	3c 2e                	cmp    $0x2e,%al
+  201ce7:	75 05                	jne    201cee <join_path+0x262>
+            // Ignore
+            continue;
+  201ce9:	e9 f8 00 00 00       	jmp    201de6 <join_path+0x35a>
+        } else if (comp_len == 2 && comp_start[0] == '.' && comp_start[1] == '.') {
+  201cee:	83 7d b4 02          	cmpl   $0x2,-0x4c(%rbp)
+  201cf2:	75 6e                	jne    201d62 <join_path+0x2d6>
+  201cf4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  201cf8:	0f b6 00             	movzbl (%rax),%eax
+  201cfb:	3c 2e                	cmp    $0x2e,%al
+  201cfd:	75 63                	jne    201d62 <join_path+0x2d6>
+  201cff:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  201d03:	48 83 c0 01          	add    $0x1,%rax
+  201d07:	0f b6 00             	movzbl (%rax),%eax
+  201d0a:	3c 2e                	cmp    $0x2e,%al
+  201d0c:	75 54                	jne    201d62 <join_path+0x2d6>
+            // Go up one directory, unless at root
+            if (tlen > 1) {
+  201d0e:	83 7d dc 01          	cmpl   $0x1,-0x24(%rbp)
+  201d12:	0f 8e ce 00 00 00    	jle    201de6 <join_path+0x35a>
+                // Remove trailing slash if any
+                if (temp[tlen-1] == '/') tlen--;
+  201d18:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201d1b:	83 e8 01             	sub    $0x1,%eax
+  201d1e:	48 98                	cltq
+  201d20:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  201d27:	ff 
+  201d28:	3c 2f                	cmp    $0x2f,%al
+  201d2a:	75 0a                	jne    201d36 <join_path+0x2aa>
+  201d2c:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+                // Remove last component
+                while (tlen > 1 && temp[tlen-1] != '/') tlen--;
+  201d30:	eb 04                	jmp    201d36 <join_path+0x2aa>
+  201d32:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  201d36:	83 7d dc 01          	cmpl   $0x1,-0x24(%rbp)
+  201d3a:	7e 14                	jle    201d50 <join_path+0x2c4>
+  201d3c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201d3f:	83 e8 01             	sub    $0x1,%eax
+  201d42:	48 98                	cltq
+  201d44:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  201d4b:	ff 
+  201d4c:	3c 2f                	cmp    $0x2f,%al
+  201d4e:	75 e2                	jne    201d32 <join_path+0x2a6>
+                temp[tlen] = 0;
+  201d50:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201d53:	48 98                	cltq
+  201d55:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  201d5c:	00 
+            if (tlen > 1) {
+  201d5d:	e9 84 00 00 00       	jmp    201de6 <join_path+0x35a>
+            }
+        } else if (comp_len > 0) {
+  201d62:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  201d66:	7e 7e                	jle    201de6 <join_path+0x35a>
+            // Add slash if not at root
+            if (tlen == 0 || temp[tlen-1] != '/') {
+  201d68:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  201d6c:	74 14                	je     201d82 <join_path+0x2f6>
+  201d6e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201d71:	83 e8 01             	sub    $0x1,%eax
+  201d74:	48 98                	cltq
+  201d76:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  201d7d:	ff 
+  201d7e:	3c 2f                	cmp    $0x2f,%al
+  201d80:	74 1c                	je     201d9e <join_path+0x312>
+                if (tlen < (int)sizeof(temp)-1) temp[tlen++] = '/';
+  201d82:	81 7d dc fe 01 00 00 	cmpl   $0x1fe,-0x24(%rbp)
+  201d89:	7f 13                	jg     201d9e <join_path+0x312>
+  201d8b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201d8e:	8d 50 01             	lea    0x1(%rax),%edx
+  201d91:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  201d94:	48 98                	cltq
+  201d96:	c6 84 05 b0 fd ff ff 	movb   $0x2f,-0x250(%rbp,%rax,1)
+  201d9d:	2f 
+            }
+            // Copy component
+            for (const char *p = comp_start; p < comp_end && tlen < (int)sizeof(temp)-1; ++p) {
+  201d9e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  201da2:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  201da6:	eb 1e                	jmp    201dc6 <join_path+0x33a>
+                temp[tlen++] = *p;
+  201da8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201dab:	8d 50 01             	lea    0x1(%rax),%edx
+  201dae:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  201db1:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  201db5:	0f b6 12             	movzbl (%rdx),%edx
+  201db8:	48 98                	cltq
+  201dba:	88 94 05 b0 fd ff ff 	mov    %dl,-0x250(%rbp,%rax,1)
+            for (const char *p = comp_start; p < comp_end && tlen < (int)sizeof(temp)-1; ++p) {
+  201dc1:	48 83 45 d0 01       	addq   $0x1,-0x30(%rbp)
+  201dc6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  201dca:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  201dce:	73 09                	jae    201dd9 <join_path+0x34d>
+  201dd0:	81 7d dc fe 01 00 00 	cmpl   $0x1fe,-0x24(%rbp)
+  201dd7:	7e cf                	jle    201da8 <join_path+0x31c>
+            }
+            temp[tlen] = 0;
+  201dd9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201ddc:	48 98                	cltq
+  201dde:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  201de5:	00 
+    while (*src) {
+  201de6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201dea:	0f b6 00             	movzbl (%rax),%eax
+  201ded:	84 c0                	test   %al,%al
+  201def:	0f 85 91 fe ff ff    	jne    201c86 <join_path+0x1fa>
+  201df5:	eb 01                	jmp    201df8 <join_path+0x36c>
+        if (!*src) break;
+  201df7:	90                   	nop
+        }
+    }
+
+    // If temp is empty, set to "/"
+    if (tlen == 0) {
+  201df8:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  201dfc:	75 20                	jne    201e1e <join_path+0x392>
+        temp[tlen++] = '/';
+  201dfe:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201e01:	8d 50 01             	lea    0x1(%rax),%edx
+  201e04:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  201e07:	48 98                	cltq
+  201e09:	c6 84 05 b0 fd ff ff 	movb   $0x2f,-0x250(%rbp,%rax,1)
+  201e10:	2f 
+        temp[tlen] = 0;
+  201e11:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201e14:	48 98                	cltq
+  201e16:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  201e1d:	00 
+    }
+
+    // Remove trailing slash unless the path is just "/"
+    if (tlen > 1 && temp[tlen-1] == '/') {
+  201e1e:	83 7d dc 01          	cmpl   $0x1,-0x24(%rbp)
+  201e22:	7e 25                	jle    201e49 <join_path+0x3bd>
+  201e24:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201e27:	83 e8 01             	sub    $0x1,%eax
+  201e2a:	48 98                	cltq
+  201e2c:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  201e33:	ff 
+  201e34:	3c 2f                	cmp    $0x2f,%al
+  201e36:	75 11                	jne    201e49 <join_path+0x3bd>
+        temp[--tlen] = 0;
+  201e38:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  201e3c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201e3f:	48 98                	cltq
+  201e41:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  201e48:	00 
+    }
+
+    // Copy temp to dst
+    for (int i = 0; i <= tlen; ++i) {
+  201e49:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  201e50:	eb 23                	jmp    201e75 <join_path+0x3e9>
+        dst[i] = temp[i];
+  201e52:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  201e55:	48 63 d0             	movslq %eax,%rdx
+  201e58:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  201e5f:	48 01 c2             	add    %rax,%rdx
+  201e62:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  201e65:	48 98                	cltq
+  201e67:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  201e6e:	ff 
+  201e6f:	88 02                	mov    %al,(%rdx)
+    for (int i = 0; i <= tlen; ++i) {
+  201e71:	83 45 cc 01          	addl   $0x1,-0x34(%rbp)
+  201e75:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  201e78:	3b 45 dc             	cmp    -0x24(%rbp),%eax
+  201e7b:	7e d5                	jle    201e52 <join_path+0x3c6>
+    }
+}
+  201e7d:	c9                   	leave
+  201e7e:	c3                   	ret
+
+0000000000201e7f <app_printf>:
+#include "lib-malloc.h"
+#include "errno.h"
+// app_printf
+//     A version of console_printf that picks a sensible color by process ID.
+
+void app_printf(int colorid, const char* format, ...) {
+  201e7f:	55                   	push   %rbp
+  201e80:	48 89 e5             	mov    %rsp,%rbp
+  201e83:	48 83 ec 50          	sub    $0x50,%rsp
+  201e87:	49 89 f2             	mov    %rsi,%r10
+  201e8a:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  201e8e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  201e92:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  201e96:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    int color;
+    if (colorid < 0) {
+        color = 0x0700;
+  201e9a:	be 00 07 00 00       	mov    $0x700,%esi
+    if (colorid < 0) {
+  201e9f:	85 ff                	test   %edi,%edi
+  201ea1:	78 32                	js     201ed5 <app_printf+0x56>
+    } else {
+        static const uint8_t col[] = { 0x0F, 0x0C, 0x0A, 0x09, 0x0E };
+        color = col[colorid % sizeof(col)] << 8;
+  201ea3:	48 63 ff             	movslq %edi,%rdi
+  201ea6:	48 ba cd cc cc cc cc 	movabs $0xcccccccccccccccd,%rdx
+  201ead:	cc cc cc 
+  201eb0:	48 89 f8             	mov    %rdi,%rax
+  201eb3:	48 f7 e2             	mul    %rdx
+  201eb6:	48 89 d0             	mov    %rdx,%rax
+  201eb9:	48 c1 e8 02          	shr    $0x2,%rax
+  201ebd:	48 83 e2 fc          	and    $0xfffffffffffffffc,%rdx
+  201ec1:	48 01 c2             	add    %rax,%rdx
+  201ec4:	48 29 d7             	sub    %rdx,%rdi
+  201ec7:	48 8d 05 aa 09 00 00 	lea    0x9aa(%rip),%rax        # 202878 <col.0>
+  201ece:	0f b6 34 38          	movzbl (%rax,%rdi,1),%esi
+  201ed2:	c1 e6 08             	shl    $0x8,%esi
+    }
+
+    va_list val;
+    va_start(val, format);
+  201ed5:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  201edc:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  201ee0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  201ee4:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  201ee8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    cursorpos = console_vprintf(cursorpos, color, format, val);
+  201eec:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  201ef0:	4c 89 d2             	mov    %r10,%rdx
+  201ef3:	8b 3d 03 71 eb ff    	mov    -0x148efd(%rip),%edi        # b8ffc <cursorpos>
+  201ef9:	e8 24 f7 ff ff       	call   201622 <console_vprintf>
+  201efe:	89 05 f8 70 eb ff    	mov    %eax,-0x148f08(%rip)        # b8ffc <cursorpos>
+    va_end(val);
+
+    /*if (CROW(cursorpos) >= 23) {
+        cursorpos = CPOS(0, 0);
+    }*/
+}
+  201f04:	c9                   	leave
+  201f05:	c3                   	ret
+
+0000000000201f06 <panic>:
+
+
+// panic, assert_fail
+//     Call the INT_SYS_PANIC system call so the kernel loops until Control-C.
+
+void panic(const char* format, ...) {
+  201f06:	55                   	push   %rbp
+  201f07:	48 89 e5             	mov    %rsp,%rbp
+  201f0a:	53                   	push   %rbx
+  201f0b:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  201f12:	48 89 fb             	mov    %rdi,%rbx
+  201f15:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  201f19:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  201f1d:	48 89 4d d8          	mov    %rcx,-0x28(%rbp)
+  201f21:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  201f25:	4c 89 4d e8          	mov    %r9,-0x18(%rbp)
+    va_list val;
+    va_start(val, format);
+  201f29:	c7 45 a8 08 00 00 00 	movl   $0x8,-0x58(%rbp)
+  201f30:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  201f34:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  201f38:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  201f3c:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    char buf[160];
+    memcpy(buf, "PANIC: ", 7);
+  201f40:	48 8d bd 08 ff ff ff 	lea    -0xf8(%rbp),%rdi
+  201f47:	ba 07 00 00 00       	mov    $0x7,%edx
+  201f4c:	48 8d 35 5e 07 00 00 	lea    0x75e(%rip),%rsi        # 2026b1 <lower_digits.0+0x11>
+  201f53:	e8 31 e5 ff ff       	call   200489 <memcpy>
+    int len = vsnprintf(&buf[7], sizeof(buf) - 7, format, val) + 7;
+  201f58:	48 8d 4d a8          	lea    -0x58(%rbp),%rcx
+  201f5c:	48 8d bd 0f ff ff ff 	lea    -0xf1(%rbp),%rdi
+  201f63:	48 89 da             	mov    %rbx,%rdx
+  201f66:	be 99 00 00 00       	mov    $0x99,%esi
+  201f6b:	e8 cd f7 ff ff       	call   20173d <vsnprintf>
+  201f70:	8d 50 07             	lea    0x7(%rax),%edx
+    va_end(val);
+    if (len > 0 && buf[len - 1] != '\n') {
+  201f73:	85 d2                	test   %edx,%edx
+  201f75:	7e 0f                	jle    201f86 <panic+0x80>
+  201f77:	83 c0 06             	add    $0x6,%eax
+  201f7a:	48 98                	cltq
+  201f7c:	80 bc 05 08 ff ff ff 	cmpb   $0xa,-0xf8(%rbp,%rax,1)
+  201f83:	0a 
+  201f84:	75 30                	jne    201fb6 <panic+0xb0>
+        strcpy(buf + len - (len == (int) sizeof(buf) - 1), "\n");
+    }
+    (void) console_printf(CPOS(23, 0), 0xC000, "%s", buf);
+  201f86:	48 8d 8d 08 ff ff ff 	lea    -0xf8(%rbp),%rcx
+  201f8d:	48 8d 15 25 07 00 00 	lea    0x725(%rip),%rdx        # 2026b9 <lower_digits.0+0x19>
+  201f94:	be 00 c0 00 00       	mov    $0xc000,%esi
+  201f99:	bf 30 07 00 00       	mov    $0x730,%edi
+  201f9e:	b8 00 00 00 00       	mov    $0x0,%eax
+  201fa3:	e8 f5 f6 ff ff       	call   20169d <console_printf>
+    asm volatile ("syscall" : "=a" (rax)
+  201fa8:	b8 30 00 00 00       	mov    $0x30,%eax
+  201fad:	bf 00 00 00 00       	mov    $0x0,%edi
+  201fb2:	0f 05                	syscall
+ loop: goto loop;
+  201fb4:	eb fe                	jmp    201fb4 <panic+0xae>
+        strcpy(buf + len - (len == (int) sizeof(buf) - 1), "\n");
+  201fb6:	48 63 c2             	movslq %edx,%rax
+  201fb9:	81 fa 9f 00 00 00    	cmp    $0x9f,%edx
+  201fbf:	0f 94 c2             	sete   %dl
+  201fc2:	0f b6 d2             	movzbl %dl,%edx
+  201fc5:	48 29 d0             	sub    %rdx,%rax
+  201fc8:	48 8d bc 05 08 ff ff 	lea    -0xf8(%rbp,%rax,1),%rdi
+  201fcf:	ff 
+  201fd0:	48 8d 35 a1 04 00 00 	lea    0x4a1(%rip),%rsi        # 202478 <malloc+0xaa>
+  201fd7:	e8 3b e8 ff ff       	call   200817 <strcpy>
+  201fdc:	eb a8                	jmp    201f86 <panic+0x80>
+
+0000000000201fde <raise>:
+
+#define SIGABRT -1
+
+
+
+int raise(int sig) {
+  201fde:	89 fe                	mov    %edi,%esi
+
+// getpid()
+//    Return current process ID, like sys_getpid().
+static inline pid_t getpid(void) {
+    return vdso()->pid;
+  201fe0:	8b 3c 25 00 10 24 00 	mov    0x241000,%edi
+    asm volatile ("syscall" : "=a" (result)
+  201fe7:	b8 41 00 00 00       	mov    $0x41,%eax
+  201fec:	0f 05                	syscall
+    return sys_kill(getpid(), sig);
+}
+  201fee:	c3                   	ret
+
+0000000000201fef <abort>:
+    return vdso()->pid;
+  201fef:	8b 3c 25 00 10 24 00 	mov    0x241000,%edi
+    asm volatile ("syscall" : "=a" (result)
+  201ff6:	b8 41 00 00 00       	mov    $0x41,%eax
+  201ffb:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  202000:	0f 05                	syscall
+
+void __attribute((noreturn)) abort(void) {
+    raise(SIGABRT);
+ spinloop: goto spinloop;       // should never get here
+  202002:	eb fe                	jmp    202002 <abort+0x13>
+
+0000000000202004 <assert_fail>:
+}
+
+
+void assert_fail(const char* file, int line, const char* msg) {
+  202004:	55                   	push   %rbp
+  202005:	48 89 e5             	mov    %rsp,%rbp
+  202008:	48 89 f9             	mov    %rdi,%rcx
+  20200b:	41 89 f0             	mov    %esi,%r8d
+  20200e:	49 89 d1             	mov    %rdx,%r9
+    (void) console_printf(CPOS(23, 0), 0xC000,
+  202011:	48 8d 15 80 07 00 00 	lea    0x780(%rip),%rdx        # 202798 <lower_digits.0+0xf8>
+  202018:	be 00 c0 00 00       	mov    $0xc000,%esi
+  20201d:	bf 30 07 00 00       	mov    $0x730,%edi
+  202022:	b8 00 00 00 00       	mov    $0x0,%eax
+  202027:	e8 71 f6 ff ff       	call   20169d <console_printf>
+                          "PANIC: %s:%d: assertion '%s' failed\n",
+                          file, line, msg);
+    abort();
+  20202c:	e8 be ff ff ff       	call   201fef <abort>
+
+0000000000202031 <scan_char>:
+    asm volatile ("syscall" : "=a" (result)
+  202031:	bf 3a 00 00 00       	mov    $0x3a,%edi
+    asm volatile ("syscall" : "=a" (rax)
+  202036:	be 3c 00 00 00       	mov    $0x3c,%esi
+    asm volatile ("syscall" : "=a" (result)
+  20203b:	89 f8                	mov    %edi,%eax
+  20203d:	0f 05                	syscall
+  20203f:	89 c2                	mov    %eax,%edx
+    asm volatile ("syscall" : "=a" (rax)
+  202041:	89 f0                	mov    %esi,%eax
+  202043:	0f 05                	syscall
+    int c;
+
+    do {
+        c = sys_keybord();
+        sys_yield();
+    } while (c == -1);
+  202045:	83 fa ff             	cmp    $0xffffffff,%edx
+  202048:	74 f1                	je     20203b <scan_char+0xa>
+
+    return c;
+  20204a:	89 d0                	mov    %edx,%eax
+}
+  20204c:	c3                   	ret
+
+000000000020204d <scan_line>:
+
+unsigned int scan_line(char* dst, unsigned int length_max) {
+  20204d:	55                   	push   %rbp
+  20204e:	48 89 e5             	mov    %rsp,%rbp
+  202051:	41 57                	push   %r15
+  202053:	41 56                	push   %r14
+  202055:	41 55                	push   %r13
+  202057:	41 54                	push   %r12
+  202059:	53                   	push   %rbx
+  20205a:	48 83 ec 08          	sub    $0x8,%rsp
+  20205e:	49 89 fe             	mov    %rdi,%r14
+  202061:	41 89 f5             	mov    %esi,%r13d
+    unsigned int length = 0;
+  202064:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            app_printf(0, "%c", c);
+            dst[length] = '\0';
+            return length;
+        } else if (c >= 32 && c <= 127) {
+            if (length < length_max) {
+                app_printf(0, "%c", c);
+  20206a:	4c 8d 3d 4b 06 00 00 	lea    0x64b(%rip),%r15        # 2026bc <lower_digits.0+0x1c>
+  202071:	eb 05                	jmp    202078 <scan_line+0x2b>
+            if (length != 0) {
+  202073:	45 85 e4             	test   %r12d,%r12d
+  202076:	75 3e                	jne    2020b6 <scan_line+0x69>
+        unsigned char c = scan_char();
+  202078:	e8 b4 ff ff ff       	call   202031 <scan_char>
+  20207d:	89 c3                	mov    %eax,%ebx
+        if (c == '\b') {
+  20207f:	3c 08                	cmp    $0x8,%al
+  202081:	74 f0                	je     202073 <scan_line+0x26>
+        } else if (c == '\n') {
+  202083:	3c 0a                	cmp    $0xa,%al
+  202085:	74 4c                	je     2020d3 <scan_line+0x86>
+        } else if (c >= 32 && c <= 127) {
+  202087:	8d 43 e0             	lea    -0x20(%rbx),%eax
+            if (length < length_max) {
+  20208a:	3c 5f                	cmp    $0x5f,%al
+  20208c:	77 ea                	ja     202078 <scan_line+0x2b>
+  20208e:	45 39 ec             	cmp    %r13d,%r12d
+  202091:	73 e5                	jae    202078 <scan_line+0x2b>
+                app_printf(0, "%c", c);
+  202093:	0f b6 d3             	movzbl %bl,%edx
+  202096:	4c 89 fe             	mov    %r15,%rsi
+  202099:	bf 00 00 00 00       	mov    $0x0,%edi
+  20209e:	b8 00 00 00 00       	mov    $0x0,%eax
+  2020a3:	e8 d7 fd ff ff       	call   201e7f <app_printf>
+                dst[length++] = c;
+  2020a8:	44 89 e0             	mov    %r12d,%eax
+  2020ab:	41 88 1c 06          	mov    %bl,(%r14,%rax,1)
+  2020af:	45 8d 64 24 01       	lea    0x1(%r12),%r12d
+  2020b4:	eb c2                	jmp    202078 <scan_line+0x2b>
+                app_printf(0, "%c", c);
+  2020b6:	ba 08 00 00 00       	mov    $0x8,%edx
+  2020bb:	4c 89 fe             	mov    %r15,%rsi
+  2020be:	bf 00 00 00 00       	mov    $0x0,%edi
+  2020c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  2020c8:	e8 b2 fd ff ff       	call   201e7f <app_printf>
+                length--;
+  2020cd:	41 83 ec 01          	sub    $0x1,%r12d
+  2020d1:	eb a5                	jmp    202078 <scan_line+0x2b>
+            app_printf(0, "%c", c);
+  2020d3:	ba 0a 00 00 00       	mov    $0xa,%edx
+  2020d8:	48 8d 35 dd 05 00 00 	lea    0x5dd(%rip),%rsi        # 2026bc <lower_digits.0+0x1c>
+  2020df:	bf 00 00 00 00       	mov    $0x0,%edi
+  2020e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  2020e9:	e8 91 fd ff ff       	call   201e7f <app_printf>
+            dst[length] = '\0';
+  2020ee:	44 89 e0             	mov    %r12d,%eax
+  2020f1:	41 c6 04 06 00       	movb   $0x0,(%r14,%rax,1)
+            }
+        }
+    }
+}
+  2020f6:	44 89 e0             	mov    %r12d,%eax
+  2020f9:	48 83 c4 08          	add    $0x8,%rsp
+  2020fd:	5b                   	pop    %rbx
+  2020fe:	41 5c                	pop    %r12
+  202100:	41 5d                	pop    %r13
+  202102:	41 5e                	pop    %r14
+  202104:	41 5f                	pop    %r15
+  202106:	5d                   	pop    %rbp
+  202107:	c3                   	ret
+
+0000000000202108 <split_string>:
+
+
+char** split_string(char* str, char sep) {
+  202108:	55                   	push   %rbp
+  202109:	48 89 e5             	mov    %rsp,%rbp
+  20210c:	41 57                	push   %r15
+  20210e:	41 56                	push   %r14
+  202110:	41 55                	push   %r13
+  202112:	41 54                	push   %r12
+  202114:	53                   	push   %rbx
+  202115:	48 83 ec 08          	sub    $0x8,%rsp
+    int s = 1;
+    int n = 0;
+
+    while (str[n]) {
+  202119:	0f b6 07             	movzbl (%rdi),%eax
+  20211c:	84 c0                	test   %al,%al
+  20211e:	0f 84 ad 00 00 00    	je     2021d1 <split_string+0xc9>
+  202124:	48 89 fb             	mov    %rdi,%rbx
+  202127:	41 89 f4             	mov    %esi,%r12d
+  20212a:	41 be 01 00 00 00    	mov    $0x1,%r14d
+    int s = 1;
+  202130:	b9 01 00 00 00       	mov    $0x1,%ecx
+  202135:	eb 03                	jmp    20213a <split_string+0x32>
+  202137:	49 89 d6             	mov    %rdx,%r14
+        if (str[n] == sep)
+            s++;
+  20213a:	41 38 c4             	cmp    %al,%r12b
+  20213d:	0f 94 c0             	sete   %al
+  202140:	0f b6 c0             	movzbl %al,%eax
+  202143:	01 c1                	add    %eax,%ecx
+    while (str[n]) {
+  202145:	49 8d 56 01          	lea    0x1(%r14),%rdx
+  202149:	0f b6 44 13 ff       	movzbl -0x1(%rbx,%rdx,1),%eax
+  20214e:	84 c0                	test   %al,%al
+  202150:	75 e5                	jne    202137 <split_string+0x2f>
+        n++;
+    }
+    
+    char** part = malloc((s+1)*sizeof(char*));
+  202152:	44 8d 79 01          	lea    0x1(%rcx),%r15d
+  202156:	4d 63 ff             	movslq %r15d,%r15
+  202159:	49 c1 e7 03          	shl    $0x3,%r15
+  20215d:	4c 89 ff             	mov    %r15,%rdi
+  202160:	e8 69 02 00 00       	call   2023ce <malloc>
+  202165:	49 89 c5             	mov    %rax,%r13
+    char* buffer = malloc(n+1);
+  202168:	41 8d 7e 01          	lea    0x1(%r14),%edi
+  20216c:	48 63 ff             	movslq %edi,%rdi
+  20216f:	e8 5a 02 00 00       	call   2023ce <malloc>
+
+    int word_n = 0;
+    part[0] = buffer;
+  202174:	49 89 45 00          	mov    %rax,0x0(%r13)
+    part[s] = NULL;
+  202178:	4b c7 44 3d f8 00 00 	movq   $0x0,-0x8(%r13,%r15,1)
+  20217f:	00 00 
+    buffer[n] = 0;
+  202181:	42 c6 04 30 00       	movb   $0x0,(%rax,%r14,1)
+
+    for (int i = 0; i < n; i++) {
+  202186:	45 85 f6             	test   %r14d,%r14d
+  202189:	7e 6c                	jle    2021f7 <split_string+0xef>
+  20218b:	41 83 ee 01          	sub    $0x1,%r14d
+  20218f:	48 89 da             	mov    %rbx,%rdx
+  202192:	48 83 c0 01          	add    $0x1,%rax
+  202196:	48 89 c1             	mov    %rax,%rcx
+    int word_n = 0;
+  202199:	bf 00 00 00 00       	mov    $0x0,%edi
+  20219e:	eb 23                	jmp    2021c3 <split_string+0xbb>
+        if (str[i] == sep) {
+            buffer[i] = 0;
+  2021a0:	c6 41 ff 00          	movb   $0x0,-0x1(%rcx)
+            part[++word_n] = &buffer[i+1];
+  2021a4:	83 c7 01             	add    $0x1,%edi
+  2021a7:	48 63 f7             	movslq %edi,%rsi
+  2021aa:	49 89 4c f5 00       	mov    %rcx,0x0(%r13,%rsi,8)
+    for (int i = 0; i < n; i++) {
+  2021af:	48 83 c2 01          	add    $0x1,%rdx
+  2021b3:	48 83 c1 01          	add    $0x1,%rcx
+  2021b7:	89 ce                	mov    %ecx,%esi
+  2021b9:	29 c6                	sub    %eax,%esi
+  2021bb:	83 ee 01             	sub    $0x1,%esi
+  2021be:	44 39 f6             	cmp    %r14d,%esi
+  2021c1:	7d 34                	jge    2021f7 <split_string+0xef>
+        if (str[i] == sep) {
+  2021c3:	0f b6 32             	movzbl (%rdx),%esi
+  2021c6:	44 38 e6             	cmp    %r12b,%sil
+  2021c9:	74 d5                	je     2021a0 <split_string+0x98>
+        } else {
+            buffer[i] = str[i];
+  2021cb:	40 88 71 ff          	mov    %sil,-0x1(%rcx)
+  2021cf:	eb de                	jmp    2021af <split_string+0xa7>
+    char** part = malloc((s+1)*sizeof(char*));
+  2021d1:	bf 10 00 00 00       	mov    $0x10,%edi
+  2021d6:	e8 f3 01 00 00       	call   2023ce <malloc>
+  2021db:	49 89 c5             	mov    %rax,%r13
+    char* buffer = malloc(n+1);
+  2021de:	bf 01 00 00 00       	mov    $0x1,%edi
+  2021e3:	e8 e6 01 00 00       	call   2023ce <malloc>
+    part[0] = buffer;
+  2021e8:	49 89 45 00          	mov    %rax,0x0(%r13)
+    part[s] = NULL;
+  2021ec:	49 c7 45 08 00 00 00 	movq   $0x0,0x8(%r13)
+  2021f3:	00 
+    buffer[n] = 0;
+  2021f4:	c6 00 00             	movb   $0x0,(%rax)
+        }
+    }
+
+    return part;
+}
+  2021f7:	4c 89 e8             	mov    %r13,%rax
+  2021fa:	48 83 c4 08          	add    $0x8,%rsp
+  2021fe:	5b                   	pop    %rbx
+  2021ff:	41 5c                	pop    %r12
+  202201:	41 5d                	pop    %r13
+  202203:	41 5e                	pop    %r14
+  202205:	41 5f                	pop    %r15
+  202207:	5d                   	pop    %rbp
+  202208:	c3                   	ret
+
+0000000000202209 <app_print_error>:
+
+
+void app_print_error(int r) {
+  202209:	55                   	push   %rbp
+  20220a:	48 89 e5             	mov    %rsp,%rbp
+    switch (r) {
+  20220d:	83 ff 24             	cmp    $0x24,%edi
+  202210:	0f 87 79 01 00 00    	ja     20238f <app_print_error+0x186>
+  202216:	89 f8                	mov    %edi,%eax
+  202218:	48 8d 15 c5 05 00 00 	lea    0x5c5(%rip),%rdx        # 2027e4 <lower_digits.0+0x144>
+  20221f:	48 63 04 82          	movslq (%rdx,%rax,4),%rax
+  202223:	48 01 d0             	add    %rdx,%rax
+  202226:	ff e0                	jmp    *%rax
+        case ENOENT:
+            app_printf(1, "Error: %s\n", "No such file or directory");
+  202228:	48 8d 15 90 04 00 00 	lea    0x490(%rip),%rdx        # 2026bf <lower_digits.0+0x1f>
+  20222f:	48 8d 35 a3 04 00 00 	lea    0x4a3(%rip),%rsi        # 2026d9 <lower_digits.0+0x39>
+  202236:	bf 01 00 00 00       	mov    $0x1,%edi
+  20223b:	b8 00 00 00 00       	mov    $0x0,%eax
+  202240:	e8 3a fc ff ff       	call   201e7f <app_printf>
+            break;
+        default:
+            app_printf(1, "Error %d: %s\n", r, "Unknown error");
+            break;
+    }
+}
+  202245:	5d                   	pop    %rbp
+  202246:	c3                   	ret
+            app_printf(1, "Error: %s\n", "I/O error");
+  202247:	48 8d 15 96 04 00 00 	lea    0x496(%rip),%rdx        # 2026e4 <lower_digits.0+0x44>
+  20224e:	48 8d 35 84 04 00 00 	lea    0x484(%rip),%rsi        # 2026d9 <lower_digits.0+0x39>
+  202255:	bf 01 00 00 00       	mov    $0x1,%edi
+  20225a:	b8 00 00 00 00       	mov    $0x0,%eax
+  20225f:	e8 1b fc ff ff       	call   201e7f <app_printf>
+            break;
+  202264:	eb df                	jmp    202245 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Exec format error");
+  202266:	48 8d 15 81 04 00 00 	lea    0x481(%rip),%rdx        # 2026ee <lower_digits.0+0x4e>
+  20226d:	48 8d 35 65 04 00 00 	lea    0x465(%rip),%rsi        # 2026d9 <lower_digits.0+0x39>
+  202274:	bf 01 00 00 00       	mov    $0x1,%edi
+  202279:	b8 00 00 00 00       	mov    $0x0,%eax
+  20227e:	e8 fc fb ff ff       	call   201e7f <app_printf>
+            break;
+  202283:	eb c0                	jmp    202245 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Resource temporarily unavailable");
+  202285:	48 8d 15 34 05 00 00 	lea    0x534(%rip),%rdx        # 2027c0 <lower_digits.0+0x120>
+  20228c:	48 8d 35 46 04 00 00 	lea    0x446(%rip),%rsi        # 2026d9 <lower_digits.0+0x39>
+  202293:	bf 01 00 00 00       	mov    $0x1,%edi
+  202298:	b8 00 00 00 00       	mov    $0x0,%eax
+  20229d:	e8 dd fb ff ff       	call   201e7f <app_printf>
+            break;
+  2022a2:	eb a1                	jmp    202245 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Out of memory");
+  2022a4:	48 8d 15 55 04 00 00 	lea    0x455(%rip),%rdx        # 202700 <lower_digits.0+0x60>
+  2022ab:	48 8d 35 27 04 00 00 	lea    0x427(%rip),%rsi        # 2026d9 <lower_digits.0+0x39>
+  2022b2:	bf 01 00 00 00       	mov    $0x1,%edi
+  2022b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  2022bc:	e8 be fb ff ff       	call   201e7f <app_printf>
+            break;
+  2022c1:	eb 82                	jmp    202245 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Bad address");
+  2022c3:	48 8d 15 44 04 00 00 	lea    0x444(%rip),%rdx        # 20270e <lower_digits.0+0x6e>
+  2022ca:	48 8d 35 08 04 00 00 	lea    0x408(%rip),%rsi        # 2026d9 <lower_digits.0+0x39>
+  2022d1:	bf 01 00 00 00       	mov    $0x1,%edi
+  2022d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  2022db:	e8 9f fb ff ff       	call   201e7f <app_printf>
+            break;
+  2022e0:	e9 60 ff ff ff       	jmp    202245 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Not a directory");
+  2022e5:	48 8d 15 2e 04 00 00 	lea    0x42e(%rip),%rdx        # 20271a <lower_digits.0+0x7a>
+  2022ec:	48 8d 35 e6 03 00 00 	lea    0x3e6(%rip),%rsi        # 2026d9 <lower_digits.0+0x39>
+  2022f3:	bf 01 00 00 00       	mov    $0x1,%edi
+  2022f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  2022fd:	e8 7d fb ff ff       	call   201e7f <app_printf>
+            break;
+  202302:	e9 3e ff ff ff       	jmp    202245 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Invalid argument");
+  202307:	48 8d 15 1c 04 00 00 	lea    0x41c(%rip),%rdx        # 20272a <lower_digits.0+0x8a>
+  20230e:	48 8d 35 c4 03 00 00 	lea    0x3c4(%rip),%rsi        # 2026d9 <lower_digits.0+0x39>
+  202315:	bf 01 00 00 00       	mov    $0x1,%edi
+  20231a:	b8 00 00 00 00       	mov    $0x0,%eax
+  20231f:	e8 5b fb ff ff       	call   201e7f <app_printf>
+            break;
+  202324:	e9 1c ff ff ff       	jmp    202245 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "No space left on device");
+  202329:	48 8d 15 0b 04 00 00 	lea    0x40b(%rip),%rdx        # 20273b <lower_digits.0+0x9b>
+  202330:	48 8d 35 a2 03 00 00 	lea    0x3a2(%rip),%rsi        # 2026d9 <lower_digits.0+0x39>
+  202337:	bf 01 00 00 00       	mov    $0x1,%edi
+  20233c:	b8 00 00 00 00       	mov    $0x0,%eax
+  202341:	e8 39 fb ff ff       	call   201e7f <app_printf>
+            break;
+  202346:	e9 fa fe ff ff       	jmp    202245 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "File already exists");
+  20234b:	48 8d 15 01 04 00 00 	lea    0x401(%rip),%rdx        # 202753 <lower_digits.0+0xb3>
+  202352:	48 8d 35 80 03 00 00 	lea    0x380(%rip),%rsi        # 2026d9 <lower_digits.0+0x39>
+  202359:	bf 01 00 00 00       	mov    $0x1,%edi
+  20235e:	b8 00 00 00 00       	mov    $0x0,%eax
+  202363:	e8 17 fb ff ff       	call   201e7f <app_printf>
+            break;
+  202368:	e9 d8 fe ff ff       	jmp    202245 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "File name too long");
+  20236d:	48 8d 15 f3 03 00 00 	lea    0x3f3(%rip),%rdx        # 202767 <lower_digits.0+0xc7>
+  202374:	48 8d 35 5e 03 00 00 	lea    0x35e(%rip),%rsi        # 2026d9 <lower_digits.0+0x39>
+  20237b:	bf 01 00 00 00       	mov    $0x1,%edi
+  202380:	b8 00 00 00 00       	mov    $0x0,%eax
+  202385:	e8 f5 fa ff ff       	call   201e7f <app_printf>
+            break;
+  20238a:	e9 b6 fe ff ff       	jmp    202245 <app_print_error+0x3c>
+            app_printf(1, "Error %d: %s\n", r, "Unknown error");
+  20238f:	48 8d 0d e4 03 00 00 	lea    0x3e4(%rip),%rcx        # 20277a <lower_digits.0+0xda>
+  202396:	89 fa                	mov    %edi,%edx
+  202398:	48 8d 35 e9 03 00 00 	lea    0x3e9(%rip),%rsi        # 202788 <lower_digits.0+0xe8>
+  20239f:	bf 01 00 00 00       	mov    $0x1,%edi
+  2023a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  2023a9:	e8 d1 fa ff ff       	call   201e7f <app_printf>
+}
+  2023ae:	e9 92 fe ff ff       	jmp    202245 <app_print_error+0x3c>
+
+00000000002023b3 <handle_error>:
+
+__attribute__((noreturn)) void handle_error(int r) {
+  2023b3:	55                   	push   %rbp
+  2023b4:	48 89 e5             	mov    %rsp,%rbp
+  2023b7:	53                   	push   %rbx
+  2023b8:	48 83 ec 08          	sub    $0x8,%rsp
+  2023bc:	89 fb                	mov    %edi,%ebx
+    app_print_error(r);
+  2023be:	e8 46 fe ff ff       	call   202209 <app_print_error>
+    asm volatile ("syscall" : "=a" (rax)
+  2023c3:	b8 40 00 00 00       	mov    $0x40,%eax
+  2023c8:	89 df                	mov    %ebx,%edi
+  2023ca:	0f 05                	syscall
+ spinloop: goto spinloop;       // should never get here
+  2023cc:	eb fe                	jmp    2023cc <handle_error+0x19>
+
+00000000002023ce <malloc>:
+
+// The heap starts 1MB above the program image (PROC_START_ADDR)
+static uint8_t* heap_top = (uint8_t*) 0x300000;
+static uint8_t* page_top = (uint8_t*) 0x300000;
+
+void* malloc(size_t size) {
+  2023ce:	48 89 fe             	mov    %rdi,%rsi
+    while (ROUNDDOWN(heap_top + size, PAGESIZE) >= page_top) {
+  2023d1:	48 8b 05 30 0c 00 00 	mov    0xc30(%rip),%rax        # 203008 <heap_top>
+  2023d8:	48 8d 14 38          	lea    (%rax,%rdi,1),%rdx
+  2023dc:	48 8b 3d 1d 0c 00 00 	mov    0xc1d(%rip),%rdi        # 203000 <page_top>
+  2023e3:	48 89 d1             	mov    %rdx,%rcx
+  2023e6:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  2023ed:	48 39 f9             	cmp    %rdi,%rcx
+  2023f0:	72 3e                	jb     202430 <malloc+0x62>
+    asm volatile ("syscall" : "=a" (result)
+  2023f2:	41 b8 3b 00 00 00    	mov    $0x3b,%r8d
+  2023f8:	44 89 c0             	mov    %r8d,%eax
+  2023fb:	0f 05                	syscall
+        int r = sys_page_alloc(page_top);
+        assert(r >= 0);
+  2023fd:	85 c0                	test   %eax,%eax
+  2023ff:	78 37                	js     202438 <malloc+0x6a>
+        page_top += PAGESIZE;
+  202401:	48 8b 05 f8 0b 00 00 	mov    0xbf8(%rip),%rax        # 203000 <page_top>
+  202408:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  20240f:	48 89 3d ea 0b 00 00 	mov    %rdi,0xbea(%rip)        # 203000 <page_top>
+    while (ROUNDDOWN(heap_top + size, PAGESIZE) >= page_top) {
+  202416:	48 8b 05 eb 0b 00 00 	mov    0xbeb(%rip),%rax        # 203008 <heap_top>
+  20241d:	48 8d 14 30          	lea    (%rax,%rsi,1),%rdx
+  202421:	48 89 d1             	mov    %rdx,%rcx
+  202424:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  20242b:	48 39 f9             	cmp    %rdi,%rcx
+  20242e:	73 c8                	jae    2023f8 <malloc+0x2a>
+    }
+
+    void* addr = heap_top;
+    heap_top += size;
+  202430:	48 89 15 d1 0b 00 00 	mov    %rdx,0xbd1(%rip)        # 203008 <heap_top>
+    return addr;
+}
+  202437:	c3                   	ret
+void* malloc(size_t size) {
+  202438:	55                   	push   %rbp
+  202439:	48 89 e5             	mov    %rsp,%rbp
+        assert(r >= 0);
+  20243c:	48 8d 15 3a 04 00 00 	lea    0x43a(%rip),%rdx        # 20287d <col.0+0x5>
+  202443:	be 0b 00 00 00       	mov    $0xb,%esi
+  202448:	48 8d 3d 35 04 00 00 	lea    0x435(%rip),%rdi        # 202884 <col.0+0xc>
+  20244f:	e8 b0 fb ff ff       	call   202004 <assert_fail>
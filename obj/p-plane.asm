@@ -0,0 +1,3330 @@
+
+obj/p-plane.full:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000200000 <usage>:
+const char *usage_str =
+    "Usage: plane [FILE]\n"
+    "Plane a file.\n";
+
+
+void __attribute__((noreturn)) usage(void) {
+  200000:	55                   	push   %rbp
+  200001:	48 89 e5             	mov    %rsp,%rbp
+    app_printf(1, "%s", usage_str);
+  200004:	48 8b 15 f5 2f 00 00 	mov    0x2ff5(%rip),%rdx        # 203000 <usage_str>
+  20000b:	48 8d 35 6e 20 00 00 	lea    0x206e(%rip),%rsi        # 202080 <malloc+0x8a>
+  200012:	bf 01 00 00 00       	mov    $0x1,%edi
+  200017:	b8 00 00 00 00       	mov    $0x0,%eax
+  20001c:	e8 86 1a 00 00       	call   201aa7 <app_printf>
+// sys_exit()
+//    Exit this process. Does not return.
+static inline void sys_exit(int exit_code) __attribute__((noreturn));
+static inline void sys_exit(int exit_code) {
+    uint64_t rax;
+    asm volatile ("syscall" : "=a" (rax)
+  200021:	b8 40 00 00 00       	mov    $0x40,%eax
+  200026:	bf 01 00 00 00       	mov    $0x1,%edi
+  20002b:	0f 05                	syscall
+                  : "a" (INT_SYS_EXIT), "D" /* %rdi */ (exit_code)
+                  : "rcx", "r11", "cc", "memory");
+ spinloop: goto spinloop;       // should never get here
+  20002d:	eb fe                	jmp    20002d <usage+0x2d>
+
+000000000020002f <process_main>:
+    sys_exit(1);
+}
+
+
+void process_main(int argc, char* argv[]) {
+  20002f:	55                   	push   %rbp
+  200030:	48 89 e5             	mov    %rsp,%rbp
+  200033:	53                   	push   %rbx
+  200034:	48 83 ec 48          	sub    $0x48,%rsp
+    if (argc <= 1) {
+  200038:	83 ff 01             	cmp    $0x1,%edi
+  20003b:	7e 54                	jle    200091 <process_main+0x62>
+  20003d:	48 89 f3             	mov    %rsi,%rbx
+        usage();
+    }
+
+    char buffer[TEXT_SIZE];
+    unsigned int length = scan_line(buffer, TEXT_SIZE-2);
+  200040:	48 8d 7d b0          	lea    -0x50(%rbp),%rdi
+  200044:	be 3e 00 00 00       	mov    $0x3e,%esi
+  200049:	e8 27 1c 00 00       	call   201c75 <scan_line>
+    buffer[length] = '\n';
+  20004e:	89 c2                	mov    %eax,%edx
+  200050:	c6 44 15 b0 0a       	movb   $0xa,-0x50(%rbp,%rdx,1)
+    buffer[length+1] = '\0';
+  200055:	8d 40 01             	lea    0x1(%rax),%eax
+  200058:	c6 44 05 b0 00       	movb   $0x0,-0x50(%rbp,%rax,1)
+    asm volatile ("syscall" : "=a" (result)
+  20005d:	48 8b 7b 08          	mov    0x8(%rbx),%rdi
+  200061:	b8 33 00 00 00       	mov    $0x33,%eax
+  200066:	0f 05                	syscall
+  200068:	89 c7                	mov    %eax,%edi
+
+    int fd = sys_open(argv[1]);
+    if (fd < 0) handle_error(-fd);
+  20006a:	85 c0                	test   %eax,%eax
+  20006c:	78 28                	js     200096 <process_main+0x67>
+    asm volatile ("syscall" : "=a" (result)
+  20006e:	48 8d 75 b0          	lea    -0x50(%rbp),%rsi
+  200072:	b8 32 00 00 00       	mov    $0x32,%eax
+  200077:	ba 40 00 00 00       	mov    $0x40,%edx
+  20007c:	0f 05                	syscall
+    //app_printf(2, "%s opened -> %d\n", argv[1], fd);
+
+    ssize_t r = sys_write(fd, buffer, TEXT_SIZE);
+    if (r < 0) handle_error(-r);
+  20007e:	48 85 c0             	test   %rax,%rax
+  200081:	78 1a                	js     20009d <process_main+0x6e>
+    asm volatile ("syscall" : "=a" (rax)
+  200083:	b8 40 00 00 00       	mov    $0x40,%eax
+  200088:	bf 00 00 00 00       	mov    $0x0,%edi
+  20008d:	0f 05                	syscall
+ spinloop: goto spinloop;       // should never get here
+  20008f:	eb fe                	jmp    20008f <process_main+0x60>
+        usage();
+  200091:	e8 6a ff ff ff       	call   200000 <usage>
+    if (fd < 0) handle_error(-fd);
+  200096:	f7 df                	neg    %edi
+  200098:	e8 3e 1f 00 00       	call   201fdb <handle_error>
+    if (r < 0) handle_error(-r);
+  20009d:	89 c7                	mov    %eax,%edi
+  20009f:	f7 df                	neg    %edi
+  2000a1:	e8 35 1f 00 00       	call   201fdb <handle_error>
+
+00000000002000a6 <vdso>:
+// KERNEL DATA PAGE
+//
+//    The kernel keeps a read-only vdso_data (see lib.h) up to date at
+//    VDSO_ADDR. Reading it is a plain memory load, not a system call.
+
+static inline const volatile vdso_data* vdso(void) {
+  2000a6:	55                   	push   %rbp
+  2000a7:	48 89 e5             	mov    %rsp,%rbp
+    return (const volatile vdso_data*) VDSO_ADDR;
+  2000aa:	b8 00 10 24 00       	mov    $0x241000,%eax
+}
+  2000af:	5d                   	pop    %rbp
+  2000b0:	c3                   	ret
+
+00000000002000b1 <memcpy>:
+#define MEMOP_WORD_MIN 64
+
+// an unaligned word that may alias any object
+typedef uint64_t __attribute__((may_alias, aligned(1))) memop_word;
+
+void* memcpy(void* dst, const void* src, size_t n) {
+  2000b1:	55                   	push   %rbp
+  2000b2:	48 89 e5             	mov    %rsp,%rbp
+  2000b5:	48 83 ec 48          	sub    $0x48,%rsp
+  2000b9:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  2000bd:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  2000c1:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+    char* d = (char*) dst;
+  2000c5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  2000c9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    const char* s = (const char*) src;
+  2000cd:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  2000d1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (n >= MEMOP_WORD_MIN) {
+  2000d5:	48 83 7d b8 3f       	cmpq   $0x3f,-0x48(%rbp)
+  2000da:	0f 86 c5 00 00 00    	jbe    2001a5 <memcpy+0xf4>
+        size_t head = -(uintptr_t) d & 7;
+  2000e0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2000e4:	48 f7 d8             	neg    %rax
+  2000e7:	83 e0 07             	and    $0x7,%eax
+  2000ea:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        size_t words = (n - head) / 8;
+  2000ee:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  2000f2:	48 2b 45 e8          	sub    -0x18(%rbp),%rax
+  2000f6:	48 c1 e8 03          	shr    $0x3,%rax
+  2000fa:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+        n = (n - head) % 8;
+  2000fe:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  200102:	48 2b 45 e8          	sub    -0x18(%rbp),%rax
+  200106:	83 e0 07             	and    $0x7,%eax
+  200109:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        asm volatile("rep movsb" : "+D" (d), "+S" (s), "+c" (head)
+  20010d:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  200111:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  200115:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  200119:	48 89 cf             	mov    %rcx,%rdi
+  20011c:	48 89 d6             	mov    %rdx,%rsi
+  20011f:	48 89 c1             	mov    %rax,%rcx
+  200122:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  200124:	48 89 c8             	mov    %rcx,%rax
+  200127:	48 89 f2             	mov    %rsi,%rdx
+  20012a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  20012e:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  200132:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                     : : "memory");
+        asm volatile("rep movsq" : "+D" (d), "+S" (s), "+c" (words)
+  200136:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  20013a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  20013e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  200142:	48 89 cf             	mov    %rcx,%rdi
+  200145:	48 89 d6             	mov    %rdx,%rsi
+  200148:	48 89 c1             	mov    %rax,%rcx
+  20014b:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  20014e:	48 89 c8             	mov    %rcx,%rax
+  200151:	48 89 f2             	mov    %rsi,%rdx
+  200154:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  200158:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  20015c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+                     : : "memory");
+    }
+    for (; n >= 16; n -= 16, s += 16, d += 16) {
+  200160:	eb 43                	jmp    2001a5 <memcpy+0xf4>
+        memop_word a = ((const memop_word*) s)[0];
+  200162:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  200166:	48 8b 00             	mov    (%rax),%rax
+  200169:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+        memop_word b = ((const memop_word*) s)[1];
+  20016d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  200171:	48 83 c0 08          	add    $0x8,%rax
+  200175:	48 8b 00             	mov    (%rax),%rax
+  200178:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+        ((memop_word*) d)[0] = a;
+  20017c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200180:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  200184:	48 89 10             	mov    %rdx,(%rax)
+        ((memop_word*) d)[1] = b;
+  200187:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20018b:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  20018f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  200193:	48 89 02             	mov    %rax,(%rdx)
+    for (; n >= 16; n -= 16, s += 16, d += 16) {
+  200196:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  20019b:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  2001a0:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  2001a5:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  2001aa:	77 b6                	ja     200162 <memcpy+0xb1>
+    }
+    for (; n > 0; --n, ++s, ++d) {
+  2001ac:	eb 1c                	jmp    2001ca <memcpy+0x119>
+        *d = *s;
+  2001ae:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2001b2:	0f b6 10             	movzbl (%rax),%edx
+  2001b5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2001b9:	88 10                	mov    %dl,(%rax)
+    for (; n > 0; --n, ++s, ++d) {
+  2001bb:	48 83 6d b8 01       	subq   $0x1,-0x48(%rbp)
+  2001c0:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  2001c5:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  2001ca:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  2001cf:	75 dd                	jne    2001ae <memcpy+0xfd>
+    }
+    return dst;
+  2001d1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  2001d5:	c9                   	leave
+  2001d6:	c3                   	ret
+
+00000000002001d7 <memmove>:
+
+void* memmove(void* dst, const void* src, size_t n) {
+  2001d7:	55                   	push   %rbp
+  2001d8:	48 89 e5             	mov    %rsp,%rbp
+  2001db:	48 83 ec 38          	sub    $0x38,%rsp
+  2001df:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  2001e3:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  2001e7:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    const char* s = (const char*) src;
+  2001eb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  2001ef:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    char* d = (char*) dst;
+  2001f3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  2001f7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (!(s < d && s + n > d)) {
+  2001fb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2001ff:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  200203:	73 11                	jae    200216 <memmove+0x3f>
+  200205:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  200209:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  20020d:	48 01 d0             	add    %rdx,%rax
+  200210:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  200214:	72 1c                	jb     200232 <memmove+0x5b>
+        // a forward copy never overwrites source bytes it has yet to read
+        return memcpy(dst, src, n);
+  200216:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  20021a:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  20021e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  200222:	48 89 ce             	mov    %rcx,%rsi
+  200225:	48 89 c7             	mov    %rax,%rdi
+  200228:	e8 84 fe ff ff       	call   2000b1 <memcpy>
+  20022d:	e9 94 00 00 00       	jmp    2002c6 <memmove+0xef>
+    }
+
+    // copy backwards: the tail bytes, then words down to the start
+    size_t words = n / 8;
+  200232:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200236:	48 c1 e8 03          	shr    $0x3,%rax
+  20023a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    size_t tail = n % 8;
+  20023e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200242:	83 e0 07             	and    $0x7,%eax
+  200245:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    s += n - 1, d += n - 1;
+  200249:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  20024d:	48 83 e8 01          	sub    $0x1,%rax
+  200251:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  200255:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200259:	48 83 e8 01          	sub    $0x1,%rax
+  20025d:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    asm volatile("std; rep movsb; cld" : "+D" (d), "+S" (s), "+c" (tail)
+  200261:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  200265:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  200269:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  20026d:	48 89 cf             	mov    %rcx,%rdi
+  200270:	48 89 d6             	mov    %rdx,%rsi
+  200273:	48 89 c1             	mov    %rax,%rcx
+  200276:	fd                   	std
+  200277:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  200279:	fc                   	cld
+  20027a:	48 89 c8             	mov    %rcx,%rax
+  20027d:	48 89 f2             	mov    %rsi,%rdx
+  200280:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  200284:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  200288:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+                 : : "memory", "cc");
+    s -= 7, d -= 7;
+  20028c:	48 83 6d f8 07       	subq   $0x7,-0x8(%rbp)
+  200291:	48 83 6d f0 07       	subq   $0x7,-0x10(%rbp)
+    asm volatile("std; rep movsq; cld" : "+D" (d), "+S" (s), "+c" (words)
+  200296:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  20029a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  20029e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2002a2:	48 89 cf             	mov    %rcx,%rdi
+  2002a5:	48 89 d6             	mov    %rdx,%rsi
+  2002a8:	48 89 c1             	mov    %rax,%rcx
+  2002ab:	fd                   	std
+  2002ac:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  2002af:	fc                   	cld
+  2002b0:	48 89 c8             	mov    %rcx,%rax
+  2002b3:	48 89 f2             	mov    %rsi,%rdx
+  2002b6:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  2002ba:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  2002be:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 : : "memory", "cc");
+    return dst;
+  2002c2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  2002c6:	c9                   	leave
+  2002c7:	c3                   	ret
+
+00000000002002c8 <memset>:
+
+void* memset(void* v, int c, size_t n) {
+  2002c8:	55                   	push   %rbp
+  2002c9:	48 89 e5             	mov    %rsp,%rbp
+  2002cc:	48 83 ec 38          	sub    $0x38,%rsp
+  2002d0:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  2002d4:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  2002d7:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    char* p = (char*) v;
+  2002db:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  2002df:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    uint64_t word = (uint8_t) c * 0x0101010101010101UL;
+  2002e3:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  2002e6:	0f b6 c0             	movzbl %al,%eax
+  2002e9:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  2002f0:	01 01 01 
+  2002f3:	48 0f af c2          	imul   %rdx,%rax
+  2002f7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (n >= MEMOP_WORD_MIN) {
+  2002fb:	48 83 7d c8 3f       	cmpq   $0x3f,-0x38(%rbp)
+  200300:	0f 86 9e 00 00 00    	jbe    2003a4 <memset+0xdc>
+        size_t head = -(uintptr_t) p & 7;
+  200306:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20030a:	48 f7 d8             	neg    %rax
+  20030d:	83 e0 07             	and    $0x7,%eax
+  200310:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        size_t words = (n - head) / 8;
+  200314:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200318:	48 2b 45 e8          	sub    -0x18(%rbp),%rax
+  20031c:	48 c1 e8 03          	shr    $0x3,%rax
+  200320:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+        n = (n - head) % 8;
+  200324:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200328:	48 2b 45 e8          	sub    -0x18(%rbp),%rax
+  20032c:	83 e0 07             	and    $0x7,%eax
+  20032f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        asm volatile("rep stosb" : "+D" (p), "+c" (head) : "a" (word)
+  200333:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  200337:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  20033b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  20033f:	48 89 ce             	mov    %rcx,%rsi
+  200342:	48 89 f7             	mov    %rsi,%rdi
+  200345:	48 89 d1             	mov    %rdx,%rcx
+  200348:	f3 aa                	rep stos %al,%es:(%rdi)
+  20034a:	48 89 ca             	mov    %rcx,%rdx
+  20034d:	48 89 fe             	mov    %rdi,%rsi
+  200350:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  200354:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+                     : "memory");
+        asm volatile("rep stosq" : "+D" (p), "+c" (words) : "a" (word)
+  200358:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  20035c:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  200360:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  200364:	48 89 ce             	mov    %rcx,%rsi
+  200367:	48 89 f7             	mov    %rsi,%rdi
+  20036a:	48 89 d1             	mov    %rdx,%rcx
+  20036d:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  200370:	48 89 ca             	mov    %rcx,%rdx
+  200373:	48 89 fe             	mov    %rdi,%rsi
+  200376:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  20037a:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+                     : "memory");
+    }
+    for (; n >= 16; n -= 16, p += 16) {
+  20037e:	eb 24                	jmp    2003a4 <memset+0xdc>
+        ((memop_word*) p)[0] = word;
+  200380:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200384:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  200388:	48 89 10             	mov    %rdx,(%rax)
+        ((memop_word*) p)[1] = word;
+  20038b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20038f:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  200393:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  200397:	48 89 02             	mov    %rax,(%rdx)
+    for (; n >= 16; n -= 16, p += 16) {
+  20039a:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  20039f:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  2003a4:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  2003a9:	77 d5                	ja     200380 <memset+0xb8>
+    }
+    for (; n > 0; ++p, --n) {
+  2003ab:	eb 15                	jmp    2003c2 <memset+0xfa>
+        *p = c;
+  2003ad:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  2003b0:	89 c2                	mov    %eax,%edx
+  2003b2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2003b6:	88 10                	mov    %dl,(%rax)
+    for (; n > 0; ++p, --n) {
+  2003b8:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  2003bd:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  2003c2:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  2003c7:	75 e4                	jne    2003ad <memset+0xe5>
+    }
+    return v;
+  2003c9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  2003cd:	c9                   	leave
+  2003ce:	c3                   	ret
+
+00000000002003cf <strlen>:
+
+size_t strlen(const char* s) {
+  2003cf:	55                   	push   %rbp
+  2003d0:	48 89 e5             	mov    %rsp,%rbp
+  2003d3:	48 83 ec 18          	sub    $0x18,%rsp
+  2003d7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    size_t n;
+    for (n = 0; *s != '\0'; ++s) {
+  2003db:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  2003e2:	00 
+  2003e3:	eb 0a                	jmp    2003ef <strlen+0x20>
+        ++n;
+  2003e5:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    for (n = 0; *s != '\0'; ++s) {
+  2003ea:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  2003ef:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2003f3:	0f b6 00             	movzbl (%rax),%eax
+  2003f6:	84 c0                	test   %al,%al
+  2003f8:	75 eb                	jne    2003e5 <strlen+0x16>
+    }
+    return n;
+  2003fa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  2003fe:	c9                   	leave
+  2003ff:	c3                   	ret
+
+0000000000200400 <strnlen>:
+
+size_t strnlen(const char* s, size_t maxlen) {
+  200400:	55                   	push   %rbp
+  200401:	48 89 e5             	mov    %rsp,%rbp
+  200404:	48 83 ec 20          	sub    $0x20,%rsp
+  200408:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  20040c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    size_t n;
+    for (n = 0; n != maxlen && *s != '\0'; ++s) {
+  200410:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  200417:	00 
+  200418:	eb 0a                	jmp    200424 <strnlen+0x24>
+        ++n;
+  20041a:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    for (n = 0; n != maxlen && *s != '\0'; ++s) {
+  20041f:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  200424:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200428:	48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+  20042c:	74 0b                	je     200439 <strnlen+0x39>
+  20042e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  200432:	0f b6 00             	movzbl (%rax),%eax
+  200435:	84 c0                	test   %al,%al
+  200437:	75 e1                	jne    20041a <strnlen+0x1a>
+    }
+    return n;
+  200439:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  20043d:	c9                   	leave
+  20043e:	c3                   	ret
+
+000000000020043f <strcpy>:
+
+char* strcpy(char* dst, const char* src) {
+  20043f:	55                   	push   %rbp
+  200440:	48 89 e5             	mov    %rsp,%rbp
+  200443:	48 83 ec 20          	sub    $0x20,%rsp
+  200447:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  20044b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    char* d = dst;
+  20044f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  200453:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    do {
+        *d++ = *src++;
+  200457:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  20045b:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  20045f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  200463:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200467:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  20046b:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+  20046f:	0f b6 12             	movzbl (%rdx),%edx
+  200472:	88 10                	mov    %dl,(%rax)
+    } while (d[-1]);
+  200474:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200478:	48 83 e8 01          	sub    $0x1,%rax
+  20047c:	0f b6 00             	movzbl (%rax),%eax
+  20047f:	84 c0                	test   %al,%al
+  200481:	75 d4                	jne    200457 <strcpy+0x18>
+    return dst;
+  200483:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  200487:	c9                   	leave
+  200488:	c3                   	ret
+
+0000000000200489 <strcmp>:
+
+int strcmp(const char* a, const char* b) {
+  200489:	55                   	push   %rbp
+  20048a:	48 89 e5             	mov    %rsp,%rbp
+  20048d:	48 83 ec 10          	sub    $0x10,%rsp
+  200491:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  200495:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    while (*a && *b && *a == *b) {
+  200499:	eb 0a                	jmp    2004a5 <strcmp+0x1c>
+        ++a, ++b;
+  20049b:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  2004a0:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+    while (*a && *b && *a == *b) {
+  2004a5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2004a9:	0f b6 00             	movzbl (%rax),%eax
+  2004ac:	84 c0                	test   %al,%al
+  2004ae:	74 1d                	je     2004cd <strcmp+0x44>
+  2004b0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2004b4:	0f b6 00             	movzbl (%rax),%eax
+  2004b7:	84 c0                	test   %al,%al
+  2004b9:	74 12                	je     2004cd <strcmp+0x44>
+  2004bb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2004bf:	0f b6 10             	movzbl (%rax),%edx
+  2004c2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2004c6:	0f b6 00             	movzbl (%rax),%eax
+  2004c9:	38 c2                	cmp    %al,%dl
+  2004cb:	74 ce                	je     20049b <strcmp+0x12>
+    }
+    return ((unsigned char) *a > (unsigned char) *b)
+  2004cd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2004d1:	0f b6 00             	movzbl (%rax),%eax
+  2004d4:	89 c2                	mov    %eax,%edx
+  2004d6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2004da:	0f b6 00             	movzbl (%rax),%eax
+  2004dd:	38 d0                	cmp    %dl,%al
+  2004df:	0f 92 c0             	setb   %al
+  2004e2:	0f b6 d0             	movzbl %al,%edx
+        - ((unsigned char) *a < (unsigned char) *b);
+  2004e5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2004e9:	0f b6 00             	movzbl (%rax),%eax
+  2004ec:	89 c1                	mov    %eax,%ecx
+  2004ee:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2004f2:	0f b6 00             	movzbl (%rax),%eax
+  2004f5:	38 c1                	cmp    %al,%cl
+  2004f7:	0f 92 c0             	setb   %al
+  2004fa:	0f b6 c0             	movzbl %al,%eax
+  2004fd:	29 c2                	sub    %eax,%edx
+  2004ff:	89 d0                	mov    %edx,%eax
+}
+  200501:	c9                   	leave
+  200502:	c3                   	ret
+
+0000000000200503 <strchr>:
+
+char* strchr(const char* s, int c) {
+  200503:	55                   	push   %rbp
+  200504:	48 89 e5             	mov    %rsp,%rbp
+  200507:	48 83 ec 10          	sub    $0x10,%rsp
+  20050b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  20050f:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    while (*s && *s != (char) c) {
+  200512:	eb 05                	jmp    200519 <strchr+0x16>
+        ++s;
+  200514:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    while (*s && *s != (char) c) {
+  200519:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20051d:	0f b6 00             	movzbl (%rax),%eax
+  200520:	84 c0                	test   %al,%al
+  200522:	74 0e                	je     200532 <strchr+0x2f>
+  200524:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200528:	0f b6 00             	movzbl (%rax),%eax
+  20052b:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  20052e:	38 d0                	cmp    %dl,%al
+  200530:	75 e2                	jne    200514 <strchr+0x11>
+    }
+    if (*s == (char) c) {
+  200532:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200536:	0f b6 00             	movzbl (%rax),%eax
+  200539:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  20053c:	38 d0                	cmp    %dl,%al
+  20053e:	75 06                	jne    200546 <strchr+0x43>
+        return (char*) s;
+  200540:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200544:	eb 05                	jmp    20054b <strchr+0x48>
+    } else {
+        return NULL;
+  200546:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+}
+  20054b:	c9                   	leave
+  20054c:	c3                   	ret
+
+000000000020054d <rand>:
+
+// New randomness implementation
+static int      rand_seed_set;
+static unsigned rand_seed;
+
+int rand(void) {
+  20054d:	55                   	push   %rbp
+  20054e:	48 89 e5             	mov    %rsp,%rbp
+  200551:	48 83 ec 10          	sub    $0x10,%rsp
+    if (!rand_seed_set) {
+  200555:	8b 05 bd 2a 00 00    	mov    0x2abd(%rip),%eax        # 203018 <rand_seed_set>
+  20055b:	85 c0                	test   %eax,%eax
+  20055d:	75 2c                	jne    20058b <rand+0x3e>
+#if WEENSYOS_KERNEL
+        extern unsigned get_entropy_value(void);
+        srand(get_entropy_value());
+#else           // user‑space build
+       /* kernel-refreshed seed from the kernel data page: no system call */
+       srand((unsigned) (vdso()->seed[0] ^ read_cycle_counter()));
+  20055f:	e8 42 fb ff ff       	call   2000a6 <vdso>
+  200564:	48 8b 40 18          	mov    0x18(%rax),%rax
+  200568:	89 c1                	mov    %eax,%ecx
+    }
+}
+
+static inline uint64_t read_cycle_counter(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+  20056a:	0f 31                	rdtsc
+  20056c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  20056f:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    return ((uint64_t) hi << 32) | lo;
+  200572:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  200575:	48 c1 e0 20          	shl    $0x20,%rax
+  200579:	48 89 c2             	mov    %rax,%rdx
+  20057c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  20057f:	48 09 d0             	or     %rdx,%rax
+  200582:	31 c8                	xor    %ecx,%eax
+  200584:	89 c7                	mov    %eax,%edi
+  200586:	e8 24 00 00 00       	call   2005af <srand>
+#endif
+    }
+    rand_seed = rand_seed * 1664525U + 1013904223U;   // LCG
+  20058b:	8b 05 8b 2a 00 00    	mov    0x2a8b(%rip),%eax        # 20301c <rand_seed>
+  200591:	69 c0 0d 66 19 00    	imul   $0x19660d,%eax,%eax
+  200597:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+  20059c:	89 05 7a 2a 00 00    	mov    %eax,0x2a7a(%rip)        # 20301c <rand_seed>
+    return rand_seed & RAND_MAX;
+  2005a2:	8b 05 74 2a 00 00    	mov    0x2a74(%rip),%eax        # 20301c <rand_seed>
+  2005a8:	25 ff ff ff 7f       	and    $0x7fffffff,%eax
+}
+  2005ad:	c9                   	leave
+  2005ae:	c3                   	ret
+
+00000000002005af <srand>:
+
+void srand(unsigned seed) {
+  2005af:	55                   	push   %rbp
+  2005b0:	48 89 e5             	mov    %rsp,%rbp
+  2005b3:	48 83 ec 08          	sub    $0x8,%rsp
+  2005b7:	89 7d fc             	mov    %edi,-0x4(%rbp)
+    rand_seed      = seed;
+  2005ba:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  2005bd:	89 05 59 2a 00 00    	mov    %eax,0x2a59(%rip)        # 20301c <rand_seed>
+    rand_seed_set  = 1;
+  2005c3:	c7 05 4b 2a 00 00 01 	movl   $0x1,0x2a4b(%rip)        # 203018 <rand_seed_set>
+  2005ca:	00 00 00 
+}
+  2005cd:	90                   	nop
+  2005ce:	c9                   	leave
+  2005cf:	c3                   	ret
+
+00000000002005d0 <fill_numbuf>:
+//    Print a message onto the console, starting at the given cursor position.
+
+// snprintf, vsnprintf
+//    Format a string into a buffer.
+
+static char* fill_numbuf(char* numbuf_end, unsigned long val, int base) {
+  2005d0:	55                   	push   %rbp
+  2005d1:	48 89 e5             	mov    %rsp,%rbp
+  2005d4:	48 83 ec 28          	sub    $0x28,%rsp
+  2005d8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  2005dc:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  2005e0:	89 55 dc             	mov    %edx,-0x24(%rbp)
+    static const char upper_digits[] = "0123456789ABCDEF";
+    static const char lower_digits[] = "0123456789abcdef";
+
+    const char* digits = upper_digits;
+  2005e3:	48 8d 05 16 1c 00 00 	lea    0x1c16(%rip),%rax        # 202200 <upper_digits.1>
+  2005ea:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (base < 0) {
+  2005ee:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  2005f2:	79 0e                	jns    200602 <fill_numbuf+0x32>
+        digits = lower_digits;
+  2005f4:	48 8d 05 25 1c 00 00 	lea    0x1c25(%rip),%rax        # 202220 <lower_digits.0>
+  2005fb:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+        base = -base;
+  2005ff:	f7 5d dc             	negl   -0x24(%rbp)
+    }
+
+    *--numbuf_end = '\0';
+  200602:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  200607:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20060b:	c6 00 00             	movb   $0x0,(%rax)
+    do {
+        *--numbuf_end = digits[val % base];
+  20060e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  200611:	48 63 c8             	movslq %eax,%rcx
+  200614:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  200618:	ba 00 00 00 00       	mov    $0x0,%edx
+  20061d:	48 f7 f1             	div    %rcx
+  200620:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200624:	48 01 d0             	add    %rdx,%rax
+  200627:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  20062c:	0f b6 10             	movzbl (%rax),%edx
+  20062f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  200633:	88 10                	mov    %dl,(%rax)
+        val /= base;
+  200635:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  200638:	48 63 f0             	movslq %eax,%rsi
+  20063b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  20063f:	ba 00 00 00 00       	mov    $0x0,%edx
+  200644:	48 f7 f6             	div    %rsi
+  200647:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    } while (val != 0);
+  20064b:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  200650:	75 bc                	jne    20060e <fill_numbuf+0x3e>
+    return numbuf_end;
+  200652:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  200656:	c9                   	leave
+  200657:	c3                   	ret
+
+0000000000200658 <printer_vprintf>:
+#define FLAG_NUMERIC            (1<<5)
+#define FLAG_SIGNED             (1<<6)
+#define FLAG_NEGATIVE           (1<<7)
+#define FLAG_ALT2               (1<<8)
+
+void printer_vprintf(printer* p, int color, const char* format, va_list val) {
+  200658:	55                   	push   %rbp
+  200659:	48 89 e5             	mov    %rsp,%rbp
+  20065c:	53                   	push   %rbx
+  20065d:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  200664:	48 89 bd 78 ff ff ff 	mov    %rdi,-0x88(%rbp)
+  20066b:	89 b5 74 ff ff ff    	mov    %esi,-0x8c(%rbp)
+  200671:	48 89 95 68 ff ff ff 	mov    %rdx,-0x98(%rbp)
+  200678:	48 89 8d 60 ff ff ff 	mov    %rcx,-0xa0(%rbp)
+#define NUMBUFSIZ 24
+    char numbuf[NUMBUFSIZ];
+
+    for (; *format; ++format) {
+  20067f:	e9 be 09 00 00       	jmp    201042 <printer_vprintf+0x9ea>
+        if (*format != '%') {
+  200684:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  20068b:	0f b6 00             	movzbl (%rax),%eax
+  20068e:	3c 25                	cmp    $0x25,%al
+  200690:	74 31                	je     2006c3 <printer_vprintf+0x6b>
+            p->putc(p, *format, color);
+  200692:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200699:	4c 8b 00             	mov    (%rax),%r8
+  20069c:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  2006a3:	0f b6 00             	movzbl (%rax),%eax
+  2006a6:	0f b6 c8             	movzbl %al,%ecx
+  2006a9:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  2006af:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  2006b6:	89 ce                	mov    %ecx,%esi
+  2006b8:	48 89 c7             	mov    %rax,%rdi
+  2006bb:	41 ff d0             	call   *%r8
+            continue;
+  2006be:	e9 77 09 00 00       	jmp    20103a <printer_vprintf+0x9e2>
+        }
+
+        // process flags
+        int flags = 0;
+  2006c3:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+        for (++format; *format; ++format) {
+  2006ca:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  2006d1:	01 
+  2006d2:	eb 4f                	jmp    200723 <printer_vprintf+0xcb>
+            const char* flagc = strchr(flag_chars, *format);
+  2006d4:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  2006db:	0f b6 00             	movzbl (%rax),%eax
+  2006de:	0f be c0             	movsbl %al,%eax
+  2006e1:	89 c6                	mov    %eax,%esi
+  2006e3:	48 8d 05 c6 19 00 00 	lea    0x19c6(%rip),%rax        # 2020b0 <flag_chars>
+  2006ea:	48 89 c7             	mov    %rax,%rdi
+  2006ed:	e8 11 fe ff ff       	call   200503 <strchr>
+  2006f2:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (flagc) {
+  2006f6:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  2006fb:	74 36                	je     200733 <printer_vprintf+0xdb>
+                flags |= 1 << (flagc - flag_chars);
+  2006fd:	48 8d 05 ac 19 00 00 	lea    0x19ac(%rip),%rax        # 2020b0 <flag_chars>
+  200704:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  200708:	48 29 c2             	sub    %rax,%rdx
+  20070b:	89 d0                	mov    %edx,%eax
+  20070d:	ba 01 00 00 00       	mov    $0x1,%edx
+  200712:	89 c1                	mov    %eax,%ecx
+  200714:	d3 e2                	shl    %cl,%edx
+  200716:	89 d0                	mov    %edx,%eax
+  200718:	09 45 ec             	or     %eax,-0x14(%rbp)
+        for (++format; *format; ++format) {
+  20071b:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  200722:	01 
+  200723:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  20072a:	0f b6 00             	movzbl (%rax),%eax
+  20072d:	84 c0                	test   %al,%al
+  20072f:	75 a3                	jne    2006d4 <printer_vprintf+0x7c>
+  200731:	eb 01                	jmp    200734 <printer_vprintf+0xdc>
+            } else {
+                break;
+  200733:	90                   	nop
+            }
+        }
+
+        // process width
+        int width = -1;
+  200734:	c7 45 e8 ff ff ff ff 	movl   $0xffffffff,-0x18(%rbp)
+        if (*format >= '1' && *format <= '9') {
+  20073b:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200742:	0f b6 00             	movzbl (%rax),%eax
+  200745:	3c 30                	cmp    $0x30,%al
+  200747:	7e 67                	jle    2007b0 <printer_vprintf+0x158>
+  200749:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200750:	0f b6 00             	movzbl (%rax),%eax
+  200753:	3c 39                	cmp    $0x39,%al
+  200755:	7f 59                	jg     2007b0 <printer_vprintf+0x158>
+            for (width = 0; *format >= '0' && *format <= '9'; ) {
+  200757:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%rbp)
+  20075e:	eb 2e                	jmp    20078e <printer_vprintf+0x136>
+                width = 10 * width + *format++ - '0';
+  200760:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  200763:	89 d0                	mov    %edx,%eax
+  200765:	c1 e0 02             	shl    $0x2,%eax
+  200768:	01 d0                	add    %edx,%eax
+  20076a:	01 c0                	add    %eax,%eax
+  20076c:	89 c1                	mov    %eax,%ecx
+  20076e:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200775:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  200779:	48 89 95 68 ff ff ff 	mov    %rdx,-0x98(%rbp)
+  200780:	0f b6 00             	movzbl (%rax),%eax
+  200783:	0f be c0             	movsbl %al,%eax
+  200786:	01 c8                	add    %ecx,%eax
+  200788:	83 e8 30             	sub    $0x30,%eax
+  20078b:	89 45 e8             	mov    %eax,-0x18(%rbp)
+            for (width = 0; *format >= '0' && *format <= '9'; ) {
+  20078e:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200795:	0f b6 00             	movzbl (%rax),%eax
+  200798:	3c 2f                	cmp    $0x2f,%al
+  20079a:	0f 8e 85 00 00 00    	jle    200825 <printer_vprintf+0x1cd>
+  2007a0:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  2007a7:	0f b6 00             	movzbl (%rax),%eax
+  2007aa:	3c 39                	cmp    $0x39,%al
+  2007ac:	7e b2                	jle    200760 <printer_vprintf+0x108>
+        if (*format >= '1' && *format <= '9') {
+  2007ae:	eb 75                	jmp    200825 <printer_vprintf+0x1cd>
+            }
+        } else if (*format == '*') {
+  2007b0:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  2007b7:	0f b6 00             	movzbl (%rax),%eax
+  2007ba:	3c 2a                	cmp    $0x2a,%al
+  2007bc:	75 68                	jne    200826 <printer_vprintf+0x1ce>
+            width = va_arg(val, int);
+  2007be:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2007c5:	8b 00                	mov    (%rax),%eax
+  2007c7:	83 f8 2f             	cmp    $0x2f,%eax
+  2007ca:	77 30                	ja     2007fc <printer_vprintf+0x1a4>
+  2007cc:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2007d3:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  2007d7:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2007de:	8b 00                	mov    (%rax),%eax
+  2007e0:	89 c0                	mov    %eax,%eax
+  2007e2:	48 01 d0             	add    %rdx,%rax
+  2007e5:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  2007ec:	8b 12                	mov    (%rdx),%edx
+  2007ee:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  2007f1:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  2007f8:	89 0a                	mov    %ecx,(%rdx)
+  2007fa:	eb 1a                	jmp    200816 <printer_vprintf+0x1be>
+  2007fc:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200803:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200807:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  20080b:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200812:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200816:	8b 00                	mov    (%rax),%eax
+  200818:	89 45 e8             	mov    %eax,-0x18(%rbp)
+            ++format;
+  20081b:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  200822:	01 
+  200823:	eb 01                	jmp    200826 <printer_vprintf+0x1ce>
+        if (*format >= '1' && *format <= '9') {
+  200825:	90                   	nop
+        }
+
+        // process precision
+        int precision = -1;
+  200826:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%rbp)
+        if (*format == '.') {
+  20082d:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200834:	0f b6 00             	movzbl (%rax),%eax
+  200837:	3c 2e                	cmp    $0x2e,%al
+  200839:	0f 85 00 01 00 00    	jne    20093f <printer_vprintf+0x2e7>
+            ++format;
+  20083f:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  200846:	01 
+            if (*format >= '0' && *format <= '9') {
+  200847:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  20084e:	0f b6 00             	movzbl (%rax),%eax
+  200851:	3c 2f                	cmp    $0x2f,%al
+  200853:	7e 67                	jle    2008bc <printer_vprintf+0x264>
+  200855:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  20085c:	0f b6 00             	movzbl (%rax),%eax
+  20085f:	3c 39                	cmp    $0x39,%al
+  200861:	7f 59                	jg     2008bc <printer_vprintf+0x264>
+                for (precision = 0; *format >= '0' && *format <= '9'; ) {
+  200863:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%rbp)
+  20086a:	eb 2e                	jmp    20089a <printer_vprintf+0x242>
+                    precision = 10 * precision + *format++ - '0';
+  20086c:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  20086f:	89 d0                	mov    %edx,%eax
+  200871:	c1 e0 02             	shl    $0x2,%eax
+  200874:	01 d0                	add    %edx,%eax
+  200876:	01 c0                	add    %eax,%eax
+  200878:	89 c1                	mov    %eax,%ecx
+  20087a:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200881:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  200885:	48 89 95 68 ff ff ff 	mov    %rdx,-0x98(%rbp)
+  20088c:	0f b6 00             	movzbl (%rax),%eax
+  20088f:	0f be c0             	movsbl %al,%eax
+  200892:	01 c8                	add    %ecx,%eax
+  200894:	83 e8 30             	sub    $0x30,%eax
+  200897:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+                for (precision = 0; *format >= '0' && *format <= '9'; ) {
+  20089a:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  2008a1:	0f b6 00             	movzbl (%rax),%eax
+  2008a4:	3c 2f                	cmp    $0x2f,%al
+  2008a6:	0f 8e 85 00 00 00    	jle    200931 <printer_vprintf+0x2d9>
+  2008ac:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  2008b3:	0f b6 00             	movzbl (%rax),%eax
+  2008b6:	3c 39                	cmp    $0x39,%al
+  2008b8:	7e b2                	jle    20086c <printer_vprintf+0x214>
+            if (*format >= '0' && *format <= '9') {
+  2008ba:	eb 75                	jmp    200931 <printer_vprintf+0x2d9>
+                }
+            } else if (*format == '*') {
+  2008bc:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  2008c3:	0f b6 00             	movzbl (%rax),%eax
+  2008c6:	3c 2a                	cmp    $0x2a,%al
+  2008c8:	75 68                	jne    200932 <printer_vprintf+0x2da>
+                precision = va_arg(val, int);
+  2008ca:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2008d1:	8b 00                	mov    (%rax),%eax
+  2008d3:	83 f8 2f             	cmp    $0x2f,%eax
+  2008d6:	77 30                	ja     200908 <printer_vprintf+0x2b0>
+  2008d8:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2008df:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  2008e3:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2008ea:	8b 00                	mov    (%rax),%eax
+  2008ec:	89 c0                	mov    %eax,%eax
+  2008ee:	48 01 d0             	add    %rdx,%rax
+  2008f1:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  2008f8:	8b 12                	mov    (%rdx),%edx
+  2008fa:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  2008fd:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200904:	89 0a                	mov    %ecx,(%rdx)
+  200906:	eb 1a                	jmp    200922 <printer_vprintf+0x2ca>
+  200908:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  20090f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200913:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200917:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  20091e:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200922:	8b 00                	mov    (%rax),%eax
+  200924:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+                ++format;
+  200927:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  20092e:	01 
+  20092f:	eb 01                	jmp    200932 <printer_vprintf+0x2da>
+            if (*format >= '0' && *format <= '9') {
+  200931:	90                   	nop
+            }
+            if (precision < 0) {
+  200932:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  200936:	79 07                	jns    20093f <printer_vprintf+0x2e7>
+                precision = 0;
+  200938:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%rbp)
+            }
+        }
+
+        // process main conversion character
+        int base = 10;
+  20093f:	c7 45 e0 0a 00 00 00 	movl   $0xa,-0x20(%rbp)
+        unsigned long num = 0;
+  200946:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  20094d:	00 
+        int length = 0;
+  20094e:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+        char* data = "";
+  200955:	48 8d 05 5a 17 00 00 	lea    0x175a(%rip),%rax        # 2020b6 <flag_chars+0x6>
+  20095c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    again:
+        switch (*format) {
+  200960:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200967:	0f b6 00             	movzbl (%rax),%eax
+  20096a:	0f be c0             	movsbl %al,%eax
+  20096d:	83 e8 43             	sub    $0x43,%eax
+  200970:	83 f8 37             	cmp    $0x37,%eax
+  200973:	0f 87 b5 03 00 00    	ja     200d2e <printer_vprintf+0x6d6>
+  200979:	89 c0                	mov    %eax,%eax
+  20097b:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  200982:	00 
+  200983:	48 8d 05 3a 17 00 00 	lea    0x173a(%rip),%rax        # 2020c4 <flag_chars+0x14>
+  20098a:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+  20098d:	48 98                	cltq
+  20098f:	48 8d 15 2e 17 00 00 	lea    0x172e(%rip),%rdx        # 2020c4 <flag_chars+0x14>
+  200996:	48 01 d0             	add    %rdx,%rax
+  200999:	ff e0                	jmp    *%rax
+        case 'l':
+        case 'z':
+            length = 1;
+  20099b:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+            ++format;
+  2009a2:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  2009a9:	01 
+            goto again;
+  2009aa:	eb b4                	jmp    200960 <printer_vprintf+0x308>
+        case 'd':
+        case 'i': {
+            long x = length ? va_arg(val, long) : va_arg(val, int);
+  2009ac:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  2009b0:	74 5d                	je     200a0f <printer_vprintf+0x3b7>
+  2009b2:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2009b9:	8b 00                	mov    (%rax),%eax
+  2009bb:	83 f8 2f             	cmp    $0x2f,%eax
+  2009be:	77 30                	ja     2009f0 <printer_vprintf+0x398>
+  2009c0:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2009c7:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  2009cb:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2009d2:	8b 00                	mov    (%rax),%eax
+  2009d4:	89 c0                	mov    %eax,%eax
+  2009d6:	48 01 d0             	add    %rdx,%rax
+  2009d9:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  2009e0:	8b 12                	mov    (%rdx),%edx
+  2009e2:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  2009e5:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  2009ec:	89 0a                	mov    %ecx,(%rdx)
+  2009ee:	eb 1a                	jmp    200a0a <printer_vprintf+0x3b2>
+  2009f0:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2009f7:	48 8b 40 08          	mov    0x8(%rax),%rax
+  2009fb:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  2009ff:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200a06:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200a0a:	48 8b 00             	mov    (%rax),%rax
+  200a0d:	eb 5c                	jmp    200a6b <printer_vprintf+0x413>
+  200a0f:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200a16:	8b 00                	mov    (%rax),%eax
+  200a18:	83 f8 2f             	cmp    $0x2f,%eax
+  200a1b:	77 30                	ja     200a4d <printer_vprintf+0x3f5>
+  200a1d:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200a24:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200a28:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200a2f:	8b 00                	mov    (%rax),%eax
+  200a31:	89 c0                	mov    %eax,%eax
+  200a33:	48 01 d0             	add    %rdx,%rax
+  200a36:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200a3d:	8b 12                	mov    (%rdx),%edx
+  200a3f:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200a42:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200a49:	89 0a                	mov    %ecx,(%rdx)
+  200a4b:	eb 1a                	jmp    200a67 <printer_vprintf+0x40f>
+  200a4d:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200a54:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200a58:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200a5c:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200a63:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200a67:	8b 00                	mov    (%rax),%eax
+  200a69:	48 98                	cltq
+  200a6b:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+            int negative = x < 0 ? FLAG_NEGATIVE : 0;
+  200a6f:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  200a73:	48 c1 f8 38          	sar    $0x38,%rax
+  200a77:	25 80 00 00 00       	and    $0x80,%eax
+  200a7c:	89 45 a4             	mov    %eax,-0x5c(%rbp)
+            num = negative ? -x : x;
+  200a7f:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  200a83:	74 09                	je     200a8e <printer_vprintf+0x436>
+  200a85:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  200a89:	48 f7 d8             	neg    %rax
+  200a8c:	eb 04                	jmp    200a92 <printer_vprintf+0x43a>
+  200a8e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  200a92:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+            flags |= FLAG_NUMERIC | FLAG_SIGNED | negative;
+  200a96:	8b 45 a4             	mov    -0x5c(%rbp),%eax
+  200a99:	83 c8 60             	or     $0x60,%eax
+  200a9c:	09 45 ec             	or     %eax,-0x14(%rbp)
+            break;
+  200a9f:	e9 cf 02 00 00       	jmp    200d73 <printer_vprintf+0x71b>
+        }
+        case 'u':
+        format_unsigned:
+            num = length ? va_arg(val, unsigned long) : va_arg(val, unsigned);
+  200aa4:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  200aa8:	74 5d                	je     200b07 <printer_vprintf+0x4af>
+  200aaa:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200ab1:	8b 00                	mov    (%rax),%eax
+  200ab3:	83 f8 2f             	cmp    $0x2f,%eax
+  200ab6:	77 30                	ja     200ae8 <printer_vprintf+0x490>
+  200ab8:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200abf:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200ac3:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200aca:	8b 00                	mov    (%rax),%eax
+  200acc:	89 c0                	mov    %eax,%eax
+  200ace:	48 01 d0             	add    %rdx,%rax
+  200ad1:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200ad8:	8b 12                	mov    (%rdx),%edx
+  200ada:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200add:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200ae4:	89 0a                	mov    %ecx,(%rdx)
+  200ae6:	eb 1a                	jmp    200b02 <printer_vprintf+0x4aa>
+  200ae8:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200aef:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200af3:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200af7:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200afe:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200b02:	48 8b 00             	mov    (%rax),%rax
+  200b05:	eb 5c                	jmp    200b63 <printer_vprintf+0x50b>
+  200b07:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200b0e:	8b 00                	mov    (%rax),%eax
+  200b10:	83 f8 2f             	cmp    $0x2f,%eax
+  200b13:	77 30                	ja     200b45 <printer_vprintf+0x4ed>
+  200b15:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200b1c:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200b20:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200b27:	8b 00                	mov    (%rax),%eax
+  200b29:	89 c0                	mov    %eax,%eax
+  200b2b:	48 01 d0             	add    %rdx,%rax
+  200b2e:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200b35:	8b 12                	mov    (%rdx),%edx
+  200b37:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200b3a:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200b41:	89 0a                	mov    %ecx,(%rdx)
+  200b43:	eb 1a                	jmp    200b5f <printer_vprintf+0x507>
+  200b45:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200b4c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200b50:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200b54:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200b5b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200b5f:	8b 00                	mov    (%rax),%eax
+  200b61:	89 c0                	mov    %eax,%eax
+  200b63:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+            flags |= FLAG_NUMERIC;
+  200b67:	83 4d ec 20          	orl    $0x20,-0x14(%rbp)
+            break;
+  200b6b:	e9 03 02 00 00       	jmp    200d73 <printer_vprintf+0x71b>
+        case 'x':
+            base = -16;
+  200b70:	c7 45 e0 f0 ff ff ff 	movl   $0xfffffff0,-0x20(%rbp)
+            goto format_unsigned;
+  200b77:	e9 28 ff ff ff       	jmp    200aa4 <printer_vprintf+0x44c>
+        case 'X':
+            base = 16;
+  200b7c:	c7 45 e0 10 00 00 00 	movl   $0x10,-0x20(%rbp)
+            goto format_unsigned;
+  200b83:	e9 1c ff ff ff       	jmp    200aa4 <printer_vprintf+0x44c>
+        case 'p':
+            num = (uintptr_t) va_arg(val, void*);
+  200b88:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200b8f:	8b 00                	mov    (%rax),%eax
+  200b91:	83 f8 2f             	cmp    $0x2f,%eax
+  200b94:	77 30                	ja     200bc6 <printer_vprintf+0x56e>
+  200b96:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200b9d:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200ba1:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200ba8:	8b 00                	mov    (%rax),%eax
+  200baa:	89 c0                	mov    %eax,%eax
+  200bac:	48 01 d0             	add    %rdx,%rax
+  200baf:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200bb6:	8b 12                	mov    (%rdx),%edx
+  200bb8:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200bbb:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200bc2:	89 0a                	mov    %ecx,(%rdx)
+  200bc4:	eb 1a                	jmp    200be0 <printer_vprintf+0x588>
+  200bc6:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200bcd:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200bd1:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200bd5:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200bdc:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200be0:	48 8b 00             	mov    (%rax),%rax
+  200be3:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+            base = -16;
+  200be7:	c7 45 e0 f0 ff ff ff 	movl   $0xfffffff0,-0x20(%rbp)
+            flags |= FLAG_ALT | FLAG_ALT2 | FLAG_NUMERIC;
+  200bee:	81 4d ec 21 01 00 00 	orl    $0x121,-0x14(%rbp)
+            break;
+  200bf5:	e9 79 01 00 00       	jmp    200d73 <printer_vprintf+0x71b>
+        case 's':
+            data = va_arg(val, char*);
+  200bfa:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c01:	8b 00                	mov    (%rax),%eax
+  200c03:	83 f8 2f             	cmp    $0x2f,%eax
+  200c06:	77 30                	ja     200c38 <printer_vprintf+0x5e0>
+  200c08:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c0f:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200c13:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c1a:	8b 00                	mov    (%rax),%eax
+  200c1c:	89 c0                	mov    %eax,%eax
+  200c1e:	48 01 d0             	add    %rdx,%rax
+  200c21:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200c28:	8b 12                	mov    (%rdx),%edx
+  200c2a:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200c2d:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200c34:	89 0a                	mov    %ecx,(%rdx)
+  200c36:	eb 1a                	jmp    200c52 <printer_vprintf+0x5fa>
+  200c38:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c3f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200c43:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200c47:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200c4e:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200c52:	48 8b 00             	mov    (%rax),%rax
+  200c55:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+            break;
+  200c59:	e9 15 01 00 00       	jmp    200d73 <printer_vprintf+0x71b>
+        case 'C':
+            color = va_arg(val, int);
+  200c5e:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c65:	8b 00                	mov    (%rax),%eax
+  200c67:	83 f8 2f             	cmp    $0x2f,%eax
+  200c6a:	77 30                	ja     200c9c <printer_vprintf+0x644>
+  200c6c:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c73:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200c77:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c7e:	8b 00                	mov    (%rax),%eax
+  200c80:	89 c0                	mov    %eax,%eax
+  200c82:	48 01 d0             	add    %rdx,%rax
+  200c85:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200c8c:	8b 12                	mov    (%rdx),%edx
+  200c8e:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200c91:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200c98:	89 0a                	mov    %ecx,(%rdx)
+  200c9a:	eb 1a                	jmp    200cb6 <printer_vprintf+0x65e>
+  200c9c:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200ca3:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200ca7:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200cab:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200cb2:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200cb6:	8b 00                	mov    (%rax),%eax
+  200cb8:	89 85 74 ff ff ff    	mov    %eax,-0x8c(%rbp)
+            goto done;
+  200cbe:	e9 77 03 00 00       	jmp    20103a <printer_vprintf+0x9e2>
+        case 'c':
+            data = numbuf;
+  200cc3:	48 8d 45 8c          	lea    -0x74(%rbp),%rax
+  200cc7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+            numbuf[0] = va_arg(val, int);
+  200ccb:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200cd2:	8b 00                	mov    (%rax),%eax
+  200cd4:	83 f8 2f             	cmp    $0x2f,%eax
+  200cd7:	77 30                	ja     200d09 <printer_vprintf+0x6b1>
+  200cd9:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200ce0:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200ce4:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200ceb:	8b 00                	mov    (%rax),%eax
+  200ced:	89 c0                	mov    %eax,%eax
+  200cef:	48 01 d0             	add    %rdx,%rax
+  200cf2:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200cf9:	8b 12                	mov    (%rdx),%edx
+  200cfb:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200cfe:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200d05:	89 0a                	mov    %ecx,(%rdx)
+  200d07:	eb 1a                	jmp    200d23 <printer_vprintf+0x6cb>
+  200d09:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200d10:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200d14:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200d18:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200d1f:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200d23:	8b 00                	mov    (%rax),%eax
+  200d25:	88 45 8c             	mov    %al,-0x74(%rbp)
+            numbuf[1] = '\0';
+  200d28:	c6 45 8d 00          	movb   $0x0,-0x73(%rbp)
+            break;
+  200d2c:	eb 45                	jmp    200d73 <printer_vprintf+0x71b>
+        default:
+            data = numbuf;
+  200d2e:	48 8d 45 8c          	lea    -0x74(%rbp),%rax
+  200d32:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+            numbuf[0] = (*format ? *format : '%');
+  200d36:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200d3d:	0f b6 00             	movzbl (%rax),%eax
+  200d40:	84 c0                	test   %al,%al
+  200d42:	74 0c                	je     200d50 <printer_vprintf+0x6f8>
+  200d44:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200d4b:	0f b6 00             	movzbl (%rax),%eax
+  200d4e:	eb 05                	jmp    200d55 <printer_vprintf+0x6fd>
+  200d50:	b8 25 00 00 00       	mov    $0x25,%eax
+  200d55:	88 45 8c             	mov    %al,-0x74(%rbp)
+            numbuf[1] = '\0';
+  200d58:	c6 45 8d 00          	movb   $0x0,-0x73(%rbp)
+            if (!*format) {
+  200d5c:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200d63:	0f b6 00             	movzbl (%rax),%eax
+  200d66:	84 c0                	test   %al,%al
+  200d68:	75 08                	jne    200d72 <printer_vprintf+0x71a>
+                format--;
+  200d6a:	48 83 ad 68 ff ff ff 	subq   $0x1,-0x98(%rbp)
+  200d71:	01 
+            }
+            break;
+  200d72:	90                   	nop
+        }
+
+        if (flags & FLAG_NUMERIC) {
+  200d73:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200d76:	83 e0 20             	and    $0x20,%eax
+  200d79:	85 c0                	test   %eax,%eax
+  200d7b:	74 1e                	je     200d9b <printer_vprintf+0x743>
+            data = fill_numbuf(numbuf + NUMBUFSIZ, num, base);
+  200d7d:	48 8d 45 8c          	lea    -0x74(%rbp),%rax
+  200d81:	48 83 c0 18          	add    $0x18,%rax
+  200d85:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  200d88:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  200d8c:	48 89 ce             	mov    %rcx,%rsi
+  200d8f:	48 89 c7             	mov    %rax,%rdi
+  200d92:	e8 39 f8 ff ff       	call   2005d0 <fill_numbuf>
+  200d97:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        }
+
+        const char* prefix = "";
+  200d9b:	48 8d 05 14 13 00 00 	lea    0x1314(%rip),%rax        # 2020b6 <flag_chars+0x6>
+  200da2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((flags & FLAG_NUMERIC) && (flags & FLAG_SIGNED)) {
+  200da6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200da9:	83 e0 20             	and    $0x20,%eax
+  200dac:	85 c0                	test   %eax,%eax
+  200dae:	74 51                	je     200e01 <printer_vprintf+0x7a9>
+  200db0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200db3:	83 e0 40             	and    $0x40,%eax
+  200db6:	85 c0                	test   %eax,%eax
+  200db8:	74 47                	je     200e01 <printer_vprintf+0x7a9>
+            if (flags & FLAG_NEGATIVE) {
+  200dba:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200dbd:	25 80 00 00 00       	and    $0x80,%eax
+  200dc2:	85 c0                	test   %eax,%eax
+  200dc4:	74 0d                	je     200dd3 <printer_vprintf+0x77b>
+                prefix = "-";
+  200dc6:	48 8d 05 ea 12 00 00 	lea    0x12ea(%rip),%rax        # 2020b7 <flag_chars+0x7>
+  200dcd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            if (flags & FLAG_NEGATIVE) {
+  200dd1:	eb 7d                	jmp    200e50 <printer_vprintf+0x7f8>
+            } else if (flags & FLAG_PLUSPOSITIVE) {
+  200dd3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200dd6:	83 e0 10             	and    $0x10,%eax
+  200dd9:	85 c0                	test   %eax,%eax
+  200ddb:	74 0d                	je     200dea <printer_vprintf+0x792>
+                prefix = "+";
+  200ddd:	48 8d 05 d5 12 00 00 	lea    0x12d5(%rip),%rax        # 2020b9 <flag_chars+0x9>
+  200de4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            if (flags & FLAG_NEGATIVE) {
+  200de8:	eb 66                	jmp    200e50 <printer_vprintf+0x7f8>
+            } else if (flags & FLAG_SPACEPOSITIVE) {
+  200dea:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200ded:	83 e0 08             	and    $0x8,%eax
+  200df0:	85 c0                	test   %eax,%eax
+  200df2:	74 5c                	je     200e50 <printer_vprintf+0x7f8>
+                prefix = " ";
+  200df4:	48 8d 05 c0 12 00 00 	lea    0x12c0(%rip),%rax        # 2020bb <flag_chars+0xb>
+  200dfb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            if (flags & FLAG_NEGATIVE) {
+  200dff:	eb 4f                	jmp    200e50 <printer_vprintf+0x7f8>
+            }
+        } else if ((flags & FLAG_NUMERIC) && (flags & FLAG_ALT)
+  200e01:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200e04:	83 e0 20             	and    $0x20,%eax
+  200e07:	85 c0                	test   %eax,%eax
+  200e09:	74 46                	je     200e51 <printer_vprintf+0x7f9>
+  200e0b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200e0e:	83 e0 01             	and    $0x1,%eax
+  200e11:	85 c0                	test   %eax,%eax
+  200e13:	74 3c                	je     200e51 <printer_vprintf+0x7f9>
+                   && (base == 16 || base == -16)
+  200e15:	83 7d e0 10          	cmpl   $0x10,-0x20(%rbp)
+  200e19:	74 06                	je     200e21 <printer_vprintf+0x7c9>
+  200e1b:	83 7d e0 f0          	cmpl   $0xfffffff0,-0x20(%rbp)
+  200e1f:	75 30                	jne    200e51 <printer_vprintf+0x7f9>
+                   && (num || (flags & FLAG_ALT2))) {
+  200e21:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  200e26:	75 0c                	jne    200e34 <printer_vprintf+0x7dc>
+  200e28:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200e2b:	25 00 01 00 00       	and    $0x100,%eax
+  200e30:	85 c0                	test   %eax,%eax
+  200e32:	74 1d                	je     200e51 <printer_vprintf+0x7f9>
+            prefix = (base == -16 ? "0x" : "0X");
+  200e34:	83 7d e0 f0          	cmpl   $0xfffffff0,-0x20(%rbp)
+  200e38:	75 09                	jne    200e43 <printer_vprintf+0x7eb>
+  200e3a:	48 8d 05 7c 12 00 00 	lea    0x127c(%rip),%rax        # 2020bd <flag_chars+0xd>
+  200e41:	eb 07                	jmp    200e4a <printer_vprintf+0x7f2>
+  200e43:	48 8d 05 76 12 00 00 	lea    0x1276(%rip),%rax        # 2020c0 <flag_chars+0x10>
+  200e4a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  200e4e:	eb 01                	jmp    200e51 <printer_vprintf+0x7f9>
+            if (flags & FLAG_NEGATIVE) {
+  200e50:	90                   	nop
+        }
+
+        int len;
+        if (precision >= 0 && !(flags & FLAG_NUMERIC)) {
+  200e51:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  200e55:	78 24                	js     200e7b <printer_vprintf+0x823>
+  200e57:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200e5a:	83 e0 20             	and    $0x20,%eax
+  200e5d:	85 c0                	test   %eax,%eax
+  200e5f:	75 1a                	jne    200e7b <printer_vprintf+0x823>
+            len = strnlen(data, precision);
+  200e61:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  200e64:	48 63 d0             	movslq %eax,%rdx
+  200e67:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200e6b:	48 89 d6             	mov    %rdx,%rsi
+  200e6e:	48 89 c7             	mov    %rax,%rdi
+  200e71:	e8 8a f5 ff ff       	call   200400 <strnlen>
+  200e76:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  200e79:	eb 0f                	jmp    200e8a <printer_vprintf+0x832>
+        } else {
+            len = strlen(data);
+  200e7b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200e7f:	48 89 c7             	mov    %rax,%rdi
+  200e82:	e8 48 f5 ff ff       	call   2003cf <strlen>
+  200e87:	89 45 bc             	mov    %eax,-0x44(%rbp)
+        }
+        int zeros;
+        if ((flags & FLAG_NUMERIC) && precision >= 0) {
+  200e8a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200e8d:	83 e0 20             	and    $0x20,%eax
+  200e90:	85 c0                	test   %eax,%eax
+  200e92:	74 20                	je     200eb4 <printer_vprintf+0x85c>
+  200e94:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  200e98:	78 1a                	js     200eb4 <printer_vprintf+0x85c>
+            zeros = precision > len ? precision - len : 0;
+  200e9a:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  200e9d:	3b 45 bc             	cmp    -0x44(%rbp),%eax
+  200ea0:	7e 08                	jle    200eaa <printer_vprintf+0x852>
+  200ea2:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  200ea5:	2b 45 bc             	sub    -0x44(%rbp),%eax
+  200ea8:	eb 05                	jmp    200eaf <printer_vprintf+0x857>
+  200eaa:	b8 00 00 00 00       	mov    $0x0,%eax
+  200eaf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  200eb2:	eb 5c                	jmp    200f10 <printer_vprintf+0x8b8>
+        } else if ((flags & FLAG_NUMERIC) && (flags & FLAG_ZERO)
+  200eb4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200eb7:	83 e0 20             	and    $0x20,%eax
+  200eba:	85 c0                	test   %eax,%eax
+  200ebc:	74 4b                	je     200f09 <printer_vprintf+0x8b1>
+  200ebe:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200ec1:	83 e0 02             	and    $0x2,%eax
+  200ec4:	85 c0                	test   %eax,%eax
+  200ec6:	74 41                	je     200f09 <printer_vprintf+0x8b1>
+                   && !(flags & FLAG_LEFTJUSTIFY)
+  200ec8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200ecb:	83 e0 04             	and    $0x4,%eax
+  200ece:	85 c0                	test   %eax,%eax
+  200ed0:	75 37                	jne    200f09 <printer_vprintf+0x8b1>
+                   && len + (int) strlen(prefix) < width) {
+  200ed2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  200ed6:	48 89 c7             	mov    %rax,%rdi
+  200ed9:	e8 f1 f4 ff ff       	call   2003cf <strlen>
+  200ede:	89 c2                	mov    %eax,%edx
+  200ee0:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  200ee3:	01 d0                	add    %edx,%eax
+  200ee5:	39 45 e8             	cmp    %eax,-0x18(%rbp)
+  200ee8:	7e 1f                	jle    200f09 <printer_vprintf+0x8b1>
+            zeros = width - len - strlen(prefix);
+  200eea:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  200eed:	2b 45 bc             	sub    -0x44(%rbp),%eax
+  200ef0:	89 c3                	mov    %eax,%ebx
+  200ef2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  200ef6:	48 89 c7             	mov    %rax,%rdi
+  200ef9:	e8 d1 f4 ff ff       	call   2003cf <strlen>
+  200efe:	89 c2                	mov    %eax,%edx
+  200f00:	89 d8                	mov    %ebx,%eax
+  200f02:	29 d0                	sub    %edx,%eax
+  200f04:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  200f07:	eb 07                	jmp    200f10 <printer_vprintf+0x8b8>
+        } else {
+            zeros = 0;
+  200f09:	c7 45 b8 00 00 00 00 	movl   $0x0,-0x48(%rbp)
+        }
+        width -= len + zeros + strlen(prefix);
+  200f10:	8b 55 bc             	mov    -0x44(%rbp),%edx
+  200f13:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  200f16:	01 d0                	add    %edx,%eax
+  200f18:	48 63 d8             	movslq %eax,%rbx
+  200f1b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  200f1f:	48 89 c7             	mov    %rax,%rdi
+  200f22:	e8 a8 f4 ff ff       	call   2003cf <strlen>
+  200f27:	48 8d 14 03          	lea    (%rbx,%rax,1),%rdx
+  200f2b:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  200f2e:	29 d0                	sub    %edx,%eax
+  200f30:	89 45 e8             	mov    %eax,-0x18(%rbp)
+        for (; !(flags & FLAG_LEFTJUSTIFY) && width > 0; --width) {
+  200f33:	eb 25                	jmp    200f5a <printer_vprintf+0x902>
+            p->putc(p, ' ', color);
+  200f35:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200f3c:	48 8b 08             	mov    (%rax),%rcx
+  200f3f:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  200f45:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200f4c:	be 20 00 00 00       	mov    $0x20,%esi
+  200f51:	48 89 c7             	mov    %rax,%rdi
+  200f54:	ff d1                	call   *%rcx
+        for (; !(flags & FLAG_LEFTJUSTIFY) && width > 0; --width) {
+  200f56:	83 6d e8 01          	subl   $0x1,-0x18(%rbp)
+  200f5a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200f5d:	83 e0 04             	and    $0x4,%eax
+  200f60:	85 c0                	test   %eax,%eax
+  200f62:	75 36                	jne    200f9a <printer_vprintf+0x942>
+  200f64:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  200f68:	7f cb                	jg     200f35 <printer_vprintf+0x8dd>
+        }
+        for (; *prefix; ++prefix) {
+  200f6a:	eb 2e                	jmp    200f9a <printer_vprintf+0x942>
+            p->putc(p, *prefix, color);
+  200f6c:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200f73:	4c 8b 00             	mov    (%rax),%r8
+  200f76:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  200f7a:	0f b6 00             	movzbl (%rax),%eax
+  200f7d:	0f b6 c8             	movzbl %al,%ecx
+  200f80:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  200f86:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200f8d:	89 ce                	mov    %ecx,%esi
+  200f8f:	48 89 c7             	mov    %rax,%rdi
+  200f92:	41 ff d0             	call   *%r8
+        for (; *prefix; ++prefix) {
+  200f95:	48 83 45 c0 01       	addq   $0x1,-0x40(%rbp)
+  200f9a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  200f9e:	0f b6 00             	movzbl (%rax),%eax
+  200fa1:	84 c0                	test   %al,%al
+  200fa3:	75 c7                	jne    200f6c <printer_vprintf+0x914>
+        }
+        for (; zeros > 0; --zeros) {
+  200fa5:	eb 25                	jmp    200fcc <printer_vprintf+0x974>
+            p->putc(p, '0', color);
+  200fa7:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200fae:	48 8b 08             	mov    (%rax),%rcx
+  200fb1:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  200fb7:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200fbe:	be 30 00 00 00       	mov    $0x30,%esi
+  200fc3:	48 89 c7             	mov    %rax,%rdi
+  200fc6:	ff d1                	call   *%rcx
+        for (; zeros > 0; --zeros) {
+  200fc8:	83 6d b8 01          	subl   $0x1,-0x48(%rbp)
+  200fcc:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  200fd0:	7f d5                	jg     200fa7 <printer_vprintf+0x94f>
+        }
+        for (; len > 0; ++data, --len) {
+  200fd2:	eb 32                	jmp    201006 <printer_vprintf+0x9ae>
+            p->putc(p, *data, color);
+  200fd4:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200fdb:	4c 8b 00             	mov    (%rax),%r8
+  200fde:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200fe2:	0f b6 00             	movzbl (%rax),%eax
+  200fe5:	0f b6 c8             	movzbl %al,%ecx
+  200fe8:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  200fee:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200ff5:	89 ce                	mov    %ecx,%esi
+  200ff7:	48 89 c7             	mov    %rax,%rdi
+  200ffa:	41 ff d0             	call   *%r8
+        for (; len > 0; ++data, --len) {
+  200ffd:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  201002:	83 6d bc 01          	subl   $0x1,-0x44(%rbp)
+  201006:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+  20100a:	7f c8                	jg     200fd4 <printer_vprintf+0x97c>
+        }
+        for (; width > 0; --width) {
+  20100c:	eb 25                	jmp    201033 <printer_vprintf+0x9db>
+            p->putc(p, ' ', color);
+  20100e:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  201015:	48 8b 08             	mov    (%rax),%rcx
+  201018:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  20101e:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  201025:	be 20 00 00 00       	mov    $0x20,%esi
+  20102a:	48 89 c7             	mov    %rax,%rdi
+  20102d:	ff d1                	call   *%rcx
+        for (; width > 0; --width) {
+  20102f:	83 6d e8 01          	subl   $0x1,-0x18(%rbp)
+  201033:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  201037:	7f d5                	jg     20100e <printer_vprintf+0x9b6>
+        }
+    done: ;
+  201039:	90                   	nop
+    for (; *format; ++format) {
+  20103a:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  201041:	01 
+  201042:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  201049:	0f b6 00             	movzbl (%rax),%eax
+  20104c:	84 c0                	test   %al,%al
+  20104e:	0f 85 30 f6 ff ff    	jne    200684 <printer_vprintf+0x2c>
+    }
+}
+  201054:	90                   	nop
+  201055:	90                   	nop
+  201056:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  20105a:	c9                   	leave
+  20105b:	c3                   	ret
+
+000000000020105c <console_putc>:
+typedef struct console_printer {
+    printer p;
+    uint16_t* cursor;
+} console_printer;
+
+static void console_putc(printer* p, unsigned char c, int color) {
+  20105c:	55                   	push   %rbp
+  20105d:	48 89 e5             	mov    %rsp,%rbp
+  201060:	48 83 ec 30          	sub    $0x30,%rsp
+  201064:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  201068:	89 f0                	mov    %esi,%eax
+  20106a:	89 55 d0             	mov    %edx,-0x30(%rbp)
+  20106d:	88 45 d4             	mov    %al,-0x2c(%rbp)
+    console_printer* cp = (console_printer*) p;
+  201070:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  201074:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    /*if (cp->cursor >= console + CONSOLE_ROWS * CONSOLE_COLUMNS) {
+        cp->cursor = console;
+    }*/
+    if (c == '\n') {
+  201078:	80 7d d4 0a          	cmpb   $0xa,-0x2c(%rbp)
+  20107c:	75 7f                	jne    2010fd <console_putc+0xa1>
+        int pos = (cp->cursor - console) % CONSOLE_COLUMNS;
+  20107e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201082:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  201086:	48 8d 05 73 6f eb ff 	lea    -0x14908d(%rip),%rax        # b8000 <console>
+  20108d:	48 29 c2             	sub    %rax,%rdx
+  201090:	48 89 d0             	mov    %rdx,%rax
+  201093:	48 d1 f8             	sar    %rax
+  201096:	48 89 c1             	mov    %rax,%rcx
+  201099:	48 ba 67 66 66 66 66 	movabs $0x6666666666666667,%rdx
+  2010a0:	66 66 66 
+  2010a3:	48 89 c8             	mov    %rcx,%rax
+  2010a6:	48 f7 ea             	imul   %rdx
+  2010a9:	48 c1 fa 05          	sar    $0x5,%rdx
+  2010ad:	48 89 c8             	mov    %rcx,%rax
+  2010b0:	48 c1 f8 3f          	sar    $0x3f,%rax
+  2010b4:	48 29 c2             	sub    %rax,%rdx
+  2010b7:	48 89 d0             	mov    %rdx,%rax
+  2010ba:	48 c1 e0 02          	shl    $0x2,%rax
+  2010be:	48 01 d0             	add    %rdx,%rax
+  2010c1:	48 c1 e0 04          	shl    $0x4,%rax
+  2010c5:	48 29 c1             	sub    %rax,%rcx
+  2010c8:	48 89 ca             	mov    %rcx,%rdx
+  2010cb:	89 55 fc             	mov    %edx,-0x4(%rbp)
+        for (; pos != CONSOLE_COLUMNS; pos++) {
+  2010ce:	eb 25                	jmp    2010f5 <console_putc+0x99>
+            *cp->cursor++ = ' ' | color;
+  2010d0:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  2010d3:	83 c8 20             	or     $0x20,%eax
+  2010d6:	89 c6                	mov    %eax,%esi
+  2010d8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2010dc:	48 8b 40 08          	mov    0x8(%rax),%rax
+  2010e0:	48 8d 48 02          	lea    0x2(%rax),%rcx
+  2010e4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  2010e8:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  2010ec:	89 f2                	mov    %esi,%edx
+  2010ee:	66 89 10             	mov    %dx,(%rax)
+        for (; pos != CONSOLE_COLUMNS; pos++) {
+  2010f1:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  2010f5:	83 7d fc 50          	cmpl   $0x50,-0x4(%rbp)
+  2010f9:	75 d5                	jne    2010d0 <console_putc+0x74>
+  2010fb:	eb 69                	jmp    201166 <console_putc+0x10a>
+        }
+    } else if (c == '\b') {
+  2010fd:	80 7d d4 08          	cmpb   $0x8,-0x2c(%rbp)
+  201101:	75 3f                	jne    201142 <console_putc+0xe6>
+        if (cp->cursor != console) {
+  201103:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201107:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  20110b:	48 8d 05 ee 6e eb ff 	lea    -0x149112(%rip),%rax        # b8000 <console>
+  201112:	48 39 c2             	cmp    %rax,%rdx
+  201115:	74 4f                	je     201166 <console_putc+0x10a>
+            *(--cp->cursor) = ' ' | color;
+  201117:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  20111a:	83 c8 20             	or     $0x20,%eax
+  20111d:	89 c1                	mov    %eax,%ecx
+  20111f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201123:	48 8b 40 08          	mov    0x8(%rax),%rax
+  201127:	48 8d 50 fe          	lea    -0x2(%rax),%rdx
+  20112b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20112f:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  201133:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201137:	48 8b 40 08          	mov    0x8(%rax),%rax
+  20113b:	89 ca                	mov    %ecx,%edx
+  20113d:	66 89 10             	mov    %dx,(%rax)
+  201140:	eb 24                	jmp    201166 <console_putc+0x10a>
+        }
+    } else {
+        *cp->cursor++ = c | color;
+  201142:	0f b6 45 d4          	movzbl -0x2c(%rbp),%eax
+  201146:	8b 55 d0             	mov    -0x30(%rbp),%edx
+  201149:	09 d0                	or     %edx,%eax
+  20114b:	89 c6                	mov    %eax,%esi
+  20114d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201151:	48 8b 40 08          	mov    0x8(%rax),%rax
+  201155:	48 8d 48 02          	lea    0x2(%rax),%rcx
+  201159:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  20115d:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  201161:	89 f2                	mov    %esi,%edx
+  201163:	66 89 10             	mov    %dx,(%rax)
+    }
+
+    const int MAX_ROWS = CONSOLE_ROWS - 2;
+  201166:	c7 45 e4 17 00 00 00 	movl   $0x17,-0x1c(%rbp)
+
+    if (cp->cursor == console + MAX_ROWS * CONSOLE_COLUMNS) {
+  20116d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201171:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  201175:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  201178:	89 d0                	mov    %edx,%eax
+  20117a:	c1 e0 02             	shl    $0x2,%eax
+  20117d:	01 d0                	add    %edx,%eax
+  20117f:	c1 e0 04             	shl    $0x4,%eax
+  201182:	48 98                	cltq
+  201184:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  201188:	48 8d 05 71 6e eb ff 	lea    -0x14918f(%rip),%rax        # b8000 <console>
+  20118f:	48 01 d0             	add    %rdx,%rax
+  201192:	48 39 c1             	cmp    %rax,%rcx
+  201195:	0f 85 ac 00 00 00    	jne    201247 <console_putc+0x1eb>
+        // Move all characters up by one row, forgetting the first row
+        for (int i = 0; i < (MAX_ROWS - 1) * CONSOLE_COLUMNS; ++i) {
+  20119b:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  2011a2:	eb 30                	jmp    2011d4 <console_putc+0x178>
+            console[i] = console[i + CONSOLE_COLUMNS];
+  2011a4:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  2011a7:	83 c0 50             	add    $0x50,%eax
+  2011aa:	48 98                	cltq
+  2011ac:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  2011b0:	48 8d 05 49 6e eb ff 	lea    -0x1491b7(%rip),%rax        # b8000 <console>
+  2011b7:	0f b7 04 02          	movzwl (%rdx,%rax,1),%eax
+  2011bb:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  2011be:	48 63 d2             	movslq %edx,%rdx
+  2011c1:	48 8d 0c 12          	lea    (%rdx,%rdx,1),%rcx
+  2011c5:	48 8d 15 34 6e eb ff 	lea    -0x1491cc(%rip),%rdx        # b8000 <console>
+  2011cc:	66 89 04 11          	mov    %ax,(%rcx,%rdx,1)
+        for (int i = 0; i < (MAX_ROWS - 1) * CONSOLE_COLUMNS; ++i) {
+  2011d0:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+  2011d4:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  2011d7:	8d 50 ff             	lea    -0x1(%rax),%edx
+  2011da:	89 d0                	mov    %edx,%eax
+  2011dc:	c1 e0 02             	shl    $0x2,%eax
+  2011df:	01 d0                	add    %edx,%eax
+  2011e1:	c1 e0 04             	shl    $0x4,%eax
+  2011e4:	39 45 f8             	cmp    %eax,-0x8(%rbp)
+  2011e7:	7c bb                	jl     2011a4 <console_putc+0x148>
+        }
+
+        // Fill last column with space
+        for (int i = (MAX_ROWS - 1) * CONSOLE_COLUMNS; i < MAX_ROWS * CONSOLE_COLUMNS; ++i) {
+  2011e9:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  2011ec:	8d 50 ff             	lea    -0x1(%rax),%edx
+  2011ef:	89 d0                	mov    %edx,%eax
+  2011f1:	c1 e0 02             	shl    $0x2,%eax
+  2011f4:	01 d0                	add    %edx,%eax
+  2011f6:	c1 e0 04             	shl    $0x4,%eax
+  2011f9:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  2011fc:	eb 20                	jmp    20121e <console_putc+0x1c2>
+            console[i] = ' ' | color;
+  2011fe:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  201201:	83 c8 20             	or     $0x20,%eax
+  201204:	89 c1                	mov    %eax,%ecx
+  201206:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  201209:	48 98                	cltq
+  20120b:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  20120f:	48 8d 05 ea 6d eb ff 	lea    -0x149216(%rip),%rax        # b8000 <console>
+  201216:	66 89 0c 02          	mov    %cx,(%rdx,%rax,1)
+        for (int i = (MAX_ROWS - 1) * CONSOLE_COLUMNS; i < MAX_ROWS * CONSOLE_COLUMNS; ++i) {
+  20121a:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  20121e:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  201221:	89 d0                	mov    %edx,%eax
+  201223:	c1 e0 02             	shl    $0x2,%eax
+  201226:	01 d0                	add    %edx,%eax
+  201228:	c1 e0 04             	shl    $0x4,%eax
+  20122b:	39 45 f4             	cmp    %eax,-0xc(%rbp)
+  20122e:	7c ce                	jl     2011fe <console_putc+0x1a2>
+        }
+
+        cp->cursor -= CONSOLE_COLUMNS;
+  201230:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201234:	48 8b 40 08          	mov    0x8(%rax),%rax
+  201238:	48 8d 90 60 ff ff ff 	lea    -0xa0(%rax),%rdx
+  20123f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201243:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    }
+}
+  201247:	90                   	nop
+  201248:	c9                   	leave
+  201249:	c3                   	ret
+
+000000000020124a <console_vprintf>:
+
+int console_vprintf(int cpos, int color, const char* format, va_list val) {
+  20124a:	55                   	push   %rbp
+  20124b:	48 89 e5             	mov    %rsp,%rbp
+  20124e:	48 83 ec 30          	sub    $0x30,%rsp
+  201252:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  201255:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  201258:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  20125c:	48 89 4d d8          	mov    %rcx,-0x28(%rbp)
+    struct console_printer cp;
+    cp.p.putc = console_putc;
+  201260:	48 8d 05 f5 fd ff ff 	lea    -0x20b(%rip),%rax        # 20105c <console_putc>
+  201267:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (cpos < 0 || cpos >= CONSOLE_ROWS * CONSOLE_COLUMNS) {
+  20126b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  20126f:	78 09                	js     20127a <console_vprintf+0x30>
+  201271:	81 7d ec cf 07 00 00 	cmpl   $0x7cf,-0x14(%rbp)
+  201278:	7e 07                	jle    201281 <console_vprintf+0x37>
+        cpos = 0;
+  20127a:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+    }
+    cp.cursor = console + cpos;
+  201281:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  201284:	48 98                	cltq
+  201286:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  20128a:	48 8d 05 6f 6d eb ff 	lea    -0x149291(%rip),%rax        # b8000 <console>
+  201291:	48 01 d0             	add    %rdx,%rax
+  201294:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    printer_vprintf(&cp.p, color, format, val);
+  201298:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  20129c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  2012a0:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  2012a3:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  2012a7:	48 89 c7             	mov    %rax,%rdi
+  2012aa:	e8 a9 f3 ff ff       	call   200658 <printer_vprintf>
+    return cp.cursor - console;
+  2012af:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  2012b3:	48 8d 05 46 6d eb ff 	lea    -0x1492ba(%rip),%rax        # b8000 <console>
+  2012ba:	48 29 c2             	sub    %rax,%rdx
+  2012bd:	48 89 d0             	mov    %rdx,%rax
+  2012c0:	48 d1 f8             	sar    %rax
+}
+  2012c3:	c9                   	leave
+  2012c4:	c3                   	ret
+
+00000000002012c5 <console_printf>:
+
+int console_printf(int cpos, int color, const char* format, ...) {
+  2012c5:	55                   	push   %rbp
+  2012c6:	48 89 e5             	mov    %rsp,%rbp
+  2012c9:	48 83 ec 60          	sub    $0x60,%rsp
+  2012cd:	89 7d ac             	mov    %edi,-0x54(%rbp)
+  2012d0:	89 75 a8             	mov    %esi,-0x58(%rbp)
+  2012d3:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+  2012d7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  2012db:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  2012df:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list val;
+    va_start(val, format);
+  2012e3:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  2012ea:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  2012ee:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  2012f2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  2012f6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    cpos = console_vprintf(cpos, color, format, val);
+  2012fa:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  2012fe:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  201302:	8b 75 a8             	mov    -0x58(%rbp),%esi
+  201305:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  201308:	89 c7                	mov    %eax,%edi
+  20130a:	e8 3b ff ff ff       	call   20124a <console_vprintf>
+  20130f:	89 45 ac             	mov    %eax,-0x54(%rbp)
+    va_end(val);
+    return cpos;
+  201312:	8b 45 ac             	mov    -0x54(%rbp),%eax
+}
+  201315:	c9                   	leave
+  201316:	c3                   	ret
+
+0000000000201317 <string_putc>:
+    printer p;
+    char* s;
+    char* end;
+} string_printer;
+
+static void string_putc(printer* p, unsigned char c, int color) {
+  201317:	55                   	push   %rbp
+  201318:	48 89 e5             	mov    %rsp,%rbp
+  20131b:	48 83 ec 20          	sub    $0x20,%rsp
+  20131f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  201323:	89 f0                	mov    %esi,%eax
+  201325:	89 55 e0             	mov    %edx,-0x20(%rbp)
+  201328:	88 45 e4             	mov    %al,-0x1c(%rbp)
+    string_printer* sp = (string_printer*) p;
+  20132b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20132f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (sp->s < sp->end) {
+  201333:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  201337:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  20133b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20133f:	48 8b 40 10          	mov    0x10(%rax),%rax
+  201343:	48 39 c2             	cmp    %rax,%rdx
+  201346:	73 1a                	jae    201362 <string_putc+0x4b>
+        *sp->s++ = c;
+  201348:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20134c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  201350:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  201354:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  201358:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  20135c:	0f b6 55 e4          	movzbl -0x1c(%rbp),%edx
+  201360:	88 10                	mov    %dl,(%rax)
+    }
+    (void) color;
+}
+  201362:	90                   	nop
+  201363:	c9                   	leave
+  201364:	c3                   	ret
+
+0000000000201365 <vsnprintf>:
+
+int vsnprintf(char* s, size_t size, const char* format, va_list val) {
+  201365:	55                   	push   %rbp
+  201366:	48 89 e5             	mov    %rsp,%rbp
+  201369:	48 83 ec 40          	sub    $0x40,%rsp
+  20136d:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  201371:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  201375:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  201379:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+    string_printer sp;
+    sp.p.putc = string_putc;
+  20137d:	48 8d 05 93 ff ff ff 	lea    -0x6d(%rip),%rax        # 201317 <string_putc>
+  201384:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    sp.s = s;
+  201388:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  20138c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (size) {
+  201390:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  201395:	74 33                	je     2013ca <vsnprintf+0x65>
+        sp.end = s + size - 1;
+  201397:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  20139b:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  20139f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  2013a3:	48 01 d0             	add    %rdx,%rax
+  2013a6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+        printer_vprintf(&sp.p, 0, format, val);
+  2013aa:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  2013ae:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  2013b2:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  2013b6:	be 00 00 00 00       	mov    $0x0,%esi
+  2013bb:	48 89 c7             	mov    %rax,%rdi
+  2013be:	e8 95 f2 ff ff       	call   200658 <printer_vprintf>
+        *sp.s = 0;
+  2013c3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2013c7:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return sp.s - s;
+  2013ca:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2013ce:	48 2b 45 d8          	sub    -0x28(%rbp),%rax
+}
+  2013d2:	c9                   	leave
+  2013d3:	c3                   	ret
+
+00000000002013d4 <snprintf>:
+
+int snprintf(char* s, size_t size, const char* format, ...) {
+  2013d4:	55                   	push   %rbp
+  2013d5:	48 89 e5             	mov    %rsp,%rbp
+  2013d8:	48 83 ec 70          	sub    $0x70,%rsp
+  2013dc:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  2013e0:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  2013e4:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  2013e8:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  2013ec:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  2013f0:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list val;
+    va_start(val, format);
+  2013f4:	c7 45 b0 18 00 00 00 	movl   $0x18,-0x50(%rbp)
+  2013fb:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  2013ff:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  201403:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  201407:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    int n = vsnprintf(s, size, format, val);
+  20140b:	48 8d 4d b0          	lea    -0x50(%rbp),%rcx
+  20140f:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  201413:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  201417:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  20141b:	48 89 c7             	mov    %rax,%rdi
+  20141e:	e8 42 ff ff ff       	call   201365 <vsnprintf>
+  201423:	89 45 cc             	mov    %eax,-0x34(%rbp)
+    va_end(val);
+    return n;
+  201426:	8b 45 cc             	mov    -0x34(%rbp),%eax
+}
+  201429:	c9                   	leave
+  20142a:	c3                   	ret
+
+000000000020142b <console_clear>:
+
+
+// console_clear
+//    Erases the console and moves the cursor to the upper left (CPOS(0, 0)).
+
+void console_clear(void) {
+  20142b:	55                   	push   %rbp
+  20142c:	48 89 e5             	mov    %rsp,%rbp
+  20142f:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < CONSOLE_ROWS * CONSOLE_COLUMNS; ++i) {
+  201433:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  20143a:	eb 1a                	jmp    201456 <console_clear+0x2b>
+        console[i] = ' ' | 0x0700;
+  20143c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  20143f:	48 98                	cltq
+  201441:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  201445:	48 8d 05 b4 6b eb ff 	lea    -0x14944c(%rip),%rax        # b8000 <console>
+  20144c:	66 c7 04 02 20 07    	movw   $0x720,(%rdx,%rax,1)
+    for (int i = 0; i < CONSOLE_ROWS * CONSOLE_COLUMNS; ++i) {
+  201452:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  201456:	81 7d fc cf 07 00 00 	cmpl   $0x7cf,-0x4(%rbp)
+  20145d:	7e dd                	jle    20143c <console_clear+0x11>
+    }
+    cursorpos = 0;
+  20145f:	c7 05 93 7b eb ff 00 	movl   $0x0,-0x14846d(%rip)        # b8ffc <cursorpos>
+  201466:	00 00 00 
+}
+  201469:	90                   	nop
+  20146a:	c9                   	leave
+  20146b:	c3                   	ret
+
+000000000020146c <string_to_char>:
+
+
+int string_to_char(const char *str, int *dest) {
+  20146c:	55                   	push   %rbp
+  20146d:	48 89 e5             	mov    %rsp,%rbp
+  201470:	48 83 ec 20          	sub    $0x20,%rsp
+  201474:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  201478:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    if (*str == '\0') return -1;
+  20147c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201480:	0f b6 00             	movzbl (%rax),%eax
+  201483:	84 c0                	test   %al,%al
+  201485:	75 0a                	jne    201491 <string_to_char+0x25>
+  201487:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  20148c:	e9 e0 00 00 00       	jmp    201571 <string_to_char+0x105>
+
+    *dest = 0;
+  201491:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  201495:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    for (; *str; str++) {
+  20149b:	e9 bd 00 00 00       	jmp    20155d <string_to_char+0xf1>
+        int digit = 0;
+  2014a0:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+        switch (*str)
+  2014a7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2014ab:	0f b6 00             	movzbl (%rax),%eax
+  2014ae:	0f be c0             	movsbl %al,%eax
+  2014b1:	83 e8 30             	sub    $0x30,%eax
+  2014b4:	83 f8 09             	cmp    $0x9,%eax
+  2014b7:	77 7c                	ja     201535 <string_to_char+0xc9>
+  2014b9:	89 c0                	mov    %eax,%eax
+  2014bb:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  2014c2:	00 
+  2014c3:	48 8d 05 da 0c 00 00 	lea    0xcda(%rip),%rax        # 2021a4 <flag_chars+0xf4>
+  2014ca:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+  2014cd:	48 98                	cltq
+  2014cf:	48 8d 15 ce 0c 00 00 	lea    0xcce(%rip),%rdx        # 2021a4 <flag_chars+0xf4>
+  2014d6:	48 01 d0             	add    %rdx,%rax
+  2014d9:	ff e0                	jmp    *%rax
+        {
+        case '0':
+            digit = 0;
+  2014db:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+            break;
+  2014e2:	eb 58                	jmp    20153c <string_to_char+0xd0>
+        case '1':
+            digit = 1;
+  2014e4:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+            break;
+  2014eb:	eb 4f                	jmp    20153c <string_to_char+0xd0>
+        case '2':
+            digit = 2;
+  2014ed:	c7 45 fc 02 00 00 00 	movl   $0x2,-0x4(%rbp)
+            break;
+  2014f4:	eb 46                	jmp    20153c <string_to_char+0xd0>
+        case '3':
+            digit = 3;
+  2014f6:	c7 45 fc 03 00 00 00 	movl   $0x3,-0x4(%rbp)
+            break;
+  2014fd:	eb 3d                	jmp    20153c <string_to_char+0xd0>
+        case '4':
+            digit = 4;
+  2014ff:	c7 45 fc 04 00 00 00 	movl   $0x4,-0x4(%rbp)
+            break;
+  201506:	eb 34                	jmp    20153c <string_to_char+0xd0>
+        case '5':
+            digit = 5;
+  201508:	c7 45 fc 05 00 00 00 	movl   $0x5,-0x4(%rbp)
+            break;
+  20150f:	eb 2b                	jmp    20153c <string_to_char+0xd0>
+        case '6':
+            digit = 6;
+  201511:	c7 45 fc 06 00 00 00 	movl   $0x6,-0x4(%rbp)
+            break;
+  201518:	eb 22                	jmp    20153c <string_to_char+0xd0>
+        case '7':
+            digit = 7;
+  20151a:	c7 45 fc 07 00 00 00 	movl   $0x7,-0x4(%rbp)
+            break;
+  201521:	eb 19                	jmp    20153c <string_to_char+0xd0>
+        case '8':
+            digit = 8;
+  201523:	c7 45 fc 08 00 00 00 	movl   $0x8,-0x4(%rbp)
+            break;
+  20152a:	eb 10                	jmp    20153c <string_to_char+0xd0>
+        case '9':
+            digit = 9;
+  20152c:	c7 45 fc 09 00 00 00 	movl   $0x9,-0x4(%rbp)
+            break;
+  201533:	eb 07                	jmp    20153c <string_to_char+0xd0>
+        default:
+            return -1;
+  201535:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  20153a:	eb 35                	jmp    201571 <string_to_char+0x105>
+        }
+
+        *dest = *dest * 10 + digit;
+  20153c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  201540:	8b 10                	mov    (%rax),%edx
+  201542:	89 d0                	mov    %edx,%eax
+  201544:	c1 e0 02             	shl    $0x2,%eax
+  201547:	01 d0                	add    %edx,%eax
+  201549:	01 c0                	add    %eax,%eax
+  20154b:	89 c2                	mov    %eax,%edx
+  20154d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  201550:	01 c2                	add    %eax,%edx
+  201552:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  201556:	89 10                	mov    %edx,(%rax)
+    for (; *str; str++) {
+  201558:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  20155d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201561:	0f b6 00             	movzbl (%rax),%eax
+  201564:	84 c0                	test   %al,%al
+  201566:	0f 85 34 ff ff ff    	jne    2014a0 <string_to_char+0x34>
+    }
+
+    return 0;
+  20156c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  201571:	c9                   	leave
+  201572:	c3                   	ret
+
+0000000000201573 <atoi>:
+
+int atoi(const char *str) {
+  201573:	55                   	push   %rbp
+  201574:	48 89 e5             	mov    %rsp,%rbp
+  201577:	48 83 ec 18          	sub    $0x18,%rsp
+  20157b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    if (*str == '\0') return -1;
+  20157f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201583:	0f b6 00             	movzbl (%rax),%eax
+  201586:	84 c0                	test   %al,%al
+  201588:	75 0a                	jne    201594 <atoi+0x21>
+  20158a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  20158f:	e9 d7 00 00 00       	jmp    20166b <atoi+0xf8>
+
+    int n = 0;
+  201594:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    for (; *str; str++) {
+  20159b:	e9 b7 00 00 00       	jmp    201657 <atoi+0xe4>
+        int digit = 0;
+  2015a0:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+        switch (*str)
+  2015a7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2015ab:	0f b6 00             	movzbl (%rax),%eax
+  2015ae:	0f be c0             	movsbl %al,%eax
+  2015b1:	83 e8 30             	sub    $0x30,%eax
+  2015b4:	83 f8 09             	cmp    $0x9,%eax
+  2015b7:	77 7c                	ja     201635 <atoi+0xc2>
+  2015b9:	89 c0                	mov    %eax,%eax
+  2015bb:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  2015c2:	00 
+  2015c3:	48 8d 05 02 0c 00 00 	lea    0xc02(%rip),%rax        # 2021cc <flag_chars+0x11c>
+  2015ca:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+  2015cd:	48 98                	cltq
+  2015cf:	48 8d 15 f6 0b 00 00 	lea    0xbf6(%rip),%rdx        # 2021cc <flag_chars+0x11c>
+  2015d6:	48 01 d0             	add    %rdx,%rax
+  2015d9:	ff e0                	jmp    *%rax
+        {
+        case '0':
+            digit = 0;
+  2015db:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+            break;
+  2015e2:	eb 58                	jmp    20163c <atoi+0xc9>
+        case '1':
+            digit = 1;
+  2015e4:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+            break;
+  2015eb:	eb 4f                	jmp    20163c <atoi+0xc9>
+        case '2':
+            digit = 2;
+  2015ed:	c7 45 f8 02 00 00 00 	movl   $0x2,-0x8(%rbp)
+            break;
+  2015f4:	eb 46                	jmp    20163c <atoi+0xc9>
+        case '3':
+            digit = 3;
+  2015f6:	c7 45 f8 03 00 00 00 	movl   $0x3,-0x8(%rbp)
+            break;
+  2015fd:	eb 3d                	jmp    20163c <atoi+0xc9>
+        case '4':
+            digit = 4;
+  2015ff:	c7 45 f8 04 00 00 00 	movl   $0x4,-0x8(%rbp)
+            break;
+  201606:	eb 34                	jmp    20163c <atoi+0xc9>
+        case '5':
+            digit = 5;
+  201608:	c7 45 f8 05 00 00 00 	movl   $0x5,-0x8(%rbp)
+            break;
+  20160f:	eb 2b                	jmp    20163c <atoi+0xc9>
+        case '6':
+            digit = 6;
+  201611:	c7 45 f8 06 00 00 00 	movl   $0x6,-0x8(%rbp)
+            break;
+  201618:	eb 22                	jmp    20163c <atoi+0xc9>
+        case '7':
+            digit = 7;
+  20161a:	c7 45 f8 07 00 00 00 	movl   $0x7,-0x8(%rbp)
+            break;
+  201621:	eb 19                	jmp    20163c <atoi+0xc9>
+        case '8':
+            digit = 8;
+  201623:	c7 45 f8 08 00 00 00 	movl   $0x8,-0x8(%rbp)
+            break;
+  20162a:	eb 10                	jmp    20163c <atoi+0xc9>
+        case '9':
+            digit = 9;
+  20162c:	c7 45 f8 09 00 00 00 	movl   $0x9,-0x8(%rbp)
+            break;
+  201633:	eb 07                	jmp    20163c <atoi+0xc9>
+        default:
+            return -1;
+  201635:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  20163a:	eb 2f                	jmp    20166b <atoi+0xf8>
+        }
+
+        n = n * 10 + digit;
+  20163c:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  20163f:	89 d0                	mov    %edx,%eax
+  201641:	c1 e0 02             	shl    $0x2,%eax
+  201644:	01 d0                	add    %edx,%eax
+  201646:	01 c0                	add    %eax,%eax
+  201648:	89 c2                	mov    %eax,%edx
+  20164a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  20164d:	01 d0                	add    %edx,%eax
+  20164f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    for (; *str; str++) {
+  201652:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  201657:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20165b:	0f b6 00             	movzbl (%rax),%eax
+  20165e:	84 c0                	test   %al,%al
+  201660:	0f 85 3a ff ff ff    	jne    2015a0 <atoi+0x2d>
+    }
+
+    return 0;
+  201666:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  20166b:	c9                   	leave
+  20166c:	c3                   	ret
+
+000000000020166d <copy_comp>:
+        components[ncomp++] = (comp); \
+    } \
+} while (0)
+
+// Helper to copy a component to dst
+void copy_comp(const char *start, const char *end, char **pdst) {
+  20166d:	55                   	push   %rbp
+  20166e:	48 89 e5             	mov    %rsp,%rbp
+  201671:	48 83 ec 18          	sub    $0x18,%rsp
+  201675:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  201679:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  20167d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    while (start < end) {
+  201681:	eb 23                	jmp    2016a6 <copy_comp+0x39>
+        *(*pdst)++ = *start++;
+  201683:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  201687:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  20168b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  20168f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201693:	48 8b 00             	mov    (%rax),%rax
+  201696:	48 8d 70 01          	lea    0x1(%rax),%rsi
+  20169a:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  20169e:	48 89 31             	mov    %rsi,(%rcx)
+  2016a1:	0f b6 12             	movzbl (%rdx),%edx
+  2016a4:	88 10                	mov    %dl,(%rax)
+    while (start < end) {
+  2016a6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2016aa:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  2016ae:	72 d3                	jb     201683 <copy_comp+0x16>
+    }
+}
+  2016b0:	90                   	nop
+  2016b1:	90                   	nop
+  2016b2:	c9                   	leave
+  2016b3:	c3                   	ret
+
+00000000002016b4 <join_path>:
+
+
+void join_path(const char *abs_path, const char *path, char *dst) {
+  2016b4:	55                   	push   %rbp
+  2016b5:	48 89 e5             	mov    %rsp,%rbp
+  2016b8:	48 81 ec 68 02 00 00 	sub    $0x268,%rsp
+  2016bf:	48 89 bd a8 fd ff ff 	mov    %rdi,-0x258(%rbp)
+  2016c6:	48 89 b5 a0 fd ff ff 	mov    %rsi,-0x260(%rbp)
+  2016cd:	48 89 95 98 fd ff ff 	mov    %rdx,-0x268(%rbp)
+    // If path is absolute, just copy it to dst (removing duplicate slashes, and trailing slash unless root)
+    if (path[0] == '/') {
+  2016d4:	48 8b 85 a0 fd ff ff 	mov    -0x260(%rbp),%rax
+  2016db:	0f b6 00             	movzbl (%rax),%eax
+  2016de:	3c 2f                	cmp    $0x2f,%al
+  2016e0:	0f 85 d6 00 00 00    	jne    2017bc <join_path+0x108>
+        const char *src = path;
+  2016e6:	48 8b 85 a0 fd ff ff 	mov    -0x260(%rbp),%rax
+  2016ed:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+        char *d = dst;
+  2016f1:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  2016f8:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+        // Always start with a single slash
+        *d++ = '/';
+  2016fc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  201700:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  201704:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  201708:	c6 00 2f             	movb   $0x2f,(%rax)
+        src++;
+  20170b:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+        int last_was_slash = 1;
+  201710:	c7 45 b0 01 00 00 00 	movl   $0x1,-0x50(%rbp)
+        while (*src) {
+  201717:	eb 64                	jmp    20177d <join_path+0xc9>
+            if (*src == '/') {
+  201719:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20171d:	0f b6 00             	movzbl (%rax),%eax
+  201720:	3c 2f                	cmp    $0x2f,%al
+  201722:	75 35                	jne    201759 <join_path+0xa5>
+                // Skip consecutive slashes
+                while (*src == '/') src++;
+  201724:	eb 05                	jmp    20172b <join_path+0x77>
+  201726:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  20172b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20172f:	0f b6 00             	movzbl (%rax),%eax
+  201732:	3c 2f                	cmp    $0x2f,%al
+  201734:	74 f0                	je     201726 <join_path+0x72>
+                if (*src == 0) break;
+  201736:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20173a:	0f b6 00             	movzbl (%rax),%eax
+  20173d:	84 c0                	test   %al,%al
+  20173f:	74 49                	je     20178a <join_path+0xd6>
+                *d++ = '/';
+  201741:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  201745:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  201749:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  20174d:	c6 00 2f             	movb   $0x2f,(%rax)
+                last_was_slash = 1;
+  201750:	c7 45 b0 01 00 00 00 	movl   $0x1,-0x50(%rbp)
+  201757:	eb 24                	jmp    20177d <join_path+0xc9>
+            } else {
+                *d++ = *src++;
+  201759:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  20175d:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  201761:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  201765:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  201769:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  20176d:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  201771:	0f b6 12             	movzbl (%rdx),%edx
+  201774:	88 10                	mov    %dl,(%rax)
+                last_was_slash = 0;
+  201776:	c7 45 b0 00 00 00 00 	movl   $0x0,-0x50(%rbp)
+        while (*src) {
+  20177d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  201781:	0f b6 00             	movzbl (%rax),%eax
+  201784:	84 c0                	test   %al,%al
+  201786:	75 91                	jne    201719 <join_path+0x65>
+  201788:	eb 01                	jmp    20178b <join_path+0xd7>
+                if (*src == 0) break;
+  20178a:	90                   	nop
+            }
+        }
+        // Remove trailing slash unless the path is just "/"
+        if (d > dst + 1 && *(d-1) == '/') {
+  20178b:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  201792:	48 83 c0 01          	add    $0x1,%rax
+  201796:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  20179a:	73 14                	jae    2017b0 <join_path+0xfc>
+  20179c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2017a0:	48 83 e8 01          	sub    $0x1,%rax
+  2017a4:	0f b6 00             	movzbl (%rax),%eax
+  2017a7:	3c 2f                	cmp    $0x2f,%al
+  2017a9:	75 05                	jne    2017b0 <join_path+0xfc>
+            d--;
+  2017ab:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+        }
+        *d = 0;
+  2017b0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2017b4:	c6 00 00             	movb   $0x0,(%rax)
+  2017b7:	e9 e9 02 00 00       	jmp    201aa5 <join_path+0x3f1>
+        return;
+    }
+
+    // Otherwise, start with abs_path
+    const char *src = abs_path;
+  2017bc:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  2017c3:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    char *d = dst;
+  2017c7:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  2017ce:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    if (*src != '/') {
+  2017d2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2017d6:	0f b6 00             	movzbl (%rax),%eax
+  2017d9:	3c 2f                	cmp    $0x2f,%al
+  2017db:	74 2e                	je     20180b <join_path+0x157>
+        *d++ = '/';
+  2017dd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  2017e1:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  2017e5:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  2017e9:	c6 00 2f             	movb   $0x2f,(%rax)
+    }
+    while (*src) {
+  2017ec:	eb 1d                	jmp    20180b <join_path+0x157>
+        *d++ = *src++;
+  2017ee:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  2017f2:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  2017f6:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  2017fa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  2017fe:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  201802:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  201806:	0f b6 12             	movzbl (%rdx),%edx
+  201809:	88 10                	mov    %dl,(%rax)
+    while (*src) {
+  20180b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20180f:	0f b6 00             	movzbl (%rax),%eax
+  201812:	84 c0                	test   %al,%al
+  201814:	75 d8                	jne    2017ee <join_path+0x13a>
+    }
+    // Remove trailing slash (unless root)
+    if (d > dst + 1 && *(d-1) == '/') {
+  201816:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  20181d:	48 83 c0 01          	add    $0x1,%rax
+  201821:	48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+  201825:	73 14                	jae    20183b <join_path+0x187>
+  201827:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  20182b:	48 83 e8 01          	sub    $0x1,%rax
+  20182f:	0f b6 00             	movzbl (%rax),%eax
+  201832:	3c 2f                	cmp    $0x2f,%al
+  201834:	75 05                	jne    20183b <join_path+0x187>
+        d--;
+  201836:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+    }
+    *d = 0;
+  20183b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  20183f:	c6 00 00             	movb   $0x0,(%rax)
+
+    // Now, process path components
+    char temp[512];
+    int tlen = 0;
+  201842:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    // Copy dst to temp for easier manipulation
+    src = dst;
+  201849:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  201850:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    while (*src && tlen < (int)sizeof(temp)-1) {
+  201854:	eb 22                	jmp    201878 <join_path+0x1c4>
+        temp[tlen++] = *src++;
+  201856:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20185a:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  20185e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  201862:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  201865:	8d 4a 01             	lea    0x1(%rdx),%ecx
+  201868:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  20186b:	0f b6 08             	movzbl (%rax),%ecx
+  20186e:	48 63 c2             	movslq %edx,%rax
+  201871:	88 8c 05 b0 fd ff ff 	mov    %cl,-0x250(%rbp,%rax,1)
+    while (*src && tlen < (int)sizeof(temp)-1) {
+  201878:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20187c:	0f b6 00             	movzbl (%rax),%eax
+  20187f:	84 c0                	test   %al,%al
+  201881:	74 09                	je     20188c <join_path+0x1d8>
+  201883:	81 7d dc fe 01 00 00 	cmpl   $0x1fe,-0x24(%rbp)
+  20188a:	7e ca                	jle    201856 <join_path+0x1a2>
+    }
+    temp[tlen] = 0;
+  20188c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  20188f:	48 98                	cltq
+  201891:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  201898:	00 
+
+    // Now, process each component in path
+    src = path;
+  201899:	48 8b 85 a0 fd ff ff 	mov    -0x260(%rbp),%rax
+  2018a0:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    while (*src) {
+  2018a4:	e9 65 01 00 00       	jmp    201a0e <join_path+0x35a>
+        // Skip slashes
+        while (*src == '/') src++;
+  2018a9:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  2018ae:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2018b2:	0f b6 00             	movzbl (%rax),%eax
+  2018b5:	3c 2f                	cmp    $0x2f,%al
+  2018b7:	74 f0                	je     2018a9 <join_path+0x1f5>
+        if (!*src) break;
+  2018b9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2018bd:	0f b6 00             	movzbl (%rax),%eax
+  2018c0:	84 c0                	test   %al,%al
+  2018c2:	0f 84 57 01 00 00    	je     201a1f <join_path+0x36b>
+
+        // Find end of component
+        const char *comp_start = src;
+  2018c8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2018cc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        while (*src && *src != '/') src++;
+  2018d0:	eb 05                	jmp    2018d7 <join_path+0x223>
+  2018d2:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  2018d7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2018db:	0f b6 00             	movzbl (%rax),%eax
+  2018de:	84 c0                	test   %al,%al
+  2018e0:	74 0b                	je     2018ed <join_path+0x239>
+  2018e2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2018e6:	0f b6 00             	movzbl (%rax),%eax
+  2018e9:	3c 2f                	cmp    $0x2f,%al
+  2018eb:	75 e5                	jne    2018d2 <join_path+0x21e>
+        const char *comp_end = src;
+  2018ed:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2018f1:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+
+        int comp_len = comp_end - comp_start;
+  2018f5:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  2018f9:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  2018fd:	89 45 b4             	mov    %eax,-0x4c(%rbp)
+
+        // Get component string
+        if (comp_len == 1 && comp_start[0] == '.') {
+  201900:	83 7d b4 01          	cmpl   $0x1,-0x4c(%rbp)
+  201904:	75 10                	jne    201916 <join_path+0x262>
+  201906:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  20190a:	0f b6 00             	movzbl (%rax),%eax
+  20190d:	3c 2e                	cmp    $0x2e,%al
+  20190f:	75 05                	jne    201916 <join_path+0x262>
+            // Ignore
+            continue;
+  201911:	e9 f8 00 00 00       	jmp    201a0e <join_path+0x35a>
+        } else if (comp_len == 2 && comp_start[0] == '.' && comp_start[1] == '.') {
+  201916:	83 7d b4 02          	cmpl   $0x2,-0x4c(%rbp)
+  20191a:	75 6e                	jne    20198a <join_path+0x2d6>
+  20191c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  201920:	0f b6 00             	movzbl (%rax),%eax
+  201923:	3c 2e                	cmp    $0x2e,%al
+  201925:	75 63                	jne    20198a <join_path+0x2d6>
+  201927:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  20192b:	48 83 c0 01          	add    $0x1,%rax
+  20192f:	0f b6 00             	movzbl (%rax),%eax
+  201932:	3c 2e                	cmp    $0x2e,%al
+  201934:	75 54                	jne    20198a <join_path+0x2d6>
+            // Go up one directory, unless at root
+            if (tlen > 1) {
+  201936:	83 7d dc 01          	cmpl   $0x1,-0x24(%rbp)
+  20193a:	0f 8e ce 00 00 00    	jle    201a0e <join_path+0x35a>
+                // Remove trailing slash if any
+                if (temp[tlen-1] == '/') tlen--;
+  201940:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201943:	83 e8 01             	sub    $0x1,%eax
+  201946:	48 98                	cltq
+  201948:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  20194f:	ff 
+  201950:	3c 2f                	cmp    $0x2f,%al
+  201952:	75 0a                	jne    20195e <join_path+0x2aa>
+  201954:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+                // Remove last component
+                while (tlen > 1 && temp[tlen-1] != '/') tlen--;
+  201958:	eb 04                	jmp    20195e <join_path+0x2aa>
+  20195a:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  20195e:	83 7d dc 01          	cmpl   $0x1,-0x24(%rbp)
+  201962:	7e 14                	jle    201978 <join_path+0x2c4>
+  201964:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201967:	83 e8 01             	sub    $0x1,%eax
+  20196a:	48 98                	cltq
+  20196c:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  201973:	ff 
+  201974:	3c 2f                	cmp    $0x2f,%al
+  201976:	75 e2                	jne    20195a <join_path+0x2a6>
+                temp[tlen] = 0;
+  201978:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  20197b:	48 98                	cltq
+  20197d:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  201984:	00 
+            if (tlen > 1) {
+  201985:	e9 84 00 00 00       	jmp    201a0e <join_path+0x35a>
+            }
+        } else if (comp_len > 0) {
+  20198a:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  20198e:	7e 7e                	jle    201a0e <join_path+0x35a>
+            // Add slash if not at root
+            if (tlen == 0 || temp[tlen-1] != '/') {
+  201990:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  201994:	74 14                	je     2019aa <join_path+0x2f6>
+  201996:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201999:	83 e8 01             	sub    $0x1,%eax
+  20199c:	48 98                	cltq
+  20199e:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  2019a5:	ff 
+  2019a6:	3c 2f                	cmp    $0x2f,%al
+  2019a8:	74 1c                	je     2019c6 <join_path+0x312>
+                if (tlen < (int)sizeof(temp)-1) temp[tlen++] = '/';
+  2019aa:	81 7d dc fe 01 00 00 	cmpl   $0x1fe,-0x24(%rbp)
+  2019b1:	7f 13                	jg     2019c6 <join_path+0x312>
+  2019b3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  2019b6:	8d 50 01             	lea    0x1(%rax),%edx
+  2019b9:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  2019bc:	48 98                	cltq
+  2019be:	c6 84 05 b0 fd ff ff 	movb   $0x2f,-0x250(%rbp,%rax,1)
+  2019c5:	2f 
+            }
+            // Copy component
+            for (const char *p = comp_start; p < comp_end && tlen < (int)sizeof(temp)-1; ++p) {
+  2019c6:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  2019ca:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  2019ce:	eb 1e                	jmp    2019ee <join_path+0x33a>
+                temp[tlen++] = *p;
+  2019d0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  2019d3:	8d 50 01             	lea    0x1(%rax),%edx
+  2019d6:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  2019d9:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  2019dd:	0f b6 12             	movzbl (%rdx),%edx
+  2019e0:	48 98                	cltq
+  2019e2:	88 94 05 b0 fd ff ff 	mov    %dl,-0x250(%rbp,%rax,1)
+            for (const char *p = comp_start; p < comp_end && tlen < (int)sizeof(temp)-1; ++p) {
+  2019e9:	48 83 45 d0 01       	addq   $0x1,-0x30(%rbp)
+  2019ee:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  2019f2:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  2019f6:	73 09                	jae    201a01 <join_path+0x34d>
+  2019f8:	81 7d dc fe 01 00 00 	cmpl   $0x1fe,-0x24(%rbp)
+  2019ff:	7e cf                	jle    2019d0 <join_path+0x31c>
+            }
+            temp[tlen] = 0;
+  201a01:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201a04:	48 98                	cltq
+  201a06:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  201a0d:	00 
+    while (*src) {
+  201a0e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201a12:	0f b6 00             	movzbl (%rax),%eax
+  201a15:	84 c0                	test   %al,%al
+  201a17:	0f 85 91 fe ff ff    	jne    2018ae <join_path+0x1fa>
+  201a1d:	eb 01                	jmp    201a20 <join_path+0x36c>
+        if (!*src) break;
+  201a1f:	90                   	nop
+        }
+    }
+
+    // If temp is empty, set to "/"
+    if (tlen == 0) {
+  201a20:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  201a24:	75 20                	jne    201a46 <join_path+0x392>
+        temp[tlen++] = '/';
+  201a26:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201a29:	8d 50 01             	lea    0x1(%rax),%edx
+  201a2c:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  201a2f:	48 98                	cltq
+  201a31:	c6 84 05 b0 fd ff ff 	movb   $0x2f,-0x250(%rbp,%rax,1)
+  201a38:	2f 
+        temp[tlen] = 0;
+  201a39:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201a3c:	48 98                	cltq
+  201a3e:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  201a45:	00 
+    }
+
+    // Remove trailing slash unless the path is just "/"
+    if (tlen > 1 && temp[tlen-1] == '/') {
+  201a46:	83 7d dc 01          	cmpl   $0x1,-0x24(%rbp)
+  201a4a:	7e 25                	jle    201a71 <join_path+0x3bd>
+  201a4c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201a4f:	83 e8 01             	sub    $0x1,%eax
+  201a52:	48 98                	cltq
+  201a54:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  201a5b:	ff 
+  201a5c:	3c 2f                	cmp    $0x2f,%al
+  201a5e:	75 11                	jne    201a71 <join_path+0x3bd>
+        temp[--tlen] = 0;
+  201a60:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  201a64:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201a67:	48 98                	cltq
+  201a69:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  201a70:	00 
+    }
+
+    // Copy temp to dst
+    for (int i = 0; i <= tlen; ++i) {
+  201a71:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  201a78:	eb 23                	jmp    201a9d <join_path+0x3e9>
+        dst[i] = temp[i];
+  201a7a:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  201a7d:	48 63 d0             	movslq %eax,%rdx
+  201a80:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  201a87:	48 01 c2             	add    %rax,%rdx
+  201a8a:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  201a8d:	48 98                	cltq
+  201a8f:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  201a96:	ff 
+  201a97:	88 02                	mov    %al,(%rdx)
+    for (int i = 0; i <= tlen; ++i) {
+  201a99:	83 45 cc 01          	addl   $0x1,-0x34(%rbp)
+  201a9d:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  201aa0:	3b 45 dc             	cmp    -0x24(%rbp),%eax
+  201aa3:	7e d5                	jle    201a7a <join_path+0x3c6>
+    }
+}
+  201aa5:	c9                   	leave
+  201aa6:	c3                   	ret
+
+0000000000201aa7 <app_printf>:
+#include "lib-malloc.h"
+#include "errno.h"
+// app_printf
+//     A version of console_printf that picks a sensible color by process ID.
+
+void app_printf(int colorid, const char* format, ...) {
+  201aa7:	55                   	push   %rbp
+  201aa8:	48 89 e5             	mov    %rsp,%rbp
+  201aab:	48 83 ec 50          	sub    $0x50,%rsp
+  201aaf:	49 89 f2             	mov    %rsi,%r10
+  201ab2:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  201ab6:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  201aba:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  201abe:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    int color;
+    if (colorid < 0) {
+        color = 0x0700;
+  201ac2:	be 00 07 00 00       	mov    $0x700,%esi
+    if (colorid < 0) {
+  201ac7:	85 ff                	test   %edi,%edi
+  201ac9:	78 32                	js     201afd <app_printf+0x56>
+    } else {
+        static const uint8_t col[] = { 0x0F, 0x0C, 0x0A, 0x09, 0x0E };
+        color = col[colorid % sizeof(col)] << 8;
+  201acb:	48 63 ff             	movslq %edi,%rdi
+  201ace:	48 ba cd cc cc cc cc 	movabs $0xcccccccccccccccd,%rdx
+  201ad5:	cc cc cc 
+  201ad8:	48 89 f8             	mov    %rdi,%rax
+  201adb:	48 f7 e2             	mul    %rdx
+  201ade:	48 89 d0             	mov    %rdx,%rax
+  201ae1:	48 c1 e8 02          	shr    $0x2,%rax
+  201ae5:	48 83 e2 fc          	and    $0xfffffffffffffffc,%rdx
+  201ae9:	48 01 c2             	add    %rax,%rdx
+  201aec:	48 29 d7             	sub    %rdx,%rdi
+  201aef:	48 8d 05 02 09 00 00 	lea    0x902(%rip),%rax        # 2023f8 <col.0>
+  201af6:	0f b6 34 38          	movzbl (%rax,%rdi,1),%esi
+  201afa:	c1 e6 08             	shl    $0x8,%esi
+    }
+
+    va_list val;
+    va_start(val, format);
+  201afd:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  201b04:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  201b08:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  201b0c:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  201b10:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    cursorpos = console_vprintf(cursorpos, color, format, val);
+  201b14:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  201b18:	4c 89 d2             	mov    %r10,%rdx
+  201b1b:	8b 3d db 74 eb ff    	mov    -0x148b25(%rip),%edi        # b8ffc <cursorpos>
+  201b21:	e8 24 f7 ff ff       	call   20124a <console_vprintf>
+  201b26:	89 05 d0 74 eb ff    	mov    %eax,-0x148b30(%rip)        # b8ffc <cursorpos>
+    va_end(val);
+
+    /*if (CROW(cursorpos) >= 23) {
+        cursorpos = CPOS(0, 0);
+    }*/
+}
+  201b2c:	c9                   	leave
+  201b2d:	c3                   	ret
+
+0000000000201b2e <panic>:
+
+
+// panic, assert_fail
+//     Call the INT_SYS_PANIC system call so the kernel loops until Control-C.
+
+void panic(const char* format, ...) {
+  201b2e:	55                   	push   %rbp
+  201b2f:	48 89 e5             	mov    %rsp,%rbp
+  201b32:	53                   	push   %rbx
+  201b33:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  201b3a:	48 89 fb             	mov    %rdi,%rbx
+  201b3d:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  201b41:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  201b45:	48 89 4d d8          	mov    %rcx,-0x28(%rbp)
+  201b49:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  201b4d:	4c 89 4d e8          	mov    %r9,-0x18(%rbp)
+    va_list val;
+    va_start(val, format);
+  201b51:	c7 45 a8 08 00 00 00 	movl   $0x8,-0x58(%rbp)
+  201b58:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  201b5c:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  201b60:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  201b64:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    char buf[160];
+    memcpy(buf, "PANIC: ", 7);
+  201b68:	48 8d bd 08 ff ff ff 	lea    -0xf8(%rbp),%rdi
+  201b6f:	ba 07 00 00 00       	mov    $0x7,%edx
+  201b74:	48 8d 35 b6 06 00 00 	lea    0x6b6(%rip),%rsi        # 202231 <lower_digits.0+0x11>
+  201b7b:	e8 31 e5 ff ff       	call   2000b1 <memcpy>
+    int len = vsnprintf(&buf[7], sizeof(buf) - 7, format, val) + 7;
+  201b80:	48 8d 4d a8          	lea    -0x58(%rbp),%rcx
+  201b84:	48 8d bd 0f ff ff ff 	lea    -0xf1(%rbp),%rdi
+  201b8b:	48 89 da             	mov    %rbx,%rdx
+  201b8e:	be 99 00 00 00       	mov    $0x99,%esi
+  201b93:	e8 cd f7 ff ff       	call   201365 <vsnprintf>
+  201b98:	8d 50 07             	lea    0x7(%rax),%edx
+    va_end(val);
+    if (len > 0 && buf[len - 1] != '\n') {
+  201b9b:	85 d2                	test   %edx,%edx
+  201b9d:	7e 0f                	jle    201bae <panic+0x80>
+  201b9f:	83 c0 06             	add    $0x6,%eax
+  201ba2:	48 98                	cltq
+  201ba4:	80 bc 05 08 ff ff ff 	cmpb   $0xa,-0xf8(%rbp,%rax,1)
+  201bab:	0a 
+  201bac:	75 30                	jne    201bde <panic+0xb0>
+        strcpy(buf + len - (len == (int) sizeof(buf) - 1), "\n");
+    }
+    (void) console_printf(CPOS(23, 0), 0xC000, "%s", buf);
+  201bae:	48 8d 8d 08 ff ff ff 	lea    -0xf8(%rbp),%rcx
+  201bb5:	48 8d 15 c4 04 00 00 	lea    0x4c4(%rip),%rdx        # 202080 <malloc+0x8a>
+  201bbc:	be 00 c0 00 00       	mov    $0xc000,%esi
+  201bc1:	bf 30 07 00 00       	mov    $0x730,%edi
+  201bc6:	b8 00 00 00 00       	mov    $0x0,%eax
+  201bcb:	e8 f5 f6 ff ff       	call   2012c5 <console_printf>
+    asm volatile ("syscall" : "=a" (rax)
+  201bd0:	b8 30 00 00 00       	mov    $0x30,%eax
+  201bd5:	bf 00 00 00 00       	mov    $0x0,%edi
+  201bda:	0f 05                	syscall
+ loop: goto loop;
+  201bdc:	eb fe                	jmp    201bdc <panic+0xae>
+        strcpy(buf + len - (len == (int) sizeof(buf) - 1), "\n");
+  201bde:	48 63 c2             	movslq %edx,%rax
+  201be1:	81 fa 9f 00 00 00    	cmp    $0x9f,%edx
+  201be7:	0f 94 c2             	sete   %dl
+  201bea:	0f b6 d2             	movzbl %dl,%edx
+  201bed:	48 29 d0             	sub    %rdx,%rax
+  201bf0:	48 8d bc 05 08 ff ff 	lea    -0xf8(%rbp,%rax,1),%rdi
+  201bf7:	ff 
+  201bf8:	48 8d 35 12 07 00 00 	lea    0x712(%rip),%rsi        # 202311 <lower_digits.0+0xf1>
+  201bff:	e8 3b e8 ff ff       	call   20043f <strcpy>
+  201c04:	eb a8                	jmp    201bae <panic+0x80>
+
+0000000000201c06 <raise>:
+
+#define SIGABRT -1
+
+
+
+int raise(int sig) {
+  201c06:	89 fe                	mov    %edi,%esi
+
+// getpid()
+//    Return current process ID, like sys_getpid().
+static inline pid_t getpid(void) {
+    return vdso()->pid;
+  201c08:	8b 3c 25 00 10 24 00 	mov    0x241000,%edi
+    asm volatile ("syscall" : "=a" (result)
+  201c0f:	b8 41 00 00 00       	mov    $0x41,%eax
+  201c14:	0f 05                	syscall
+    return sys_kill(getpid(), sig);
+}
+  201c16:	c3                   	ret
+
+0000000000201c17 <abort>:
+    return vdso()->pid;
+  201c17:	8b 3c 25 00 10 24 00 	mov    0x241000,%edi
+    asm volatile ("syscall" : "=a" (result)
+  201c1e:	b8 41 00 00 00       	mov    $0x41,%eax
+  201c23:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  201c28:	0f 05                	syscall
+
+void __attribute((noreturn)) abort(void) {
+    raise(SIGABRT);
+ spinloop: goto spinloop;       // should never get here
+  201c2a:	eb fe                	jmp    201c2a <abort+0x13>
+
+0000000000201c2c <assert_fail>:
+}
+
+
+void assert_fail(const char* file, int line, const char* msg) {
+  201c2c:	55                   	push   %rbp
+  201c2d:	48 89 e5             	mov    %rsp,%rbp
+  201c30:	48 89 f9             	mov    %rdi,%rcx
+  201c33:	41 89 f0             	mov    %esi,%r8d
+  201c36:	49 89 d1             	mov    %rdx,%r9
+    (void) console_printf(CPOS(23, 0), 0xC000,
+  201c39:	48 8d 15 d8 06 00 00 	lea    0x6d8(%rip),%rdx        # 202318 <lower_digits.0+0xf8>
+  201c40:	be 00 c0 00 00       	mov    $0xc000,%esi
+  201c45:	bf 30 07 00 00       	mov    $0x730,%edi
+  201c4a:	b8 00 00 00 00       	mov    $0x0,%eax
+  201c4f:	e8 71 f6 ff ff       	call   2012c5 <console_printf>
+                          "PANIC: %s:%d: assertion '%s' failed\n",
+                          file, line, msg);
+    abort();
+  201c54:	e8 be ff ff ff       	call   201c17 <abort>
+
+0000000000201c59 <scan_char>:
+    asm volatile ("syscall" : "=a" (result)
+  201c59:	bf 3a 00 00 00       	mov    $0x3a,%edi
+    asm volatile ("syscall" : "=a" (rax)
+  201c5e:	be 3c 00 00 00       	mov    $0x3c,%esi
+    asm volatile ("syscall" : "=a" (result)
+  201c63:	89 f8                	mov    %edi,%eax
+  201c65:	0f 05                	syscall
+  201c67:	89 c2                	mov    %eax,%edx
+    asm volatile ("syscall" : "=a" (rax)
+  201c69:	89 f0                	mov    %esi,%eax
+  201c6b:	0f 05                	syscall
+    int c;
+
+    do {
+        c = sys_keybord();
+        sys_yield();
+    } while (c == -1);
+  201c6d:	83 fa ff             	cmp    $0xffffffff,%edx
+  201c70:	74 f1                	je     201c63 <scan_char+0xa>
+
+    return c;
+  201c72:	89 d0                	mov    %edx,%eax
+}
+  201c74:	c3                   	ret
+
+0000000000201c75 <scan_line>:
+
+unsigned int scan_line(char* dst, unsigned int length_max) {
+  201c75:	55                   	push   %rbp
+  201c76:	48 89 e5             	mov    %rsp,%rbp
+  201c79:	41 57                	push   %r15
+  201c7b:	41 56                	push   %r14
+  201c7d:	41 55                	push   %r13
+  201c7f:	41 54                	push   %r12
+  201c81:	53                   	push   %rbx
+  201c82:	48 83 ec 08          	sub    $0x8,%rsp
+  201c86:	49 89 fe             	mov    %rdi,%r14
+  201c89:	41 89 f5             	mov    %esi,%r13d
+    unsigned int length = 0;
+  201c8c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            app_printf(0, "%c", c);
+            dst[length] = '\0';
+            return length;
+        } else if (c >= 32 && c <= 127) {
+            if (length < length_max) {
+                app_printf(0, "%c", c);
+  201c92:	4c 8d 3d a0 05 00 00 	lea    0x5a0(%rip),%r15        # 202239 <lower_digits.0+0x19>
+  201c99:	eb 05                	jmp    201ca0 <scan_line+0x2b>
+            if (length != 0) {
+  201c9b:	45 85 e4             	test   %r12d,%r12d
+  201c9e:	75 3e                	jne    201cde <scan_line+0x69>
+        unsigned char c = scan_char();
+  201ca0:	e8 b4 ff ff ff       	call   201c59 <scan_char>
+  201ca5:	89 c3                	mov    %eax,%ebx
+        if (c == '\b') {
+  201ca7:	3c 08                	cmp    $0x8,%al
+  201ca9:	74 f0                	je     201c9b <scan_line+0x26>
+        } else if (c == '\n') {
+  201cab:	3c 0a                	cmp    $0xa,%al
+  201cad:	74 4c                	je     201cfb <scan_line+0x86>
+        } else if (c >= 32 && c <= 127) {
+  201caf:	8d 43 e0             	lea    -0x20(%rbx),%eax
+            if (length < length_max) {
+  201cb2:	3c 5f                	cmp    $0x5f,%al
+  201cb4:	77 ea                	ja     201ca0 <scan_line+0x2b>
+  201cb6:	45 39 ec             	cmp    %r13d,%r12d
+  201cb9:	73 e5                	jae    201ca0 <scan_line+0x2b>
+                app_printf(0, "%c", c);
+  201cbb:	0f b6 d3             	movzbl %bl,%edx
+  201cbe:	4c 89 fe             	mov    %r15,%rsi
+  201cc1:	bf 00 00 00 00       	mov    $0x0,%edi
+  201cc6:	b8 00 00 00 00       	mov    $0x0,%eax
+  201ccb:	e8 d7 fd ff ff       	call   201aa7 <app_printf>
+                dst[length++] = c;
+  201cd0:	44 89 e0             	mov    %r12d,%eax
+  201cd3:	41 88 1c 06          	mov    %bl,(%r14,%rax,1)
+  201cd7:	45 8d 64 24 01       	lea    0x1(%r12),%r12d
+  201cdc:	eb c2                	jmp    201ca0 <scan_line+0x2b>
+                app_printf(0, "%c", c);
+  201cde:	ba 08 00 00 00       	mov    $0x8,%edx
+  201ce3:	4c 89 fe             	mov    %r15,%rsi
+  201ce6:	bf 00 00 00 00       	mov    $0x0,%edi
+  201ceb:	b8 00 00 00 00       	mov    $0x0,%eax
+  201cf0:	e8 b2 fd ff ff       	call   201aa7 <app_printf>
+                length--;
+  201cf5:	41 83 ec 01          	sub    $0x1,%r12d
+  201cf9:	eb a5                	jmp    201ca0 <scan_line+0x2b>
+            app_printf(0, "%c", c);
+  201cfb:	ba 0a 00 00 00       	mov    $0xa,%edx
+  201d00:	48 8d 35 32 05 00 00 	lea    0x532(%rip),%rsi        # 202239 <lower_digits.0+0x19>
+  201d07:	bf 00 00 00 00       	mov    $0x0,%edi
+  201d0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  201d11:	e8 91 fd ff ff       	call   201aa7 <app_printf>
+            dst[length] = '\0';
+  201d16:	44 89 e0             	mov    %r12d,%eax
+  201d19:	41 c6 04 06 00       	movb   $0x0,(%r14,%rax,1)
+            }
+        }
+    }
+}
+  201d1e:	44 89 e0             	mov    %r12d,%eax
+  201d21:	48 83 c4 08          	add    $0x8,%rsp
+  201d25:	5b                   	pop    %rbx
+  201d26:	41 5c                	pop    %r12
+  201d28:	41 5d                	pop    %r13
+  201d2a:	41 5e                	pop    %r14
+  201d2c:	41 5f                	pop    %r15
+  201d2e:	5d                   	pop    %rbp
+  201d2f:	c3                   	ret
+
+0000000000201d30 <split_string>:
+
+
+char** split_string(char* str, char sep) {
+  201d30:	55                   	push   %rbp
+  201d31:	48 89 e5             	mov    %rsp,%rbp
+  201d34:	41 57                	push   %r15
+  201d36:	41 56                	push   %r14
+  201d38:	41 55                	push   %r13
+  201d3a:	41 54                	push   %r12
+  201d3c:	53                   	push   %rbx
+  201d3d:	48 83 ec 08          	sub    $0x8,%rsp
+    int s = 1;
+    int n = 0;
+
+    while (str[n]) {
+  201d41:	0f b6 07             	movzbl (%rdi),%eax
+  201d44:	84 c0                	test   %al,%al
+  201d46:	0f 84 ad 00 00 00    	je     201df9 <split_string+0xc9>
+  201d4c:	48 89 fb             	mov    %rdi,%rbx
+  201d4f:	41 89 f4             	mov    %esi,%r12d
+  201d52:	41 be 01 00 00 00    	mov    $0x1,%r14d
+    int s = 1;
+  201d58:	b9 01 00 00 00       	mov    $0x1,%ecx
+  201d5d:	eb 03                	jmp    201d62 <split_string+0x32>
+  201d5f:	49 89 d6             	mov    %rdx,%r14
+        if (str[n] == sep)
+            s++;
+  201d62:	41 38 c4             	cmp    %al,%r12b
+  201d65:	0f 94 c0             	sete   %al
+  201d68:	0f b6 c0             	movzbl %al,%eax
+  201d6b:	01 c1                	add    %eax,%ecx
+    while (str[n]) {
+  201d6d:	49 8d 56 01          	lea    0x1(%r14),%rdx
+  201d71:	0f b6 44 13 ff       	movzbl -0x1(%rbx,%rdx,1),%eax
+  201d76:	84 c0                	test   %al,%al
+  201d78:	75 e5                	jne    201d5f <split_string+0x2f>
+        n++;
+    }
+    
+    char** part = malloc((s+1)*sizeof(char*));
+  201d7a:	44 8d 79 01          	lea    0x1(%rcx),%r15d
+  201d7e:	4d 63 ff             	movslq %r15d,%r15
+  201d81:	49 c1 e7 03          	shl    $0x3,%r15
+  201d85:	4c 89 ff             	mov    %r15,%rdi
+  201d88:	e8 69 02 00 00       	call   201ff6 <malloc>
+  201d8d:	49 89 c5             	mov    %rax,%r13
+    char* buffer = malloc(n+1);
+  201d90:	41 8d 7e 01          	lea    0x1(%r14),%edi
+  201d94:	48 63 ff             	movslq %edi,%rdi
+  201d97:	e8 5a 02 00 00       	call   201ff6 <malloc>
+
+    int word_n = 0;
+    part[0] = buffer;
+  201d9c:	49 89 45 00          	mov    %rax,0x0(%r13)
+    part[s] = NULL;
+  201da0:	4b c7 44 3d f8 00 00 	movq   $0x0,-0x8(%r13,%r15,1)
+  201da7:	00 00 
+    buffer[n] = 0;
+  201da9:	42 c6 04 30 00       	movb   $0x0,(%rax,%r14,1)
+
+    for (int i = 0; i < n; i++) {
+  201dae:	45 85 f6             	test   %r14d,%r14d
+  201db1:	7e 6c                	jle    201e1f <split_string+0xef>
+  201db3:	41 83 ee 01          	sub    $0x1,%r14d
+  201db7:	48 89 da             	mov    %rbx,%rdx
+  201dba:	48 83 c0 01          	add    $0x1,%rax
+  201dbe:	48 89 c1             	mov    %rax,%rcx
+    int word_n = 0;
+  201dc1:	bf 00 00 00 00       	mov    $0x0,%edi
+  201dc6:	eb 23                	jmp    201deb <split_string+0xbb>
+        if (str[i] == sep) {
+            buffer[i] = 0;
+  201dc8:	c6 41 ff 00          	movb   $0x0,-0x1(%rcx)
+            part[++word_n] = &buffer[i+1];
+  201dcc:	83 c7 01             	add    $0x1,%edi
+  201dcf:	48 63 f7             	movslq %edi,%rsi
+  201dd2:	49 89 4c f5 00       	mov    %rcx,0x0(%r13,%rsi,8)
+    for (int i = 0; i < n; i++) {
+  201dd7:	48 83 c2 01          	add    $0x1,%rdx
+  201ddb:	48 83 c1 01          	add    $0x1,%rcx
+  201ddf:	89 ce                	mov    %ecx,%esi
+  201de1:	29 c6                	sub    %eax,%esi
+  201de3:	83 ee 01             	sub    $0x1,%esi
+  201de6:	44 39 f6             	cmp    %r14d,%esi
+  201de9:	7d 34                	jge    201e1f <split_string+0xef>
+        if (str[i] == sep) {
+  201deb:	0f b6 32             	movzbl (%rdx),%esi
+  201dee:	44 38 e6             	cmp    %r12b,%sil
+  201df1:	74 d5                	je     201dc8 <split_string+0x98>
+        } else {
+            buffer[i] = str[i];
+  201df3:	40 88 71 ff          	mov    %sil,-0x1(%rcx)
+  201df7:	eb de                	jmp    201dd7 <split_string+0xa7>
+    char** part = malloc((s+1)*sizeof(char*));
+  201df9:	bf 10 00 00 00       	mov    $0x10,%edi
+  201dfe:	e8 f3 01 00 00       	call   201ff6 <malloc>
+  201e03:	49 89 c5             	mov    %rax,%r13
+    char* buffer = malloc(n+1);
+  201e06:	bf 01 00 00 00       	mov    $0x1,%edi
+  201e0b:	e8 e6 01 00 00       	call   201ff6 <malloc>
+    part[0] = buffer;
+  201e10:	49 89 45 00          	mov    %rax,0x0(%r13)
+    part[s] = NULL;
+  201e14:	49 c7 45 08 00 00 00 	movq   $0x0,0x8(%r13)
+  201e1b:	00 
+    buffer[n] = 0;
+  201e1c:	c6 00 00             	movb   $0x0,(%rax)
+        }
+    }
+
+    return part;
+}
+  201e1f:	4c 89 e8             	mov    %r13,%rax
+  201e22:	48 83 c4 08          	add    $0x8,%rsp
+  201e26:	5b                   	pop    %rbx
+  201e27:	41 5c                	pop    %r12
+  201e29:	41 5d                	pop    %r13
+  201e2b:	41 5e                	pop    %r14
+  201e2d:	41 5f                	pop    %r15
+  201e2f:	5d                   	pop    %rbp
+  201e30:	c3                   	ret
+
+0000000000201e31 <app_print_error>:
+
+
+void app_print_error(int r) {
+  201e31:	55                   	push   %rbp
+  201e32:	48 89 e5             	mov    %rsp,%rbp
+    switch (r) {
+  201e35:	83 ff 24             	cmp    $0x24,%edi
+  201e38:	0f 87 79 01 00 00    	ja     201fb7 <app_print_error+0x186>
+  201e3e:	89 f8                	mov    %edi,%eax
+  201e40:	48 8d 15 1d 05 00 00 	lea    0x51d(%rip),%rdx        # 202364 <lower_digits.0+0x144>
+  201e47:	48 63 04 82          	movslq (%rdx,%rax,4),%rax
+  201e4b:	48 01 d0             	add    %rdx,%rax
+  201e4e:	ff e0                	jmp    *%rax
+        case ENOENT:
+            app_printf(1, "Error: %s\n", "No such file or directory");
+  201e50:	48 8d 15 e5 03 00 00 	lea    0x3e5(%rip),%rdx        # 20223c <lower_digits.0+0x1c>
+  201e57:	48 8d 35 f8 03 00 00 	lea    0x3f8(%rip),%rsi        # 202256 <lower_digits.0+0x36>
+  201e5e:	bf 01 00 00 00       	mov    $0x1,%edi
+  201e63:	b8 00 00 00 00       	mov    $0x0,%eax
+  201e68:	e8 3a fc ff ff       	call   201aa7 <app_printf>
+            break;
+        default:
+            app_printf(1, "Error %d: %s\n", r, "Unknown error");
+            break;
+    }
+}
+  201e6d:	5d                   	pop    %rbp
+  201e6e:	c3                   	ret
+            app_printf(1, "Error: %s\n", "I/O error");
+  201e6f:	48 8d 15 eb 03 00 00 	lea    0x3eb(%rip),%rdx        # 202261 <lower_digits.0+0x41>
+  201e76:	48 8d 35 d9 03 00 00 	lea    0x3d9(%rip),%rsi        # 202256 <lower_digits.0+0x36>
+  201e7d:	bf 01 00 00 00       	mov    $0x1,%edi
+  201e82:	b8 00 00 00 00       	mov    $0x0,%eax
+  201e87:	e8 1b fc ff ff       	call   201aa7 <app_printf>
+            break;
+  201e8c:	eb df                	jmp    201e6d <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Exec format error");
+  201e8e:	48 8d 15 d6 03 00 00 	lea    0x3d6(%rip),%rdx        # 20226b <lower_digits.0+0x4b>
+  201e95:	48 8d 35 ba 03 00 00 	lea    0x3ba(%rip),%rsi        # 202256 <lower_digits.0+0x36>
+  201e9c:	bf 01 00 00 00       	mov    $0x1,%edi
+  201ea1:	b8 00 00 00 00       	mov    $0x0,%eax
+  201ea6:	e8 fc fb ff ff       	call   201aa7 <app_printf>
+            break;
+  201eab:	eb c0                	jmp    201e6d <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Resource temporarily unavailable");
+  201ead:	48 8d 15 8c 04 00 00 	lea    0x48c(%rip),%rdx        # 202340 <lower_digits.0+0x120>
+  201eb4:	48 8d 35 9b 03 00 00 	lea    0x39b(%rip),%rsi        # 202256 <lower_digits.0+0x36>
+  201ebb:	bf 01 00 00 00       	mov    $0x1,%edi
+  201ec0:	b8 00 00 00 00       	mov    $0x0,%eax
+  201ec5:	e8 dd fb ff ff       	call   201aa7 <app_printf>
+            break;
+  201eca:	eb a1                	jmp    201e6d <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Out of memory");
+  201ecc:	48 8d 15 aa 03 00 00 	lea    0x3aa(%rip),%rdx        # 20227d <lower_digits.0+0x5d>
+  201ed3:	48 8d 35 7c 03 00 00 	lea    0x37c(%rip),%rsi        # 202256 <lower_digits.0+0x36>
+  201eda:	bf 01 00 00 00       	mov    $0x1,%edi
+  201edf:	b8 00 00 00 00       	mov    $0x0,%eax
+  201ee4:	e8 be fb ff ff       	call   201aa7 <app_printf>
+            break;
+  201ee9:	eb 82                	jmp    201e6d <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Bad address");
+  201eeb:	48 8d 15 99 03 00 00 	lea    0x399(%rip),%rdx        # 20228b <lower_digits.0+0x6b>
+  201ef2:	48 8d 35 5d 03 00 00 	lea    0x35d(%rip),%rsi        # 202256 <lower_digits.0+0x36>
+  201ef9:	bf 01 00 00 00       	mov    $0x1,%edi
+  201efe:	b8 00 00 00 00       	mov    $0x0,%eax
+  201f03:	e8 9f fb ff ff       	call   201aa7 <app_printf>
+            break;
+  201f08:	e9 60 ff ff ff       	jmp    201e6d <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Not a directory");
+  201f0d:	48 8d 15 83 03 00 00 	lea    0x383(%rip),%rdx        # 202297 <lower_digits.0+0x77>
+  201f14:	48 8d 35 3b 03 00 00 	lea    0x33b(%rip),%rsi        # 202256 <lower_digits.0+0x36>
+  201f1b:	bf 01 00 00 00       	mov    $0x1,%edi
+  201f20:	b8 00 00 00 00       	mov    $0x0,%eax
+  201f25:	e8 7d fb ff ff       	call   201aa7 <app_printf>
+            break;
+  201f2a:	e9 3e ff ff ff       	jmp    201e6d <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Invalid argument");
+  201f2f:	48 8d 15 71 03 00 00 	lea    0x371(%rip),%rdx        # 2022a7 <lower_digits.0+0x87>
+  201f36:	48 8d 35 19 03 00 00 	lea    0x319(%rip),%rsi        # 202256 <lower_digits.0+0x36>
+  201f3d:	bf 01 00 00 00       	mov    $0x1,%edi
+  201f42:	b8 00 00 00 00       	mov    $0x0,%eax
+  201f47:	e8 5b fb ff ff       	call   201aa7 <app_printf>
+            break;
+  201f4c:	e9 1c ff ff ff       	jmp    201e6d <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "No space left on device");
+  201f51:	48 8d 15 60 03 00 00 	lea    0x360(%rip),%rdx        # 2022b8 <lower_digits.0+0x98>
+  201f58:	48 8d 35 f7 02 00 00 	lea    0x2f7(%rip),%rsi        # 202256 <lower_digits.0+0x36>
+  201f5f:	bf 01 00 00 00       	mov    $0x1,%edi
+  201f64:	b8 00 00 00 00       	mov    $0x0,%eax
+  201f69:	e8 39 fb ff ff       	call   201aa7 <app_printf>
+            break;
+  201f6e:	e9 fa fe ff ff       	jmp    201e6d <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "File already exists");
+  201f73:	48 8d 15 56 03 00 00 	lea    0x356(%rip),%rdx        # 2022d0 <lower_digits.0+0xb0>
+  201f7a:	48 8d 35 d5 02 00 00 	lea    0x2d5(%rip),%rsi        # 202256 <lower_digits.0+0x36>
+  201f81:	bf 01 00 00 00       	mov    $0x1,%edi
+  201f86:	b8 00 00 00 00       	mov    $0x0,%eax
+  201f8b:	e8 17 fb ff ff       	call   201aa7 <app_printf>
+            break;
+  201f90:	e9 d8 fe ff ff       	jmp    201e6d <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "File name too long");
+  201f95:	48 8d 15 48 03 00 00 	lea    0x348(%rip),%rdx        # 2022e4 <lower_digits.0+0xc4>
+  201f9c:	48 8d 35 b3 02 00 00 	lea    0x2b3(%rip),%rsi        # 202256 <lower_digits.0+0x36>
+  201fa3:	bf 01 00 00 00       	mov    $0x1,%edi
+  201fa8:	b8 00 00 00 00       	mov    $0x0,%eax
+  201fad:	e8 f5 fa ff ff       	call   201aa7 <app_printf>
+            break;
+  201fb2:	e9 b6 fe ff ff       	jmp    201e6d <app_print_error+0x3c>
+            app_printf(1, "Error %d: %s\n", r, "Unknown error");
+  201fb7:	48 8d 0d 39 03 00 00 	lea    0x339(%rip),%rcx        # 2022f7 <lower_digits.0+0xd7>
+  201fbe:	89 fa                	mov    %edi,%edx
+  201fc0:	48 8d 35 3e 03 00 00 	lea    0x33e(%rip),%rsi        # 202305 <lower_digits.0+0xe5>
+  201fc7:	bf 01 00 00 00       	mov    $0x1,%edi
+  201fcc:	b8 00 00 00 00       	mov    $0x0,%eax
+  201fd1:	e8 d1 fa ff ff       	call   201aa7 <app_printf>
+}
+  201fd6:	e9 92 fe ff ff       	jmp    201e6d <app_print_error+0x3c>
+
+0000000000201fdb <handle_error>:
+
+__attribute__((noreturn)) void handle_error(int r) {
+  201fdb:	55                   	push   %rbp
+  201fdc:	48 89 e5             	mov    %rsp,%rbp
+  201fdf:	53                   	push   %rbx
+  201fe0:	48 83 ec 08          	sub    $0x8,%rsp
+  201fe4:	89 fb                	mov    %edi,%ebx
+    app_print_error(r);
+  201fe6:	e8 46 fe ff ff       	call   201e31 <app_print_error>
+    asm volatile ("syscall" : "=a" (rax)
+  201feb:	b8 40 00 00 00       	mov    $0x40,%eax
+  201ff0:	89 df                	mov    %ebx,%edi
+  201ff2:	0f 05                	syscall
+ spinloop: goto spinloop;       // should never get here
+  201ff4:	eb fe                	jmp    201ff4 <handle_error+0x19>
+
+0000000000201ff6 <malloc>:
+
+// The heap starts 1MB above the program image (PROC_START_ADDR)
+static uint8_t* heap_top = (uint8_t*) 0x300000;
+static uint8_t* page_top = (uint8_t*) 0x300000;
+
+void* malloc(size_t size) {
+  201ff6:	48 89 fe             	mov    %rdi,%rsi
+    while (ROUNDDOWN(heap_top + size, PAGESIZE) >= page_top) {
+  201ff9:	48 8b 05 10 10 00 00 	mov    0x1010(%rip),%rax        # 203010 <heap_top>
+  202000:	48 8d 14 38          	lea    (%rax,%rdi,1),%rdx
+  202004:	48 8b 3d fd 0f 00 00 	mov    0xffd(%rip),%rdi        # 203008 <page_top>
+  20200b:	48 89 d1             	mov    %rdx,%rcx
+  20200e:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  202015:	48 39 f9             	cmp    %rdi,%rcx
+  202018:	72 3e                	jb     202058 <malloc+0x62>
+    asm volatile ("syscall" : "=a" (result)
+  20201a:	41 b8 3b 00 00 00    	mov    $0x3b,%r8d
+  202020:	44 89 c0             	mov    %r8d,%eax
+  202023:	0f 05                	syscall
+        int r = sys_page_alloc(page_top);
+        assert(r >= 0);
+  202025:	85 c0                	test   %eax,%eax
+  202027:	78 37                	js     202060 <malloc+0x6a>
+        page_top += PAGESIZE;
+  202029:	48 8b 05 d8 0f 00 00 	mov    0xfd8(%rip),%rax        # 203008 <page_top>
+  202030:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  202037:	48 89 3d ca 0f 00 00 	mov    %rdi,0xfca(%rip)        # 203008 <page_top>
+    while (ROUNDDOWN(heap_top + size, PAGESIZE) >= page_top) {
+  20203e:	48 8b 05 cb 0f 00 00 	mov    0xfcb(%rip),%rax        # 203010 <heap_top>
+  202045:	48 8d 14 30          	lea    (%rax,%rsi,1),%rdx
+  202049:	48 89 d1             	mov    %rdx,%rcx
+  20204c:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  202053:	48 39 f9             	cmp    %rdi,%rcx
+  202056:	73 c8                	jae    202020 <malloc+0x2a>
+    }
+
+    void* addr = heap_top;
+    heap_top += size;
+  202058:	48 89 15 b1 0f 00 00 	mov    %rdx,0xfb1(%rip)        # 203010 <heap_top>
+    return addr;
+}
+  20205f:	c3                   	ret
+void* malloc(size_t size) {
+  202060:	55                   	push   %rbp
+  202061:	48 89 e5             	mov    %rsp,%rbp
+        assert(r >= 0);
+  202064:	48 8d 15 92 03 00 00 	lea    0x392(%rip),%rdx        # 2023fd <col.0+0x5>
+  20206b:	be 0b 00 00 00       	mov    $0xb,%esi
+  202070:	48 8d 3d 8d 03 00 00 	lea    0x38d(%rip),%rdi        # 202404 <col.0+0xc>
+  202077:	e8 b0 fb ff ff       	call   201c2c <assert_fail>
@@ -0,0 +1,3301 @@
+
+obj/p-rm.full:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000200000 <usage>:
+const char *usage_str =
+    "Usage: rm [FILE]\n"
+    "Remove a file.\n";
+
+
+void __attribute__((noreturn)) usage(void) {
+  200000:	55                   	push   %rbp
+  200001:	48 89 e5             	mov    %rsp,%rbp
+    app_printf(1, "%s", usage_str);
+  200004:	48 8b 15 f5 2f 00 00 	mov    0x2ff5(%rip),%rdx        # 203000 <usage_str>
+  20000b:	48 8d 35 3e 20 00 00 	lea    0x203e(%rip),%rsi        # 202050 <malloc+0x8e>
+  200012:	bf 01 00 00 00       	mov    $0x1,%edi
+  200017:	b8 00 00 00 00       	mov    $0x0,%eax
+  20001c:	e8 52 1a 00 00       	call   201a73 <app_printf>
+// sys_exit()
+//    Exit this process. Does not return.
+static inline void sys_exit(int exit_code) __attribute__((noreturn));
+static inline void sys_exit(int exit_code) {
+    uint64_t rax;
+    asm volatile ("syscall" : "=a" (rax)
+  200021:	b8 40 00 00 00       	mov    $0x40,%eax
+  200026:	bf 01 00 00 00       	mov    $0x1,%edi
+  20002b:	0f 05                	syscall
+                  : "a" (INT_SYS_EXIT), "D" /* %rdi */ (exit_code)
+                  : "rcx", "r11", "cc", "memory");
+ spinloop: goto spinloop;       // should never get here
+  20002d:	eb fe                	jmp    20002d <usage+0x2d>
+
+000000000020002f <process_main>:
+    sys_exit(1);
+}
+
+
+void process_main(int argc, char* argv[]) {
+  20002f:	55                   	push   %rbp
+  200030:	48 89 e5             	mov    %rsp,%rbp
+    if (argc <= 1) {
+  200033:	83 ff 01             	cmp    $0x1,%edi
+  200036:	7e 1d                	jle    200055 <process_main+0x26>
+    asm volatile ("syscall" : "=a" (result)
+  200038:	48 8b 7e 08          	mov    0x8(%rsi),%rdi
+  20003c:	b8 48 00 00 00       	mov    $0x48,%eax
+  200041:	0f 05                	syscall
+        usage();
+    }
+
+    int r = sys_remove(argv[1]);
+    assert(r == 0);
+  200043:	85 c0                	test   %eax,%eax
+  200045:	75 13                	jne    20005a <process_main+0x2b>
+    asm volatile ("syscall" : "=a" (rax)
+  200047:	b8 40 00 00 00       	mov    $0x40,%eax
+  20004c:	bf 00 00 00 00       	mov    $0x0,%edi
+  200051:	0f 05                	syscall
+ spinloop: goto spinloop;       // should never get here
+  200053:	eb fe                	jmp    200053 <process_main+0x24>
+        usage();
+  200055:	e8 a6 ff ff ff       	call   200000 <usage>
+    assert(r == 0);
+  20005a:	48 8d 15 f2 1f 00 00 	lea    0x1ff2(%rip),%rdx        # 202053 <malloc+0x91>
+  200061:	be 16 00 00 00       	mov    $0x16,%esi
+  200066:	48 8d 3d ed 1f 00 00 	lea    0x1fed(%rip),%rdi        # 20205a <malloc+0x98>
+  20006d:	e8 86 1b 00 00       	call   201bf8 <assert_fail>
+
+0000000000200072 <vdso>:
+// KERNEL DATA PAGE
+//
+//    The kernel keeps a read-only vdso_data (see lib.h) up to date at
+//    VDSO_ADDR. Reading it is a plain memory load, not a system call.
+
+static inline const volatile vdso_data* vdso(void) {
+  200072:	55                   	push   %rbp
+  200073:	48 89 e5             	mov    %rsp,%rbp
+    return (const volatile vdso_data*) VDSO_ADDR;
+  200076:	b8 00 10 24 00       	mov    $0x241000,%eax
+}
+  20007b:	5d                   	pop    %rbp
+  20007c:	c3                   	ret
+
+000000000020007d <memcpy>:
+#define MEMOP_WORD_MIN 64
+
+// an unaligned word that may alias any object
+typedef uint64_t __attribute__((may_alias, aligned(1))) memop_word;
+
+void* memcpy(void* dst, const void* src, size_t n) {
+  20007d:	55                   	push   %rbp
+  20007e:	48 89 e5             	mov    %rsp,%rbp
+  200081:	48 83 ec 48          	sub    $0x48,%rsp
+  200085:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  200089:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  20008d:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+    char* d = (char*) dst;
+  200091:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200095:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    const char* s = (const char*) src;
+  200099:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  20009d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (n >= MEMOP_WORD_MIN) {
+  2000a1:	48 83 7d b8 3f       	cmpq   $0x3f,-0x48(%rbp)
+  2000a6:	0f 86 c5 00 00 00    	jbe    200171 <memcpy+0xf4>
+        size_t head = -(uintptr_t) d & 7;
+  2000ac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2000b0:	48 f7 d8             	neg    %rax
+  2000b3:	83 e0 07             	and    $0x7,%eax
+  2000b6:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        size_t words = (n - head) / 8;
+  2000ba:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  2000be:	48 2b 45 e8          	sub    -0x18(%rbp),%rax
+  2000c2:	48 c1 e8 03          	shr    $0x3,%rax
+  2000c6:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+        n = (n - head) % 8;
+  2000ca:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  2000ce:	48 2b 45 e8          	sub    -0x18(%rbp),%rax
+  2000d2:	83 e0 07             	and    $0x7,%eax
+  2000d5:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        asm volatile("rep movsb" : "+D" (d), "+S" (s), "+c" (head)
+  2000d9:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  2000dd:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  2000e1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2000e5:	48 89 cf             	mov    %rcx,%rdi
+  2000e8:	48 89 d6             	mov    %rdx,%rsi
+  2000eb:	48 89 c1             	mov    %rax,%rcx
+  2000ee:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  2000f0:	48 89 c8             	mov    %rcx,%rax
+  2000f3:	48 89 f2             	mov    %rsi,%rdx
+  2000f6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  2000fa:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  2000fe:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                     : : "memory");
+        asm volatile("rep movsq" : "+D" (d), "+S" (s), "+c" (words)
+  200102:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  200106:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  20010a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  20010e:	48 89 cf             	mov    %rcx,%rdi
+  200111:	48 89 d6             	mov    %rdx,%rsi
+  200114:	48 89 c1             	mov    %rax,%rcx
+  200117:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  20011a:	48 89 c8             	mov    %rcx,%rax
+  20011d:	48 89 f2             	mov    %rsi,%rdx
+  200120:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  200124:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  200128:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+                     : : "memory");
+    }
+    for (; n >= 16; n -= 16, s += 16, d += 16) {
+  20012c:	eb 43                	jmp    200171 <memcpy+0xf4>
+        memop_word a = ((const memop_word*) s)[0];
+  20012e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  200132:	48 8b 00             	mov    (%rax),%rax
+  200135:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+        memop_word b = ((const memop_word*) s)[1];
+  200139:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  20013d:	48 83 c0 08          	add    $0x8,%rax
+  200141:	48 8b 00             	mov    (%rax),%rax
+  200144:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+        ((memop_word*) d)[0] = a;
+  200148:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20014c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  200150:	48 89 10             	mov    %rdx,(%rax)
+        ((memop_word*) d)[1] = b;
+  200153:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200157:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  20015b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  20015f:	48 89 02             	mov    %rax,(%rdx)
+    for (; n >= 16; n -= 16, s += 16, d += 16) {
+  200162:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  200167:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  20016c:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  200171:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  200176:	77 b6                	ja     20012e <memcpy+0xb1>
+    }
+    for (; n > 0; --n, ++s, ++d) {
+  200178:	eb 1c                	jmp    200196 <memcpy+0x119>
+        *d = *s;
+  20017a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  20017e:	0f b6 10             	movzbl (%rax),%edx
+  200181:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200185:	88 10                	mov    %dl,(%rax)
+    for (; n > 0; --n, ++s, ++d) {
+  200187:	48 83 6d b8 01       	subq   $0x1,-0x48(%rbp)
+  20018c:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  200191:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  200196:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  20019b:	75 dd                	jne    20017a <memcpy+0xfd>
+    }
+    return dst;
+  20019d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  2001a1:	c9                   	leave
+  2001a2:	c3                   	ret
+
+00000000002001a3 <memmove>:
+
+void* memmove(void* dst, const void* src, size_t n) {
+  2001a3:	55                   	push   %rbp
+  2001a4:	48 89 e5             	mov    %rsp,%rbp
+  2001a7:	48 83 ec 38          	sub    $0x38,%rsp
+  2001ab:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  2001af:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  2001b3:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    const char* s = (const char*) src;
+  2001b7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  2001bb:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    char* d = (char*) dst;
+  2001bf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  2001c3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (!(s < d && s + n > d)) {
+  2001c7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2001cb:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  2001cf:	73 11                	jae    2001e2 <memmove+0x3f>
+  2001d1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  2001d5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  2001d9:	48 01 d0             	add    %rdx,%rax
+  2001dc:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  2001e0:	72 1c                	jb     2001fe <memmove+0x5b>
+        // a forward copy never overwrites source bytes it has yet to read
+        return memcpy(dst, src, n);
+  2001e2:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  2001e6:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  2001ea:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  2001ee:	48 89 ce             	mov    %rcx,%rsi
+  2001f1:	48 89 c7             	mov    %rax,%rdi
+  2001f4:	e8 84 fe ff ff       	call   20007d <memcpy>
+  2001f9:	e9 94 00 00 00       	jmp    200292 <memmove+0xef>
+    }
+
+    // copy backwards: the tail bytes, then words down to the start
+    size_t words = n / 8;
+  2001fe:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200202:	48 c1 e8 03          	shr    $0x3,%rax
+  200206:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    size_t tail = n % 8;
+  20020a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  20020e:	83 e0 07             	and    $0x7,%eax
+  200211:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    s += n - 1, d += n - 1;
+  200215:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200219:	48 83 e8 01          	sub    $0x1,%rax
+  20021d:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  200221:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200225:	48 83 e8 01          	sub    $0x1,%rax
+  200229:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    asm volatile("std; rep movsb; cld" : "+D" (d), "+S" (s), "+c" (tail)
+  20022d:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  200231:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  200235:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  200239:	48 89 cf             	mov    %rcx,%rdi
+  20023c:	48 89 d6             	mov    %rdx,%rsi
+  20023f:	48 89 c1             	mov    %rax,%rcx
+  200242:	fd                   	std
+  200243:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  200245:	fc                   	cld
+  200246:	48 89 c8             	mov    %rcx,%rax
+  200249:	48 89 f2             	mov    %rsi,%rdx
+  20024c:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  200250:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  200254:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+                 : : "memory", "cc");
+    s -= 7, d -= 7;
+  200258:	48 83 6d f8 07       	subq   $0x7,-0x8(%rbp)
+  20025d:	48 83 6d f0 07       	subq   $0x7,-0x10(%rbp)
+    asm volatile("std; rep movsq; cld" : "+D" (d), "+S" (s), "+c" (words)
+  200262:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  200266:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  20026a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20026e:	48 89 cf             	mov    %rcx,%rdi
+  200271:	48 89 d6             	mov    %rdx,%rsi
+  200274:	48 89 c1             	mov    %rax,%rcx
+  200277:	fd                   	std
+  200278:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  20027b:	fc                   	cld
+  20027c:	48 89 c8             	mov    %rcx,%rax
+  20027f:	48 89 f2             	mov    %rsi,%rdx
+  200282:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  200286:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  20028a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 : : "memory", "cc");
+    return dst;
+  20028e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  200292:	c9                   	leave
+  200293:	c3                   	ret
+
+0000000000200294 <memset>:
+
+void* memset(void* v, int c, size_t n) {
+  200294:	55                   	push   %rbp
+  200295:	48 89 e5             	mov    %rsp,%rbp
+  200298:	48 83 ec 38          	sub    $0x38,%rsp
+  20029c:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  2002a0:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  2002a3:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    char* p = (char*) v;
+  2002a7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  2002ab:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    uint64_t word = (uint8_t) c * 0x0101010101010101UL;
+  2002af:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  2002b2:	0f b6 c0             	movzbl %al,%eax
+  2002b5:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  2002bc:	01 01 01 
+  2002bf:	48 0f af c2          	imul   %rdx,%rax
+  2002c3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (n >= MEMOP_WORD_MIN) {
+  2002c7:	48 83 7d c8 3f       	cmpq   $0x3f,-0x38(%rbp)
+  2002cc:	0f 86 9e 00 00 00    	jbe    200370 <memset+0xdc>
+        size_t head = -(uintptr_t) p & 7;
+  2002d2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2002d6:	48 f7 d8             	neg    %rax
+  2002d9:	83 e0 07             	and    $0x7,%eax
+  2002dc:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        size_t words = (n - head) / 8;
+  2002e0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  2002e4:	48 2b 45 e8          	sub    -0x18(%rbp),%rax
+  2002e8:	48 c1 e8 03          	shr    $0x3,%rax
+  2002ec:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+        n = (n - head) % 8;
+  2002f0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  2002f4:	48 2b 45 e8          	sub    -0x18(%rbp),%rax
+  2002f8:	83 e0 07             	and    $0x7,%eax
+  2002fb:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        asm volatile("rep stosb" : "+D" (p), "+c" (head) : "a" (word)
+  2002ff:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  200303:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  200307:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  20030b:	48 89 ce             	mov    %rcx,%rsi
+  20030e:	48 89 f7             	mov    %rsi,%rdi
+  200311:	48 89 d1             	mov    %rdx,%rcx
+  200314:	f3 aa                	rep stos %al,%es:(%rdi)
+  200316:	48 89 ca             	mov    %rcx,%rdx
+  200319:	48 89 fe             	mov    %rdi,%rsi
+  20031c:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  200320:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+                     : "memory");
+        asm volatile("rep stosq" : "+D" (p), "+c" (words) : "a" (word)
+  200324:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  200328:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  20032c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  200330:	48 89 ce             	mov    %rcx,%rsi
+  200333:	48 89 f7             	mov    %rsi,%rdi
+  200336:	48 89 d1             	mov    %rdx,%rcx
+  200339:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  20033c:	48 89 ca             	mov    %rcx,%rdx
+  20033f:	48 89 fe             	mov    %rdi,%rsi
+  200342:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  200346:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+                     : "memory");
+    }
+    for (; n >= 16; n -= 16, p += 16) {
+  20034a:	eb 24                	jmp    200370 <memset+0xdc>
+        ((memop_word*) p)[0] = word;
+  20034c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200350:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  200354:	48 89 10             	mov    %rdx,(%rax)
+        ((memop_word*) p)[1] = word;
+  200357:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20035b:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  20035f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  200363:	48 89 02             	mov    %rax,(%rdx)
+    for (; n >= 16; n -= 16, p += 16) {
+  200366:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  20036b:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  200370:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  200375:	77 d5                	ja     20034c <memset+0xb8>
+    }
+    for (; n > 0; ++p, --n) {
+  200377:	eb 15                	jmp    20038e <memset+0xfa>
+        *p = c;
+  200379:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  20037c:	89 c2                	mov    %eax,%edx
+  20037e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200382:	88 10                	mov    %dl,(%rax)
+    for (; n > 0; ++p, --n) {
+  200384:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  200389:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  20038e:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  200393:	75 e4                	jne    200379 <memset+0xe5>
+    }
+    return v;
+  200395:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  200399:	c9                   	leave
+  20039a:	c3                   	ret
+
+000000000020039b <strlen>:
+
+size_t strlen(const char* s) {
+  20039b:	55                   	push   %rbp
+  20039c:	48 89 e5             	mov    %rsp,%rbp
+  20039f:	48 83 ec 18          	sub    $0x18,%rsp
+  2003a3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    size_t n;
+    for (n = 0; *s != '\0'; ++s) {
+  2003a7:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  2003ae:	00 
+  2003af:	eb 0a                	jmp    2003bb <strlen+0x20>
+        ++n;
+  2003b1:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    for (n = 0; *s != '\0'; ++s) {
+  2003b6:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  2003bb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2003bf:	0f b6 00             	movzbl (%rax),%eax
+  2003c2:	84 c0                	test   %al,%al
+  2003c4:	75 eb                	jne    2003b1 <strlen+0x16>
+    }
+    return n;
+  2003c6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  2003ca:	c9                   	leave
+  2003cb:	c3                   	ret
+
+00000000002003cc <strnlen>:
+
+size_t strnlen(const char* s, size_t maxlen) {
+  2003cc:	55                   	push   %rbp
+  2003cd:	48 89 e5             	mov    %rsp,%rbp
+  2003d0:	48 83 ec 20          	sub    $0x20,%rsp
+  2003d4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  2003d8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    size_t n;
+    for (n = 0; n != maxlen && *s != '\0'; ++s) {
+  2003dc:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  2003e3:	00 
+  2003e4:	eb 0a                	jmp    2003f0 <strnlen+0x24>
+        ++n;
+  2003e6:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    for (n = 0; n != maxlen && *s != '\0'; ++s) {
+  2003eb:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  2003f0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2003f4:	48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+  2003f8:	74 0b                	je     200405 <strnlen+0x39>
+  2003fa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2003fe:	0f b6 00             	movzbl (%rax),%eax
+  200401:	84 c0                	test   %al,%al
+  200403:	75 e1                	jne    2003e6 <strnlen+0x1a>
+    }
+    return n;
+  200405:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  200409:	c9                   	leave
+  20040a:	c3                   	ret
+
+000000000020040b <strcpy>:
+
+char* strcpy(char* dst, const char* src) {
+  20040b:	55                   	push   %rbp
+  20040c:	48 89 e5             	mov    %rsp,%rbp
+  20040f:	48 83 ec 20          	sub    $0x20,%rsp
+  200413:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  200417:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    char* d = dst;
+  20041b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20041f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    do {
+        *d++ = *src++;
+  200423:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  200427:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  20042b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  20042f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200433:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  200437:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+  20043b:	0f b6 12             	movzbl (%rdx),%edx
+  20043e:	88 10                	mov    %dl,(%rax)
+    } while (d[-1]);
+  200440:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200444:	48 83 e8 01          	sub    $0x1,%rax
+  200448:	0f b6 00             	movzbl (%rax),%eax
+  20044b:	84 c0                	test   %al,%al
+  20044d:	75 d4                	jne    200423 <strcpy+0x18>
+    return dst;
+  20044f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  200453:	c9                   	leave
+  200454:	c3                   	ret
+
+0000000000200455 <strcmp>:
+
+int strcmp(const char* a, const char* b) {
+  200455:	55                   	push   %rbp
+  200456:	48 89 e5             	mov    %rsp,%rbp
+  200459:	48 83 ec 10          	sub    $0x10,%rsp
+  20045d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  200461:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    while (*a && *b && *a == *b) {
+  200465:	eb 0a                	jmp    200471 <strcmp+0x1c>
+        ++a, ++b;
+  200467:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  20046c:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+    while (*a && *b && *a == *b) {
+  200471:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200475:	0f b6 00             	movzbl (%rax),%eax
+  200478:	84 c0                	test   %al,%al
+  20047a:	74 1d                	je     200499 <strcmp+0x44>
+  20047c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  200480:	0f b6 00             	movzbl (%rax),%eax
+  200483:	84 c0                	test   %al,%al
+  200485:	74 12                	je     200499 <strcmp+0x44>
+  200487:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20048b:	0f b6 10             	movzbl (%rax),%edx
+  20048e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  200492:	0f b6 00             	movzbl (%rax),%eax
+  200495:	38 c2                	cmp    %al,%dl
+  200497:	74 ce                	je     200467 <strcmp+0x12>
+    }
+    return ((unsigned char) *a > (unsigned char) *b)
+  200499:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20049d:	0f b6 00             	movzbl (%rax),%eax
+  2004a0:	89 c2                	mov    %eax,%edx
+  2004a2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2004a6:	0f b6 00             	movzbl (%rax),%eax
+  2004a9:	38 d0                	cmp    %dl,%al
+  2004ab:	0f 92 c0             	setb   %al
+  2004ae:	0f b6 d0             	movzbl %al,%edx
+        - ((unsigned char) *a < (unsigned char) *b);
+  2004b1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2004b5:	0f b6 00             	movzbl (%rax),%eax
+  2004b8:	89 c1                	mov    %eax,%ecx
+  2004ba:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2004be:	0f b6 00             	movzbl (%rax),%eax
+  2004c1:	38 c1                	cmp    %al,%cl
+  2004c3:	0f 92 c0             	setb   %al
+  2004c6:	0f b6 c0             	movzbl %al,%eax
+  2004c9:	29 c2                	sub    %eax,%edx
+  2004cb:	89 d0                	mov    %edx,%eax
+}
+  2004cd:	c9                   	leave
+  2004ce:	c3                   	ret
+
+00000000002004cf <strchr>:
+
+char* strchr(const char* s, int c) {
+  2004cf:	55                   	push   %rbp
+  2004d0:	48 89 e5             	mov    %rsp,%rbp
+  2004d3:	48 83 ec 10          	sub    $0x10,%rsp
+  2004d7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  2004db:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    while (*s && *s != (char) c) {
+  2004de:	eb 05                	jmp    2004e5 <strchr+0x16>
+        ++s;
+  2004e0:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    while (*s && *s != (char) c) {
+  2004e5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2004e9:	0f b6 00             	movzbl (%rax),%eax
+  2004ec:	84 c0                	test   %al,%al
+  2004ee:	74 0e                	je     2004fe <strchr+0x2f>
+  2004f0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2004f4:	0f b6 00             	movzbl (%rax),%eax
+  2004f7:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  2004fa:	38 d0                	cmp    %dl,%al
+  2004fc:	75 e2                	jne    2004e0 <strchr+0x11>
+    }
+    if (*s == (char) c) {
+  2004fe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200502:	0f b6 00             	movzbl (%rax),%eax
+  200505:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  200508:	38 d0                	cmp    %dl,%al
+  20050a:	75 06                	jne    200512 <strchr+0x43>
+        return (char*) s;
+  20050c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200510:	eb 05                	jmp    200517 <strchr+0x48>
+    } else {
+        return NULL;
+  200512:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+}
+  200517:	c9                   	leave
+  200518:	c3                   	ret
+
+0000000000200519 <rand>:
+
+// New randomness implementation
+static int      rand_seed_set;
+static unsigned rand_seed;
+
+int rand(void) {
+  200519:	55                   	push   %rbp
+  20051a:	48 89 e5             	mov    %rsp,%rbp
+  20051d:	48 83 ec 10          	sub    $0x10,%rsp
+    if (!rand_seed_set) {
+  200521:	8b 05 f1 2a 00 00    	mov    0x2af1(%rip),%eax        # 203018 <rand_seed_set>
+  200527:	85 c0                	test   %eax,%eax
+  200529:	75 2c                	jne    200557 <rand+0x3e>
+#if WEENSYOS_KERNEL
+        extern unsigned get_entropy_value(void);
+        srand(get_entropy_value());
+#else           // user‑space build
+       /* kernel-refreshed seed from the kernel data page: no system call */
+       srand((unsigned) (vdso()->seed[0] ^ read_cycle_counter()));
+  20052b:	e8 42 fb ff ff       	call   200072 <vdso>
+  200530:	48 8b 40 18          	mov    0x18(%rax),%rax
+  200534:	89 c1                	mov    %eax,%ecx
+    }
+}
+
+static inline uint64_t read_cycle_counter(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+  200536:	0f 31                	rdtsc
+  200538:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  20053b:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    return ((uint64_t) hi << 32) | lo;
+  20053e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  200541:	48 c1 e0 20          	shl    $0x20,%rax
+  200545:	48 89 c2             	mov    %rax,%rdx
+  200548:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  20054b:	48 09 d0             	or     %rdx,%rax
+  20054e:	31 c8                	xor    %ecx,%eax
+  200550:	89 c7                	mov    %eax,%edi
+  200552:	e8 24 00 00 00       	call   20057b <srand>
+#endif
+    }
+    rand_seed = rand_seed * 1664525U + 1013904223U;   // LCG
+  200557:	8b 05 bf 2a 00 00    	mov    0x2abf(%rip),%eax        # 20301c <rand_seed>
+  20055d:	69 c0 0d 66 19 00    	imul   $0x19660d,%eax,%eax
+  200563:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+  200568:	89 05 ae 2a 00 00    	mov    %eax,0x2aae(%rip)        # 20301c <rand_seed>
+    return rand_seed & RAND_MAX;
+  20056e:	8b 05 a8 2a 00 00    	mov    0x2aa8(%rip),%eax        # 20301c <rand_seed>
+  200574:	25 ff ff ff 7f       	and    $0x7fffffff,%eax
+}
+  200579:	c9                   	leave
+  20057a:	c3                   	ret
+
+000000000020057b <srand>:
+
+void srand(unsigned seed) {
+  20057b:	55                   	push   %rbp
+  20057c:	48 89 e5             	mov    %rsp,%rbp
+  20057f:	48 83 ec 08          	sub    $0x8,%rsp
+  200583:	89 7d fc             	mov    %edi,-0x4(%rbp)
+    rand_seed      = seed;
+  200586:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  200589:	89 05 8d 2a 00 00    	mov    %eax,0x2a8d(%rip)        # 20301c <rand_seed>
+    rand_seed_set  = 1;
+  20058f:	c7 05 7f 2a 00 00 01 	movl   $0x1,0x2a7f(%rip)        # 203018 <rand_seed_set>
+  200596:	00 00 00 
+}
+  200599:	90                   	nop
+  20059a:	c9                   	leave
+  20059b:	c3                   	ret
+
+000000000020059c <fill_numbuf>:
+//    Print a message onto the console, starting at the given cursor position.
+
+// snprintf, vsnprintf
+//    Format a string into a buffer.
+
+static char* fill_numbuf(char* numbuf_end, unsigned long val, int base) {
+  20059c:	55                   	push   %rbp
+  20059d:	48 89 e5             	mov    %rsp,%rbp
+  2005a0:	48 83 ec 28          	sub    $0x28,%rsp
+  2005a4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  2005a8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  2005ac:	89 55 dc             	mov    %edx,-0x24(%rbp)
+    static const char upper_digits[] = "0123456789ABCDEF";
+    static const char lower_digits[] = "0123456789abcdef";
+
+    const char* digits = upper_digits;
+  2005af:	48 8d 05 3a 1c 00 00 	lea    0x1c3a(%rip),%rax        # 2021f0 <upper_digits.1>
+  2005b6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (base < 0) {
+  2005ba:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  2005be:	79 0e                	jns    2005ce <fill_numbuf+0x32>
+        digits = lower_digits;
+  2005c0:	48 8d 05 49 1c 00 00 	lea    0x1c49(%rip),%rax        # 202210 <lower_digits.0>
+  2005c7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+        base = -base;
+  2005cb:	f7 5d dc             	negl   -0x24(%rbp)
+    }
+
+    *--numbuf_end = '\0';
+  2005ce:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  2005d3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2005d7:	c6 00 00             	movb   $0x0,(%rax)
+    do {
+        *--numbuf_end = digits[val % base];
+  2005da:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  2005dd:	48 63 c8             	movslq %eax,%rcx
+  2005e0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  2005e4:	ba 00 00 00 00       	mov    $0x0,%edx
+  2005e9:	48 f7 f1             	div    %rcx
+  2005ec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2005f0:	48 01 d0             	add    %rdx,%rax
+  2005f3:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  2005f8:	0f b6 10             	movzbl (%rax),%edx
+  2005fb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2005ff:	88 10                	mov    %dl,(%rax)
+        val /= base;
+  200601:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  200604:	48 63 f0             	movslq %eax,%rsi
+  200607:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  20060b:	ba 00 00 00 00       	mov    $0x0,%edx
+  200610:	48 f7 f6             	div    %rsi
+  200613:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    } while (val != 0);
+  200617:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  20061c:	75 bc                	jne    2005da <fill_numbuf+0x3e>
+    return numbuf_end;
+  20061e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  200622:	c9                   	leave
+  200623:	c3                   	ret
+
+0000000000200624 <printer_vprintf>:
+#define FLAG_NUMERIC            (1<<5)
+#define FLAG_SIGNED             (1<<6)
+#define FLAG_NEGATIVE           (1<<7)
+#define FLAG_ALT2               (1<<8)
+
+void printer_vprintf(printer* p, int color, const char* format, va_list val) {
+  200624:	55                   	push   %rbp
+  200625:	48 89 e5             	mov    %rsp,%rbp
+  200628:	53                   	push   %rbx
+  200629:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  200630:	48 89 bd 78 ff ff ff 	mov    %rdi,-0x88(%rbp)
+  200637:	89 b5 74 ff ff ff    	mov    %esi,-0x8c(%rbp)
+  20063d:	48 89 95 68 ff ff ff 	mov    %rdx,-0x98(%rbp)
+  200644:	48 89 8d 60 ff ff ff 	mov    %rcx,-0xa0(%rbp)
+#define NUMBUFSIZ 24
+    char numbuf[NUMBUFSIZ];
+
+    for (; *format; ++format) {
+  20064b:	e9 be 09 00 00       	jmp    20100e <printer_vprintf+0x9ea>
+        if (*format != '%') {
+  200650:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200657:	0f b6 00             	movzbl (%rax),%eax
+  20065a:	3c 25                	cmp    $0x25,%al
+  20065c:	74 31                	je     20068f <printer_vprintf+0x6b>
+            p->putc(p, *format, color);
+  20065e:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200665:	4c 8b 00             	mov    (%rax),%r8
+  200668:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  20066f:	0f b6 00             	movzbl (%rax),%eax
+  200672:	0f b6 c8             	movzbl %al,%ecx
+  200675:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  20067b:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200682:	89 ce                	mov    %ecx,%esi
+  200684:	48 89 c7             	mov    %rax,%rdi
+  200687:	41 ff d0             	call   *%r8
+            continue;
+  20068a:	e9 77 09 00 00       	jmp    201006 <printer_vprintf+0x9e2>
+        }
+
+        // process flags
+        int flags = 0;
+  20068f:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+        for (++format; *format; ++format) {
+  200696:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  20069d:	01 
+  20069e:	eb 4f                	jmp    2006ef <printer_vprintf+0xcb>
+            const char* flagc = strchr(flag_chars, *format);
+  2006a0:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  2006a7:	0f b6 00             	movzbl (%rax),%eax
+  2006aa:	0f be c0             	movsbl %al,%eax
+  2006ad:	89 c6                	mov    %eax,%esi
+  2006af:	48 8d 05 ea 19 00 00 	lea    0x19ea(%rip),%rax        # 2020a0 <flag_chars>
+  2006b6:	48 89 c7             	mov    %rax,%rdi
+  2006b9:	e8 11 fe ff ff       	call   2004cf <strchr>
+  2006be:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (flagc) {
+  2006c2:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  2006c7:	74 36                	je     2006ff <printer_vprintf+0xdb>
+                flags |= 1 << (flagc - flag_chars);
+  2006c9:	48 8d 05 d0 19 00 00 	lea    0x19d0(%rip),%rax        # 2020a0 <flag_chars>
+  2006d0:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  2006d4:	48 29 c2             	sub    %rax,%rdx
+  2006d7:	89 d0                	mov    %edx,%eax
+  2006d9:	ba 01 00 00 00       	mov    $0x1,%edx
+  2006de:	89 c1                	mov    %eax,%ecx
+  2006e0:	d3 e2                	shl    %cl,%edx
+  2006e2:	89 d0                	mov    %edx,%eax
+  2006e4:	09 45 ec             	or     %eax,-0x14(%rbp)
+        for (++format; *format; ++format) {
+  2006e7:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  2006ee:	01 
+  2006ef:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  2006f6:	0f b6 00             	movzbl (%rax),%eax
+  2006f9:	84 c0                	test   %al,%al
+  2006fb:	75 a3                	jne    2006a0 <printer_vprintf+0x7c>
+  2006fd:	eb 01                	jmp    200700 <printer_vprintf+0xdc>
+            } else {
+                break;
+  2006ff:	90                   	nop
+            }
+        }
+
+        // process width
+        int width = -1;
+  200700:	c7 45 e8 ff ff ff ff 	movl   $0xffffffff,-0x18(%rbp)
+        if (*format >= '1' && *format <= '9') {
+  200707:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  20070e:	0f b6 00             	movzbl (%rax),%eax
+  200711:	3c 30                	cmp    $0x30,%al
+  200713:	7e 67                	jle    20077c <printer_vprintf+0x158>
+  200715:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  20071c:	0f b6 00             	movzbl (%rax),%eax
+  20071f:	3c 39                	cmp    $0x39,%al
+  200721:	7f 59                	jg     20077c <printer_vprintf+0x158>
+            for (width = 0; *format >= '0' && *format <= '9'; ) {
+  200723:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%rbp)
+  20072a:	eb 2e                	jmp    20075a <printer_vprintf+0x136>
+                width = 10 * width + *format++ - '0';
+  20072c:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  20072f:	89 d0                	mov    %edx,%eax
+  200731:	c1 e0 02             	shl    $0x2,%eax
+  200734:	01 d0                	add    %edx,%eax
+  200736:	01 c0                	add    %eax,%eax
+  200738:	89 c1                	mov    %eax,%ecx
+  20073a:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200741:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  200745:	48 89 95 68 ff ff ff 	mov    %rdx,-0x98(%rbp)
+  20074c:	0f b6 00             	movzbl (%rax),%eax
+  20074f:	0f be c0             	movsbl %al,%eax
+  200752:	01 c8                	add    %ecx,%eax
+  200754:	83 e8 30             	sub    $0x30,%eax
+  200757:	89 45 e8             	mov    %eax,-0x18(%rbp)
+            for (width = 0; *format >= '0' && *format <= '9'; ) {
+  20075a:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200761:	0f b6 00             	movzbl (%rax),%eax
+  200764:	3c 2f                	cmp    $0x2f,%al
+  200766:	0f 8e 85 00 00 00    	jle    2007f1 <printer_vprintf+0x1cd>
+  20076c:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200773:	0f b6 00             	movzbl (%rax),%eax
+  200776:	3c 39                	cmp    $0x39,%al
+  200778:	7e b2                	jle    20072c <printer_vprintf+0x108>
+        if (*format >= '1' && *format <= '9') {
+  20077a:	eb 75                	jmp    2007f1 <printer_vprintf+0x1cd>
+            }
+        } else if (*format == '*') {
+  20077c:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200783:	0f b6 00             	movzbl (%rax),%eax
+  200786:	3c 2a                	cmp    $0x2a,%al
+  200788:	75 68                	jne    2007f2 <printer_vprintf+0x1ce>
+            width = va_arg(val, int);
+  20078a:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200791:	8b 00                	mov    (%rax),%eax
+  200793:	83 f8 2f             	cmp    $0x2f,%eax
+  200796:	77 30                	ja     2007c8 <printer_vprintf+0x1a4>
+  200798:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  20079f:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  2007a3:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2007aa:	8b 00                	mov    (%rax),%eax
+  2007ac:	89 c0                	mov    %eax,%eax
+  2007ae:	48 01 d0             	add    %rdx,%rax
+  2007b1:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  2007b8:	8b 12                	mov    (%rdx),%edx
+  2007ba:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  2007bd:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  2007c4:	89 0a                	mov    %ecx,(%rdx)
+  2007c6:	eb 1a                	jmp    2007e2 <printer_vprintf+0x1be>
+  2007c8:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2007cf:	48 8b 40 08          	mov    0x8(%rax),%rax
+  2007d3:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  2007d7:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  2007de:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  2007e2:	8b 00                	mov    (%rax),%eax
+  2007e4:	89 45 e8             	mov    %eax,-0x18(%rbp)
+            ++format;
+  2007e7:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  2007ee:	01 
+  2007ef:	eb 01                	jmp    2007f2 <printer_vprintf+0x1ce>
+        if (*format >= '1' && *format <= '9') {
+  2007f1:	90                   	nop
+        }
+
+        // process precision
+        int precision = -1;
+  2007f2:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%rbp)
+        if (*format == '.') {
+  2007f9:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200800:	0f b6 00             	movzbl (%rax),%eax
+  200803:	3c 2e                	cmp    $0x2e,%al
+  200805:	0f 85 00 01 00 00    	jne    20090b <printer_vprintf+0x2e7>
+            ++format;
+  20080b:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  200812:	01 
+            if (*format >= '0' && *format <= '9') {
+  200813:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  20081a:	0f b6 00             	movzbl (%rax),%eax
+  20081d:	3c 2f                	cmp    $0x2f,%al
+  20081f:	7e 67                	jle    200888 <printer_vprintf+0x264>
+  200821:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200828:	0f b6 00             	movzbl (%rax),%eax
+  20082b:	3c 39                	cmp    $0x39,%al
+  20082d:	7f 59                	jg     200888 <printer_vprintf+0x264>
+                for (precision = 0; *format >= '0' && *format <= '9'; ) {
+  20082f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%rbp)
+  200836:	eb 2e                	jmp    200866 <printer_vprintf+0x242>
+                    precision = 10 * precision + *format++ - '0';
+  200838:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  20083b:	89 d0                	mov    %edx,%eax
+  20083d:	c1 e0 02             	shl    $0x2,%eax
+  200840:	01 d0                	add    %edx,%eax
+  200842:	01 c0                	add    %eax,%eax
+  200844:	89 c1                	mov    %eax,%ecx
+  200846:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  20084d:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  200851:	48 89 95 68 ff ff ff 	mov    %rdx,-0x98(%rbp)
+  200858:	0f b6 00             	movzbl (%rax),%eax
+  20085b:	0f be c0             	movsbl %al,%eax
+  20085e:	01 c8                	add    %ecx,%eax
+  200860:	83 e8 30             	sub    $0x30,%eax
+  200863:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+                for (precision = 0; *format >= '0' && *format <= '9'; ) {
+  200866:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  20086d:	0f b6 00             	movzbl (%rax),%eax
+  200870:	3c 2f                	cmp    $0x2f,%al
+  200872:	0f 8e 85 00 00 00    	jle    2008fd <printer_vprintf+0x2d9>
+  200878:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  20087f:	0f b6 00             	movzbl (%rax),%eax
+  200882:	3c 39                	cmp    $0x39,%al
+  200884:	7e b2                	jle    200838 <printer_vprintf+0x214>
+            if (*format >= '0' && *format <= '9') {
+  200886:	eb 75                	jmp    2008fd <printer_vprintf+0x2d9>
+                }
+            } else if (*format == '*') {
+  200888:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  20088f:	0f b6 00             	movzbl (%rax),%eax
+  200892:	3c 2a                	cmp    $0x2a,%al
+  200894:	75 68                	jne    2008fe <printer_vprintf+0x2da>
+                precision = va_arg(val, int);
+  200896:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  20089d:	8b 00                	mov    (%rax),%eax
+  20089f:	83 f8 2f             	cmp    $0x2f,%eax
+  2008a2:	77 30                	ja     2008d4 <printer_vprintf+0x2b0>
+  2008a4:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2008ab:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  2008af:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2008b6:	8b 00                	mov    (%rax),%eax
+  2008b8:	89 c0                	mov    %eax,%eax
+  2008ba:	48 01 d0             	add    %rdx,%rax
+  2008bd:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  2008c4:	8b 12                	mov    (%rdx),%edx
+  2008c6:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  2008c9:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  2008d0:	89 0a                	mov    %ecx,(%rdx)
+  2008d2:	eb 1a                	jmp    2008ee <printer_vprintf+0x2ca>
+  2008d4:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2008db:	48 8b 40 08          	mov    0x8(%rax),%rax
+  2008df:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  2008e3:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  2008ea:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  2008ee:	8b 00                	mov    (%rax),%eax
+  2008f0:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+                ++format;
+  2008f3:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  2008fa:	01 
+  2008fb:	eb 01                	jmp    2008fe <printer_vprintf+0x2da>
+            if (*format >= '0' && *format <= '9') {
+  2008fd:	90                   	nop
+            }
+            if (precision < 0) {
+  2008fe:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  200902:	79 07                	jns    20090b <printer_vprintf+0x2e7>
+                precision = 0;
+  200904:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%rbp)
+            }
+        }
+
+        // process main conversion character
+        int base = 10;
+  20090b:	c7 45 e0 0a 00 00 00 	movl   $0xa,-0x20(%rbp)
+        unsigned long num = 0;
+  200912:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  200919:	00 
+        int length = 0;
+  20091a:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+        char* data = "";
+  200921:	48 8d 05 7e 17 00 00 	lea    0x177e(%rip),%rax        # 2020a6 <flag_chars+0x6>
+  200928:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    again:
+        switch (*format) {
+  20092c:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200933:	0f b6 00             	movzbl (%rax),%eax
+  200936:	0f be c0             	movsbl %al,%eax
+  200939:	83 e8 43             	sub    $0x43,%eax
+  20093c:	83 f8 37             	cmp    $0x37,%eax
+  20093f:	0f 87 b5 03 00 00    	ja     200cfa <printer_vprintf+0x6d6>
+  200945:	89 c0                	mov    %eax,%eax
+  200947:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  20094e:	00 
+  20094f:	48 8d 05 5e 17 00 00 	lea    0x175e(%rip),%rax        # 2020b4 <flag_chars+0x14>
+  200956:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+  200959:	48 98                	cltq
+  20095b:	48 8d 15 52 17 00 00 	lea    0x1752(%rip),%rdx        # 2020b4 <flag_chars+0x14>
+  200962:	48 01 d0             	add    %rdx,%rax
+  200965:	ff e0                	jmp    *%rax
+        case 'l':
+        case 'z':
+            length = 1;
+  200967:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+            ++format;
+  20096e:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  200975:	01 
+            goto again;
+  200976:	eb b4                	jmp    20092c <printer_vprintf+0x308>
+        case 'd':
+        case 'i': {
+            long x = length ? va_arg(val, long) : va_arg(val, int);
+  200978:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  20097c:	74 5d                	je     2009db <printer_vprintf+0x3b7>
+  20097e:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200985:	8b 00                	mov    (%rax),%eax
+  200987:	83 f8 2f             	cmp    $0x2f,%eax
+  20098a:	77 30                	ja     2009bc <printer_vprintf+0x398>
+  20098c:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200993:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200997:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  20099e:	8b 00                	mov    (%rax),%eax
+  2009a0:	89 c0                	mov    %eax,%eax
+  2009a2:	48 01 d0             	add    %rdx,%rax
+  2009a5:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  2009ac:	8b 12                	mov    (%rdx),%edx
+  2009ae:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  2009b1:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  2009b8:	89 0a                	mov    %ecx,(%rdx)
+  2009ba:	eb 1a                	jmp    2009d6 <printer_vprintf+0x3b2>
+  2009bc:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2009c3:	48 8b 40 08          	mov    0x8(%rax),%rax
+  2009c7:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  2009cb:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  2009d2:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  2009d6:	48 8b 00             	mov    (%rax),%rax
+  2009d9:	eb 5c                	jmp    200a37 <printer_vprintf+0x413>
+  2009db:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2009e2:	8b 00                	mov    (%rax),%eax
+  2009e4:	83 f8 2f             	cmp    $0x2f,%eax
+  2009e7:	77 30                	ja     200a19 <printer_vprintf+0x3f5>
+  2009e9:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2009f0:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  2009f4:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2009fb:	8b 00                	mov    (%rax),%eax
+  2009fd:	89 c0                	mov    %eax,%eax
+  2009ff:	48 01 d0             	add    %rdx,%rax
+  200a02:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200a09:	8b 12                	mov    (%rdx),%edx
+  200a0b:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200a0e:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200a15:	89 0a                	mov    %ecx,(%rdx)
+  200a17:	eb 1a                	jmp    200a33 <printer_vprintf+0x40f>
+  200a19:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200a20:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200a24:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200a28:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200a2f:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200a33:	8b 00                	mov    (%rax),%eax
+  200a35:	48 98                	cltq
+  200a37:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+            int negative = x < 0 ? FLAG_NEGATIVE : 0;
+  200a3b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  200a3f:	48 c1 f8 38          	sar    $0x38,%rax
+  200a43:	25 80 00 00 00       	and    $0x80,%eax
+  200a48:	89 45 a4             	mov    %eax,-0x5c(%rbp)
+            num = negative ? -x : x;
+  200a4b:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  200a4f:	74 09                	je     200a5a <printer_vprintf+0x436>
+  200a51:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  200a55:	48 f7 d8             	neg    %rax
+  200a58:	eb 04                	jmp    200a5e <printer_vprintf+0x43a>
+  200a5a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  200a5e:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+            flags |= FLAG_NUMERIC | FLAG_SIGNED | negative;
+  200a62:	8b 45 a4             	mov    -0x5c(%rbp),%eax
+  200a65:	83 c8 60             	or     $0x60,%eax
+  200a68:	09 45 ec             	or     %eax,-0x14(%rbp)
+            break;
+  200a6b:	e9 cf 02 00 00       	jmp    200d3f <printer_vprintf+0x71b>
+        }
+        case 'u':
+        format_unsigned:
+            num = length ? va_arg(val, unsigned long) : va_arg(val, unsigned);
+  200a70:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  200a74:	74 5d                	je     200ad3 <printer_vprintf+0x4af>
+  200a76:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200a7d:	8b 00                	mov    (%rax),%eax
+  200a7f:	83 f8 2f             	cmp    $0x2f,%eax
+  200a82:	77 30                	ja     200ab4 <printer_vprintf+0x490>
+  200a84:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200a8b:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200a8f:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200a96:	8b 00                	mov    (%rax),%eax
+  200a98:	89 c0                	mov    %eax,%eax
+  200a9a:	48 01 d0             	add    %rdx,%rax
+  200a9d:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200aa4:	8b 12                	mov    (%rdx),%edx
+  200aa6:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200aa9:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200ab0:	89 0a                	mov    %ecx,(%rdx)
+  200ab2:	eb 1a                	jmp    200ace <printer_vprintf+0x4aa>
+  200ab4:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200abb:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200abf:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200ac3:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200aca:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200ace:	48 8b 00             	mov    (%rax),%rax
+  200ad1:	eb 5c                	jmp    200b2f <printer_vprintf+0x50b>
+  200ad3:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200ada:	8b 00                	mov    (%rax),%eax
+  200adc:	83 f8 2f             	cmp    $0x2f,%eax
+  200adf:	77 30                	ja     200b11 <printer_vprintf+0x4ed>
+  200ae1:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200ae8:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200aec:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200af3:	8b 00                	mov    (%rax),%eax
+  200af5:	89 c0                	mov    %eax,%eax
+  200af7:	48 01 d0             	add    %rdx,%rax
+  200afa:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200b01:	8b 12                	mov    (%rdx),%edx
+  200b03:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200b06:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200b0d:	89 0a                	mov    %ecx,(%rdx)
+  200b0f:	eb 1a                	jmp    200b2b <printer_vprintf+0x507>
+  200b11:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200b18:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200b1c:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200b20:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200b27:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200b2b:	8b 00                	mov    (%rax),%eax
+  200b2d:	89 c0                	mov    %eax,%eax
+  200b2f:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+            flags |= FLAG_NUMERIC;
+  200b33:	83 4d ec 20          	orl    $0x20,-0x14(%rbp)
+            break;
+  200b37:	e9 03 02 00 00       	jmp    200d3f <printer_vprintf+0x71b>
+        case 'x':
+            base = -16;
+  200b3c:	c7 45 e0 f0 ff ff ff 	movl   $0xfffffff0,-0x20(%rbp)
+            goto format_unsigned;
+  200b43:	e9 28 ff ff ff       	jmp    200a70 <printer_vprintf+0x44c>
+        case 'X':
+            base = 16;
+  200b48:	c7 45 e0 10 00 00 00 	movl   $0x10,-0x20(%rbp)
+            goto format_unsigned;
+  200b4f:	e9 1c ff ff ff       	jmp    200a70 <printer_vprintf+0x44c>
+        case 'p':
+            num = (uintptr_t) va_arg(val, void*);
+  200b54:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200b5b:	8b 00                	mov    (%rax),%eax
+  200b5d:	83 f8 2f             	cmp    $0x2f,%eax
+  200b60:	77 30                	ja     200b92 <printer_vprintf+0x56e>
+  200b62:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200b69:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200b6d:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200b74:	8b 00                	mov    (%rax),%eax
+  200b76:	89 c0                	mov    %eax,%eax
+  200b78:	48 01 d0             	add    %rdx,%rax
+  200b7b:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200b82:	8b 12                	mov    (%rdx),%edx
+  200b84:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200b87:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200b8e:	89 0a                	mov    %ecx,(%rdx)
+  200b90:	eb 1a                	jmp    200bac <printer_vprintf+0x588>
+  200b92:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200b99:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200b9d:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200ba1:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200ba8:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200bac:	48 8b 00             	mov    (%rax),%rax
+  200baf:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+            base = -16;
+  200bb3:	c7 45 e0 f0 ff ff ff 	movl   $0xfffffff0,-0x20(%rbp)
+            flags |= FLAG_ALT | FLAG_ALT2 | FLAG_NUMERIC;
+  200bba:	81 4d ec 21 01 00 00 	orl    $0x121,-0x14(%rbp)
+            break;
+  200bc1:	e9 79 01 00 00       	jmp    200d3f <printer_vprintf+0x71b>
+        case 's':
+            data = va_arg(val, char*);
+  200bc6:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200bcd:	8b 00                	mov    (%rax),%eax
+  200bcf:	83 f8 2f             	cmp    $0x2f,%eax
+  200bd2:	77 30                	ja     200c04 <printer_vprintf+0x5e0>
+  200bd4:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200bdb:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200bdf:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200be6:	8b 00                	mov    (%rax),%eax
+  200be8:	89 c0                	mov    %eax,%eax
+  200bea:	48 01 d0             	add    %rdx,%rax
+  200bed:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200bf4:	8b 12                	mov    (%rdx),%edx
+  200bf6:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200bf9:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200c00:	89 0a                	mov    %ecx,(%rdx)
+  200c02:	eb 1a                	jmp    200c1e <printer_vprintf+0x5fa>
+  200c04:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c0b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200c0f:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200c13:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200c1a:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200c1e:	48 8b 00             	mov    (%rax),%rax
+  200c21:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+            break;
+  200c25:	e9 15 01 00 00       	jmp    200d3f <printer_vprintf+0x71b>
+        case 'C':
+            color = va_arg(val, int);
+  200c2a:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c31:	8b 00                	mov    (%rax),%eax
+  200c33:	83 f8 2f             	cmp    $0x2f,%eax
+  200c36:	77 30                	ja     200c68 <printer_vprintf+0x644>
+  200c38:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c3f:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200c43:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c4a:	8b 00                	mov    (%rax),%eax
+  200c4c:	89 c0                	mov    %eax,%eax
+  200c4e:	48 01 d0             	add    %rdx,%rax
+  200c51:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200c58:	8b 12                	mov    (%rdx),%edx
+  200c5a:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200c5d:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200c64:	89 0a                	mov    %ecx,(%rdx)
+  200c66:	eb 1a                	jmp    200c82 <printer_vprintf+0x65e>
+  200c68:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c6f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200c73:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200c77:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200c7e:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200c82:	8b 00                	mov    (%rax),%eax
+  200c84:	89 85 74 ff ff ff    	mov    %eax,-0x8c(%rbp)
+            goto done;
+  200c8a:	e9 77 03 00 00       	jmp    201006 <printer_vprintf+0x9e2>
+        case 'c':
+            data = numbuf;
+  200c8f:	48 8d 45 8c          	lea    -0x74(%rbp),%rax
+  200c93:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+            numbuf[0] = va_arg(val, int);
+  200c97:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c9e:	8b 00                	mov    (%rax),%eax
+  200ca0:	83 f8 2f             	cmp    $0x2f,%eax
+  200ca3:	77 30                	ja     200cd5 <printer_vprintf+0x6b1>
+  200ca5:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200cac:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200cb0:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200cb7:	8b 00                	mov    (%rax),%eax
+  200cb9:	89 c0                	mov    %eax,%eax
+  200cbb:	48 01 d0             	add    %rdx,%rax
+  200cbe:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200cc5:	8b 12                	mov    (%rdx),%edx
+  200cc7:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200cca:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200cd1:	89 0a                	mov    %ecx,(%rdx)
+  200cd3:	eb 1a                	jmp    200cef <printer_vprintf+0x6cb>
+  200cd5:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200cdc:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200ce0:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200ce4:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200ceb:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200cef:	8b 00                	mov    (%rax),%eax
+  200cf1:	88 45 8c             	mov    %al,-0x74(%rbp)
+            numbuf[1] = '\0';
+  200cf4:	c6 45 8d 00          	movb   $0x0,-0x73(%rbp)
+            break;
+  200cf8:	eb 45                	jmp    200d3f <printer_vprintf+0x71b>
+        default:
+            data = numbuf;
+  200cfa:	48 8d 45 8c          	lea    -0x74(%rbp),%rax
+  200cfe:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+            numbuf[0] = (*format ? *format : '%');
+  200d02:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200d09:	0f b6 00             	movzbl (%rax),%eax
+  200d0c:	84 c0                	test   %al,%al
+  200d0e:	74 0c                	je     200d1c <printer_vprintf+0x6f8>
+  200d10:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200d17:	0f b6 00             	movzbl (%rax),%eax
+  200d1a:	eb 05                	jmp    200d21 <printer_vprintf+0x6fd>
+  200d1c:	b8 25 00 00 00       	mov    $0x25,%eax
+  200d21:	88 45 8c             	mov    %al,-0x74(%rbp)
+            numbuf[1] = '\0';
+  200d24:	c6 45 8d 00          	movb   $0x0,-0x73(%rbp)
+            if (!*format) {
+  200d28:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200d2f:	0f b6 00             	movzbl (%rax),%eax
+  200d32:	84 c0                	test   %al,%al
+  200d34:	75 08                	jne    200d3e <printer_vprintf+0x71a>
+                format--;
+  200d36:	48 83 ad 68 ff ff ff 	subq   $0x1,-0x98(%rbp)
+  200d3d:	01 
+            }
+            break;
+  200d3e:	90                   	nop
+        }
+
+        if (flags & FLAG_NUMERIC) {
+  200d3f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200d42:	83 e0 20             	and    $0x20,%eax
+  200d45:	85 c0                	test   %eax,%eax
+  200d47:	74 1e                	je     200d67 <printer_vprintf+0x743>
+            data = fill_numbuf(numbuf + NUMBUFSIZ, num, base);
+  200d49:	48 8d 45 8c          	lea    -0x74(%rbp),%rax
+  200d4d:	48 83 c0 18          	add    $0x18,%rax
+  200d51:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  200d54:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  200d58:	48 89 ce             	mov    %rcx,%rsi
+  200d5b:	48 89 c7             	mov    %rax,%rdi
+  200d5e:	e8 39 f8 ff ff       	call   20059c <fill_numbuf>
+  200d63:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        }
+
+        const char* prefix = "";
+  200d67:	48 8d 05 38 13 00 00 	lea    0x1338(%rip),%rax        # 2020a6 <flag_chars+0x6>
+  200d6e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((flags & FLAG_NUMERIC) && (flags & FLAG_SIGNED)) {
+  200d72:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200d75:	83 e0 20             	and    $0x20,%eax
+  200d78:	85 c0                	test   %eax,%eax
+  200d7a:	74 51                	je     200dcd <printer_vprintf+0x7a9>
+  200d7c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200d7f:	83 e0 40             	and    $0x40,%eax
+  200d82:	85 c0                	test   %eax,%eax
+  200d84:	74 47                	je     200dcd <printer_vprintf+0x7a9>
+            if (flags & FLAG_NEGATIVE) {
+  200d86:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200d89:	25 80 00 00 00       	and    $0x80,%eax
+  200d8e:	85 c0                	test   %eax,%eax
+  200d90:	74 0d                	je     200d9f <printer_vprintf+0x77b>
+                prefix = "-";
+  200d92:	48 8d 05 0e 13 00 00 	lea    0x130e(%rip),%rax        # 2020a7 <flag_chars+0x7>
+  200d99:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            if (flags & FLAG_NEGATIVE) {
+  200d9d:	eb 7d                	jmp    200e1c <printer_vprintf+0x7f8>
+            } else if (flags & FLAG_PLUSPOSITIVE) {
+  200d9f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200da2:	83 e0 10             	and    $0x10,%eax
+  200da5:	85 c0                	test   %eax,%eax
+  200da7:	74 0d                	je     200db6 <printer_vprintf+0x792>
+                prefix = "+";
+  200da9:	48 8d 05 f9 12 00 00 	lea    0x12f9(%rip),%rax        # 2020a9 <flag_chars+0x9>
+  200db0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            if (flags & FLAG_NEGATIVE) {
+  200db4:	eb 66                	jmp    200e1c <printer_vprintf+0x7f8>
+            } else if (flags & FLAG_SPACEPOSITIVE) {
+  200db6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200db9:	83 e0 08             	and    $0x8,%eax
+  200dbc:	85 c0                	test   %eax,%eax
+  200dbe:	74 5c                	je     200e1c <printer_vprintf+0x7f8>
+                prefix = " ";
+  200dc0:	48 8d 05 e4 12 00 00 	lea    0x12e4(%rip),%rax        # 2020ab <flag_chars+0xb>
+  200dc7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            if (flags & FLAG_NEGATIVE) {
+  200dcb:	eb 4f                	jmp    200e1c <printer_vprintf+0x7f8>
+            }
+        } else if ((flags & FLAG_NUMERIC) && (flags & FLAG_ALT)
+  200dcd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200dd0:	83 e0 20             	and    $0x20,%eax
+  200dd3:	85 c0                	test   %eax,%eax
+  200dd5:	74 46                	je     200e1d <printer_vprintf+0x7f9>
+  200dd7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200dda:	83 e0 01             	and    $0x1,%eax
+  200ddd:	85 c0                	test   %eax,%eax
+  200ddf:	74 3c                	je     200e1d <printer_vprintf+0x7f9>
+                   && (base == 16 || base == -16)
+  200de1:	83 7d e0 10          	cmpl   $0x10,-0x20(%rbp)
+  200de5:	74 06                	je     200ded <printer_vprintf+0x7c9>
+  200de7:	83 7d e0 f0          	cmpl   $0xfffffff0,-0x20(%rbp)
+  200deb:	75 30                	jne    200e1d <printer_vprintf+0x7f9>
+                   && (num || (flags & FLAG_ALT2))) {
+  200ded:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  200df2:	75 0c                	jne    200e00 <printer_vprintf+0x7dc>
+  200df4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200df7:	25 00 01 00 00       	and    $0x100,%eax
+  200dfc:	85 c0                	test   %eax,%eax
+  200dfe:	74 1d                	je     200e1d <printer_vprintf+0x7f9>
+            prefix = (base == -16 ? "0x" : "0X");
+  200e00:	83 7d e0 f0          	cmpl   $0xfffffff0,-0x20(%rbp)
+  200e04:	75 09                	jne    200e0f <printer_vprintf+0x7eb>
+  200e06:	48 8d 05 a0 12 00 00 	lea    0x12a0(%rip),%rax        # 2020ad <flag_chars+0xd>
+  200e0d:	eb 07                	jmp    200e16 <printer_vprintf+0x7f2>
+  200e0f:	48 8d 05 9a 12 00 00 	lea    0x129a(%rip),%rax        # 2020b0 <flag_chars+0x10>
+  200e16:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  200e1a:	eb 01                	jmp    200e1d <printer_vprintf+0x7f9>
+            if (flags & FLAG_NEGATIVE) {
+  200e1c:	90                   	nop
+        }
+
+        int len;
+        if (precision >= 0 && !(flags & FLAG_NUMERIC)) {
+  200e1d:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  200e21:	78 24                	js     200e47 <printer_vprintf+0x823>
+  200e23:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200e26:	83 e0 20             	and    $0x20,%eax
+  200e29:	85 c0                	test   %eax,%eax
+  200e2b:	75 1a                	jne    200e47 <printer_vprintf+0x823>
+            len = strnlen(data, precision);
+  200e2d:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  200e30:	48 63 d0             	movslq %eax,%rdx
+  200e33:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200e37:	48 89 d6             	mov    %rdx,%rsi
+  200e3a:	48 89 c7             	mov    %rax,%rdi
+  200e3d:	e8 8a f5 ff ff       	call   2003cc <strnlen>
+  200e42:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  200e45:	eb 0f                	jmp    200e56 <printer_vprintf+0x832>
+        } else {
+            len = strlen(data);
+  200e47:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200e4b:	48 89 c7             	mov    %rax,%rdi
+  200e4e:	e8 48 f5 ff ff       	call   20039b <strlen>
+  200e53:	89 45 bc             	mov    %eax,-0x44(%rbp)
+        }
+        int zeros;
+        if ((flags & FLAG_NUMERIC) && precision >= 0) {
+  200e56:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200e59:	83 e0 20             	and    $0x20,%eax
+  200e5c:	85 c0                	test   %eax,%eax
+  200e5e:	74 20                	je     200e80 <printer_vprintf+0x85c>
+  200e60:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  200e64:	78 1a                	js     200e80 <printer_vprintf+0x85c>
+            zeros = precision > len ? precision - len : 0;
+  200e66:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  200e69:	3b 45 bc             	cmp    -0x44(%rbp),%eax
+  200e6c:	7e 08                	jle    200e76 <printer_vprintf+0x852>
+  200e6e:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  200e71:	2b 45 bc             	sub    -0x44(%rbp),%eax
+  200e74:	eb 05                	jmp    200e7b <printer_vprintf+0x857>
+  200e76:	b8 00 00 00 00       	mov    $0x0,%eax
+  200e7b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  200e7e:	eb 5c                	jmp    200edc <printer_vprintf+0x8b8>
+        } else if ((flags & FLAG_NUMERIC) && (flags & FLAG_ZERO)
+  200e80:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200e83:	83 e0 20             	and    $0x20,%eax
+  200e86:	85 c0                	test   %eax,%eax
+  200e88:	74 4b                	je     200ed5 <printer_vprintf+0x8b1>
+  200e8a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200e8d:	83 e0 02             	and    $0x2,%eax
+  200e90:	85 c0                	test   %eax,%eax
+  200e92:	74 41                	je     200ed5 <printer_vprintf+0x8b1>
+                   && !(flags & FLAG_LEFTJUSTIFY)
+  200e94:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200e97:	83 e0 04             	and    $0x4,%eax
+  200e9a:	85 c0                	test   %eax,%eax
+  200e9c:	75 37                	jne    200ed5 <printer_vprintf+0x8b1>
+                   && len + (int) strlen(prefix) < width) {
+  200e9e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  200ea2:	48 89 c7             	mov    %rax,%rdi
+  200ea5:	e8 f1 f4 ff ff       	call   20039b <strlen>
+  200eaa:	89 c2                	mov    %eax,%edx
+  200eac:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  200eaf:	01 d0                	add    %edx,%eax
+  200eb1:	39 45 e8             	cmp    %eax,-0x18(%rbp)
+  200eb4:	7e 1f                	jle    200ed5 <printer_vprintf+0x8b1>
+            zeros = width - len - strlen(prefix);
+  200eb6:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  200eb9:	2b 45 bc             	sub    -0x44(%rbp),%eax
+  200ebc:	89 c3                	mov    %eax,%ebx
+  200ebe:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  200ec2:	48 89 c7             	mov    %rax,%rdi
+  200ec5:	e8 d1 f4 ff ff       	call   20039b <strlen>
+  200eca:	89 c2                	mov    %eax,%edx
+  200ecc:	89 d8                	mov    %ebx,%eax
+  200ece:	29 d0                	sub    %edx,%eax
+  200ed0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  200ed3:	eb 07                	jmp    200edc <printer_vprintf+0x8b8>
+        } else {
+            zeros = 0;
+  200ed5:	c7 45 b8 00 00 00 00 	movl   $0x0,-0x48(%rbp)
+        }
+        width -= len + zeros + strlen(prefix);
+  200edc:	8b 55 bc             	mov    -0x44(%rbp),%edx
+  200edf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  200ee2:	01 d0                	add    %edx,%eax
+  200ee4:	48 63 d8             	movslq %eax,%rbx
+  200ee7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  200eeb:	48 89 c7             	mov    %rax,%rdi
+  200eee:	e8 a8 f4 ff ff       	call   20039b <strlen>
+  200ef3:	48 8d 14 03          	lea    (%rbx,%rax,1),%rdx
+  200ef7:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  200efa:	29 d0                	sub    %edx,%eax
+  200efc:	89 45 e8             	mov    %eax,-0x18(%rbp)
+        for (; !(flags & FLAG_LEFTJUSTIFY) && width > 0; --width) {
+  200eff:	eb 25                	jmp    200f26 <printer_vprintf+0x902>
+            p->putc(p, ' ', color);
+  200f01:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200f08:	48 8b 08             	mov    (%rax),%rcx
+  200f0b:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  200f11:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200f18:	be 20 00 00 00       	mov    $0x20,%esi
+  200f1d:	48 89 c7             	mov    %rax,%rdi
+  200f20:	ff d1                	call   *%rcx
+        for (; !(flags & FLAG_LEFTJUSTIFY) && width > 0; --width) {
+  200f22:	83 6d e8 01          	subl   $0x1,-0x18(%rbp)
+  200f26:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200f29:	83 e0 04             	and    $0x4,%eax
+  200f2c:	85 c0                	test   %eax,%eax
+  200f2e:	75 36                	jne    200f66 <printer_vprintf+0x942>
+  200f30:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  200f34:	7f cb                	jg     200f01 <printer_vprintf+0x8dd>
+        }
+        for (; *prefix; ++prefix) {
+  200f36:	eb 2e                	jmp    200f66 <printer_vprintf+0x942>
+            p->putc(p, *prefix, color);
+  200f38:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200f3f:	4c 8b 00             	mov    (%rax),%r8
+  200f42:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  200f46:	0f b6 00             	movzbl (%rax),%eax
+  200f49:	0f b6 c8             	movzbl %al,%ecx
+  200f4c:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  200f52:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200f59:	89 ce                	mov    %ecx,%esi
+  200f5b:	48 89 c7             	mov    %rax,%rdi
+  200f5e:	41 ff d0             	call   *%r8
+        for (; *prefix; ++prefix) {
+  200f61:	48 83 45 c0 01       	addq   $0x1,-0x40(%rbp)
+  200f66:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  200f6a:	0f b6 00             	movzbl (%rax),%eax
+  200f6d:	84 c0                	test   %al,%al
+  200f6f:	75 c7                	jne    200f38 <printer_vprintf+0x914>
+        }
+        for (; zeros > 0; --zeros) {
+  200f71:	eb 25                	jmp    200f98 <printer_vprintf+0x974>
+            p->putc(p, '0', color);
+  200f73:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200f7a:	48 8b 08             	mov    (%rax),%rcx
+  200f7d:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  200f83:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200f8a:	be 30 00 00 00       	mov    $0x30,%esi
+  200f8f:	48 89 c7             	mov    %rax,%rdi
+  200f92:	ff d1                	call   *%rcx
+        for (; zeros > 0; --zeros) {
+  200f94:	83 6d b8 01          	subl   $0x1,-0x48(%rbp)
+  200f98:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  200f9c:	7f d5                	jg     200f73 <printer_vprintf+0x94f>
+        }
+        for (; len > 0; ++data, --len) {
+  200f9e:	eb 32                	jmp    200fd2 <printer_vprintf+0x9ae>
+            p->putc(p, *data, color);
+  200fa0:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200fa7:	4c 8b 00             	mov    (%rax),%r8
+  200faa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200fae:	0f b6 00             	movzbl (%rax),%eax
+  200fb1:	0f b6 c8             	movzbl %al,%ecx
+  200fb4:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  200fba:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200fc1:	89 ce                	mov    %ecx,%esi
+  200fc3:	48 89 c7             	mov    %rax,%rdi
+  200fc6:	41 ff d0             	call   *%r8
+        for (; len > 0; ++data, --len) {
+  200fc9:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  200fce:	83 6d bc 01          	subl   $0x1,-0x44(%rbp)
+  200fd2:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+  200fd6:	7f c8                	jg     200fa0 <printer_vprintf+0x97c>
+        }
+        for (; width > 0; --width) {
+  200fd8:	eb 25                	jmp    200fff <printer_vprintf+0x9db>
+            p->putc(p, ' ', color);
+  200fda:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200fe1:	48 8b 08             	mov    (%rax),%rcx
+  200fe4:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  200fea:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200ff1:	be 20 00 00 00       	mov    $0x20,%esi
+  200ff6:	48 89 c7             	mov    %rax,%rdi
+  200ff9:	ff d1                	call   *%rcx
+        for (; width > 0; --width) {
+  200ffb:	83 6d e8 01          	subl   $0x1,-0x18(%rbp)
+  200fff:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  201003:	7f d5                	jg     200fda <printer_vprintf+0x9b6>
+        }
+    done: ;
+  201005:	90                   	nop
+    for (; *format; ++format) {
+  201006:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  20100d:	01 
+  20100e:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  201015:	0f b6 00             	movzbl (%rax),%eax
+  201018:	84 c0                	test   %al,%al
+  20101a:	0f 85 30 f6 ff ff    	jne    200650 <printer_vprintf+0x2c>
+    }
+}
+  201020:	90                   	nop
+  201021:	90                   	nop
+  201022:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  201026:	c9                   	leave
+  201027:	c3                   	ret
+
+0000000000201028 <console_putc>:
+typedef struct console_printer {
+    printer p;
+    uint16_t* cursor;
+} console_printer;
+
+static void console_putc(printer* p, unsigned char c, int color) {
+  201028:	55                   	push   %rbp
+  201029:	48 89 e5             	mov    %rsp,%rbp
+  20102c:	48 83 ec 30          	sub    $0x30,%rsp
+  201030:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  201034:	89 f0                	mov    %esi,%eax
+  201036:	89 55 d0             	mov    %edx,-0x30(%rbp)
+  201039:	88 45 d4             	mov    %al,-0x2c(%rbp)
+    console_printer* cp = (console_printer*) p;
+  20103c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  201040:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    /*if (cp->cursor >= console + CONSOLE_ROWS * CONSOLE_COLUMNS) {
+        cp->cursor = console;
+    }*/
+    if (c == '\n') {
+  201044:	80 7d d4 0a          	cmpb   $0xa,-0x2c(%rbp)
+  201048:	75 7f                	jne    2010c9 <console_putc+0xa1>
+        int pos = (cp->cursor - console) % CONSOLE_COLUMNS;
+  20104a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20104e:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  201052:	48 8d 05 a7 6f eb ff 	lea    -0x149059(%rip),%rax        # b8000 <console>
+  201059:	48 29 c2             	sub    %rax,%rdx
+  20105c:	48 89 d0             	mov    %rdx,%rax
+  20105f:	48 d1 f8             	sar    %rax
+  201062:	48 89 c1             	mov    %rax,%rcx
+  201065:	48 ba 67 66 66 66 66 	movabs $0x6666666666666667,%rdx
+  20106c:	66 66 66 
+  20106f:	48 89 c8             	mov    %rcx,%rax
+  201072:	48 f7 ea             	imul   %rdx
+  201075:	48 c1 fa 05          	sar    $0x5,%rdx
+  201079:	48 89 c8             	mov    %rcx,%rax
+  20107c:	48 c1 f8 3f          	sar    $0x3f,%rax
+  201080:	48 29 c2             	sub    %rax,%rdx
+  201083:	48 89 d0             	mov    %rdx,%rax
+  201086:	48 c1 e0 02          	shl    $0x2,%rax
+  20108a:	48 01 d0             	add    %rdx,%rax
+  20108d:	48 c1 e0 04          	shl    $0x4,%rax
+  201091:	48 29 c1             	sub    %rax,%rcx
+  201094:	48 89 ca             	mov    %rcx,%rdx
+  201097:	89 55 fc             	mov    %edx,-0x4(%rbp)
+        for (; pos != CONSOLE_COLUMNS; pos++) {
+  20109a:	eb 25                	jmp    2010c1 <console_putc+0x99>
+            *cp->cursor++ = ' ' | color;
+  20109c:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  20109f:	83 c8 20             	or     $0x20,%eax
+  2010a2:	89 c6                	mov    %eax,%esi
+  2010a4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2010a8:	48 8b 40 08          	mov    0x8(%rax),%rax
+  2010ac:	48 8d 48 02          	lea    0x2(%rax),%rcx
+  2010b0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  2010b4:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  2010b8:	89 f2                	mov    %esi,%edx
+  2010ba:	66 89 10             	mov    %dx,(%rax)
+        for (; pos != CONSOLE_COLUMNS; pos++) {
+  2010bd:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  2010c1:	83 7d fc 50          	cmpl   $0x50,-0x4(%rbp)
+  2010c5:	75 d5                	jne    20109c <console_putc+0x74>
+  2010c7:	eb 69                	jmp    201132 <console_putc+0x10a>
+        }
+    } else if (c == '\b') {
+  2010c9:	80 7d d4 08          	cmpb   $0x8,-0x2c(%rbp)
+  2010cd:	75 3f                	jne    20110e <console_putc+0xe6>
+        if (cp->cursor != console) {
+  2010cf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2010d3:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  2010d7:	48 8d 05 22 6f eb ff 	lea    -0x1490de(%rip),%rax        # b8000 <console>
+  2010de:	48 39 c2             	cmp    %rax,%rdx
+  2010e1:	74 4f                	je     201132 <console_putc+0x10a>
+            *(--cp->cursor) = ' ' | color;
+  2010e3:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  2010e6:	83 c8 20             	or     $0x20,%eax
+  2010e9:	89 c1                	mov    %eax,%ecx
+  2010eb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2010ef:	48 8b 40 08          	mov    0x8(%rax),%rax
+  2010f3:	48 8d 50 fe          	lea    -0x2(%rax),%rdx
+  2010f7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2010fb:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  2010ff:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201103:	48 8b 40 08          	mov    0x8(%rax),%rax
+  201107:	89 ca                	mov    %ecx,%edx
+  201109:	66 89 10             	mov    %dx,(%rax)
+  20110c:	eb 24                	jmp    201132 <console_putc+0x10a>
+        }
+    } else {
+        *cp->cursor++ = c | color;
+  20110e:	0f b6 45 d4          	movzbl -0x2c(%rbp),%eax
+  201112:	8b 55 d0             	mov    -0x30(%rbp),%edx
+  201115:	09 d0                	or     %edx,%eax
+  201117:	89 c6                	mov    %eax,%esi
+  201119:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20111d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  201121:	48 8d 48 02          	lea    0x2(%rax),%rcx
+  201125:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  201129:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  20112d:	89 f2                	mov    %esi,%edx
+  20112f:	66 89 10             	mov    %dx,(%rax)
+    }
+
+    const int MAX_ROWS = CONSOLE_ROWS - 2;
+  201132:	c7 45 e4 17 00 00 00 	movl   $0x17,-0x1c(%rbp)
+
+    if (cp->cursor == console + MAX_ROWS * CONSOLE_COLUMNS) {
+  201139:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20113d:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  201141:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  201144:	89 d0                	mov    %edx,%eax
+  201146:	c1 e0 02             	shl    $0x2,%eax
+  201149:	01 d0                	add    %edx,%eax
+  20114b:	c1 e0 04             	shl    $0x4,%eax
+  20114e:	48 98                	cltq
+  201150:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  201154:	48 8d 05 a5 6e eb ff 	lea    -0x14915b(%rip),%rax        # b8000 <console>
+  20115b:	48 01 d0             	add    %rdx,%rax
+  20115e:	48 39 c1             	cmp    %rax,%rcx
+  201161:	0f 85 ac 00 00 00    	jne    201213 <console_putc+0x1eb>
+        // Move all characters up by one row, forgetting the first row
+        for (int i = 0; i < (MAX_ROWS - 1) * CONSOLE_COLUMNS; ++i) {
+  201167:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  20116e:	eb 30                	jmp    2011a0 <console_putc+0x178>
+            console[i] = console[i + CONSOLE_COLUMNS];
+  201170:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  201173:	83 c0 50             	add    $0x50,%eax
+  201176:	48 98                	cltq
+  201178:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  20117c:	48 8d 05 7d 6e eb ff 	lea    -0x149183(%rip),%rax        # b8000 <console>
+  201183:	0f b7 04 02          	movzwl (%rdx,%rax,1),%eax
+  201187:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  20118a:	48 63 d2             	movslq %edx,%rdx
+  20118d:	48 8d 0c 12          	lea    (%rdx,%rdx,1),%rcx
+  201191:	48 8d 15 68 6e eb ff 	lea    -0x149198(%rip),%rdx        # b8000 <console>
+  201198:	66 89 04 11          	mov    %ax,(%rcx,%rdx,1)
+        for (int i = 0; i < (MAX_ROWS - 1) * CONSOLE_COLUMNS; ++i) {
+  20119c:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+  2011a0:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  2011a3:	8d 50 ff             	lea    -0x1(%rax),%edx
+  2011a6:	89 d0                	mov    %edx,%eax
+  2011a8:	c1 e0 02             	shl    $0x2,%eax
+  2011ab:	01 d0                	add    %edx,%eax
+  2011ad:	c1 e0 04             	shl    $0x4,%eax
+  2011b0:	39 45 f8             	cmp    %eax,-0x8(%rbp)
+  2011b3:	7c bb                	jl     201170 <console_putc+0x148>
+        }
+
+        // Fill last column with space
+        for (int i = (MAX_ROWS - 1) * CONSOLE_COLUMNS; i < MAX_ROWS * CONSOLE_COLUMNS; ++i) {
+  2011b5:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  2011b8:	8d 50 ff             	lea    -0x1(%rax),%edx
+  2011bb:	89 d0                	mov    %edx,%eax
+  2011bd:	c1 e0 02             	shl    $0x2,%eax
+  2011c0:	01 d0                	add    %edx,%eax
+  2011c2:	c1 e0 04             	shl    $0x4,%eax
+  2011c5:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  2011c8:	eb 20                	jmp    2011ea <console_putc+0x1c2>
+            console[i] = ' ' | color;
+  2011ca:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  2011cd:	83 c8 20             	or     $0x20,%eax
+  2011d0:	89 c1                	mov    %eax,%ecx
+  2011d2:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  2011d5:	48 98                	cltq
+  2011d7:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  2011db:	48 8d 05 1e 6e eb ff 	lea    -0x1491e2(%rip),%rax        # b8000 <console>
+  2011e2:	66 89 0c 02          	mov    %cx,(%rdx,%rax,1)
+        for (int i = (MAX_ROWS - 1) * CONSOLE_COLUMNS; i < MAX_ROWS * CONSOLE_COLUMNS; ++i) {
+  2011e6:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  2011ea:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  2011ed:	89 d0                	mov    %edx,%eax
+  2011ef:	c1 e0 02             	shl    $0x2,%eax
+  2011f2:	01 d0                	add    %edx,%eax
+  2011f4:	c1 e0 04             	shl    $0x4,%eax
+  2011f7:	39 45 f4             	cmp    %eax,-0xc(%rbp)
+  2011fa:	7c ce                	jl     2011ca <console_putc+0x1a2>
+        }
+
+        cp->cursor -= CONSOLE_COLUMNS;
+  2011fc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201200:	48 8b 40 08          	mov    0x8(%rax),%rax
+  201204:	48 8d 90 60 ff ff ff 	lea    -0xa0(%rax),%rdx
+  20120b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20120f:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    }
+}
+  201213:	90                   	nop
+  201214:	c9                   	leave
+  201215:	c3                   	ret
+
+0000000000201216 <console_vprintf>:
+
+int console_vprintf(int cpos, int color, const char* format, va_list val) {
+  201216:	55                   	push   %rbp
+  201217:	48 89 e5             	mov    %rsp,%rbp
+  20121a:	48 83 ec 30          	sub    $0x30,%rsp
+  20121e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  201221:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  201224:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  201228:	48 89 4d d8          	mov    %rcx,-0x28(%rbp)
+    struct console_printer cp;
+    cp.p.putc = console_putc;
+  20122c:	48 8d 05 f5 fd ff ff 	lea    -0x20b(%rip),%rax        # 201028 <console_putc>
+  201233:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (cpos < 0 || cpos >= CONSOLE_ROWS * CONSOLE_COLUMNS) {
+  201237:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  20123b:	78 09                	js     201246 <console_vprintf+0x30>
+  20123d:	81 7d ec cf 07 00 00 	cmpl   $0x7cf,-0x14(%rbp)
+  201244:	7e 07                	jle    20124d <console_vprintf+0x37>
+        cpos = 0;
+  201246:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+    }
+    cp.cursor = console + cpos;
+  20124d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  201250:	48 98                	cltq
+  201252:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  201256:	48 8d 05 a3 6d eb ff 	lea    -0x14925d(%rip),%rax        # b8000 <console>
+  20125d:	48 01 d0             	add    %rdx,%rax
+  201260:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    printer_vprintf(&cp.p, color, format, val);
+  201264:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  201268:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  20126c:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  20126f:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  201273:	48 89 c7             	mov    %rax,%rdi
+  201276:	e8 a9 f3 ff ff       	call   200624 <printer_vprintf>
+    return cp.cursor - console;
+  20127b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  20127f:	48 8d 05 7a 6d eb ff 	lea    -0x149286(%rip),%rax        # b8000 <console>
+  201286:	48 29 c2             	sub    %rax,%rdx
+  201289:	48 89 d0             	mov    %rdx,%rax
+  20128c:	48 d1 f8             	sar    %rax
+}
+  20128f:	c9                   	leave
+  201290:	c3                   	ret
+
+0000000000201291 <console_printf>:
+
+int console_printf(int cpos, int color, const char* format, ...) {
+  201291:	55                   	push   %rbp
+  201292:	48 89 e5             	mov    %rsp,%rbp
+  201295:	48 83 ec 60          	sub    $0x60,%rsp
+  201299:	89 7d ac             	mov    %edi,-0x54(%rbp)
+  20129c:	89 75 a8             	mov    %esi,-0x58(%rbp)
+  20129f:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+  2012a3:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  2012a7:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  2012ab:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list val;
+    va_start(val, format);
+  2012af:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  2012b6:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  2012ba:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  2012be:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  2012c2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    cpos = console_vprintf(cpos, color, format, val);
+  2012c6:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  2012ca:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  2012ce:	8b 75 a8             	mov    -0x58(%rbp),%esi
+  2012d1:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  2012d4:	89 c7                	mov    %eax,%edi
+  2012d6:	e8 3b ff ff ff       	call   201216 <console_vprintf>
+  2012db:	89 45 ac             	mov    %eax,-0x54(%rbp)
+    va_end(val);
+    return cpos;
+  2012de:	8b 45 ac             	mov    -0x54(%rbp),%eax
+}
+  2012e1:	c9                   	leave
+  2012e2:	c3                   	ret
+
+00000000002012e3 <string_putc>:
+    printer p;
+    char* s;
+    char* end;
+} string_printer;
+
+static void string_putc(printer* p, unsigned char c, int color) {
+  2012e3:	55                   	push   %rbp
+  2012e4:	48 89 e5             	mov    %rsp,%rbp
+  2012e7:	48 83 ec 20          	sub    $0x20,%rsp
+  2012eb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  2012ef:	89 f0                	mov    %esi,%eax
+  2012f1:	89 55 e0             	mov    %edx,-0x20(%rbp)
+  2012f4:	88 45 e4             	mov    %al,-0x1c(%rbp)
+    string_printer* sp = (string_printer*) p;
+  2012f7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2012fb:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (sp->s < sp->end) {
+  2012ff:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  201303:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  201307:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20130b:	48 8b 40 10          	mov    0x10(%rax),%rax
+  20130f:	48 39 c2             	cmp    %rax,%rdx
+  201312:	73 1a                	jae    20132e <string_putc+0x4b>
+        *sp->s++ = c;
+  201314:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  201318:	48 8b 40 08          	mov    0x8(%rax),%rax
+  20131c:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  201320:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  201324:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  201328:	0f b6 55 e4          	movzbl -0x1c(%rbp),%edx
+  20132c:	88 10                	mov    %dl,(%rax)
+    }
+    (void) color;
+}
+  20132e:	90                   	nop
+  20132f:	c9                   	leave
+  201330:	c3                   	ret
+
+0000000000201331 <vsnprintf>:
+
+int vsnprintf(char* s, size_t size, const char* format, va_list val) {
+  201331:	55                   	push   %rbp
+  201332:	48 89 e5             	mov    %rsp,%rbp
+  201335:	48 83 ec 40          	sub    $0x40,%rsp
+  201339:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  20133d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  201341:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  201345:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+    string_printer sp;
+    sp.p.putc = string_putc;
+  201349:	48 8d 05 93 ff ff ff 	lea    -0x6d(%rip),%rax        # 2012e3 <string_putc>
+  201350:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    sp.s = s;
+  201354:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  201358:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (size) {
+  20135c:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  201361:	74 33                	je     201396 <vsnprintf+0x65>
+        sp.end = s + size - 1;
+  201363:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  201367:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  20136b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  20136f:	48 01 d0             	add    %rdx,%rax
+  201372:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+        printer_vprintf(&sp.p, 0, format, val);
+  201376:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  20137a:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  20137e:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  201382:	be 00 00 00 00       	mov    $0x0,%esi
+  201387:	48 89 c7             	mov    %rax,%rdi
+  20138a:	e8 95 f2 ff ff       	call   200624 <printer_vprintf>
+        *sp.s = 0;
+  20138f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  201393:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return sp.s - s;
+  201396:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  20139a:	48 2b 45 d8          	sub    -0x28(%rbp),%rax
+}
+  20139e:	c9                   	leave
+  20139f:	c3                   	ret
+
+00000000002013a0 <snprintf>:
+
+int snprintf(char* s, size_t size, const char* format, ...) {
+  2013a0:	55                   	push   %rbp
+  2013a1:	48 89 e5             	mov    %rsp,%rbp
+  2013a4:	48 83 ec 70          	sub    $0x70,%rsp
+  2013a8:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  2013ac:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  2013b0:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  2013b4:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  2013b8:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  2013bc:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list val;
+    va_start(val, format);
+  2013c0:	c7 45 b0 18 00 00 00 	movl   $0x18,-0x50(%rbp)
+  2013c7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  2013cb:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  2013cf:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  2013d3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    int n = vsnprintf(s, size, format, val);
+  2013d7:	48 8d 4d b0          	lea    -0x50(%rbp),%rcx
+  2013db:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  2013df:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  2013e3:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  2013e7:	48 89 c7             	mov    %rax,%rdi
+  2013ea:	e8 42 ff ff ff       	call   201331 <vsnprintf>
+  2013ef:	89 45 cc             	mov    %eax,-0x34(%rbp)
+    va_end(val);
+    return n;
+  2013f2:	8b 45 cc             	mov    -0x34(%rbp),%eax
+}
+  2013f5:	c9                   	leave
+  2013f6:	c3                   	ret
+
+00000000002013f7 <console_clear>:
+
+
+// console_clear
+//    Erases the console and moves the cursor to the upper left (CPOS(0, 0)).
+
+void console_clear(void) {
+  2013f7:	55                   	push   %rbp
+  2013f8:	48 89 e5             	mov    %rsp,%rbp
+  2013fb:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < CONSOLE_ROWS * CONSOLE_COLUMNS; ++i) {
+  2013ff:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  201406:	eb 1a                	jmp    201422 <console_clear+0x2b>
+        console[i] = ' ' | 0x0700;
+  201408:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  20140b:	48 98                	cltq
+  20140d:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  201411:	48 8d 05 e8 6b eb ff 	lea    -0x149418(%rip),%rax        # b8000 <console>
+  201418:	66 c7 04 02 20 07    	movw   $0x720,(%rdx,%rax,1)
+    for (int i = 0; i < CONSOLE_ROWS * CONSOLE_COLUMNS; ++i) {
+  20141e:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  201422:	81 7d fc cf 07 00 00 	cmpl   $0x7cf,-0x4(%rbp)
+  201429:	7e dd                	jle    201408 <console_clear+0x11>
+    }
+    cursorpos = 0;
+  20142b:	c7 05 c7 7b eb ff 00 	movl   $0x0,-0x148439(%rip)        # b8ffc <cursorpos>
+  201432:	00 00 00 
+}
+  201435:	90                   	nop
+  201436:	c9                   	leave
+  201437:	c3                   	ret
+
+0000000000201438 <string_to_char>:
+
+
+int string_to_char(const char *str, int *dest) {
+  201438:	55                   	push   %rbp
+  201439:	48 89 e5             	mov    %rsp,%rbp
+  20143c:	48 83 ec 20          	sub    $0x20,%rsp
+  201440:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  201444:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    if (*str == '\0') return -1;
+  201448:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20144c:	0f b6 00             	movzbl (%rax),%eax
+  20144f:	84 c0                	test   %al,%al
+  201451:	75 0a                	jne    20145d <string_to_char+0x25>
+  201453:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  201458:	e9 e0 00 00 00       	jmp    20153d <string_to_char+0x105>
+
+    *dest = 0;
+  20145d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  201461:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    for (; *str; str++) {
+  201467:	e9 bd 00 00 00       	jmp    201529 <string_to_char+0xf1>
+        int digit = 0;
+  20146c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+        switch (*str)
+  201473:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201477:	0f b6 00             	movzbl (%rax),%eax
+  20147a:	0f be c0             	movsbl %al,%eax
+  20147d:	83 e8 30             	sub    $0x30,%eax
+  201480:	83 f8 09             	cmp    $0x9,%eax
+  201483:	77 7c                	ja     201501 <string_to_char+0xc9>
+  201485:	89 c0                	mov    %eax,%eax
+  201487:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  20148e:	00 
+  20148f:	48 8d 05 fe 0c 00 00 	lea    0xcfe(%rip),%rax        # 202194 <flag_chars+0xf4>
+  201496:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+  201499:	48 98                	cltq
+  20149b:	48 8d 15 f2 0c 00 00 	lea    0xcf2(%rip),%rdx        # 202194 <flag_chars+0xf4>
+  2014a2:	48 01 d0             	add    %rdx,%rax
+  2014a5:	ff e0                	jmp    *%rax
+        {
+        case '0':
+            digit = 0;
+  2014a7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+            break;
+  2014ae:	eb 58                	jmp    201508 <string_to_char+0xd0>
+        case '1':
+            digit = 1;
+  2014b0:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+            break;
+  2014b7:	eb 4f                	jmp    201508 <string_to_char+0xd0>
+        case '2':
+            digit = 2;
+  2014b9:	c7 45 fc 02 00 00 00 	movl   $0x2,-0x4(%rbp)
+            break;
+  2014c0:	eb 46                	jmp    201508 <string_to_char+0xd0>
+        case '3':
+            digit = 3;
+  2014c2:	c7 45 fc 03 00 00 00 	movl   $0x3,-0x4(%rbp)
+            break;
+  2014c9:	eb 3d                	jmp    201508 <string_to_char+0xd0>
+        case '4':
+            digit = 4;
+  2014cb:	c7 45 fc 04 00 00 00 	movl   $0x4,-0x4(%rbp)
+            break;
+  2014d2:	eb 34                	jmp    201508 <string_to_char+0xd0>
+        case '5':
+            digit = 5;
+  2014d4:	c7 45 fc 05 00 00 00 	movl   $0x5,-0x4(%rbp)
+            break;
+  2014db:	eb 2b                	jmp    201508 <string_to_char+0xd0>
+        case '6':
+            digit = 6;
+  2014dd:	c7 45 fc 06 00 00 00 	movl   $0x6,-0x4(%rbp)
+            break;
+  2014e4:	eb 22                	jmp    201508 <string_to_char+0xd0>
+        case '7':
+            digit = 7;
+  2014e6:	c7 45 fc 07 00 00 00 	movl   $0x7,-0x4(%rbp)
+            break;
+  2014ed:	eb 19                	jmp    201508 <string_to_char+0xd0>
+        case '8':
+            digit = 8;
+  2014ef:	c7 45 fc 08 00 00 00 	movl   $0x8,-0x4(%rbp)
+            break;
+  2014f6:	eb 10                	jmp    201508 <string_to_char+0xd0>
+        case '9':
+            digit = 9;
+  2014f8:	c7 45 fc 09 00 00 00 	movl   $0x9,-0x4(%rbp)
+            break;
+  2014ff:	eb 07                	jmp    201508 <string_to_char+0xd0>
+        default:
+            return -1;
+  201501:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  201506:	eb 35                	jmp    20153d <string_to_char+0x105>
+        }
+
+        *dest = *dest * 10 + digit;
+  201508:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  20150c:	8b 10                	mov    (%rax),%edx
+  20150e:	89 d0                	mov    %edx,%eax
+  201510:	c1 e0 02             	shl    $0x2,%eax
+  201513:	01 d0                	add    %edx,%eax
+  201515:	01 c0                	add    %eax,%eax
+  201517:	89 c2                	mov    %eax,%edx
+  201519:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  20151c:	01 c2                	add    %eax,%edx
+  20151e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  201522:	89 10                	mov    %edx,(%rax)
+    for (; *str; str++) {
+  201524:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  201529:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20152d:	0f b6 00             	movzbl (%rax),%eax
+  201530:	84 c0                	test   %al,%al
+  201532:	0f 85 34 ff ff ff    	jne    20146c <string_to_char+0x34>
+    }
+
+    return 0;
+  201538:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  20153d:	c9                   	leave
+  20153e:	c3                   	ret
+
+000000000020153f <atoi>:
+
+int atoi(const char *str) {
+  20153f:	55                   	push   %rbp
+  201540:	48 89 e5             	mov    %rsp,%rbp
+  201543:	48 83 ec 18          	sub    $0x18,%rsp
+  201547:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    if (*str == '\0') return -1;
+  20154b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20154f:	0f b6 00             	movzbl (%rax),%eax
+  201552:	84 c0                	test   %al,%al
+  201554:	75 0a                	jne    201560 <atoi+0x21>
+  201556:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  20155b:	e9 d7 00 00 00       	jmp    201637 <atoi+0xf8>
+
+    int n = 0;
+  201560:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    for (; *str; str++) {
+  201567:	e9 b7 00 00 00       	jmp    201623 <atoi+0xe4>
+        int digit = 0;
+  20156c:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+        switch (*str)
+  201573:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201577:	0f b6 00             	movzbl (%rax),%eax
+  20157a:	0f be c0             	movsbl %al,%eax
+  20157d:	83 e8 30             	sub    $0x30,%eax
+  201580:	83 f8 09             	cmp    $0x9,%eax
+  201583:	77 7c                	ja     201601 <atoi+0xc2>
+  201585:	89 c0                	mov    %eax,%eax
+  201587:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  20158e:	00 
+  20158f:	48 8d 05 26 0c 00 00 	lea    0xc26(%rip),%rax        # 2021bc <flag_chars+0x11c>
+  201596:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+  201599:	48 98                	cltq
+  20159b:	48 8d 15 1a 0c 00 00 	lea    0xc1a(%rip),%rdx        # 2021bc <flag_chars+0x11c>
+  2015a2:	48 01 d0             	add    %rdx,%rax
+  2015a5:	ff e0                	jmp    *%rax
+        {
+        case '0':
+            digit = 0;
+  2015a7:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+            break;
+  2015ae:	eb 58                	jmp    201608 <atoi+0xc9>
+        case '1':
+            digit = 1;
+  2015b0:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+            break;
+  2015b7:	eb 4f                	jmp    201608 <atoi+0xc9>
+        case '2':
+            digit = 2;
+  2015b9:	c7 45 f8 02 00 00 00 	movl   $0x2,-0x8(%rbp)
+            break;
+  2015c0:	eb 46                	jmp    201608 <atoi+0xc9>
+        case '3':
+            digit = 3;
+  2015c2:	c7 45 f8 03 00 00 00 	movl   $0x3,-0x8(%rbp)
+            break;
+  2015c9:	eb 3d                	jmp    201608 <atoi+0xc9>
+        case '4':
+            digit = 4;
+  2015cb:	c7 45 f8 04 00 00 00 	movl   $0x4,-0x8(%rbp)
+            break;
+  2015d2:	eb 34                	jmp    201608 <atoi+0xc9>
+        case '5':
+            digit = 5;
+  2015d4:	c7 45 f8 05 00 00 00 	movl   $0x5,-0x8(%rbp)
+            break;
+  2015db:	eb 2b                	jmp    201608 <atoi+0xc9>
+        case '6':
+            digit = 6;
+  2015dd:	c7 45 f8 06 00 00 00 	movl   $0x6,-0x8(%rbp)
+            break;
+  2015e4:	eb 22                	jmp    201608 <atoi+0xc9>
+        case '7':
+            digit = 7;
+  2015e6:	c7 45 f8 07 00 00 00 	movl   $0x7,-0x8(%rbp)
+            break;
+  2015ed:	eb 19                	jmp    201608 <atoi+0xc9>
+        case '8':
+            digit = 8;
+  2015ef:	c7 45 f8 08 00 00 00 	movl   $0x8,-0x8(%rbp)
+            break;
+  2015f6:	eb 10                	jmp    201608 <atoi+0xc9>
+        case '9':
+            digit = 9;
+  2015f8:	c7 45 f8 09 00 00 00 	movl   $0x9,-0x8(%rbp)
+            break;
+  2015ff:	eb 07                	jmp    201608 <atoi+0xc9>
+        default:
+            return -1;
+  201601:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  201606:	eb 2f                	jmp    201637 <atoi+0xf8>
+        }
+
+        n = n * 10 + digit;
+  201608:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  20160b:	89 d0                	mov    %edx,%eax
+  20160d:	c1 e0 02             	shl    $0x2,%eax
+  201610:	01 d0                	add    %edx,%eax
+  201612:	01 c0                	add    %eax,%eax
+  201614:	89 c2                	mov    %eax,%edx
+  201616:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  201619:	01 d0                	add    %edx,%eax
+  20161b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    for (; *str; str++) {
+  20161e:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  201623:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201627:	0f b6 00             	movzbl (%rax),%eax
+  20162a:	84 c0                	test   %al,%al
+  20162c:	0f 85 3a ff ff ff    	jne    20156c <atoi+0x2d>
+    }
+
+    return 0;
+  201632:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  201637:	c9                   	leave
+  201638:	c3                   	ret
+
+0000000000201639 <copy_comp>:
+        components[ncomp++] = (comp); \
+    } \
+} while (0)
+
+// Helper to copy a component to dst
+void copy_comp(const char *start, const char *end, char **pdst) {
+  201639:	55                   	push   %rbp
+  20163a:	48 89 e5             	mov    %rsp,%rbp
+  20163d:	48 83 ec 18          	sub    $0x18,%rsp
+  201641:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  201645:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  201649:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    while (start < end) {
+  20164d:	eb 23                	jmp    201672 <copy_comp+0x39>
+        *(*pdst)++ = *start++;
+  20164f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  201653:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  201657:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  20165b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20165f:	48 8b 00             	mov    (%rax),%rax
+  201662:	48 8d 70 01          	lea    0x1(%rax),%rsi
+  201666:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  20166a:	48 89 31             	mov    %rsi,(%rcx)
+  20166d:	0f b6 12             	movzbl (%rdx),%edx
+  201670:	88 10                	mov    %dl,(%rax)
+    while (start < end) {
+  201672:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  201676:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  20167a:	72 d3                	jb     20164f <copy_comp+0x16>
+    }
+}
+  20167c:	90                   	nop
+  20167d:	90                   	nop
+  20167e:	c9                   	leave
+  20167f:	c3                   	ret
+
+0000000000201680 <join_path>:
+
+
+void join_path(const char *abs_path, const char *path, char *dst) {
+  201680:	55                   	push   %rbp
+  201681:	48 89 e5             	mov    %rsp,%rbp
+  201684:	48 81 ec 68 02 00 00 	sub    $0x268,%rsp
+  20168b:	48 89 bd a8 fd ff ff 	mov    %rdi,-0x258(%rbp)
+  201692:	48 89 b5 a0 fd ff ff 	mov    %rsi,-0x260(%rbp)
+  201699:	48 89 95 98 fd ff ff 	mov    %rdx,-0x268(%rbp)
+    // If path is absolute, just copy it to dst (removing duplicate slashes, and trailing slash unless root)
+    if (path[0] == '/') {
+  2016a0:	48 8b 85 a0 fd ff ff 	mov    -0x260(%rbp),%rax
+  2016a7:	0f b6 00             	movzbl (%rax),%eax
+  2016aa:	3c 2f                	cmp    $0x2f,%al
+  2016ac:	0f 85 d6 00 00 00    	jne    201788 <join_path+0x108>
+        const char *src = path;
+  2016b2:	48 8b 85 a0 fd ff ff 	mov    -0x260(%rbp),%rax
+  2016b9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+        char *d = dst;
+  2016bd:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  2016c4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+        // Always start with a single slash
+        *d++ = '/';
+  2016c8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2016cc:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  2016d0:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  2016d4:	c6 00 2f             	movb   $0x2f,(%rax)
+        src++;
+  2016d7:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+        int last_was_slash = 1;
+  2016dc:	c7 45 b0 01 00 00 00 	movl   $0x1,-0x50(%rbp)
+        while (*src) {
+  2016e3:	eb 64                	jmp    201749 <join_path+0xc9>
+            if (*src == '/') {
+  2016e5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2016e9:	0f b6 00             	movzbl (%rax),%eax
+  2016ec:	3c 2f                	cmp    $0x2f,%al
+  2016ee:	75 35                	jne    201725 <join_path+0xa5>
+                // Skip consecutive slashes
+                while (*src == '/') src++;
+  2016f0:	eb 05                	jmp    2016f7 <join_path+0x77>
+  2016f2:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  2016f7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2016fb:	0f b6 00             	movzbl (%rax),%eax
+  2016fe:	3c 2f                	cmp    $0x2f,%al
+  201700:	74 f0                	je     2016f2 <join_path+0x72>
+                if (*src == 0) break;
+  201702:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  201706:	0f b6 00             	movzbl (%rax),%eax
+  201709:	84 c0                	test   %al,%al
+  20170b:	74 49                	je     201756 <join_path+0xd6>
+                *d++ = '/';
+  20170d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  201711:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  201715:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  201719:	c6 00 2f             	movb   $0x2f,(%rax)
+                last_was_slash = 1;
+  20171c:	c7 45 b0 01 00 00 00 	movl   $0x1,-0x50(%rbp)
+  201723:	eb 24                	jmp    201749 <join_path+0xc9>
+            } else {
+                *d++ = *src++;
+  201725:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  201729:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  20172d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  201731:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  201735:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  201739:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  20173d:	0f b6 12             	movzbl (%rdx),%edx
+  201740:	88 10                	mov    %dl,(%rax)
+                last_was_slash = 0;
+  201742:	c7 45 b0 00 00 00 00 	movl   $0x0,-0x50(%rbp)
+        while (*src) {
+  201749:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20174d:	0f b6 00             	movzbl (%rax),%eax
+  201750:	84 c0                	test   %al,%al
+  201752:	75 91                	jne    2016e5 <join_path+0x65>
+  201754:	eb 01                	jmp    201757 <join_path+0xd7>
+                if (*src == 0) break;
+  201756:	90                   	nop
+            }
+        }
+        // Remove trailing slash unless the path is just "/"
+        if (d > dst + 1 && *(d-1) == '/') {
+  201757:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  20175e:	48 83 c0 01          	add    $0x1,%rax
+  201762:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  201766:	73 14                	jae    20177c <join_path+0xfc>
+  201768:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  20176c:	48 83 e8 01          	sub    $0x1,%rax
+  201770:	0f b6 00             	movzbl (%rax),%eax
+  201773:	3c 2f                	cmp    $0x2f,%al
+  201775:	75 05                	jne    20177c <join_path+0xfc>
+            d--;
+  201777:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+        }
+        *d = 0;
+  20177c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  201780:	c6 00 00             	movb   $0x0,(%rax)
+  201783:	e9 e9 02 00 00       	jmp    201a71 <join_path+0x3f1>
+        return;
+    }
+
+    // Otherwise, start with abs_path
+    const char *src = abs_path;
+  201788:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  20178f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    char *d = dst;
+  201793:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  20179a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    if (*src != '/') {
+  20179e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2017a2:	0f b6 00             	movzbl (%rax),%eax
+  2017a5:	3c 2f                	cmp    $0x2f,%al
+  2017a7:	74 2e                	je     2017d7 <join_path+0x157>
+        *d++ = '/';
+  2017a9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  2017ad:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  2017b1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  2017b5:	c6 00 2f             	movb   $0x2f,(%rax)
+    }
+    while (*src) {
+  2017b8:	eb 1d                	jmp    2017d7 <join_path+0x157>
+        *d++ = *src++;
+  2017ba:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  2017be:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  2017c2:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  2017c6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  2017ca:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  2017ce:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  2017d2:	0f b6 12             	movzbl (%rdx),%edx
+  2017d5:	88 10                	mov    %dl,(%rax)
+    while (*src) {
+  2017d7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2017db:	0f b6 00             	movzbl (%rax),%eax
+  2017de:	84 c0                	test   %al,%al
+  2017e0:	75 d8                	jne    2017ba <join_path+0x13a>
+    }
+    // Remove trailing slash (unless root)
+    if (d > dst + 1 && *(d-1) == '/') {
+  2017e2:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  2017e9:	48 83 c0 01          	add    $0x1,%rax
+  2017ed:	48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+  2017f1:	73 14                	jae    201807 <join_path+0x187>
+  2017f3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  2017f7:	48 83 e8 01          	sub    $0x1,%rax
+  2017fb:	0f b6 00             	movzbl (%rax),%eax
+  2017fe:	3c 2f                	cmp    $0x2f,%al
+  201800:	75 05                	jne    201807 <join_path+0x187>
+        d--;
+  201802:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+    }
+    *d = 0;
+  201807:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  20180b:	c6 00 00             	movb   $0x0,(%rax)
+
+    // Now, process path components
+    char temp[512];
+    int tlen = 0;
+  20180e:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    // Copy dst to temp for easier manipulation
+    src = dst;
+  201815:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  20181c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    while (*src && tlen < (int)sizeof(temp)-1) {
+  201820:	eb 22                	jmp    201844 <join_path+0x1c4>
+        temp[tlen++] = *src++;
+  201822:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201826:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  20182a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  20182e:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  201831:	8d 4a 01             	lea    0x1(%rdx),%ecx
+  201834:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  201837:	0f b6 08             	movzbl (%rax),%ecx
+  20183a:	48 63 c2             	movslq %edx,%rax
+  20183d:	88 8c 05 b0 fd ff ff 	mov    %cl,-0x250(%rbp,%rax,1)
+    while (*src && tlen < (int)sizeof(temp)-1) {
+  201844:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201848:	0f b6 00             	movzbl (%rax),%eax
+  20184b:	84 c0                	test   %al,%al
+  20184d:	74 09                	je     201858 <join_path+0x1d8>
+  20184f:	81 7d dc fe 01 00 00 	cmpl   $0x1fe,-0x24(%rbp)
+  201856:	7e ca                	jle    201822 <join_path+0x1a2>
+    }
+    temp[tlen] = 0;
+  201858:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  20185b:	48 98                	cltq
+  20185d:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  201864:	00 
+
+    // Now, process each component in path
+    src = path;
+  201865:	48 8b 85 a0 fd ff ff 	mov    -0x260(%rbp),%rax
+  20186c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    while (*src) {
+  201870:	e9 65 01 00 00       	jmp    2019da <join_path+0x35a>
+        // Skip slashes
+        while (*src == '/') src++;
+  201875:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  20187a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20187e:	0f b6 00             	movzbl (%rax),%eax
+  201881:	3c 2f                	cmp    $0x2f,%al
+  201883:	74 f0                	je     201875 <join_path+0x1f5>
+        if (!*src) break;
+  201885:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201889:	0f b6 00             	movzbl (%rax),%eax
+  20188c:	84 c0                	test   %al,%al
+  20188e:	0f 84 57 01 00 00    	je     2019eb <join_path+0x36b>
+
+        // Find end of component
+        const char *comp_start = src;
+  201894:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201898:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        while (*src && *src != '/') src++;
+  20189c:	eb 05                	jmp    2018a3 <join_path+0x223>
+  20189e:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  2018a3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2018a7:	0f b6 00             	movzbl (%rax),%eax
+  2018aa:	84 c0                	test   %al,%al
+  2018ac:	74 0b                	je     2018b9 <join_path+0x239>
+  2018ae:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2018b2:	0f b6 00             	movzbl (%rax),%eax
+  2018b5:	3c 2f                	cmp    $0x2f,%al
+  2018b7:	75 e5                	jne    20189e <join_path+0x21e>
+        const char *comp_end = src;
+  2018b9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2018bd:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+
+        int comp_len = comp_end - comp_start;
+  2018c1:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  2018c5:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  2018c9:	89 45 b4             	mov    %eax,-0x4c(%rbp)
+
+        // Get component string
+        if (comp_len == 1 && comp_start[0] == '.') {
+  2018cc:	83 7d b4 01          	cmpl   $0x1,-0x4c(%rbp)
+  2018d0:	75 10                	jne    2018e2 <join_path+0x262>
+  2018d2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  2018d6:	0f b6 00             	movzbl (%rax),%eax
+  2018d9:	3c 2e                	cmp    $0x2e,%al
+  2018db:	75 05                	jne    2018e2 <join_path+0x262>
+            // Ignore
+            continue;
+  2018dd:	e9 f8 00 00 00       	jmp    2019da <join_path+0x35a>
+        } else if (comp_len == 2 && comp_start[0] == '.' && comp_start[1] == '.') {
+  2018e2:	83 7d b4 02          	cmpl   $0x2,-0x4c(%rbp)
+  2018e6:	75 6e                	jne    201956 <join_path+0x2d6>
+  2018e8:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  2018ec:	0f b6 00             	movzbl (%rax),%eax
+  2018ef:	3c 2e                	cmp    $0x2e,%al
+  2018f1:	75 63                	jne    201956 <join_path+0x2d6>
+  2018f3:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  2018f7:	48 83 c0 01          	add    $0x1,%rax
+  2018fb:	0f b6 00             	movzbl (%rax),%eax
+  2018fe:	3c 2e                	cmp    $0x2e,%al
+  201900:	75 54                	jne    201956 <join_path+0x2d6>
+            // Go up one directory, unless at root
+            if (tlen > 1) {
+  201902:	83 7d dc 01          	cmpl   $0x1,-0x24(%rbp)
+  201906:	0f 8e ce 00 00 00    	jle    2019da <join_path+0x35a>
+                // Remove trailing slash if any
+                if (temp[tlen-1] == '/') tlen--;
+  20190c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  20190f:	83 e8 01             	sub    $0x1,%eax
+  201912:	48 98                	cltq
+  201914:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  20191b:	ff 
+  20191c:	3c 2f                	cmp    $0x2f,%al
+  20191e:	75 0a                	jne    20192a <join_path+0x2aa>
+  201920:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+                // Remove last component
+                while (tlen > 1 && temp[tlen-1] != '/') tlen--;
+  201924:	eb 04                	jmp    20192a <join_path+0x2aa>
+  201926:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  20192a:	83 7d dc 01          	cmpl   $0x1,-0x24(%rbp)
+  20192e:	7e 14                	jle    201944 <join_path+0x2c4>
+  201930:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201933:	83 e8 01             	sub    $0x1,%eax
+  201936:	48 98                	cltq
+  201938:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  20193f:	ff 
+  201940:	3c 2f                	cmp    $0x2f,%al
+  201942:	75 e2                	jne    201926 <join_path+0x2a6>
+                temp[tlen] = 0;
+  201944:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201947:	48 98                	cltq
+  201949:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  201950:	00 
+            if (tlen > 1) {
+  201951:	e9 84 00 00 00       	jmp    2019da <join_path+0x35a>
+            }
+        } else if (comp_len > 0) {
+  201956:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  20195a:	7e 7e                	jle    2019da <join_path+0x35a>
+            // Add slash if not at root
+            if (tlen == 0 || temp[tlen-1] != '/') {
+  20195c:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  201960:	74 14                	je     201976 <join_path+0x2f6>
+  201962:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201965:	83 e8 01             	sub    $0x1,%eax
+  201968:	48 98                	cltq
+  20196a:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  201971:	ff 
+  201972:	3c 2f                	cmp    $0x2f,%al
+  201974:	74 1c                	je     201992 <join_path+0x312>
+                if (tlen < (int)sizeof(temp)-1) temp[tlen++] = '/';
+  201976:	81 7d dc fe 01 00 00 	cmpl   $0x1fe,-0x24(%rbp)
+  20197d:	7f 13                	jg     201992 <join_path+0x312>
+  20197f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201982:	8d 50 01             	lea    0x1(%rax),%edx
+  201985:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  201988:	48 98                	cltq
+  20198a:	c6 84 05 b0 fd ff ff 	movb   $0x2f,-0x250(%rbp,%rax,1)
+  201991:	2f 
+            }
+            // Copy component
+            for (const char *p = comp_start; p < comp_end && tlen < (int)sizeof(temp)-1; ++p) {
+  201992:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  201996:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  20199a:	eb 1e                	jmp    2019ba <join_path+0x33a>
+                temp[tlen++] = *p;
+  20199c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  20199f:	8d 50 01             	lea    0x1(%rax),%edx
+  2019a2:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  2019a5:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  2019a9:	0f b6 12             	movzbl (%rdx),%edx
+  2019ac:	48 98                	cltq
+  2019ae:	88 94 05 b0 fd ff ff 	mov    %dl,-0x250(%rbp,%rax,1)
+            for (const char *p = comp_start; p < comp_end && tlen < (int)sizeof(temp)-1; ++p) {
+  2019b5:	48 83 45 d0 01       	addq   $0x1,-0x30(%rbp)
+  2019ba:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  2019be:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  2019c2:	73 09                	jae    2019cd <join_path+0x34d>
+  2019c4:	81 7d dc fe 01 00 00 	cmpl   $0x1fe,-0x24(%rbp)
+  2019cb:	7e cf                	jle    20199c <join_path+0x31c>
+            }
+            temp[tlen] = 0;
+  2019cd:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  2019d0:	48 98                	cltq
+  2019d2:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  2019d9:	00 
+    while (*src) {
+  2019da:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2019de:	0f b6 00             	movzbl (%rax),%eax
+  2019e1:	84 c0                	test   %al,%al
+  2019e3:	0f 85 91 fe ff ff    	jne    20187a <join_path+0x1fa>
+  2019e9:	eb 01                	jmp    2019ec <join_path+0x36c>
+        if (!*src) break;
+  2019eb:	90                   	nop
+        }
+    }
+
+    // If temp is empty, set to "/"
+    if (tlen == 0) {
+  2019ec:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  2019f0:	75 20                	jne    201a12 <join_path+0x392>
+        temp[tlen++] = '/';
+  2019f2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  2019f5:	8d 50 01             	lea    0x1(%rax),%edx
+  2019f8:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  2019fb:	48 98                	cltq
+  2019fd:	c6 84 05 b0 fd ff ff 	movb   $0x2f,-0x250(%rbp,%rax,1)
+  201a04:	2f 
+        temp[tlen] = 0;
+  201a05:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201a08:	48 98                	cltq
+  201a0a:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  201a11:	00 
+    }
+
+    // Remove trailing slash unless the path is just "/"
+    if (tlen > 1 && temp[tlen-1] == '/') {
+  201a12:	83 7d dc 01          	cmpl   $0x1,-0x24(%rbp)
+  201a16:	7e 25                	jle    201a3d <join_path+0x3bd>
+  201a18:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201a1b:	83 e8 01             	sub    $0x1,%eax
+  201a1e:	48 98                	cltq
+  201a20:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  201a27:	ff 
+  201a28:	3c 2f                	cmp    $0x2f,%al
+  201a2a:	75 11                	jne    201a3d <join_path+0x3bd>
+        temp[--tlen] = 0;
+  201a2c:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  201a30:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201a33:	48 98                	cltq
+  201a35:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  201a3c:	00 
+    }
+
+    // Copy temp to dst
+    for (int i = 0; i <= tlen; ++i) {
+  201a3d:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  201a44:	eb 23                	jmp    201a69 <join_path+0x3e9>
+        dst[i] = temp[i];
+  201a46:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  201a49:	48 63 d0             	movslq %eax,%rdx
+  201a4c:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  201a53:	48 01 c2             	add    %rax,%rdx
+  201a56:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  201a59:	48 98                	cltq
+  201a5b:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  201a62:	ff 
+  201a63:	88 02                	mov    %al,(%rdx)
+    for (int i = 0; i <= tlen; ++i) {
+  201a65:	83 45 cc 01          	addl   $0x1,-0x34(%rbp)
+  201a69:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  201a6c:	3b 45 dc             	cmp    -0x24(%rbp),%eax
+  201a6f:	7e d5                	jle    201a46 <join_path+0x3c6>
+    }
+}
+  201a71:	c9                   	leave
+  201a72:	c3                   	ret
+
+0000000000201a73 <app_printf>:
+#include "lib-malloc.h"
+#include "errno.h"
+// app_printf
+//     A version of console_printf that picks a sensible color by process ID.
+
+void app_printf(int colorid, const char* format, ...) {
+  201a73:	55                   	push   %rbp
+  201a74:	48 89 e5             	mov    %rsp,%rbp
+  201a77:	48 83 ec 50          	sub    $0x50,%rsp
+  201a7b:	49 89 f2             	mov    %rsi,%r10
+  201a7e:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  201a82:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  201a86:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  201a8a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    int color;
+    if (colorid < 0) {
+        color = 0x0700;
+  201a8e:	be 00 07 00 00       	mov    $0x700,%esi
+    if (colorid < 0) {
+  201a93:	85 ff                	test   %edi,%edi
+  201a95:	78 32                	js     201ac9 <app_printf+0x56>
+    } else {
+        static const uint8_t col[] = { 0x0F, 0x0C, 0x0A, 0x09, 0x0E };
+        color = col[colorid % sizeof(col)] << 8;
+  201a97:	48 63 ff             	movslq %edi,%rdi
+  201a9a:	48 ba cd cc cc cc cc 	movabs $0xcccccccccccccccd,%rdx
+  201aa1:	cc cc cc 
+  201aa4:	48 89 f8             	mov    %rdi,%rax
+  201aa7:	48 f7 e2             	mul    %rdx
+  201aaa:	48 89 d0             	mov    %rdx,%rax
+  201aad:	48 c1 e8 02          	shr    $0x2,%rax
+  201ab1:	48 83 e2 fc          	and    $0xfffffffffffffffc,%rdx
+  201ab5:	48 01 c2             	add    %rax,%rdx
+  201ab8:	48 29 d7             	sub    %rdx,%rdi
+  201abb:	48 8d 05 26 09 00 00 	lea    0x926(%rip),%rax        # 2023e8 <col.0>
+  201ac2:	0f b6 34 38          	movzbl (%rax,%rdi,1),%esi
+  201ac6:	c1 e6 08             	shl    $0x8,%esi
+    }
+
+    va_list val;
+    va_start(val, format);
+  201ac9:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  201ad0:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  201ad4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  201ad8:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  201adc:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    cursorpos = console_vprintf(cursorpos, color, format, val);
+  201ae0:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  201ae4:	4c 89 d2             	mov    %r10,%rdx
+  201ae7:	8b 3d 0f 75 eb ff    	mov    -0x148af1(%rip),%edi        # b8ffc <cursorpos>
+  201aed:	e8 24 f7 ff ff       	call   201216 <console_vprintf>
+  201af2:	89 05 04 75 eb ff    	mov    %eax,-0x148afc(%rip)        # b8ffc <cursorpos>
+    va_end(val);
+
+    /*if (CROW(cursorpos) >= 23) {
+        cursorpos = CPOS(0, 0);
+    }*/
+}
+  201af8:	c9                   	leave
+  201af9:	c3                   	ret
+
+0000000000201afa <panic>:
+
+
+// panic, assert_fail
+//     Call the INT_SYS_PANIC system call so the kernel loops until Control-C.
+
+void panic(const char* format, ...) {
+  201afa:	55                   	push   %rbp
+  201afb:	48 89 e5             	mov    %rsp,%rbp
+  201afe:	53                   	push   %rbx
+  201aff:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  201b06:	48 89 fb             	mov    %rdi,%rbx
+  201b09:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  201b0d:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  201b11:	48 89 4d d8          	mov    %rcx,-0x28(%rbp)
+  201b15:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  201b19:	4c 89 4d e8          	mov    %r9,-0x18(%rbp)
+    va_list val;
+    va_start(val, format);
+  201b1d:	c7 45 a8 08 00 00 00 	movl   $0x8,-0x58(%rbp)
+  201b24:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  201b28:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  201b2c:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  201b30:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    char buf[160];
+    memcpy(buf, "PANIC: ", 7);
+  201b34:	48 8d bd 08 ff ff ff 	lea    -0xf8(%rbp),%rdi
+  201b3b:	ba 07 00 00 00       	mov    $0x7,%edx
+  201b40:	48 8d 35 da 06 00 00 	lea    0x6da(%rip),%rsi        # 202221 <lower_digits.0+0x11>
+  201b47:	e8 31 e5 ff ff       	call   20007d <memcpy>
+    int len = vsnprintf(&buf[7], sizeof(buf) - 7, format, val) + 7;
+  201b4c:	48 8d 4d a8          	lea    -0x58(%rbp),%rcx
+  201b50:	48 8d bd 0f ff ff ff 	lea    -0xf1(%rbp),%rdi
+  201b57:	48 89 da             	mov    %rbx,%rdx
+  201b5a:	be 99 00 00 00       	mov    $0x99,%esi
+  201b5f:	e8 cd f7 ff ff       	call   201331 <vsnprintf>
+  201b64:	8d 50 07             	lea    0x7(%rax),%edx
+    va_end(val);
+    if (len > 0 && buf[len - 1] != '\n') {
+  201b67:	85 d2                	test   %edx,%edx
+  201b69:	7e 0f                	jle    201b7a <panic+0x80>
+  201b6b:	83 c0 06             	add    $0x6,%eax
+  201b6e:	48 98                	cltq
+  201b70:	80 bc 05 08 ff ff ff 	cmpb   $0xa,-0xf8(%rbp,%rax,1)
+  201b77:	0a 
+  201b78:	75 30                	jne    201baa <panic+0xb0>
+        strcpy(buf + len - (len == (int) sizeof(buf) - 1), "\n");
+    }
+    (void) console_printf(CPOS(23, 0), 0xC000, "%s", buf);
+  201b7a:	48 8d 8d 08 ff ff ff 	lea    -0xf8(%rbp),%rcx
+  201b81:	48 8d 15 c8 04 00 00 	lea    0x4c8(%rip),%rdx        # 202050 <malloc+0x8e>
+  201b88:	be 00 c0 00 00       	mov    $0xc000,%esi
+  201b8d:	bf 30 07 00 00       	mov    $0x730,%edi
+  201b92:	b8 00 00 00 00       	mov    $0x0,%eax
+  201b97:	e8 f5 f6 ff ff       	call   201291 <console_printf>
+    asm volatile ("syscall" : "=a" (rax)
+  201b9c:	b8 30 00 00 00       	mov    $0x30,%eax
+  201ba1:	bf 00 00 00 00       	mov    $0x0,%edi
+  201ba6:	0f 05                	syscall
+ loop: goto loop;
+  201ba8:	eb fe                	jmp    201ba8 <panic+0xae>
+        strcpy(buf + len - (len == (int) sizeof(buf) - 1), "\n");
+  201baa:	48 63 c2             	movslq %edx,%rax
+  201bad:	81 fa 9f 00 00 00    	cmp    $0x9f,%edx
+  201bb3:	0f 94 c2             	sete   %dl
+  201bb6:	0f b6 d2             	movzbl %dl,%edx
+  201bb9:	48 29 d0             	sub    %rdx,%rax
+  201bbc:	48 8d bc 05 08 ff ff 	lea    -0xf8(%rbp,%rax,1),%rdi
+  201bc3:	ff 
+  201bc4:	48 8d 35 36 07 00 00 	lea    0x736(%rip),%rsi        # 202301 <lower_digits.0+0xf1>
+  201bcb:	e8 3b e8 ff ff       	call   20040b <strcpy>
+  201bd0:	eb a8                	jmp    201b7a <panic+0x80>
+
+0000000000201bd2 <raise>:
+
+#define SIGABRT -1
+
+
+
+int raise(int sig) {
+  201bd2:	89 fe                	mov    %edi,%esi
+
+// getpid()
+//    Return current process ID, like sys_getpid().
+static inline pid_t getpid(void) {
+    return vdso()->pid;
+  201bd4:	8b 3c 25 00 10 24 00 	mov    0x241000,%edi
+    asm volatile ("syscall" : "=a" (result)
+  201bdb:	b8 41 00 00 00       	mov    $0x41,%eax
+  201be0:	0f 05                	syscall
+    return sys_kill(getpid(), sig);
+}
+  201be2:	c3                   	ret
+
+0000000000201be3 <abort>:
+    return vdso()->pid;
+  201be3:	8b 3c 25 00 10 24 00 	mov    0x241000,%edi
+    asm volatile ("syscall" : "=a" (result)
+  201bea:	b8 41 00 00 00       	mov    $0x41,%eax
+  201bef:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  201bf4:	0f 05                	syscall
+
+void __attribute((noreturn)) abort(void) {
+    raise(SIGABRT);
+ spinloop: goto spinloop;       // should never get here
+  201bf6:	eb fe                	jmp    201bf6 <abort+0x13>
+
+0000000000201bf8 <assert_fail>:
+}
+
+
+void assert_fail(const char* file, int line, const char* msg) {
+  201bf8:	55                   	push   %rbp
+  201bf9:	48 89 e5             	mov    %rsp,%rbp
+  201bfc:	48 89 f9             	mov    %rdi,%rcx
+  201bff:	41 89 f0             	mov    %esi,%r8d
+  201c02:	49 89 d1             	mov    %rdx,%r9
+    (void) console_printf(CPOS(23, 0), 0xC000,
+  201c05:	48 8d 15 fc 06 00 00 	lea    0x6fc(%rip),%rdx        # 202308 <lower_digits.0+0xf8>
+  201c0c:	be 00 c0 00 00       	mov    $0xc000,%esi
+  201c11:	bf 30 07 00 00       	mov    $0x730,%edi
+  201c16:	b8 00 00 00 00       	mov    $0x0,%eax
+  201c1b:	e8 71 f6 ff ff       	call   201291 <console_printf>
+                          "PANIC: %s:%d: assertion '%s' failed\n",
+                          file, line, msg);
+    abort();
+  201c20:	e8 be ff ff ff       	call   201be3 <abort>
+
+0000000000201c25 <scan_char>:
+    asm volatile ("syscall" : "=a" (result)
+  201c25:	bf 3a 00 00 00       	mov    $0x3a,%edi
+    asm volatile ("syscall" : "=a" (rax)
+  201c2a:	be 3c 00 00 00       	mov    $0x3c,%esi
+    asm volatile ("syscall" : "=a" (result)
+  201c2f:	89 f8                	mov    %edi,%eax
+  201c31:	0f 05                	syscall
+  201c33:	89 c2                	mov    %eax,%edx
+    asm volatile ("syscall" : "=a" (rax)
+  201c35:	89 f0                	mov    %esi,%eax
+  201c37:	0f 05                	syscall
+    int c;
+
+    do {
+        c = sys_keybord();
+        sys_yield();
+    } while (c == -1);
+  201c39:	83 fa ff             	cmp    $0xffffffff,%edx
+  201c3c:	74 f1                	je     201c2f <scan_char+0xa>
+
+    return c;
+  201c3e:	89 d0                	mov    %edx,%eax
+}
+  201c40:	c3                   	ret
+
+0000000000201c41 <scan_line>:
+
+unsigned int scan_line(char* dst, unsigned int length_max) {
+  201c41:	55                   	push   %rbp
+  201c42:	48 89 e5             	mov    %rsp,%rbp
+  201c45:	41 57                	push   %r15
+  201c47:	41 56                	push   %r14
+  201c49:	41 55                	push   %r13
+  201c4b:	41 54                	push   %r12
+  201c4d:	53                   	push   %rbx
+  201c4e:	48 83 ec 08          	sub    $0x8,%rsp
+  201c52:	49 89 fe             	mov    %rdi,%r14
+  201c55:	41 89 f5             	mov    %esi,%r13d
+    unsigned int length = 0;
+  201c58:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            app_printf(0, "%c", c);
+            dst[length] = '\0';
+            return length;
+        } else if (c >= 32 && c <= 127) {
+            if (length < length_max) {
+                app_printf(0, "%c", c);
+  201c5e:	4c 8d 3d c4 05 00 00 	lea    0x5c4(%rip),%r15        # 202229 <lower_digits.0+0x19>
+  201c65:	eb 05                	jmp    201c6c <scan_line+0x2b>
+            if (length != 0) {
+  201c67:	45 85 e4             	test   %r12d,%r12d
+  201c6a:	75 3e                	jne    201caa <scan_line+0x69>
+        unsigned char c = scan_char();
+  201c6c:	e8 b4 ff ff ff       	call   201c25 <scan_char>
+  201c71:	89 c3                	mov    %eax,%ebx
+        if (c == '\b') {
+  201c73:	3c 08                	cmp    $0x8,%al
+  201c75:	74 f0                	je     201c67 <scan_line+0x26>
+        } else if (c == '\n') {
+  201c77:	3c 0a                	cmp    $0xa,%al
+  201c79:	74 4c                	je     201cc7 <scan_line+0x86>
+        } else if (c >= 32 && c <= 127) {
+  201c7b:	8d 43 e0             	lea    -0x20(%rbx),%eax
+            if (length < length_max) {
+  201c7e:	3c 5f                	cmp    $0x5f,%al
+  201c80:	77 ea                	ja     201c6c <scan_line+0x2b>
+  201c82:	45 39 ec             	cmp    %r13d,%r12d
+  201c85:	73 e5                	jae    201c6c <scan_line+0x2b>
+                app_printf(0, "%c", c);
+  201c87:	0f b6 d3             	movzbl %bl,%edx
+  201c8a:	4c 89 fe             	mov    %r15,%rsi
+  201c8d:	bf 00 00 00 00       	mov    $0x0,%edi
+  201c92:	b8 00 00 00 00       	mov    $0x0,%eax
+  201c97:	e8 d7 fd ff ff       	call   201a73 <app_printf>
+                dst[length++] = c;
+  201c9c:	44 89 e0             	mov    %r12d,%eax
+  201c9f:	41 88 1c 06          	mov    %bl,(%r14,%rax,1)
+  201ca3:	45 8d 64 24 01       	lea    0x1(%r12),%r12d
+  201ca8:	eb c2                	jmp    201c6c <scan_line+0x2b>
+                app_printf(0, "%c", c);
+  201caa:	ba 08 00 00 00       	mov    $0x8,%edx
+  201caf:	4c 89 fe             	mov    %r15,%rsi
+  201cb2:	bf 00 00 00 00       	mov    $0x0,%edi
+  201cb7:	b8 00 00 00 00       	mov    $0x0,%eax
+  201cbc:	e8 b2 fd ff ff       	call   201a73 <app_printf>
+                length--;
+  201cc1:	41 83 ec 01          	sub    $0x1,%r12d
+  201cc5:	eb a5                	jmp    201c6c <scan_line+0x2b>
+            app_printf(0, "%c", c);
+  201cc7:	ba 0a 00 00 00       	mov    $0xa,%edx
+  201ccc:	48 8d 35 56 05 00 00 	lea    0x556(%rip),%rsi        # 202229 <lower_digits.0+0x19>
+  201cd3:	bf 00 00 00 00       	mov    $0x0,%edi
+  201cd8:	b8 00 00 00 00       	mov    $0x0,%eax
+  201cdd:	e8 91 fd ff ff       	call   201a73 <app_printf>
+            dst[length] = '\0';
+  201ce2:	44 89 e0             	mov    %r12d,%eax
+  201ce5:	41 c6 04 06 00       	movb   $0x0,(%r14,%rax,1)
+            }
+        }
+    }
+}
+  201cea:	44 89 e0             	mov    %r12d,%eax
+  201ced:	48 83 c4 08          	add    $0x8,%rsp
+  201cf1:	5b                   	pop    %rbx
+  201cf2:	41 5c                	pop    %r12
+  201cf4:	41 5d                	pop    %r13
+  201cf6:	41 5e                	pop    %r14
+  201cf8:	41 5f                	pop    %r15
+  201cfa:	5d                   	pop    %rbp
+  201cfb:	c3                   	ret
+
+0000000000201cfc <split_string>:
+
+
+char** split_string(char* str, char sep) {
+  201cfc:	55                   	push   %rbp
+  201cfd:	48 89 e5             	mov    %rsp,%rbp
+  201d00:	41 57                	push   %r15
+  201d02:	41 56                	push   %r14
+  201d04:	41 55                	push   %r13
+  201d06:	41 54                	push   %r12
+  201d08:	53                   	push   %rbx
+  201d09:	48 83 ec 08          	sub    $0x8,%rsp
+    int s = 1;
+    int n = 0;
+
+    while (str[n]) {
+  201d0d:	0f b6 07             	movzbl (%rdi),%eax
+  201d10:	84 c0                	test   %al,%al
+  201d12:	0f 84 ad 00 00 00    	je     201dc5 <split_string+0xc9>
+  201d18:	48 89 fb             	mov    %rdi,%rbx
+  201d1b:	41 89 f4             	mov    %esi,%r12d
+  201d1e:	41 be 01 00 00 00    	mov    $0x1,%r14d
+    int s = 1;
+  201d24:	b9 01 00 00 00       	mov    $0x1,%ecx
+  201d29:	eb 03                	jmp    201d2e <split_string+0x32>
+  201d2b:	49 89 d6             	mov    %rdx,%r14
+        if (str[n] == sep)
+            s++;
+  201d2e:	41 38 c4             	cmp    %al,%r12b
+  201d31:	0f 94 c0             	sete   %al
+  201d34:	0f b6 c0             	movzbl %al,%eax
+  201d37:	01 c1                	add    %eax,%ecx
+    while (str[n]) {
+  201d39:	49 8d 56 01          	lea    0x1(%r14),%rdx
+  201d3d:	0f b6 44 13 ff       	movzbl -0x1(%rbx,%rdx,1),%eax
+  201d42:	84 c0                	test   %al,%al
+  201d44:	75 e5                	jne    201d2b <split_string+0x2f>
+        n++;
+    }
+    
+    char** part = malloc((s+1)*sizeof(char*));
+  201d46:	44 8d 79 01          	lea    0x1(%rcx),%r15d
+  201d4a:	4d 63 ff             	movslq %r15d,%r15
+  201d4d:	49 c1 e7 03          	shl    $0x3,%r15
+  201d51:	4c 89 ff             	mov    %r15,%rdi
+  201d54:	e8 69 02 00 00       	call   201fc2 <malloc>
+  201d59:	49 89 c5             	mov    %rax,%r13
+    char* buffer = malloc(n+1);
+  201d5c:	41 8d 7e 01          	lea    0x1(%r14),%edi
+  201d60:	48 63 ff             	movslq %edi,%rdi
+  201d63:	e8 5a 02 00 00       	call   201fc2 <malloc>
+
+    int word_n = 0;
+    part[0] = buffer;
+  201d68:	49 89 45 00          	mov    %rax,0x0(%r13)
+    part[s] = NULL;
+  201d6c:	4b c7 44 3d f8 00 00 	movq   $0x0,-0x8(%r13,%r15,1)
+  201d73:	00 00 
+    buffer[n] = 0;
+  201d75:	42 c6 04 30 00       	movb   $0x0,(%rax,%r14,1)
+
+    for (int i = 0; i < n; i++) {
+  201d7a:	45 85 f6             	test   %r14d,%r14d
+  201d7d:	7e 6c                	jle    201deb <split_string+0xef>
+  201d7f:	41 83 ee 01          	sub    $0x1,%r14d
+  201d83:	48 89 da             	mov    %rbx,%rdx
+  201d86:	48 83 c0 01          	add    $0x1,%rax
+  201d8a:	48 89 c1             	mov    %rax,%rcx
+    int word_n = 0;
+  201d8d:	bf 00 00 00 00       	mov    $0x0,%edi
+  201d92:	eb 23                	jmp    201db7 <split_string+0xbb>
+        if (str[i] == sep) {
+            buffer[i] = 0;
+  201d94:	c6 41 ff 00          	movb   $0x0,-0x1(%rcx)
+            part[++word_n] = &buffer[i+1];
+  201d98:	83 c7 01             	add    $0x1,%edi
+  201d9b:	48 63 f7             	movslq %edi,%rsi
+  201d9e:	49 89 4c f5 00       	mov    %rcx,0x0(%r13,%rsi,8)
+    for (int i = 0; i < n; i++) {
+  201da3:	48 83 c2 01          	add    $0x1,%rdx
+  201da7:	48 83 c1 01          	add    $0x1,%rcx
+  201dab:	89 ce                	mov    %ecx,%esi
+  201dad:	29 c6                	sub    %eax,%esi
+  201daf:	83 ee 01             	sub    $0x1,%esi
+  201db2:	44 39 f6             	cmp    %r14d,%esi
+  201db5:	7d 34                	jge    201deb <split_string+0xef>
+        if (str[i] == sep) {
+  201db7:	0f b6 32             	movzbl (%rdx),%esi
+  201dba:	44 38 e6             	cmp    %r12b,%sil
+  201dbd:	74 d5                	je     201d94 <split_string+0x98>
+        } else {
+            buffer[i] = str[i];
+  201dbf:	40 88 71 ff          	mov    %sil,-0x1(%rcx)
+  201dc3:	eb de                	jmp    201da3 <split_string+0xa7>
+    char** part = malloc((s+1)*sizeof(char*));
+  201dc5:	bf 10 00 00 00       	mov    $0x10,%edi
+  201dca:	e8 f3 01 00 00       	call   201fc2 <malloc>
+  201dcf:	49 89 c5             	mov    %rax,%r13
+    char* buffer = malloc(n+1);
+  201dd2:	bf 01 00 00 00       	mov    $0x1,%edi
+  201dd7:	e8 e6 01 00 00       	call   201fc2 <malloc>
+    part[0] = buffer;
+  201ddc:	49 89 45 00          	mov    %rax,0x0(%r13)
+    part[s] = NULL;
+  201de0:	49 c7 45 08 00 00 00 	movq   $0x0,0x8(%r13)
+  201de7:	00 
+    buffer[n] = 0;
+  201de8:	c6 00 00             	movb   $0x0,(%rax)
+        }
+    }
+
+    return part;
+}
+  201deb:	4c 89 e8             	mov    %r13,%rax
+  201dee:	48 83 c4 08          	add    $0x8,%rsp
+  201df2:	5b                   	pop    %rbx
+  201df3:	41 5c                	pop    %r12
+  201df5:	41 5d                	pop    %r13
+  201df7:	41 5e                	pop    %r14
+  201df9:	41 5f                	pop    %r15
+  201dfb:	5d                   	pop    %rbp
+  201dfc:	c3                   	ret
+
+0000000000201dfd <app_print_error>:
+
+
+void app_print_error(int r) {
+  201dfd:	55                   	push   %rbp
+  201dfe:	48 89 e5             	mov    %rsp,%rbp
+    switch (r) {
+  201e01:	83 ff 24             	cmp    $0x24,%edi
+  201e04:	0f 87 79 01 00 00    	ja     201f83 <app_print_error+0x186>
+  201e0a:	89 f8                	mov    %edi,%eax
+  201e0c:	48 8d 15 41 05 00 00 	lea    0x541(%rip),%rdx        # 202354 <lower_digits.0+0x144>
+  201e13:	48 63 04 82          	movslq (%rdx,%rax,4),%rax
+  201e17:	48 01 d0             	add    %rdx,%rax
+  201e1a:	ff e0                	jmp    *%rax
+        case ENOENT:
+            app_printf(1, "Error: %s\n", "No such file or directory");
+  201e1c:	48 8d 15 09 04 00 00 	lea    0x409(%rip),%rdx        # 20222c <lower_digits.0+0x1c>
+  201e23:	48 8d 35 1c 04 00 00 	lea    0x41c(%rip),%rsi        # 202246 <lower_digits.0+0x36>
+  201e2a:	bf 01 00 00 00       	mov    $0x1,%edi
+  201e2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  201e34:	e8 3a fc ff ff       	call   201a73 <app_printf>
+            break;
+        default:
+            app_printf(1, "Error %d: %s\n", r, "Unknown error");
+            break;
+    }
+}
+  201e39:	5d                   	pop    %rbp
+  201e3a:	c3                   	ret
+            app_printf(1, "Error: %s\n", "I/O error");
+  201e3b:	48 8d 15 0f 04 00 00 	lea    0x40f(%rip),%rdx        # 202251 <lower_digits.0+0x41>
+  201e42:	48 8d 35 fd 03 00 00 	lea    0x3fd(%rip),%rsi        # 202246 <lower_digits.0+0x36>
+  201e49:	bf 01 00 00 00       	mov    $0x1,%edi
+  201e4e:	b8 00 00 00 00       	mov    $0x0,%eax
+  201e53:	e8 1b fc ff ff       	call   201a73 <app_printf>
+            break;
+  201e58:	eb df                	jmp    201e39 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Exec format error");
+  201e5a:	48 8d 15 fa 03 00 00 	lea    0x3fa(%rip),%rdx        # 20225b <lower_digits.0+0x4b>
+  201e61:	48 8d 35 de 03 00 00 	lea    0x3de(%rip),%rsi        # 202246 <lower_digits.0+0x36>
+  201e68:	bf 01 00 00 00       	mov    $0x1,%edi
+  201e6d:	b8 00 00 00 00       	mov    $0x0,%eax
+  201e72:	e8 fc fb ff ff       	call   201a73 <app_printf>
+            break;
+  201e77:	eb c0                	jmp    201e39 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Resource temporarily unavailable");
+  201e79:	48 8d 15 b0 04 00 00 	lea    0x4b0(%rip),%rdx        # 202330 <lower_digits.0+0x120>
+  201e80:	48 8d 35 bf 03 00 00 	lea    0x3bf(%rip),%rsi        # 202246 <lower_digits.0+0x36>
+  201e87:	bf 01 00 00 00       	mov    $0x1,%edi
+  201e8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  201e91:	e8 dd fb ff ff       	call   201a73 <app_printf>
+            break;
+  201e96:	eb a1                	jmp    201e39 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Out of memory");
+  201e98:	48 8d 15 ce 03 00 00 	lea    0x3ce(%rip),%rdx        # 20226d <lower_digits.0+0x5d>
+  201e9f:	48 8d 35 a0 03 00 00 	lea    0x3a0(%rip),%rsi        # 202246 <lower_digits.0+0x36>
+  201ea6:	bf 01 00 00 00       	mov    $0x1,%edi
+  201eab:	b8 00 00 00 00       	mov    $0x0,%eax
+  201eb0:	e8 be fb ff ff       	call   201a73 <app_printf>
+            break;
+  201eb5:	eb 82                	jmp    201e39 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Bad address");
+  201eb7:	48 8d 15 bd 03 00 00 	lea    0x3bd(%rip),%rdx        # 20227b <lower_digits.0+0x6b>
+  201ebe:	48 8d 35 81 03 00 00 	lea    0x381(%rip),%rsi        # 202246 <lower_digits.0+0x36>
+  201ec5:	bf 01 00 00 00       	mov    $0x1,%edi
+  201eca:	b8 00 00 00 00       	mov    $0x0,%eax
+  201ecf:	e8 9f fb ff ff       	call   201a73 <app_printf>
+            break;
+  201ed4:	e9 60 ff ff ff       	jmp    201e39 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Not a directory");
+  201ed9:	48 8d 15 a7 03 00 00 	lea    0x3a7(%rip),%rdx        # 202287 <lower_digits.0+0x77>
+  201ee0:	48 8d 35 5f 03 00 00 	lea    0x35f(%rip),%rsi        # 202246 <lower_digits.0+0x36>
+  201ee7:	bf 01 00 00 00       	mov    $0x1,%edi
+  201eec:	b8 00 00 00 00       	mov    $0x0,%eax
+  201ef1:	e8 7d fb ff ff       	call   201a73 <app_printf>
+            break;
+  201ef6:	e9 3e ff ff ff       	jmp    201e39 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Invalid argument");
+  201efb:	48 8d 15 95 03 00 00 	lea    0x395(%rip),%rdx        # 202297 <lower_digits.0+0x87>
+  201f02:	48 8d 35 3d 03 00 00 	lea    0x33d(%rip),%rsi        # 202246 <lower_digits.0+0x36>
+  201f09:	bf 01 00 00 00       	mov    $0x1,%edi
+  201f0e:	b8 00 00 00 00       	mov    $0x0,%eax
+  201f13:	e8 5b fb ff ff       	call   201a73 <app_printf>
+            break;
+  201f18:	e9 1c ff ff ff       	jmp    201e39 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "No space left on device");
+  201f1d:	48 8d 15 84 03 00 00 	lea    0x384(%rip),%rdx        # 2022a8 <lower_digits.0+0x98>
+  201f24:	48 8d 35 1b 03 00 00 	lea    0x31b(%rip),%rsi        # 202246 <lower_digits.0+0x36>
+  201f2b:	bf 01 00 00 00       	mov    $0x1,%edi
+  201f30:	b8 00 00 00 00       	mov    $0x0,%eax
+  201f35:	e8 39 fb ff ff       	call   201a73 <app_printf>
+            break;
+  201f3a:	e9 fa fe ff ff       	jmp    201e39 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "File already exists");
+  201f3f:	48 8d 15 7a 03 00 00 	lea    0x37a(%rip),%rdx        # 2022c0 <lower_digits.0+0xb0>
+  201f46:	48 8d 35 f9 02 00 00 	lea    0x2f9(%rip),%rsi        # 202246 <lower_digits.0+0x36>
+  201f4d:	bf 01 00 00 00       	mov    $0x1,%edi
+  201f52:	b8 00 00 00 00       	mov    $0x0,%eax
+  201f57:	e8 17 fb ff ff       	call   201a73 <app_printf>
+            break;
+  201f5c:	e9 d8 fe ff ff       	jmp    201e39 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "File name too long");
+  201f61:	48 8d 15 6c 03 00 00 	lea    0x36c(%rip),%rdx        # 2022d4 <lower_digits.0+0xc4>
+  201f68:	48 8d 35 d7 02 00 00 	lea    0x2d7(%rip),%rsi        # 202246 <lower_digits.0+0x36>
+  201f6f:	bf 01 00 00 00       	mov    $0x1,%edi
+  201f74:	b8 00 00 00 00       	mov    $0x0,%eax
+  201f79:	e8 f5 fa ff ff       	call   201a73 <app_printf>
+            break;
+  201f7e:	e9 b6 fe ff ff       	jmp    201e39 <app_print_error+0x3c>
+            app_printf(1, "Error %d: %s\n", r, "Unknown error");
+  201f83:	48 8d 0d 5d 03 00 00 	lea    0x35d(%rip),%rcx        # 2022e7 <lower_digits.0+0xd7>
+  201f8a:	89 fa                	mov    %edi,%edx
+  201f8c:	48 8d 35 62 03 00 00 	lea    0x362(%rip),%rsi        # 2022f5 <lower_digits.0+0xe5>
+  201f93:	bf 01 00 00 00       	mov    $0x1,%edi
+  201f98:	b8 00 00 00 00       	mov    $0x0,%eax
+  201f9d:	e8 d1 fa ff ff       	call   201a73 <app_printf>
+}
+  201fa2:	e9 92 fe ff ff       	jmp    201e39 <app_print_error+0x3c>
+
+0000000000201fa7 <handle_error>:
+
+__attribute__((noreturn)) void handle_error(int r) {
+  201fa7:	55                   	push   %rbp
+  201fa8:	48 89 e5             	mov    %rsp,%rbp
+  201fab:	53                   	push   %rbx
+  201fac:	48 83 ec 08          	sub    $0x8,%rsp
+  201fb0:	89 fb                	mov    %edi,%ebx
+    app_print_error(r);
+  201fb2:	e8 46 fe ff ff       	call   201dfd <app_print_error>
+    asm volatile ("syscall" : "=a" (rax)
+  201fb7:	b8 40 00 00 00       	mov    $0x40,%eax
+  201fbc:	89 df                	mov    %ebx,%edi
+  201fbe:	0f 05                	syscall
+ spinloop: goto spinloop;       // should never get here
+  201fc0:	eb fe                	jmp    201fc0 <handle_error+0x19>
+
+0000000000201fc2 <malloc>:
+
+// The heap starts 1MB above the program image (PROC_START_ADDR)
+static uint8_t* heap_top = (uint8_t*) 0x300000;
+static uint8_t* page_top = (uint8_t*) 0x300000;
+
+void* malloc(size_t size) {
+  201fc2:	48 89 fe             	mov    %rdi,%rsi
+    while (ROUNDDOWN(heap_top + size, PAGESIZE) >= page_top) {
+  201fc5:	48 8b 05 44 10 00 00 	mov    0x1044(%rip),%rax        # 203010 <heap_top>
+  201fcc:	48 8d 14 38          	lea    (%rax,%rdi,1),%rdx
+  201fd0:	48 8b 3d 31 10 00 00 	mov    0x1031(%rip),%rdi        # 203008 <page_top>
+  201fd7:	48 89 d1             	mov    %rdx,%rcx
+  201fda:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  201fe1:	48 39 f9             	cmp    %rdi,%rcx
+  201fe4:	72 3e                	jb     202024 <malloc+0x62>
+    asm volatile ("syscall" : "=a" (result)
+  201fe6:	41 b8 3b 00 00 00    	mov    $0x3b,%r8d
+  201fec:	44 89 c0             	mov    %r8d,%eax
+  201fef:	0f 05                	syscall
+        int r = sys_page_alloc(page_top);
+        assert(r >= 0);
+  201ff1:	85 c0                	test   %eax,%eax
+  201ff3:	78 37                	js     20202c <malloc+0x6a>
+        page_top += PAGESIZE;
+  201ff5:	48 8b 05 0c 10 00 00 	mov    0x100c(%rip),%rax        # 203008 <page_top>
+  201ffc:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  202003:	48 89 3d fe 0f 00 00 	mov    %rdi,0xffe(%rip)        # 203008 <page_top>
+    while (ROUNDDOWN(heap_top + size, PAGESIZE) >= page_top) {
+  20200a:	48 8b 05 ff 0f 00 00 	mov    0xfff(%rip),%rax        # 203010 <heap_top>
+  202011:	48 8d 14 30          	lea    (%rax,%rsi,1),%rdx
+  202015:	48 89 d1             	mov    %rdx,%rcx
+  202018:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  20201f:	48 39 f9             	cmp    %rdi,%rcx
+  202022:	73 c8                	jae    201fec <malloc+0x2a>
+    }
+
+    void* addr = heap_top;
+    heap_top += size;
+  202024:	48 89 15 e5 0f 00 00 	mov    %rdx,0xfe5(%rip)        # 203010 <heap_top>
+    return addr;
+}
+  20202b:	c3                   	ret
+void* malloc(size_t size) {
+  20202c:	55                   	push   %rbp
+  20202d:	48 89 e5             	mov    %rsp,%rbp
+        assert(r >= 0);
+  202030:	48 8d 15 b6 03 00 00 	lea    0x3b6(%rip),%rdx        # 2023ed <col.0+0x5>
+  202037:	be 0b 00 00 00       	mov    $0xb,%esi
+  20203c:	48 8d 3d b1 03 00 00 	lea    0x3b1(%rip),%rdi        # 2023f4 <col.0+0xc>
+  202043:	e8 b0 fb ff ff       	call   201bf8 <assert_fail>
@@ -0,0 +1,3508 @@
+
+obj/p-shell.full:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000200000 <exec_simple_cmd>:
+#include "errno.h"
+
+#define LINE_LENGTH 80
+
+
+int exec_simple_cmd(char** cmd_line) {
+  200000:	55                   	push   %rbp
+  200001:	48 89 e5             	mov    %rsp,%rbp
+  200004:	41 55                	push   %r13
+  200006:	41 54                	push   %r12
+  200008:	53                   	push   %rbx
+  200009:	48 81 ec 18 01 00 00 	sub    $0x118,%rsp
+    int r;
+
+    assert(cmd_line[0] != NULL);
+  200010:	4c 8b 2f             	mov    (%rdi),%r13
+  200013:	4d 85 ed             	test   %r13,%r13
+  200016:	74 3d                	je     200055 <exec_simple_cmd+0x55>
+  200018:	49 89 fc             	mov    %rdi,%r12
+    char* cmd = cmd_line[0];
+
+    if (strcmp(cmd, "cd") == 0) {
+  20001b:	48 8d 35 46 22 00 00 	lea    0x2246(%rip),%rsi        # 202268 <malloc+0xaf>
+  200022:	4c 89 ef             	mov    %r13,%rdi
+  200025:	e8 22 06 00 00       	call   20064c <strcmp>
+  20002a:	89 c3                	mov    %eax,%ebx
+  20002c:	85 c0                	test   %eax,%eax
+  20002e:	75 4a                	jne    20007a <exec_simple_cmd+0x7a>
+        if (cmd_line[1] == NULL)
+  200030:	49 8b 7c 24 08       	mov    0x8(%r12),%rdi
+  200035:	48 85 ff             	test   %rdi,%rdi
+  200038:	74 0b                	je     200045 <exec_simple_cmd+0x45>
+//    number, the arguments are in %rdi, %rsi, %rdx and %r10, and the result
+//    comes back in %rax. The processor clobbers %rcx and %r11.
+
+static inline int sys_chdir(const char *path) {
+    int result;
+    asm volatile ("syscall" : "=a" (result)
+  20003a:	b8 43 00 00 00       	mov    $0x43,%eax
+  20003f:	0f 05                	syscall
+            return 0;
+        
+        char* path = cmd_line[1];
+
+        r = sys_chdir(path);
+        if (r < 0) {
+  200041:	85 c0                	test   %eax,%eax
+  200043:	78 28                	js     20006d <exec_simple_cmd+0x6d>
+    assert(r >= 0);
+    r = sys_forget(pid);
+    assert(r == 0);
+
+    return exit_code;
+}
+  200045:	89 d8                	mov    %ebx,%eax
+  200047:	48 81 c4 18 01 00 00 	add    $0x118,%rsp
+  20004e:	5b                   	pop    %rbx
+  20004f:	41 5c                	pop    %r12
+  200051:	41 5d                	pop    %r13
+  200053:	5d                   	pop    %rbp
+  200054:	c3                   	ret
+    assert(cmd_line[0] != NULL);
+  200055:	48 8d 15 e4 21 00 00 	lea    0x21e4(%rip),%rdx        # 202240 <malloc+0x87>
+  20005c:	be 0b 00 00 00       	mov    $0xb,%esi
+  200061:	48 8d 3d ec 21 00 00 	lea    0x21ec(%rip),%rdi        # 202254 <malloc+0x9b>
+  200068:	e8 82 1d 00 00       	call   201def <assert_fail>
+            app_print_error(-r);
+  20006d:	f7 d8                	neg    %eax
+  20006f:	89 c3                	mov    %eax,%ebx
+  200071:	89 c7                	mov    %eax,%edi
+  200073:	e8 7c 1f 00 00       	call   201ff4 <app_print_error>
+            return -r;
+  200078:	eb cb                	jmp    200045 <exec_simple_cmd+0x45>
+    if (strcmp(cmd, "pwd") == 0) {
+  20007a:	48 8d 35 ea 21 00 00 	lea    0x21ea(%rip),%rsi        # 20226b <malloc+0xb2>
+  200081:	4c 89 ef             	mov    %r13,%rdi
+  200084:	e8 c3 05 00 00       	call   20064c <strcmp>
+  200089:	85 c0                	test   %eax,%eax
+  20008b:	75 50                	jne    2000dd <exec_simple_cmd+0xdd>
+    return result;
+}
+
+static inline int sys_getcwd(char* buffer, size_t size) {
+    int result;
+    asm volatile ("syscall" : "=a" (result)
+  20008d:	48 8d bd dc fe ff ff 	lea    -0x124(%rbp),%rdi
+  200094:	b8 42 00 00 00       	mov    $0x42,%eax
+  200099:	be 00 01 00 00       	mov    $0x100,%esi
+  20009e:	0f 05                	syscall
+  2000a0:	89 c3                	mov    %eax,%ebx
+        assert(r == 0);
+  2000a2:	85 c0                	test   %eax,%eax
+  2000a4:	75 1f                	jne    2000c5 <exec_simple_cmd+0xc5>
+        app_printf(0, "%s\n", buffer);
+  2000a6:	48 8d 95 dc fe ff ff 	lea    -0x124(%rbp),%rdx
+  2000ad:	48 8d 35 4b 24 00 00 	lea    0x244b(%rip),%rsi        # 2024ff <lower_digits.0+0xef>
+  2000b4:	bf 00 00 00 00       	mov    $0x0,%edi
+  2000b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  2000be:	e8 a7 1b 00 00       	call   201c6a <app_printf>
+        return 0;
+  2000c3:	eb 80                	jmp    200045 <exec_simple_cmd+0x45>
+        assert(r == 0);
+  2000c5:	48 8d 15 a3 21 00 00 	lea    0x21a3(%rip),%rdx        # 20226f <malloc+0xb6>
+  2000cc:	be 20 00 00 00       	mov    $0x20,%esi
+  2000d1:	48 8d 3d 7c 21 00 00 	lea    0x217c(%rip),%rdi        # 202254 <malloc+0x9b>
+  2000d8:	e8 12 1d 00 00       	call   201def <assert_fail>
+    if (strcmp(cmd, "exit") == 0) {
+  2000dd:	48 8d 35 92 21 00 00 	lea    0x2192(%rip),%rsi        # 202276 <malloc+0xbd>
+  2000e4:	4c 89 ef             	mov    %r13,%rdi
+  2000e7:	e8 60 05 00 00       	call   20064c <strcmp>
+  2000ec:	85 c0                	test   %eax,%eax
+  2000ee:	74 44                	je     200134 <exec_simple_cmd+0x134>
+    asm volatile ("syscall" : "=a" (result)
+  2000f0:	b8 46 00 00 00       	mov    $0x46,%eax
+  2000f5:	4c 89 ef             	mov    %r13,%rdi
+  2000f8:	4c 89 e6             	mov    %r12,%rsi
+  2000fb:	0f 05                	syscall
+  2000fd:	89 c7                	mov    %eax,%edi
+  2000ff:	89 c3                	mov    %eax,%ebx
+    if (pid == 0) {
+  200101:	85 c0                	test   %eax,%eax
+  200103:	0f 84 3c ff ff ff    	je     200045 <exec_simple_cmd+0x45>
+    if (pid == -ENOENT) {
+  200109:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  20010c:	74 34                	je     200142 <exec_simple_cmd+0x142>
+    if (pid < 0) {
+  20010e:	85 c0                	test   %eax,%eax
+  200110:	78 50                	js     200162 <exec_simple_cmd+0x162>
+    asm volatile ("syscall" : "=a" (result)
+  200112:	48 8d 75 dc          	lea    -0x24(%rbp),%rsi
+  200116:	b8 39 00 00 00       	mov    $0x39,%eax
+  20011b:	0f 05                	syscall
+    assert(r >= 0);
+  20011d:	85 c0                	test   %eax,%eax
+  20011f:	78 4f                	js     200170 <exec_simple_cmd+0x170>
+    asm volatile ("syscall" : "=a" (result)
+  200121:	b8 38 00 00 00       	mov    $0x38,%eax
+  200126:	0f 05                	syscall
+    assert(r == 0);
+  200128:	85 c0                	test   %eax,%eax
+  20012a:	75 5c                	jne    200188 <exec_simple_cmd+0x188>
+    return exit_code;
+  20012c:	8b 5d dc             	mov    -0x24(%rbp),%ebx
+  20012f:	e9 11 ff ff ff       	jmp    200045 <exec_simple_cmd+0x45>
+// sys_exit()
+//    Exit this process. Does not return.
+static inline void sys_exit(int exit_code) __attribute__((noreturn));
+static inline void sys_exit(int exit_code) {
+    uint64_t rax;
+    asm volatile ("syscall" : "=a" (rax)
+  200134:	b8 40 00 00 00       	mov    $0x40,%eax
+  200139:	bf 00 00 00 00       	mov    $0x0,%edi
+  20013e:	0f 05                	syscall
+                  : "a" (INT_SYS_EXIT), "D" /* %rdi */ (exit_code)
+                  : "rcx", "r11", "cc", "memory");
+ spinloop: goto spinloop;       // should never get here
+  200140:	eb fe                	jmp    200140 <exec_simple_cmd+0x140>
+        app_printf(1, "command not found\n");
+  200142:	48 8d 35 32 21 00 00 	lea    0x2132(%rip),%rsi        # 20227b <malloc+0xc2>
+  200149:	bf 01 00 00 00       	mov    $0x1,%edi
+  20014e:	b8 00 00 00 00       	mov    $0x0,%eax
+  200153:	e8 12 1b 00 00       	call   201c6a <app_printf>
+        return 127;
+  200158:	bb 7f 00 00 00       	mov    $0x7f,%ebx
+  20015d:	e9 e3 fe ff ff       	jmp    200045 <exec_simple_cmd+0x45>
+        app_print_error(-pid);
+  200162:	f7 db                	neg    %ebx
+  200164:	89 df                	mov    %ebx,%edi
+  200166:	e8 89 1e 00 00       	call   201ff4 <app_print_error>
+        return -pid;
+  20016b:	e9 d5 fe ff ff       	jmp    200045 <exec_simple_cmd+0x45>
+    assert(r >= 0);
+  200170:	48 8d 15 17 21 00 00 	lea    0x2117(%rip),%rdx        # 20228e <malloc+0xd5>
+  200177:	be 3a 00 00 00       	mov    $0x3a,%esi
+  20017c:	48 8d 3d d1 20 00 00 	lea    0x20d1(%rip),%rdi        # 202254 <malloc+0x9b>
+  200183:	e8 67 1c 00 00       	call   201def <assert_fail>
+    assert(r == 0);
+  200188:	48 8d 15 e0 20 00 00 	lea    0x20e0(%rip),%rdx        # 20226f <malloc+0xb6>
+  20018f:	be 3c 00 00 00       	mov    $0x3c,%esi
+  200194:	48 8d 3d b9 20 00 00 	lea    0x20b9(%rip),%rdi        # 202254 <malloc+0x9b>
+  20019b:	e8 4f 1c 00 00       	call   201def <assert_fail>
+
+00000000002001a0 <shell>:
+
+void __attribute((noreturn)) shell(void) {
+  2001a0:	55                   	push   %rbp
+  2001a1:	48 89 e5             	mov    %rsp,%rbp
+  2001a4:	41 56                	push   %r14
+  2001a6:	41 55                	push   %r13
+  2001a8:	41 54                	push   %r12
+  2001aa:	53                   	push   %rbx
+  2001ab:	48 81 ec 50 01 00 00 	sub    $0x150,%rsp
+    asm volatile ("syscall" : "=a" (result)
+  2001b2:	48 8d bd e0 fe ff ff 	lea    -0x120(%rbp),%rdi
+  2001b9:	b8 42 00 00 00       	mov    $0x42,%eax
+  2001be:	be 00 01 00 00       	mov    $0x100,%esi
+  2001c3:	0f 05                	syscall
+        int r = sys_getcwd(buffer, sizeof(buffer)); // TODO: sizeof(cwd) of sizeof(cwd)-1
+
+        assert(r == 0);
+
+
+        app_printf(3, "%s", buffer);
+  2001c5:	49 89 fc             	mov    %rdi,%r12
+  2001c8:	4c 8d 35 c6 20 00 00 	lea    0x20c6(%rip),%r14        # 202295 <malloc+0xdc>
+        app_printf(0, "$ ");
+  2001cf:	4c 8d 2d c2 20 00 00 	lea    0x20c2(%rip),%r13        # 202298 <malloc+0xdf>
+
+        char line[LINE_LENGTH];
+        scan_line(line, LINE_LENGTH);
+  2001d6:	48 8d 9d 90 fe ff ff 	lea    -0x170(%rbp),%rbx
+        assert(r == 0);
+  2001dd:	85 c0                	test   %eax,%eax
+  2001df:	74 2b                	je     20020c <shell+0x6c>
+  2001e1:	48 8d 15 87 20 00 00 	lea    0x2087(%rip),%rdx        # 20226f <malloc+0xb6>
+  2001e8:	be 46 00 00 00       	mov    $0x46,%esi
+  2001ed:	48 8d 3d 60 20 00 00 	lea    0x2060(%rip),%rdi        # 202254 <malloc+0x9b>
+  2001f4:	e8 f6 1b 00 00       	call   201def <assert_fail>
+  2001f9:	b8 42 00 00 00       	mov    $0x42,%eax
+  2001fe:	be 00 01 00 00       	mov    $0x100,%esi
+  200203:	4c 89 e7             	mov    %r12,%rdi
+  200206:	0f 05                	syscall
+  200208:	85 c0                	test   %eax,%eax
+  20020a:	75 d5                	jne    2001e1 <shell+0x41>
+        app_printf(3, "%s", buffer);
+  20020c:	4c 89 e2             	mov    %r12,%rdx
+  20020f:	4c 89 f6             	mov    %r14,%rsi
+  200212:	bf 03 00 00 00       	mov    $0x3,%edi
+  200217:	b8 00 00 00 00       	mov    $0x0,%eax
+  20021c:	e8 49 1a 00 00       	call   201c6a <app_printf>
+        app_printf(0, "$ ");
+  200221:	4c 89 ee             	mov    %r13,%rsi
+  200224:	bf 00 00 00 00       	mov    $0x0,%edi
+  200229:	b8 00 00 00 00       	mov    $0x0,%eax
+  20022e:	e8 37 1a 00 00       	call   201c6a <app_printf>
+        scan_line(line, LINE_LENGTH);
+  200233:	be 50 00 00 00       	mov    $0x50,%esi
+  200238:	48 89 df             	mov    %rbx,%rdi
+  20023b:	e8 f8 1b 00 00       	call   201e38 <scan_line>
+        char** cmd_line = split_string(line, ' ');
+  200240:	be 20 00 00 00       	mov    $0x20,%esi
+  200245:	48 89 df             	mov    %rbx,%rdi
+  200248:	e8 a6 1c 00 00       	call   201ef3 <split_string>
+
+        //for (char** addr = cmd_line; *addr; addr++)
+        //    app_printf(2, "%s\n", *addr);        
+
+        if (line[0] != '\0') {
+  20024d:	80 bd 90 fe ff ff 00 	cmpb   $0x0,-0x170(%rbp)
+  200254:	74 a3                	je     2001f9 <shell+0x59>
+            exec_simple_cmd(cmd_line);
+  200256:	48 89 c7             	mov    %rax,%rdi
+  200259:	e8 a2 fd ff ff       	call   200000 <exec_simple_cmd>
+  20025e:	eb 99                	jmp    2001f9 <shell+0x59>
+
+0000000000200260 <process_main>:
+        }
+    }
+}
+
+void process_main(void) {
+  200260:	55                   	push   %rbp
+  200261:	48 89 e5             	mov    %rsp,%rbp
+
+    app_printf(3, "Hello, from process %d\n", p);
+    app_printf(3, "Shell\n");*/
+
+
+    shell();
+  200264:	e8 37 ff ff ff       	call   2001a0 <shell>
+
+0000000000200269 <vdso>:
+// KERNEL DATA PAGE
+//
+//    The kernel keeps a read-only vdso_data (see lib.h) up to date at
+//    VDSO_ADDR. Reading it is a plain memory load, not a system call.
+
+static inline const volatile vdso_data* vdso(void) {
+  200269:	55                   	push   %rbp
+  20026a:	48 89 e5             	mov    %rsp,%rbp
+    return (const volatile vdso_data*) VDSO_ADDR;
+  20026d:	b8 00 10 24 00       	mov    $0x241000,%eax
+}
+  200272:	5d                   	pop    %rbp
+  200273:	c3                   	ret
+
+0000000000200274 <memcpy>:
+#define MEMOP_WORD_MIN 64
+
+// an unaligned word that may alias any object
+typedef uint64_t __attribute__((may_alias, aligned(1))) memop_word;
+
+void* memcpy(void* dst, const void* src, size_t n) {
+  200274:	55                   	push   %rbp
+  200275:	48 89 e5             	mov    %rsp,%rbp
+  200278:	48 83 ec 48          	sub    $0x48,%rsp
+  20027c:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  200280:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  200284:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+    char* d = (char*) dst;
+  200288:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  20028c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    const char* s = (const char*) src;
+  200290:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  200294:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (n >= MEMOP_WORD_MIN) {
+  200298:	48 83 7d b8 3f       	cmpq   $0x3f,-0x48(%rbp)
+  20029d:	0f 86 c5 00 00 00    	jbe    200368 <memcpy+0xf4>
+        size_t head = -(uintptr_t) d & 7;
+  2002a3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2002a7:	48 f7 d8             	neg    %rax
+  2002aa:	83 e0 07             	and    $0x7,%eax
+  2002ad:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        size_t words = (n - head) / 8;
+  2002b1:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  2002b5:	48 2b 45 e8          	sub    -0x18(%rbp),%rax
+  2002b9:	48 c1 e8 03          	shr    $0x3,%rax
+  2002bd:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+        n = (n - head) % 8;
+  2002c1:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  2002c5:	48 2b 45 e8          	sub    -0x18(%rbp),%rax
+  2002c9:	83 e0 07             	and    $0x7,%eax
+  2002cc:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        asm volatile("rep movsb" : "+D" (d), "+S" (s), "+c" (head)
+  2002d0:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  2002d4:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  2002d8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2002dc:	48 89 cf             	mov    %rcx,%rdi
+  2002df:	48 89 d6             	mov    %rdx,%rsi
+  2002e2:	48 89 c1             	mov    %rax,%rcx
+  2002e5:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  2002e7:	48 89 c8             	mov    %rcx,%rax
+  2002ea:	48 89 f2             	mov    %rsi,%rdx
+  2002ed:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  2002f1:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  2002f5:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                     : : "memory");
+        asm volatile("rep movsq" : "+D" (d), "+S" (s), "+c" (words)
+  2002f9:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  2002fd:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  200301:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  200305:	48 89 cf             	mov    %rcx,%rdi
+  200308:	48 89 d6             	mov    %rdx,%rsi
+  20030b:	48 89 c1             	mov    %rax,%rcx
+  20030e:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  200311:	48 89 c8             	mov    %rcx,%rax
+  200314:	48 89 f2             	mov    %rsi,%rdx
+  200317:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  20031b:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  20031f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+                     : : "memory");
+    }
+    for (; n >= 16; n -= 16, s += 16, d += 16) {
+  200323:	eb 43                	jmp    200368 <memcpy+0xf4>
+        memop_word a = ((const memop_word*) s)[0];
+  200325:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  200329:	48 8b 00             	mov    (%rax),%rax
+  20032c:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+        memop_word b = ((const memop_word*) s)[1];
+  200330:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  200334:	48 83 c0 08          	add    $0x8,%rax
+  200338:	48 8b 00             	mov    (%rax),%rax
+  20033b:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+        ((memop_word*) d)[0] = a;
+  20033f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200343:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  200347:	48 89 10             	mov    %rdx,(%rax)
+        ((memop_word*) d)[1] = b;
+  20034a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20034e:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  200352:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  200356:	48 89 02             	mov    %rax,(%rdx)
+    for (; n >= 16; n -= 16, s += 16, d += 16) {
+  200359:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  20035e:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  200363:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  200368:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  20036d:	77 b6                	ja     200325 <memcpy+0xb1>
+    }
+    for (; n > 0; --n, ++s, ++d) {
+  20036f:	eb 1c                	jmp    20038d <memcpy+0x119>
+        *d = *s;
+  200371:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  200375:	0f b6 10             	movzbl (%rax),%edx
+  200378:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20037c:	88 10                	mov    %dl,(%rax)
+    for (; n > 0; --n, ++s, ++d) {
+  20037e:	48 83 6d b8 01       	subq   $0x1,-0x48(%rbp)
+  200383:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  200388:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  20038d:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  200392:	75 dd                	jne    200371 <memcpy+0xfd>
+    }
+    return dst;
+  200394:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  200398:	c9                   	leave
+  200399:	c3                   	ret
+
+000000000020039a <memmove>:
+
+void* memmove(void* dst, const void* src, size_t n) {
+  20039a:	55                   	push   %rbp
+  20039b:	48 89 e5             	mov    %rsp,%rbp
+  20039e:	48 83 ec 38          	sub    $0x38,%rsp
+  2003a2:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  2003a6:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  2003aa:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    const char* s = (const char*) src;
+  2003ae:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  2003b2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    char* d = (char*) dst;
+  2003b6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  2003ba:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (!(s < d && s + n > d)) {
+  2003be:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2003c2:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  2003c6:	73 11                	jae    2003d9 <memmove+0x3f>
+  2003c8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  2003cc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  2003d0:	48 01 d0             	add    %rdx,%rax
+  2003d3:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  2003d7:	72 1c                	jb     2003f5 <memmove+0x5b>
+        // a forward copy never overwrites source bytes it has yet to read
+        return memcpy(dst, src, n);
+  2003d9:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  2003dd:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  2003e1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  2003e5:	48 89 ce             	mov    %rcx,%rsi
+  2003e8:	48 89 c7             	mov    %rax,%rdi
+  2003eb:	e8 84 fe ff ff       	call   200274 <memcpy>
+  2003f0:	e9 94 00 00 00       	jmp    200489 <memmove+0xef>
+    }
+
+    // copy backwards: the tail bytes, then words down to the start
+    size_t words = n / 8;
+  2003f5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  2003f9:	48 c1 e8 03          	shr    $0x3,%rax
+  2003fd:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    size_t tail = n % 8;
+  200401:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200405:	83 e0 07             	and    $0x7,%eax
+  200408:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    s += n - 1, d += n - 1;
+  20040c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200410:	48 83 e8 01          	sub    $0x1,%rax
+  200414:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  200418:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  20041c:	48 83 e8 01          	sub    $0x1,%rax
+  200420:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    asm volatile("std; rep movsb; cld" : "+D" (d), "+S" (s), "+c" (tail)
+  200424:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  200428:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  20042c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  200430:	48 89 cf             	mov    %rcx,%rdi
+  200433:	48 89 d6             	mov    %rdx,%rsi
+  200436:	48 89 c1             	mov    %rax,%rcx
+  200439:	fd                   	std
+  20043a:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  20043c:	fc                   	cld
+  20043d:	48 89 c8             	mov    %rcx,%rax
+  200440:	48 89 f2             	mov    %rsi,%rdx
+  200443:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  200447:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  20044b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+                 : : "memory", "cc");
+    s -= 7, d -= 7;
+  20044f:	48 83 6d f8 07       	subq   $0x7,-0x8(%rbp)
+  200454:	48 83 6d f0 07       	subq   $0x7,-0x10(%rbp)
+    asm volatile("std; rep movsq; cld" : "+D" (d), "+S" (s), "+c" (words)
+  200459:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  20045d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  200461:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  200465:	48 89 cf             	mov    %rcx,%rdi
+  200468:	48 89 d6             	mov    %rdx,%rsi
+  20046b:	48 89 c1             	mov    %rax,%rcx
+  20046e:	fd                   	std
+  20046f:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  200472:	fc                   	cld
+  200473:	48 89 c8             	mov    %rcx,%rax
+  200476:	48 89 f2             	mov    %rsi,%rdx
+  200479:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  20047d:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  200481:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 : : "memory", "cc");
+    return dst;
+  200485:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  200489:	c9                   	leave
+  20048a:	c3                   	ret
+
+000000000020048b <memset>:
+
+void* memset(void* v, int c, size_t n) {
+  20048b:	55                   	push   %rbp
+  20048c:	48 89 e5             	mov    %rsp,%rbp
+  20048f:	48 83 ec 38          	sub    $0x38,%rsp
+  200493:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  200497:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  20049a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    char* p = (char*) v;
+  20049e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  2004a2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    uint64_t word = (uint8_t) c * 0x0101010101010101UL;
+  2004a6:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  2004a9:	0f b6 c0             	movzbl %al,%eax
+  2004ac:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  2004b3:	01 01 01 
+  2004b6:	48 0f af c2          	imul   %rdx,%rax
+  2004ba:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (n >= MEMOP_WORD_MIN) {
+  2004be:	48 83 7d c8 3f       	cmpq   $0x3f,-0x38(%rbp)
+  2004c3:	0f 86 9e 00 00 00    	jbe    200567 <memset+0xdc>
+        size_t head = -(uintptr_t) p & 7;
+  2004c9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2004cd:	48 f7 d8             	neg    %rax
+  2004d0:	83 e0 07             	and    $0x7,%eax
+  2004d3:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        size_t words = (n - head) / 8;
+  2004d7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  2004db:	48 2b 45 e8          	sub    -0x18(%rbp),%rax
+  2004df:	48 c1 e8 03          	shr    $0x3,%rax
+  2004e3:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+        n = (n - head) % 8;
+  2004e7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  2004eb:	48 2b 45 e8          	sub    -0x18(%rbp),%rax
+  2004ef:	83 e0 07             	and    $0x7,%eax
+  2004f2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        asm volatile("rep stosb" : "+D" (p), "+c" (head) : "a" (word)
+  2004f6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2004fa:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  2004fe:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  200502:	48 89 ce             	mov    %rcx,%rsi
+  200505:	48 89 f7             	mov    %rsi,%rdi
+  200508:	48 89 d1             	mov    %rdx,%rcx
+  20050b:	f3 aa                	rep stos %al,%es:(%rdi)
+  20050d:	48 89 ca             	mov    %rcx,%rdx
+  200510:	48 89 fe             	mov    %rdi,%rsi
+  200513:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  200517:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+                     : "memory");
+        asm volatile("rep stosq" : "+D" (p), "+c" (words) : "a" (word)
+  20051b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  20051f:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  200523:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  200527:	48 89 ce             	mov    %rcx,%rsi
+  20052a:	48 89 f7             	mov    %rsi,%rdi
+  20052d:	48 89 d1             	mov    %rdx,%rcx
+  200530:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  200533:	48 89 ca             	mov    %rcx,%rdx
+  200536:	48 89 fe             	mov    %rdi,%rsi
+  200539:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  20053d:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+                     : "memory");
+    }
+    for (; n >= 16; n -= 16, p += 16) {
+  200541:	eb 24                	jmp    200567 <memset+0xdc>
+        ((memop_word*) p)[0] = word;
+  200543:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200547:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  20054b:	48 89 10             	mov    %rdx,(%rax)
+        ((memop_word*) p)[1] = word;
+  20054e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200552:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  200556:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  20055a:	48 89 02             	mov    %rax,(%rdx)
+    for (; n >= 16; n -= 16, p += 16) {
+  20055d:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  200562:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  200567:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  20056c:	77 d5                	ja     200543 <memset+0xb8>
+    }
+    for (; n > 0; ++p, --n) {
+  20056e:	eb 15                	jmp    200585 <memset+0xfa>
+        *p = c;
+  200570:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  200573:	89 c2                	mov    %eax,%edx
+  200575:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200579:	88 10                	mov    %dl,(%rax)
+    for (; n > 0; ++p, --n) {
+  20057b:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  200580:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  200585:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  20058a:	75 e4                	jne    200570 <memset+0xe5>
+    }
+    return v;
+  20058c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  200590:	c9                   	leave
+  200591:	c3                   	ret
+
+0000000000200592 <strlen>:
+
+size_t strlen(const char* s) {
+  200592:	55                   	push   %rbp
+  200593:	48 89 e5             	mov    %rsp,%rbp
+  200596:	48 83 ec 18          	sub    $0x18,%rsp
+  20059a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    size_t n;
+    for (n = 0; *s != '\0'; ++s) {
+  20059e:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  2005a5:	00 
+  2005a6:	eb 0a                	jmp    2005b2 <strlen+0x20>
+        ++n;
+  2005a8:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    for (n = 0; *s != '\0'; ++s) {
+  2005ad:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  2005b2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2005b6:	0f b6 00             	movzbl (%rax),%eax
+  2005b9:	84 c0                	test   %al,%al
+  2005bb:	75 eb                	jne    2005a8 <strlen+0x16>
+    }
+    return n;
+  2005bd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  2005c1:	c9                   	leave
+  2005c2:	c3                   	ret
+
+00000000002005c3 <strnlen>:
+
+size_t strnlen(const char* s, size_t maxlen) {
+  2005c3:	55                   	push   %rbp
+  2005c4:	48 89 e5             	mov    %rsp,%rbp
+  2005c7:	48 83 ec 20          	sub    $0x20,%rsp
+  2005cb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  2005cf:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    size_t n;
+    for (n = 0; n != maxlen && *s != '\0'; ++s) {
+  2005d3:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  2005da:	00 
+  2005db:	eb 0a                	jmp    2005e7 <strnlen+0x24>
+        ++n;
+  2005dd:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    for (n = 0; n != maxlen && *s != '\0'; ++s) {
+  2005e2:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  2005e7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2005eb:	48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+  2005ef:	74 0b                	je     2005fc <strnlen+0x39>
+  2005f1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2005f5:	0f b6 00             	movzbl (%rax),%eax
+  2005f8:	84 c0                	test   %al,%al
+  2005fa:	75 e1                	jne    2005dd <strnlen+0x1a>
+    }
+    return n;
+  2005fc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  200600:	c9                   	leave
+  200601:	c3                   	ret
+
+0000000000200602 <strcpy>:
+
+char* strcpy(char* dst, const char* src) {
+  200602:	55                   	push   %rbp
+  200603:	48 89 e5             	mov    %rsp,%rbp
+  200606:	48 83 ec 20          	sub    $0x20,%rsp
+  20060a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  20060e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    char* d = dst;
+  200612:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  200616:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    do {
+        *d++ = *src++;
+  20061a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  20061e:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  200622:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  200626:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20062a:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  20062e:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+  200632:	0f b6 12             	movzbl (%rdx),%edx
+  200635:	88 10                	mov    %dl,(%rax)
+    } while (d[-1]);
+  200637:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20063b:	48 83 e8 01          	sub    $0x1,%rax
+  20063f:	0f b6 00             	movzbl (%rax),%eax
+  200642:	84 c0                	test   %al,%al
+  200644:	75 d4                	jne    20061a <strcpy+0x18>
+    return dst;
+  200646:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  20064a:	c9                   	leave
+  20064b:	c3                   	ret
+
+000000000020064c <strcmp>:
+
+int strcmp(const char* a, const char* b) {
+  20064c:	55                   	push   %rbp
+  20064d:	48 89 e5             	mov    %rsp,%rbp
+  200650:	48 83 ec 10          	sub    $0x10,%rsp
+  200654:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  200658:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    while (*a && *b && *a == *b) {
+  20065c:	eb 0a                	jmp    200668 <strcmp+0x1c>
+        ++a, ++b;
+  20065e:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  200663:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+    while (*a && *b && *a == *b) {
+  200668:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20066c:	0f b6 00             	movzbl (%rax),%eax
+  20066f:	84 c0                	test   %al,%al
+  200671:	74 1d                	je     200690 <strcmp+0x44>
+  200673:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  200677:	0f b6 00             	movzbl (%rax),%eax
+  20067a:	84 c0                	test   %al,%al
+  20067c:	74 12                	je     200690 <strcmp+0x44>
+  20067e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200682:	0f b6 10             	movzbl (%rax),%edx
+  200685:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  200689:	0f b6 00             	movzbl (%rax),%eax
+  20068c:	38 c2                	cmp    %al,%dl
+  20068e:	74 ce                	je     20065e <strcmp+0x12>
+    }
+    return ((unsigned char) *a > (unsigned char) *b)
+  200690:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200694:	0f b6 00             	movzbl (%rax),%eax
+  200697:	89 c2                	mov    %eax,%edx
+  200699:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  20069d:	0f b6 00             	movzbl (%rax),%eax
+  2006a0:	38 d0                	cmp    %dl,%al
+  2006a2:	0f 92 c0             	setb   %al
+  2006a5:	0f b6 d0             	movzbl %al,%edx
+        - ((unsigned char) *a < (unsigned char) *b);
+  2006a8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2006ac:	0f b6 00             	movzbl (%rax),%eax
+  2006af:	89 c1                	mov    %eax,%ecx
+  2006b1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2006b5:	0f b6 00             	movzbl (%rax),%eax
+  2006b8:	38 c1                	cmp    %al,%cl
+  2006ba:	0f 92 c0             	setb   %al
+  2006bd:	0f b6 c0             	movzbl %al,%eax
+  2006c0:	29 c2                	sub    %eax,%edx
+  2006c2:	89 d0                	mov    %edx,%eax
+}
+  2006c4:	c9                   	leave
+  2006c5:	c3                   	ret
+
+00000000002006c6 <strchr>:
+
+char* strchr(const char* s, int c) {
+  2006c6:	55                   	push   %rbp
+  2006c7:	48 89 e5             	mov    %rsp,%rbp
+  2006ca:	48 83 ec 10          	sub    $0x10,%rsp
+  2006ce:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  2006d2:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    while (*s && *s != (char) c) {
+  2006d5:	eb 05                	jmp    2006dc <strchr+0x16>
+        ++s;
+  2006d7:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    while (*s && *s != (char) c) {
+  2006dc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2006e0:	0f b6 00             	movzbl (%rax),%eax
+  2006e3:	84 c0                	test   %al,%al
+  2006e5:	74 0e                	je     2006f5 <strchr+0x2f>
+  2006e7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2006eb:	0f b6 00             	movzbl (%rax),%eax
+  2006ee:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  2006f1:	38 d0                	cmp    %dl,%al
+  2006f3:	75 e2                	jne    2006d7 <strchr+0x11>
+    }
+    if (*s == (char) c) {
+  2006f5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2006f9:	0f b6 00             	movzbl (%rax),%eax
+  2006fc:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  2006ff:	38 d0                	cmp    %dl,%al
+  200701:	75 06                	jne    200709 <strchr+0x43>
+        return (char*) s;
+  200703:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200707:	eb 05                	jmp    20070e <strchr+0x48>
+    } else {
+        return NULL;
+  200709:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+}
+  20070e:	c9                   	leave
+  20070f:	c3                   	ret
+
+0000000000200710 <rand>:
+
+// New randomness implementation
+static int      rand_seed_set;
+static unsigned rand_seed;
+
+int rand(void) {
+  200710:	55                   	push   %rbp
+  200711:	48 89 e5             	mov    %rsp,%rbp
+  200714:	48 83 ec 10          	sub    $0x10,%rsp
+    if (!rand_seed_set) {
+  200718:	8b 05 f2 28 00 00    	mov    0x28f2(%rip),%eax        # 203010 <rand_seed_set>
+  20071e:	85 c0                	test   %eax,%eax
+  200720:	75 2c                	jne    20074e <rand+0x3e>
+#if WEENSYOS_KERNEL
+        extern unsigned get_entropy_value(void);
+        srand(get_entropy_value());
+#else           // user‑space build
+       /* kernel-refreshed seed from the kernel data page: no system call */
+       srand((unsigned) (vdso()->seed[0] ^ read_cycle_counter()));
+  200722:	e8 42 fb ff ff       	call   200269 <vdso>
+  200727:	48 8b 40 18          	mov    0x18(%rax),%rax
+  20072b:	89 c1                	mov    %eax,%ecx
+    }
+}
+
+static inline uint64_t read_cycle_counter(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+  20072d:	0f 31                	rdtsc
+  20072f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  200732:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    return ((uint64_t) hi << 32) | lo;
+  200735:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  200738:	48 c1 e0 20          	shl    $0x20,%rax
+  20073c:	48 89 c2             	mov    %rax,%rdx
+  20073f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  200742:	48 09 d0             	or     %rdx,%rax
+  200745:	31 c8                	xor    %ecx,%eax
+  200747:	89 c7                	mov    %eax,%edi
+  200749:	e8 24 00 00 00       	call   200772 <srand>
+#endif
+    }
+    rand_seed = rand_seed * 1664525U + 1013904223U;   // LCG
+  20074e:	8b 05 c0 28 00 00    	mov    0x28c0(%rip),%eax        # 203014 <rand_seed>
+  200754:	69 c0 0d 66 19 00    	imul   $0x19660d,%eax,%eax
+  20075a:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+  20075f:	89 05 af 28 00 00    	mov    %eax,0x28af(%rip)        # 203014 <rand_seed>
+    return rand_seed & RAND_MAX;
+  200765:	8b 05 a9 28 00 00    	mov    0x28a9(%rip),%eax        # 203014 <rand_seed>
+  20076b:	25 ff ff ff 7f       	and    $0x7fffffff,%eax
+}
+  200770:	c9                   	leave
+  200771:	c3                   	ret
+
+0000000000200772 <srand>:
+
+void srand(unsigned seed) {
+  200772:	55                   	push   %rbp
+  200773:	48 89 e5             	mov    %rsp,%rbp
+  200776:	48 83 ec 08          	sub    $0x8,%rsp
+  20077a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+    rand_seed      = seed;
+  20077d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  200780:	89 05 8e 28 00 00    	mov    %eax,0x288e(%rip)        # 203014 <rand_seed>
+    rand_seed_set  = 1;
+  200786:	c7 05 80 28 00 00 01 	movl   $0x1,0x2880(%rip)        # 203010 <rand_seed_set>
+  20078d:	00 00 00 
+}
+  200790:	90                   	nop
+  200791:	c9                   	leave
+  200792:	c3                   	ret
+
+0000000000200793 <fill_numbuf>:
+//    Print a message onto the console, starting at the given cursor position.
+
+// snprintf, vsnprintf
+//    Format a string into a buffer.
+
+static char* fill_numbuf(char* numbuf_end, unsigned long val, int base) {
+  200793:	55                   	push   %rbp
+  200794:	48 89 e5             	mov    %rsp,%rbp
+  200797:	48 83 ec 28          	sub    $0x28,%rsp
+  20079b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  20079f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  2007a3:	89 55 dc             	mov    %edx,-0x24(%rbp)
+    static const char upper_digits[] = "0123456789ABCDEF";
+    static const char lower_digits[] = "0123456789abcdef";
+
+    const char* digits = upper_digits;
+  2007a6:	48 8d 05 43 1c 00 00 	lea    0x1c43(%rip),%rax        # 2023f0 <upper_digits.1>
+  2007ad:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (base < 0) {
+  2007b1:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  2007b5:	79 0e                	jns    2007c5 <fill_numbuf+0x32>
+        digits = lower_digits;
+  2007b7:	48 8d 05 52 1c 00 00 	lea    0x1c52(%rip),%rax        # 202410 <lower_digits.0>
+  2007be:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+        base = -base;
+  2007c2:	f7 5d dc             	negl   -0x24(%rbp)
+    }
+
+    *--numbuf_end = '\0';
+  2007c5:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  2007ca:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2007ce:	c6 00 00             	movb   $0x0,(%rax)
+    do {
+        *--numbuf_end = digits[val % base];
+  2007d1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  2007d4:	48 63 c8             	movslq %eax,%rcx
+  2007d7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  2007db:	ba 00 00 00 00       	mov    $0x0,%edx
+  2007e0:	48 f7 f1             	div    %rcx
+  2007e3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2007e7:	48 01 d0             	add    %rdx,%rax
+  2007ea:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  2007ef:	0f b6 10             	movzbl (%rax),%edx
+  2007f2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2007f6:	88 10                	mov    %dl,(%rax)
+        val /= base;
+  2007f8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  2007fb:	48 63 f0             	movslq %eax,%rsi
+  2007fe:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  200802:	ba 00 00 00 00       	mov    $0x0,%edx
+  200807:	48 f7 f6             	div    %rsi
+  20080a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    } while (val != 0);
+  20080e:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  200813:	75 bc                	jne    2007d1 <fill_numbuf+0x3e>
+    return numbuf_end;
+  200815:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  200819:	c9                   	leave
+  20081a:	c3                   	ret
+
+000000000020081b <printer_vprintf>:
+#define FLAG_NUMERIC            (1<<5)
+#define FLAG_SIGNED             (1<<6)
+#define FLAG_NEGATIVE           (1<<7)
+#define FLAG_ALT2               (1<<8)
+
+void printer_vprintf(printer* p, int color, const char* format, va_list val) {
+  20081b:	55                   	push   %rbp
+  20081c:	48 89 e5             	mov    %rsp,%rbp
+  20081f:	53                   	push   %rbx
+  200820:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  200827:	48 89 bd 78 ff ff ff 	mov    %rdi,-0x88(%rbp)
+  20082e:	89 b5 74 ff ff ff    	mov    %esi,-0x8c(%rbp)
+  200834:	48 89 95 68 ff ff ff 	mov    %rdx,-0x98(%rbp)
+  20083b:	48 89 8d 60 ff ff ff 	mov    %rcx,-0xa0(%rbp)
+#define NUMBUFSIZ 24
+    char numbuf[NUMBUFSIZ];
+
+    for (; *format; ++format) {
+  200842:	e9 be 09 00 00       	jmp    201205 <printer_vprintf+0x9ea>
+        if (*format != '%') {
+  200847:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  20084e:	0f b6 00             	movzbl (%rax),%eax
+  200851:	3c 25                	cmp    $0x25,%al
+  200853:	74 31                	je     200886 <printer_vprintf+0x6b>
+            p->putc(p, *format, color);
+  200855:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  20085c:	4c 8b 00             	mov    (%rax),%r8
+  20085f:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200866:	0f b6 00             	movzbl (%rax),%eax
+  200869:	0f b6 c8             	movzbl %al,%ecx
+  20086c:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  200872:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200879:	89 ce                	mov    %ecx,%esi
+  20087b:	48 89 c7             	mov    %rax,%rdi
+  20087e:	41 ff d0             	call   *%r8
+            continue;
+  200881:	e9 77 09 00 00       	jmp    2011fd <printer_vprintf+0x9e2>
+        }
+
+        // process flags
+        int flags = 0;
+  200886:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+        for (++format; *format; ++format) {
+  20088d:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  200894:	01 
+  200895:	eb 4f                	jmp    2008e6 <printer_vprintf+0xcb>
+            const char* flagc = strchr(flag_chars, *format);
+  200897:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  20089e:	0f b6 00             	movzbl (%rax),%eax
+  2008a1:	0f be c0             	movsbl %al,%eax
+  2008a4:	89 c6                	mov    %eax,%esi
+  2008a6:	48 8d 05 f3 19 00 00 	lea    0x19f3(%rip),%rax        # 2022a0 <flag_chars>
+  2008ad:	48 89 c7             	mov    %rax,%rdi
+  2008b0:	e8 11 fe ff ff       	call   2006c6 <strchr>
+  2008b5:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (flagc) {
+  2008b9:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  2008be:	74 36                	je     2008f6 <printer_vprintf+0xdb>
+                flags |= 1 << (flagc - flag_chars);
+  2008c0:	48 8d 05 d9 19 00 00 	lea    0x19d9(%rip),%rax        # 2022a0 <flag_chars>
+  2008c7:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  2008cb:	48 29 c2             	sub    %rax,%rdx
+  2008ce:	89 d0                	mov    %edx,%eax
+  2008d0:	ba 01 00 00 00       	mov    $0x1,%edx
+  2008d5:	89 c1                	mov    %eax,%ecx
+  2008d7:	d3 e2                	shl    %cl,%edx
+  2008d9:	89 d0                	mov    %edx,%eax
+  2008db:	09 45 ec             	or     %eax,-0x14(%rbp)
+        for (++format; *format; ++format) {
+  2008de:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  2008e5:	01 
+  2008e6:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  2008ed:	0f b6 00             	movzbl (%rax),%eax
+  2008f0:	84 c0                	test   %al,%al
+  2008f2:	75 a3                	jne    200897 <printer_vprintf+0x7c>
+  2008f4:	eb 01                	jmp    2008f7 <printer_vprintf+0xdc>
+            } else {
+                break;
+  2008f6:	90                   	nop
+            }
+        }
+
+        // process width
+        int width = -1;
+  2008f7:	c7 45 e8 ff ff ff ff 	movl   $0xffffffff,-0x18(%rbp)
+        if (*format >= '1' && *format <= '9') {
+  2008fe:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200905:	0f b6 00             	movzbl (%rax),%eax
+  200908:	3c 30                	cmp    $0x30,%al
+  20090a:	7e 67                	jle    200973 <printer_vprintf+0x158>
+  20090c:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200913:	0f b6 00             	movzbl (%rax),%eax
+  200916:	3c 39                	cmp    $0x39,%al
+  200918:	7f 59                	jg     200973 <printer_vprintf+0x158>
+            for (width = 0; *format >= '0' && *format <= '9'; ) {
+  20091a:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%rbp)
+  200921:	eb 2e                	jmp    200951 <printer_vprintf+0x136>
+                width = 10 * width + *format++ - '0';
+  200923:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  200926:	89 d0                	mov    %edx,%eax
+  200928:	c1 e0 02             	shl    $0x2,%eax
+  20092b:	01 d0                	add    %edx,%eax
+  20092d:	01 c0                	add    %eax,%eax
+  20092f:	89 c1                	mov    %eax,%ecx
+  200931:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200938:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  20093c:	48 89 95 68 ff ff ff 	mov    %rdx,-0x98(%rbp)
+  200943:	0f b6 00             	movzbl (%rax),%eax
+  200946:	0f be c0             	movsbl %al,%eax
+  200949:	01 c8                	add    %ecx,%eax
+  20094b:	83 e8 30             	sub    $0x30,%eax
+  20094e:	89 45 e8             	mov    %eax,-0x18(%rbp)
+            for (width = 0; *format >= '0' && *format <= '9'; ) {
+  200951:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200958:	0f b6 00             	movzbl (%rax),%eax
+  20095b:	3c 2f                	cmp    $0x2f,%al
+  20095d:	0f 8e 85 00 00 00    	jle    2009e8 <printer_vprintf+0x1cd>
+  200963:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  20096a:	0f b6 00             	movzbl (%rax),%eax
+  20096d:	3c 39                	cmp    $0x39,%al
+  20096f:	7e b2                	jle    200923 <printer_vprintf+0x108>
+        if (*format >= '1' && *format <= '9') {
+  200971:	eb 75                	jmp    2009e8 <printer_vprintf+0x1cd>
+            }
+        } else if (*format == '*') {
+  200973:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  20097a:	0f b6 00             	movzbl (%rax),%eax
+  20097d:	3c 2a                	cmp    $0x2a,%al
+  20097f:	75 68                	jne    2009e9 <printer_vprintf+0x1ce>
+            width = va_arg(val, int);
+  200981:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200988:	8b 00                	mov    (%rax),%eax
+  20098a:	83 f8 2f             	cmp    $0x2f,%eax
+  20098d:	77 30                	ja     2009bf <printer_vprintf+0x1a4>
+  20098f:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200996:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  20099a:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2009a1:	8b 00                	mov    (%rax),%eax
+  2009a3:	89 c0                	mov    %eax,%eax
+  2009a5:	48 01 d0             	add    %rdx,%rax
+  2009a8:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  2009af:	8b 12                	mov    (%rdx),%edx
+  2009b1:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  2009b4:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  2009bb:	89 0a                	mov    %ecx,(%rdx)
+  2009bd:	eb 1a                	jmp    2009d9 <printer_vprintf+0x1be>
+  2009bf:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2009c6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  2009ca:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  2009ce:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  2009d5:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  2009d9:	8b 00                	mov    (%rax),%eax
+  2009db:	89 45 e8             	mov    %eax,-0x18(%rbp)
+            ++format;
+  2009de:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  2009e5:	01 
+  2009e6:	eb 01                	jmp    2009e9 <printer_vprintf+0x1ce>
+        if (*format >= '1' && *format <= '9') {
+  2009e8:	90                   	nop
+        }
+
+        // process precision
+        int precision = -1;
+  2009e9:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%rbp)
+        if (*format == '.') {
+  2009f0:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  2009f7:	0f b6 00             	movzbl (%rax),%eax
+  2009fa:	3c 2e                	cmp    $0x2e,%al
+  2009fc:	0f 85 00 01 00 00    	jne    200b02 <printer_vprintf+0x2e7>
+            ++format;
+  200a02:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  200a09:	01 
+            if (*format >= '0' && *format <= '9') {
+  200a0a:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200a11:	0f b6 00             	movzbl (%rax),%eax
+  200a14:	3c 2f                	cmp    $0x2f,%al
+  200a16:	7e 67                	jle    200a7f <printer_vprintf+0x264>
+  200a18:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200a1f:	0f b6 00             	movzbl (%rax),%eax
+  200a22:	3c 39                	cmp    $0x39,%al
+  200a24:	7f 59                	jg     200a7f <printer_vprintf+0x264>
+                for (precision = 0; *format >= '0' && *format <= '9'; ) {
+  200a26:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%rbp)
+  200a2d:	eb 2e                	jmp    200a5d <printer_vprintf+0x242>
+                    precision = 10 * precision + *format++ - '0';
+  200a2f:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  200a32:	89 d0                	mov    %edx,%eax
+  200a34:	c1 e0 02             	shl    $0x2,%eax
+  200a37:	01 d0                	add    %edx,%eax
+  200a39:	01 c0                	add    %eax,%eax
+  200a3b:	89 c1                	mov    %eax,%ecx
+  200a3d:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200a44:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  200a48:	48 89 95 68 ff ff ff 	mov    %rdx,-0x98(%rbp)
+  200a4f:	0f b6 00             	movzbl (%rax),%eax
+  200a52:	0f be c0             	movsbl %al,%eax
+  200a55:	01 c8                	add    %ecx,%eax
+  200a57:	83 e8 30             	sub    $0x30,%eax
+  200a5a:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+                for (precision = 0; *format >= '0' && *format <= '9'; ) {
+  200a5d:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200a64:	0f b6 00             	movzbl (%rax),%eax
+  200a67:	3c 2f                	cmp    $0x2f,%al
+  200a69:	0f 8e 85 00 00 00    	jle    200af4 <printer_vprintf+0x2d9>
+  200a6f:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200a76:	0f b6 00             	movzbl (%rax),%eax
+  200a79:	3c 39                	cmp    $0x39,%al
+  200a7b:	7e b2                	jle    200a2f <printer_vprintf+0x214>
+            if (*format >= '0' && *format <= '9') {
+  200a7d:	eb 75                	jmp    200af4 <printer_vprintf+0x2d9>
+                }
+            } else if (*format == '*') {
+  200a7f:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200a86:	0f b6 00             	movzbl (%rax),%eax
+  200a89:	3c 2a                	cmp    $0x2a,%al
+  200a8b:	75 68                	jne    200af5 <printer_vprintf+0x2da>
+                precision = va_arg(val, int);
+  200a8d:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200a94:	8b 00                	mov    (%rax),%eax
+  200a96:	83 f8 2f             	cmp    $0x2f,%eax
+  200a99:	77 30                	ja     200acb <printer_vprintf+0x2b0>
+  200a9b:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200aa2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200aa6:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200aad:	8b 00                	mov    (%rax),%eax
+  200aaf:	89 c0                	mov    %eax,%eax
+  200ab1:	48 01 d0             	add    %rdx,%rax
+  200ab4:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200abb:	8b 12                	mov    (%rdx),%edx
+  200abd:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200ac0:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200ac7:	89 0a                	mov    %ecx,(%rdx)
+  200ac9:	eb 1a                	jmp    200ae5 <printer_vprintf+0x2ca>
+  200acb:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200ad2:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200ad6:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200ada:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200ae1:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200ae5:	8b 00                	mov    (%rax),%eax
+  200ae7:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+                ++format;
+  200aea:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  200af1:	01 
+  200af2:	eb 01                	jmp    200af5 <printer_vprintf+0x2da>
+            if (*format >= '0' && *format <= '9') {
+  200af4:	90                   	nop
+            }
+            if (precision < 0) {
+  200af5:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  200af9:	79 07                	jns    200b02 <printer_vprintf+0x2e7>
+                precision = 0;
+  200afb:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%rbp)
+            }
+        }
+
+        // process main conversion character
+        int base = 10;
+  200b02:	c7 45 e0 0a 00 00 00 	movl   $0xa,-0x20(%rbp)
+        unsigned long num = 0;
+  200b09:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  200b10:	00 
+        int length = 0;
+  200b11:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+        char* data = "";
+  200b18:	48 8d 05 87 17 00 00 	lea    0x1787(%rip),%rax        # 2022a6 <flag_chars+0x6>
+  200b1f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    again:
+        switch (*format) {
+  200b23:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200b2a:	0f b6 00             	movzbl (%rax),%eax
+  200b2d:	0f be c0             	movsbl %al,%eax
+  200b30:	83 e8 43             	sub    $0x43,%eax
+  200b33:	83 f8 37             	cmp    $0x37,%eax
+  200b36:	0f 87 b5 03 00 00    	ja     200ef1 <printer_vprintf+0x6d6>
+  200b3c:	89 c0                	mov    %eax,%eax
+  200b3e:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  200b45:	00 
+  200b46:	48 8d 05 67 17 00 00 	lea    0x1767(%rip),%rax        # 2022b4 <flag_chars+0x14>
+  200b4d:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+  200b50:	48 98                	cltq
+  200b52:	48 8d 15 5b 17 00 00 	lea    0x175b(%rip),%rdx        # 2022b4 <flag_chars+0x14>
+  200b59:	48 01 d0             	add    %rdx,%rax
+  200b5c:	ff e0                	jmp    *%rax
+        case 'l':
+        case 'z':
+            length = 1;
+  200b5e:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+            ++format;
+  200b65:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  200b6c:	01 
+            goto again;
+  200b6d:	eb b4                	jmp    200b23 <printer_vprintf+0x308>
+        case 'd':
+        case 'i': {
+            long x = length ? va_arg(val, long) : va_arg(val, int);
+  200b6f:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  200b73:	74 5d                	je     200bd2 <printer_vprintf+0x3b7>
+  200b75:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200b7c:	8b 00                	mov    (%rax),%eax
+  200b7e:	83 f8 2f             	cmp    $0x2f,%eax
+  200b81:	77 30                	ja     200bb3 <printer_vprintf+0x398>
+  200b83:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200b8a:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200b8e:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200b95:	8b 00                	mov    (%rax),%eax
+  200b97:	89 c0                	mov    %eax,%eax
+  200b99:	48 01 d0             	add    %rdx,%rax
+  200b9c:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200ba3:	8b 12                	mov    (%rdx),%edx
+  200ba5:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200ba8:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200baf:	89 0a                	mov    %ecx,(%rdx)
+  200bb1:	eb 1a                	jmp    200bcd <printer_vprintf+0x3b2>
+  200bb3:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200bba:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200bbe:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200bc2:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200bc9:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200bcd:	48 8b 00             	mov    (%rax),%rax
+  200bd0:	eb 5c                	jmp    200c2e <printer_vprintf+0x413>
+  200bd2:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200bd9:	8b 00                	mov    (%rax),%eax
+  200bdb:	83 f8 2f             	cmp    $0x2f,%eax
+  200bde:	77 30                	ja     200c10 <printer_vprintf+0x3f5>
+  200be0:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200be7:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200beb:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200bf2:	8b 00                	mov    (%rax),%eax
+  200bf4:	89 c0                	mov    %eax,%eax
+  200bf6:	48 01 d0             	add    %rdx,%rax
+  200bf9:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200c00:	8b 12                	mov    (%rdx),%edx
+  200c02:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200c05:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200c0c:	89 0a                	mov    %ecx,(%rdx)
+  200c0e:	eb 1a                	jmp    200c2a <printer_vprintf+0x40f>
+  200c10:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c17:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200c1b:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200c1f:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200c26:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200c2a:	8b 00                	mov    (%rax),%eax
+  200c2c:	48 98                	cltq
+  200c2e:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+            int negative = x < 0 ? FLAG_NEGATIVE : 0;
+  200c32:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  200c36:	48 c1 f8 38          	sar    $0x38,%rax
+  200c3a:	25 80 00 00 00       	and    $0x80,%eax
+  200c3f:	89 45 a4             	mov    %eax,-0x5c(%rbp)
+            num = negative ? -x : x;
+  200c42:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  200c46:	74 09                	je     200c51 <printer_vprintf+0x436>
+  200c48:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  200c4c:	48 f7 d8             	neg    %rax
+  200c4f:	eb 04                	jmp    200c55 <printer_vprintf+0x43a>
+  200c51:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  200c55:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+            flags |= FLAG_NUMERIC | FLAG_SIGNED | negative;
+  200c59:	8b 45 a4             	mov    -0x5c(%rbp),%eax
+  200c5c:	83 c8 60             	or     $0x60,%eax
+  200c5f:	09 45 ec             	or     %eax,-0x14(%rbp)
+            break;
+  200c62:	e9 cf 02 00 00       	jmp    200f36 <printer_vprintf+0x71b>
+        }
+        case 'u':
+        format_unsigned:
+            num = length ? va_arg(val, unsigned long) : va_arg(val, unsigned);
+  200c67:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  200c6b:	74 5d                	je     200cca <printer_vprintf+0x4af>
+  200c6d:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c74:	8b 00                	mov    (%rax),%eax
+  200c76:	83 f8 2f             	cmp    $0x2f,%eax
+  200c79:	77 30                	ja     200cab <printer_vprintf+0x490>
+  200c7b:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c82:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200c86:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c8d:	8b 00                	mov    (%rax),%eax
+  200c8f:	89 c0                	mov    %eax,%eax
+  200c91:	48 01 d0             	add    %rdx,%rax
+  200c94:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200c9b:	8b 12                	mov    (%rdx),%edx
+  200c9d:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200ca0:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200ca7:	89 0a                	mov    %ecx,(%rdx)
+  200ca9:	eb 1a                	jmp    200cc5 <printer_vprintf+0x4aa>
+  200cab:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200cb2:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200cb6:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200cba:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200cc1:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200cc5:	48 8b 00             	mov    (%rax),%rax
+  200cc8:	eb 5c                	jmp    200d26 <printer_vprintf+0x50b>
+  200cca:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200cd1:	8b 00                	mov    (%rax),%eax
+  200cd3:	83 f8 2f             	cmp    $0x2f,%eax
+  200cd6:	77 30                	ja     200d08 <printer_vprintf+0x4ed>
+  200cd8:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200cdf:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200ce3:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200cea:	8b 00                	mov    (%rax),%eax
+  200cec:	89 c0                	mov    %eax,%eax
+  200cee:	48 01 d0             	add    %rdx,%rax
+  200cf1:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200cf8:	8b 12                	mov    (%rdx),%edx
+  200cfa:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200cfd:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200d04:	89 0a                	mov    %ecx,(%rdx)
+  200d06:	eb 1a                	jmp    200d22 <printer_vprintf+0x507>
+  200d08:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200d0f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200d13:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200d17:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200d1e:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200d22:	8b 00                	mov    (%rax),%eax
+  200d24:	89 c0                	mov    %eax,%eax
+  200d26:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+            flags |= FLAG_NUMERIC;
+  200d2a:	83 4d ec 20          	orl    $0x20,-0x14(%rbp)
+            break;
+  200d2e:	e9 03 02 00 00       	jmp    200f36 <printer_vprintf+0x71b>
+        case 'x':
+            base = -16;
+  200d33:	c7 45 e0 f0 ff ff ff 	movl   $0xfffffff0,-0x20(%rbp)
+            goto format_unsigned;
+  200d3a:	e9 28 ff ff ff       	jmp    200c67 <printer_vprintf+0x44c>
+        case 'X':
+            base = 16;
+  200d3f:	c7 45 e0 10 00 00 00 	movl   $0x10,-0x20(%rbp)
+            goto format_unsigned;
+  200d46:	e9 1c ff ff ff       	jmp    200c67 <printer_vprintf+0x44c>
+        case 'p':
+            num = (uintptr_t) va_arg(val, void*);
+  200d4b:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200d52:	8b 00                	mov    (%rax),%eax
+  200d54:	83 f8 2f             	cmp    $0x2f,%eax
+  200d57:	77 30                	ja     200d89 <printer_vprintf+0x56e>
+  200d59:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200d60:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200d64:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200d6b:	8b 00                	mov    (%rax),%eax
+  200d6d:	89 c0                	mov    %eax,%eax
+  200d6f:	48 01 d0             	add    %rdx,%rax
+  200d72:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200d79:	8b 12                	mov    (%rdx),%edx
+  200d7b:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200d7e:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200d85:	89 0a                	mov    %ecx,(%rdx)
+  200d87:	eb 1a                	jmp    200da3 <printer_vprintf+0x588>
+  200d89:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200d90:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200d94:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200d98:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200d9f:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200da3:	48 8b 00             	mov    (%rax),%rax
+  200da6:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+            base = -16;
+  200daa:	c7 45 e0 f0 ff ff ff 	movl   $0xfffffff0,-0x20(%rbp)
+            flags |= FLAG_ALT | FLAG_ALT2 | FLAG_NUMERIC;
+  200db1:	81 4d ec 21 01 00 00 	orl    $0x121,-0x14(%rbp)
+            break;
+  200db8:	e9 79 01 00 00       	jmp    200f36 <printer_vprintf+0x71b>
+        case 's':
+            data = va_arg(val, char*);
+  200dbd:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200dc4:	8b 00                	mov    (%rax),%eax
+  200dc6:	83 f8 2f             	cmp    $0x2f,%eax
+  200dc9:	77 30                	ja     200dfb <printer_vprintf+0x5e0>
+  200dcb:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200dd2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200dd6:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200ddd:	8b 00                	mov    (%rax),%eax
+  200ddf:	89 c0                	mov    %eax,%eax
+  200de1:	48 01 d0             	add    %rdx,%rax
+  200de4:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200deb:	8b 12                	mov    (%rdx),%edx
+  200ded:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200df0:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200df7:	89 0a                	mov    %ecx,(%rdx)
+  200df9:	eb 1a                	jmp    200e15 <printer_vprintf+0x5fa>
+  200dfb:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200e02:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200e06:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200e0a:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200e11:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200e15:	48 8b 00             	mov    (%rax),%rax
+  200e18:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+            break;
+  200e1c:	e9 15 01 00 00       	jmp    200f36 <printer_vprintf+0x71b>
+        case 'C':
+            color = va_arg(val, int);
+  200e21:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200e28:	8b 00                	mov    (%rax),%eax
+  200e2a:	83 f8 2f             	cmp    $0x2f,%eax
+  200e2d:	77 30                	ja     200e5f <printer_vprintf+0x644>
+  200e2f:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200e36:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200e3a:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200e41:	8b 00                	mov    (%rax),%eax
+  200e43:	89 c0                	mov    %eax,%eax
+  200e45:	48 01 d0             	add    %rdx,%rax
+  200e48:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200e4f:	8b 12                	mov    (%rdx),%edx
+  200e51:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200e54:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200e5b:	89 0a                	mov    %ecx,(%rdx)
+  200e5d:	eb 1a                	jmp    200e79 <printer_vprintf+0x65e>
+  200e5f:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200e66:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200e6a:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200e6e:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200e75:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200e79:	8b 00                	mov    (%rax),%eax
+  200e7b:	89 85 74 ff ff ff    	mov    %eax,-0x8c(%rbp)
+            goto done;
+  200e81:	e9 77 03 00 00       	jmp    2011fd <printer_vprintf+0x9e2>
+        case 'c':
+            data = numbuf;
+  200e86:	48 8d 45 8c          	lea    -0x74(%rbp),%rax
+  200e8a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+            numbuf[0] = va_arg(val, int);
+  200e8e:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200e95:	8b 00                	mov    (%rax),%eax
+  200e97:	83 f8 2f             	cmp    $0x2f,%eax
+  200e9a:	77 30                	ja     200ecc <printer_vprintf+0x6b1>
+  200e9c:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200ea3:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200ea7:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200eae:	8b 00                	mov    (%rax),%eax
+  200eb0:	89 c0                	mov    %eax,%eax
+  200eb2:	48 01 d0             	add    %rdx,%rax
+  200eb5:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200ebc:	8b 12                	mov    (%rdx),%edx
+  200ebe:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200ec1:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200ec8:	89 0a                	mov    %ecx,(%rdx)
+  200eca:	eb 1a                	jmp    200ee6 <printer_vprintf+0x6cb>
+  200ecc:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200ed3:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200ed7:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200edb:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200ee2:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200ee6:	8b 00                	mov    (%rax),%eax
+  200ee8:	88 45 8c             	mov    %al,-0x74(%rbp)
+            numbuf[1] = '\0';
+  200eeb:	c6 45 8d 00          	movb   $0x0,-0x73(%rbp)
+            break;
+  200eef:	eb 45                	jmp    200f36 <printer_vprintf+0x71b>
+        default:
+            data = numbuf;
+  200ef1:	48 8d 45 8c          	lea    -0x74(%rbp),%rax
+  200ef5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+            numbuf[0] = (*format ? *format : '%');
+  200ef9:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200f00:	0f b6 00             	movzbl (%rax),%eax
+  200f03:	84 c0                	test   %al,%al
+  200f05:	74 0c                	je     200f13 <printer_vprintf+0x6f8>
+  200f07:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200f0e:	0f b6 00             	movzbl (%rax),%eax
+  200f11:	eb 05                	jmp    200f18 <printer_vprintf+0x6fd>
+  200f13:	b8 25 00 00 00       	mov    $0x25,%eax
+  200f18:	88 45 8c             	mov    %al,-0x74(%rbp)
+            numbuf[1] = '\0';
+  200f1b:	c6 45 8d 00          	movb   $0x0,-0x73(%rbp)
+            if (!*format) {
+  200f1f:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200f26:	0f b6 00             	movzbl (%rax),%eax
+  200f29:	84 c0                	test   %al,%al
+  200f2b:	75 08                	jne    200f35 <printer_vprintf+0x71a>
+                format--;
+  200f2d:	48 83 ad 68 ff ff ff 	subq   $0x1,-0x98(%rbp)
+  200f34:	01 
+            }
+            break;
+  200f35:	90                   	nop
+        }
+
+        if (flags & FLAG_NUMERIC) {
+  200f36:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200f39:	83 e0 20             	and    $0x20,%eax
+  200f3c:	85 c0                	test   %eax,%eax
+  200f3e:	74 1e                	je     200f5e <printer_vprintf+0x743>
+            data = fill_numbuf(numbuf + NUMBUFSIZ, num, base);
+  200f40:	48 8d 45 8c          	lea    -0x74(%rbp),%rax
+  200f44:	48 83 c0 18          	add    $0x18,%rax
+  200f48:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  200f4b:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  200f4f:	48 89 ce             	mov    %rcx,%rsi
+  200f52:	48 89 c7             	mov    %rax,%rdi
+  200f55:	e8 39 f8 ff ff       	call   200793 <fill_numbuf>
+  200f5a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        }
+
+        const char* prefix = "";
+  200f5e:	48 8d 05 41 13 00 00 	lea    0x1341(%rip),%rax        # 2022a6 <flag_chars+0x6>
+  200f65:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((flags & FLAG_NUMERIC) && (flags & FLAG_SIGNED)) {
+  200f69:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200f6c:	83 e0 20             	and    $0x20,%eax
+  200f6f:	85 c0                	test   %eax,%eax
+  200f71:	74 51                	je     200fc4 <printer_vprintf+0x7a9>
+  200f73:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200f76:	83 e0 40             	and    $0x40,%eax
+  200f79:	85 c0                	test   %eax,%eax
+  200f7b:	74 47                	je     200fc4 <printer_vprintf+0x7a9>
+            if (flags & FLAG_NEGATIVE) {
+  200f7d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200f80:	25 80 00 00 00       	and    $0x80,%eax
+  200f85:	85 c0                	test   %eax,%eax
+  200f87:	74 0d                	je     200f96 <printer_vprintf+0x77b>
+                prefix = "-";
+  200f89:	48 8d 05 17 13 00 00 	lea    0x1317(%rip),%rax        # 2022a7 <flag_chars+0x7>
+  200f90:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            if (flags & FLAG_NEGATIVE) {
+  200f94:	eb 7d                	jmp    201013 <printer_vprintf+0x7f8>
+            } else if (flags & FLAG_PLUSPOSITIVE) {
+  200f96:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200f99:	83 e0 10             	and    $0x10,%eax
+  200f9c:	85 c0                	test   %eax,%eax
+  200f9e:	74 0d                	je     200fad <printer_vprintf+0x792>
+                prefix = "+";
+  200fa0:	48 8d 05 02 13 00 00 	lea    0x1302(%rip),%rax        # 2022a9 <flag_chars+0x9>
+  200fa7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            if (flags & FLAG_NEGATIVE) {
+  200fab:	eb 66                	jmp    201013 <printer_vprintf+0x7f8>
+            } else if (flags & FLAG_SPACEPOSITIVE) {
+  200fad:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200fb0:	83 e0 08             	and    $0x8,%eax
+  200fb3:	85 c0                	test   %eax,%eax
+  200fb5:	74 5c                	je     201013 <printer_vprintf+0x7f8>
+                prefix = " ";
+  200fb7:	48 8d 05 ed 12 00 00 	lea    0x12ed(%rip),%rax        # 2022ab <flag_chars+0xb>
+  200fbe:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            if (flags & FLAG_NEGATIVE) {
+  200fc2:	eb 4f                	jmp    201013 <printer_vprintf+0x7f8>
+            }
+        } else if ((flags & FLAG_NUMERIC) && (flags & FLAG_ALT)
+  200fc4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200fc7:	83 e0 20             	and    $0x20,%eax
+  200fca:	85 c0                	test   %eax,%eax
+  200fcc:	74 46                	je     201014 <printer_vprintf+0x7f9>
+  200fce:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200fd1:	83 e0 01             	and    $0x1,%eax
+  200fd4:	85 c0                	test   %eax,%eax
+  200fd6:	74 3c                	je     201014 <printer_vprintf+0x7f9>
+                   && (base == 16 || base == -16)
+  200fd8:	83 7d e0 10          	cmpl   $0x10,-0x20(%rbp)
+  200fdc:	74 06                	je     200fe4 <printer_vprintf+0x7c9>
+  200fde:	83 7d e0 f0          	cmpl   $0xfffffff0,-0x20(%rbp)
+  200fe2:	75 30                	jne    201014 <printer_vprintf+0x7f9>
+                   && (num || (flags & FLAG_ALT2))) {
+  200fe4:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  200fe9:	75 0c                	jne    200ff7 <printer_vprintf+0x7dc>
+  200feb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200fee:	25 00 01 00 00       	and    $0x100,%eax
+  200ff3:	85 c0                	test   %eax,%eax
+  200ff5:	74 1d                	je     201014 <printer_vprintf+0x7f9>
+            prefix = (base == -16 ? "0x" : "0X");
+  200ff7:	83 7d e0 f0          	cmpl   $0xfffffff0,-0x20(%rbp)
+  200ffb:	75 09                	jne    201006 <printer_vprintf+0x7eb>
+  200ffd:	48 8d 05 a9 12 00 00 	lea    0x12a9(%rip),%rax        # 2022ad <flag_chars+0xd>
+  201004:	eb 07                	jmp    20100d <printer_vprintf+0x7f2>
+  201006:	48 8d 05 a3 12 00 00 	lea    0x12a3(%rip),%rax        # 2022b0 <flag_chars+0x10>
+  20100d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  201011:	eb 01                	jmp    201014 <printer_vprintf+0x7f9>
+            if (flags & FLAG_NEGATIVE) {
+  201013:	90                   	nop
+        }
+
+        int len;
+        if (precision >= 0 && !(flags & FLAG_NUMERIC)) {
+  201014:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  201018:	78 24                	js     20103e <printer_vprintf+0x823>
+  20101a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  20101d:	83 e0 20             	and    $0x20,%eax
+  201020:	85 c0                	test   %eax,%eax
+  201022:	75 1a                	jne    20103e <printer_vprintf+0x823>
+            len = strnlen(data, precision);
+  201024:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  201027:	48 63 d0             	movslq %eax,%rdx
+  20102a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  20102e:	48 89 d6             	mov    %rdx,%rsi
+  201031:	48 89 c7             	mov    %rax,%rdi
+  201034:	e8 8a f5 ff ff       	call   2005c3 <strnlen>
+  201039:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  20103c:	eb 0f                	jmp    20104d <printer_vprintf+0x832>
+        } else {
+            len = strlen(data);
+  20103e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  201042:	48 89 c7             	mov    %rax,%rdi
+  201045:	e8 48 f5 ff ff       	call   200592 <strlen>
+  20104a:	89 45 bc             	mov    %eax,-0x44(%rbp)
+        }
+        int zeros;
+        if ((flags & FLAG_NUMERIC) && precision >= 0) {
+  20104d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  201050:	83 e0 20             	and    $0x20,%eax
+  201053:	85 c0                	test   %eax,%eax
+  201055:	74 20                	je     201077 <printer_vprintf+0x85c>
+  201057:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  20105b:	78 1a                	js     201077 <printer_vprintf+0x85c>
+            zeros = precision > len ? precision - len : 0;
+  20105d:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  201060:	3b 45 bc             	cmp    -0x44(%rbp),%eax
+  201063:	7e 08                	jle    20106d <printer_vprintf+0x852>
+  201065:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  201068:	2b 45 bc             	sub    -0x44(%rbp),%eax
+  20106b:	eb 05                	jmp    201072 <printer_vprintf+0x857>
+  20106d:	b8 00 00 00 00       	mov    $0x0,%eax
+  201072:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  201075:	eb 5c                	jmp    2010d3 <printer_vprintf+0x8b8>
+        } else if ((flags & FLAG_NUMERIC) && (flags & FLAG_ZERO)
+  201077:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  20107a:	83 e0 20             	and    $0x20,%eax
+  20107d:	85 c0                	test   %eax,%eax
+  20107f:	74 4b                	je     2010cc <printer_vprintf+0x8b1>
+  201081:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  201084:	83 e0 02             	and    $0x2,%eax
+  201087:	85 c0                	test   %eax,%eax
+  201089:	74 41                	je     2010cc <printer_vprintf+0x8b1>
+                   && !(flags & FLAG_LEFTJUSTIFY)
+  20108b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  20108e:	83 e0 04             	and    $0x4,%eax
+  201091:	85 c0                	test   %eax,%eax
+  201093:	75 37                	jne    2010cc <printer_vprintf+0x8b1>
+                   && len + (int) strlen(prefix) < width) {
+  201095:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  201099:	48 89 c7             	mov    %rax,%rdi
+  20109c:	e8 f1 f4 ff ff       	call   200592 <strlen>
+  2010a1:	89 c2                	mov    %eax,%edx
+  2010a3:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  2010a6:	01 d0                	add    %edx,%eax
+  2010a8:	39 45 e8             	cmp    %eax,-0x18(%rbp)
+  2010ab:	7e 1f                	jle    2010cc <printer_vprintf+0x8b1>
+            zeros = width - len - strlen(prefix);
+  2010ad:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  2010b0:	2b 45 bc             	sub    -0x44(%rbp),%eax
+  2010b3:	89 c3                	mov    %eax,%ebx
+  2010b5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  2010b9:	48 89 c7             	mov    %rax,%rdi
+  2010bc:	e8 d1 f4 ff ff       	call   200592 <strlen>
+  2010c1:	89 c2                	mov    %eax,%edx
+  2010c3:	89 d8                	mov    %ebx,%eax
+  2010c5:	29 d0                	sub    %edx,%eax
+  2010c7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  2010ca:	eb 07                	jmp    2010d3 <printer_vprintf+0x8b8>
+        } else {
+            zeros = 0;
+  2010cc:	c7 45 b8 00 00 00 00 	movl   $0x0,-0x48(%rbp)
+        }
+        width -= len + zeros + strlen(prefix);
+  2010d3:	8b 55 bc             	mov    -0x44(%rbp),%edx
+  2010d6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  2010d9:	01 d0                	add    %edx,%eax
+  2010db:	48 63 d8             	movslq %eax,%rbx
+  2010de:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  2010e2:	48 89 c7             	mov    %rax,%rdi
+  2010e5:	e8 a8 f4 ff ff       	call   200592 <strlen>
+  2010ea:	48 8d 14 03          	lea    (%rbx,%rax,1),%rdx
+  2010ee:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  2010f1:	29 d0                	sub    %edx,%eax
+  2010f3:	89 45 e8             	mov    %eax,-0x18(%rbp)
+        for (; !(flags & FLAG_LEFTJUSTIFY) && width > 0; --width) {
+  2010f6:	eb 25                	jmp    20111d <printer_vprintf+0x902>
+            p->putc(p, ' ', color);
+  2010f8:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  2010ff:	48 8b 08             	mov    (%rax),%rcx
+  201102:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  201108:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  20110f:	be 20 00 00 00       	mov    $0x20,%esi
+  201114:	48 89 c7             	mov    %rax,%rdi
+  201117:	ff d1                	call   *%rcx
+        for (; !(flags & FLAG_LEFTJUSTIFY) && width > 0; --width) {
+  201119:	83 6d e8 01          	subl   $0x1,-0x18(%rbp)
+  20111d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  201120:	83 e0 04             	and    $0x4,%eax
+  201123:	85 c0                	test   %eax,%eax
+  201125:	75 36                	jne    20115d <printer_vprintf+0x942>
+  201127:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  20112b:	7f cb                	jg     2010f8 <printer_vprintf+0x8dd>
+        }
+        for (; *prefix; ++prefix) {
+  20112d:	eb 2e                	jmp    20115d <printer_vprintf+0x942>
+            p->putc(p, *prefix, color);
+  20112f:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  201136:	4c 8b 00             	mov    (%rax),%r8
+  201139:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  20113d:	0f b6 00             	movzbl (%rax),%eax
+  201140:	0f b6 c8             	movzbl %al,%ecx
+  201143:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  201149:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  201150:	89 ce                	mov    %ecx,%esi
+  201152:	48 89 c7             	mov    %rax,%rdi
+  201155:	41 ff d0             	call   *%r8
+        for (; *prefix; ++prefix) {
+  201158:	48 83 45 c0 01       	addq   $0x1,-0x40(%rbp)
+  20115d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  201161:	0f b6 00             	movzbl (%rax),%eax
+  201164:	84 c0                	test   %al,%al
+  201166:	75 c7                	jne    20112f <printer_vprintf+0x914>
+        }
+        for (; zeros > 0; --zeros) {
+  201168:	eb 25                	jmp    20118f <printer_vprintf+0x974>
+            p->putc(p, '0', color);
+  20116a:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  201171:	48 8b 08             	mov    (%rax),%rcx
+  201174:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  20117a:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  201181:	be 30 00 00 00       	mov    $0x30,%esi
+  201186:	48 89 c7             	mov    %rax,%rdi
+  201189:	ff d1                	call   *%rcx
+        for (; zeros > 0; --zeros) {
+  20118b:	83 6d b8 01          	subl   $0x1,-0x48(%rbp)
+  20118f:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  201193:	7f d5                	jg     20116a <printer_vprintf+0x94f>
+        }
+        for (; len > 0; ++data, --len) {
+  201195:	eb 32                	jmp    2011c9 <printer_vprintf+0x9ae>
+            p->putc(p, *data, color);
+  201197:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  20119e:	4c 8b 00             	mov    (%rax),%r8
+  2011a1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  2011a5:	0f b6 00             	movzbl (%rax),%eax
+  2011a8:	0f b6 c8             	movzbl %al,%ecx
+  2011ab:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  2011b1:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  2011b8:	89 ce                	mov    %ecx,%esi
+  2011ba:	48 89 c7             	mov    %rax,%rdi
+  2011bd:	41 ff d0             	call   *%r8
+        for (; len > 0; ++data, --len) {
+  2011c0:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  2011c5:	83 6d bc 01          	subl   $0x1,-0x44(%rbp)
+  2011c9:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+  2011cd:	7f c8                	jg     201197 <printer_vprintf+0x97c>
+        }
+        for (; width > 0; --width) {
+  2011cf:	eb 25                	jmp    2011f6 <printer_vprintf+0x9db>
+            p->putc(p, ' ', color);
+  2011d1:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  2011d8:	48 8b 08             	mov    (%rax),%rcx
+  2011db:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  2011e1:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  2011e8:	be 20 00 00 00       	mov    $0x20,%esi
+  2011ed:	48 89 c7             	mov    %rax,%rdi
+  2011f0:	ff d1                	call   *%rcx
+        for (; width > 0; --width) {
+  2011f2:	83 6d e8 01          	subl   $0x1,-0x18(%rbp)
+  2011f6:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  2011fa:	7f d5                	jg     2011d1 <printer_vprintf+0x9b6>
+        }
+    done: ;
+  2011fc:	90                   	nop
+    for (; *format; ++format) {
+  2011fd:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  201204:	01 
+  201205:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  20120c:	0f b6 00             	movzbl (%rax),%eax
+  20120f:	84 c0                	test   %al,%al
+  201211:	0f 85 30 f6 ff ff    	jne    200847 <printer_vprintf+0x2c>
+    }
+}
+  201217:	90                   	nop
+  201218:	90                   	nop
+  201219:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  20121d:	c9                   	leave
+  20121e:	c3                   	ret
+
+000000000020121f <console_putc>:
+typedef struct console_printer {
+    printer p;
+    uint16_t* cursor;
+} console_printer;
+
+static void console_putc(printer* p, unsigned char c, int color) {
+  20121f:	55                   	push   %rbp
+  201220:	48 89 e5             	mov    %rsp,%rbp
+  201223:	48 83 ec 30          	sub    $0x30,%rsp
+  201227:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  20122b:	89 f0                	mov    %esi,%eax
+  20122d:	89 55 d0             	mov    %edx,-0x30(%rbp)
+  201230:	88 45 d4             	mov    %al,-0x2c(%rbp)
+    console_printer* cp = (console_printer*) p;
+  201233:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  201237:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    /*if (cp->cursor >= console + CONSOLE_ROWS * CONSOLE_COLUMNS) {
+        cp->cursor = console;
+    }*/
+    if (c == '\n') {
+  20123b:	80 7d d4 0a          	cmpb   $0xa,-0x2c(%rbp)
+  20123f:	75 7f                	jne    2012c0 <console_putc+0xa1>
+        int pos = (cp->cursor - console) % CONSOLE_COLUMNS;
+  201241:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201245:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  201249:	48 8d 05 b0 6d eb ff 	lea    -0x149250(%rip),%rax        # b8000 <console>
+  201250:	48 29 c2             	sub    %rax,%rdx
+  201253:	48 89 d0             	mov    %rdx,%rax
+  201256:	48 d1 f8             	sar    %rax
+  201259:	48 89 c1             	mov    %rax,%rcx
+  20125c:	48 ba 67 66 66 66 66 	movabs $0x6666666666666667,%rdx
+  201263:	66 66 66 
+  201266:	48 89 c8             	mov    %rcx,%rax
+  201269:	48 f7 ea             	imul   %rdx
+  20126c:	48 c1 fa 05          	sar    $0x5,%rdx
+  201270:	48 89 c8             	mov    %rcx,%rax
+  201273:	48 c1 f8 3f          	sar    $0x3f,%rax
+  201277:	48 29 c2             	sub    %rax,%rdx
+  20127a:	48 89 d0             	mov    %rdx,%rax
+  20127d:	48 c1 e0 02          	shl    $0x2,%rax
+  201281:	48 01 d0             	add    %rdx,%rax
+  201284:	48 c1 e0 04          	shl    $0x4,%rax
+  201288:	48 29 c1             	sub    %rax,%rcx
+  20128b:	48 89 ca             	mov    %rcx,%rdx
+  20128e:	89 55 fc             	mov    %edx,-0x4(%rbp)
+        for (; pos != CONSOLE_COLUMNS; pos++) {
+  201291:	eb 25                	jmp    2012b8 <console_putc+0x99>
+            *cp->cursor++ = ' ' | color;
+  201293:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  201296:	83 c8 20             	or     $0x20,%eax
+  201299:	89 c6                	mov    %eax,%esi
+  20129b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20129f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  2012a3:	48 8d 48 02          	lea    0x2(%rax),%rcx
+  2012a7:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  2012ab:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  2012af:	89 f2                	mov    %esi,%edx
+  2012b1:	66 89 10             	mov    %dx,(%rax)
+        for (; pos != CONSOLE_COLUMNS; pos++) {
+  2012b4:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  2012b8:	83 7d fc 50          	cmpl   $0x50,-0x4(%rbp)
+  2012bc:	75 d5                	jne    201293 <console_putc+0x74>
+  2012be:	eb 69                	jmp    201329 <console_putc+0x10a>
+        }
+    } else if (c == '\b') {
+  2012c0:	80 7d d4 08          	cmpb   $0x8,-0x2c(%rbp)
+  2012c4:	75 3f                	jne    201305 <console_putc+0xe6>
+        if (cp->cursor != console) {
+  2012c6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2012ca:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  2012ce:	48 8d 05 2b 6d eb ff 	lea    -0x1492d5(%rip),%rax        # b8000 <console>
+  2012d5:	48 39 c2             	cmp    %rax,%rdx
+  2012d8:	74 4f                	je     201329 <console_putc+0x10a>
+            *(--cp->cursor) = ' ' | color;
+  2012da:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  2012dd:	83 c8 20             	or     $0x20,%eax
+  2012e0:	89 c1                	mov    %eax,%ecx
+  2012e2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2012e6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  2012ea:	48 8d 50 fe          	lea    -0x2(%rax),%rdx
+  2012ee:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2012f2:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  2012f6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2012fa:	48 8b 40 08          	mov    0x8(%rax),%rax
+  2012fe:	89 ca                	mov    %ecx,%edx
+  201300:	66 89 10             	mov    %dx,(%rax)
+  201303:	eb 24                	jmp    201329 <console_putc+0x10a>
+        }
+    } else {
+        *cp->cursor++ = c | color;
+  201305:	0f b6 45 d4          	movzbl -0x2c(%rbp),%eax
+  201309:	8b 55 d0             	mov    -0x30(%rbp),%edx
+  20130c:	09 d0                	or     %edx,%eax
+  20130e:	89 c6                	mov    %eax,%esi
+  201310:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201314:	48 8b 40 08          	mov    0x8(%rax),%rax
+  201318:	48 8d 48 02          	lea    0x2(%rax),%rcx
+  20131c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  201320:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  201324:	89 f2                	mov    %esi,%edx
+  201326:	66 89 10             	mov    %dx,(%rax)
+    }
+
+    const int MAX_ROWS = CONSOLE_ROWS - 2;
+  201329:	c7 45 e4 17 00 00 00 	movl   $0x17,-0x1c(%rbp)
+
+    if (cp->cursor == console + MAX_ROWS * CONSOLE_COLUMNS) {
+  201330:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201334:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  201338:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  20133b:	89 d0                	mov    %edx,%eax
+  20133d:	c1 e0 02             	shl    $0x2,%eax
+  201340:	01 d0                	add    %edx,%eax
+  201342:	c1 e0 04             	shl    $0x4,%eax
+  201345:	48 98                	cltq
+  201347:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  20134b:	48 8d 05 ae 6c eb ff 	lea    -0x149352(%rip),%rax        # b8000 <console>
+  201352:	48 01 d0             	add    %rdx,%rax
+  201355:	48 39 c1             	cmp    %rax,%rcx
+  201358:	0f 85 ac 00 00 00    	jne    20140a <console_putc+0x1eb>
+        // Move all characters up by one row, forgetting the first row
+        for (int i = 0; i < (MAX_ROWS - 1) * CONSOLE_COLUMNS; ++i) {
+  20135e:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  201365:	eb 30                	jmp    201397 <console_putc+0x178>
+            console[i] = console[i + CONSOLE_COLUMNS];
+  201367:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  20136a:	83 c0 50             	add    $0x50,%eax
+  20136d:	48 98                	cltq
+  20136f:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  201373:	48 8d 05 86 6c eb ff 	lea    -0x14937a(%rip),%rax        # b8000 <console>
+  20137a:	0f b7 04 02          	movzwl (%rdx,%rax,1),%eax
+  20137e:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  201381:	48 63 d2             	movslq %edx,%rdx
+  201384:	48 8d 0c 12          	lea    (%rdx,%rdx,1),%rcx
+  201388:	48 8d 15 71 6c eb ff 	lea    -0x14938f(%rip),%rdx        # b8000 <console>
+  20138f:	66 89 04 11          	mov    %ax,(%rcx,%rdx,1)
+        for (int i = 0; i < (MAX_ROWS - 1) * CONSOLE_COLUMNS; ++i) {
+  201393:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+  201397:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  20139a:	8d 50 ff             	lea    -0x1(%rax),%edx
+  20139d:	89 d0                	mov    %edx,%eax
+  20139f:	c1 e0 02             	shl    $0x2,%eax
+  2013a2:	01 d0                	add    %edx,%eax
+  2013a4:	c1 e0 04             	shl    $0x4,%eax
+  2013a7:	39 45 f8             	cmp    %eax,-0x8(%rbp)
+  2013aa:	7c bb                	jl     201367 <console_putc+0x148>
+        }
+
+        // Fill last column with space
+        for (int i = (MAX_ROWS - 1) * CONSOLE_COLUMNS; i < MAX_ROWS * CONSOLE_COLUMNS; ++i) {
+  2013ac:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  2013af:	8d 50 ff             	lea    -0x1(%rax),%edx
+  2013b2:	89 d0                	mov    %edx,%eax
+  2013b4:	c1 e0 02             	shl    $0x2,%eax
+  2013b7:	01 d0                	add    %edx,%eax
+  2013b9:	c1 e0 04             	shl    $0x4,%eax
+  2013bc:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  2013bf:	eb 20                	jmp    2013e1 <console_putc+0x1c2>
+            console[i] = ' ' | color;
+  2013c1:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  2013c4:	83 c8 20             	or     $0x20,%eax
+  2013c7:	89 c1                	mov    %eax,%ecx
+  2013c9:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  2013cc:	48 98                	cltq
+  2013ce:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  2013d2:	48 8d 05 27 6c eb ff 	lea    -0x1493d9(%rip),%rax        # b8000 <console>
+  2013d9:	66 89 0c 02          	mov    %cx,(%rdx,%rax,1)
+        for (int i = (MAX_ROWS - 1) * CONSOLE_COLUMNS; i < MAX_ROWS * CONSOLE_COLUMNS; ++i) {
+  2013dd:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  2013e1:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  2013e4:	89 d0                	mov    %edx,%eax
+  2013e6:	c1 e0 02             	shl    $0x2,%eax
+  2013e9:	01 d0                	add    %edx,%eax
+  2013eb:	c1 e0 04             	shl    $0x4,%eax
+  2013ee:	39 45 f4             	cmp    %eax,-0xc(%rbp)
+  2013f1:	7c ce                	jl     2013c1 <console_putc+0x1a2>
+        }
+
+        cp->cursor -= CONSOLE_COLUMNS;
+  2013f3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2013f7:	48 8b 40 08          	mov    0x8(%rax),%rax
+  2013fb:	48 8d 90 60 ff ff ff 	lea    -0xa0(%rax),%rdx
+  201402:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201406:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    }
+}
+  20140a:	90                   	nop
+  20140b:	c9                   	leave
+  20140c:	c3                   	ret
+
+000000000020140d <console_vprintf>:
+
+int console_vprintf(int cpos, int color, const char* format, va_list val) {
+  20140d:	55                   	push   %rbp
+  20140e:	48 89 e5             	mov    %rsp,%rbp
+  201411:	48 83 ec 30          	sub    $0x30,%rsp
+  201415:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  201418:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  20141b:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  20141f:	48 89 4d d8          	mov    %rcx,-0x28(%rbp)
+    struct console_printer cp;
+    cp.p.putc = console_putc;
+  201423:	48 8d 05 f5 fd ff ff 	lea    -0x20b(%rip),%rax        # 20121f <console_putc>
+  20142a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (cpos < 0 || cpos >= CONSOLE_ROWS * CONSOLE_COLUMNS) {
+  20142e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  201432:	78 09                	js     20143d <console_vprintf+0x30>
+  201434:	81 7d ec cf 07 00 00 	cmpl   $0x7cf,-0x14(%rbp)
+  20143b:	7e 07                	jle    201444 <console_vprintf+0x37>
+        cpos = 0;
+  20143d:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+    }
+    cp.cursor = console + cpos;
+  201444:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  201447:	48 98                	cltq
+  201449:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  20144d:	48 8d 05 ac 6b eb ff 	lea    -0x149454(%rip),%rax        # b8000 <console>
+  201454:	48 01 d0             	add    %rdx,%rax
+  201457:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    printer_vprintf(&cp.p, color, format, val);
+  20145b:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  20145f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  201463:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  201466:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  20146a:	48 89 c7             	mov    %rax,%rdi
+  20146d:	e8 a9 f3 ff ff       	call   20081b <printer_vprintf>
+    return cp.cursor - console;
+  201472:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  201476:	48 8d 05 83 6b eb ff 	lea    -0x14947d(%rip),%rax        # b8000 <console>
+  20147d:	48 29 c2             	sub    %rax,%rdx
+  201480:	48 89 d0             	mov    %rdx,%rax
+  201483:	48 d1 f8             	sar    %rax
+}
+  201486:	c9                   	leave
+  201487:	c3                   	ret
+
+0000000000201488 <console_printf>:
+
+int console_printf(int cpos, int color, const char* format, ...) {
+  201488:	55                   	push   %rbp
+  201489:	48 89 e5             	mov    %rsp,%rbp
+  20148c:	48 83 ec 60          	sub    $0x60,%rsp
+  201490:	89 7d ac             	mov    %edi,-0x54(%rbp)
+  201493:	89 75 a8             	mov    %esi,-0x58(%rbp)
+  201496:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+  20149a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  20149e:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  2014a2:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list val;
+    va_start(val, format);
+  2014a6:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  2014ad:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  2014b1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  2014b5:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  2014b9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    cpos = console_vprintf(cpos, color, format, val);
+  2014bd:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  2014c1:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  2014c5:	8b 75 a8             	mov    -0x58(%rbp),%esi
+  2014c8:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  2014cb:	89 c7                	mov    %eax,%edi
+  2014cd:	e8 3b ff ff ff       	call   20140d <console_vprintf>
+  2014d2:	89 45 ac             	mov    %eax,-0x54(%rbp)
+    va_end(val);
+    return cpos;
+  2014d5:	8b 45 ac             	mov    -0x54(%rbp),%eax
+}
+  2014d8:	c9                   	leave
+  2014d9:	c3                   	ret
+
+00000000002014da <string_putc>:
+    printer p;
+    char* s;
+    char* end;
+} string_printer;
+
+static void string_putc(printer* p, unsigned char c, int color) {
+  2014da:	55                   	push   %rbp
+  2014db:	48 89 e5             	mov    %rsp,%rbp
+  2014de:	48 83 ec 20          	sub    $0x20,%rsp
+  2014e2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  2014e6:	89 f0                	mov    %esi,%eax
+  2014e8:	89 55 e0             	mov    %edx,-0x20(%rbp)
+  2014eb:	88 45 e4             	mov    %al,-0x1c(%rbp)
+    string_printer* sp = (string_printer*) p;
+  2014ee:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2014f2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (sp->s < sp->end) {
+  2014f6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2014fa:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  2014fe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  201502:	48 8b 40 10          	mov    0x10(%rax),%rax
+  201506:	48 39 c2             	cmp    %rax,%rdx
+  201509:	73 1a                	jae    201525 <string_putc+0x4b>
+        *sp->s++ = c;
+  20150b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20150f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  201513:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  201517:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  20151b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  20151f:	0f b6 55 e4          	movzbl -0x1c(%rbp),%edx
+  201523:	88 10                	mov    %dl,(%rax)
+    }
+    (void) color;
+}
+  201525:	90                   	nop
+  201526:	c9                   	leave
+  201527:	c3                   	ret
+
+0000000000201528 <vsnprintf>:
+
+int vsnprintf(char* s, size_t size, const char* format, va_list val) {
+  201528:	55                   	push   %rbp
+  201529:	48 89 e5             	mov    %rsp,%rbp
+  20152c:	48 83 ec 40          	sub    $0x40,%rsp
+  201530:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  201534:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  201538:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  20153c:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+    string_printer sp;
+    sp.p.putc = string_putc;
+  201540:	48 8d 05 93 ff ff ff 	lea    -0x6d(%rip),%rax        # 2014da <string_putc>
+  201547:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    sp.s = s;
+  20154b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  20154f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (size) {
+  201553:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  201558:	74 33                	je     20158d <vsnprintf+0x65>
+        sp.end = s + size - 1;
+  20155a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  20155e:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  201562:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  201566:	48 01 d0             	add    %rdx,%rax
+  201569:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+        printer_vprintf(&sp.p, 0, format, val);
+  20156d:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  201571:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  201575:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  201579:	be 00 00 00 00       	mov    $0x0,%esi
+  20157e:	48 89 c7             	mov    %rax,%rdi
+  201581:	e8 95 f2 ff ff       	call   20081b <printer_vprintf>
+        *sp.s = 0;
+  201586:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  20158a:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return sp.s - s;
+  20158d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  201591:	48 2b 45 d8          	sub    -0x28(%rbp),%rax
+}
+  201595:	c9                   	leave
+  201596:	c3                   	ret
+
+0000000000201597 <snprintf>:
+
+int snprintf(char* s, size_t size, const char* format, ...) {
+  201597:	55                   	push   %rbp
+  201598:	48 89 e5             	mov    %rsp,%rbp
+  20159b:	48 83 ec 70          	sub    $0x70,%rsp
+  20159f:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  2015a3:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  2015a7:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  2015ab:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  2015af:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  2015b3:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list val;
+    va_start(val, format);
+  2015b7:	c7 45 b0 18 00 00 00 	movl   $0x18,-0x50(%rbp)
+  2015be:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  2015c2:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  2015c6:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  2015ca:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    int n = vsnprintf(s, size, format, val);
+  2015ce:	48 8d 4d b0          	lea    -0x50(%rbp),%rcx
+  2015d2:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  2015d6:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  2015da:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  2015de:	48 89 c7             	mov    %rax,%rdi
+  2015e1:	e8 42 ff ff ff       	call   201528 <vsnprintf>
+  2015e6:	89 45 cc             	mov    %eax,-0x34(%rbp)
+    va_end(val);
+    return n;
+  2015e9:	8b 45 cc             	mov    -0x34(%rbp),%eax
+}
+  2015ec:	c9                   	leave
+  2015ed:	c3                   	ret
+
+00000000002015ee <console_clear>:
+
+
+// console_clear
+//    Erases the console and moves the cursor to the upper left (CPOS(0, 0)).
+
+void console_clear(void) {
+  2015ee:	55                   	push   %rbp
+  2015ef:	48 89 e5             	mov    %rsp,%rbp
+  2015f2:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < CONSOLE_ROWS * CONSOLE_COLUMNS; ++i) {
+  2015f6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  2015fd:	eb 1a                	jmp    201619 <console_clear+0x2b>
+        console[i] = ' ' | 0x0700;
+  2015ff:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  201602:	48 98                	cltq
+  201604:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  201608:	48 8d 05 f1 69 eb ff 	lea    -0x14960f(%rip),%rax        # b8000 <console>
+  20160f:	66 c7 04 02 20 07    	movw   $0x720,(%rdx,%rax,1)
+    for (int i = 0; i < CONSOLE_ROWS * CONSOLE_COLUMNS; ++i) {
+  201615:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  201619:	81 7d fc cf 07 00 00 	cmpl   $0x7cf,-0x4(%rbp)
+  201620:	7e dd                	jle    2015ff <console_clear+0x11>
+    }
+    cursorpos = 0;
+  201622:	c7 05 d0 79 eb ff 00 	movl   $0x0,-0x148630(%rip)        # b8ffc <cursorpos>
+  201629:	00 00 00 
+}
+  20162c:	90                   	nop
+  20162d:	c9                   	leave
+  20162e:	c3                   	ret
+
+000000000020162f <string_to_char>:
+
+
+int string_to_char(const char *str, int *dest) {
+  20162f:	55                   	push   %rbp
+  201630:	48 89 e5             	mov    %rsp,%rbp
+  201633:	48 83 ec 20          	sub    $0x20,%rsp
+  201637:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  20163b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    if (*str == '\0') return -1;
+  20163f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201643:	0f b6 00             	movzbl (%rax),%eax
+  201646:	84 c0                	test   %al,%al
+  201648:	75 0a                	jne    201654 <string_to_char+0x25>
+  20164a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  20164f:	e9 e0 00 00 00       	jmp    201734 <string_to_char+0x105>
+
+    *dest = 0;
+  201654:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  201658:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    for (; *str; str++) {
+  20165e:	e9 bd 00 00 00       	jmp    201720 <string_to_char+0xf1>
+        int digit = 0;
+  201663:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+        switch (*str)
+  20166a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20166e:	0f b6 00             	movzbl (%rax),%eax
+  201671:	0f be c0             	movsbl %al,%eax
+  201674:	83 e8 30             	sub    $0x30,%eax
+  201677:	83 f8 09             	cmp    $0x9,%eax
+  20167a:	77 7c                	ja     2016f8 <string_to_char+0xc9>
+  20167c:	89 c0                	mov    %eax,%eax
+  20167e:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  201685:	00 
+  201686:	48 8d 05 07 0d 00 00 	lea    0xd07(%rip),%rax        # 202394 <flag_chars+0xf4>
+  20168d:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+  201690:	48 98                	cltq
+  201692:	48 8d 15 fb 0c 00 00 	lea    0xcfb(%rip),%rdx        # 202394 <flag_chars+0xf4>
+  201699:	48 01 d0             	add    %rdx,%rax
+  20169c:	ff e0                	jmp    *%rax
+        {
+        case '0':
+            digit = 0;
+  20169e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+            break;
+  2016a5:	eb 58                	jmp    2016ff <string_to_char+0xd0>
+        case '1':
+            digit = 1;
+  2016a7:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+            break;
+  2016ae:	eb 4f                	jmp    2016ff <string_to_char+0xd0>
+        case '2':
+            digit = 2;
+  2016b0:	c7 45 fc 02 00 00 00 	movl   $0x2,-0x4(%rbp)
+            break;
+  2016b7:	eb 46                	jmp    2016ff <string_to_char+0xd0>
+        case '3':
+            digit = 3;
+  2016b9:	c7 45 fc 03 00 00 00 	movl   $0x3,-0x4(%rbp)
+            break;
+  2016c0:	eb 3d                	jmp    2016ff <string_to_char+0xd0>
+        case '4':
+            digit = 4;
+  2016c2:	c7 45 fc 04 00 00 00 	movl   $0x4,-0x4(%rbp)
+            break;
+  2016c9:	eb 34                	jmp    2016ff <string_to_char+0xd0>
+        case '5':
+            digit = 5;
+  2016cb:	c7 45 fc 05 00 00 00 	movl   $0x5,-0x4(%rbp)
+            break;
+  2016d2:	eb 2b                	jmp    2016ff <string_to_char+0xd0>
+        case '6':
+            digit = 6;
+  2016d4:	c7 45 fc 06 00 00 00 	movl   $0x6,-0x4(%rbp)
+            break;
+  2016db:	eb 22                	jmp    2016ff <string_to_char+0xd0>
+        case '7':
+            digit = 7;
+  2016dd:	c7 45 fc 07 00 00 00 	movl   $0x7,-0x4(%rbp)
+            break;
+  2016e4:	eb 19                	jmp    2016ff <string_to_char+0xd0>
+        case '8':
+            digit = 8;
+  2016e6:	c7 45 fc 08 00 00 00 	movl   $0x8,-0x4(%rbp)
+            break;
+  2016ed:	eb 10                	jmp    2016ff <string_to_char+0xd0>
+        case '9':
+            digit = 9;
+  2016ef:	c7 45 fc 09 00 00 00 	movl   $0x9,-0x4(%rbp)
+            break;
+  2016f6:	eb 07                	jmp    2016ff <string_to_char+0xd0>
+        default:
+            return -1;
+  2016f8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  2016fd:	eb 35                	jmp    201734 <string_to_char+0x105>
+        }
+
+        *dest = *dest * 10 + digit;
+  2016ff:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  201703:	8b 10                	mov    (%rax),%edx
+  201705:	89 d0                	mov    %edx,%eax
+  201707:	c1 e0 02             	shl    $0x2,%eax
+  20170a:	01 d0                	add    %edx,%eax
+  20170c:	01 c0                	add    %eax,%eax
+  20170e:	89 c2                	mov    %eax,%edx
+  201710:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  201713:	01 c2                	add    %eax,%edx
+  201715:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  201719:	89 10                	mov    %edx,(%rax)
+    for (; *str; str++) {
+  20171b:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  201720:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201724:	0f b6 00             	movzbl (%rax),%eax
+  201727:	84 c0                	test   %al,%al
+  201729:	0f 85 34 ff ff ff    	jne    201663 <string_to_char+0x34>
+    }
+
+    return 0;
+  20172f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  201734:	c9                   	leave
+  201735:	c3                   	ret
+
+0000000000201736 <atoi>:
+
+int atoi(const char *str) {
+  201736:	55                   	push   %rbp
+  201737:	48 89 e5             	mov    %rsp,%rbp
+  20173a:	48 83 ec 18          	sub    $0x18,%rsp
+  20173e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    if (*str == '\0') return -1;
+  201742:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201746:	0f b6 00             	movzbl (%rax),%eax
+  201749:	84 c0                	test   %al,%al
+  20174b:	75 0a                	jne    201757 <atoi+0x21>
+  20174d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  201752:	e9 d7 00 00 00       	jmp    20182e <atoi+0xf8>
+
+    int n = 0;
+  201757:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    for (; *str; str++) {
+  20175e:	e9 b7 00 00 00       	jmp    20181a <atoi+0xe4>
+        int digit = 0;
+  201763:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+        switch (*str)
+  20176a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20176e:	0f b6 00             	movzbl (%rax),%eax
+  201771:	0f be c0             	movsbl %al,%eax
+  201774:	83 e8 30             	sub    $0x30,%eax
+  201777:	83 f8 09             	cmp    $0x9,%eax
+  20177a:	77 7c                	ja     2017f8 <atoi+0xc2>
+  20177c:	89 c0                	mov    %eax,%eax
+  20177e:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  201785:	00 
+  201786:	48 8d 05 2f 0c 00 00 	lea    0xc2f(%rip),%rax        # 2023bc <flag_chars+0x11c>
+  20178d:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+  201790:	48 98                	cltq
+  201792:	48 8d 15 23 0c 00 00 	lea    0xc23(%rip),%rdx        # 2023bc <flag_chars+0x11c>
+  201799:	48 01 d0             	add    %rdx,%rax
+  20179c:	ff e0                	jmp    *%rax
+        {
+        case '0':
+            digit = 0;
+  20179e:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+            break;
+  2017a5:	eb 58                	jmp    2017ff <atoi+0xc9>
+        case '1':
+            digit = 1;
+  2017a7:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+            break;
+  2017ae:	eb 4f                	jmp    2017ff <atoi+0xc9>
+        case '2':
+            digit = 2;
+  2017b0:	c7 45 f8 02 00 00 00 	movl   $0x2,-0x8(%rbp)
+            break;
+  2017b7:	eb 46                	jmp    2017ff <atoi+0xc9>
+        case '3':
+            digit = 3;
+  2017b9:	c7 45 f8 03 00 00 00 	movl   $0x3,-0x8(%rbp)
+            break;
+  2017c0:	eb 3d                	jmp    2017ff <atoi+0xc9>
+        case '4':
+            digit = 4;
+  2017c2:	c7 45 f8 04 00 00 00 	movl   $0x4,-0x8(%rbp)
+            break;
+  2017c9:	eb 34                	jmp    2017ff <atoi+0xc9>
+        case '5':
+            digit = 5;
+  2017cb:	c7 45 f8 05 00 00 00 	movl   $0x5,-0x8(%rbp)
+            break;
+  2017d2:	eb 2b                	jmp    2017ff <atoi+0xc9>
+        case '6':
+            digit = 6;
+  2017d4:	c7 45 f8 06 00 00 00 	movl   $0x6,-0x8(%rbp)
+            break;
+  2017db:	eb 22                	jmp    2017ff <atoi+0xc9>
+        case '7':
+            digit = 7;
+  2017dd:	c7 45 f8 07 00 00 00 	movl   $0x7,-0x8(%rbp)
+            break;
+  2017e4:	eb 19                	jmp    2017ff <atoi+0xc9>
+        case '8':
+            digit = 8;
+  2017e6:	c7 45 f8 08 00 00 00 	movl   $0x8,-0x8(%rbp)
+            break;
+  2017ed:	eb 10                	jmp    2017ff <atoi+0xc9>
+        case '9':
+            digit = 9;
+  2017ef:	c7 45 f8 09 00 00 00 	movl   $0x9,-0x8(%rbp)
+            break;
+  2017f6:	eb 07                	jmp    2017ff <atoi+0xc9>
+        default:
+            return -1;
+  2017f8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  2017fd:	eb 2f                	jmp    20182e <atoi+0xf8>
+        }
+
+        n = n * 10 + digit;
+  2017ff:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  201802:	89 d0                	mov    %edx,%eax
+  201804:	c1 e0 02             	shl    $0x2,%eax
+  201807:	01 d0                	add    %edx,%eax
+  201809:	01 c0                	add    %eax,%eax
+  20180b:	89 c2                	mov    %eax,%edx
+  20180d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  201810:	01 d0                	add    %edx,%eax
+  201812:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    for (; *str; str++) {
+  201815:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  20181a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20181e:	0f b6 00             	movzbl (%rax),%eax
+  201821:	84 c0                	test   %al,%al
+  201823:	0f 85 3a ff ff ff    	jne    201763 <atoi+0x2d>
+    }
+
+    return 0;
+  201829:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  20182e:	c9                   	leave
+  20182f:	c3                   	ret
+
+0000000000201830 <copy_comp>:
+        components[ncomp++] = (comp); \
+    } \
+} while (0)
+
+// Helper to copy a component to dst
+void copy_comp(const char *start, const char *end, char **pdst) {
+  201830:	55                   	push   %rbp
+  201831:	48 89 e5             	mov    %rsp,%rbp
+  201834:	48 83 ec 18          	sub    $0x18,%rsp
+  201838:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  20183c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  201840:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    while (start < end) {
+  201844:	eb 23                	jmp    201869 <copy_comp+0x39>
+        *(*pdst)++ = *start++;
+  201846:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  20184a:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  20184e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  201852:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201856:	48 8b 00             	mov    (%rax),%rax
+  201859:	48 8d 70 01          	lea    0x1(%rax),%rsi
+  20185d:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  201861:	48 89 31             	mov    %rsi,(%rcx)
+  201864:	0f b6 12             	movzbl (%rdx),%edx
+  201867:	88 10                	mov    %dl,(%rax)
+    while (start < end) {
+  201869:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20186d:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  201871:	72 d3                	jb     201846 <copy_comp+0x16>
+    }
+}
+  201873:	90                   	nop
+  201874:	90                   	nop
+  201875:	c9                   	leave
+  201876:	c3                   	ret
+
+0000000000201877 <join_path>:
+
+
+void join_path(const char *abs_path, const char *path, char *dst) {
+  201877:	55                   	push   %rbp
+  201878:	48 89 e5             	mov    %rsp,%rbp
+  20187b:	48 81 ec 68 02 00 00 	sub    $0x268,%rsp
+  201882:	48 89 bd a8 fd ff ff 	mov    %rdi,-0x258(%rbp)
+  201889:	48 89 b5 a0 fd ff ff 	mov    %rsi,-0x260(%rbp)
+  201890:	48 89 95 98 fd ff ff 	mov    %rdx,-0x268(%rbp)
+    // If path is absolute, just copy it to dst (removing duplicate slashes, and trailing slash unless root)
+    if (path[0] == '/') {
+  201897:	48 8b 85 a0 fd ff ff 	mov    -0x260(%rbp),%rax
+  20189e:	0f b6 00             	movzbl (%rax),%eax
+  2018a1:	3c 2f                	cmp    $0x2f,%al
+  2018a3:	0f 85 d6 00 00 00    	jne    20197f <join_path+0x108>
+        const char *src = path;
+  2018a9:	48 8b 85 a0 fd ff ff 	mov    -0x260(%rbp),%rax
+  2018b0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+        char *d = dst;
+  2018b4:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  2018bb:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+        // Always start with a single slash
+        *d++ = '/';
+  2018bf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2018c3:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  2018c7:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  2018cb:	c6 00 2f             	movb   $0x2f,(%rax)
+        src++;
+  2018ce:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+        int last_was_slash = 1;
+  2018d3:	c7 45 b0 01 00 00 00 	movl   $0x1,-0x50(%rbp)
+        while (*src) {
+  2018da:	eb 64                	jmp    201940 <join_path+0xc9>
+            if (*src == '/') {
+  2018dc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2018e0:	0f b6 00             	movzbl (%rax),%eax
+  2018e3:	3c 2f                	cmp    $0x2f,%al
+  2018e5:	75 35                	jne    20191c <join_path+0xa5>
+                // Skip consecutive slashes
+                while (*src == '/') src++;
+  2018e7:	eb 05                	jmp    2018ee <join_path+0x77>
+  2018e9:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  2018ee:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2018f2:	0f b6 00             	movzbl (%rax),%eax
+  2018f5:	3c 2f                	cmp    $0x2f,%al
+  2018f7:	74 f0                	je     2018e9 <join_path+0x72>
+                if (*src == 0) break;
+  2018f9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2018fd:	0f b6 00             	movzbl (%rax),%eax
+  201900:	84 c0                	test   %al,%al
+  201902:	74 49                	je     20194d <join_path+0xd6>
+                *d++ = '/';
+  201904:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  201908:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  20190c:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  201910:	c6 00 2f             	movb   $0x2f,(%rax)
+                last_was_slash = 1;
+  201913:	c7 45 b0 01 00 00 00 	movl   $0x1,-0x50(%rbp)
+  20191a:	eb 24                	jmp    201940 <join_path+0xc9>
+            } else {
+                *d++ = *src++;
+  20191c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  201920:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  201924:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  201928:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  20192c:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  201930:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  201934:	0f b6 12             	movzbl (%rdx),%edx
+  201937:	88 10                	mov    %dl,(%rax)
+                last_was_slash = 0;
+  201939:	c7 45 b0 00 00 00 00 	movl   $0x0,-0x50(%rbp)
+        while (*src) {
+  201940:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  201944:	0f b6 00             	movzbl (%rax),%eax
+  201947:	84 c0                	test   %al,%al
+  201949:	75 91                	jne    2018dc <join_path+0x65>
+  20194b:	eb 01                	jmp    20194e <join_path+0xd7>
+                if (*src == 0) break;
+  20194d:	90                   	nop
+            }
+        }
+        // Remove trailing slash unless the path is just "/"
+        if (d > dst + 1 && *(d-1) == '/') {
+  20194e:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  201955:	48 83 c0 01          	add    $0x1,%rax
+  201959:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  20195d:	73 14                	jae    201973 <join_path+0xfc>
+  20195f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  201963:	48 83 e8 01          	sub    $0x1,%rax
+  201967:	0f b6 00             	movzbl (%rax),%eax
+  20196a:	3c 2f                	cmp    $0x2f,%al
+  20196c:	75 05                	jne    201973 <join_path+0xfc>
+            d--;
+  20196e:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+        }
+        *d = 0;
+  201973:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  201977:	c6 00 00             	movb   $0x0,(%rax)
+  20197a:	e9 e9 02 00 00       	jmp    201c68 <join_path+0x3f1>
+        return;
+    }
+
+    // Otherwise, start with abs_path
+    const char *src = abs_path;
+  20197f:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  201986:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    char *d = dst;
+  20198a:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  201991:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    if (*src != '/') {
+  201995:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201999:	0f b6 00             	movzbl (%rax),%eax
+  20199c:	3c 2f                	cmp    $0x2f,%al
+  20199e:	74 2e                	je     2019ce <join_path+0x157>
+        *d++ = '/';
+  2019a0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  2019a4:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  2019a8:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  2019ac:	c6 00 2f             	movb   $0x2f,(%rax)
+    }
+    while (*src) {
+  2019af:	eb 1d                	jmp    2019ce <join_path+0x157>
+        *d++ = *src++;
+  2019b1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  2019b5:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  2019b9:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  2019bd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  2019c1:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  2019c5:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  2019c9:	0f b6 12             	movzbl (%rdx),%edx
+  2019cc:	88 10                	mov    %dl,(%rax)
+    while (*src) {
+  2019ce:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2019d2:	0f b6 00             	movzbl (%rax),%eax
+  2019d5:	84 c0                	test   %al,%al
+  2019d7:	75 d8                	jne    2019b1 <join_path+0x13a>
+    }
+    // Remove trailing slash (unless root)
+    if (d > dst + 1 && *(d-1) == '/') {
+  2019d9:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  2019e0:	48 83 c0 01          	add    $0x1,%rax
+  2019e4:	48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+  2019e8:	73 14                	jae    2019fe <join_path+0x187>
+  2019ea:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  2019ee:	48 83 e8 01          	sub    $0x1,%rax
+  2019f2:	0f b6 00             	movzbl (%rax),%eax
+  2019f5:	3c 2f                	cmp    $0x2f,%al
+  2019f7:	75 05                	jne    2019fe <join_path+0x187>
+        d--;
+  2019f9:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+    }
+    *d = 0;
+  2019fe:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  201a02:	c6 00 00             	movb   $0x0,(%rax)
+
+    // Now, process path components
+    char temp[512];
+    int tlen = 0;
+  201a05:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    // Copy dst to temp for easier manipulation
+    src = dst;
+  201a0c:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  201a13:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    while (*src && tlen < (int)sizeof(temp)-1) {
+  201a17:	eb 22                	jmp    201a3b <join_path+0x1c4>
+        temp[tlen++] = *src++;
+  201a19:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201a1d:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  201a21:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  201a25:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  201a28:	8d 4a 01             	lea    0x1(%rdx),%ecx
+  201a2b:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  201a2e:	0f b6 08             	movzbl (%rax),%ecx
+  201a31:	48 63 c2             	movslq %edx,%rax
+  201a34:	88 8c 05 b0 fd ff ff 	mov    %cl,-0x250(%rbp,%rax,1)
+    while (*src && tlen < (int)sizeof(temp)-1) {
+  201a3b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201a3f:	0f b6 00             	movzbl (%rax),%eax
+  201a42:	84 c0                	test   %al,%al
+  201a44:	74 09                	je     201a4f <join_path+0x1d8>
+  201a46:	81 7d dc fe 01 00 00 	cmpl   $0x1fe,-0x24(%rbp)
+  201a4d:	7e ca                	jle    201a19 <join_path+0x1a2>
+    }
+    temp[tlen] = 0;
+  201a4f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201a52:	48 98                	cltq
+  201a54:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  201a5b:	00 
+
+    // Now, process each component in path
+    src = path;
+  201a5c:	48 8b 85 a0 fd ff ff 	mov    -0x260(%rbp),%rax
+  201a63:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    while (*src) {
+  201a67:	e9 65 01 00 00       	jmp    201bd1 <join_path+0x35a>
+        // Skip slashes
+        while (*src == '/') src++;
+  201a6c:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  201a71:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201a75:	0f b6 00             	movzbl (%rax),%eax
+  201a78:	3c 2f                	cmp    $0x2f,%al
+  201a7a:	74 f0                	je     201a6c <join_path+0x1f5>
+        if (!*src) break;
+  201a7c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201a80:	0f b6 00             	movzbl (%rax),%eax
+  201a83:	84 c0                	test   %al,%al
+  201a85:	0f 84 57 01 00 00    	je     201be2 <join_path+0x36b>
+
+        // Find end of component
+        const char *comp_start = src;
+  201a8b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201a8f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        while (*src && *src != '/') src++;
+  201a93:	eb 05                	jmp    201a9a <join_path+0x223>
+  201a95:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  201a9a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201a9e:	0f b6 00             	movzbl (%rax),%eax
+  201aa1:	84 c0                	test   %al,%al
+  201aa3:	74 0b                	je     201ab0 <join_path+0x239>
+  201aa5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201aa9:	0f b6 00             	movzbl (%rax),%eax
+  201aac:	3c 2f                	cmp    $0x2f,%al
+  201aae:	75 e5                	jne    201a95 <join_path+0x21e>
+        const char *comp_end = src;
+  201ab0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201ab4:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+
+        int comp_len = comp_end - comp_start;
+  201ab8:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  201abc:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  201ac0:	89 45 b4             	mov    %eax,-0x4c(%rbp)
+
+        // Get component string
+        if (comp_len == 1 && comp_start[0] == '.') {
+  201ac3:	83 7d b4 01          	cmpl   $0x1,-0x4c(%rbp)
+  201ac7:	75 10                	jne    201ad9 <join_path+0x262>
+  201ac9:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  201acd:	0f b6 00             	movzbl (%rax),%eax
+  201ad0:	3c 2e                	cmp    $0x2e,%al
+  201ad2:	75 05                	jne    201ad9 <join_path+0x262>
+            // Ignore
+            continue;
+  201ad4:	e9 f8 00 00 00       	jmp    201bd1 <join_path+0x35a>
+        } else if (comp_len == 2 && comp_start[0] == '.' && comp_start[1] == '.') {
+  201ad9:	83 7d b4 02          	cmpl   $0x2,-0x4c(%rbp)
+  201add:	75 6e                	jne    201b4d <join_path+0x2d6>
+  201adf:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  201ae3:	0f b6 00             	movzbl (%rax),%eax
+  201ae6:	3c 2e                	cmp    $0x2e,%al
+  201ae8:	75 63                	jne    201b4d <join_path+0x2d6>
+  201aea:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  201aee:	48 83 c0 01          	add    $0x1,%rax
+  201af2:	0f b6 00             	movzbl (%rax),%eax
+  201af5:	3c 2e                	cmp    $0x2e,%al
+  201af7:	75 54                	jne    201b4d <join_path+0x2d6>
+            // Go up one directory, unless at root
+            if (tlen > 1) {
+  201af9:	83 7d dc 01          	cmpl   $0x1,-0x24(%rbp)
+  201afd:	0f 8e ce 00 00 00    	jle    201bd1 <join_path+0x35a>
+                // Remove trailing slash if any
+                if (temp[tlen-1] == '/') tlen--;
+  201b03:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201b06:	83 e8 01             	sub    $0x1,%eax
+  201b09:	48 98                	cltq
+  201b0b:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  201b12:	ff 
+  201b13:	3c 2f                	cmp    $0x2f,%al
+  201b15:	75 0a                	jne    201b21 <join_path+0x2aa>
+  201b17:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+                // Remove last component
+                while (tlen > 1 && temp[tlen-1] != '/') tlen--;
+  201b1b:	eb 04                	jmp    201b21 <join_path+0x2aa>
+  201b1d:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  201b21:	83 7d dc 01          	cmpl   $0x1,-0x24(%rbp)
+  201b25:	7e 14                	jle    201b3b <join_path+0x2c4>
+  201b27:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201b2a:	83 e8 01             	sub    $0x1,%eax
+  201b2d:	48 98                	cltq
+  201b2f:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  201b36:	ff 
+  201b37:	3c 2f                	cmp    $0x2f,%al
+  201b39:	75 e2                	jne    201b1d <join_path+0x2a6>
+                temp[tlen] = 0;
+  201b3b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201b3e:	48 98                	cltq
+  201b40:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  201b47:	00 
+            if (tlen > 1) {
+  201b48:	e9 84 00 00 00       	jmp    201bd1 <join_path+0x35a>
+            }
+        } else if (comp_len > 0) {
+  201b4d:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  201b51:	7e 7e                	jle    201bd1 <join_path+0x35a>
+            // Add slash if not at root
+            if (tlen == 0 || temp[tlen-1] != '/') {
+  201b53:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  201b57:	74 14                	je     201b6d <join_path+0x2f6>
+  201b59:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201b5c:	83 e8 01             	sub    $0x1,%eax
+  201b5f:	48 98                	cltq
+  201b61:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  201b68:	ff 
+  201b69:	3c 2f                	cmp    $0x2f,%al
+  201b6b:	74 1c                	je     201b89 <join_path+0x312>
+                if (tlen < (int)sizeof(temp)-1) temp[tlen++] = '/';
+  201b6d:	81 7d dc fe 01 00 00 	cmpl   $0x1fe,-0x24(%rbp)
+  201b74:	7f 13                	jg     201b89 <join_path+0x312>
+  201b76:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201b79:	8d 50 01             	lea    0x1(%rax),%edx
+  201b7c:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  201b7f:	48 98                	cltq
+  201b81:	c6 84 05 b0 fd ff ff 	movb   $0x2f,-0x250(%rbp,%rax,1)
+  201b88:	2f 
+            }
+            // Copy component
+            for (const char *p = comp_start; p < comp_end && tlen < (int)sizeof(temp)-1; ++p) {
+  201b89:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  201b8d:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  201b91:	eb 1e                	jmp    201bb1 <join_path+0x33a>
+                temp[tlen++] = *p;
+  201b93:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201b96:	8d 50 01             	lea    0x1(%rax),%edx
+  201b99:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  201b9c:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  201ba0:	0f b6 12             	movzbl (%rdx),%edx
+  201ba3:	48 98                	cltq
+  201ba5:	88 94 05 b0 fd ff ff 	mov    %dl,-0x250(%rbp,%rax,1)
+            for (const char *p = comp_start; p < comp_end && tlen < (int)sizeof(temp)-1; ++p) {
+  201bac:	48 83 45 d0 01       	addq   $0x1,-0x30(%rbp)
+  201bb1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  201bb5:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  201bb9:	73 09                	jae    201bc4 <join_path+0x34d>
+  201bbb:	81 7d dc fe 01 00 00 	cmpl   $0x1fe,-0x24(%rbp)
+  201bc2:	7e cf                	jle    201b93 <join_path+0x31c>
+            }
+            temp[tlen] = 0;
+  201bc4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201bc7:	48 98                	cltq
+  201bc9:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  201bd0:	00 
+    while (*src) {
+  201bd1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201bd5:	0f b6 00             	movzbl (%rax),%eax
+  201bd8:	84 c0                	test   %al,%al
+  201bda:	0f 85 91 fe ff ff    	jne    201a71 <join_path+0x1fa>
+  201be0:	eb 01                	jmp    201be3 <join_path+0x36c>
+        if (!*src) break;
+  201be2:	90                   	nop
+        }
+    }
+
+    // If temp is empty, set to "/"
+    if (tlen == 0) {
+  201be3:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  201be7:	75 20                	jne    201c09 <join_path+0x392>
+        temp[tlen++] = '/';
+  201be9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201bec:	8d 50 01             	lea    0x1(%rax),%edx
+  201bef:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  201bf2:	48 98                	cltq
+  201bf4:	c6 84 05 b0 fd ff ff 	movb   $0x2f,-0x250(%rbp,%rax,1)
+  201bfb:	2f 
+        temp[tlen] = 0;
+  201bfc:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201bff:	48 98                	cltq
+  201c01:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  201c08:	00 
+    }
+
+    // Remove trailing slash unless the path is just "/"
+    if (tlen > 1 && temp[tlen-1] == '/') {
+  201c09:	83 7d dc 01          	cmpl   $0x1,-0x24(%rbp)
+  201c0d:	7e 25                	jle    201c34 <join_path+0x3bd>
+  201c0f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201c12:	83 e8 01             	sub    $0x1,%eax
+  201c15:	48 98                	cltq
+  201c17:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  201c1e:	ff 
+  201c1f:	3c 2f                	cmp    $0x2f,%al
+  201c21:	75 11                	jne    201c34 <join_path+0x3bd>
+        temp[--tlen] = 0;
+  201c23:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  201c27:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201c2a:	48 98                	cltq
+  201c2c:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  201c33:	00 
+    }
+
+    // Copy temp to dst
+    for (int i = 0; i <= tlen; ++i) {
+  201c34:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  201c3b:	eb 23                	jmp    201c60 <join_path+0x3e9>
+        dst[i] = temp[i];
+  201c3d:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  201c40:	48 63 d0             	movslq %eax,%rdx
+  201c43:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  201c4a:	48 01 c2             	add    %rax,%rdx
+  201c4d:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  201c50:	48 98                	cltq
+  201c52:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  201c59:	ff 
+  201c5a:	88 02                	mov    %al,(%rdx)
+    for (int i = 0; i <= tlen; ++i) {
+  201c5c:	83 45 cc 01          	addl   $0x1,-0x34(%rbp)
+  201c60:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  201c63:	3b 45 dc             	cmp    -0x24(%rbp),%eax
+  201c66:	7e d5                	jle    201c3d <join_path+0x3c6>
+    }
+}
+  201c68:	c9                   	leave
+  201c69:	c3                   	ret
+
+0000000000201c6a <app_printf>:
+#include "lib-malloc.h"
+#include "errno.h"
+// app_printf
+//     A version of console_printf that picks a sensible color by process ID.
+
+void app_printf(int colorid, const char* format, ...) {
+  201c6a:	55                   	push   %rbp
+  201c6b:	48 89 e5             	mov    %rsp,%rbp
+  201c6e:	48 83 ec 50          	sub    $0x50,%rsp
+  201c72:	49 89 f2             	mov    %rsi,%r10
+  201c75:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  201c79:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  201c7d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  201c81:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    int color;
+    if (colorid < 0) {
+        color = 0x0700;
+  201c85:	be 00 07 00 00       	mov    $0x700,%esi
+    if (colorid < 0) {
+  201c8a:	85 ff                	test   %edi,%edi
+  201c8c:	78 32                	js     201cc0 <app_printf+0x56>
+    } else {
+        static const uint8_t col[] = { 0x0F, 0x0C, 0x0A, 0x09, 0x0E };
+        color = col[colorid % sizeof(col)] << 8;
+  201c8e:	48 63 ff             	movslq %edi,%rdi
+  201c91:	48 ba cd cc cc cc cc 	movabs $0xcccccccccccccccd,%rdx
+  201c98:	cc cc cc 
+  201c9b:	48 89 f8             	mov    %rdi,%rax
+  201c9e:	48 f7 e2             	mul    %rdx
+  201ca1:	48 89 d0             	mov    %rdx,%rax
+  201ca4:	48 c1 e8 02          	shr    $0x2,%rax
+  201ca8:	48 83 e2 fc          	and    $0xfffffffffffffffc,%rdx
+  201cac:	48 01 c2             	add    %rax,%rdx
+  201caf:	48 29 d7             	sub    %rdx,%rdi
+  201cb2:	48 8d 05 2f 09 00 00 	lea    0x92f(%rip),%rax        # 2025e8 <col.0>
+  201cb9:	0f b6 34 38          	movzbl (%rax,%rdi,1),%esi
+  201cbd:	c1 e6 08             	shl    $0x8,%esi
+    }
+
+    va_list val;
+    va_start(val, format);
+  201cc0:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  201cc7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  201ccb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  201ccf:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  201cd3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    cursorpos = console_vprintf(cursorpos, color, format, val);
+  201cd7:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  201cdb:	4c 89 d2             	mov    %r10,%rdx
+  201cde:	8b 3d 18 73 eb ff    	mov    -0x148ce8(%rip),%edi        # b8ffc <cursorpos>
+  201ce4:	e8 24 f7 ff ff       	call   20140d <console_vprintf>
+  201ce9:	89 05 0d 73 eb ff    	mov    %eax,-0x148cf3(%rip)        # b8ffc <cursorpos>
+    va_end(val);
+
+    /*if (CROW(cursorpos) >= 23) {
+        cursorpos = CPOS(0, 0);
+    }*/
+}
+  201cef:	c9                   	leave
+  201cf0:	c3                   	ret
+
+0000000000201cf1 <panic>:
+
+
+// panic, assert_fail
+//     Call the INT_SYS_PANIC system call so the kernel loops until Control-C.
+
+void panic(const char* format, ...) {
+  201cf1:	55                   	push   %rbp
+  201cf2:	48 89 e5             	mov    %rsp,%rbp
+  201cf5:	53                   	push   %rbx
+  201cf6:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  201cfd:	48 89 fb             	mov    %rdi,%rbx
+  201d00:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  201d04:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  201d08:	48 89 4d d8          	mov    %rcx,-0x28(%rbp)
+  201d0c:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  201d10:	4c 89 4d e8          	mov    %r9,-0x18(%rbp)
+    va_list val;
+    va_start(val, format);
+  201d14:	c7 45 a8 08 00 00 00 	movl   $0x8,-0x58(%rbp)
+  201d1b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  201d1f:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  201d23:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  201d27:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    char buf[160];
+    memcpy(buf, "PANIC: ", 7);
+  201d2b:	48 8d bd 08 ff ff ff 	lea    -0xf8(%rbp),%rdi
+  201d32:	ba 07 00 00 00       	mov    $0x7,%edx
+  201d37:	48 8d 35 e3 06 00 00 	lea    0x6e3(%rip),%rsi        # 202421 <lower_digits.0+0x11>
+  201d3e:	e8 31 e5 ff ff       	call   200274 <memcpy>
+    int len = vsnprintf(&buf[7], sizeof(buf) - 7, format, val) + 7;
+  201d43:	48 8d 4d a8          	lea    -0x58(%rbp),%rcx
+  201d47:	48 8d bd 0f ff ff ff 	lea    -0xf1(%rbp),%rdi
+  201d4e:	48 89 da             	mov    %rbx,%rdx
+  201d51:	be 99 00 00 00       	mov    $0x99,%esi
+  201d56:	e8 cd f7 ff ff       	call   201528 <vsnprintf>
+  201d5b:	8d 50 07             	lea    0x7(%rax),%edx
+    va_end(val);
+    if (len > 0 && buf[len - 1] != '\n') {
+  201d5e:	85 d2                	test   %edx,%edx
+  201d60:	7e 0f                	jle    201d71 <panic+0x80>
+  201d62:	83 c0 06             	add    $0x6,%eax
+  201d65:	48 98                	cltq
+  201d67:	80 bc 05 08 ff ff ff 	cmpb   $0xa,-0xf8(%rbp,%rax,1)
+  201d6e:	0a 
+  201d6f:	75 30                	jne    201da1 <panic+0xb0>
+        strcpy(buf + len - (len == (int) sizeof(buf) - 1), "\n");
+    }
+    (void) console_printf(CPOS(23, 0), 0xC000, "%s", buf);
+  201d71:	48 8d 8d 08 ff ff ff 	lea    -0xf8(%rbp),%rcx
+  201d78:	48 8d 15 16 05 00 00 	lea    0x516(%rip),%rdx        # 202295 <malloc+0xdc>
+  201d7f:	be 00 c0 00 00       	mov    $0xc000,%esi
+  201d84:	bf 30 07 00 00       	mov    $0x730,%edi
+  201d89:	b8 00 00 00 00       	mov    $0x0,%eax
+  201d8e:	e8 f5 f6 ff ff       	call   201488 <console_printf>
+    asm volatile ("syscall" : "=a" (rax)
+  201d93:	b8 30 00 00 00       	mov    $0x30,%eax
+  201d98:	bf 00 00 00 00       	mov    $0x0,%edi
+  201d9d:	0f 05                	syscall
+ loop: goto loop;
+  201d9f:	eb fe                	jmp    201d9f <panic+0xae>
+        strcpy(buf + len - (len == (int) sizeof(buf) - 1), "\n");
+  201da1:	48 63 c2             	movslq %edx,%rax
+  201da4:	81 fa 9f 00 00 00    	cmp    $0x9f,%edx
+  201daa:	0f 94 c2             	sete   %dl
+  201dad:	0f b6 d2             	movzbl %dl,%edx
+  201db0:	48 29 d0             	sub    %rdx,%rax
+  201db3:	48 8d bc 05 08 ff ff 	lea    -0xf8(%rbp,%rax,1),%rdi
+  201dba:	ff 
+  201dbb:	48 8d 35 ca 04 00 00 	lea    0x4ca(%rip),%rsi        # 20228c <malloc+0xd3>
+  201dc2:	e8 3b e8 ff ff       	call   200602 <strcpy>
+  201dc7:	eb a8                	jmp    201d71 <panic+0x80>
+
+0000000000201dc9 <raise>:
+
+#define SIGABRT -1
+
+
+
+int raise(int sig) {
+  201dc9:	89 fe                	mov    %edi,%esi
+
+// getpid()
+//    Return current process ID, like sys_getpid().
+static inline pid_t getpid(void) {
+    return vdso()->pid;
+  201dcb:	8b 3c 25 00 10 24 00 	mov    0x241000,%edi
+    asm volatile ("syscall" : "=a" (result)
+  201dd2:	b8 41 00 00 00       	mov    $0x41,%eax
+  201dd7:	0f 05                	syscall
+    return sys_kill(getpid(), sig);
+}
+  201dd9:	c3                   	ret
+
+0000000000201dda <abort>:
+    return vdso()->pid;
+  201dda:	8b 3c 25 00 10 24 00 	mov    0x241000,%edi
+    asm volatile ("syscall" : "=a" (result)
+  201de1:	b8 41 00 00 00       	mov    $0x41,%eax
+  201de6:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  201deb:	0f 05                	syscall
+
+void __attribute((noreturn)) abort(void) {
+    raise(SIGABRT);
+ spinloop: goto spinloop;       // should never get here
+  201ded:	eb fe                	jmp    201ded <abort+0x13>
+
+0000000000201def <assert_fail>:
+}
+
+
+void assert_fail(const char* file, int line, const char* msg) {
+  201def:	55                   	push   %rbp
+  201df0:	48 89 e5             	mov    %rsp,%rbp
+  201df3:	48 89 f9             	mov    %rdi,%rcx
+  201df6:	41 89 f0             	mov    %esi,%r8d
+  201df9:	49 89 d1             	mov    %rdx,%r9
+    (void) console_printf(CPOS(23, 0), 0xC000,
+  201dfc:	48 8d 15 05 07 00 00 	lea    0x705(%rip),%rdx        # 202508 <lower_digits.0+0xf8>
+  201e03:	be 00 c0 00 00       	mov    $0xc000,%esi
+  201e08:	bf 30 07 00 00       	mov    $0x730,%edi
+  201e0d:	b8 00 00 00 00       	mov    $0x0,%eax
+  201e12:	e8 71 f6 ff ff       	call   201488 <console_printf>
+                          "PANIC: %s:%d: assertion '%s' failed\n",
+                          file, line, msg);
+    abort();
+  201e17:	e8 be ff ff ff       	call   201dda <abort>
+
+0000000000201e1c <scan_char>:
+    asm volatile ("syscall" : "=a" (result)
+  201e1c:	bf 3a 00 00 00       	mov    $0x3a,%edi
+    asm volatile ("syscall" : "=a" (rax)
+  201e21:	be 3c 00 00 00       	mov    $0x3c,%esi
+    asm volatile ("syscall" : "=a" (result)
+  201e26:	89 f8                	mov    %edi,%eax
+  201e28:	0f 05                	syscall
+  201e2a:	89 c2                	mov    %eax,%edx
+    asm volatile ("syscall" : "=a" (rax)
+  201e2c:	89 f0                	mov    %esi,%eax
+  201e2e:	0f 05                	syscall
+    int c;
+
+    do {
+        c = sys_keybord();
+        sys_yield();
+    } while (c == -1);
+  201e30:	83 fa ff             	cmp    $0xffffffff,%edx
+  201e33:	74 f1                	je     201e26 <scan_char+0xa>
+
+    return c;
+  201e35:	89 d0                	mov    %edx,%eax
+}
+  201e37:	c3                   	ret
+
+0000000000201e38 <scan_line>:
+
+unsigned int scan_line(char* dst, unsigned int length_max) {
+  201e38:	55                   	push   %rbp
+  201e39:	48 89 e5             	mov    %rsp,%rbp
+  201e3c:	41 57                	push   %r15
+  201e3e:	41 56                	push   %r14
+  201e40:	41 55                	push   %r13
+  201e42:	41 54                	push   %r12
+  201e44:	53                   	push   %rbx
+  201e45:	48 83 ec 08          	sub    $0x8,%rsp
+  201e49:	49 89 fe             	mov    %rdi,%r14
+  201e4c:	41 89 f5             	mov    %esi,%r13d
+    unsigned int length = 0;
+  201e4f:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            app_printf(0, "%c", c);
+            dst[length] = '\0';
+            return length;
+        } else if (c >= 32 && c <= 127) {
+            if (length < length_max) {
+                app_printf(0, "%c", c);
+  201e55:	4c 8d 3d cd 05 00 00 	lea    0x5cd(%rip),%r15        # 202429 <lower_digits.0+0x19>
+  201e5c:	eb 05                	jmp    201e63 <scan_line+0x2b>
+            if (length != 0) {
+  201e5e:	45 85 e4             	test   %r12d,%r12d
+  201e61:	75 3e                	jne    201ea1 <scan_line+0x69>
+        unsigned char c = scan_char();
+  201e63:	e8 b4 ff ff ff       	call   201e1c <scan_char>
+  201e68:	89 c3                	mov    %eax,%ebx
+        if (c == '\b') {
+  201e6a:	3c 08                	cmp    $0x8,%al
+  201e6c:	74 f0                	je     201e5e <scan_line+0x26>
+        } else if (c == '\n') {
+  201e6e:	3c 0a                	cmp    $0xa,%al
+  201e70:	74 4c                	je     201ebe <scan_line+0x86>
+        } else if (c >= 32 && c <= 127) {
+  201e72:	8d 43 e0             	lea    -0x20(%rbx),%eax
+            if (length < length_max) {
+  201e75:	3c 5f                	cmp    $0x5f,%al
+  201e77:	77 ea                	ja     201e63 <scan_line+0x2b>
+  201e79:	45 39 ec             	cmp    %r13d,%r12d
+  201e7c:	73 e5                	jae    201e63 <scan_line+0x2b>
+                app_printf(0, "%c", c);
+  201e7e:	0f b6 d3             	movzbl %bl,%edx
+  201e81:	4c 89 fe             	mov    %r15,%rsi
+  201e84:	bf 00 00 00 00       	mov    $0x0,%edi
+  201e89:	b8 00 00 00 00       	mov    $0x0,%eax
+  201e8e:	e8 d7 fd ff ff       	call   201c6a <app_printf>
+                dst[length++] = c;
+  201e93:	44 89 e0             	mov    %r12d,%eax
+  201e96:	41 88 1c 06          	mov    %bl,(%r14,%rax,1)
+  201e9a:	45 8d 64 24 01       	lea    0x1(%r12),%r12d
+  201e9f:	eb c2                	jmp    201e63 <scan_line+0x2b>
+                app_printf(0, "%c", c);
+  201ea1:	ba 08 00 00 00       	mov    $0x8,%edx
+  201ea6:	4c 89 fe             	mov    %r15,%rsi
+  201ea9:	bf 00 00 00 00       	mov    $0x0,%edi
+  201eae:	b8 00 00 00 00       	mov    $0x0,%eax
+  201eb3:	e8 b2 fd ff ff       	call   201c6a <app_printf>
+                length--;
+  201eb8:	41 83 ec 01          	sub    $0x1,%r12d
+  201ebc:	eb a5                	jmp    201e63 <scan_line+0x2b>
+            app_printf(0, "%c", c);
+  201ebe:	ba 0a 00 00 00       	mov    $0xa,%edx
+  201ec3:	48 8d 35 5f 05 00 00 	lea    0x55f(%rip),%rsi        # 202429 <lower_digits.0+0x19>
+  201eca:	bf 00 00 00 00       	mov    $0x0,%edi
+  201ecf:	b8 00 00 00 00       	mov    $0x0,%eax
+  201ed4:	e8 91 fd ff ff       	call   201c6a <app_printf>
+            dst[length] = '\0';
+  201ed9:	44 89 e0             	mov    %r12d,%eax
+  201edc:	41 c6 04 06 00       	movb   $0x0,(%r14,%rax,1)
+            }
+        }
+    }
+}
+  201ee1:	44 89 e0             	mov    %r12d,%eax
+  201ee4:	48 83 c4 08          	add    $0x8,%rsp
+  201ee8:	5b                   	pop    %rbx
+  201ee9:	41 5c                	pop    %r12
+  201eeb:	41 5d                	pop    %r13
+  201eed:	41 5e                	pop    %r14
+  201eef:	41 5f                	pop    %r15
+  201ef1:	5d                   	pop    %rbp
+  201ef2:	c3                   	ret
+
+0000000000201ef3 <split_string>:
+
+
+char** split_string(char* str, char sep) {
+  201ef3:	55                   	push   %rbp
+  201ef4:	48 89 e5             	mov    %rsp,%rbp
+  201ef7:	41 57                	push   %r15
+  201ef9:	41 56                	push   %r14
+  201efb:	41 55                	push   %r13
+  201efd:	41 54                	push   %r12
+  201eff:	53                   	push   %rbx
+  201f00:	48 83 ec 08          	sub    $0x8,%rsp
+    int s = 1;
+    int n = 0;
+
+    while (str[n]) {
+  201f04:	0f b6 07             	movzbl (%rdi),%eax
+  201f07:	84 c0                	test   %al,%al
+  201f09:	0f 84 ad 00 00 00    	je     201fbc <split_string+0xc9>
+  201f0f:	48 89 fb             	mov    %rdi,%rbx
+  201f12:	41 89 f4             	mov    %esi,%r12d
+  201f15:	41 be 01 00 00 00    	mov    $0x1,%r14d
+    int s = 1;
+  201f1b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  201f20:	eb 03                	jmp    201f25 <split_string+0x32>
+  201f22:	49 89 d6             	mov    %rdx,%r14
+        if (str[n] == sep)
+            s++;
+  201f25:	41 38 c4             	cmp    %al,%r12b
+  201f28:	0f 94 c0             	sete   %al
+  201f2b:	0f b6 c0             	movzbl %al,%eax
+  201f2e:	01 c1                	add    %eax,%ecx
+    while (str[n]) {
+  201f30:	49 8d 56 01          	lea    0x1(%r14),%rdx
+  201f34:	0f b6 44 13 ff       	movzbl -0x1(%rbx,%rdx,1),%eax
+  201f39:	84 c0                	test   %al,%al
+  201f3b:	75 e5                	jne    201f22 <split_string+0x2f>
+        n++;
+    }
+    
+    char** part = malloc((s+1)*sizeof(char*));
+  201f3d:	44 8d 79 01          	lea    0x1(%rcx),%r15d
+  201f41:	4d 63 ff             	movslq %r15d,%r15
+  201f44:	49 c1 e7 03          	shl    $0x3,%r15
+  201f48:	4c 89 ff             	mov    %r15,%rdi
+  201f4b:	e8 69 02 00 00       	call   2021b9 <malloc>
+  201f50:	49 89 c5             	mov    %rax,%r13
+    char* buffer = malloc(n+1);
+  201f53:	41 8d 7e 01          	lea    0x1(%r14),%edi
+  201f57:	48 63 ff             	movslq %edi,%rdi
+  201f5a:	e8 5a 02 00 00       	call   2021b9 <malloc>
+
+    int word_n = 0;
+    part[0] = buffer;
+  201f5f:	49 89 45 00          	mov    %rax,0x0(%r13)
+    part[s] = NULL;
+  201f63:	4b c7 44 3d f8 00 00 	movq   $0x0,-0x8(%r13,%r15,1)
+  201f6a:	00 00 
+    buffer[n] = 0;
+  201f6c:	42 c6 04 30 00       	movb   $0x0,(%rax,%r14,1)
+
+    for (int i = 0; i < n; i++) {
+  201f71:	45 85 f6             	test   %r14d,%r14d
+  201f74:	7e 6c                	jle    201fe2 <split_string+0xef>
+  201f76:	41 83 ee 01          	sub    $0x1,%r14d
+  201f7a:	48 89 da             	mov    %rbx,%rdx
+  201f7d:	48 83 c0 01          	add    $0x1,%rax
+  201f81:	48 89 c1             	mov    %rax,%rcx
+    int word_n = 0;
+  201f84:	bf 00 00 00 00       	mov    $0x0,%edi
+  201f89:	eb 23                	jmp    201fae <split_string+0xbb>
+        if (str[i] == sep) {
+            buffer[i] = 0;
+  201f8b:	c6 41 ff 00          	movb   $0x0,-0x1(%rcx)
+            part[++word_n] = &buffer[i+1];
+  201f8f:	83 c7 01             	add    $0x1,%edi
+  201f92:	48 63 f7             	movslq %edi,%rsi
+  201f95:	49 89 4c f5 00       	mov    %rcx,0x0(%r13,%rsi,8)
+    for (int i = 0; i < n; i++) {
+  201f9a:	48 83 c2 01          	add    $0x1,%rdx
+  201f9e:	48 83 c1 01          	add    $0x1,%rcx
+  201fa2:	89 ce                	mov    %ecx,%esi
+  201fa4:	29 c6                	sub    %eax,%esi
+  201fa6:	83 ee 01             	sub    $0x1,%esi
+  201fa9:	44 39 f6             	cmp    %r14d,%esi
+  201fac:	7d 34                	jge    201fe2 <split_string+0xef>
+        if (str[i] == sep) {
+  201fae:	0f b6 32             	movzbl (%rdx),%esi
+  201fb1:	44 38 e6             	cmp    %r12b,%sil
+  201fb4:	74 d5                	je     201f8b <split_string+0x98>
+        } else {
+            buffer[i] = str[i];
+  201fb6:	40 88 71 ff          	mov    %sil,-0x1(%rcx)
+  201fba:	eb de                	jmp    201f9a <split_string+0xa7>
+    char** part = malloc((s+1)*sizeof(char*));
+  201fbc:	bf 10 00 00 00       	mov    $0x10,%edi
+  201fc1:	e8 f3 01 00 00       	call   2021b9 <malloc>
+  201fc6:	49 89 c5             	mov    %rax,%r13
+    char* buffer = malloc(n+1);
+  201fc9:	bf 01 00 00 00       	mov    $0x1,%edi
+  201fce:	e8 e6 01 00 00       	call   2021b9 <malloc>
+    part[0] = buffer;
+  201fd3:	49 89 45 00          	mov    %rax,0x0(%r13)
+    part[s] = NULL;
+  201fd7:	49 c7 45 08 00 00 00 	movq   $0x0,0x8(%r13)
+  201fde:	00 
+    buffer[n] = 0;
+  201fdf:	c6 00 00             	movb   $0x0,(%rax)
+        }
+    }
+
+    return part;
+}
+  201fe2:	4c 89 e8             	mov    %r13,%rax
+  201fe5:	48 83 c4 08          	add    $0x8,%rsp
+  201fe9:	5b                   	pop    %rbx
+  201fea:	41 5c                	pop    %r12
+  201fec:	41 5d                	pop    %r13
+  201fee:	41 5e                	pop    %r14
+  201ff0:	41 5f                	pop    %r15
+  201ff2:	5d                   	pop    %rbp
+  201ff3:	c3                   	ret
+
+0000000000201ff4 <app_print_error>:
+
+
+void app_print_error(int r) {
+  201ff4:	55                   	push   %rbp
+  201ff5:	48 89 e5             	mov    %rsp,%rbp
+    switch (r) {
+  201ff8:	83 ff 24             	cmp    $0x24,%edi
+  201ffb:	0f 87 79 01 00 00    	ja     20217a <app_print_error+0x186>
+  202001:	89 f8                	mov    %edi,%eax
+  202003:	48 8d 15 4a 05 00 00 	lea    0x54a(%rip),%rdx        # 202554 <lower_digits.0+0x144>
+  20200a:	48 63 04 82          	movslq (%rdx,%rax,4),%rax
+  20200e:	48 01 d0             	add    %rdx,%rax
+  202011:	ff e0                	jmp    *%rax
+        case ENOENT:
+            app_printf(1, "Error: %s\n", "No such file or directory");
+  202013:	48 8d 15 12 04 00 00 	lea    0x412(%rip),%rdx        # 20242c <lower_digits.0+0x1c>
+  20201a:	48 8d 35 25 04 00 00 	lea    0x425(%rip),%rsi        # 202446 <lower_digits.0+0x36>
+  202021:	bf 01 00 00 00       	mov    $0x1,%edi
+  202026:	b8 00 00 00 00       	mov    $0x0,%eax
+  20202b:	e8 3a fc ff ff       	call   201c6a <app_printf>
+            break;
+        default:
+            app_printf(1, "Error %d: %s\n", r, "Unknown error");
+            break;
+    }
+}
+  202030:	5d                   	pop    %rbp
+  202031:	c3                   	ret
+            app_printf(1, "Error: %s\n", "I/O error");
+  202032:	48 8d 15 18 04 00 00 	lea    0x418(%rip),%rdx        # 202451 <lower_digits.0+0x41>
+  202039:	48 8d 35 06 04 00 00 	lea    0x406(%rip),%rsi        # 202446 <lower_digits.0+0x36>
+  202040:	bf 01 00 00 00       	mov    $0x1,%edi
+  202045:	b8 00 00 00 00       	mov    $0x0,%eax
+  20204a:	e8 1b fc ff ff       	call   201c6a <app_printf>
+            break;
+  20204f:	eb df                	jmp    202030 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Exec format error");
+  202051:	48 8d 15 03 04 00 00 	lea    0x403(%rip),%rdx        # 20245b <lower_digits.0+0x4b>
+  202058:	48 8d 35 e7 03 00 00 	lea    0x3e7(%rip),%rsi        # 202446 <lower_digits.0+0x36>
+  20205f:	bf 01 00 00 00       	mov    $0x1,%edi
+  202064:	b8 00 00 00 00       	mov    $0x0,%eax
+  202069:	e8 fc fb ff ff       	call   201c6a <app_printf>
+            break;
+  20206e:	eb c0                	jmp    202030 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Resource temporarily unavailable");
+  202070:	48 8d 15 b9 04 00 00 	lea    0x4b9(%rip),%rdx        # 202530 <lower_digits.0+0x120>
+  202077:	48 8d 35 c8 03 00 00 	lea    0x3c8(%rip),%rsi        # 202446 <lower_digits.0+0x36>
+  20207e:	bf 01 00 00 00       	mov    $0x1,%edi
+  202083:	b8 00 00 00 00       	mov    $0x0,%eax
+  202088:	e8 dd fb ff ff       	call   201c6a <app_printf>
+            break;
+  20208d:	eb a1                	jmp    202030 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Out of memory");
+  20208f:	48 8d 15 d7 03 00 00 	lea    0x3d7(%rip),%rdx        # 20246d <lower_digits.0+0x5d>
+  202096:	48 8d 35 a9 03 00 00 	lea    0x3a9(%rip),%rsi        # 202446 <lower_digits.0+0x36>
+  20209d:	bf 01 00 00 00       	mov    $0x1,%edi
+  2020a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  2020a7:	e8 be fb ff ff       	call   201c6a <app_printf>
+            break;
+  2020ac:	eb 82                	jmp    202030 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Bad address");
+  2020ae:	48 8d 15 c6 03 00 00 	lea    0x3c6(%rip),%rdx        # 20247b <lower_digits.0+0x6b>
+  2020b5:	48 8d 35 8a 03 00 00 	lea    0x38a(%rip),%rsi        # 202446 <lower_digits.0+0x36>
+  2020bc:	bf 01 00 00 00       	mov    $0x1,%edi
+  2020c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  2020c6:	e8 9f fb ff ff       	call   201c6a <app_printf>
+            break;
+  2020cb:	e9 60 ff ff ff       	jmp    202030 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Not a directory");
+  2020d0:	48 8d 15 b0 03 00 00 	lea    0x3b0(%rip),%rdx        # 202487 <lower_digits.0+0x77>
+  2020d7:	48 8d 35 68 03 00 00 	lea    0x368(%rip),%rsi        # 202446 <lower_digits.0+0x36>
+  2020de:	bf 01 00 00 00       	mov    $0x1,%edi
+  2020e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  2020e8:	e8 7d fb ff ff       	call   201c6a <app_printf>
+            break;
+  2020ed:	e9 3e ff ff ff       	jmp    202030 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Invalid argument");
+  2020f2:	48 8d 15 9e 03 00 00 	lea    0x39e(%rip),%rdx        # 202497 <lower_digits.0+0x87>
+  2020f9:	48 8d 35 46 03 00 00 	lea    0x346(%rip),%rsi        # 202446 <lower_digits.0+0x36>
+  202100:	bf 01 00 00 00       	mov    $0x1,%edi
+  202105:	b8 00 00 00 00       	mov    $0x0,%eax
+  20210a:	e8 5b fb ff ff       	call   201c6a <app_printf>
+            break;
+  20210f:	e9 1c ff ff ff       	jmp    202030 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "No space left on device");
+  202114:	48 8d 15 8d 03 00 00 	lea    0x38d(%rip),%rdx        # 2024a8 <lower_digits.0+0x98>
+  20211b:	48 8d 35 24 03 00 00 	lea    0x324(%rip),%rsi        # 202446 <lower_digits.0+0x36>
+  202122:	bf 01 00 00 00       	mov    $0x1,%edi
+  202127:	b8 00 00 00 00       	mov    $0x0,%eax
+  20212c:	e8 39 fb ff ff       	call   201c6a <app_printf>
+            break;
+  202131:	e9 fa fe ff ff       	jmp    202030 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "File already exists");
+  202136:	48 8d 15 83 03 00 00 	lea    0x383(%rip),%rdx        # 2024c0 <lower_digits.0+0xb0>
+  20213d:	48 8d 35 02 03 00 00 	lea    0x302(%rip),%rsi        # 202446 <lower_digits.0+0x36>
+  202144:	bf 01 00 00 00       	mov    $0x1,%edi
+  202149:	b8 00 00 00 00       	mov    $0x0,%eax
+  20214e:	e8 17 fb ff ff       	call   201c6a <app_printf>
+            break;
+  202153:	e9 d8 fe ff ff       	jmp    202030 <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "File name too long");
+  202158:	48 8d 15 75 03 00 00 	lea    0x375(%rip),%rdx        # 2024d4 <lower_digits.0+0xc4>
+  20215f:	48 8d 35 e0 02 00 00 	lea    0x2e0(%rip),%rsi        # 202446 <lower_digits.0+0x36>
+  202166:	bf 01 00 00 00       	mov    $0x1,%edi
+  20216b:	b8 00 00 00 00       	mov    $0x0,%eax
+  202170:	e8 f5 fa ff ff       	call   201c6a <app_printf>
+            break;
+  202175:	e9 b6 fe ff ff       	jmp    202030 <app_print_error+0x3c>
+            app_printf(1, "Error %d: %s\n", r, "Unknown error");
+  20217a:	48 8d 0d 66 03 00 00 	lea    0x366(%rip),%rcx        # 2024e7 <lower_digits.0+0xd7>
+  202181:	89 fa                	mov    %edi,%edx
+  202183:	48 8d 35 6b 03 00 00 	lea    0x36b(%rip),%rsi        # 2024f5 <lower_digits.0+0xe5>
+  20218a:	bf 01 00 00 00       	mov    $0x1,%edi
+  20218f:	b8 00 00 00 00       	mov    $0x0,%eax
+  202194:	e8 d1 fa ff ff       	call   201c6a <app_printf>
+}
+  202199:	e9 92 fe ff ff       	jmp    202030 <app_print_error+0x3c>
+
+000000000020219e <handle_error>:
+
+__attribute__((noreturn)) void handle_error(int r) {
+  20219e:	55                   	push   %rbp
+  20219f:	48 89 e5             	mov    %rsp,%rbp
+  2021a2:	53                   	push   %rbx
+  2021a3:	48 83 ec 08          	sub    $0x8,%rsp
+  2021a7:	89 fb                	mov    %edi,%ebx
+    app_print_error(r);
+  2021a9:	e8 46 fe ff ff       	call   201ff4 <app_print_error>
+    asm volatile ("syscall" : "=a" (rax)
+  2021ae:	b8 40 00 00 00       	mov    $0x40,%eax
+  2021b3:	89 df                	mov    %ebx,%edi
+  2021b5:	0f 05                	syscall
+ spinloop: goto spinloop;       // should never get here
+  2021b7:	eb fe                	jmp    2021b7 <handle_error+0x19>
+
+00000000002021b9 <malloc>:
+
+// The heap starts 1MB above the program image (PROC_START_ADDR)
+static uint8_t* heap_top = (uint8_t*) 0x300000;
+static uint8_t* page_top = (uint8_t*) 0x300000;
+
+void* malloc(size_t size) {
+  2021b9:	48 89 fe             	mov    %rdi,%rsi
+    while (ROUNDDOWN(heap_top + size, PAGESIZE) >= page_top) {
+  2021bc:	48 8b 05 45 0e 00 00 	mov    0xe45(%rip),%rax        # 203008 <heap_top>
+  2021c3:	48 8d 14 38          	lea    (%rax,%rdi,1),%rdx
+  2021c7:	48 8b 3d 32 0e 00 00 	mov    0xe32(%rip),%rdi        # 203000 <page_top>
+  2021ce:	48 89 d1             	mov    %rdx,%rcx
+  2021d1:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  2021d8:	48 39 f9             	cmp    %rdi,%rcx
+  2021db:	72 3e                	jb     20221b <malloc+0x62>
+    asm volatile ("syscall" : "=a" (result)
+  2021dd:	41 b8 3b 00 00 00    	mov    $0x3b,%r8d
+  2021e3:	44 89 c0             	mov    %r8d,%eax
+  2021e6:	0f 05                	syscall
+        int r = sys_page_alloc(page_top);
+        assert(r >= 0);
+  2021e8:	85 c0                	test   %eax,%eax
+  2021ea:	78 37                	js     202223 <malloc+0x6a>
+        page_top += PAGESIZE;
+  2021ec:	48 8b 05 0d 0e 00 00 	mov    0xe0d(%rip),%rax        # 203000 <page_top>
+  2021f3:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  2021fa:	48 89 3d ff 0d 00 00 	mov    %rdi,0xdff(%rip)        # 203000 <page_top>
+    while (ROUNDDOWN(heap_top + size, PAGESIZE) >= page_top) {
+  202201:	48 8b 05 00 0e 00 00 	mov    0xe00(%rip),%rax        # 203008 <heap_top>
+  202208:	48 8d 14 30          	lea    (%rax,%rsi,1),%rdx
+  20220c:	48 89 d1             	mov    %rdx,%rcx
+  20220f:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  202216:	48 39 f9             	cmp    %rdi,%rcx
+  202219:	73 c8                	jae    2021e3 <malloc+0x2a>
+    }
+
+    void* addr = heap_top;
+    heap_top += size;
+  20221b:	48 89 15 e6 0d 00 00 	mov    %rdx,0xde6(%rip)        # 203008 <heap_top>
+    return addr;
+}
+  202222:	c3                   	ret
+void* malloc(size_t size) {
+  202223:	55                   	push   %rbp
+  202224:	48 89 e5             	mov    %rsp,%rbp
+        assert(r >= 0);
+  202227:	48 8d 15 60 00 00 00 	lea    0x60(%rip),%rdx        # 20228e <malloc+0xd5>
+  20222e:	be 0b 00 00 00       	mov    $0xb,%esi
+  202233:	48 8d 3d b3 03 00 00 	lea    0x3b3(%rip),%rdi        # 2025ed <col.0+0x5>
+  20223a:	e8 b0 fb ff ff       	call   201def <assert_fail>
@@ -0,0 +1,3298 @@
+
+obj/p-touch.full:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000200000 <usage>:
+const char *usage_str =
+    "Usage: touch [FILE]\n"
+    "Touch a file.\n";
+
+
+void __attribute__((noreturn)) usage(void) {
+  200000:	55                   	push   %rbp
+  200001:	48 89 e5             	mov    %rsp,%rbp
+    app_printf(0, "%s", usage_str);
+  200004:	48 8b 15 f5 2f 00 00 	mov    0x2ff5(%rip),%rdx        # 203000 <usage_str>
+  20000b:	48 8d 35 2e 20 00 00 	lea    0x202e(%rip),%rsi        # 202040 <malloc+0x8d>
+  200012:	bf 00 00 00 00       	mov    $0x0,%edi
+  200017:	b8 00 00 00 00       	mov    $0x0,%eax
+  20001c:	e8 43 1a 00 00       	call   201a64 <app_printf>
+// sys_exit()
+//    Exit this process. Does not return.
+static inline void sys_exit(int exit_code) __attribute__((noreturn));
+static inline void sys_exit(int exit_code) {
+    uint64_t rax;
+    asm volatile ("syscall" : "=a" (rax)
+  200021:	b8 40 00 00 00       	mov    $0x40,%eax
+  200026:	bf 01 00 00 00       	mov    $0x1,%edi
+  20002b:	0f 05                	syscall
+                  : "a" (INT_SYS_EXIT), "D" /* %rdi */ (exit_code)
+                  : "rcx", "r11", "cc", "memory");
+ spinloop: goto spinloop;       // should never get here
+  20002d:	eb fe                	jmp    20002d <usage+0x2d>
+
+000000000020002f <process_main>:
+    sys_exit(1);
+}
+
+
+void process_main(int argc, char* argv[]) {
+  20002f:	55                   	push   %rbp
+  200030:	48 89 e5             	mov    %rsp,%rbp
+    if (argc <= 1) usage();
+  200033:	83 ff 01             	cmp    $0x1,%edi
+  200036:	7e 1d                	jle    200055 <process_main+0x26>
+    asm volatile ("syscall" : "=a" (result)
+  200038:	48 8b 7e 08          	mov    0x8(%rsi),%rdi
+  20003c:	b8 47 00 00 00       	mov    $0x47,%eax
+  200041:	0f 05                	syscall
+
+    int r = sys_touch(argv[1]);
+    if (r < 0) handle_error(-r);
+  200043:	85 c0                	test   %eax,%eax
+  200045:	78 13                	js     20005a <process_main+0x2b>
+    asm volatile ("syscall" : "=a" (rax)
+  200047:	b8 40 00 00 00       	mov    $0x40,%eax
+  20004c:	bf 00 00 00 00       	mov    $0x0,%edi
+  200051:	0f 05                	syscall
+ spinloop: goto spinloop;       // should never get here
+  200053:	eb fe                	jmp    200053 <process_main+0x24>
+    if (argc <= 1) usage();
+  200055:	e8 a6 ff ff ff       	call   200000 <usage>
+    if (r < 0) handle_error(-r);
+  20005a:	f7 d8                	neg    %eax
+  20005c:	89 c7                	mov    %eax,%edi
+  20005e:	e8 35 1f 00 00       	call   201f98 <handle_error>
+
+0000000000200063 <vdso>:
+// KERNEL DATA PAGE
+//
+//    The kernel keeps a read-only vdso_data (see lib.h) up to date at
+//    VDSO_ADDR. Reading it is a plain memory load, not a system call.
+
+static inline const volatile vdso_data* vdso(void) {
+  200063:	55                   	push   %rbp
+  200064:	48 89 e5             	mov    %rsp,%rbp
+    return (const volatile vdso_data*) VDSO_ADDR;
+  200067:	b8 00 10 24 00       	mov    $0x241000,%eax
+}
+  20006c:	5d                   	pop    %rbp
+  20006d:	c3                   	ret
+
+000000000020006e <memcpy>:
+#define MEMOP_WORD_MIN 64
+
+// an unaligned word that may alias any object
+typedef uint64_t __attribute__((may_alias, aligned(1))) memop_word;
+
+void* memcpy(void* dst, const void* src, size_t n) {
+  20006e:	55                   	push   %rbp
+  20006f:	48 89 e5             	mov    %rsp,%rbp
+  200072:	48 83 ec 48          	sub    $0x48,%rsp
+  200076:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  20007a:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  20007e:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+    char* d = (char*) dst;
+  200082:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200086:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    const char* s = (const char*) src;
+  20008a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  20008e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (n >= MEMOP_WORD_MIN) {
+  200092:	48 83 7d b8 3f       	cmpq   $0x3f,-0x48(%rbp)
+  200097:	0f 86 c5 00 00 00    	jbe    200162 <memcpy+0xf4>
+        size_t head = -(uintptr_t) d & 7;
+  20009d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2000a1:	48 f7 d8             	neg    %rax
+  2000a4:	83 e0 07             	and    $0x7,%eax
+  2000a7:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        size_t words = (n - head) / 8;
+  2000ab:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  2000af:	48 2b 45 e8          	sub    -0x18(%rbp),%rax
+  2000b3:	48 c1 e8 03          	shr    $0x3,%rax
+  2000b7:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+        n = (n - head) % 8;
+  2000bb:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  2000bf:	48 2b 45 e8          	sub    -0x18(%rbp),%rax
+  2000c3:	83 e0 07             	and    $0x7,%eax
+  2000c6:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        asm volatile("rep movsb" : "+D" (d), "+S" (s), "+c" (head)
+  2000ca:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  2000ce:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  2000d2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2000d6:	48 89 cf             	mov    %rcx,%rdi
+  2000d9:	48 89 d6             	mov    %rdx,%rsi
+  2000dc:	48 89 c1             	mov    %rax,%rcx
+  2000df:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  2000e1:	48 89 c8             	mov    %rcx,%rax
+  2000e4:	48 89 f2             	mov    %rsi,%rdx
+  2000e7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  2000eb:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  2000ef:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                     : : "memory");
+        asm volatile("rep movsq" : "+D" (d), "+S" (s), "+c" (words)
+  2000f3:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  2000f7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  2000fb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  2000ff:	48 89 cf             	mov    %rcx,%rdi
+  200102:	48 89 d6             	mov    %rdx,%rsi
+  200105:	48 89 c1             	mov    %rax,%rcx
+  200108:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  20010b:	48 89 c8             	mov    %rcx,%rax
+  20010e:	48 89 f2             	mov    %rsi,%rdx
+  200111:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  200115:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  200119:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+                     : : "memory");
+    }
+    for (; n >= 16; n -= 16, s += 16, d += 16) {
+  20011d:	eb 43                	jmp    200162 <memcpy+0xf4>
+        memop_word a = ((const memop_word*) s)[0];
+  20011f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  200123:	48 8b 00             	mov    (%rax),%rax
+  200126:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+        memop_word b = ((const memop_word*) s)[1];
+  20012a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  20012e:	48 83 c0 08          	add    $0x8,%rax
+  200132:	48 8b 00             	mov    (%rax),%rax
+  200135:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+        ((memop_word*) d)[0] = a;
+  200139:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20013d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  200141:	48 89 10             	mov    %rdx,(%rax)
+        ((memop_word*) d)[1] = b;
+  200144:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200148:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  20014c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  200150:	48 89 02             	mov    %rax,(%rdx)
+    for (; n >= 16; n -= 16, s += 16, d += 16) {
+  200153:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  200158:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  20015d:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  200162:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  200167:	77 b6                	ja     20011f <memcpy+0xb1>
+    }
+    for (; n > 0; --n, ++s, ++d) {
+  200169:	eb 1c                	jmp    200187 <memcpy+0x119>
+        *d = *s;
+  20016b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  20016f:	0f b6 10             	movzbl (%rax),%edx
+  200172:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200176:	88 10                	mov    %dl,(%rax)
+    for (; n > 0; --n, ++s, ++d) {
+  200178:	48 83 6d b8 01       	subq   $0x1,-0x48(%rbp)
+  20017d:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  200182:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  200187:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  20018c:	75 dd                	jne    20016b <memcpy+0xfd>
+    }
+    return dst;
+  20018e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  200192:	c9                   	leave
+  200193:	c3                   	ret
+
+0000000000200194 <memmove>:
+
+void* memmove(void* dst, const void* src, size_t n) {
+  200194:	55                   	push   %rbp
+  200195:	48 89 e5             	mov    %rsp,%rbp
+  200198:	48 83 ec 38          	sub    $0x38,%rsp
+  20019c:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  2001a0:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  2001a4:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    const char* s = (const char*) src;
+  2001a8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  2001ac:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    char* d = (char*) dst;
+  2001b0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  2001b4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (!(s < d && s + n > d)) {
+  2001b8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2001bc:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  2001c0:	73 11                	jae    2001d3 <memmove+0x3f>
+  2001c2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  2001c6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  2001ca:	48 01 d0             	add    %rdx,%rax
+  2001cd:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  2001d1:	72 1c                	jb     2001ef <memmove+0x5b>
+        // a forward copy never overwrites source bytes it has yet to read
+        return memcpy(dst, src, n);
+  2001d3:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  2001d7:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  2001db:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  2001df:	48 89 ce             	mov    %rcx,%rsi
+  2001e2:	48 89 c7             	mov    %rax,%rdi
+  2001e5:	e8 84 fe ff ff       	call   20006e <memcpy>
+  2001ea:	e9 94 00 00 00       	jmp    200283 <memmove+0xef>
+    }
+
+    // copy backwards: the tail bytes, then words down to the start
+    size_t words = n / 8;
+  2001ef:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  2001f3:	48 c1 e8 03          	shr    $0x3,%rax
+  2001f7:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    size_t tail = n % 8;
+  2001fb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  2001ff:	83 e0 07             	and    $0x7,%eax
+  200202:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    s += n - 1, d += n - 1;
+  200206:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  20020a:	48 83 e8 01          	sub    $0x1,%rax
+  20020e:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  200212:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200216:	48 83 e8 01          	sub    $0x1,%rax
+  20021a:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    asm volatile("std; rep movsb; cld" : "+D" (d), "+S" (s), "+c" (tail)
+  20021e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  200222:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  200226:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  20022a:	48 89 cf             	mov    %rcx,%rdi
+  20022d:	48 89 d6             	mov    %rdx,%rsi
+  200230:	48 89 c1             	mov    %rax,%rcx
+  200233:	fd                   	std
+  200234:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  200236:	fc                   	cld
+  200237:	48 89 c8             	mov    %rcx,%rax
+  20023a:	48 89 f2             	mov    %rsi,%rdx
+  20023d:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  200241:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  200245:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+                 : : "memory", "cc");
+    s -= 7, d -= 7;
+  200249:	48 83 6d f8 07       	subq   $0x7,-0x8(%rbp)
+  20024e:	48 83 6d f0 07       	subq   $0x7,-0x10(%rbp)
+    asm volatile("std; rep movsq; cld" : "+D" (d), "+S" (s), "+c" (words)
+  200253:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  200257:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  20025b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20025f:	48 89 cf             	mov    %rcx,%rdi
+  200262:	48 89 d6             	mov    %rdx,%rsi
+  200265:	48 89 c1             	mov    %rax,%rcx
+  200268:	fd                   	std
+  200269:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  20026c:	fc                   	cld
+  20026d:	48 89 c8             	mov    %rcx,%rax
+  200270:	48 89 f2             	mov    %rsi,%rdx
+  200273:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  200277:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  20027b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 : : "memory", "cc");
+    return dst;
+  20027f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  200283:	c9                   	leave
+  200284:	c3                   	ret
+
+0000000000200285 <memset>:
+
+void* memset(void* v, int c, size_t n) {
+  200285:	55                   	push   %rbp
+  200286:	48 89 e5             	mov    %rsp,%rbp
+  200289:	48 83 ec 38          	sub    $0x38,%rsp
+  20028d:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  200291:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  200294:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    char* p = (char*) v;
+  200298:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  20029c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    uint64_t word = (uint8_t) c * 0x0101010101010101UL;
+  2002a0:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  2002a3:	0f b6 c0             	movzbl %al,%eax
+  2002a6:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  2002ad:	01 01 01 
+  2002b0:	48 0f af c2          	imul   %rdx,%rax
+  2002b4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (n >= MEMOP_WORD_MIN) {
+  2002b8:	48 83 7d c8 3f       	cmpq   $0x3f,-0x38(%rbp)
+  2002bd:	0f 86 9e 00 00 00    	jbe    200361 <memset+0xdc>
+        size_t head = -(uintptr_t) p & 7;
+  2002c3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2002c7:	48 f7 d8             	neg    %rax
+  2002ca:	83 e0 07             	and    $0x7,%eax
+  2002cd:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        size_t words = (n - head) / 8;
+  2002d1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  2002d5:	48 2b 45 e8          	sub    -0x18(%rbp),%rax
+  2002d9:	48 c1 e8 03          	shr    $0x3,%rax
+  2002dd:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+        n = (n - head) % 8;
+  2002e1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  2002e5:	48 2b 45 e8          	sub    -0x18(%rbp),%rax
+  2002e9:	83 e0 07             	and    $0x7,%eax
+  2002ec:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        asm volatile("rep stosb" : "+D" (p), "+c" (head) : "a" (word)
+  2002f0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2002f4:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  2002f8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  2002fc:	48 89 ce             	mov    %rcx,%rsi
+  2002ff:	48 89 f7             	mov    %rsi,%rdi
+  200302:	48 89 d1             	mov    %rdx,%rcx
+  200305:	f3 aa                	rep stos %al,%es:(%rdi)
+  200307:	48 89 ca             	mov    %rcx,%rdx
+  20030a:	48 89 fe             	mov    %rdi,%rsi
+  20030d:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  200311:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+                     : "memory");
+        asm volatile("rep stosq" : "+D" (p), "+c" (words) : "a" (word)
+  200315:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  200319:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  20031d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  200321:	48 89 ce             	mov    %rcx,%rsi
+  200324:	48 89 f7             	mov    %rsi,%rdi
+  200327:	48 89 d1             	mov    %rdx,%rcx
+  20032a:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  20032d:	48 89 ca             	mov    %rcx,%rdx
+  200330:	48 89 fe             	mov    %rdi,%rsi
+  200333:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  200337:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+                     : "memory");
+    }
+    for (; n >= 16; n -= 16, p += 16) {
+  20033b:	eb 24                	jmp    200361 <memset+0xdc>
+        ((memop_word*) p)[0] = word;
+  20033d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200341:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  200345:	48 89 10             	mov    %rdx,(%rax)
+        ((memop_word*) p)[1] = word;
+  200348:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20034c:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  200350:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  200354:	48 89 02             	mov    %rax,(%rdx)
+    for (; n >= 16; n -= 16, p += 16) {
+  200357:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  20035c:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  200361:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  200366:	77 d5                	ja     20033d <memset+0xb8>
+    }
+    for (; n > 0; ++p, --n) {
+  200368:	eb 15                	jmp    20037f <memset+0xfa>
+        *p = c;
+  20036a:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  20036d:	89 c2                	mov    %eax,%edx
+  20036f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200373:	88 10                	mov    %dl,(%rax)
+    for (; n > 0; ++p, --n) {
+  200375:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  20037a:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  20037f:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  200384:	75 e4                	jne    20036a <memset+0xe5>
+    }
+    return v;
+  200386:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  20038a:	c9                   	leave
+  20038b:	c3                   	ret
+
+000000000020038c <strlen>:
+
+size_t strlen(const char* s) {
+  20038c:	55                   	push   %rbp
+  20038d:	48 89 e5             	mov    %rsp,%rbp
+  200390:	48 83 ec 18          	sub    $0x18,%rsp
+  200394:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    size_t n;
+    for (n = 0; *s != '\0'; ++s) {
+  200398:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  20039f:	00 
+  2003a0:	eb 0a                	jmp    2003ac <strlen+0x20>
+        ++n;
+  2003a2:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    for (n = 0; *s != '\0'; ++s) {
+  2003a7:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  2003ac:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2003b0:	0f b6 00             	movzbl (%rax),%eax
+  2003b3:	84 c0                	test   %al,%al
+  2003b5:	75 eb                	jne    2003a2 <strlen+0x16>
+    }
+    return n;
+  2003b7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  2003bb:	c9                   	leave
+  2003bc:	c3                   	ret
+
+00000000002003bd <strnlen>:
+
+size_t strnlen(const char* s, size_t maxlen) {
+  2003bd:	55                   	push   %rbp
+  2003be:	48 89 e5             	mov    %rsp,%rbp
+  2003c1:	48 83 ec 20          	sub    $0x20,%rsp
+  2003c5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  2003c9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    size_t n;
+    for (n = 0; n != maxlen && *s != '\0'; ++s) {
+  2003cd:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  2003d4:	00 
+  2003d5:	eb 0a                	jmp    2003e1 <strnlen+0x24>
+        ++n;
+  2003d7:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    for (n = 0; n != maxlen && *s != '\0'; ++s) {
+  2003dc:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  2003e1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2003e5:	48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+  2003e9:	74 0b                	je     2003f6 <strnlen+0x39>
+  2003eb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2003ef:	0f b6 00             	movzbl (%rax),%eax
+  2003f2:	84 c0                	test   %al,%al
+  2003f4:	75 e1                	jne    2003d7 <strnlen+0x1a>
+    }
+    return n;
+  2003f6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  2003fa:	c9                   	leave
+  2003fb:	c3                   	ret
+
+00000000002003fc <strcpy>:
+
+char* strcpy(char* dst, const char* src) {
+  2003fc:	55                   	push   %rbp
+  2003fd:	48 89 e5             	mov    %rsp,%rbp
+  200400:	48 83 ec 20          	sub    $0x20,%rsp
+  200404:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  200408:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    char* d = dst;
+  20040c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  200410:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    do {
+        *d++ = *src++;
+  200414:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  200418:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  20041c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  200420:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200424:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  200428:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+  20042c:	0f b6 12             	movzbl (%rdx),%edx
+  20042f:	88 10                	mov    %dl,(%rax)
+    } while (d[-1]);
+  200431:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200435:	48 83 e8 01          	sub    $0x1,%rax
+  200439:	0f b6 00             	movzbl (%rax),%eax
+  20043c:	84 c0                	test   %al,%al
+  20043e:	75 d4                	jne    200414 <strcpy+0x18>
+    return dst;
+  200440:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  200444:	c9                   	leave
+  200445:	c3                   	ret
+
+0000000000200446 <strcmp>:
+
+int strcmp(const char* a, const char* b) {
+  200446:	55                   	push   %rbp
+  200447:	48 89 e5             	mov    %rsp,%rbp
+  20044a:	48 83 ec 10          	sub    $0x10,%rsp
+  20044e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  200452:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    while (*a && *b && *a == *b) {
+  200456:	eb 0a                	jmp    200462 <strcmp+0x1c>
+        ++a, ++b;
+  200458:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  20045d:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+    while (*a && *b && *a == *b) {
+  200462:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200466:	0f b6 00             	movzbl (%rax),%eax
+  200469:	84 c0                	test   %al,%al
+  20046b:	74 1d                	je     20048a <strcmp+0x44>
+  20046d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  200471:	0f b6 00             	movzbl (%rax),%eax
+  200474:	84 c0                	test   %al,%al
+  200476:	74 12                	je     20048a <strcmp+0x44>
+  200478:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20047c:	0f b6 10             	movzbl (%rax),%edx
+  20047f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  200483:	0f b6 00             	movzbl (%rax),%eax
+  200486:	38 c2                	cmp    %al,%dl
+  200488:	74 ce                	je     200458 <strcmp+0x12>
+    }
+    return ((unsigned char) *a > (unsigned char) *b)
+  20048a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20048e:	0f b6 00             	movzbl (%rax),%eax
+  200491:	89 c2                	mov    %eax,%edx
+  200493:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  200497:	0f b6 00             	movzbl (%rax),%eax
+  20049a:	38 d0                	cmp    %dl,%al
+  20049c:	0f 92 c0             	setb   %al
+  20049f:	0f b6 d0             	movzbl %al,%edx
+        - ((unsigned char) *a < (unsigned char) *b);
+  2004a2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2004a6:	0f b6 00             	movzbl (%rax),%eax
+  2004a9:	89 c1                	mov    %eax,%ecx
+  2004ab:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2004af:	0f b6 00             	movzbl (%rax),%eax
+  2004b2:	38 c1                	cmp    %al,%cl
+  2004b4:	0f 92 c0             	setb   %al
+  2004b7:	0f b6 c0             	movzbl %al,%eax
+  2004ba:	29 c2                	sub    %eax,%edx
+  2004bc:	89 d0                	mov    %edx,%eax
+}
+  2004be:	c9                   	leave
+  2004bf:	c3                   	ret
+
+00000000002004c0 <strchr>:
+
+char* strchr(const char* s, int c) {
+  2004c0:	55                   	push   %rbp
+  2004c1:	48 89 e5             	mov    %rsp,%rbp
+  2004c4:	48 83 ec 10          	sub    $0x10,%rsp
+  2004c8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  2004cc:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    while (*s && *s != (char) c) {
+  2004cf:	eb 05                	jmp    2004d6 <strchr+0x16>
+        ++s;
+  2004d1:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    while (*s && *s != (char) c) {
+  2004d6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2004da:	0f b6 00             	movzbl (%rax),%eax
+  2004dd:	84 c0                	test   %al,%al
+  2004df:	74 0e                	je     2004ef <strchr+0x2f>
+  2004e1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2004e5:	0f b6 00             	movzbl (%rax),%eax
+  2004e8:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  2004eb:	38 d0                	cmp    %dl,%al
+  2004ed:	75 e2                	jne    2004d1 <strchr+0x11>
+    }
+    if (*s == (char) c) {
+  2004ef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2004f3:	0f b6 00             	movzbl (%rax),%eax
+  2004f6:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  2004f9:	38 d0                	cmp    %dl,%al
+  2004fb:	75 06                	jne    200503 <strchr+0x43>
+        return (char*) s;
+  2004fd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  200501:	eb 05                	jmp    200508 <strchr+0x48>
+    } else {
+        return NULL;
+  200503:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+}
+  200508:	c9                   	leave
+  200509:	c3                   	ret
+
+000000000020050a <rand>:
+
+// New randomness implementation
+static int      rand_seed_set;
+static unsigned rand_seed;
+
+int rand(void) {
+  20050a:	55                   	push   %rbp
+  20050b:	48 89 e5             	mov    %rsp,%rbp
+  20050e:	48 83 ec 10          	sub    $0x10,%rsp
+    if (!rand_seed_set) {
+  200512:	8b 05 00 2b 00 00    	mov    0x2b00(%rip),%eax        # 203018 <rand_seed_set>
+  200518:	85 c0                	test   %eax,%eax
+  20051a:	75 2c                	jne    200548 <rand+0x3e>
+#if WEENSYOS_KERNEL
+        extern unsigned get_entropy_value(void);
+        srand(get_entropy_value());
+#else           // user‑space build
+       /* kernel-refreshed seed from the kernel data page: no system call */
+       srand((unsigned) (vdso()->seed[0] ^ read_cycle_counter()));
+  20051c:	e8 42 fb ff ff       	call   200063 <vdso>
+  200521:	48 8b 40 18          	mov    0x18(%rax),%rax
+  200525:	89 c1                	mov    %eax,%ecx
+    }
+}
+
+static inline uint64_t read_cycle_counter(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+  200527:	0f 31                	rdtsc
+  200529:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  20052c:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    return ((uint64_t) hi << 32) | lo;
+  20052f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  200532:	48 c1 e0 20          	shl    $0x20,%rax
+  200536:	48 89 c2             	mov    %rax,%rdx
+  200539:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  20053c:	48 09 d0             	or     %rdx,%rax
+  20053f:	31 c8                	xor    %ecx,%eax
+  200541:	89 c7                	mov    %eax,%edi
+  200543:	e8 24 00 00 00       	call   20056c <srand>
+#endif
+    }
+    rand_seed = rand_seed * 1664525U + 1013904223U;   // LCG
+  200548:	8b 05 ce 2a 00 00    	mov    0x2ace(%rip),%eax        # 20301c <rand_seed>
+  20054e:	69 c0 0d 66 19 00    	imul   $0x19660d,%eax,%eax
+  200554:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+  200559:	89 05 bd 2a 00 00    	mov    %eax,0x2abd(%rip)        # 20301c <rand_seed>
+    return rand_seed & RAND_MAX;
+  20055f:	8b 05 b7 2a 00 00    	mov    0x2ab7(%rip),%eax        # 20301c <rand_seed>
+  200565:	25 ff ff ff 7f       	and    $0x7fffffff,%eax
+}
+  20056a:	c9                   	leave
+  20056b:	c3                   	ret
+
+000000000020056c <srand>:
+
+void srand(unsigned seed) {
+  20056c:	55                   	push   %rbp
+  20056d:	48 89 e5             	mov    %rsp,%rbp
+  200570:	48 83 ec 08          	sub    $0x8,%rsp
+  200574:	89 7d fc             	mov    %edi,-0x4(%rbp)
+    rand_seed      = seed;
+  200577:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  20057a:	89 05 9c 2a 00 00    	mov    %eax,0x2a9c(%rip)        # 20301c <rand_seed>
+    rand_seed_set  = 1;
+  200580:	c7 05 8e 2a 00 00 01 	movl   $0x1,0x2a8e(%rip)        # 203018 <rand_seed_set>
+  200587:	00 00 00 
+}
+  20058a:	90                   	nop
+  20058b:	c9                   	leave
+  20058c:	c3                   	ret
+
+000000000020058d <fill_numbuf>:
+//    Print a message onto the console, starting at the given cursor position.
+
+// snprintf, vsnprintf
+//    Format a string into a buffer.
+
+static char* fill_numbuf(char* numbuf_end, unsigned long val, int base) {
+  20058d:	55                   	push   %rbp
+  20058e:	48 89 e5             	mov    %rsp,%rbp
+  200591:	48 83 ec 28          	sub    $0x28,%rsp
+  200595:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  200599:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  20059d:	89 55 dc             	mov    %edx,-0x24(%rbp)
+    static const char upper_digits[] = "0123456789ABCDEF";
+    static const char lower_digits[] = "0123456789abcdef";
+
+    const char* digits = upper_digits;
+  2005a0:	48 8d 05 19 1c 00 00 	lea    0x1c19(%rip),%rax        # 2021c0 <upper_digits.1>
+  2005a7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (base < 0) {
+  2005ab:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  2005af:	79 0e                	jns    2005bf <fill_numbuf+0x32>
+        digits = lower_digits;
+  2005b1:	48 8d 05 28 1c 00 00 	lea    0x1c28(%rip),%rax        # 2021e0 <lower_digits.0>
+  2005b8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+        base = -base;
+  2005bc:	f7 5d dc             	negl   -0x24(%rbp)
+    }
+
+    *--numbuf_end = '\0';
+  2005bf:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  2005c4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2005c8:	c6 00 00             	movb   $0x0,(%rax)
+    do {
+        *--numbuf_end = digits[val % base];
+  2005cb:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  2005ce:	48 63 c8             	movslq %eax,%rcx
+  2005d1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  2005d5:	ba 00 00 00 00       	mov    $0x0,%edx
+  2005da:	48 f7 f1             	div    %rcx
+  2005dd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2005e1:	48 01 d0             	add    %rdx,%rax
+  2005e4:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  2005e9:	0f b6 10             	movzbl (%rax),%edx
+  2005ec:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2005f0:	88 10                	mov    %dl,(%rax)
+        val /= base;
+  2005f2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  2005f5:	48 63 f0             	movslq %eax,%rsi
+  2005f8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  2005fc:	ba 00 00 00 00       	mov    $0x0,%edx
+  200601:	48 f7 f6             	div    %rsi
+  200604:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    } while (val != 0);
+  200608:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  20060d:	75 bc                	jne    2005cb <fill_numbuf+0x3e>
+    return numbuf_end;
+  20060f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  200613:	c9                   	leave
+  200614:	c3                   	ret
+
+0000000000200615 <printer_vprintf>:
+#define FLAG_NUMERIC            (1<<5)
+#define FLAG_SIGNED             (1<<6)
+#define FLAG_NEGATIVE           (1<<7)
+#define FLAG_ALT2               (1<<8)
+
+void printer_vprintf(printer* p, int color, const char* format, va_list val) {
+  200615:	55                   	push   %rbp
+  200616:	48 89 e5             	mov    %rsp,%rbp
+  200619:	53                   	push   %rbx
+  20061a:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  200621:	48 89 bd 78 ff ff ff 	mov    %rdi,-0x88(%rbp)
+  200628:	89 b5 74 ff ff ff    	mov    %esi,-0x8c(%rbp)
+  20062e:	48 89 95 68 ff ff ff 	mov    %rdx,-0x98(%rbp)
+  200635:	48 89 8d 60 ff ff ff 	mov    %rcx,-0xa0(%rbp)
+#define NUMBUFSIZ 24
+    char numbuf[NUMBUFSIZ];
+
+    for (; *format; ++format) {
+  20063c:	e9 be 09 00 00       	jmp    200fff <printer_vprintf+0x9ea>
+        if (*format != '%') {
+  200641:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200648:	0f b6 00             	movzbl (%rax),%eax
+  20064b:	3c 25                	cmp    $0x25,%al
+  20064d:	74 31                	je     200680 <printer_vprintf+0x6b>
+            p->putc(p, *format, color);
+  20064f:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200656:	4c 8b 00             	mov    (%rax),%r8
+  200659:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200660:	0f b6 00             	movzbl (%rax),%eax
+  200663:	0f b6 c8             	movzbl %al,%ecx
+  200666:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  20066c:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200673:	89 ce                	mov    %ecx,%esi
+  200675:	48 89 c7             	mov    %rax,%rdi
+  200678:	41 ff d0             	call   *%r8
+            continue;
+  20067b:	e9 77 09 00 00       	jmp    200ff7 <printer_vprintf+0x9e2>
+        }
+
+        // process flags
+        int flags = 0;
+  200680:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+        for (++format; *format; ++format) {
+  200687:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  20068e:	01 
+  20068f:	eb 4f                	jmp    2006e0 <printer_vprintf+0xcb>
+            const char* flagc = strchr(flag_chars, *format);
+  200691:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200698:	0f b6 00             	movzbl (%rax),%eax
+  20069b:	0f be c0             	movsbl %al,%eax
+  20069e:	89 c6                	mov    %eax,%esi
+  2006a0:	48 8d 05 c9 19 00 00 	lea    0x19c9(%rip),%rax        # 202070 <flag_chars>
+  2006a7:	48 89 c7             	mov    %rax,%rdi
+  2006aa:	e8 11 fe ff ff       	call   2004c0 <strchr>
+  2006af:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (flagc) {
+  2006b3:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  2006b8:	74 36                	je     2006f0 <printer_vprintf+0xdb>
+                flags |= 1 << (flagc - flag_chars);
+  2006ba:	48 8d 05 af 19 00 00 	lea    0x19af(%rip),%rax        # 202070 <flag_chars>
+  2006c1:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  2006c5:	48 29 c2             	sub    %rax,%rdx
+  2006c8:	89 d0                	mov    %edx,%eax
+  2006ca:	ba 01 00 00 00       	mov    $0x1,%edx
+  2006cf:	89 c1                	mov    %eax,%ecx
+  2006d1:	d3 e2                	shl    %cl,%edx
+  2006d3:	89 d0                	mov    %edx,%eax
+  2006d5:	09 45 ec             	or     %eax,-0x14(%rbp)
+        for (++format; *format; ++format) {
+  2006d8:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  2006df:	01 
+  2006e0:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  2006e7:	0f b6 00             	movzbl (%rax),%eax
+  2006ea:	84 c0                	test   %al,%al
+  2006ec:	75 a3                	jne    200691 <printer_vprintf+0x7c>
+  2006ee:	eb 01                	jmp    2006f1 <printer_vprintf+0xdc>
+            } else {
+                break;
+  2006f0:	90                   	nop
+            }
+        }
+
+        // process width
+        int width = -1;
+  2006f1:	c7 45 e8 ff ff ff ff 	movl   $0xffffffff,-0x18(%rbp)
+        if (*format >= '1' && *format <= '9') {
+  2006f8:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  2006ff:	0f b6 00             	movzbl (%rax),%eax
+  200702:	3c 30                	cmp    $0x30,%al
+  200704:	7e 67                	jle    20076d <printer_vprintf+0x158>
+  200706:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  20070d:	0f b6 00             	movzbl (%rax),%eax
+  200710:	3c 39                	cmp    $0x39,%al
+  200712:	7f 59                	jg     20076d <printer_vprintf+0x158>
+            for (width = 0; *format >= '0' && *format <= '9'; ) {
+  200714:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%rbp)
+  20071b:	eb 2e                	jmp    20074b <printer_vprintf+0x136>
+                width = 10 * width + *format++ - '0';
+  20071d:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  200720:	89 d0                	mov    %edx,%eax
+  200722:	c1 e0 02             	shl    $0x2,%eax
+  200725:	01 d0                	add    %edx,%eax
+  200727:	01 c0                	add    %eax,%eax
+  200729:	89 c1                	mov    %eax,%ecx
+  20072b:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200732:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  200736:	48 89 95 68 ff ff ff 	mov    %rdx,-0x98(%rbp)
+  20073d:	0f b6 00             	movzbl (%rax),%eax
+  200740:	0f be c0             	movsbl %al,%eax
+  200743:	01 c8                	add    %ecx,%eax
+  200745:	83 e8 30             	sub    $0x30,%eax
+  200748:	89 45 e8             	mov    %eax,-0x18(%rbp)
+            for (width = 0; *format >= '0' && *format <= '9'; ) {
+  20074b:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200752:	0f b6 00             	movzbl (%rax),%eax
+  200755:	3c 2f                	cmp    $0x2f,%al
+  200757:	0f 8e 85 00 00 00    	jle    2007e2 <printer_vprintf+0x1cd>
+  20075d:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200764:	0f b6 00             	movzbl (%rax),%eax
+  200767:	3c 39                	cmp    $0x39,%al
+  200769:	7e b2                	jle    20071d <printer_vprintf+0x108>
+        if (*format >= '1' && *format <= '9') {
+  20076b:	eb 75                	jmp    2007e2 <printer_vprintf+0x1cd>
+            }
+        } else if (*format == '*') {
+  20076d:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200774:	0f b6 00             	movzbl (%rax),%eax
+  200777:	3c 2a                	cmp    $0x2a,%al
+  200779:	75 68                	jne    2007e3 <printer_vprintf+0x1ce>
+            width = va_arg(val, int);
+  20077b:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200782:	8b 00                	mov    (%rax),%eax
+  200784:	83 f8 2f             	cmp    $0x2f,%eax
+  200787:	77 30                	ja     2007b9 <printer_vprintf+0x1a4>
+  200789:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200790:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200794:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  20079b:	8b 00                	mov    (%rax),%eax
+  20079d:	89 c0                	mov    %eax,%eax
+  20079f:	48 01 d0             	add    %rdx,%rax
+  2007a2:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  2007a9:	8b 12                	mov    (%rdx),%edx
+  2007ab:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  2007ae:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  2007b5:	89 0a                	mov    %ecx,(%rdx)
+  2007b7:	eb 1a                	jmp    2007d3 <printer_vprintf+0x1be>
+  2007b9:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2007c0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  2007c4:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  2007c8:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  2007cf:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  2007d3:	8b 00                	mov    (%rax),%eax
+  2007d5:	89 45 e8             	mov    %eax,-0x18(%rbp)
+            ++format;
+  2007d8:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  2007df:	01 
+  2007e0:	eb 01                	jmp    2007e3 <printer_vprintf+0x1ce>
+        if (*format >= '1' && *format <= '9') {
+  2007e2:	90                   	nop
+        }
+
+        // process precision
+        int precision = -1;
+  2007e3:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%rbp)
+        if (*format == '.') {
+  2007ea:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  2007f1:	0f b6 00             	movzbl (%rax),%eax
+  2007f4:	3c 2e                	cmp    $0x2e,%al
+  2007f6:	0f 85 00 01 00 00    	jne    2008fc <printer_vprintf+0x2e7>
+            ++format;
+  2007fc:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  200803:	01 
+            if (*format >= '0' && *format <= '9') {
+  200804:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  20080b:	0f b6 00             	movzbl (%rax),%eax
+  20080e:	3c 2f                	cmp    $0x2f,%al
+  200810:	7e 67                	jle    200879 <printer_vprintf+0x264>
+  200812:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200819:	0f b6 00             	movzbl (%rax),%eax
+  20081c:	3c 39                	cmp    $0x39,%al
+  20081e:	7f 59                	jg     200879 <printer_vprintf+0x264>
+                for (precision = 0; *format >= '0' && *format <= '9'; ) {
+  200820:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%rbp)
+  200827:	eb 2e                	jmp    200857 <printer_vprintf+0x242>
+                    precision = 10 * precision + *format++ - '0';
+  200829:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  20082c:	89 d0                	mov    %edx,%eax
+  20082e:	c1 e0 02             	shl    $0x2,%eax
+  200831:	01 d0                	add    %edx,%eax
+  200833:	01 c0                	add    %eax,%eax
+  200835:	89 c1                	mov    %eax,%ecx
+  200837:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  20083e:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  200842:	48 89 95 68 ff ff ff 	mov    %rdx,-0x98(%rbp)
+  200849:	0f b6 00             	movzbl (%rax),%eax
+  20084c:	0f be c0             	movsbl %al,%eax
+  20084f:	01 c8                	add    %ecx,%eax
+  200851:	83 e8 30             	sub    $0x30,%eax
+  200854:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+                for (precision = 0; *format >= '0' && *format <= '9'; ) {
+  200857:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  20085e:	0f b6 00             	movzbl (%rax),%eax
+  200861:	3c 2f                	cmp    $0x2f,%al
+  200863:	0f 8e 85 00 00 00    	jle    2008ee <printer_vprintf+0x2d9>
+  200869:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200870:	0f b6 00             	movzbl (%rax),%eax
+  200873:	3c 39                	cmp    $0x39,%al
+  200875:	7e b2                	jle    200829 <printer_vprintf+0x214>
+            if (*format >= '0' && *format <= '9') {
+  200877:	eb 75                	jmp    2008ee <printer_vprintf+0x2d9>
+                }
+            } else if (*format == '*') {
+  200879:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200880:	0f b6 00             	movzbl (%rax),%eax
+  200883:	3c 2a                	cmp    $0x2a,%al
+  200885:	75 68                	jne    2008ef <printer_vprintf+0x2da>
+                precision = va_arg(val, int);
+  200887:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  20088e:	8b 00                	mov    (%rax),%eax
+  200890:	83 f8 2f             	cmp    $0x2f,%eax
+  200893:	77 30                	ja     2008c5 <printer_vprintf+0x2b0>
+  200895:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  20089c:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  2008a0:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2008a7:	8b 00                	mov    (%rax),%eax
+  2008a9:	89 c0                	mov    %eax,%eax
+  2008ab:	48 01 d0             	add    %rdx,%rax
+  2008ae:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  2008b5:	8b 12                	mov    (%rdx),%edx
+  2008b7:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  2008ba:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  2008c1:	89 0a                	mov    %ecx,(%rdx)
+  2008c3:	eb 1a                	jmp    2008df <printer_vprintf+0x2ca>
+  2008c5:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2008cc:	48 8b 40 08          	mov    0x8(%rax),%rax
+  2008d0:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  2008d4:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  2008db:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  2008df:	8b 00                	mov    (%rax),%eax
+  2008e1:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+                ++format;
+  2008e4:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  2008eb:	01 
+  2008ec:	eb 01                	jmp    2008ef <printer_vprintf+0x2da>
+            if (*format >= '0' && *format <= '9') {
+  2008ee:	90                   	nop
+            }
+            if (precision < 0) {
+  2008ef:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  2008f3:	79 07                	jns    2008fc <printer_vprintf+0x2e7>
+                precision = 0;
+  2008f5:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%rbp)
+            }
+        }
+
+        // process main conversion character
+        int base = 10;
+  2008fc:	c7 45 e0 0a 00 00 00 	movl   $0xa,-0x20(%rbp)
+        unsigned long num = 0;
+  200903:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  20090a:	00 
+        int length = 0;
+  20090b:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+        char* data = "";
+  200912:	48 8d 05 5d 17 00 00 	lea    0x175d(%rip),%rax        # 202076 <flag_chars+0x6>
+  200919:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    again:
+        switch (*format) {
+  20091d:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200924:	0f b6 00             	movzbl (%rax),%eax
+  200927:	0f be c0             	movsbl %al,%eax
+  20092a:	83 e8 43             	sub    $0x43,%eax
+  20092d:	83 f8 37             	cmp    $0x37,%eax
+  200930:	0f 87 b5 03 00 00    	ja     200ceb <printer_vprintf+0x6d6>
+  200936:	89 c0                	mov    %eax,%eax
+  200938:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  20093f:	00 
+  200940:	48 8d 05 3d 17 00 00 	lea    0x173d(%rip),%rax        # 202084 <flag_chars+0x14>
+  200947:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+  20094a:	48 98                	cltq
+  20094c:	48 8d 15 31 17 00 00 	lea    0x1731(%rip),%rdx        # 202084 <flag_chars+0x14>
+  200953:	48 01 d0             	add    %rdx,%rax
+  200956:	ff e0                	jmp    *%rax
+        case 'l':
+        case 'z':
+            length = 1;
+  200958:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+            ++format;
+  20095f:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  200966:	01 
+            goto again;
+  200967:	eb b4                	jmp    20091d <printer_vprintf+0x308>
+        case 'd':
+        case 'i': {
+            long x = length ? va_arg(val, long) : va_arg(val, int);
+  200969:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  20096d:	74 5d                	je     2009cc <printer_vprintf+0x3b7>
+  20096f:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200976:	8b 00                	mov    (%rax),%eax
+  200978:	83 f8 2f             	cmp    $0x2f,%eax
+  20097b:	77 30                	ja     2009ad <printer_vprintf+0x398>
+  20097d:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200984:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200988:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  20098f:	8b 00                	mov    (%rax),%eax
+  200991:	89 c0                	mov    %eax,%eax
+  200993:	48 01 d0             	add    %rdx,%rax
+  200996:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  20099d:	8b 12                	mov    (%rdx),%edx
+  20099f:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  2009a2:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  2009a9:	89 0a                	mov    %ecx,(%rdx)
+  2009ab:	eb 1a                	jmp    2009c7 <printer_vprintf+0x3b2>
+  2009ad:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2009b4:	48 8b 40 08          	mov    0x8(%rax),%rax
+  2009b8:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  2009bc:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  2009c3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  2009c7:	48 8b 00             	mov    (%rax),%rax
+  2009ca:	eb 5c                	jmp    200a28 <printer_vprintf+0x413>
+  2009cc:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2009d3:	8b 00                	mov    (%rax),%eax
+  2009d5:	83 f8 2f             	cmp    $0x2f,%eax
+  2009d8:	77 30                	ja     200a0a <printer_vprintf+0x3f5>
+  2009da:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2009e1:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  2009e5:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  2009ec:	8b 00                	mov    (%rax),%eax
+  2009ee:	89 c0                	mov    %eax,%eax
+  2009f0:	48 01 d0             	add    %rdx,%rax
+  2009f3:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  2009fa:	8b 12                	mov    (%rdx),%edx
+  2009fc:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  2009ff:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200a06:	89 0a                	mov    %ecx,(%rdx)
+  200a08:	eb 1a                	jmp    200a24 <printer_vprintf+0x40f>
+  200a0a:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200a11:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200a15:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200a19:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200a20:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200a24:	8b 00                	mov    (%rax),%eax
+  200a26:	48 98                	cltq
+  200a28:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+            int negative = x < 0 ? FLAG_NEGATIVE : 0;
+  200a2c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  200a30:	48 c1 f8 38          	sar    $0x38,%rax
+  200a34:	25 80 00 00 00       	and    $0x80,%eax
+  200a39:	89 45 a4             	mov    %eax,-0x5c(%rbp)
+            num = negative ? -x : x;
+  200a3c:	83 7d a4 00          	cmpl   $0x0,-0x5c(%rbp)
+  200a40:	74 09                	je     200a4b <printer_vprintf+0x436>
+  200a42:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  200a46:	48 f7 d8             	neg    %rax
+  200a49:	eb 04                	jmp    200a4f <printer_vprintf+0x43a>
+  200a4b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  200a4f:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+            flags |= FLAG_NUMERIC | FLAG_SIGNED | negative;
+  200a53:	8b 45 a4             	mov    -0x5c(%rbp),%eax
+  200a56:	83 c8 60             	or     $0x60,%eax
+  200a59:	09 45 ec             	or     %eax,-0x14(%rbp)
+            break;
+  200a5c:	e9 cf 02 00 00       	jmp    200d30 <printer_vprintf+0x71b>
+        }
+        case 'u':
+        format_unsigned:
+            num = length ? va_arg(val, unsigned long) : va_arg(val, unsigned);
+  200a61:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  200a65:	74 5d                	je     200ac4 <printer_vprintf+0x4af>
+  200a67:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200a6e:	8b 00                	mov    (%rax),%eax
+  200a70:	83 f8 2f             	cmp    $0x2f,%eax
+  200a73:	77 30                	ja     200aa5 <printer_vprintf+0x490>
+  200a75:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200a7c:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200a80:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200a87:	8b 00                	mov    (%rax),%eax
+  200a89:	89 c0                	mov    %eax,%eax
+  200a8b:	48 01 d0             	add    %rdx,%rax
+  200a8e:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200a95:	8b 12                	mov    (%rdx),%edx
+  200a97:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200a9a:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200aa1:	89 0a                	mov    %ecx,(%rdx)
+  200aa3:	eb 1a                	jmp    200abf <printer_vprintf+0x4aa>
+  200aa5:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200aac:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200ab0:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200ab4:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200abb:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200abf:	48 8b 00             	mov    (%rax),%rax
+  200ac2:	eb 5c                	jmp    200b20 <printer_vprintf+0x50b>
+  200ac4:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200acb:	8b 00                	mov    (%rax),%eax
+  200acd:	83 f8 2f             	cmp    $0x2f,%eax
+  200ad0:	77 30                	ja     200b02 <printer_vprintf+0x4ed>
+  200ad2:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200ad9:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200add:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200ae4:	8b 00                	mov    (%rax),%eax
+  200ae6:	89 c0                	mov    %eax,%eax
+  200ae8:	48 01 d0             	add    %rdx,%rax
+  200aeb:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200af2:	8b 12                	mov    (%rdx),%edx
+  200af4:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200af7:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200afe:	89 0a                	mov    %ecx,(%rdx)
+  200b00:	eb 1a                	jmp    200b1c <printer_vprintf+0x507>
+  200b02:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200b09:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200b0d:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200b11:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200b18:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200b1c:	8b 00                	mov    (%rax),%eax
+  200b1e:	89 c0                	mov    %eax,%eax
+  200b20:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+            flags |= FLAG_NUMERIC;
+  200b24:	83 4d ec 20          	orl    $0x20,-0x14(%rbp)
+            break;
+  200b28:	e9 03 02 00 00       	jmp    200d30 <printer_vprintf+0x71b>
+        case 'x':
+            base = -16;
+  200b2d:	c7 45 e0 f0 ff ff ff 	movl   $0xfffffff0,-0x20(%rbp)
+            goto format_unsigned;
+  200b34:	e9 28 ff ff ff       	jmp    200a61 <printer_vprintf+0x44c>
+        case 'X':
+            base = 16;
+  200b39:	c7 45 e0 10 00 00 00 	movl   $0x10,-0x20(%rbp)
+            goto format_unsigned;
+  200b40:	e9 1c ff ff ff       	jmp    200a61 <printer_vprintf+0x44c>
+        case 'p':
+            num = (uintptr_t) va_arg(val, void*);
+  200b45:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200b4c:	8b 00                	mov    (%rax),%eax
+  200b4e:	83 f8 2f             	cmp    $0x2f,%eax
+  200b51:	77 30                	ja     200b83 <printer_vprintf+0x56e>
+  200b53:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200b5a:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200b5e:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200b65:	8b 00                	mov    (%rax),%eax
+  200b67:	89 c0                	mov    %eax,%eax
+  200b69:	48 01 d0             	add    %rdx,%rax
+  200b6c:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200b73:	8b 12                	mov    (%rdx),%edx
+  200b75:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200b78:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200b7f:	89 0a                	mov    %ecx,(%rdx)
+  200b81:	eb 1a                	jmp    200b9d <printer_vprintf+0x588>
+  200b83:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200b8a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200b8e:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200b92:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200b99:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200b9d:	48 8b 00             	mov    (%rax),%rax
+  200ba0:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+            base = -16;
+  200ba4:	c7 45 e0 f0 ff ff ff 	movl   $0xfffffff0,-0x20(%rbp)
+            flags |= FLAG_ALT | FLAG_ALT2 | FLAG_NUMERIC;
+  200bab:	81 4d ec 21 01 00 00 	orl    $0x121,-0x14(%rbp)
+            break;
+  200bb2:	e9 79 01 00 00       	jmp    200d30 <printer_vprintf+0x71b>
+        case 's':
+            data = va_arg(val, char*);
+  200bb7:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200bbe:	8b 00                	mov    (%rax),%eax
+  200bc0:	83 f8 2f             	cmp    $0x2f,%eax
+  200bc3:	77 30                	ja     200bf5 <printer_vprintf+0x5e0>
+  200bc5:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200bcc:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200bd0:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200bd7:	8b 00                	mov    (%rax),%eax
+  200bd9:	89 c0                	mov    %eax,%eax
+  200bdb:	48 01 d0             	add    %rdx,%rax
+  200bde:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200be5:	8b 12                	mov    (%rdx),%edx
+  200be7:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200bea:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200bf1:	89 0a                	mov    %ecx,(%rdx)
+  200bf3:	eb 1a                	jmp    200c0f <printer_vprintf+0x5fa>
+  200bf5:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200bfc:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200c00:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200c04:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200c0b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200c0f:	48 8b 00             	mov    (%rax),%rax
+  200c12:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+            break;
+  200c16:	e9 15 01 00 00       	jmp    200d30 <printer_vprintf+0x71b>
+        case 'C':
+            color = va_arg(val, int);
+  200c1b:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c22:	8b 00                	mov    (%rax),%eax
+  200c24:	83 f8 2f             	cmp    $0x2f,%eax
+  200c27:	77 30                	ja     200c59 <printer_vprintf+0x644>
+  200c29:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c30:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200c34:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c3b:	8b 00                	mov    (%rax),%eax
+  200c3d:	89 c0                	mov    %eax,%eax
+  200c3f:	48 01 d0             	add    %rdx,%rax
+  200c42:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200c49:	8b 12                	mov    (%rdx),%edx
+  200c4b:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200c4e:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200c55:	89 0a                	mov    %ecx,(%rdx)
+  200c57:	eb 1a                	jmp    200c73 <printer_vprintf+0x65e>
+  200c59:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c60:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200c64:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200c68:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200c6f:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200c73:	8b 00                	mov    (%rax),%eax
+  200c75:	89 85 74 ff ff ff    	mov    %eax,-0x8c(%rbp)
+            goto done;
+  200c7b:	e9 77 03 00 00       	jmp    200ff7 <printer_vprintf+0x9e2>
+        case 'c':
+            data = numbuf;
+  200c80:	48 8d 45 8c          	lea    -0x74(%rbp),%rax
+  200c84:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+            numbuf[0] = va_arg(val, int);
+  200c88:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c8f:	8b 00                	mov    (%rax),%eax
+  200c91:	83 f8 2f             	cmp    $0x2f,%eax
+  200c94:	77 30                	ja     200cc6 <printer_vprintf+0x6b1>
+  200c96:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200c9d:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  200ca1:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200ca8:	8b 00                	mov    (%rax),%eax
+  200caa:	89 c0                	mov    %eax,%eax
+  200cac:	48 01 d0             	add    %rdx,%rax
+  200caf:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200cb6:	8b 12                	mov    (%rdx),%edx
+  200cb8:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  200cbb:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200cc2:	89 0a                	mov    %ecx,(%rdx)
+  200cc4:	eb 1a                	jmp    200ce0 <printer_vprintf+0x6cb>
+  200cc6:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  200ccd:	48 8b 40 08          	mov    0x8(%rax),%rax
+  200cd1:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  200cd5:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  200cdc:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  200ce0:	8b 00                	mov    (%rax),%eax
+  200ce2:	88 45 8c             	mov    %al,-0x74(%rbp)
+            numbuf[1] = '\0';
+  200ce5:	c6 45 8d 00          	movb   $0x0,-0x73(%rbp)
+            break;
+  200ce9:	eb 45                	jmp    200d30 <printer_vprintf+0x71b>
+        default:
+            data = numbuf;
+  200ceb:	48 8d 45 8c          	lea    -0x74(%rbp),%rax
+  200cef:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+            numbuf[0] = (*format ? *format : '%');
+  200cf3:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200cfa:	0f b6 00             	movzbl (%rax),%eax
+  200cfd:	84 c0                	test   %al,%al
+  200cff:	74 0c                	je     200d0d <printer_vprintf+0x6f8>
+  200d01:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200d08:	0f b6 00             	movzbl (%rax),%eax
+  200d0b:	eb 05                	jmp    200d12 <printer_vprintf+0x6fd>
+  200d0d:	b8 25 00 00 00       	mov    $0x25,%eax
+  200d12:	88 45 8c             	mov    %al,-0x74(%rbp)
+            numbuf[1] = '\0';
+  200d15:	c6 45 8d 00          	movb   $0x0,-0x73(%rbp)
+            if (!*format) {
+  200d19:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  200d20:	0f b6 00             	movzbl (%rax),%eax
+  200d23:	84 c0                	test   %al,%al
+  200d25:	75 08                	jne    200d2f <printer_vprintf+0x71a>
+                format--;
+  200d27:	48 83 ad 68 ff ff ff 	subq   $0x1,-0x98(%rbp)
+  200d2e:	01 
+            }
+            break;
+  200d2f:	90                   	nop
+        }
+
+        if (flags & FLAG_NUMERIC) {
+  200d30:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200d33:	83 e0 20             	and    $0x20,%eax
+  200d36:	85 c0                	test   %eax,%eax
+  200d38:	74 1e                	je     200d58 <printer_vprintf+0x743>
+            data = fill_numbuf(numbuf + NUMBUFSIZ, num, base);
+  200d3a:	48 8d 45 8c          	lea    -0x74(%rbp),%rax
+  200d3e:	48 83 c0 18          	add    $0x18,%rax
+  200d42:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  200d45:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  200d49:	48 89 ce             	mov    %rcx,%rsi
+  200d4c:	48 89 c7             	mov    %rax,%rdi
+  200d4f:	e8 39 f8 ff ff       	call   20058d <fill_numbuf>
+  200d54:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        }
+
+        const char* prefix = "";
+  200d58:	48 8d 05 17 13 00 00 	lea    0x1317(%rip),%rax        # 202076 <flag_chars+0x6>
+  200d5f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if ((flags & FLAG_NUMERIC) && (flags & FLAG_SIGNED)) {
+  200d63:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200d66:	83 e0 20             	and    $0x20,%eax
+  200d69:	85 c0                	test   %eax,%eax
+  200d6b:	74 51                	je     200dbe <printer_vprintf+0x7a9>
+  200d6d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200d70:	83 e0 40             	and    $0x40,%eax
+  200d73:	85 c0                	test   %eax,%eax
+  200d75:	74 47                	je     200dbe <printer_vprintf+0x7a9>
+            if (flags & FLAG_NEGATIVE) {
+  200d77:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200d7a:	25 80 00 00 00       	and    $0x80,%eax
+  200d7f:	85 c0                	test   %eax,%eax
+  200d81:	74 0d                	je     200d90 <printer_vprintf+0x77b>
+                prefix = "-";
+  200d83:	48 8d 05 ed 12 00 00 	lea    0x12ed(%rip),%rax        # 202077 <flag_chars+0x7>
+  200d8a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            if (flags & FLAG_NEGATIVE) {
+  200d8e:	eb 7d                	jmp    200e0d <printer_vprintf+0x7f8>
+            } else if (flags & FLAG_PLUSPOSITIVE) {
+  200d90:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200d93:	83 e0 10             	and    $0x10,%eax
+  200d96:	85 c0                	test   %eax,%eax
+  200d98:	74 0d                	je     200da7 <printer_vprintf+0x792>
+                prefix = "+";
+  200d9a:	48 8d 05 d8 12 00 00 	lea    0x12d8(%rip),%rax        # 202079 <flag_chars+0x9>
+  200da1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            if (flags & FLAG_NEGATIVE) {
+  200da5:	eb 66                	jmp    200e0d <printer_vprintf+0x7f8>
+            } else if (flags & FLAG_SPACEPOSITIVE) {
+  200da7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200daa:	83 e0 08             	and    $0x8,%eax
+  200dad:	85 c0                	test   %eax,%eax
+  200daf:	74 5c                	je     200e0d <printer_vprintf+0x7f8>
+                prefix = " ";
+  200db1:	48 8d 05 c3 12 00 00 	lea    0x12c3(%rip),%rax        # 20207b <flag_chars+0xb>
+  200db8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            if (flags & FLAG_NEGATIVE) {
+  200dbc:	eb 4f                	jmp    200e0d <printer_vprintf+0x7f8>
+            }
+        } else if ((flags & FLAG_NUMERIC) && (flags & FLAG_ALT)
+  200dbe:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200dc1:	83 e0 20             	and    $0x20,%eax
+  200dc4:	85 c0                	test   %eax,%eax
+  200dc6:	74 46                	je     200e0e <printer_vprintf+0x7f9>
+  200dc8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200dcb:	83 e0 01             	and    $0x1,%eax
+  200dce:	85 c0                	test   %eax,%eax
+  200dd0:	74 3c                	je     200e0e <printer_vprintf+0x7f9>
+                   && (base == 16 || base == -16)
+  200dd2:	83 7d e0 10          	cmpl   $0x10,-0x20(%rbp)
+  200dd6:	74 06                	je     200dde <printer_vprintf+0x7c9>
+  200dd8:	83 7d e0 f0          	cmpl   $0xfffffff0,-0x20(%rbp)
+  200ddc:	75 30                	jne    200e0e <printer_vprintf+0x7f9>
+                   && (num || (flags & FLAG_ALT2))) {
+  200dde:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  200de3:	75 0c                	jne    200df1 <printer_vprintf+0x7dc>
+  200de5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200de8:	25 00 01 00 00       	and    $0x100,%eax
+  200ded:	85 c0                	test   %eax,%eax
+  200def:	74 1d                	je     200e0e <printer_vprintf+0x7f9>
+            prefix = (base == -16 ? "0x" : "0X");
+  200df1:	83 7d e0 f0          	cmpl   $0xfffffff0,-0x20(%rbp)
+  200df5:	75 09                	jne    200e00 <printer_vprintf+0x7eb>
+  200df7:	48 8d 05 7f 12 00 00 	lea    0x127f(%rip),%rax        # 20207d <flag_chars+0xd>
+  200dfe:	eb 07                	jmp    200e07 <printer_vprintf+0x7f2>
+  200e00:	48 8d 05 79 12 00 00 	lea    0x1279(%rip),%rax        # 202080 <flag_chars+0x10>
+  200e07:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  200e0b:	eb 01                	jmp    200e0e <printer_vprintf+0x7f9>
+            if (flags & FLAG_NEGATIVE) {
+  200e0d:	90                   	nop
+        }
+
+        int len;
+        if (precision >= 0 && !(flags & FLAG_NUMERIC)) {
+  200e0e:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  200e12:	78 24                	js     200e38 <printer_vprintf+0x823>
+  200e14:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200e17:	83 e0 20             	and    $0x20,%eax
+  200e1a:	85 c0                	test   %eax,%eax
+  200e1c:	75 1a                	jne    200e38 <printer_vprintf+0x823>
+            len = strnlen(data, precision);
+  200e1e:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  200e21:	48 63 d0             	movslq %eax,%rdx
+  200e24:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200e28:	48 89 d6             	mov    %rdx,%rsi
+  200e2b:	48 89 c7             	mov    %rax,%rdi
+  200e2e:	e8 8a f5 ff ff       	call   2003bd <strnlen>
+  200e33:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  200e36:	eb 0f                	jmp    200e47 <printer_vprintf+0x832>
+        } else {
+            len = strlen(data);
+  200e38:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200e3c:	48 89 c7             	mov    %rax,%rdi
+  200e3f:	e8 48 f5 ff ff       	call   20038c <strlen>
+  200e44:	89 45 bc             	mov    %eax,-0x44(%rbp)
+        }
+        int zeros;
+        if ((flags & FLAG_NUMERIC) && precision >= 0) {
+  200e47:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200e4a:	83 e0 20             	and    $0x20,%eax
+  200e4d:	85 c0                	test   %eax,%eax
+  200e4f:	74 20                	je     200e71 <printer_vprintf+0x85c>
+  200e51:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  200e55:	78 1a                	js     200e71 <printer_vprintf+0x85c>
+            zeros = precision > len ? precision - len : 0;
+  200e57:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  200e5a:	3b 45 bc             	cmp    -0x44(%rbp),%eax
+  200e5d:	7e 08                	jle    200e67 <printer_vprintf+0x852>
+  200e5f:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  200e62:	2b 45 bc             	sub    -0x44(%rbp),%eax
+  200e65:	eb 05                	jmp    200e6c <printer_vprintf+0x857>
+  200e67:	b8 00 00 00 00       	mov    $0x0,%eax
+  200e6c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  200e6f:	eb 5c                	jmp    200ecd <printer_vprintf+0x8b8>
+        } else if ((flags & FLAG_NUMERIC) && (flags & FLAG_ZERO)
+  200e71:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200e74:	83 e0 20             	and    $0x20,%eax
+  200e77:	85 c0                	test   %eax,%eax
+  200e79:	74 4b                	je     200ec6 <printer_vprintf+0x8b1>
+  200e7b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200e7e:	83 e0 02             	and    $0x2,%eax
+  200e81:	85 c0                	test   %eax,%eax
+  200e83:	74 41                	je     200ec6 <printer_vprintf+0x8b1>
+                   && !(flags & FLAG_LEFTJUSTIFY)
+  200e85:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200e88:	83 e0 04             	and    $0x4,%eax
+  200e8b:	85 c0                	test   %eax,%eax
+  200e8d:	75 37                	jne    200ec6 <printer_vprintf+0x8b1>
+                   && len + (int) strlen(prefix) < width) {
+  200e8f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  200e93:	48 89 c7             	mov    %rax,%rdi
+  200e96:	e8 f1 f4 ff ff       	call   20038c <strlen>
+  200e9b:	89 c2                	mov    %eax,%edx
+  200e9d:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  200ea0:	01 d0                	add    %edx,%eax
+  200ea2:	39 45 e8             	cmp    %eax,-0x18(%rbp)
+  200ea5:	7e 1f                	jle    200ec6 <printer_vprintf+0x8b1>
+            zeros = width - len - strlen(prefix);
+  200ea7:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  200eaa:	2b 45 bc             	sub    -0x44(%rbp),%eax
+  200ead:	89 c3                	mov    %eax,%ebx
+  200eaf:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  200eb3:	48 89 c7             	mov    %rax,%rdi
+  200eb6:	e8 d1 f4 ff ff       	call   20038c <strlen>
+  200ebb:	89 c2                	mov    %eax,%edx
+  200ebd:	89 d8                	mov    %ebx,%eax
+  200ebf:	29 d0                	sub    %edx,%eax
+  200ec1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  200ec4:	eb 07                	jmp    200ecd <printer_vprintf+0x8b8>
+        } else {
+            zeros = 0;
+  200ec6:	c7 45 b8 00 00 00 00 	movl   $0x0,-0x48(%rbp)
+        }
+        width -= len + zeros + strlen(prefix);
+  200ecd:	8b 55 bc             	mov    -0x44(%rbp),%edx
+  200ed0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  200ed3:	01 d0                	add    %edx,%eax
+  200ed5:	48 63 d8             	movslq %eax,%rbx
+  200ed8:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  200edc:	48 89 c7             	mov    %rax,%rdi
+  200edf:	e8 a8 f4 ff ff       	call   20038c <strlen>
+  200ee4:	48 8d 14 03          	lea    (%rbx,%rax,1),%rdx
+  200ee8:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  200eeb:	29 d0                	sub    %edx,%eax
+  200eed:	89 45 e8             	mov    %eax,-0x18(%rbp)
+        for (; !(flags & FLAG_LEFTJUSTIFY) && width > 0; --width) {
+  200ef0:	eb 25                	jmp    200f17 <printer_vprintf+0x902>
+            p->putc(p, ' ', color);
+  200ef2:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200ef9:	48 8b 08             	mov    (%rax),%rcx
+  200efc:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  200f02:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200f09:	be 20 00 00 00       	mov    $0x20,%esi
+  200f0e:	48 89 c7             	mov    %rax,%rdi
+  200f11:	ff d1                	call   *%rcx
+        for (; !(flags & FLAG_LEFTJUSTIFY) && width > 0; --width) {
+  200f13:	83 6d e8 01          	subl   $0x1,-0x18(%rbp)
+  200f17:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  200f1a:	83 e0 04             	and    $0x4,%eax
+  200f1d:	85 c0                	test   %eax,%eax
+  200f1f:	75 36                	jne    200f57 <printer_vprintf+0x942>
+  200f21:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  200f25:	7f cb                	jg     200ef2 <printer_vprintf+0x8dd>
+        }
+        for (; *prefix; ++prefix) {
+  200f27:	eb 2e                	jmp    200f57 <printer_vprintf+0x942>
+            p->putc(p, *prefix, color);
+  200f29:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200f30:	4c 8b 00             	mov    (%rax),%r8
+  200f33:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  200f37:	0f b6 00             	movzbl (%rax),%eax
+  200f3a:	0f b6 c8             	movzbl %al,%ecx
+  200f3d:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  200f43:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200f4a:	89 ce                	mov    %ecx,%esi
+  200f4c:	48 89 c7             	mov    %rax,%rdi
+  200f4f:	41 ff d0             	call   *%r8
+        for (; *prefix; ++prefix) {
+  200f52:	48 83 45 c0 01       	addq   $0x1,-0x40(%rbp)
+  200f57:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  200f5b:	0f b6 00             	movzbl (%rax),%eax
+  200f5e:	84 c0                	test   %al,%al
+  200f60:	75 c7                	jne    200f29 <printer_vprintf+0x914>
+        }
+        for (; zeros > 0; --zeros) {
+  200f62:	eb 25                	jmp    200f89 <printer_vprintf+0x974>
+            p->putc(p, '0', color);
+  200f64:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200f6b:	48 8b 08             	mov    (%rax),%rcx
+  200f6e:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  200f74:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200f7b:	be 30 00 00 00       	mov    $0x30,%esi
+  200f80:	48 89 c7             	mov    %rax,%rdi
+  200f83:	ff d1                	call   *%rcx
+        for (; zeros > 0; --zeros) {
+  200f85:	83 6d b8 01          	subl   $0x1,-0x48(%rbp)
+  200f89:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  200f8d:	7f d5                	jg     200f64 <printer_vprintf+0x94f>
+        }
+        for (; len > 0; ++data, --len) {
+  200f8f:	eb 32                	jmp    200fc3 <printer_vprintf+0x9ae>
+            p->putc(p, *data, color);
+  200f91:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200f98:	4c 8b 00             	mov    (%rax),%r8
+  200f9b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  200f9f:	0f b6 00             	movzbl (%rax),%eax
+  200fa2:	0f b6 c8             	movzbl %al,%ecx
+  200fa5:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  200fab:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200fb2:	89 ce                	mov    %ecx,%esi
+  200fb4:	48 89 c7             	mov    %rax,%rdi
+  200fb7:	41 ff d0             	call   *%r8
+        for (; len > 0; ++data, --len) {
+  200fba:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  200fbf:	83 6d bc 01          	subl   $0x1,-0x44(%rbp)
+  200fc3:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+  200fc7:	7f c8                	jg     200f91 <printer_vprintf+0x97c>
+        }
+        for (; width > 0; --width) {
+  200fc9:	eb 25                	jmp    200ff0 <printer_vprintf+0x9db>
+            p->putc(p, ' ', color);
+  200fcb:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200fd2:	48 8b 08             	mov    (%rax),%rcx
+  200fd5:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  200fdb:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  200fe2:	be 20 00 00 00       	mov    $0x20,%esi
+  200fe7:	48 89 c7             	mov    %rax,%rdi
+  200fea:	ff d1                	call   *%rcx
+        for (; width > 0; --width) {
+  200fec:	83 6d e8 01          	subl   $0x1,-0x18(%rbp)
+  200ff0:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  200ff4:	7f d5                	jg     200fcb <printer_vprintf+0x9b6>
+        }
+    done: ;
+  200ff6:	90                   	nop
+    for (; *format; ++format) {
+  200ff7:	48 83 85 68 ff ff ff 	addq   $0x1,-0x98(%rbp)
+  200ffe:	01 
+  200fff:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  201006:	0f b6 00             	movzbl (%rax),%eax
+  201009:	84 c0                	test   %al,%al
+  20100b:	0f 85 30 f6 ff ff    	jne    200641 <printer_vprintf+0x2c>
+    }
+}
+  201011:	90                   	nop
+  201012:	90                   	nop
+  201013:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  201017:	c9                   	leave
+  201018:	c3                   	ret
+
+0000000000201019 <console_putc>:
+typedef struct console_printer {
+    printer p;
+    uint16_t* cursor;
+} console_printer;
+
+static void console_putc(printer* p, unsigned char c, int color) {
+  201019:	55                   	push   %rbp
+  20101a:	48 89 e5             	mov    %rsp,%rbp
+  20101d:	48 83 ec 30          	sub    $0x30,%rsp
+  201021:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  201025:	89 f0                	mov    %esi,%eax
+  201027:	89 55 d0             	mov    %edx,-0x30(%rbp)
+  20102a:	88 45 d4             	mov    %al,-0x2c(%rbp)
+    console_printer* cp = (console_printer*) p;
+  20102d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  201031:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    /*if (cp->cursor >= console + CONSOLE_ROWS * CONSOLE_COLUMNS) {
+        cp->cursor = console;
+    }*/
+    if (c == '\n') {
+  201035:	80 7d d4 0a          	cmpb   $0xa,-0x2c(%rbp)
+  201039:	75 7f                	jne    2010ba <console_putc+0xa1>
+        int pos = (cp->cursor - console) % CONSOLE_COLUMNS;
+  20103b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20103f:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  201043:	48 8d 05 b6 6f eb ff 	lea    -0x14904a(%rip),%rax        # b8000 <console>
+  20104a:	48 29 c2             	sub    %rax,%rdx
+  20104d:	48 89 d0             	mov    %rdx,%rax
+  201050:	48 d1 f8             	sar    %rax
+  201053:	48 89 c1             	mov    %rax,%rcx
+  201056:	48 ba 67 66 66 66 66 	movabs $0x6666666666666667,%rdx
+  20105d:	66 66 66 
+  201060:	48 89 c8             	mov    %rcx,%rax
+  201063:	48 f7 ea             	imul   %rdx
+  201066:	48 c1 fa 05          	sar    $0x5,%rdx
+  20106a:	48 89 c8             	mov    %rcx,%rax
+  20106d:	48 c1 f8 3f          	sar    $0x3f,%rax
+  201071:	48 29 c2             	sub    %rax,%rdx
+  201074:	48 89 d0             	mov    %rdx,%rax
+  201077:	48 c1 e0 02          	shl    $0x2,%rax
+  20107b:	48 01 d0             	add    %rdx,%rax
+  20107e:	48 c1 e0 04          	shl    $0x4,%rax
+  201082:	48 29 c1             	sub    %rax,%rcx
+  201085:	48 89 ca             	mov    %rcx,%rdx
+  201088:	89 55 fc             	mov    %edx,-0x4(%rbp)
+        for (; pos != CONSOLE_COLUMNS; pos++) {
+  20108b:	eb 25                	jmp    2010b2 <console_putc+0x99>
+            *cp->cursor++ = ' ' | color;
+  20108d:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  201090:	83 c8 20             	or     $0x20,%eax
+  201093:	89 c6                	mov    %eax,%esi
+  201095:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201099:	48 8b 40 08          	mov    0x8(%rax),%rax
+  20109d:	48 8d 48 02          	lea    0x2(%rax),%rcx
+  2010a1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  2010a5:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  2010a9:	89 f2                	mov    %esi,%edx
+  2010ab:	66 89 10             	mov    %dx,(%rax)
+        for (; pos != CONSOLE_COLUMNS; pos++) {
+  2010ae:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  2010b2:	83 7d fc 50          	cmpl   $0x50,-0x4(%rbp)
+  2010b6:	75 d5                	jne    20108d <console_putc+0x74>
+  2010b8:	eb 69                	jmp    201123 <console_putc+0x10a>
+        }
+    } else if (c == '\b') {
+  2010ba:	80 7d d4 08          	cmpb   $0x8,-0x2c(%rbp)
+  2010be:	75 3f                	jne    2010ff <console_putc+0xe6>
+        if (cp->cursor != console) {
+  2010c0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2010c4:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  2010c8:	48 8d 05 31 6f eb ff 	lea    -0x1490cf(%rip),%rax        # b8000 <console>
+  2010cf:	48 39 c2             	cmp    %rax,%rdx
+  2010d2:	74 4f                	je     201123 <console_putc+0x10a>
+            *(--cp->cursor) = ' ' | color;
+  2010d4:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  2010d7:	83 c8 20             	or     $0x20,%eax
+  2010da:	89 c1                	mov    %eax,%ecx
+  2010dc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2010e0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  2010e4:	48 8d 50 fe          	lea    -0x2(%rax),%rdx
+  2010e8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2010ec:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  2010f0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2010f4:	48 8b 40 08          	mov    0x8(%rax),%rax
+  2010f8:	89 ca                	mov    %ecx,%edx
+  2010fa:	66 89 10             	mov    %dx,(%rax)
+  2010fd:	eb 24                	jmp    201123 <console_putc+0x10a>
+        }
+    } else {
+        *cp->cursor++ = c | color;
+  2010ff:	0f b6 45 d4          	movzbl -0x2c(%rbp),%eax
+  201103:	8b 55 d0             	mov    -0x30(%rbp),%edx
+  201106:	09 d0                	or     %edx,%eax
+  201108:	89 c6                	mov    %eax,%esi
+  20110a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20110e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  201112:	48 8d 48 02          	lea    0x2(%rax),%rcx
+  201116:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  20111a:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  20111e:	89 f2                	mov    %esi,%edx
+  201120:	66 89 10             	mov    %dx,(%rax)
+    }
+
+    const int MAX_ROWS = CONSOLE_ROWS - 2;
+  201123:	c7 45 e4 17 00 00 00 	movl   $0x17,-0x1c(%rbp)
+
+    if (cp->cursor == console + MAX_ROWS * CONSOLE_COLUMNS) {
+  20112a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20112e:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  201132:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  201135:	89 d0                	mov    %edx,%eax
+  201137:	c1 e0 02             	shl    $0x2,%eax
+  20113a:	01 d0                	add    %edx,%eax
+  20113c:	c1 e0 04             	shl    $0x4,%eax
+  20113f:	48 98                	cltq
+  201141:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  201145:	48 8d 05 b4 6e eb ff 	lea    -0x14914c(%rip),%rax        # b8000 <console>
+  20114c:	48 01 d0             	add    %rdx,%rax
+  20114f:	48 39 c1             	cmp    %rax,%rcx
+  201152:	0f 85 ac 00 00 00    	jne    201204 <console_putc+0x1eb>
+        // Move all characters up by one row, forgetting the first row
+        for (int i = 0; i < (MAX_ROWS - 1) * CONSOLE_COLUMNS; ++i) {
+  201158:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  20115f:	eb 30                	jmp    201191 <console_putc+0x178>
+            console[i] = console[i + CONSOLE_COLUMNS];
+  201161:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  201164:	83 c0 50             	add    $0x50,%eax
+  201167:	48 98                	cltq
+  201169:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  20116d:	48 8d 05 8c 6e eb ff 	lea    -0x149174(%rip),%rax        # b8000 <console>
+  201174:	0f b7 04 02          	movzwl (%rdx,%rax,1),%eax
+  201178:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  20117b:	48 63 d2             	movslq %edx,%rdx
+  20117e:	48 8d 0c 12          	lea    (%rdx,%rdx,1),%rcx
+  201182:	48 8d 15 77 6e eb ff 	lea    -0x149189(%rip),%rdx        # b8000 <console>
+  201189:	66 89 04 11          	mov    %ax,(%rcx,%rdx,1)
+        for (int i = 0; i < (MAX_ROWS - 1) * CONSOLE_COLUMNS; ++i) {
+  20118d:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+  201191:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  201194:	8d 50 ff             	lea    -0x1(%rax),%edx
+  201197:	89 d0                	mov    %edx,%eax
+  201199:	c1 e0 02             	shl    $0x2,%eax
+  20119c:	01 d0                	add    %edx,%eax
+  20119e:	c1 e0 04             	shl    $0x4,%eax
+  2011a1:	39 45 f8             	cmp    %eax,-0x8(%rbp)
+  2011a4:	7c bb                	jl     201161 <console_putc+0x148>
+        }
+
+        // Fill last column with space
+        for (int i = (MAX_ROWS - 1) * CONSOLE_COLUMNS; i < MAX_ROWS * CONSOLE_COLUMNS; ++i) {
+  2011a6:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  2011a9:	8d 50 ff             	lea    -0x1(%rax),%edx
+  2011ac:	89 d0                	mov    %edx,%eax
+  2011ae:	c1 e0 02             	shl    $0x2,%eax
+  2011b1:	01 d0                	add    %edx,%eax
+  2011b3:	c1 e0 04             	shl    $0x4,%eax
+  2011b6:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  2011b9:	eb 20                	jmp    2011db <console_putc+0x1c2>
+            console[i] = ' ' | color;
+  2011bb:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  2011be:	83 c8 20             	or     $0x20,%eax
+  2011c1:	89 c1                	mov    %eax,%ecx
+  2011c3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  2011c6:	48 98                	cltq
+  2011c8:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  2011cc:	48 8d 05 2d 6e eb ff 	lea    -0x1491d3(%rip),%rax        # b8000 <console>
+  2011d3:	66 89 0c 02          	mov    %cx,(%rdx,%rax,1)
+        for (int i = (MAX_ROWS - 1) * CONSOLE_COLUMNS; i < MAX_ROWS * CONSOLE_COLUMNS; ++i) {
+  2011d7:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  2011db:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  2011de:	89 d0                	mov    %edx,%eax
+  2011e0:	c1 e0 02             	shl    $0x2,%eax
+  2011e3:	01 d0                	add    %edx,%eax
+  2011e5:	c1 e0 04             	shl    $0x4,%eax
+  2011e8:	39 45 f4             	cmp    %eax,-0xc(%rbp)
+  2011eb:	7c ce                	jl     2011bb <console_putc+0x1a2>
+        }
+
+        cp->cursor -= CONSOLE_COLUMNS;
+  2011ed:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2011f1:	48 8b 40 08          	mov    0x8(%rax),%rax
+  2011f5:	48 8d 90 60 ff ff ff 	lea    -0xa0(%rax),%rdx
+  2011fc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201200:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    }
+}
+  201204:	90                   	nop
+  201205:	c9                   	leave
+  201206:	c3                   	ret
+
+0000000000201207 <console_vprintf>:
+
+int console_vprintf(int cpos, int color, const char* format, va_list val) {
+  201207:	55                   	push   %rbp
+  201208:	48 89 e5             	mov    %rsp,%rbp
+  20120b:	48 83 ec 30          	sub    $0x30,%rsp
+  20120f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  201212:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  201215:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  201219:	48 89 4d d8          	mov    %rcx,-0x28(%rbp)
+    struct console_printer cp;
+    cp.p.putc = console_putc;
+  20121d:	48 8d 05 f5 fd ff ff 	lea    -0x20b(%rip),%rax        # 201019 <console_putc>
+  201224:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (cpos < 0 || cpos >= CONSOLE_ROWS * CONSOLE_COLUMNS) {
+  201228:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  20122c:	78 09                	js     201237 <console_vprintf+0x30>
+  20122e:	81 7d ec cf 07 00 00 	cmpl   $0x7cf,-0x14(%rbp)
+  201235:	7e 07                	jle    20123e <console_vprintf+0x37>
+        cpos = 0;
+  201237:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+    }
+    cp.cursor = console + cpos;
+  20123e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  201241:	48 98                	cltq
+  201243:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  201247:	48 8d 05 b2 6d eb ff 	lea    -0x14924e(%rip),%rax        # b8000 <console>
+  20124e:	48 01 d0             	add    %rdx,%rax
+  201251:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    printer_vprintf(&cp.p, color, format, val);
+  201255:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  201259:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  20125d:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  201260:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  201264:	48 89 c7             	mov    %rax,%rdi
+  201267:	e8 a9 f3 ff ff       	call   200615 <printer_vprintf>
+    return cp.cursor - console;
+  20126c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  201270:	48 8d 05 89 6d eb ff 	lea    -0x149277(%rip),%rax        # b8000 <console>
+  201277:	48 29 c2             	sub    %rax,%rdx
+  20127a:	48 89 d0             	mov    %rdx,%rax
+  20127d:	48 d1 f8             	sar    %rax
+}
+  201280:	c9                   	leave
+  201281:	c3                   	ret
+
+0000000000201282 <console_printf>:
+
+int console_printf(int cpos, int color, const char* format, ...) {
+  201282:	55                   	push   %rbp
+  201283:	48 89 e5             	mov    %rsp,%rbp
+  201286:	48 83 ec 60          	sub    $0x60,%rsp
+  20128a:	89 7d ac             	mov    %edi,-0x54(%rbp)
+  20128d:	89 75 a8             	mov    %esi,-0x58(%rbp)
+  201290:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+  201294:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  201298:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  20129c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list val;
+    va_start(val, format);
+  2012a0:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  2012a7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  2012ab:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  2012af:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  2012b3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    cpos = console_vprintf(cpos, color, format, val);
+  2012b7:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  2012bb:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  2012bf:	8b 75 a8             	mov    -0x58(%rbp),%esi
+  2012c2:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  2012c5:	89 c7                	mov    %eax,%edi
+  2012c7:	e8 3b ff ff ff       	call   201207 <console_vprintf>
+  2012cc:	89 45 ac             	mov    %eax,-0x54(%rbp)
+    va_end(val);
+    return cpos;
+  2012cf:	8b 45 ac             	mov    -0x54(%rbp),%eax
+}
+  2012d2:	c9                   	leave
+  2012d3:	c3                   	ret
+
+00000000002012d4 <string_putc>:
+    printer p;
+    char* s;
+    char* end;
+} string_printer;
+
+static void string_putc(printer* p, unsigned char c, int color) {
+  2012d4:	55                   	push   %rbp
+  2012d5:	48 89 e5             	mov    %rsp,%rbp
+  2012d8:	48 83 ec 20          	sub    $0x20,%rsp
+  2012dc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  2012e0:	89 f0                	mov    %esi,%eax
+  2012e2:	89 55 e0             	mov    %edx,-0x20(%rbp)
+  2012e5:	88 45 e4             	mov    %al,-0x1c(%rbp)
+    string_printer* sp = (string_printer*) p;
+  2012e8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2012ec:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (sp->s < sp->end) {
+  2012f0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2012f4:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  2012f8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2012fc:	48 8b 40 10          	mov    0x10(%rax),%rax
+  201300:	48 39 c2             	cmp    %rax,%rdx
+  201303:	73 1a                	jae    20131f <string_putc+0x4b>
+        *sp->s++ = c;
+  201305:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  201309:	48 8b 40 08          	mov    0x8(%rax),%rax
+  20130d:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  201311:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  201315:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  201319:	0f b6 55 e4          	movzbl -0x1c(%rbp),%edx
+  20131d:	88 10                	mov    %dl,(%rax)
+    }
+    (void) color;
+}
+  20131f:	90                   	nop
+  201320:	c9                   	leave
+  201321:	c3                   	ret
+
+0000000000201322 <vsnprintf>:
+
+int vsnprintf(char* s, size_t size, const char* format, va_list val) {
+  201322:	55                   	push   %rbp
+  201323:	48 89 e5             	mov    %rsp,%rbp
+  201326:	48 83 ec 40          	sub    $0x40,%rsp
+  20132a:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  20132e:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  201332:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  201336:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+    string_printer sp;
+    sp.p.putc = string_putc;
+  20133a:	48 8d 05 93 ff ff ff 	lea    -0x6d(%rip),%rax        # 2012d4 <string_putc>
+  201341:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    sp.s = s;
+  201345:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  201349:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (size) {
+  20134d:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  201352:	74 33                	je     201387 <vsnprintf+0x65>
+        sp.end = s + size - 1;
+  201354:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  201358:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  20135c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  201360:	48 01 d0             	add    %rdx,%rax
+  201363:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+        printer_vprintf(&sp.p, 0, format, val);
+  201367:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  20136b:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  20136f:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  201373:	be 00 00 00 00       	mov    $0x0,%esi
+  201378:	48 89 c7             	mov    %rax,%rdi
+  20137b:	e8 95 f2 ff ff       	call   200615 <printer_vprintf>
+        *sp.s = 0;
+  201380:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  201384:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return sp.s - s;
+  201387:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  20138b:	48 2b 45 d8          	sub    -0x28(%rbp),%rax
+}
+  20138f:	c9                   	leave
+  201390:	c3                   	ret
+
+0000000000201391 <snprintf>:
+
+int snprintf(char* s, size_t size, const char* format, ...) {
+  201391:	55                   	push   %rbp
+  201392:	48 89 e5             	mov    %rsp,%rbp
+  201395:	48 83 ec 70          	sub    $0x70,%rsp
+  201399:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  20139d:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  2013a1:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  2013a5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  2013a9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  2013ad:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list val;
+    va_start(val, format);
+  2013b1:	c7 45 b0 18 00 00 00 	movl   $0x18,-0x50(%rbp)
+  2013b8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  2013bc:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  2013c0:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  2013c4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    int n = vsnprintf(s, size, format, val);
+  2013c8:	48 8d 4d b0          	lea    -0x50(%rbp),%rcx
+  2013cc:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  2013d0:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  2013d4:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  2013d8:	48 89 c7             	mov    %rax,%rdi
+  2013db:	e8 42 ff ff ff       	call   201322 <vsnprintf>
+  2013e0:	89 45 cc             	mov    %eax,-0x34(%rbp)
+    va_end(val);
+    return n;
+  2013e3:	8b 45 cc             	mov    -0x34(%rbp),%eax
+}
+  2013e6:	c9                   	leave
+  2013e7:	c3                   	ret
+
+00000000002013e8 <console_clear>:
+
+
+// console_clear
+//    Erases the console and moves the cursor to the upper left (CPOS(0, 0)).
+
+void console_clear(void) {
+  2013e8:	55                   	push   %rbp
+  2013e9:	48 89 e5             	mov    %rsp,%rbp
+  2013ec:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < CONSOLE_ROWS * CONSOLE_COLUMNS; ++i) {
+  2013f0:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  2013f7:	eb 1a                	jmp    201413 <console_clear+0x2b>
+        console[i] = ' ' | 0x0700;
+  2013f9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  2013fc:	48 98                	cltq
+  2013fe:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  201402:	48 8d 05 f7 6b eb ff 	lea    -0x149409(%rip),%rax        # b8000 <console>
+  201409:	66 c7 04 02 20 07    	movw   $0x720,(%rdx,%rax,1)
+    for (int i = 0; i < CONSOLE_ROWS * CONSOLE_COLUMNS; ++i) {
+  20140f:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  201413:	81 7d fc cf 07 00 00 	cmpl   $0x7cf,-0x4(%rbp)
+  20141a:	7e dd                	jle    2013f9 <console_clear+0x11>
+    }
+    cursorpos = 0;
+  20141c:	c7 05 d6 7b eb ff 00 	movl   $0x0,-0x14842a(%rip)        # b8ffc <cursorpos>
+  201423:	00 00 00 
+}
+  201426:	90                   	nop
+  201427:	c9                   	leave
+  201428:	c3                   	ret
+
+0000000000201429 <string_to_char>:
+
+
+int string_to_char(const char *str, int *dest) {
+  201429:	55                   	push   %rbp
+  20142a:	48 89 e5             	mov    %rsp,%rbp
+  20142d:	48 83 ec 20          	sub    $0x20,%rsp
+  201431:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  201435:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    if (*str == '\0') return -1;
+  201439:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20143d:	0f b6 00             	movzbl (%rax),%eax
+  201440:	84 c0                	test   %al,%al
+  201442:	75 0a                	jne    20144e <string_to_char+0x25>
+  201444:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  201449:	e9 e0 00 00 00       	jmp    20152e <string_to_char+0x105>
+
+    *dest = 0;
+  20144e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  201452:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    for (; *str; str++) {
+  201458:	e9 bd 00 00 00       	jmp    20151a <string_to_char+0xf1>
+        int digit = 0;
+  20145d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+        switch (*str)
+  201464:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201468:	0f b6 00             	movzbl (%rax),%eax
+  20146b:	0f be c0             	movsbl %al,%eax
+  20146e:	83 e8 30             	sub    $0x30,%eax
+  201471:	83 f8 09             	cmp    $0x9,%eax
+  201474:	77 7c                	ja     2014f2 <string_to_char+0xc9>
+  201476:	89 c0                	mov    %eax,%eax
+  201478:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  20147f:	00 
+  201480:	48 8d 05 dd 0c 00 00 	lea    0xcdd(%rip),%rax        # 202164 <flag_chars+0xf4>
+  201487:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+  20148a:	48 98                	cltq
+  20148c:	48 8d 15 d1 0c 00 00 	lea    0xcd1(%rip),%rdx        # 202164 <flag_chars+0xf4>
+  201493:	48 01 d0             	add    %rdx,%rax
+  201496:	ff e0                	jmp    *%rax
+        {
+        case '0':
+            digit = 0;
+  201498:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+            break;
+  20149f:	eb 58                	jmp    2014f9 <string_to_char+0xd0>
+        case '1':
+            digit = 1;
+  2014a1:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+            break;
+  2014a8:	eb 4f                	jmp    2014f9 <string_to_char+0xd0>
+        case '2':
+            digit = 2;
+  2014aa:	c7 45 fc 02 00 00 00 	movl   $0x2,-0x4(%rbp)
+            break;
+  2014b1:	eb 46                	jmp    2014f9 <string_to_char+0xd0>
+        case '3':
+            digit = 3;
+  2014b3:	c7 45 fc 03 00 00 00 	movl   $0x3,-0x4(%rbp)
+            break;
+  2014ba:	eb 3d                	jmp    2014f9 <string_to_char+0xd0>
+        case '4':
+            digit = 4;
+  2014bc:	c7 45 fc 04 00 00 00 	movl   $0x4,-0x4(%rbp)
+            break;
+  2014c3:	eb 34                	jmp    2014f9 <string_to_char+0xd0>
+        case '5':
+            digit = 5;
+  2014c5:	c7 45 fc 05 00 00 00 	movl   $0x5,-0x4(%rbp)
+            break;
+  2014cc:	eb 2b                	jmp    2014f9 <string_to_char+0xd0>
+        case '6':
+            digit = 6;
+  2014ce:	c7 45 fc 06 00 00 00 	movl   $0x6,-0x4(%rbp)
+            break;
+  2014d5:	eb 22                	jmp    2014f9 <string_to_char+0xd0>
+        case '7':
+            digit = 7;
+  2014d7:	c7 45 fc 07 00 00 00 	movl   $0x7,-0x4(%rbp)
+            break;
+  2014de:	eb 19                	jmp    2014f9 <string_to_char+0xd0>
+        case '8':
+            digit = 8;
+  2014e0:	c7 45 fc 08 00 00 00 	movl   $0x8,-0x4(%rbp)
+            break;
+  2014e7:	eb 10                	jmp    2014f9 <string_to_char+0xd0>
+        case '9':
+            digit = 9;
+  2014e9:	c7 45 fc 09 00 00 00 	movl   $0x9,-0x4(%rbp)
+            break;
+  2014f0:	eb 07                	jmp    2014f9 <string_to_char+0xd0>
+        default:
+            return -1;
+  2014f2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  2014f7:	eb 35                	jmp    20152e <string_to_char+0x105>
+        }
+
+        *dest = *dest * 10 + digit;
+  2014f9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  2014fd:	8b 10                	mov    (%rax),%edx
+  2014ff:	89 d0                	mov    %edx,%eax
+  201501:	c1 e0 02             	shl    $0x2,%eax
+  201504:	01 d0                	add    %edx,%eax
+  201506:	01 c0                	add    %eax,%eax
+  201508:	89 c2                	mov    %eax,%edx
+  20150a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  20150d:	01 c2                	add    %eax,%edx
+  20150f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  201513:	89 10                	mov    %edx,(%rax)
+    for (; *str; str++) {
+  201515:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  20151a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20151e:	0f b6 00             	movzbl (%rax),%eax
+  201521:	84 c0                	test   %al,%al
+  201523:	0f 85 34 ff ff ff    	jne    20145d <string_to_char+0x34>
+    }
+
+    return 0;
+  201529:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  20152e:	c9                   	leave
+  20152f:	c3                   	ret
+
+0000000000201530 <atoi>:
+
+int atoi(const char *str) {
+  201530:	55                   	push   %rbp
+  201531:	48 89 e5             	mov    %rsp,%rbp
+  201534:	48 83 ec 18          	sub    $0x18,%rsp
+  201538:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    if (*str == '\0') return -1;
+  20153c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201540:	0f b6 00             	movzbl (%rax),%eax
+  201543:	84 c0                	test   %al,%al
+  201545:	75 0a                	jne    201551 <atoi+0x21>
+  201547:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  20154c:	e9 d7 00 00 00       	jmp    201628 <atoi+0xf8>
+
+    int n = 0;
+  201551:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    for (; *str; str++) {
+  201558:	e9 b7 00 00 00       	jmp    201614 <atoi+0xe4>
+        int digit = 0;
+  20155d:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+        switch (*str)
+  201564:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201568:	0f b6 00             	movzbl (%rax),%eax
+  20156b:	0f be c0             	movsbl %al,%eax
+  20156e:	83 e8 30             	sub    $0x30,%eax
+  201571:	83 f8 09             	cmp    $0x9,%eax
+  201574:	77 7c                	ja     2015f2 <atoi+0xc2>
+  201576:	89 c0                	mov    %eax,%eax
+  201578:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  20157f:	00 
+  201580:	48 8d 05 05 0c 00 00 	lea    0xc05(%rip),%rax        # 20218c <flag_chars+0x11c>
+  201587:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+  20158a:	48 98                	cltq
+  20158c:	48 8d 15 f9 0b 00 00 	lea    0xbf9(%rip),%rdx        # 20218c <flag_chars+0x11c>
+  201593:	48 01 d0             	add    %rdx,%rax
+  201596:	ff e0                	jmp    *%rax
+        {
+        case '0':
+            digit = 0;
+  201598:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+            break;
+  20159f:	eb 58                	jmp    2015f9 <atoi+0xc9>
+        case '1':
+            digit = 1;
+  2015a1:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+            break;
+  2015a8:	eb 4f                	jmp    2015f9 <atoi+0xc9>
+        case '2':
+            digit = 2;
+  2015aa:	c7 45 f8 02 00 00 00 	movl   $0x2,-0x8(%rbp)
+            break;
+  2015b1:	eb 46                	jmp    2015f9 <atoi+0xc9>
+        case '3':
+            digit = 3;
+  2015b3:	c7 45 f8 03 00 00 00 	movl   $0x3,-0x8(%rbp)
+            break;
+  2015ba:	eb 3d                	jmp    2015f9 <atoi+0xc9>
+        case '4':
+            digit = 4;
+  2015bc:	c7 45 f8 04 00 00 00 	movl   $0x4,-0x8(%rbp)
+            break;
+  2015c3:	eb 34                	jmp    2015f9 <atoi+0xc9>
+        case '5':
+            digit = 5;
+  2015c5:	c7 45 f8 05 00 00 00 	movl   $0x5,-0x8(%rbp)
+            break;
+  2015cc:	eb 2b                	jmp    2015f9 <atoi+0xc9>
+        case '6':
+            digit = 6;
+  2015ce:	c7 45 f8 06 00 00 00 	movl   $0x6,-0x8(%rbp)
+            break;
+  2015d5:	eb 22                	jmp    2015f9 <atoi+0xc9>
+        case '7':
+            digit = 7;
+  2015d7:	c7 45 f8 07 00 00 00 	movl   $0x7,-0x8(%rbp)
+            break;
+  2015de:	eb 19                	jmp    2015f9 <atoi+0xc9>
+        case '8':
+            digit = 8;
+  2015e0:	c7 45 f8 08 00 00 00 	movl   $0x8,-0x8(%rbp)
+            break;
+  2015e7:	eb 10                	jmp    2015f9 <atoi+0xc9>
+        case '9':
+            digit = 9;
+  2015e9:	c7 45 f8 09 00 00 00 	movl   $0x9,-0x8(%rbp)
+            break;
+  2015f0:	eb 07                	jmp    2015f9 <atoi+0xc9>
+        default:
+            return -1;
+  2015f2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  2015f7:	eb 2f                	jmp    201628 <atoi+0xf8>
+        }
+
+        n = n * 10 + digit;
+  2015f9:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  2015fc:	89 d0                	mov    %edx,%eax
+  2015fe:	c1 e0 02             	shl    $0x2,%eax
+  201601:	01 d0                	add    %edx,%eax
+  201603:	01 c0                	add    %eax,%eax
+  201605:	89 c2                	mov    %eax,%edx
+  201607:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  20160a:	01 d0                	add    %edx,%eax
+  20160c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    for (; *str; str++) {
+  20160f:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  201614:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201618:	0f b6 00             	movzbl (%rax),%eax
+  20161b:	84 c0                	test   %al,%al
+  20161d:	0f 85 3a ff ff ff    	jne    20155d <atoi+0x2d>
+    }
+
+    return 0;
+  201623:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  201628:	c9                   	leave
+  201629:	c3                   	ret
+
+000000000020162a <copy_comp>:
+        components[ncomp++] = (comp); \
+    } \
+} while (0)
+
+// Helper to copy a component to dst
+void copy_comp(const char *start, const char *end, char **pdst) {
+  20162a:	55                   	push   %rbp
+  20162b:	48 89 e5             	mov    %rsp,%rbp
+  20162e:	48 83 ec 18          	sub    $0x18,%rsp
+  201632:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  201636:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  20163a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    while (start < end) {
+  20163e:	eb 23                	jmp    201663 <copy_comp+0x39>
+        *(*pdst)++ = *start++;
+  201640:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  201644:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  201648:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  20164c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201650:	48 8b 00             	mov    (%rax),%rax
+  201653:	48 8d 70 01          	lea    0x1(%rax),%rsi
+  201657:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  20165b:	48 89 31             	mov    %rsi,(%rcx)
+  20165e:	0f b6 12             	movzbl (%rdx),%edx
+  201661:	88 10                	mov    %dl,(%rax)
+    while (start < end) {
+  201663:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  201667:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  20166b:	72 d3                	jb     201640 <copy_comp+0x16>
+    }
+}
+  20166d:	90                   	nop
+  20166e:	90                   	nop
+  20166f:	c9                   	leave
+  201670:	c3                   	ret
+
+0000000000201671 <join_path>:
+
+
+void join_path(const char *abs_path, const char *path, char *dst) {
+  201671:	55                   	push   %rbp
+  201672:	48 89 e5             	mov    %rsp,%rbp
+  201675:	48 81 ec 68 02 00 00 	sub    $0x268,%rsp
+  20167c:	48 89 bd a8 fd ff ff 	mov    %rdi,-0x258(%rbp)
+  201683:	48 89 b5 a0 fd ff ff 	mov    %rsi,-0x260(%rbp)
+  20168a:	48 89 95 98 fd ff ff 	mov    %rdx,-0x268(%rbp)
+    // If path is absolute, just copy it to dst (removing duplicate slashes, and trailing slash unless root)
+    if (path[0] == '/') {
+  201691:	48 8b 85 a0 fd ff ff 	mov    -0x260(%rbp),%rax
+  201698:	0f b6 00             	movzbl (%rax),%eax
+  20169b:	3c 2f                	cmp    $0x2f,%al
+  20169d:	0f 85 d6 00 00 00    	jne    201779 <join_path+0x108>
+        const char *src = path;
+  2016a3:	48 8b 85 a0 fd ff ff 	mov    -0x260(%rbp),%rax
+  2016aa:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+        char *d = dst;
+  2016ae:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  2016b5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+        // Always start with a single slash
+        *d++ = '/';
+  2016b9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  2016bd:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  2016c1:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  2016c5:	c6 00 2f             	movb   $0x2f,(%rax)
+        src++;
+  2016c8:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+        int last_was_slash = 1;
+  2016cd:	c7 45 b0 01 00 00 00 	movl   $0x1,-0x50(%rbp)
+        while (*src) {
+  2016d4:	eb 64                	jmp    20173a <join_path+0xc9>
+            if (*src == '/') {
+  2016d6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2016da:	0f b6 00             	movzbl (%rax),%eax
+  2016dd:	3c 2f                	cmp    $0x2f,%al
+  2016df:	75 35                	jne    201716 <join_path+0xa5>
+                // Skip consecutive slashes
+                while (*src == '/') src++;
+  2016e1:	eb 05                	jmp    2016e8 <join_path+0x77>
+  2016e3:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  2016e8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2016ec:	0f b6 00             	movzbl (%rax),%eax
+  2016ef:	3c 2f                	cmp    $0x2f,%al
+  2016f1:	74 f0                	je     2016e3 <join_path+0x72>
+                if (*src == 0) break;
+  2016f3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  2016f7:	0f b6 00             	movzbl (%rax),%eax
+  2016fa:	84 c0                	test   %al,%al
+  2016fc:	74 49                	je     201747 <join_path+0xd6>
+                *d++ = '/';
+  2016fe:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  201702:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  201706:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  20170a:	c6 00 2f             	movb   $0x2f,(%rax)
+                last_was_slash = 1;
+  20170d:	c7 45 b0 01 00 00 00 	movl   $0x1,-0x50(%rbp)
+  201714:	eb 24                	jmp    20173a <join_path+0xc9>
+            } else {
+                *d++ = *src++;
+  201716:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  20171a:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  20171e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  201722:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  201726:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  20172a:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  20172e:	0f b6 12             	movzbl (%rdx),%edx
+  201731:	88 10                	mov    %dl,(%rax)
+                last_was_slash = 0;
+  201733:	c7 45 b0 00 00 00 00 	movl   $0x0,-0x50(%rbp)
+        while (*src) {
+  20173a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  20173e:	0f b6 00             	movzbl (%rax),%eax
+  201741:	84 c0                	test   %al,%al
+  201743:	75 91                	jne    2016d6 <join_path+0x65>
+  201745:	eb 01                	jmp    201748 <join_path+0xd7>
+                if (*src == 0) break;
+  201747:	90                   	nop
+            }
+        }
+        // Remove trailing slash unless the path is just "/"
+        if (d > dst + 1 && *(d-1) == '/') {
+  201748:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  20174f:	48 83 c0 01          	add    $0x1,%rax
+  201753:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  201757:	73 14                	jae    20176d <join_path+0xfc>
+  201759:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  20175d:	48 83 e8 01          	sub    $0x1,%rax
+  201761:	0f b6 00             	movzbl (%rax),%eax
+  201764:	3c 2f                	cmp    $0x2f,%al
+  201766:	75 05                	jne    20176d <join_path+0xfc>
+            d--;
+  201768:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+        }
+        *d = 0;
+  20176d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  201771:	c6 00 00             	movb   $0x0,(%rax)
+  201774:	e9 e9 02 00 00       	jmp    201a62 <join_path+0x3f1>
+        return;
+    }
+
+    // Otherwise, start with abs_path
+    const char *src = abs_path;
+  201779:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  201780:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    char *d = dst;
+  201784:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  20178b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    if (*src != '/') {
+  20178f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201793:	0f b6 00             	movzbl (%rax),%eax
+  201796:	3c 2f                	cmp    $0x2f,%al
+  201798:	74 2e                	je     2017c8 <join_path+0x157>
+        *d++ = '/';
+  20179a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  20179e:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  2017a2:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  2017a6:	c6 00 2f             	movb   $0x2f,(%rax)
+    }
+    while (*src) {
+  2017a9:	eb 1d                	jmp    2017c8 <join_path+0x157>
+        *d++ = *src++;
+  2017ab:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  2017af:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  2017b3:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  2017b7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  2017bb:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  2017bf:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  2017c3:	0f b6 12             	movzbl (%rdx),%edx
+  2017c6:	88 10                	mov    %dl,(%rax)
+    while (*src) {
+  2017c8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2017cc:	0f b6 00             	movzbl (%rax),%eax
+  2017cf:	84 c0                	test   %al,%al
+  2017d1:	75 d8                	jne    2017ab <join_path+0x13a>
+    }
+    // Remove trailing slash (unless root)
+    if (d > dst + 1 && *(d-1) == '/') {
+  2017d3:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  2017da:	48 83 c0 01          	add    $0x1,%rax
+  2017de:	48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+  2017e2:	73 14                	jae    2017f8 <join_path+0x187>
+  2017e4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  2017e8:	48 83 e8 01          	sub    $0x1,%rax
+  2017ec:	0f b6 00             	movzbl (%rax),%eax
+  2017ef:	3c 2f                	cmp    $0x2f,%al
+  2017f1:	75 05                	jne    2017f8 <join_path+0x187>
+        d--;
+  2017f3:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+    }
+    *d = 0;
+  2017f8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  2017fc:	c6 00 00             	movb   $0x0,(%rax)
+
+    // Now, process path components
+    char temp[512];
+    int tlen = 0;
+  2017ff:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    // Copy dst to temp for easier manipulation
+    src = dst;
+  201806:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  20180d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    while (*src && tlen < (int)sizeof(temp)-1) {
+  201811:	eb 22                	jmp    201835 <join_path+0x1c4>
+        temp[tlen++] = *src++;
+  201813:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201817:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  20181b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  20181f:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  201822:	8d 4a 01             	lea    0x1(%rdx),%ecx
+  201825:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  201828:	0f b6 08             	movzbl (%rax),%ecx
+  20182b:	48 63 c2             	movslq %edx,%rax
+  20182e:	88 8c 05 b0 fd ff ff 	mov    %cl,-0x250(%rbp,%rax,1)
+    while (*src && tlen < (int)sizeof(temp)-1) {
+  201835:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201839:	0f b6 00             	movzbl (%rax),%eax
+  20183c:	84 c0                	test   %al,%al
+  20183e:	74 09                	je     201849 <join_path+0x1d8>
+  201840:	81 7d dc fe 01 00 00 	cmpl   $0x1fe,-0x24(%rbp)
+  201847:	7e ca                	jle    201813 <join_path+0x1a2>
+    }
+    temp[tlen] = 0;
+  201849:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  20184c:	48 98                	cltq
+  20184e:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  201855:	00 
+
+    // Now, process each component in path
+    src = path;
+  201856:	48 8b 85 a0 fd ff ff 	mov    -0x260(%rbp),%rax
+  20185d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    while (*src) {
+  201861:	e9 65 01 00 00       	jmp    2019cb <join_path+0x35a>
+        // Skip slashes
+        while (*src == '/') src++;
+  201866:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  20186b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20186f:	0f b6 00             	movzbl (%rax),%eax
+  201872:	3c 2f                	cmp    $0x2f,%al
+  201874:	74 f0                	je     201866 <join_path+0x1f5>
+        if (!*src) break;
+  201876:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  20187a:	0f b6 00             	movzbl (%rax),%eax
+  20187d:	84 c0                	test   %al,%al
+  20187f:	0f 84 57 01 00 00    	je     2019dc <join_path+0x36b>
+
+        // Find end of component
+        const char *comp_start = src;
+  201885:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201889:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        while (*src && *src != '/') src++;
+  20188d:	eb 05                	jmp    201894 <join_path+0x223>
+  20188f:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  201894:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  201898:	0f b6 00             	movzbl (%rax),%eax
+  20189b:	84 c0                	test   %al,%al
+  20189d:	74 0b                	je     2018aa <join_path+0x239>
+  20189f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2018a3:	0f b6 00             	movzbl (%rax),%eax
+  2018a6:	3c 2f                	cmp    $0x2f,%al
+  2018a8:	75 e5                	jne    20188f <join_path+0x21e>
+        const char *comp_end = src;
+  2018aa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2018ae:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+
+        int comp_len = comp_end - comp_start;
+  2018b2:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  2018b6:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  2018ba:	89 45 b4             	mov    %eax,-0x4c(%rbp)
+
+        // Get component string
+        if (comp_len == 1 && comp_start[0] == '.') {
+  2018bd:	83 7d b4 01          	cmpl   $0x1,-0x4c(%rbp)
+  2018c1:	75 10                	jne    2018d3 <join_path+0x262>
+  2018c3:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  2018c7:	0f b6 00             	movzbl (%rax),%eax
+  2018ca:	3c 2e                	cmp    $0x2e,%al
+  2018cc:	75 05                	jne    2018d3 <join_path+0x262>
+            // Ignore
+            continue;
+  2018ce:	e9 f8 00 00 00       	jmp    2019cb <join_path+0x35a>
+        } else if (comp_len == 2 && comp_start[0] == '.' && comp_start[1] == '.') {
+  2018d3:	83 7d b4 02          	cmpl   $0x2,-0x4c(%rbp)
+  2018d7:	75 6e                	jne    201947 <join_path+0x2d6>
+  2018d9:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  2018dd:	0f b6 00             	movzbl (%rax),%eax
+  2018e0:	3c 2e                	cmp    $0x2e,%al
+  2018e2:	75 63                	jne    201947 <join_path+0x2d6>
+  2018e4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  2018e8:	48 83 c0 01          	add    $0x1,%rax
+  2018ec:	0f b6 00             	movzbl (%rax),%eax
+  2018ef:	3c 2e                	cmp    $0x2e,%al
+  2018f1:	75 54                	jne    201947 <join_path+0x2d6>
+            // Go up one directory, unless at root
+            if (tlen > 1) {
+  2018f3:	83 7d dc 01          	cmpl   $0x1,-0x24(%rbp)
+  2018f7:	0f 8e ce 00 00 00    	jle    2019cb <join_path+0x35a>
+                // Remove trailing slash if any
+                if (temp[tlen-1] == '/') tlen--;
+  2018fd:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201900:	83 e8 01             	sub    $0x1,%eax
+  201903:	48 98                	cltq
+  201905:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  20190c:	ff 
+  20190d:	3c 2f                	cmp    $0x2f,%al
+  20190f:	75 0a                	jne    20191b <join_path+0x2aa>
+  201911:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+                // Remove last component
+                while (tlen > 1 && temp[tlen-1] != '/') tlen--;
+  201915:	eb 04                	jmp    20191b <join_path+0x2aa>
+  201917:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  20191b:	83 7d dc 01          	cmpl   $0x1,-0x24(%rbp)
+  20191f:	7e 14                	jle    201935 <join_path+0x2c4>
+  201921:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201924:	83 e8 01             	sub    $0x1,%eax
+  201927:	48 98                	cltq
+  201929:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  201930:	ff 
+  201931:	3c 2f                	cmp    $0x2f,%al
+  201933:	75 e2                	jne    201917 <join_path+0x2a6>
+                temp[tlen] = 0;
+  201935:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201938:	48 98                	cltq
+  20193a:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  201941:	00 
+            if (tlen > 1) {
+  201942:	e9 84 00 00 00       	jmp    2019cb <join_path+0x35a>
+            }
+        } else if (comp_len > 0) {
+  201947:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  20194b:	7e 7e                	jle    2019cb <join_path+0x35a>
+            // Add slash if not at root
+            if (tlen == 0 || temp[tlen-1] != '/') {
+  20194d:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  201951:	74 14                	je     201967 <join_path+0x2f6>
+  201953:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201956:	83 e8 01             	sub    $0x1,%eax
+  201959:	48 98                	cltq
+  20195b:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  201962:	ff 
+  201963:	3c 2f                	cmp    $0x2f,%al
+  201965:	74 1c                	je     201983 <join_path+0x312>
+                if (tlen < (int)sizeof(temp)-1) temp[tlen++] = '/';
+  201967:	81 7d dc fe 01 00 00 	cmpl   $0x1fe,-0x24(%rbp)
+  20196e:	7f 13                	jg     201983 <join_path+0x312>
+  201970:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201973:	8d 50 01             	lea    0x1(%rax),%edx
+  201976:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  201979:	48 98                	cltq
+  20197b:	c6 84 05 b0 fd ff ff 	movb   $0x2f,-0x250(%rbp,%rax,1)
+  201982:	2f 
+            }
+            // Copy component
+            for (const char *p = comp_start; p < comp_end && tlen < (int)sizeof(temp)-1; ++p) {
+  201983:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  201987:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  20198b:	eb 1e                	jmp    2019ab <join_path+0x33a>
+                temp[tlen++] = *p;
+  20198d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201990:	8d 50 01             	lea    0x1(%rax),%edx
+  201993:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  201996:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  20199a:	0f b6 12             	movzbl (%rdx),%edx
+  20199d:	48 98                	cltq
+  20199f:	88 94 05 b0 fd ff ff 	mov    %dl,-0x250(%rbp,%rax,1)
+            for (const char *p = comp_start; p < comp_end && tlen < (int)sizeof(temp)-1; ++p) {
+  2019a6:	48 83 45 d0 01       	addq   $0x1,-0x30(%rbp)
+  2019ab:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  2019af:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  2019b3:	73 09                	jae    2019be <join_path+0x34d>
+  2019b5:	81 7d dc fe 01 00 00 	cmpl   $0x1fe,-0x24(%rbp)
+  2019bc:	7e cf                	jle    20198d <join_path+0x31c>
+            }
+            temp[tlen] = 0;
+  2019be:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  2019c1:	48 98                	cltq
+  2019c3:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  2019ca:	00 
+    while (*src) {
+  2019cb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  2019cf:	0f b6 00             	movzbl (%rax),%eax
+  2019d2:	84 c0                	test   %al,%al
+  2019d4:	0f 85 91 fe ff ff    	jne    20186b <join_path+0x1fa>
+  2019da:	eb 01                	jmp    2019dd <join_path+0x36c>
+        if (!*src) break;
+  2019dc:	90                   	nop
+        }
+    }
+
+    // If temp is empty, set to "/"
+    if (tlen == 0) {
+  2019dd:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  2019e1:	75 20                	jne    201a03 <join_path+0x392>
+        temp[tlen++] = '/';
+  2019e3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  2019e6:	8d 50 01             	lea    0x1(%rax),%edx
+  2019e9:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  2019ec:	48 98                	cltq
+  2019ee:	c6 84 05 b0 fd ff ff 	movb   $0x2f,-0x250(%rbp,%rax,1)
+  2019f5:	2f 
+        temp[tlen] = 0;
+  2019f6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  2019f9:	48 98                	cltq
+  2019fb:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  201a02:	00 
+    }
+
+    // Remove trailing slash unless the path is just "/"
+    if (tlen > 1 && temp[tlen-1] == '/') {
+  201a03:	83 7d dc 01          	cmpl   $0x1,-0x24(%rbp)
+  201a07:	7e 25                	jle    201a2e <join_path+0x3bd>
+  201a09:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201a0c:	83 e8 01             	sub    $0x1,%eax
+  201a0f:	48 98                	cltq
+  201a11:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  201a18:	ff 
+  201a19:	3c 2f                	cmp    $0x2f,%al
+  201a1b:	75 11                	jne    201a2e <join_path+0x3bd>
+        temp[--tlen] = 0;
+  201a1d:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  201a21:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  201a24:	48 98                	cltq
+  201a26:	c6 84 05 b0 fd ff ff 	movb   $0x0,-0x250(%rbp,%rax,1)
+  201a2d:	00 
+    }
+
+    // Copy temp to dst
+    for (int i = 0; i <= tlen; ++i) {
+  201a2e:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  201a35:	eb 23                	jmp    201a5a <join_path+0x3e9>
+        dst[i] = temp[i];
+  201a37:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  201a3a:	48 63 d0             	movslq %eax,%rdx
+  201a3d:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+  201a44:	48 01 c2             	add    %rax,%rdx
+  201a47:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  201a4a:	48 98                	cltq
+  201a4c:	0f b6 84 05 b0 fd ff 	movzbl -0x250(%rbp,%rax,1),%eax
+  201a53:	ff 
+  201a54:	88 02                	mov    %al,(%rdx)
+    for (int i = 0; i <= tlen; ++i) {
+  201a56:	83 45 cc 01          	addl   $0x1,-0x34(%rbp)
+  201a5a:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  201a5d:	3b 45 dc             	cmp    -0x24(%rbp),%eax
+  201a60:	7e d5                	jle    201a37 <join_path+0x3c6>
+    }
+}
+  201a62:	c9                   	leave
+  201a63:	c3                   	ret
+
+0000000000201a64 <app_printf>:
+#include "lib-malloc.h"
+#include "errno.h"
+// app_printf
+//     A version of console_printf that picks a sensible color by process ID.
+
+void app_printf(int colorid, const char* format, ...) {
+  201a64:	55                   	push   %rbp
+  201a65:	48 89 e5             	mov    %rsp,%rbp
+  201a68:	48 83 ec 50          	sub    $0x50,%rsp
+  201a6c:	49 89 f2             	mov    %rsi,%r10
+  201a6f:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  201a73:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  201a77:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  201a7b:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    int color;
+    if (colorid < 0) {
+        color = 0x0700;
+  201a7f:	be 00 07 00 00       	mov    $0x700,%esi
+    if (colorid < 0) {
+  201a84:	85 ff                	test   %edi,%edi
+  201a86:	78 32                	js     201aba <app_printf+0x56>
+    } else {
+        static const uint8_t col[] = { 0x0F, 0x0C, 0x0A, 0x09, 0x0E };
+        color = col[colorid % sizeof(col)] << 8;
+  201a88:	48 63 ff             	movslq %edi,%rdi
+  201a8b:	48 ba cd cc cc cc cc 	movabs $0xcccccccccccccccd,%rdx
+  201a92:	cc cc cc 
+  201a95:	48 89 f8             	mov    %rdi,%rax
+  201a98:	48 f7 e2             	mul    %rdx
+  201a9b:	48 89 d0             	mov    %rdx,%rax
+  201a9e:	48 c1 e8 02          	shr    $0x2,%rax
+  201aa2:	48 83 e2 fc          	and    $0xfffffffffffffffc,%rdx
+  201aa6:	48 01 c2             	add    %rax,%rdx
+  201aa9:	48 29 d7             	sub    %rdx,%rdi
+  201aac:	48 8d 05 05 09 00 00 	lea    0x905(%rip),%rax        # 2023b8 <col.0>
+  201ab3:	0f b6 34 38          	movzbl (%rax,%rdi,1),%esi
+  201ab7:	c1 e6 08             	shl    $0x8,%esi
+    }
+
+    va_list val;
+    va_start(val, format);
+  201aba:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  201ac1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  201ac5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  201ac9:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  201acd:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    cursorpos = console_vprintf(cursorpos, color, format, val);
+  201ad1:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  201ad5:	4c 89 d2             	mov    %r10,%rdx
+  201ad8:	8b 3d 1e 75 eb ff    	mov    -0x148ae2(%rip),%edi        # b8ffc <cursorpos>
+  201ade:	e8 24 f7 ff ff       	call   201207 <console_vprintf>
+  201ae3:	89 05 13 75 eb ff    	mov    %eax,-0x148aed(%rip)        # b8ffc <cursorpos>
+    va_end(val);
+
+    /*if (CROW(cursorpos) >= 23) {
+        cursorpos = CPOS(0, 0);
+    }*/
+}
+  201ae9:	c9                   	leave
+  201aea:	c3                   	ret
+
+0000000000201aeb <panic>:
+
+
+// panic, assert_fail
+//     Call the INT_SYS_PANIC system call so the kernel loops until Control-C.
+
+void panic(const char* format, ...) {
+  201aeb:	55                   	push   %rbp
+  201aec:	48 89 e5             	mov    %rsp,%rbp
+  201aef:	53                   	push   %rbx
+  201af0:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  201af7:	48 89 fb             	mov    %rdi,%rbx
+  201afa:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  201afe:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  201b02:	48 89 4d d8          	mov    %rcx,-0x28(%rbp)
+  201b06:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  201b0a:	4c 89 4d e8          	mov    %r9,-0x18(%rbp)
+    va_list val;
+    va_start(val, format);
+  201b0e:	c7 45 a8 08 00 00 00 	movl   $0x8,-0x58(%rbp)
+  201b15:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  201b19:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  201b1d:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  201b21:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    char buf[160];
+    memcpy(buf, "PANIC: ", 7);
+  201b25:	48 8d bd 08 ff ff ff 	lea    -0xf8(%rbp),%rdi
+  201b2c:	ba 07 00 00 00       	mov    $0x7,%edx
+  201b31:	48 8d 35 b9 06 00 00 	lea    0x6b9(%rip),%rsi        # 2021f1 <lower_digits.0+0x11>
+  201b38:	e8 31 e5 ff ff       	call   20006e <memcpy>
+    int len = vsnprintf(&buf[7], sizeof(buf) - 7, format, val) + 7;
+  201b3d:	48 8d 4d a8          	lea    -0x58(%rbp),%rcx
+  201b41:	48 8d bd 0f ff ff ff 	lea    -0xf1(%rbp),%rdi
+  201b48:	48 89 da             	mov    %rbx,%rdx
+  201b4b:	be 99 00 00 00       	mov    $0x99,%esi
+  201b50:	e8 cd f7 ff ff       	call   201322 <vsnprintf>
+  201b55:	8d 50 07             	lea    0x7(%rax),%edx
+    va_end(val);
+    if (len > 0 && buf[len - 1] != '\n') {
+  201b58:	85 d2                	test   %edx,%edx
+  201b5a:	7e 0f                	jle    201b6b <panic+0x80>
+  201b5c:	83 c0 06             	add    $0x6,%eax
+  201b5f:	48 98                	cltq
+  201b61:	80 bc 05 08 ff ff ff 	cmpb   $0xa,-0xf8(%rbp,%rax,1)
+  201b68:	0a 
+  201b69:	75 30                	jne    201b9b <panic+0xb0>
+        strcpy(buf + len - (len == (int) sizeof(buf) - 1), "\n");
+    }
+    (void) console_printf(CPOS(23, 0), 0xC000, "%s", buf);
+  201b6b:	48 8d 8d 08 ff ff ff 	lea    -0xf8(%rbp),%rcx
+  201b72:	48 8d 15 c7 04 00 00 	lea    0x4c7(%rip),%rdx        # 202040 <malloc+0x8d>
+  201b79:	be 00 c0 00 00       	mov    $0xc000,%esi
+  201b7e:	bf 30 07 00 00       	mov    $0x730,%edi
+  201b83:	b8 00 00 00 00       	mov    $0x0,%eax
+  201b88:	e8 f5 f6 ff ff       	call   201282 <console_printf>
+    asm volatile ("syscall" : "=a" (rax)
+  201b8d:	b8 30 00 00 00       	mov    $0x30,%eax
+  201b92:	bf 00 00 00 00       	mov    $0x0,%edi
+  201b97:	0f 05                	syscall
+ loop: goto loop;
+  201b99:	eb fe                	jmp    201b99 <panic+0xae>
+        strcpy(buf + len - (len == (int) sizeof(buf) - 1), "\n");
+  201b9b:	48 63 c2             	movslq %edx,%rax
+  201b9e:	81 fa 9f 00 00 00    	cmp    $0x9f,%edx
+  201ba4:	0f 94 c2             	sete   %dl
+  201ba7:	0f b6 d2             	movzbl %dl,%edx
+  201baa:	48 29 d0             	sub    %rdx,%rax
+  201bad:	48 8d bc 05 08 ff ff 	lea    -0xf8(%rbp,%rax,1),%rdi
+  201bb4:	ff 
+  201bb5:	48 8d 35 15 07 00 00 	lea    0x715(%rip),%rsi        # 2022d1 <lower_digits.0+0xf1>
+  201bbc:	e8 3b e8 ff ff       	call   2003fc <strcpy>
+  201bc1:	eb a8                	jmp    201b6b <panic+0x80>
+
+0000000000201bc3 <raise>:
+
+#define SIGABRT -1
+
+
+
+int raise(int sig) {
+  201bc3:	89 fe                	mov    %edi,%esi
+
+// getpid()
+//    Return current process ID, like sys_getpid().
+static inline pid_t getpid(void) {
+    return vdso()->pid;
+  201bc5:	8b 3c 25 00 10 24 00 	mov    0x241000,%edi
+    asm volatile ("syscall" : "=a" (result)
+  201bcc:	b8 41 00 00 00       	mov    $0x41,%eax
+  201bd1:	0f 05                	syscall
+    return sys_kill(getpid(), sig);
+}
+  201bd3:	c3                   	ret
+
+0000000000201bd4 <abort>:
+    return vdso()->pid;
+  201bd4:	8b 3c 25 00 10 24 00 	mov    0x241000,%edi
+    asm volatile ("syscall" : "=a" (result)
+  201bdb:	b8 41 00 00 00       	mov    $0x41,%eax
+  201be0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  201be5:	0f 05                	syscall
+
+void __attribute((noreturn)) abort(void) {
+    raise(SIGABRT);
+ spinloop: goto spinloop;       // should never get here
+  201be7:	eb fe                	jmp    201be7 <abort+0x13>
+
+0000000000201be9 <assert_fail>:
+}
+
+
+void assert_fail(const char* file, int line, const char* msg) {
+  201be9:	55                   	push   %rbp
+  201bea:	48 89 e5             	mov    %rsp,%rbp
+  201bed:	48 89 f9             	mov    %rdi,%rcx
+  201bf0:	41 89 f0             	mov    %esi,%r8d
+  201bf3:	49 89 d1             	mov    %rdx,%r9
+    (void) console_printf(CPOS(23, 0), 0xC000,
+  201bf6:	48 8d 15 db 06 00 00 	lea    0x6db(%rip),%rdx        # 2022d8 <lower_digits.0+0xf8>
+  201bfd:	be 00 c0 00 00       	mov    $0xc000,%esi
+  201c02:	bf 30 07 00 00       	mov    $0x730,%edi
+  201c07:	b8 00 00 00 00       	mov    $0x0,%eax
+  201c0c:	e8 71 f6 ff ff       	call   201282 <console_printf>
+                          "PANIC: %s:%d: assertion '%s' failed\n",
+                          file, line, msg);
+    abort();
+  201c11:	e8 be ff ff ff       	call   201bd4 <abort>
+
+0000000000201c16 <scan_char>:
+    asm volatile ("syscall" : "=a" (result)
+  201c16:	bf 3a 00 00 00       	mov    $0x3a,%edi
+    asm volatile ("syscall" : "=a" (rax)
+  201c1b:	be 3c 00 00 00       	mov    $0x3c,%esi
+    asm volatile ("syscall" : "=a" (result)
+  201c20:	89 f8                	mov    %edi,%eax
+  201c22:	0f 05                	syscall
+  201c24:	89 c2                	mov    %eax,%edx
+    asm volatile ("syscall" : "=a" (rax)
+  201c26:	89 f0                	mov    %esi,%eax
+  201c28:	0f 05                	syscall
+    int c;
+
+    do {
+        c = sys_keybord();
+        sys_yield();
+    } while (c == -1);
+  201c2a:	83 fa ff             	cmp    $0xffffffff,%edx
+  201c2d:	74 f1                	je     201c20 <scan_char+0xa>
+
+    return c;
+  201c2f:	89 d0                	mov    %edx,%eax
+}
+  201c31:	c3                   	ret
+
+0000000000201c32 <scan_line>:
+
+unsigned int scan_line(char* dst, unsigned int length_max) {
+  201c32:	55                   	push   %rbp
+  201c33:	48 89 e5             	mov    %rsp,%rbp
+  201c36:	41 57                	push   %r15
+  201c38:	41 56                	push   %r14
+  201c3a:	41 55                	push   %r13
+  201c3c:	41 54                	push   %r12
+  201c3e:	53                   	push   %rbx
+  201c3f:	48 83 ec 08          	sub    $0x8,%rsp
+  201c43:	49 89 fe             	mov    %rdi,%r14
+  201c46:	41 89 f5             	mov    %esi,%r13d
+    unsigned int length = 0;
+  201c49:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            app_printf(0, "%c", c);
+            dst[length] = '\0';
+            return length;
+        } else if (c >= 32 && c <= 127) {
+            if (length < length_max) {
+                app_printf(0, "%c", c);
+  201c4f:	4c 8d 3d a3 05 00 00 	lea    0x5a3(%rip),%r15        # 2021f9 <lower_digits.0+0x19>
+  201c56:	eb 05                	jmp    201c5d <scan_line+0x2b>
+            if (length != 0) {
+  201c58:	45 85 e4             	test   %r12d,%r12d
+  201c5b:	75 3e                	jne    201c9b <scan_line+0x69>
+        unsigned char c = scan_char();
+  201c5d:	e8 b4 ff ff ff       	call   201c16 <scan_char>
+  201c62:	89 c3                	mov    %eax,%ebx
+        if (c == '\b') {
+  201c64:	3c 08                	cmp    $0x8,%al
+  201c66:	74 f0                	je     201c58 <scan_line+0x26>
+        } else if (c == '\n') {
+  201c68:	3c 0a                	cmp    $0xa,%al
+  201c6a:	74 4c                	je     201cb8 <scan_line+0x86>
+        } else if (c >= 32 && c <= 127) {
+  201c6c:	8d 43 e0             	lea    -0x20(%rbx),%eax
+            if (length < length_max) {
+  201c6f:	3c 5f                	cmp    $0x5f,%al
+  201c71:	77 ea                	ja     201c5d <scan_line+0x2b>
+  201c73:	45 39 ec             	cmp    %r13d,%r12d
+  201c76:	73 e5                	jae    201c5d <scan_line+0x2b>
+                app_printf(0, "%c", c);
+  201c78:	0f b6 d3             	movzbl %bl,%edx
+  201c7b:	4c 89 fe             	mov    %r15,%rsi
+  201c7e:	bf 00 00 00 00       	mov    $0x0,%edi
+  201c83:	b8 00 00 00 00       	mov    $0x0,%eax
+  201c88:	e8 d7 fd ff ff       	call   201a64 <app_printf>
+                dst[length++] = c;
+  201c8d:	44 89 e0             	mov    %r12d,%eax
+  201c90:	41 88 1c 06          	mov    %bl,(%r14,%rax,1)
+  201c94:	45 8d 64 24 01       	lea    0x1(%r12),%r12d
+  201c99:	eb c2                	jmp    201c5d <scan_line+0x2b>
+                app_printf(0, "%c", c);
+  201c9b:	ba 08 00 00 00       	mov    $0x8,%edx
+  201ca0:	4c 89 fe             	mov    %r15,%rsi
+  201ca3:	bf 00 00 00 00       	mov    $0x0,%edi
+  201ca8:	b8 00 00 00 00       	mov    $0x0,%eax
+  201cad:	e8 b2 fd ff ff       	call   201a64 <app_printf>
+                length--;
+  201cb2:	41 83 ec 01          	sub    $0x1,%r12d
+  201cb6:	eb a5                	jmp    201c5d <scan_line+0x2b>
+            app_printf(0, "%c", c);
+  201cb8:	ba 0a 00 00 00       	mov    $0xa,%edx
+  201cbd:	48 8d 35 35 05 00 00 	lea    0x535(%rip),%rsi        # 2021f9 <lower_digits.0+0x19>
+  201cc4:	bf 00 00 00 00       	mov    $0x0,%edi
+  201cc9:	b8 00 00 00 00       	mov    $0x0,%eax
+  201cce:	e8 91 fd ff ff       	call   201a64 <app_printf>
+            dst[length] = '\0';
+  201cd3:	44 89 e0             	mov    %r12d,%eax
+  201cd6:	41 c6 04 06 00       	movb   $0x0,(%r14,%rax,1)
+            }
+        }
+    }
+}
+  201cdb:	44 89 e0             	mov    %r12d,%eax
+  201cde:	48 83 c4 08          	add    $0x8,%rsp
+  201ce2:	5b                   	pop    %rbx
+  201ce3:	41 5c                	pop    %r12
+  201ce5:	41 5d                	pop    %r13
+  201ce7:	41 5e                	pop    %r14
+  201ce9:	41 5f                	pop    %r15
+  201ceb:	5d                   	pop    %rbp
+  201cec:	c3                   	ret
+
+0000000000201ced <split_string>:
+
+
+char** split_string(char* str, char sep) {
+  201ced:	55                   	push   %rbp
+  201cee:	48 89 e5             	mov    %rsp,%rbp
+  201cf1:	41 57                	push   %r15
+  201cf3:	41 56                	push   %r14
+  201cf5:	41 55                	push   %r13
+  201cf7:	41 54                	push   %r12
+  201cf9:	53                   	push   %rbx
+  201cfa:	48 83 ec 08          	sub    $0x8,%rsp
+    int s = 1;
+    int n = 0;
+
+    while (str[n]) {
+  201cfe:	0f b6 07             	movzbl (%rdi),%eax
+  201d01:	84 c0                	test   %al,%al
+  201d03:	0f 84 ad 00 00 00    	je     201db6 <split_string+0xc9>
+  201d09:	48 89 fb             	mov    %rdi,%rbx
+  201d0c:	41 89 f4             	mov    %esi,%r12d
+  201d0f:	41 be 01 00 00 00    	mov    $0x1,%r14d
+    int s = 1;
+  201d15:	b9 01 00 00 00       	mov    $0x1,%ecx
+  201d1a:	eb 03                	jmp    201d1f <split_string+0x32>
+  201d1c:	49 89 d6             	mov    %rdx,%r14
+        if (str[n] == sep)
+            s++;
+  201d1f:	41 38 c4             	cmp    %al,%r12b
+  201d22:	0f 94 c0             	sete   %al
+  201d25:	0f b6 c0             	movzbl %al,%eax
+  201d28:	01 c1                	add    %eax,%ecx
+    while (str[n]) {
+  201d2a:	49 8d 56 01          	lea    0x1(%r14),%rdx
+  201d2e:	0f b6 44 13 ff       	movzbl -0x1(%rbx,%rdx,1),%eax
+  201d33:	84 c0                	test   %al,%al
+  201d35:	75 e5                	jne    201d1c <split_string+0x2f>
+        n++;
+    }
+    
+    char** part = malloc((s+1)*sizeof(char*));
+  201d37:	44 8d 79 01          	lea    0x1(%rcx),%r15d
+  201d3b:	4d 63 ff             	movslq %r15d,%r15
+  201d3e:	49 c1 e7 03          	shl    $0x3,%r15
+  201d42:	4c 89 ff             	mov    %r15,%rdi
+  201d45:	e8 69 02 00 00       	call   201fb3 <malloc>
+  201d4a:	49 89 c5             	mov    %rax,%r13
+    char* buffer = malloc(n+1);
+  201d4d:	41 8d 7e 01          	lea    0x1(%r14),%edi
+  201d51:	48 63 ff             	movslq %edi,%rdi
+  201d54:	e8 5a 02 00 00       	call   201fb3 <malloc>
+
+    int word_n = 0;
+    part[0] = buffer;
+  201d59:	49 89 45 00          	mov    %rax,0x0(%r13)
+    part[s] = NULL;
+  201d5d:	4b c7 44 3d f8 00 00 	movq   $0x0,-0x8(%r13,%r15,1)
+  201d64:	00 00 
+    buffer[n] = 0;
+  201d66:	42 c6 04 30 00       	movb   $0x0,(%rax,%r14,1)
+
+    for (int i = 0; i < n; i++) {
+  201d6b:	45 85 f6             	test   %r14d,%r14d
+  201d6e:	7e 6c                	jle    201ddc <split_string+0xef>
+  201d70:	41 83 ee 01          	sub    $0x1,%r14d
+  201d74:	48 89 da             	mov    %rbx,%rdx
+  201d77:	48 83 c0 01          	add    $0x1,%rax
+  201d7b:	48 89 c1             	mov    %rax,%rcx
+    int word_n = 0;
+  201d7e:	bf 00 00 00 00       	mov    $0x0,%edi
+  201d83:	eb 23                	jmp    201da8 <split_string+0xbb>
+        if (str[i] == sep) {
+            buffer[i] = 0;
+  201d85:	c6 41 ff 00          	movb   $0x0,-0x1(%rcx)
+            part[++word_n] = &buffer[i+1];
+  201d89:	83 c7 01             	add    $0x1,%edi
+  201d8c:	48 63 f7             	movslq %edi,%rsi
+  201d8f:	49 89 4c f5 00       	mov    %rcx,0x0(%r13,%rsi,8)
+    for (int i = 0; i < n; i++) {
+  201d94:	48 83 c2 01          	add    $0x1,%rdx
+  201d98:	48 83 c1 01          	add    $0x1,%rcx
+  201d9c:	89 ce                	mov    %ecx,%esi
+  201d9e:	29 c6                	sub    %eax,%esi
+  201da0:	83 ee 01             	sub    $0x1,%esi
+  201da3:	44 39 f6             	cmp    %r14d,%esi
+  201da6:	7d 34                	jge    201ddc <split_string+0xef>
+        if (str[i] == sep) {
+  201da8:	0f b6 32             	movzbl (%rdx),%esi
+  201dab:	44 38 e6             	cmp    %r12b,%sil
+  201dae:	74 d5                	je     201d85 <split_string+0x98>
+        } else {
+            buffer[i] = str[i];
+  201db0:	40 88 71 ff          	mov    %sil,-0x1(%rcx)
+  201db4:	eb de                	jmp    201d94 <split_string+0xa7>
+    char** part = malloc((s+1)*sizeof(char*));
+  201db6:	bf 10 00 00 00       	mov    $0x10,%edi
+  201dbb:	e8 f3 01 00 00       	call   201fb3 <malloc>
+  201dc0:	49 89 c5             	mov    %rax,%r13
+    char* buffer = malloc(n+1);
+  201dc3:	bf 01 00 00 00       	mov    $0x1,%edi
+  201dc8:	e8 e6 01 00 00       	call   201fb3 <malloc>
+    part[0] = buffer;
+  201dcd:	49 89 45 00          	mov    %rax,0x0(%r13)
+    part[s] = NULL;
+  201dd1:	49 c7 45 08 00 00 00 	movq   $0x0,0x8(%r13)
+  201dd8:	00 
+    buffer[n] = 0;
+  201dd9:	c6 00 00             	movb   $0x0,(%rax)
+        }
+    }
+
+    return part;
+}
+  201ddc:	4c 89 e8             	mov    %r13,%rax
+  201ddf:	48 83 c4 08          	add    $0x8,%rsp
+  201de3:	5b                   	pop    %rbx
+  201de4:	41 5c                	pop    %r12
+  201de6:	41 5d                	pop    %r13
+  201de8:	41 5e                	pop    %r14
+  201dea:	41 5f                	pop    %r15
+  201dec:	5d                   	pop    %rbp
+  201ded:	c3                   	ret
+
+0000000000201dee <app_print_error>:
+
+
+void app_print_error(int r) {
+  201dee:	55                   	push   %rbp
+  201def:	48 89 e5             	mov    %rsp,%rbp
+    switch (r) {
+  201df2:	83 ff 24             	cmp    $0x24,%edi
+  201df5:	0f 87 79 01 00 00    	ja     201f74 <app_print_error+0x186>
+  201dfb:	89 f8                	mov    %edi,%eax
+  201dfd:	48 8d 15 20 05 00 00 	lea    0x520(%rip),%rdx        # 202324 <lower_digits.0+0x144>
+  201e04:	48 63 04 82          	movslq (%rdx,%rax,4),%rax
+  201e08:	48 01 d0             	add    %rdx,%rax
+  201e0b:	ff e0                	jmp    *%rax
+        case ENOENT:
+            app_printf(1, "Error: %s\n", "No such file or directory");
+  201e0d:	48 8d 15 e8 03 00 00 	lea    0x3e8(%rip),%rdx        # 2021fc <lower_digits.0+0x1c>
+  201e14:	48 8d 35 fb 03 00 00 	lea    0x3fb(%rip),%rsi        # 202216 <lower_digits.0+0x36>
+  201e1b:	bf 01 00 00 00       	mov    $0x1,%edi
+  201e20:	b8 00 00 00 00       	mov    $0x0,%eax
+  201e25:	e8 3a fc ff ff       	call   201a64 <app_printf>
+            break;
+        default:
+            app_printf(1, "Error %d: %s\n", r, "Unknown error");
+            break;
+    }
+}
+  201e2a:	5d                   	pop    %rbp
+  201e2b:	c3                   	ret
+            app_printf(1, "Error: %s\n", "I/O error");
+  201e2c:	48 8d 15 ee 03 00 00 	lea    0x3ee(%rip),%rdx        # 202221 <lower_digits.0+0x41>
+  201e33:	48 8d 35 dc 03 00 00 	lea    0x3dc(%rip),%rsi        # 202216 <lower_digits.0+0x36>
+  201e3a:	bf 01 00 00 00       	mov    $0x1,%edi
+  201e3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  201e44:	e8 1b fc ff ff       	call   201a64 <app_printf>
+            break;
+  201e49:	eb df                	jmp    201e2a <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Exec format error");
+  201e4b:	48 8d 15 d9 03 00 00 	lea    0x3d9(%rip),%rdx        # 20222b <lower_digits.0+0x4b>
+  201e52:	48 8d 35 bd 03 00 00 	lea    0x3bd(%rip),%rsi        # 202216 <lower_digits.0+0x36>
+  201e59:	bf 01 00 00 00       	mov    $0x1,%edi
+  201e5e:	b8 00 00 00 00       	mov    $0x0,%eax
+  201e63:	e8 fc fb ff ff       	call   201a64 <app_printf>
+            break;
+  201e68:	eb c0                	jmp    201e2a <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Resource temporarily unavailable");
+  201e6a:	48 8d 15 8f 04 00 00 	lea    0x48f(%rip),%rdx        # 202300 <lower_digits.0+0x120>
+  201e71:	48 8d 35 9e 03 00 00 	lea    0x39e(%rip),%rsi        # 202216 <lower_digits.0+0x36>
+  201e78:	bf 01 00 00 00       	mov    $0x1,%edi
+  201e7d:	b8 00 00 00 00       	mov    $0x0,%eax
+  201e82:	e8 dd fb ff ff       	call   201a64 <app_printf>
+            break;
+  201e87:	eb a1                	jmp    201e2a <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Out of memory");
+  201e89:	48 8d 15 ad 03 00 00 	lea    0x3ad(%rip),%rdx        # 20223d <lower_digits.0+0x5d>
+  201e90:	48 8d 35 7f 03 00 00 	lea    0x37f(%rip),%rsi        # 202216 <lower_digits.0+0x36>
+  201e97:	bf 01 00 00 00       	mov    $0x1,%edi
+  201e9c:	b8 00 00 00 00       	mov    $0x0,%eax
+  201ea1:	e8 be fb ff ff       	call   201a64 <app_printf>
+            break;
+  201ea6:	eb 82                	jmp    201e2a <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Bad address");
+  201ea8:	48 8d 15 9c 03 00 00 	lea    0x39c(%rip),%rdx        # 20224b <lower_digits.0+0x6b>
+  201eaf:	48 8d 35 60 03 00 00 	lea    0x360(%rip),%rsi        # 202216 <lower_digits.0+0x36>
+  201eb6:	bf 01 00 00 00       	mov    $0x1,%edi
+  201ebb:	b8 00 00 00 00       	mov    $0x0,%eax
+  201ec0:	e8 9f fb ff ff       	call   201a64 <app_printf>
+            break;
+  201ec5:	e9 60 ff ff ff       	jmp    201e2a <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Not a directory");
+  201eca:	48 8d 15 86 03 00 00 	lea    0x386(%rip),%rdx        # 202257 <lower_digits.0+0x77>
+  201ed1:	48 8d 35 3e 03 00 00 	lea    0x33e(%rip),%rsi        # 202216 <lower_digits.0+0x36>
+  201ed8:	bf 01 00 00 00       	mov    $0x1,%edi
+  201edd:	b8 00 00 00 00       	mov    $0x0,%eax
+  201ee2:	e8 7d fb ff ff       	call   201a64 <app_printf>
+            break;
+  201ee7:	e9 3e ff ff ff       	jmp    201e2a <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "Invalid argument");
+  201eec:	48 8d 15 74 03 00 00 	lea    0x374(%rip),%rdx        # 202267 <lower_digits.0+0x87>
+  201ef3:	48 8d 35 1c 03 00 00 	lea    0x31c(%rip),%rsi        # 202216 <lower_digits.0+0x36>
+  201efa:	bf 01 00 00 00       	mov    $0x1,%edi
+  201eff:	b8 00 00 00 00       	mov    $0x0,%eax
+  201f04:	e8 5b fb ff ff       	call   201a64 <app_printf>
+            break;
+  201f09:	e9 1c ff ff ff       	jmp    201e2a <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "No space left on device");
+  201f0e:	48 8d 15 63 03 00 00 	lea    0x363(%rip),%rdx        # 202278 <lower_digits.0+0x98>
+  201f15:	48 8d 35 fa 02 00 00 	lea    0x2fa(%rip),%rsi        # 202216 <lower_digits.0+0x36>
+  201f1c:	bf 01 00 00 00       	mov    $0x1,%edi
+  201f21:	b8 00 00 00 00       	mov    $0x0,%eax
+  201f26:	e8 39 fb ff ff       	call   201a64 <app_printf>
+            break;
+  201f2b:	e9 fa fe ff ff       	jmp    201e2a <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "File already exists");
+  201f30:	48 8d 15 59 03 00 00 	lea    0x359(%rip),%rdx        # 202290 <lower_digits.0+0xb0>
+  201f37:	48 8d 35 d8 02 00 00 	lea    0x2d8(%rip),%rsi        # 202216 <lower_digits.0+0x36>
+  201f3e:	bf 01 00 00 00       	mov    $0x1,%edi
+  201f43:	b8 00 00 00 00       	mov    $0x0,%eax
+  201f48:	e8 17 fb ff ff       	call   201a64 <app_printf>
+            break;
+  201f4d:	e9 d8 fe ff ff       	jmp    201e2a <app_print_error+0x3c>
+            app_printf(1, "Error: %s\n", "File name too long");
+  201f52:	48 8d 15 4b 03 00 00 	lea    0x34b(%rip),%rdx        # 2022a4 <lower_digits.0+0xc4>
+  201f59:	48 8d 35 b6 02 00 00 	lea    0x2b6(%rip),%rsi        # 202216 <lower_digits.0+0x36>
+  201f60:	bf 01 00 00 00       	mov    $0x1,%edi
+  201f65:	b8 00 00 00 00       	mov    $0x0,%eax
+  201f6a:	e8 f5 fa ff ff       	call   201a64 <app_printf>
+            break;
+  201f6f:	e9 b6 fe ff ff       	jmp    201e2a <app_print_error+0x3c>
+            app_printf(1, "Error %d: %s\n", r, "Unknown error");
+  201f74:	48 8d 0d 3c 03 00 00 	lea    0x33c(%rip),%rcx        # 2022b7 <lower_digits.0+0xd7>
+  201f7b:	89 fa                	mov    %edi,%edx
+  201f7d:	48 8d 35 41 03 00 00 	lea    0x341(%rip),%rsi        # 2022c5 <lower_digits.0+0xe5>
+  201f84:	bf 01 00 00 00       	mov    $0x1,%edi
+  201f89:	b8 00 00 00 00       	mov    $0x0,%eax
+  201f8e:	e8 d1 fa ff ff       	call   201a64 <app_printf>
+}
+  201f93:	e9 92 fe ff ff       	jmp    201e2a <app_print_error+0x3c>
+
+0000000000201f98 <handle_error>:
+
+__attribute__((noreturn)) void handle_error(int r) {
+  201f98:	55                   	push   %rbp
+  201f99:	48 89 e5             	mov    %rsp,%rbp
+  201f9c:	53                   	push   %rbx
+  201f9d:	48 83 ec 08          	sub    $0x8,%rsp
+  201fa1:	89 fb                	mov    %edi,%ebx
+    app_print_error(r);
+  201fa3:	e8 46 fe ff ff       	call   201dee <app_print_error>
+    asm volatile ("syscall" : "=a" (rax)
+  201fa8:	b8 40 00 00 00       	mov    $0x40,%eax
+  201fad:	89 df                	mov    %ebx,%edi
+  201faf:	0f 05                	syscall
+ spinloop: goto spinloop;       // should never get here
+  201fb1:	eb fe                	jmp    201fb1 <handle_error+0x19>
+
+0000000000201fb3 <malloc>:
+
+// The heap starts 1MB above the program image (PROC_START_ADDR)
+static uint8_t* heap_top = (uint8_t*) 0x300000;
+static uint8_t* page_top = (uint8_t*) 0x300000;
+
+void* malloc(size_t size) {
+  201fb3:	48 89 fe             	mov    %rdi,%rsi
+    while (ROUNDDOWN(heap_top + size, PAGESIZE) >= page_top) {
+  201fb6:	48 8b 05 53 10 00 00 	mov    0x1053(%rip),%rax        # 203010 <heap_top>
+  201fbd:	48 8d 14 38          	lea    (%rax,%rdi,1),%rdx
+  201fc1:	48 8b 3d 40 10 00 00 	mov    0x1040(%rip),%rdi        # 203008 <page_top>
+  201fc8:	48 89 d1             	mov    %rdx,%rcx
+  201fcb:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  201fd2:	48 39 f9             	cmp    %rdi,%rcx
+  201fd5:	72 3e                	jb     202015 <malloc+0x62>
+    asm volatile ("syscall" : "=a" (result)
+  201fd7:	41 b8 3b 00 00 00    	mov    $0x3b,%r8d
+  201fdd:	44 89 c0             	mov    %r8d,%eax
+  201fe0:	0f 05                	syscall
+        int r = sys_page_alloc(page_top);
+        assert(r >= 0);
+  201fe2:	85 c0                	test   %eax,%eax
+  201fe4:	78 37                	js     20201d <malloc+0x6a>
+        page_top += PAGESIZE;
+  201fe6:	48 8b 05 1b 10 00 00 	mov    0x101b(%rip),%rax        # 203008 <page_top>
+  201fed:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  201ff4:	48 89 3d 0d 10 00 00 	mov    %rdi,0x100d(%rip)        # 203008 <page_top>
+    while (ROUNDDOWN(heap_top + size, PAGESIZE) >= page_top) {
+  201ffb:	48 8b 05 0e 10 00 00 	mov    0x100e(%rip),%rax        # 203010 <heap_top>
+  202002:	48 8d 14 30          	lea    (%rax,%rsi,1),%rdx
+  202006:	48 89 d1             	mov    %rdx,%rcx
+  202009:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  202010:	48 39 f9             	cmp    %rdi,%rcx
+  202013:	73 c8                	jae    201fdd <malloc+0x2a>
+    }
+
+    void* addr = heap_top;
+    heap_top += size;
+  202015:	48 89 15 f4 0f 00 00 	mov    %rdx,0xff4(%rip)        # 203010 <heap_top>
+    return addr;
+}
+  20201c:	c3                   	ret
+void* malloc(size_t size) {
+  20201d:	55                   	push   %rbp
+  20201e:	48 89 e5             	mov    %rsp,%rbp
+        assert(r >= 0);
+  202021:	48 8d 15 95 03 00 00 	lea    0x395(%rip),%rdx        # 2023bd <col.0+0x5>
+  202028:	be 0b 00 00 00       	mov    $0xb,%esi
+  20202d:	48 8d 3d 90 03 00 00 	lea    0x390(%rip),%rdi        # 2023c4 <col.0+0xc>
+  202034:	e8 b0 fb ff ff       	call   201be9 <assert_fail>
@@ -10,7 +10,7 @@ uint8_t* stack_bottom;
 
 void process_main(void) {
 
-    pid_t p = sys_getpid();
+    pid_t p = getpid();
     srand(p);
 
     //app_printf(p, "process_main, pid: %d\n", p);
@@ -16,13 +16,44 @@ void __attribute__((noreturn)) usage(void) {
 }
 
 
+// The files are opened, sized and read with the I/O ring: one batch of
+// requests, and one system call, per step for all the files.
+#define BATCH_SIZE 32
+
+static io_ring* ring = (io_ring*) IORING_ADDR;
+
+static void submit(uint32_t op, int fd, const void* addr, size_t len,
+                   void* arg, uint64_t user_data) {
+    io_sqe* sqe = &ring->sq[ring->sq_tail % IORING_ENTRIES];
+    sqe->op = op;
+    sqe->fd = fd;
+    sqe->addr = (uintptr_t) addr;
+    sqe->len = len;
+    sqe->arg = (uintptr_t) arg;
+    sqe->user_data = user_data;
+    ++ring->sq_tail;
+}
+
+// complete(res)
+//    Run the queued requests, storing each result in `res[user_data]`.
+static void complete(int64_t* res) {
+    while (ring->sq_head != ring->sq_tail) {
+        int r = sys_ioring_enter();
+        if (r < 0) handle_error(-r);
+        for (; ring->cq_head != ring->cq_tail; ++ring->cq_head) {
+            io_cqe* cqe = &ring->cq[ring->cq_head % IORING_ENTRIES];
+            res[cqe->user_data] = cqe->res;
+        }
+    }
+}
+
+
 void process_main(int argc, char* argv[]) {
     if (argc <= 1) usage();
     
-    int read_count;
+    int read_count = 0;
 
     if (argc == 2) {
-        read_count = 1024;
         argc++;
     } else {
         int r = string_to_char(argv[argc-1], &read_count);
@@ -32,18 +63,50 @@ void process_main(int argc, char* argv[]) {
 
     //app_printf(0, "read_count : %d\n", read_count);
 
-    for (int i = 1; i < argc-1; i++) {
-        char *pathname = argv[i];
-        int fd = sys_open(pathname);
-        if (fd < 0) handle_error(-fd);
+    int r = sys_ioring_setup(ring);
+    if (r < 0) handle_error(-r);
 
-        char *buf = (char *) malloc(read_count+1);
-    
-        int r = sys_read(fd, (void *) buf, read_count);
-        if (r < 0) handle_error(-r);
-        buf[r] = '\0';
+    static int64_t fds[BATCH_SIZE], counts[BATCH_SIZE];
+    static struct stat st[BATCH_SIZE];
+    static char *bufs[BATCH_SIZE];
+
+    for (int first = 1; first < argc-1; first += BATCH_SIZE) {
+        int n = MIN(argc-1 - first, BATCH_SIZE);
+
+        for (int i = 0; i < n; i++) {
+            submit(IORING_OP_OPEN, 0, argv[first+i], 0, NULL, i);
+        }
+        complete(fds);
+        for (int i = 0; i < n; i++) {
+            if (fds[i] < 0) handle_error(-fds[i]);
+        }
+
+        // Without an explicit count, read the whole file
+        for (int i = 0; i < n; i++) {
+            counts[i] = read_count;
+            if (read_count == 0) {
+                submit(IORING_OP_FSTAT, fds[i], NULL, 0, &st[i], i);
+            }
+        }
+        if (read_count == 0) {
+            complete(counts);
+            for (int i = 0; i < n; i++) {
+                if (counts[i] < 0) handle_error(-counts[i]);
+                counts[i] = st[i].st_size;
+            }
+        }
+
+        for (int i = 0; i < n; i++) {
+            bufs[i] = (char *) malloc(counts[i]+1);
+            submit(IORING_OP_READ, fds[i], bufs[i], counts[i], NULL, i);
+        }
+        complete(counts);
 
-        app_printf(4, "%s", buf);
+        for (int i = 0; i < n; i++) {
+            if (counts[i] < 0) handle_error(-counts[i]);
+            bufs[i][counts[i]] = '\0';
+            app_printf(4, "%s", bufs[i]);
+        }
     }
 
     sys_exit(0);
@@ -16,7 +16,7 @@ void process_main(void) {
     assert(p2 >= 0);
 
     // Check fork return values: fork should return 0 to child.
-    if (sys_getpid() == 1) {
+    if (getpid() == 1) {
         //assert(p1 != 0);
         assert(p1 != 0 && p2 != 0 && p1 != p2);
     } else {
@@ -30,7 +30,7 @@ void process_main(void) {
 
     // The rest of this code is like p-allocator.c.
 
-    pid_t p = sys_getpid();
+    pid_t p = getpid();
     srand(p);
 
     // The heap starts on the page right after the 'end' symbol,
@@ -0,0 +1,84 @@
+#include "process.h"
+#include "lib.h"
+
+// iotest: write a scratch file with sys_writev, patch it with sys_pwrite,
+// and read it back with sys_pread and sys_readv, checking every byte.
+// Prints "iotest: ok", or the step that failed.
+
+#define PATH "/iotest.tmp"
+#define PIECES 4
+#define PIECE_SIZE 1500                 // pieces straddle file blocks
+
+static char data[PIECES][PIECE_SIZE];
+static char back[PIECES][PIECE_SIZE];
+
+
+static void __attribute__((noreturn)) fail(const char* step, ssize_t r) {
+    app_printf(1, "iotest: %s failed (%d)\n", step, (int) r);
+    sys_remove(PATH);
+    sys_exit(1);
+}
+
+static int same(const char* a, const char* b, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        if (a[i] != b[i]) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+
+void process_main(void) {
+    for (int i = 0; i < PIECES; ++i) {
+        for (int j = 0; j < PIECE_SIZE; ++j) {
+            data[i][j] = 'a' + (i * 7 + j) % 26;
+        }
+    }
+
+    int r = sys_touch(PATH);
+    if (r < 0) handle_error(-r);
+
+    int fd = sys_open(PATH);
+    if (fd < 0) fail("open", fd);
+
+    iovec iov[PIECES];
+    for (int i = 0; i < PIECES; ++i) {
+        iov[i].iov_base = data[i];
+        iov[i].iov_len = PIECE_SIZE;
+    }
+    ssize_t n = sys_writev(fd, iov, PIECES);
+    if (n != PIECES * PIECE_SIZE) fail("writev", n);
+
+    // overwrite piece 2 in place, then read it alone
+    for (int j = 0; j < PIECE_SIZE; ++j) {
+        data[2][j] = '0' + j % 10;
+    }
+    n = sys_pwrite(fd, data[2], PIECE_SIZE, 2 * PIECE_SIZE);
+    if (n != PIECE_SIZE) fail("pwrite", n);
+
+    n = sys_pread(fd, back[2], PIECE_SIZE, 2 * PIECE_SIZE);
+    if (n != PIECE_SIZE || !same(back[2], data[2], PIECE_SIZE)) fail("pread", n);
+
+    // pwrite left the offset at the end of the file: nothing to read
+    n = sys_read(fd, back[0], PIECE_SIZE);
+    if (n != 0) fail("read at end", n);
+
+    // a new descriptor reads the whole file from the start
+    fd = sys_open(PATH);
+    if (fd < 0) fail("open", fd);
+    for (int i = 0; i < PIECES; ++i) {
+        iov[i].iov_base = back[i];
+    }
+    n = sys_readv(fd, iov, PIECES);
+    if (n != PIECES * PIECE_SIZE) fail("readv", n);
+    for (int i = 0; i < PIECES; ++i) {
+        if (!same(back[i], data[i], PIECE_SIZE)) fail("readv", i);
+    }
+
+    r = sys_remove(PATH);
+    if (r < 0) handle_error(-r);
+
+    app_printf(0, "iotest: ok\n");
+    sys_exit(0);
+}
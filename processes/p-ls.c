@@ -23,13 +23,21 @@ void process_main(int argc, char* argv[]) {
         path = argv[1];
     }
 
-    char buffer[64];
-
-    int r = sys_listdir(path, buffer);
-    if (r < 0)
-        handle_error(-r);
-
-    app_printf(0, "%s", buffer);
+    dirent ents[8];
+    unsigned cookie = 0;
+
+    while (1) {
+        int r = sys_getdents(path, ents, sizeof(ents), cookie);
+        if (r < 0)
+            handle_error(-r);
+        if (r == 0)
+            break;
+
+        for (int i = 0; i < r; i++) {
+            app_printf(0, "%s%s\n", ents[i].d_name, ents[i].d_type == DT_DIR ? "/" : "");
+        }
+        cookie += r;
+    }
 
     sys_exit(0);
 }
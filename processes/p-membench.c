@@ -0,0 +1,83 @@
+#include "process.h"
+#include "lib.h"
+
+// membench: compare lib.c's memcpy, memmove and memset against plain byte
+// loops across sizes. Prints the average cycles per call (rdtsc).
+
+#define MAX_SIZE 16384
+#define ROUNDS 64
+
+static char src[MAX_SIZE + 16];
+static char dst[MAX_SIZE + 16];
+
+static const size_t sizes[] = { 8, 64, 256, 1024, 4096, MAX_SIZE };
+
+
+static void* byte_memcpy(void* d, const void* s, size_t n) {
+    volatile char* vd = (volatile char*) d;
+    const char* cs = (const char*) s;
+    for (; n > 0; --n) {
+        *vd++ = *cs++;
+    }
+    return d;
+}
+
+static void* byte_memmove(void* d, const void* s, size_t n) {
+    volatile char* vd = (volatile char*) d + n;
+    const char* cs = (const char*) s + n;
+    for (; n > 0; --n) {
+        *--vd = *--cs;
+    }
+    return d;
+}
+
+static void* byte_memset(void* d, int c, size_t n) {
+    volatile char* vd = (volatile char*) d;
+    for (; n > 0; --n) {
+        *vd++ = c;
+    }
+    return d;
+}
+
+
+// bench(op, n, misalign)
+//    Return the average cycles of operation `op` on `n` bytes, with the
+//    destination offset by `misalign` bytes.
+static uint64_t bench(int op, size_t n, size_t misalign) {
+    char* d = dst + misalign;
+    uint64_t start = read_cycle_counter();
+    for (int i = 0; i < ROUNDS; ++i) {
+        switch (op) {
+        case 0: memcpy(d, src, n); break;
+        case 1: byte_memcpy(d, src, n); break;
+        case 2: memmove(d, d - misalign, n); break;
+        case 3: byte_memmove(d, d - misalign, n); break;
+        case 4: memset(d, i, n); break;
+        case 5: byte_memset(d, i, n); break;
+        }
+    }
+    return (read_cycle_counter() - start) / ROUNDS;
+}
+
+
+void process_main(void) {
+    for (size_t i = 0; i < sizeof(src); ++i) {
+        src[i] = i;
+    }
+    // touch every page first so page faults stay out of the timings
+    memset(dst, 0, sizeof(dst));
+
+    app_printf(0, "%6s %9s %9s %9s %9s %9s %9s\n", "bytes",
+               "memcpy", "bytes", "memmove", "bytes", "memset", "bytes");
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i) {
+        size_t n = sizes[i];
+        app_printf(0, "%6u", (unsigned) n);
+        for (int op = 0; op < 6; ++op) {
+            // memmove overlaps source and destination by 8 bytes less 3
+            app_printf(0, " %9u", (unsigned) bench(op, n, op == 2 || op == 3 ? 5 : 0));
+        }
+        app_printf(0, "\n");
+        sys_yield();
+    }
+    sys_exit(0);
+}
@@ -0,0 +1,107 @@
+#include "process.h"
+#include "lib.h"
+
+// mmaptest: map a scratch file, write to it through the mapping and
+// through a file descriptor, and check that each side sees the other's
+// writes: after sys_msync, after sys_munmap, and while mapped. Then map
+// more pages than the kernel keeps mapped at once, so that a dirty page
+// is evicted and must be written back. Prints "mmaptest: ok", or the step
+// that failed.
+
+#define PATH "/mmaptest.tmp"
+#define FILE_SIZE 9000                  // three pages, the last partial
+#define BIG_PAGES 68                    // more than MMAP_PAGES in k-mmap.c
+
+// free address space between the reserved pages and the heap
+#define MAP_ADDR ((char*) 0x280000)
+
+static char data[FILE_SIZE];
+static char back[FILE_SIZE];
+
+
+static void __attribute__((noreturn)) fail(const char* step, ssize_t r) {
+    app_printf(1, "mmaptest: %s failed (%d)\n", step, (int) r);
+    sys_remove(PATH);
+    sys_exit(1);
+}
+
+static int same(const char* a, const char* b, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        if (a[i] != b[i]) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+// check_file(step)
+//    Read the whole file through a new descriptor and compare it to `data`.
+static void check_file(const char* step) {
+    int fd = sys_open(PATH);
+    if (fd < 0) fail(step, fd);
+    ssize_t n = sys_pread(fd, back, FILE_SIZE, 0);
+    if (n != FILE_SIZE || !same(back, data, FILE_SIZE)) fail(step, n);
+}
+
+
+void process_main(void) {
+    for (int i = 0; i < FILE_SIZE; ++i) {
+        data[i] = 'a' + i % 26;
+    }
+
+    int r = sys_touch(PATH);
+    if (r < 0) handle_error(-r);
+
+    int fd = sys_open(PATH);
+    if (fd < 0) fail("open", fd);
+    ssize_t n = sys_write(fd, data, FILE_SIZE);
+    if (n != FILE_SIZE) fail("write", n);
+
+    r = sys_mmap(MAP_ADDR, FILE_SIZE, PROT_READ | PROT_WRITE, fd);
+    if (r < 0) fail("mmap", r);
+    if (!same(MAP_ADDR, data, FILE_SIZE)) fail("mapped read", 0);
+
+    // writes through the mapping reach the file at msync
+    for (int i = 0; i < FILE_SIZE; i += 1000) {
+        MAP_ADDR[i] = data[i] = '#';
+    }
+    r = sys_msync(MAP_ADDR, FILE_SIZE);
+    if (r < 0) fail("msync", r);
+    check_file("read after msync");
+
+    // writes through a descriptor show in the mapping
+    data[4100] = MAP_ADDR[4100] = '*';
+    n = sys_pwrite(fd, "0123456789", 10, 5000);
+    if (n != 10) fail("pwrite", n);
+    memcpy(data + 5000, "0123456789", 10);
+    if (!same(MAP_ADDR, data, FILE_SIZE)) fail("mapped read after pwrite", 0);
+
+    // and are not undone by the writeback at munmap
+    r = sys_munmap(MAP_ADDR, FILE_SIZE);
+    if (r < 0) fail("munmap", r);
+    check_file("read after munmap");
+
+    // reading the whole big mapping evicts page 0, dirty, on the way
+    for (int i = 0; i < BIG_PAGES; ++i) {
+        memset(back, 'A' + i % 26, PAGESIZE);
+        n = sys_pwrite(fd, back, PAGESIZE, (off_t) i * PAGESIZE);
+        if (n != PAGESIZE) fail("big write", n);
+    }
+    r = sys_mmap(MAP_ADDR, BIG_PAGES * PAGESIZE, PROT_READ | PROT_WRITE, fd);
+    if (r < 0) fail("big mmap", r);
+    MAP_ADDR[0] = '#';
+    for (int i = 1; i < BIG_PAGES; ++i) {
+        if (MAP_ADDR[i * PAGESIZE] != 'A' + i % 26) fail("big mapped read", i);
+    }
+    n = sys_pread(fd, back, 1, 0);
+    if (n != 1 || back[0] != '#') fail("read after eviction", n);
+    if (MAP_ADDR[0] != '#') fail("mapped read after eviction", 0);
+    r = sys_munmap(MAP_ADDR, BIG_PAGES * PAGESIZE);
+    if (r < 0) fail("big munmap", r);
+
+    r = sys_remove(PATH);
+    if (r < 0) handle_error(-r);
+
+    app_printf(0, "mmaptest: ok\n");
+    sys_exit(0);
+}
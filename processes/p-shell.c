@@ -1,5 +1,6 @@
 #include "process.h"
 #include "lib.h"
+#include "errno.h"
 
 #define LINE_LENGTH 80
 
@@ -38,19 +39,19 @@ int exec_simple_cmd(char** cmd_line) {
         sys_exit(0);
     }
 
-    int pid = sys_fork();
-    assert(pid >= 0);
-
+    int pid = sys_spawn(cmd, cmd_line);
     if (pid == 0) {
-        // child process
-        //app_printf(1, "cmdline[0] : %p\n", cmd_line[0]);
-        //app_printf(1, "cmdline : %p\n", cmd_line);
-        sys_execv(cmd, cmd_line);
+        // kernel builtin
+        return 0;
+    }
+    if (pid == -ENOENT) {
         app_printf(1, "command not found\n");
-        sys_exit(127);
+        return 127;
+    }
+    if (pid < 0) {
+        app_print_error(-pid);
+        return -pid;
     }
-
-    // parent process
 
     int exit_code;
     r = sys_wait(pid, &exit_code);